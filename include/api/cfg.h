@@ -56,6 +56,7 @@ class TrainCfg {
     this->loss_name_ = rhs.loss_name_;
     this->mix_precision_cfg_ = rhs.mix_precision_cfg_;
     this->accumulate_gradients_ = rhs.accumulate_gradients_;
+    this->recompute_memory_budget_ = rhs.recompute_memory_budget_;
   }
   ~TrainCfg() = default;
 
@@ -64,6 +65,7 @@ class TrainCfg {
     "loss_fct", "_loss_fn", "SigmoidCrossEntropy"}; /**< Set part of the name that identify a loss kernel */
   MixPrecisionCfg mix_precision_cfg_;               /**< Mix precision configuration */
   bool accumulate_gradients_ = false;
+  size_t recompute_memory_budget_ = 0; /**< Tensor memory budget in bytes, activations are recomputed to fit it */
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_INCLUDE_API_CFG_H
@@ -216,8 +216,28 @@ class MS_API CPUDeviceInfo : public DeviceInfoContext {
   ///
   /// \return Whether enable float16 inference.
   bool GetEnableFP16() const;
+
+  /// \brief Set the precision mode.
+  ///
+  /// \param[in] precision_mode Optional "origin", "bf16". "origin" is set as default. "bf16" stores the constant
+  /// weights of matmul and convolution in bfloat16 and accumulates in float32 on the CPUs supporting bfloat16.
+  inline void SetPrecisionMode(const std::string &precision_mode);
+
+  /// \brief Get the precision mode.
+  ///
+  /// \return The precision mode.
+  inline std::string GetPrecisionMode() const;
+
+ private:
+  void SetPrecisionMode(const std::vector<char> &precision_mode);
+  std::vector<char> GetPrecisionModeChar() const;
 };
 
+void CPUDeviceInfo::SetPrecisionMode(const std::string &precision_mode) {
+  SetPrecisionMode(StringToChar(precision_mode));
+}
+std::string CPUDeviceInfo::GetPrecisionMode() const { return CharToString(GetPrecisionModeChar()); }
+
 /// \brief Derived from DeviceInfoContext, The configuration of the model running on the NPU. This option is only valid
 /// for MindSpore Lite.
 class MS_API KirinNPUDeviceInfo : public DeviceInfoContext {
@@ -37,6 +37,40 @@ namespace mindspore {
 namespace opt::dynamic_shape {
 namespace {
 constexpr int64_t kInvalidShape = -2;
+// Print the hit rate of the resize cache every so many lookups.
+constexpr size_t kResizeCachePrintInterval = 10000;
+
+// The input shapes of the last infer and resize of the kernel.
+struct KernelShapeCache {
+  bool cacheable{false};
+  bool infer_valid{false};
+  bool resize_valid{false};
+  std::vector<ShapeVector> infer_input_shapes;
+  std::vector<ShapeVector> resize_input_shapes;
+};
+using KernelShapeCachePtr = std::shared_ptr<KernelShapeCache>;
+
+bool IsKernelShapeCacheable(const CNodePtr &kernel) {
+  if (!abstract::GetValueDependArgIndices(kernel).empty()) {
+    return false;
+  }
+  if (kComputeDepend.find(common::AnfAlgo::GetCNodeName(kernel)) != kComputeDepend.end()) {
+    return false;
+  }
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel);
+  return kernel_mod != nullptr && !kernel_mod->IsNeedRetrieveOutputShape();
+}
+
+std::vector<ShapeVector> GetKernelInputShapes(const CNodePtr &kernel) {
+  std::vector<ShapeVector> input_shapes;
+  auto input_size = common::AnfAlgo::GetInputTensorNum(kernel);
+  for (size_t i = 0; i < input_size; ++i) {
+    auto input_node_with_index = common::AnfAlgo::GetPrevNodeOutput(kernel, i, false);
+    (void)input_shapes.emplace_back(
+      common::AnfAlgo::GetOutputInferShape(input_node_with_index.first, input_node_with_index.second));
+  }
+  return input_shapes;
+}
 
 void InferShapeForNopNode(const AnfNodePtr &input_node) {
   MS_EXCEPTION_IF_NULL(input_node);
@@ -212,6 +246,10 @@ AnfNodePtr GenInitNode(const AnfNodePtr &node) {
   auto kernel_mod = AnfAlgo::GetKernelMod(cnode);
   MS_EXCEPTION_IF_NULL(kernel_mod);
   AnfUtils::CustomActorCallback actor_func = [kernel_mod, cnode](void *) {
+    if (ResizeCache::GetInstance().CheckResizeHit(cnode)) {
+      MS_LOG(DEBUG) << "The input shapes of " << cnode->fullname_with_scope() << " are not changed, skip the resize.";
+      return;
+    }
     auto args = cnode->user_data<kernel::KernelArgs>();
     if (args == nullptr) {
       args = std::make_shared<kernel::KernelArgs>();
@@ -235,6 +273,10 @@ void InferOp(const CNodePtr &cnode, void *args) {
     MS_LOG(WARNING) << "The node " << cnode->fullname_with_scope() << " is not dynamic shape.";
     return;
   }
+  if (ResizeCache::GetInstance().CheckInferHit(cnode)) {
+    MS_LOG(DEBUG) << "The input shapes of " << cnode->fullname_with_scope() << " are not changed, skip the infer.";
+    return;
+  }
   kernel::KernelArgs kernel_args;
   if (AnfAlgo::IsDynamicShapeSkipExecute(cnode)) {
     std::vector<TypeId> dtypes{common::AnfAlgo::GetOutputInferDataType(cnode, 0)};
@@ -253,6 +295,56 @@ void InferOp(const CNodePtr &cnode, void *args) {
   }
 }
 
+ResizeCache &ResizeCache::GetInstance() {
+  static ResizeCache instance;
+  return instance;
+}
+
+ResizeCache::ResizeCache() { enable_ = (common::GetEnv("MS_DEV_DISABLE_RESIZE_CACHE") != "1"); }
+
+bool ResizeCache::CheckInferHit(const CNodePtr &kernel) { return CheckHit(kernel, true); }
+
+bool ResizeCache::CheckResizeHit(const CNodePtr &kernel) { return CheckHit(kernel, false); }
+
+bool ResizeCache::CheckHit(const CNodePtr &kernel, bool is_infer) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  if (!enable_) {
+    return false;
+  }
+  auto cache = kernel->user_data<KernelShapeCache>();
+  if (cache == nullptr) {
+    cache = std::make_shared<KernelShapeCache>();
+    cache->cacheable = IsKernelShapeCacheable(kernel);
+    kernel->set_user_data<KernelShapeCache>(cache);
+  }
+  if (!cache->cacheable) {
+    return false;
+  }
+  auto input_shapes = GetKernelInputShapes(kernel);
+  auto &valid = is_infer ? cache->infer_valid : cache->resize_valid;
+  auto &last_input_shapes = is_infer ? cache->infer_input_shapes : cache->resize_input_shapes;
+  bool hit = valid && input_shapes == last_input_shapes;
+  if (!hit) {
+    last_input_shapes = std::move(input_shapes);
+    valid = true;
+  }
+  auto &hit_num = is_infer ? infer_hit_num_ : resize_hit_num_;
+  auto &miss_num = is_infer ? infer_miss_num_ : resize_miss_num_;
+  hit ? ++hit_num : ++miss_num;
+  if (!is_infer && (resize_hit_num_ + resize_miss_num_) % kResizeCachePrintInterval == 0) {
+    PrintHitRate();
+  }
+  return hit;
+}
+
+void ResizeCache::PrintHitRate() const {
+  auto rate = [](size_t hit, size_t miss) { return hit + miss == 0 ? 0.0 : static_cast<double>(hit) / (hit + miss); };
+  MS_LOG(INFO) << "Resize cache of the dynamic shape kernels, infer hit " << infer_hit_num_ << " miss "
+               << infer_miss_num_ << " (hit rate " << rate(infer_hit_num_, infer_miss_num_) << "), resize hit "
+               << resize_hit_num_ << " miss " << resize_miss_num_ << " (hit rate "
+               << rate(resize_hit_num_, resize_miss_num_) << ").";
+}
+
 CustomActorNodeManager &CustomActorNodeManager::Instance() {
   static CustomActorNodeManager instance{};
   return instance;
@@ -17,6 +17,8 @@
 #ifndef MINDSPORE_CCSRC_BACKEND_COMMON_OPTIMIZER_DYNAMIC_SHAPE_DYNAMIC_SHAPE_HELPER_H
 #define MINDSPORE_CCSRC_BACKEND_COMMON_OPTIMIZER_DYNAMIC_SHAPE_DYNAMIC_SHAPE_HELPER_H
 
+#include <atomic>
+#include <vector>
 #include "ir/anf.h"
 #include "utils/ms_utils.h"
 #include "backend/common/optimizer/optimizer.h"
@@ -27,6 +29,42 @@ void InferOp(const CNodePtr &node, void *args = nullptr);
 AnfNodePtr GenInferNode(const AnfNodePtr &node);
 AnfNodePtr GenInitNode(const AnfNodePtr &node);
 
+// The cache of the infer and resize of the dynamic shape kernels. The output shapes set by InferShape and the
+// workspace sizes and tiling kept in the kernel mod by Resize only depend on the input shapes for most kernels, so
+// the infer and resize are skipped when the input shapes are the same as the last time of the kernel. The kernels
+// depending on the input values or retrieving the output shapes after launch are not cached. The cache is disabled
+// by env MS_DEV_DISABLE_RESIZE_CACHE=1.
+class ResizeCache {
+ public:
+  static ResizeCache &GetInstance();
+
+  bool enable() const { return enable_; }
+
+  // Return true if the infer of the kernel can be skipped, otherwise record the current input shapes.
+  bool CheckInferHit(const CNodePtr &kernel);
+  // Return true if the resize of the kernel can be skipped, otherwise record the current input shapes.
+  bool CheckResizeHit(const CNodePtr &kernel);
+
+  size_t infer_hit_num() const { return infer_hit_num_; }
+  size_t infer_miss_num() const { return infer_miss_num_; }
+  size_t resize_hit_num() const { return resize_hit_num_; }
+  size_t resize_miss_num() const { return resize_miss_num_; }
+
+ private:
+  ResizeCache();
+  ~ResizeCache() = default;
+  DISABLE_COPY_AND_ASSIGN(ResizeCache)
+
+  bool CheckHit(const CNodePtr &kernel, bool is_infer);
+  void PrintHitRate() const;
+
+  bool enable_{true};
+  std::atomic<size_t> infer_hit_num_{0};
+  std::atomic<size_t> infer_miss_num_{0};
+  std::atomic<size_t> resize_hit_num_{0};
+  std::atomic<size_t> resize_miss_num_{0};
+};
+
 struct RelatedCustomActorNode {
   AnfNodePtr infer_node;
   AnfNodePtr init_node;
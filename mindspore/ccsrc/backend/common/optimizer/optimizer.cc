@@ -62,6 +62,14 @@ AnfNodePtr PatternProcessPass::Run(const FuncGraphPtr &func_graph, const AnfNode
   return nullptr;
 }
 
+std::string PatternProcessPass::RootPrimitiveName() {
+  if (pattern_ == nullptr) {
+    Build();
+  }
+  auto primitive = GetCNodePrimitive(pattern_);
+  return primitive == nullptr ? "" : primitive->name();
+}
+
 std::vector<AnfNodePtr> PatternProcessPass::GetOrigNodes() const {
   std::vector<AnfNodePtr> orig_nodes;
   for (auto &prim_var : *primitive_vars_) {
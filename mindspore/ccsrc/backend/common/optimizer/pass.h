@@ -33,6 +33,9 @@ class Pass {
   explicit Pass(const std::string &name = "pass") : name_(name) {}
   virtual ~Pass() = default;
   virtual bool Run(const FuncGraphPtr &func_graph) = 0;
+  // The primitive name of the nodes the pass starts to match from, empty if the pass may change any node.
+  // The pass manager skips the pass when no node of this primitive is in the graph.
+  virtual std::string RootPrimitiveName() { return ""; }
   const std::string &name() const { return name_; }
   void SetCacheManager(const CacheManagerPtr &cm) { cache_manager_ = cm; }
   const CacheManagerPtr &GetCacheManager() const { return cache_manager_; }
@@ -17,15 +17,40 @@
 
 #include <sys/time.h>
 #include <deque>
+#include <limits>
 #include <string>
 #include "ir/anf.h"
 #include "ir/manager.h"
 #include "utils/ms_context.h"
+#include "utils/compile_profiler.h"
 #include "include/common/debug/anf_ir_dump.h"
 #include "include/common/utils/anfalgo.h"
+#include "utils/hash_set.h"
 
 namespace mindspore {
 namespace opt {
+namespace {
+constexpr size_t kDirtyVersion = std::numeric_limits<size_t>::max();
+
+// Collect the primitive names of all cnodes in the graph and its managed sub graphs.
+bool BuildPrimitiveIndex(const FuncGraphPtr &func_graph, mindspore::HashSet<std::string> *primitive_names) {
+  MS_EXCEPTION_IF_NULL(primitive_names);
+  primitive_names->clear();
+  auto manager = func_graph->manager();
+  if (manager == nullptr) {
+    return false;
+  }
+  manager->AddFuncGraph(func_graph);
+  for (const auto &node : manager->all_nodes()) {
+    auto primitive = GetCNodePrimitive(node);
+    if (primitive != nullptr) {
+      (void)primitive_names->insert(primitive->name());
+    }
+  }
+  return true;
+}
+}  // namespace
+
 void CacheManager::Update(const AnfNodePtr &node) {
   MS_EXCEPTION_IF_NULL(node);
   auto type_iter = type_map_.find(node);
@@ -104,7 +129,11 @@ bool PassManager::RunPass(const FuncGraphPtr &func_graph, size_t pass_id, const
   struct timeval end_time {};
   (void)gettimeofday(&start_time, nullptr);
 #endif
-  bool changed = pass->Run(func_graph);
+  bool changed = false;
+  {
+    CompileProfileScope profile_scope(GetPassFullname(pass_id, pass), "backend_pass", func_graph);
+    changed = pass->Run(func_graph);
+  }
   constexpr auto kMicroSendUnit = 1000000;
 #if defined(_WIN32) || defined(_WIN64)
   auto end_time = std::chrono::steady_clock::now();
@@ -140,31 +169,75 @@ void PassManager::DumpPassIR(const FuncGraphPtr &func_graph, const std::string &
 #endif
 }
 
-bool PassManager::Run(const FuncGraphPtr &func_graph, const std::vector<PassPtr> &passes) const {
+bool PassManager::RunDirtyPasses(const FuncGraphPtr &func_graph, const std::vector<PassPtr> &passes,
+                                 std::vector<size_t> *pass_versions, size_t *graph_version) const {
+  MS_EXCEPTION_IF_NULL(pass_versions);
+  MS_EXCEPTION_IF_NULL(graph_version);
   if (func_graph == nullptr) {
     return false;
   }
   bool changed = false;
   size_t num = 0;
-  for (const auto &pass : passes) {
-    if (pass != nullptr) {
-      pass->SetCacheManager(cache_manager_);
-      changed = RunPass(func_graph, num, pass) || changed;
-#ifdef ENABLE_DUMP_IR
-      DumpPassIR(func_graph, GetPassFullname(num, pass));
-#endif
+  // The primitive index is rebuilt only after a pass has run, the skipped passes do not touch the graph.
+  mindspore::HashSet<std::string> primitive_names;
+  bool index_dirty = true;
+  bool index_valid = false;
+  for (size_t i = 0; i < passes.size(); ++i) {
+    const auto &pass = passes[i];
+    if (pass == nullptr) {
+      continue;
+    }
+    if ((*pass_versions)[i] == *graph_version) {
+      MS_LOG(DEBUG) << "Skip pass " << GetPassFullname(num, pass) << ", the graph is not changed since its last run.";
       num++;
+      continue;
+    }
+    const auto &root_name = pass->RootPrimitiveName();
+    if (!root_name.empty()) {
+      if (index_dirty) {
+        index_valid = BuildPrimitiveIndex(func_graph, &primitive_names);
+        index_dirty = false;
+      }
+      if (index_valid && primitive_names.count(root_name) == 0) {
+        MS_LOG(DEBUG) << "Skip pass " << GetPassFullname(num, pass) << ", no " << root_name << " node in the graph.";
+        (*pass_versions)[i] = *graph_version;
+        num++;
+        continue;
+      }
+    }
+    pass->SetCacheManager(cache_manager_);
+    bool pass_changed = RunPass(func_graph, num, pass);
+    index_dirty = true;
+    if (pass_changed) {
+      ++(*graph_version);
+      // The pass may match again on the nodes it produces, so it is rerun in the next round.
+      (*pass_versions)[i] = kDirtyVersion;
+    } else {
+      (*pass_versions)[i] = *graph_version;
     }
+    changed = pass_changed || changed;
+#ifdef ENABLE_DUMP_IR
+    DumpPassIR(func_graph, GetPassFullname(num, pass));
+#endif
+    num++;
   }
   return changed;
 }
 
+bool PassManager::Run(const FuncGraphPtr &func_graph, const std::vector<PassPtr> &passes) const {
+  std::vector<size_t> pass_versions(passes.size(), kDirtyVersion);
+  size_t graph_version = 0;
+  return RunDirtyPasses(func_graph, passes, &pass_versions, &graph_version);
+}
+
 bool PassManager::Run(const FuncGraphPtr &func_graph) const {
   bool changed = false;
-  // run all passes
+  // run all passes, and in the later rounds only rerun the passes whose input graph has changed
+  std::vector<size_t> pass_versions(passes_.size(), kDirtyVersion);
+  size_t graph_version = 0;
   bool change = true;
   while (change) {
-    change = Run(func_graph, passes_);
+    change = RunDirtyPasses(func_graph, passes_, &pass_versions, &graph_version);
     changed = change || changed;
     if (run_only_once_) {
       break;
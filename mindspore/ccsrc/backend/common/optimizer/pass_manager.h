@@ -68,6 +68,12 @@ class BACKEND_EXPORT PassManager {
   virtual bool RunPass(const FuncGraphPtr &func_graph, size_t pass_id, const PassPtr &pass) const;
   virtual std::string GetPassFullname(size_t pass_id, const PassPtr &pass) const;
   virtual void DumpPassIR(const FuncGraphPtr &func_graph, const std::string &pass_fullname) const;
+  // Run the passes whose input graph may have changed since their last run, a pass is skipped if its graph version
+  // equals the current graph version, or if its root primitive is not in the graph
+  // @param [in out] pass_versions The graph version after each pass last ran, kDirtyVersion if it must run
+  // @param [in out] graph_version The graph version increased by every pass that changes the graph
+  bool RunDirtyPasses(const FuncGraphPtr &func_graph, const std::vector<PassPtr> &passes,
+                      std::vector<size_t> *pass_versions, size_t *graph_version) const;
 
   const std::string name_;
   std::vector<PassPtr> passes_;
@@ -18,6 +18,8 @@
 #include <vector>
 #include <set>
 #include <memory>
+#include <cmath>
+#include <algorithm>
 
 #include "utils/hash_map.h"
 #include "ir/graph_utils.h"
@@ -28,6 +30,8 @@
 #include "kernel/kernel_build_info.h"
 #include "backend/common/optimizer/helper.h"
 #include "include/common/utils/parallel_context.h"
+#include "distributed/collective/collective_manager.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace opt {
@@ -150,6 +154,12 @@ bool CommunicationOpFusion::GetSplitSegments(const CommunicationOpInfo &communic
     split_indices = parallel_context->GetAllReduceFusionSplitIndices(group);
   }
 
+  if (split_indices.empty() && op_name_ == kAllReduceOpName &&
+      GetAllReduceAutoSplitSegment(communication_op_info.communication_op_nodes, segment_index)) {
+    MS_LOG(INFO) << "The auto split segment num for AllReduce is " << segment_index->size();
+    return CheckSegments(communication_op_node_size, segment_index);
+  }
+
   if (!split_indices.empty()) {
     uint32_t last_index = 0;
     for (size_t i = 0; i < split_indices.size(); ++i) {
@@ -217,6 +227,55 @@ void CommunicationOpFusion::GetAllReduceSplitSegment(const std::vector<CNodePtr>
   *segment_index = std::move(real_segment_index);
 }
 
+bool CommunicationOpFusion::GetAllReduceAutoSplitSegment(const std::vector<CNodePtr> &nodes,
+                                                         std::vector<size_t> *segment_index) const {
+  MS_EXCEPTION_IF_NULL(segment_index);
+  static const bool enable_auto_split = (common::GetEnv("MS_DEV_ALLREDUCE_FUSION_AUTO") == "1");
+  if (!enable_auto_split || nodes.empty()) {
+    return false;
+  }
+  auto primitive = common::AnfAlgo::GetCNodePrimitive(nodes[0]);
+  MS_EXCEPTION_IF_NULL(primitive);
+  ValuePtr attr_group = primitive->GetAttr(kAttrGroup);
+  if (attr_group == nullptr) {
+    return false;
+  }
+  distributed::collective::CommCostModel cost_model;
+  const auto &group = GetValue<std::string>(attr_group);
+  if (!distributed::collective::CollectiveManager::instance()->GetAllReduceCostModel(group, &cost_model) ||
+      cost_model.alpha_ <= 0 || cost_model.beta_ <= 0) {
+    MS_LOG(INFO) << "No valid AllReduce cost model of group " << group << ", use the default fusion strategy.";
+    return false;
+  }
+
+  std::vector<size_t> tensor_sizes;
+  size_t total_size = 0;
+  for (const auto &node : nodes) {
+    auto tensor_size = AnfAlgo::GetOutputTensorMemSize(node, 0);
+    tensor_sizes.push_back(tensor_size);
+    total_size += tensor_size;
+  }
+  // The AllReduce of buckets are overlapped with the computation except the last one, the exposed communication time
+  // of n buckets is about n * alpha + beta * total_size / n, which is minimized by n = sqrt(beta * total_size / alpha).
+  auto bucket_num = std::sqrt(cost_model.beta_ * static_cast<double>(total_size) / cost_model.alpha_);
+  bucket_num = std::min(std::max(std::round(bucket_num), 1.0), static_cast<double>(nodes.size()));
+  auto bucket_size = static_cast<double>(total_size) / bucket_num;
+  MS_LOG(INFO) << "The AllReduce of group " << group << " total size: " << total_size
+               << ", auto bucket num: " << bucket_num << ", bucket size: " << bucket_size;
+
+  segment_index->clear();
+  double accumulate = 0;
+  for (size_t i = 0; i < nodes.size() - 1; ++i) {
+    accumulate += static_cast<double>(tensor_sizes[i]);
+    if (accumulate >= bucket_size) {
+      segment_index->push_back(i);
+      accumulate = 0;
+    }
+  }
+  segment_index->push_back(nodes.size() - 1);
+  return true;
+}
+
 // Hard coded Load(%paraxxx, cnode()) to Load(%paraxxx, U) to prevent
 // cycle after AllReduce fused. It's a workaround.
 // case 1:
@@ -44,6 +44,9 @@ class CommunicationOpFusion : public Pass {
                 const std::vector<size_t> &segment_index) const;
   void GetAllReduceSplitSegment(const std::vector<CNodePtr> &nodes, int64_t threshold,
                                 std::vector<size_t> *segment_index) const;
+  // Split the AllReduce nodes by the benchmarked latency and bandwidth of the communication group, which is enabled by
+  // the env MS_DEV_ALLREDUCE_FUSION_AUTO. Return false if the cost model is not available.
+  bool GetAllReduceAutoSplitSegment(const std::vector<CNodePtr> &nodes, std::vector<size_t> *segment_index) const;
   AnfNodePtr CreateFusedCommunicationOp(const FuncGraphPtr &func_graph,
                                         const CommunicationOpInfo &communication_op_info, size_t start_index,
                                         size_t end_index) const;
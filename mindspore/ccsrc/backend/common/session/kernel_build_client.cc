@@ -15,6 +15,7 @@
  */
 
 #include "backend/common/session/kernel_build_client.h"
+#include <algorithm>
 #include <memory>
 
 namespace mindspore {
@@ -27,6 +28,67 @@ void ReplaceStr(std::string *dest, const std::string &replace, char new_char) {
   }
 }
 
+namespace {
+// The number of the requests in flight when pipelining, which keeps the responses far below the pipe buffer, so the
+// server never blocks on writing the responses while the client is writing the requests.
+constexpr size_t kMaxPipelinedRequests = 64;
+}  // namespace
+
+std::string KernelBuildClient::Response() {
+  if (!init_) {
+    MS_LOG(EXCEPTION) << "Try to get response before Open()";
+  }
+  // One read may return the responses of several pipelined requests, split them by line and filter out the
+  // interference without the tag.
+  while (responses_.empty()) {
+    std::string buf;
+    *dp_ >> buf;
+    if (buf.empty()) {
+      MS_LOG(EXCEPTION) << "Response is empty";
+    }
+    std::string::size_type line_start = 0;
+    while (line_start <= buf.size()) {
+      auto line_end = buf.find('\n', line_start);
+      if (line_end == std::string::npos) {
+        line_end = buf.size();
+      }
+      auto start = buf.find(kTag, line_start);
+      if (start != std::string::npos && start < line_end) {
+        auto pos = start + std::strlen(kTag);
+        responses_.push_back(buf.substr(pos, line_end - pos));
+      }
+      line_start = line_end + 1;
+    }
+    if (responses_.empty()) {
+      MS_LOG(EXCEPTION) << "Response seems incorrect, res: " << buf;
+    }
+  }
+  auto res = responses_.front();
+  responses_.pop_front();
+  // Revert the line feed and space
+  if (res != kSuccess && res != kAck && res != kErr && res != kTrue) {
+    ReplaceStr(&res, kLF, '\n');
+    ReplaceStr(&res, kSP, ' ');
+  }
+  MS_LOG(DEBUG) << "\t[" << res << "]";
+  return res;
+}
+
+std::vector<std::string> KernelBuildClient::SendRequests(const std::vector<std::string> &data) {
+  std::lock_guard<std::mutex> locker(mutex_);
+  std::vector<std::string> res;
+  res.reserve(data.size());
+  size_t sent = 0;
+  while (res.size() < data.size()) {
+    auto send_end = std::min(data.size(), res.size() + kMaxPipelinedRequests);
+    for (; sent < send_end; ++sent) {
+      Request(data[sent]);
+    }
+    res.push_back(Response());
+  }
+  return res;
+}
+
 bool KernelBuildClient::AkgStart(int process_num, int wait_time) {
   // Start compiling..
   auto res = SendRequest(kAkgStart);
@@ -69,10 +131,10 @@ bool KernelBuildClient::AkgSendData(const std::vector<std::string> &jsons) {
     MS_LOG(ERROR) << "AKG/DATA failed, res: " << res;
     return false;
   }
-  for (auto &json : jsons) {
-    res = SendRequest(json);
-    if (res != kAck) {
-      MS_LOG(ERROR) << "AKG/DATA.. responds failed, res: " << res << ", when sending [" << json << "]";
+  auto responses = SendRequests(jsons);
+  for (size_t i = 0; i < responses.size(); ++i) {
+    if (responses[i] != kAck) {
+      MS_LOG(ERROR) << "AKG/DATA.. responds failed, res: " << responses[i] << ", when sending [" << jsons[i] << "]";
       return false;
     }
   }
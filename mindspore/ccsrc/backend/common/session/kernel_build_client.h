@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_BACKEND_SESSION_KERNEL_BUILD_CLIENT_H_
 #define MINDSPORE_CCSRC_BACKEND_SESSION_KERNEL_BUILD_CLIENT_H_
 
+#include <deque>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -82,6 +83,7 @@ class KernelBuildClient {
   void Close() noexcept {
     if (init_) {
       dp_->Close();
+      responses_.clear();
       init_ = false;
     }
   }
@@ -99,33 +101,10 @@ class KernelBuildClient {
     MS_LOG(DEBUG) << "\t[" << req << "]";
     *dp_ << req;
   }
-  std::string Response() {
-    if (!init_) {
-      MS_LOG(EXCEPTION) << "Try to get response before Open()";
-    }
-    std::string res;
-    *dp_ >> res;
-    // Filter out the interference
-    if (res.empty()) {
-      MS_LOG(EXCEPTION) << "Response is empty";
-    }
-    auto start = res.find(kTag);
-    if (start == std::string::npos) {
-      MS_LOG(EXCEPTION) << "Response seems incorrect, res: " << res;
-    }
-    auto pos = start + std::strlen(kTag);
-    if (pos > res.size()) {  // Safe check for codedex
-      MS_LOG(EXCEPTION) << "Response seems incorrect, res(" << res.size() << "): {" << res << "}, start: " << start;
-    }
-    res = res.substr(pos);
-    // Revert the line feed and space
-    if (res != kSuccess && res != kAck && res != kErr && res != kTrue) {
-      ReplaceStr(&res, kLF, '\n');
-      ReplaceStr(&res, kSP, ' ');
-    }
-    MS_LOG(DEBUG) << "\t[" << res << "]";
-    return res;
-  }
+  std::string Response();
+  // Send the requests without waiting for the response of each one, and fetch the responses in order, so the server
+  // handles the requests one after another without the round trip of the pipe between them.
+  std::vector<std::string> SendRequests(const std::vector<std::string> &data);
 
   // Run AKG building.
   bool AkgStart(int process_num, int wait_time);
@@ -142,6 +121,8 @@ class KernelBuildClient {
   std::mutex mutex_;
   bool init_;
   std::shared_ptr<DuplexPipe> dp_;
+  // The responses which are read from the pipe but not fetched yet.
+  std::deque<std::string> responses_;
 };
 
 static std::string GetScriptFilePath(const std::string &cmd_env, const std::string &cmd_script,
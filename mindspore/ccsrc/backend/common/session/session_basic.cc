@@ -2872,6 +2872,13 @@ void SessionBasic::InitAllBucket(const KernelGraphPtr &graph, const device::Devi
   auto split_index = GetAllReduceSplitIndex();
   PreProcessOnSplitIndex(graph, &split_index);
   auto bucket_size_list = GenerateBucketSizeList(graph, split_index);
+  // The split indices are in the order of parameters, while the grads are produced in the reverse order by the
+  // backward execution. Assign the buckets in the reverse order, so that the bucket of the last parameters is full and
+  // launched firstly, and its AllReduce is overlapped with the backward of the front parameters.
+  static const bool reverse_bucket_order = (common::GetEnv("MS_DEV_BUCKET_REVERSE_ORDER") == "1");
+  if (reverse_bucket_order) {
+    std::reverse(bucket_size_list.begin(), bucket_size_list.end());
+  }
   uint32_t bucket_id = 0;
   for (const auto &bucket_size : bucket_size_list) {
     MS_LOG(INFO) << "Create new bucket:" << bucket_id << " size:" << bucket_size;
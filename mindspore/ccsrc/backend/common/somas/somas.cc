@@ -52,6 +52,8 @@ constexpr size_t kRefNodeTensorNum = 2;
 constexpr auto kOnlyOneDestinationNode = 1;
 constexpr auto kOnlyTwoDestinationNode = 2;
 
+constexpr auto kSomasCacheVersion = 1;
+constexpr auto kVersion = "version";
 constexpr auto kGraphId = "graph_id";
 constexpr auto kHashId = "hash_id";
 constexpr auto kMemOffset = "mem_offset";
@@ -62,6 +64,7 @@ constexpr auto kRefNodeSize = "ref_node_size";
 constexpr auto kStreamSize = "stream_size";
 constexpr auto kStreamGroupSize = "stream_group_size";
 constexpr auto kTensors = "tensors";
+constexpr auto kContiguousLists = "contiguous_lists";
 
 constexpr auto kTensorId = "tensor_id";
 constexpr auto kSize = "size";
@@ -72,6 +75,21 @@ constexpr auto kLifeEnd = "life_end";
 constexpr auto kOffset = "offset";
 constexpr auto kCachedResultThreshold = 2000;
 
+namespace {
+// The somas result is saved with the compile cache, so the warm start can skip the conflict analysis and solving.
+bool IsCompileCacheEnabled() {
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  return !context_ptr->get_param<std::string>(MS_CTX_COMPILE_CACHE_PATH).empty() ||
+         !common::GetEnv(kCOMPILER_CACHE_PATH).empty();
+}
+
+bool NeedCacheSomasResult(size_t tensor_size) {
+  static const bool compile_cache_enabled = IsCompileCacheEnabled();
+  return compile_cache_enabled || tensor_size >= kCachedResultThreshold;
+}
+}  // namespace
+
 std::map<TensorType, std::string> tensor_type_name_map = {{kCommon, "Common"},
                                                           {kOutputOnly, "OutputOnly"},
                                                           {kWorkspace, "Workspace"},
@@ -123,9 +141,9 @@ bool Somas::Allocate(const session::KernelGraph *graph) {
 bool Somas::LoadSomasCache(const session::KernelGraph *graph) {
   MS_EXCEPTION_IF_NULL(graph);
   MS_LOG(DEBUG) << "Somas LoadSomasCache start...";
-  if (tensors_list_.size() < kCachedResultThreshold) {
+  if (!NeedCacheSomasResult(tensors_list_.size())) {
     MS_LOG(DEBUG) << "Tensors size (" << tensors_list_.size() << ") less than " << kCachedResultThreshold
-                  << ", no need to load cached";
+                  << " and compile cache is disabled, no need to load cached";
     return false;
   }
 
@@ -156,12 +174,13 @@ bool Somas::CalcSomasModelHash(const session::KernelGraph *graph) {
 
 bool Somas::SaveSomasResult(const session::KernelGraph *graph) {
   MS_EXCEPTION_IF_NULL(graph);
-  if (tensors_list_.size() < kCachedResultThreshold) {
+  if (!NeedCacheSomasResult(tensors_list_.size())) {
     MS_LOG(DEBUG) << "Tensors size (" << tensors_list_.size() << ") less than " << kCachedResultThreshold
-                  << ", no need to save result";
+                  << " and compile cache is disabled, no need to save result";
     return false;
   }
   nlohmann::json somas_json;
+  somas_json[kVersion] = kSomasCacheVersion;
   somas_json[kGraphId] = graph->graph_id();
   somas_json[kHashId] = hash_id_;
   somas_json[kMemOffset] = mem_offset_;
@@ -185,6 +204,7 @@ bool Somas::SaveSomasResult(const session::KernelGraph *graph) {
     tensors_json.emplace_back(tensor_json);
   }
   somas_json[kTensors] = tensors_json;
+  somas_json[kContiguousLists] = contiguous_tensors_list_;
 
   std::string filename = Common::GetCompilerCachePath() + "/somas_meta/somas_graph_" +
                          std::to_string(graph->graph_id()) + "_" + hash_id_ + ".json";
@@ -228,6 +248,10 @@ bool Somas::LoadSomasResult(const session::KernelGraph *graph, const string &fil
 
 bool Somas::VerifySomasResult(const session::KernelGraph *graph, const nlohmann::json &somas_json) const {
   MS_EXCEPTION_IF_NULL(graph);
+  if (!somas_json.contains(kVersion) || somas_json[kVersion] != kSomasCacheVersion) {
+    MS_LOG(WARNING) << "Mismatch somas cache version, expect " << kSomasCacheVersion;
+    return false;
+  }
   auto graph_id = somas_json[kGraphId];
   auto hash_id = somas_json[kHashId];
   auto node_size = somas_json[kNodeSize];
@@ -277,6 +301,13 @@ bool Somas::VerifySomasResult(const session::KernelGraph *graph, const nlohmann:
     return false;
   }
 
+  // The contiguous tensors must keep the same order, otherwise the cached offsets break the continuity.
+  if (!somas_json.contains(kContiguousLists) ||
+      somas_json[kContiguousLists].get<std::vector<std::vector<size_t>>>() != contiguous_tensors_list_) {
+    MS_LOG(WARNING) << "Mismatch contiguous tensors lists of graph " << graph->graph_id();
+    return false;
+  }
+
   return true;
 }
 
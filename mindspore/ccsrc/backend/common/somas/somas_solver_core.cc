@@ -47,13 +47,23 @@ Status SomasSolverCore::MemoryAllocationSolver() {
     BuildBlocks();
     Clean();
     MS_LOG(INFO) << "time\tSol#\tResult\t\t\t\tAlgorithm\tSorting Strategy\tOffset Strategy";
-    for (size_t algorithm = 0; algorithm < static_cast<size_t>(kNumAlgorithmTypes); algorithm++) {
+    bool out_of_budget = false;
+    for (size_t algorithm = 0; algorithm < static_cast<size_t>(kNumAlgorithmTypes) && !out_of_budget; algorithm++) {
       algorithm_ = static_cast<AlgorithmType>(algorithm);
-      for (size_t sort_strategy = 0; sort_strategy < static_cast<size_t>(kNumSortingTypes); sort_strategy++) {
+      for (size_t sort_strategy = 0; sort_strategy < static_cast<size_t>(kNumSortingTypes) && !out_of_budget;
+           sort_strategy++) {
         sort_strategy_ = static_cast<SortingType>(sort_strategy);
         SortTensors();
         for (size_t branching_strategy = 0; branching_strategy < static_cast<size_t>(kNumFittingTypes);
              branching_strategy++) {
+          // Keep the best solution found so far once the budget is exhausted.
+          if (time_budget_ != 0 && sol_count_ != 0 &&
+              std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start)
+                  .count() > SizeToLong(time_budget_)) {
+            MS_LOG(INFO) << "Time budget " << time_budget_ << " ms exhausted after " << sol_count_ << " solutions";
+            out_of_budget = true;
+            break;
+          }
           branching_strategy_ = static_cast<FittingType>(branching_strategy);
           Clean();
           MS_LOG(DEBUG) << "Timing Start " << tensors_.size() << " Tensors";
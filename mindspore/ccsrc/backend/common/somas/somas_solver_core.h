@@ -61,6 +61,8 @@ class SomasSolverCore {
   void SetFittingStrategy(FittingType branching_strategy) { branching_strategy_ = branching_strategy; }
   void SetAlgorithmStrategy(AlgorithmType algorithm_strategy) { algorithm_ = algorithm_strategy; }
   void SetAllStrategies(bool all) { all_ = all; }
+  // Wall-clock budget in milliseconds of the full strategies search, zero means no budget.
+  void set_time_budget(size_t time_budget) { time_budget_ = time_budget; }
   const size_t &GetUpperbound() const { return upperbound_; }
   const size_t &Getlifelongmemory() const { return lifelong_memory_; }
 
@@ -80,6 +82,7 @@ class SomasSolverCore {
   bool verify_{false};
   bool all_{false};
   bool is_multi_thread_valid_{true};
+  size_t time_budget_{0};
 
   size_t FindSolutions();
   size_t Search(const std::shared_ptr<FootPrint> &pFootprint);
@@ -15,8 +15,10 @@
 */
 
 #include <cstdio>
+#include <deque>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include "include/common/thread_pool.h"
@@ -24,10 +26,133 @@
 #include "backend/common/somas/somas_solver_core.h"
 #include "backend/common/somas/somas_solver_pre.h"
 #include "include/common/debug/common.h"
+#include "utils/hashing.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace somas {
 constexpr auto kSolNumThresholdMultiThread = 8;
+namespace {
+struct SolverCache {
+  std::mutex mutex_;
+  HashMap<size_t, SomasSolverResult> results_;
+  // The insertion order of results, the oldest one is evicted when the cache is full.
+  std::deque<size_t> hashes_;
+};
+
+SolverCache &GetSolverCache() {
+  static SolverCache solver_cache;
+  return solver_cache;
+}
+
+size_t GetTimeBudgetFromEnv() {
+  static const auto time_budget_env = common::GetEnv("MS_DEV_SOMAS_SOLVER_TIME_BUDGET");
+  if (time_budget_env.empty()) {
+    return 0;
+  }
+  try {
+    return std::stoul(time_budget_env);
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid MS_DEV_SOMAS_SOLVER_TIME_BUDGET: " << time_budget_env << ", it should be milliseconds.";
+  }
+  return 0;
+}
+}  // namespace
+
+SomasSolverInput SomasSolverPre::MakeSolverInput(const TensorsDescMap &tensors,
+                                                 const std::vector<DynamicBitSet> *pConstraints,
+                                                 const vector<vector<size_t>> &continuous_v, bool ball,
+                                                 SortingType sorting, FittingType fitting, AlgorithmType algorithm) {
+  MS_EXCEPTION_IF_NULL(pConstraints);
+  SomasSolverInput input;
+  // The iteration order of hash map is not stable, so keep the tensors in the order of index.
+  std::map<size_t, SomasSolverTensorDescPtr> sorted_tensors(tensors.begin(), tensors.end());
+  input.tensors_.reserve(sorted_tensors.size());
+  for (const auto &tensor : sorted_tensors) {
+    MS_EXCEPTION_IF_NULL(tensor.second);
+    input.tensors_.emplace_back(tensor.first, tensor.second->size_, tensor.second->lifelong_);
+  }
+  input.continuous_ = continuous_v;
+  input.constraints_.reserve(pConstraints->size());
+  for (const auto &constraint : *pConstraints) {
+    input.constraints_.push_back(constraint.bit_);
+  }
+  // The strategies are part of the key, a single heuristic may give different offsets from the full search.
+  input.strategies_ = {static_cast<size_t>(ball), static_cast<size_t>(sorting), static_cast<size_t>(fitting),
+                       static_cast<size_t>(algorithm)};
+  return input;
+}
+
+size_t SomasSolverPre::SolverInputHash(const SomasSolverInput &input) {
+  size_t hash_sum = input.tensors_.size();
+  for (const auto &tensor : input.tensors_) {
+    hash_sum =
+      hash_combine({hash_sum, std::get<0>(tensor), std::get<1>(tensor), static_cast<size_t>(std::get<2>(tensor))});
+  }
+  for (const auto &continuous : input.continuous_) {
+    hash_sum = hash_combine(hash_sum, continuous.size());
+    for (auto index : continuous) {
+      hash_sum = hash_combine(hash_sum, index);
+    }
+  }
+  for (const auto &constraint : input.constraints_) {
+    for (auto bits : constraint) {
+      hash_sum = hash_combine(hash_sum, static_cast<size_t>(bits));
+    }
+  }
+  for (auto strategy : input.strategies_) {
+    hash_sum = hash_combine(hash_sum, strategy);
+  }
+  return hash_sum;
+}
+
+void SomasSolverPre::ClearSolverCache() {
+  auto &solver_cache = GetSolverCache();
+  std::lock_guard<std::mutex> lock(solver_cache.mutex_);
+  solver_cache.results_.clear();
+  solver_cache.hashes_.clear();
+}
+
+bool SomasSolverPre::FindCachedSolution(const SomasSolverInput &input, size_t input_hash, TensorsDescMap *pTensors) {
+  MS_EXCEPTION_IF_NULL(pTensors);
+  auto &solver_cache = GetSolverCache();
+  std::lock_guard<std::mutex> lock(solver_cache.mutex_);
+  auto iter = solver_cache.results_.find(input_hash);
+  if (iter == solver_cache.results_.end()) {
+    return false;
+  }
+  const auto &result = iter->second;
+  if (!(result.input_ == input)) {
+    MS_LOG(INFO) << "The somas solver input has the same hash " << input_hash << " as a different cached input.";
+    return false;
+  }
+  for (auto &tensor : *pTensors) {
+    tensor.second->offset_ = result.tensor_offsets_.at(tensor.first);
+  }
+  max_offset_ = result.max_offset_;
+  return true;
+}
+
+void SomasSolverPre::CacheSolution(const SomasSolverInput &input, size_t input_hash,
+                                   const TensorsDescMap &tensors) const {
+  SomasSolverResult result;
+  result.input_ = input;
+  result.max_offset_ = max_offset_;
+  for (const auto &tensor : tensors) {
+    (void)result.tensor_offsets_.emplace(tensor.first, tensor.second->offset_);
+  }
+  auto &solver_cache = GetSolverCache();
+  std::lock_guard<std::mutex> lock(solver_cache.mutex_);
+  if (solver_cache.results_.count(input_hash) == 0) {
+    solver_cache.hashes_.push_back(input_hash);
+  }
+  solver_cache.results_[input_hash] = std::move(result);
+  while (solver_cache.hashes_.size() > kSolverCacheMaxSize) {
+    (void)solver_cache.results_.erase(solver_cache.hashes_.front());
+    solver_cache.hashes_.pop_front();
+  }
+}
+
 Status SomasSolverPre::CheckTensors(const TensorsDescMap *pTensors, uint32_t index1, uint32_t index2) const {
   auto tensors = *pTensors;
   if (tensors[index1] == nullptr) {
@@ -105,12 +230,22 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
   Status ret = SUCCESS;
   try {
     TensorsDescMap &tensors = *ptensors;
+    auto input = MakeSolverInput(tensors, pConstraints, continuous_v, ball, sorting, fitting, algorithm);
+    size_t input_hash = SolverInputHash(input);
+    if (FindCachedSolution(input, input_hash, ptensors)) {
+      MS_LOG(INFO) << "SomasSolver::Solving hit the solver cache, graph id: " << graph->graph_id()
+                   << ", RESULT: " << max_offset_;
+      Log(graph, tensors, pConstraints, continuous_v);
+      return ret;
+    }
     constexpr size_t numSortingTypes = static_cast<size_t>(kNumSortingTypes);
     constexpr size_t numFittingTypes = static_cast<size_t>(kNumFittingTypes);
     constexpr size_t numAlgorithmTypes = static_cast<size_t>(kNumAlgorithmTypes);
     constexpr size_t total_sol = numSortingTypes * numFittingTypes * numAlgorithmTypes;
+    size_t time_budget = time_budget_ != 0 ? time_budget_ : GetTimeBudgetFromEnv();
     size_t process_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
-    bool isMultiThreadPermit = ball && process_num >= total_sol && total_sol > 1;
+    // The thread pool dispatches the tasks to the idle threads, so the strategies more than threads are queued.
+    bool isMultiThreadPermit = ball && process_num > 1 && total_sol > 1;
     bool isMultiThreadValid = isMultiThreadPermit && (total_sol > kSolNumThresholdMultiThread ||
                                                       kParallelComputeSizeThreshold <= tensors.size());
     const double giga = 1024. * 1024. * 1024.;
@@ -122,6 +257,9 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
         return FAILED;
       }
       auto start = std::chrono::system_clock::now();
+      auto deadline = start + std::chrono::milliseconds(time_budget);
+      // Each element is only written by its own task, and is set only when the strategy is solved successfully.
+      std::vector<uint8_t> solved(total_sol, 0);
       for (size_t algorithm_strategy = 0, sol = 0; algorithm_strategy < numAlgorithmTypes; algorithm_strategy++) {
         for (size_t sort_strategy = 0; sort_strategy < numSortingTypes; sort_strategy++) {
           for (size_t branching_strategy = 0; branching_strategy < numFittingTypes; branching_strategy++) {
@@ -132,8 +270,16 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
             pSolver->SetFittingStrategy(FittingType(branching_strategy));
             pSolver->SetAllStrategies(false);
             pSolver->VerifySolution(bVerifySolution);
-            auto task = [pSolver]() {
-              return pSolver->MemoryAllocationSolver() == SUCCESS ? common::SUCCESS : common::FAIL;
+            auto task = [pSolver, sol, time_budget, deadline, &solved]() {
+              // The first strategy always runs, the others are skipped once the budget is exhausted.
+              if (sol != 0 && time_budget != 0 && std::chrono::system_clock::now() > deadline) {
+                return common::SUCCESS;
+              }
+              if (pSolver->MemoryAllocationSolver() != SUCCESS) {
+                return common::FAIL;
+              }
+              solved[sol] = 1;
+              return common::SUCCESS;
             };
             tasks.emplace_back(task);
             solvers.emplace_back(pSolver);
@@ -142,8 +288,12 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
         }
       }
       common::ThreadPool::GetInstance().SyncRun(tasks);
-      size_t best_sol = 0, worst = 0, best = SIZE_MAX, best_timing = SIZE_MAX;
+      size_t best_sol = 0, worst = 0, best = SIZE_MAX, best_timing = SIZE_MAX, solved_num = 0;
       for (size_t sol = 0; sol < total_sol; sol++) {
+        if (solved[sol] == 0) {
+          continue;
+        }
+        ++solved_num;
         auto &solver = solvers[sol];
         auto &upperbound = solver->GetUpperbound();
         if (upperbound > worst) {
@@ -155,6 +305,10 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
           best_timing = LongToSize(solver->timing_);
         }
       }
+      if (solved_num == 0) {
+        MS_LOG(WARNING) << "SomasSolver::Solving FAILED, none of the " << total_sol << " strategies is solved.";
+        return FAILED;
+      }
       auto end = std::chrono::system_clock::now();
       size_t total_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
       auto &best_solver = solvers[best_sol];
@@ -165,6 +319,10 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
       constexpr float kFloatPresent = 100.0;
       MS_LOG(INFO) << "SOMAS SOLVER RESUME:";
       MS_LOG(INFO) << "Best Solution:[" << 1 + best_sol << "/" << total_sol << "] ";
+      if (solved_num < total_sol) {
+        MS_LOG(INFO) << "Time budget " << time_budget << " ms exhausted, " << solved_num << "/" << total_sol
+                     << " strategies solved";
+      }
       MS_LOG(INFO) << "Best result:" << best << " Bytes " << (best) / (giga) << " GB ("
                    << (best - best_solver->Getlifelongmemory()) / (giga) << " GB + "
                    << best_solver->Getlifelongmemory() / (giga) << " GB from lifelong tensors)";
@@ -175,6 +333,7 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
       MS_LOG(INFO) << "Time elapsed: " << total_time << " ms";
       MS_LOG(INFO) << "Spread:" << static_cast<double>((worst - best) / static_cast<double>(best * kFloatPresent))
                    << " %%";
+      CacheSolution(input, input_hash, tensors);
     } else {
       if (AddContiguousInfoInMap(continuous_v, ptensors) == FAILED) {
         return FAILED;
@@ -185,10 +344,12 @@ Status SomasSolverPre::Solving(const session::KernelGraph *graph, TensorsDescMap
       pSolver->SetFittingStrategy(fitting);
       pSolver->SetAllStrategies(ball);
       pSolver->VerifySolution(bVerifySolution);
+      pSolver->set_time_budget(time_budget);
       if (SUCCESS == (pSolver->MemoryAllocationSolver())) {
         max_offset_ = pSolver->GetUpperbound();
         MS_LOG(INFO) << "SomasSolver::Solving SUCCESS";
         MS_LOG(INFO) << "SomasSolver::Solving RESULT: " << max_offset_ << " (" << max_offset_ / (giga) << " GB)";
+        CacheSolution(input, input_hash, tensors);
       }
     }
     Log(graph, tensors, pConstraints, continuous_v);
@@ -24,6 +24,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <tuple>
 #include <vector>
 #include "utils/hash_map.h"
 #include "backend/common/session/kernel_graph.h"
@@ -42,6 +43,7 @@ constexpr char const *sortingNames[6] = {"size(>), index(<)",
 constexpr char const *branchingNames[4] = {"bestfit", "smallest", "largest", "worstfit"};
 constexpr char const *algorithmTypeNames[2] = {"Shared Objects", "Single Object"};
 constexpr auto kParallelComputeSizeThreshold = 2000;
+constexpr size_t kSolverCacheMaxSize = 64;
 enum Status { FAILED, SUCCESS };
 enum AlgorithmType { kManyObjects = 0, kSingleObject, kNumAlgorithmTypes };
 enum SortingType {
@@ -174,6 +176,28 @@ struct SomasSolverTensorDesc {
 };
 using SomasSolverTensorDescPtr = std::shared_ptr<SomasSolverTensorDesc>;
 typedef mindspore::HashMap<size_t, SomasSolverTensorDescPtr> TensorsDescMap;
+
+// The whole input of the solver, the tensors are sorted by index, and the lifetimes of the tensors are the conflict
+// bits of the constraints.
+struct SomasSolverInput {
+  std::vector<std::tuple<size_t, size_t, bool>> tensors_;  // index, size and lifelong
+  vector<vector<size_t>> continuous_;
+  std::vector<std::vector<uint64_t>> constraints_;
+  std::vector<size_t> strategies_;  // ball, sorting, fitting and algorithm
+
+  bool operator==(const SomasSolverInput &other) const {
+    return tensors_ == other.tensors_ && continuous_ == other.continuous_ && constraints_ == other.constraints_ &&
+           strategies_ == other.strategies_;
+  }
+};
+
+// The solved offsets of tensors, it is cached by the hash of solver input, so the same graph can skip solving. The
+// input is kept to be compared on the hit, so the inputs with the same hash never share the offsets.
+struct SomasSolverResult {
+  SomasSolverInput input_;
+  size_t max_offset_{0};
+  std::map<size_t, size_t> tensor_offsets_;
+};
 class SomasSolverPre {
  public:
   SomasSolverPre() = default;
@@ -183,6 +207,14 @@ class SomasSolverPre {
   SomasSolverPre &operator=(const SomasSolverPre &) = delete;
 
   size_t GetMaxOffset() const { return max_offset_; }
+  // Wall-clock budget in milliseconds of the whole strategies search, zero means no budget.
+  void set_time_budget(size_t time_budget) { time_budget_ = time_budget; }
+
+  static SomasSolverInput MakeSolverInput(const TensorsDescMap &tensors, const std::vector<DynamicBitSet> *pConstraints,
+                                          const vector<vector<size_t>> &continuous_v, bool ball, SortingType sorting,
+                                          FittingType fitting, AlgorithmType algorithm);
+  static size_t SolverInputHash(const SomasSolverInput &input);
+  static void ClearSolverCache();
 
   Status Solving(const session::KernelGraph *graph, TensorsDescMap *ptensors,
                  const std::vector<DynamicBitSet> *pConstraints, const vector<vector<size_t>> &continuous_v,
@@ -200,7 +232,10 @@ class SomasSolverPre {
                                       const TensorsDescMap *pTensors) const;
 
  private:
-  size_t max_offset_;
+  size_t max_offset_{0};
+  size_t time_budget_{0};
+  bool FindCachedSolution(const SomasSolverInput &input, size_t input_hash, TensorsDescMap *pTensors);
+  void CacheSolution(const SomasSolverInput &input, size_t input_hash, const TensorsDescMap &tensors) const;
   void SolverInputLog(const session::KernelGraph *graph, const TensorsDescMap &tensors,
                       const vector<vector<size_t>> &continuous_v) const;
   void SolverOutputLog(const session::KernelGraph *graph, const TensorsDescMap &tensors) const;
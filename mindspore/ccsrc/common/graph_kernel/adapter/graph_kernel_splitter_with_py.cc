@@ -368,7 +368,9 @@ class CostModelSplitSchemer : public SplitSchemer {
 
 std::shared_ptr<SplitSchemer> GraphKernelSplitterWithPy::GetSplitSchema(const std::string &processor) {
   // default use c++ split model for CPU target.
-  if (processor != kCPUDevice) {
+  bool use_cpp_model = (processor == kCPUDevice) ||
+                       (processor == kGPUDevice && GraphKernelFlags::GetInstance().enable_reduce_stitch_fusion);
+  if (!use_cpp_model) {
     MS_LOG(DEBUG) << "use py split model";
     return std::make_shared<CostModelSplitSchemer>();
   } else {
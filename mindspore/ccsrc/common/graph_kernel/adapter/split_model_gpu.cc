@@ -0,0 +1,48 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/graph_kernel/adapter/split_model_gpu.h"
+#include <memory>
+#include "utils/ms_context.h"
+
+namespace mindspore::graphkernel::inner {
+SPLIT_MODEL_REGISTER(kGPUDevice, SplitModelGpu);
+constexpr size_t kReduceFusionDepth = 20;
+constexpr size_t kBroadcastFusionDepth = 20;
+constexpr size_t kStitchFusionDepth = 40;
+constexpr size_t kMaxStitchNum = 3;
+
+void SplitModelGpu::InitFusePatterns() {
+  AddPattern(std::make_shared<FuseVirtualNode>(), true);
+  AddPattern(std::make_shared<FuseReshape>(), true);
+  AddPattern(FuseElemwiseBroadcastFwd::CreateDepthMatcher(), true);
+  AddPattern(FuseElemwiseBroadcastFwd::CreateWidthMatcher(), true);
+  AddPattern(FuseReduceFwd::CreateDepthMatcher(kReduceFusionDepth), true);
+  AddPattern(FuseReduceFwd::CreateWidthMatcher(kReduceFusionDepth), true);
+  AddPattern(FuseElemwiseBroadcastBwd::CreateDepthMatcher(kBroadcastFusionDepth), true);
+  AddPattern(FuseElemwiseBroadcastBwd::CreateWidthMatcher(kBroadcastFusionDepth), true);
+  // the reduce and its users are fused after the elemwise ops around them are fused.
+  AddPattern(std::make_shared<FuseReduceStitch>(kStitchFusionDepth, kMaxStitchNum), true);
+  AddPattern(FuseReduceFwd::CreateDepthMatcher(kReduceFusionDepth), true);
+  AddPattern(FuseElemwiseBroadcastBwd::CreateDepthMatcher(kBroadcastFusionDepth), true);
+  AddPattern(std::make_shared<FuseIsolateReshape>(), true);
+}
+
+AreaMode SplitModelGpu::GetDefaultAreaMode(const PrimOpPtr &node) const {
+  // the single reshape op is inlined to the main graph.
+  return (node != nullptr && node->compute_type() == NodePattern::RESHAPE) ? AreaMode::BASIC : AreaMode::COMPOSITE;
+}
+}  // namespace mindspore::graphkernel::inner
@@ -590,6 +590,10 @@ class CppCostModelSplitSchemer : public CommonSplitSchemer {
         (void)nodes.emplace_back(op_node_map[op]);
         node_group_[nodes.back()] = split_plan_.size();
       }
+      for (auto &op : area->stitch_ops()) {
+        AnfUtils::SetNodeAttr(kAttrStitch, MakeValue("common"), op_node_map[op]);
+        MS_LOG(INFO) << "Enable common stitch fusion by " << op_node_map[op]->fullname_with_scope();
+      }
       std::sort(nodes.begin(), nodes.end(), [&node_idx_map](const AnfNodePtr &a, const AnfNodePtr &b) {
         return node_idx_map[a] < node_idx_map[b];
       });
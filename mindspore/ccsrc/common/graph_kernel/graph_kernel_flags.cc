@@ -267,6 +267,8 @@ void GraphKernelFlags::RegisterFlags(std::map<std::string, std::string> *flag_ma
   reg.AddFlag("enable_auto_tensor_inplace", &enable_auto_tensor_inplace, false);
   reg.AddFlag("enable_low_precision", &enable_low_precision);
   reg.AddFlag("enable_csr_fusion", &enable_csr_fusion);
+  reg.AddFlag("enable_cost_model_fusion", &enable_cost_model_fusion);
+  reg.AddFlag("enable_reduce_stitch_fusion", &enable_reduce_stitch_fusion);
   reg.AddFlag("enable_debug_mode", &enable_debug_mode);
 
   // Integer flags
@@ -303,6 +305,8 @@ std::string GraphKernelFlags::DumpAllFlags() const {
   json["enable_horizontal_fusion"] = enable_horizontal_fusion;
   json["enable_auto_tensor_inplace"] = enable_auto_tensor_inplace;
   json["enable_csr_fusion"] = enable_csr_fusion;
+  json["enable_cost_model_fusion"] = enable_cost_model_fusion;
+  json["enable_reduce_stitch_fusion"] = enable_reduce_stitch_fusion;
   json["enable_low_precision"] = enable_low_precision;
   json["enable_debug_mode"] = enable_debug_mode;
 
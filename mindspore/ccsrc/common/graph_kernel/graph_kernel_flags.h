@@ -118,6 +118,19 @@ class GraphKernelFlags {
    */
   bool enable_csr_fusion{false};
 
+  /**
+   * Enable the cost model of fusion in split model.
+   * The fusion is rejected if the fused kernel is estimated slower than the separate kernels.
+   */
+  bool enable_cost_model_fusion{false};
+
+  /**
+   * Use the c++ split model with the reduce stitch fusion on GPU, instead of the python split model.
+   *
+   * Experimental feature.
+   */
+  bool enable_reduce_stitch_fusion{false};
+
   /**
    * Optimization level, value from 0 to 3.
    * 0: Disable GraphKernel
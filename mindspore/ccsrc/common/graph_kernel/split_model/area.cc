@@ -146,6 +146,8 @@ void Area::FuseInput(const AreaPtr &input_area) {
     ops_.swap(input_area->ops_);
   }
   (void)ops_.insert(ops_.cend(), input_area->ops_.cbegin(), input_area->ops_.cend());
+  (void)stitch_ops_.insert(stitch_ops_.cend(), input_area->stitch_ops_.cbegin(), input_area->stitch_ops_.cend());
+  input_area->stitch_ops_.clear();
 
   // update area pattern
   hd_->compute_type_ = std::max(pattern(), input_area->pattern());
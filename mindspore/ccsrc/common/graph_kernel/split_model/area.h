@@ -82,6 +82,9 @@ class Area : public std::enable_shared_from_this<Area> {
   PrimOpPtr dom() const { return IsAlive() ? ops_[0] : nullptr; }
   NodePattern pattern() const { return hd_->compute_type(); }
   const std::vector<PrimOpPtr> &ops() const { return ops_; }
+  // get the ops whose outputs are kept in the stitch buffer of the kernel
+  const std::vector<PrimOpPtr> &stitch_ops() const { return stitch_ops_; }
+  void AddStitchOp(const PrimOpPtr &op) { stitch_ops_.push_back(op); }
   bool is_output() const { return is_output_; }
   int64_t compute_size() const;
 
@@ -104,6 +107,7 @@ class Area : public std::enable_shared_from_this<Area> {
   const size_t unique_id_;
   bool is_output_;
   std::vector<PrimOpPtr> ops_;
+  std::vector<PrimOpPtr> stitch_ops_;
   AreaMode mode_{AreaMode::BASIC};
   // The `inputs_with_relation_.first` stores the input area of `this` area.
   // The `hd_->inputs` stores the NodeHandle of `this` area, to maintain the user edges.
@@ -160,6 +160,32 @@ bool FuseElemwiseBroadcastBwd::Match(const AreaPtr &dom) {
   return fused_areas_.size() == dom->user_num();
 }
 
+bool FuseReduceStitch::Check(const AreaPtr &dom) {
+  if (dom->pattern() != NodePattern::REDUCE || dom->is_output() || dom->user_num() == 0) {
+    return false;
+  }
+  return dom->size() <= size_limit_ && dom->stitch_ops().size() < stitch_limit_;
+}
+
+bool FuseReduceStitch::Match(const AreaPtr &dom) {
+  // the users should be computed on the input shape of reduce, to which the reduce result is broadcasted.
+  auto reduce_op = dom->dom();
+  if (reduce_op->inputs().empty()) {
+    return false;
+  }
+  auto input_size = SizeToLong(reduce_op->input(0)->tensor_size());
+  for (auto &a : dom->users()) {
+    if (a->pattern() > NodePattern::REDUCE || a->compute_size() != input_size) {
+      return false;
+    }
+    if (a->stitch_ops().size() + dom->stitch_ops().size() >= stitch_limit_ || HasCircle(dom, a)) {
+      return false;
+    }
+    (void)fused_areas_.emplace_back(a);
+  }
+  return fused_areas_.size() == dom->user_num();
+}
+
 std::string FusePattern::ToString() const {
   std::ostringstream oss;
   if (direction_ == FuseDirection::FORWARD) {
@@ -51,6 +51,8 @@ class FusePattern {
 
   std::string name() const { return name_; }
   FuseDirection direction() const { return direction_; }
+  // whether the output of dominant op is kept in the stitch buffer after fusion.
+  bool stitch() const { return stitch_; }
   std::vector<AreaPtr> fused_areas_;
 
  protected:
@@ -67,6 +69,7 @@ class FusePattern {
 
   std::string name_;
   FuseDirection direction_{FuseDirection::FORWARD};
+  bool stitch_{false};
   CircleCheckerPtr circle_checker_{nullptr};
 };
 using FusePatternPtr = std::shared_ptr<FusePattern>;
@@ -155,6 +158,25 @@ class FuseElemwiseBroadcastBwd : public FusePattern {
   size_t size_limit_;
 };
 
+// fuse all users of the reduce area, and the reduce result is kept in the stitch buffer (shared memory on GPU),
+// so the reduce and its broadcasted users like the softmax and layernorm are done in one kernel.
+class FuseReduceStitch : public FusePattern {
+ public:
+  FuseReduceStitch(size_t size_limit, size_t stitch_limit)
+      : FusePattern("reduce_stitch"), size_limit_(size_limit), stitch_limit_(stitch_limit) {
+    direction_ = FuseDirection::BACKWARD;
+    stitch_ = true;
+  }
+  ~FuseReduceStitch() = default;
+
+ protected:
+  bool Check(const AreaPtr &dom) override;
+  bool Match(const AreaPtr &dom) override;
+  size_t size_limit_;
+  // the maximum number of stitch buffers in a kernel
+  size_t stitch_limit_;
+};
+
 // bind the virtual nodes to their inputs
 class FuseVirtualNode : public FusePattern {
  public:
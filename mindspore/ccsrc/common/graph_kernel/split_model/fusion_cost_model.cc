@@ -0,0 +1,97 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/graph_kernel/split_model/fusion_cost_model.h"
+#include <algorithm>
+#include "utils/hash_set.h"
+
+namespace mindspore::graphkernel::inner {
+namespace {
+// The launch overhead of a kernel, in seconds.
+constexpr double kLaunchOverhead = 5e-6;
+// The memory bandwidth, in bytes per second.
+constexpr double kMemoryBandwidth = 2e11;
+// The computation throughput, in elements per second.
+constexpr double kComputeThroughput = 1e12;
+// The maximum number of input and output tensors of a fused kernel.
+constexpr size_t kMaxFusedIoNum = 32;
+}  // namespace
+
+FusionCostModel::KernelCost FusionCostModel::Estimate(const std::vector<PrimOpPtr> &ops) const {
+  HashSet<Node *> inner_nodes;
+  for (const auto &op : ops) {
+    (void)inner_nodes.insert(op.get());
+  }
+  HashSet<Node *> visited_inputs;
+  size_t io_num = 0;
+  size_t traffic = 0;
+  size_t compute = 0;
+  for (const auto &op : ops) {
+    size_t op_compute = op->tensor_size();
+    for (const auto &inp : op->inputs()) {
+      // the reduce op computes on its input elements.
+      op_compute = std::max(op_compute, inp->tensor_size());
+      if (inner_nodes.count(inp.get()) == 0 && visited_inputs.insert(inp.get()).second) {
+        ++io_num;
+        traffic += inp->tensor_size(true);
+      }
+    }
+    bool is_output = op->users().empty();
+    for (const auto &user : op->users()) {
+      if (inner_nodes.count(user.first) == 0) {
+        is_output = true;
+      } else {
+        // the op is recomputed for each element of its inner user when its output is broadcasted.
+        op_compute = std::max(op_compute, user.first->tensor_size());
+      }
+    }
+    compute += op_compute;
+    if (is_output) {
+      ++io_num;
+      traffic += op->tensor_size(true);
+    }
+  }
+  auto latency = kLaunchOverhead + std::max(static_cast<double>(traffic) / kMemoryBandwidth,
+                                            static_cast<double>(compute) / kComputeThroughput);
+  return KernelCost{latency, io_num};
+}
+
+bool FusionCostModel::Accept(const AreaPtr &dom, const std::vector<AreaPtr> &areas) const {
+  // the virtual and reshape nodes are free to fuse.
+  auto is_free = [](const AreaPtr &a) { return a->pattern() <= NodePattern::RESHAPE; };
+  if (is_free(dom) || std::any_of(areas.begin(), areas.end(), is_free)) {
+    return true;
+  }
+  auto fused_ops = dom->ops();
+  double separate_latency = Estimate(dom->ops()).latency;
+  for (const auto &a : areas) {
+    (void)fused_ops.insert(fused_ops.end(), a->ops().begin(), a->ops().end());
+    separate_latency += Estimate(a->ops()).latency;
+  }
+  auto fused_cost = Estimate(fused_ops);
+  if (fused_cost.io_num > kMaxFusedIoNum) {
+    MS_LOG(DEBUG) << "Reject fusing to area " << dom->ToString() << ", the fused kernel has " << fused_cost.io_num
+                  << " inputs and outputs.";
+    return false;
+  }
+  if (fused_cost.latency > separate_latency) {
+    MS_LOG(DEBUG) << "Reject fusing to area " << dom->ToString() << ", the estimated latency of the fused kernel is "
+                  << fused_cost.latency << "s, but the separate kernels is " << separate_latency << "s.";
+    return false;
+  }
+  return true;
+}
+}  // namespace mindspore::graphkernel::inner
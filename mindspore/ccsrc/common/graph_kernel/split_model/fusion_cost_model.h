@@ -0,0 +1,46 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_BACKEND_OPTIMIZER_GRAPH_KERNEL_SPLIT_MODEL_FUSION_COST_MODEL_H_
+#define MINDSPORE_CCSRC_BACKEND_OPTIMIZER_GRAPH_KERNEL_SPLIT_MODEL_FUSION_COST_MODEL_H_
+
+#include <memory>
+#include <vector>
+#include "common/graph_kernel/split_model/area.h"
+
+namespace mindspore::graphkernel::inner {
+// The cost model of fusion estimates the latency of a kernel by the launch overhead, the memory traffic of its
+// inputs and outputs and the amount of computation, so a fusion is accepted only if the fused kernel is estimated
+// faster than the separate kernels. The fusion whose kernel reads and writes too many tensors is always rejected,
+// since its kernel is likely to spill registers.
+class FusionCostModel {
+ public:
+  FusionCostModel() = default;
+  ~FusionCostModel() = default;
+
+  // Whether to fuse the `areas` into the `dom` area.
+  bool Accept(const AreaPtr &dom, const std::vector<AreaPtr> &areas) const;
+
+ private:
+  struct KernelCost {
+    double latency{0};
+    size_t io_num{0};
+  };
+  KernelCost Estimate(const std::vector<PrimOpPtr> &ops) const;
+};
+using FusionCostModelPtr = std::shared_ptr<FusionCostModel>;
+}  // namespace mindspore::graphkernel::inner
+#endif  // MINDSPORE_CCSRC_BACKEND_OPTIMIZER_GRAPH_KERNEL_SPLIT_MODEL_FUSION_COST_MODEL_H_
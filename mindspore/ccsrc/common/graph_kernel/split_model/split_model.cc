@@ -16,6 +16,7 @@
 #include "common/graph_kernel/split_model/split_model.h"
 #include <algorithm>
 #include "utils/hash_set.h"
+#include "common/graph_kernel/graph_kernel_flags.h"
 
 namespace mindspore::graphkernel::inner {
 ReachTable::ReachTable(size_t size) : size_(size), reach_(size, std::vector<bool>(size, false)) {
@@ -200,8 +201,15 @@ bool SplitModel::RunOnePattern(const FusePatternPtr &pattern) {
     if (pattern->Run(area)) {
       MS_LOG(DEBUG) << "Area " << area->ToString() << " matches " << pattern->ToString();
       LimitAreaSize(area, &pattern->fused_areas_);
+      if (cost_model_ != nullptr && !cost_model_->Accept(area, pattern->fused_areas_)) {
+        pattern->fused_areas_.clear();
+      }
       if (!pattern->fused_areas_.empty()) {
+        auto stitch_op = pattern->stitch() ? area->dom() : nullptr;
         FuseAreas(area, pattern->fused_areas_, pattern->direction());
+        if (stitch_op != nullptr) {
+          node_area_map_[stitch_op]->AddStitchOp(stitch_op);
+        }
         changed = true;
         continue;
       }
@@ -231,6 +239,9 @@ void SplitModel::RunFusePatterns() {
 }
 
 void SplitModel::Run(const LiteGraphPtr &litegraph) {
+  if (GraphKernelFlags::GetInstance().enable_cost_model_fusion) {
+    cost_model_ = std::make_shared<FusionCostModel>();
+  }
   InitGraph(litegraph);
   InitFusePatterns();
   RunFusePatterns();
@@ -24,6 +24,7 @@
 #include "common/graph_kernel/model/lite_graph.h"
 #include "common/graph_kernel/split_model/area.h"
 #include "common/graph_kernel/split_model/fuse_pattern.h"
+#include "common/graph_kernel/split_model/fusion_cost_model.h"
 
 namespace mindspore::graphkernel::inner {
 class ReachTable : public CircleChecker {
@@ -79,6 +80,8 @@ class SplitModel {
 
   std::list<AreaPtr> areas_;  // use std::list to accelerate the "erase"
   std::shared_ptr<ReachTable> reach_table_{nullptr};
+  // the fusion is decided by the patterns only when the cost model is not set.
+  FusionCostModelPtr cost_model_{nullptr};
   HashMap<NodePtr, AreaPtr> node_area_map_;
 
  private:
@@ -16,6 +16,7 @@
 
 #include "common/mem_reuse/mem_dynamic_allocator.h"
 #include <string>
+#include <chrono>
 #include "include/common/utils/convert_utils.h"
 #include "utils/log_adapter.h"
 #include "utils/ms_context.h"
@@ -34,6 +35,7 @@ thread_local AllocatorDebugInfo DynamicMemAllocatorDebugInfo::debug_info_;
 static const std::map<DynamicMemBufStatus, std::string> kBufStatusString = {
   {DynamicMemBufStatus::kMemBufIdle, "idle"},
   {DynamicMemBufStatus::kMemBufUsed, "used"},
+  {DynamicMemBufStatus::kMemBufCached, "cached"},
 };
 
 static const std::map<AllocatorType, std::string> kAllocatorTypeString = {
@@ -43,42 +45,133 @@ static const std::map<AllocatorType, std::string> kAllocatorTypeString = {
   {AllocatorType::kOther, "other"},
 };
 
+namespace {
+std::mutex &MemPoolsMutex() {
+  static std::mutex mem_pools_mutex;
+  return mem_pools_mutex;
+}
+
+std::vector<DynamicMemPoolBestFit *> &MemPools() {
+  static std::vector<DynamicMemPoolBestFit *> mem_pools;
+  return mem_pools;
+}
+
+// Remove the owned memory from the thread cache when it is returned to the memory pool, called with the lock of thread
+// cache hold.
+void EraseThreadOwnedMem(const ThreadMemCachePtr &thread_cache, const DeviceMemPtr &device_addr) {
+  const auto &iter = thread_cache->owned_mem_.find(device_addr);
+  if (iter == thread_cache->owned_mem_.end()) {
+    return;
+  }
+  auto size = DynamicMemPoolBestFit::SizeClassSize(iter->second.size_class_index_);
+  auto &owned_size = thread_cache->owned_mem_size_by_type_[static_cast<int>(iter->second.pool_allocator_type_)];
+  owned_size -= std::min(owned_size, size);
+  (void)thread_cache->owned_mem_.erase(iter);
+}
+
+// Mark the owned memory as not in use when it is freed to the thread cache, called with the lock of thread cache hold.
+void FreeThreadOwnedMem(const ThreadMemCachePtr &thread_cache, const ThreadOwnedMem &owned_mem) {
+  auto size = DynamicMemPoolBestFit::SizeClassSize(owned_mem.size_class_index_);
+  auto &used_size = thread_cache->used_mem_size_by_type_[static_cast<int>(owned_mem.allocator_type_)];
+  used_size -= std::min(used_size, size);
+}
+}  // namespace
+
 DynamicMemPoolBestFit::~DynamicMemPoolBestFit() {
+  UnregisterMemPool(this);
   persistent_mem_->clear();
   common_mem_->clear();
 }
 
+void DynamicMemPoolBestFit::RegisterMemPool(DynamicMemPoolBestFit *mem_pool) {
+  std::lock_guard<std::mutex> locker(MemPoolsMutex());
+  MemPools().emplace_back(mem_pool);
+}
+
+void DynamicMemPoolBestFit::UnregisterMemPool(const DynamicMemPoolBestFit *mem_pool) {
+  std::lock_guard<std::mutex> locker(MemPoolsMutex());
+  auto &mem_pools = MemPools();
+  (void)mem_pools.erase(std::remove(mem_pools.begin(), mem_pools.end(), mem_pool), mem_pools.end());
+}
+
+std::vector<DynamicMemPoolBestFit *> DynamicMemPoolBestFit::GetAllMemPools() {
+  std::lock_guard<std::mutex> locker(MemPoolsMutex());
+  return MemPools();
+}
+
 DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMem(size_t size, bool from_persistent_mem) {
   size_t align_size = AlignMemorySize(size);
-  std::lock_guard<std::mutex> locker(mutex_);
+  DeviceMemPtr device_addr = nullptr;
+  size_t size_class_index = kSizeClassInvalidIndex;
+  if (enable_thread_cache_ && !from_persistent_mem) {
+    size_class_index = SizeClassIndex(align_size);
+  }
+  if (size_class_index != kSizeClassInvalidIndex) {
+    device_addr = AllocFromThreadCache(size_class_index);
+  } else {
+    std::lock_guard<std::mutex> locker(mutex_);
+    device_addr = AllocTensorMemInner(align_size, from_persistent_mem);
+  }
+  if (event_capacity_ > 0 && device_addr != nullptr) {
+    RecordMemEvent(true, device_addr, align_size, DynamicMemAllocatorDebugInfo::GetDebugInfo().type_);
+  }
+
+  MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
+                << ", address:" << device_addr << ", size:" << size << "B, total allocated mem:" << TotalMemStatistics()
+                << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
+                << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
+  return device_addr;
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocTensorMemInner(size_t align_size, bool from_persistent_mem) {
+  DeviceMemPtr device_addr = nullptr;
+  // The small and medium memory is rounded up to the size class and popped from the size class free list firstly.
+  size_t size_class_index = enable_size_class_ ? SizeClassIndex(align_size) : kSizeClassInvalidIndex;
+  if (size_class_index != kSizeClassInvalidIndex) {
+    align_size = SizeClassSize(size_class_index);
+    device_addr = FindCachedMemBuf(size_class_index, from_persistent_mem);
+  }
   // Find the idle memory buf by tensor size, if not find, then add new memory block and memory buf.
-  DeviceMemPtr device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+  if (!device_addr) {
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+  }
   if (!device_addr) {
     device_addr = AddMemBlockAndMemBuf(align_size, from_persistent_mem);
   }
+  // The thread caches and size class caches may hold the required memory, return them to the idle map and retry.
+  if (!device_addr) {
+    for (const auto &thread_cache : thread_caches_) {
+      ReconcileThreadCache(thread_cache);
+    }
+    if (TotalCachedMemStatistics() > 0) {
+      MS_LOG(INFO) << "Release the size class cache of size:" << TotalCachedMemStatistics()
+                   << "B and retry the memory alloc of size:" << align_size << "B.";
+      ReleaseSizeClassCache(common_mem_);
+      ReleaseSizeClassCache(persistent_mem_);
+    }
+    device_addr = FindIdleMemBuf(align_size, from_persistent_mem);
+    if (!device_addr) {
+      device_addr = FindIdleMemBuf(align_size, !from_persistent_mem);
+    }
+  }
 
   // Alloc memory failed and dump the info.
   if (!device_addr) {
     DumpDynamicMemPoolDebugInfo();
-    DumpDynamicMemPoolStateInfo();
+    DumpDynamicMemPoolStateInfoInner();
   }
-
-  MS_LOG(DEBUG) << "Alloc memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
-                << ", address:" << device_addr << ", size:" << size << "B, total allocated mem:" << TotalMemStatistics()
-                << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
-                << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
   return device_addr;
 }
 
 std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const std::vector<size_t> &size_list) {
   std::vector<DeviceMemPtr> device_addr_list;
   size_t total_size = std::accumulate(size_list.begin(), size_list.end(), IntToSize(0));
-  // Pre-alloc the one whole piece memory.
-  auto device_addr = AllocTensorMem(total_size, false);
+  // Pre-alloc the one whole piece memory, which can't be served by the thread cache because it will be divided.
+  std::lock_guard<std::mutex> locker(mutex_);
+  auto device_addr = AllocTensorMemInner(AlignMemorySize(total_size), false);
   if (!device_addr) {
     return device_addr_list;
   }
-  std::lock_guard<std::mutex> locker(mutex_);
   // Remove the pre-alloc memory.
   auto mem_block = FindMemBlock(device_addr, common_mem_);
   if (mem_block == nullptr) {
@@ -115,6 +208,435 @@ std::vector<DeviceMemPtr> DynamicMemPoolBestFit::AllocContinuousTensorMem(const
   return device_addr_list;
 }
 
+size_t DynamicMemPoolBestFit::SizeClassIndex(size_t align_size) {
+  if (align_size == 0 || align_size > DYNAMIC_MEM_SIZE_CLASS_MAX_SIZE || align_size % DYNAMIC_MEM_ALIGN_SIZE != 0) {
+    return kSizeClassInvalidIndex;
+  }
+  // The size classes are the multiple of the align size: [1, 2, 3, 4], and then divide the range (2^k, 2^(k+1)] into
+  // DYNAMIC_MEM_SIZE_CLASS_STEPS classes equally.
+  size_t units = align_size / DYNAMIC_MEM_ALIGN_SIZE;
+  if (units <= DYNAMIC_MEM_SIZE_CLASS_STEPS) {
+    return units - 1;
+  }
+  size_t power = 0;
+  while ((static_cast<size_t>(1) << (power + 1)) < units) {
+    ++power;
+  }
+  // The steps is 4, so the log2 of steps is 2.
+  constexpr size_t kLog2Steps = 2;
+  size_t step = static_cast<size_t>(1) << (power - kLog2Steps);
+  size_t offset = (units - (static_cast<size_t>(1) << power) + step - 1) / step;
+  return DYNAMIC_MEM_SIZE_CLASS_STEPS + (power - kLog2Steps) * DYNAMIC_MEM_SIZE_CLASS_STEPS + offset - 1;
+}
+
+size_t DynamicMemPoolBestFit::SizeClassSize(size_t index) {
+  if (index < DYNAMIC_MEM_SIZE_CLASS_STEPS) {
+    return (index + 1) * DYNAMIC_MEM_ALIGN_SIZE;
+  }
+  constexpr size_t kLog2Steps = 2;
+  size_t power = (index - DYNAMIC_MEM_SIZE_CLASS_STEPS) / DYNAMIC_MEM_SIZE_CLASS_STEPS + kLog2Steps;
+  size_t offset = (index - DYNAMIC_MEM_SIZE_CLASS_STEPS) % DYNAMIC_MEM_SIZE_CLASS_STEPS + 1;
+  size_t units = (static_cast<size_t>(1) << power) + offset * (static_cast<size_t>(1) << (power - kLog2Steps));
+  return units * DYNAMIC_MEM_ALIGN_SIZE;
+}
+
+void DynamicMemPoolBestFit::set_enable_size_class(bool enable_size_class) {
+  std::lock_guard<std::mutex> locker(mutex_);
+  if (!enable_size_class) {
+    ReleaseSizeClassCache(common_mem_);
+    ReleaseSizeClassCache(persistent_mem_);
+  }
+  enable_size_class_ = enable_size_class;
+  MS_LOG(INFO) << "Set the size class allocation of dynamic memory pool: " << enable_size_class;
+}
+
+void DynamicMemPoolBestFit::ReleaseSizeClassCache() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  ReleaseSizeClassCache(common_mem_);
+  ReleaseSizeClassCache(persistent_mem_);
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::FindCachedMemBuf(size_t size_class_index, bool from_persistent_mem) {
+  auto mem_mng = from_persistent_mem ? persistent_mem_ : common_mem_;
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  if (size_class_index >= mem_mng->size_class_free_lists_.size() ||
+      mem_mng->size_class_free_lists_[size_class_index].empty()) {
+    return nullptr;
+  }
+  auto &free_list = mem_mng->size_class_free_lists_[size_class_index];
+  auto mem_buf = free_list.back();
+  free_list.pop_back();
+  MS_EXCEPTION_IF_NULL(mem_buf);
+  if (mem_buf->status_ != DynamicMemBufStatus::kMemBufCached) {
+    DumpDynamicMemPoolDebugInfo();
+    MS_LOG(EXCEPTION) << "Find the mem_buf is not cached, size_class_index[" << size_class_index << "] mem_buf_size["
+                      << mem_buf->size_ << "] mem_buf_address[" << mem_buf->device_addr_ << "].";
+  }
+  mem_buf->status_ = DynamicMemBufStatus::kMemBufUsed;
+  mem_buf->allocator_name_ = DynamicMemAllocatorDebugInfo::GetDebugInfo().name_;
+  mem_buf->allocator_type_ = DynamicMemAllocatorDebugInfo::GetDebugInfo().type_;
+  // Memory statistics
+  mem_mng->mps_.total_cached_mem_size_ -= mem_buf->size_;
+  IncreaseUsedMemStatistics(mem_buf, mem_mng);
+  return mem_buf->device_addr_;
+}
+
+bool DynamicMemPoolBestFit::CacheMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
+                                        const MemStatusManagerPtr &mem_mng) {
+  MS_EXCEPTION_IF_NULL(mem_block);
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  const auto &iter = mem_block->block_all_mem_buf_map_.find(device_addr);
+  if (iter == mem_block->block_all_mem_buf_map_.end()) {
+    return false;
+  }
+  auto mem_buf = iter->second;
+  MS_EXCEPTION_IF_NULL(mem_buf);
+  // Only the memory buf whose size is exactly the size class can be cached, others are combined into the idle map.
+  auto size_class_index = SizeClassIndex(mem_buf->size_);
+  if (mem_buf->status_ != DynamicMemBufStatus::kMemBufUsed || size_class_index == kSizeClassInvalidIndex ||
+      SizeClassSize(size_class_index) != mem_buf->size_) {
+    return false;
+  }
+  DecreaseUsedMemStatistics(mem_buf, mem_mng);
+  mem_buf->status_ = DynamicMemBufStatus::kMemBufCached;
+  mem_mng->mps_.total_cached_mem_size_ += mem_buf->size_;
+  if (size_class_index >= mem_mng->size_class_free_lists_.size()) {
+    mem_mng->size_class_free_lists_.resize(size_class_index + 1);
+  }
+  mem_mng->size_class_free_lists_[size_class_index].emplace_back(mem_buf);
+  return true;
+}
+
+void DynamicMemPoolBestFit::ReleaseSizeClassCache(const MemStatusManagerPtr &mem_mng) {
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  for (auto &free_list : mem_mng->size_class_free_lists_) {
+    for (auto &mem_buf : free_list) {
+      MS_EXCEPTION_IF_NULL(mem_buf);
+      auto mem_block = FindMemBlock(mem_buf->device_addr_, mem_mng);
+      MS_EXCEPTION_IF_NULL(mem_block);
+      // Turn back to the used status, then the memory buf can be combined as the normal memory free.
+      mem_buf->status_ = DynamicMemBufStatus::kMemBufUsed;
+      IncreaseUsedMemStatistics(mem_buf, mem_mng);
+      CombineMemBuf(mem_block, mem_buf->device_addr_, mem_mng);
+    }
+    free_list.clear();
+  }
+  mem_mng->mps_.total_cached_mem_size_ = 0;
+}
+
+size_t DynamicMemPoolBestFit::GenPoolId() {
+  static std::atomic<size_t> pool_id_counter{0};
+  return ++pool_id_counter;
+}
+
+void DynamicMemPoolBestFit::set_enable_thread_cache(bool enable_thread_cache) {
+  if (!enable_thread_cache) {
+    ReconcileThreadCaches();
+  }
+  enable_thread_cache_ = enable_thread_cache;
+  MS_LOG(INFO) << "Set the thread cache of dynamic memory pool: " << enable_thread_cache;
+}
+
+void DynamicMemPoolBestFit::ReconcileThreadCaches() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  for (const auto &thread_cache : thread_caches_) {
+    ReconcileThreadCache(thread_cache);
+  }
+}
+
+size_t DynamicMemPoolBestFit::TotalThreadCachedMemStatistics() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  size_t total_size = 0;
+  for (const auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    total_size += thread_cache->cached_mem_size_;
+  }
+  return total_size;
+}
+
+ThreadMemCachePtr DynamicMemPoolBestFit::GetThreadMemCache() {
+  // The key is the pool id, because one thread may alloc memory from several memory pools.
+  static thread_local std::unordered_map<size_t, ThreadMemCachePtr> thread_mem_caches;
+  const auto &iter = thread_mem_caches.find(pool_id_);
+  if (iter != thread_mem_caches.end()) {
+    return iter->second;
+  }
+
+  auto thread_cache = std::make_shared<ThreadMemCache>();
+  std::lock_guard<std::mutex> locker(mutex_);
+  // The thread cache which is only referred by the memory pool belongs to the exited thread, remove it.
+  for (auto cache_iter = thread_caches_.begin(); cache_iter != thread_caches_.end();) {
+    if (cache_iter->use_count() == 1) {
+      ReconcileThreadCache(*cache_iter);
+      cache_iter = thread_caches_.erase(cache_iter);
+    } else {
+      ++cache_iter;
+    }
+  }
+  thread_caches_.emplace_back(thread_cache);
+  thread_mem_caches[pool_id_] = thread_cache;
+  return thread_cache;
+}
+
+DeviceMemPtr DynamicMemPoolBestFit::AllocFromThreadCache(size_t size_class_index) {
+  auto thread_cache = GetThreadMemCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  auto size = SizeClassSize(size_class_index);
+  auto allocator_type = DynamicMemAllocatorDebugInfo::GetDebugInfo().type_;
+  MS_EXCEPTION_IF_CHECK_FAIL((static_cast<int>(allocator_type) < ALLOCATOR_TYPE_NUM),
+                             "Allocator type is out of range.");
+  {
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    if (size_class_index < thread_cache->free_lists_.size() && !thread_cache->free_lists_[size_class_index].empty()) {
+      auto device_addr = thread_cache->free_lists_[size_class_index].back();
+      thread_cache->free_lists_[size_class_index].pop_back();
+      thread_cache->cached_mem_size_ -= size;
+      // The memory buf in the memory pool keeps the allocator type of the first user, the new user is recorded here.
+      thread_cache->owned_mem_[device_addr].allocator_type_ = allocator_type;
+      thread_cache->used_mem_size_by_type_[static_cast<int>(allocator_type)] += size;
+      ++thread_cache->hit_count_;
+      return device_addr;
+    }
+  }
+
+  // The thread cache is missed, alloc the memory of the size class from the memory pool.
+  std::lock_guard<std::mutex> locker(mutex_);
+  auto device_addr = AllocTensorMemInner(size, false);
+  if (device_addr != nullptr) {
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    ThreadOwnedMem owned_mem;
+    owned_mem.size_class_index_ = size_class_index;
+    owned_mem.pool_allocator_type_ = allocator_type;
+    owned_mem.allocator_type_ = allocator_type;
+    thread_cache->owned_mem_[device_addr] = owned_mem;
+    thread_cache->owned_mem_size_by_type_[static_cast<int>(allocator_type)] += size;
+    thread_cache->used_mem_size_by_type_[static_cast<int>(allocator_type)] += size;
+    ++thread_cache->miss_count_;
+  }
+  return device_addr;
+}
+
+bool DynamicMemPoolBestFit::FreeToThreadCache(const DeviceMemPtr &device_addr, size_t *free_size,
+                                              AllocatorType *allocator_type) {
+  MS_EXCEPTION_IF_NULL(free_size);
+  MS_EXCEPTION_IF_NULL(allocator_type);
+  auto thread_cache = GetThreadMemCache();
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  std::vector<DeviceMemPtr> reconciled_addrs;
+  {
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    const auto &iter = thread_cache->owned_mem_.find(device_addr);
+    if (iter == thread_cache->owned_mem_.end()) {
+      return false;
+    }
+    FreeThreadOwnedMem(thread_cache, iter->second);
+    *allocator_type = iter->second.allocator_type_;
+    auto size_class_index = iter->second.size_class_index_;
+    if (size_class_index >= thread_cache->free_lists_.size()) {
+      thread_cache->free_lists_.resize(size_class_index + 1);
+    }
+    thread_cache->free_lists_[size_class_index].emplace_back(device_addr);
+    thread_cache->cached_mem_size_ += SizeClassSize(size_class_index);
+    *free_size = SizeClassSize(size_class_index);
+    if (thread_cache->cached_mem_size_ <= DYNAMIC_MEM_THREAD_CACHE_MAX_SIZE) {
+      return true;
+    }
+
+    // Return the cached memory from the large size class to the memory pool, until half of the cache is released.
+    for (size_t i = thread_cache->free_lists_.size(); i > 0; --i) {
+      auto &free_list = thread_cache->free_lists_[i - 1];
+      while (!free_list.empty() && thread_cache->cached_mem_size_ > DYNAMIC_MEM_THREAD_CACHE_MAX_SIZE / 2) {
+        reconciled_addrs.emplace_back(free_list.back());
+        EraseThreadOwnedMem(thread_cache, free_list.back());
+        free_list.pop_back();
+        thread_cache->cached_mem_size_ -= SizeClassSize(i - 1);
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> locker(mutex_);
+  for (const auto &addr : reconciled_addrs) {
+    FreeTensorMemInner(addr);
+  }
+  return true;
+}
+
+bool DynamicMemPoolBestFit::FreeToOwnerThreadCache(const DeviceMemPtr &device_addr, size_t *free_size,
+                                                   AllocatorType *allocator_type) {
+  MS_EXCEPTION_IF_NULL(free_size);
+  MS_EXCEPTION_IF_NULL(allocator_type);
+  for (const auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    const auto &iter = thread_cache->owned_mem_.find(device_addr);
+    if (iter == thread_cache->owned_mem_.end()) {
+      continue;
+    }
+    FreeThreadOwnedMem(thread_cache, iter->second);
+    *allocator_type = iter->second.allocator_type_;
+    // The thread cache is disabled, the memory is returned to the memory pool directly.
+    if (!enable_thread_cache_) {
+      EraseThreadOwnedMem(thread_cache, device_addr);
+      *free_size = FreeTensorMemInner(device_addr);
+      return true;
+    }
+    // The exceeded memory will be reconciled when the owner thread frees memory.
+    auto size_class_index = iter->second.size_class_index_;
+    if (size_class_index >= thread_cache->free_lists_.size()) {
+      thread_cache->free_lists_.resize(size_class_index + 1);
+    }
+    thread_cache->free_lists_[size_class_index].emplace_back(device_addr);
+    thread_cache->cached_mem_size_ += SizeClassSize(size_class_index);
+    *free_size = SizeClassSize(size_class_index);
+    return true;
+  }
+  return false;
+}
+
+void DynamicMemPoolBestFit::ReconcileThreadCache(const ThreadMemCachePtr &thread_cache) {
+  MS_EXCEPTION_IF_NULL(thread_cache);
+  std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+  for (auto &free_list : thread_cache->free_lists_) {
+    for (const auto &device_addr : free_list) {
+      EraseThreadOwnedMem(thread_cache, device_addr);
+      FreeTensorMemInner(device_addr);
+    }
+    free_list.clear();
+  }
+  thread_cache->cached_mem_size_ = 0;
+}
+
+void DynamicMemPoolBestFit::IncreaseUsedMemStatistics(const DynamicMemBufPtr &mem_buf,
+                                                      const MemStatusManagerPtr &mem_mng) const {
+  MS_EXCEPTION_IF_NULL(mem_buf);
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  auto &mps = mem_mng->mps_;
+  mps.total_used_mem_size_ += mem_buf->size_;
+  if (mps.total_used_mem_size_ > mps.used_mem_peak_size_) {
+    mps.used_mem_peak_size_ = mps.total_used_mem_size_;
+  }
+  auto type = static_cast<int>(mem_buf->allocator_type_);
+  MS_EXCEPTION_IF_CHECK_FAIL((type < ALLOCATOR_TYPE_NUM), "Allocator type is out of range.");
+  mps.used_mem_size_by_type_[type] += mem_buf->size_;
+  if (mps.used_mem_size_by_type_[type] > mps.used_mem_peak_size_by_type_[type]) {
+    mps.used_mem_peak_size_by_type_[type] = mps.used_mem_size_by_type_[type];
+  }
+}
+
+void DynamicMemPoolBestFit::DecreaseUsedMemStatistics(const DynamicMemBufPtr &mem_buf,
+                                                      const MemStatusManagerPtr &mem_mng) {
+  MS_EXCEPTION_IF_NULL(mem_buf);
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  auto &mps = mem_mng->mps_;
+  if (mps.total_used_mem_size_ < mem_buf->size_) {
+    DumpDynamicMemPoolDebugInfo();
+    MS_LOG(EXCEPTION) << "The total used mem size is less than the size of membuf.";
+  }
+  mps.total_used_mem_size_ -= mem_buf->size_;
+  auto type = static_cast<int>(mem_buf->allocator_type_);
+  MS_EXCEPTION_IF_CHECK_FAIL((type < ALLOCATOR_TYPE_NUM), "Allocator type is out of range.");
+  // The allocator type of continuous memory buf may be changed, so the used size of type is decreased to 0 at least.
+  mps.used_mem_size_by_type_[type] -= std::min(mps.used_mem_size_by_type_[type], mem_buf->size_);
+}
+
+DynamicMemPoolStats DynamicMemPoolBestFit::GetMemPoolStats() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  DynamicMemPoolStats stats;
+  for (const auto &mem_mng : {common_mem_, persistent_mem_}) {
+    MS_EXCEPTION_IF_NULL(mem_mng);
+    const auto &mps = mem_mng->mps_;
+    stats.total_mem_size_ += mps.total_mem_size_;
+    stats.total_used_mem_size_ += mps.total_used_mem_size_;
+    stats.used_mem_peak_size_ += mps.used_mem_peak_size_;
+    stats.total_cached_mem_size_ += mps.total_cached_mem_size_;
+    stats.idle_mem_buf_count_ += mem_mng->idle_mem_buf_map_.size();
+    stats.mem_block_count_ += mem_mng->mem_block_list_.size();
+    if (!mem_mng->idle_mem_buf_map_.empty()) {
+      stats.largest_idle_mem_buf_size_ =
+        std::max(stats.largest_idle_mem_buf_size_, mem_mng->idle_mem_buf_map_.rbegin()->first);
+    }
+    for (int i = 0; i < ALLOCATOR_TYPE_NUM; ++i) {
+      stats.used_mem_size_by_type_[i] += mps.used_mem_size_by_type_[i];
+      stats.used_mem_peak_size_by_type_[i] += mps.used_mem_peak_size_by_type_[i];
+    }
+  }
+  // The memory pool counts the memory owned by the thread caches as used by the type of the first user, replace it
+  // with the memory in use by the type of the current user.
+  for (const auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    stats.thread_cached_mem_size_ += thread_cache->cached_mem_size_;
+    stats.thread_cache_hit_count_ += thread_cache->hit_count_;
+    stats.thread_cache_miss_count_ += thread_cache->miss_count_;
+    for (int i = 0; i < ALLOCATOR_TYPE_NUM; ++i) {
+      auto &used_size = stats.used_mem_size_by_type_[i];
+      used_size += thread_cache->used_mem_size_by_type_[i];
+      used_size -= std::min(used_size, thread_cache->owned_mem_size_by_type_[i]);
+    }
+  }
+  if (stats.total_mem_size_ > stats.total_used_mem_size_ + stats.total_cached_mem_size_) {
+    stats.total_idle_mem_size_ = stats.total_mem_size_ - stats.total_used_mem_size_ - stats.total_cached_mem_size_;
+    stats.fragmentation_ratio_ =
+      1.0f - static_cast<float>(stats.largest_idle_mem_buf_size_) / static_cast<float>(stats.total_idle_mem_size_);
+  }
+  return stats;
+}
+
+size_t DynamicMemPoolBestFit::MemEventTimelineSizeFromEnv() {
+  auto timeline_size = common::GetEnv("MS_DEV_MEMPOOL_TIMELINE_SIZE");
+  if (timeline_size.empty()) {
+    return 0;
+  }
+  try {
+    return LongToSize(std::stol(timeline_size));
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid MS_DEV_MEMPOOL_TIMELINE_SIZE: " << timeline_size << ", error: " << e.what();
+  }
+  return 0;
+}
+
+void DynamicMemPoolBestFit::EnableMemEventTimeline(size_t capacity) {
+  std::lock_guard<std::mutex> locker(event_mutex_);
+  events_.clear();
+  events_.resize(capacity);
+  event_count_ = 0;
+  event_capacity_ = capacity;
+}
+
+std::vector<DynamicMemEvent> DynamicMemPoolBestFit::GetMemEventTimeline() {
+  std::lock_guard<std::mutex> locker(event_mutex_);
+  std::vector<DynamicMemEvent> events;
+  size_t capacity = events_.size();
+  if (capacity == 0) {
+    return events;
+  }
+  size_t begin = event_count_ > capacity ? event_count_ - capacity : 0;
+  for (size_t i = begin; i < event_count_; ++i) {
+    events.emplace_back(events_[i % capacity]);
+  }
+  return events;
+}
+
+void DynamicMemPoolBestFit::RecordMemEvent(bool is_alloc, const DeviceMemPtr &device_addr, size_t size,
+                                           AllocatorType allocator_type) {
+  auto time_stamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+  std::lock_guard<std::mutex> locker(event_mutex_);
+  if (events_.empty()) {
+    return;
+  }
+  auto &event = events_[event_count_ % events_.size()];
+  event.time_stamp_ = static_cast<uint64_t>(time_stamp);
+  event.is_alloc_ = is_alloc;
+  event.device_addr_ = device_addr;
+  event.size_ = size;
+  event.allocator_type_ = allocator_type;
+  event.total_used_mem_size_ = TotalUsedMemStatistics();
+  ++event_count_;
+}
+
 size_t DynamicMemPoolBestFit::AlignMemorySize(size_t size) const {
   if (size == 0) {
     return DYNAMIC_MEM_ALIGN_SIZE;
@@ -147,10 +669,7 @@ DeviceMemPtr DynamicMemPoolBestFit::FindIdleMemBuf(size_t size, bool from_persis
       SplitMemBuf(size, mem_buf, mem_mng);
     }
     // Memory statistics
-    mem_mng->mps_.total_used_mem_size_ += mem_buf->size_;
-    if (mem_mng->mps_.total_used_mem_size_ > mem_mng->mps_.used_mem_peak_size_) {
-      mem_mng->mps_.used_mem_peak_size_ = mem_mng->mps_.total_used_mem_size_;
-    }
+    IncreaseUsedMemStatistics(mem_buf, mem_mng);
     return mem_buf->device_addr_;
   }
   return nullptr;
@@ -223,6 +742,15 @@ DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_
     mem_mng = persistent_mem_;
   }
   MS_EXCEPTION_IF_NULL(mem_mng);
+  // The new device memory from the expandable segment is contiguous with the memory block, expand the memory block
+  // instead of adding a new one, then the idle memory at the tail of block can be combined.
+  auto prev_mem_block =
+    (!IsExpandableSegment() || mem_mng->mem_block_list_.empty()) ? nullptr : FindMemBlock(device_addr, mem_mng);
+  if (prev_mem_block != nullptr &&
+      AddressOffset(prev_mem_block->device_addr(), prev_mem_block->size()) == static_cast<uint8_t *>(device_addr)) {
+    ExpandMemBlock(prev_mem_block, device_addr, real_alloc_size, mem_mng);
+    return FindIdleMemBuf(size, from_persistent_mem);
+  }
   auto mem_block = std::make_shared<DynamicMemBlock>(device_addr, real_alloc_size);
   MS_EXCEPTION_IF_NULL(mem_block);
   const auto &iter =
@@ -241,13 +769,33 @@ DeviceMemPtr DynamicMemPoolBestFit::AddMemBlockAndMemBuf(size_t size, bool from_
   }
   // Memory statistics
   mem_mng->mps_.total_mem_size_ += real_alloc_size;
-  mem_mng->mps_.total_used_mem_size_ += mem_buf->size_;
-  if (mem_mng->mps_.total_used_mem_size_ > mem_mng->mps_.used_mem_peak_size_) {
-    mem_mng->mps_.used_mem_peak_size_ = mem_mng->mps_.total_used_mem_size_;
-  }
+  IncreaseUsedMemStatistics(mem_buf, mem_mng);
   return mem_buf->device_addr_;
 }
 
+void DynamicMemPoolBestFit::ExpandMemBlock(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
+                                           size_t size, const MemStatusManagerPtr &mem_mng) {
+  MS_EXCEPTION_IF_NULL(mem_block);
+  MS_EXCEPTION_IF_NULL(mem_mng);
+  mem_block->mem_block_size_ += size;
+  mem_block->expanded_device_addrs_.emplace_back(device_addr);
+  mem_mng->mps_.total_mem_size_ += size;
+  // Combine the new memory into the idle memory buf at the tail of memory block.
+  if (!mem_block->block_all_mem_buf_map_.empty()) {
+    auto last_mem_buf = mem_block->block_all_mem_buf_map_.rbegin()->second;
+    MS_EXCEPTION_IF_NULL(last_mem_buf);
+    if (last_mem_buf->status_ == DynamicMemBufStatus::kMemBufIdle) {
+      EraseIdleMemBuf(last_mem_buf->size_, last_mem_buf->device_addr_, mem_mng);
+      last_mem_buf->size_ += size;
+      (void)mem_mng->idle_mem_buf_map_.emplace(last_mem_buf->size_, last_mem_buf);
+      return;
+    }
+  }
+  auto mem_buf = std::make_shared<DynamicMemBuf>(device_addr, DynamicMemBufStatus::kMemBufIdle, size);
+  (void)mem_block->block_all_mem_buf_map_.emplace(device_addr, mem_buf);
+  (void)mem_mng->idle_mem_buf_map_.emplace(size, mem_buf);
+}
+
 size_t DynamicMemPoolBestFit::CalMemBlockAllocSize(size_t size, bool from_persistent_mem) {
   auto device_free_mem_size = free_mem_size();
   if (device_free_mem_size < size) {
@@ -314,12 +862,38 @@ DynamicMemBlockPtr DynamicMemPoolBestFit::FindMemBlock(const DeviceMemPtr &devic
 
 void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
   MS_EXCEPTION_IF_NULL(device_addr);
-  std::lock_guard<std::mutex> locker(mutex_);
-  auto fn = [this](const MemStatusManagerPtr &mem_mng, const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
+  size_t free_size = 0;
+  // The allocator type of the event is the type of the memory user, which may be different from the freeing thread.
+  auto allocator_type = AllocatorType::kOther;
+  if (!enable_thread_cache_ || !FreeToThreadCache(device_addr, &free_size, &allocator_type)) {
+    std::lock_guard<std::mutex> locker(mutex_);
+    if (thread_caches_.empty() || !FreeToOwnerThreadCache(device_addr, &free_size, &allocator_type)) {
+      free_size = FreeTensorMemInner(device_addr, &allocator_type);
+    }
+  }
+  if (event_capacity_ > 0) {
+    RecordMemEvent(false, device_addr, free_size, allocator_type);
+  }
+
+  MS_LOG(DEBUG) << "Free memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
+                << ", address:" << device_addr << ", total allocated mem:" << TotalMemStatistics()
+                << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
+                << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
+}
+
+size_t DynamicMemPoolBestFit::FreeTensorMemInner(const DeviceMemPtr &device_addr, AllocatorType *allocator_type) {
+  size_t free_size = 0;
+  auto fn = [this, &free_size, allocator_type](const MemStatusManagerPtr &mem_mng,
+                                               const DeviceMemPtr &device_addr) -> DynamicMemBlockPtr {
     auto mem_block = FindMemBlock(device_addr, mem_mng);
     if (mem_block != nullptr) {
       const auto &iter = mem_block->block_all_mem_buf_map_.find(device_addr);
       if (iter != mem_block->block_all_mem_buf_map_.end()) {
+        MS_EXCEPTION_IF_NULL(iter->second);
+        free_size = iter->second->size_;
+        if (allocator_type != nullptr) {
+          *allocator_type = iter->second->allocator_type_;
+        }
         return mem_block;
       }
     }
@@ -331,17 +905,17 @@ void DynamicMemPoolBestFit::FreeTensorMem(const DeviceMemPtr &device_addr) {
     if (mem_block == nullptr) {
       // Maybe destroy the memory pool first, then destroy the address, so this is normal case.
       MS_LOG(DEBUG) << "Can't find the mem_block of the device address[" << device_addr << "].";
-      return;
+      return 0;
+    }
+    if (!enable_size_class_ || !CacheMemBuf(mem_block, device_addr, persistent_mem_)) {
+      CombineMemBuf(mem_block, device_addr, persistent_mem_);
     }
-    CombineMemBuf(mem_block, device_addr, persistent_mem_);
   } else {
-    CombineMemBuf(mem_block, device_addr, common_mem_);
+    if (!enable_size_class_ || !CacheMemBuf(mem_block, device_addr, common_mem_)) {
+      CombineMemBuf(mem_block, device_addr, common_mem_);
+    }
   }
-
-  MS_LOG(DEBUG) << "Free memory details, name:" << DynamicMemAllocatorDebugInfo::GetDebugInfo().name_
-                << ", address:" << device_addr << ", total allocated mem:" << TotalMemStatistics()
-                << "B, peak used mem:" << UsedMemPeakStatistics() << "B, in used mem:" << TotalUsedMemStatistics()
-                << "B, total idle mem:" << (TotalMemStatistics() - TotalUsedMemStatistics()) << "B.";
+  return free_size;
 }
 
 void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
@@ -360,11 +934,7 @@ void DynamicMemPoolBestFit::CombineMemBuf(const DynamicMemBlockPtr &mem_block, c
     MS_LOG(EXCEPTION) << "Find the mem_buf is not used, mem_buf_address[" << mem_buf->device_addr_ << "].";
   }
   mem_buf->status_ = DynamicMemBufStatus::kMemBufIdle;
-  if (mem_mng->mps_.total_used_mem_size_ < mem_buf->size_) {
-    DumpDynamicMemPoolDebugInfo();
-    MS_LOG(EXCEPTION) << "The total used mem size is less than the size of membuf.";
-  }
-  mem_mng->mps_.total_used_mem_size_ -= mem_buf->size_;
+  DecreaseUsedMemStatistics(mem_buf, mem_mng);
   // Combine backward(combine the next_mem_buf to mem_buf)
   auto next_iter = iter;
   (void)next_iter++;
@@ -418,7 +988,7 @@ void DynamicMemPoolBestFit::EraseIdleMemBuf(size_t size, const DeviceMemPtr &dev
 
 void DynamicMemPoolBestFit::ReleaseDeviceRes() {
   std::lock_guard<std::mutex> locker(mutex_);
-  DumpDynamicMemPoolStateInfo();
+  DumpDynamicMemPoolStateInfoInner();
 
   auto fn = [this](const MemStatusManagerPtr &mem_mng) {
     for (auto &iter : mem_mng->mem_block_list_) {
@@ -429,15 +999,38 @@ void DynamicMemPoolBestFit::ReleaseDeviceRes() {
         }
         device_addr = nullptr;
       }
+      for (const auto &expanded_device_addr : iter->expanded_device_addrs_) {
+        if (!FreeDeviceMem(expanded_device_addr)) {
+          MS_LOG(EXCEPTION) << "Free device memory[" << expanded_device_addr << "] error.";
+        }
+      }
+      iter->expanded_device_addrs_.clear();
     }
     mem_mng->mem_block_list_.clear();
     mem_mng->idle_mem_buf_map_.clear();
+    mem_mng->size_class_free_lists_.clear();
+    mem_mng->mps_.total_cached_mem_size_ = 0;
   };
   fn(common_mem_);
   fn(persistent_mem_);
+  // The memory in the thread caches has been released with the memory blocks.
+  for (const auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    thread_cache->free_lists_.clear();
+    thread_cache->owned_mem_.clear();
+    thread_cache->cached_mem_size_ = 0;
+    std::fill(std::begin(thread_cache->owned_mem_size_by_type_), std::end(thread_cache->owned_mem_size_by_type_), 0);
+    std::fill(std::begin(thread_cache->used_mem_size_by_type_), std::end(thread_cache->used_mem_size_by_type_), 0);
+  }
 }
 
 void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  DumpDynamicMemPoolStateInfoInner();
+}
+
+void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfoInner() {
   size_t total_used_size_list[ALLOCATOR_TYPE_NUM] = {0};
   auto fn = [&](const MemStatusManagerPtr &mem_mng, const std::string &mem_type) {
     if (mem_mng->mem_block_list_.empty()) {
@@ -465,6 +1058,7 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                  << "M, peak used mem:" << mem_mng->mps_.used_mem_peak_size_ / kMBToByte
                  << "M, in used mem:" << mem_mng->mps_.total_used_mem_size_ / kMBToByte << "M, total idle mem:"
                  << (mem_mng->mps_.total_mem_size_ - mem_mng->mps_.total_used_mem_size_) / kMBToByte
+                 << "M, size class cached mem:" << mem_mng->mps_.total_cached_mem_size_ / kMBToByte
                  << "M. Block unit size:" << mem_mng->unit_size_ / kMBToByte
                  << "M, block counts:" << mem_mng->mem_block_list_.size() << buf.str();
   };
@@ -482,6 +1076,23 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolStateInfo() {
                << total_used_size_list[static_cast<int>(AllocatorType::kKernelOutput)] / kMBToByte
                << "M, other used size:" << total_used_size_list[static_cast<int>(AllocatorType::kOther)] / kMBToByte
                << "M.";
+
+  if (thread_caches_.empty()) {
+    return;
+  }
+  size_t total_thread_cached_size = 0;
+  size_t total_hit_count = 0;
+  size_t total_miss_count = 0;
+  for (const auto &thread_cache : thread_caches_) {
+    MS_EXCEPTION_IF_NULL(thread_cache);
+    std::lock_guard<std::mutex> cache_locker(thread_cache->mutex_);
+    total_thread_cached_size += thread_cache->cached_mem_size_;
+    total_hit_count += thread_cache->hit_count_;
+    total_miss_count += thread_cache->miss_count_;
+  }
+  MS_LOG(INFO) << "The dynamic memory pool thread cache counts:" << thread_caches_.size()
+               << ", thread cached mem:" << total_thread_cached_size / kMBToByte << "M, hit counts:" << total_hit_count
+               << ", miss counts:" << total_miss_count << ".";
 }
 
 void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
@@ -490,6 +1101,7 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
     size_t total_used_mem = 0;
     size_t total_idle_mem1 = 0;
     size_t total_idle_mem2 = 0;
+    size_t total_cached_mem = 0;
     // Dump the memory block info and memory buf info.
     MS_LOG(WARNING) << mem_type << " all mem_block info: counts[" << mem_mng->mem_block_list_.size() << "].";
     for (auto iter = mem_mng->mem_block_list_.begin(); iter != mem_mng->mem_block_list_.end(); ++iter) {
@@ -503,6 +1115,8 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
         MS_EXCEPTION_IF_NULL(mem_buf);
         if (mem_buf->status_ == DynamicMemBufStatus::kMemBufIdle) {
           total_idle_mem1 += mem_buf->size_;
+        } else if (mem_buf->status_ == DynamicMemBufStatus::kMemBufCached) {
+          total_cached_mem += mem_buf->size_;
         } else {
           total_used_mem += mem_buf->size_;
         }
@@ -523,11 +1137,14 @@ void DynamicMemPoolBestFit::DumpDynamicMemPoolDebugInfo() {
     }
     // Dump the memory statistical info.
     MS_LOG(WARNING) << mem_type << " total allocated memory[" << total_mem << "], used memory[" << total_used_mem
-                    << "], idle memory[" << total_idle_mem1 << "].";
+                    << "], idle memory[" << total_idle_mem1 << "], cached memory[" << total_cached_mem << "].";
     if (total_idle_mem1 != total_idle_mem2) {
       MS_LOG(ERROR) << "Check error: the idle memory in the mem_block is not equal the global idle memory.";
     }
-    if (total_mem != total_used_mem + total_idle_mem1) {
+    if (total_cached_mem != mem_mng->mps_.total_cached_mem_size_) {
+      MS_LOG(ERROR) << "Check error: the cached memory in the mem_block is not equal the size class cached memory.";
+    }
+    if (total_mem != total_used_mem + total_idle_mem1 + total_cached_mem) {
       MS_LOG(ERROR) << "Check error: the the total memory is not equal the sum of used memory and idle memory.";
     }
   };
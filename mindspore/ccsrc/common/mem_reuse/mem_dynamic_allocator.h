@@ -25,14 +25,17 @@
 #include <thread>
 #include <mutex>
 #include <string>
+#include <limits>
+#include <atomic>
+#include <unordered_map>
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace device {
 using DeviceMemPtr = void(*);
 
-// The status of memory buf.
-enum class DynamicMemBufStatus : int { kMemBufIdle, kMemBufUsed };
+// The status of memory buf, the cached memory buf is free but kept in the size class free list for the fast reuse.
+enum class DynamicMemBufStatus : int { kMemBufIdle, kMemBufUsed, kMemBufCached };
 
 // Memory allocator type is used to record the memory classification statistics information.
 enum class AllocatorType : int { kWeight, kConstantValue, kKernelOutput, kOther };
@@ -44,6 +47,16 @@ static const size_t DYNAMIC_MEM_ALIGN_SIZE = 512;
 // The minimum unit size (1G) of memory block used for dynamic extend.
 static const size_t DYNAMIC_MEM_ALLOC_UNIT_SIZE = 1024 << 20;
 
+// The memory whose aligned size is not larger than this size (8M) is allocated from the size class free list, when the
+// size class allocation is enabled by the environment variable MS_DEV_MEMPOOL_SIZE_CLASS=1.
+static const size_t DYNAMIC_MEM_SIZE_CLASS_MAX_SIZE = 8 << 20;
+// The number of size classes between two adjacent powers of two, which limits the internal waste within 25%.
+static const size_t DYNAMIC_MEM_SIZE_CLASS_STEPS = 4;
+
+// The maximum size (64M) of memory kept in one thread cache, the thread cache is enabled by the environment variable
+// MS_DEV_MEMPOOL_THREAD_CACHE=1.
+static const size_t DYNAMIC_MEM_THREAD_CACHE_MAX_SIZE = 64 << 20;
+
 // The Comparator of device address from small to large.
 struct DeviceAddrCmp {
   bool operator()(const DeviceMemPtr &addr1, const DeviceMemPtr &addr2) const { return addr1 < addr2; }
@@ -118,6 +131,8 @@ class DynamicMemBlock {
 
   DeviceMemPtr device_addr_base_{nullptr};
   size_t mem_block_size_{0};
+  // The contiguous device memory which expands this memory block, they are freed with the memory block.
+  std::vector<DeviceMemPtr> expanded_device_addrs_;
 };
 using DynamicMemBlockPtr = std::shared_ptr<DynamicMemBlock>;
 
@@ -128,6 +143,43 @@ struct DeviceState {
   size_t total_used_mem_size_{0};
   // Maximum peak memory usage
   size_t used_mem_peak_size_{0};
+  // Memory kept in the size class free lists
+  size_t total_cached_mem_size_{0};
+  // Memory in use and maximum peak memory usage of each allocator type
+  size_t used_mem_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+  size_t used_mem_peak_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+};
+
+// The statistics snapshot of the dynamic memory pool, which includes the common mem and persistent mem.
+struct DynamicMemPoolStats {
+  size_t total_mem_size_{0};
+  size_t total_used_mem_size_{0};
+  size_t used_mem_peak_size_{0};
+  size_t total_idle_mem_size_{0};
+  size_t total_cached_mem_size_{0};
+  size_t largest_idle_mem_buf_size_{0};
+  size_t idle_mem_buf_count_{0};
+  size_t mem_block_count_{0};
+  // The ratio of idle memory which can't be allocated as a whole: 1 - largest idle mem buf / total idle mem.
+  float fragmentation_ratio_{0.0f};
+  size_t used_mem_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+  size_t used_mem_peak_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+  // The memory kept in the thread caches, and the alloc counts served or missed by the thread caches.
+  size_t thread_cached_mem_size_{0};
+  size_t thread_cache_hit_count_{0};
+  size_t thread_cache_miss_count_{0};
+};
+
+// The event of memory alloc and free recorded in the ring buffer timeline of the dynamic memory pool.
+struct DynamicMemEvent {
+  // The steady clock time stamp in nanoseconds.
+  uint64_t time_stamp_{0};
+  bool is_alloc_{true};
+  DeviceMemPtr device_addr_{nullptr};
+  size_t size_{0};
+  AllocatorType allocator_type_{AllocatorType::kOther};
+  // The total used memory of memory pool after the event.
+  size_t total_used_mem_size_{0};
 };
 
 struct MemStatusManager {
@@ -137,20 +189,64 @@ struct MemStatusManager {
   std::vector<DynamicMemBlockPtr> mem_block_list_;
   // The map of all idle memory buf by size.
   SizeMapMemBuf idle_mem_buf_map_;
+  // The free lists of cached memory buf, indexed by the size class.
+  std::vector<std::vector<DynamicMemBufPtr>> size_class_free_lists_;
   void clear() noexcept {
     mem_block_list_.clear();
     idle_mem_buf_map_.clear();
+    size_class_free_lists_.clear();
+    mps_.total_cached_mem_size_ = 0;
   }
 };
 using MemStatusManagerPtr = std::shared_ptr<MemStatusManager>;
 
+// The memory owned by the thread cache, which is a used memory buf from the view of memory pool.
+struct ThreadOwnedMem {
+  size_t size_class_index_{0};
+  // The allocator type of the memory buf in the memory pool, which is set when the thread cache allocates it.
+  AllocatorType pool_allocator_type_{AllocatorType::kOther};
+  // The allocator type of the current or the latest user, which is set when the memory is allocated from the cache.
+  AllocatorType allocator_type_{AllocatorType::kOther};
+};
+
+// The cache of the memory alloc thread, which collects the memory free and serves the memory alloc of the size class
+// locally without the lock of memory pool. The memory in the thread cache is used status from the view of memory pool.
+struct ThreadMemCache {
+  // Protect the thread cache from the reconciliation of memory pool, it is uncontended in most cases.
+  std::mutex mutex_;
+  // The free lists of cached device address, indexed by the size class.
+  std::vector<std::vector<DeviceMemPtr>> free_lists_;
+  // The device address allocated by the thread cache and the owned memory info.
+  std::unordered_map<DeviceMemPtr, ThreadOwnedMem> owned_mem_;
+  size_t cached_mem_size_{0};
+  // The owned memory by the allocator type of memory pool, and the memory in use by the allocator type of user, which
+  // correct the used memory statistics of memory pool by allocator type.
+  size_t owned_mem_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+  size_t used_mem_size_by_type_[ALLOCATOR_TYPE_NUM]{0};
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+};
+using ThreadMemCachePtr = std::shared_ptr<ThreadMemCache>;
+
 // The main class of dynamic memory pool.
 class DynamicMemPoolBestFit {
  public:
   DynamicMemPoolBestFit()
-      : persistent_mem_(std::make_shared<MemStatusManager>()), common_mem_(std::make_shared<MemStatusManager>()) {}
+      : persistent_mem_(std::make_shared<MemStatusManager>()),
+        common_mem_(std::make_shared<MemStatusManager>()),
+        enable_size_class_(common::GetEnv("MS_DEV_MEMPOOL_SIZE_CLASS") == "1"),
+        enable_thread_cache_(common::GetEnv("MS_DEV_MEMPOOL_THREAD_CACHE") == "1"),
+        pool_id_(GenPoolId()) {
+    RegisterMemPool(this);
+    EnableMemEventTimeline(MemEventTimelineSizeFromEnv());
+  }
   virtual ~DynamicMemPoolBestFit();
 
+  // The name of memory pool for the statistics query.
+  virtual std::string GetMemPoolName() const { return "DynamicMemPool"; }
+  // Get all the alive memory pools.
+  static std::vector<DynamicMemPoolBestFit *> GetAllMemPools();
+
   // The main program entry of memory alloc.
   DeviceMemPtr AllocTensorMem(size_t size, bool from_persistent_mem = false);
   // The main program entry of continuous memory alloc.
@@ -166,6 +262,23 @@ class DynamicMemPoolBestFit {
   // Set the minimum memory unit size using for dynamic extend.
   void SetMemAllocUintSize(size_t common_size, size_t persist_size = DYNAMIC_MEM_ALLOC_UNIT_SIZE);
 
+  // Enable or disable the size class allocation for the small and medium memory.
+  void set_enable_size_class(bool enable_size_class);
+  bool enable_size_class() const { return enable_size_class_; }
+  // Return all the cached memory buf in the size class free lists to the best fit idle map.
+  void ReleaseSizeClassCache();
+
+  // Enable or disable the thread cache for the small and medium memory of common mem.
+  void set_enable_thread_cache(bool enable_thread_cache);
+  bool enable_thread_cache() const { return enable_thread_cache_; }
+  // Return all the cached memory in the thread caches to the memory pool.
+  void ReconcileThreadCaches();
+
+  // The size class helpers, the index is kSizeClassInvalidIndex if the size is out of the size class range.
+  static constexpr size_t kSizeClassInvalidIndex = std::numeric_limits<size_t>::max();
+  static size_t SizeClassIndex(size_t align_size);
+  static size_t SizeClassSize(size_t index);
+
   // The statistics information.
   size_t TotalMemStatistics() const {
     return common_mem_->mps_.total_mem_size_ + persistent_mem_->mps_.total_mem_size_;
@@ -176,6 +289,19 @@ class DynamicMemPoolBestFit {
   size_t UsedMemPeakStatistics() const {
     return common_mem_->mps_.used_mem_peak_size_ + persistent_mem_->mps_.used_mem_peak_size_;
   }
+  size_t TotalCachedMemStatistics() const {
+    return common_mem_->mps_.total_cached_mem_size_ + persistent_mem_->mps_.total_cached_mem_size_;
+  }
+
+  size_t TotalThreadCachedMemStatistics();
+  // Get the statistics snapshot, which is used by the python and profiler to query the memory state.
+  DynamicMemPoolStats GetMemPoolStats();
+
+  // Enable the ring buffer timeline of memory alloc and free event, the capacity 0 means disable. It can also be
+  // enabled by the environment variable MS_DEV_MEMPOOL_TIMELINE_SIZE.
+  void EnableMemEventTimeline(size_t capacity);
+  // Get the recorded events from the oldest to the latest.
+  std::vector<DynamicMemEvent> GetMemEventTimeline();
 
   // Display the brief state information of memory block and memory buf.
   void DumpDynamicMemPoolStateInfo();
@@ -196,12 +322,28 @@ class DynamicMemPoolBestFit {
   virtual size_t AlignMemorySize(size_t size) const;
   // Calculate memory block required alloc size when adding the memory block.
   virtual size_t CalMemBlockAllocSize(size_t size, bool from_persistent_mem);
+  // Whether the device memory is allocated from an expandable segment, only then the new device memory contiguous with
+  // the memory block is combined into the memory block.
+  virtual bool IsExpandableSegment() const { return false; }
 
  private:
+  // Alloc and free the memory with the lock of memory pool hold.
+  DeviceMemPtr AllocTensorMemInner(size_t align_size, bool from_persistent_mem);
+  // Return the size of the freed memory buf, 0 if the device address isn't found. The allocator type recorded on the
+  // memory buf is returned by the allocator_type if it's not nullptr.
+  size_t FreeTensorMemInner(const DeviceMemPtr &device_addr, AllocatorType *allocator_type = nullptr);
+  // Update the used memory statistics when the memory buf is allocated or freed.
+  void IncreaseUsedMemStatistics(const DynamicMemBufPtr &mem_buf, const MemStatusManagerPtr &mem_mng) const;
+  void DecreaseUsedMemStatistics(const DynamicMemBufPtr &mem_buf, const MemStatusManagerPtr &mem_mng);
+  // Record the memory event to the ring buffer timeline.
+  void RecordMemEvent(bool is_alloc, const DeviceMemPtr &device_addr, size_t size, AllocatorType allocator_type);
   // Find the idle memory buf by aligned size when memory alloc.
   DeviceMemPtr FindIdleMemBuf(size_t size, bool from_persistent_mem);
   // Add the memory block and memory buf when memory alloc not find the idle memory buf.
   DeviceMemPtr AddMemBlockAndMemBuf(size_t size, bool from_persistent_mem);
+  // Expand the memory block by the contiguous device memory, and combine it into the idle memory buf at the tail.
+  void ExpandMemBlock(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr, size_t size,
+                      const MemStatusManagerPtr &mem_mng);
   // Judge whether need split the memory buf by alloc size and memory buf size.
   bool IsSplit(size_t tensor_size, size_t mem_buf_size) const;
   // Split the memory buf by alloc size.
@@ -215,6 +357,29 @@ class DynamicMemPoolBestFit {
                      const MemStatusManagerPtr &mem_mng);
   // Erase the idle memory buf by size and device address when idle memory buf is combined.
   void EraseIdleMemBuf(size_t size, const DeviceMemPtr &device_addr, const MemStatusManagerPtr &mem_mng) const;
+  // Pop the cached memory buf from the size class free list, return nullptr if the free list is empty.
+  DeviceMemPtr FindCachedMemBuf(size_t size_class_index, bool from_persistent_mem);
+  // Push the memory buf to the size class free list when memory free, return false if it can't be cached.
+  bool CacheMemBuf(const DynamicMemBlockPtr &mem_block, const DeviceMemPtr &device_addr,
+                   const MemStatusManagerPtr &mem_mng);
+  // Return the cached memory buf of the memory manager to the best fit idle map.
+  void ReleaseSizeClassCache(const MemStatusManagerPtr &mem_mng);
+  // Get the thread cache of current thread, create and register it to the memory pool at the first time.
+  ThreadMemCachePtr GetThreadMemCache();
+  // Alloc the memory of the size class from the thread cache, and alloc from the memory pool if the cache is missed.
+  DeviceMemPtr AllocFromThreadCache(size_t size_class_index);
+  // Collect the memory free to the thread cache of current thread, return false if the memory is not owned by it.
+  bool FreeToThreadCache(const DeviceMemPtr &device_addr, size_t *free_size, AllocatorType *allocator_type);
+  // Collect the memory free of other thread to the owner thread cache, called with the lock of memory pool hold.
+  bool FreeToOwnerThreadCache(const DeviceMemPtr &device_addr, size_t *free_size, AllocatorType *allocator_type);
+  // Return the cached memory of the thread cache to the memory pool, called with the lock of memory pool hold.
+  void ReconcileThreadCache(const ThreadMemCachePtr &thread_cache);
+  // Display the brief state information, called with the lock of memory pool hold.
+  void DumpDynamicMemPoolStateInfoInner();
+  static size_t GenPoolId();
+  static void RegisterMemPool(DynamicMemPoolBestFit *mem_pool);
+  static size_t MemEventTimelineSizeFromEnv();
+  static void UnregisterMemPool(const DynamicMemPoolBestFit *mem_pool);
 
   // Support multi-thread.
   std::mutex mutex_;
@@ -223,6 +388,19 @@ class DynamicMemPoolBestFit {
   // In the graph mode, the unit size set in the context will be modified through the FetchMemUnitSize function, so it
   // needs to be changed back after that
   size_t config_unit_size_{DYNAMIC_MEM_ALLOC_UNIT_SIZE};
+  // Whether the small and medium memory is allocated from the size class free lists.
+  bool enable_size_class_{false};
+  // Whether the small and medium memory of common mem is allocated from the thread caches.
+  std::atomic<bool> enable_thread_cache_{false};
+  // The unique id to find the thread cache of this memory pool in the thread local storage.
+  size_t pool_id_{0};
+  // All the registered thread caches, protected by the mutex_.
+  std::vector<ThreadMemCachePtr> thread_caches_;
+  // The ring buffer timeline of memory event, protected by the event_mutex_.
+  std::mutex event_mutex_;
+  std::atomic<size_t> event_capacity_{0};
+  std::vector<DynamicMemEvent> events_;
+  size_t event_count_{0};
 };
 }  // namespace device
 }  // namespace mindspore
@@ -21,6 +21,7 @@
 #include "utils/log_adapter.h"
 
 constexpr auto kModelOptionCpuEnableFP16 = "mindspore.option.cpu.enable_fp16";
+constexpr auto kModelOptionCpuPrecisionMode = "mindspore.option.cpu.precision_mode";
 constexpr auto kModelOptionGPUEnableFP16 = "mindspore.option.gpu.enable_fp16";
 constexpr auto kModelOptionKirinNpuFrequency = "mindspore.option.kirin_npu.frequency";
 constexpr auto kModelOptionDeviceID = "mindspore.option.device_id";
@@ -127,6 +128,16 @@ bool CPUDeviceInfo::GetEnableFP16() const {
   return GetValue<bool>(data_, kModelOptionCpuEnableFP16);
 }
 
+void CPUDeviceInfo::SetPrecisionMode(const std::vector<char> &precision_mode) {
+  MS_EXCEPTION_IF_NULL(data_);
+  data_->params[kModelOptionCpuPrecisionMode] = CharToString(precision_mode);
+}
+std::vector<char> CPUDeviceInfo::GetPrecisionModeChar() const {
+  MS_EXCEPTION_IF_NULL(data_);
+  const std::string &ref = GetValue<std::string>(data_, kModelOptionCpuPrecisionMode);
+  return StringToChar(ref);
+}
+
 void GPUDeviceInfo::SetEnableFP16(bool is_fp16) {
   MS_EXCEPTION_IF_NULL(data_);
   data_->params[kModelOptionGPUEnableFP16] = is_fp16;
@@ -15,6 +15,11 @@
  */
 #include "debug/data_dump/dump_json_parser.h"
 #include <fstream>
+#include <condition_variable>
+#include <queue>
+#include <tuple>
+#include <thread>
+#include <utility>
 #include "utils/log_adapter.h"
 #include "include/common/debug/common.h"
 #include "debug/utils.h"
@@ -50,9 +55,104 @@ constexpr auto kDumpInputAndOutput = 0;
 constexpr auto kDumpInputOnly = 1;
 constexpr auto kDumpOutputOnly = 2;
 constexpr auto kMindsporeDumpConfig = "MINDSPORE_DUMP_CONFIG";
+// Write the dump files in the background thread instead of the execution thread when it is set to 1.
+constexpr auto kMindsporeDumpAsyncWrite = "MS_DUMP_ASYNC_WRITE";
+// The max bytes of the dump data waiting for the background thread, the dumping blocks when it is exceeded.
+constexpr size_t kMaxAsyncDumpBytes = 1UL << 30;
 }  // namespace
 
 namespace mindspore {
+namespace {
+bool WriteDumpFile(const std::string &file_path, const std::string &npy_header, const void *data, size_t len) {
+  ChangeFileMode(file_path, S_IWUSR);
+  std::ofstream fd(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!fd.is_open()) {
+    MS_LOG(ERROR) << "Open file " << file_path << " failed." << ErrnoToString(errno);
+    return false;
+  }
+  if (!npy_header.empty()) {
+    fd << npy_header;
+    (void)fd.write(reinterpret_cast<const char *>(data), SizeToLong(len));
+    if (fd.bad()) {
+      fd.close();
+      MS_LOG(ERROR) << "Write mem to file " << file_path << " failed.";
+      return false;
+    }
+    fd.close();
+    ChangeFileMode(file_path, S_IRUSR);
+  }
+  return true;
+}
+
+// The background writer of the dump files. The dump data is copied into the queue so that the device memory can be
+// reused once DumpToFile returns, and the queue is bounded by kMaxAsyncDumpBytes to limit the host memory.
+class AsyncDumpWriter {
+ public:
+  static AsyncDumpWriter &GetInstance() {
+    static AsyncDumpWriter instance;
+    return instance;
+  }
+
+  void Submit(const std::string &file_path, std::string &&npy_header, const void *data, size_t len) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!thread_.joinable()) {
+      thread_ = std::thread(&AsyncDumpWriter::Run, this);
+    }
+    cond_var_.wait(lock, [this, len]() { return pending_bytes_ == 0 || pending_bytes_ + len <= kMaxAsyncDumpBytes; });
+    pending_bytes_ += len;
+    (void)tasks_.emplace(file_path, std::move(npy_header),
+                         std::string(reinterpret_cast<const char *>(data), reinterpret_cast<const char *>(data) + len));
+    cond_var_.notify_all();
+  }
+
+  // Wait for all the submitted dump files to be written.
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_var_.wait(lock, [this]() { return pending_bytes_ == 0 && tasks_.empty(); });
+  }
+
+ private:
+  AsyncDumpWriter() = default;
+  ~AsyncDumpWriter() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      stop_ = true;
+      cond_var_.notify_all();
+    }
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+  DISABLE_COPY_AND_ASSIGN(AsyncDumpWriter)
+
+  void Run() {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cond_var_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      auto task = std::move(tasks_.front());
+      tasks_.pop();
+      lock.unlock();
+      const auto &[file_path, npy_header, data] = task;
+      (void)WriteDumpFile(file_path, npy_header, data.data(), data.size());
+      lock.lock();
+      pending_bytes_ -= data.size();
+      cond_var_.notify_all();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cond_var_;
+  // The file path, npy header and data of the dump files to be written.
+  std::queue<std::tuple<std::string, std::string, std::string>> tasks_;
+  size_t pending_bytes_{0};
+  bool stop_{false};
+  std::thread thread_;
+};
+}  // namespace
+
 auto DumpJsonParser::CheckJsonKeyExist(const nlohmann::json &content, const std::string &key) {
   nlohmann::json::const_iterator iter = content.find(key);
   if (iter == content.end()) {
@@ -296,25 +396,25 @@ bool DumpJsonParser::DumpToFile(const std::string &filename, const void *data, s
   }
   const std::string file_path_str = file_path.value();
   MS_LOG(INFO) << "Dump path is " << file_path_str;
-  ChangeFileMode(file_path_str, S_IWUSR);
-  std::ofstream fd(file_path_str, std::ios::out | std::ios::trunc | std::ios::binary);
-  if (!fd.is_open()) {
-    MS_LOG(EXCEPTION) << "Open file " << file_path_str << " failed." << ErrnoToString(errno);
-  }
   std::string npy_header = GenerateNpyHeader(shape, type);
-  if (!npy_header.empty()) {
-    fd << npy_header;
-    (void)fd.write(reinterpret_cast<const char *>(data), SizeToLong(len));
-    if (fd.bad()) {
-      fd.close();
-      MS_LOG(EXCEPTION) << "Write mem to file " << file_path_str << " failed.";
-    }
-    fd.close();
-    ChangeFileMode(file_path_str, S_IRUSR);
+  if (common::GetEnv(kMindsporeDumpAsyncWrite) == "1") {
+    AsyncDumpWriter::GetInstance().Submit(file_path_str, std::move(npy_header), data, len);
+    return true;
+  }
+  if (!WriteDumpFile(file_path_str, npy_header, data, len)) {
+    MS_LOG(EXCEPTION) << "Dump mem to file " << file_path_str << " failed.";
   }
   return true;
 }
 
+void DumpJsonParser::WaitDumpFilesWritten() { AsyncDumpWriter::GetInstance().Wait(); }
+
+void DumpJsonParser::UpdateDumpIter() {
+  // The dump files of the current iteration are completed before moving to the next iteration.
+  WaitDumpFilesWritten();
+  ++cur_dump_iter_;
+}
+
 void DumpJsonParser::ParseCommonDumpSetting(const nlohmann::json &content) {
   // async_dump is enabled by default, if e2e dump is enabled it will override this
   auto context = MsContext::GetInstance();
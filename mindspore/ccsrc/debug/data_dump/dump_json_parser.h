@@ -43,6 +43,8 @@ class BACKEND_EXPORT DumpJsonParser {
   void Parse();
   static bool DumpToFile(const std::string &filename, const void *data, size_t len, const ShapeVector &shape,
                          TypeId type);
+  // Wait for the dump files written in the background with env MS_DUMP_ASYNC_WRITE.
+  static void WaitDumpFilesWritten();
   void CopyDumpJsonToDir(uint32_t rank_id);
   void CopyHcclJsonToDir(uint32_t rank_id);
   void CopyMSCfgJsonToDir(uint32_t rank_id);
@@ -66,7 +68,7 @@ class BACKEND_EXPORT DumpJsonParser {
   bool trans_flag() const { return trans_flag_; }
   uint32_t cur_dump_iter() const { return cur_dump_iter_; }
   uint32_t input_output() const { return input_output_; }
-  void UpdateDumpIter() { ++cur_dump_iter_; }
+  void UpdateDumpIter();
   bool FileFormatIsNpy() const { return file_format_ == JsonFileFormat::FORMAT_NPY; }
   bool GetIterDumpFlag() const;
   bool DumpEnabledForIter() const;
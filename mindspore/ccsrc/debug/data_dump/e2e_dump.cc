@@ -42,6 +42,10 @@
 #include "debug/tensor_load.h"
 #include "debug/debugger/debugger.h"
 #endif
+#ifdef ENABLE_GPU
+#include "debug/tensor_data.h"
+#include "plugin/device/gpu/hal/device/gpu_tensor_statistics.h"
+#endif
 
 namespace mindspore {
 #ifdef ENABLE_D
@@ -708,6 +712,130 @@ bool E2eDump::DumpSingleNodeData(const CNodePtr &node, uint32_t graph_id, uint32
   return success;
 }
 
+#ifdef ENABLE_GPU
+namespace {
+// The tensor whose statistics are reduced on device and not fetched yet.
+struct DeviceStatDumpInfo {
+  std::string dump_path;
+  TensorStatDump stat_dump;
+  TypeId type;
+  size_t data_size;
+  ShapeVector shape;
+};
+
+std::vector<DeviceStatDumpInfo> device_stat_dump_infos;
+
+void LaunchDeviceStatistics(const kernel::AddressPtr &addr, void *stream, DeviceStatDumpInfo &&info) {
+  MS_EXCEPTION_IF_NULL(addr);
+  if (!device::gpu::GPUTensorStatistics::IsTypeSupported(info.type)) {
+    MS_LOG(INFO) << "Unsupported tensor data_type " << TypeIdToString(info.type) << " for statistic dump on device.";
+    return;
+  }
+  auto &statistics = device::gpu::GPUTensorStatistics::GetInstance();
+  if (statistics.full()) {
+    E2eDump::FlushDeviceStatistics();
+  }
+  if (!statistics.Launch(addr->addr, addr->size, info.type, stream)) {
+    MS_LOG(WARNING) << "Launch tensor statistics on device failed, skipping current statistics";
+    return;
+  }
+  (void)device_stat_dump_infos.emplace_back(std::move(info));
+}
+}  // namespace
+
+/*
+ * Feature group: Dump.
+ * Target device group: GPU.
+ * Runtime category: MindRT.
+ * Description: This function is for the statistic dump of a single node in GPU, which launches the statistics of the
+ * inputs and outputs on device. It is used when the tensors are not dumped and the online debugger is disabled, so the
+ * tensors don't need to be loaded to host.
+ */
+void E2eDump::DumpSingleNodeStatisticsOnDevice(const CNodePtr &node, const std::vector<kernel::AddressPtr> &inputs,
+                                               const std::vector<kernel::AddressPtr> &outputs, void *stream,
+                                               uint32_t graph_id, uint32_t rank_id) {
+  MS_EXCEPTION_IF_NULL(node);
+  auto &dump_json_parser = DumpJsonParser::GetInstance();
+  std::string kernel_name = GetKernelNodeName(node);
+  if (!dump_json_parser.DumpEnabledForIter() || !dump_json_parser.NeedDump(kernel_name)) {
+    return;
+  }
+  dump_json_parser.MatchKernel(kernel_name);
+  GetFileKernelName(NOT_NULL(&kernel_name));
+  std::string dump_path = GenerateDumpPath(graph_id, rank_id);
+  bool trans_flag = dump_json_parser.trans_flag();
+  std::string op_type = common::AnfAlgo::GetCNodeName(node);
+  std::string op_name = GetOpNameWithoutScope(kernel_name);
+  const uint32_t task_id = 0;
+  const uint32_t stream_id = 0;
+  if (dump_json_parser.InputNeedDump()) {
+    auto input_size = std::min(common::AnfAlgo::GetInputTensorNum(node), inputs.size());
+    for (size_t j = 0; j < input_size; ++j) {
+      auto kernel_with_index = common::AnfAlgo::GetPrevNodeOutput(node, j);
+      auto input = kernel_with_index.first;
+      auto index = kernel_with_index.second;
+      if (!AnfAlgo::OutputAddrExist(input, index)) {
+        continue;
+      }
+      ShapeVector int_shapes;
+      GetDumpIntShape(input, index, NOT_NULL(&int_shapes), trans_flag);
+      TensorStatDump stat_dump(op_type, op_name, task_id, stream_id, Common::GetTimeStamp(), true, j, j);
+      DeviceStatDumpInfo info{dump_path, stat_dump, AnfAlgo::GetOutputDeviceDataType(input, index), inputs[j]->size,
+                              int_shapes};
+      LaunchDeviceStatistics(inputs[j], stream, std::move(info));
+    }
+  }
+  if (dump_json_parser.OutputNeedDump()) {
+    auto output_size = std::min(common::AnfAlgo::GetOutputTensorNum(node), outputs.size());
+    for (size_t j = 0; j < output_size; ++j) {
+      if (!AnfAlgo::OutputAddrExist(node, j)) {
+        continue;
+      }
+      ShapeVector int_shapes;
+      GetDumpIntShape(node, j, NOT_NULL(&int_shapes), trans_flag);
+      TensorStatDump stat_dump(op_type, op_name, task_id, stream_id, Common::GetTimeStamp(), false, j, j);
+      DeviceStatDumpInfo info{dump_path, stat_dump, AnfAlgo::GetOutputDeviceDataType(node, j), outputs[j]->size,
+                              int_shapes};
+      LaunchDeviceStatistics(outputs[j], stream, std::move(info));
+    }
+  }
+}
+
+/*
+ * Feature group: Dump.
+ * Target device group: GPU.
+ * Runtime category: MindRT.
+ * Description: This function copies the statistics launched on device to host in one copy and writes them to the
+ * statistic files. It is called at the end of each step, and when the buffer of the statistics on device is full.
+ */
+void E2eDump::FlushDeviceStatistics() {
+  if (device_stat_dump_infos.empty()) {
+    return;
+  }
+  std::vector<TensorStatisticsRecord> records;
+  if (!device::gpu::GPUTensorStatistics::GetInstance().Fetch(&records) ||
+      records.size() != device_stat_dump_infos.size()) {
+    MS_LOG(WARNING) << "Fetch tensor statistics from device failed, skipping current statistics";
+    device_stat_dump_infos.clear();
+    return;
+  }
+  for (size_t i = 0; i < records.size(); ++i) {
+    const auto &record = records[i];
+    auto &info = device_stat_dump_infos[i];
+    TensorData data;
+    data.SetType(info.type);
+    uint64_t count = record.value_num + record.nan_count + record.neg_inf_count + record.pos_inf_count;
+    double avg = record.value_num > 0 ? record.sum / record.value_num : 0.0;
+    uint64_t zero_count = record.value_num - record.neg_count - record.pos_count;
+    DebugServices::TensorStat stat(info.data_size, data.GetType(), info.shape, info.type == kNumberTypeBool,
+                                   record.max_value, record.min_value, avg, count, record.neg_count, record.pos_count,
+                                   record.nan_count, record.neg_inf_count, record.pos_inf_count, zero_count);
+    (void)info.stat_dump.DumpTensorStatsToFile(info.dump_path, data.GetTypeString(), stat);
+  }
+  device_stat_dump_infos.clear();
+}
+#endif
+
 /*
  * Feature group: Dump.
  * Target device group: Ascend, GPU.
@@ -25,6 +25,7 @@
 
 #include "backend/common/session/kernel_graph.h"
 #include "runtime/device/device_address.h"
+#include "kernel/kernel.h"
 #include "debug/data_dump/dump_json_parser.h"
 #include "debug/data_dump/dump_utils.h"
 #ifdef ENABLE_DEBUGGER
@@ -100,6 +101,17 @@ class E2eDump {
 
   static bool IsMindRTKernelByKernel();
 
+#ifdef ENABLE_GPU
+  // Launch the statistics of the inputs and outputs of the node on the stream of the node for the GPU statistic dump,
+  // which are reduced on device instead of copying the tensors to host. The statistics of a step are copied to host
+  // together and written to the statistic files by FlushDeviceStatistics.
+  static void DumpSingleNodeStatisticsOnDevice(const CNodePtr &node, const std::vector<kernel::AddressPtr> &inputs,
+                                               const std::vector<kernel::AddressPtr> &outputs, void *stream,
+                                               uint32_t graph_id, uint32_t rank_id);
+
+  static void FlushDeviceStatistics();
+#endif
+
  private:
   static void DumpOutput(const session::KernelGraph *graph, const std::string &dump_path, const Debugger *debugger);
 
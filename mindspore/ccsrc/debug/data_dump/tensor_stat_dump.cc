@@ -166,10 +166,14 @@ bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const s
     type = "unsupported(" + std::to_string(data->GetType()) + ")";
     MS_LOG(INFO) << "Unsupported tensor data_type " << type << " for tensor " << data->GetName();
   }
+  return DumpTensorStatsToFile(dump_path, type, DebugServices::GetTensorStatistics(data));
+}
+
+bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const std::string &type,
+                                           const DebugServices::TensorStat &stat) {
   if (!OpenStatisticsFile(dump_path)) {
     return false;
   }
-  const DebugServices::TensorStat &stat = DebugServices::GetTensorStatistics(data);
   // write tensor statistics to csv file
   std::ostringstream shape;
   shape << "\"(";
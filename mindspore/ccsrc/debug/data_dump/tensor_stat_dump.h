@@ -23,6 +23,7 @@
 #include <mutex>
 
 #include "utils/ms_utils.h"
+#include "debug/debug_services.h"
 
 namespace mindspore {
 class Debugger;
@@ -61,6 +62,9 @@ class TensorStatDump {
   bool DumpTensorStatsToFile(const std::string &dump_path, const std::shared_ptr<TensorData> data);
   bool DumpTensorStatsToFile(const std::string &original_kernel_name, const std::string &dump_path,
                              const Debugger *debugger);
+  // Write the statistics of the tensor computed elsewhere, such as the ones reduced on device.
+  bool DumpTensorStatsToFile(const std::string &dump_path, const std::string &type,
+                             const DebugServices::TensorStat &stat);
 
  private:
   const std::string op_type_;
@@ -482,15 +482,16 @@ void DebugServices::CheckHistoryErrorCode(int *error_code, bool history_not_foun
  * successfully and whether we have a multi root graph scenario. All of aforementioned checks are done in this function.
  */
 void DebugServices::CheckWatchpointsForTensor(ChunkData *chunk_data, ProcessedNPYFiles *const processed_npy_files,
-                                              std::vector<std::shared_ptr<TensorData>> *const tensor_list, int begin,
-                                              int end, int chunk_id, const bool init_dbg_suspend, const bool step_end,
-                                              const bool recheck, std::vector<unsigned int> *const device_id,
+                                              std::vector<std::shared_ptr<TensorData>> *const tensor_list,
+                                              std::atomic<size_t> *const next_tensor_index, int chunk_id,
+                                              const bool init_dbg_suspend, const bool step_end, const bool recheck,
+                                              std::vector<unsigned int> *const device_id,
                                               std::vector<unsigned int> *const root_graph_id, bool error_on_no_value) {
-  int list_size = tensor_list->size();
-  if (end > list_size) {
-    end = list_size;
-  }
-  for (int i = begin; i < end; i++) {
+  MS_EXCEPTION_IF_NULL(next_tensor_index);
+  size_t list_size = tensor_list->size();
+  // The threads take the tensors one by one from the shared index, so that the threads with large tensors do not
+  // hold up the check while the other threads are idle.
+  for (size_t i = next_tensor_index->fetch_add(1); i < list_size; i = next_tensor_index->fetch_add(1)) {
     auto &tensor = (*tensor_list)[i];
     const auto tensor_name = tensor->GetName();
     const auto tensor_name_no_slot = tensor_name.substr(0, tensor_name.find_first_of(':'));
@@ -587,9 +588,9 @@ void DebugServices::CheckWatchpointsForTensor(ChunkData *chunk_data, ProcessedNP
  * Feature group: Offline debugger, Online debugger.
  * Target device group: Ascend, GPU.
  * Runtime category: Old runtime, MindRT.
- * Description: This function checks the watchpoints for the given tensor list by dividing the tensor list into chunks.
- * Each chunk is handled by a separate thread and then the result of check watchpoint for each thread is gathered and
- * sorted. In the end, the time for checking the watchpoint in the current step is reported.
+ * Description: This function checks the watchpoints for the given tensor list with multiple threads, which take the
+ * tensors dynamically from the list. The result of check watchpoint for each thread is gathered and sorted. In the
+ * end, the time for checking the watchpoint in the current step is reported.
  */
 void DebugServices::CheckWatchpoints(std::vector<std::string> *const name, std::vector<std::string> *const slot,
                                      std::vector<int> *const condition, std::vector<unsigned int> *const watchpoint_id,
@@ -629,8 +630,6 @@ void DebugServices::CheckWatchpoints(std::vector<std::string> *const name, std::
     max_thread_num = tensor_list_size;
   }
   MS_LOG(INFO) << "Number of threads used for checkwatchpoint: " << max_thread_num;
-  size_t chunk_size = tensor_list_size / max_thread_num;
-  size_t remainder = tensor_list_size % max_thread_num;
   ChunkData chunk_data;
   chunk_data.chunk_exec_orders.resize(max_thread_num);
   chunk_data.chunk_names.resize(max_thread_num);
@@ -646,18 +645,12 @@ void DebugServices::CheckWatchpoints(std::vector<std::string> *const name, std::
   chunk_data.chunk_time_stamp.resize(max_thread_num);
 
   std::vector<std::future<void>> tensor_future_vec;
-  size_t begin = 0;
-  size_t end = begin;
+  std::atomic<size_t> next_tensor_index{0};
   for (size_t i = 0; i < max_thread_num; i++) {
-    end += chunk_size;
-    if (remainder > 0) {
-      end++;
-      remainder--;
-    }
-    (void)tensor_future_vec.emplace_back(std::async(
-      std::launch::async, &DebugServices::CheckWatchpointsForTensor, this, &chunk_data, processed_npy_files,
-      tensor_list, begin, end, i, init_dbg_suspend, step_end, recheck, device_id, root_graph_id, error_on_no_value));
-    begin = end;
+    (void)tensor_future_vec.emplace_back(std::async(std::launch::async, &DebugServices::CheckWatchpointsForTensor,
+                                                    this, &chunk_data, processed_npy_files, tensor_list,
+                                                    &next_tensor_index, i, init_dbg_suspend, step_end, recheck,
+                                                    device_id, root_graph_id, error_on_no_value));
   }
 
   SortWatchpointsInfo(&tensor_future_vec, &exec_order, &time_stamps, &tensor_list_byte_size, name, slot,
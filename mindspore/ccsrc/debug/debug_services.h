@@ -24,6 +24,7 @@
 #include "base/float16.h"
 #endif
 
+#include <atomic>
 #include <cmath>
 #include <vector>
 #include <future>
@@ -307,8 +308,9 @@ class DebugServices {
   void CheckHistoryErrorCode(int *error_code, bool history_not_found) const;
 
   void CheckWatchpointsForTensor(ChunkData *chunk_data, ProcessedNPYFiles *const processed_npy_files,
-                                 std::vector<std::shared_ptr<TensorData>> *const tensor_list, int begin, int end,
-                                 int chunk_id, const bool init_dbg_suspend, const bool step_end, const bool recheck,
+                                 std::vector<std::shared_ptr<TensorData>> *const tensor_list,
+                                 std::atomic<size_t> *const next_tensor_index, int chunk_id,
+                                 const bool init_dbg_suspend, const bool step_end, const bool recheck,
                                  std::vector<unsigned int> *device_id, std::vector<unsigned int> *root_graph_id,
                                  bool error_on_no_value = false);
 
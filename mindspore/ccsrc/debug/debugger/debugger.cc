@@ -592,6 +592,10 @@ void Debugger::PostExecuteGraphDebugger() {
   if (debugger_) {
     debugger_->PostExecute();
   }
+#ifdef ENABLE_GPU
+  // Write the statistics reduced on device in the step before the dump iteration is updated.
+  E2eDump::FlushDeviceStatistics();
+#endif
   E2eDump::UpdateIterMindRTDump();
   executed_graph_ptr_set_.clear();
 }
@@ -22,6 +22,9 @@
 #include "include/common/debug/anf_dump_utils.h"
 #include "debug/debugger/debugger.h"
 #include "plugin/device/gpu/hal/device/gpu_device_address.h"
+#ifdef ENABLE_GPU
+#include "plugin/device/gpu/hal/device/gpu_device_manager.h"
+#endif
 #include "debug/data_dump/dump_json_parser.h"
 #ifdef ENABLE_D
 #include "debug/dump_data_builder.h"
@@ -188,6 +191,46 @@ bool GetTransFlag() {
   return DumpJsonParser::GetInstance().trans_flag();
 }
 
+/*
+ * Feature group: Dump.
+ * Target device group: GPU.
+ * Runtime category: MindRT.
+ * Description: Launch the statistics of the given node on device for the statistic dump on GPU, when the tensors are
+ * not dumped and the online debugger is disabled. Returns false if the tensors need to be loaded to host.
+ */
+bool DumpStatisticsOnDevice(const CNodePtr &cnode, const KernelLaunchInfo *launch_info,
+                            const DeviceContext *device_context, bool dump_enabled) {
+#ifdef ENABLE_GPU
+  auto &dump_json_parser = DumpJsonParser::GetInstance();
+  if (!IsDeviceTargetGPU() || Debugger::GetInstance()->debugger_enabled() || !dump_json_parser.IsStatisticDump() ||
+      dump_json_parser.IsTensorDump()) {
+    return false;
+  }
+  if (!dump_enabled) {
+    return true;
+  }
+  MS_EXCEPTION_IF_NULL(launch_info);
+  MS_EXCEPTION_IF_NULL(device_context);
+  MS_EXCEPTION_IF_NULL(device_context->device_res_manager_);
+  // The statistics are launched on the stream of the kernel, so they are reduced before the memory is reused.
+  void *stream = nullptr;
+  if (common::AnfAlgo::HasNodeAttr(kAttrStream, cnode)) {
+    auto stream_id = common::AnfAlgo::GetNodeAttr<size_t>(cnode, kAttrStream);
+    stream = device_context->device_res_manager_->GetStream(stream_id);
+  } else {
+    stream = device::gpu::GPUDeviceManager::GetInstance().default_stream();
+  }
+  MS_EXCEPTION_IF_NULL(stream);
+  auto kernel_graph = std::dynamic_pointer_cast<KernelGraph>(cnode->func_graph());
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  E2eDump::DumpSingleNodeStatisticsOnDevice(cnode, launch_info->inputs_, launch_info->outputs_, stream,
+                                            kernel_graph->graph_id(), Debugger::GetRankID());
+  return true;
+#else
+  return false;
+#endif
+}
+
 /*
  * Feature group: Dump, Online debugger.
  * Target device group: Ascend, GPU.
@@ -208,26 +251,28 @@ void ReadDataAndDump(const CNodePtr &cnode, const KernelLaunchInfo *launch_info,
   MS_EXCEPTION_IF_NULL(kernel_graph);
   auto root_graph_id = kernel_graph->root_graph_id();
   bool trans_flag = GetTransFlag();
-  if (debugger->debugger_enabled() || dump_json_parser.InputNeedDump()) {
-    LoadInputs(cnode, launch_info, exec_order, root_graph_id, device_context, trans_flag);
-  }
-  if (debugger->debugger_enabled() || dump_json_parser.OutputNeedDump()) {
-    LoadOutputs(cnode, launch_info, exec_order, root_graph_id, device_context, trans_flag);
-  }
-  // Dump kernel
-  if (dump_enabled) {
-    MS_EXCEPTION_IF_NULL(kernel_graph);
-    auto graph_id = kernel_graph->graph_id();
-    // for GPU, nodes are dumped in graph_id directory.
-    if (IsDeviceTargetGPU()) {
-      debugger->DumpSingleNode(cnode, graph_id);
-    } else {
-      // for Ascend, node are dumped in root_graph_id directory.
-      debugger->DumpSingleNode(cnode, root_graph_id);
+  if (!DumpStatisticsOnDevice(cnode, launch_info, device_context, dump_enabled)) {
+    if (debugger->debugger_enabled() || dump_json_parser.InputNeedDump()) {
+      LoadInputs(cnode, launch_info, exec_order, root_graph_id, device_context, trans_flag);
     }
-    // Clear Dumped data when online debugger is not enabled
-    if (!debugger->debugger_enabled()) {
-      debugger->ClearCurrentData();
+    if (debugger->debugger_enabled() || dump_json_parser.OutputNeedDump()) {
+      LoadOutputs(cnode, launch_info, exec_order, root_graph_id, device_context, trans_flag);
+    }
+    // Dump kernel
+    if (dump_enabled) {
+      MS_EXCEPTION_IF_NULL(kernel_graph);
+      auto graph_id = kernel_graph->graph_id();
+      // for GPU, nodes are dumped in graph_id directory.
+      if (IsDeviceTargetGPU()) {
+        debugger->DumpSingleNode(cnode, graph_id);
+      } else {
+        // for Ascend, node are dumped in root_graph_id directory.
+        debugger->DumpSingleNode(cnode, root_graph_id);
+      }
+      // Clear Dumped data when online debugger is not enabled
+      if (!debugger->debugger_enabled()) {
+        debugger->ClearCurrentData();
+      }
     }
   }
   if (IsDeviceTargetGPU()) {
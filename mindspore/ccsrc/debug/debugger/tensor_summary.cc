@@ -121,16 +121,50 @@ TensorSummary<T>::TensorSummary(const void *current_tensor_ptr, const void *cons
 template <typename T>
 void TensorSummary<T>::SummarizeTensor(const std::vector<DebugServices::watchpoint_t> &wps) {
   InitCalculators(wps);
-  for (size_t i = 0; i < num_elements_; ++i) {
-    auto current_value = static_cast<double>(current_tensor_ptr_[i]);
-    double previous_value = std::numeric_limits<double>::quiet_NaN();
-    if (prev_tensor_ptr_) {
-      if (num_elements_ == prev_num_elements_) {
-        previous_value = static_cast<double>(prev_tensor_ptr_[i]);
-      } else {
-        MS_LOG(DEBUG) << "Current and previous tensor are not the same size.";
+  // Resolve the calculators and the previous tensor once instead of per element.
+  const bool use_prev_value = prev_tensor_ptr_ != nullptr && num_elements_ == prev_num_elements_;
+  if (prev_tensor_ptr_ != nullptr && !use_prev_value) {
+    MS_LOG(DEBUG) << "Current and previous tensor are not the same size.";
+  }
+  std::vector<AllCloseCalculator *> all_close_calcs;
+  for (auto &it : all_close_) {
+    (void)all_close_calcs.emplace_back(it.second.get());
+  }
+  std::vector<RangeCountCalculator *> range_count_calcs;
+  for (auto &it : range_counts_) {
+    (void)range_count_calcs.emplace_back(it.second.get());
+  }
+  auto find_mean = [this](const std::string &name) -> MeanCalculator * {
+    auto iter = means_.find(name);
+    return iter == means_.end() ? nullptr : iter->second.get();
+  };
+  MeanCalculator *curr_prev_diff_mean = find_mean("curr_prev_diff_mean");
+  MeanCalculator *abs_prev_mean = find_mean("abs_prev_mean");
+  MeanCalculator *abs_current_mean = find_mean("abs_current_mean");
+  const bool only_basic_stats = all_close_calcs.empty() && range_count_calcs.empty() && means_.empty() &&
+                                !mean_sd_cal_enabled_;
+  if (only_basic_stats) {
+    // The conditions such as nan, inf, overflow and the min/max based ranges only need the basic statistics.
+    for (size_t i = 0; i < num_elements_; ++i) {
+      auto current_value = static_cast<double>(current_tensor_ptr_[i]);
+      if (!std::isfinite(current_value)) {
+        if (std::isinf(current_value)) {
+          inf_count_ += 1;
+        } else {
+          nan_count_ += 1;
+        }
+      } else if (current_value == 0.0) {
+        zero_count_ += 1;
       }
+      max_ = std::max(max_, current_value);
+      min_ = std::min(min_, current_value);
     }
+    return;
+  }
+  for (size_t i = 0; i < num_elements_; ++i) {
+    auto current_value = static_cast<double>(current_tensor_ptr_[i]);
+    double previous_value =
+      use_prev_value ? static_cast<double>(prev_tensor_ptr_[i]) : std::numeric_limits<double>::quiet_NaN();
     if (std::isinf(current_value)) {
       inf_count_ += 1;
     }
@@ -145,20 +179,20 @@ void TensorSummary<T>::SummarizeTensor(const std::vector<DebugServices::watchpoi
     if (mean_sd_cal_enabled_) {
       current_mean_variance_.ProcessElement(current_value);
     }
-    for (auto &it : all_close_) {
-      it.second->ProcessElement(current_value, previous_value);
+    for (auto calc : all_close_calcs) {
+      calc->ProcessElement(current_value, previous_value);
     }
-    for (auto &range_count : range_counts_) {
-      range_count.second->ProcessElement(current_value);
+    for (auto calc : range_count_calcs) {
+      calc->ProcessElement(current_value);
     }
-    for (auto &mean : means_) {
-      if (mean.first.compare("curr_prev_diff_mean") == 0) {
-        mean.second->ProcessElement(std::abs(current_value - previous_value));
-      } else if (mean.first.compare("abs_prev_mean") == 0) {
-        mean.second->ProcessElement(std::abs(previous_value));
-      } else if (mean.first.compare("abs_current_mean") == 0) {
-        mean.second->ProcessElement(std::abs(current_value));
-      }
+    if (curr_prev_diff_mean != nullptr) {
+      curr_prev_diff_mean->ProcessElement(std::abs(current_value - previous_value));
+    }
+    if (abs_prev_mean != nullptr) {
+      abs_prev_mean->ProcessElement(std::abs(previous_value));
+    }
+    if (abs_current_mean != nullptr) {
+      abs_current_mean->ProcessElement(std::abs(current_value));
     }
   }
 }
@@ -203,8 +237,9 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
     offset += num_elements_for_thread;
   }
 
-  // Aggregate results of all chunks
+  // Aggregate results of all chunks, the average of each chunk is weighted by its number of finite values.
   num_elements_ = 0;  // Let current tensor weight 0 in the aggregation
+  uint64_t value_num = 0;
   for (unsigned int i = 0; i < summary_future_vec.size(); i++) {
     summary_future_vec[i].wait();
     summary_future_vec[i].get();
@@ -212,8 +247,13 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
     num_elements_ += cur_summary.num_elements_;
     min_ = std::min(min_, cur_summary.min_);
     max_ = std::max(max_, cur_summary.max_);
-    double avg_delta = cur_summary.avg_ - avg_;
-    avg_ += avg_delta * (cur_summary.num_elements_ / num_elements_);
+    uint64_t cur_value_num = cur_summary.num_elements_ - cur_summary.nan_count_ - cur_summary.neg_inf_count_ -
+                             cur_summary.pos_inf_count_;
+    value_num += cur_value_num;
+    if (value_num > 0) {
+      double avg_delta = cur_summary.avg_ - avg_;
+      avg_ += avg_delta * (static_cast<double>(cur_value_num) / value_num);
+    }
     neg_zero_count_ += cur_summary.neg_zero_count_;
     pos_zero_count_ += cur_summary.pos_zero_count_;
     neg_inf_count_ += cur_summary.neg_inf_count_;
@@ -232,35 +272,37 @@ void TensorSummary<T>::TensorStatistics(DbgDataType dtype_value) {
  */
 template <typename T>
 void TensorSummary<T>::TensorStatisticsSingleThread() {
-  MeanCalculator mean_calc = MeanCalculator();
+  // Classify each element once, skip the nan and inf checks for integral types, and accumulate the sum instead of
+  // updating the running mean with a division per element.
+  const bool is_integral = std::is_integral<T>::value;
+  double sum = 0.0;
+  uint64_t value_num = 0;
   for (size_t i = 0; i < num_elements_; ++i) {
     auto current_value = static_cast<double>(current_tensor_ptr_[i]);
-    if (std::isinf(current_value)) {
-      if (current_value > 0) {
+    if (!is_integral && !std::isfinite(current_value)) {
+      if (std::isnan(current_value)) {
+        nan_count_ += 1;
+      } else if (current_value > 0) {
         pos_inf_count_ += 1;
       } else {
         neg_inf_count_ += 1;
       }
+      continue;
     }
+    // only considering tensor elements with value
     if (current_value == 0.0) {
       zero_count_ += 1;
+    } else if (std::signbit(current_value)) {
+      neg_zero_count_ += 1;
+    } else {
+      pos_zero_count_ += 1;
     }
-    if (std::isnan(current_value)) {
-      nan_count_ += 1;
-    }
-    if (!(std::isnan(current_value) || std::isinf(current_value))) {
-      // only considering tensor elements with value
-      if (std::signbit(current_value) && !(current_value == 0.0)) {
-        neg_zero_count_ += 1;
-      } else if (!(current_value == 0.0)) {
-        pos_zero_count_ += 1;
-      }
-      max_ = std::max(max_, current_value);
-      min_ = std::min(min_, current_value);
-      mean_calc.ProcessElement(current_value);
-    }
+    max_ = std::max(max_, current_value);
+    min_ = std::min(min_, current_value);
+    sum += current_value;
+    ++value_num;
   }
-  avg_ = mean_calc.GetMean();
+  avg_ = value_num > 0 ? sum / value_num : 0.0;
 }
 
 /*
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "debug/rdr/step_trace_recorder.h"
+#include <sys/stat.h>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <mutex>
+#include "include/common/utils/utils.h"
+#include "include/common/debug/rdr/recorder_manager.h"
+#include "mindspore/core/utils/file_utils.h"
+#include "utils/profile.h"
+
+namespace mindspore {
+namespace {
+constexpr char kStepTraceRecorderName[] = "step_trace";
+// The ring buffer keeps the latest events, which usually covers several steps of a small graph.
+constexpr size_t kStepTraceEventNum = 65536;
+constexpr size_t kStepTraceEventMask = kStepTraceEventNum - 1;
+// The step is abnormally slow if the step time is longer than the ratio of the average step time.
+constexpr double kSlowStepRatio = 3.0;
+constexpr double kAvgStepTimeWeight = 0.1;
+constexpr size_t kStepTraceWarmupSteps = 10;
+constexpr size_t kMaxSlowStepExportNum = 10;
+
+const char *StepTraceEventTypeName(StepTraceEventType type) {
+  switch (type) {
+    case StepTraceEventType::kStepEnd:
+      return "StepEnd";
+    case StepTraceEventType::kMemoryAlloc:
+      return "MemoryAlloc";
+    case StepTraceEventType::kKernelLaunch:
+      return "KernelLaunch";
+    case StepTraceEventType::kMemoryFree:
+      return "MemoryFree";
+    default:
+      return "Unknown";
+  }
+}
+
+const StepTraceRecorderPtr &GetStepTraceRecorder() {
+  static StepTraceRecorderPtr recorder = nullptr;
+  static std::once_flag init_flag;
+  std::call_once(init_flag, []() {
+    if (RecorderManager::Instance().RdrEnable()) {
+      recorder = std::make_shared<StepTraceRecorder>(std::string(GetSubModuleName(SubModuleId::SM_RUNTIME_FRAMEWORK)),
+                                                     kStepTraceRecorderName);
+    }
+  });
+  return recorder;
+}
+}  // namespace
+
+StepTraceRecorder::StepTraceRecorder(const std::string &module, const std::string &name)
+    : BaseRecorder(module, name), events_(std::make_unique<StepTraceEvent[]>(kStepTraceEventNum)) {}
+
+void StepTraceRecorder::Record(StepTraceEventType type, const std::string &name, size_t value) {
+  // The slot is claimed by the atomic sequence number, so the recording threads never wait for each other.
+  auto seq = event_seq_.fetch_add(1, std::memory_order_relaxed) + 1;
+  auto &event = events_[seq & kStepTraceEventMask];
+  event.seq_.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  event.step_ = step_.load(std::memory_order_relaxed);
+  event.time_ = GetTime();
+  event.type_ = type;
+  event.value_ = value;
+  // Keep the tail of the long name, which contains the kernel type and id.
+  auto name_len = std::min(name.size(), kMaxEventNameLen - 1);
+  (void)std::copy(name.end() - static_cast<std::ptrdiff_t>(name_len), name.end(), event.name_);
+  event.name_[name_len] = '\0';
+  event.seq_.store(seq, std::memory_order_release);
+}
+
+void StepTraceRecorder::RecordStepEnd(const std::string &name, double step_time) {
+  // The step end is recorded by the main thread only.
+  auto step = step_.fetch_add(1, std::memory_order_relaxed) + 1;
+  Record(StepTraceEventType::kStepEnd, name, static_cast<size_t>(step_time));
+  bool is_slow_step = (step > kStepTraceWarmupSteps) && (step_time > kSlowStepRatio * avg_step_time_);
+  avg_step_time_ = (step == 1) ? step_time : (avg_step_time_ + kAvgStepTimeWeight * (step_time - avg_step_time_));
+  if (is_slow_step && slow_step_export_num_ < kMaxSlowStepExportNum) {
+    ++slow_step_export_num_;
+    MS_LOG(WARNING) << "The step " << step << " of " << name << " costs " << step_time
+                    << " ms, which is much longer than the average " << avg_step_time_
+                    << " ms, export the step trace of RDR.";
+    ExportEvents("slow_step_" + std::to_string(step));
+  }
+}
+
+void StepTraceRecorder::Export() { ExportEvents(""); }
+
+void StepTraceRecorder::ExportEvents(const std::string &suffix) {
+  auto realpath = GetFileRealPath(suffix);
+  if (!realpath.has_value()) {
+    return;
+  }
+  std::string file_path = realpath.value() + ".txt";
+  ChangeFileMode(file_path, S_IRWXU);
+  std::ofstream fout(file_path);
+  if (!fout.is_open()) {
+    MS_LOG(WARNING) << "Open file for saving step trace failed. File path: '" << file_path << "'.";
+    return;
+  }
+  // The events are exported from the oldest one, and the slot being written or overwritten during export is skipped.
+  auto last_seq = event_seq_.load(std::memory_order_acquire);
+  auto first_seq = (last_seq > kStepTraceEventNum) ? (last_seq - kStepTraceEventNum + 1) : 1;
+  fout << "step,time(s),event,name,value" << std::endl;
+  fout << std::fixed << std::setprecision(6);
+  for (auto seq = first_seq; seq <= last_seq; ++seq) {
+    const auto &event = events_[seq & kStepTraceEventMask];
+    if (event.seq_.load(std::memory_order_acquire) != seq) {
+      continue;
+    }
+    std::string name(event.name_);
+    auto step = event.step_;
+    auto time = event.time_;
+    auto type = event.type_;
+    auto value = event.value_;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (event.seq_.load(std::memory_order_relaxed) != seq) {
+      continue;
+    }
+    fout << step << "," << time << "," << StepTraceEventTypeName(type) << "," << name << "," << value << std::endl;
+  }
+  fout.close();
+  ChangeFileMode(file_path, S_IRUSR);
+}
+
+namespace RDR {
+bool StepTraceEnable() { return GetStepTraceRecorder() != nullptr; }
+
+void RecordStepTraceEvent(StepTraceEventType type, const std::string &name, size_t value) {
+  const auto &recorder = GetStepTraceRecorder();
+  if (recorder == nullptr) {
+    return;
+  }
+  recorder->Record(type, name, value);
+}
+
+void RecordStepEnd(const std::string &name, double step_time) {
+  const auto &recorder = GetStepTraceRecorder();
+  if (recorder == nullptr) {
+    return;
+  }
+  recorder->RecordStepEnd(name, step_time);
+  // The recorders are cleared by the RDR snapshot, register it again to export it with the other recorders.
+  auto &recorder_manager = RecorderManager::Instance();
+  if (recorder_manager.GetRecorder(recorder->GetModule(), recorder->GetName()) == nullptr) {
+    (void)recorder_manager.RecordObject(recorder);
+  }
+}
+}  // namespace RDR
+}  // namespace mindspore
@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DEBUG_RDR_STEP_TRACE_RECORDER_H_
+#define MINDSPORE_CCSRC_DEBUG_RDR_STEP_TRACE_RECORDER_H_
+#include <atomic>
+#include <string>
+#include <memory>
+
+#include "include/common/debug/rdr/base_recorder.h"
+
+namespace mindspore {
+enum class StepTraceEventType : int { kStepEnd = 0, kMemoryAlloc, kKernelLaunch, kMemoryFree };
+
+// The StepTraceRecorder keeps the latest runtime events of the recent steps in a lock-free ring buffer, so it can keep
+// recording in the normal running with bounded overhead. The events are exported with the other recorders when the
+// running fails, and exported at once when the step time is much longer than the average of the previous steps.
+class StepTraceRecorder : public BaseRecorder {
+ public:
+  StepTraceRecorder(const std::string &module, const std::string &name);
+  ~StepTraceRecorder() override = default;
+
+  void Record(StepTraceEventType type, const std::string &name, size_t value);
+  // Record the end of step and check whether the step is abnormally slow.
+  void RecordStepEnd(const std::string &name, double step_time);
+  void Export() override;
+
+ private:
+  static constexpr size_t kMaxEventNameLen = 64;
+  struct StepTraceEvent {
+    // The sequence number of the event in the slot, which is written last to identify the complete event.
+    std::atomic<uint64_t> seq_{0};
+    uint64_t step_{0};
+    double time_{0};
+    StepTraceEventType type_{StepTraceEventType::kStepEnd};
+    size_t value_{0};
+    char name_[kMaxEventNameLen]{0};
+  };
+
+  void ExportEvents(const std::string &suffix);
+
+  std::unique_ptr<StepTraceEvent[]> events_;
+  std::atomic<uint64_t> event_seq_{0};
+  std::atomic<uint64_t> step_{0};
+  double avg_step_time_{0};
+  size_t slow_step_export_num_{0};
+};
+using StepTraceRecorderPtr = std::shared_ptr<StepTraceRecorder>;
+
+namespace RDR {
+// Whether the step trace is enabled, which is checked by the caller in the hot path before recording.
+bool StepTraceEnable();
+void RecordStepTraceEvent(StepTraceEventType type, const std::string &name, size_t value = 0);
+void RecordStepEnd(const std::string &name, double step_time);
+}  // namespace RDR
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DEBUG_RDR_STEP_TRACE_RECORDER_H_
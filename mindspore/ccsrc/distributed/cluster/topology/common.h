@@ -63,6 +63,13 @@ static const int kDecimal = 10;
 // The timeout(second) for heartbeat from compute graph node to meta server.
 static const uint64_t kDefaultNodeTimeout = 30;
 
+// The heartbeat interval(second) of the compute graph node grows with the cluster size so that the meta server receives
+// at most kMaxHeartbeatNumPerSecond heartbeats per second, and it is bounded to keep several heartbeats in one node
+// timeout.
+static const uint32_t kMinHeartbeatInterval = 3;
+static const uint32_t kMaxHeartbeatInterval = 10;
+static const size_t kMaxHeartbeatNumPerSecond = 500;
+
 // The timeout for initializing the cluster topology.
 static const std::chrono::milliseconds kTopoInitTimeout = std::chrono::milliseconds(1000 * 60 * 10);
 
@@ -15,6 +15,8 @@
  */
 
 #include <utility>
+#include <algorithm>
+#include <chrono>
 #include <nlohmann/json.hpp>
 #include "utils/log_adapter.h"
 #include "utils/ms_exception.h"
@@ -200,6 +202,9 @@ bool ComputeGraphNode::Register() {
   if (reg_resp_msg.success()) {
     authenticated_ = true;
     rank_id_ = reg_resp_msg.rank_id();
+    if (reg_resp_msg.node_num() > 0) {
+      node_num_ = reg_resp_msg.node_num();
+    }
     MS_LOG(INFO) << "The compute graph node: " << node_id_ << " has been registered successfully.";
     return true;
   } else {
@@ -238,9 +243,17 @@ bool ComputeGraphNode::Heartbeat() {
   try {
     MS_EXCEPTION_IF_NULL(hb_client_);
 
-    MS_LOG(INFO) << "The heartbeat thread is started.";
-    uint32_t interval = 3;
+    uint32_t interval = GetHeartbeatInterval();
     uint32_t timeout = 10;
+    MS_LOG(INFO) << "The heartbeat thread is started, the heartbeat interval is " << interval << "s.";
+
+    // Spread the heartbeats of the nodes over the interval by rank id instead of sending them all at the same time
+    // after the registration.
+    const uint32_t kMillisecondsPerSecond = 1000;
+    uint64_t interval_ms = interval * kMillisecondsPerSecond;
+    if (node_num_ > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds((rank_id_ % node_num_) * interval_ms / node_num_));
+    }
 
     while (enable_hb_) {
       if (topo_state_ == TopoState::kInitializing && ElapsedTime(start_time_) > kTopoInitTimeout) {
@@ -296,6 +309,13 @@ bool ComputeGraphNode::Heartbeat() {
   return true;
 }
 
+uint32_t ComputeGraphNode::GetHeartbeatInterval() const {
+  size_t interval = node_num_ / kMaxHeartbeatNumPerSecond;
+  interval = std::max(interval, static_cast<size_t>(kMinHeartbeatInterval));
+  interval = std::min(interval, static_cast<size_t>(kMaxHeartbeatInterval));
+  return static_cast<uint32_t>(interval);
+}
+
 bool ComputeGraphNode::ReconnectIfNeeded(const std::function<bool(void)> &func, const std::string &error,
                                          size_t retry) {
   bool success = false;
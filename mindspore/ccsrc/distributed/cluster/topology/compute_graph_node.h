@@ -80,6 +80,9 @@ class ComputeGraphNode : public NodeBase {
   bool Heartbeat();
 
   // Call the `Reconnect` function if the input func execution failed.
+  // Get the heartbeat interval in seconds according to the number of nodes in the cluster.
+  uint32_t GetHeartbeatInterval() const;
+
   bool ReconnectIfNeeded(const std::function<bool(void)> &func, const std::string &error, size_t retry);
 
   // Reconnect to the meta server node.
@@ -100,6 +103,9 @@ class ComputeGraphNode : public NodeBase {
   // Incidate whether this node is authenticated by meta server node.
   std::atomic<bool> authenticated_;
 
+  // The total number of nodes in the cluster replied by the meta server node in registration.
+  size_t node_num_{0};
+
   // The heartbeat thread from compute graph node to meta server node.
   std::thread heartbeat_;
 
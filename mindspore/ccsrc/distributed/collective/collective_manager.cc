@@ -16,6 +16,7 @@
 
 #include "distributed/collective/collective_manager.h"
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <functional>
@@ -68,6 +69,12 @@ std::shared_ptr<CollectiveManager> CollectiveManager::instance() {
 }
 
 namespace {
+// The sizes of AllReduce to benchmark the latency and the bandwidth of the communication group.
+constexpr size_t kBenchmarkSmallSize = 4096;
+constexpr size_t kBenchmarkLargeSize = 32 << 20;
+constexpr size_t kBenchmarkWarmupNum = 2;
+constexpr size_t kBenchmarkRepeatNum = 5;
+
 // The wrapper to provide a timeout mechanism for executing functions.
 bool ExecuteFuncInThread(const std::function<bool()> &func, const int64_t timeout) {
   bool execute_success = false;
@@ -240,9 +247,77 @@ bool CollectiveManager::CreateCommunicationGroup(const std::string &group_name,
   ret = ExecuteFuncInThread(init_device_comm_group_func, kTimeToWait);
 
   MS_LOG(INFO) << "End initialize communication group on the device side.";
+  if (ret && !CreateHierarchicalGroups(group_name, group_ranks)) {
+    MS_LOG(ERROR) << "Failed to create hierarchical communication groups for " << group_name;
+    return false;
+  }
   return ret;
 }
 
+bool CollectiveManager::CreateHierarchicalGroups(const std::string &group_name,
+                                                 const std::vector<uint32_t> &group_ranks) {
+  static const bool enable_hierarchical_comm = (common::GetEnv("MS_DEV_HIERARCHICAL_COMM") == "1");
+  if (!enable_hierarchical_comm || !device_lib_supported_ || all_host_hashs_.size() != global_rank_size_) {
+    return true;
+  }
+
+  // Group the ranks by the nodes. The hierarchical collectives require that the ranks of the group are sorted by the
+  // nodes and each node has the same number of ranks, otherwise the flat collectives are used.
+  std::vector<size_t> node_hashs;
+  std::vector<std::vector<uint32_t>> node_ranks;
+  for (const auto &rank : group_ranks) {
+    if (rank >= all_host_hashs_.size()) {
+      return true;
+    }
+    auto host_hash = all_host_hashs_[rank];
+    if (node_hashs.empty() || node_hashs.back() != host_hash) {
+      if (std::find(node_hashs.begin(), node_hashs.end(), host_hash) != node_hashs.end()) {
+        return true;
+      }
+      node_hashs.push_back(host_hash);
+      (void)node_ranks.emplace_back();
+    }
+    node_ranks.back().push_back(rank);
+  }
+  if (node_ranks.size() <= 1 || node_ranks[0].size() <= 1 ||
+      std::any_of(node_ranks.begin(), node_ranks.end(),
+                  [&node_ranks](const std::vector<uint32_t> &ranks) { return ranks.size() != node_ranks[0].size(); })) {
+    return true;
+  }
+
+  size_t node_index = node_ranks.size();
+  size_t local_index = 0;
+  for (size_t i = 0; i < node_ranks.size(); ++i) {
+    auto iter = std::find(node_ranks[i].begin(), node_ranks[i].end(), global_rank_id_);
+    if (iter != node_ranks[i].end()) {
+      node_index = i;
+      local_index = static_cast<size_t>(iter - node_ranks[i].begin());
+      break;
+    }
+  }
+  if (node_index == node_ranks.size()) {
+    return true;
+  }
+
+  std::vector<uint32_t> inter_ranks;
+  (void)std::transform(node_ranks.begin(), node_ranks.end(), std::back_inserter(inter_ranks),
+                       [local_index](const std::vector<uint32_t> &ranks) { return ranks[local_index]; });
+  // The group within the node is created before the group across the nodes on all the ranks, to avoid waiting for
+  // each other.
+  const auto &intra_group_name = group_name + "_intra_" + std::to_string(node_index);
+  const auto &inter_group_name = group_name + "_inter_" + std::to_string(local_index);
+  if (!CreateCommunicationGroup(intra_group_name, node_ranks[node_index]) ||
+      !CreateCommunicationGroup(inter_group_name, inter_ranks)) {
+    return false;
+  }
+  MS_EXCEPTION_IF_NULL(device_comm_lib_instance_);
+  device_comm_lib_instance_->SetHierarchicalGroups(group_name, intra_group_name, inter_group_name);
+  MS_LOG(INFO) << "The collectives of group " << group_name << " are hierarchical on " << node_ranks.size()
+               << " nodes, the group within the node is " << intra_group_name << ", the group across the nodes is "
+               << inter_group_name;
+  return true;
+}
+
 bool CollectiveManager::DestroyCommunicationGroup(const std::string &group_name) {
   MS_EXCEPTION_IF_NULL(host_comm_lib_instance_);
   if (!host_comm_lib_instance_->DestroyCommunicationGroup(group_name)) {
@@ -306,6 +381,110 @@ void CollectiveManager::set_global_rank_size(uint32_t global_rank_size) { global
 
 uint32_t CollectiveManager::local_rank_id() const { return local_rank_id_; }
 
+bool CollectiveManager::GetAllReduceCostModel(const std::string &group_name, CommCostModel *cost_model) {
+  MS_EXCEPTION_IF_NULL(cost_model);
+  std::unique_lock<std::mutex> lock(cost_model_mutex_);
+  const auto &iter = all_reduce_cost_models_.find(group_name);
+  if (iter != all_reduce_cost_models_.end()) {
+    *cost_model = iter->second;
+    return true;
+  }
+
+  if (!inited_.load() || !device_lib_supported_ || device_ctx_ == nullptr || device_comm_lib_instance_ == nullptr ||
+      device_comm_lib_instance_->GetGroup(group_name) == nullptr) {
+    MS_LOG(INFO) << "The AllReduce of group " << group_name << " can't be benchmarked on the device side.";
+    return false;
+  }
+  auto &res_manager = device_ctx_->device_res_manager_;
+  MS_EXCEPTION_IF_NULL(res_manager);
+  if (benchmark_stream_id_ == SIZE_MAX && !res_manager->CreateStream(&benchmark_stream_id_)) {
+    MS_LOG(WARNING) << "Failed to create the stream for benchmarking AllReduce.";
+    return false;
+  }
+
+  void *send_buff = res_manager->AllocateMemory(kBenchmarkLargeSize);
+  void *recv_buff = res_manager->AllocateMemory(kBenchmarkLargeSize);
+  // The costs of small and large AllReduce are reduced by max in the group, so all the ranks get the same cost model.
+  std::vector<float> costs(2, 0);
+  bool ret = (send_buff != nullptr) && (recv_buff != nullptr);
+  if (ret) {
+    double small_cost = 0;
+    double large_cost = 0;
+    ret = BenchmarkAllReduce(group_name, send_buff, recv_buff, kBenchmarkSmallSize, &small_cost) &&
+          BenchmarkAllReduce(group_name, send_buff, recv_buff, kBenchmarkLargeSize, &large_cost);
+    costs[0] = static_cast<float>(small_cost);
+    costs[1] = static_cast<float>(large_cost);
+  }
+  if (ret) {
+    const size_t costs_size = costs.size() * sizeof(float);
+    const ShapeVector costs_shape = {SizeToLong(costs.size())};
+    auto send_address =
+      res_manager->CreateDeviceAddress(send_buff, costs_size, kOpFormat_DEFAULT, kNumberTypeFloat32, costs_shape);
+    auto recv_address =
+      res_manager->CreateDeviceAddress(recv_buff, costs_size, kOpFormat_DEFAULT, kNumberTypeFloat32, costs_shape);
+    MS_EXCEPTION_IF_NULL(send_address);
+    MS_EXCEPTION_IF_NULL(recv_address);
+    ret = send_address->SyncHostToDevice(costs_shape, costs_size, kNumberTypeFloat32, costs.data()) &&
+          device_comm_lib_instance_->AllReduce(send_buff, recv_buff, costs.size(), kNumberTypeFloat32,
+                                               device::CollectiveOpReduceType::Reduce_Max, group_name,
+                                               res_manager->GetStream(benchmark_stream_id_)) &&
+          res_manager->SyncStream(benchmark_stream_id_) &&
+          recv_address->SyncDeviceToHost(costs_shape, costs_size, kNumberTypeFloat32, costs.data());
+    // The memory is freed by the device context below.
+    send_address->set_ptr(nullptr);
+    recv_address->set_ptr(nullptr);
+  }
+  if (send_buff != nullptr) {
+    res_manager->FreeMemory(send_buff);
+  }
+  if (recv_buff != nullptr) {
+    res_manager->FreeMemory(recv_buff);
+  }
+  if (!ret) {
+    MS_LOG(WARNING) << "Failed to benchmark the AllReduce of group " << group_name;
+    return false;
+  }
+
+  CommCostModel model;
+  model.beta_ = std::max(static_cast<double>(costs[1] - costs[0]), 0.0) /
+                static_cast<double>(kBenchmarkLargeSize - kBenchmarkSmallSize);
+  model.alpha_ = std::max(static_cast<double>(costs[0]) - model.beta_ * kBenchmarkSmallSize, 0.0);
+  MS_LOG(INFO) << "The AllReduce cost model of group " << group_name << ", latency: " << model.alpha_
+               << " us, bandwidth: " << (model.beta_ > 0 ? 1.0 / model.beta_ : 0) << " bytes/us";
+  all_reduce_cost_models_[group_name] = model;
+  *cost_model = model;
+  return true;
+}
+
+bool CollectiveManager::BenchmarkAllReduce(const std::string &group_name, const void *send_buff, void *recv_buff,
+                                           size_t size, double *cost) const {
+  MS_EXCEPTION_IF_NULL(cost);
+  MS_EXCEPTION_IF_NULL(device_ctx_);
+  MS_EXCEPTION_IF_NULL(device_comm_lib_instance_);
+  auto &res_manager = device_ctx_->device_res_manager_;
+  MS_EXCEPTION_IF_NULL(res_manager);
+  void *stream = res_manager->GetStream(benchmark_stream_id_);
+  auto start_time = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < kBenchmarkWarmupNum + kBenchmarkRepeatNum; ++i) {
+    if (i == kBenchmarkWarmupNum) {
+      if (!res_manager->SyncStream(benchmark_stream_id_)) {
+        return false;
+      }
+      start_time = std::chrono::steady_clock::now();
+    }
+    if (!device_comm_lib_instance_->AllReduce(send_buff, recv_buff, size / sizeof(float), kNumberTypeFloat32,
+                                              device::CollectiveOpReduceType::Reduce_Sum, group_name, stream)) {
+      return false;
+    }
+  }
+  if (!res_manager->SyncStream(benchmark_stream_id_)) {
+    return false;
+  }
+  auto total_cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_time).count();
+  *cost = total_cost / kBenchmarkRepeatNum;
+  return true;
+}
+
 bool CollectiveManager::InitHostCommlib() {
   device::DeviceContextKey host_key = {"CPU", 0};
   host_ctx_ = device::DeviceContextManager::GetInstance().GetOrCreateDeviceContext(host_key);
@@ -416,6 +595,7 @@ bool CollectiveManager::AssignLocalRank() {
       local_rank_id_++;
     }
   }
+  all_host_hashs_ = all_host_hashs;
 
   // No need to reset device_id if library on device side is not supported, e.g., ascend.
   if (device_lib_supported_) {
@@ -20,6 +20,8 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <map>
+#include <mutex>
 #include <atomic>
 #include "utils/ms_utils.h"
 #include "distributed/constants.h"
@@ -35,6 +37,13 @@ using DeviceContextManager = device::DeviceContextManager;
 using CollectiveCommunicationLib = device::CollectiveCommunicationLib;
 using CommunicationGroupPtr = device::CommunicationGroupPtr;
 
+// The alpha-beta cost model of the collective communication: cost = alpha + beta * size, where alpha is the latency in
+// microseconds and beta is the cost of each byte in microseconds.
+struct CommCostModel {
+  double alpha_{0};
+  double beta_{0};
+};
+
 // The collective communication API.
 // MindSpore uses OpenMPI on CPU, NCCL on GPU, HCCL on Ascend, to achieve distributed training.
 // Besides, MindSpore also has its own communication library which is implemented on the CPU side.
@@ -69,6 +78,10 @@ class BACKEND_EXPORT CollectiveManager {
 
   uint32_t local_rank_id() const;
 
+  // Get the cost model of AllReduce in the specified group. The model is benchmarked by launching the real AllReduce on
+  // the device at the first time and cached, so all the ranks of the group must call it in the same order.
+  bool GetAllReduceCostModel(const std::string &group_name, CommCostModel *cost_model);
+
   // Set whether need reinitialize collective communication.
   void set_need_reinit(bool need_reinit) { need_reinit_ = need_reinit; }
   // Get whether need reinitialize collective communication.
@@ -89,6 +102,14 @@ class BACKEND_EXPORT CollectiveManager {
   // Assign the local rank id for this process.
   bool AssignLocalRank();
 
+  // Create the sub groups within the node and across the nodes for the hierarchical collectives of the group, which is
+  // enabled by the env MS_DEV_HIERARCHICAL_COMM and only takes effect when the group spreads over multiple nodes.
+  bool CreateHierarchicalGroups(const std::string &group_name, const std::vector<uint32_t> &group_ranks);
+
+  // Launch the AllReduce of the size repeatedly and get the average cost in microseconds.
+  bool BenchmarkAllReduce(const std::string &group_name, const void *send_buff, void *recv_buff, size_t size,
+                          double *cost) const;
+
   std::atomic_bool inited_;
   std::atomic_bool finalized_;
 
@@ -124,6 +145,9 @@ class BACKEND_EXPORT CollectiveManager {
   // Global group ranks.
   std::vector<uint32_t> global_group_ranks_;
 
+  // The host name hashes of all the ranks, which are used to detect the ranks on the same node.
+  std::vector<size_t> all_host_hashs_;
+
   // The global group name on the host side. This is used for Creating global group on host side for AllGather
   // operation of host name while assigning local rank.
   std::string host_global_group_name_;
@@ -131,6 +155,12 @@ class BACKEND_EXPORT CollectiveManager {
   // This member is represents whether the collective communication library is supported on the device side. If not, the
   // device side library will be replace by library on the host side.
   bool device_lib_supported_;
+
+  // The benchmarked AllReduce cost models, key: group name.
+  std::map<std::string, CommCostModel> all_reduce_cost_models_;
+  std::mutex cost_model_mutex_;
+  // The stream to launch the benchmark AllReduce, which is created at the first benchmark.
+  size_t benchmark_stream_id_{SIZE_MAX};
 };
 }  // namespace collective
 }  // namespace distributed
@@ -0,0 +1,220 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/embedding_cache/embedding_cache_policy.h"
+#include <algorithm>
+#include <cctype>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+EmbeddingCachePolicyType GetEmbeddingCachePolicyType(const std::string &name) {
+  std::string lower_name = name;
+  (void)std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  static const std::map<std::string, EmbeddingCachePolicyType> kNameToPolicyType = {
+    {"step_expiry", EmbeddingCachePolicyType::kStepExpiry},
+    {"lru", EmbeddingCachePolicyType::kLRU},
+    {"lfu", EmbeddingCachePolicyType::kLFU},
+    {"arc", EmbeddingCachePolicyType::kARC}};
+  auto iter = kNameToPolicyType.find(lower_name);
+  if (iter == kNameToPolicyType.end()) {
+    MS_LOG(EXCEPTION) << "Unsupported embedding cache policy: " << name
+                      << ", the supported policies are: step_expiry, lru, lfu and arc.";
+  }
+  return iter->second;
+}
+
+void PositionLists::PushBack(List *list, int index) {
+  MS_EXCEPTION_IF_NULL(list);
+  auto offset = Offset(index);
+  prev_[offset] = list->tail_;
+  next_[offset] = INVALID_INDEX_VALUE;
+  if (list->tail_ != INVALID_INDEX_VALUE) {
+    next_[Offset(list->tail_)] = index;
+  } else {
+    list->head_ = index;
+  }
+  list->tail_ = index;
+  ++list->size_;
+}
+
+void PositionLists::Remove(List *list, int index) {
+  MS_EXCEPTION_IF_NULL(list);
+  auto offset = Offset(index);
+  auto prev = prev_[offset];
+  auto next = next_[offset];
+  if (prev != INVALID_INDEX_VALUE) {
+    next_[Offset(prev)] = next;
+  } else {
+    list->head_ = next;
+  }
+  if (next != INVALID_INDEX_VALUE) {
+    prev_[Offset(next)] = prev;
+  } else {
+    list->tail_ = prev;
+  }
+  prev_[offset] = INVALID_INDEX_VALUE;
+  next_[offset] = INVALID_INDEX_VALUE;
+  --list->size_;
+}
+
+void LRUCachePolicy::Insert(int64_t, int index) { lists_.PushBack(&lru_list_, index); }
+
+void LRUCachePolicy::Access(int index) {
+  lists_.Remove(&lru_list_, index);
+  lists_.PushBack(&lru_list_, index);
+}
+
+int LRUCachePolicy::Evict(int64_t, const std::function<bool(int)> &evictable) {
+  auto index = lru_list_.head_;
+  if (index == INVALID_INDEX_VALUE || !evictable(index)) {
+    return INVALID_INDEX_VALUE;
+  }
+  lists_.Remove(&lru_list_, index);
+  return index;
+}
+
+void LFUCachePolicy::Insert(int64_t, int index) {
+  frequencies_[Offset(index)] = 1;
+  lists_.PushBack(&frequency_lists_[1], index);
+}
+
+void LFUCachePolicy::RemoveFromFrequencyList(int index) {
+  auto iter = frequency_lists_.find(frequencies_[Offset(index)]);
+  if (iter == frequency_lists_.end()) {
+    MS_LOG(EXCEPTION) << "The position " << index << " is not in the LFU cache policy.";
+  }
+  lists_.Remove(&(iter->second), index);
+  if (iter->second.size_ == 0) {
+    (void)frequency_lists_.erase(iter);
+  }
+}
+
+void LFUCachePolicy::Access(int index) {
+  RemoveFromFrequencyList(index);
+  auto frequency = ++frequencies_[Offset(index)];
+  lists_.PushBack(&frequency_lists_[frequency], index);
+}
+
+int LFUCachePolicy::Evict(int64_t, const std::function<bool(int)> &evictable) {
+  // The list of a frequency is in the order of last access, skip the whole list if the least recently accessed one is
+  // not evictable.
+  for (auto &item : frequency_lists_) {
+    auto index = item.second.head_;
+    if (index != INVALID_INDEX_VALUE && evictable(index)) {
+      RemoveFromFrequencyList(index);
+      return index;
+    }
+  }
+  return INVALID_INDEX_VALUE;
+}
+
+void ARCCachePolicy::PushGhost(GhostList *ghost_list, int64_t id) {
+  ghost_list->ids_.push_back(id);
+  ghost_list->id_to_iter_[id] = std::prev(ghost_list->ids_.end());
+  // Keep the history no more than the capacity.
+  if (ghost_list->ids_.size() > capacity()) {
+    (void)ghost_list->id_to_iter_.erase(ghost_list->ids_.front());
+    ghost_list->ids_.pop_front();
+  }
+}
+
+bool ARCCachePolicy::PopGhost(GhostList *ghost_list, int64_t id) {
+  auto iter = ghost_list->id_to_iter_.find(id);
+  if (iter == ghost_list->id_to_iter_.end()) {
+    return false;
+  }
+  (void)ghost_list->ids_.erase(iter->second);
+  (void)ghost_list->id_to_iter_.erase(iter);
+  return true;
+}
+
+void ARCCachePolicy::Insert(int64_t id, int index) {
+  auto offset = Offset(index);
+  ids_[offset] = id;
+  // The id hit in the history is accessed at least twice, and the target size of T1 is adapted to the ghost list hit.
+  auto recent_ghost_size = recent_ghost_list_.ids_.size();
+  auto frequent_ghost_size = frequent_ghost_list_.ids_.size();
+  if (PopGhost(&recent_ghost_list_, id)) {
+    auto delta = std::max(frequent_ghost_size / recent_ghost_size, static_cast<size_t>(1));
+    target_recent_size_ = std::min(target_recent_size_ + delta, capacity());
+  } else if (PopGhost(&frequent_ghost_list_, id)) {
+    auto delta = std::max(recent_ghost_size / frequent_ghost_size, static_cast<size_t>(1));
+    target_recent_size_ = target_recent_size_ > delta ? target_recent_size_ - delta : 0;
+  } else {
+    in_frequent_list_[offset] = false;
+    lists_.PushBack(&recent_list_, index);
+    return;
+  }
+  in_frequent_list_[offset] = true;
+  lists_.PushBack(&frequent_list_, index);
+}
+
+void ARCCachePolicy::Access(int index) {
+  auto offset = Offset(index);
+  if (in_frequent_list_[offset]) {
+    lists_.Remove(&frequent_list_, index);
+  } else {
+    lists_.Remove(&recent_list_, index);
+    in_frequent_list_[offset] = true;
+  }
+  lists_.PushBack(&frequent_list_, index);
+}
+
+void ARCCachePolicy::EvictFrom(bool frequent, int index) {
+  if (frequent) {
+    lists_.Remove(&frequent_list_, index);
+    PushGhost(&frequent_ghost_list_, ids_[Offset(index)]);
+  } else {
+    lists_.Remove(&recent_list_, index);
+    PushGhost(&recent_ghost_list_, ids_[Offset(index)]);
+  }
+}
+
+int ARCCachePolicy::Evict(int64_t id, const std::function<bool(int)> &evictable) {
+  auto recent_size = recent_list_.size_;
+  bool evict_recent =
+    recent_size > 0 && (recent_size > target_recent_size_ ||
+                        (recent_size == target_recent_size_ && frequent_ghost_list_.id_to_iter_.count(id) != 0));
+  // Evict from the preferred list, and the other list is tried if the preferred one has no evictable position.
+  for (bool frequent : {!evict_recent, evict_recent}) {
+    auto index = frequent ? frequent_list_.head_ : recent_list_.head_;
+    if (index != INVALID_INDEX_VALUE && evictable(index)) {
+      EvictFrom(frequent, index);
+      return index;
+    }
+  }
+  return INVALID_INDEX_VALUE;
+}
+
+std::unique_ptr<EmbeddingCachePolicy> CreateEmbeddingCachePolicy(EmbeddingCachePolicyType type, size_t begin_pos,
+                                                                 size_t end_pos) {
+  switch (type) {
+    case EmbeddingCachePolicyType::kStepExpiry:
+      return nullptr;
+    case EmbeddingCachePolicyType::kLRU:
+      return std::make_unique<LRUCachePolicy>(begin_pos, end_pos);
+    case EmbeddingCachePolicyType::kLFU:
+      return std::make_unique<LFUCachePolicy>(begin_pos, end_pos);
+    case EmbeddingCachePolicyType::kARC:
+      return std::make_unique<ARCCachePolicy>(begin_pos, end_pos);
+    default:
+      MS_LOG(EXCEPTION) << "Invalid embedding cache policy type: " << static_cast<int>(type);
+  }
+}
+}  // namespace distributed
+}  // namespace mindspore
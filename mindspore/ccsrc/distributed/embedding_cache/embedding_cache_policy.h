@@ -0,0 +1,170 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "utils/hash_map.h"
+#include "distributed/embedding_cache/embedding_id_index_map.h"
+
+namespace mindspore {
+namespace distributed {
+// The eviction policy type of the embedding cache.
+// kStepExpiry: evict the elements whose step is expired in the order of positions, which is the default policy.
+// kLRU: evict the least recently used element.
+// kLFU: evict the least frequently used element, the least recently used one is evicted among the same frequency.
+// kARC: adaptive replacement cache, balance between the recency and frequency by the history of evicted ids.
+enum class EmbeddingCachePolicyType { kStepExpiry = 0, kLRU, kLFU, kARC };
+
+// Get the policy type by name(case insensitive): "step_expiry", "lru", "lfu" and "arc".
+EmbeddingCachePolicyType GetEmbeddingCachePolicyType(const std::string &name);
+
+// The doubly linked lists of the positions in range [begin_pos, end_pos), each position belongs to one list at most.
+class PositionLists {
+ public:
+  struct List {
+    int head_{INVALID_INDEX_VALUE};
+    int tail_{INVALID_INDEX_VALUE};
+    size_t size_{0};
+  };
+
+  PositionLists(size_t begin_pos, size_t end_pos)
+      : begin_pos_(begin_pos),
+        prev_(end_pos - begin_pos, INVALID_INDEX_VALUE),
+        next_(end_pos - begin_pos, INVALID_INDEX_VALUE) {}
+  ~PositionLists() = default;
+
+  void PushBack(List *list, int index);
+  void Remove(List *list, int index);
+
+ private:
+  size_t Offset(int index) const { return static_cast<size_t>(index) - begin_pos_; }
+
+  size_t begin_pos_;
+  std::vector<int> prev_;
+  std::vector<int> next_;
+};
+
+// The eviction policy of the embedding cache positions in range [begin_pos, end_pos), which is owned by a shard of
+// the embedding hash map and is not thread safe.
+// The elements are accessed in the order of steps, and an element can be evicted only if its last access step is
+// old enough, so the policies only need to check the least recently accessed element of each list.
+class EmbeddingCachePolicy {
+ public:
+  EmbeddingCachePolicy(size_t begin_pos, size_t end_pos) : begin_pos_(begin_pos), end_pos_(end_pos) {}
+  virtual ~EmbeddingCachePolicy() = default;
+
+  // Record the id is inserted to the position.
+  virtual void Insert(int64_t id, int index) = 0;
+  // Record the element at the position is accessed in a new step.
+  virtual void Access(int index) = 0;
+  // Select a position satisfying 'evictable' for the new id and remove it from the policy, return INVALID_INDEX_VALUE
+  // if there is no such position.
+  virtual int Evict(int64_t id, const std::function<bool(int)> &evictable) = 0;
+
+ protected:
+  size_t Offset(int index) const { return static_cast<size_t>(index) - begin_pos_; }
+  size_t capacity() const { return end_pos_ - begin_pos_; }
+
+  size_t begin_pos_;
+  size_t end_pos_;
+};
+
+class LRUCachePolicy : public EmbeddingCachePolicy {
+ public:
+  LRUCachePolicy(size_t begin_pos, size_t end_pos)
+      : EmbeddingCachePolicy(begin_pos, end_pos), lists_(begin_pos, end_pos) {}
+  ~LRUCachePolicy() override = default;
+
+  void Insert(int64_t id, int index) override;
+  void Access(int index) override;
+  int Evict(int64_t id, const std::function<bool(int)> &evictable) override;
+
+ private:
+  PositionLists lists_;
+  // The positions in the order of last access.
+  PositionLists::List lru_list_;
+};
+
+class LFUCachePolicy : public EmbeddingCachePolicy {
+ public:
+  LFUCachePolicy(size_t begin_pos, size_t end_pos)
+      : EmbeddingCachePolicy(begin_pos, end_pos), lists_(begin_pos, end_pos), frequencies_(end_pos - begin_pos, 0) {}
+  ~LFUCachePolicy() override = default;
+
+  void Insert(int64_t id, int index) override;
+  void Access(int index) override;
+  int Evict(int64_t id, const std::function<bool(int)> &evictable) override;
+
+ private:
+  void RemoveFromFrequencyList(int index);
+
+  PositionLists lists_;
+  // The access frequency of each position.
+  std::vector<size_t> frequencies_;
+  // The positions of each frequency in the order of last access.
+  std::map<size_t, PositionLists::List> frequency_lists_;
+};
+
+class ARCCachePolicy : public EmbeddingCachePolicy {
+ public:
+  ARCCachePolicy(size_t begin_pos, size_t end_pos)
+      : EmbeddingCachePolicy(begin_pos, end_pos),
+        lists_(begin_pos, end_pos),
+        ids_(end_pos - begin_pos, 0),
+        in_frequent_list_(end_pos - begin_pos, false) {}
+  ~ARCCachePolicy() override = default;
+
+  void Insert(int64_t id, int index) override;
+  void Access(int index) override;
+  int Evict(int64_t id, const std::function<bool(int)> &evictable) override;
+
+ private:
+  // The history of the evicted ids.
+  struct GhostList {
+    std::list<int64_t> ids_;
+    mindspore::HashMap<int64_t, std::list<int64_t>::iterator> id_to_iter_;
+  };
+  void PushGhost(GhostList *ghost_list, int64_t id);
+  bool PopGhost(GhostList *ghost_list, int64_t id);
+  void EvictFrom(bool frequent, int index);
+
+  PositionLists lists_;
+  std::vector<int64_t> ids_;
+  std::vector<bool> in_frequent_list_;
+  // The positions accessed once(T1) and at least twice(T2) recently, in the order of last access.
+  PositionLists::List recent_list_;
+  PositionLists::List frequent_list_;
+  // The ids evicted from T1(B1) and T2(B2).
+  GhostList recent_ghost_list_;
+  GhostList frequent_ghost_list_;
+  // The target size of T1.
+  size_t target_recent_size_{0};
+};
+
+// Create the eviction policy for the positions in range [begin_pos, end_pos), return nullptr for kStepExpiry which is
+// implemented by the embedding hash map itself.
+std::unique_ptr<EmbeddingCachePolicy> CreateEmbeddingCachePolicy(EmbeddingCachePolicyType type, size_t begin_pos,
+                                                                 size_t end_pos);
+}  // namespace distributed
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
@@ -34,9 +34,14 @@ void EmbeddingCacheTableManager::Initialize() { GetEmbeddingTableSliceBound(); }
 
 void EmbeddingCacheTableManager::Finalize() {
   hash_tables_.clear();
+  {
+    std::lock_guard<std::mutex> lock(table_statistics_mutex_);
+    table_statistics_.clear();
+  }
 
   embedding_device_cache_ = nullptr;
   embedding_host_cache_ = nullptr;
+  embedding_host_optimizer_ = nullptr;
 }
 
 void EmbeddingCacheTableManager::InsertHashTableSize(const std::string &param_name, size_t cache_vocab_size,
@@ -114,10 +119,35 @@ size_t EmbeddingCacheTableManager::QueryHashTableSize(const std::string &param_n
   return iter->second.cache_vocab_size;
 }
 
+void EmbeddingCacheTableManager::AddHostAdamTable(const std::string &var_name, const std::string &m_name,
+                                                  const std::string &v_name, const AdamHyperParams &params) {
+  if (embedding_host_optimizer_ == nullptr) {
+    return;
+  }
+  auto var_iter = hash_tables_.find(var_name);
+  auto m_iter = hash_tables_.find(m_name);
+  auto v_iter = hash_tables_.find(v_name);
+  if (var_iter == hash_tables_.end() || m_iter == hash_tables_.end() || v_iter == hash_tables_.end()) {
+    MS_LOG(EXCEPTION) << "The var: " << var_name << ", m: " << m_name << " and v: " << v_name
+                      << " of Adam should all be embedding cache tables.";
+  }
+  auto embedding_size = var_iter->second.embedding_size;
+  if (m_iter->second.embedding_size != embedding_size || v_iter->second.embedding_size != embedding_size) {
+    MS_LOG(EXCEPTION) << "The embedding size of the var: " << var_name << ", m: " << m_name << " and v: " << v_name
+                      << " of Adam should be the same.";
+  }
+  embedding_host_optimizer_->AddAdamTable(var_iter->second.host_address.get(), m_iter->second.host_address.get(),
+                                          v_iter->second.host_address.get(), embedding_size, params);
+  MS_LOG(INFO) << "Add the embedding cache table: " << var_name << " updated by Adam to the host optimizer, lr: "
+               << params.lr << ", beta1: " << params.beta1 << ", beta2: " << params.beta2
+               << ", epsilon: " << params.epsilon;
+}
+
 void EmbeddingCacheTableManager::AllocMemForEmbeddingCacheTable(const device::DeviceContext *device_context) {
   MS_EXCEPTION_IF_NULL(device_context);
 
   size_t max_embedding_size = 0;
+  auto storage_path = common::GetEnv(kEnvEmbeddingStoragePath);
   for (auto &item : hash_tables_) {
     size_t embedding_size = item.second.embedding_size;
     auto &device_address = item.second.device_address;
@@ -132,13 +162,31 @@ void EmbeddingCacheTableManager::AllocMemForEmbeddingCacheTable(const device::De
     host_address = std::shared_ptr<float>(host_hash_table_addr.release(), std::default_delete<float[]>());
     MS_EXCEPTION_IF_NULL(host_address);
 
+    if (!storage_path.empty()) {
+      // The workers on the same machine may share the storage path, so the directory of each table is distinguished
+      // by the rank id.
+      auto table_storage_path = storage_path + "/rank_" + std::to_string(rank_id_) + "/embedding_table_" +
+                                std::to_string(item.second.param_key_);
+      item.second.embedding_store =
+        std::make_shared<storage::EmbeddingStore>(table_storage_path, embedding_size * sizeof(float));
+      item.second.embedding_store->Initialize();
+    }
+
     max_embedding_size = (embedding_size > max_embedding_size) ? embedding_size : max_embedding_size;
   }
 
-  embedding_device_cache_ = std::make_shared<EmbeddingDeviceCache>(batch_ids_num_, device_cache_size_);
+  // The device and local host hash maps must be divided into the same shards, so that the swapping between the device
+  // and local host cache of the ids in a shard only touches the same shard of both hash maps.
+  size_t shard_num = GetHashMapShardNum();
+  embedding_device_cache_ = std::make_shared<EmbeddingDeviceCache>(batch_ids_num_, device_cache_size_, shard_num,
+                                                                   GetDeviceCachePolicyType());
   MS_EXCEPTION_IF_NULL(embedding_device_cache_);
-  embedding_host_cache_ = std::make_shared<EmbeddingHostCache>(batch_ids_num_, host_cache_size_);
+  embedding_host_cache_ = std::make_shared<EmbeddingHostCache>(batch_ids_num_, host_cache_size_, shard_num);
   MS_EXCEPTION_IF_NULL(embedding_host_cache_);
+  if (common::GetEnv(kEnvEmbeddingHostOptimizer) == "1") {
+    embedding_host_optimizer_ = std::make_shared<EmbeddingHostOptimizer>();
+    MS_LOG(INFO) << "The Adam steps missed by the rows out of the device cache are applied on the local host.";
+  }
 
   embedding_device_cache_->hash_swap_index_addr_ =
     reinterpret_cast<int *>(device_context->device_res_manager_->AllocateMemory(batch_ids_num_ * sizeof(int)));
@@ -160,11 +208,12 @@ void EmbeddingCacheTableManager::GetEmbeddingTableSliceBound() {
   MS_EXCEPTION_IF_NULL(node);
   rank_id = node->rank_id();
 #endif
+  rank_id_ = rank_id;
 
-  auto local_shard_size = FloatToInt(std::ceil(SizeToFloat(vocab_size_) / worker_num));
-  local_embedding_slice_bounds_.first = local_shard_size * UintToInt(rank_id);
+  auto local_shard_size = SizeToLong((vocab_size_ + worker_num - 1) / worker_num);
+  local_embedding_slice_bounds_.first = local_shard_size * static_cast<int64_t>(rank_id);
   local_embedding_slice_bounds_.second =
-    std::min(local_embedding_slice_bounds_.first + local_shard_size, SizeToInt(vocab_size_));
+    std::min(local_embedding_slice_bounds_.first + local_shard_size, SizeToLong(vocab_size_));
   local_device_cache_bounds_.first = SizeToInt(device_cache_size_) * UintToInt(rank_id);
   local_device_cache_bounds_.second = local_device_cache_bounds_.first + SizeToInt(device_cache_size_);
   MS_LOG(INFO) << "Worker num:" << worker_num << ", rank id:" << rank_id
@@ -174,6 +223,35 @@ void EmbeddingCacheTableManager::GetEmbeddingTableSliceBound() {
                << ", cache indices end: " << local_device_cache_bounds_.second;
 }
 
+size_t EmbeddingCacheTableManager::GetHashMapShardNum() const {
+  auto env_shard_num = common::GetEnv(kEnvParseThreadNum);
+  if (env_shard_num.empty()) {
+    return 1;
+  }
+  size_t shard_num = 1;
+  try {
+    shard_num = std::stoul(env_shard_num);
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid value of env " << kEnvParseThreadNum << ": " << env_shard_num << ", " << e.what();
+    return 1;
+  }
+  // Each shard of the device hash map should be large enough to hold the ids of a step.
+  shard_num = std::min({shard_num, kMaxThreadNum, device_cache_size_ / kMinHashMapShardCapacity});
+  shard_num = std::max(shard_num, static_cast<size_t>(1));
+  MS_LOG(INFO) << "The embedding hash maps are divided into " << shard_num << " shards.";
+  return shard_num;
+}
+
+EmbeddingCachePolicyType EmbeddingCacheTableManager::GetDeviceCachePolicyType() const {
+  auto env_policy = common::GetEnv(kEnvDeviceCachePolicy);
+  if (env_policy.empty()) {
+    return EmbeddingCachePolicyType::kStepExpiry;
+  }
+  auto policy_type = GetEmbeddingCachePolicyType(env_policy);
+  MS_LOG(INFO) << "The eviction policy of the device embedding cache is " << env_policy;
+  return policy_type;
+}
+
 int EmbeddingCacheTableManager::cache_indices_lower_bound() const { return local_device_cache_bounds_.first; }
 
 void EmbeddingCacheTableManager::DumpHashTables() const {
@@ -193,5 +271,45 @@ void EmbeddingCacheTableManager::DumpHashTables() const {
                  << ", host cache address:" << reinterpret_cast<void *>(item.second.host_address.get());
   }
 }
+
+void EmbeddingCacheTableManager::UpdateTableStatistics(const EmbeddingCacheStatisticsInfo &step_info) {
+  std::lock_guard<std::mutex> lock(table_statistics_mutex_);
+  auto swap_size = step_info.device_to_host_size_ + step_info.host_to_device_size_ + step_info.host_to_server_size_ +
+                   step_info.server_to_host_size_;
+  for (const auto &item : hash_tables_) {
+    auto &statistics = table_statistics_[item.first];
+    statistics.id_count_ += step_info.batch_id_count_;
+    statistics.device_hit_count_ += step_info.hash_hit_count_;
+    statistics.device_miss_count_ += step_info.host_to_device_size_;
+    statistics.device_to_host_size_ += step_info.device_to_host_size_;
+    statistics.host_to_device_size_ += step_info.host_to_device_size_;
+    statistics.host_to_server_size_ += step_info.host_to_server_size_;
+    statistics.server_to_host_size_ += step_info.server_to_host_size_;
+    statistics.swap_bytes_ += swap_size * item.second.embedding_size * sizeof(float);
+  }
+}
+
+EmbeddingCacheTableStatistics EmbeddingCacheTableManager::QueryTableStatistics(const std::string &param_name) const {
+  std::lock_guard<std::mutex> lock(table_statistics_mutex_);
+  auto iter = table_statistics_.find(param_name);
+  if (iter == table_statistics_.end()) {
+    return EmbeddingCacheTableStatistics();
+  }
+  return iter->second;
+}
+
+void EmbeddingCacheTableManager::DumpTableStatistics() const {
+  std::lock_guard<std::mutex> lock(table_statistics_mutex_);
+  for (const auto &item : table_statistics_) {
+    const auto &statistics = item.second;
+    MS_LOG(INFO) << "Embedding cache table statistics: embedding table name:" << item.first
+                 << ", id count:" << statistics.id_count_ << ", device hit rate:" << statistics.device_hit_rate()
+                 << ", device to host size:" << statistics.device_to_host_size_
+                 << ", host to device size:" << statistics.host_to_device_size_
+                 << ", host to server size:" << statistics.host_to_server_size_
+                 << ", server to host size:" << statistics.server_to_host_size_
+                 << ", swap bytes:" << statistics.swap_bytes_;
+  }
+}
 }  // namespace distributed
 }  // namespace mindspore
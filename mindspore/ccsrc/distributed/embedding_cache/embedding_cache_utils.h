@@ -18,11 +18,14 @@
 #define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CHCHE_UTILS_H_
 
 #include <map>
+#include <mutex>
 #include <string>
 #include <memory>
 #include <utility>
 #include "kernel/kernel.h"
 #include "distributed/embedding_cache/embedding_hash_map.h"
+#include "distributed/embedding_cache/embedding_host_optimizer.h"
+#include "distributed/persistent/storage/embedding_store.h"
 #include "runtime/hardware/device_context.h"
 #include "include/backend/visible.h"
 
@@ -38,6 +41,18 @@ static constexpr size_t kHostCacheScaleFactor = 10;
 static constexpr size_t kMaxThreadNum = 16;
 // Maximum number of feature ids processed per thread.
 static constexpr size_t kMaxIdsPerThread = 10000;
+// The env to set the number of threads that parse the cache miss ids, and the embedding hash maps are divided into the
+// same number of shards. The ids are parsed by one thread by default.
+static constexpr char kEnvParseThreadNum[] = "MS_DEV_EMBEDDING_CACHE_PARSE_THREAD_NUM";
+// The env to set the eviction policy of the device cache: step_expiry(default), lru, lfu or arc.
+static constexpr char kEnvDeviceCachePolicy[] = "MS_DEV_EMBEDDING_CACHE_POLICY";
+// The env to set the directory of the local storage tier (e.g. on SSD) below the local host cache. The embeddings
+// swapped out from the local host cache are stored in it rather than pushed to the remote, and the remote is only
+// accessed for the ids which have never been swapped out. The local storage is disabled by default.
+static constexpr char kEnvEmbeddingStoragePath[] = "MS_DEV_EMBEDDING_CACHE_STORAGE_PATH";
+// If set to 1, the rows swapped out of the device cache catch up the Adam steps they missed on the local host when they
+// are swapped into the device cache again, see EmbeddingHostOptimizer. It is disabled by default.
+static constexpr char kEnvEmbeddingHostOptimizer[] = "MS_DEV_EMBEDDING_CACHE_HOST_OPTIMIZER";
 
 using mindspore::kernel::Address;
 
@@ -51,6 +66,8 @@ struct HashTableInfo {
   Address device_address{nullptr, 0};
   std::shared_ptr<float> host_address{nullptr};
   int32_t param_key_{-1};
+  // The local storage tier below the local host cache, which is nullptr if not enabled.
+  std::shared_ptr<storage::EmbeddingStore> embedding_store{nullptr};
 };
 
 // Record the hash mapping relationship of all embedding tables with cache enabled on the device side, and the
@@ -58,19 +75,20 @@ struct HashTableInfo {
 // all embedding cache tables on the device side is same: hash mapping, and feature ids of feature vectors that need
 // to be swapped with the local host cache.
 struct EmbeddingDeviceCache {
-  EmbeddingDeviceCache(size_t batch_ids_num, size_t cache_vocab_size)
+  EmbeddingDeviceCache(size_t batch_ids_num, size_t cache_vocab_size, size_t shard_num,
+                       EmbeddingCachePolicyType policy_type = EmbeddingCachePolicyType::kStepExpiry)
       : hash_swap_index_addr_(nullptr), hash_swap_value_addr_(nullptr) {
     device_to_host_index = std::make_unique<int[]>(batch_ids_num);
-    device_to_host_ids = std::make_unique<int[]>(batch_ids_num);
+    device_to_host_ids = std::make_unique<int64_t[]>(batch_ids_num);
     host_to_device_index = std::make_unique<int[]>(batch_ids_num);
-    host_to_device_ids = std::make_unique<int[]>(batch_ids_num);
-    device_hash_map_ = std::make_shared<EmbeddingHashMap>(0, cache_vocab_size);
+    host_to_device_ids = std::make_unique<int64_t[]>(batch_ids_num);
+    device_hash_map_ = std::make_shared<EmbeddingHashMap>(0, cache_vocab_size, shard_num, policy_type);
   }
 
   std::unique_ptr<int[]> device_to_host_index;
-  std::unique_ptr<int[]> device_to_host_ids;
+  std::unique_ptr<int64_t[]> device_to_host_ids;
   std::unique_ptr<int[]> host_to_device_index;
-  std::unique_ptr<int[]> host_to_device_ids;
+  std::unique_ptr<int64_t[]> host_to_device_ids;
   int *hash_swap_index_addr_;
   float *hash_swap_value_addr_;
   std::shared_ptr<EmbeddingHashMap> device_hash_map_;
@@ -81,20 +99,20 @@ struct EmbeddingDeviceCache {
 // all embedding cache tables on the local host side is same: hash mapping, and feature ids of feature vectors that need
 // to be swapped with the remote cache and device cache.
 struct EmbeddingHostCache {
-  EmbeddingHostCache(size_t batch_ids_num, size_t host_cache_vocab_size) {
+  EmbeddingHostCache(size_t batch_ids_num, size_t host_cache_vocab_size, size_t shard_num) {
     host_to_server_index = std::make_unique<int[]>(batch_ids_num);
-    host_to_server_ids = std::make_unique<int[]>(batch_ids_num);
+    host_to_server_ids = std::make_unique<int64_t[]>(batch_ids_num);
     server_to_host_index = std::make_unique<int[]>(batch_ids_num);
-    server_to_host_ids = std::make_unique<int[]>(batch_ids_num);
+    server_to_host_ids = std::make_unique<int64_t[]>(batch_ids_num);
     host_to_device_index = std::make_unique<int[]>(batch_ids_num);
     device_to_host_index = std::make_unique<int[]>(batch_ids_num);
-    host_hash_map_ = std::make_shared<EmbeddingHashMap>(0, host_cache_vocab_size);
+    host_hash_map_ = std::make_shared<EmbeddingHashMap>(0, host_cache_vocab_size, shard_num);
   }
 
   std::unique_ptr<int[]> host_to_server_index;
-  std::unique_ptr<int[]> host_to_server_ids;
+  std::unique_ptr<int64_t[]> host_to_server_ids;
   std::unique_ptr<int[]> server_to_host_index;
-  std::unique_ptr<int[]> server_to_host_ids;
+  std::unique_ptr<int64_t[]> server_to_host_ids;
   std::unique_ptr<int[]> host_to_device_index;
   std::unique_ptr<int[]> device_to_host_index;
   std::shared_ptr<EmbeddingHashMap> host_hash_map_;
@@ -113,6 +131,24 @@ struct EmbeddingCacheStatisticsInfo {
   size_t mem_cache_hit_count_{0};
 };
 
+// The accumulated statistics of an embedding cache table over all the steps.
+struct EmbeddingCacheTableStatistics {
+  size_t id_count_{0};
+  size_t device_hit_count_{0};
+  size_t device_miss_count_{0};
+  size_t device_to_host_size_{0};
+  size_t host_to_device_size_{0};
+  size_t host_to_server_size_{0};
+  size_t server_to_host_size_{0};
+  // The bytes of the embeddings swapped between the device, local host and remote cache.
+  size_t swap_bytes_{0};
+
+  float device_hit_rate() const {
+    auto total_count = device_hit_count_ + device_miss_count_;
+    return total_count == 0 ? 0 : static_cast<float>(device_hit_count_) / total_count;
+  }
+};
+
 // The EmbeddingCacheTableManager class is used to save all Parameter information for enabling cache, such as device
 // cache size, host cache size, etc., and can allocate memory for the embedding cache table.
 class BACKEND_EXPORT EmbeddingCacheTableManager {
@@ -146,6 +182,12 @@ class BACKEND_EXPORT EmbeddingCacheTableManager {
   // Qeury device cache size of a embedding cache table.
   size_t QueryHashTableSize(const std::string &param_name) const;
 
+  // Add the embedding cache tables of the var, m and v updated by Adam to the host optimizer, it's ignored if the host
+  // optimizer is not enabled.
+  void AddHostAdamTable(const std::string &var_name, const std::string &m_name, const std::string &v_name,
+                        const AdamHyperParams &params);
+  bool enable_host_optimizer() const { return embedding_host_optimizer_ != nullptr; }
+
   // Check whether a parameter is cache enabled embedding table.
   bool IsEmbeddingCacheTable(const std::string &param_name) const { return hash_tables_.count(param_name) != 0; }
 
@@ -158,6 +200,12 @@ class BACKEND_EXPORT EmbeddingCacheTableManager {
 
   void DumpHashTables() const;
 
+  // Accumulate the statistics of a step to all the embedding cache tables.
+  void UpdateTableStatistics(const EmbeddingCacheStatisticsInfo &step_info);
+  // Qeury the accumulated statistics of a embedding cache table.
+  EmbeddingCacheTableStatistics QueryTableStatistics(const std::string &param_name) const;
+  void DumpTableStatistics() const;
+
  private:
   EmbeddingCacheTableManager() = default;
   ~EmbeddingCacheTableManager() = default;
@@ -166,10 +214,21 @@ class BACKEND_EXPORT EmbeddingCacheTableManager {
   // Get embedding table slice bound info on each worker in a multi-worker automatic parallel scenario.
   void GetEmbeddingTableSliceBound();
 
+  // Get the shard number of the embedding hash maps, which is also the number of threads parsing the cache miss ids.
+  size_t GetHashMapShardNum() const;
+
+  // Get the eviction policy of the device cache from env.
+  EmbeddingCachePolicyType GetDeviceCachePolicyType() const;
+
   // The hash tables records information such as the dimension, memory address, and cache size of the embedding table
   // with the embedding cache enabled.
   std::map<std::string, HashTableInfo> hash_tables_;
 
+  // The accumulated statistics of the embedding cache tables, which are updated by the prefetch actor and can be
+  // queried from the other threads.
+  std::map<std::string, EmbeddingCacheTableStatistics> table_statistics_;
+  mutable std::mutex table_statistics_mutex_;
+
   // Record the hash mapping relationship of all embedding tables with cache enabled on the device side, and the
   // ids information that needs to be exchanged with the local host cache.
   std::shared_ptr<EmbeddingDeviceCache> embedding_device_cache_;
@@ -178,14 +237,20 @@ class BACKEND_EXPORT EmbeddingCacheTableManager {
   // information that needs to be exchanged with the remote cache and device cache.
   std::shared_ptr<EmbeddingHostCache> embedding_host_cache_;
 
+  // Apply the Adam steps missed by the rows out of the device cache on the local host, which is nullptr if not enabled.
+  std::shared_ptr<EmbeddingHostOptimizer> embedding_host_optimizer_;
+
   // Model parallelism is used between multiple workers, and local_embedding_slice_bounds_ records the feature range
   // corresponding to the embedding table slice of the process.
-  std::pair<int, int> local_embedding_slice_bounds_;
+  std::pair<int64_t, int64_t> local_embedding_slice_bounds_;
 
   // Model parallelism is used between multiple workers, and local_device_cache_bounds_ records the local device cache
   // range corresponding to the embedding table slice of the process.
   std::pair<int, int> local_device_cache_bounds_;
 
+  // The rank id of the worker.
+  uint32_t rank_id_{0};
+
   // Full Embedding table row num, not less than the total number of feature ids.
   size_t vocab_size_{0};
   // Embedding cache size(row number of embedding cache) of device cache.
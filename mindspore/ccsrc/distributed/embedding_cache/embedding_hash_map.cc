@@ -15,78 +15,165 @@
  */
 
 #include "distributed/embedding_cache/embedding_hash_map.h"
+#include <algorithm>
 
 namespace mindspore {
 namespace distributed {
-int EmbeddingHashMap::ParseData(const int id, int *const swap_out_index, int *const swap_out_ids,
+EmbeddingHashMap::EmbeddingHashMap(size_t hash_count, size_t hash_capacity, size_t shard_num,
+                                   EmbeddingCachePolicyType policy_type)
+    : hash_count_(hash_count), hash_capacity_(hash_capacity), policy_type_(policy_type) {
+  hash_map_elements_.resize(hash_capacity);
+  // In multi-device mode, embedding table are distributed on different devices by id interval,
+  // and ids outside the range of local device will use the front and back positions of the table,
+  // the positions are reserved for this.
+  hash_map_elements_.front().set_step(SIZE_MAX);
+  hash_map_elements_.back().set_step(SIZE_MAX);
+
+  // Each shard should be large enough to hold the ids of a step.
+  shard_num = std::max(std::min(shard_num, hash_capacity / kMinHashMapShardCapacity), static_cast<size_t>(1));
+  size_t begin_pos = 0;
+  for (size_t i = 0; i < shard_num; ++i) {
+    size_t shard_capacity = hash_capacity / shard_num + (i < hash_capacity % shard_num ? 1 : 0);
+    (void)shards_.emplace_back(std::make_unique<Shard>(begin_pos, begin_pos + shard_capacity, policy_type));
+    begin_pos += shard_capacity;
+  }
+}
+
+int EmbeddingHashMap::ParseData(const int64_t id, int *const swap_out_index, int64_t *const swap_out_ids,
                                 const size_t data_step, const size_t graph_running_step, size_t *const swap_out_size,
                                 bool *const need_wait_graph) {
   MS_EXCEPTION_IF_NULL(swap_out_index);
   MS_EXCEPTION_IF_NULL(swap_out_ids);
   MS_EXCEPTION_IF_NULL(swap_out_size);
+  auto &shard = shards_[ShardIndex(id)];
   bool need_swap = false;
-  auto hash_index = FindInsertionPos(data_step, graph_running_step, &need_swap, need_wait_graph);
+  auto hash_index = shard->policy_ != nullptr
+                      ? FindInsertionPosByPolicy(shard.get(), id, graph_running_step, &need_swap, need_wait_graph)
+                      : FindInsertionPos(shard.get(), data_step, graph_running_step, &need_swap, need_wait_graph);
   if (hash_index == INVALID_INDEX_VALUE) {
     return hash_index;
   }
 
   if (!need_swap) {
-    hash_count_++;
-    (void)hash_id_to_index_.emplace(id, hash_index);
-    hash_map_elements_[hash_index].set_id(id);
-    hash_map_elements_[hash_index].set_step(data_step);
-    return hash_index;
+    shard->hash_count_++;
+  } else {
+    swap_out_index[*swap_out_size] = hash_index;
+    swap_out_ids[*swap_out_size] = hash_map_elements_[hash_index].id_;
+    (*swap_out_size)++;
+    (void)shard->hash_id_to_index_.Erase(hash_map_elements_[hash_index].id_);
+  }
+  if (!shard->hash_id_to_index_.Insert(id, hash_index)) {
+    MS_LOG(EXCEPTION) << "Insert id " << id << " to the embedding hash map failed, hash count: " << shard->hash_count_
+                      << ", hash capacity: " << hash_capacity_;
   }
-
-  swap_out_index[*swap_out_size] = hash_index;
-  swap_out_ids[*swap_out_size] = hash_map_elements_[hash_index].id_;
-  (*swap_out_size)++;
-  (void)hash_id_to_index_.erase(hash_map_elements_[hash_index].id_);
-  (void)hash_id_to_index_.emplace(id, hash_index);
   hash_map_elements_[hash_index].set_id(id);
   hash_map_elements_[hash_index].set_step(data_step);
+  if (shard->policy_ != nullptr) {
+    shard->policy_->Insert(id, hash_index);
+  }
   return hash_index;
 }
 
-int EmbeddingHashMap::FindInsertionPos(const size_t, const size_t graph_running_step, bool *const need_swap,
-                                       bool *const need_wait_graph) {
+size_t EmbeddingHashMap::ParseData(const int64_t *ids, const size_t ids_num, int *const hash_indices,
+                                   int *const swap_out_index, int64_t *const swap_out_ids, const size_t data_step,
+                                   const size_t graph_running_step, size_t *const swap_out_size,
+                                   bool *const need_wait_graph) {
+  MS_EXCEPTION_IF_NULL(ids);
+  MS_EXCEPTION_IF_NULL(hash_indices);
+  for (size_t i = 0; i < ids_num; ++i) {
+    hash_indices[i] = ParseData(ids[i], swap_out_index, swap_out_ids, data_step, graph_running_step, swap_out_size,
+                                need_wait_graph);
+    if (hash_indices[i] == INVALID_INDEX_VALUE) {
+      return i;
+    }
+  }
+  return ids_num;
+}
+
+int EmbeddingHashMap::FindInsertionPos(Shard *const shard, const size_t, const size_t graph_running_step,
+                                       bool *const need_swap, bool *const need_wait_graph) {
+  MS_EXCEPTION_IF_NULL(shard);
   MS_EXCEPTION_IF_NULL(need_swap);
   MS_EXCEPTION_IF_NULL(need_wait_graph);
   int hash_index = INVALID_INDEX_VALUE;
-  while (!expired_element_full_) {
-    if (hash_map_elements_[current_pos_].IsEmpty()) {
-      hash_index = current_pos_;
-    } else if (hash_map_elements_[current_pos_].IsExpired(graph_running_step)) {
-      hash_index = current_pos_;
+  while (!shard->expired_element_full_) {
+    auto current_pos = shard->current_pos_;
+    if (hash_map_elements_[current_pos].IsEmpty()) {
+      hash_index = SizeToInt(current_pos);
+    } else if (hash_map_elements_[current_pos].IsExpired(graph_running_step)) {
+      hash_index = SizeToInt(current_pos);
       *need_swap = true;
-    } else if (hash_map_elements_[current_pos_].StepEqual(graph_running_step)) {
-      graph_running_index_[graph_running_index_num_++] = current_pos_;
+    } else if (hash_map_elements_[current_pos].StepEqual(graph_running_step)) {
+      shard->graph_running_index_[shard->graph_running_index_num_++] = SizeToInt(current_pos);
     }
-    current_pos_ = (current_pos_ + 1) % hash_capacity_;
+    shard->current_pos_ = current_pos + 1 == shard->end_pos_ ? shard->begin_pos_ : current_pos + 1;
     if (hash_index != INVALID_INDEX_VALUE) {
       return hash_index;
     }
-    if (current_pos_ == current_batch_start_pos_) {
-      expired_element_full_ = true;
-      MS_LOG(INFO) << "Running step:" << graph_running_step << "(num:" << graph_running_index_num_
+    if (shard->current_pos_ == shard->current_batch_start_pos_) {
+      shard->expired_element_full_ = true;
+      MS_LOG(INFO) << "Running step:" << graph_running_step << "(num:" << shard->graph_running_index_num_
                    << ") will be used, index swap will wait until the graph completed.";
     }
   }
 
-  if (graph_running_index_pos_ != graph_running_index_num_) {
+  if (shard->graph_running_index_pos_ != shard->graph_running_index_num_) {
     *need_swap = true;
     *need_wait_graph = true;
-    return graph_running_index_[graph_running_index_pos_++];
+    return shard->graph_running_index_[shard->graph_running_index_pos_++];
   }
   return INVALID_INDEX_VALUE;
 }
 
+int EmbeddingHashMap::FindInsertionPosByPolicy(Shard *const shard, const int64_t id, const size_t graph_running_step,
+                                               bool *const need_swap, bool *const need_wait_graph) {
+  MS_EXCEPTION_IF_NULL(shard);
+  MS_EXCEPTION_IF_NULL(shard->policy_);
+  MS_EXCEPTION_IF_NULL(need_swap);
+  MS_EXCEPTION_IF_NULL(need_wait_graph);
+  // The empty positions are used firstly, and the reserved positions are skipped.
+  while (shard->empty_pos_ < shard->end_pos_) {
+    auto current_pos = shard->empty_pos_++;
+    if (hash_map_elements_[current_pos].IsEmpty()) {
+      return SizeToInt(current_pos);
+    }
+  }
+
+  auto hash_index = shard->policy_->Evict(
+    id, [this, graph_running_step](int index) { return hash_map_elements_[index].IsExpired(graph_running_step); });
+  if (hash_index != INVALID_INDEX_VALUE) {
+    *need_swap = true;
+    return hash_index;
+  }
+  // The element used by the running step of graph can be swapped out after the graph completed.
+  hash_index = shard->policy_->Evict(id, [this, graph_running_step](int index) {
+    return hash_map_elements_[index].IsExpired(graph_running_step) ||
+           hash_map_elements_[index].StepEqual(graph_running_step);
+  });
+  if (hash_index != INVALID_INDEX_VALUE) {
+    *need_swap = true;
+    *need_wait_graph = true;
+  }
+  return hash_index;
+}
+
+size_t EmbeddingHashMap::id_num() const {
+  size_t id_num = 0;
+  for (const auto &shard : shards_) {
+    id_num += shard->hash_id_to_index_.size();
+  }
+  return id_num;
+}
+
 void EmbeddingHashMap::DumpHashMap() {
-  MS_LOG(INFO) << "Dump hash map info begin, hash_capacity: " << hash_capacity_ << " hash_count: " << hash_count_;
-  MS_LOG(INFO) << "Dump hash_id_to_index: ";
-  for (auto iter = hash_id_to_index_.begin(); iter != hash_id_to_index_.end(); ++iter) {
-    MS_LOG(INFO) << "  id: " << iter->first << " index: " << iter->second;
+  size_t hash_count = hash_count_;
+  for (const auto &shard : shards_) {
+    hash_count += shard->hash_count_;
   }
+  MS_LOG(INFO) << "Dump hash map info begin, hash_capacity: " << hash_capacity_ << " hash_count: " << hash_count
+               << " shard_num: " << shards_.size();
+  MS_LOG(INFO) << "Dump hash_id_to_index: ";
+  ForEach([](int64_t id, int index) { MS_LOG(INFO) << "  id: " << id << " index: " << index; });
   MS_LOG(INFO) << "Dump hash_map_unit: ";
   for (size_t i = 0; i < hash_map_elements_.size(); i++) {
     if (!hash_map_elements_[i].IsEmpty()) {
@@ -98,10 +185,18 @@ void EmbeddingHashMap::DumpHashMap() {
 }
 
 void EmbeddingHashMap::Reset() {
-  current_batch_start_pos_ = current_pos_;
-  graph_running_index_num_ = 0;
-  graph_running_index_pos_ = 0;
-  expired_element_full_ = false;
+  for (auto &shard : shards_) {
+    // Clean up the deleted slots left by swapping out when they make the probe sequences long, no reader is running
+    // between the steps.
+    auto &hash_id_to_index = shard->hash_id_to_index_;
+    if (hash_id_to_index.deleted_num() * 4 > hash_id_to_index.slot_num()) {
+      hash_id_to_index.Rehash();
+    }
+    shard->current_batch_start_pos_ = shard->current_pos_;
+    shard->graph_running_index_num_ = 0;
+    shard->graph_running_index_pos_ = 0;
+    shard->expired_element_full_ = false;
+  }
 }
 }  // namespace distributed
 }  // namespace mindspore
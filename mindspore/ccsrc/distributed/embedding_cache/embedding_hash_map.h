@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+
 #ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HASH_MAP_H_
 #define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HASH_MAP_H_
 
@@ -21,56 +22,75 @@
 #include <utility>
 #include <memory>
 #include <vector>
-#include "utils/hash_map.h"
 #include "utils/convert_utils_base.h"
+#include "distributed/embedding_cache/embedding_id_index_map.h"
+#include "distributed/embedding_cache/embedding_cache_policy.h"
 
 namespace mindspore {
 namespace distributed {
 // Define the value of an invalid step.
 static constexpr size_t INVALID_STEP_VALUE = 0;
-// Define the value of an invalid index.
-static constexpr int INVALID_INDEX_VALUE = -1;
+// The minimum capacity of a shard of the hash map.
+static constexpr size_t kMinHashMapShardCapacity = 1024;
 
 struct HashMapElement {
-  int id_{INVALID_INDEX_VALUE};
+  int64_t id_{INVALID_INDEX_VALUE};
   // The current global step of cache prefetching operation.
   size_t step_{INVALID_STEP_VALUE};
 
   bool IsEmpty() const { return step_ == INVALID_STEP_VALUE; }
   bool IsExpired(size_t graph_running_step) const { return graph_running_step > step_; }
   bool StepEqual(size_t step) const { return step_ == step; }
-  void set_id(int id) { id_ = id; }
+  void set_id(int64_t id) { id_ = id; }
   void set_step(size_t step) { step_ = step; }
 };
 
 // EmbeddingHashMap is used to manage the id -> index mapping of the embedding cache table on the host
 // side. The cache content can be stored on the device or host side.
+// The hash map can be divided into several shards by the id, each shard owns a contiguous range of the indices, so the
+// ids of different shards can be parsed by different threads at the same time.
+// The elements to be swapped out are selected by the eviction policy, and only the elements whose step is expired can
+// be swapped out.
 class EmbeddingHashMap {
  public:
-  EmbeddingHashMap(size_t hash_count, size_t hash_capacity)
-      : hash_count_(hash_count),
-        hash_capacity_(hash_capacity),
-        current_pos_(0),
-        current_batch_start_pos_(0),
-        graph_running_index_num_(0),
-        graph_running_index_pos_(0),
-        expired_element_full_(false) {
-    hash_map_elements_.resize(hash_capacity);
-    // In multi-device mode, embedding table are distributed on different devices by id interval,
-    // and ids outside the range of local device will use the front and back positions of the table,
-    // the positions are reserved for this.
-    hash_map_elements_.front().set_step(SIZE_MAX);
-    hash_map_elements_.back().set_step(SIZE_MAX);
-    graph_running_index_ = std::make_unique<int[]>(hash_capacity);
-  }
-
+  EmbeddingHashMap(size_t hash_count, size_t hash_capacity, size_t shard_num = 1,
+                   EmbeddingCachePolicyType policy_type = EmbeddingCachePolicyType::kStepExpiry);
   ~EmbeddingHashMap() = default;
 
   // Find the insertion position (index) in the hash map for an id.
   // If the hash map capacity is insufficient, return the information of ids and indices that need to be swapped.
-  int ParseData(const int id, int *const swap_out_index, int *const swap_out_ids, const size_t data_step,
+  // The ids of the same shard must not be parsed concurrently.
+  int ParseData(const int64_t id, int *const swap_out_index, int64_t *const swap_out_ids, const size_t data_step,
                 const size_t graph_running_step, size_t *const swap_out_size, bool *const need_wait_graph);
 
+  // Find the insertion positions (indices) in the hash map for a batch of ids which are not in the hash map, and the
+  // indices are stored to hash_indices. The parsing stops at the first id without insertion position, and the number
+  // of parsed ids is returned, then the caller should wait for the graph to release the positions and parse the rest.
+  size_t ParseData(const int64_t *ids, const size_t ids_num, int *const hash_indices, int *const swap_out_index,
+                   int64_t *const swap_out_ids, const size_t data_step, const size_t graph_running_step,
+                   size_t *const swap_out_size, bool *const need_wait_graph);
+
+  // Get the index of the id, return INVALID_INDEX_VALUE if the id is not in the hash map. It can be called
+  // concurrently while ParseData is running.
+  int GetIndex(const int64_t id) const { return shards_[ShardIndex(id)]->hash_id_to_index_.Find(id); }
+
+  // Get the shard which the id belongs to.
+  size_t ShardIndex(const int64_t id) const {
+    return shards_.size() == 1 ? 0 : static_cast<size_t>(static_cast<uint64_t>(id) % shards_.size());
+  }
+  size_t shard_num() const { return shards_.size(); }
+
+  // Get the number of ids in the hash map.
+  size_t id_num() const;
+
+  // Traverse all the id -> index mappings, it must not be called concurrently with ParseData.
+  template <typename Func>
+  void ForEach(Func &&func) const {
+    for (const auto &shard : shards_) {
+      shard->hash_id_to_index_.ForEach(func);
+    }
+  }
+
   // Get the global step of a element in hash map.
   size_t hash_step(const int hash_index) const { return hash_map_elements_[IntToSize(hash_index)].step_; }
   // Set the global step of a element in hash map.
@@ -78,8 +98,16 @@ class EmbeddingHashMap {
     hash_map_elements_[IntToSize(hash_index)].set_step(step);
   }
 
-  // Get the id -> index mapping.
-  const mindspore::HashMap<int, int> &hash_id_to_index() const { return hash_id_to_index_; }
+  // Record the access of the element in a new step to the eviction policy. The elements of the same shard must not be
+  // recorded concurrently, the same as ParseData.
+  void RecordAccess(const int hash_index) {
+    auto &policy = shards_[ShardIndex(hash_map_elements_[IntToSize(hash_index)].id_)]->policy_;
+    if (policy != nullptr) {
+      policy->Access(hash_index);
+    }
+  }
+
+  EmbeddingCachePolicyType policy_type() const { return policy_type_; }
 
   // Get capacity of hash map.
   size_t hash_capacity() const { return hash_capacity_; }
@@ -90,11 +118,60 @@ class EmbeddingHashMap {
   void DumpHashMap();
 
  private:
-  // Find the insertion position (index) in the hash map for an id.
-  int FindInsertionPos(const size_t data_step, const size_t graph_running_step, bool *const need_swap,
-                       bool *const need_wait_graph);
-
-  // Statistics on the usage of hash map capacity.
+  // The shard owns the indices in range [begin_pos_, end_pos_), and records the cursor of finding insertion position.
+  struct Shard {
+    Shard(size_t begin_pos, size_t end_pos, EmbeddingCachePolicyType policy_type)
+        : begin_pos_(begin_pos),
+          end_pos_(end_pos),
+          current_pos_(begin_pos),
+          current_batch_start_pos_(begin_pos),
+          hash_id_to_index_(end_pos - begin_pos),
+          policy_(CreateEmbeddingCachePolicy(policy_type, begin_pos, end_pos)),
+          empty_pos_(begin_pos) {
+      graph_running_index_ = std::make_unique<int[]>(end_pos - begin_pos);
+    }
+
+    size_t begin_pos_;
+    size_t end_pos_;
+
+    // Statistics on the usage of shard capacity.
+    size_t hash_count_{0};
+
+    // The cursor that records the current slot.
+    size_t current_pos_;
+    // The cursor that records the start position of current_pos_.
+    size_t current_batch_start_pos_;
+
+    // The number of ids which need to wait for the calculation graph to finish executing the current step and need be
+    // swapped out.
+    size_t graph_running_index_num_{0};
+    // The index in array 'graph_running_index_', and the value on this index is the hash index for new id,
+    // but need to wait for the calculation graph to finish executing the current step and swap out the expired data.
+    size_t graph_running_index_pos_{0};
+    // Record the index information of the feature id that needs to be swapped out after the calculation graph finishes
+    // executing the current step.
+    std::unique_ptr<int[]> graph_running_index_;
+
+    // The flag indicates shard is full.
+    bool expired_element_full_{false};
+
+    // The id -> index mapping of the ids in this shard.
+    EmbeddingIdIndexMap hash_id_to_index_;
+
+    // The eviction policy, which is nullptr for kStepExpiry.
+    std::unique_ptr<EmbeddingCachePolicy> policy_;
+    // The cursor to find the empty positions which are used before any eviction when the policy is set.
+    size_t empty_pos_;
+  };
+
+  // Find the insertion position (index) in the shard for an id.
+  int FindInsertionPos(Shard *const shard, const size_t data_step, const size_t graph_running_step,
+                       bool *const need_swap, bool *const need_wait_graph);
+  // Find the insertion position (index) in the shard for an id by the eviction policy of the shard.
+  int FindInsertionPosByPolicy(Shard *const shard, const int64_t id, const size_t graph_running_step,
+                               bool *const need_swap, bool *const need_wait_graph);
+
+  // The initial statistics on the usage of hash map capacity.
   size_t hash_count_;
 
   // The hash map capacity.
@@ -103,26 +180,11 @@ class EmbeddingHashMap {
   // Record all elements in this hash map.
   std::vector<HashMapElement> hash_map_elements_;
 
-  // The id -> index mapping.
-  mindspore::HashMap<int, int> hash_id_to_index_;
-
-  // The cursor that records the current slot.
-  size_t current_pos_;
-  // The cursor that records the start position of current_pos_.
-  size_t current_batch_start_pos_;
-
-  // The number of ids which need to wait for the calculation graph to finish executing the current step and need be
-  // swapped out.
-  size_t graph_running_index_num_;
-  // The index in array 'graph_running_index_', and the value on this index is the hash index for new id,
-  // but need to wait for the calculation graph to finish executing the current step and swap out the expired data.
-  size_t graph_running_index_pos_;
-  // Record the index information of the feature id that needs to be swapped out after the calculation graph finishes
-  // executing the current step.
-  std::unique_ptr<int[]> graph_running_index_;
-
-  // The flag indicates hash map is full.
-  bool expired_element_full_;
+  // The eviction policy type of all the shards.
+  EmbeddingCachePolicyType policy_type_;
+
+  // The shards of hash map.
+  std::vector<std::unique_ptr<Shard>> shards_;
 };
 }  // namespace distributed
 }  // namespace mindspore
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/embedding_cache/embedding_host_optimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "utils/log_adapter.h"
+#include "utils/convert_utils_base.h"
+
+namespace mindspore {
+namespace distributed {
+void ApplyAdamZeroGradSteps(float *var, float *m, float *v, size_t size, const AdamHyperParams &params,
+                            uint64_t begin_step, uint64_t end_step) {
+  MS_EXCEPTION_IF_NULL(var);
+  MS_EXCEPTION_IF_NULL(m);
+  MS_EXCEPTION_IF_NULL(v);
+  const double beta1 = params.beta1;
+  const double beta2 = params.beta2;
+  double m_decay = 1;
+  uint64_t step = begin_step;
+  for (; step < end_step && m_decay >= std::numeric_limits<float>::epsilon(); ++step) {
+    auto step_num = static_cast<double>(step);
+    auto lr =
+      static_cast<float>(params.lr * std::sqrt(1 - std::pow(beta2, step_num)) / (1 - std::pow(beta1, step_num)));
+    for (size_t i = 0; i < size; ++i) {
+      m[i] *= params.beta1;
+      v[i] *= params.beta2;
+      var[i] -= lr * m[i] / (std::sqrt(v[i]) + params.epsilon);
+    }
+    m_decay *= beta1;
+  }
+  if (step == end_step) {
+    return;
+  }
+  auto rest_steps = static_cast<double>(end_step - step);
+  auto m_rest_decay = static_cast<float>(std::pow(beta1, rest_steps));
+  auto v_rest_decay = static_cast<float>(std::pow(beta2, rest_steps));
+  for (size_t i = 0; i < size; ++i) {
+    m[i] *= m_rest_decay;
+    v[i] *= v_rest_decay;
+  }
+}
+
+void EmbeddingHostOptimizer::AddAdamTable(float *var, float *m, float *v, size_t embedding_size,
+                                          const AdamHyperParams &params) {
+  MS_EXCEPTION_IF_NULL(var);
+  MS_EXCEPTION_IF_NULL(m);
+  MS_EXCEPTION_IF_NULL(v);
+  // The table may be added by each compiling of the graph.
+  auto is_added = [var](const AdamTable &table) { return table.var == var; };
+  if (std::any_of(adam_tables_.begin(), adam_tables_.end(), is_added)) {
+    return;
+  }
+  (void)adam_tables_.emplace_back(AdamTable{var, m, v, embedding_size, params});
+}
+
+void EmbeddingHostOptimizer::RecordSwapOut(const int64_t *ids, size_t ids_num, uint64_t step) {
+  if (adam_tables_.empty()) {
+    return;
+  }
+  MS_EXCEPTION_IF_NULL(ids);
+  for (size_t i = 0; i < ids_num; ++i) {
+    swap_out_steps_[ids[i]] = step;
+  }
+}
+
+bool EmbeddingHostOptimizer::ApplyMissedSteps(const int64_t *ids, const int *host_indices, size_t ids_num,
+                                              uint64_t step) {
+  if (adam_tables_.empty()) {
+    return true;
+  }
+  MS_ERROR_IF_NULL(ids);
+  MS_ERROR_IF_NULL(host_indices);
+  for (size_t i = 0; i < ids_num; ++i) {
+    auto iter = swap_out_steps_.find(ids[i]);
+    if (iter == swap_out_steps_.end()) {
+      continue;
+    }
+    auto swap_out_step = iter->second;
+    (void)swap_out_steps_.erase(iter);
+    if (swap_out_step >= step) {
+      continue;
+    }
+    if (host_indices[i] < 0) {
+      MS_LOG(ERROR) << "Invalid local host cache index: " << host_indices[i] << " of id: " << ids[i];
+      return false;
+    }
+    auto index = IntToSize(host_indices[i]);
+    for (const auto &table : adam_tables_) {
+      auto offset = index * table.embedding_size;
+      ApplyAdamZeroGradSteps(table.var + offset, table.m + offset, table.v + offset, table.embedding_size,
+                             table.params, swap_out_step, step);
+    }
+  }
+  return true;
+}
+}  // namespace distributed
+}  // namespace mindspore
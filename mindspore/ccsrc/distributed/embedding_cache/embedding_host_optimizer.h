@@ -0,0 +1,84 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HOST_OPTIMIZER_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HOST_OPTIMIZER_H_
+
+#include <cstdint>
+#include <vector>
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace distributed {
+// The hyper parameters of the Adam optimizer, which keep constant during training.
+struct AdamHyperParams {
+  float lr{0};
+  float beta1{0};
+  float beta2{0};
+  float epsilon{0};
+};
+
+// Apply the Adam steps [begin_step, end_step) with zero gradient to a row of var, m and v in one pass, as FusedSparseAdam
+// does for the rows without gradient: m and v decay, and var keeps being updated by the decayed moments. The step k uses
+// the beta powers beta1^k and beta2^k. The loop stops once m decays below the float precision, and the rest steps only
+// decay m and v since their updates of var are negligible.
+BACKEND_EXPORT void ApplyAdamZeroGradSteps(float *var, float *m, float *v, size_t size, const AdamHyperParams &params,
+                                           uint64_t begin_step, uint64_t end_step);
+
+// The host optimizer of the embedding cache. The optimizer on the device only updates the rows in the device cache, so
+// the rows swapped out to the local host cache miss the Adam steps, in which they have no gradient but their moments
+// still decay. The host optimizer records the step at which an id is swapped out of the device cache, and applies the
+// missed steps to the rows of the unique ids swapped into the device cache during prefetching, so the host tables are
+// never updated in full and the update work scales with the unique ids swapped in each step.
+// The FTRL optimizer needs no host update, since a step with zero gradient keeps its accum, linear and var unchanged.
+class BACKEND_EXPORT EmbeddingHostOptimizer {
+ public:
+  EmbeddingHostOptimizer() = default;
+  ~EmbeddingHostOptimizer() = default;
+
+  // Add the local host cache of the var, m and v updated by Adam, whose rows have embedding_size elements.
+  void AddAdamTable(float *var, float *m, float *v, size_t embedding_size, const AdamHyperParams &params);
+
+  bool empty() const { return adam_tables_.empty(); }
+
+  // Record the ids swapped out of the device cache while preparing the data of the step, which is the first step they
+  // miss.
+  void RecordSwapOut(const int64_t *ids, size_t ids_num, uint64_t step);
+
+  // Apply the missed steps before the step to the rows of the ids in the local host cache, whose indices are
+  // host_indices. The ids which have never been swapped out of the device cache have missed no step.
+  bool ApplyMissedSteps(const int64_t *ids, const int *host_indices, size_t ids_num, uint64_t step);
+
+ private:
+  DISABLE_COPY_AND_ASSIGN(EmbeddingHostOptimizer);
+
+  struct AdamTable {
+    float *var;
+    float *m;
+    float *v;
+    size_t embedding_size;
+    AdamHyperParams params;
+  };
+  std::vector<AdamTable> adam_tables_;
+
+  // The step at which each id out of the device cache was swapped out.
+  HashMap<int64_t, uint64_t> swap_out_steps_;
+};
+}  // namespace distributed
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HOST_OPTIMIZER_H_
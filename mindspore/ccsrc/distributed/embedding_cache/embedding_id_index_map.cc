@@ -0,0 +1,164 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/embedding_cache/embedding_id_index_map.h"
+#include <vector>
+#include <utility>
+
+namespace mindspore {
+namespace distributed {
+EmbeddingIdIndexMap::EmbeddingIdIndexMap(size_t max_size) {
+  // Keep the load factor no more than 0.5 to make the probe sequence short.
+  size_t min_group_num = (max_size * 2 + kSlotGroupSize - 1) / kSlotGroupSize;
+  group_num_ = 1;
+  while (group_num_ < min_group_num) {
+    group_num_ <<= 1;
+  }
+  group_mask_ = group_num_ - 1;
+  groups_ = std::make_unique<SlotGroup[]>(group_num_);
+  ResetSlots();
+}
+
+void EmbeddingIdIndexMap::ResetSlots() {
+  for (size_t i = 0; i < group_num_; ++i) {
+    for (size_t j = 0; j < kSlotGroupSize; ++j) {
+      groups_[i].ids_[j].store(kEmptyId, std::memory_order_relaxed);
+      groups_[i].indices_[j].store(INVALID_INDEX_VALUE, std::memory_order_relaxed);
+    }
+  }
+  size_.store(0, std::memory_order_release);
+  deleted_num_ = 0;
+}
+
+int EmbeddingIdIndexMap::Find(int64_t id) const {
+  auto group_index = HashGroup(id);
+  for (size_t probe = 0; probe < group_num_; ++probe) {
+    const auto &group = groups_[group_index];
+    for (size_t j = 0; j < kSlotGroupSize; ++j) {
+      auto slot_id = group.ids_[j].load(std::memory_order_acquire);
+      if (slot_id == id) {
+        auto index = group.indices_[j].load(std::memory_order_acquire);
+        // The slot may be erased and reused by the writer during reading the index.
+        if (group.ids_[j].load(std::memory_order_acquire) == id) {
+          return index;
+        }
+        return INVALID_INDEX_VALUE;
+      }
+      if (slot_id == kEmptyId) {
+        return INVALID_INDEX_VALUE;
+      }
+    }
+    group_index = (group_index + 1) & group_mask_;
+  }
+  return INVALID_INDEX_VALUE;
+}
+
+void EmbeddingIdIndexMap::Find(const int64_t *ids, size_t ids_num, int *indices) const {
+  MS_EXCEPTION_IF_NULL(ids);
+  MS_EXCEPTION_IF_NULL(indices);
+  constexpr size_t kPrefetchDistance = 8;
+  for (size_t i = 0; i < ids_num; ++i) {
+    // Prefetch the group of the later id to hide the cache miss latency of random access.
+    if (i + kPrefetchDistance < ids_num) {
+      __builtin_prefetch(&groups_[HashGroup(ids[i + kPrefetchDistance])]);
+    }
+    indices[i] = Find(ids[i]);
+  }
+}
+
+bool EmbeddingIdIndexMap::Insert(int64_t id, int index) {
+  if (id == kEmptyId || id == kDeletedId) {
+    MS_LOG(EXCEPTION) << "The id " << id << " is reserved and can not be inserted to the embedding cache.";
+  }
+  std::atomic<int64_t> *deleted_slot = nullptr;
+  std::atomic<int> *deleted_slot_index = nullptr;
+  auto group_index = HashGroup(id);
+  for (size_t probe = 0; probe < group_num_; ++probe) {
+    auto &group = groups_[group_index];
+    for (size_t j = 0; j < kSlotGroupSize; ++j) {
+      auto slot_id = group.ids_[j].load(std::memory_order_relaxed);
+      if (slot_id == id) {
+        group.indices_[j].store(index, std::memory_order_release);
+        return true;
+      }
+      if (slot_id == kDeletedId && deleted_slot == nullptr) {
+        deleted_slot = &group.ids_[j];
+        deleted_slot_index = &group.indices_[j];
+        continue;
+      }
+      if (slot_id == kEmptyId) {
+        if (deleted_slot == nullptr) {
+          group.indices_[j].store(index, std::memory_order_relaxed);
+          group.ids_[j].store(id, std::memory_order_release);
+        } else {
+          // Reuse the deleted slot in front of the probe sequence.
+          deleted_slot_index->store(index, std::memory_order_relaxed);
+          deleted_slot->store(id, std::memory_order_release);
+          --deleted_num_;
+        }
+        (void)size_.fetch_add(1, std::memory_order_release);
+        return true;
+      }
+    }
+    group_index = (group_index + 1) & group_mask_;
+  }
+
+  if (deleted_slot == nullptr) {
+    MS_LOG(WARNING) << "The embedding id index map is full, size: " << size() << ", slot number: " << slot_num();
+    return false;
+  }
+  deleted_slot_index->store(index, std::memory_order_relaxed);
+  deleted_slot->store(id, std::memory_order_release);
+  --deleted_num_;
+  (void)size_.fetch_add(1, std::memory_order_release);
+  return true;
+}
+
+bool EmbeddingIdIndexMap::Erase(int64_t id) {
+  auto group_index = HashGroup(id);
+  for (size_t probe = 0; probe < group_num_; ++probe) {
+    auto &group = groups_[group_index];
+    for (size_t j = 0; j < kSlotGroupSize; ++j) {
+      auto slot_id = group.ids_[j].load(std::memory_order_relaxed);
+      if (slot_id == id) {
+        group.ids_[j].store(kDeletedId, std::memory_order_release);
+        ++deleted_num_;
+        (void)size_.fetch_sub(1, std::memory_order_release);
+        return true;
+      }
+      if (slot_id == kEmptyId) {
+        return false;
+      }
+    }
+    group_index = (group_index + 1) & group_mask_;
+  }
+  return false;
+}
+
+void EmbeddingIdIndexMap::Rehash() {
+  if (deleted_num_ == 0) {
+    return;
+  }
+  std::vector<std::pair<int64_t, int>> id_indices;
+  id_indices.reserve(size());
+  ForEach([&id_indices](int64_t id, int index) { (void)id_indices.emplace_back(id, index); });
+  ResetSlots();
+  for (const auto &id_index : id_indices) {
+    (void)Insert(id_index.first, id_index.second);
+  }
+}
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_ID_INDEX_MAP_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_ID_INDEX_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+// Define the value of an invalid index.
+static constexpr int INVALID_INDEX_VALUE = -1;
+
+// EmbeddingIdIndexMap is an open addressing hash map used to manage the id -> index mapping of the embedding cache.
+// The slots are grouped by cache line and the groups are probed linearly, so looking up an id usually touches only one
+// cache line. The capacity is fixed at construction, because the number of ids in the embedding cache never exceeds
+// the cache size, and the table is never reallocated.
+// Only one thread is allowed to modify the map at the same time, while the other threads can look up concurrently: the
+// index of a slot is written before the id is published by a release store, and an erased slot is marked as deleted
+// instead of empty, which keeps the probe sequence of the other ids.
+class EmbeddingIdIndexMap {
+ public:
+  explicit EmbeddingIdIndexMap(size_t max_size);
+  ~EmbeddingIdIndexMap() = default;
+  EmbeddingIdIndexMap(const EmbeddingIdIndexMap &) = delete;
+  EmbeddingIdIndexMap &operator=(const EmbeddingIdIndexMap &) = delete;
+
+  // Find the index of the id, return INVALID_INDEX_VALUE if the id is not in the map. Thread safe.
+  int Find(int64_t id) const;
+
+  // Find the indices of a batch of ids, the index of the id not in the map is INVALID_INDEX_VALUE. Thread safe.
+  void Find(const int64_t *ids, size_t ids_num, int *indices) const;
+
+  // Insert the id -> index mapping, or update the index if the id exists. Return false if the map is full.
+  bool Insert(int64_t id, int index);
+
+  // Erase the id, return false if the id is not in the map.
+  bool Erase(int64_t id);
+
+  // Rebuild the table to clean up the deleted slots. It must not be called concurrently with the readers.
+  void Rehash();
+
+  // Traverse all the id -> index mappings. It must not be called concurrently with the writer.
+  template <typename Func>
+  void ForEach(Func &&func) const {
+    for (size_t i = 0; i < group_num_; ++i) {
+      for (size_t j = 0; j < kSlotGroupSize; ++j) {
+        int64_t id = groups_[i].ids_[j].load(std::memory_order_relaxed);
+        if (id != kEmptyId && id != kDeletedId) {
+          func(id, groups_[i].indices_[j].load(std::memory_order_relaxed));
+        }
+      }
+    }
+  }
+
+  size_t size() const { return size_.load(std::memory_order_acquire); }
+  size_t deleted_num() const { return deleted_num_; }
+  size_t slot_num() const { return group_num_ * kSlotGroupSize; }
+
+ private:
+  // The ids of empty and deleted slots, which are not valid feature ids.
+  static constexpr int64_t kEmptyId = INT64_MIN;
+  static constexpr int64_t kDeletedId = INT64_MIN + 1;
+  // The number of slots in a group, the ids and indices of a group fit in a cache line of 64 bytes.
+  static constexpr size_t kSlotGroupSize = 5;
+
+  struct alignas(64) SlotGroup {
+    std::atomic<int64_t> ids_[kSlotGroupSize];
+    std::atomic<int> indices_[kSlotGroupSize];
+  };
+
+  // The group index where the probe sequence of the id starts.
+  size_t HashGroup(int64_t id) const {
+    constexpr uint64_t kGoldenRatio = 0x9E3779B97F4A7C15ULL;
+    auto hash = static_cast<uint64_t>(id) * kGoldenRatio;
+    return static_cast<size_t>(hash ^ (hash >> 32)) & group_mask_;
+  }
+
+  void ResetSlots();
+
+  size_t group_num_;
+  size_t group_mask_;
+  std::unique_ptr<SlotGroup[]> groups_;
+
+  // The number of the ids in the map.
+  std::atomic<size_t> size_{0};
+  // The number of the deleted slots, which are reused by the later insertion and cleaned up by Rehash.
+  size_t deleted_num_{0};
+};
+}  // namespace distributed
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_ID_INDEX_MAP_H_
@@ -38,6 +38,22 @@ bool Block::CheckSha256Seq() const {
   }
   return true;
 }
+
+void Block::GenDeltaSha256Seq(size_t delta_index) const {
+  std::string sha256_cal = system::sha256::GetHashFromFile(delta_file_name(delta_index));
+  MS_EXCEPTION_IF_NULL(block_meta_);
+  block_meta_->Insert(kDeltaHashSeqPrefix + std::to_string(delta_index), sha256_cal);
+}
+
+bool Block::CheckDeltaSha256Seq(size_t delta_index) const {
+  MS_EXCEPTION_IF_NULL(block_meta_);
+  std::string sha256_gen = block_meta_->Get<std::string>(kDeltaHashSeqPrefix + std::to_string(delta_index));
+  if (sha256_gen != system::sha256::GetHashFromFile(delta_file_name(delta_index))) {
+    MS_LOG(ERROR) << "The delta file has been modified, file name: " << delta_file_name(delta_index);
+    return false;
+  }
+  return true;
+}
 }  // namespace storage
 }  // namespace distributed
 }  // namespace mindspore
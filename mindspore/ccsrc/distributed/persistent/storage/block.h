@@ -21,6 +21,7 @@
 #include <string>
 
 #include "distributed/persistent/storage/json_utils.h"
+#include "distributed/persistent/storage/constants.h"
 #include "nlohmann/json.hpp"
 
 namespace mindspore {
@@ -44,6 +45,15 @@ class Block {
   // Check sha256 hash sequence.
   bool CheckSha256Seq() const;
 
+  // Generate and check the sha256 hash sequence of the delta file.
+  void GenDeltaSha256Seq(size_t delta_index) const;
+  bool CheckDeltaSha256Seq(size_t delta_index) const;
+
+  // Get the file path of the delta file which records the dirty rows of the block.
+  std::string delta_file_name(size_t delta_index) const {
+    return block_file_name_ + kDeltaFileInfix + std::to_string(delta_index);
+  }
+
   // Set the block meta pointer associated with the block file.
   void set_block_meta(const std::shared_ptr<BlockMeta> &block_meta) { block_meta_ = block_meta; }
 
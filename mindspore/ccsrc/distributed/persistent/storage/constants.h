@@ -29,15 +29,25 @@ constexpr char kShardShape[] = "shard_shape";
 constexpr char kShardRangeLowerBound[] = "shard_range_lower_bound";
 constexpr char kShardRangeUpperBound[] = "shard_range_upper_bound";
 constexpr char kHashSeq[] = "hash_seq";
+constexpr char kTensorNum[] = "tensor_num";
+// The number of delta files of a block, and the row number and hash sequence of each delta file.
+constexpr char kDeltaNum[] = "delta_num";
+constexpr char kDeltaRowNumPrefix[] = "delta_row_num_";
+constexpr char kDeltaHashSeqPrefix[] = "delta_hash_seq_";
 
 constexpr char kBlockFilePrefix[] = "block_";
 constexpr char kBlockMetaFilePrefix[] = "block_meta_";
+constexpr char kDeltaFileInfix[] = "_delta_";
 constexpr char kJsonSuffix[] = ".json";
 constexpr size_t JSON_SUFFIX_LENS = 5;
 
 // Storage config related.
 constexpr char kFileStoragePath[] = "file_storage_path";
 constexpr char kMaxBlockLength[] = "max_block_length";
+// Only the dirty rows are written to the delta files of block in incremental mode, and the delta files of a block are
+// compacted to the block file when the number reaches 'max_delta_num'.
+constexpr char kIncrementalPersist[] = "incremental_persist";
+constexpr char kMaxDeltaNum[] = "max_delta_num";
 }  // namespace storage
 }  // namespace distributed
 }  // namespace mindspore
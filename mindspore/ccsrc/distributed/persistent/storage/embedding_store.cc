@@ -0,0 +1,160 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/persistent/storage/embedding_store.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+#include "distributed/persistent/storage/file_io_utils.h"
+#include "utils/convert_utils_base.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+EmbeddingStore::EmbeddingStore(const std::string &file_path, size_t value_length, size_t max_segment_length)
+    : file_path_(file_path), value_length_(value_length) {
+  if (value_length_ == 0) {
+    MS_LOG(EXCEPTION) << "The value length of embedding store can not be zero.";
+  }
+  slots_per_segment_ = std::max(max_segment_length / value_length_, static_cast<size_t>(1));
+}
+
+EmbeddingStore::~EmbeddingStore() { Finalize(); }
+
+void EmbeddingStore::Initialize() {
+  if (!FileIOUtils::IsFileOrDirExist(file_path_)) {
+    FileIOUtils::CreateDirRecursive(file_path_);
+  }
+  MS_LOG(INFO) << "Initialize embedding store in " << file_path_ << ", value length: " << value_length_
+               << ", slots per segment: " << slots_per_segment_;
+}
+
+void EmbeddingStore::Finalize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < segments_.size(); ++i) {
+    if (segments_[i] == nullptr) {
+      continue;
+    }
+    segments_[i]->close();
+    auto file_name = file_path_ + "/" + kSegmentFilePrefix + std::to_string(i);
+    if (std::remove(file_name.c_str()) != 0) {
+      MS_LOG(WARNING) << "Remove segment file failed, file name: " << file_name;
+    }
+  }
+  segments_.clear();
+  id_to_slot_.clear();
+  next_slot_ = 0;
+}
+
+std::fstream *EmbeddingStore::GetSegment(size_t segment_index) {
+  if (segment_index >= segments_.size()) {
+    segments_.resize(segment_index + 1);
+  }
+  auto &segment = segments_[segment_index];
+  if (segment != nullptr) {
+    return segment.get();
+  }
+
+  auto file_name = file_path_ + "/" + kSegmentFilePrefix + std::to_string(segment_index);
+  segment = std::make_unique<std::fstream>();
+  // The trunc mode creates the segment file and discards the content left by the previous running.
+  segment->open(file_name, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!segment->is_open() || !segment->good()) {
+    segment = nullptr;
+    MS_LOG(ERROR) << "Open segment file failed, file name: " << file_name;
+    return nullptr;
+  }
+  return segment.get();
+}
+
+bool EmbeddingStore::Put(const int64_t *ids, size_t ids_num, const void *values) {
+  MS_ERROR_IF_NULL(ids);
+  MS_ERROR_IF_NULL(values);
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Write the values in the order of slots to reduce the random access of disk.
+  std::vector<std::pair<size_t, size_t>> slot_to_pos(ids_num);
+  for (size_t i = 0; i < ids_num; ++i) {
+    auto iter = id_to_slot_.find(ids[i]);
+    if (iter == id_to_slot_.end()) {
+      iter = id_to_slot_.emplace(ids[i], next_slot_++).first;
+    }
+    slot_to_pos[i] = {iter->second, i};
+  }
+  std::sort(slot_to_pos.begin(), slot_to_pos.end());
+
+  const char *data = reinterpret_cast<const char *>(values);
+  for (const auto &item : slot_to_pos) {
+    auto segment = GetSegment(item.first / slots_per_segment_);
+    MS_ERROR_IF_NULL(segment);
+    (void)segment->seekp(SizeToLong((item.first % slots_per_segment_) * value_length_));
+    (void)segment->write(data + item.second * value_length_, SizeToLong(value_length_));
+    if (!segment->good()) {
+      MS_LOG(ERROR) << "Write embedding store failed, id: " << ids[item.second];
+      return false;
+    }
+  }
+  return true;
+}
+
+bool EmbeddingStore::Get(const int64_t *ids, size_t ids_num, void *values, bool *found) {
+  MS_ERROR_IF_NULL(ids);
+  MS_ERROR_IF_NULL(values);
+  MS_ERROR_IF_NULL(found);
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<std::pair<size_t, size_t>> slot_to_pos;
+  for (size_t i = 0; i < ids_num; ++i) {
+    auto iter = id_to_slot_.find(ids[i]);
+    found[i] = iter != id_to_slot_.end();
+    if (found[i]) {
+      (void)slot_to_pos.emplace_back(iter->second, i);
+    }
+  }
+  std::sort(slot_to_pos.begin(), slot_to_pos.end());
+
+  char *data = reinterpret_cast<char *>(values);
+  for (const auto &item : slot_to_pos) {
+    auto segment = GetSegment(item.first / slots_per_segment_);
+    MS_ERROR_IF_NULL(segment);
+    (void)segment->seekg(SizeToLong((item.first % slots_per_segment_) * value_length_));
+    (void)segment->read(data + item.second * value_length_, SizeToLong(value_length_));
+    if (!segment->good()) {
+      MS_LOG(ERROR) << "Read embedding store failed, id: " << ids[item.second];
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<int64_t> EmbeddingStore::GetAllIds() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::vector<int64_t> ids;
+  ids.reserve(id_to_slot_.size());
+  for (const auto &item : id_to_slot_) {
+    ids.push_back(item.first);
+  }
+  return ids;
+}
+
+size_t EmbeddingStore::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return id_to_slot_.size();
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_EMBEDDING_STORE_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_EMBEDDING_STORE_H_
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+// The default maximum segment file length : 1GB.
+constexpr size_t DEFAULT_MAX_SEGMENT_LENGTH = 1UL << 30;
+constexpr char kSegmentFilePrefix[] = "segment_";
+
+// The key-value storage of the fixed length values (the embeddings of an id) on local disk, which is used as the tier
+// below the local host cache of embedding cache. The values are stored in the slots of segment files, and the index
+// of id to slot is kept in memory. The value of an existing id is overwritten in place, and the value of a new id is
+// appended to the last segment file. All the methods are thread safe.
+class EmbeddingStore {
+ public:
+  EmbeddingStore(const std::string &file_path, size_t value_length,
+                 size_t max_segment_length = DEFAULT_MAX_SEGMENT_LENGTH);
+  ~EmbeddingStore();
+
+  // Create the directory of segment files.
+  void Initialize();
+  // Close and remove all the segment files.
+  void Finalize();
+
+  // Write the values of ids, the value of the i-th id is at 'values + i * value_length'.
+  bool Put(const int64_t *ids, size_t ids_num, const void *values);
+
+  // Read the values of ids which are in the store and set 'found' of them to true, the values of other ids are not
+  // touched.
+  bool Get(const int64_t *ids, size_t ids_num, void *values, bool *found);
+
+  // Get all the ids in the store.
+  std::vector<int64_t> GetAllIds() const;
+
+  size_t size() const;
+  size_t value_length() const { return value_length_; }
+
+ private:
+  DISABLE_COPY_AND_ASSIGN(EmbeddingStore);
+
+  // Get the file stream of the segment, the segment file is created if it does not exist.
+  std::fstream *GetSegment(size_t segment_index);
+
+  std::string file_path_;
+  size_t value_length_;
+  // The number of values in a segment file.
+  size_t slots_per_segment_;
+
+  std::vector<std::unique_ptr<std::fstream>> segments_;
+  // The slot of each id, the slot is 'segment index * slots_per_segment_ + slot in the segment'.
+  mindspore::HashMap<int64_t, size_t> id_to_slot_;
+  size_t next_slot_{0};
+  mutable std::mutex mutex_;
+};
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_EMBEDDING_STORE_H_
@@ -19,6 +19,7 @@
 #include <dirent.h>
 #include <cmath>
 #include <algorithm>
+#include <cstdio>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -32,6 +33,12 @@
 namespace mindspore {
 namespace distributed {
 namespace storage {
+namespace {
+size_t GetDeltaNum(const BlockMeta &block_meta) {
+  return block_meta.Exists(kDeltaNum) ? block_meta.Get<size_t>(kDeltaNum) : 0;
+}
+}  // namespace
+
 void LocalFile::Write(const InputData &input, const DirtyInfo &dirty_info) {
   std::vector<InputData> inputs = {input};
   Write(inputs, dirty_info);
@@ -44,11 +51,23 @@ void LocalFile::Write(const std::vector<InputData> &inputs, const DirtyInfo &dir
 
   // The block file has been created, only the blocks related to the dirty information need to be rewritten.
   if (finish_create_block_files_) {
-    std::vector<int> block_indices;
-    TransformDirtyInfoToBlockIndices(dirty_info, &block_indices);
+    std::map<size_t, std::vector<int>> block_rows;
+    TransformDirtyInfoToBlockRows(dirty_info, &block_rows);
 
-    for (const auto &block_index : block_indices) {
-      WriteOneBlockFile(IntToSize(block_index), inputs);
+    for (const auto &item : block_rows) {
+      auto block_index = item.first;
+      const auto &rows = item.second;
+      const auto &block_meta_ptr = block_meta_list_.at(block_index);
+      MS_EXCEPTION_IF_NULL(block_meta_ptr);
+      size_t block_row_num =
+        block_meta_ptr->Get<size_t>(kShardRangeUpperBound) - block_meta_ptr->Get<size_t>(kShardRangeLowerBound);
+      // The whole block is rewritten when most of the rows are dirty or the delta files reach the maximum number, and
+      // the delta files are compacted to the new block file.
+      if (!incremental_persist_ || rows.size() * 2 >= block_row_num || GetDeltaNum(*block_meta_ptr) >= max_delta_num_) {
+        WriteOneBlockFile(block_index, inputs);
+      } else {
+        WriteOneDeltaFile(block_index, rows, inputs);
+      }
     }
     return;
   }
@@ -57,41 +76,39 @@ void LocalFile::Write(const std::vector<InputData> &inputs, const DirtyInfo &dir
   WriteBlockFiles(inputs);
 }
 
-void LocalFile::TransformDirtyInfoToBlockIndices(const DirtyInfo &dirty_info, std::vector<int> *block_indices) const {
-  MS_EXCEPTION_IF_NULL(block_indices);
+void LocalFile::TransformDirtyInfoToBlockRows(const DirtyInfo &dirty_info,
+                                              std::map<size_t, std::vector<int>> *block_rows) const {
+  MS_EXCEPTION_IF_NULL(block_rows);
   if (block_meta_list_.empty()) {
     MS_LOG(EXCEPTION) << "The block meta list is empty";
   }
 
+  // The dirty info is accumulated by the updates, which may be unsorted and duplicated.
+  DirtyInfo sorted_dirty_info = dirty_info;
+  std::sort(sorted_dirty_info.begin(), sorted_dirty_info.end());
+  (void)sorted_dirty_info.erase(std::unique(sorted_dirty_info.begin(), sorted_dirty_info.end()),
+                                sorted_dirty_info.end());
+
   size_t block_index = 0;
-  bool block_index_alread_insert_vec = false;
   auto block_meta_ptr = block_meta_list_.at(block_index);
   MS_EXCEPTION_IF_NULL(block_meta_ptr);
   int cur_lower_bound = block_meta_ptr->Get<int>(kShardRangeLowerBound);
   int cur_upper_bound = block_meta_ptr->Get<int>(kShardRangeUpperBound);
 
-  for (const auto &dirty_value : dirty_info) {
-    if (dirty_value >= cur_lower_bound && dirty_value < cur_upper_bound) {
-      if (!block_index_alread_insert_vec) {
-        block_index_alread_insert_vec = true;
-        block_indices->push_back(block_index);
-      }
-      continue;
-    }
-
-    while (!(dirty_value >= cur_lower_bound && dirty_value < cur_upper_bound)) {
+  for (const auto &dirty_value : sorted_dirty_info) {
+    while (dirty_value >= cur_upper_bound) {
       if (++block_index >= block_meta_list_.size()) {
-        break;
+        return;
       }
       block_meta_ptr = block_meta_list_[block_index];
       MS_EXCEPTION_IF_NULL(block_meta_ptr);
       cur_lower_bound = block_meta_ptr->Get<int>(kShardRangeLowerBound);
       cur_upper_bound = block_meta_ptr->Get<int>(kShardRangeUpperBound);
     }
-
-    if (block_index < block_meta_list_.size()) {
-      block_indices->push_back(block_index);
+    if (dirty_value < cur_lower_bound) {
+      continue;
     }
+    (*block_rows)[block_index].push_back(dirty_value - cur_lower_bound);
   }
 }
 
@@ -141,6 +158,9 @@ void LocalFile::WriteBlockFiles(const std::vector<InputData> &inputs) {
     size_t field_length = (cur_upper_bound - cur_lower_bound) * non_first_dims_size;
     block_meta_ptr->Insert(kFieldsLength, field_length);
     block_meta_ptr->Insert(kOffset, offset);
+    block_meta_ptr->Insert(kTensorNum, tensor_num);
+    // The delta files left by the previous running are discarded.
+    block_meta_ptr->Insert(kDeltaNum, static_cast<size_t>(0));
     offset += field_length;
     block_meta_list_.push_back(block_meta_ptr);
 
@@ -182,6 +202,113 @@ void LocalFile::WriteOneBlockFile(size_t block_index, const std::vector<InputDat
 
   // Generate sha256 hash sequence.
   block_ptr->GenSha256Seq();
+
+  // The delta files have been merged to the new block file.
+  RemoveDeltaFiles(block_index);
+}
+
+void LocalFile::WriteOneDeltaFile(size_t block_index, const std::vector<int> &rows,
+                                  const std::vector<InputData> &inputs) const {
+  const auto &block_meta_ptr = block_meta_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_meta_ptr);
+  size_t field_size = block_meta_ptr->Get<size_t>(kFieldsLength);
+  size_t offset = block_meta_ptr->Get<size_t>(kOffset);
+  size_t block_row_num =
+    block_meta_ptr->Get<size_t>(kShardRangeUpperBound) - block_meta_ptr->Get<size_t>(kShardRangeLowerBound);
+  size_t row_size = field_size / block_row_num;
+
+  // The delta file consists of the dirty rows and the data of these rows of each input.
+  std::vector<char> delta_data(rows.size() * row_size * inputs.size());
+  char *dest = delta_data.data();
+  for (const auto &input : inputs) {
+    const char *block_data = reinterpret_cast<const char *>(std::get<1>(input)) + offset;
+    for (const auto &row : rows) {
+      dest = std::copy_n(block_data + IntToSize(row) * row_size, row_size, dest);
+    }
+  }
+
+  const auto &block_ptr = block_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_ptr);
+  size_t delta_index = GetDeltaNum(*block_meta_ptr);
+  std::string delta_file_name = block_ptr->delta_file_name(delta_index);
+  std::vector<std::pair<const void *, size_t>> delta_inputs = {{rows.data(), rows.size() * sizeof(int)},
+                                                              {delta_data.data(), delta_data.size()}};
+  if (!FileIOUtils::Write(delta_file_name, delta_inputs)) {
+    MS_LOG(EXCEPTION) << "Write to delta file[" << delta_file_name << "] failed.";
+  }
+  ChangeFileMode(delta_file_name, S_IRWXU | S_IRWXG | S_IRWXO);
+
+  block_meta_ptr->Insert(kDeltaRowNumPrefix + std::to_string(delta_index), rows.size());
+  block_ptr->GenDeltaSha256Seq(delta_index);
+  // The delta file takes effect after the delta number is updated, so an interrupted writing leaves no partial delta.
+  block_meta_ptr->Insert(kDeltaNum, delta_index + 1);
+}
+
+void LocalFile::RemoveDeltaFiles(size_t block_index) const {
+  const auto &block_meta_ptr = block_meta_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_meta_ptr);
+  size_t delta_num = GetDeltaNum(*block_meta_ptr);
+  if (delta_num == 0) {
+    return;
+  }
+
+  // Discard the delta files in the block meta firstly, so that they are never applied to the new block file.
+  block_meta_ptr->Insert(kDeltaNum, static_cast<size_t>(0));
+  const auto &block_ptr = block_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_ptr);
+  for (size_t delta_index = 0; delta_index < delta_num; ++delta_index) {
+    std::string delta_file_name = block_ptr->delta_file_name(delta_index);
+    if (std::remove(delta_file_name.c_str()) != 0) {
+      MS_LOG(WARNING) << "Remove delta file failed, file name [" << delta_file_name << "]";
+    }
+  }
+}
+
+void LocalFile::ReadOneBlockFile(size_t block_index, size_t tensor_num, std::vector<char> *block_data) const {
+  MS_EXCEPTION_IF_NULL(block_data);
+  const auto &block_meta_ptr = block_meta_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_meta_ptr);
+  size_t field_size = block_meta_ptr->Get<size_t>(kFieldsLength);
+  block_data->resize(field_size * tensor_num);
+
+  const auto &block_ptr = block_list_.at(block_index);
+  MS_EXCEPTION_IF_NULL(block_ptr);
+  if (!block_ptr->CheckSha256Seq()) {
+    MS_LOG(EXCEPTION) << "CheckSha256 failed, file name [" << block_ptr->block_file_name() << "]";
+  }
+  std::vector<std::pair<void *, size_t>> block_output_data = {{block_data->data(), block_data->size()}};
+  if (!FileIOUtils::Read(block_ptr->block_file_name(), block_output_data)) {
+    MS_LOG(EXCEPTION) << "Read block file failed, file name [" << block_ptr->block_file_name() << "]";
+  }
+
+  // Apply the delta files in the order of writing.
+  size_t block_row_num =
+    block_meta_ptr->Get<size_t>(kShardRangeUpperBound) - block_meta_ptr->Get<size_t>(kShardRangeLowerBound);
+  size_t row_size = field_size / block_row_num;
+  size_t delta_num = GetDeltaNum(*block_meta_ptr);
+  for (size_t delta_index = 0; delta_index < delta_num; ++delta_index) {
+    std::string delta_file_name = block_ptr->delta_file_name(delta_index);
+    if (!block_ptr->CheckDeltaSha256Seq(delta_index)) {
+      MS_LOG(EXCEPTION) << "CheckSha256 failed, file name [" << delta_file_name << "]";
+    }
+    size_t delta_row_num = block_meta_ptr->Get<size_t>(kDeltaRowNumPrefix + std::to_string(delta_index));
+    std::vector<int> rows(delta_row_num);
+    std::vector<char> delta_data(delta_row_num * row_size * tensor_num);
+    std::vector<std::pair<void *, size_t>> delta_output_data = {{rows.data(), rows.size() * sizeof(int)},
+                                                                {delta_data.data(), delta_data.size()}};
+    if (!FileIOUtils::Read(delta_file_name, delta_output_data)) {
+      MS_LOG(EXCEPTION) << "Read delta file failed, file name [" << delta_file_name << "]";
+    }
+
+    const char *src = delta_data.data();
+    for (size_t tensor_index = 0; tensor_index < tensor_num; ++tensor_index) {
+      char *tensor_data = block_data->data() + tensor_index * field_size;
+      for (const auto &row : rows) {
+        (void)std::copy_n(src, row_size, tensor_data + IntToSize(row) * row_size);
+        src += row_size;
+      }
+    }
+  }
 }
 
 void LocalFile::Read(const OutputData &output) {
@@ -197,29 +324,48 @@ void LocalFile::Read(const std::vector<OutputData> &outputs) {
     }
   }
 
-  // Read all block files.
+  // Read all block files and apply the delta files of them.
   for (size_t block_index = 0; block_index < block_list_.size(); ++block_index) {
-    std::vector<std::pair<void *, size_t>> block_output_data;
     const auto &block_meta_ptr = block_meta_list_[block_index];
     MS_EXCEPTION_IF_NULL(block_meta_ptr);
     size_t field_size = block_meta_ptr->Get<size_t>(kFieldsLength);
     size_t offset = block_meta_ptr->Get<size_t>(kOffset);
 
+    std::vector<char> block_data;
+    ReadOneBlockFile(block_index, outputs.size(), &block_data);
     for (size_t output_index = 0; output_index < outputs.size(); ++output_index) {
-      void *data_ptr = reinterpret_cast<char *>(std::get<0>(outputs[output_index])) + offset;
-      size_t data_size = field_size;
-      (void)block_output_data.emplace_back(data_ptr, data_size);
+      char *data_ptr = reinterpret_cast<char *>(std::get<0>(outputs[output_index])) + offset;
+      (void)std::copy_n(block_data.data() + output_index * field_size, field_size, data_ptr);
+    }
+  }
+}
+
+void LocalFile::Compact() {
+  if (block_list_.empty() || block_meta_list_.empty()) {
+    if (!LoadBlocksInfo()) {
+      MS_LOG(EXCEPTION) << "LoadBlocksInfo failed";
     }
+  }
 
-    const auto &block_ptr = block_list_[block_index];
-    MS_EXCEPTION_IF_NULL(block_ptr);
-    if (!block_ptr->CheckSha256Seq()) {
-      MS_LOG(EXCEPTION) << "CheckSha256 failed, file name [" << block_ptr->block_file_name() << "]";
+  for (size_t block_index = 0; block_index < block_list_.size(); ++block_index) {
+    const auto &block_meta_ptr = block_meta_list_[block_index];
+    MS_EXCEPTION_IF_NULL(block_meta_ptr);
+    if (GetDeltaNum(*block_meta_ptr) == 0) {
+      continue;
     }
+    size_t tensor_num = block_meta_ptr->Exists(kTensorNum) ? block_meta_ptr->Get<size_t>(kTensorNum) : 1;
+    std::vector<char> block_data;
+    ReadOneBlockFile(block_index, tensor_num, &block_data);
 
-    if (!FileIOUtils::Read(block_ptr->block_file_name(), block_output_data)) {
-      MS_LOG(EXCEPTION) << "Read block file failed, file name [" << block_ptr->block_file_name() << "]";
+    const auto &block_ptr = block_list_[block_index];
+    MS_EXCEPTION_IF_NULL(block_ptr);
+    std::vector<std::pair<const void *, size_t>> block_inputs_data = {{block_data.data(), block_data.size()}};
+    if (!FileIOUtils::Write(block_ptr->block_file_name(), block_inputs_data)) {
+      MS_LOG(EXCEPTION) << "Write to block file[" << block_ptr->block_file_name() << "] failed.";
     }
+    block_ptr->GenSha256Seq();
+    RemoveDeltaFiles(block_index);
+    MS_LOG(INFO) << "Compact the delta files of block file [" << block_ptr->block_file_name() << "]";
   }
 }
 
@@ -240,6 +386,11 @@ bool LocalFile::LoadBlocksInfo() {
       continue;
     }
 
+    // The delta files are found by the block meta.
+    if (file_name.find(kDeltaFileInfix) != std::string::npos) {
+      continue;
+    }
+
     std::string real_storage_file_path = file_path_ + "/" + file_name;
     auto suffix = file_name.substr(file_name.length() - JSON_SUFFIX_LENS);
     if (suffix == kJsonSuffix) {
@@ -32,6 +32,8 @@ namespace distributed {
 namespace storage {
 // The default maximum block length : 128MB.
 constexpr size_t DEFAULT_MAX_BLOCK_LENGTH = 128 << 20;
+// The default maximum number of delta files of a block in incremental mode.
+constexpr size_t DEFAULT_MAX_DELTA_NUM = 8;
 
 // File type persistence storage implementation class.
 class LocalFile : public StorageBase {
@@ -48,6 +50,16 @@ class LocalFile : public StorageBase {
     } else {
       max_block_length_ = DEFAULT_MAX_BLOCK_LENGTH;
     }
+
+    auto incremental_iter = storage_config.find(kIncrementalPersist);
+    if (incremental_iter != storage_config.end()) {
+      incremental_persist_ = incremental_iter->second == "true";
+    }
+
+    auto delta_num_iter = storage_config.find(kMaxDeltaNum);
+    if (delta_num_iter != storage_config.end() && !(delta_num_iter->second).empty()) {
+      max_delta_num_ = std::stoul(delta_num_iter->second);
+    }
   }
 
   ~LocalFile() override = default;
@@ -68,6 +80,10 @@ class LocalFile : public StorageBase {
   // Read data from all block files in file_path_(dir) for multiple tensors.
   void Read(const std::vector<OutputData> &outputs) override;
 
+  // Merge the delta files into the block files, which can be run offline or between the persistences to make the
+  // restoring faster.
+  void Compact();
+
  private:
   // Create blocks and block metas and write input data to block files.
   void WriteBlockFiles(const std::vector<InputData> &inputs);
@@ -75,9 +91,18 @@ class LocalFile : public StorageBase {
   // Write shardding data to one specific block file by block index and generate sha256.
   void WriteOneBlockFile(size_t block_index, const std::vector<InputData> &inputs) const;
 
-  // Obtain the corresponding file block index according to dirty info, only need to rewrite these file blocks, and
-  // dirty info needs to be sorted in ascending order.
-  void TransformDirtyInfoToBlockIndices(const DirtyInfo &dirty_info, std::vector<int> *block_indices) const;
+  // Write the dirty rows of a block to a new delta file, the rows are relative to the lower bound of the block.
+  void WriteOneDeltaFile(size_t block_index, const std::vector<int> &rows, const std::vector<InputData> &inputs) const;
+
+  // Read the block file and apply the delta files, the data of all tensors in the block are read to 'block_data'.
+  void ReadOneBlockFile(size_t block_index, size_t tensor_num, std::vector<char> *block_data) const;
+
+  // Remove the delta files of a block after the block file is rewritten.
+  void RemoveDeltaFiles(size_t block_index) const;
+
+  // Group the dirty rows by the blocks, only need to rewrite these file blocks. The rows in the block are relative
+  // to the lower bound of the block, sorted and deduplicated.
+  void TransformDirtyInfoToBlockRows(const DirtyInfo &dirty_info, std::map<size_t, std::vector<int>> *block_rows) const;
 
   // Load file list info of block files and block meta files in the 'file_path_' to block list and block meta list.
   bool LoadBlocksInfo();
@@ -97,6 +122,12 @@ class LocalFile : public StorageBase {
 
   // Indicates whether block files has been created.
   bool finish_create_block_files_{false};
+
+  // Whether only the dirty rows are written to the delta files rather than the whole blocks.
+  bool incremental_persist_{false};
+
+  // Maximum number of delta files of each block, the delta files are compacted when the number is reached.
+  size_t max_delta_num_{DEFAULT_MAX_DELTA_NUM};
 };
 }  // namespace storage
 }  // namespace distributed
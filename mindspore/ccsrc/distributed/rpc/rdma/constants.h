@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_CONSTANTS_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_CONSTANTS_H_
+
+#include <rdma/rdma_cma.h>
+#include <rdma/rdma_verbs.h>
+#include <string>
+
+#include "distributed/rpc/tcp/constants.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The size of the registered receive buffer of each connection on the server side. The client writes the whole message
+// into this buffer by one-sided RDMA write, so one message must not be larger than this size.
+constexpr size_t kRdmaRecvBufferSize = 256 << 20;
+
+// The buffer of the message meta which contains the message header, name, source and destination.
+constexpr size_t kRdmaMetaBufferSize = sizeof(MessageHeader) + MAX_KMSG_NAME_LEN + MAX_KMSG_TO_LEN + MAX_KMSG_FROM_LEN;
+
+// The max number of work requests posted for one message: the meta, the data and its zero-copy segments.
+constexpr uint32_t kRdmaMaxSendWrNum = SEND_MSG_SEGMENT_NUM + 2;
+constexpr uint32_t kRdmaMaxRecvWrNum = 4;
+
+// The max number of the cached memory regions of the data sent by client, which are deregistered all when exceeded.
+constexpr size_t kRdmaMaxCachedMemRegionNum = 256;
+
+constexpr int kRdmaListenBacklog = 1024;
+constexpr int kRdmaAcceptIntervalInMs = 10;
+
+// The registered receive buffer of the server, which is sent to the client as the private data of accepting.
+struct RdmaBufferInfo {
+  uint64_t addr{0};
+  uint32_t rkey{0};
+  uint32_t size{0};
+};
+
+// Parse the ip and port of the url in format "ip:port".
+inline bool ParseRdmaUrl(const std::string &url, std::string *ip, std::string *port) {
+  size_t index = url.rfind(':');
+  if (index == std::string::npos || index == 0 || index + 1 >= url.size()) {
+    MS_LOG(ERROR) << "Invalid rdma url " << url;
+    return false;
+  }
+  *ip = url.substr(0, index);
+  *port = url.substr(index + 1);
+  return true;
+}
+
+// The queue pair attributes of both client and server connections.
+inline struct ibv_qp_init_attr RdmaQpInitAttr() {
+  struct ibv_qp_init_attr attr = {};
+  attr.cap.max_send_wr = kRdmaMaxSendWrNum;
+  attr.cap.max_recv_wr = kRdmaMaxRecvWrNum;
+  attr.cap.max_send_sge = 1;
+  attr.cap.max_recv_sge = 1;
+  attr.qp_type = IBV_QPT_RC;
+  attr.sq_sig_all = 0;
+  return attr;
+}
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_CONSTANTS_H_
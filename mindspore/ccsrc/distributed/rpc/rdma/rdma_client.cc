@@ -0,0 +1,383 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/rpc/rdma/rdma_client.h"
+
+#include <unistd.h>
+#include <iterator>
+#include <vector>
+#include <utility>
+#include "securec/include/securec.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+RDMAClient::~RDMAClient() {
+  try {
+    Finalize();
+  } catch (const std::exception &) {
+    MS_LOG(ERROR) << "Failed to finalize the rdma client.";
+  }
+}
+
+bool RDMAClient::Initialize() {
+  std::lock_guard<std::mutex> lock(send_mutex_);
+  if (running_) {
+    return true;
+  }
+  running_ = true;
+  send_thread_ = std::thread(&RDMAClient::SendLoop, this);
+  return true;
+}
+
+void RDMAClient::Finalize() {
+  {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    running_ = false;
+  }
+  send_cond_.notify_all();
+  if (send_thread_.joinable()) {
+    send_thread_.join();
+  }
+
+  std::lock_guard<std::mutex> lock(conn_mutex_);
+  for (auto &conn : connections_) {
+    DestroyConnection(conn.second.get());
+  }
+  connections_.clear();
+}
+
+bool RDMAClient::Connect(const std::string &dst_url, size_t retry_count, const MemFreeCallback &free_cb) {
+  size_t interval = 5;
+  for (size_t i = 0; i < retry_count; ++i) {
+    auto conn = std::make_unique<RdmaClientConnection>();
+    if (ConnectImpl(dst_url, conn.get())) {
+      MS_LOG(INFO) << "Connected to the rdma server " << dst_url << " successfully.";
+      conn->free_cb = free_cb;
+      std::lock_guard<std::mutex> lock(conn_mutex_);
+      connections_[dst_url] = std::move(conn);
+      return true;
+    }
+    MS_LOG(WARNING) << "Failed to connect to the rdma server : " << dst_url << ", retry to reconnect(" << (i + 1)
+                    << "/" << retry_count << ")...";
+    DestroyConnection(conn.get());
+    sleep(interval);
+  }
+  return false;
+}
+
+bool RDMAClient::IsConnected(const std::string &dst_url) {
+  std::lock_guard<std::mutex> lock(conn_mutex_);
+  return connections_.count(dst_url) != 0;
+}
+
+bool RDMAClient::Disconnect(const std::string &dst_url, size_t) {
+  std::unique_ptr<RdmaClientConnection> conn = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(conn_mutex_);
+    auto iter = connections_.find(dst_url);
+    if (iter == connections_.end()) {
+      return true;
+    }
+    conn = std::move(iter->second);
+    (void)connections_.erase(iter);
+  }
+  std::lock_guard<std::mutex> lock(conn->mutex);
+  DestroyConnection(conn.get());
+  return true;
+}
+
+int RDMAClient::SendSync(std::unique_ptr<MessageBase> &&msg) {
+  MS_EXCEPTION_IF_NULL(msg);
+  std::string destination = msg->to.Url();
+  RdmaClientConnection *conn = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(conn_mutex_);
+    auto iter = connections_.find(destination);
+    if (iter == connections_.end()) {
+      MS_LOG(ERROR) << "Can not found remote link and send fail name: " << msg->name << ", to: " << destination;
+      return -1;
+    }
+    conn = iter->second.get();
+  }
+  std::lock_guard<std::mutex> lock(conn->mutex);
+  int send_bytes = WriteMessage(conn, msg.get());
+  // The same as tcp, the real memory of the data is released after the message is sent or dropped.
+  if (msg->data != nullptr && conn->free_cb && !conn->free_cb(msg->data)) {
+    MS_LOG(ERROR) << "Failed to free message data memory.";
+  }
+  return send_bytes;
+}
+
+void RDMAClient::SendAsync(std::unique_ptr<MessageBase> &&msg) {
+  {
+    std::lock_guard<std::mutex> lock(send_mutex_);
+    send_queue_.push(std::move(msg));
+  }
+  send_cond_.notify_one();
+}
+
+MessageBase *RDMAClient::ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t) {
+  MS_LOG(ERROR) << "The rdma client does not support receiving message from the server.";
+  return NULL_MSG;
+}
+
+void RDMAClient::SendLoop() {
+  while (true) {
+    std::unique_ptr<MessageBase> msg = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(send_mutex_);
+      send_cond_.wait(lock, [this] { return !running_ || !send_queue_.empty(); });
+      if (send_queue_.empty()) {
+        return;
+      }
+      msg = std::move(send_queue_.front());
+      send_queue_.pop();
+    }
+    (void)SendSync(std::move(msg));
+  }
+}
+
+bool RDMAClient::ConnectImpl(const std::string &dst_url, RdmaClientConnection *conn) {
+  MS_EXCEPTION_IF_NULL(conn);
+  std::string ip;
+  std::string port;
+  if (!ParseRdmaUrl(dst_url, &ip, &port)) {
+    return false;
+  }
+  struct rdma_addrinfo hints = {};
+  hints.ai_port_space = RDMA_PS_TCP;
+  struct rdma_addrinfo *addr_info = nullptr;
+  if (rdma_getaddrinfo(ip.c_str(), port.c_str(), &hints, &addr_info) != 0) {
+    MS_LOG(ERROR) << "Failed to get the rdma address of " << dst_url << ", errno: " << errno;
+    return false;
+  }
+  auto qp_attr = RdmaQpInitAttr();
+  int ret = rdma_create_ep(&conn->id, addr_info, nullptr, &qp_attr);
+  rdma_freeaddrinfo(addr_info);
+  if (ret != 0) {
+    MS_LOG(ERROR) << "Failed to create the rdma endpoint to " << dst_url << ", errno: " << errno;
+    conn->id = nullptr;
+    return false;
+  }
+
+  conn->meta_mr = rdma_reg_msgs(conn->id, conn->meta_buffer, sizeof(conn->meta_buffer));
+  conn->ack_mr = rdma_reg_msgs(conn->id, &conn->ack, sizeof(conn->ack));
+  if (conn->meta_mr == nullptr || conn->ack_mr == nullptr) {
+    MS_LOG(ERROR) << "Failed to register the message buffer, errno: " << errno;
+    return false;
+  }
+  // The acknowledgement of the server is received before sending the next message.
+  if (rdma_post_recv(conn->id, nullptr, &conn->ack, sizeof(conn->ack), conn->ack_mr) != 0) {
+    MS_LOG(ERROR) << "Failed to post the receive request of acknowledgement, errno: " << errno;
+    return false;
+  }
+  if (rdma_connect(conn->id, nullptr) != 0) {
+    MS_LOG(ERROR) << "Failed to connect to the rdma server " << dst_url << ", errno: " << errno;
+    return false;
+  }
+
+  // The established event of the synchronous endpoint carries the registered receive buffer of the server.
+  auto event = conn->id->event;
+  if (event == nullptr || event->param.conn.private_data == nullptr ||
+      event->param.conn.private_data_len < sizeof(RdmaBufferInfo)) {
+    MS_LOG(ERROR) << "The rdma server " << dst_url << " does not provide the receive buffer.";
+    return false;
+  }
+  auto ret_code = memcpy_s(&conn->remote_buffer, sizeof(RdmaBufferInfo), event->param.conn.private_data,
+                           sizeof(RdmaBufferInfo));
+  if (ret_code != EOK) {
+    MS_LOG(ERROR) << "Failed to copy the receive buffer info, ret code: " << ret_code;
+    return false;
+  }
+  return true;
+}
+
+void RDMAClient::DestroyConnection(RdmaClientConnection *conn) {
+  if (conn == nullptr || conn->id == nullptr) {
+    return;
+  }
+  (void)rdma_disconnect(conn->id);
+  for (auto &mem_region : conn->mem_regions) {
+    (void)rdma_dereg_mr(mem_region.second);
+  }
+  conn->mem_regions.clear();
+  if (conn->meta_mr != nullptr) {
+    (void)rdma_dereg_mr(conn->meta_mr);
+    conn->meta_mr = nullptr;
+  }
+  if (conn->ack_mr != nullptr) {
+    (void)rdma_dereg_mr(conn->ack_mr);
+    conn->ack_mr = nullptr;
+  }
+  rdma_destroy_ep(conn->id);
+  conn->id = nullptr;
+}
+
+struct ibv_mr *RDMAClient::GetMemRegion(RdmaClientConnection *conn, void *addr, size_t size) {
+  MS_EXCEPTION_IF_NULL(conn);
+  auto &mem_regions = conn->mem_regions;
+  auto iter = mem_regions.upper_bound(addr);
+  if (iter != mem_regions.begin()) {
+    auto mem_region = std::prev(iter)->second;
+    if (static_cast<char *>(addr) + size <= static_cast<char *>(mem_region->addr) + mem_region->length) {
+      return mem_region;
+    }
+  }
+
+  if (mem_regions.size() >= kRdmaMaxCachedMemRegionNum) {
+    for (auto &mem_region : mem_regions) {
+      (void)rdma_dereg_mr(mem_region.second);
+    }
+    mem_regions.clear();
+  }
+  auto mem_region = rdma_reg_msgs(conn->id, addr, size);
+  if (mem_region == nullptr) {
+    MS_LOG(ERROR) << "Failed to register the memory region of size " << size << ", errno: " << errno;
+    return nullptr;
+  }
+  // The smaller memory region of the same address is replaced.
+  auto old_iter = mem_regions.find(addr);
+  if (old_iter != mem_regions.end()) {
+    (void)rdma_dereg_mr(old_iter->second);
+  }
+  mem_regions[addr] = mem_region;
+  return mem_region;
+}
+
+int RDMAClient::WriteMessage(RdmaClientConnection *conn, MessageBase *msg) {
+  MS_EXCEPTION_IF_NULL(conn);
+  MS_EXCEPTION_IF_NULL(msg);
+  if (conn->id == nullptr) {
+    MS_LOG(ERROR) << "The rdma connection is disconnected and the name of dropped message is: " << msg->name;
+    return -1;
+  }
+  std::string send_to = msg->to;
+  std::string send_from = msg->from;
+  if (msg->name.size() > MAX_KMSG_NAME_LEN || send_to.size() > MAX_KMSG_TO_LEN ||
+      send_from.size() > MAX_KMSG_FROM_LEN) {
+    MS_LOG(ERROR) << "The meta of message " << msg->name << " is too long.";
+    return -1;
+  }
+
+  // Part 1. The meta of message in the same format as tcp: header, name, destination and source.
+  MessageHeader header;
+  FillMessageHeader(*msg, &header);
+  size_t meta_size = 0;
+  for (const auto &meta : std::vector<std::pair<const void *, size_t>>{{&header, sizeof(header)},
+                                                                        {msg->name.data(), msg->name.size()},
+                                                                        {send_to.data(), send_to.size()},
+                                                                        {send_from.data(), send_from.size()}}) {
+    if (meta.second == 0) {
+      continue;
+    }
+    auto ret = memcpy_s(conn->meta_buffer + meta_size, kRdmaMetaBufferSize - meta_size, meta.first, meta.second);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << "Failed to copy the meta of message " << msg->name << ", ret code: " << ret;
+      return -1;
+    }
+    meta_size += meta.second;
+  }
+
+  // Part 2. The data or body of message, and the zero-copy segments.
+  bool use_body = (msg->data == nullptr);
+  std::vector<std::pair<void *, size_t>> pieces;
+  size_t data_size = use_body ? msg->body.size() : msg->size;
+  if (data_size > 0) {
+    (void)pieces.emplace_back(use_body ? const_cast<char *>(msg->body.data()) : msg->data, data_size);
+  }
+  (void)pieces.insert(pieces.end(), msg->segments.begin(), msg->segments.end());
+  size_t total_size = meta_size;
+  for (const auto &piece : pieces) {
+    total_size += piece.second;
+  }
+  if (total_size > conn->remote_buffer.size) {
+    MS_LOG(ERROR) << "The size " << total_size << " of message " << msg->name
+                  << " exceeds the receive buffer size of rdma server " << conn->remote_buffer.size;
+    return -1;
+  }
+
+  // The body is released with the message, so it's registered only for this sending.
+  struct ibv_mr *body_mr = nullptr;
+  std::vector<struct ibv_sge> sges(pieces.size() + 1);
+  sges[0] = {reinterpret_cast<uint64_t>(conn->meta_buffer), static_cast<uint32_t>(meta_size), conn->meta_mr->lkey};
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    struct ibv_mr *mem_region = nullptr;
+    if (use_body && i == 0 && data_size > 0) {
+      body_mr = rdma_reg_msgs(conn->id, pieces[i].first, pieces[i].second);
+      mem_region = body_mr;
+    } else {
+      mem_region = GetMemRegion(conn, pieces[i].first, pieces[i].second);
+    }
+    if (mem_region == nullptr) {
+      MS_LOG(ERROR) << "Failed to register the memory of message " << msg->name;
+      if (body_mr != nullptr) {
+        (void)rdma_dereg_mr(body_mr);
+      }
+      return -1;
+    }
+    sges[i + 1] = {reinterpret_cast<uint64_t>(pieces[i].first), static_cast<uint32_t>(pieces[i].second),
+                   mem_region->lkey};
+  }
+
+  // Write all the parts to the receive buffer of server continuously, and the last write notifies the server with the
+  // total size of message as the immediate data.
+  std::vector<struct ibv_send_wr> work_requests(sges.size());
+  uint64_t remote_addr = conn->remote_buffer.addr;
+  for (size_t i = 0; i < sges.size(); ++i) {
+    auto &work_request = work_requests[i];
+    work_request = {};
+    work_request.wr_id = i;
+    work_request.sg_list = &sges[i];
+    work_request.num_sge = 1;
+    work_request.opcode = IBV_WR_RDMA_WRITE;
+    work_request.wr.rdma.remote_addr = remote_addr;
+    work_request.wr.rdma.rkey = conn->remote_buffer.rkey;
+    work_request.next = (i + 1 < sges.size()) ? &work_requests[i + 1] : nullptr;
+    remote_addr += sges[i].length;
+  }
+  auto &last_request = work_requests.back();
+  last_request.opcode = IBV_WR_RDMA_WRITE_WITH_IMM;
+  last_request.imm_data = htonl(static_cast<uint32_t>(total_size));
+  last_request.send_flags = IBV_SEND_SIGNALED;
+
+  int result = static_cast<int>(total_size);
+  struct ibv_send_wr *bad_request = nullptr;
+  struct ibv_wc work_completion = {};
+  if (ibv_post_send(conn->id->qp, work_requests.data(), &bad_request) != 0) {
+    MS_LOG(ERROR) << "Failed to post the rdma write of message " << msg->name << ", errno: " << errno;
+    result = -1;
+  } else if (rdma_get_send_comp(conn->id, &work_completion) <= 0 || work_completion.status != IBV_WC_SUCCESS) {
+    MS_LOG(ERROR) << "Failed to write message " << msg->name << " to the rdma server, status: "
+                  << work_completion.status;
+    result = -1;
+  } else if (rdma_get_recv_comp(conn->id, &work_completion) <= 0 || work_completion.status != IBV_WC_SUCCESS) {
+    // The server acknowledges after the receive buffer is consumed, then the next message could be written.
+    MS_LOG(ERROR) << "Failed to receive the acknowledgement of message " << msg->name << ", status: "
+                  << work_completion.status;
+    result = -1;
+  } else if (rdma_post_recv(conn->id, nullptr, &conn->ack, sizeof(conn->ack), conn->ack_mr) != 0) {
+    MS_LOG(ERROR) << "Failed to post the receive request of acknowledgement, errno: " << errno;
+    result = -1;
+  }
+  if (body_mr != nullptr) {
+    (void)rdma_dereg_mr(body_mr);
+  }
+  return result;
+}
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
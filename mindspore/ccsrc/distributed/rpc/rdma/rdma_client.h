@@ -0,0 +1,121 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_CLIENT_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_CLIENT_H_
+
+#include <map>
+#include <queue>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "distributed/rpc/rpc_client_base.h"
+#include "distributed/rpc/rdma/constants.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The connection from the rdma client to one server.
+struct RdmaClientConnection {
+  struct rdma_cm_id *id{nullptr};
+  // The registered receive buffer of the server.
+  RdmaBufferInfo remote_buffer;
+
+  // The registered buffer of the message meta and the acknowledgement from the server.
+  char meta_buffer[kRdmaMetaBufferSize];
+  struct ibv_mr *meta_mr{nullptr};
+  uint32_t ack{0};
+  struct ibv_mr *ack_mr{nullptr};
+
+  // The memory regions of the sent data, keyed by the start address of the data.
+  std::map<void *, struct ibv_mr *> mem_regions;
+
+  MemFreeCallback free_cb;
+  std::mutex mutex;
+};
+
+// The rdma client writes the messages into the registered buffer of the server by one-sided RDMA write, which avoids
+// the copying and the cpu usage of the kernel tcp stack. The data of the message is registered as memory region once
+// and cached, so the large tensors are sent directly from their own memory.
+class RDMAClient : public RPCClientBase {
+ public:
+  RDMAClient() = default;
+  ~RDMAClient() override;
+
+  // Build or destroy the rdma client.
+  bool Initialize() override;
+  void Finalize() override;
+
+  // Connect to the specified server.
+  // Function free_cb binds with client's each connection. It frees the real memory after message is sent to the peer.
+  bool Connect(
+    const std::string &dst_url, size_t retry_count = 60, const MemFreeCallback &free_cb = [](void *data) {
+      MS_ERROR_IF_NULL(data);
+      delete static_cast<char *>(data);
+      return true;
+    }) override;
+
+  // Check if the connection to dst_url has been established.
+  bool IsConnected(const std::string &dst_url) override;
+
+  // Disconnect from the specified server.
+  bool Disconnect(const std::string &dst_url, size_t timeout_in_sec = 5) override;
+
+  // Send the message from the source to the destination synchronously and return the byte size by this method call.
+  int SendSync(std::unique_ptr<MessageBase> &&msg) override;
+
+  // Send the message from the source to the destination asynchronously.
+  void SendAsync(std::unique_ptr<MessageBase> &&msg) override;
+
+  // The rdma transport is one-way, the server never replies so the receiving is not supported.
+  MessageBase *ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t timeout = 30) override;
+
+  // The message is sent out before SendSync returns, so nothing needs to be flushed.
+  bool Flush(const std::string &dst_url) override { return true; }
+
+ private:
+  bool ConnectImpl(const std::string &dst_url, RdmaClientConnection *conn);
+  void DestroyConnection(RdmaClientConnection *conn);
+
+  // Write the message to the server and wait for the acknowledgement, return the byte size of the message.
+  int WriteMessage(RdmaClientConnection *conn, MessageBase *msg);
+
+  // Get the memory region which covers the data, register and cache the memory region if not found.
+  struct ibv_mr *GetMemRegion(RdmaClientConnection *conn, void *addr, size_t size);
+
+  // The thread sends the messages of SendAsync in order.
+  void SendLoop();
+
+  std::mutex conn_mutex_;
+  std::map<std::string, std::unique_ptr<RdmaClientConnection>> connections_;
+
+  std::thread send_thread_;
+  std::mutex send_mutex_;
+  std::condition_variable send_cond_;
+  std::queue<std::unique_ptr<MessageBase>> send_queue_;
+  bool running_{false};
+
+  DISABLE_COPY_AND_ASSIGN(RDMAClient);
+};
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_CLIENT_H_
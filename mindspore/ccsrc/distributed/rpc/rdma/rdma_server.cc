@@ -0,0 +1,264 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/rpc/rdma/rdma_server.h"
+
+#include <fcntl.h>
+#include <chrono>
+#include <utility>
+#include "distributed/rpc/tcp/socket_operation.h"
+#include "securec/include/securec.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+RDMAServer::~RDMAServer() {
+  try {
+    Finalize();
+  } catch (const std::exception &) {
+    MS_LOG(ERROR) << "Failed to finalize the rdma server.";
+  }
+}
+
+bool RDMAServer::Initialize(const std::string &url, const MemAllocateCallback &allocate_cb) {
+  if (running_) {
+    return true;
+  }
+  std::string ip;
+  std::string port;
+  if (!ParseRdmaUrl(url, &ip, &port)) {
+    return false;
+  }
+  allocate_cb_ = allocate_cb;
+
+  struct rdma_addrinfo hints = {};
+  hints.ai_flags = RAI_PASSIVE;
+  hints.ai_port_space = RDMA_PS_TCP;
+  struct rdma_addrinfo *addr_info = nullptr;
+  if (rdma_getaddrinfo(ip.c_str(), port.c_str(), &hints, &addr_info) != 0) {
+    MS_LOG(ERROR) << "Failed to get the rdma address of " << url << ", errno: " << errno;
+    return false;
+  }
+  // The queue pair attributes of listening endpoint are used by the accepted connections.
+  auto qp_attr = RdmaQpInitAttr();
+  int ret = rdma_create_ep(&listen_id_, addr_info, nullptr, &qp_attr);
+  rdma_freeaddrinfo(addr_info);
+  if (ret != 0) {
+    MS_LOG(ERROR) << "Failed to create the rdma endpoint of " << url << ", errno: " << errno;
+    listen_id_ = nullptr;
+    return false;
+  }
+  if (rdma_listen(listen_id_, kRdmaListenBacklog) != 0) {
+    MS_LOG(ERROR) << "Failed to listen on " << url << ", errno: " << errno;
+    rdma_destroy_ep(listen_id_);
+    listen_id_ = nullptr;
+    return false;
+  }
+  // Poll the connection requests without blocking so that the accepting thread could be stopped.
+  MS_EXCEPTION_IF_NULL(listen_id_->channel);
+  int flags = fcntl(listen_id_->channel->fd, F_GETFL);
+  (void)fcntl(listen_id_->channel->fd, F_SETFL, flags | O_NONBLOCK);
+
+  ip_ = ip;
+  port_ = ntohs(rdma_get_src_port(listen_id_));
+  running_ = true;
+  accept_thread_ = std::thread(&RDMAServer::AcceptLoop, this);
+  MS_LOG(INFO) << "The rdma server listens on " << ip_ << ":" << port_;
+  return true;
+}
+
+bool RDMAServer::Initialize(const MemAllocateCallback &allocate_cb) {
+  // The port 0 means that the port will be allocated randomly by the os system.
+  return Initialize(SocketOperation::GetLocalIP() + ":0", allocate_cb);
+}
+
+void RDMAServer::Finalize() {
+  if (!running_) {
+    return;
+  }
+  running_ = false;
+  if (accept_thread_.joinable()) {
+    accept_thread_.join();
+  }
+
+  std::lock_guard<std::mutex> lock(conn_mutex_);
+  for (auto &conn : connections_) {
+    // The pending receive request is flushed after disconnecting, so the receiving thread exits.
+    (void)rdma_disconnect(conn->id);
+    if (conn->recv_thread.joinable()) {
+      conn->recv_thread.join();
+    }
+    DestroyConnection(conn.get());
+  }
+  connections_.clear();
+  if (listen_id_ != nullptr) {
+    rdma_destroy_ep(listen_id_);
+    listen_id_ = nullptr;
+  }
+}
+
+void RDMAServer::AcceptLoop() {
+  while (running_) {
+    struct rdma_cm_id *id = nullptr;
+    if (rdma_get_request(listen_id_, &id) != 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        MS_LOG(WARNING) << "Failed to get the rdma connection request, errno: " << errno;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(kRdmaAcceptIntervalInMs));
+      continue;
+    }
+
+    auto conn = std::make_unique<RdmaServerConnection>();
+    conn->id = id;
+    if (!AcceptConnection(conn.get())) {
+      DestroyConnection(conn.get());
+      continue;
+    }
+    conn->recv_thread = std::thread(&RDMAServer::RecvLoop, this, conn.get());
+    std::lock_guard<std::mutex> lock(conn_mutex_);
+    connections_.push_back(std::move(conn));
+  }
+}
+
+bool RDMAServer::AcceptConnection(RdmaServerConnection *conn) {
+  MS_EXCEPTION_IF_NULL(conn);
+  conn->recv_buffer = std::make_unique<char[]>(kRdmaRecvBufferSize);
+  conn->recv_mr = rdma_reg_write(conn->id, conn->recv_buffer.get(), kRdmaRecvBufferSize);
+  conn->ack_mr = rdma_reg_msgs(conn->id, &conn->ack, sizeof(conn->ack));
+  if (conn->recv_mr == nullptr || conn->ack_mr == nullptr) {
+    MS_LOG(ERROR) << "Failed to register the receive buffer, errno: " << errno;
+    return false;
+  }
+  // Each rdma write with immediate data from the client consumes one receive request.
+  if (rdma_post_recv(conn->id, nullptr, &conn->ack, sizeof(conn->ack), conn->ack_mr) != 0) {
+    MS_LOG(ERROR) << "Failed to post the receive request, errno: " << errno;
+    return false;
+  }
+
+  RdmaBufferInfo buffer_info;
+  buffer_info.addr = reinterpret_cast<uint64_t>(conn->recv_buffer.get());
+  buffer_info.rkey = conn->recv_mr->rkey;
+  buffer_info.size = static_cast<uint32_t>(kRdmaRecvBufferSize);
+  struct rdma_conn_param conn_param = {};
+  conn_param.private_data = &buffer_info;
+  conn_param.private_data_len = static_cast<uint8_t>(sizeof(buffer_info));
+  if (rdma_accept(conn->id, &conn_param) != 0) {
+    MS_LOG(ERROR) << "Failed to accept the rdma connection, errno: " << errno;
+    return false;
+  }
+  return true;
+}
+
+void RDMAServer::DestroyConnection(RdmaServerConnection *conn) {
+  if (conn == nullptr || conn->id == nullptr) {
+    return;
+  }
+  if (conn->recv_mr != nullptr) {
+    (void)rdma_dereg_mr(conn->recv_mr);
+    conn->recv_mr = nullptr;
+  }
+  if (conn->ack_mr != nullptr) {
+    (void)rdma_dereg_mr(conn->ack_mr);
+    conn->ack_mr = nullptr;
+  }
+  rdma_destroy_ep(conn->id);
+  conn->id = nullptr;
+}
+
+void RDMAServer::RecvLoop(RdmaServerConnection *conn) {
+  MS_EXCEPTION_IF_NULL(conn);
+  while (true) {
+    struct ibv_wc work_completion = {};
+    if (rdma_get_recv_comp(conn->id, &work_completion) <= 0 || work_completion.status != IBV_WC_SUCCESS) {
+      MS_LOG(INFO) << "The rdma connection is closed, status: " << work_completion.status;
+      return;
+    }
+    MessageBase *msg = nullptr;
+    if (work_completion.opcode == IBV_WC_RECV_RDMA_WITH_IMM) {
+      msg = ParseMessage(conn, static_cast<size_t>(ntohl(work_completion.imm_data)));
+    } else {
+      MS_LOG(WARNING) << "Unexpected rdma work completion opcode: " << work_completion.opcode;
+    }
+
+    // The receive buffer has been consumed, so acknowledge the client to write the next message.
+    if (rdma_post_recv(conn->id, nullptr, &conn->ack, sizeof(conn->ack), conn->ack_mr) != 0 ||
+        rdma_post_send(conn->id, nullptr, &conn->ack, sizeof(conn->ack), conn->ack_mr, IBV_SEND_SIGNALED) != 0 ||
+        rdma_get_send_comp(conn->id, &work_completion) <= 0) {
+      MS_LOG(ERROR) << "Failed to acknowledge the rdma client, errno: " << errno;
+      delete msg;
+      return;
+    }
+    if (msg == nullptr) {
+      continue;
+    }
+    if (!message_handler_) {
+      MS_LOG(INFO) << "Message handler was not found";
+      delete msg;
+      continue;
+    }
+    auto result = message_handler_(msg);
+    if (result != NULL_MSG) {
+      MS_LOG(WARNING) << "The rdma server can not reply message " << result->name << " to the client.";
+      delete result;
+    }
+  }
+}
+
+MessageBase *RDMAServer::ParseMessage(const RdmaServerConnection *conn, size_t total_size) {
+  MS_EXCEPTION_IF_NULL(conn);
+  const char *buffer = conn->recv_buffer.get();
+  MessageHeader header;
+  if (total_size < sizeof(header) || total_size > kRdmaRecvBufferSize ||
+      memcpy_s(&header, sizeof(header), buffer, sizeof(header)) != EOK ||
+      strncmp(RPC_MAGICID, header.magic, sizeof(RPC_MAGICID) - 1) != 0) {
+    MS_LOG(ERROR) << "Drop invalid rdma data of size " << total_size;
+    return nullptr;
+  }
+  size_t name_len = ntohl(header.name_len);
+  size_t to_len = ntohl(header.to_len);
+  size_t from_len = ntohl(header.from_len);
+  size_t body_len = ntohl(header.body_len);
+  if (name_len > MAX_KMSG_NAME_LEN || to_len > MAX_KMSG_TO_LEN || from_len > MAX_KMSG_FROM_LEN ||
+      sizeof(header) + name_len + to_len + from_len + body_len != total_size) {
+    MS_LOG(ERROR) << "Drop invalid rdma data of size " << total_size;
+    return nullptr;
+  }
+
+  MessageBase *msg = new (std::nothrow) MessageBase();
+  MS_EXCEPTION_IF_NULL(msg);
+  const char *data = buffer + sizeof(header);
+  msg->name.assign(data, name_len);
+  data += name_len;
+  msg->to = AID(std::string(data, to_len));
+  data += to_len;
+  msg->from = AID(std::string(data, from_len));
+  data += from_len;
+  if (allocate_cb_) {
+    msg->data = allocate_cb_(body_len);
+    msg->size = body_len;
+    if (body_len > 0 && (msg->data == nullptr || memcpy_s(msg->data, body_len, data, body_len) != EOK)) {
+      MS_LOG(ERROR) << "Failed to copy the rdma data of message " << msg->name;
+      delete msg;
+      return nullptr;
+    }
+  } else {
+    msg->body.assign(data, body_len);
+  }
+  return msg;
+}
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
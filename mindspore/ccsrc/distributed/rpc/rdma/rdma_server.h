@@ -0,0 +1,99 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_SERVER_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_SERVER_H_
+
+#include <atomic>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "distributed/rpc/rpc_server_base.h"
+#include "distributed/rpc/rdma/constants.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The connection from one rdma client to the server.
+struct RdmaServerConnection {
+  struct rdma_cm_id *id{nullptr};
+  // The receive buffer written by the client with one-sided RDMA write.
+  std::unique_ptr<char[]> recv_buffer;
+  struct ibv_mr *recv_mr{nullptr};
+  uint32_t ack{0};
+  struct ibv_mr *ack_mr{nullptr};
+  std::thread recv_thread;
+};
+
+// The rdma server registers a receive buffer for each connection and hands its address to the client when accepting,
+// then the client writes the messages to the buffer directly and the server is notified by the immediate data.
+class RDMAServer : public RPCServerBase {
+ public:
+  RDMAServer() = default;
+  ~RDMAServer() override;
+
+  // Init the rdma server using the specified url.
+  bool Initialize(const std::string &url, const MemAllocateCallback &allocate_cb = {}) override;
+
+  // Init the rdma server using local IP and random port.
+  bool Initialize(const MemAllocateCallback &allocate_cb = {}) override;
+
+  // Destroy the rdma server.
+  void Finalize() override;
+
+  // Set the message processing handler.
+  void SetMessageHandler(const MessageHandler &handler) override { message_handler_ = handler; }
+
+  // Return the IP and port binded by this server.
+  std::string GetIP() const override { return ip_; }
+  uint32_t GetPort() const override { return port_; }
+
+ private:
+  // Accept the connection requests until the server is finalized.
+  void AcceptLoop();
+  bool AcceptConnection(RdmaServerConnection *conn);
+  void DestroyConnection(RdmaServerConnection *conn);
+
+  // Receive the messages written by the client until the connection is closed.
+  void RecvLoop(RdmaServerConnection *conn);
+
+  // Build the message from the receive buffer.
+  MessageBase *ParseMessage(const RdmaServerConnection *conn, size_t total_size);
+
+  struct rdma_cm_id *listen_id_{nullptr};
+  std::thread accept_thread_;
+  std::atomic_bool running_{false};
+
+  std::mutex conn_mutex_;
+  std::vector<std::unique_ptr<RdmaServerConnection>> connections_;
+
+  MessageHandler message_handler_;
+  MemAllocateCallback allocate_cb_;
+
+  std::string ip_{""};
+  uint32_t port_{0};
+
+  DISABLE_COPY_AND_ASSIGN(RDMAServer);
+};
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RDMA_RDMA_SERVER_H_
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_CLIENT_BASE_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_CLIENT_BASE_H_
+
+#include <string>
+#include <memory>
+
+#include "actor/msg.h"
+#include "distributed/rpc/tcp/constants.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The interface of the rpc client, which is implemented by the transports like tcp and rdma.
+class RPCClientBase {
+ public:
+  RPCClientBase() = default;
+  virtual ~RPCClientBase() = default;
+
+  // Build or destroy the rpc client.
+  virtual bool Initialize() = 0;
+  virtual void Finalize() = 0;
+
+  // Connect to the specified server.
+  // Function free_cb binds with client's each connection. It frees the real memory after message is sent to the peer.
+  virtual bool Connect(
+    const std::string &dst_url, size_t retry_count = 60, const MemFreeCallback &free_cb = [](void *data) {
+      MS_ERROR_IF_NULL(data);
+      delete static_cast<char *>(data);
+      return true;
+    }) = 0;
+
+  // Check if the connection to dst_url has been established.
+  virtual bool IsConnected(const std::string &dst_url) = 0;
+
+  // Disconnect from the specified server.
+  virtual bool Disconnect(const std::string &dst_url, size_t timeout_in_sec = 5) = 0;
+
+  // Send the message from the source to the destination synchronously and return the byte size by this method call.
+  virtual int SendSync(std::unique_ptr<MessageBase> &&msg) = 0;
+
+  // Send the message from the source to the destination asynchronously.
+  virtual void SendAsync(std::unique_ptr<MessageBase> &&msg) = 0;
+
+  // Retrieve a message from the server specified by the input message.
+  // Returns nullptr after timeout.
+  virtual MessageBase *ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t timeout = 30) = 0;
+
+  // Force the data in the send buffer to be sent out.
+  virtual bool Flush(const std::string &dst_url) = 0;
+};
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_CLIENT_BASE_H_
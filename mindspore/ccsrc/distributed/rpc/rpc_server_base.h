@@ -0,0 +1,53 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_SERVER_BASE_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_SERVER_BASE_H_
+
+#include <string>
+
+#include "distributed/rpc/tcp/constants.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The interface of the rpc server, which is implemented by the transports like tcp and rdma.
+class RPCServerBase {
+ public:
+  RPCServerBase() = default;
+  virtual ~RPCServerBase() = default;
+
+  // Init the server using the specified url.
+  virtual bool Initialize(const std::string &url, const MemAllocateCallback &allocate_cb = {}) = 0;
+
+  // Init the server using local IP and random port.
+  virtual bool Initialize(const MemAllocateCallback &allocate_cb = {}) = 0;
+
+  // Destroy the server.
+  virtual void Finalize() = 0;
+
+  // Set the message processing handler.
+  virtual void SetMessageHandler(const MessageHandler &handler) = 0;
+
+  // Return the IP and port binded by this server.
+  virtual std::string GetIP() const = 0;
+  virtual uint32_t GetPort() const = 0;
+};
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_SERVER_BASE_H_
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_TRANSPORT_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_TRANSPORT_H_
+
+#include <memory>
+
+#include "distributed/rpc/tcp/tcp_client.h"
+#include "distributed/rpc/tcp/tcp_server.h"
+#ifdef ENABLE_RDMA
+#include "distributed/rpc/rdma/rdma_client.h"
+#include "distributed/rpc/rdma/rdma_server.h"
+#endif
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace rpc {
+// The transport of rpc actors is tcp by default, and could be set to rdma by env MS_DEV_RPC_PROTOCOL=rdma on the
+// InfiniBand or RoCE clusters. Both sides of the inter-process edges must use the same transport.
+inline bool EnableRDMATransport() {
+#ifdef ENABLE_RDMA
+  static const bool enable_rdma = (common::GetEnv("MS_DEV_RPC_PROTOCOL") == "rdma");
+  return enable_rdma;
+#else
+  return false;
+#endif
+}
+
+inline std::unique_ptr<RPCClientBase> CreateRPCClient() {
+#ifdef ENABLE_RDMA
+  if (EnableRDMATransport()) {
+    return std::make_unique<RDMAClient>();
+  }
+#endif
+  return std::make_unique<TCPClient>();
+}
+
+inline std::unique_ptr<RPCServerBase> CreateRPCServer() {
+#ifdef ENABLE_RDMA
+  if (EnableRDMATransport()) {
+    return std::make_unique<RDMAServer>();
+  }
+#endif
+  return std::make_unique<TCPServer>();
+}
+}  // namespace rpc
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_RPC_RPC_TRANSPORT_H_
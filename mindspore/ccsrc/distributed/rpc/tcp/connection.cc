@@ -359,11 +359,21 @@ void Connection::FillSendMessage(MessageBase *msg, const std::string &advertiseU
       send_io_vec[index].iov_base = const_cast<char *>(send_from.data());
       send_io_vec[index].iov_len = send_from.size();
       ++index;
-      send_io_vec[index].iov_base = GetMessageBaseRealData(msg);
       // The real size of the data body.
       size_t real_data_size = GetMessageBaseRealDataSize(msg);
-      send_io_vec[index].iov_len = real_data_size;
-      ++index;
+      if (real_data_size > 0 || msg->segments.empty()) {
+        send_io_vec[index].iov_base = GetMessageBaseRealData(msg);
+        send_io_vec[index].iov_len = real_data_size;
+        ++index;
+      }
+      // Send the segments directly from the buffers of the caller by scatter-gather io.
+      RPC_ASSERT(msg->segments.size() <= static_cast<size_t>(SEND_MSG_SEGMENT_NUM));
+      for (const auto &segment : msg->segments) {
+        send_io_vec[index].iov_base = segment.first;
+        send_io_vec[index].iov_len = segment.second;
+        real_data_size += segment.second;
+        ++index;
+      }
       send_kernel_msg.msg_iov = send_io_vec;
       send_kernel_msg.msg_iovlen = index;
       total_send_len =
@@ -208,7 +208,7 @@ struct Connection {
   struct msghdr recv_kernel_msg;
 
   struct iovec recv_io_vec[RECV_MSG_IO_VEC_LEN];
-  struct iovec send_io_vec[SEND_MSG_IO_VEC_LEN];
+  struct iovec send_io_vec[SEND_MSG_IO_VEC_LEN + SEND_MSG_SEGMENT_NUM];
 
   ParseType recv_message_type{kTcpMsg};
 
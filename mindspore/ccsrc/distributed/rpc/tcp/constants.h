@@ -49,6 +49,8 @@ using MemAllocateCallback = std::function<void *(size_t size)>;
 using MemFreeCallback = std::function<bool(void *data)>;
 
 constexpr int SEND_MSG_IO_VEC_LEN = 5;
+// The max number of the zero-copy segments in one message, each segment takes one io vector.
+constexpr int SEND_MSG_SEGMENT_NUM = 64;
 constexpr int RECV_MSG_IO_VEC_LEN = 4;
 
 constexpr unsigned int BUSMAGIC_LEN = 4;
@@ -93,6 +95,14 @@ static const char URL_PROTOCOL_IP_SEPARATOR[] = "://";
 static const char URL_IP_PORT_SEPARATOR[] = ":";
 static const char TCP_RECV_EVLOOP_THREADNAME[] = "RECV_EVENT_LOOP";
 static const char TCP_SEND_EVLOOP_THREADNAME[] = "SEND_EVENT_LOOP";
+// The thread name prefix of the sharded event loops, the thread name is limited to 16 characters.
+static const char TCP_RECV_EVLOOP_THREADNAME_PREFIX[] = "RECV_EVLOOP_";
+static const char TCP_SEND_EVLOOP_THREADNAME_PREFIX[] = "SEND_EVLOOP_";
+
+// The env to set the number of the event loop shards of TCPComm, the connections are distributed to the shards by the
+// hash of destination url.
+static const char kEnvEventLoopNum[] = "MS_DEV_RPC_EVENT_LOOP_NUM";
+constexpr size_t kMaxEventLoopNum = 16;
 
 constexpr int RPC_OK = 0;
 constexpr int RPC_ERROR = -1;
@@ -136,11 +146,12 @@ __attribute__((unused)) static void FillMessageHeader(const MessageBase &message
   header->name_len = htonl(static_cast<uint32_t>(message.name.size()));
   header->to_len = htonl(static_cast<uint32_t>(send_to.size()));
   header->from_len = htonl(static_cast<uint32_t>(send_from.size()));
-  if (message.data != nullptr) {
-    header->body_len = htonl(static_cast<uint32_t>(message.size));
-  } else {
-    header->body_len = htonl(static_cast<uint32_t>(message.body.size()));
+  size_t body_len = (message.data != nullptr) ? message.size : message.body.size();
+  // The segments are received as the tail of the body by the peer.
+  for (const auto &segment : message.segments) {
+    body_len += segment.second;
   }
+  header->body_len = htonl(static_cast<uint32_t>(body_len));
 }
 
 // Compute and return the byte size of the whole message.
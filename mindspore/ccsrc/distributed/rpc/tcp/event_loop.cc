@@ -25,6 +25,7 @@
 #include <unistd.h>
 #include <utility>
 #include <atomic>
+#include <chrono>
 #include <string>
 #include <thread>
 
@@ -64,7 +65,10 @@ int EventLoopRun(EventLoop *evloop, int timeout) {
       }
     } else if (nevent > 0) {
       /* save the epoll modify in "stop" while dispatching handlers */
+      auto start_time = std::chrono::steady_clock::now();
       evloop->HandleEvent(events, nevent);
+      evloop->busy_time_ += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start_time).count());
     } else {
       MS_LOG(ERROR) << "Failed to call epoll_wait, epoll_fd_: " << evloop->epoll_fd_ << ", ret: 0,errno: " << errno;
       evloop->is_stop_ = true;
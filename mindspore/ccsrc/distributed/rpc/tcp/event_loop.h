@@ -21,6 +21,7 @@
 #include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <semaphore.h>
+#include <atomic>
 #include <functional>
 #include <list>
 #include <mutex>
@@ -80,6 +81,9 @@ class EventLoop {
   int UpdateEpollEvent(int fd, uint32_t events);
   int DeleteEpollEvent(int fd);
 
+  // The accumulated time in microseconds this event loop spends on handling the events and tasks.
+  uint64_t busy_time() const { return busy_time_.load(); }
+
  private:
   void AddEvent(Event *event);
 
@@ -129,6 +133,8 @@ class EventLoop {
   // delete events on the same fd twice in once epoll_wait.
   std::map<int, std::list<Event *>> deleted_events_;
 
+  std::atomic<uint64_t> busy_time_{0};
+
   friend int EventLoopRun(EventLoop *evloop, int timeout);
   friend void QueueReadyCallback(int fd, uint32_t events, void *arg);
 };
@@ -22,20 +22,21 @@
 #include <mutex>
 #include <condition_variable>
 
+#include "distributed/rpc/rpc_client_base.h"
 #include "distributed/rpc/tcp/tcp_comm.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace distributed {
 namespace rpc {
-class TCPClient {
+class TCPClient : public RPCClientBase {
  public:
   explicit TCPClient(bool enable_ssl = false) : enable_ssl_(enable_ssl) {}
-  ~TCPClient() = default;
+  ~TCPClient() override = default;
 
   // Build or destroy the TCP client.
-  bool Initialize();
-  void Finalize();
+  bool Initialize() override;
+  void Finalize() override;
 
   // Connect to the specified server.
   // Function free_cb binds with client's each connection. It frees the real memory after message is sent to the peer.
@@ -44,26 +45,26 @@ class TCPClient {
       MS_ERROR_IF_NULL(data);
       delete static_cast<char *>(data);
       return true;
-    });
+    }) override;
 
   // Check if the connection to dst_url has been established.
-  bool IsConnected(const std::string &dst_url);
+  bool IsConnected(const std::string &dst_url) override;
 
   // Disconnect from the specified server.
-  bool Disconnect(const std::string &dst_url, size_t timeout_in_sec = 5);
+  bool Disconnect(const std::string &dst_url, size_t timeout_in_sec = 5) override;
 
   // Send the message from the source to the destination synchronously and return the byte size by this method call.
-  int SendSync(std::unique_ptr<MessageBase> &&msg);
+  int SendSync(std::unique_ptr<MessageBase> &&msg) override;
 
   // Send the message from the source to the destination asynchronously.
-  void SendAsync(std::unique_ptr<MessageBase> &&msg);
+  void SendAsync(std::unique_ptr<MessageBase> &&msg) override;
 
   // Retrieve a message from tcp server specified by the input message.
   // Returns nullptr after timeout.
-  MessageBase *ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t timeout = 30);
+  MessageBase *ReceiveSync(std::unique_ptr<MessageBase> &&msg, uint32_t timeout = 30) override;
 
   // Force the data in the send buffer to be sent out.
-  bool Flush(const std::string &dst_url);
+  bool Flush(const std::string &dst_url) override;
 
  private:
   // The basic TCP communication component used by the client.
@@ -19,8 +19,11 @@
 #include <mutex>
 #include <utility>
 #include <memory>
+#include <functional>
+#include <algorithm>
 
 #include "actor/aid.h"
+#include "utils/ms_utils.h"
 #include "distributed/rpc/tcp/constants.h"
 #include "distributed/rpc/tcp/tcp_socket_operation.h"
 
@@ -67,7 +70,7 @@ void OnAccept(int server, uint32_t events, void *arg) {
     return;
   }
   TCPComm *tcpmgr = reinterpret_cast<TCPComm *>(arg);
-  if (tcpmgr->recv_event_loop_ == nullptr) {
+  if (tcpmgr->recv_event_loops_.empty()) {
     MS_LOG(ERROR) << "EventLoop is null, server fd: " << server << ", events: " << events;
     return;
   }
@@ -108,10 +111,7 @@ void OnAccept(int server, uint32_t events, void *arg) {
   conn->peer = conn->destination;
 
   conn->is_remote = true;
-  conn->recv_event_loop = tcpmgr->recv_event_loop_;
-  conn->send_event_loop = tcpmgr->send_event_loop_;
-
-  conn->conn_mutex = tcpmgr->conn_mutex_;
+  tcpmgr->AssignShard(conn, conn->destination);
   conn->message_handler = tcpmgr->message_handler_;
 
   conn->event_callback = std::bind(&TCPComm::EventCallBack, tcpmgr, std::placeholders::_1);
@@ -141,41 +141,110 @@ bool TCPComm::Initialize() {
   conn_pool_ = std::make_shared<ConnectionPool>();
   MS_EXCEPTION_IF_NULL(conn_pool_);
 
-  conn_mutex_ = std::make_shared<std::mutex>();
-  MS_EXCEPTION_IF_NULL(conn_mutex_);
-
-  recv_event_loop_ = new (std::nothrow) EventLoop();
-  if (recv_event_loop_ == nullptr) {
-    MS_LOG(ERROR) << "Failed to create recv evLoop.";
+  if (!InitEventLoops()) {
+    ReleaseEventLoops();
     return false;
   }
+  return true;
+}
 
-  bool ok = recv_event_loop_->Initialize(TCP_RECV_EVLOOP_THREADNAME);
-  if (!ok) {
-    MS_LOG(ERROR) << "Failed to init recv evLoop";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
-    return false;
+bool TCPComm::InitEventLoops() {
+  size_t loop_num = 1;
+  auto loop_num_env = common::GetEnv(kEnvEventLoopNum);
+  if (!loop_num_env.empty()) {
+    try {
+      loop_num = std::stoul(loop_num_env);
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid value of env " << kEnvEventLoopNum << ": " << loop_num_env << ", " << e.what();
+      loop_num = 1;
+    }
+    loop_num = std::min(std::max(loop_num, static_cast<size_t>(1)), kMaxEventLoopNum);
   }
+  MS_LOG(INFO) << "The event loop shard number: " << loop_num;
 
-  send_event_loop_ = new (std::nothrow) EventLoop();
-  if (send_event_loop_ == nullptr) {
-    MS_LOG(ERROR) << "Failed to create send evLoop.";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
-    return false;
+  for (size_t i = 0; i < loop_num; ++i) {
+    auto conn_mutex = std::make_shared<std::mutex>();
+    MS_EXCEPTION_IF_NULL(conn_mutex);
+    conn_mutexes_.push_back(conn_mutex);
+
+    auto recv_event_loop = new (std::nothrow) EventLoop();
+    if (recv_event_loop == nullptr) {
+      MS_LOG(ERROR) << "Failed to create recv evLoop.";
+      return false;
+    }
+    recv_event_loops_.push_back(recv_event_loop);
+    std::string recv_thread_name =
+      loop_num == 1 ? TCP_RECV_EVLOOP_THREADNAME : TCP_RECV_EVLOOP_THREADNAME_PREFIX + std::to_string(i);
+    if (!recv_event_loop->Initialize(recv_thread_name)) {
+      MS_LOG(ERROR) << "Failed to init recv evLoop";
+      return false;
+    }
+
+    auto send_event_loop = new (std::nothrow) EventLoop();
+    if (send_event_loop == nullptr) {
+      MS_LOG(ERROR) << "Failed to create send evLoop.";
+      return false;
+    }
+    send_event_loops_.push_back(send_event_loop);
+    std::string send_thread_name =
+      loop_num == 1 ? TCP_SEND_EVLOOP_THREADNAME : TCP_SEND_EVLOOP_THREADNAME_PREFIX + std::to_string(i);
+    if (!send_event_loop->Initialize(send_thread_name)) {
+      MS_LOG(ERROR) << "Failed to init send evLoop";
+      return false;
+    }
   }
-  ok = send_event_loop_->Initialize(TCP_SEND_EVLOOP_THREADNAME);
-  if (!ok) {
-    MS_LOG(ERROR) << "Failed to init send evLoop";
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
-    delete send_event_loop_;
-    send_event_loop_ = nullptr;
-    return false;
+  return true;
+}
+
+void TCPComm::ReleaseEventLoops() {
+  for (size_t i = 0; i < send_event_loops_.size(); ++i) {
+    MS_LOG(INFO) << "Delete send event loop " << i << ", busy time: " << send_event_loops_[i]->busy_time() << "us";
+    send_event_loops_[i]->Finalize();
+    delete send_event_loops_[i];
   }
+  send_event_loops_.clear();
 
-  return true;
+  for (size_t i = 0; i < recv_event_loops_.size(); ++i) {
+    MS_LOG(INFO) << "Delete recv event loop " << i << ", busy time: " << recv_event_loops_[i]->busy_time() << "us";
+    recv_event_loops_[i]->Finalize();
+    delete recv_event_loops_[i];
+  }
+  recv_event_loops_.clear();
+  conn_mutexes_.clear();
+}
+
+size_t TCPComm::ShardIndex(const std::string &url) const {
+  if (conn_mutexes_.size() <= 1) {
+    return 0;
+  }
+  return std::hash<std::string>()(url) % conn_mutexes_.size();
+}
+
+void TCPComm::AssignShard(Connection *conn, const std::string &url) {
+  MS_EXCEPTION_IF_NULL(conn);
+  auto index = ShardIndex(url);
+  conn->recv_event_loop = recv_event_loops_[index];
+  conn->send_event_loop = send_event_loops_[index];
+  conn->conn_mutex = conn_mutexes_[index];
+}
+
+size_t TCPComm::RemainingTaskNum() const {
+  size_t task_num = 0;
+  for (auto event_loop : recv_event_loops_) {
+    task_num += event_loop->RemainingTaskNum();
+  }
+  for (auto event_loop : send_event_loops_) {
+    task_num += event_loop->RemainingTaskNum();
+  }
+  return task_num;
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> TCPComm::GetEventLoopBusyTime() const {
+  std::vector<std::pair<uint64_t, uint64_t>> busy_time;
+  for (size_t i = 0; i < recv_event_loops_.size() && i < send_event_loops_.size(); ++i) {
+    (void)busy_time.emplace_back(recv_event_loops_[i]->busy_time(), send_event_loops_[i]->busy_time());
+  }
+  return busy_time;
 }
 
 bool TCPComm::StartServerSocket(const std::string &url, const MemAllocateCallback &allocate_cb) {
@@ -192,7 +261,7 @@ bool TCPComm::StartServerSocket(const std::string &url, const MemAllocateCallbac
   }
 
   // Register read event callback for server socket
-  int retval = recv_event_loop_->SetEventHandler(server_fd_, EPOLLIN | EPOLLHUP | EPOLLERR, OnAccept,
+  int retval = recv_event_loops_[0]->SetEventHandler(server_fd_, EPOLLIN | EPOLLHUP | EPOLLERR, OnAccept,
                                                  reinterpret_cast<void *>(this));
   if (retval != RPC_OK) {
     MS_LOG(ERROR) << "Failed to add server event, url: " << url.c_str();
@@ -243,7 +312,7 @@ void TCPComm::EventCallBack(void *connection) {
     (void)conn->Flush();
     conn->conn_mutex->unlock();
   } else if (conn->state == ConnectionState::kDisconnecting) {
-    std::lock_guard<std::mutex> lock(*conn_mutex_);
+    std::lock_guard<std::mutex> lock(*conn->conn_mutex);
     conn_pool_->DeleteConnection(conn->destination);
   }
 }
@@ -315,8 +384,10 @@ void TCPComm::DropMessage(MessageBase *msg) {
 }
 
 ssize_t TCPComm::Send(MessageBase *msg, bool sync) {
-  auto task = [msg, this] {
-    std::lock_guard<std::mutex> lock(*conn_mutex_);
+  // The message is sent by the event loop of the shard which the destination belongs to.
+  auto shard_index = ShardIndex(msg->to.Url());
+  auto task = [msg, shard_index, this] {
+    std::lock_guard<std::mutex> lock(*conn_mutexes_[shard_index]);
     // Search connection by the target address
     std::string destination = msg->to.Url();
     Connection *conn = conn_pool_->FindConnection(destination);
@@ -358,7 +429,7 @@ ssize_t TCPComm::Send(MessageBase *msg, bool sync) {
   if (sync) {
     return task();
   } else {
-    send_event_loop_->AddTask(task);
+    send_event_loops_[shard_index]->AddTask(task);
     return true;
   }
 }
@@ -375,7 +446,7 @@ bool TCPComm::Flush(const std::string &dst_url) {
 }
 
 bool TCPComm::Connect(const std::string &dst_url) {
-  std::lock_guard<std::mutex> lock(*conn_mutex_);
+  std::lock_guard<std::mutex> lock(*conn_mutexes_[ShardIndex(dst_url)]);
 
   // Search connection by the target address
   Connection *conn = conn_pool_->FindConnection(dst_url);
@@ -388,9 +459,7 @@ bool TCPComm::Connect(const std::string &dst_url) {
       return false;
     }
     conn->enable_ssl = enable_ssl_;
-    conn->recv_event_loop = this->recv_event_loop_;
-    conn->send_event_loop = this->send_event_loop_;
-    conn->conn_mutex = conn_mutex_;
+    AssignShard(conn, dst_url);
     conn->message_handler = message_handler_;
     conn->InitSocketOperation();
 
@@ -452,16 +521,16 @@ bool TCPComm::IsConnected(const std::string &dst_url) {
 bool TCPComm::Disconnect(const std::string &dst_url) {
   int interval = 100000;
   size_t retry = 30;
-  while (recv_event_loop_->RemainingTaskNum() != 0 && send_event_loop_->RemainingTaskNum() != 0 && retry > 0) {
+  while (RemainingTaskNum() != 0 && retry > 0) {
     usleep(interval);
     retry--;
   }
-  if (recv_event_loop_->RemainingTaskNum() > 0 || send_event_loop_->RemainingTaskNum() > 0) {
+  if (RemainingTaskNum() > 0) {
     MS_LOG(ERROR) << "Failed to disconnect from url " << dst_url
                   << ", because there are still pending tasks to be executed, please try later.";
     return false;
   }
-  std::lock_guard<std::mutex> lock(*conn_mutex_);
+  std::lock_guard<std::mutex> lock(*conn_mutexes_[ShardIndex(dst_url)]);
   auto conn = conn_pool_->FindConnection(dst_url);
   if (conn != nullptr) {
     std::lock_guard<std::mutex> conn_lock(conn->conn_owned_mutex_);
@@ -479,28 +548,14 @@ Connection *TCPComm::CreateDefaultConn(const std::string &to) {
   conn->enable_ssl = enable_ssl_;
   conn->source = url_.data();
   conn->destination = to;
-  conn->recv_event_loop = this->recv_event_loop_;
-  conn->send_event_loop = this->send_event_loop_;
-  conn->conn_mutex = conn_mutex_;
+  AssignShard(conn, to);
   conn->message_handler = message_handler_;
   conn->InitSocketOperation();
   return conn;
 }
 
 void TCPComm::Finalize() {
-  if (send_event_loop_ != nullptr) {
-    MS_LOG(INFO) << "Delete send event loop";
-    send_event_loop_->Finalize();
-    delete send_event_loop_;
-    send_event_loop_ = nullptr;
-  }
-
-  if (recv_event_loop_ != nullptr) {
-    MS_LOG(INFO) << "Delete recv event loop";
-    recv_event_loop_->Finalize();
-    delete recv_event_loop_;
-    recv_event_loop_ = nullptr;
-  }
+  ReleaseEventLoops();
 
   if (server_fd_ > 0) {
     if (close(server_fd_) != 0) {
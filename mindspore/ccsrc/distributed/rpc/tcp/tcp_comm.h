@@ -21,6 +21,7 @@
 #include <memory>
 #include <vector>
 #include <mutex>
+#include <utility>
 
 #include "actor/msg.h"
 #include "distributed/rpc/tcp/connection.h"
@@ -39,8 +40,7 @@ void ConnectedEventHandler(int fd, uint32_t events, void *context);
 
 class TCPComm {
  public:
-  explicit TCPComm(bool enable_ssl = false)
-      : server_fd_(-1), recv_event_loop_(nullptr), send_event_loop_(nullptr), enable_ssl_(enable_ssl) {}
+  explicit TCPComm(bool enable_ssl = false) : server_fd_(-1), enable_ssl_(enable_ssl) {}
   TCPComm(const TCPComm &) = delete;
   TCPComm &operator=(const TCPComm &) = delete;
   ~TCPComm() = default;
@@ -90,7 +90,27 @@ class TCPComm {
    */
   const MemAllocateCallback &allocate_cb() const { return allocate_cb_; }
 
+  /**
+   * @description: Returns the busy time of the recv and send event loops of each shard.
+   * @return {std::vector<std::pair<uint64_t, uint64_t>>}: The busy time in microseconds of each shard.
+   */
+  std::vector<std::pair<uint64_t, uint64_t>> GetEventLoopBusyTime() const;
+
  private:
+  // Create the recv and send event loops of all the shards.
+  bool InitEventLoops();
+  // Stop and delete the event loops of all the shards.
+  void ReleaseEventLoops();
+
+  // Get the shard index of the connection to the url.
+  size_t ShardIndex(const std::string &url) const;
+
+  // Assign the event loops and mutex of the shard which the url belongs to the connection.
+  void AssignShard(Connection *conn, const std::string &url);
+
+  // The number of tasks pending in the event loops of all the shards.
+  size_t RemainingTaskNum() const;
+
   // Build the connection.
   Connection *CreateDefaultConn(const std::string &to);
 
@@ -121,16 +141,16 @@ class TCPComm {
   // User defined handler for Handling received messages.
   MessageHandler message_handler_;
 
-  // All the connections share the same read and write event loop objects.
-  EventLoop *recv_event_loop_;
-  EventLoop *send_event_loop_;
+  // The connections are sharded by the hash of destination url, and the connections in the same shard share the same
+  // read and write event loop objects and the mutex for connection operations. The server socket is always handled by
+  // the recv event loop of the first shard.
+  std::vector<EventLoop *> recv_event_loops_;
+  std::vector<EventLoop *> send_event_loops_;
+  std::vector<std::shared_ptr<std::mutex>> conn_mutexes_;
 
   // The connection pool used to store new connections.
   std::shared_ptr<ConnectionPool> conn_pool_;
 
-  // The mutex for connection operations.
-  std::shared_ptr<std::mutex> conn_mutex_;
-
   // The method used to allocate memory when tcp servers of this TcpComm receive message from the remote.
   MemAllocateCallback allocate_cb_;
 
@@ -20,32 +20,33 @@
 #include <string>
 #include <memory>
 
+#include "distributed/rpc/rpc_server_base.h"
 #include "distributed/rpc/tcp/tcp_comm.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace distributed {
 namespace rpc {
-class TCPServer {
+class TCPServer : public RPCServerBase {
  public:
   explicit TCPServer(bool enable_ssl = false) : enable_ssl_(enable_ssl) {}
-  ~TCPServer() = default;
+  ~TCPServer() override = default;
 
   // Init the tcp server using the specified url.
-  bool Initialize(const std::string &url, const MemAllocateCallback &allocate_cb = {});
+  bool Initialize(const std::string &url, const MemAllocateCallback &allocate_cb = {}) override;
 
   // Init the tcp server using local IP and random port.
-  bool Initialize(const MemAllocateCallback &allocate_cb = {});
+  bool Initialize(const MemAllocateCallback &allocate_cb = {}) override;
 
   // Destroy the tcp server.
-  void Finalize();
+  void Finalize() override;
 
   // Set the message processing handler.
-  void SetMessageHandler(const MessageHandler &handler);
+  void SetMessageHandler(const MessageHandler &handler) override;
 
   // Return the IP and port binded by this server.
-  std::string GetIP() const;
-  uint32_t GetPort() const;
+  std::string GetIP() const override;
+  uint32_t GetPort() const override;
 
  private:
   bool InitializeImpl(const std::string &url, const MemAllocateCallback &allocate_cb);
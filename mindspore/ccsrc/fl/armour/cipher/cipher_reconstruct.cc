@@ -430,16 +430,22 @@ bool CipherReconStruct::GetSuvNoise(const std::vector<std::string> &clients_shar
         return false;
       }
       bool symbol_noise = GetSymbol(fl_id, *p_key);
-      size_t index = 0;
       size_t size_noise = noise_tmp.size();
+      if (size_noise > noise->size()) {
+        MS_LOG(ERROR) << "The size of pairwise noise " << size_noise << " exceeds the feature map size "
+                      << noise->size();
+        return false;
+      }
+      // Plain loops over the raw buffers without the bounds check of at(), so that they are vectorized.
+      float *noise_data = noise->data();
+      const float *noise_tmp_data = noise_tmp.data();
       if (symbol_noise == false) {
-        for (; index < size_noise; ++index) {
-          noise_tmp[index] = noise_tmp[index] * -1;
-          noise->at(index) += noise_tmp[index];
+        for (size_t index = 0; index < size_noise; ++index) {
+          noise_data[index] -= noise_tmp_data[index];
         }
       } else {
-        for (; index < size_noise; ++index) {
-          noise->at(index) += noise_tmp[index];
+        for (size_t index = 0; index < size_noise; ++index) {
+          noise_data[index] += noise_tmp_data[index];
         }
       }
     }
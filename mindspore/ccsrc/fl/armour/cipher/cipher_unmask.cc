@@ -18,9 +18,16 @@
 #include "fl/server/common.h"
 #include "fl/server/local_meta_store.h"
 #include "fl/armour/cipher/cipher_meta_storage.h"
+#include <algorithm>
+#include "include/common/thread_pool.h"
 
 namespace mindspore {
 namespace armour {
+namespace {
+// The number of parameters unmasked by one task.
+constexpr size_t kUnmaskNumPerTask = 65536;
+}  // namespace
+
 bool CipherUnmask::UnMask(const std::map<std::string, AddressPtr> &data) {
   MS_LOG(INFO) << "CipherMgr::UnMask START";
   clock_t start_time = clock();
@@ -37,6 +44,8 @@ bool CipherUnmask::UnMask(const std::map<std::string, AddressPtr> &data) {
     MS_LOG(ERROR) << "FedAvgTotalDataSize equals to 0";
     return false;
   }
+  // The unmasking of the parameters is split into the chunks which are run by the thread pool.
+  std::vector<common::Task> tasks;
   int sum_size = 0;
   for (auto iter = data.begin(); iter != data.end(); ++iter) {
     if (iter->second == nullptr) {
@@ -44,12 +53,28 @@ bool CipherUnmask::UnMask(const std::map<std::string, AddressPtr> &data) {
       return false;
     }
     size_t size_data = iter->second->size / sizeof(float);
+    if (IntToSize(sum_size) + size_data > noise.size()) {
+      MS_LOG(ERROR) << "The size of parameters exceeds the feature map size " << noise.size();
+      return false;
+    }
     float *in_data = reinterpret_cast<float *>(iter->second->addr);
-    for (size_t i = 0; i < size_data; ++i) {
-      in_data[i] = in_data[i] + noise[i + IntToSize(sum_size)] / data_size;
+    const float *noise_data = noise.data() + sum_size;
+    for (size_t offset = 0; offset < size_data; offset += kUnmaskNumPerTask) {
+      size_t end = std::min(offset + kUnmaskNumPerTask, size_data);
+      (void)tasks.emplace_back([in_data, noise_data, offset, end, data_size]() {
+        for (size_t i = offset; i < end; ++i) {
+          in_data[i] = in_data[i] + noise_data[i] / data_size;
+        }
+        return common::SUCCESS;
+      });
     }
     sum_size += SizeToInt(size_data);
-    for (size_t i = 0; i < data.size(); ++i) {
+  }
+  (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+  for (auto iter = data.begin(); iter != data.end(); ++iter) {
+    float *in_data = reinterpret_cast<float *>(iter->second->addr);
+    size_t size_data = iter->second->size / sizeof(float);
+    for (size_t i = 0; i < data.size() && i < size_data; ++i) {
       MS_LOG(INFO) << " index : " << i << " in_data unmask: " << in_data[i] * data_size;
     }
   }
@@ -15,6 +15,8 @@
  */
 
 #include "fl/armour/secure_protocol/masking.h"
+#include <algorithm>
+#include <atomic>
 
 namespace mindspore {
 namespace armour {
@@ -26,6 +28,48 @@ int Masking::GetMasking(std::vector<float> *noise, int noise_len, const uint8_t
 }
 
 #else
+namespace {
+// The number of noise values expanded by one task, 256KB of keystream.
+constexpr size_t kMaskingNumPerTask = 65536;
+constexpr size_t kNoiseNumPerBlock = AES_IV_SIZE / sizeof(int32_t);
+constexpr size_t kBitsPerByte = 8;
+constexpr size_t kByteMask = 0xFF;
+
+// Add the block number to the big-endian 128-bit counter, which is the same as the counter increment of AES-CTR.
+void AdvanceCounter(uint8_t *counter, size_t block_num) {
+  size_t carry = block_num;
+  for (int i = AES_IV_SIZE - 1; i >= 0 && carry != 0; --i) {
+    carry += counter[i];
+    counter[i] = static_cast<uint8_t>(carry & kByteMask);
+    carry >>= kBitsPerByte;
+  }
+}
+}  // namespace
+
+int Masking::GetMaskingChunk(float *noise, size_t offset, size_t len, const uint8_t *secret, int secret_len,
+                             const uint8_t *ivec) {
+  uint8_t counter[AES_IV_SIZE];
+  if (memcpy_s(counter, sizeof(counter), ivec, AES_IV_SIZE) != EOK) {
+    MS_LOG(ERROR) << "copy ivec failed!";
+    return -1;
+  }
+  AdvanceCounter(counter, offset / kNoiseNumPerBlock);
+  int size = SizeToInt(len * sizeof(int32_t));
+  std::vector<int32_t> data(len, 0);
+  std::vector<int32_t> encrypt_data(len, 0);
+  int encrypt_len = 0;
+  AESEncrypt encrypt(secret, secret_len, counter, AES_IV_SIZE, AES_CTR);
+  if (encrypt.EncryptData(reinterpret_cast<uint8_t *>(data.data()), size,
+                          reinterpret_cast<uint8_t *>(encrypt_data.data()), &encrypt_len) != 0) {
+    MS_LOG(ERROR) << "call AES-CTR failed!";
+    return -1;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    noise[i] = static_cast<float>(encrypt_data[i]) / INT32_MAX;
+  }
+  return 0;
+}
+
 int Masking::GetMasking(std::vector<float> *noise, int noise_len, const uint8_t *secret, int secret_len,
                         const uint8_t *ivec, int ivec_size) {
   if ((secret_len != KEY_LENGTH_16 && secret_len != KEY_LENGTH_32) || secret == nullptr) {
@@ -40,19 +84,26 @@ int Masking::GetMasking(std::vector<float> *noise, int noise_len, const uint8_t
     MS_LOG(ERROR) << "ivec is invalid!";
     return -1;
   }
-  int size = noise_len * sizeof(int);
-  std::vector<uint8_t> data(size, 0);
-  std::vector<uint8_t> encrypt_data(size, 0);
-  int encrypt_len = 0;
-  AESEncrypt encrypt(secret, secret_len, ivec, AES_IV_SIZE, AES_CTR);
-  if (encrypt.EncryptData(data.data(), size, encrypt_data.data(), &encrypt_len) != 0) {
-    MS_LOG(ERROR) << "call AES-CTR failed!";
-    return -1;
+  // The keystream is independent between the chunks in counter mode, so the chunks are expanded by the thread pool.
+  size_t total_len = IntToSize(noise_len);
+  size_t start = noise->size();
+  noise->resize(start + total_len);
+  float *noise_data = noise->data() + start;
+  std::atomic_bool success{true};
+  std::vector<common::Task> tasks;
+  for (size_t offset = 0; offset < total_len; offset += kMaskingNumPerTask) {
+    size_t len = std::min(kMaskingNumPerTask, total_len - offset);
+    (void)tasks.emplace_back([noise_data, offset, len, secret, secret_len, ivec, &success]() {
+      if (GetMaskingChunk(noise_data + offset, offset, len, secret, secret_len, ivec) != 0) {
+        success = false;
+      }
+      return common::SUCCESS;
+    });
   }
-
-  for (int i = 0; i < noise_len; i++) {
-    auto value = *(reinterpret_cast<int32_t *>(encrypt_data.data()) + i);
-    (void)noise->emplace_back(static_cast<float>(value) / INT32_MAX);
+  (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+  if (!success) {
+    noise->resize(start);
+    return -1;
   }
   return 0;
 }
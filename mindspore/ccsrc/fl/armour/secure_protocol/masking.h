@@ -19,6 +19,8 @@
 
 #include <random>
 #include <vector>
+#include "include/common/thread_pool.h"
+#include "utils/convert_utils_base.h"
 #include "fl/armour/secure_protocol/encrypt.h"
 
 namespace mindspore {
@@ -28,6 +30,12 @@ class Masking {
  public:
   static int GetMasking(std::vector<float> *noise, int noise_len, const uint8_t *secret, int secret_len,
                         const uint8_t *ivec, int ivec_size);
+
+ private:
+  // Expand the AES-CTR keystream of the noise chunk [offset, offset + len) of the masking, the counter of the chunk
+  // is the initial vector advanced by the AES blocks before the offset, so that the chunks are expanded in parallel.
+  static int GetMaskingChunk(float *noise, size_t offset, size_t len, const uint8_t *secret, int secret_len,
+                             const uint8_t *ivec);
 };
 }  // namespace armour
 }  // namespace mindspore
@@ -15,10 +15,49 @@
  */
 
 #include "fl/compression/decode_executor.h"
+#include "fl/compression/encode_executor.h"
 
 namespace mindspore {
 namespace fl {
 namespace compression {
+namespace {
+constexpr uint8_t kVarintPayloadMask = 0x7f;
+constexpr uint8_t kVarintContinueFlag = 0x80;
+constexpr size_t kVarintPayloadBits = 7;
+constexpr size_t kVarintMaxByteNum = 10;
+constexpr uint8_t kNibbleMask = 0x0f;
+constexpr size_t kNibbleBits = 4;
+constexpr size_t kNibbleNumPerByte = 2;
+
+bool CheckStochasticQuant(const CompressFeatureMap &compress_feature_map, size_t num_bits, size_t value_num) {
+  if (num_bits != kStochasticQuantBits8 && num_bits != kStochasticQuantBits4) {
+    MS_LOG(WARNING) << "The bit number of the stochastic quantization should be 8 or 4, but got " << num_bits;
+    return false;
+  }
+  size_t data_num = num_bits == kStochasticQuantBits8 ? value_num : (value_num + 1) / kNibbleNumPerByte;
+  if (compress_feature_map.compress_data.size() != data_num) {
+    MS_LOG(WARNING) << "The size of the compressed data of " << value_num << " values should be " << data_num
+                    << ", but got " << compress_feature_map.compress_data.size();
+    return false;
+  }
+  return true;
+}
+
+// The quantized level of the i-th value in [0, 2^num_bits - 1].
+inline size_t QuantLevel(const std::vector<int8_t> &compress_data, size_t i, size_t num_bits) {
+  if (num_bits == kStochasticQuantBits8) {
+    return static_cast<size_t>(static_cast<int>(compress_data[i]) + (1 << (num_bits - 1)));
+  }
+  auto byte = static_cast<uint8_t>(compress_data[i / kNibbleNumPerByte]);
+  return static_cast<size_t>((byte >> ((i % kNibbleNumPerByte) * kNibbleBits)) & kNibbleMask);
+}
+
+inline float QuantScale(const CompressFeatureMap &compress_feature_map, size_t num_bits) {
+  return (compress_feature_map.max_val - compress_feature_map.min_val) / (static_cast<float>(1 << num_bits) - 1.0f) +
+         1e-10f;
+}
+}  // namespace
+
 std::vector<int> DecodeExecutor::ConstructMaskArray(int seed, float upload_sparse_rate, size_t param_num) const {
   static const int multiplier = 2147483647;
   static const double increment = 4294967294.0;
@@ -51,76 +90,85 @@ bool DecodeExecutor::DeQuantSparseDiff(std::map<std::string, std::vector<float>>
                                        const std::vector<CompressFeatureMap> &compress_feature_maps, size_t num_bits,
                                        float upload_sparse_rate, int seed, const std::vector<std::string> &name_vec,
                                        size_t data_size) {
-  std::vector<std::vector<float>> decompress_feature_maps;
-
-  // origin parameters
-  std::vector<size_t> shape_vec;
-  size_t param_num = 0;
   const auto &iter_to_model = mindspore::fl::server::ModelStore::GetInstance().iteration_to_model();
   size_t latest_iter_num = iter_to_model.rbegin()->first;
   std::map<std::string, AddressPtr> feature_maps =
     mindspore::fl::server::ModelStore::GetInstance().GetModelByIterNum(latest_iter_num);
+  return DeQuantSparseDiff(weight_map, compress_feature_maps, num_bits, upload_sparse_rate, seed, name_vec, data_size,
+                           feature_maps);
+}
+
+bool DecodeExecutor::DeQuantSparseDiff(std::map<std::string, std::vector<float>> *weight_map,
+                                       const std::vector<CompressFeatureMap> &compress_feature_maps, size_t num_bits,
+                                       float upload_sparse_rate, int seed, const std::vector<std::string> &name_vec,
+                                       size_t data_size, const std::map<std::string, AddressPtr> &feature_maps) {
+  MS_EXCEPTION_IF_NULL(weight_map);
+  // origin parameters
+  std::vector<size_t> shape_vec;
+  std::vector<float *> weight_data_vec;
+  size_t param_num = 0;
   // get shape vector and number of upload parameters
   for (const auto &name : name_vec) {
-    size_t shape = feature_maps[name]->size / sizeof(float);
+    auto iter = feature_maps.find(name);
+    if (iter == feature_maps.end() || iter->second == nullptr) {
+      MS_LOG(WARNING) << "The last weights have no parameter " << name;
+      return false;
+    }
+    size_t shape = iter->second->size / sizeof(float);
     (void)shape_vec.emplace_back(shape);
+    (void)weight_data_vec.emplace_back(reinterpret_cast<float *>(iter->second->addr));
     param_num += shape;
   }
   MS_LOG(DEBUG) << "Compression get last weights success!";
 
-  // quant decode
+  // The quant, sparse and difference decoding are fused in one pass, which writes each parameter to the weight map
+  // directly instead of materializing the dequantized and the desparsified copies of all the parameters.
   auto temp1 = static_cast<float>(1 << num_bits) - 1.0f;
   auto temp2 = static_cast<float>(1 << (num_bits - 1));
-  std::vector<float> de_min_max_feature_map;
-  for (auto compress_feature_map : compress_feature_maps) {
-    float min_val = compress_feature_map.min_val;
-    float max_val = compress_feature_map.max_val;
-    float scale_val = static_cast<float>(max_val - min_val) / temp1 + 1e-10f;
-    size_t size = compress_feature_map.compress_data.size();
-    for (size_t i = 0; i < size; ++i) {
-      (void)de_min_max_feature_map.emplace_back(
-        (static_cast<float>(compress_feature_map.compress_data[i]) + temp2) * scale_val + min_val);
+  size_t compress_map_index = 0;
+  size_t compress_data_index = 0;
+  float scale_val = 0.0f;
+  auto next_dequant_value = [&compress_feature_maps, &compress_map_index, &compress_data_index, &scale_val, temp1,
+                             temp2](float *value) {
+    while (compress_map_index < compress_feature_maps.size() &&
+           compress_data_index >= compress_feature_maps[compress_map_index].compress_data.size()) {
+      ++compress_map_index;
+      compress_data_index = 0;
     }
-  }
-  MS_LOG(DEBUG) << "Compression quant decode success!";
+    if (compress_map_index >= compress_feature_maps.size()) {
+      return false;
+    }
+    const auto &compress_feature_map = compress_feature_maps[compress_map_index];
+    if (compress_data_index == 0) {
+      scale_val = static_cast<float>(compress_feature_map.max_val - compress_feature_map.min_val) / temp1 + 1e-10f;
+    }
+    *value = (static_cast<float>(compress_feature_map.compress_data[compress_data_index]) + temp2) * scale_val +
+             compress_feature_map.min_val;
+    ++compress_data_index;
+    return true;
+  };
 
-  // sparse decode
   std::vector<int> mask_array = ConstructMaskArray(seed, upload_sparse_rate, param_num);
   size_t index = 0;
-  size_t de_min_max_feature_map_index = 0;
-  for (const auto &shape : shape_vec) {
-    std::vector<float> feature_map(shape);
-    for (size_t i = 0; i < shape; ++i) {
+  for (size_t i = 0; i < shape_vec.size(); ++i) {
+    size_t feature_size = shape_vec[i];
+    const std::string &name = name_vec[i];
+    float *weight_data = weight_data_vec[i];
+    auto &weight_item = (*weight_map)[name];
+    weight_item.resize(feature_size);
+    for (size_t j = 0; j < feature_size; ++j) {
       if (index >= mask_array.size()) {
         MS_LOG(WARNING) << "The mask_array and parameter shape is not matched.";
         return false;
       }
-      if (mask_array[index] == 1) {
-        if (de_min_max_feature_map_index >= de_min_max_feature_map.size()) {
-          MS_LOG(WARNING) << "The number of upload parameters is too small.";
-          return false;
-        }
-        feature_map[i] = de_min_max_feature_map[de_min_max_feature_map_index];
-        de_min_max_feature_map_index += 1;
-      } else {
-        feature_map[i] = 0.0f;
+      float value = 0.0f;
+      if (mask_array[index] == 1 && !next_dequant_value(&value)) {
+        MS_LOG(WARNING) << "The number of upload parameters is too small.";
+        return false;
       }
+      weight_item[j] = value + data_size * weight_data[j];
       index += 1;
     }
-    (void)decompress_feature_maps.emplace_back(feature_map);
-  }
-  MS_LOG(DEBUG) << "Compression sparse decode success!";
-
-  // difference decode
-  for (size_t i = 0; i < decompress_feature_maps.size(); ++i) {
-    size_t feature_size = decompress_feature_maps[i].size();
-    std::string name = name_vec[i];
-    float *weight_data = reinterpret_cast<float *>(feature_maps[name]->addr);
-    auto &weight_item = (*weight_map)[name];
-    weight_item.resize(feature_size);
-    for (size_t j = 0; j < feature_size; ++j) {
-      weight_item[j] = decompress_feature_maps[i][j] + data_size * weight_data[j];
-    }
   }
   MS_LOG(DEBUG) << "Compression difference decode success!";
 
@@ -137,6 +185,102 @@ bool DecodeExecutor::Decode(std::map<std::string, std::vector<float>> *weight_ma
   return false;
 }
 
+bool DecodeExecutor::DeQuantStochastic(const CompressFeatureMap &compress_feature_map, size_t num_bits,
+                                       size_t value_num, std::vector<float> *values) const {
+  MS_ERROR_IF_NULL_W_RET_VAL(values, false);
+  if (!CheckStochasticQuant(compress_feature_map, num_bits, value_num)) {
+    return false;
+  }
+  float scale_val = QuantScale(compress_feature_map, num_bits);
+  values->resize(value_num);
+  for (size_t i = 0; i < value_num; ++i) {
+    (*values)[i] = static_cast<float>(QuantLevel(compress_feature_map.compress_data, i, num_bits)) * scale_val +
+                   compress_feature_map.min_val;
+  }
+  return true;
+}
+
+bool DecodeExecutor::DecodeTopKIndices(const std::vector<int8_t> &index_data, size_t index_num, size_t param_num,
+                                       std::vector<size_t> *indices) const {
+  MS_ERROR_IF_NULL_W_RET_VAL(indices, false);
+  indices->resize(index_num);
+  size_t pos = 0;
+  size_t index = 0;
+  for (size_t i = 0; i < index_num; ++i) {
+    size_t delta = 0;
+    size_t byte_num = 0;
+    uint8_t byte = kVarintContinueFlag;
+    while ((byte & kVarintContinueFlag) != 0) {
+      if (pos >= index_data.size() || byte_num == kVarintMaxByteNum) {
+        MS_LOG(WARNING) << "The index data of top-k is truncated or corrupted.";
+        return false;
+      }
+      byte = static_cast<uint8_t>(index_data[pos++]);
+      delta |= static_cast<size_t>(byte & kVarintPayloadMask) << (byte_num++ * kVarintPayloadBits);
+    }
+    // The indices are strictly ascending, so only the first delta can be zero.
+    if ((i != 0 && delta == 0) || delta >= param_num - index) {
+      MS_LOG(WARNING) << "The index of top-k is out of order or out of the parameter size " << param_num;
+      return false;
+    }
+    index += delta;
+    (*indices)[i] = index;
+  }
+  if (pos != index_data.size()) {
+    MS_LOG(WARNING) << "The index data of top-k has " << (index_data.size() - pos) << " redundant bytes.";
+    return false;
+  }
+  return true;
+}
+
+bool CompressAggregator::AccumulateQuant(const CompressFeatureMap &compress_feature_map, size_t num_bits,
+                                         size_t data_size) {
+  if (!CheckStochasticQuant(compress_feature_map, num_bits, sum_.size())) {
+    return false;
+  }
+  float scale_val = QuantScale(compress_feature_map, num_bits);
+  for (size_t i = 0; i < sum_.size(); ++i) {
+    sum_[i] += static_cast<float>(QuantLevel(compress_feature_map.compress_data, i, num_bits)) * scale_val;
+  }
+  offset_sum_ += compress_feature_map.min_val;
+  data_size_sum_ += data_size;
+  return true;
+}
+
+bool CompressAggregator::AccumulateTopK(const std::vector<int8_t> &index_data, size_t index_num,
+                                        const CompressFeatureMap &compress_feature_map, size_t num_bits,
+                                        size_t data_size) {
+  std::vector<size_t> indices;
+  if (!DecodeExecutor::GetInstance().DecodeTopKIndices(index_data, index_num, sum_.size(), &indices) ||
+      !CheckStochasticQuant(compress_feature_map, num_bits, index_num)) {
+    return false;
+  }
+  float scale_val = QuantScale(compress_feature_map, num_bits);
+  for (size_t i = 0; i < index_num; ++i) {
+    sum_[indices[i]] += static_cast<float>(QuantLevel(compress_feature_map.compress_data, i, num_bits)) * scale_val +
+                        compress_feature_map.min_val;
+  }
+  data_size_sum_ += data_size;
+  return true;
+}
+
+bool CompressAggregator::Finalize(const float *last_weight, size_t param_num, std::vector<float> *aggregate) const {
+  MS_ERROR_IF_NULL_W_RET_VAL(last_weight, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(aggregate, false);
+  if (param_num != sum_.size()) {
+    MS_LOG(WARNING) << "The size of the last weights " << param_num << " is not the same as the aggregation "
+                    << sum_.size();
+    return false;
+  }
+  auto offset = static_cast<float>(offset_sum_);
+  auto data_size_sum = static_cast<float>(data_size_sum_);
+  aggregate->resize(param_num);
+  for (size_t i = 0; i < param_num; ++i) {
+    (*aggregate)[i] = sum_[i] + offset + data_size_sum * last_weight[i];
+  }
+  return true;
+}
+
 schema::CompressType DecodeExecutor::GetCompressType(schema::CompressType upload_compress_type) const {
   if (upload_compress_type == schema::CompressType_DIFF_SPARSE_QUANT) {
     MS_LOG(DEBUG) << "This upload compress type is DIFF_SPARSE_QUANT.";
@@ -60,6 +60,12 @@ class DecodeExecutor {
                          float upload_sparse_rate, int seed, const std::vector<std::string> &name_vec,
                          size_t data_size);
 
+  // decode the upload parameters by the given last weights instead of the latest model in the model store
+  bool DeQuantSparseDiff(std::map<std::string, std::vector<float>> *weight_map,
+                         const std::vector<CompressFeatureMap> &compress_feature_maps, size_t num_bits,
+                         float upload_sparse_rate, int seed, const std::vector<std::string> &name_vec,
+                         size_t data_size, const std::map<std::string, AddressPtr> &feature_maps);
+
   // decode
   bool Decode(std::map<std::string, std::vector<float>> *weight_map,
               const std::vector<CompressFeatureMap> &compress_feature_maps, schema::CompressType upload_compress_type,
@@ -67,10 +73,45 @@ class DecodeExecutor {
 
   schema::CompressType GetCompressType(schema::CompressType upload_compress_type) const;
 
+  // decode the value_num values of the 8-bit or 4-bit stochastic quantization
+  bool DeQuantStochastic(const CompressFeatureMap &compress_feature_map, size_t num_bits, size_t value_num,
+                         std::vector<float> *values) const;
+
+  // decode the index_num ascending indices of top-k from the varints of their differences, which are less than
+  // param_num
+  bool DecodeTopKIndices(const std::vector<int8_t> &index_data, size_t index_num, size_t param_num,
+                         std::vector<size_t> *indices) const;
+
  private:
   DecodeExecutor() = default;
   ~DecodeExecutor() = default;
 };
+
+// Sum the uploads of a parameter in the compressed domain instead of decoding each upload to dense weights first.
+// The quantized levels are accumulated with their scales and the minimum of a dense upload is summed once as a
+// scalar, and a top-k upload only touches its kept indices. As for DIFF_SPARSE_QUANT, each upload is the difference
+// from the last weights weighted by the data size, so the result is the sum of the data size weighted new weights,
+// which is the input of the federated average.
+class CompressAggregator {
+ public:
+  explicit CompressAggregator(size_t param_num) : sum_(param_num, 0.0f) {}
+  ~CompressAggregator() = default;
+
+  // accumulate a dense upload of the stochastic quantization
+  bool AccumulateQuant(const CompressFeatureMap &compress_feature_map, size_t num_bits, size_t data_size);
+
+  // accumulate a top-k upload, whose index_num kept values are stochastically quantized
+  bool AccumulateTopK(const std::vector<int8_t> &index_data, size_t index_num,
+                      const CompressFeatureMap &compress_feature_map, size_t num_bits, size_t data_size);
+
+  // write the sum of the new weights of all the accumulated uploads
+  bool Finalize(const float *last_weight, size_t param_num, std::vector<float> *aggregate) const;
+
+ private:
+  std::vector<float> sum_;
+  double offset_sum_{0.0};
+  size_t data_size_sum_{0};
+};
 }  // namespace compression
 }  // namespace fl
 }  // namespace mindspore
@@ -17,9 +17,12 @@
 #include "fl/compression/encode_executor.h"
 
 #include <arpa/inet.h>
+#include <cmath>
 #include <cstring>
 #include <functional>
 #include <algorithm>
+#include <numeric>
+#include <random>
 #include <regex>
 #include <map>
 #include <utility>
@@ -29,6 +32,22 @@
 namespace mindspore {
 namespace fl {
 namespace compression {
+namespace {
+constexpr uint8_t kVarintPayloadMask = 0x7f;
+constexpr uint8_t kVarintContinueFlag = 0x80;
+constexpr size_t kVarintPayloadBits = 7;
+constexpr size_t kNibbleBits = 4;
+constexpr size_t kNibbleNumPerByte = 2;
+
+void AppendVarint(size_t value, std::vector<int8_t> *data) {
+  while (value > kVarintPayloadMask) {
+    data->push_back(static_cast<int8_t>((value & kVarintPayloadMask) | kVarintContinueFlag));
+    value >>= kVarintPayloadBits;
+  }
+  data->push_back(static_cast<int8_t>(value));
+}
+}  // namespace
+
 bool CompressExecutor::EnableCompressWeight(const schema::CompressType compressType) const {
   return kCompressTypeMap.count(compressType) > 0;
 }
@@ -80,6 +99,78 @@ bool CompressExecutor::quant_min_max(std::map<std::string, CompressWeight> *comp
   return true;
 }
 
+bool CompressExecutor::StochasticQuant(const std::vector<float> &values, size_t num_bits, uint32_t seed,
+                                       CompressWeight *compress_weight) const {
+  MS_ERROR_IF_NULL_W_RET_VAL(compress_weight, false);
+  if (num_bits != kStochasticQuantBits8 && num_bits != kStochasticQuantBits4) {
+    MS_LOG(WARNING) << "The bit number of the stochastic quantization should be 8 or 4, but got " << num_bits;
+    return false;
+  }
+  if (values.empty()) {
+    MS_LOG(WARNING) << "The size of parameters is zero.";
+    return false;
+  }
+  auto minmax = std::minmax_element(values.begin(), values.end());
+  float min_value = *minmax.first;
+  float max_value = *minmax.second;
+  if (!std::isfinite(min_value) || !std::isfinite(max_value)) {
+    MS_LOG(WARNING) << "The parameters to quantize have inf or nan.";
+    return false;
+  }
+  auto max_level = static_cast<float>(1 << num_bits) - 1.0f;
+  float scale_value = (max_value - min_value) / max_level + 1e-10f;
+  std::mt19937 generator(seed);
+  std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+  compress_weight->compress_data.assign(num_bits == kStochasticQuantBits8 ? values.size()
+                                                                           : (values.size() + 1) / kNibbleNumPerByte,
+                                        0);
+  for (size_t i = 0; i < values.size(); ++i) {
+    // Round down or up with the probability of the distance to the other level.
+    auto level = std::floor((values[i] - min_value) / scale_value + distribution(generator));
+    auto quant_level = static_cast<uint8_t>(std::min(std::max(level, 0.0f), max_level));
+    if (num_bits == kStochasticQuantBits8) {
+      compress_weight->compress_data[i] = static_cast<int8_t>(quant_level - (1 << (num_bits - 1)));
+    } else {
+      auto &byte = compress_weight->compress_data[i / kNibbleNumPerByte];
+      byte = static_cast<int8_t>(static_cast<uint8_t>(byte) | (quant_level << ((i % kNibbleNumPerByte) * kNibbleBits)));
+    }
+  }
+  compress_weight->compress_data_len = values.size();
+  compress_weight->min_val = min_value;
+  compress_weight->max_val = max_value;
+  return true;
+}
+
+bool CompressExecutor::TopKSparse(const std::vector<float> &values, size_t k, size_t num_bits, uint32_t seed,
+                                  TopKCompressWeight *compress_weight) const {
+  MS_ERROR_IF_NULL_W_RET_VAL(compress_weight, false);
+  if (k == 0 || k > values.size()) {
+    MS_LOG(WARNING) << "The k of top-k should be in [1, " << values.size() << "], but got " << k;
+    return false;
+  }
+  std::vector<size_t> indices(values.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  auto larger_magnitude = [&values](size_t lhs, size_t rhs) {
+    return std::abs(values[lhs]) > std::abs(values[rhs]) ||
+           (std::abs(values[lhs]) == std::abs(values[rhs]) && lhs < rhs);
+  };
+  std::nth_element(indices.begin(), indices.begin() + SizeToLong(k) - 1, indices.end(), larger_magnitude);
+  indices.resize(k);
+  std::sort(indices.begin(), indices.end());
+
+  compress_weight->index_data.clear();
+  std::vector<float> kept_values(k);
+  size_t last_index = 0;
+  for (size_t i = 0; i < k; ++i) {
+    AppendVarint(indices[i] - last_index, &compress_weight->index_data);
+    last_index = indices[i];
+    kept_values[i] = values[indices[i]];
+  }
+  compress_weight->index_num = k;
+  return StochasticQuant(kept_values, num_bits, seed, &compress_weight->value_weight);
+}
+
 schema::CompressType CompressExecutor::GetCompressType(
   const flatbuffers::Vector<int8_t> *download_compress_types) const {
   schema::CompressType compressType = schema::CompressType_NO_COMPRESS;
@@ -36,6 +36,11 @@ namespace compression {
 // compress type map: schema::CompressType -> num bits
 const std::map<schema::CompressType, size_t> kCompressTypeMap = {{schema::CompressType_QUANT, 8}};
 
+// The bit numbers of the stochastic quantization, the 4-bit values are packed two per byte with the first one in the
+// low nibble.
+constexpr size_t kStochasticQuantBits8 = 8;
+constexpr size_t kStochasticQuantBits4 = 4;
+
 struct CompressWeight {
   std::vector<int8_t> compress_data;
   size_t compress_data_len;
@@ -43,6 +48,14 @@ struct CompressWeight {
   float max_val;
 };
 
+// The top-k upload of a parameter: the ascending indices of the kept values are encoded as the varints of their
+// differences, the first one is the index itself, and the kept values are quantized in value_weight.
+struct TopKCompressWeight {
+  std::vector<int8_t> index_data;
+  size_t index_num;
+  CompressWeight value_weight;
+};
+
 class CompressExecutor {
  public:
   CompressExecutor() = default;
@@ -63,6 +76,15 @@ class CompressExecutor {
                      std::map<std::string, std::vector<float>> feature_maps, size_t num_bits) const;
 
   schema::CompressType GetCompressType(const flatbuffers::Vector<int8_t> *download_compress_types) const;
+
+  // quantize the values to 8 or 4 bits by stochastic rounding, which is unbiased: the expectation of each dequantized
+  // value is the value itself
+  bool StochasticQuant(const std::vector<float> &values, size_t num_bits, uint32_t seed,
+                       CompressWeight *compress_weight) const;
+
+  // keep the k values with the largest magnitude, delta encode their indices and stochastically quantize them
+  bool TopKSparse(const std::vector<float> &values, size_t k, size_t num_bits, uint32_t seed,
+                  TopKCompressWeight *compress_weight) const;
 };
 }  // namespace compression
 }  // namespace fl
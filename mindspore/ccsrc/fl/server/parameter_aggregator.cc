@@ -109,6 +109,69 @@ bool ParameterAggregator::LaunchAggregators() {
   return true;
 }
 
+bool ParameterAggregator::LaunchAggregatorsWithData(const std::map<std::string, Address> &new_data) {
+  MS_ERROR_IF_NULL_W_RET_VAL(memory_register_, false);
+  std::map<std::string, AddressPtr> &name_to_addr = memory_register_->addresses();
+  std::map<std::string, Address> data_to_copy;
+  std::map<std::string, AddressPtr> data_in_place;
+  for (const auto &data : new_data) {
+    const std::string &name = data.first;
+    if (name_to_addr.count(name) == 0) {
+      continue;
+    }
+    MS_ERROR_IF_NULL_W_RET_VAL(name_to_addr[name], false);
+    MS_ERROR_IF_NULL_W_RET_VAL(data.second.addr, false);
+    if (name_to_addr[name]->size == data.second.size && IsAggregatorOnlyInput(name)) {
+      data_in_place[name] = std::make_shared<Address>(data.second);
+    } else {
+      data_to_copy[name] = data.second;
+    }
+  }
+  if (!UpdateData(data_to_copy)) {
+    return false;
+  }
+
+  for (auto &aggregator_with_params : aggregation_kernel_parameters_) {
+    std::shared_ptr<kernel::AggregationKernelMod> aggr_kernel = aggregator_with_params.first;
+    MS_ERROR_IF_NULL_W_RET_VAL(aggr_kernel, false);
+    const KernelParams &params = aggregator_with_params.second;
+    std::vector<AddressPtr> inputs = params.inputs;
+    const std::vector<std::string> &input_names = aggr_kernel->input_names();
+    for (size_t i = 0; i < input_names.size() && i < inputs.size(); ++i) {
+      auto iter = data_in_place.find(input_names[i]);
+      if (iter != data_in_place.end()) {
+        inputs[i] = iter->second;
+      }
+    }
+    if (!aggr_kernel->Launch(inputs, params.workspace, params.outputs)) {
+      MS_LOG(ERROR) << "Launching aggregation kernel " << typeid(aggr_kernel.get()).name() << " failed.";
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ParameterAggregator::IsAggregatorOnlyInput(const std::string &name) const {
+  if (name == kWeight) {
+    return false;
+  }
+  auto has_name = [&name](const std::vector<std::string> &names) {
+    return std::find(names.begin(), names.end(), name) != names.end();
+  };
+  bool is_aggregator_input = std::any_of(aggregation_kernel_parameters_.begin(), aggregation_kernel_parameters_.end(),
+                                         [&has_name](const auto &aggregator_with_params) {
+                                           return has_name(aggregator_with_params.first->input_names());
+                                         });
+  bool is_optimizer_data = std::any_of(optimizer_kernel_parameters_.begin(), optimizer_kernel_parameters_.end(),
+                                       [&has_name](const auto &optimizer_with_params) {
+                                         auto &optimizer = optimizer_with_params.first;
+                                         return has_name(optimizer->input_names()) ||
+                                                has_name(optimizer->workspace_names()) ||
+                                                has_name(optimizer->output_names());
+                                       });
+  return is_aggregator_input && !is_optimizer_data;
+}
+
 AddressPtr ParameterAggregator::GetWeight() {
   if (memory_register_ == nullptr) {
     MS_LOG(ERROR)
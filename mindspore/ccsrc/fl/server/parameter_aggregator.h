@@ -78,6 +78,11 @@ class ParameterAggregator {
   // Launch aggregators/optimizers of this ParameterAggregator in order.
   bool LaunchAggregators();
 
+  // Launch the aggregators with the new data, the inputs only read by the aggregators are read from the new data in
+  // place, so that each update is folded into the aggregated data on arrival without being copied to the memory of
+  // ParameterAggregator first. The other data is updated as UpdateData does.
+  bool LaunchAggregatorsWithData(const std::map<std::string, Address> &new_data);
+
   // Different from the method Pull, this method simply returns the weight of this ParameterAggregator without causing
   // any change of status.
   AddressPtr GetWeight();
@@ -122,6 +127,9 @@ class ParameterAggregator {
   // Judge whether the parameter needs to be aggregated.
   bool JudgeRequiredAggr(const CNodePtr &cnode);
 
+  // Whether the data is only used as the input of the aggregators, which can be read from the uploaded data in place.
+  bool IsAggregatorOnlyInput(const std::string &name) const;
+
   ServerMode server_mode_;
   size_t required_push_count_;
   size_t required_pull_count_;
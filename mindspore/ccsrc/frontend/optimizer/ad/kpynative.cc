@@ -310,6 +310,8 @@ class KPynativeCellImpl : public KPynativeCell {
   AnfNodePtrList cell_inputs_;
   // These weights need to calculate gradient.
   mindspore::HashSet<AnfNodePtr> need_grad_weights_;
+  // These cnodes depend on none of the inputs and weights which need gradient, so their gradients are dead.
+  mindspore::HashSet<AnfNodePtr> dead_grad_cnodes_;
   OrderedMap<AnfNodePtr, PynativeAdjointPtr> anfnode_to_adjoin_;
 
   // For CNode like TupleGetItem, ListGetItem, MakeTuple, MakeList, it's bypassed by caller so
@@ -321,6 +323,9 @@ class KPynativeCellImpl : public KPynativeCell {
                     const PynativeAdjoint::FuncGraphType fg_type = PynativeAdjoint::FuncGraphType::kBackwardPropagate);
   void BuildAdjointForInput(const CNodePtr &cnode, const ValuePtrList &op_args);
   void PropagateStopGradient();
+  // Find the cnodes with dead gradients, they are skipped in back propagate.
+  void PruneDeadGradient();
+  bool NeedGrad(const AnfNodePtr &node) const;
   bool AllReferencesStopped(const CNodePtr &curr_cnode);
   OrderedMap<AnfNodePtr, PynativeAdjointPtr>::reverse_iterator GetLastNodeReverseIter();
   // Back propagate for all node;
@@ -384,6 +389,8 @@ FuncGraphPtr KPynativeCellImpl::Finish(const AnfNodePtrList &weights, const std:
   PropagateStopGradient();
   // Set sens node and weights node
   SetSensAndWeights(weights, has_sens_arg);
+  // Skip the back propagate of the cnodes which the inputs and weights needing gradient do not flow through;
+  PruneDeadGradient();
   // Build forward CNode;
   if (build_formal_param) {
     (void)BuildKNode();
@@ -706,6 +713,10 @@ bool KPynativeCellImpl::BackPropagate(const CNodePtr &cnode_primal, const CNodeP
       MS_LOG(DEBUG) << "Bypass accumulate dout to cnode with stop_gradient flag, cnode: " << input->DebugString();
       continue;
     }
+    if (dead_grad_cnodes_.find(input) != dead_grad_cnodes_.end()) {
+      MS_LOG(DEBUG) << "Bypass accumulate dout to cnode with dead gradient, cnode: " << input->DebugString();
+      continue;
+    }
     // Backprop sens wrt inputs.
     const auto &input_adjoint_iter = anfnode_to_adjoin_.find(input);
     if (input_adjoint_iter == anfnode_to_adjoin_.end()) {
@@ -869,6 +880,10 @@ bool KPynativeCellImpl::BackPropagate(bool by_value) {
       MS_LOG(DEBUG) << "Bypass backpropagate for cnode with stop_gradient flag: " << cnode->DebugString();
       continue;
     }
+    if (dead_grad_cnodes_.find(cnode) != dead_grad_cnodes_.end()) {
+      MS_LOG(DEBUG) << "Bypass backpropagate for cnode with dead gradient: " << cnode->DebugString();
+      continue;
+    }
     MS_LOG(DEBUG) << "BackPropagate for CNode: " << cnode->DebugString();
     auto fg = iter->second->fg();
     auto fg_type = iter->second->fg_type();
@@ -924,6 +939,42 @@ void KPynativeCellImpl::PropagateStopGradient() {
   }
 }
 
+bool KPynativeCellImpl::NeedGrad(const AnfNodePtr &node) const {
+  MS_EXCEPTION_IF_NULL(node);
+  if (node->isa<CNode>()) {
+    return dead_grad_cnodes_.find(node) == dead_grad_cnodes_.end();
+  }
+  if (node->isa<Parameter>()) {
+    // The input parameter always needs gradient, and the weight needs gradient only if it is required.
+    bool is_weight = node->cast<ParameterPtr>()->has_default();
+    return !is_weight || need_grad_weights_.find(node) != need_grad_weights_.end();
+  }
+  return false;
+}
+
+void KPynativeCellImpl::PruneDeadGradient() {
+  // The adjoints are recorded in the execution order, so the inputs of a cnode are always visited before it.
+  dead_grad_cnodes_.clear();
+  for (const auto &iter : anfnode_to_adjoin_) {
+    const auto &node = iter.first;
+    if (!node->isa<CNode>()) {
+      continue;
+    }
+    auto cnode = node->cast<CNodePtr>();
+    // The hook functions should be called even if the gradient is dead.
+    if (IsPrimitiveCNode(cnode, prim::kPrimHookBackward) || IsPrimitiveCNode(cnode, prim::kPrimCellBackwardHook)) {
+      continue;
+    }
+    const auto &inputs = cnode->inputs();
+    bool need_grad =
+      std::any_of(inputs.cbegin() + 1, inputs.cend(), [this](const AnfNodePtr &input) { return NeedGrad(input); });
+    if (!need_grad) {
+      MS_LOG(DEBUG) << "The gradient of cnode is dead: " << cnode->DebugString();
+      (void)dead_grad_cnodes_.insert(cnode);
+    }
+  }
+}
+
 FuncGraphPtr KPynativeCellImpl::BuildBPropCutFuncGraph(const PrimitivePtr &prim, const CNodePtr &cnode) const {
   auto inputs_num = cnode->size() - 1;
 
@@ -24,6 +24,7 @@
 #include "ir/func_graph.h"
 #include "frontend/operator/ops.h"
 #include "include/common/utils/convert_utils.h"
+#include "include/common/utils/utils.h"
 
 namespace mindspore {
 namespace opt {
@@ -31,6 +32,18 @@ namespace irpass {
 constexpr size_t kCondIndex = 1;
 constexpr size_t kTrueBranchIndex = 2;
 constexpr size_t kFalseBranchIndex = 3;
+// Max number of cnodes in a branch graph which is converted to select.
+constexpr size_t kMaxSelectBranchNodes = 8;
+// Select runs both branches and propagates the gradient to both of them, the gradient of the branch not taken is zero,
+// but zero times an inf or nan derivative is nan. So only the ops whose outputs and derivatives are finite for the
+// finite inputs are converted, for example log(x) guarded by x > 0 is not.
+const PrimitiveSet kSelectBranchPrims = {prim::kPrimAdd,        prim::kPrimSub,         prim::kPrimMul,
+                                         prim::kPrimNeg,        prim::kPrimAbs,         prim::kPrimMaximum,
+                                         prim::kPrimMinimum,    prim::kPrimSquare,      prim::kPrimRelu,
+                                         prim::kPrimCast,       prim::kPrimReshape,     prim::kPrimTranspose,
+                                         prim::kPrimExpandDims, prim::kPrimSqueeze,     prim::kPrimZerosLike,
+                                         prim::kPrimOnesLike,   prim::kPrimAddN,        prim::kPrimSelect,
+                                         prim::kPrimBroadcastTo, prim::kPrimIdentity};
 namespace internal {
 AnfNodePtr GenerateSwitchNode(const FuncGraphPtr &graph, const AnfNodePtr &cond, const AnfNodePtr &data,
                               int64_t switch_idx) {
@@ -628,6 +641,106 @@ void ConvertSwitchReplacement::TransformSwitchBranchReplace(const AnfNodePtr &no
   auto new_node = internal::TransformMergeBranches({cond, cloned_g1, cloned_g2}, {true_output, false_output}, fg);
   (void)fg->manager()->Replace(node, new_node);
 }
+
+bool SwitchSmallBranchToSelect::CheckSmallBranch(const AnfNodePtr &node) const {
+  if (!IsValueNode<FuncGraph>(node)) {
+    return false;
+  }
+  auto graph = GetValueNode<FuncGraphPtr>(node);
+  MS_EXCEPTION_IF_NULL(graph);
+  if (!graph->parameters().empty() || graph->output() == nullptr) {
+    return false;
+  }
+  size_t cnode_num = 0;
+  auto include_func = [&graph](const AnfNodePtr &item) {
+    return item->func_graph() == graph ? FOLLOW : EXCLUDE;
+  };
+  for (auto &item : TopoSort(graph->get_return(), SuccIncoming, include_func)) {
+    if (!item->isa<CNode>() || item == graph->get_return()) {
+      continue;
+    }
+    if (++cnode_num > kMaxSelectBranchNodes) {
+      return false;
+    }
+    // Both branches are evaluated by select, so only the side effect free and finite ops are allowed.
+    if (!IsOneOfPrimitiveCNode(item, kSelectBranchPrims) || HasAbstractMonad(item)) {
+      return false;
+    }
+    auto &inputs = item->cast<CNodePtr>()->inputs();
+    if (std::any_of(inputs.begin() + 1, inputs.end(),
+                    [](const AnfNodePtr &input) { return IsValueNode<FuncGraph>(input) || HasAbstractMonad(input); })) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SwitchSmallBranchToSelect::CheckSwitchCallNode(const AnfNodePtr &node) const {
+  // {{prim::kPrimSwitch, C, G1, G2}}, the call without arguments means no monad state is passed in.
+  auto cnode = node->cast<CNodePtr>();
+  if (cnode == nullptr || cnode->size() != 1 || !IsPrimitiveCNode(cnode->input(0), prim::kPrimSwitch)) {
+    return false;
+  }
+  auto switch_node = cnode->input(0)->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(switch_node);
+  if (!CheckSmallBranch(switch_node->input(kTrueBranchIndex)) ||
+      !CheckSmallBranch(switch_node->input(kFalseBranchIndex))) {
+    return false;
+  }
+  auto cond_abs = dyn_cast<abstract::AbstractTensor>(switch_node->input(kCondIndex)->abstract());
+  auto true_abs = dyn_cast<abstract::AbstractTensor>(
+    GetValueNode<FuncGraphPtr>(switch_node->input(kTrueBranchIndex))->output()->abstract());
+  auto false_abs = dyn_cast<abstract::AbstractTensor>(
+    GetValueNode<FuncGraphPtr>(switch_node->input(kFalseBranchIndex))->output()->abstract());
+  if (cond_abs == nullptr || true_abs == nullptr || false_abs == nullptr) {
+    return false;
+  }
+  auto cond_type = cond_abs->element()->BuildType();
+  auto true_type = true_abs->element()->BuildType();
+  auto false_type = false_abs->element()->BuildType();
+  if (cond_type == nullptr || cond_type->type_id() != kNumberTypeBool || true_type == nullptr ||
+      false_type == nullptr || *true_type != *false_type) {
+    return false;
+  }
+  const auto &cond_shape = cond_abs->shape()->shape();
+  const auto &true_shape = true_abs->shape()->shape();
+  const auto &false_shape = false_abs->shape()->shape();
+  if (IsDynamic(cond_shape) || IsDynamic(true_shape) || true_shape != false_shape) {
+    return false;
+  }
+  // The condition is either of the output shape, or a single element which can be broadcast to it.
+  return cond_shape == true_shape || SizeOf(cond_shape) == 1;
+}
+
+void SwitchSmallBranchToSelect::TransformSwitchToSelect(const AnfNodePtr &node) const {
+  auto cnode = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(cnode);
+  auto switch_cnode = cnode->input(0)->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(switch_cnode);
+  auto cond = switch_cnode->input(kCondIndex);
+  auto g1 = GetValueNode<FuncGraphPtr>(switch_cnode->input(kTrueBranchIndex));
+  auto g2 = GetValueNode<FuncGraphPtr>(switch_cnode->input(kFalseBranchIndex));
+  auto fg = node->func_graph();
+  MS_EXCEPTION_IF_NULL(fg);
+  auto true_output = InlineClone(g1, fg, {});
+  auto false_output = InlineClone(g2, fg, {});
+
+  auto output_abs = g1->output()->abstract()->cast<abstract::AbstractTensorPtr>();
+  MS_EXCEPTION_IF_NULL(output_abs);
+  const auto &output_shape = output_abs->shape()->shape();
+  auto cond_abs = cond->abstract()->cast<abstract::AbstractTensorPtr>();
+  MS_EXCEPTION_IF_NULL(cond_abs);
+  if (cond_abs->shape()->shape() != output_shape) {
+    auto broadcast_to = std::make_shared<Primitive>(prim::kPrimBroadcastTo->name());
+    (void)broadcast_to->AddAttr(kAttrShape, MakeValue(output_shape));
+    cond = fg->NewCNode({NewValueNode(broadcast_to), cond});
+    cond->set_abstract(std::make_shared<abstract::AbstractTensor>(kBool, output_shape));
+  }
+  auto select = fg->NewCNode({NewValueNode(prim::kPrimSelect), cond, true_output, false_output});
+  select->set_abstract(output_abs->Clone());
+  MS_LOG(DEBUG) << "Convert switch call " << node->DebugString() << " to select " << select->DebugString();
+  (void)fg->manager()->Replace(node, select);
+}
 }  // namespace irpass
 }  // namespace opt
 }  // namespace mindspore
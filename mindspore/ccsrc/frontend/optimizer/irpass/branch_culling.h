@@ -27,6 +27,7 @@
 #include "frontend/operator/ops.h"
 #include "frontend/optimizer/irpass.h"
 #include "pipeline/jit/parse/resolve.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace opt {
@@ -219,6 +220,42 @@ class ConvertSwitchReplacement {
   void TransformSwitchBranchReplace(const AnfNodePtr &node) const;
 };
 
+// {{prim::kPrimSwitch, C, G1, G2}} -> {prim::kPrimSelect, C, G1_output, G2_output}
+// Inline tiny side-effect free branches whose outputs are tensors of the same shape, and pick the result on device
+// instead of going through the control flow actors and a host side decision. The branches may only contain the ops
+// which never produce inf or nan, as select runs both of them. It is enabled by the env MS_DEV_SWITCH_TO_SELECT=1.
+class SwitchSmallBranchToSelect {
+ public:
+  SwitchSmallBranchToSelect() = default;
+  virtual ~SwitchSmallBranchToSelect() = default;
+
+  bool operator()(const FuncGraphPtr &root, const OptimizerPtr &) {
+    if (common::GetEnv("MS_DEV_SWITCH_TO_SELECT") != "1") {
+      return false;
+    }
+    AnfNodePtr ret = root->get_return();
+    MS_EXCEPTION_IF_NULL(ret);
+    std::vector<AnfNodePtr> all_nodes = DeepScopedGraphSearch(ret);
+
+    bool change = false;
+    for (auto &node : all_nodes) {
+      if (CheckSwitchCallNode(node)) {
+        TransformSwitchToSelect(node);
+        change = true;
+      }
+    }
+    return change;
+  }
+
+ private:
+  // Determine whether the branch graph is small, pure and can be evaluated eagerly.
+  bool CheckSmallBranch(const AnfNodePtr &node) const;
+  // Determine whether node matches {{prim::kPrimSwitch, C, G1, G2}} with tensor condition and compatible outputs.
+  bool CheckSwitchCallNode(const AnfNodePtr &node) const;
+  // Replace the switch call with select.
+  void TransformSwitchToSelect(const AnfNodePtr &node) const;
+};
+
 // {prim::kPrimSwitch, {prim::kPrimDepend, ValueNode, X}, G1, G2} ->
 // {prim::kPrimDepend, {prim::kPrimSwitch, ValueNode, G1, G2}, X}
 class ExchangeSwitchDependValue : public OptimizerCaller {
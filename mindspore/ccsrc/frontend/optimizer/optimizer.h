@@ -35,6 +35,7 @@
 #include "pipeline/jit/resource.h"
 #include "pipeline/jit/action.h"
 #include "utils/ms_context.h"
+#include "utils/compile_profiler.h"
 
 namespace mindspore {
 namespace opt {
@@ -200,7 +201,11 @@ class Optimizer : public std::enable_shared_from_this<Optimizer> {
               changes_since_last_renorm = true;
             }
           };
-          use_profile ? (WITH(MsProfile::GetProfile()->Step(pass_names_[i])) opt_func) : opt_func();
+          {
+            CompileProfileScope profile_scope(name_ + "." + pass_names_[i], "opt_pass",
+                                              [&func_graph]() { return func_graph; });
+            use_profile ? (WITH(MsProfile::GetProfile()->Step(pass_names_[i])) opt_func) : opt_func();
+          }
 #ifdef ENABLE_DUMP_IR
           static const auto enable_dump_pass_ir = GetDumpConfig().enable_dump_pass_ir;
           if (enable_dump_pass_ir && MsContext::GetInstance()->get_param<bool>(MS_CTX_SAVE_GRAPHS_FLAG)) {
@@ -26,6 +26,9 @@
 #include "ir/func_graph.h"
 #include "mindspore/core/ops/core_ops.h"
 #include "include/common/utils/utils.h"
+#include "abstract/utils.h"
+#include "utils/ms_utils.h"
+#include "utils/shape_utils.h"
 
 namespace mindspore {
 namespace opt {
@@ -327,6 +330,135 @@ void SetRecomputedAttr(const FuncGraphPtr &graph, const std::vector<CNodePtr> &o
   }
 }
 
+// The memory budget of the forward outputs kept for the backward, in units of MB. When the env is set, the nodes to be
+// recomputed are selected automatically besides the ones marked by user.
+constexpr auto kEnvAutoRecomputeBudget = "MS_DEV_AUTO_RECOMPUTE_BUDGET";
+constexpr size_t kMBToByte = 1024 * 1024;
+constexpr float kMatMulFlopsPerElement = 2.0;
+
+bool GetTensorInfo(const AnfNodePtr &node, ShapeVector *shape, size_t *size) {
+  auto abs = node->abstract();
+  if (abs == nullptr || !abs->isa<abstract::AbstractTensor>()) {
+    return false;
+  }
+  auto shape_ptr = abs->BuildShape()->cast<abstract::ShapePtr>();
+  auto type_ptr = abs->cast_ptr<abstract::AbstractTensor>()->element()->BuildType();
+  if (shape_ptr == nullptr || type_ptr == nullptr || IsDynamic(shape_ptr->shape())) {
+    return false;
+  }
+  *shape = shape_ptr->shape();
+  *size = abstract::TypeIdSize(type_ptr->type_id());
+  for (auto dim : *shape) {
+    *size *= LongToSize(dim);
+  }
+  return true;
+}
+
+// Estimate the computation of recomputing the node, in units of the output elements of an element-wise operator.
+float GetRecomputeCost(const CNodePtr &node, const ShapeVector &output_shape) {
+  float output_elements = 1.0;
+  for (auto dim : output_shape) {
+    output_elements *= static_cast<float>(dim);
+  }
+  if (IsPrimitiveCNode(node, prim::kPrimMatMul) || IsPrimitiveCNode(node, prim::kPrimBatchMatMul)) {
+    ShapeVector input_shape;
+    size_t input_size = 0;
+    if (node->size() <= kIndex1 || !GetTensorInfo(node->input(kIndex1), &input_shape, &input_size) ||
+        input_shape.size() < kDim2) {
+      return -1;
+    }
+    auto prim = GetCNodePrimitive(node);
+    auto transpose_a = prim->GetAttr("transpose_a");
+    bool is_transpose_a = transpose_a != nullptr && transpose_a->isa<BoolImm>() && GetValue<bool>(transpose_a);
+    auto reduce_dim = is_transpose_a ? input_shape[input_shape.size() - kDim2] : input_shape.back();
+    return kMatMulFlopsPerElement * output_elements * static_cast<float>(reduce_dim);
+  }
+  return output_elements;
+}
+
+// Select the nodes to be recomputed by the memory budget of the forward outputs used by backward. To free the memory
+// of one output, the node is recomputed in backward, and the cheap node with large output is preferable, so the
+// nodes are greedily selected by the ratio of output size to recomputation cost until the kept outputs fit in the
+// budget. Only the node whose inputs are kept anyway is selected, so the recomputation frees memory without keeping
+// more inputs.
+void SetAutoRecomputedAttr(const FuncGraphPtr &graph, const std::vector<CNodePtr> &origin_nodes_topological) {
+  auto budget_env = common::GetEnv(kEnvAutoRecomputeBudget);
+  if (budget_env.empty()) {
+    return;
+  }
+  size_t budget = 0;
+  try {
+    budget = std::stoul(budget_env) * kMBToByte;
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid value of env " << kEnvAutoRecomputeBudget << ": " << budget_env;
+    return;
+  }
+  MS_EXCEPTION_IF_NULL(graph);
+  auto mng = graph->manager();
+  MS_EXCEPTION_IF_NULL(mng);
+  const auto &node_users = mng->node_users();
+  auto is_kept_for_bprop = [&node_users](const AnfNodePtr &node) {
+    auto iter = node_users.find(node);
+    return iter != node_users.end() && std::any_of(iter->second.begin(), iter->second.end(),
+                                                   [](const auto &user) { return IsBpropNode(user.first); });
+  };
+
+  struct Candidate {
+    CNodePtr node;
+    size_t size;
+    float cost;
+  };
+  std::vector<Candidate> candidates;
+  size_t kept_size = 0;
+  mindspore::HashMap<AnfNodePtr, bool> has_grad_inputs_map;
+  for (const auto &node : origin_nodes_topological) {
+    ShapeVector shape;
+    size_t size = 0;
+    if (IsBpropNode(node) || !is_kept_for_bprop(node) || !GetTensorInfo(node, &shape, &size)) {
+      continue;
+    }
+    kept_size += size;
+    if (IsSetNoRecomputeCNodeAttr(node) || IsSetRecomputeCNodeAttr(node) || CanNotRecomputed(node) ||
+        GetCNodePrimitive(node) == nullptr || !HasForwardOutput(mng, node) ||
+        HasGradInputs(node, &has_grad_inputs_map)) {
+      continue;
+    }
+    const auto &inputs = node->inputs();
+    if (!std::all_of(inputs.begin() + 1, inputs.end(), [&is_kept_for_bprop](const AnfNodePtr &input) {
+          return !input->isa<CNode>() || is_kept_for_bprop(input);
+        })) {
+      continue;
+    }
+    auto cost = GetRecomputeCost(node, shape);
+    if (cost > 0) {
+      candidates.push_back({node, size, cost});
+    }
+  }
+  if (kept_size <= budget) {
+    MS_LOG(INFO) << "The forward outputs kept for backward take " << kept_size << " bytes, within the budget "
+                 << budget << " bytes, no node is recomputed automatically.";
+    return;
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+    return static_cast<float>(a.size) / a.cost > static_cast<float>(b.size) / b.cost;
+  });
+  size_t selected_num = 0;
+  for (const auto &candidate : candidates) {
+    if (kept_size <= budget) {
+      break;
+    }
+    candidate.node->AddAttr(kAttrRecompute, MakeValue(true));
+    kept_size -= candidate.size;
+    ++selected_num;
+  }
+  MS_LOG(INFO) << "Select " << selected_num << " nodes to be recomputed automatically, the forward outputs kept for "
+               << "backward take " << kept_size << " bytes with the budget " << budget << " bytes.";
+  if (kept_size > budget) {
+    MS_LOG(WARNING) << "The forward outputs kept for backward still exceed the budget " << budget_env
+                    << " MB after recomputing all the candidates.";
+  }
+}
+
 CNodePtr CreateNewRecomputedNode(const FuncGraphPtr &graph, const CNodePtr &origin_node,
                                  const std::vector<AnfNodePtr> &new_inputs) {
   auto recomputed_node = graph->NewCNode(new_inputs);
@@ -458,6 +590,7 @@ void InsertRecomputedNodes(const FuncGraphPtr &graph) {
   MS_EXCEPTION_IF_NULL(mng);
   std::list<CNodePtr> orders = graph->GetOrderedCnodes();
   std::vector<CNodePtr> origin_nodes_topological(orders.cbegin(), orders.cend());
+  SetAutoRecomputedAttr(graph, origin_nodes_topological);
   SetRecomputedAttr(graph, origin_nodes_topological);
   // Get candidate origin recomputed nodes which have no grad inputs and output to at least one grad node directly.
   std::vector<CNodePtr> candidate_recomputed_nodes = FindCandidateRecomputedNodes(mng, origin_nodes_topological);
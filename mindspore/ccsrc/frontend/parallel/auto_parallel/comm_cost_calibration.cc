@@ -0,0 +1,115 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "frontend/parallel/auto_parallel/comm_cost_calibration.h"
+#include <fstream>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace parallel {
+namespace {
+constexpr char kCommCostCalibrationFileEnv[] = "MS_DEV_COMM_COST_CALIBRATION_FILE";
+constexpr const char *kCommTypeNames[kCommTypeNum] = {"AllReduce", "AllGather", "ReduceScatter", "AllToAll"};
+constexpr size_t kLatencyIndex = 0;
+constexpr size_t kBandwidthIndex = 1;
+// The bytes transferred in one microsecond by the bandwidth of 1 GB/s.
+constexpr double kBytesPerUsPerGBps = 1.0e3;
+}  // namespace
+
+CommCostCalibration::CommCostCalibration() {
+  auto file = common::GetEnv(kCommCostCalibrationFileEnv);
+  if (!file.empty()) {
+    Load(file);
+  }
+}
+
+void CommCostCalibration::Load(const std::string &file) {
+  std::ifstream calibration_fs(file);
+  if (!calibration_fs.is_open()) {
+    MS_LOG(WARNING) << "Open the communication cost calibration file: " << file << " failed, the calibration is "
+                    << "disabled.";
+    return;
+  }
+  nlohmann::json calibration_json;
+  try {
+    calibration_fs >> calibration_json;
+    for (size_t type = 0; type < kCommTypeNum; ++type) {
+      const auto &type_iter = calibration_json.find(kCommTypeNames[type]);
+      if (type_iter == calibration_json.end()) {
+        MS_LOG(INFO) << "There is no calibration of " << kCommTypeNames[type] << ", use the reference instead.";
+        continue;
+      }
+      for (auto iter = type_iter->begin(); iter != type_iter->end(); ++iter) {
+        const std::vector<double> &measure = iter.value();
+        auto group_size = std::stoul(iter.key());
+        if (measure.size() <= kBandwidthIndex || measure[kBandwidthIndex] <= 0 || group_size == 0) {
+          MS_LOG(WARNING) << "Invalid calibration of " << kCommTypeNames[type] << " for group size " << iter.key();
+          continue;
+        }
+        measures_[type][group_size] = {measure[kLatencyIndex], measure[kBandwidthIndex]};
+      }
+    }
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Parse the communication cost calibration file: " << file << " failed: " << e.what();
+    for (auto &measures : measures_) {
+      measures.clear();
+    }
+    return;
+  }
+  const auto &reference = measures_[kCommAllReduce];
+  if (reference.empty()) {
+    MS_LOG(WARNING) << "The communication cost calibration file: " << file << " has no AllReduce, the calibration is "
+                    << "disabled.";
+    return;
+  }
+  ref_bandwidth_gbps_ = reference.rbegin()->second.bandwidth_gbps_;
+  enable_ = true;
+  MS_LOG(INFO) << "Load the communication cost calibration from " << file << ", reference bandwidth "
+               << ref_bandwidth_gbps_ << " GB/s.";
+}
+
+const CommCostCalibration::CommMeasure *CommCostCalibration::FindMeasure(CommType type, size_t group_size) const {
+  const auto &measures = measures_[type];
+  if (measures.empty()) {
+    return nullptr;
+  }
+  auto iter = measures.lower_bound(group_size);
+  if (iter == measures.end()) {
+    return &(measures.rbegin()->second);
+  }
+  return &(iter->second);
+}
+
+double CommCostCalibration::BandwidthFactor(CommType type, size_t group_size) const {
+  auto measure = enable_ ? FindMeasure(type, group_size) : nullptr;
+  if (measure == nullptr) {
+    return 1.0;
+  }
+  return ref_bandwidth_gbps_ / measure->bandwidth_gbps_;
+}
+
+double CommCostCalibration::Cost(CommType type, size_t group_size, double bytes) const {
+  auto measure = enable_ ? FindMeasure(type, group_size) : nullptr;
+  if (measure == nullptr) {
+    return bytes;
+  }
+  return bytes * ref_bandwidth_gbps_ / measure->bandwidth_gbps_ +
+         measure->latency_us_ * ref_bandwidth_gbps_ * kBytesPerUsPerGBps;
+}
+}  // namespace parallel
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_FRONTEND_PARALLEL_AUTO_PARALLEL_COMM_COST_CALIBRATION_H_
+#define MINDSPORE_CCSRC_FRONTEND_PARALLEL_AUTO_PARALLEL_COMM_COST_CALIBRATION_H_
+
+#include <map>
+#include <string>
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace parallel {
+enum CommType { kCommAllReduce = 0, kCommAllGather, kCommReduceScatter, kCommAllToAll, kCommTypeNum };
+
+// The calibration of communication cost by the latency and bandwidth of collectives measured on the cluster, which
+// replaces the uniform scale factors of the communication in the cost model. The measurements are loaded from the json
+// file of env MS_DEV_COMM_COST_CALIBRATION_FILE, in the format of
+//   {"AllReduce": {"<group size>": [<latency in us>, <bandwidth in GB/s>], ...}, "AllGather": {...}, ...}
+// and the calibration is disabled when the env is not set.
+// The calibrated cost is in units of the bytes transferred by the AllReduce of the largest measured group in the same
+// time, so it is comparable with the other costs in bytes.
+class CommCostCalibration {
+ public:
+  static CommCostCalibration &GetInstance() {
+    static CommCostCalibration instance;
+    return instance;
+  }
+
+  bool enable() const { return enable_; }
+
+  // The ratio of the time to transfer the same bytes by the collective in the group to that of the reference.
+  double BandwidthFactor(CommType type, size_t group_size) const;
+
+  // The calibrated cost of transferring the bytes by the collective in the group, including the latency.
+  double Cost(CommType type, size_t group_size, double bytes) const;
+
+ private:
+  CommCostCalibration();
+  ~CommCostCalibration() = default;
+  DISABLE_COPY_AND_ASSIGN(CommCostCalibration);
+
+  void Load(const std::string &file);
+
+  struct CommMeasure {
+    double latency_us_{0};
+    double bandwidth_gbps_{0};
+  };
+  // Use the measure of the smallest measured group not smaller than the group, or the largest measured group.
+  const CommMeasure *FindMeasure(CommType type, size_t group_size) const;
+
+  bool enable_{false};
+  double ref_bandwidth_gbps_{0};
+  std::map<size_t, CommMeasure> measures_[kCommTypeNum];
+};
+}  // namespace parallel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_FRONTEND_PARALLEL_AUTO_PARALLEL_COMM_COST_CALIBRATION_H_
@@ -18,11 +18,26 @@
 
 #include <algorithm>
 #include <random>
+#include "frontend/parallel/auto_parallel/comm_cost_calibration.h"
 #include "frontend/parallel/device_matrix.h"
 #include "frontend/parallel/tensor_layout/tensor_redistribution.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+// The communication cost of AllReduce of the parameter gradient, whose slice is replicated in the devices of the
+// stage not used by the parameter.
+double ParameterGradCommCost(const Shape &slice_shape, size_t type_length, size_t total_device_num,
+                             int64_t used_device_num) {
+  double bytes = ListProduct(slice_shape) * static_cast<double>(type_length);
+  const auto &calibration = CommCostCalibration::GetInstance();
+  if (!calibration.enable() || used_device_num <= 0) {
+    return bytes;
+  }
+  return calibration.Cost(kCommAllReduce, total_device_num / LongToSize(used_device_num), bytes);
+}
+}  // namespace
+
 void OperatorCost::set_is_parameter(const std::vector<bool> &is_parameter) { is_parameter_ = is_parameter; }
 
 void OperatorCost::set_is_parameter_involve(const std::vector<bool> &is_parameter_inv) {
@@ -93,7 +108,14 @@ double MatMulCost::GetForwardCommCost(const std::vector<TensorInfo> &inputs, con
     return 0.0;
   } else {
     // Else, the communication cost is the size (number of bytes) of a slice of output tensor.
-    return ListProduct(output0.slice_shape()) * static_cast<double>(outputs_type_lengths_[0]);
+    double bytes = ListProduct(output0.slice_shape()) * static_cast<double>(outputs_type_lengths_[0]);
+    const auto &calibration = CommCostCalibration::GetInstance();
+    if (!calibration.enable()) {
+      return bytes;
+    }
+    // The slices of output are AllReduced in the devices partitioning the reduced dimension.
+    auto group_size = input0_shape[input0_shape.size() - 1] / input0_slice_shape[input0_slice_shape.size() - 1];
+    return calibration.Cost(kCommAllReduce, LongToSize(group_size), bytes);
   }
 }
 
@@ -117,7 +139,7 @@ double MatMulCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, co
     }
 
     if (total_device_num != LongToSize(used_device_num))
-      result += ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result += ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
   }
 
   return result;
@@ -234,7 +256,7 @@ double BatchNormCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs,
   }
 
   if (total_device_num != LongToSize(used_device_num)) {
-    tmp_cost = ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+    tmp_cost = ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
   }
 
   for (size_t i = 1; i < is_parameter_.size(); ++i) {
@@ -294,7 +316,7 @@ double CastCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, cons
       used_device_num *= input1_shape[i] / input1_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result = ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result = ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
     }
   }
   return result;
@@ -360,7 +382,7 @@ double SoftmaxCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, c
       used_device_num *= input1_shape[i] / input1_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result = ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result = ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
     }
   }
   return result;
@@ -534,7 +556,7 @@ double BatchParallelCost::GetBackwardCommCost(const std::vector<TensorInfo> &inp
       used_device_num *= input_a_shape[i] / input_a_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result += ListProduct(input_a_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_a_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
     }
   }
 
@@ -597,7 +619,7 @@ double PReLUCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, con
       used_device_num *= input1_shape[i] / input1_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result = ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result = ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
     }
   }
   return result;
@@ -771,7 +793,7 @@ double ReshapeCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, c
       used_device_num *= input1_shape[i] / input1_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result = ListProduct(input1_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result = ParameterGradCommCost(input1_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
     }
   }
   return result;
@@ -867,7 +889,7 @@ double SubCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, const
     }
 
     if (total_device_num != LongToSize(used_device_num))
-      result += ListProduct(input_a_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_a_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
   }
 
   if (is_parameter_[1]) {
@@ -880,7 +902,7 @@ double SubCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, const
     }
 
     if (total_device_num != LongToSize(used_device_num))
-      result += ListProduct(input_b_slice_shape) * static_cast<double>(inputs_type_lengths_[1]);
+      result += ParameterGradCommCost(input_b_slice_shape, inputs_type_lengths_[1], total_device_num, used_device_num);
   }
 
   return result;
@@ -1206,7 +1228,7 @@ double ReduceSumCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs,
     }
 
     if (total_device_num != LongToSize(used_device_num))
-      result += ListProduct(input_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
   }
 
   return result;
@@ -1351,7 +1373,7 @@ double GatherV2Cost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs,
       used_device_num *= input_a_shape[i] / input_a_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result += ListProduct(input_a_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_a_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
     }
   }
 
@@ -1474,7 +1496,7 @@ double LayerNormCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs,
         used_device_num *= shape[i] / slice_shape[i];
       }
       if (total_device_num != LongToSize(used_device_num)) {
-        result += ListProduct(slice_shape) * static_cast<double>(inputs_type_lengths_[index]);
+        result += ParameterGradCommCost(slice_shape, inputs_type_lengths_[index], total_device_num, used_device_num);
       }
     }
   }
@@ -1533,7 +1555,7 @@ double UniqueCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, co
       used_device_num *= input_shape[i] / input_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result = ListProduct(input_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result = ParameterGradCommCost(input_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
     }
   }
   return result;
@@ -1610,7 +1632,7 @@ double GatherCost::GetBackwardCommCost(const std::vector<TensorInfo> &inputs, co
       used_device_num *= input_a_shape[i] / input_a_slice_shape[i];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result += ListProduct(input_a_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_a_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
     }
   }
   return result;
@@ -1917,7 +1939,7 @@ double CropAndResizeCost::GetBackwardCommCost(const std::vector<TensorInfo> &inp
       used_device_num *= input_shape[j] / input_slice_shape[j];
     }
     if (total_device_num != LongToSize(used_device_num)) {
-      result += ListProduct(input_slice_shape) * static_cast<double>(inputs_type_lengths_[0]);
+      result += ParameterGradCommCost(input_slice_shape, inputs_type_lengths_[0], total_device_num, used_device_num);
     }
   }
   return result;
@@ -16,17 +16,99 @@
 
 #include "frontend/parallel/auto_parallel/rec_core/rec_partition.h"
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "utils/hash_map.h"
+
 #include "ir/anf.h"
 #include "frontend/parallel/status.h"
 #include "frontend/parallel/ops_info/ops_utils.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+void AppendTensorParam(const TensorParam &tensor, std::vector<double> *key) {
+  (void)key->insert(key->end(),
+                    {static_cast<double>(tensor.tensor_type), static_cast<double>(tensor.tensor_shape.shape_n),
+                     static_cast<double>(tensor.tensor_shape.shape_c), static_cast<double>(tensor.tensor_shape.shape_h),
+                     static_cast<double>(tensor.tensor_shape.shape_w), tensor.tensor_str.str_n, tensor.tensor_str.str_c,
+                     tensor.tensor_str.str_h, tensor.tensor_str.str_w});
+}
+
+void AppendTensorStr(const TensorStr4D &str, std::vector<double> *key) {
+  (void)key->insert(key->end(), {str.str_n, str.str_c, str.str_h, str.str_w});
+}
+
+// Collect the strategies of the adjacent nodes which are already partitioned in this loop, in the order of their
+// partitioning. The cost of redistribution only depends on these strategies, so they are used instead of the whole
+// strategy list, which makes the partitioning of each node independent of the size of the graph.
+std::vector<std::pair<std::string, StrategyRec>> GetAdjacentStrategies(
+  const Graph::NodeType &node, const std::vector<std::pair<std::string, StrategyRec>> &node_name_to_strategy,
+  const mindspore::HashMap<std::string, std::vector<size_t>> &name_to_strategy_index, const Graph &graph) {
+  std::vector<size_t> strategy_index;
+  auto collect = [&strategy_index, &name_to_strategy_index, &graph](const std::vector<size_t> &adjacent_nodes) {
+    for (auto adjacent : adjacent_nodes) {
+      auto iter = name_to_strategy_index.find(graph.nodes[adjacent].name);
+      if (iter != name_to_strategy_index.end()) {
+        (void)strategy_index.insert(strategy_index.end(), iter->second.begin(), iter->second.end());
+      }
+    }
+  };
+  collect(node.node_in);
+  collect(node.node_out);
+  std::sort(strategy_index.begin(), strategy_index.end());
+  (void)strategy_index.erase(std::unique(strategy_index.begin(), strategy_index.end()), strategy_index.end());
+
+  std::vector<std::pair<std::string, StrategyRec>> adjacent_strategies;
+  adjacent_strategies.reserve(strategy_index.size());
+  for (auto index : strategy_index) {
+    adjacent_strategies.push_back(node_name_to_strategy[index]);
+  }
+  return adjacent_strategies;
+}
+
+// The key of the partitioning of node consists of the operator, its tensors and the strategies of adjacent nodes seen
+// by the cost of redistribution. The isomorphic nodes, such as the ones in the repeated transformer blocks, share the
+// same key and the optimal strategy is searched only once.
+std::vector<double> GetPartitionKey(const Graph::NodeType &node,
+                                    const std::vector<std::pair<std::string, StrategyRec>> &adjacent_strategies,
+                                    const Graph &graph) {
+  std::vector<double> key = {static_cast<double>(node.apply.op_type), static_cast<double>(node.node_in.size()),
+                             static_cast<double>(node.node_out.size())};
+  for (size_t i = 0; i < MAX_INPUT_NUM; i++) {
+    AppendTensorParam(node.apply.arguments[i], &key);
+    AppendTensorStr(node.apply.str.inputTensor[i], &key);
+  }
+  AppendTensorStr(node.apply.str.outputTensor, &key);
+  key.push_back(static_cast<double>(node.apply.str.cut_counter));
+  key.push_back(node.apply.str.cost);
+  AppendTensorParam(node.tensor_parm, &key);
+
+  // The positions of adjacent nodes matching each strategy and the parts of strategy used in the redistribution.
+  for (const auto &adjacent_strategy : adjacent_strategies) {
+    for (size_t i = 0; i < node.node_in.size(); i++) {
+      if (graph.nodes[node.node_in[i]].name == adjacent_strategy.first) {
+        key.push_back(static_cast<double>(i));
+      }
+    }
+    key.push_back(-1);
+    for (size_t i = 0; i < node.node_out.size(); i++) {
+      if (graph.nodes[node.node_out[i]].name == adjacent_strategy.first) {
+        key.push_back(static_cast<double>(i));
+      }
+    }
+    key.push_back(-1);
+    AppendTensorStr(adjacent_strategy.second.inputTensor[0], &key);
+    AppendTensorStr(adjacent_strategy.second.outputTensor, &key);
+  }
+  return key;
+}
+}  // namespace
+
 // Get the target node's weight for sorting.
 double GetWeights(const Graph::NodeType &node) {
   const OperatorRec &op = node.apply;
@@ -232,6 +314,10 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
 
     // temp vector to map nodename to its strategy.
     std::vector<std::pair<std::string, StrategyRec>> node_name_to_strategy;
+    mindspore::HashMap<std::string, std::vector<size_t>> name_to_strategy_index;
+    // The optimal strategies searched in this loop.
+    std::map<std::vector<double>, StrategyRec> partition_cache;
+    size_t cache_hit = 0;
 
     // Loop for all the nodes
     for (size_t i_node = 0; i_node < iter_nodes; i_node++) {
@@ -244,7 +330,16 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
       StrategyRec old_str = graph->nodes[index].apply.str;
 
       // Serch optimal strategy to cut this operator. And store the result optimal strategy in graph.
-      graph->nodes[index].apply.str = PartitionNode(node_ptr, node_name_to_strategy, graph);
+      auto adjacent_strategies = GetAdjacentStrategies(node_ptr, node_name_to_strategy, name_to_strategy_index, *graph);
+      auto key = GetPartitionKey(node_ptr, adjacent_strategies, *graph);
+      auto cache_iter = partition_cache.find(key);
+      if (cache_iter != partition_cache.end()) {
+        graph->nodes[index].apply.str = cache_iter->second;
+        ++cache_hit;
+      } else {
+        graph->nodes[index].apply.str = PartitionNode(node_ptr, adjacent_strategies, graph);
+        (void)partition_cache.emplace(std::move(key), graph->nodes[index].apply.str);
+      }
 
       // Get Current 2-parts partitioning strategy of this loop
       size_t op_inputs_num = graph->nodes[index].node_in.size();
@@ -255,8 +350,11 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
 
       // Note down the node name and its strategy in this loop.
       auto node_name_to_str = std::pair<std::string, StrategyRec>(graph->nodes[index].name, one_loop_strategyrec);
+      name_to_strategy_index[node_name_to_str.first].push_back(node_name_to_strategy.size());
       node_name_to_strategy.push_back(node_name_to_str);
     }
+    MS_LOG(INFO) << "Partition loop " << loop << ": " << iter_nodes << " nodes, " << partition_cache.size()
+                 << " distinct partitionings searched, " << cache_hit << " reused.";
   }
 
   if (DevicesMemoryControl(num_device, device_memory, graph) != SUCCESS) {
@@ -289,8 +289,9 @@ FuncGraphPtr PsEmbeddingCacheInserter::ConstructEmbeddingLookupSubGraph(const An
   if (!common::AnfAlgo::HasNodeAttr(kAttrOffset, dyn_cast<CNode>(node))) {
     MS_LOG(EXCEPTION) << "Can not find offset attr of kernel: " << node->fullname_with_scope();
   }
-  int64_t offset = common::AnfAlgo::GetNodeAttr<int64_t>(node, kAttrOffset);
-  common::AnfAlgo::SetNodeAttr(kAttrOffset, MakeValue(offset), embedding_cache_lookup_node);
+  // The workers send the ids minus the begin of the embedding table slice on this server, which are the row indices of
+  // the slice already, so the offset of the lookup is zero.
+  common::AnfAlgo::SetNodeAttr(kAttrOffset, MakeValue<int64_t>(0), embedding_cache_lookup_node);
   common::AnfAlgo::SetNodeAttr(kAttrInputIsDynamicShape, MakeValue(true), embedding_cache_lookup_node);
   common::AnfAlgo::SetNodeAttr(kAttrOutputIsDynamicShape, MakeValue(true), embedding_cache_lookup_node);
 
@@ -19,10 +19,12 @@
 #include <set>
 #include <queue>
 #include <algorithm>
+#include <iterator>
 #include "frontend/parallel/graph_util/pipeline_split_utils.h"
 #include "frontend/parallel/graph_util/generate_graph.h"
 #include "mindspore/core/ops/core_ops.h"
 #include "ir/value.h"
+#include "utils/ms_utils.h"
 #include "frontend/parallel/ops_info/ops_utils.h"
 #include "frontend/parallel/device_manager.h"
 #include "include/common/utils/parallel_context.h"
@@ -37,6 +39,10 @@ const std::set<PrimitivePtr> END_NODE_BLACK_LIST = {
   prim::kPrimDepend,    prim::kPrimTupleGetItem, prim::kPrimAdd,    prim::kPrimSoftmaxCrossEntropyWithLogits,
   prim::kPrimMakeTuple, prim::kPrimUpdateState,  prim::kPrimReshape};
 
+// Issue the receive of backward before the forward computation of the same 1F1B step, to overlap the communication
+// with the computation.
+constexpr char kEnvPipelineCommOverlap[] = "MS_DEV_PIPELINE_COMM_OVERLAP";
+
 static bool IsInEndNodeBlackList(const CNodePtr &cnode) {
   MS_EXCEPTION_IF_NULL(cnode);
   if (!IsValueNode<Primitive>(cnode->input(0))) {
@@ -414,8 +420,11 @@ void ReorderForBackward(const PipelinePair &forward_start_pair, const PipelinePa
   MS_EXCEPTION_IF_NULL(manager);
   auto stage_num = g_device_manager->stage_num();
   auto stage_id = g_device_manager->stage_id();
+  // The order of send and receive between the stages is kept, only the receive of backward in the stage which is not
+  // the last can run in parallel with the forward computation.
+  bool comm_overlap = !IsLastStage() && common::GetEnv(kEnvPipelineCommOverlap) == "1";
   for (size_t i = LongToSize(stage_num - stage_id); i < (forward_start_pair.first.size()); ++i) {
-    auto prior_node1 = forward_end_before_pair.second[i];
+    auto prior_node1 = comm_overlap ? forward_start_pair.second[i] : forward_end_before_pair.second[i];
     auto post_node1 = backward_start_pair.first[LongToSize(SizeToLong(i) - stage_num + stage_id + 1)];
     InsertDepend(prior_node1, post_node1, manager, root);
     auto prior_node2 = backward_end_pair.second[LongToSize(SizeToLong(i) - stage_num + stage_id)];
@@ -439,12 +448,54 @@ void ReorderForBackward(const PipelinePair &forward_start_pair, const PipelinePa
     InsertDepend(prior_node5, post_node5, manager, root);
   }
   if (!IsLastStage()) {
-    auto prior_node6 = forward_end_before_pair.second[LongToSize(stage_num - 1 - stage_id)];
+    auto last_warmup = LongToSize(stage_num - 1 - stage_id);
+    auto prior_node6 =
+      comm_overlap ? forward_start_pair.second[last_warmup] : forward_end_before_pair.second[last_warmup];
     auto post_node6 = backward_start_pair.first[0];
     InsertDepend(prior_node6, post_node6, manager, root);
   }
 }
 
+// The 1F1B schedule of the stage. When the stage has several chunks, the chunk c of the stage s is the virtual stage
+// c * stage_num + s, and the micro batches go through the chunks in groups of stage_num, so the forward of a group
+// moves to the next chunk after stage_num steps and the backward goes through the chunks in the reversed order.
+std::vector<PipelineScheduleStep> PipelineSchedule(int64_t stage_num, int64_t stage_id, int64_t micro_size,
+                                                   int64_t chunk_num) {
+  if (stage_num <= 0 || stage_id < 0 || stage_id >= stage_num || chunk_num <= 0 || micro_size < stage_num) {
+    MS_LOG(EXCEPTION) << "Invalid pipeline schedule, stage num: " << stage_num << ", stage id: " << stage_id
+                      << ", micro size: " << micro_size << ", chunk num: " << chunk_num;
+  }
+  if (chunk_num > 1 && micro_size % stage_num != 0) {
+    MS_LOG(EXCEPTION) << "MicroBatch size: " << micro_size << " should be a multiple of stage num: " << stage_num
+                      << " when each stage has " << chunk_num << " virtual stages.";
+  }
+  auto step_num = micro_size * chunk_num;
+  auto get_step = [stage_num, chunk_num](int64_t index, bool is_forward) {
+    auto group = index / stage_num;
+    auto chunk = is_forward ? group % chunk_num : chunk_num - 1 - group % chunk_num;
+    return PipelineScheduleStep{group / chunk_num * stage_num + index % stage_num, chunk, is_forward};
+  };
+  // The stage runs the forward of the warmup steps before its first backward. With chunks, the warmup covers the
+  // chunks before the last one, and all the forward steps run first if there is only one group of micro batches.
+  auto warmup_num = stage_num - stage_id - 1;
+  if (chunk_num > 1) {
+    warmup_num = micro_size == stage_num ? step_num : warmup_num * 2 + (chunk_num - 1) * stage_num;
+  }
+  warmup_num = std::min(warmup_num, step_num);
+  std::vector<PipelineScheduleStep> schedule;
+  for (int64_t i = 0; i < warmup_num; ++i) {
+    schedule.push_back(get_step(i, true));
+  }
+  for (int64_t i = warmup_num; i < step_num; ++i) {
+    schedule.push_back(get_step(i, true));
+    schedule.push_back(get_step(i - warmup_num, false));
+  }
+  for (int64_t i = step_num - warmup_num; i < step_num; ++i) {
+    schedule.push_back(get_step(i, false));
+  }
+  return schedule;
+}
+
 void ReorderForParams(const std::vector<AnfNodePtr> &backward_params, const std::vector<AnfNodePtr> &forward_params,
                       const PipelinePair &forward_params_pair, const std::vector<AnfNodePtr> &backward_end,
                       const PipelinePair &forward_start_pair, const FuncGraphPtr &root) {
@@ -759,6 +810,91 @@ void CheckBorderNode(const PipelinePair &forward_start_pair, const PipelinePair
   }
 }
 
+static int64_t GetChunk(const AnfNodePtr &node, int64_t default_chunk) {
+  MS_EXCEPTION_IF_NULL(node);
+  auto cnode = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(cnode);
+  if (!cnode->HasPrimalAttr(PIPELINE_CHUNK)) {
+    return default_chunk;
+  }
+  return GetValue<int64_t>(cnode->GetPrimalAttr(PIPELINE_CHUNK));
+}
+
+// The border nodes of a chunk, the first and second of each pair are the first and last nodes of the micro batches.
+struct ChunkBorder {
+  PipelinePair forward_start;
+  PipelinePair forward_end;
+  PipelinePair backward_start;
+  PipelinePair backward_end;
+};
+
+// The send and receive have the chunk of their virtual stage. The begin nodes without chunk are the slices of the
+// micro batches and the parameter starts of the first chunk, and the end nodes without chunk are the ends of the loss
+// in the last chunk.
+static std::vector<ChunkBorder> GetChunkBorders(const std::vector<AnfNodePtr> &forward_start,
+                                                const std::vector<AnfNodePtr> &forward_end,
+                                                const std::vector<AnfNodePtr> &backward_start,
+                                                const std::vector<AnfNodePtr> &backward_end, int64_t chunk_num,
+                                                int64_t micro_max, const FuncGraphPtr &root) {
+  auto get_chunk_nodes = [](const std::vector<AnfNodePtr> &nodes, int64_t chunk, int64_t default_chunk) {
+    std::vector<AnfNodePtr> chunk_nodes;
+    (void)std::copy_if(
+      nodes.cbegin(), nodes.cend(), std::back_inserter(chunk_nodes),
+      [chunk, default_chunk](const AnfNodePtr &node) { return GetChunk(node, default_chunk) == chunk; });
+    return chunk_nodes;
+  };
+  std::vector<ChunkBorder> chunk_borders;
+  for (int64_t chunk = 0; chunk < chunk_num; ++chunk) {
+    ChunkBorder border;
+    border.forward_start = Deduplicate(get_chunk_nodes(forward_start, chunk, 0), root, micro_max);
+    border.forward_end = Deduplicate(get_chunk_nodes(forward_end, chunk, chunk_num - 1), root, micro_max);
+    border.backward_start = Deduplicate(get_chunk_nodes(backward_start, chunk, chunk_num - 1), root, micro_max);
+    border.backward_end = Deduplicate(get_chunk_nodes(backward_end, chunk, 0), root, micro_max);
+    CheckBorderNode(border.forward_start, border.forward_end, border.backward_start, border.backward_end,
+                    LongToSize(micro_max));
+    chunk_borders.push_back(border);
+  }
+  return chunk_borders;
+}
+
+// Chain the border nodes of the chunks by the interleaved 1F1B schedule. As ReorderForBackward, when the forward before
+// a backward ends with a send, the receive of the backward runs between the computation and the send of the forward,
+// and the send of the backward runs after the send of the forward.
+static void ReorderForInterleaved(const std::vector<ChunkBorder> &chunk_borders, int64_t micro_max,
+                                  const FuncGraphPtr &root) {
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  auto manager = root->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto schedule = PipelineSchedule(g_device_manager->stage_num(), g_device_manager->stage_id(), micro_max + 1,
+                                   SizeToLong(chunk_borders.size()));
+  bool comm_overlap = common::GetEnv(kEnvPipelineCommOverlap) == "1";
+  for (size_t i = 1; i < schedule.size(); ++i) {
+    const auto &prior_border = chunk_borders[LongToSize(schedule[i - 1].chunk)];
+    const auto &post_border = chunk_borders[LongToSize(schedule[i].chunk)];
+    auto prior_micro = LongToSize(schedule[i - 1].micro);
+    auto post_micro = LongToSize(schedule[i].micro);
+    auto post_node = schedule[i].is_forward ? post_border.forward_start.first[post_micro]
+                                            : post_border.backward_start.first[post_micro];
+    if (!schedule[i - 1].is_forward) {
+      InsertDepend(prior_border.backward_end.second[prior_micro], post_node, manager, root);
+      continue;
+    }
+    const auto &forward_end = prior_border.forward_end;
+    if (schedule[i].is_forward || !IsPrimitiveCNode(forward_end.first[prior_micro], prim::kPrimSend)) {
+      InsertDepend(forward_end.second[prior_micro], post_node, manager, root);
+      continue;
+    }
+    auto forward_end_cnode = forward_end.second[prior_micro]->cast<CNodePtr>();
+    MS_EXCEPTION_IF_NULL(forward_end_cnode);
+    auto forward_end_before = GetActualOp(forward_end_cnode->input(1));
+    MS_EXCEPTION_IF_NULL(forward_end_before);
+    auto prior_node = comm_overlap ? prior_border.forward_start.second[prior_micro] : forward_end_before;
+    InsertDepend(prior_node, post_node, manager, root);
+    InsertDepend(post_border.backward_start.second[post_micro], forward_end.first[prior_micro], manager, root);
+    InsertDepend(forward_end.second[prior_micro], post_border.backward_end.first[post_micro], manager, root);
+  }
+}
+
 void Reorder(const FuncGraphPtr &root) {
   std::vector<AnfNodePtr> forward_start;
   std::vector<AnfNodePtr> forward_end;
@@ -779,6 +915,23 @@ void Reorder(const FuncGraphPtr &root) {
       MS_EXCEPTION_IF_NULL(micro_size);
       micro_max = GetValue<int64_t>(micro_size);
     }
+    // The chunks are labeled on the send and receive only when each stage has several virtual stages.
+    int64_t chunk_max = 0;
+    for (auto &node : forward_start) {
+      chunk_max = std::max(chunk_max, GetChunk(node, 0));
+    }
+    for (auto &node : forward_end) {
+      chunk_max = std::max(chunk_max, GetChunk(node, 0));
+    }
+    if (chunk_max > 0) {
+      auto chunk_borders =
+        GetChunkBorders(forward_start, forward_end, backward_start, backward_end, chunk_max + 1, micro_max, root);
+      ReorderForInterleaved(chunk_borders, micro_max, root);
+      auto forward_params_pair = Deduplicate(forward_params, root, micro_max);
+      ReorderForParams(backward_params, forward_params, forward_params_pair,
+                       {chunk_borders.front().backward_end.second.back()}, chunk_borders.front().forward_start, root);
+      return;
+    }
   }
   auto backward_start_pair = Deduplicate(backward_start, root, micro_max);
   auto backward_end_pair = Deduplicate(backward_end, root, micro_max);
@@ -26,6 +26,12 @@
 namespace mindspore {
 namespace parallel {
 using PipelinePair = std::pair<std::vector<AnfNodePtr>, std::vector<AnfNodePtr>>;
+// The forward or backward of a micro batch on a chunk(virtual stage) of the stage.
+struct PipelineScheduleStep {
+  int64_t micro;
+  int64_t chunk;
+  bool is_forward;
+};
 AnfNodePtr FindAccuGrad(const CNodePtr &cnode);
 bool IsLastStage();
 void InsertVirtualAssignAdd(const std::pair<AnfNodePtr, int> &node_user, const FuncGraphManagerPtr &manager,
@@ -40,6 +46,8 @@ void ReorderForForward(const std::vector<AnfNodePtr> &forward_start, const std::
 void ReorderForBackward(const PipelinePair &forward_start_pair, const PipelinePair &forward_end_pair,
                         const PipelinePair &backward_start_pair, const PipelinePair &backward_end_pair,
                         const PipelinePair &forward_end_before_pair, const FuncGraphPtr &root);
+std::vector<PipelineScheduleStep> PipelineSchedule(int64_t stage_num, int64_t stage_id, int64_t micro_size,
+                                                   int64_t chunk_num);
 void ReorderForParams(const std::vector<AnfNodePtr> &backward_params, const std::vector<AnfNodePtr> &forward_params,
                       const PipelinePair &forward_params_pair, const std::vector<AnfNodePtr> &backward_end,
                       const PipelinePair &forward_start_pair, const FuncGraphPtr &root);
@@ -29,10 +29,29 @@
 #include "frontend/parallel/device_manager.h"
 #include "frontend/parallel/device_matrix.h"
 #include "frontend/parallel/dynamic_creator.h"
+#include "frontend/parallel/graph_util/generate_graph.h"
 #include "frontend/parallel/tensor_layout/tensor_redistribution.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+// The number of the chunks of the rows of the MatMul whose forward all reduce is split, 1 or unset means no split.
+constexpr char kEnvMatMulCommChunkNum[] = "MS_DEV_MATMUL_COMM_CHUNK_NUM";
+
+int64_t GetCommChunkNum() {
+  auto env = common::GetEnv(kEnvMatMulCommChunkNum);
+  if (env.empty()) {
+    return 1;
+  }
+  try {
+    return std::stoll(env);
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "The value of " << kEnvMatMulCommChunkNum << " is invalid: " << env;
+    return 1;
+  }
+}
+}  // namespace
+
 void SetDevMatrixShape(const Dimensions &mat_a_strategy, const Dimensions &mat_b_strategy, bool transpose_b,
                        Shape *dev_matrix_shape) {
   MS_EXCEPTION_IF_NULL(dev_matrix_shape);
@@ -485,6 +504,88 @@ std::vector<StrategyPtr> MatMulBase::GenerateOpStrategies(int64_t stage_id) {
   return sp_vector;
 }
 
+Status MatMulInfo::InferForwardCommunication() {
+  comm_chunk_num_ = 1;
+  comm_chunk_group_.clear();
+  if (MatMul::InferForwardCommunication() != SUCCESS) {
+    return FAILED;
+  }
+  auto chunk_num = GetCommChunkNum();
+  // only the rows of the 2-D matmul are split, the batch dimensions may be broadcast with the other input.
+  if (chunk_num <= 1 || forward_op_.empty() || forward_reduce_scatter_ || transpose_a_ ||
+      inputs_shape_.at(0).size() != 2 || inputs_shape_.at(1).size() != 2) {
+    return SUCCESS;
+  }
+
+  auto rows = inputs_shape_.at(0).at(0);
+  auto rows_split = strategy_->GetInputDim().at(0).at(0);
+  if (rows <= 0 || rows % rows_split != 0 || (rows / rows_split) % chunk_num != 0) {
+    MS_LOG(INFO) << name_ << ": The slice rows " << rows << "/" << rows_split << " can not be split into " << chunk_num
+                 << " chunks, use the forward all reduce of the whole output.";
+    return SUCCESS;
+  }
+
+  const auto &op_attrs = forward_op_[0].second.first;
+  auto group_attr =
+    std::find_if(op_attrs.begin(), op_attrs.end(), [](const Attr &attr) { return attr.first == GROUP; });
+  if (group_attr == op_attrs.end()) {
+    MS_LOG(ERROR) << name_ << ": The forward all reduce has no group.";
+    return FAILED;
+  }
+  // the all reduce of each chunk is in the replace graph, so the forward op is not inserted again.
+  comm_chunk_group_ = GetValue<std::string>(group_attr->second);
+  comm_chunk_num_ = chunk_num;
+  forward_op_.clear();
+  MS_LOG(INFO) << name_ << ": Split the forward all reduce into " << comm_chunk_num_ << " chunks, the group is "
+               << comm_chunk_group_;
+  return SUCCESS;
+}
+
+Status MatMulInfo::ComputeReplaceGraph(const CNodePtr &cnode) {
+  GenerateGraph gen_g = GenerateGraph(attrs_);
+  if (gen_g.Init(cnode) != SUCCESS) {
+    MS_LOG(ERROR) << name_ << ": GenerateGraph Init failed";
+    return FAILED;
+  }
+
+  OperatorAttrs split_attrs = {std::make_pair(AXIS, MakeValue(int64_t(0))),
+                               std::make_pair(OUTPUT_NUM, MakeValue(comm_chunk_num_))};
+  auto split = gen_g.PushBack({gen_g.NewOpInst(SPLIT, split_attrs), gen_g.virtual_input_node()});
+  std::vector<std::pair<AnfNodePtr, int64_t>> input_nodes = {std::make_pair(split, 1)};
+
+  OperatorAttrs matmul_attrs = {std::make_pair(TRANSPOSE_A, MakeValue(transpose_a_)),
+                                std::make_pair(TRANSPOSE_B, MakeValue(transpose_b_))};
+  OperatorAttrs all_reduce_attrs = {std::make_pair(OP, MakeValue(REDUCE_OP_SUM)),
+                                    std::make_pair(GROUP, MakeValue(comm_chunk_group_))};
+  std::vector<AnfNodePtr> make_tuple_inputs = {gen_g.NewOpInst(MAKE_TUPLE)};
+  // the chunks do not depend on each other, so the all reduce of a chunk runs on the communication stream while the
+  // matmul of the next chunk is computing.
+  for (int64_t i = 0; i < comm_chunk_num_; ++i) {
+    auto chunk = gen_g.PushBack({gen_g.NewOpInst(TUPLE_GETITEM), split, CreatInt64Imm(i)});
+    auto matmul = gen_g.PushBack({gen_g.NewOpInst(MATMUL, matmul_attrs), chunk, gen_g.virtual_input_node()});
+    auto all_reduce = gen_g.PushBack({gen_g.NewOpInst(ALL_REDUCE, all_reduce_attrs), matmul});
+    input_nodes.push_back(std::make_pair(matmul, 2));
+    make_tuple_inputs.push_back(all_reduce);
+  }
+  auto make_tuple = gen_g.PushBack(make_tuple_inputs);
+
+  OperatorAttrs concat_attrs = {std::make_pair(AXIS, MakeValue(int64_t(0)))};
+  auto concat = gen_g.PushBack({gen_g.NewOpInst(CONCAT, concat_attrs), make_tuple});
+  replace_graph_ = std::make_shared<std::pair<std::vector<std::pair<AnfNodePtr, int64_t>>, AnfNodePtr>>(
+    std::make_pair(input_nodes, concat));
+  return SUCCESS;
+}
+
+ReplaceGraphPtr MatMulInfo::replace_graph(const CNodePtr &cnode) {
+  if (comm_chunk_num_ <= 1) {
+    return nullptr;
+  }
+  if (ComputeReplaceGraph(cnode) != SUCCESS) {
+    MS_LOG(EXCEPTION) << name_ << ": ComputeReplaceGraph failed.";
+  }
+  return replace_graph_;
+}
+
 std::shared_ptr<Strategies> BatchMatMulInfo::GenerateBatchStrategies() {
   Dimensions batch_strategy(inputs_shape_[1].size() - 1, 1);
   (void)batch_strategy.insert(batch_strategy.cbegin(), stage_device_size_);
@@ -76,6 +76,19 @@ class MatMulInfo : public MatMul {
              const PrimitiveAttrs &attrs)
       : MatMul(name, inputs_shape, outputs_shape, attrs) {}
   ~MatMulInfo() override = default;
+
+  ReplaceGraphPtr replace_graph(const CNodePtr &cnode) override;
+
+ protected:
+  Status InferForwardCommunication() override;
+
+ private:
+  Status ComputeReplaceGraph(const CNodePtr &cnode);
+
+  // split the rows of the matmul into chunks and all reduce each chunk, so the communication of a chunk overlaps
+  // the computation of the next chunks.
+  int64_t comm_chunk_num_ = 1;
+  std::string comm_chunk_group_;
 };
 
 class BatchMatMulInfo : public MatMul {
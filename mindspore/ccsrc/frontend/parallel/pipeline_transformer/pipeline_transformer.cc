@@ -203,7 +203,7 @@ void PipelineTransformer::LabelGenMaskFusion() {
       continue;
     }
     auto stage = (*fg)->stage();
-    if (stage != -1 && stage != stage_) {
+    if (stage != -1 && !IsLocalStage(stage)) {
       continue;
     }
     auto nodes = (*fg)->nodes();
@@ -245,7 +245,7 @@ void PipelineTransformer::Coloring() {
           auto user_node = user_pair.first->cast<CNodePtr>();
           user_node->set_user_data<NodeStageInfo>(std::make_shared<NodeStageInfo>(graph->stage()));
           auto user_node_graph = user_node->func_graph();
-          if (graph->stage() == stage_ && user_node_graph->stage() == -1) {
+          if (IsLocalStage(graph->stage()) && user_node_graph->stage() == -1) {
             user_node_graph->set_stage(graph->stage());
             need_coloring = true;
           }
@@ -255,11 +255,25 @@ void PipelineTransformer::Coloring() {
   }
   MS_EXCEPTION_IF_NULL(g_device_manager);
   auto stage_num = g_device_manager->stage_num();
-  if (SizeToLong(stage_set.size()) != stage_num) {
-    MS_LOG(EXCEPTION) << "Stage num is " << stage_num << " is not equal to stage used: " << stage_set.size();
+  // The cells can be set with the stages in [0, stage_num * chunk_num), and each device runs chunk_num virtual stages.
+  if (stage_set.empty() || SizeToLong(stage_set.size()) % stage_num != 0 ||
+      *stage_set.rbegin() != SizeToLong(stage_set.size()) - 1) {
+    MS_LOG(EXCEPTION) << "Stage num is " << stage_num << ", the stages used: " << stage_set.size()
+                      << " should be a multiple of it and start from 0 continuously.";
   }
+  chunk_num_ = SizeToLong(stage_set.size()) / stage_num;
+  if (chunk_num_ > 1) {
+    MS_LOG(INFO) << "Each stage has " << chunk_num_ << " virtual stages, the interleaved schedule will be used.";
+  }
+}
+
+int64_t PipelineTransformer::PhysicalStage(int64_t stage) const {
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  return stage % g_device_manager->stage_num();
 }
 
+bool PipelineTransformer::IsLocalStage(int64_t stage) const { return stage != -1 && PhysicalStage(stage) == stage_; }
+
 void PipelineTransformer::BroadCastColoring() {
   auto need_coloring = true;
   while (need_coloring) {
@@ -479,7 +493,9 @@ std::vector<AnfNodePtr> PipelineTransformer::HandleSharedParameter() {
       if (IsValueNode<FuncGraph>(cnode->input(0))) {
         graph = GetValueNode<FuncGraphPtr>(cnode->input(0));
       }
-      if (graph == root_ || graph->stage() == -1 || parameter_stage.count(stage_) == 0) {
+      if (graph == root_ || graph->stage() == -1 ||
+          std::none_of(parameter_stage.cbegin(), parameter_stage.cend(),
+                       [this](int64_t stage) { return IsLocalStage(stage); })) {
         continue;
       }
       auto micro = cnode->GetPrimalAttr(MICRO);
@@ -487,9 +503,9 @@ std::vector<AnfNodePtr> PipelineTransformer::HandleSharedParameter() {
         MS_LOG(INFO) << "parameter: " << parameter->ToString() << " doesn't have micro batch";
         micro = MakeValue(int64_t(0));
       }
-      if (stage_ == *parameter_stage.begin()) {
+      if (IsLocalStage(*parameter_stage.begin())) {
         auto stage_info = node->user_data<NodeStageInfo>();
-        if (graph->stage() == stage_ || stage_info == nullptr) {
+        if (IsLocalStage(graph->stage()) || stage_info == nullptr) {
           continue;
         }
         auto user_stage = stage_info->stage();
@@ -545,7 +561,7 @@ void PipelineTransformer::ParameterColoring() {
     }
     MS_EXCEPTION_IF_NULL(param_info);
     auto requires_grad = param_info->requires_grad();
-    if (!parameter_stage.empty() && *parameter_stage.begin() == stage_ && !virtual_param_ && requires_grad) {
+    if (!parameter_stage.empty() && IsLocalStage(*parameter_stage.begin()) && !virtual_param_ && requires_grad) {
       virtual_param_ = parameter;
     }
     parameter_color_map_[parameter] = parameter_stage;
@@ -566,7 +582,7 @@ void PipelineTransformer::RemoveMonadNode() {
       continue;
     }
     auto stage = stage_info->stage();
-    if (stage != stage_ && stage != -1) {
+    if (stage != -1 && !IsLocalStage(stage)) {
       auto node_users = node_users_map[node];
       for (auto &user_node : node_users) {
         auto u_node = NewValueNode(kUMonad);
@@ -618,7 +634,7 @@ AnfNodePtr PipelineTransformer::FindPipelineCareNode(const AnfNodePtr &node) con
 
 SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t user_node_stage, int64_t node_stage,
                                          const ValuePtr &value) {
-  auto dest_rank = global_rank_ + (user_node_stage - node_stage) * per_stage_rank_num_;
+  auto dest_rank = global_rank_ + (PhysicalStage(user_node_stage) - PhysicalStage(node_stage)) * per_stage_rank_num_;
   int64_t send_tag;
   if (send_tag_map.find(dest_rank) != send_tag_map.end()) {
     send_tag = send_tag_map[dest_rank] + 1;
@@ -628,7 +644,7 @@ SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t us
     send_tag_map[dest_rank] = 0;
   }
   Attr attr_tag = std::make_pair(SR_TAG, MakeValue(send_tag));
-  Attr attr_rank = std::make_pair(DEST_RANK, MakeValue(user_node_stage));
+  Attr attr_rank = std::make_pair(DEST_RANK, MakeValue(PhysicalStage(user_node_stage)));
   Attr attr_group = std::make_pair(GROUP, MakeValue(group_[0]));
   Attr attr_group_back = std::make_pair(GROUP_BACK, MakeValue(group_[1]));
   OperatorAttrs attrs = {attr_tag, attr_rank, attr_group, attr_group_back};
@@ -664,6 +680,9 @@ SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t us
   auto send = main_graph_->NewCNode(send_input);
   if (!parameter->isa<Parameter>() && care_node != nullptr && !care_node->isa<Parameter>()) {
     send->AddPrimalAttr(PIPELINE_END, value);
+    if (chunk_num_ > 1) {
+      send->AddPrimalAttr(PIPELINE_CHUNK, MakeValue(node_stage / g_device_manager->stage_num()));
+    }
   } else {
     send->AddPrimalAttr(PIPELINE_PARAM, value);
     send->set_user_data<OperatorInfo>(op_info);
@@ -688,7 +707,7 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
                                               const AnfNodePtr &use_node, int index, int64_t user_node_stage,
                                               int64_t node_stage, const ValuePtr &value,
                                               const AnfNodePtr &graph_param) {
-  auto src_rank = global_rank_ - (user_node_stage - node_stage) * per_stage_rank_num_;
+  auto src_rank = global_rank_ - (PhysicalStage(user_node_stage) - PhysicalStage(node_stage)) * per_stage_rank_num_;
   int64_t recv_tag;
   if (recv_tag_map.find(src_rank) != recv_tag_map.end()) {
     recv_tag = recv_tag_map[src_rank] + 1;
@@ -698,7 +717,7 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
     recv_tag_map[src_rank] = 0;
   }
   Attr attr_tag = std::make_pair(SR_TAG, MakeValue(recv_tag));
-  Attr attr_rank = std::make_pair(SRC_RANK, MakeValue(node_stage));
+  Attr attr_rank = std::make_pair(SRC_RANK, MakeValue(PhysicalStage(node_stage)));
   std::pair<OperatorInfoPtr, int> op_info_pair;
   bool is_param = true;
   TensorInfo tensor_info;
@@ -740,6 +759,9 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
     recv->AddPrimalAttr(PIPELINE_PARAM, value);
   } else {
     recv->AddPrimalAttr(PIPELINE_BEGIN, value);
+    if (chunk_num_ > 1) {
+      recv->AddPrimalAttr(PIPELINE_CHUNK, MakeValue(user_node_stage / g_device_manager->stage_num()));
+    }
   }
   recv->AddPrimalAttr(MICRO, value);
   auto node_abstract = node->abstract();
@@ -782,7 +804,7 @@ AnfNodePtr PipelineTransformer::Reuse(const AnfNodePtr &node, int64_t stage, con
     if (cnode->input(1) == node) {
       auto prim = GetValueNode<PrimitivePtr>(cnode->input(0));
       auto dest_rank_send = GetValue<int64_t>(prim->GetAttr(tag));
-      if (dest_rank_send == stage) {
+      if (dest_rank_send == PhysicalStage(stage)) {
         return input;
       }
     }
@@ -828,7 +850,7 @@ AnfNodePtr PipelineTransformer::HandleParameterGraph(const AnfNodePtr &node, con
   auto parameter = use_parameter_list.at(pos - 1);
 
   // insert receive
-  if (stage_ == user_stage) {
+  if (IsLocalStage(user_stage)) {
     auto recv = Reuse(argument, stage, ops, SRC_RANK);
     if (recv) {
       manager_->SetEdge(use_node, SizeToInt(pos), recv);
@@ -860,7 +882,8 @@ void PipelineTransformer::CutBorderForNode(const FuncGraphPtr &graph, const AnfN
       continue;
     }
     auto user_node_stage = user_stage_info->stage();
-    if (node_stage != stage_ && user_node_stage != stage_) {
+    // Only the border between this device and another one is cut, the virtual stages of a device share the nodes.
+    if (IsLocalStage(node_stage) == IsLocalStage(user_node_stage)) {
       continue;
     }
     auto micro = user_node->cast<CNodePtr>()->GetPrimalAttr(MICRO);
@@ -869,7 +892,7 @@ void PipelineTransformer::CutBorderForNode(const FuncGraphPtr &graph, const AnfN
       micro = MakeValue(int64_t(0));
     }
     if (node_stage < user_node_stage) {
-      if (node_stage == stage_) {
+      if (IsLocalStage(node_stage)) {
         if (IsParameterGraph(node)) {
           auto send_depend = HandleParameterGraph(node, user_node, node_stage, user_node_stage, micro,
                                                   IntToSize(user_pair.second), *send_ops);
@@ -946,6 +969,15 @@ void PipelineTransformer::CutGraph() {
   auto send_recv_ops = CutBorder(main_graph_);
   auto send_ops = send_recv_ops.first;
   if (IsLastStage()) {
+    // The last stage sends the outputs of its virtual stages except the last one, which are kept by the loss.
+    if (chunk_num_ == 1 || (send_ops.empty() && make_tuple_inputs.size() <= 1)) {
+      return;
+    }
+    (void)make_tuple_inputs.insert(make_tuple_inputs.cend(), send_ops.cbegin(), send_ops.cend());
+    auto make_tuple = main_graph_->NewCNode(make_tuple_inputs);
+    std::vector<AnfNodePtr> out = {NewValueNode(prim::kPrimDepend), main_graph_->output(), make_tuple};
+    auto out_node = main_graph_->NewCNode(out);
+    (void)manager_->Replace(main_graph_->output(), out_node);
     return;
   }
   if (send_ops.empty() && !root_->has_flag(kTraining)) {
@@ -1084,7 +1116,7 @@ bool PipelineTransformer::IsRedundancyParameter(const AnfNodePtr &parameter) {
   if (stage_set.empty()) {
     return false;
   }
-  return stage_set.count(stage_) == 0;
+  return std::none_of(stage_set.cbegin(), stage_set.cend(), [this](int64_t stage) { return IsLocalStage(stage); });
 }
 
 void PipelineTransformer::ElimParameter() {
@@ -94,6 +94,8 @@ class PipelineTransformer {
   void RedundancyNode(const AnfNodePtr &node, mindspore::HashMap<CNodePtr, std::vector<AnfNodePtr>> *make_tuple_map);
   bool IsRedundancyParameter(const AnfNodePtr &parameter);
   void ElimParameter();
+  int64_t PhysicalStage(int64_t stage) const;
+  bool IsLocalStage(int64_t stage) const;
   FuncGraphManagerPtr manager_;
   int64_t stage_;
   FuncGraphPtr root_;
@@ -105,6 +107,8 @@ class PipelineTransformer {
   ValueListPtr shape_;
   AnfNodePtr virtual_param_;
   int64_t micro_size_ = 0;
+  // The number of the virtual stages on each device, the stage s runs on the device stage s % stage_num.
+  int64_t chunk_num_ = 1;
   std::vector<std::string> group_ = {};
   mindspore::HashMap<AnfNodePtr, std::set<int64_t>> parameter_color_map_ = {};
 };
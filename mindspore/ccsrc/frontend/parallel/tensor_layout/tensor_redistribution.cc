@@ -18,14 +18,35 @@
 #include <functional>
 #include <numeric>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <utility>
 #include <string>
+#include "utils/hash_map.h"
 #include "utils/ms_utils.h"
+#include "include/common/utils/parallel_context.h"
 #include "frontend/parallel/status.h"
+#include "frontend/parallel/auto_parallel/comm_cost_calibration.h"
 #include "frontend/parallel/tensor_layout/shape_util.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+struct RedistributionCost {
+  bool reshape_flag;
+  double comm_cost;
+  double forward_comm_cost;
+  double backward_comm_cost;
+  double computation_cost;
+  double memory_cost;
+};
+
+// The strategy search asks for the cost of the same layout pairs on many edges and layers, so the costs are cached.
+constexpr size_t kRedistributionCostCacheSize = 100000;
+std::mutex g_cost_cache_mutex;
+mindspore::HashMap<std::string, RedistributionCost> g_cost_cache;
+}  // namespace
+
 Status TensorRedistribution::Init(const TensorLayout &from, const TensorLayout &to, const RankList &dev_list) {
   from_origin_ = from;
   to_origin_ = to;
@@ -202,7 +223,49 @@ Status TensorRedistribution::InferRedistribution(const TensorLayout &from_layout
   return Status::SUCCESS;
 }
 
+std::string TensorRedistribution::CostCacheKey() const {
+  std::ostringstream buffer;
+  buffer << from_origin_.ToString() << to_origin_.ToString() << std::endl << "device list = ";
+  for (auto rank : dev_list_) {
+    buffer << rank << ",";
+  }
+  buffer << std::endl << keep_reshape_ << ParallelContext::GetInstance()->enable_all2all();
+  return buffer.str();
+}
+
 Status TensorRedistribution::ComputeCost() {
+  // The operators are not constructed in the cost model, so the cost only depends on the layouts.
+  if (construct_op_flag_) {
+    return InferCost();
+  }
+  auto key = CostCacheKey();
+  {
+    std::lock_guard<std::mutex> lock(g_cost_cache_mutex);
+    auto iter = g_cost_cache.find(key);
+    if (iter != g_cost_cache.end()) {
+      const auto &cost = iter->second;
+      reshape_flag_ = cost.reshape_flag;
+      comm_cost_ = cost.comm_cost;
+      forward_comm_cost_ = cost.forward_comm_cost;
+      backward_comm_cost_ = cost.backward_comm_cost;
+      computation_cost_ = cost.computation_cost;
+      memory_cost_ = cost.memory_cost;
+      return Status::SUCCESS;
+    }
+  }
+  if (InferCost() != Status::SUCCESS) {
+    return Status::FAILED;
+  }
+  std::lock_guard<std::mutex> lock(g_cost_cache_mutex);
+  if (g_cost_cache.size() >= kRedistributionCostCacheSize) {
+    g_cost_cache.clear();
+  }
+  g_cost_cache[key] = {reshape_flag_, comm_cost_, forward_comm_cost_, backward_comm_cost_, computation_cost_,
+                       memory_cost_};
+  return Status::SUCCESS;
+}
+
+Status TensorRedistribution::InferCost() {
   RedistributionOpListPtr redistribution_oplist_ptr = InferTensorRedistributionOperatorList(true);
   if (redistribution_oplist_ptr == nullptr) {
     MS_LOG(ERROR) << "Failure: InferTensorRedistribution failed";
@@ -249,9 +312,14 @@ Status TensorRedistribution::ComputePermuteCost(double input_size, const Shape &
     MS_LOG(ERROR) << "attrs size should not be less than 5!";
     return Status::FAILED;
   }
-  forward_comm_cost_ += input_size * ALLTOALL_SCALE_FACTOR;
-  backward_comm_cost_ += input_size * ALLTOALL_SCALE_FACTOR;
-  comm_cost_ += COST_FACTOR * input_size * ALLTOALL_SCALE_FACTOR;
+  double alltoall_factor = ALLTOALL_SCALE_FACTOR;
+  const auto &calibration = CommCostCalibration::GetInstance();
+  if (calibration.enable()) {
+    alltoall_factor = calibration.BandwidthFactor(kCommAllToAll, LongToSize(attrs[TRANSFER_PERMUTE_DEV_NUM_INDEX]));
+  }
+  forward_comm_cost_ += input_size * alltoall_factor;
+  backward_comm_cost_ += input_size * alltoall_factor;
+  comm_cost_ += COST_FACTOR * input_size * alltoall_factor;
   int64_t concat_dim = attrs[TRANSFER_PERMUTE_CONCAT_DIM_INDEX];
   if (concat_dim == 0) {
     // memory cost = all_gather
@@ -275,9 +343,17 @@ Status TensorRedistribution::ComputeConcatCost(double input_size, const Shape &a
   }
   double dev_num = attrs[TRANSFER_CONCAT_SPLIT_COUNT_INDEX];
   // here, communication cost = all_gather + reduce_scatter
-  forward_comm_cost_ += input_size * dev_num * ALLGATHER_REDUCESCATTER_SCALE_FACTOR;
-  backward_comm_cost_ += input_size * ALLGATHER_REDUCESCATTER_SCALE_FACTOR;
-  comm_cost_ += input_size * (dev_num + 1.0) * ALLGATHER_REDUCESCATTER_SCALE_FACTOR;
+  double allgather_factor = ALLGATHER_REDUCESCATTER_SCALE_FACTOR;
+  double reducescatter_factor = ALLGATHER_REDUCESCATTER_SCALE_FACTOR;
+  const auto &calibration = CommCostCalibration::GetInstance();
+  if (calibration.enable()) {
+    auto group_size = static_cast<size_t>(dev_num);
+    allgather_factor = calibration.BandwidthFactor(kCommAllGather, group_size);
+    reducescatter_factor = calibration.BandwidthFactor(kCommReduceScatter, group_size);
+  }
+  forward_comm_cost_ += input_size * dev_num * allgather_factor;
+  backward_comm_cost_ += input_size * reducescatter_factor;
+  comm_cost_ += input_size * (dev_num * allgather_factor + reducescatter_factor);
   int64_t concat_dim = attrs[TRANSFER_CONCAT_TENSOR_DIM_INDEX];
   if (concat_dim == 0) {
     // computation cost = all_gather
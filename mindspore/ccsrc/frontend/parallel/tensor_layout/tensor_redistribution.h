@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_FRONTEND_PARALLEL_TENSOR_LAYOUT_TENSOR_REDISTRIBUTION_H_
 #define MINDSPORE_CCSRC_FRONTEND_PARALLEL_TENSOR_LAYOUT_TENSOR_REDISTRIBUTION_H_
 
+#include <string>
 #include <vector>
 
 #include "ir/value.h"
@@ -59,6 +60,8 @@ class TensorRedistribution {
   Status InferRedistribution(const TensorLayout &from_layout, const TensorLayout &to_layout,
                              OperatorVector *const operator_vector, OutPutInfoVector *const output_info_vector,
                              bool is_cost_model);
+  Status InferCost();
+  std::string CostCacheKey() const;
   Status ComputeConcatCost(double input_size, const Shape &attrs);
   Status ComputePermuteCost(double input_size, const Shape &attrs);
   RedistributionOpListPtr InferTensorRedistributionOperatorListUnExpand(bool is_cost_model = false);
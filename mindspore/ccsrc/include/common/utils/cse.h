@@ -19,6 +19,7 @@
 #ifndef MINDSPORE_CCSRC_INCLUDE_COMMON_UTILS_CSE_H_
 #define MINDSPORE_CCSRC_INCLUDE_COMMON_UTILS_CSE_H_
 
+#include <utility>
 #include <vector>
 #include "utils/hash_map.h"
 #include "ir/anf.h"
@@ -47,6 +48,11 @@ class COMMON_EXPORT CSE {
   bool BuildOrderGroupAndDoReplace(const FuncGraphManagerPtr manager) const;
   bool DoReplace(const FuncGraphManagerPtr manager, const std::vector<std::size_t> &order_group,
                  mindspore::HashMap<std::size_t, std::vector<AnfNodePtr>> *groups) const;
+
+  // The change version and output of each graph after its last elimination, the graph is skipped in the next run if
+  // the manager has not changed it since then.
+  mutable mindspore::HashMap<const FuncGraph *, std::pair<std::size_t, const AnfNode *>> clean_graphs_;
+  mutable const FuncGraphManager *clean_graphs_manager_{nullptr};
 };
 
 COMMON_EXPORT BasePtr AbsOf(const AnfNodePtr &node, bool ignore_fg_abs_tracking_id = false);
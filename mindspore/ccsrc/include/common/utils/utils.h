@@ -496,6 +496,7 @@ constexpr auto kAttrRootRank = "root_rank";
 constexpr auto kAttrComm = "comm";
 constexpr auto kAttrIsTraining = "is_training";
 constexpr auto kAttrFusionId = "fusion_id";
+constexpr auto kAttrFusedActivation = "fused_activation";
 constexpr auto kAttrDuplicated = "duplicated";
 constexpr auto kAttrBucketId = "bucket_id";
 constexpr auto kAttrGradOutputIndex = "grad_output_index";
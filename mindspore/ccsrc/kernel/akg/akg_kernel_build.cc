@@ -21,6 +21,8 @@
 
 #include <chrono>
 #include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,6 +30,7 @@
 #include <utility>
 #include <vector>
 #include <iostream>
+#include <thread>
 #include "ir/dtype.h"
 #include "ir/func_graph.h"
 #include "common/graph_kernel/graph_kernel_flags.h"
@@ -35,6 +38,9 @@
 #include "kernel/akg/akg_kernel_json_generator.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
+#include "include/common/debug/common.h"
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace kernel {
@@ -42,9 +48,99 @@ constexpr int32_t MAX_ERROR_LEN = 1024;
 constexpr int32_t PROCESS_NUM = 16;
 constexpr int32_t TIME_OUT = 300;
 constexpr auto kLogLevel = "log_level";
+constexpr auto kSharedKernelCachePathEnv = "MS_AKG_KERNEL_CACHE_PATH";
 
 #define ACQUIRE_LOCK LockMng lock(fd_, __func__, __LINE__)
 
+// The number of akg compiling processes, which is sized to the available cores but not more than the kernels.
+int32_t GetBuildProcessNum(size_t kernel_num) {
+  auto core_num = static_cast<size_t>(std::thread::hardware_concurrency());
+  if (core_num == 0) {
+    core_num = static_cast<size_t>(PROCESS_NUM);
+  }
+  return SizeToInt(std::max<size_t>(1, std::min(core_num, kernel_num)));
+}
+
+// The kernel binaries in the shared cache directory are shared across processes and ranks. The kernel name is
+// generated by the hash of the kernel json, which contains the target info, so it identifies the kernel binary
+// on the same processor.
+std::string GetSharedKernelCachePath() {
+  static std::string shared_path = []() -> std::string {
+    auto env_path = common::GetEnv(kSharedKernelCachePathEnv);
+    if (env_path.empty()) {
+      return "";
+    }
+    auto path = env_path + "/" + GetStrProcessorFromContext() + "/";
+    auto real_path = FileUtils::CreateNotExistDirs(path, true);
+    if (!real_path.has_value()) {
+      MS_LOG(WARNING) << "Create the shared akg kernel cache directory " << path
+                      << " failed, the shared cache is disabled.";
+      return "";
+    }
+    return real_path.value() + "/";
+  }();
+  return shared_path;
+}
+
+// Get the names of the json and binary files of the kernel in the directory.
+std::vector<std::string> GetKernelFiles(const std::string &dir_path, const std::string &kernel_name) {
+  std::vector<std::string> files;
+  DIR *dir = opendir(dir_path.c_str());
+  if (dir == nullptr) {
+    return files;
+  }
+  struct dirent *entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    std::string file_name = entry->d_name;
+    auto stem = file_name.substr(0, file_name.rfind('.'));
+    if (stem == kernel_name || stem == "lib" + kernel_name) {
+      (void)files.emplace_back(file_name);
+    }
+  }
+  (void)closedir(dir);
+  return files;
+}
+
+// Copy the file by writing a temporary file and renaming it, so the readers never see a partial file.
+bool CopyFileAtomically(const std::string &src, const std::string &dst) {
+  std::ifstream src_file(src, std::ios::binary);
+  if (!src_file.is_open()) {
+    return false;
+  }
+  auto tmp = dst + ".tmp" + std::to_string(getpid());
+  {
+    std::ofstream tmp_file(tmp, std::ios::binary | std::ios::trunc);
+    if (!tmp_file.is_open()) {
+      return false;
+    }
+    tmp_file << src_file.rdbuf();
+    if (!tmp_file.good()) {
+      (void)std::remove(tmp.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmp.c_str(), dst.c_str()) != 0) {
+    (void)std::remove(tmp.c_str());
+    return false;
+  }
+  return true;
+}
+
+// Copy the json and binary files of the kernel, the json file is copied at last as it marks the kernel is complete.
+bool CopyKernelFiles(const std::string &src_dir, const std::string &dst_dir, const std::string &kernel_name) {
+  auto files = GetKernelFiles(src_dir, kernel_name);
+  auto json_file = kernel_name + kJsonSuffix;
+  if (std::find(files.begin(), files.end(), json_file) == files.end()) {
+    return false;
+  }
+  for (const auto &file : files) {
+    if (file != json_file && !CopyFileAtomically(src_dir + file, dst_dir + file)) {
+      return false;
+    }
+  }
+  return CopyFileAtomically(src_dir + json_file, dst_dir + json_file);
+}
+
 inline std::string GetErrorInfo() {
   char buf[MAX_ERROR_LEN + 1] = {0};
   auto ret = strerror_r(errno, buf, MAX_ERROR_LEN);
@@ -405,6 +501,9 @@ std::vector<JsonNodePair> AkgKernelBuilder::GetNotCachedKernels(const std::vecto
     auto kernel_name = json_generator.kernel_name();
 
     auto cached_kernel_pack = AkgSearchCache(kernel_name);
+    if (cached_kernel_pack == nullptr) {
+      cached_kernel_pack = FetchFromSharedCache(kernel_name);
+    }
     if (cached_kernel_pack != nullptr) {
       MS_LOG(DEBUG) << "Use cached kernel, kernel_name[" << kernel_name << "], fullname_with_scope["
                     << anf_node->fullname_with_scope() << "].";
@@ -432,11 +531,36 @@ bool AkgKernelBuilder::InsertToCache(const std::vector<JsonNodePair> &build_args
       return false;
     }
     AkgSetKernelMod(new_kernel_pack, json_generator, anf_node);
+    PublishToSharedCache(kernel_name);
     MS_LOG(DEBUG) << "Akg compile " << kernel_name << " kernel and insert cache successfully!";
   }
   return true;
 }
 
+KernelPackPtr AkgKernelBuilder::FetchFromSharedCache(const std::string &kernel_name) {
+  auto shared_path = GetSharedKernelCachePath();
+  if (shared_path.empty()) {
+    return nullptr;
+  }
+  auto kernel_meta_path = KernelMeta::GetInstance()->kernel_meta_path();
+  if (!CopyKernelFiles(shared_path, kernel_meta_path, kernel_name)) {
+    return nullptr;
+  }
+  MS_LOG(INFO) << "Fetch kernel " << kernel_name << " from the shared cache " << shared_path;
+  return AkgInsertCache(kernel_name);
+}
+
+void AkgKernelBuilder::PublishToSharedCache(const std::string &kernel_name) {
+  auto shared_path = GetSharedKernelCachePath();
+  if (shared_path.empty() || Common::FileExists(shared_path + kernel_name + kJsonSuffix)) {
+    return;
+  }
+  auto kernel_meta_path = KernelMeta::GetInstance()->kernel_meta_path();
+  if (!CopyKernelFiles(kernel_meta_path, shared_path, kernel_name)) {
+    MS_LOG(WARNING) << "Publish kernel " << kernel_name << " to the shared cache " << shared_path << " failed.";
+  }
+}
+
 bool AkgKernelBuilder::HandleRepeatNodes() {
   for (const auto &[json_generator, anf_node] : repeat_nodes_) {
     auto kernel_name = json_generator.kernel_name();
@@ -494,7 +618,7 @@ bool AkgKernelBuilder::ParallelBuild(const std::vector<JsonNodePair> &build_args
 
     auto client = GetClient();
     MS_EXCEPTION_IF_NULL(client);
-    if (!client->AkgStart(PROCESS_NUM, TIME_OUT)) {
+    if (!client->AkgStart(GetBuildProcessNum(jsons.size()), TIME_OUT)) {
       MS_LOG(ERROR) << "Akg start failed.";
       return false;
     }
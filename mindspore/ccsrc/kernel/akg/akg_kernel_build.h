@@ -54,6 +54,10 @@ class AkgKernelBuilder {
   std::vector<std::string> GetKernelJsonsByHashId(const std::vector<JsonNodePair> &build_args,
                                                   const std::set<size_t> &fetched_ids);
   bool InsertToCache(const std::vector<JsonNodePair> &build_args);
+  // Fetch the kernel from the shared cache directory of env MS_AKG_KERNEL_CACHE_PATH to the local kernel meta.
+  KernelPackPtr FetchFromSharedCache(const std::string &kernel_name);
+  // Publish the compiled kernel in the local kernel meta to the shared cache directory.
+  void PublishToSharedCache(const std::string &kernel_name);
   bool HandleRepeatNodes();
   bool AkgOpParallelBuild(const std::vector<JsonNodePair> &build_args);
 
@@ -16,6 +16,9 @@
 
 #include "minddata/dataset/api/python/pybind_register.h"
 #include "minddata/dataset/engine/datasetops/batch_op.h"
+#ifdef ENABLE_CACHE
+#include "minddata/dataset/engine/datasetops/source/generator_shm_ring.h"
+#endif
 
 namespace mindspore {
 namespace dataset {
@@ -42,5 +45,58 @@ PYBIND_REGISTER(DatasetOp, 0, ([](const py::module *m) {
                   (void)py::class_<DatasetOp, std::shared_ptr<DatasetOp>>(*m, "DatasetOp");
                 }));
 
+#ifdef ENABLE_CACHE
+PYBIND_REGISTER(GeneratorShmRow, 0, ([](const py::module *m) {
+                  (void)py::class_<GeneratorShmRow>(*m, "GeneratorShmRow")
+                    .def_readonly("slot", &GeneratorShmRow::slot);
+                }));
+
+PYBIND_REGISTER(
+  GeneratorShmRing, 0, ([](const py::module *m) {
+    (void)py::class_<GeneratorShmRing, std::shared_ptr<GeneratorShmRing>>(*m, "GeneratorShmRing")
+      .def(py::init([](int32_t num_slots, int64_t slot_size) {
+        std::shared_ptr<GeneratorShmRing> ring;
+        THROW_IF_ERROR(GeneratorShmRing::Create(num_slots, slot_size, &ring));
+        return ring;
+      }))
+      .def_static("attach",
+                  [](int32_t key) {
+                    std::shared_ptr<GeneratorShmRing> ring;
+                    THROW_IF_ERROR(GeneratorShmRing::Attach(key, &ring));
+                    return ring;
+                  })
+      .def("key", &GeneratorShmRing::key)
+      .def("num_slots", &GeneratorShmRing::num_slots)
+      .def("slot_size", &GeneratorShmRing::slot_size)
+      .def("num_slots_in_use", &GeneratorShmRing::NumSlotsInUse)
+      .def("acquire",
+           [](GeneratorShmRing &ring) {
+             int32_t slot = -1;
+             THROW_IF_ERROR(ring.AcquireSlot(&slot));
+             return slot;
+           })
+      .def("buffer",
+           [](GeneratorShmRing &ring, int32_t slot) {
+             auto data = ring.SlotData(slot);
+             if (data == nullptr) {
+               THROW_IF_ERROR(Status(StatusCode::kMDUnexpectedError, "Invalid slot " + std::to_string(slot)));
+             }
+             // A writable view of the slot, so that the worker can build the NumPy arrays on it in place.
+             return py::memoryview::from_memory(data, ring.slot_size(), false);
+           })
+      .def("set_column",
+           [](GeneratorShmRing &ring, int32_t slot, int32_t column, const py::dtype &type,
+              const std::vector<dsize_t> &shape, int64_t offset) {
+             THROW_IF_ERROR(ring.SetColumn(slot, column, DataType::FromNpType(type), TensorShape(shape), offset));
+           })
+      .def("commit",
+           [](GeneratorShmRing &ring, int32_t slot, int32_t num_columns) {
+             THROW_IF_ERROR(ring.CommitSlot(slot, num_columns));
+           })
+      .def("row",
+           [](const std::shared_ptr<GeneratorShmRing> &ring, int32_t slot) { return GeneratorShmRow{ring, slot}; });
+  }));
+#endif
+
 }  // namespace dataset
 }  // namespace mindspore
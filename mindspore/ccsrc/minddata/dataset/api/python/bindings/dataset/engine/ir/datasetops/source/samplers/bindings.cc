@@ -45,12 +45,14 @@ PYBIND_REGISTER(DistributedSamplerObj, 2, ([](const py::module *m) {
                   (void)py::class_<DistributedSamplerObj, SamplerObj, std::shared_ptr<DistributedSamplerObj>>(
                     *m, "DistributedSamplerObj", "to create a DistributedSamplerObj")
                     .def(py::init([](int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples,
-                                     uint32_t seed, int64_t offset, bool even_dist) {
-                      std::shared_ptr<DistributedSamplerObj> sampler = std::make_shared<DistributedSamplerObj>(
-                        num_shards, shard_id, shuffle, num_samples, seed, offset, even_dist);
-                      THROW_IF_ERROR(sampler->ValidateParams());
-                      return sampler;
-                    }));
+                                     uint32_t seed, int64_t offset, bool even_dist, int64_t block_size) {
+                           std::shared_ptr<DistributedSamplerObj> sampler = std::make_shared<DistributedSamplerObj>(
+                             num_shards, shard_id, shuffle, num_samples, seed, offset, even_dist, block_size);
+                           THROW_IF_ERROR(sampler->ValidateParams());
+                           return sampler;
+                         }),
+                         py::arg("num_shards"), py::arg("shard_id"), py::arg("shuffle"), py::arg("num_samples"),
+                         py::arg("seed"), py::arg("offset"), py::arg("even_dist"), py::arg("block_size") = 0);
                 }));
 
 PYBIND_REGISTER(PreBuiltSamplerObj, 2, ([](const py::module *m) {
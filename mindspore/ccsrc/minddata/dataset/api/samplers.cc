@@ -39,18 +39,19 @@ Status Sampler::BuildChildren(std::shared_ptr<SamplerObj> *const sampler) const
 
 // DistributedSampler
 DistributedSampler::DistributedSampler(int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples,
-                                       uint32_t seed, int64_t offset, bool even_dist)
+                                       uint32_t seed, int64_t offset, bool even_dist, int64_t block_size)
     : num_shards_(num_shards),
       shard_id_(shard_id),
       shuffle_(shuffle),
       num_samples_(num_samples),
       seed_(seed),
       offset_(offset),
-      even_dist_(even_dist) {}
+      even_dist_(even_dist),
+      block_size_(block_size) {}
 
 std::shared_ptr<SamplerObj> DistributedSampler::Parse() const {
-  std::shared_ptr<SamplerObj> output =
-    std::make_shared<DistributedSamplerObj>(num_shards_, shard_id_, shuffle_, num_samples_, seed_, offset_, even_dist_);
+  std::shared_ptr<SamplerObj> output = std::make_shared<DistributedSamplerObj>(
+    num_shards_, shard_id_, shuffle_, num_samples_, seed_, offset_, even_dist_, block_size_);
   Status s = BuildChildren(&output);
   if (s.IsError()) {
     MS_LOG(ERROR) << "[Internal ERROR] Error in Parse. Message: " << s;
@@ -53,8 +53,10 @@ ConfigManager::ConfigManager()
       enable_autotune_(false),
       save_autoconfig_(false),
       autotune_interval_(kCfgAutoTuneInterval),
+      enable_autotune_model_(false),
       enable_watchdog_(true),
-      multiprocessing_timeout_interval_(kCfgMultiprocessingTimeoutInterval) {
+      multiprocessing_timeout_interval_(kCfgMultiprocessingTimeoutInterval),
+      tensor_pool_size_(kCfgTensorPoolSize) {
   autotune_json_filepath_ = kEmptyString;
   num_cpu_threads_ = num_cpu_threads_ > 0 ? num_cpu_threads_ : std::numeric_limits<uint16_t>::max();
   num_parallel_workers_ = num_parallel_workers_ < num_cpu_threads_ ? num_parallel_workers_ : num_cpu_threads_;
@@ -259,6 +259,15 @@ class ConfigManager {
   // @param interval - autotune interval in steps
   void set_autotune_interval(int64_t interval) { autotune_interval_ = interval; }
 
+  // setter function
+  // @param enable - To tune the whole pipeline by the queueing model of the profiled operators, instead of tuning
+  //     the operators one by one
+  void set_enable_autotune_model(bool enable) { enable_autotune_model_ = enable; }
+
+  // getter function
+  // @return - Flag to indicate whether autotune solves the pipeline configuration by the queueing model
+  bool enable_autotune_model() const { return enable_autotune_model_; }
+
   // setter function
   // @param enable - To enable watchdog python thread
   void set_enable_watchdog(bool enable) { enable_watchdog_ = enable; }
@@ -283,6 +292,14 @@ class ConfigManager {
   // @return - Flag to indicate whether the dataset is dynamic-shape
   bool dynamic_shape() const { return dynamic_shape_; }
 
+  // setter function
+  // @param size - The maximum size in MB of the freed tensor buffers cached for reuse, 0 to disable the tensor pool
+  void set_tensor_pool_size(uint32_t size) { tensor_pool_size_ = size; }
+
+  // getter function
+  // @return - The maximum size in MB of the freed tensor buffers cached for reuse
+  uint32_t tensor_pool_size() const { return tensor_pool_size_; }
+
  private:
   // Private helper function that takes a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
@@ -313,10 +330,12 @@ class ConfigManager {
   bool enable_autotune_;
   bool save_autoconfig_;  // True if should save AutoTune configuration
   int64_t autotune_interval_;
+  bool enable_autotune_model_;  // True if autotune solves the pipeline configuration by the queueing model
   bool enable_watchdog_;                       // Watchdog python thread enabled flag
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
+  uint32_t tensor_pool_size_;  // Maximum size in MB of the cached tensor buffers
 };
 }  // namespace dataset
 }  // namespace mindspore
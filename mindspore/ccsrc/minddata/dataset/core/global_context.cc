@@ -57,6 +57,7 @@ GlobalContext *GlobalContext::Instance() {
 Status GlobalContext::Init() {
   config_manager_ = std::make_shared<ConfigManager>();
   mem_pool_ = std::make_shared<SystemPool>();
+  tensor_pool_ = std::make_shared<RecyclePool>(0);
   // For testing we can use Dummy pool instead
 
   // Create some tensor allocators for the different types and hook them into the pool.
@@ -72,6 +73,20 @@ Status GlobalContext::Init() {
   return Status::OK();
 }
 
+std::shared_ptr<MemoryPool> GlobalContext::tensor_mem_pool() const {
+  const size_t kMBToBytes = 1UL << 20;
+  size_t capacity = static_cast<size_t>(config_manager_->tensor_pool_size()) * kMBToBytes;
+  if (capacity == 0) {
+    return mem_pool_;
+  }
+  if (tensor_pool_->capacity() != capacity) {
+    tensor_pool_->set_capacity(capacity);
+  }
+  return tensor_pool_;
+}
+
+RecyclePoolStats GlobalContext::tensor_pool_stats() const { return tensor_pool_->GetStats(); }
+
 // A print method typically used for debugging
 void GlobalContext::Print(std::ostream &out) const {
   out << "GlobalContext contains the following default config: " << *config_manager_ << "\n";
@@ -28,6 +28,7 @@
 
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/util/recycle_pool.h"
 
 namespace mindspore {
 namespace dataset {
@@ -86,6 +87,14 @@ class GlobalContext {
   // @return the mem pool
   std::shared_ptr<MemoryPool> mem_pool() const { return mem_pool_; }
 
+  // Getter method
+  // @return the mem pool for the tensor data, which recycles the freed buffers when the tensor pool size is configured
+  std::shared_ptr<MemoryPool> tensor_mem_pool() const;
+
+  // Getter method
+  // @return the allocation statistics of the tensor data pool
+  RecyclePoolStats tensor_pool_stats() const;
+
   // Getter method
   // @return the tensor allocator as raw pointer
   const TensorAlloc *tensor_allocator() const { return tensor_allocator_.get(); }
@@ -113,6 +122,7 @@ class GlobalContext {
   static std::once_flag init_instance_flag_;
   static std::unique_ptr<GlobalContext> global_context_;        // The instance of the singleton (global)
   std::shared_ptr<MemoryPool> mem_pool_;                        // A global memory pool
+  std::shared_ptr<RecyclePool> tensor_pool_;                    // A memory pool recycling the tensor data
   std::shared_ptr<ConfigManager> config_manager_;               // The configs
   std::unique_ptr<TensorAlloc> tensor_allocator_;               // An allocator for Tensors
   std::unique_ptr<CVTensorAlloc> cv_tensor_allocator_;          // An allocator for CV Tensors
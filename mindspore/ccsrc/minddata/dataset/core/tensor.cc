@@ -65,7 +65,7 @@ namespace dataset {
 
 Tensor::Tensor(const TensorShape &shape, const DataType &type) : shape_(shape), type_(type), data_(nullptr) {
   // grab the mem pool from global context and create the allocator for char data area
-  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->mem_pool();
+  std::shared_ptr<MemoryPool> global_pool = GlobalContext::Instance()->tensor_mem_pool();
   data_allocator_ = std::make_unique<Allocator<unsigned char>>(global_pool);
 }
 
@@ -174,6 +174,24 @@ Status Tensor::CreateFromMemory(const TensorShape &shape, const DataType &type,
   return Status::OK();
 }
 
+Status Tensor::CreateFromPoolMemory(const TensorShape &shape, const DataType &type, uchar *data,
+                                    const std::shared_ptr<MemoryPool> &pool, TensorPtr *out) {
+  RETURN_UNEXPECTED_IF_NULL(data);
+  RETURN_UNEXPECTED_IF_NULL(pool);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Failed to create tensor on pool memory, tensor shape is unknown.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(),
+                               "Failed to create tensor on pool memory, data type should be numeric.");
+  const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
+  *out = std::allocate_shared<Tensor>(*alloc, shape, type);
+  CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Allocate memory failed.");
+  // The memory is given back to the pool when the tensor is destroyed.
+  (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+  (*out)->data_ = data;
+  (*out)->data_end_ = data + (*out)->SizeInBytes();
+  return Status::OK();
+}
+
 #ifdef ENABLE_PYTHON
 Status Tensor::CreateFromNpString(py::array arr, std::shared_ptr<Tensor> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
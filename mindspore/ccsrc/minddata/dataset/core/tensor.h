@@ -50,6 +50,7 @@ namespace py = pybind11;
 namespace mindspore {
 namespace dataset {
 class Tensor;
+class MemoryPool;
 template <typename T>
 class Allocator;
 
@@ -105,6 +106,17 @@ class Tensor {
   static Status CreateFromMemory(const TensorShape &shape, const DataType &type, const uchar *src,
                                  const dsize_t &length, TensorPtr *out);
 
+  /// Create a numeric tensor on the memory owned by a memory pool. Data will NOT be copied, and the memory is given
+  /// back to the pool by MemoryPool::Deallocate() when the tensor is destroyed.
+  /// \param[in] shape shape of the output tensor
+  /// \param[in] type type of the output tensor
+  /// \param[in] data pointer to the memory holding the data, its length is determined from the shape and type
+  /// \param[in] pool memory pool owning the memory
+  /// \param[out] out Generated tensor
+  /// \return Status code
+  static Status CreateFromPoolMemory(const TensorShape &shape, const DataType &type, uchar *data,
+                                     const std::shared_ptr<MemoryPool> &pool, TensorPtr *out);
+
   /// Create a copy of the input tensor
   /// \param[in] in original tensor to be copied
   /// \param[out] out output tensor to be generated
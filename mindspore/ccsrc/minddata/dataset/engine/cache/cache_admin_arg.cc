@@ -88,6 +88,9 @@ CacheAdminArgHandler::CacheAdminArgHandler()
   arg_map_["--loglevel"] = ArgValue::kArgLogLevel;
   arg_map_["-r"] = ArgValue::kArgMemoryCapRatio;
   arg_map_["--memory_cap_ratio"] = ArgValue::kArgMemoryCapRatio;
+  arg_map_["-c"] = ArgValue::kArgCompress;
+  arg_map_["--compress"] = ArgValue::kArgCompress;
+  arg_map_["--numa_sharding"] = ArgValue::kArgNumaSharding;
   arg_map_["--list_sessions"] = ArgValue::kArgListSessions;
   arg_map_["--server_info"] = ArgValue::kArgServerInfo;
   // Initialize argument tracker with false values
@@ -334,6 +337,11 @@ Status CacheAdminArgHandler::ParseArgStream(std::stringstream *arg_stream) {
         RETURN_IF_NOT_OK(AssignArg(tok, &memory_cap_ratio_, arg_stream));
         break;
       }
+      case ArgValue::kArgCompress:
+      case ArgValue::kArgNumaSharding: {
+        RETURN_IF_NOT_OK(AssignArg(tok, static_cast<std::string *>(nullptr), arg_stream));
+        break;
+      }
       case ArgValue::kArgListSessions: {
         RETURN_IF_NOT_OK(AssignArg(tok, static_cast<std::string *>(nullptr), arg_stream, CommandId::kCmdListSessions));
         break;
@@ -643,8 +651,10 @@ Status CacheAdminArgHandler::StartServer() {
     std::string minloglevel_string = std::to_string(log_level_);
     std::string daemonize_string = "true";
     std::string memory_cap_ratio_string = std::to_string(memory_cap_ratio_);
+    std::string compress_string = used_args_[ArgValue::kArgCompress] ? "true" : "false";
+    std::string numa_sharding_string = used_args_[ArgValue::kArgNumaSharding] ? "true" : "false";
 
-    char *argv[9];
+    char *argv[11];
     argv[0] = cache_server_binary.data();
     argv[1] = spill_dir_.data();
     argv[2] = workers_string.data();
@@ -653,7 +663,9 @@ Status CacheAdminArgHandler::StartServer() {
     argv[5] = minloglevel_string.data();
     argv[6] = daemonize_string.data();
     argv[7] = memory_cap_ratio_string.data();
-    argv[8] = nullptr;
+    argv[8] = compress_string.data();
+    argv[9] = numa_sharding_string.data();
+    argv[10] = nullptr;
 
     // Now exec the binary
     execv(cache_server_binary.data(), argv);
@@ -673,6 +685,7 @@ void CacheAdminArgHandler::Help() {
   std::cerr << "                [[-w | --workers] <number of workers>]    Default is " << kDefaultNumWorkers << ".\n";
   std::cerr << "                [[-s | --spilldir] <spilling directory>]  Default is no spilling.\n";
   std::cerr << "                [[-l | --loglevel] <log level>]           Default is 1 (INFO level).\n";
+  std::cerr << "                [-c | --compress]                         Default is no compression.\n";
   std::cerr << "            [--destroy_session  | -d] <session id>\n";
   std::cerr << "                [[-p | --port] <port number>]\n";
   std::cerr << "            [--generate_session | -g]\n";
@@ -688,6 +701,8 @@ void CacheAdminArgHandler::Help() {
   //    Default is: kDefaultSharedMemorySizeInGB (Gb in unit)
   // [ [-r | --memory_cap_ratio] <float percent value>]
   //    Default is kMemoryCapRatio
+  // [ --numa_sharding ]
+  //    Default is off. Bind the shared memory and the workers serving a client to the numa node of the client.
 }
 }  // namespace dataset
 }  // namespace mindspore
@@ -14,12 +14,18 @@
  * limitations under the License.
  */
 #include "minddata/dataset/engine/cache/cache_arena.h"
+#include <algorithm>
 #include "minddata/dataset/engine/cache/cache_server.h"
 #include "minddata/dataset/util/path.h"
 namespace mindspore {
 namespace dataset {
 CachedSharedMemory::CachedSharedMemory(int32_t port, size_t val_in_GB)
-    : shared_memory_sz_in_gb_(val_in_GB), port_(port), num_numa_nodes_(-1), sub_pool_sz_(-1) {
+    : shared_memory_sz_in_gb_(val_in_GB),
+      port_(port),
+      num_numa_nodes_(-1),
+      sub_pool_sz_(-1),
+      numa_sharding_(false),
+      num_pools_per_node_(1) {
   // We create the shared memory and we will destroy it. All other client just detach only.
   shm_.RemoveResourcesOnExit();
 }
@@ -36,6 +42,10 @@ Status CachedSharedMemory::Init() {
   int64_t shm_mem_sz = shared_memory_sz_in_gb_ * 1073741824L;
   RETURN_IF_NOT_OK(shm_.Create(shm_mem_sz));
   MS_LOG(INFO) << "Creation of shared memory successful. Shared memory key " << shm_.GetKey();
+  numa_sharding_ = cs.IsNumaShardingOn();
+  if (numa_sharding_) {
+    return InitNumaShards(shm_mem_sz);
+  }
   // Interleave the memory.
   cs.GetHWControl()->InterleaveMemory(shm_.SharedMemoryBaseAddr(), shm_mem_sz);
   // We will create a number of sub pool out of shared memory to reduce latch contention
@@ -60,6 +70,43 @@ Status CachedSharedMemory::Init() {
   return Status::OK();
 }
 
+Status CachedSharedMemory::InitNumaShards(int64_t shm_mem_sz) {
+  CacheServer &cs = CacheServer::GetInstance();
+  // Each numa node gets its own region of the shared memory, bound to the node, and the region is split into a few
+  // sub pools to reduce latch contention among the clients on the same node.
+  constexpr int64_t kPageSize = 4096;
+  constexpr int64_t kMaxPoolsPerNode = 4;
+  constexpr int64 min_subpool_sz = 512 * 1048576L;
+  int64_t region_sz = shm_mem_sz / num_numa_nodes_;
+  num_pools_per_node_ =
+    static_cast<int32_t>(std::max<int64_t>(1, std::min(kMaxPoolsPerNode, region_sz / min_subpool_sz)));
+  // Sub pools must start at a page boundary so we can bind them to a numa node.
+  sub_pool_sz_ = region_sz / num_pools_per_node_ / kPageSize * kPageSize;
+  CHECK_FAIL_RETURN_UNEXPECTED(sub_pool_sz_ > 0, "Shared memory is too small to shard by numa node.");
+  auto num_of_pools = num_numa_nodes_ * num_pools_per_node_;
+  shm_pool_.reserve(num_of_pools);
+  for (auto i = 0; i < num_of_pools; ++i) {
+    void *ptr = static_cast<char *>(shm_.SharedMemoryBaseAddr()) + i * sub_pool_sz_;
+    cs.GetHWControl()->AssignToNode(i / num_pools_per_node_, ptr, sub_pool_sz_);
+    shm_pool_.push_back(std::make_unique<ArenaImpl>(ptr, sub_pool_sz_));
+  }
+  mux_ = std::make_unique<std::mutex[]>(num_of_pools);
+  MS_LOG(INFO) << "Shared memory is sharded to " << num_numa_nodes_ << " numa nodes with " << num_pools_per_node_
+               << " sub pools each.";
+  return Status::OK();
+}
+
+size_t CachedSharedMemory::GetBeginSlot(int32_t client_id) const {
+  if (numa_sharding_ && client_id >= 0) {
+    // Start with the sub pools of the numa node of the client, which is where the client is bound to.
+    auto &cs = CacheServer::GetInstance();
+    auto node = cs.GetClientNumaNode(client_id);
+    auto n = (client_id / num_numa_nodes_) % num_pools_per_node_;
+    return node * num_pools_per_node_ + n;
+  }
+  return client_id % shm_pool_.size();
+}
+
 Status CachedSharedMemory::CreateArena(std::unique_ptr<CachedSharedMemory> *out, int32_t port, size_t val_in_GB) {
   RETURN_UNEXPECTED_IF_NULL(out);
   auto mem_pool = std::unique_ptr<CachedSharedMemory>(new CachedSharedMemory(port, val_in_GB));
@@ -71,7 +118,7 @@ Status CachedSharedMemory::CreateArena(std::unique_ptr<CachedSharedMemory> *out,
 Status CachedSharedMemory::AllocateSharedMemory(int32_t client_id, size_t sz, void **p) {
   Status rc;
   RETURN_UNEXPECTED_IF_NULL(p);
-  auto begin_slot = client_id % shm_pool_.size();
+  auto begin_slot = GetBeginSlot(client_id);
   auto slot = begin_slot;
   do {
     std::unique_lock<std::mutex> lock(mux_[slot]);
@@ -87,7 +134,7 @@ Status CachedSharedMemory::AllocateSharedMemory(int32_t client_id, size_t sz, vo
 }
 
 void CachedSharedMemory::DeallocateSharedMemory(int32_t client_id, void *p) {
-  auto begin_slot = client_id % shm_pool_.size();
+  auto begin_slot = GetBeginSlot(client_id);
   auto slot = begin_slot;
   auto start_addr = static_cast<char *>(SharedMemoryBaseAddr());
   bool found = false;
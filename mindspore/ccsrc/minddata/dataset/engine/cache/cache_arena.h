@@ -68,9 +68,15 @@ class CachedSharedMemory {
   std::unique_ptr<std::mutex[]> mux_;
   int32_t num_numa_nodes_;
   int64_t sub_pool_sz_;
+  bool numa_sharding_;
+  int32_t num_pools_per_node_;
   /// Private constructor. Not to be called directly.
   CachedSharedMemory(int32_t port, size_t val_in_GB);
   Status Init();
+  /// \brief Partition the shared memory by numa node and bind each partition to its node.
+  Status InitNumaShards(int64_t shm_mem_sz);
+  /// \brief The first sub pool to look at for a client.
+  size_t GetBeginSlot(int32_t client_id) const;
 };
 }  // namespace dataset
 }  // namespace mindspore
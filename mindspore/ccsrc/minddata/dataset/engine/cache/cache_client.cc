@@ -212,10 +212,9 @@ Status CacheClient::CreateCache(uint32_t tree_crc, bool generate_id) {
     if (success) {
       // Attach to shared memory for local client
       RETURN_IF_NOT_OK(comm_->AttachToSharedMemory(&local_bypass_));
-      if (local_bypass_) {
-        async_buffer_stream_ = std::make_shared<AsyncBufferStream>();
-        RETURN_IF_NOT_OK(async_buffer_stream_->Init(this));
-      }
+      // Remote client streams the rows in batch as well, but from its own memory rather than the shared memory.
+      async_buffer_stream_ = std::make_shared<AsyncBufferStream>();
+      RETURN_IF_NOT_OK(async_buffer_stream_->Init(this));
     }
     // We are not resetting the Duplicate key return code. We are passing it back to the CacheOp. This will tell the
     // CacheOp to bypass the build phase.
@@ -371,15 +370,23 @@ Status CacheClient::AsyncBufferStream::ReleaseBuffer() {
 
 Status CacheClient::AsyncBufferStream::Init(CacheClient *cc) {
   cc_ = cc;
-  // Allocate shared memory from the server
-  auto mem_rq = std::make_shared<AllocateSharedBlockRequest>(cc_->server_connection_id_, cc_->GetClientId(),
-                                                             kAsyncBufferSize * kNumAsyncBuffer);
-  RETURN_IF_NOT_OK(cc->PushRequest(mem_rq));
-  RETURN_IF_NOT_OK(mem_rq->Wait());
-  offset_addr_ = mem_rq->GetAddr();
-  // Now we need to add that to the base address of where we attach.
-  auto base = cc->SharedMemoryBaseAddr();
-  auto start = reinterpret_cast<int64_t>(base) + offset_addr_;
+  int64_t start = 0;
+  if (cc->local_bypass_) {
+    // Allocate shared memory from the server
+    auto mem_rq = std::make_shared<AllocateSharedBlockRequest>(cc_->server_connection_id_, cc_->GetClientId(),
+                                                               kAsyncBufferSize * kNumAsyncBuffer);
+    RETURN_IF_NOT_OK(cc->PushRequest(mem_rq));
+    RETURN_IF_NOT_OK(mem_rq->Wait());
+    offset_addr_ = mem_rq->GetAddr();
+    // Now we need to add that to the base address of where we attach.
+    auto base = cc->SharedMemoryBaseAddr();
+    start = reinterpret_cast<int64_t>(base) + offset_addr_;
+  } else {
+    // Remote client can't attach to the shared memory, the buffers are in the client memory and each flush sends
+    // the whole buffer inline in one request.
+    remote_buffer_ = std::make_unique<char[]>(kAsyncBufferSize * kNumAsyncBuffer);
+    start = reinterpret_cast<int64_t>(remote_buffer_.get());
+  }
   for (auto i = 0; i < kNumAsyncBuffer; ++i) {
     // We only need to set the pointer during init. Other fields will be set dynamically.
     buf_arr_[i].buffer_ = reinterpret_cast<void *>(start + i * kAsyncBufferSize);
@@ -427,8 +434,14 @@ Status CacheClient::AsyncBufferStream::SyncFlush(AsyncFlushFlag flag) {
   }
   auto *asyncWriter = &buf_arr_[cur_];
   if (asyncWriter->num_ele_) {
-    asyncWriter->rq.reset(
-      new BatchCacheRowsRequest(cc_, offset_addr_ + cur_ * kAsyncBufferSize, asyncWriter->num_ele_));
+    if (cc_->local_bypass_) {
+      asyncWriter->rq.reset(
+        new BatchCacheRowsRequest(cc_, offset_addr_ + cur_ * kAsyncBufferSize, asyncWriter->num_ele_));
+    } else {
+      asyncWriter->rq.reset(new BatchCacheRowsRequest(cc_, asyncWriter->buffer_,
+                                                      kAsyncBufferSize - asyncWriter->bytes_avail_,
+                                                      asyncWriter->num_ele_));
+    }
     flush_rc_ = cc_->PushRequest(asyncWriter->rq);
     RETURN_IF_NOT_OK(flush_rc_);
 
@@ -324,7 +324,7 @@ class CacheClient {
     enum class AsyncFlushFlag : int8_t { kFlushNone = 0, kFlushBlocking = 1, kCallerHasXLock = 1u << 2 };
     Status SyncFlush(AsyncFlushFlag flag);
 
-    /// This maps a physical shared memory to the data stream.
+    /// This maps a physical shared memory (or the client memory for remote client) to the data stream.
     class AsyncWriter {
      public:
       friend class AsyncBufferStream;
@@ -350,6 +350,7 @@ class CacheClient {
     TaskGroup vg_;
     CacheClient *cc_;
     int64_t offset_addr_;
+    std::unique_ptr<char[]> remote_buffer_;  // The buffers of remote client, which can't use the shared memory
     AsyncWriter buf_arr_[kNumAsyncBuffer];
     int32_t cur_;
   };
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/cache/cache_compress.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int kHashLog = 12;
+constexpr size_t kMinMatch = 4;
+// Same as the LZ4 block format, the last 5 bytes are always literals and the last match starts at least 12 bytes
+// before the end of the input.
+constexpr size_t kLastLiterals = 5;
+constexpr size_t kMatchLimit = 12;
+constexpr size_t kMaxOffset = 65535;
+constexpr size_t kRunMask = 15;
+constexpr uint8_t kLengthByteMax = 255;
+constexpr int kTokenShift = 4;
+constexpr int kByteShift = 8;
+constexpr int kSkipShift = 6;
+
+inline uint32_t Read32(const uint8_t *p) {
+  uint32_t v;
+  (void)memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+inline uint32_t Hash32(uint32_t v) {
+  constexpr uint32_t kPrime = 2654435761U;
+  return (v * kPrime) >> (32 - kHashLog);
+}
+
+// Number of bytes to encode a length of at least kRunMask with the 255 continuation bytes.
+inline size_t LengthBytes(size_t len) { return len >= kRunMask ? (len - kRunMask) / kLengthByteMax + 1 : 0; }
+
+inline uint8_t *WriteLength(size_t len, uint8_t *op) {
+  len -= kRunMask;
+  while (len >= kLengthByteMax) {
+    *op++ = kLengthByteMax;
+    len -= kLengthByteMax;
+  }
+  *op++ = static_cast<uint8_t>(len);
+  return op;
+}
+
+Status ReadLength(const uint8_t **ip, const uint8_t *iend, size_t *len) {
+  uint8_t b;
+  do {
+    CHECK_FAIL_RETURN_UNEXPECTED(*ip < iend, "Corrupted compressed cache data.");
+    b = *(*ip)++;
+    *len += b;
+  } while (b == kLengthByteMax);
+  return Status::OK();
+}
+}  // namespace
+
+size_t CacheCompressor::Compress(const ReadableSlice &src, WritableSlice *dest) {
+  if (dest == nullptr) {
+    return 0;
+  }
+  const auto *base = static_cast<const uint8_t *>(src.GetPointer());
+  const uint8_t *iend = base + src.GetSize();
+  auto *ostart = static_cast<uint8_t *>(dest->GetMutablePointer());
+  const uint8_t *oend = ostart + dest->GetSize();
+  const uint8_t *ip = base;
+  const uint8_t *anchor = base;
+  uint8_t *op = ostart;
+  if (src.GetSize() > kMatchLimit) {
+    std::array<uint32_t, 1U << kHashLog> table{};
+    const uint8_t *mflimit = iend - kMatchLimit;
+    const uint8_t *matchlimit = iend - kLastLiterals;
+    ++ip;
+    while (ip < mflimit) {
+      auto seq = Read32(ip);
+      auto h = Hash32(seq);
+      const uint8_t *ref = base + table[h];
+      table[h] = static_cast<uint32_t>(ip - base);
+      if (static_cast<size_t>(ip - ref) > kMaxOffset || Read32(ref) != seq) {
+        // Step faster over the data that does not compress.
+        ip += 1 + ((ip - anchor) >> kSkipShift);
+        continue;
+      }
+      // Extend the match backward and then forward.
+      while (ip > anchor && ref > base && ip[-1] == ref[-1]) {
+        --ip;
+        --ref;
+      }
+      size_t match_len = kMinMatch;
+      while (ip + match_len < matchlimit && ip[match_len] == ref[match_len]) {
+        ++match_len;
+      }
+      auto lit_len = static_cast<size_t>(ip - anchor);
+      auto ml = match_len - kMinMatch;
+      constexpr size_t kOffsetBytes = 2;
+      if (static_cast<size_t>(oend - op) < 1 + LengthBytes(lit_len) + lit_len + kOffsetBytes + LengthBytes(ml)) {
+        return 0;
+      }
+      uint8_t *token = op++;
+      *token = static_cast<uint8_t>((std::min(lit_len, kRunMask) << kTokenShift) | std::min(ml, kRunMask));
+      if (lit_len >= kRunMask) {
+        op = WriteLength(lit_len, op);
+      }
+      (void)memcpy(op, anchor, lit_len);
+      op += lit_len;
+      auto offset = static_cast<uint16_t>(ip - ref);
+      *op++ = static_cast<uint8_t>(offset);
+      *op++ = static_cast<uint8_t>(offset >> kByteShift);
+      if (ml >= kRunMask) {
+        op = WriteLength(ml, op);
+      }
+      ip += match_len;
+      anchor = ip;
+    }
+  }
+  // The rest are the last literals.
+  auto lit_len = static_cast<size_t>(iend - anchor);
+  if (static_cast<size_t>(oend - op) < 1 + LengthBytes(lit_len) + lit_len) {
+    return 0;
+  }
+  *op++ = static_cast<uint8_t>(std::min(lit_len, kRunMask) << kTokenShift);
+  if (lit_len >= kRunMask) {
+    op = WriteLength(lit_len, op);
+  }
+  if (lit_len > 0) {
+    (void)memcpy(op, anchor, lit_len);
+    op += lit_len;
+  }
+  return static_cast<size_t>(op - ostart);
+}
+
+Status CacheCompressor::Decompress(const ReadableSlice &src, WritableSlice *dest) {
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  const auto *ip = static_cast<const uint8_t *>(src.GetPointer());
+  const uint8_t *iend = ip + src.GetSize();
+  auto *ostart = static_cast<uint8_t *>(dest->GetMutablePointer());
+  const uint8_t *oend = ostart + dest->GetSize();
+  uint8_t *op = ostart;
+  while (ip < iend) {
+    auto token = *ip++;
+    size_t lit_len = token >> kTokenShift;
+    if (lit_len == kRunMask) {
+      RETURN_IF_NOT_OK(ReadLength(&ip, iend, &lit_len));
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(lit_len <= static_cast<size_t>(iend - ip) && lit_len <= static_cast<size_t>(oend - op),
+                                 "Corrupted compressed cache data.");
+    if (lit_len > 0) {
+      (void)memcpy(op, ip, lit_len);
+      ip += lit_len;
+      op += lit_len;
+    }
+    // The last sequence has only literals.
+    if (ip == iend) {
+      break;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(iend - ip >= 2, "Corrupted compressed cache data.");
+    size_t offset = ip[0] | (static_cast<size_t>(ip[1]) << kByteShift);
+    ip += 2;
+    CHECK_FAIL_RETURN_UNEXPECTED(offset > 0 && offset <= static_cast<size_t>(op - ostart),
+                                 "Corrupted compressed cache data.");
+    size_t match_len = token & kRunMask;
+    if (match_len == kRunMask) {
+      RETURN_IF_NOT_OK(ReadLength(&ip, iend, &match_len));
+    }
+    match_len += kMinMatch;
+    CHECK_FAIL_RETURN_UNEXPECTED(match_len <= static_cast<size_t>(oend - op), "Corrupted compressed cache data.");
+    const uint8_t *ref = op - offset;
+    if (offset >= match_len) {
+      (void)memcpy(op, ref, match_len);
+      op += match_len;
+    } else {
+      // The match overlaps the output, copy byte by byte to repeat the pattern.
+      for (size_t i = 0; i < match_len; ++i) {
+        *op++ = *ref++;
+      }
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(op == oend, "Length mismatch of the decompressed cache data.");
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
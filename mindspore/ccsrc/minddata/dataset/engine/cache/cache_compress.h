@@ -0,0 +1,45 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_COMPRESS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_COMPRESS_H_
+
+#include <cstddef>
+#include "minddata/dataset/util/slice.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A lightweight LZ77 byte codec laid out in the LZ4 block format. The cache server uses it to keep the
+/// compressible columns of a row compressed in memory, so more rows fit in the memory before spilling to disk.
+/// It favors the speed over the ratio: one hash probe per position and no entropy coding.
+class CacheCompressor {
+ public:
+  /// \brief Compress a buffer.
+  /// \param[in] src The buffer to compress
+  /// \param[out] dest The destination. Its size is the limit of the compressed size.
+  /// \return The number of compressed bytes written, or 0 if the compressed buffer does not fit in the destination.
+  static size_t Compress(const ReadableSlice &src, WritableSlice *dest);
+
+  /// \brief Decompress a buffer produced by Compress.
+  /// \param[in] src The compressed buffer
+  /// \param[out] dest The destination which must be exactly the size of the original buffer
+  /// \return Status object
+  static Status Decompress(const ReadableSlice &src, WritableSlice *dest);
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_CACHE_COMPRESS_H_
@@ -146,7 +146,8 @@ Status CacheServerRequest::operator()(CacheServerGreeter::AsyncService *svc, grp
     type_ = static_cast<RequestType>(rq_.type());
     // Now we pass the address of this instance to CacheServer's main loop.
     MS_LOG(DEBUG) << "Handle request " << *this;
-    // We will distribute the request evenly (or randomly) over all the numa nodes.
+    // We will distribute the request evenly (or randomly) over all the numa nodes, or to the numa node of the
+    // client if numa sharding is on.
     // The exception is BatchFetch and BatchCache which we need to pre-process here.
     // Also some requests are urgent that we want to process them here too.
     if (type_ == BaseRequest::RequestType::kBatchFetchRows || type_ == BaseRequest::RequestType::kBatchCacheRows ||
@@ -156,7 +157,7 @@ Status CacheServerRequest::operator()(CacheServerGreeter::AsyncService *svc, grp
       // WARNING. After we call ProcessRequest, the memory of 'this' is being recycled by ReturnRequestTag
       // asynchronously. Further access of 'this' is unpredictable.
     } else {
-      RETURN_IF_NOT_OK(cs.PushRequest(cs.GetRandomWorker(), this));
+      RETURN_IF_NOT_OK(cs.PushRequest(cs.GetWorkerByClientId(rq_.client_id()), this));
     }
   } else if (st_ == STATE::FINISH) {
     // We don't have logic here but moved to the caller.
@@ -31,7 +31,7 @@ namespace ms = mindspore;
 namespace ds = mindspore::dataset;
 
 namespace {
-const int32_t kTotalArgs = 8;
+const int32_t kTotalArgs = 10;
 enum ArgIndex : uint8_t {
   kProcessName = 0,
   kRootDir = 1,
@@ -40,7 +40,9 @@ enum ArgIndex : uint8_t {
   kSharedMemorySize = 4,
   kLogLevel = 5,
   kDemonize = 6,
-  kMemoryCapRatio = 7
+  kMemoryCapRatio = 7,
+  kCompress = 8,
+  kNumaSharding = 9
 };
 
 ms::Status BuildServer(ds::CacheServer::Builder *builder, ds::SharedMessage *msg, int32_t port, bool daemonize) {
@@ -140,7 +142,9 @@ ms::Status StartServer(int argc, char **argv) {
     .SetPort(port)
     .SetSharedMemorySizeInGB(static_cast<int32_t>(strtol(argv[ArgIndex::kSharedMemorySize], nullptr, ds::kDecimal)))
     .SetLogLevel(static_cast<int8_t>((strtol(argv[ArgIndex::kLogLevel], nullptr, ds::kDecimal))))
-    .SetMemoryCapRatio(strtof(argv[ArgIndex::kMemoryCapRatio], nullptr));
+    .SetMemoryCapRatio(strtof(argv[ArgIndex::kMemoryCapRatio], nullptr))
+    .SetCompression(strcmp(argv[ArgIndex::kCompress], "true") == 0)
+    .SetNumaSharding(strcmp(argv[ArgIndex::kNumaSharding], "true") == 0);
 
   auto daemonize_string = argv[ArgIndex::kDemonize];
   bool daemonize = strcmp(daemonize_string, "true") == 0 || strcmp(daemonize_string, "TRUE") == 0 ||
@@ -16,13 +16,19 @@
 #include <algorithm>
 #include "utils/ms_utils.h"
 #include "minddata/dataset/engine/cache/cache_pool.h"
+#include "minddata/dataset/engine/cache/cache_compress.h"
 #include "minddata/dataset/engine/cache/cache_server.h"
 #include "minddata/dataset/util/services.h"
 
 namespace mindspore {
 namespace dataset {
-CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root)
-    : mp_(std::move(mp)), root_(root), subfolder_(Services::GetUniqueID()), sm_(nullptr), tree_(nullptr) {
+CachePool::CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root, bool compress)
+    : mp_(std::move(mp)),
+      root_(root),
+      subfolder_(Services::GetUniqueID()),
+      sm_(nullptr),
+      tree_(nullptr),
+      compress_(compress) {
   // Initialize soft memory cap to the current available memory on the machine.
   soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
   temp_mem_usage_ = 0;
@@ -88,23 +94,29 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
     sz += v.GetSize();
   }
   bl.sz = sz;
+  // Compress the buffer first if asked to, and we only need memory for the compressed buffer if it pays off.
+  std::unique_ptr<base_type[]> compressed;
+  if (compress_) {
+    RETURN_IF_NOT_OK(Compress(buf, &compressed, &bl.compressed_sz));
+  }
+  size_t mem_sz = bl.compressed_sz > 0 ? bl.compressed_sz : sz;
   // If required memory size exceeds the available size, it gives OOM status. To avoid cache server process got killed
   // or crashing the machine, set lower bound memory, which means stopping cache once the rest available memory is less
   // than the lower bound. (The default is 20% of physical RAM)
-  if (soft_mem_limit_ - temp_mem_usage_ - static_cast<uint64_t>(sz) < min_avail_mem_) {
+  if (soft_mem_limit_ - temp_mem_usage_ - static_cast<uint64_t>(mem_sz) < min_avail_mem_) {
     MS_LOG(WARNING) << "Memory usage will exceed the upper bound limit of: " << min_avail_mem_
                     << ". The cache server will not cache any more data.";
     rc = STATUS_ERROR(StatusCode::kMDOutOfMemory, "Out of memory.");
   } else {
-    rc = mp_->Allocate(sz, reinterpret_cast<void **>(&bl.ptr));
+    rc = mp_->Allocate(mem_sz, reinterpret_cast<void **>(&bl.ptr));
     // Adjust the soft limit and usage counting when every 100M memory are used.
-    if (temp_mem_usage_ + sz >= kMemoryCapAdjustInterval) {
+    if (temp_mem_usage_ + mem_sz >= kMemoryCapAdjustInterval) {
       soft_mem_limit_ = CacheServerHW::GetAvailableMemory();
       temp_mem_usage_ = 0;
     }
   }
   if (rc.IsOk()) {
-    temp_mem_usage_ += sz;
+    temp_mem_usage_ += mem_sz;
     // Write down which numa node where we allocate from. It only make sense if the policy is kOnNode.
     if (CacheServerHW::numa_enabled()) {
       auto &cs = CacheServer::GetInstance();
@@ -113,16 +125,20 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
       CHECK_FAIL_RETURN_UNEXPECTED(bl.node_id != -1, "Allocator is not from numa memory pool");
       bl.node_hit = (bl.node_id == node_id);
     }
-    // We will do a piecewise copy.
-    WritableSlice dest(bl.ptr, bl.sz);
-    size_t pos = 0;
-    for (auto &v : buf) {
-      WritableSlice out(dest, pos);
-      rc = WritableSlice::Copy(&out, v);
-      if (rc.IsError()) {
-        break;
+    WritableSlice dest(bl.ptr, mem_sz);
+    if (bl.compressed_sz > 0) {
+      rc = WritableSlice::Copy(&dest, ReadableSlice(compressed.get(), bl.compressed_sz));
+    } else {
+      // We will do a piecewise copy.
+      size_t pos = 0;
+      for (auto &v : buf) {
+        WritableSlice out(dest, pos);
+        rc = WritableSlice::Copy(&out, v);
+        if (rc.IsError()) {
+          break;
+        }
+        pos += v.GetSize();
       }
-      pos += v.GetSize();
     }
     if (rc.IsError()) {
       mp_->Deallocate(bl.ptr);
@@ -133,6 +149,7 @@ Status CachePool::Insert(CachePool::key_type key, const std::vector<ReadableSlic
     // If no memory, write to disk.
     if (sm_ != nullptr) {
       MS_LOG(DEBUG) << "Spill to disk directly ... " << bl.sz << " bytes.";
+      bl.compressed_sz = 0;
       RETURN_IF_NOT_OK(sm_->Write(&bl.storage_key, buf));
     } else {
       // If asked to spill to disk instead but there is no storage set up, simply return no memory
@@ -162,7 +179,9 @@ Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *byt
   auto r = tree_->Search(key);
   if (r.second) {
     auto &it = r.first;
-    if (it->ptr != nullptr) {
+    if (it->ptr != nullptr && it->compressed_sz > 0) {
+      RETURN_IF_NOT_OK(Decompress(*it, dest));
+    } else if (it->ptr != nullptr) {
       ReadableSlice src(it->ptr, it->sz);
       RETURN_IF_NOT_OK(WritableSlice::Copy(dest, src));
     } else if (sm_ != nullptr) {
@@ -183,6 +202,82 @@ Status CachePool::Read(CachePool::key_type key, WritableSlice *dest, size_t *byt
   return Status::OK();
 }
 
+Status CachePool::Compress(const std::vector<ReadableSlice> &buf, std::unique_ptr<base_type[]> *out,
+                           size_t *out_sz) const {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  RETURN_UNEXPECTED_IF_NULL(out_sz);
+  *out_sz = 0;
+  size_t sz = 0;
+  for (auto &v : buf) {
+    sz += v.GetSize();
+  }
+  if (sz < kMinCompressSize) {
+    return Status::OK();
+  }
+  // Every slice is either compressed or stored as is, so this is the worst case.
+  size_t capacity = sz + buf.size() * sizeof(SegmentHeader);
+  std::unique_ptr<base_type[]> staging;
+  try {
+    staging = std::make_unique<base_type[]>(capacity);
+  } catch (const std::bad_alloc &e) {
+    // Not fatal. Just cache the buffer as is.
+    return Status::OK();
+  }
+  WritableSlice all(staging.get(), capacity);
+  size_t pos = 0;
+  for (auto &v : buf) {
+    SegmentHeader hdr{v.GetSize(), 0};
+    WritableSlice out_data(all, pos + sizeof(SegmentHeader), v.GetSize());
+    if (v.GetSize() >= kMinCompressSize) {
+      // Only keep it compressed if it saves enough, otherwise the decompression during the fetch is a waste.
+      WritableSlice limit(out_data, 0, v.GetSize() - v.GetSize() / kMinSavingDivisor);
+      hdr.stored_sz = CacheCompressor::Compress(v, &limit);
+    }
+    if (hdr.stored_sz == 0 && v.GetSize() > 0) {
+      RETURN_IF_NOT_OK(WritableSlice::Copy(&out_data, v));
+      hdr.stored_sz = v.GetSize();
+    }
+    WritableSlice out_hdr(all, pos, sizeof(SegmentHeader));
+    RETURN_IF_NOT_OK(WritableSlice::Copy(&out_hdr, ReadableSlice(&hdr, sizeof(SegmentHeader))));
+    pos += sizeof(SegmentHeader) + hdr.stored_sz;
+  }
+  if (pos <= sz - sz / kMinSavingDivisor) {
+    *out = std::move(staging);
+    *out_sz = pos;
+  }
+  return Status::OK();
+}
+
+Status CachePool::Decompress(const DataLocator &bl, WritableSlice *dest) const {
+  RETURN_UNEXPECTED_IF_NULL(dest);
+  CHECK_FAIL_RETURN_UNEXPECTED(dest->GetSize() >= bl.sz, "Destination buffer is too small.");
+  size_t in_pos = 0;
+  size_t out_pos = 0;
+  while (in_pos < bl.compressed_sz) {
+    SegmentHeader hdr{};
+    CHECK_FAIL_RETURN_UNEXPECTED(in_pos + sizeof(SegmentHeader) <= bl.compressed_sz,
+                                 "Corrupted compressed cache data.");
+    WritableSlice out_hdr(&hdr, sizeof(SegmentHeader));
+    RETURN_IF_NOT_OK(WritableSlice::Copy(&out_hdr, ReadableSlice(bl.ptr + in_pos, sizeof(SegmentHeader))));
+    in_pos += sizeof(SegmentHeader);
+    CHECK_FAIL_RETURN_UNEXPECTED(in_pos + hdr.stored_sz <= bl.compressed_sz && out_pos + hdr.raw_sz <= bl.sz,
+                                 "Corrupted compressed cache data.");
+    ReadableSlice in(bl.ptr + in_pos, hdr.stored_sz);
+    WritableSlice out(*dest, out_pos, hdr.raw_sz);
+    if (hdr.raw_sz == 0) {
+      continue;
+    } else if (hdr.stored_sz == hdr.raw_sz) {
+      RETURN_IF_NOT_OK(WritableSlice::Copy(&out, in));
+    } else {
+      RETURN_IF_NOT_OK(CacheCompressor::Decompress(in, &out));
+    }
+    in_pos += hdr.stored_sz;
+    out_pos += hdr.raw_sz;
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(out_pos == bl.sz, "Length mismatch of the decompressed cache data.");
+  return Status::OK();
+}
+
 Path CachePool::GetSpillPath() const {
   auto spill = Path(root_) / subfolder_;
   return spill;
@@ -237,7 +332,8 @@ Status CachePool::GetDataLocator(key_type key, const std::shared_ptr<flatbuffers
     bld.add_key(key);
     bld.add_size(it->sz);
     bld.add_node_id(it->node_id);
-    bld.add_addr(reinterpret_cast<int64_t>(it->ptr));
+    // A compressed buffer can't be copied as is. Leave the address out so the fetch goes through Read.
+    bld.add_addr(it->compressed_sz > 0 ? 0 : reinterpret_cast<int64_t>(it->ptr));
     auto offset = bld.Finish();
     *out = offset;
   } else {
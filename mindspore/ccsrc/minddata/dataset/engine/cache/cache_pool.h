@@ -35,6 +35,8 @@ namespace dataset {
 /// \brief A CachePool provides service for backup/restore a buffer. A buffer can be represented in a form of vector of
 /// ReadableSlice where all memory blocks will be copied to one contiguous block which can be in memory or spilled to
 /// disk (if a disk directory is provided). User must provide a key to insert the buffer.
+/// If compression is on, each ReadableSlice (i.e. each column of a row) is compressed on its own and kept compressed
+/// in memory only if it pays off. Buffers spilled to disk are not compressed.
 /// \see ReadableSlice
 class CachePool : public Service {
  public:
@@ -48,35 +50,40 @@ class CachePool : public Service {
   // An internal class to locate the whereabouts of a backed up buffer which can be either in
   class DataLocator {
    public:
-    DataLocator() : ptr(nullptr), sz(0), node_id(0), node_hit(false), storage_key(0) {}
+    DataLocator() : ptr(nullptr), sz(0), compressed_sz(0), node_id(0), node_hit(false), storage_key(0) {}
     ~DataLocator() = default;
     DataLocator(const DataLocator &other) = default;
     DataLocator &operator=(const DataLocator &other) = default;
     DataLocator(DataLocator &&other) noexcept {
       ptr = other.ptr;
       sz = other.sz;
+      compressed_sz = other.compressed_sz;
       node_id = other.node_id;
       node_hit = other.node_hit;
       storage_key = other.storage_key;
       other.ptr = nullptr;
       other.sz = 0;
+      other.compressed_sz = 0;
       other.storage_key = 0;
     }
     DataLocator &operator=(DataLocator &&other) noexcept {
       if (&other != this) {
         ptr = other.ptr;
         sz = other.sz;
+        compressed_sz = other.compressed_sz;
         node_id = other.node_id;
         node_hit = other.node_hit;
         storage_key = other.storage_key;
         other.ptr = nullptr;
         other.sz = 0;
+        other.compressed_sz = 0;
         other.storage_key = 0;
       }
       return *this;
     }
     pointer ptr;
     size_t sz;
+    size_t compressed_sz;  // size of the buffer at ptr if it is compressed, or 0 if ptr holds the sz bytes as is
     numa_id_t node_id;  // where the numa node the memory is allocated to
     bool node_hit;      // we can allocate to the preferred node
     StorageManager::key_type storage_key;
@@ -101,7 +108,8 @@ class CachePool : public Service {
   /// \brief Constructor
   /// \param alloc Allocator to allocate memory from
   /// \param root Optional disk folder to spill
-  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "");
+  /// \param compress Optional. Keep the compressible buffers compressed in memory
+  explicit CachePool(std::shared_ptr<NumaMemoryPool> mp, const std::string &root = "", bool compress = false);
 
   CachePool(const CachePool &) = delete;
   CachePool(CachePool &&) = delete;
@@ -143,7 +151,35 @@ class CachePool : public Service {
   /// \note Once locking is off. It is user's responsibility to ensure concurrency
   void SetLocking(bool on_off) { tree_->SetLocking(on_off); }
 
+  /// \brief Check if the buffers are compressed in memory
+  bool IsCompressionOn() const { return compress_; }
+
  private:
+  // Each compressed slice is prefixed by this header. A slice that does not compress is stored as is with
+  // stored_sz equal to raw_sz.
+  struct SegmentHeader {
+    uint64_t raw_sz;
+    uint64_t stored_sz;
+  };
+  // Slices smaller than this are not worth the effort to compress, e.g. the row header and the label columns.
+  constexpr static size_t kMinCompressSize = 64;
+  // A slice (and the whole buffer) must shrink by at least 1/kMinSavingDivisor to be kept compressed.
+  constexpr static size_t kMinSavingDivisor = 8;
+
+  /// \brief Compress the slices into one buffer
+  /// \param[in] buf A sequence of ReadableSlice objects
+  /// \param[out] out The compressed buffer
+  /// \param[out] out_sz Size of the compressed buffer, or 0 if the compression does not pay off
+  /// \return Error code
+  Status Compress(const std::vector<ReadableSlice> &buf, std::unique_ptr<base_type[]> *out, size_t *out_sz) const;
+
+  /// \brief Decompress a buffer cached in memory
+  /// \param[in] bl The DataLocator of a compressed buffer
+  /// \param[out] dest The destination of the original buffer
+  /// \return Error code
+  Status Decompress(const DataLocator &bl, WritableSlice *dest) const;
+
+
   std::shared_ptr<NumaMemoryPool> mp_;
   Path root_;
   const std::string subfolder_;
@@ -154,6 +190,7 @@ class CachePool : public Service {
                                           // we will adjust soft_mem_limit_ every 100Mb based on this parameter)
   uint64_t min_avail_mem_;                // lower bound of the available memory
   const int kMemoryCapAdjustInterval = 104857600;
+  bool compress_;
 };
 }  // namespace dataset
 }  // namespace mindspore
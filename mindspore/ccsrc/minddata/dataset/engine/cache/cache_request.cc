@@ -349,9 +349,19 @@ BatchCacheRowsRequest::BatchCacheRowsRequest(const CacheClient *cc, int64_t addr
     : BaseRequest(RequestType::kBatchCacheRows) {
   rq_.set_connection_id(cc->server_connection_id_);
   rq_.set_client_id(cc->client_id_);
+  rq_.set_flag(kDataIsInSharedMemory);
   rq_.add_buf_data(cc->cookie());
   rq_.add_buf_data(std::to_string(addr));
   rq_.add_buf_data(std::to_string(num_ele));
 }
+
+BatchCacheRowsRequest::BatchCacheRowsRequest(const CacheClient *cc, const void *buffer, int64_t sz, int32_t num_ele)
+    : BaseRequest(RequestType::kBatchCacheRows) {
+  rq_.set_connection_id(cc->server_connection_id_);
+  rq_.set_client_id(cc->client_id_);
+  rq_.add_buf_data(cc->cookie());
+  rq_.add_buf_data(buffer, sz);
+  rq_.add_buf_data(std::to_string(num_ele));
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -493,6 +493,11 @@ class BatchCacheRowsRequest : public BaseRequest {
  public:
   friend class CacheServer;
   explicit BatchCacheRowsRequest(const CacheClient *cc, int64_t addr, int32_t num_ele);
+  /// \brief Constructor for remote client, the serialized rows are sent inline in the request
+  /// \param buffer The back-to-back serialized tensor rows
+  /// \param sz The size of the serialized rows
+  /// \param num_ele The number of tensor rows
+  BatchCacheRowsRequest(const CacheClient *cc, const void *buffer, int64_t sz, int32_t num_ele);
   ~BatchCacheRowsRequest() override = default;
 };
 }  // namespace dataset
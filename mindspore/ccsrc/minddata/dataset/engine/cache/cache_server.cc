@@ -757,6 +757,9 @@ Status CacheServer::BatchCacheRows(CacheRequest *rq) {
   enum BufDataIndex : uint8_t { kCookie = 0, kAddr = 1, kSize = 2 };
   constexpr int32_t kExpectedBufDataSize = 3;
   CHECK_FAIL_RETURN_UNEXPECTED(rq->buf_data().size() == kExpectedBufDataSize, "Expect three pieces of data");
+  if (!BitTest(rq->flag(), kDataIsInSharedMemory)) {
+    return BatchCacheRowsInline(rq);
+  }
   try {
     auto &cookie = rq->buf_data(BufDataIndex::kCookie);
     auto connection_id = rq->connection_id();
@@ -789,7 +792,8 @@ Status CacheServer::BatchCacheRows(CacheRequest *rq) {
       cache_rq->rq_.add_buf_data(std::to_string(start - reinterpret_cast<int64_t>(base)));
       cache_rq->rq_.add_buf_data(std::to_string(reinterpret_cast<int64_t>(p - start)));
       cache_rq->rq_.add_buf_data(std::to_string(reinterpret_cast<int64_t>(batch_wait.get())));
-      RETURN_IF_NOT_OK(PushRequest(GetRandomWorker(), cache_rq));
+      // The worker allocates the row on its own numa node, which is the node of the client if sharding is on.
+      RETURN_IF_NOT_OK(PushRequest(GetWorkerByClientId(client_id), cache_rq));
     }
     // Now wait for all of them to come back.
     RETURN_IF_NOT_OK(batch_wait->Wait());
@@ -801,6 +805,39 @@ Status CacheServer::BatchCacheRows(CacheRequest *rq) {
   return Status::OK();
 }
 
+Status CacheServer::BatchCacheRowsInline(CacheRequest *rq) {
+  // First one is cookie, followed by the serialized rows and then the number of rows.
+  enum BufDataIndex : uint8_t { kCookie = 0, kData = 1, kSize = 2 };
+  auto connection_id = rq->connection_id();
+  // Hold the shared lock to prevent the cache from being dropped.
+  SharedLock lck(&rwLock_);
+  CacheService *cs = GetService(connection_id);
+  if (cs == nullptr) {
+    std::string errMsg = "Cache id " + std::to_string(connection_id) + " not found";
+    RETURN_STATUS_UNEXPECTED(errMsg);
+  }
+  // Only if the cookie matches, we can accept insert into this cache that has a build phase
+  CHECK_FAIL_RETURN_UNEXPECTED(!cs->HasBuildPhase() || rq->buf_data(BufDataIndex::kCookie) == cs->cookie(),
+                               "Cookie mismatch. Client id: " + std::to_string(rq->client_id()));
+  auto &data = rq->buf_data(BufDataIndex::kData);
+  auto num_elem = static_cast<int32_t>(strtol(rq->buf_data(BufDataIndex::kSize).data(), nullptr, kDecimal));
+  const char *p = data.data();
+  const char *end = p + data.size();
+  // The rows were sent in one message, so they are cached one by one without going through the workers again.
+  for (auto i = 0; i < num_elem; ++i) {
+    const char *start = p;
+    auto msg = GetTensorRowHeaderMsg(p);
+    p += msg->size_of_this();
+    for (auto k = 0; k < msg->column()->size(); ++k) {
+      p += msg->data_sz()->Get(k);
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(p <= end, "Data corruption detected.");
+    row_id_type id = -1;
+    RETURN_IF_NOT_OK(cs->FastCacheRow(ReadableSlice(start, p - start), &id));
+  }
+  return Status::OK();
+}
+
 Status CacheServer::ProcessRowRequest(CacheServerRequest *cache_req, bool *internal_request) {
   auto &rq = cache_req->rq_;
   auto &reply = cache_req->reply_;
@@ -992,8 +1029,8 @@ session_id_type CacheServer::GetSessionID(connection_id_type connection_id) cons
 }
 
 CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port,
-                         int32_t shared_meory_sz_in_gb, float memory_cap_ratio, int8_t log_level,
-                         std::shared_ptr<CacheServerHW> hw_info)
+                         int32_t shared_meory_sz_in_gb, float memory_cap_ratio, int8_t log_level, bool compress,
+                         bool numa_sharding, std::shared_ptr<CacheServerHW> hw_info)
     : top_(spill_path),
       num_workers_(num_workers),
       num_grpc_workers_(num_workers_),
@@ -1001,6 +1038,8 @@ CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int
       shared_memory_sz_in_gb_(shared_meory_sz_in_gb),
       global_shutdown_(false),
       memory_cap_ratio_(memory_cap_ratio),
+      compress_(compress),
+      numa_sharding_(numa_sharding),
       numa_affinity_(true),
       log_level_(log_level),
       hw_info_(std::move(hw_info)) {
@@ -1011,6 +1050,11 @@ CacheServer::CacheServer(const std::string &spill_path, int32_t num_workers, int
     MS_LOG(WARNING) << "Warning: This build is not compiled with numa support.  Install libnuma-devel and use a build "
                        "that is compiled with numa support for more optimal performance";
   }
+  // Sharding by numa node only makes sense if we can bind the threads and the memory to the nodes.
+  if (numa_sharding_ && (!numa_affinity_ || GetNumaNodeCount() <= 1)) {
+    MS_LOG(INFO) << "Numa sharding is turned off because there is no more than one numa node to bind to.";
+    numa_sharding_ = false;
+  }
   // We create the shared memory and we will destroy it. All other client just detach only.
   if (shared_memory_sz_in_gb_ > kDefaultSharedMemorySize) {
     MS_LOG(INFO) << "Shared memory size is readjust to " << kDefaultSharedMemorySize << " GB.";
@@ -1211,6 +1255,13 @@ worker_id_t CacheServer::GetRandomWorker() const {
   return dist(gen);
 }
 
+worker_id_t CacheServer::GetWorkerByClientId(int32_t client_id) const {
+  if (IsNumaShardingOn() && client_id >= 0) {
+    return GetWorkerByNumaId(GetClientNumaNode(client_id));
+  }
+  return GetRandomWorker();
+}
+
 Status CacheServer::AllocateSharedMemory(int32_t client_id, size_t sz, void **p) {
   return shm_->AllocateSharedMemory(client_id, sz, p);
 }
@@ -1306,7 +1357,9 @@ CacheServer::Builder::Builder()
       port_(kCfgDefaultCachePort),
       shared_memory_sz_in_gb_(kDefaultSharedMemorySize),
       memory_cap_ratio_(kDefaultMemoryCapRatio),
-      log_level_(kDefaultLogLevel) {
+      log_level_(kDefaultLogLevel),
+      compress_(false),
+      numa_sharding_(false) {
   if (num_workers_ == 0) {
     num_workers_ = 1;
   }
@@ -73,6 +73,8 @@ class CacheServer : public Service {
     int32_t GetSharedMemorySzInGb() const { return shared_memory_sz_in_gb_; }
     float GetMemoryCapRatio() const { return memory_cap_ratio_; }
     int8_t GetLogLevel() const { return log_level_; }
+    bool GetCompression() const { return compress_; }
+    bool GetNumaSharding() const { return numa_sharding_; }
 
     Builder &SetRootDirectory(std::string root) {
       top_ = std::move(root);
@@ -98,6 +100,14 @@ class CacheServer : public Service {
       log_level_ = log_level;
       return *this;
     }
+    Builder &SetCompression(bool compress) {
+      compress_ = compress;
+      return *this;
+    }
+    Builder &SetNumaSharding(bool numa_sharding) {
+      numa_sharding_ = numa_sharding;
+      return *this;
+    }
 
     Status SanityCheck();
 
@@ -108,6 +118,8 @@ class CacheServer : public Service {
           << "Tcp/ip port: " << GetPort() << "\n"
           << "Shared memory size (in GB): " << GetSharedMemorySzInGb() << "\n"
           << "Memory cap ratio: " << GetMemoryCapRatio() << "\n"
+          << "Compression: " << (GetCompression() ? "On" : "Off") << "\n"
+          << "Numa sharding: " << (GetNumaSharding() ? "On" : "Off") << "\n"
           << "Log level: " << std::to_string(GetLogLevel());
     }
 
@@ -143,7 +155,8 @@ class CacheServer : public Service {
       // We need to bring up the Task Manager by bringing up the Services singleton.
       RETURN_IF_NOT_OK(Services::CreateInstance());
       RETURN_IF_NOT_OK(CacheServer::CreateInstance(top_, num_workers_, port_, shared_memory_sz_in_gb_,
-                                                   memory_cap_ratio_, log_level_, std::move(hw_info_)));
+                                                   memory_cap_ratio_, log_level_, compress_, numa_sharding_,
+                                                   std::move(hw_info_)));
       return Status(StatusCode::kSuccess, warning_string);
     }
 
@@ -154,6 +167,8 @@ class CacheServer : public Service {
     int32_t shared_memory_sz_in_gb_;
     float memory_cap_ratio_;
     int8_t log_level_;
+    bool compress_;
+    bool numa_sharding_;
     std::shared_ptr<CacheServerHW> hw_info_;
 
     /// \brief Sanity checks on the shared memory.
@@ -173,12 +188,12 @@ class CacheServer : public Service {
   ~CacheServer() override { (void)ServiceStop(); }
 
   static Status CreateInstance(const std::string &spill_path, int32_t num_workers, int32_t port,
-                               int32_t shared_memory_sz, float memory_cap_ratio, int8_t log_level,
-                               std::shared_ptr<CacheServerHW> hw_info) {
+                               int32_t shared_memory_sz, float memory_cap_ratio, int8_t log_level, bool compress,
+                               bool numa_sharding, std::shared_ptr<CacheServerHW> hw_info) {
     std::call_once(init_instance_flag_, [&]() -> Status {
       auto &SvcManager = Services::GetInstance();
       RETURN_IF_NOT_OK(SvcManager.AddHook(&instance_, spill_path, num_workers, port, shared_memory_sz, memory_cap_ratio,
-                                          log_level, hw_info));
+                                          log_level, compress, numa_sharding, hw_info));
       return Status::OK();
     });
     return Status::OK();
@@ -231,12 +246,27 @@ class CacheServer : public Service {
   /// \return worker id
   worker_id_t GetRandomWorker() const;
 
+  /// \brief Pick a worker for a request of a client. If numa sharding is on, the worker is on the numa node the
+  /// client is bound to. Otherwise it is a random worker.
+  /// \param client_id The client id of the request, or -1 if unknown
+  /// \return worker id
+  worker_id_t GetWorkerByClientId(int32_t client_id) const;
+
+  /// \brief Return the numa node a client is bound to, which is the same node of the cpu list we send to the client.
+  numa_id_t GetClientNumaNode(int32_t client_id) const { return client_id % GetNumaNodeCount(); }
+
+  /// \brief Check if the requests and the shared memory of a client are sharded to the numa node of the client
+  bool IsNumaShardingOn() const { return numa_sharding_; }
+
   /// \brief Check if we bind threads to numa cores
   bool IsNumaAffinityOn() const { return numa_affinity_; }
 
   /// \brief Return the memory cap ratio
   float GetMemoryCapRatio() const { return memory_cap_ratio_; }
 
+  /// \brief Check if the cache services keep the rows compressed in memory
+  bool IsCompressionOn() const { return compress_; }
+
   /// \brief Function to handle a row request
   /// \param[in] cache_req A row request to handle
   /// \param[out] internal_request Indicator if the request is an internal request
@@ -293,6 +323,8 @@ class CacheServer : public Service {
   int8_t log_level_;  // log_level is saved here for informational purpose only. It's not a functional field.
   std::atomic<bool> global_shutdown_;
   float memory_cap_ratio_;
+  bool compress_;
+  bool numa_sharding_;
   std::shared_ptr<CacheServerHW> hw_info_;
   std::map<worker_id_t, Task *> numa_tasks_;
   bool numa_affinity_;
@@ -303,7 +335,8 @@ class CacheServer : public Service {
   /// \param spill_path Top directory for spilling buffers to.
   /// \param num_workers Number of threads for handling requests.
   explicit CacheServer(const std::string &spill_path, int32_t num_workers, int32_t port, int32_t share_memory_sz_in_gb,
-                       float memory_cap_ratio, int8_t log_level, std::shared_ptr<CacheServerHW> hw_info);
+                       float memory_cap_ratio, int8_t log_level, bool compress, bool numa_sharding,
+                       std::shared_ptr<CacheServerHW> hw_info);
 
   /// \brief Locate a cache service from connection id.
   /// \return Pointer to cache service. Null if not found
@@ -477,6 +510,11 @@ class CacheServer : public Service {
   Status BatchFetch(const std::shared_ptr<flatbuffers::FlatBufferBuilder> &fbb, WritableSlice *out);
   Status BatchCacheRows(CacheRequest *rq);
 
+  /// \brief Cache the rows of a remote client, which are sent inline in the request rather than in shared memory.
+  /// \param[in] rq The request with the cookie, the back-to-back serialized rows and the number of rows.
+  /// \return Status object
+  Status BatchCacheRowsInline(CacheRequest *rq);
+
   Status InternalFetchRow(CacheRequest *rq);
   Status InternalCacheRow(CacheRequest *rq, CacheReply *reply);
 };
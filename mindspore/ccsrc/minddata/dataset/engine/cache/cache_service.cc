@@ -53,7 +53,7 @@ Status CacheService::DoServiceStart() {
     RETURN_STATUS_UNEXPECTED("Unable to bring up numa memory pool");
   }
   // Put together a CachePool for backing up the Tensor.
-  cp_ = std::make_shared<CachePool>(numa_pool_, root_);
+  cp_ = std::make_shared<CachePool>(numa_pool_, root_, cs.IsCompressionOn());
   RETURN_IF_NOT_OK(cp_->ServiceStart());
   // Assign a name to this cache. Used for exclusive connection. But we can just use CachePool's name.
   cookie_ = cp_->MyName();
@@ -170,8 +170,15 @@ Status CacheService::FastCacheRow(const ReadableSlice &src, row_id_type *row_id_
       }
       *row_id_generated = msg->row_id();
     }
-    // Now we cache the buffer.
-    Status rc = cp_->Insert(*row_id_generated, {src});
+    // Now we cache the buffer. If compression is on, split the buffer into the header and the columns so the
+    // compression is decided column by column.
+    std::vector<ReadableSlice> all_data;
+    if (cp_->IsCompressionOn()) {
+      RETURN_IF_NOT_OK(SplitRow(src, &all_data));
+    } else {
+      all_data.push_back(src);
+    }
+    Status rc = cp_->Insert(*row_id_generated, all_data);
     if (rc == Status(StatusCode::kMDDuplicateKey)) {
       MS_LOG(DEBUG) << "Ignoring duplicate key.";
     } else {
@@ -193,6 +200,26 @@ Status CacheService::FastCacheRow(const ReadableSlice &src, row_id_type *row_id_
   }
 }
 
+Status CacheService::SplitRow(const ReadableSlice &src, std::vector<ReadableSlice> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  auto msg = GetTensorRowHeaderMsg(src.GetPointer());
+  auto column_hdr = msg->column();
+  auto data_sz = msg->data_sz();
+  CHECK_FAIL_RETURN_UNEXPECTED(column_hdr != nullptr && data_sz != nullptr && data_sz->size() == column_hdr->size(),
+                               "Column count does not match.");
+  int64_t offset = msg->size_of_this();
+  out->reserve(column_hdr->size() + 1);
+  out->emplace_back(src, 0, offset);
+  for (auto i = 0; i < column_hdr->size(); ++i) {
+    out->emplace_back(src, offset, data_sz->Get(i));
+    offset += data_sz->Get(i);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(offset <= static_cast<int64_t>(src.GetSize()),
+                               "Row size does not match. Expect " + std::to_string(offset) + " but get " +
+                                 std::to_string(src.GetSize()));
+  return Status::OK();
+}
+
 std::ostream &operator<<(std::ostream &out, const CacheService &cs) {
   // Then show any custom derived-internal stuff
   out << "\nCache memory size: " << cs.cache_mem_sz_;
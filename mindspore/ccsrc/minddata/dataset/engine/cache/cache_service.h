@@ -145,6 +145,12 @@ class CacheService : public Service {
   row_id_type GetNextRowId() { return next_id_.fetch_add(1); }
 
   Status InternalFetchRow(const FetchRowMsg *p);
+
+  /// \brief Split a serialized row into the header and the columns
+  /// \param[in] src A serialized row
+  /// \param[out] out The header followed by one slice per column
+  /// \return Status object
+  static Status SplitRow(const ReadableSlice &src, std::vector<ReadableSlice> *out);
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -216,6 +216,7 @@ void DatasetOp::CreateConnector() {
   MS_LOG(DEBUG) << "Creating connector in tree operator: " << operator_id_ << ".";
   if (oc_queue_size_ > 0) {
     out_connector_ = std::make_unique<OperatorConnector>(oc_queue_size_);
+    out_connector_->SetName(NameWithID());
   } else {
     // Some op's may choose not to have an output connector
     MS_LOG(DEBUG) << "Bypassed connector creation for tree operator: " << operator_id_ << ".";
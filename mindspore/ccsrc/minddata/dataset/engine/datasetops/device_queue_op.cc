@@ -441,6 +441,28 @@ Status DeviceQueueOp::LaunchParallelCopyThread() {
   return Status::OK();
 }
 
+Status DeviceQueueOp::GrowPrefetchDepth(const std::vector<device::DataQueueItem> &items) {
+  uint32_t queue_capacity = static_cast<uint32_t>(gpu_connector_->capacity()) / num_workers_;
+  if (queue_capacity >= kDeviceQueGpuMaxQueueCapacity) {
+    return Status::OK();
+  }
+  size_t batch_size = 0;
+  for (const auto &item : items) {
+    batch_size += item.data_len_;
+  }
+  // Half of the pin memory pool of a worker is left for the batches which are staged or held by the device queue.
+  const size_t kMegaByte = 1024 * 1024;
+  size_t memory_budget = static_cast<size_t>(kDeviceQueGpuThreadMemory) * kMegaByte / 2;
+  uint32_t new_capacity = std::min(queue_capacity * 2, kDeviceQueGpuMaxQueueCapacity);
+  if (batch_size == 0 || new_capacity * batch_size > memory_budget) {
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(gpu_connector_->Resize(static_cast<int32_t>(new_capacity)));
+  MS_LOG(INFO) << "Device queue " << channel_name_ << " is drained, grow the prefetch depth of each worker from "
+               << queue_capacity << " to " << new_capacity << ".";
+  return Status::OK();
+}
+
 bool DeviceQueueOp::NoExceptionRaised() {
   return !TaskManager::FindMe()->Interrupted() && !mindspore::DataQueueHandler::IsClosed();
 }
@@ -496,6 +518,11 @@ Status DeviceQueueOp::PushDataToGPU() {
         RETURN_STATUS_ERROR(StatusCode::kMDTimeOut,
                             "[Internal ERROR] Failed to prefetch data in current PS mode(cache data when sending).");
       }
+      // The device queue has been drained before this batch arrives, so the consumer stalls on the data.
+      if (send_batch > 0 && mindspore::DataQueueHandler::Size(channel_name_) == 0) {
+        ++device_underflow_count_;
+        RETURN_IF_NOT_OK(GrowPrefetchDepth(items));
+      }
       RETURN_IF_NOT_OK(RetryPushData(items, is_profiling_enable, &push_cost));
 #ifndef ENABLE_SECURITY
       ProfilingRecorder(is_profiling_enable, profiling_node, send_batch, push_cost, &batch_start_time, &end_time,
@@ -641,11 +668,34 @@ Status DeviceQueueOp::SendDataToGPU() {
 
 Status DeviceQueueOp::MallocForGPUData(std::vector<device::DataQueueItem> *items, const TensorRow &curr_row,
                                        const int32_t &worker_id) {
+  // Stage all the columns of the batch in one pinned buffer, so the gpu queue copies them to device with one memcpy.
+  // Fall back to one buffer per column if the pool can not offer such a large buffer.
+  size_t total_len = 0;
+  for (auto &sub_item : *items) {
+    total_len += sub_item.data_len_;
+  }
+  uint8_t *batch_ptr = nullptr;
+  if (items->size() > 1 && total_len > 0) {
+    void *ptr = nullptr;
+    if (pool_[worker_id]->Allocate(total_len, &ptr).IsOk()) {
+      batch_ptr = reinterpret_cast<uint8_t *>(ptr);
+    }
+  }
+  size_t offset = 0;
   int i = 0;
   for (auto &sub_item : *items) {
-    auto rc = pool_[worker_id]->Allocate(sub_item.data_len_, &sub_item.data_ptr_);
-    if (rc.IsError() || sub_item.data_ptr_ == nullptr) {
-      RETURN_STATUS_OOM("Memory malloc failed, check memory usage.");
+    if (batch_ptr != nullptr) {
+      sub_item.data_ptr_ = batch_ptr + offset;
+      offset += sub_item.data_len_;
+      // The first column owns the staging buffer, the invalid worker id keeps the others from being released.
+      if (i > 0) {
+        sub_item.worker_id_ = -1;
+      }
+    } else {
+      auto rc = pool_[worker_id]->Allocate(sub_item.data_len_, &sub_item.data_ptr_);
+      if (rc.IsError() || sub_item.data_ptr_ == nullptr) {
+        RETURN_STATUS_OOM("Memory malloc failed, check memory usage.");
+      }
     }
     if (curr_row[i] == nullptr) {
       MS_LOG(ERROR) << "[Internal ERROR] The pointer curr_row[" << i << "] is null";
@@ -74,6 +74,10 @@ class DeviceQueueOp : public PipelineOp {
   /// \return connector size of current op
   int32_t ConnectorSize() const { return ChildOpConnectorSize(); }
 
+  /// \brief Getter function
+  /// \return number of batches which found the device queue drained when they were sent
+  int64_t DeviceUnderflowCount() const { return device_underflow_count_; }
+
   Status EoeReceived(int32_t worker_id) override;
 
   void StopSend() { stop_send_ = true; }
@@ -157,12 +161,15 @@ class DeviceQueueOp : public PipelineOp {
   Status PushDataToGPU();
   Status WorkerEntry(int32_t worker_id);
   Status SetThreadDevice();
+  // Grow the prefetch depth of gpu_connector_ within the pin memory budget after the device queue is drained
+  Status GrowPrefetchDepth(const std::vector<device::DataQueueItem> &items);
 
   QueueList<TensorRow> receive_queues_;
   std::vector<std::shared_ptr<MemoryPool>> pool_;
   std::unique_ptr<GpuConnector> gpu_connector_;
   const uint32_t kDeviceQueGpuNumThreads = 2;
   const uint32_t kDeviceQueGpuQueueCapacity = 8;
+  const uint32_t kDeviceQueGpuMaxQueueCapacity = 32;
   const uint32_t kDeviceQueGpuThreadMemory = 1024;
   uint32_t num_workers_;
   uint32_t queue_capacity_;
@@ -195,6 +202,7 @@ class DeviceQueueOp : public PipelineOp {
   std::mutex data_info_mutex_;
   bool first_push_flag_;  // default: false, when first push, it will be true
   bool dynamic_shape_{false};
+  std::atomic<int64_t> device_underflow_count_{0};
 
 #ifdef ENABLE_TDTQUE
   std::shared_ptr<DeviceQueueBase> tdtInstancePtr;
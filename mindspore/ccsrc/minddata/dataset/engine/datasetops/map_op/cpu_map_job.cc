@@ -39,8 +39,14 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
-      // Call compute function for cpu
-      Status rc = ops_[i]->Compute(input_row, &result_row);
+      // Call compute function for cpu, the rows batched before the map are computed in one call if supported.
+      Status rc;
+      if (IsBatchedInput(ops_[i], input_row)) {
+        result_row.resize(1);
+        rc = ops_[i]->BatchCompute(input_row[0], &result_row[0]);
+      } else {
+        rc = ops_[i]->Compute(input_row, &result_row);
+      }
       if (rc.IsError()) {
         RETURN_IF_NOT_OK(RebuildMapErrorMsg(input_row, i, &rc));
       }
@@ -55,6 +61,13 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
   return Status::OK();
 }
 
+bool CpuMapJob::IsBatchedInput(const std::shared_ptr<TensorOp> &op, const TensorRow &input_row) {
+  if (op->BatchInputRank() == 0 || !op->OneToOne() || input_row.size() != 1 || input_row[0] == nullptr) {
+    return false;
+  }
+  return static_cast<int32_t>(input_row[0]->Rank()) == op->BatchInputRank();
+}
+
 Status CpuMapJob::RebuildMapErrorMsg(const TensorRow &input_row, const size_t &i, Status *rc) {
   std::string err_msg = "";
   std::string op_name = ops_[i]->Name();
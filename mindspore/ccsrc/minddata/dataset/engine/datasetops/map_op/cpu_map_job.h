@@ -37,6 +37,9 @@ class CpuMapJob : public MapJob {
   Status Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) override;
 
  private:
+  // Whether the row is a block of rows batched before the map, which is computed by BatchCompute of the op.
+  static bool IsBatchedInput(const std::shared_ptr<TensorOp> &op, const TensorRow &input_row);
+
   Status RebuildMapErrorMsg(const TensorRow &input_row, const size_t &i, Status *rc);
 };
 
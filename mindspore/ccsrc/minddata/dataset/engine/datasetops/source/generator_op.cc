@@ -92,7 +92,43 @@ Status GeneratorOp::Init() {
   return CreateGeneratorObject();
 }
 
+Status GeneratorOp::CheckColumnType(size_t column, const std::shared_ptr<Tensor> &tensor) {
+  if ((!column_types_.empty()) && (column_types_[column] != DataType::DE_UNKNOWN) &&
+      (column_types_[column] != tensor->type())) {
+    RETURN_STATUS_ERROR(StatusCode::kMDPyFuncException,
+                        "Invalid python function, type of returned data in 'GeneratorDataset' should be same with "
+                        "specified column_types, but the type of returned data: " +
+                          tensor->type().ToString() + ", specified column type: " + column_types_[column].ToString());
+  }
+  return Status::OK();
+}
+
+#ifdef ENABLE_CACHE
+Status GeneratorOp::ShmRowToTensorRow(const GeneratorShmRow &shm_row, TensorRow *tensor_row) {
+  RETURN_UNEXPECTED_IF_NULL(shm_row.ring);
+  RETURN_IF_NOT_OK(shm_row.ring->PopRow(shm_row.slot, tensor_row));
+  if (tensor_row->size() != column_names_.size()) {
+    RETURN_STATUS_ERROR(
+      StatusCode::kMDPyFuncException,
+      "Invalid python function, the 'source' of 'GeneratorDataset' should return same number of NumPy arrays as "
+      "specified in column_names, the size of column_names is:" +
+        std::to_string(column_names_.size()) +
+        " and number of arrays written to shared memory is:" + std::to_string(tensor_row->size()));
+  }
+  for (size_t i = 0; i < tensor_row->size(); ++i) {
+    RETURN_IF_NOT_OK(CheckColumnType(i, (*tensor_row)[i]));
+  }
+  return Status::OK();
+}
+#endif
+
 Status GeneratorOp::PyRowToTensorRow(py::object py_data, TensorRow *tensor_row) {
+#ifdef ENABLE_CACHE
+  // The worker process has written the row to the shared memory ring in place.
+  if (py::isinstance<GeneratorShmRow>(py_data)) {
+    return ShmRowToTensorRow(py_data.cast<GeneratorShmRow>(), tensor_row);
+  }
+#endif
   if (!py::isinstance<py::tuple>(py_data)) {
     RETURN_STATUS_ERROR(StatusCode::kMDPyFuncException,
                         "Invalid python function, the 'source' of 'GeneratorDataset' should return a tuple of NumPy "
@@ -26,6 +26,9 @@
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#ifdef ENABLE_CACHE
+#include "minddata/dataset/engine/datasetops/source/generator_shm_ring.h"
+#endif
 #include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
 #include "minddata/dataset/util/wait_post.h"
 #include "pybind11/pybind11.h"
@@ -97,6 +100,14 @@ class GeneratorOp : public PipelineOp, public RandomAccessOp {
 
   Status PyRowToTensorRow(py::object py_data, TensorRow *tensor_row);
 
+  /// Check the type of the tensor created for the column against the specified column_types
+  Status CheckColumnType(size_t column, const std::shared_ptr<Tensor> &tensor);
+
+#ifdef ENABLE_CACHE
+  /// Take the row written by the worker process from the shared memory ring, without copying the data
+  Status ShmRowToTensorRow(const GeneratorShmRow &shm_row, TensorRow *tensor_row);
+#endif
+
   /// Private function for computing the assignment of the column name map.
   /// \return - Status
   Status ComputeColMap() override;
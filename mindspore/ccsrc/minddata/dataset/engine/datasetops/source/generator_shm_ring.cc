@@ -0,0 +1,226 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/datasetops/source/generator_shm_ring.h"
+#include <unistd.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr uint32_t kShmRingMagic = 0x4D445352;
+constexpr int64_t kShmRingAlignSize = 64;
+constexpr int32_t kShmRingCreateRetry = 16;
+constexpr int32_t kShmRingKeyShift = 12;
+constexpr int32_t kShmRingKeyPidMask = 0x3FFFF;
+constexpr int32_t kShmRingKeyPrefix = 0x40000000;
+
+int64_t AlignUp(int64_t size) { return (size + kShmRingAlignSize - 1) / kShmRingAlignSize * kShmRingAlignSize; }
+}  // namespace
+
+GeneratorShmRing::GeneratorShmRing(SharedMemory &&shm)
+    : shm_(std::move(shm)), base_(nullptr), num_slots_(0), slot_size_(0), slot_stride_(0), next_slot_(0) {}
+
+Status GeneratorShmRing::Create(int32_t num_slots, int64_t slot_size, std::shared_ptr<GeneratorShmRing> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(num_slots > 0, "The number of slots of shared memory ring should be positive.");
+  CHECK_FAIL_RETURN_UNEXPECTED(slot_size > 0, "The slot size of shared memory ring should be positive.");
+  const int64_t slot_stride = AlignUp(sizeof(SlotHeader)) + AlignUp(slot_size);
+  const int64_t total_size = AlignUp(sizeof(RingHeader)) + slot_stride * num_slots;
+  // The key is made from the pid so it is never IPC_PRIVATE, and it is retried in case another ring has taken it.
+  static std::atomic<int32_t> key_seq{0};
+  Status rc;
+  for (int32_t i = 0; i < kShmRingCreateRetry; ++i) {
+    auto seq = key_seq.fetch_add(1) & ((1 << kShmRingKeyShift) - 1);
+    SharedMemory shm(kShmRingKeyPrefix | ((getpid() & kShmRingKeyPidMask) << kShmRingKeyShift) | seq);
+    rc = shm.Create(total_size);
+    if (rc.IsError()) {
+      continue;
+    }
+    shm.RemoveResourcesOnExit();
+    auto header = reinterpret_cast<RingHeader *>(shm.SharedMemoryBaseAddr());
+    header->num_slots = num_slots;
+    header->slot_size = slot_size;
+    header->magic = kShmRingMagic;
+    *out = std::shared_ptr<GeneratorShmRing>(new GeneratorShmRing(std::move(shm)));
+    return (*out)->Init();
+  }
+  return rc;
+}
+
+Status GeneratorShmRing::Attach(SharedMemory::shm_key_t key, std::shared_ptr<GeneratorShmRing> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  SharedMemory shm(key);
+  RETURN_IF_NOT_OK(shm.Attach());
+  *out = std::shared_ptr<GeneratorShmRing>(new GeneratorShmRing(std::move(shm)));
+  return (*out)->Init();
+}
+
+Status GeneratorShmRing::Init() {
+  base_ = reinterpret_cast<uint8_t *>(shm_.SharedMemoryBaseAddr());
+  RETURN_UNEXPECTED_IF_NULL(base_);
+  auto header = reinterpret_cast<RingHeader *>(base_);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->magic == kShmRingMagic,
+                               "The shared memory of key " + std::to_string(shm_.GetKey()) + " is not a ring.");
+  num_slots_ = header->num_slots;
+  slot_size_ = header->slot_size;
+  slot_stride_ = AlignUp(sizeof(SlotHeader)) + AlignUp(slot_size_);
+  return Status::OK();
+}
+
+GeneratorShmRing::SlotHeader *GeneratorShmRing::Slot(int32_t slot) const {
+  return reinterpret_cast<SlotHeader *>(base_ + AlignUp(sizeof(RingHeader)) + slot_stride_ * slot);
+}
+
+uint8_t *GeneratorShmRing::SlotData(int32_t slot) const {
+  if (slot < 0 || slot >= num_slots_) {
+    return nullptr;
+  }
+  return reinterpret_cast<uint8_t *>(Slot(slot)) + AlignUp(sizeof(SlotHeader));
+}
+
+Status GeneratorShmRing::CheckSlot(int32_t slot, SlotState state) const {
+  CHECK_FAIL_RETURN_UNEXPECTED(slot >= 0 && slot < num_slots_, "Invalid slot " + std::to_string(slot) +
+                                                                  ", the ring has " + std::to_string(num_slots_) +
+                                                                  " slots.");
+  auto cur_state = Slot(slot)->state.load(std::memory_order_acquire);
+  CHECK_FAIL_RETURN_UNEXPECTED(cur_state == state, "The state of slot " + std::to_string(slot) + " is " +
+                                                     std::to_string(cur_state) + ", but " + std::to_string(state) +
+                                                     " is expected.");
+  return Status::OK();
+}
+
+Status GeneratorShmRing::AcquireSlot(int32_t *slot) {
+  RETURN_UNEXPECTED_IF_NULL(slot);
+  *slot = -1;
+  // Start from a moving cursor so that the workers of different processes do not contend for the same slot.
+  auto start = next_slot_.fetch_add(1, std::memory_order_relaxed);
+  for (int32_t i = 0; i < num_slots_; ++i) {
+    auto index = static_cast<int32_t>((static_cast<uint32_t>(start) + i) % num_slots_);
+    int32_t expected = kSlotFree;
+    if (Slot(index)->state.compare_exchange_strong(expected, kSlotWriting, std::memory_order_acq_rel)) {
+      Slot(index)->num_columns = 0;
+      *slot = index;
+      break;
+    }
+  }
+  return Status::OK();
+}
+
+Status GeneratorShmRing::SetColumn(int32_t slot, int32_t column, const DataType &type, const TensorShape &shape,
+                                   int64_t offset) {
+  RETURN_IF_NOT_OK(CheckSlot(slot, kSlotWriting));
+  CHECK_FAIL_RETURN_UNEXPECTED(column >= 0 && column < kShmRingMaxColumns,
+                               "Invalid column " + std::to_string(column) + ", the ring supports at most " +
+                                 std::to_string(kShmRingMaxColumns) + " columns.");
+  CHECK_FAIL_RETURN_UNEXPECTED(type.IsNumeric(), "Only the numeric column can be written to the ring, but got " +
+                                                   type.ToString());
+  CHECK_FAIL_RETURN_UNEXPECTED(shape.known() && shape.Rank() <= kShmRingMaxRank,
+                               "Invalid shape " + shape.ToString() + ", the ring supports the known shape with rank " +
+                                 "at most " + std::to_string(kShmRingMaxRank));
+  const int64_t size = shape.NumOfElements() * type.SizeInBytes();
+  CHECK_FAIL_RETURN_UNEXPECTED(offset >= 0 && offset + size <= slot_size_,
+                               "The column of " + std::to_string(size) + " bytes at offset " + std::to_string(offset) +
+                                 " exceeds the slot size " + std::to_string(slot_size_));
+  auto &desc = Slot(slot)->columns[column];
+  desc.type = static_cast<int32_t>(type.value());
+  desc.rank = static_cast<int32_t>(shape.Rank());
+  desc.offset = offset;
+  for (int32_t i = 0; i < desc.rank; ++i) {
+    desc.shape[i] = shape[i];
+  }
+  return Status::OK();
+}
+
+Status GeneratorShmRing::CommitSlot(int32_t slot, int32_t num_columns) {
+  RETURN_IF_NOT_OK(CheckSlot(slot, kSlotWriting));
+  CHECK_FAIL_RETURN_UNEXPECTED(num_columns >= 0 && num_columns <= kShmRingMaxColumns,
+                               "Invalid number of columns " + std::to_string(num_columns));
+  Slot(slot)->num_columns = num_columns;
+  Slot(slot)->state.store(kSlotReady, std::memory_order_release);
+  return Status::OK();
+}
+
+Status GeneratorShmRing::PopRow(int32_t slot, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+  RETURN_IF_NOT_OK(CheckSlot(slot, kSlotReady));
+  auto header = Slot(slot);
+  header->state.store(kSlotReading, std::memory_order_relaxed);
+  // Hold one reference while creating the tensors, so the slot is freed exactly once even if a tensor fails.
+  header->num_refs.store(1, std::memory_order_relaxed);
+  uint8_t *data = SlotData(slot);
+  Status rc;
+  for (int32_t i = 0; i < header->num_columns && rc.IsOk(); ++i) {
+    const auto &desc = header->columns[i];
+    TensorShape shape(std::vector<dsize_t>(desc.shape, desc.shape + desc.rank));
+    DataType type(static_cast<DataType::Type>(desc.type));
+    std::shared_ptr<Tensor> tensor;
+    if (shape.NumOfElements() == 0) {
+      rc = Tensor::CreateEmpty(shape, type, &tensor);
+    } else {
+      header->num_refs.fetch_add(1, std::memory_order_relaxed);
+      rc = Tensor::CreateFromPoolMemory(shape, type, data + desc.offset, shared_from_this(), &tensor);
+      if (rc.IsError()) {
+        Deallocate(data);
+      }
+    }
+    if (rc.IsOk()) {
+      row->push_back(std::move(tensor));
+    }
+  }
+  Deallocate(data);
+  return rc;
+}
+
+int32_t GeneratorShmRing::NumSlotsInUse() const {
+  int32_t num_in_use = 0;
+  for (int32_t i = 0; i < num_slots_; ++i) {
+    if (Slot(i)->state.load(std::memory_order_relaxed) != kSlotFree) {
+      ++num_in_use;
+    }
+  }
+  return num_in_use;
+}
+
+Status GeneratorShmRing::Allocate(size_t, void **) {
+  RETURN_STATUS_UNEXPECTED("The memory of shared memory ring can only be taken by PopRow.");
+}
+
+Status GeneratorShmRing::Reallocate(void **, size_t, size_t) {
+  RETURN_STATUS_UNEXPECTED("The memory of shared memory ring can not be reallocated.");
+}
+
+void GeneratorShmRing::Deallocate(void *p) {
+  auto offset = reinterpret_cast<uint8_t *>(p) - (base_ + AlignUp(sizeof(RingHeader)));
+  if (p == nullptr || offset < 0 || offset >= slot_stride_ * num_slots_) {
+    MS_LOG(ERROR) << "The memory " << p << " does not belong to the shared memory ring.";
+    return;
+  }
+  auto header = Slot(static_cast<int32_t>(offset / slot_stride_));
+  if (header->num_refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    header->state.store(kSlotFree, std::memory_order_release);
+  }
+}
+
+int GeneratorShmRing::PercentFree() const {
+  constexpr int kPercent = 100;
+  return (num_slots_ - NumSlotsInUse()) * kPercent / num_slots_;
+}
+}  // namespace dataset
+}  // namespace mindspore
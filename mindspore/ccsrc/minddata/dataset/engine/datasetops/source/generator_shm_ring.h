@@ -0,0 +1,146 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_GENERATOR_SHM_RING_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_GENERATOR_SHM_RING_H_
+
+#include <atomic>
+#include <memory>
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/core/tensor_shape.h"
+#include "minddata/dataset/engine/cache/cache_ipc.h"
+#include "minddata/dataset/util/memory_pool.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+constexpr int32_t kShmRingMaxColumns = 16;
+constexpr int32_t kShmRingMaxRank = 8;
+
+/// \brief A ring of fixed size slots on the shared memory, used to transport the rows of GeneratorDataset from the
+/// python worker processes without pickling. A worker acquires a free slot, writes the NumPy arrays into the slot
+/// buffer in place and commits it. GeneratorOp then pops the slot as a TensorRow whose tensors point to the slot
+/// memory directly, and the slot becomes free again once all its tensors are destroyed.
+/// The ring itself is the memory pool of those tensors, so it outlives every tensor created on it.
+class GeneratorShmRing : public MemoryPool, public std::enable_shared_from_this<GeneratorShmRing> {
+ public:
+  enum SlotState : int32_t { kSlotFree = 0, kSlotWriting = 1, kSlotReady = 2, kSlotReading = 3 };
+
+  ~GeneratorShmRing() override = default;
+
+  /// \brief Create the shared memory of the ring in the main process, the shared memory is removed when the ring is
+  /// destroyed.
+  /// \param[in] num_slots Number of slots in the ring
+  /// \param[in] slot_size Size in bytes of the data buffer of each slot
+  /// \param[out] out The created ring
+  /// \return Status object
+  static Status Create(int32_t num_slots, int64_t slot_size, std::shared_ptr<GeneratorShmRing> *out);
+
+  /// \brief Attach to the ring created by the main process, called by the worker process.
+  /// \param[in] key The key of the shared memory of the ring
+  /// \param[out] out The attached ring
+  /// \return Status object
+  static Status Attach(SharedMemory::shm_key_t key, std::shared_ptr<GeneratorShmRing> *out);
+
+  SharedMemory::shm_key_t key() const { return shm_.GetKey(); }
+  int32_t num_slots() const { return num_slots_; }
+  int64_t slot_size() const { return slot_size_; }
+
+  /// \brief Acquire a free slot to write a row, called by the worker process.
+  /// \param[out] slot Index of the acquired slot, -1 if all the slots are in use
+  /// \return Status object
+  Status AcquireSlot(int32_t *slot);
+
+  /// \brief The data buffer of the slot, which is slot_size() bytes long.
+  uint8_t *SlotData(int32_t slot) const;
+
+  /// \brief Describe one column of the row written in the slot.
+  /// \param[in] slot Index of the slot acquired by AcquireSlot()
+  /// \param[in] column Index of the column
+  /// \param[in] type Numeric type of the column
+  /// \param[in] shape Shape of the column
+  /// \param[in] offset Offset of the column data in the slot buffer
+  /// \return Status object
+  Status SetColumn(int32_t slot, int32_t column, const DataType &type, const TensorShape &shape, int64_t offset);
+
+  /// \brief Publish the row written in the slot to GeneratorOp.
+  /// \param[in] slot Index of the slot acquired by AcquireSlot()
+  /// \param[in] num_columns Number of columns described by SetColumn()
+  /// \return Status object
+  Status CommitSlot(int32_t slot, int32_t num_columns);
+
+  /// \brief Take the committed row out of the slot, the tensors of the row share the slot memory.
+  /// \param[in] slot Index of the committed slot
+  /// \param[out] row The row read from the slot
+  /// \return Status object
+  Status PopRow(int32_t slot, TensorRow *row);
+
+  /// \brief Number of slots which are not free.
+  int32_t NumSlotsInUse() const;
+
+  /// MemoryPool interface, the memory of the ring is only handed out by PopRow().
+  Status Allocate(size_t, void **) override;
+  Status Reallocate(void **, size_t, size_t) override;
+  /// Give back the memory of one tensor, and free the slot when it is the last one.
+  void Deallocate(void *p) override;
+  uint64_t get_max_size() const override { return static_cast<uint64_t>(slot_size_); }
+  int PercentFree() const override;
+
+ private:
+  struct ColumnDesc {
+    int32_t type;
+    int32_t rank;
+    int64_t offset;
+    int64_t shape[kShmRingMaxRank];
+  };
+
+  struct SlotHeader {
+    std::atomic<int32_t> state;
+    std::atomic<int32_t> num_refs;
+    int32_t num_columns;
+    int32_t reserved;
+    ColumnDesc columns[kShmRingMaxColumns];
+  };
+
+  struct RingHeader {
+    uint32_t magic;
+    int32_t num_slots;
+    int64_t slot_size;
+  };
+
+  explicit GeneratorShmRing(SharedMemory &&shm);
+
+  Status Init();
+  Status CheckSlot(int32_t slot, SlotState state) const;
+  SlotHeader *Slot(int32_t slot) const;
+
+  SharedMemory shm_;
+  uint8_t *base_;
+  int32_t num_slots_;
+  int64_t slot_size_;
+  int64_t slot_stride_;
+  std::atomic<int32_t> next_slot_;
+};
+
+/// \brief A committed slot of the ring, which the python generator yields in place of the tuple of NumPy arrays.
+struct GeneratorShmRow {
+  std::shared_ptr<GeneratorShmRing> ring;
+  int32_t slot;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_GENERATOR_SHM_RING_H_
@@ -198,8 +198,8 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
   }
   if (task_type == mindrecord::TaskType::kCommonTask) {
     for (const auto &tupled_row : tupled_buffer) {
-      std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-      mindrecord::json columns_json = std::get<1>(tupled_row);
+      const std::vector<uint8_t> &columns_blob = std::get<0>(tupled_row);
+      const mindrecord::json &columns_json = std::get<1>(tupled_row);
       RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob, columns_json, task_type));
       std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
       fetched_row->setPath(file_path);
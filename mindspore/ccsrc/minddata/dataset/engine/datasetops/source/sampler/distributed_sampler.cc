@@ -18,13 +18,14 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 
 #include "minddata/dataset/util/random.h"
 
 namespace mindspore {
 namespace dataset {
 DistributedSamplerRT::DistributedSamplerRT(int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples,
-                                           uint32_t seed, int64_t offset, bool even_dist)
+                                           uint32_t seed, int64_t offset, bool even_dist, int64_t block_size)
     : SamplerRT(num_samples, std::numeric_limits<int64_t>::max()),
       cnt_(0),
       seed_(seed == std::numeric_limits<uint32_t>::max() ? GetSeed() : seed),
@@ -33,7 +34,9 @@ DistributedSamplerRT::DistributedSamplerRT(int64_t num_shards, int64_t shard_id,
       shuffle_(shuffle),
       even_dist_(even_dist),
       offset_(offset),
-      non_empty_(true) {
+      non_empty_(true),
+      block_size_(block_size),
+      epoch_(0) {
   // Update the num_shards_ in global context. this number is only used for now by auto_num_worker_pass. User discretion
   // is advised. Auto_num_worker_pass is currently an experimental feature which can still work if the num_shards_ isn't
   // 100% correct. The reason behind is for now, PreBuildSampler doesn't offer a way to return num_shards. Once
@@ -58,6 +61,9 @@ Status DistributedSamplerRT::InitSampler() {
     device_id_ < num_devices_ && device_id_ >= 0 && num_rows_ > 0 && num_samples_ > 0,
     "Invalid parameter, num_shard must be greater than shard_id and greater than 0, got num_shard: " +
       std::to_string(num_devices_) + ", shard_id: " + std::to_string(device_id_) + ".\n");
+  CHECK_FAIL_RETURN_UNEXPECTED(block_size_ == 0 || offset_ == -1,
+                               "Invalid parameter, block_size can not be used together with offset, got offset: " +
+                                 std::to_string(offset_) + ".\n");
   rnd_.seed(seed_++);
 
   if (offset_ != -1 || !even_dist_) {
@@ -77,7 +83,9 @@ Status DistributedSamplerRT::InitSampler() {
     samples_per_tensor_ = (num_rows_ + num_devices_ - 1) / num_devices_;  // equals to ceil(num_rows/num_devices)
   }
   samples_per_tensor_ = num_samples_ < samples_per_tensor_ ? num_samples_ : samples_per_tensor_;
-  if (shuffle_) {
+  if (block_size_ > 0) {
+    AssignBlocks();
+  } else if (shuffle_) {
     shuffle_vec_.reserve(num_rows_);
     for (int64_t i = 0; i < num_rows_; i++) {
       shuffle_vec_.push_back(i);
@@ -92,6 +100,51 @@ Status DistributedSamplerRT::InitSampler() {
   return Status::OK();
 }
 
+void DistributedSamplerRT::AssignBlocks() {
+  int64_t num_blocks = (num_rows_ + block_size_ - 1) / block_size_;
+  std::vector<int64_t> block_order(num_blocks);
+  std::iota(block_order.begin(), block_order.end(), 0);
+  // All the shards have the same seed, so they get the same order of blocks.
+  if (shuffle_) {
+    std::shuffle(block_order.begin(), block_order.end(), rnd_);
+  }
+  // Rotate the blocks by the blocks of one shard every epoch, so a shard takes the other blocks in the next epoch.
+  int64_t blocks_per_shard = (num_blocks + num_devices_ - 1) / num_devices_;
+  (void)std::rotate(block_order.begin(), block_order.begin() + (epoch_ * blocks_per_shard) % num_blocks,
+                    block_order.end());
+
+  // The start position of this shard in the rows concatenated by the order of blocks, which is the same as the number
+  // of rows taken by the previous shards.
+  int64_t start;
+  if (even_dist_) {
+    start = device_id_ * ((num_rows_ + num_devices_ - 1) / num_devices_);
+  } else {
+    start = device_id_ * (num_rows_ / num_devices_) + std::min(device_id_, num_rows_ % num_devices_);
+  }
+  start %= num_rows_;
+  auto rows_of_block = [this, num_blocks](int64_t block) {
+    return block == num_blocks - 1 ? num_rows_ - block * block_size_ : block_size_;
+  };
+  size_t index = 0;
+  while (start >= rows_of_block(block_order[index])) {
+    start -= rows_of_block(block_order[index]);
+    ++index;
+  }
+  block_rows_.clear();
+  block_rows_.reserve(samples_per_tensor_);
+  // The rows wrap around to the first block when the shards take more rows than the dataset for even distribution.
+  while (static_cast<int64_t>(block_rows_.size()) < samples_per_tensor_) {
+    int64_t block = block_order[index];
+    int64_t remaining = samples_per_tensor_ - static_cast<int64_t>(block_rows_.size());
+    int64_t end = std::min(rows_of_block(block), start + remaining);
+    for (int64_t row = start; row < end; ++row) {
+      block_rows_.push_back(block * block_size_ + row);
+    }
+    start = 0;
+    index = (index + 1) % block_order.size();
+  }
+}
+
 Status DistributedSamplerRT::GetNextSample(TensorRow *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   if (cnt_ > samples_per_tensor_) {
@@ -124,18 +177,23 @@ Status DistributedSamplerRT::GetNextSample(TensorRow *out) {
     auto id_ptr = sample_ids->begin<int64_t>();
     bool flag_add_1 = false;
     while (cnt_ < samples_per_tensor_ && id_ptr != sample_ids->end<int64_t>()) {
-      int64_t middle_value = num_devices_ * cnt_ + device_id_ - offset_;
-      // if index < 0, we move back one place
-      if (middle_value < 0) {
-        samples_per_tensor_++;
-        cnt_++;
-        flag_add_1 = true;
-        middle_value = num_devices_ * cnt_ + device_id_ - offset_;
-      }
-      int64_t sampled_id = middle_value % num_rows_;
+      int64_t sampled_id;
+      if (block_size_ > 0) {
+        sampled_id = block_rows_[static_cast<size_t>(cnt_)];
+      } else {
+        int64_t middle_value = num_devices_ * cnt_ + device_id_ - offset_;
+        // if index < 0, we move back one place
+        if (middle_value < 0) {
+          samples_per_tensor_++;
+          cnt_++;
+          flag_add_1 = true;
+          middle_value = num_devices_ * cnt_ + device_id_ - offset_;
+        }
+        sampled_id = middle_value % num_rows_;
 
-      if (shuffle_) {
-        sampled_id = shuffle_vec_[static_cast<size_t>(sampled_id)];
+        if (shuffle_) {
+          sampled_id = shuffle_vec_[static_cast<size_t>(sampled_id)];
+        }
       }
 
       if (HasChildSampler()) {
@@ -161,7 +219,14 @@ Status DistributedSamplerRT::ResetSampler() {
   CHECK_FAIL_RETURN_UNEXPECTED(cnt_ == samples_per_tensor_, "[Internal ERROR] Reset() Sampler called early or late.");
   cnt_ = 0;
 
-  if (shuffle_ == true) {
+  if (block_size_ > 0) {
+    epoch_++;
+    if (shuffle_) {
+      rnd_.seed(seed_);
+      seed_++;
+    }
+    AssignBlocks();
+  } else if (shuffle_ == true) {
     rnd_.seed(seed_);
     seed_++;
     std::shuffle(shuffle_vec_.begin(), shuffle_vec_.end(), rnd_);
@@ -210,6 +275,9 @@ void DistributedSamplerRT::SamplerPrint(std::ostream &out, bool show_all) const
     SamplerRT::SamplerPrint(out, show_all);
     out << "\nseed: " << seed_ << "\ndevice_id: " << device_id_ << "\nnum_devices: " << num_devices_
         << "\nshuffle: " << shuffle_;
+    if (block_size_ > 0) {
+      out << "\nblock_size: " << block_size_;
+    }
   }
 }
 
@@ -222,6 +290,9 @@ Status DistributedSamplerRT::to_json(nlohmann::json *out_json) {
   args["shard_id"] = device_id_;
   args["shuffle"] = shuffle_;
   args["offset"] = offset_;
+  if (block_size_ > 0) {
+    args["block_size"] = block_size_;
+  }
   *out_json = args;
   return Status::OK();
 }
@@ -40,9 +40,13 @@ class DistributedSamplerRT : public SamplerRT {
   ///     This option is not exposed in the python API. Current behavior is that the remainder will always
   ///     be handled by the first n shards, n being the corresponding device id. Please notice that when offset is set,
   ///     even_dist will be forcibly converted to false for sending rest datasets in concatdataset scenario.
+  /// \param[in] block_size The number of contiguous rows in a block. If it is greater than 0, each shard takes a
+  ///     contiguous range of blocks instead of the rows by stride, so the reads of a shard are mostly sequential.
+  ///     The blocks are shuffled when shuffle is true and the assignment is rotated by one shard every epoch, while
+  ///     the rows in a block are always in order. 0 means the rows are assigned by stride.
   DistributedSamplerRT(int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples,
                        uint32_t seed = std::numeric_limits<uint32_t>::max(), int64_t offset = -1,
-                       bool even_dist = true);
+                       bool even_dist = true, int64_t block_size = 0);
 
   /// \brief default destructor
   ~DistributedSamplerRT() = default;
@@ -78,6 +82,9 @@ class DistributedSamplerRT : public SamplerRT {
   Status to_json(nlohmann::json *out_json) override;
 
  private:
+  /// \brief Order the blocks of this epoch and take the rows of the range of this shard
+  void AssignBlocks();
+
   int64_t cnt_;  // number of samples that have already been filled in to Tensor
   uint32_t seed_;
   int64_t device_id_;
@@ -88,6 +95,9 @@ class DistributedSamplerRT : public SamplerRT {
   bool even_dist_;
   int64_t offset_;
   bool non_empty_;
+  int64_t block_size_;
+  int64_t epoch_;
+  std::vector<int64_t> block_rows_;  // the rows of this shard in the block mode
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
+
+#include <algorithm>
+#include <memory>
+
+namespace mindspore {
+namespace dataset {
+ShuffleBufferSamplerRT::ShuffleBufferSamplerRT(int32_t shuffle_size, uint32_t shuffle_seed, bool reshuffle_each_epoch,
+                                               int64_t samples_per_tensor)
+    : SamplerRT(0, samples_per_tensor),
+      shuffle_size_(shuffle_size),
+      shuffle_seed_(shuffle_seed),
+      reshuffle_each_epoch_(reshuffle_each_epoch),
+      rng_(shuffle_seed),
+      shuffle_last_idx_(-1),
+      next_input_id_(0),
+      next_id_(0) {}
+
+void ShuffleBufferSamplerRT::InitShuffleBuffer() {
+  shuffle_buffer_.clear();
+  next_input_id_ = 0;
+  while (next_input_id_ < num_samples_ && shuffle_buffer_.size() < static_cast<size_t>(shuffle_size_)) {
+    shuffle_buffer_.push_back(next_input_id_++);
+  }
+  shuffle_last_idx_ = static_cast<int64_t>(shuffle_buffer_.size()) - 1;
+}
+
+int64_t ShuffleBufferSamplerRT::NextShuffledId() {
+  auto random_slot = static_cast<int64_t>(rng_() % static_cast<uint64_t>(shuffle_last_idx_ + 1));
+  int64_t id = shuffle_buffer_[random_slot];
+  shuffle_buffer_[random_slot] = shuffle_buffer_[shuffle_last_idx_];
+  if (next_input_id_ < num_samples_) {
+    // The buffer is full, refill the last slot by the next input id.
+    shuffle_buffer_[shuffle_last_idx_] = next_input_id_++;
+  } else {
+    // Draining the buffer after all input ids are taken.
+    shuffle_last_idx_--;
+  }
+  return id;
+}
+
+Status ShuffleBufferSamplerRT::GetNextSample(TensorRow *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  if (next_id_ > num_samples_) {
+    RETURN_STATUS_UNEXPECTED(
+      "[Internal ERROR] Sampler index must be less than or equal to num_samples(total rows in dataset), but got" +
+      std::to_string(next_id_) + ", num_samplers:" + std::to_string(num_samples_));
+  } else if (next_id_ == num_samples_) {
+    (*out) = TensorRow(TensorRow::kFlagEOE);
+  } else {
+    // The id in the buffer may be from anywhere of the input, so all the child ids are fetched at the epoch beginning.
+    if (HasChildSampler() && next_id_ == 0) {
+      RETURN_IF_NOT_OK(child_[0]->GetNextSample(&child_ids_));
+    }
+
+    std::shared_ptr<Tensor> sampleIds;
+    int64_t last_id = std::min(samples_per_tensor_ + next_id_, num_samples_);
+    RETURN_IF_NOT_OK(CreateSamplerTensor(&sampleIds, last_id - next_id_));
+    auto id_ptr = sampleIds->begin<int64_t>();
+
+    for (int64_t i = 0; i < (last_id - next_id_); i++) {
+      int64_t sampled_id = NextShuffledId();
+      if (HasChildSampler()) {
+        RETURN_IF_NOT_OK(GetAssociatedChildId(&sampled_id, sampled_id));
+      }
+      *(id_ptr + static_cast<ptrdiff_t>(i)) = sampled_id;
+    }
+    next_id_ = last_id;
+    (*out) = {sampleIds};
+  }
+  return Status::OK();
+}
+
+Status ShuffleBufferSamplerRT::InitSampler() {
+  if (is_initialized) {
+    return Status::OK();
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(num_rows_ > 0, "[Internal ERROR] num_rows must be greater than 0, but got num_rows: " +
+                                                std::to_string(num_rows_));
+  CHECK_FAIL_RETURN_UNEXPECTED(shuffle_size_ > 1,
+                               "[Internal ERROR] shuffle_size must be greater than 1, but got shuffle_size: " +
+                                 std::to_string(shuffle_size_));
+  num_samples_ = num_rows_;
+  samples_per_tensor_ = samples_per_tensor_ > num_samples_ ? num_samples_ : samples_per_tensor_;
+  rng_.seed(shuffle_seed_);
+  InitShuffleBuffer();
+
+  is_initialized = true;
+  return Status::OK();
+}
+
+Status ShuffleBufferSamplerRT::ResetSampler() {
+  CHECK_FAIL_RETURN_UNEXPECTED(next_id_ == num_samples_, "[Internal ERROR] Reset() Sampler called early or late.");
+  next_id_ = 0;
+
+  // The same as ShuffleOp, the following epochs keep on using the rng_ if reshuffle_each_epoch is true.
+  if (!reshuffle_each_epoch_) {
+    rng_.seed(shuffle_seed_);
+  }
+  InitShuffleBuffer();
+
+  if (HasChildSampler()) {
+    RETURN_IF_NOT_OK(child_[0]->ResetSampler());
+  }
+
+  return Status::OK();
+}
+
+void ShuffleBufferSamplerRT::SamplerPrint(std::ostream &out, bool show_all) const {
+  out << "\nSampler: ShuffleBufferSampler";
+  if (show_all) {
+    // Call the super class for displaying any common detailed info
+    SamplerRT::SamplerPrint(out, show_all);
+    // Then add our own info
+    out << "\nshuffle_size_: " << shuffle_size_ << "\nshuffle_seed_: " << shuffle_seed_;
+  }
+}
+
+Status ShuffleBufferSamplerRT::to_json(nlohmann::json *out_json) {
+  RETURN_UNEXPECTED_IF_NULL(out_json);
+  nlohmann::json args;
+  RETURN_IF_NOT_OK(SamplerRT::to_json(&args));
+  args["sampler_name"] = "ShuffleBufferSampler";
+  args["shuffle_size"] = shuffle_size_;
+  args["shuffle_seed"] = shuffle_seed_;
+  args["reshuffle_each_epoch"] = reshuffle_each_epoch_;
+
+  *out_json = args;
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
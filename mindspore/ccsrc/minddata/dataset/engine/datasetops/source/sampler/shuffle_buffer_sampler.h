@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "minddata/dataset/engine/datasetops/source/sampler/sampler.h"
+
+namespace mindspore {
+namespace dataset {
+// ShuffleBufferSamplerRT shuffles the ids of its child sampler (or 0 ~ num_rows - 1 if there is no child) in the same
+// way as ShuffleOp shuffles the rows: a buffer of shuffle_size ids is filled from the input, and each output id is
+// picked randomly from the buffer, then the slot is refilled by the next input id. With the same seed it produces the
+// same order as a ShuffleOp above the leaf op, but the buffer only holds the ids rather than the rows, and the leaf op
+// loads the payload of each row lazily when the id is sampled.
+class ShuffleBufferSamplerRT : public SamplerRT {
+ public:
+  // Constructor
+  // @param shuffle_size - The number of ids in the shuffle buffer
+  // @param shuffle_seed - The seed to use for random number generation
+  // @param reshuffle_each_epoch - T/F to reshuffle after epoch, otherwise each epoch uses the same order
+  // @param int64_t samples_per_tensor - Num of Sampler Ids to fetch via 1 GetNextSample call
+  ShuffleBufferSamplerRT(int32_t shuffle_size, uint32_t shuffle_seed, bool reshuffle_each_epoch,
+                         int64_t samples_per_tensor = std::numeric_limits<int64_t>::max());
+
+  // Destructor.
+  ~ShuffleBufferSamplerRT() = default;
+
+  // Op calls this to get next Sample that contains all the sampleIds
+  // @param TensorRow to be returned to corresponding Dataset Op
+  // @return Status The status code returned
+  Status GetNextSample(TensorRow *out) override;
+
+  // meant to be called by base class or python
+  Status InitSampler() override;
+
+  // for next epoch of sampleIds
+  // @return Status The status code returned
+  Status ResetSampler() override;
+
+  void SamplerPrint(std::ostream &out, bool show_all) const override;
+
+  /// \brief Get the arguments of node
+  /// \param[out] out_json JSON string of all attributes
+  /// \return Status of the function
+  Status to_json(nlohmann::json *out_json) override;
+
+ private:
+  // Fill the shuffle buffer with the first ids of the epoch.
+  void InitShuffleBuffer();
+
+  // Pick the next id from the shuffle buffer, and refill the slot by the next input id.
+  int64_t NextShuffledId();
+
+  int32_t shuffle_size_;
+  uint32_t shuffle_seed_;
+  bool reshuffle_each_epoch_;
+  // mt19937_64 and the modulo are the same as ShuffleOp, so that the order is the same as ShuffleOp.
+  std::mt19937_64 rng_;
+  std::vector<int64_t> shuffle_buffer_;  // The ids waiting to be sampled, at most shuffle_size_ ids
+  int64_t shuffle_last_idx_;             // The last valid slot of shuffle_buffer_
+  int64_t next_input_id_;                // The next input id to refill the shuffle buffer
+  int64_t next_id_;                      // The number of ids sampled in the current epoch
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_SAMPLER_SHUFFLE_BUFFER_SAMPLER_H_
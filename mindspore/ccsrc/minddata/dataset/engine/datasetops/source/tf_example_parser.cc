@@ -0,0 +1,380 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
+
+#include <cstring>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// Wire types of protobuf, the deprecated groups are left to protobuf.
+constexpr uint32_t kWireVarint = 0;
+constexpr uint32_t kWireFixed64 = 1;
+constexpr uint32_t kWireLengthDelimited = 2;
+constexpr uint32_t kWireFixed32 = 5;
+constexpr uint32_t kWireTypeBits = 3;
+constexpr uint32_t kWireTypeMask = 7;
+constexpr uint32_t kVarintMaxShift = 64;
+constexpr uint32_t kVarintShift = 7;
+constexpr uint8_t kVarintMore = 0x80;
+constexpr uint8_t kVarintValueMask = 0x7F;
+constexpr size_t kFixed32Size = 4;
+constexpr size_t kFixed64Size = 8;
+constexpr uint32_t kByteBits = 8;
+
+// Field numbers of Example.features, Features.feature, the key and value of the map entry and the list values.
+constexpr uint32_t kFeaturesField = 1;
+constexpr uint32_t kFeatureMapField = 1;
+constexpr uint32_t kMapKeyField = 1;
+constexpr uint32_t kMapValueField = 2;
+constexpr uint32_t kListValueField = 1;
+
+bool ReadVarint(const uint8_t **ptr, const uint8_t *end, uint64_t *value) {
+  uint64_t result = 0;
+  for (uint32_t shift = 0; shift < kVarintMaxShift && *ptr < end; shift += kVarintShift) {
+    uint8_t byte = *((*ptr)++);
+    result |= static_cast<uint64_t>(byte & kVarintValueMask) << shift;
+    if ((byte & kVarintMore) == 0) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ReadTag(const uint8_t **ptr, const uint8_t *end, uint32_t *field, uint32_t *wire_type) {
+  uint64_t tag = 0;
+  if (!ReadVarint(ptr, end, &tag)) {
+    return false;
+  }
+  *field = static_cast<uint32_t>(tag >> kWireTypeBits);
+  *wire_type = static_cast<uint32_t>(tag & kWireTypeMask);
+  return true;
+}
+
+bool ReadLengthDelimited(const uint8_t **ptr, const uint8_t *end, const uint8_t **data, size_t *size) {
+  uint64_t length = 0;
+  if (!ReadVarint(ptr, end, &length) || length > static_cast<uint64_t>(end - *ptr)) {
+    return false;
+  }
+  *data = *ptr;
+  *size = static_cast<size_t>(length);
+  *ptr += length;
+  return true;
+}
+
+bool SkipField(const uint8_t **ptr, const uint8_t *end, uint32_t wire_type) {
+  uint64_t value = 0;
+  const uint8_t *data = nullptr;
+  size_t size = 0;
+  switch (wire_type) {
+    case kWireVarint:
+      return ReadVarint(ptr, end, &value);
+    case kWireFixed64:
+      size = kFixed64Size;
+      break;
+    case kWireLengthDelimited:
+      return ReadLengthDelimited(ptr, end, &data, &size);
+    case kWireFixed32:
+      size = kFixed32Size;
+      break;
+    default:
+      return false;
+  }
+  if (size > static_cast<size_t>(end - *ptr)) {
+    return false;
+  }
+  *ptr += size;
+  return true;
+}
+
+float ReadFixed32Float(const uint8_t *ptr) {
+  uint32_t bits = 0;
+  for (size_t i = 0; i < kFixed32Size; ++i) {
+    bits |= static_cast<uint32_t>(ptr[i]) << (kByteBits * i);
+  }
+  float value = 0;
+  (void)memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+}  // namespace
+
+TFExampleParser::TFExampleParser(const std::vector<std::string> &column_names) {
+  for (size_t i = 0; i < column_names.size(); ++i) {
+    column_ids_[column_names[i]] = i;
+  }
+}
+
+bool TFExampleParser::Parse(const std::string &serialized_example, std::vector<FeatureView> *features) const {
+  if (features == nullptr) {
+    return false;
+  }
+  features->assign(column_ids_.size(), FeatureView());
+  auto ptr = reinterpret_cast<const uint8_t *>(serialized_example.data());
+  auto end = ptr + serialized_example.size();
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field != kFeaturesField || wire_type != kWireLengthDelimited) {
+      if (!SkipField(&ptr, end, wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    // The features may be split into several fields, which are merged like protobuf does.
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    if (!ReadLengthDelimited(&ptr, end, &data, &size) || !ParseFeatures(data, data + size, features)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TFExampleParser::ParseFeatures(const uint8_t *ptr, const uint8_t *end, std::vector<FeatureView> *features) const {
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field != kFeatureMapField || wire_type != kWireLengthDelimited) {
+      if (!SkipField(&ptr, end, wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    if (!ReadLengthDelimited(&ptr, end, &data, &size) || !ParseMapEntry(data, data + size, features)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TFExampleParser::ParseMapEntry(const uint8_t *ptr, const uint8_t *end, std::vector<FeatureView> *features) const {
+  const uint8_t *key = nullptr;
+  size_t key_size = 0;
+  const uint8_t *value = nullptr;
+  size_t value_size = 0;
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field == kMapKeyField && wire_type == kWireLengthDelimited) {
+      if (!ReadLengthDelimited(&ptr, end, &key, &key_size)) {
+        return false;
+      }
+    } else if (field == kMapValueField && wire_type == kWireLengthDelimited) {
+      if (!ReadLengthDelimited(&ptr, end, &value, &value_size)) {
+        return false;
+      }
+    } else if (!SkipField(&ptr, end, wire_type)) {
+      return false;
+    }
+  }
+  std::string key_str = key == nullptr ? std::string() : std::string(reinterpret_cast<const char *>(key), key_size);
+  auto iter = column_ids_.find(key_str);
+  if (iter == column_ids_.end()) {
+    return true;
+  }
+  // The later entry of the same key replaces the former one, the same as protobuf map.
+  FeatureView feature;
+  feature.kind = FeatureKind::kNotSet;
+  if (value != nullptr && !ParseFeature(value, value + value_size, &feature)) {
+    return false;
+  }
+  (*features)[iter->second] = feature;
+  return true;
+}
+
+bool TFExampleParser::ParseFeature(const uint8_t *ptr, const uint8_t *end, FeatureView *feature) {
+  feature->feature = ptr;
+  feature->feature_size = static_cast<size_t>(end - ptr);
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    auto kind = static_cast<FeatureKind>(field);
+    if (kind != FeatureKind::kBytesList && kind != FeatureKind::kFloatList && kind != FeatureKind::kInt64List) {
+      if (!SkipField(&ptr, end, wire_type)) {
+        return false;
+      }
+      continue;
+    }
+    // A list split into several fields has to be merged, leave it to protobuf.
+    if (wire_type != kWireLengthDelimited || feature->kind == kind) {
+      return false;
+    }
+    feature->kind = kind;
+    if (!ReadLengthDelimited(&ptr, end, &feature->list, &feature->list_size)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TFExampleParser::CountInt64List(const FeatureView &feature, int64_t *num_values) {
+  *num_values = 0;
+  const uint8_t *ptr = feature.list;
+  const uint8_t *end = ptr + feature.list_size;
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      if (!ReadLengthDelimited(&ptr, end, &data, &size) || (size > 0 && (data[size - 1] & kVarintMore) != 0)) {
+        return false;
+      }
+      // Each varint ends with a byte without the continuation bit.
+      for (size_t i = 0; i < size; ++i) {
+        *num_values += (data[i] & kVarintMore) == 0 ? 1 : 0;
+      }
+    } else if (field == kListValueField && wire_type == kWireVarint) {
+      uint64_t value = 0;
+      if (!ReadVarint(&ptr, end, &value)) {
+        return false;
+      }
+      ++(*num_values);
+    } else if (!SkipField(&ptr, end, wire_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename T>
+bool TFExampleParser::DecodeInt64List(const FeatureView &feature, T *values, int64_t num_values) {
+  int64_t index = 0;
+  const uint8_t *ptr = feature.list;
+  const uint8_t *end = ptr + feature.list_size;
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    uint64_t value = 0;
+    if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      if (!ReadLengthDelimited(&ptr, end, &data, &size)) {
+        return false;
+      }
+      const uint8_t *data_end = data + size;
+      while (data < data_end) {
+        if (index >= num_values || !ReadVarint(&data, data_end, &value)) {
+          return false;
+        }
+        values[index++] = static_cast<T>(static_cast<int64_t>(value));
+      }
+    } else if (field == kListValueField && wire_type == kWireVarint) {
+      if (index >= num_values || !ReadVarint(&ptr, end, &value)) {
+        return false;
+      }
+      values[index++] = static_cast<T>(static_cast<int64_t>(value));
+    } else if (!SkipField(&ptr, end, wire_type)) {
+      return false;
+    }
+  }
+  return index == num_values;
+}
+
+template bool TFExampleParser::DecodeInt64List<uint64_t>(const FeatureView &, uint64_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<int64_t>(const FeatureView &, int64_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<uint32_t>(const FeatureView &, uint32_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<int32_t>(const FeatureView &, int32_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<uint16_t>(const FeatureView &, uint16_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<int16_t>(const FeatureView &, int16_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<uint8_t>(const FeatureView &, uint8_t *, int64_t);
+template bool TFExampleParser::DecodeInt64List<int8_t>(const FeatureView &, int8_t *, int64_t);
+
+bool TFExampleParser::CountFloatList(const FeatureView &feature, int64_t *num_values) {
+  *num_values = 0;
+  const uint8_t *ptr = feature.list;
+  const uint8_t *end = ptr + feature.list_size;
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      if (!ReadLengthDelimited(&ptr, end, &data, &size) || size % kFixed32Size != 0) {
+        return false;
+      }
+      *num_values += static_cast<int64_t>(size / kFixed32Size);
+    } else if (field == kListValueField && wire_type == kWireFixed32) {
+      if (!SkipField(&ptr, end, wire_type)) {
+        return false;
+      }
+      ++(*num_values);
+    } else if (!SkipField(&ptr, end, wire_type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TFExampleParser::DecodeFloatList(const FeatureView &feature, float *values, int64_t num_values) {
+  int64_t index = 0;
+  const uint8_t *ptr = feature.list;
+  const uint8_t *end = ptr + feature.list_size;
+  while (ptr < end) {
+    uint32_t field = 0;
+    uint32_t wire_type = 0;
+    if (!ReadTag(&ptr, end, &field, &wire_type)) {
+      return false;
+    }
+    if (field == kListValueField && wire_type == kWireLengthDelimited) {
+      const uint8_t *data = nullptr;
+      size_t size = 0;
+      if (!ReadLengthDelimited(&ptr, end, &data, &size) || size % kFixed32Size != 0 ||
+          index + static_cast<int64_t>(size / kFixed32Size) > num_values) {
+        return false;
+      }
+      for (size_t i = 0; i < size; i += kFixed32Size) {
+        values[index++] = ReadFixed32Float(data + i);
+      }
+    } else if (field == kListValueField && wire_type == kWireFixed32) {
+      if (index >= num_values || kFixed32Size > static_cast<size_t>(end - ptr)) {
+        return false;
+      }
+      values[index++] = ReadFixed32Float(ptr);
+      ptr += kFixed32Size;
+    } else if (!SkipField(&ptr, end, wire_type)) {
+      return false;
+    }
+  }
+  return index == num_values;
+}
+}  // namespace dataset
+}  // namespace mindspore
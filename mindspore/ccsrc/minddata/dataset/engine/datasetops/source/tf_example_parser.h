@@ -0,0 +1,78 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mindspore {
+namespace dataset {
+// Scans the wire format of a serialized dataengine::Example once and locates the features of the columns to load.
+// The other features are skipped without being deserialized, and the int64 and float lists are decoded straight
+// into the buffer of the caller, so no protobuf object is built for the hot numeric columns.
+class TFExampleParser {
+ public:
+  // The same numbers as the oneof kind of dataengine::Feature.
+  enum class FeatureKind { kNotFound = -1, kNotSet = 0, kBytesList = 1, kFloatList = 2, kInt64List = 3 };
+
+  // Points into the serialized example, which must outlive the view.
+  struct FeatureView {
+    FeatureKind kind = FeatureKind::kNotFound;
+    const uint8_t *feature = nullptr;  // the serialized dataengine::Feature
+    size_t feature_size = 0;
+    const uint8_t *list = nullptr;  // the serialized BytesList, FloatList or Int64List
+    size_t list_size = 0;
+  };
+
+  explicit TFExampleParser(const std::vector<std::string> &column_names);
+
+  ~TFExampleParser() = default;
+
+  /// Locate the features of the columns in a serialized example.
+  /// @param serialized_example - the serialized dataengine::Example.
+  /// @param features - the feature of each column, in the order of the column names.
+  /// @return bool - false if the example is malformed or uses an encoding which should be left to protobuf.
+  bool Parse(const std::string &serialized_example, std::vector<FeatureView> *features) const;
+
+  /// Count the values of an int64 list, both the packed and the unpacked encodings are accepted.
+  static bool CountInt64List(const FeatureView &feature, int64_t *num_values);
+
+  /// Decode the values of an int64 list and cast them to T.
+  template <typename T>
+  static bool DecodeInt64List(const FeatureView &feature, T *values, int64_t num_values);
+
+  /// Count the values of a float list, both the packed and the unpacked encodings are accepted.
+  static bool CountFloatList(const FeatureView &feature, int64_t *num_values);
+
+  /// Decode the values of a float list.
+  static bool DecodeFloatList(const FeatureView &feature, float *values, int64_t num_values);
+
+ private:
+  bool ParseFeatures(const uint8_t *ptr, const uint8_t *end, std::vector<FeatureView> *features) const;
+
+  bool ParseMapEntry(const uint8_t *ptr, const uint8_t *end, std::vector<FeatureView> *features) const;
+
+  static bool ParseFeature(const uint8_t *ptr, const uint8_t *end, FeatureView *feature);
+
+  std::unordered_map<std::string, size_t> column_ids_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_DATASETOPS_SOURCE_TF_EXAMPLE_PARSER_H_
@@ -41,6 +41,7 @@
 namespace mindspore {
 namespace dataset {
 const int64_t kTFRecordFileLimit = 0x140000000;
+const size_t kParseChunkRows = 256;
 
 std::set<std::string> TFReaderOp::large_files_ = {};
 
@@ -91,6 +92,7 @@ TFReaderOp::TFReaderOp(int32_t num_workers, int32_t worker_connector_size, int64
       dataset_files_list_(std::move(dataset_files_list)),
       columns_to_load_(std::move(columns_to_load)),
       data_schema_(std::move(data_schema)),
+      parse_threads_(1),
       equal_rows_per_shard_(equal_rows_per_shard) {}
 
 // A print method typically used for debugging
@@ -135,6 +137,14 @@ Status TFReaderOp::Init() {
       std::to_string(total_rows_));
   }
 
+  std::vector<std::string> column_names;
+  for (int32_t col = 0; col < data_schema_->NumColumns(); ++col) {
+    column_names.push_back(data_schema_->Column(col).Name());
+  }
+  example_parser_ = std::make_unique<TFExampleParser>(column_names);
+  // One worker loads one file at a time, so the idle workers help to parse the rows when there are fewer files.
+  parse_threads_ = std::max(1, num_workers_ / static_cast<int32_t>(std::max<size_t>(dataset_files_list_.size(), 1)));
+
   // Build the index with our files such that each file corresponds to a key id.
   RETURN_IF_NOT_OK(filename_index_->insert(dataset_files_list_));
 
@@ -295,13 +305,19 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     (void)reader.seekg(0, std::ios::beg);
   }
 
-  int64_t rows_read = 0;
   int64_t rows_total = 0;
+  // Only batch the rows when they are parsed by multi threads, otherwise send each row as soon as it is parsed.
+  size_t chunk_rows = parse_threads_ > 1 ? kParseChunkRows : 1;
+  std::vector<std::string> serialized_examples;
 
   while (reader.peek() != EOF) {
     if (!load_jagged_connector_) {
       break;
     }
+    // the rows after the end offset are not needed
+    if (start_offset != kInvalidOffset && rows_total >= end_offset) {
+      break;
+    }
     RETURN_IF_INTERRUPTED();
 
     // read length
@@ -311,34 +327,178 @@ Status TFReaderOp::LoadFile(const std::string &filename, int64_t start_offset, i
     // ignore crc header
     (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
 
-    // read serialized Example
-    std::string serialized_example;
-    serialized_example.resize(record_length);
-    (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
-
-    int32_t num_columns = data_schema_->NumColumns();
-    TensorRow newRow(num_columns, nullptr);
-
     if (start_offset == kInvalidOffset || (rows_total >= start_offset && rows_total < end_offset)) {
-      dataengine::Example tf_file;
-      if (!tf_file.ParseFromString(serialized_example)) {
-        std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
-        MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
-        RETURN_STATUS_UNEXPECTED(errMsg);
+      // read serialized Example
+      std::string serialized_example;
+      serialized_example.resize(record_length);
+      (void)reader.read(&serialized_example[0], static_cast<std::streamsize>(record_length));
+      serialized_examples.push_back(std::move(serialized_example));
+      if (serialized_examples.size() >= chunk_rows) {
+        RETURN_IF_NOT_OK(LoadChunk(filename, worker_id, &serialized_examples));
       }
-
-      std::vector<std::string> file_path(num_columns, filename);
-      newRow.setPath(file_path);
-      RETURN_IF_NOT_OK(LoadExample(&tf_file, &newRow));
-      rows_read++;
-      RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(newRow)));
+    } else {
+      (void)reader.ignore(static_cast<std::streamsize>(record_length));
     }
 
     // ignore crc footer
     (void)reader.ignore(static_cast<std::streamsize>(sizeof(int32_t)));
     rows_total++;
   }
+  if (!serialized_examples.empty() && load_jagged_connector_) {
+    RETURN_IF_NOT_OK(LoadChunk(filename, worker_id, &serialized_examples));
+  }
+
+  return Status::OK();
+}
+
+Status TFReaderOp::LoadChunk(const std::string &filename, int32_t worker_id,
+                             std::vector<std::string> *serialized_examples) {
+  RETURN_UNEXPECTED_IF_NULL(serialized_examples);
+  int32_t num_columns = data_schema_->NumColumns();
+  size_t num_rows = serialized_examples->size();
+  std::vector<TensorRow> rows(num_rows, TensorRow(num_columns, nullptr));
+  auto parse_rows = [this, &filename, serialized_examples, &rows, num_columns](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      std::vector<std::string> file_path(num_columns, filename);
+      rows[i].setPath(file_path);
+      RETURN_IF_NOT_OK(ParseExample((*serialized_examples)[i], filename, &rows[i]));
+    }
+    return Status::OK();
+  };
+
+  size_t num_threads = std::min(static_cast<size_t>(parse_threads_), num_rows);
+  if (num_threads <= 1) {
+    RETURN_IF_NOT_OK(parse_rows(0, num_rows));
+  } else {
+    size_t rows_per_thread = (num_rows + num_threads - 1) / num_threads;
+    std::vector<std::future<Status>> futures;
+    for (size_t begin = rows_per_thread; begin < num_rows; begin += rows_per_thread) {
+      futures.push_back(std::async(std::launch::async, parse_rows, begin, std::min(num_rows, begin + rows_per_thread)));
+    }
+    Status rc = parse_rows(0, rows_per_thread);
+    for (auto &future : futures) {
+      Status thread_rc = future.get();
+      if (rc.IsOk()) {
+        rc = thread_rc;
+      }
+    }
+    RETURN_IF_NOT_OK(rc);
+  }
+
+  for (auto &row : rows) {
+    RETURN_IF_NOT_OK(jagged_rows_connector_->Add(worker_id, std::move(row)));
+  }
+  serialized_examples->clear();
+  return Status::OK();
+}
 
+Status TFReaderOp::ParseExample(const std::string &serialized_example, const std::string &filename,
+                                TensorRow *out_row) {
+  std::vector<TFExampleParser::FeatureView> features;
+  if (example_parser_ != nullptr && example_parser_->Parse(serialized_example, &features)) {
+    int32_t num_columns = data_schema_->NumColumns();
+    for (int32_t col = 0; col < num_columns; ++col) {
+      RETURN_IF_NOT_OK(LoadFeatureView(out_row, features[col], data_schema_->Column(col), col));
+    }
+    return Status::OK();
+  }
+
+  // The fast parser leaves the malformed rows and the rare encodings to protobuf.
+  dataengine::Example tf_file;
+  if (!tf_file.ParseFromString(serialized_example)) {
+    std::string errMsg = "Failed to parse tfrecord file: " + filename + ", make sure protobuf version is suitable.";
+    MS_LOG(DEBUG) << errMsg + ", details of string: " << serialized_example;
+    RETURN_STATUS_UNEXPECTED(errMsg);
+  }
+  return LoadExample(&tf_file, out_row);
+}
+
+Status TFReaderOp::LoadFeatureView(TensorRow *tensor_row, const TFExampleParser::FeatureView &feature,
+                                   const ColDescriptor &current_col, int32_t col) {
+  std::shared_ptr<Tensor> ts;
+  switch (feature.kind) {
+    case TFExampleParser::FeatureKind::kNotFound: {
+      RETURN_STATUS_UNEXPECTED("Invalid columns_list, column name: " + current_col.Name() +
+                               " does not exist in tfrecord file, check tfrecord files.");
+    }
+    case TFExampleParser::FeatureKind::kBytesList: {
+      // the bytes are copied anyway, just parse this cell by protobuf
+      dataengine::Feature column_values_list;
+      CHECK_FAIL_RETURN_UNEXPECTED(
+        column_values_list.ParseFromArray(feature.feature, static_cast<int>(feature.feature_size)),
+        "Failed to parse tfrecord file, make sure protobuf version is suitable.");
+      return LoadFeature(tensor_row, column_values_list, current_col, col);
+    }
+    case TFExampleParser::FeatureKind::kFloatList: {
+      if (current_col.Type() != DataType::DE_FLOAT32) {
+        std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                              " should be string, but got " + current_col.Type().ToString();
+        RETURN_STATUS_UNEXPECTED(err_msg);
+      }
+      int64_t num_elements = 0;
+      CHECK_FAIL_RETURN_UNEXPECTED(TFExampleParser::CountFloatList(feature, &num_elements),
+                                   "Failed to parse the float list of " + current_col.Name() + " in tfrecord file.");
+      TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+      RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements), &current_shape));
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), &ts));
+      std::string err_msg = "Failed to parse the float list of " + current_col.Name() + " in tfrecord file.";
+      CHECK_FAIL_RETURN_UNEXPECTED(ts->Size() == num_elements, err_msg);
+      if (num_elements > 0) {
+        auto values = ts->begin<float>();
+        CHECK_FAIL_RETURN_UNEXPECTED(TFExampleParser::DecodeFloatList(feature, &(*values), num_elements), err_msg);
+      }
+      break;
+    }
+    case TFExampleParser::FeatureKind::kInt64List: {
+      if (current_col.Type() == DataType::DE_UINT64) {
+        RETURN_IF_NOT_OK(LoadIntListView<uint64_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_INT64) {
+        RETURN_IF_NOT_OK(LoadIntListView<int64_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_UINT32) {
+        RETURN_IF_NOT_OK(LoadIntListView<uint32_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_INT32) {
+        RETURN_IF_NOT_OK(LoadIntListView<int32_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_UINT16) {
+        RETURN_IF_NOT_OK(LoadIntListView<uint16_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_INT16) {
+        RETURN_IF_NOT_OK(LoadIntListView<int16_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_UINT8) {
+        RETURN_IF_NOT_OK(LoadIntListView<uint8_t>(current_col, feature, &ts));
+      } else if (current_col.Type() == DataType::DE_INT8) {
+        RETURN_IF_NOT_OK(LoadIntListView<int8_t>(current_col, feature, &ts));
+      } else {
+        std::string err_msg = "Invalid column type, the column type of " + current_col.Name() +
+                              " should be uint64, int64, uint32, int32, uint16, int16, uint8 or int8, but got " +
+                              current_col.Type().ToString();
+        RETURN_STATUS_UNEXPECTED(err_msg);
+      }
+      break;
+    }
+    default: {
+      std::string err_msg =
+        "Unrecognized datatype, column type in tfrecord file must be uint8, int64 or float32, check tfrecord file.";
+      RETURN_STATUS_UNEXPECTED(err_msg);
+    }
+  }
+
+  (*tensor_row)[col] = std::move(ts);
+  return Status::OK();
+}
+
+template <typename T>
+Status TFReaderOp::LoadIntListView(const ColDescriptor &current_col, const TFExampleParser::FeatureView &feature,
+                                   std::shared_ptr<Tensor> *tensor) {
+  std::string err_msg = "Failed to parse the int list of " + current_col.Name() + " in tfrecord file.";
+  int64_t num_elements = 0;
+  CHECK_FAIL_RETURN_UNEXPECTED(TFExampleParser::CountInt64List(feature, &num_elements), err_msg);
+  TensorShape current_shape = TensorShape::CreateUnknownRankShape();
+  RETURN_IF_NOT_OK(current_col.MaterializeTensorShape(static_cast<int32_t>(num_elements), &current_shape));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(current_shape, current_col.Type(), tensor));
+  CHECK_FAIL_RETURN_UNEXPECTED((*tensor)->Size() == num_elements, err_msg);
+  if (num_elements > 0) {
+    auto values = (*tensor)->begin<T>();
+    CHECK_FAIL_RETURN_UNEXPECTED(TFExampleParser::DecodeInt64List<T>(feature, &(*values), num_elements), err_msg);
+  }
   return Status::OK();
 }
 
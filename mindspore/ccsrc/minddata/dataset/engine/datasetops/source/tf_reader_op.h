@@ -33,6 +33,7 @@
 #include "minddata/dataset/engine/data_schema.h"
 #include "minddata/dataset/engine/datasetops/parallel_op.h"
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
 #include "minddata/dataset/engine/jagged_connector.h"
 
 namespace dataengine {
@@ -121,6 +122,22 @@ class TFReaderOp : public NonMappableLeafOp {
   // @return Status - the error code returned.
   Status LoadExample(const dataengine::Example *tf_file, TensorRow *out_row);
 
+  // Parses a single serialized row and puts the data into a tensor table.
+  // Only the columns to load are decoded, and it falls back to protobuf if the fast parser can not handle the row.
+  // @param serialized_example - the serialized dataengine::Example.
+  // @param filename - the file which the row is read from.
+  // @param out_row - the tensor table to put the parsed data in.
+  // @return Status - the error code returned.
+  Status ParseExample(const std::string &serialized_example, const std::string &filename, TensorRow *out_row);
+
+  // Parses a single cell located by the fast parser and puts the data into a tensor table.
+  // @param tensor_row - the tensor table to put the parsed data in.
+  // @param feature - the cell to parse.
+  // @param current_col - the column descriptor containing the expected shape and type of the data.
+  // @return Status - the error code returned.
+  Status LoadFeatureView(TensorRow *tensor_row, const TFExampleParser::FeatureView &feature,
+                         const ColDescriptor &current_col, int32_t col);
+
   // Parses a single cell and puts the data into a tensor table.
   // @param tensor_table - the tensor table to put the parsed data in.
   // @param column_values_list - the cell to parse.
@@ -157,6 +174,15 @@ class TFReaderOp : public NonMappableLeafOp {
   Status LoadIntList(const ColDescriptor &current_col, const dataengine::Feature &column_values_list,
                      int32_t *num_elements, std::shared_ptr<Tensor> *tensor);
 
+  /// Decodes an int64 list located by the fast parser into a tensor of type T
+  /// @param current_col - the column descriptor containing the expected shape and type of the data.
+  /// @param feature - the cell that contains the int list to read from.
+  /// @param tensor - the tensor we read the values into.
+  /// @return Status - the error code returned.
+  template <typename T>
+  Status LoadIntListView(const ColDescriptor &current_col, const TFExampleParser::FeatureView &feature,
+                         std::shared_ptr<Tensor> *tensor);
+
   /// Determines which template type to use and calls LoadIntList
   /// @param current_col - the column descriptor containing the expected shape and type of the data.
   /// @param column_values_list - the cell that contains the int list to read from.
@@ -194,6 +220,13 @@ class TFReaderOp : public NonMappableLeafOp {
    */
   Status FillIOBlockNoShuffle();
 
+  // Parses a chunk of serialized rows of a file, spread over parse_threads_ threads, and sends them in order.
+  // @param filename - the file which the rows are read from.
+  // @param worker_id - the id of the worker that is executing this function.
+  // @param serialized_examples - the serialized rows, cleared after sent.
+  // @return Status - the error code returned.
+  Status LoadChunk(const std::string &filename, int32_t worker_id, std::vector<std::string> *serialized_examples);
+
   // Calculate number of rows in each shard.
   // @return Status - the error code returned.
   Status CalculateNumRowsPerShard() override;
@@ -205,6 +238,8 @@ class TFReaderOp : public NonMappableLeafOp {
   std::vector<std::string> dataset_files_list_;
   std::vector<std::string> columns_to_load_;
   std::unique_ptr<DataSchema> data_schema_;
+  std::unique_ptr<TFExampleParser> example_parser_;
+  int32_t parse_threads_;
   static std::set<std::string> large_files_;
 
   bool equal_rows_per_shard_;
@@ -19,6 +19,7 @@
 #include <limits>
 #include "minddata/dataset/engine/datasetops/dataset_op.h"
 #include "minddata/dataset/engine/datasetops/device_queue_op.h"
+#include "minddata/dataset/engine/perf/pipeline_trace.h"
 #if defined(ENABLE_GPUQUE) || defined(ENABLE_TDTQUE)
 #include "mindspore/core/utils/numa_interface.h"
 #endif
@@ -64,6 +65,19 @@ ExecutionTree::~ExecutionTree() {
 #endif
 #endif
   (void)tg_->ServiceStop();
+  if (GlobalContext::config_manager()->tensor_pool_size() > 0) {
+    MS_LOG(INFO) << "Tensor pool stats: " << GlobalContext::Instance()->tensor_pool_stats();
+  }
+  if (root_ != nullptr) {
+    for (auto itr = begin(); itr != end(); ++itr) {
+      if (itr->OutputConnector() != nullptr && itr->OutputConnector()->produce_time().Count() > 0) {
+        MS_LOG(INFO) << "Latency of " << itr->OutputConnector()->LatencySummary();
+      }
+    }
+  }
+  if (RowTracer::GetInstance()->enabled() && RowTracer::GetInstance()->Save().IsError()) {
+    MS_LOG(WARNING) << "Failed to save the dataset pipeline trace.";
+  }
 }
 
 // Associates a DatasetOp with this tree. This assigns a valid node id to the operator and
@@ -0,0 +1,226 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/gnn/graph_csr.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
+
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+// The rows of a request are only split to the workers when each worker gets at least so many rows.
+constexpr size_t kMinRowsPerWorker = 256;
+// Floyd's algorithm picks a few samples from a large row without touching the whole row.
+constexpr int32_t kFloydMaxSamples = 64;
+constexpr int32_t kNoNeighbor = -1;
+}  // namespace
+
+Status GraphCsr::Build(const std::unordered_map<NodeIdType, std::shared_ptr<Node>> &node_id_map,
+                       const std::vector<NodeType> &neighbor_types) {
+  node_ids_.clear();
+  node_indexes_.clear();
+  adjacencies_.clear();
+  node_ids_.reserve(node_id_map.size());
+  for (const auto &item : node_id_map) {
+    node_ids_.push_back(item.first);
+  }
+  std::sort(node_ids_.begin(), node_ids_.end());
+  node_indexes_.reserve(node_ids_.size());
+  for (size_t i = 0; i < node_ids_.size(); ++i) {
+    node_indexes_[node_ids_[i]] = static_cast<int32_t>(i);
+  }
+
+  std::vector<NodeIdType> neighbors;
+  std::vector<WeightType> weights;
+  for (const auto &type : neighbor_types) {
+    Adjacency adjacency;
+    adjacency.offsets.reserve(node_ids_.size() + 1);
+    adjacency.offsets.push_back(0);
+    for (const auto &id : node_ids_) {
+      RETURN_IF_NOT_OK(node_id_map.at(id)->GetAllNeighborsWithWeight(type, &neighbors, &weights));
+      CHECK_FAIL_RETURN_UNEXPECTED(neighbors.size() == weights.size(),
+                                   "The number of neighbors does not match the weight.");
+      double cum_weight = 0;
+      for (size_t i = 0; i < neighbors.size(); ++i) {
+        auto itr = node_indexes_.find(neighbors[i]);
+        CHECK_FAIL_RETURN_UNEXPECTED(itr != node_indexes_.end(), "Invalid node id:" + std::to_string(neighbors[i]));
+        adjacency.neighbors.push_back(itr->second);
+        cum_weight += weights[i];
+        adjacency.cum_weights.push_back(cum_weight);
+      }
+      adjacency.offsets.push_back(static_cast<int64_t>(adjacency.neighbors.size()));
+    }
+    adjacencies_[type] = std::move(adjacency);
+  }
+  MS_LOG(INFO) << "Build the neighbors of " << node_ids_.size() << " nodes in CSR layout for "
+               << neighbor_types.size() << " neighbor types.";
+  return Status::OK();
+}
+
+void GraphCsr::SampleNode(const Adjacency &adjacency, int32_t index, int32_t samples_num, SamplingStrategy strategy,
+                          std::mt19937 *rnd, std::vector<int32_t> *scratch, int32_t *out) const {
+  int64_t begin = index < 0 ? 0 : adjacency.offsets[index];
+  int64_t degree = index < 0 ? 0 : adjacency.offsets[index + 1] - begin;
+  if (degree == 0) {
+    // If there are no neighbors, they are filled with kDefaultNodeId
+    std::fill(out, out + samples_num, kNoNeighbor);
+    return;
+  }
+  const int32_t *neighbors = adjacency.neighbors.data() + begin;
+  if (strategy == SamplingStrategy::kEdgeWeight) {
+    const double *cum_weights = adjacency.cum_weights.data() + begin;
+    double total_weight = cum_weights[degree - 1];
+    std::uniform_real_distribution<double> weight_dist(0, total_weight);
+    std::uniform_int_distribution<int64_t> uniform_dist(0, degree - 1);
+    for (int32_t i = 0; i < samples_num; ++i) {
+      int64_t pos = 0;
+      if (total_weight > 0) {
+        pos = std::upper_bound(cum_weights, cum_weights + degree, weight_dist(*rnd)) - cum_weights;
+        pos = std::min(pos, degree - 1);
+      } else {
+        pos = uniform_dist(*rnd);
+      }
+      out[i] = neighbors[pos];
+    }
+    return;
+  }
+  // The same as LocalNode, every round takes the neighbors without replacement until enough are taken.
+  for (int32_t taken = 0; taken < samples_num;) {
+    auto num = static_cast<int32_t>(std::min<int64_t>(samples_num - taken, degree));
+    int32_t *round = out + taken;
+    if (num == degree) {
+      std::copy(neighbors, neighbors + degree, round);
+    } else if (num <= kFloydMaxSamples) {
+      // The positions are picked, since a node may be the neighbor more than once.
+      scratch->clear();
+      for (int64_t j = degree - num; j < degree; ++j) {
+        auto pos = static_cast<int32_t>(std::uniform_int_distribution<int64_t>(0, j)(*rnd));
+        if (std::find(scratch->begin(), scratch->end(), pos) != scratch->end()) {
+          pos = static_cast<int32_t>(j);
+        }
+        scratch->push_back(pos);
+      }
+      for (int32_t k = 0; k < num; ++k) {
+        round[k] = neighbors[(*scratch)[k]];
+      }
+    } else {
+      scratch->assign(neighbors, neighbors + degree);
+      for (int32_t k = 0; k < num; ++k) {
+        auto pos = std::uniform_int_distribution<int64_t>(k, degree - 1)(*rnd);
+        std::swap((*scratch)[k], (*scratch)[pos]);
+      }
+      std::copy(scratch->begin(), scratch->begin() + num, round);
+    }
+    std::shuffle(round, round + num, *rnd);
+    taken += num;
+  }
+}
+
+Status GraphCsr::SampleRows(const std::vector<int32_t> &indexes, const std::vector<NodeIdType> &neighbor_nums,
+                            const std::vector<const Adjacency *> &adjacencies, SamplingStrategy strategy,
+                            size_t begin, size_t end, uint32_t seed, NodeIdType *out) const {
+  std::mt19937 rnd(seed);
+  size_t width = 1;
+  size_t hop_width = 1;
+  for (const auto &num : neighbor_nums) {
+    hop_width *= static_cast<size_t>(num);
+    width += hop_width;
+  }
+  std::vector<int32_t> inputs;
+  std::vector<int32_t> outputs;
+  std::vector<int32_t> scratch;
+  for (size_t row = begin; row < end; ++row) {
+    NodeIdType *out_row = out + row * width;
+    *out_row++ = node_ids_[indexes[row]];
+    inputs.assign(1, indexes[row]);
+    for (size_t hop = 0; hop < neighbor_nums.size(); ++hop) {
+      auto samples_num = neighbor_nums[hop];
+      outputs.resize(inputs.size() * samples_num);
+      for (size_t i = 0; i < inputs.size(); ++i) {
+        SampleNode(*adjacencies[hop], inputs[i], samples_num, strategy, &rnd, &scratch,
+                   outputs.data() + i * samples_num);
+      }
+      for (const auto &index : outputs) {
+        *out_row++ = index == kNoNeighbor ? kDefaultNodeId : node_ids_[index];
+      }
+      inputs.swap(outputs);
+    }
+  }
+  return Status::OK();
+}
+
+Status GraphCsr::SampleNeighbors(const std::vector<NodeIdType> &node_list, const std::vector<NodeIdType> &neighbor_nums,
+                                 const std::vector<NodeType> &neighbor_types, SamplingStrategy strategy,
+                                 int32_t num_workers, std::mt19937 *rnd, std::shared_ptr<Tensor> *out) const {
+  RETURN_UNEXPECTED_IF_NULL(rnd);
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(strategy == SamplingStrategy::kRandom || strategy == SamplingStrategy::kEdgeWeight,
+                               "Invalid strategy");
+  std::vector<int32_t> indexes(node_list.size());
+  for (size_t i = 0; i < node_list.size(); ++i) {
+    auto itr = node_indexes_.find(node_list[i]);
+    CHECK_FAIL_RETURN_UNEXPECTED(itr != node_indexes_.end(), "Invalid node id:" + std::to_string(node_list[i]));
+    indexes[i] = itr->second;
+  }
+  std::vector<const Adjacency *> adjacencies;
+  for (const auto &type : neighbor_types) {
+    auto itr = adjacencies_.find(type);
+    CHECK_FAIL_RETURN_UNEXPECTED(itr != adjacencies_.end(), "Invalid neighbor type:" + std::to_string(type));
+    adjacencies.push_back(&itr->second);
+  }
+  dsize_t width = 1;
+  dsize_t hop_width = 1;
+  for (const auto &num : neighbor_nums) {
+    hop_width *= num;
+    width += hop_width;
+  }
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape({static_cast<dsize_t>(node_list.size()), width}),
+                                       DataType(DataType::DE_INT32), out));
+  NodeIdType *data = &(*(*out)->begin<NodeIdType>());
+  RETURN_UNEXPECTED_IF_NULL(data);
+
+  // Each worker takes a contiguous block of rows and its own random generator seeded by the graph.
+  size_t num_rows = node_list.size();
+  size_t num_tasks = std::max<size_t>(1, std::min<size_t>(num_workers, num_rows / kMinRowsPerWorker));
+  size_t rows_per_task = (num_rows + num_tasks - 1) / num_tasks;
+  std::vector<uint32_t> seeds(num_tasks);
+  for (auto &seed : seeds) {
+    seed = (*rnd)();
+  }
+  if (num_tasks == 1) {
+    return SampleRows(indexes, neighbor_nums, adjacencies, strategy, 0, num_rows, seeds[0], data);
+  }
+  TaskGroup vg;
+  for (size_t task = 0; task < num_tasks; ++task) {
+    size_t begin = task * rows_per_task;
+    size_t end = std::min(num_rows, begin + rows_per_task);
+    RETURN_IF_NOT_OK(vg.CreateAsyncTask("GraphCsrSampler", [&, begin, end, task]() {
+      TaskManager::FindMe()->Post();
+      return SampleRows(indexes, neighbor_nums, adjacencies, strategy, begin, end, seeds[task], data);
+    }));
+  }
+  RETURN_IF_NOT_OK(vg.join_all(Task::WaitFlag::kBlocking));
+  return vg.GetTaskErrorIfAny();
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
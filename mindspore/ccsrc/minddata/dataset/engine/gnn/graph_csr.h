@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/include/dataset/constants.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+// The neighbors of all the nodes in the compressed sparse row layout, one adjacency per neighbor type. The node ids
+// are mapped to the dense indexes once per request, and every hop of the sampling only reads the flat arrays, instead
+// of looking up the LocalNode objects in the hash map. The arrays are contiguous, so they can be copied to the shared
+// memory as they are.
+class GraphCsr {
+ public:
+  GraphCsr() = default;
+
+  ~GraphCsr() = default;
+
+  // Build the adjacencies from the loaded nodes
+  // @param std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map - All the nodes of the graph
+  // @param std::vector<NodeType> neighbor_types - All the node types, which are also the neighbor types
+  // @return Status The status code returned
+  Status Build(const std::unordered_map<NodeIdType, std::shared_ptr<Node>> &node_id_map,
+               const std::vector<NodeType> &neighbor_types);
+
+  // @return bool - Whether the adjacencies are built
+  bool built() const { return !node_ids_.empty(); }
+
+  // Sample the neighbors of a batch of nodes hop by hop, the rows are split to the workers
+  // @param std::vector<NodeIdType> node_list - List of nodes
+  // @param std::vector<NodeIdType> neighbor_nums - Number of neighbors sampled per hop
+  // @param std::vector<NodeType> neighbor_types - Neighbor type sampled per hop
+  // @param SamplingStrategy strategy - Sampling strategy
+  // @param int32_t num_workers - Number of the worker threads
+  // @param std::mt19937 *rnd - The random generator to seed the workers
+  // @param std::shared_ptr<Tensor> *out - Returned neighbor's id, one row per node
+  // @return Status The status code returned
+  Status SampleNeighbors(const std::vector<NodeIdType> &node_list, const std::vector<NodeIdType> &neighbor_nums,
+                         const std::vector<NodeType> &neighbor_types, SamplingStrategy strategy, int32_t num_workers,
+                         std::mt19937 *rnd, std::shared_ptr<Tensor> *out) const;
+
+ private:
+  struct Adjacency {
+    std::vector<int64_t> offsets;     // The row offsets, of size num_nodes + 1
+    std::vector<int32_t> neighbors;   // The dense indexes of the neighbors
+    std::vector<double> cum_weights;  // The inclusive prefix sums of the edge weights in each row
+  };
+
+  // Sample the rows [begin, end) of the output
+  Status SampleRows(const std::vector<int32_t> &indexes, const std::vector<NodeIdType> &neighbor_nums,
+                    const std::vector<const Adjacency *> &adjacencies, SamplingStrategy strategy, size_t begin,
+                    size_t end, uint32_t seed, NodeIdType *out) const;
+
+  // Sample samples_num neighbors of one node, the index of the missing neighbor is -1
+  void SampleNode(const Adjacency &adjacency, int32_t index, int32_t samples_num, SamplingStrategy strategy,
+                  std::mt19937 *rnd, std::vector<int32_t> *scratch, int32_t *out) const;
+
+  std::unordered_map<NodeIdType, int32_t> node_indexes_;
+  std::vector<NodeIdType> node_ids_;
+  std::unordered_map<NodeType, Adjacency> adjacencies_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
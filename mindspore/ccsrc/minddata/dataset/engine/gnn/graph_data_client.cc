@@ -18,6 +18,7 @@
 #include <unistd.h>
 #include <functional>
 #include <map>
+#include <unordered_set>
 
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "grpcpp/grpcpp.h"
@@ -27,10 +28,27 @@
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/tensor_proto.h"
 #endif
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace dataset {
 namespace gnn {
+#if !defined(_WIN32) && !defined(_WIN64)
+namespace {
+// Set it to true to send the requests of graph data through one stream instead of one rpc per request.
+constexpr char kGraphDataStreamEnv[] = "MS_DEV_GNN_CLIENT_STREAM";
+// The max number of nodes whose feature address are cached for each feature type.
+constexpr size_t kMaxCachedFeatureNodes = 1 << 20;
+
+// The ids are sent as the raw int32 bytes of id_tensor instead of the varint encoded repeated id.
+void SetRequestIds(const std::vector<int32_t> &ids, GnnGraphDataRequestPb *request) {
+  TensorPb *id_tensor = request->mutable_id_tensor();
+  id_tensor->add_dims(static_cast<google::protobuf::int64>(ids.size()));
+  id_tensor->set_tensor_type(DataTypePb::DE_PB_INT32);
+  id_tensor->set_data(ids.data(), ids.size() * sizeof(int32_t));
+}
+}  // namespace
+#endif
 
 GraphDataClient::GraphDataClient(const std::string &dataset_file, const std::string &hostname, int32_t port)
     : dataset_file_(dataset_file),
@@ -42,6 +60,8 @@ GraphDataClient::GraphDataClient(const std::string &dataset_file, const std::str
       shared_memory_size_(0),
       graph_feature_parser_(nullptr),
       graph_shared_memory_(nullptr),
+      stream_request_cnt_(0),
+      stream_broken_(false),
 #endif
       registered_(false) {
 }
@@ -70,6 +90,9 @@ Status GraphDataClient::Init() {
     }
     RETURN_IF_NOT_OK(status);
     MS_LOG(INFO) << "Graph data client successfully registered with server " << server_address;
+    if (common::GetEnv(kGraphDataStreamEnv) == "true") {
+      RETURN_IF_NOT_OK(OpenGraphDataStream());
+    }
   }
   RETURN_IF_NOT_OK(InitFeatureParser());
   return Status::OK();
@@ -78,6 +101,7 @@ Status GraphDataClient::Init() {
 
 Status GraphDataClient::Stop() {
 #if !defined(_WIN32) && !defined(_WIN64)
+  RETURN_IF_NOT_OK(CloseGraphDataStream());
   if (registered_) {
     RETURN_IF_NOT_OK(UnRegisterToServer());
   }
@@ -94,7 +118,7 @@ Status GraphDataClient::GetAllNodes(NodeType node_type, std::shared_ptr<Tensor>
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_ALL_NODES);
   request.add_type(static_cast<google::protobuf::int32>(node_type));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -108,7 +132,7 @@ Status GraphDataClient::GetAllEdges(EdgeType edge_type, std::shared_ptr<Tensor>
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_ALL_EDGES);
   request.add_type(static_cast<google::protobuf::int32>(edge_type));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -121,10 +145,8 @@ Status GraphDataClient::GetNodesFromEdges(const std::vector<EdgeIdType> &edge_li
   GnnGraphDataRequestPb request;
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_NODES_FROM_EDGES);
-  for (const auto &edge_id : edge_list) {
-    request.add_id(static_cast<google::protobuf::int32>(edge_id));
-  }
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  SetRequestIds(edge_list, &request);
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -146,7 +168,7 @@ Status GraphDataClient::GetEdgesFromNodes(const std::vector<std::pair<NodeIdType
     proto_pair->set_dst_id(static_cast<google::protobuf::int32>(pair_node_id.second));
   }
 
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -160,12 +182,10 @@ Status GraphDataClient::GetAllNeighbors(const std::vector<NodeIdType> &node_list
   GnnGraphDataRequestPb request;
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_ALL_NEIGHBORS);
-  for (const auto &node_id : node_list) {
-    request.add_id(static_cast<google::protobuf::int32>(node_id));
-  }
+  SetRequestIds(node_list, &request);
   request.add_type(static_cast<google::protobuf::int32>(neighbor_type));
   request.set_format(static_cast<google::protobuf::int32>(format));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -181,9 +201,7 @@ Status GraphDataClient::GetSampledNeighbors(const std::vector<NodeIdType> &node_
   GnnGraphDataRequestPb request;
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_SAMPLED_NEIGHBORS);
-  for (const auto &node_id : node_list) {
-    request.add_id(static_cast<google::protobuf::int32>(node_id));
-  }
+  SetRequestIds(node_list, &request);
   for (const auto &num : neighbor_nums) {
     request.add_number(static_cast<google::protobuf::int32>(num));
   }
@@ -191,7 +209,7 @@ Status GraphDataClient::GetSampledNeighbors(const std::vector<NodeIdType> &node_
     request.add_type(static_cast<google::protobuf::int32>(type));
   }
   request.set_strategy(static_cast<google::protobuf::int32>(strategy));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -205,12 +223,10 @@ Status GraphDataClient::GetNegSampledNeighbors(const std::vector<NodeIdType> &no
   GnnGraphDataRequestPb request;
   GnnGraphDataResponsePb response;
   request.set_op_name(GET_NEG_SAMPLED_NEIGHBORS);
-  for (const auto &node_id : node_list) {
-    request.add_id(static_cast<google::protobuf::int32>(node_id));
-  }
+  SetRequestIds(node_list, &request);
   request.add_number(static_cast<google::protobuf::int32>(samples_num));
   request.add_type(static_cast<google::protobuf::int32>(neg_neighbor_type));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -226,9 +242,7 @@ Status GraphDataClient::GraphDataClient::RandomWalk(const std::vector<NodeIdType
   GnnGraphDataRequestPb request;
   GnnGraphDataResponsePb response;
   request.set_op_name(RANDOM_WALK);
-  for (const auto &node_id : node_list) {
-    request.add_id(static_cast<google::protobuf::int32>(node_id));
-  }
+  SetRequestIds(node_list, &request);
   for (const auto &type : meta_path) {
     request.add_type(static_cast<google::protobuf::int32>(type));
   }
@@ -236,7 +250,7 @@ Status GraphDataClient::GraphDataClient::RandomWalk(const std::vector<NodeIdType
   walk_param->set_p(step_home_param);
   walk_param->set_q(step_away_param);
   walk_param->set_default_id(static_cast<google::protobuf::int32>(default_node));
-  RETURN_IF_NOT_OK(GetGraphDataTensor(request, &response, out));
+  RETURN_IF_NOT_OK(GetGraphDataTensor(&request, &response, out));
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
 #endif
@@ -252,28 +266,12 @@ Status GraphDataClient::GetNodeFeature(const std::shared_ptr<Tensor> &nodes,
   }
   CHECK_FAIL_RETURN_UNEXPECTED(!feature_types.empty(), "Input feature_types is empty");
 
-  GnnGraphDataRequestPb request;
-  GnnGraphDataResponsePb response;
-  request.set_op_name(GET_NODE_FEATURE);
-  for (const auto &type : feature_types) {
-    request.add_type(static_cast<google::protobuf::int32>(type));
-  }
-  RETURN_IF_NOT_OK(TensorToPb(nodes, request.mutable_id_tensor()));
-  RETURN_IF_NOT_OK(GetGraphData(request, &response));
-  CHECK_FAIL_RETURN_UNEXPECTED(feature_types.size() == response.result_data().size(),
-                               "The number of feature types returned by the server is wrong");
-  if (response.result_data().size() > 0) {
-    size_t i = 0;
-    for (const auto &result : response.result_data()) {
-      std::shared_ptr<Tensor> tensor;
-      RETURN_IF_NOT_OK(PbToTensor(&result, &tensor));
-      std::shared_ptr<Tensor> fea_tensor;
-      RETURN_IF_NOT_OK(ParseNodeFeatureFromMemory(nodes, feature_types[i], tensor, &fea_tensor));
-      out->emplace_back(std::move(fea_tensor));
-      ++i;
-    }
-  } else {
-    RETURN_STATUS_UNEXPECTED("RPC failed: The number of returned tensor is abnormal");
+  std::vector<std::shared_ptr<Tensor>> address_tensors;
+  RETURN_IF_NOT_OK(GetNodeFeatureAddress(nodes, feature_types, &address_tensors));
+  for (size_t i = 0; i < feature_types.size(); ++i) {
+    std::shared_ptr<Tensor> fea_tensor;
+    RETURN_IF_NOT_OK(ParseNodeFeatureFromMemory(nodes, feature_types[i], address_tensors[i], &fea_tensor));
+    out->emplace_back(std::move(fea_tensor));
   }
 #else
   RETURN_STATUS_UNEXPECTED("This operation is not supported in Windows OS.");
@@ -297,7 +295,7 @@ Status GraphDataClient::GetEdgeFeature(const std::shared_ptr<Tensor> &edges,
     request.add_type(static_cast<google::protobuf::int32>(type));
   }
   RETURN_IF_NOT_OK(TensorToPb(edges, request.mutable_id_tensor()));
-  RETURN_IF_NOT_OK(GetGraphData(request, &response));
+  RETURN_IF_NOT_OK(GetGraphData(&request, &response));
   CHECK_FAIL_RETURN_UNEXPECTED(feature_types.size() == response.result_data().size(),
                                "The number of feature types returned by the server is wrong");
   if (response.result_data().size() > 0) {
@@ -402,8 +400,11 @@ Status GraphDataClient::GraphInfo(py::dict *out) {
 }
 
 #if !defined(_WIN32) && !defined(_WIN64)
-Status GraphDataClient::GetGraphData(const GnnGraphDataRequestPb &request, GnnGraphDataResponsePb *response) {
+Status GraphDataClient::GetGraphData(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response) {
   RETURN_IF_NOT_OK(CheckPid());
+  if (stream_ != nullptr) {
+    return GetGraphDataByStream(request, response);
+  }
   void *tag;
   bool ok;
   grpc::Status status;
@@ -413,7 +414,7 @@ Status GraphDataClient::GetGraphData(const GnnGraphDataRequestPb &request, GnnGr
   auto deadline = std::chrono::system_clock::now() + std::chrono::seconds(60);
   ctx.set_deadline(deadline);
   std::unique_ptr<grpc::ClientAsyncResponseReader<GnnGraphDataResponsePb>> rpc(
-    stub_->PrepareAsyncGetGraphData(&ctx, request, &cq));
+    stub_->PrepareAsyncGetGraphData(&ctx, *request, &cq));
   rpc->StartCall();
   rpc->Finish(response, &status, response);
 
@@ -437,7 +438,7 @@ Status GraphDataClient::GetGraphData(const GnnGraphDataRequestPb &request, GnnGr
   return Status::OK();
 }
 
-Status GraphDataClient::GetGraphDataTensor(const GnnGraphDataRequestPb &request, GnnGraphDataResponsePb *response,
+Status GraphDataClient::GetGraphDataTensor(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response,
                                            std::shared_ptr<Tensor> *out) {
   RETURN_IF_NOT_OK(GetGraphData(request, response));
   if (1 == response->result_data().size()) {
@@ -451,6 +452,186 @@ Status GraphDataClient::GetGraphDataTensor(const GnnGraphDataRequestPb &request,
   return Status::OK();
 }
 
+Status GraphDataClient::GetGraphDataByStream(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response) {
+  auto stream_request = std::make_shared<StreamRequest>();
+  int64_t request_id;
+  {
+    std::unique_lock<std::mutex> lck(stream_mutex_);
+    CHECK_FAIL_RETURN_UNEXPECTED(!stream_broken_, "The stream to the graph data server is closed.");
+    request_id = stream_request_cnt_++;
+    (void)stream_requests_.emplace(request_id, stream_request);
+  }
+  request->set_request_id(static_cast<google::protobuf::int64>(request_id));
+  bool write_success;
+  {
+    std::unique_lock<std::mutex> lck(stream_write_mutex_);
+    write_success = stream_->Write(*request);
+  }
+  if (!write_success) {
+    std::unique_lock<std::mutex> lck(stream_mutex_);
+    // The reader may have failed the request already when the stream is broken.
+    if (stream_requests_.erase(request_id) > 0) {
+      RETURN_STATUS_ERROR(StatusCode::kMDNetWorkError, "Failed to send the request to the graph data server.");
+    }
+  }
+
+  {
+    py::gil_scoped_release gil_release;
+    RETURN_IF_NOT_OK(stream_request->wp_.Wait());
+  }
+  RETURN_IF_NOT_OK(stream_request->rc_);
+  response->Swap(&stream_request->response_);
+  if (response->error_msg() != "Success") {
+    RETURN_STATUS_UNEXPECTED(response->error_msg());
+  }
+  return Status::OK();
+}
+
+Status GraphDataClient::OpenGraphDataStream() {
+  stream_ctx_ = std::make_unique<grpc::ClientContext>();
+  stream_ = stub_->GetGraphDataStream(stream_ctx_.get());
+  CHECK_FAIL_RETURN_UNEXPECTED(stream_ != nullptr, "Failed to open the stream to the graph data server.");
+  stream_broken_ = false;
+  stream_tg_ = std::make_unique<TaskGroup>();
+  RETURN_IF_NOT_OK(stream_tg_->CreateAsyncTask("graph data stream reader",
+                                               std::bind(&GraphDataClient::StreamReaderEntry, this)));
+  MS_LOG(INFO) << "Graph data client sends the requests through the stream.";
+  return Status::OK();
+}
+
+Status GraphDataClient::CloseGraphDataStream() {
+  if (stream_ == nullptr) {
+    return Status::OK();
+  }
+  {
+    std::unique_lock<std::mutex> lck(stream_write_mutex_);
+    (void)stream_->WritesDone();
+  }
+  // The reader exits after the server replies all the requests and finishes the stream.
+  RETURN_IF_NOT_OK(stream_tg_->join_all(Task::WaitFlag::kBlocking));
+  grpc::Status status = stream_->Finish();
+  stream_.reset();
+  stream_ctx_.reset();
+  stream_tg_.reset();
+  if (!status.ok()) {
+    MS_LOG(WARNING) << "The stream to the graph data server is finished with error: " << status.error_message()
+                    << ". GRPC Code " << std::to_string(status.error_code());
+  }
+  return Status::OK();
+}
+
+Status GraphDataClient::StreamReaderEntry() {
+  TaskManager::FindMe()->Post();
+  GnnGraphDataResponsePb response;
+  while (stream_->Read(&response)) {
+    std::shared_ptr<StreamRequest> stream_request;
+    {
+      std::unique_lock<std::mutex> lck(stream_mutex_);
+      auto itr = stream_requests_.find(response.request_id());
+      if (itr == stream_requests_.end()) {
+        MS_LOG(WARNING) << "Unknown request id of the reply: " << response.request_id();
+        continue;
+      }
+      stream_request = std::move(itr->second);
+      (void)stream_requests_.erase(itr);
+    }
+    stream_request->response_.Swap(&response);
+    stream_request->wp_.Set();
+    response.Clear();
+  }
+  // The stream is closed, fail all the requests still waiting for the replies.
+  std::unique_lock<std::mutex> lck(stream_mutex_);
+  stream_broken_ = true;
+  for (auto &item : stream_requests_) {
+    item.second->rc_ = STATUS_ERROR(StatusCode::kMDNetWorkError, "The stream to the graph data server is closed.");
+    item.second->wp_.Set();
+  }
+  stream_requests_.clear();
+  return Status::OK();
+}
+
+Status GraphDataClient::GetNodeFeatureAddress(const std::shared_ptr<Tensor> &nodes,
+                                              const std::vector<FeatureType> &feature_types,
+                                              std::vector<std::shared_ptr<Tensor>> *out) {
+  // Find the nodes whose feature address of any type is not cached, each of them is requested only once.
+  std::vector<NodeIdType> missing_nodes;
+  {
+    std::unique_lock<std::mutex> lck(feature_cache_mutex_);
+    std::unordered_set<NodeIdType> missing_set;
+    for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
+      if (*node_itr == kDefaultNodeId || missing_set.count(*node_itr) > 0) {
+        continue;
+      }
+      for (const auto &type : feature_types) {
+        auto &cache = node_feature_cache_[type];
+        if (cache.find(*node_itr) == cache.end()) {
+          (void)missing_set.insert(*node_itr);
+          missing_nodes.push_back(*node_itr);
+          break;
+        }
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<Tensor>> missing_address;
+  std::unordered_map<NodeIdType, size_t> missing_index;
+  if (!missing_nodes.empty()) {
+    GnnGraphDataRequestPb request;
+    GnnGraphDataResponsePb response;
+    request.set_op_name(GET_NODE_FEATURE);
+    for (const auto &type : feature_types) {
+      request.add_type(static_cast<google::protobuf::int32>(type));
+    }
+    SetRequestIds(missing_nodes, &request);
+    RETURN_IF_NOT_OK(GetGraphData(&request, &response));
+    CHECK_FAIL_RETURN_UNEXPECTED(feature_types.size() == response.result_data().size(),
+                                 "The number of feature types returned by the server is wrong");
+    for (const auto &result : response.result_data()) {
+      std::shared_ptr<Tensor> tensor;
+      RETURN_IF_NOT_OK(PbToTensor(&result, &tensor));
+      CHECK_FAIL_RETURN_UNEXPECTED(tensor->Size() == static_cast<dsize_t>(missing_nodes.size() * 2),
+                                   "RPC failed: The size of returned feature address is abnormal");
+      missing_address.push_back(std::move(tensor));
+    }
+    for (size_t i = 0; i < missing_nodes.size(); ++i) {
+      missing_index[missing_nodes[i]] = i;
+    }
+  }
+
+  std::unique_lock<std::mutex> lck(feature_cache_mutex_);
+  for (size_t i = 0; i < feature_types.size(); ++i) {
+    auto &cache = node_feature_cache_[feature_types[i]];
+    const int64_t *missing_data = missing_address.empty() ? nullptr : &(*missing_address[i]->begin<int64_t>());
+    // The cache stops growing when it is full, the cached entries are never evicted.
+    if (missing_data != nullptr && cache.size() + missing_nodes.size() <= kMaxCachedFeatureNodes) {
+      for (size_t j = 0; j < missing_nodes.size(); ++j) {
+        cache[missing_nodes[j]] = std::make_pair(missing_data[j * 2], missing_data[j * 2 + 1]);
+      }
+    }
+    std::shared_ptr<Tensor> address_tensor;
+    RETURN_IF_NOT_OK(
+      Tensor::CreateEmpty(nodes->shape().AppendDim(2), DataType(DataType::DE_INT64), &address_tensor));
+    auto address_itr = address_tensor->begin<int64_t>();
+    for (auto node_itr = nodes->begin<NodeIdType>(); node_itr != nodes->end<NodeIdType>(); ++node_itr) {
+      std::pair<int64_t, int64_t> address(-1, -1);
+      if (*node_itr != kDefaultNodeId) {
+        auto index_itr = missing_index.find(*node_itr);
+        if (index_itr != missing_index.end()) {
+          address = std::make_pair(missing_data[index_itr->second * 2], missing_data[index_itr->second * 2 + 1]);
+        } else {
+          address = cache.at(*node_itr);
+        }
+      }
+      *address_itr = address.first;
+      ++address_itr;
+      *address_itr = address.second;
+      ++address_itr;
+    }
+    out->push_back(std::move(address_tensor));
+  }
+  return Status::OK();
+}
+
 Status GraphDataClient::ParseNodeFeatureFromMemory(const std::shared_ptr<Tensor> &nodes, FeatureType feature_type,
                                                    const std::shared_ptr<Tensor> &memory_tensor,
                                                    std::shared_ptr<Tensor> *out) {
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -33,6 +34,8 @@
 #include "minddata/dataset/engine/gnn/graph_feature_parser.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
+#include "minddata/dataset/util/task_manager.h"
+#include "minddata/dataset/util/wait_post.h"
 #endif
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_column.h"
@@ -164,11 +167,31 @@ class GraphDataClient : public GraphData {
 
   Status GetStoredGraphFeature(FeatureType feature_type, std::shared_ptr<Tensor> *out_feature);
 
-  Status GetGraphData(const GnnGraphDataRequestPb &request, GnnGraphDataResponsePb *response);
+  Status GetGraphData(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response);
 
-  Status GetGraphDataTensor(const GnnGraphDataRequestPb &request, GnnGraphDataResponsePb *response,
+  Status GetGraphDataTensor(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response,
                             std::shared_ptr<Tensor> *out);
 
+  // Send the request through the stream of GetGraphDataStream and wait for its reply, the requests of many threads
+  // are pipelined in the stream.
+  Status GetGraphDataByStream(GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response);
+
+  Status OpenGraphDataStream();
+
+  Status CloseGraphDataStream();
+
+  // The entry of the task that reads the replies of the stream and wakes up the waiting requests.
+  Status StreamReaderEntry();
+
+  // Get the feature addresses in shared memory of the nodes, the addresses known by the previous requests are taken
+  // from the cache and only the rest nodes are requested from the server.
+  // @param std::shared_ptr<Tensor> nodes - List of nodes
+  // @param std::vector<FeatureType> feature_types - Types of features
+  // @param std::vector<std::shared_ptr<Tensor>> *out - Returned (offset, length) of each node for each feature type
+  // @return Status The status code returned
+  Status GetNodeFeatureAddress(const std::shared_ptr<Tensor> &nodes, const std::vector<FeatureType> &feature_types,
+                               std::vector<std::shared_ptr<Tensor>> *out);
+
   Status RegisterToServer();
 
   Status UnRegisterToServer();
@@ -196,6 +219,24 @@ class GraphDataClient : public GraphData {
   std::unordered_map<FeatureType, std::shared_ptr<Tensor>> default_node_feature_map_;
   std::unordered_map<FeatureType, std::shared_ptr<Tensor>> default_edge_feature_map_;
   std::unordered_map<FeatureType, std::shared_ptr<Tensor>> graph_feature_map_;
+
+  struct StreamRequest {
+    WaitPost wp_;
+    Status rc_;
+    GnnGraphDataResponsePb response_;
+  };
+  std::unique_ptr<grpc::ClientContext> stream_ctx_;
+  std::unique_ptr<grpc::ClientReaderWriter<GnnGraphDataRequestPb, GnnGraphDataResponsePb>> stream_;
+  std::unique_ptr<TaskGroup> stream_tg_;
+  std::mutex stream_write_mutex_;
+  std::mutex stream_mutex_;
+  int64_t stream_request_cnt_;
+  bool stream_broken_;
+  std::unordered_map<int64_t, std::shared_ptr<StreamRequest>> stream_requests_;
+
+  // The feature (offset, length) in shared memory of the nodes, which never change after the server is up.
+  std::mutex feature_cache_mutex_;
+  std::unordered_map<FeatureType, std::unordered_map<NodeIdType, std::pair<int64_t, int64_t>>> node_feature_cache_;
 #endif
   bool registered_;
 };
@@ -262,6 +262,9 @@ Status GraphDataImpl::GetSampledNeighbors(const std::vector<NodeIdType> &node_li
     RETURN_IF_NOT_OK(CheckNeighborType(type));
   }
   RETURN_UNEXPECTED_IF_NULL(out);
+  if (neighbor_csr_.built()) {
+    return neighbor_csr_.SampleNeighbors(node_list, neighbor_nums, neighbor_types, strategy, num_workers_, &rnd_, out);
+  }
   std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
   for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
     std::shared_ptr<Node> input_node;
@@ -596,6 +599,7 @@ Status GraphDataImpl::Init() {
   // ask graph_loader to load everything into memory
   RETURN_IF_NOT_OK(gl.InitAndLoad());
   RETURN_IF_NOT_OK(gl.GetNodesAndEdges());
+  RETURN_IF_NOT_OK(BuildNeighborCsr());
   return Status::OK();
 }
 
@@ -609,10 +613,20 @@ Status GraphDataImpl::Init(int32_t num_nodes, const std::shared_ptr<Tensor> &edg
                           server_mode_);
   RETURN_IF_NOT_OK(gl.InitAndLoad());
   RETURN_IF_NOT_OK(gl.GetNodesAndEdges());
+  RETURN_IF_NOT_OK(BuildNeighborCsr());
 
   return Status::OK();
 }
 
+Status GraphDataImpl::BuildNeighborCsr() {
+  std::vector<NodeType> node_types;
+  node_types.reserve(node_type_map_.size());
+  for (const auto &item : node_type_map_) {
+    node_types.push_back(item.first);
+  }
+  return neighbor_csr_.Build(node_id_map_, node_types);
+}
+
 Status GraphDataImpl::GetMetaInfo(MetaInfo *meta_info) {
   RETURN_UNEXPECTED_IF_NULL(meta_info);
   meta_info->node_type.resize(node_type_map_.size());
@@ -25,6 +25,7 @@
 #include <vector>
 #include <utility>
 
+#include "minddata/dataset/engine/gnn/graph_csr.h"
 #include "minddata/dataset/engine/gnn/graph_data.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
@@ -285,6 +286,9 @@ class GraphDataImpl : public GraphData {
 
   Status CheckNeighborType(NodeType neighbor_type);
 
+  // Build the CSR layout of the neighbors after the graph is loaded, which serves GetSampledNeighbors.
+  Status BuildNeighborCsr();
+
   std::string data_format_;
   std::string dataset_file_;
   int32_t num_workers_;  // The number of worker threads
@@ -297,6 +301,7 @@ class GraphDataImpl : public GraphData {
 #endif
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
   std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
+  GraphCsr neighbor_csr_;
 
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
   std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
@@ -108,6 +108,8 @@ class UntypedCall {
   virtual Status operator()() = 0;
 
   virtual bool JudgeFinish() = 0;
+  // Called when the event of the call is failed, return true if the call can be released.
+  virtual bool Abort() { return false; }
 };
 
 template <class ServiceImpl, class AsyncService, class RequestMessage, class ResponseMessage>
@@ -175,6 +177,92 @@ class CallData : public UntypedCall {
   ResponseMessage response_;
 };
 
+// The call of a bidirectional streaming rpc. The requests of one stream are read, handled and replied one by one, so
+// the client can pipeline many requests in one stream without waiting for the replies.
+template <class ServiceImpl, class AsyncService, class RequestMessage, class ResponseMessage>
+class StreamCallData : public UntypedCall {
+ public:
+  enum class STATE : int8_t { CREATE = 1, CONNECT = 2, READ = 3, WRITE = 4, FINISH = 5 };
+  using EnqueueFunction = void (AsyncService::*)(grpc::ServerContext *,
+                                                 grpc::ServerAsyncReaderWriter<ResponseMessage, RequestMessage> *,
+                                                 grpc::CompletionQueue *, grpc::ServerCompletionQueue *, void *);
+  using HandleRequestFunction = grpc::Status (ServiceImpl::*)(grpc::ServerContext *, const RequestMessage *,
+                                                              ResponseMessage *);
+  StreamCallData(ServiceImpl *service_impl, AsyncService *async_service, grpc::ServerCompletionQueue *cq,
+                 EnqueueFunction enqueue_function, HandleRequestFunction handle_request_function)
+      : status_(STATE::CREATE),
+        service_impl_(service_impl),
+        async_service_(async_service),
+        cq_(cq),
+        enqueue_function_(enqueue_function),
+        handle_request_function_(handle_request_function),
+        stream_(&ctx_) {}
+
+  ~StreamCallData() override = default;
+
+  static Status EnqueueRequest(ServiceImpl *service_impl, AsyncService *async_service, grpc::ServerCompletionQueue *cq,
+                               EnqueueFunction enqueue_function, HandleRequestFunction handle_request_function) {
+    auto call = new StreamCallData<ServiceImpl, AsyncService, RequestMessage, ResponseMessage>(
+      service_impl, async_service, cq, enqueue_function, handle_request_function);
+    RETURN_IF_NOT_OK((*call)());
+    return Status::OK();
+  }
+
+  Status operator()() override {
+    if (status_ == STATE::CREATE) {
+      status_ = STATE::CONNECT;
+      (async_service_->*enqueue_function_)(&ctx_, &stream_, cq_, cq_, this);
+    } else if (status_ == STATE::CONNECT) {
+      // A new stream is connected, wait for the next one and read the first request.
+      RETURN_IF_NOT_OK(EnqueueRequest(service_impl_, async_service_, cq_, enqueue_function_, handle_request_function_));
+      status_ = STATE::READ;
+      stream_.Read(&request_, this);
+    } else if (status_ == STATE::READ) {
+      response_.Clear();
+      grpc::Status s = (service_impl_->*handle_request_function_)(&ctx_, &request_, &response_);
+      if (s.ok()) {
+        response_.set_request_id(request_.request_id());
+        status_ = STATE::WRITE;
+        stream_.Write(response_, this);
+      } else {
+        status_ = STATE::FINISH;
+        stream_.Finish(s, this);
+      }
+    } else if (status_ == STATE::WRITE) {
+      request_.Clear();
+      status_ = STATE::READ;
+      stream_.Read(&request_, this);
+    } else {
+      MS_LOG(WARNING) << "The StreamCallData status is finish and the pointer needs to be released.";
+    }
+    return Status::OK();
+  }
+
+  bool JudgeFinish() override { return status_ == STATE::FINISH; }
+
+  bool Abort() override {
+    if (status_ == STATE::READ || status_ == STATE::WRITE) {
+      // The client has closed its writes or is gone, finish the stream.
+      status_ = STATE::FINISH;
+      stream_.Finish(grpc::Status::OK, this);
+      return false;
+    }
+    return true;
+  }
+
+ private:
+  STATE status_;
+  ServiceImpl *service_impl_;
+  AsyncService *async_service_;
+  grpc::ServerCompletionQueue *cq_;
+  EnqueueFunction enqueue_function_;
+  HandleRequestFunction handle_request_function_;
+  grpc::ServerContext ctx_;
+  grpc::ServerAsyncReaderWriter<ResponseMessage, RequestMessage> stream_;
+  RequestMessage request_;
+  ResponseMessage response_;
+};
+
 #define ENQUEUE_REQUEST(service_impl, async_service, cq, method, request_msg, response_msg)                       \
   do {                                                                                                            \
     Status s =                                                                                                    \
@@ -184,6 +272,15 @@ class CallData : public UntypedCall {
     RETURN_IF_NOT_OK(s);                                                                                          \
   } while (0)
 
+#define ENQUEUE_STREAM_REQUEST(service_impl, async_service, cq, method, handle_method, request_msg, response_msg) \
+  do {                                                                                                         \
+    Status s = StreamCallData<gnn::GraphDataServiceImpl, GnnGraphData::AsyncService, request_msg,              \
+                              response_msg>::EnqueueRequest(service_impl, async_service, cq,                   \
+                                                            &GnnGraphData::AsyncService::Request##method,      \
+                                                            &gnn::GraphDataServiceImpl::handle_method);        \
+    RETURN_IF_NOT_OK(s);                                                                                       \
+  } while (0)
+
 class GraphDataGrpcServer : public GrpcAsyncServer {
  public:
   GraphDataGrpcServer(const std::string &host, int32_t port, GraphDataServiceImpl *service_impl)
@@ -203,6 +300,8 @@ class GraphDataGrpcServer : public GrpcAsyncServer {
                     GnnClientUnRegisterResponsePb);
     ENQUEUE_REQUEST(service_impl_, &svc_, cq_.get(), GetGraphData, GnnGraphDataRequestPb, GnnGraphDataResponsePb);
     ENQUEUE_REQUEST(service_impl_, &svc_, cq_.get(), GetMetaInfo, GnnMetaInfoRequestPb, GnnMetaInfoResponsePb);
+    ENQUEUE_STREAM_REQUEST(service_impl_, &svc_, cq_.get(), GetGraphDataStream, GetGraphData, GnnGraphDataRequestPb,
+                           GnnGraphDataResponsePb);
     return Status::OK();
   }
 
@@ -216,6 +315,14 @@ class GraphDataGrpcServer : public GrpcAsyncServer {
     return Status::OK();
   }
 
+  Status ProcessFailedRequest(void *tag) override {
+    auto rq = static_cast<UntypedCall *>(tag);
+    if (rq->Abort()) {
+      delete rq;
+    }
+    return Status::OK();
+  }
+
  private:
   GraphDataServiceImpl *service_impl_;
   GnnGraphData::AsyncService svc_;
@@ -43,6 +43,25 @@ static std::unordered_map<uint32_t, pFunction> g_get_graph_data_func_ = {
 GraphDataServiceImpl::GraphDataServiceImpl(GraphDataServer *server, GraphDataImpl *graph_data_impl)
     : server_(server), graph_data_impl_(graph_data_impl) {}
 
+Status GraphDataServiceImpl::GetRequestIds(const GnnGraphDataRequestPb *request, std::vector<int32_t> *ids) {
+  // The client sends the ids as the raw int32 bytes of id_tensor, the repeated id is still accepted.
+  if (request->has_id_tensor()) {
+    const TensorPb &id_tensor = request->id_tensor();
+    CHECK_FAIL_RETURN_UNEXPECTED(
+      id_tensor.tensor_type() == DataTypePb::DE_PB_INT32 && id_tensor.data().size() % sizeof(int32_t) == 0,
+      "Invalid id tensor of the request.");
+    ids->resize(id_tensor.data().size() / sizeof(int32_t));
+    if (!ids->empty()) {
+      int ret_code = memcpy_s(ids->data(), ids->size() * sizeof(int32_t), id_tensor.data().data(),
+                              id_tensor.data().size());
+      CHECK_FAIL_RETURN_UNEXPECTED(ret_code == EOK, "Failed to copy the id tensor of the request.");
+    }
+  } else {
+    ids->assign(request->id().begin(), request->id().end());
+  }
+  return Status::OK();
+}
+
 Status GraphDataServiceImpl::FillDefaultFeature(GnnClientRegisterResponsePb *response) {
   const auto default_node_features = graph_data_impl_->GetAllDefaultNodeFeatures();
   for (const auto &feature : *default_node_features) {
@@ -185,12 +204,9 @@ Status GraphDataServiceImpl::GetAllEdges(const GnnGraphDataRequestPb *request, G
 }
 
 Status GraphDataServiceImpl::GetNodesFromEdges(const GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response) {
-  CHECK_FAIL_RETURN_UNEXPECTED(request->id_size() > 0, "The input edge id is empty");
-
   std::vector<EdgeIdType> edge_list;
-  edge_list.resize(request->id().size());
-  std::transform(request->id().begin(), request->id().end(), edge_list.begin(),
-                 [](const google::protobuf::int32 id) { return static_cast<EdgeIdType>(id); });
+  RETURN_IF_NOT_OK(GetRequestIds(request, &edge_list));
+  CHECK_FAIL_RETURN_UNEXPECTED(!edge_list.empty(), "The input edge id is empty");
   std::shared_ptr<Tensor> tensor;
   RETURN_IF_NOT_OK(graph_data_impl_->GetNodesFromEdges(edge_list, &tensor));
   TensorPb *result = response->add_result_data();
@@ -220,13 +236,11 @@ Status GraphDataServiceImpl::GetEdgesFromNodes(const GnnGraphDataRequestPb *requ
 }
 
 Status GraphDataServiceImpl::GetAllNeighbors(const GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response) {
-  CHECK_FAIL_RETURN_UNEXPECTED(request->id_size() > 0, "The input node id is empty");
   CHECK_FAIL_RETURN_UNEXPECTED(request->type_size() == 1, "The number of edge types is not 1");
 
   std::vector<NodeIdType> node_list;
-  node_list.resize(request->id().size());
-  std::transform(request->id().begin(), request->id().end(), node_list.begin(),
-                 [](const google::protobuf::int32 id) { return static_cast<NodeIdType>(id); });
+  RETURN_IF_NOT_OK(GetRequestIds(request, &node_list));
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "The input node id is empty");
   OutputFormat format = static_cast<OutputFormat>(request->format());
   std::shared_ptr<Tensor> tensor;
   RETURN_IF_NOT_OK(
@@ -238,14 +252,12 @@ Status GraphDataServiceImpl::GetAllNeighbors(const GnnGraphDataRequestPb *reques
 
 Status GraphDataServiceImpl::GetSampledNeighbors(const GnnGraphDataRequestPb *request,
                                                  GnnGraphDataResponsePb *response) {
-  CHECK_FAIL_RETURN_UNEXPECTED(request->id_size() > 0, "The input node id is empty");
   CHECK_FAIL_RETURN_UNEXPECTED(request->number_size() > 0, "The input neighbor number is empty");
   CHECK_FAIL_RETURN_UNEXPECTED(request->type_size() > 0, "The input neighbor type is empty");
 
   std::vector<NodeIdType> node_list;
-  node_list.resize(request->id().size());
-  std::transform(request->id().begin(), request->id().end(), node_list.begin(),
-                 [](const google::protobuf::int32 id) { return static_cast<NodeIdType>(id); });
+  RETURN_IF_NOT_OK(GetRequestIds(request, &node_list));
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "The input node id is empty");
   std::vector<NodeIdType> neighbor_nums;
   neighbor_nums.resize(request->number().size());
   std::transform(request->number().begin(), request->number().end(), neighbor_nums.begin(),
@@ -264,14 +276,12 @@ Status GraphDataServiceImpl::GetSampledNeighbors(const GnnGraphDataRequestPb *re
 
 Status GraphDataServiceImpl::GetNegSampledNeighbors(const GnnGraphDataRequestPb *request,
                                                     GnnGraphDataResponsePb *response) {
-  CHECK_FAIL_RETURN_UNEXPECTED(request->id_size() > 0, "The input node id is empty");
   CHECK_FAIL_RETURN_UNEXPECTED(request->number_size() == 1, "The number of neighbor number is not 1");
   CHECK_FAIL_RETURN_UNEXPECTED(request->type_size() == 1, "The number of neighbor types is not 1");
 
   std::vector<NodeIdType> node_list;
-  node_list.resize(request->id().size());
-  std::transform(request->id().begin(), request->id().end(), node_list.begin(),
-                 [](const google::protobuf::int32 id) { return static_cast<NodeIdType>(id); });
+  RETURN_IF_NOT_OK(GetRequestIds(request, &node_list));
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "The input node id is empty");
   std::shared_ptr<Tensor> tensor;
   RETURN_IF_NOT_OK(graph_data_impl_->GetNegSampledNeighbors(node_list, static_cast<NodeIdType>(request->number()[0]),
                                                             static_cast<NodeType>(request->type()[0]), &tensor));
@@ -281,13 +291,11 @@ Status GraphDataServiceImpl::GetNegSampledNeighbors(const GnnGraphDataRequestPb
 }
 
 Status GraphDataServiceImpl::RandomWalk(const GnnGraphDataRequestPb *request, GnnGraphDataResponsePb *response) {
-  CHECK_FAIL_RETURN_UNEXPECTED(request->id_size() > 0, "The input node id is empty");
   CHECK_FAIL_RETURN_UNEXPECTED(request->type_size() > 0, "The input meta path is empty");
 
   std::vector<NodeIdType> node_list;
-  node_list.resize(request->id().size());
-  std::transform(request->id().begin(), request->id().end(), node_list.begin(),
-                 [](const google::protobuf::int32 id) { return static_cast<NodeIdType>(id); });
+  RETURN_IF_NOT_OK(GetRequestIds(request, &node_list));
+  CHECK_FAIL_RETURN_UNEXPECTED(!node_list.empty(), "The input node id is empty");
   std::vector<NodeType> meta_path;
   meta_path.resize(request->type().size());
   std::transform(request->type().begin(), request->type().end(), meta_path.begin(),
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 #include "proto/gnn_graph_data.grpc.pb.h"
@@ -61,6 +62,8 @@ class GraphDataServiceImpl {
  private:
   Status FillDefaultFeature(GnnClientRegisterResponsePb *response);
 
+  Status GetRequestIds(const GnnGraphDataRequestPb *request, std::vector<int32_t> *ids);
+
   GraphDataServer *server_;
   GraphDataImpl *graph_data_impl_;
 };
@@ -62,12 +62,17 @@ Status GrpcAsyncServer::HandleRequest() {
     if (success) {
       RETURN_IF_NOT_OK(ProcessRequest(tag));
     } else {
-      MS_LOG(DEBUG) << "cq_->Next failed.";
+      RETURN_IF_NOT_OK(ProcessFailedRequest(tag));
     }
   }
   return Status::OK();
 }
 
+Status GrpcAsyncServer::ProcessFailedRequest(void *tag) {
+  MS_LOG(DEBUG) << "cq_->Next failed.";
+  return Status::OK();
+}
+
 void GrpcAsyncServer::Stop() {
   if (server_) {
     server_->Shutdown();
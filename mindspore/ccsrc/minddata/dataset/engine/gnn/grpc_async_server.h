@@ -48,6 +48,9 @@ class GrpcAsyncServer {
 
   virtual Status ProcessRequest(void *tag) = 0;
 
+  /// \brief Handle the tag whose event of the completion queue is failed, e.g. the client closes the stream
+  virtual Status ProcessFailedRequest(void *tag);
+
  protected:
   int32_t port_;
   std::string host_;
@@ -65,6 +65,22 @@ Status LocalNode::GetAllNeighbors(NodeType neighbor_type, std::vector<NodeIdType
   return Status::OK();
 }
 
+Status LocalNode::GetAllNeighborsWithWeight(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                            std::vector<WeightType> *out_weights) {
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  RETURN_UNEXPECTED_IF_NULL(out_weights);
+  out_neighbors->clear();
+  out_weights->clear();
+  auto itr = neighbor_nodes_.find(neighbor_type);
+  if (itr != neighbor_nodes_.end()) {
+    out_neighbors->resize(itr->second.first.size());
+    std::transform(itr->second.first.begin(), itr->second.first.end(), out_neighbors->begin(),
+                   [](const std::shared_ptr<Node> &node) { return node->id(); });
+    *out_weights = itr->second.second;
+  }
+  return Status::OK();
+}
+
 Status LocalNode::GetRandomSampledNeighbors(const std::vector<std::shared_ptr<Node>> &neighbors, int32_t samples_num,
                                             std::vector<NodeIdType> *out, std::mt19937 *rnd) {
   std::vector<NodeIdType> shuffled_id(neighbors.size());
@@ -51,6 +51,14 @@ class LocalNode : public Node {
   Status GetAllNeighbors(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
                          bool exclude_itself = false) override;
 
+  // Get the all neighbors of a node and the weights of the edges to them
+  // @param NodeType neighbor_type - type of neighbor
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
+  // @param std::vector<WeightType> *out_weights - Returned edge weights
+  // @return Status The status code returned
+  Status GetAllNeighborsWithWeight(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                   std::vector<WeightType> *out_weights) override;
+
   // Get the sampled neighbors of a node
   // @param NodeType neighbor_type - type of neighbor
   // @param int32_t samples_num - Number of neighbors to be acquired
@@ -68,6 +68,14 @@ class Node {
   virtual Status GetAllNeighbors(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
                                  bool exclude_itself = false) = 0;
 
+  // Get the all neighbors of a node and the weights of the edges to them
+  // @param NodeType neighbor_type - type of neighbor
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
+  // @param std::vector<WeightType> *out_weights - Returned edge weights
+  // @return Status The status code returned
+  virtual Status GetAllNeighborsWithWeight(NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                           std::vector<WeightType> *out_weights) = 0;
+
   // Get the sampled neighbors of a node
   // @param NodeType neighbor_type - type of neighbor
   // @param int32_t samples_num - Number of neighbors to be acquired
@@ -83,6 +83,14 @@ class GpuConnector : public Connector<GpuConnectorItem> {
     return Status::OK();
   }
 
+  // Resize the queue of every producer to the new capacity.
+  Status Resize(int32_t queue_capacity) {
+    for (size_t i = 0; i < queues_.size(); i++) {
+      RETURN_IF_NOT_OK(queues_[i]->Resize(queue_capacity));
+    }
+    return Status::OK();
+  }
+
  private:
   std::vector<bool> is_queue_finished_;
 };
@@ -32,14 +32,15 @@ namespace mindspore {
 namespace dataset {
 // Constructor
 DistributedSamplerObj::DistributedSamplerObj(int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples,
-                                             uint32_t seed, int64_t offset, bool even_dist)
+                                             uint32_t seed, int64_t offset, bool even_dist, int64_t block_size)
     : num_shards_(num_shards),
       shard_id_(shard_id),
       shuffle_(shuffle),
       num_samples_(num_samples),
       seed_(seed),
       offset_(offset),
-      even_dist_(even_dist) {
+      even_dist_(even_dist),
+      block_size_(block_size) {
   // Update the num_shards_ in global context. this number is only used for now by auto_num_worker_pass. User discretion
   // is advised. Auto_num_worker_pass is currently an experimental feature which can still work if the num_shards_ isn't
   // 100% correct. The reason behind is for now, PreBuildSampler doesn't offer a way to return num_shards. Once
@@ -71,13 +72,23 @@ Status DistributedSamplerObj::ValidateParams() {
                              std::to_string(num_shards_) + "), but got: " + std::to_string(offset_));
   }
 
+  if (block_size_ < 0) {
+    RETURN_STATUS_UNEXPECTED("DistributedSampler: block_size must be greater than or equal to 0, but got: " +
+                             std::to_string(block_size_));
+  }
+
+  if (block_size_ > 0 && offset_ != -1) {
+    RETURN_STATUS_UNEXPECTED("DistributedSampler: block_size can not be used together with offset, but got offset: " +
+                             std::to_string(offset_));
+  }
+
   return Status::OK();
 }
 
 Status DistributedSamplerObj::SamplerBuild(std::shared_ptr<SamplerRT> *sampler) {
   // runtime sampler object
   *sampler = std::make_shared<dataset::DistributedSamplerRT>(num_shards_, shard_id_, shuffle_, num_samples_, seed_,
-                                                             offset_, even_dist_);
+                                                             offset_, even_dist_, block_size_);
   Status s = BuildChildren(sampler);
   sampler = s.IsOk() ? sampler : nullptr;
   return s;
@@ -103,6 +114,9 @@ Status DistributedSamplerObj::to_json(nlohmann::json *const out_json) {
   args["offset"] = offset_;
   args["num_samples"] = num_samples_;
   args["even_dist"] = even_dist_;
+  if (block_size_ > 0) {
+    args["block_size"] = block_size_;
+  }
   *out_json = args;
   return Status::OK();
 }
@@ -122,8 +136,9 @@ Status DistributedSamplerObj::from_json(nlohmann::json json_obj, int64_t num_sam
   uint32_t seed = json_obj["seed"];
   int64_t offset = json_obj["offset"];
   bool even_dist = json_obj["even_dist"];
-  *sampler =
-    std::make_shared<DistributedSamplerObj>(num_shards, shard_id, shuffle, num_samples, seed, offset, even_dist);
+  int64_t block_size = json_obj.find("block_size") != json_obj.end() ? json_obj["block_size"].get<int64_t>() : 0;
+  *sampler = std::make_shared<DistributedSamplerObj>(num_shards, shard_id, shuffle, num_samples, seed, offset,
+                                                     even_dist, block_size);
   // Run common code in super class to add children samplers
   RETURN_IF_NOT_OK(SamplerObj::from_json(json_obj, sampler));
   return Status::OK();
@@ -131,8 +146,8 @@ Status DistributedSamplerObj::from_json(nlohmann::json json_obj, int64_t num_sam
 #endif
 
 std::shared_ptr<SamplerObj> DistributedSamplerObj::SamplerCopy() {
-  auto sampler =
-    std::make_shared<DistributedSamplerObj>(num_shards_, shard_id_, shuffle_, num_samples_, seed_, offset_, even_dist_);
+  auto sampler = std::make_shared<DistributedSamplerObj>(num_shards_, shard_id_, shuffle_, num_samples_, seed_, offset_,
+                                                        even_dist_, block_size_);
   for (const auto &child : children_) {
     Status rc = sampler->AddChildSampler(child);
     if (rc.IsError()) {
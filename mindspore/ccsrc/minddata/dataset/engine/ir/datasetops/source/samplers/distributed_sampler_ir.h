@@ -35,7 +35,7 @@ class SamplerRT;
 class DistributedSamplerObj : public SamplerObj {
  public:
   DistributedSamplerObj(int64_t num_shards, int64_t shard_id, bool shuffle, int64_t num_samples, uint32_t seed,
-                        int64_t offset, bool even_dist);
+                        int64_t offset, bool even_dist, int64_t block_size = 0);
 
   ~DistributedSamplerObj() override;
 
@@ -75,6 +75,7 @@ class DistributedSamplerObj : public SamplerObj {
   uint32_t seed_;
   int64_t offset_;
   bool even_dist_;
+  int64_t block_size_;
 };
 }  // namespace dataset
 }  // namespace mindspore
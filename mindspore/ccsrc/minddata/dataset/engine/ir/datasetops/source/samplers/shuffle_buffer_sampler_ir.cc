@@ -0,0 +1,84 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/shuffle_buffer_sampler_ir.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
+#include "minddata/dataset/util/validators.h"
+
+namespace mindspore {
+namespace dataset {
+// Constructor
+ShuffleBufferSamplerObj::ShuffleBufferSamplerObj(int32_t shuffle_size, uint32_t shuffle_seed,
+                                                 bool reshuffle_each_epoch)
+    : shuffle_size_(shuffle_size), shuffle_seed_(shuffle_seed), reshuffle_each_epoch_(reshuffle_each_epoch) {}
+
+// Destructor
+ShuffleBufferSamplerObj::~ShuffleBufferSamplerObj() = default;
+
+Status ShuffleBufferSamplerObj::ValidateParams() {
+  if (shuffle_size_ <= 1) {
+    RETURN_STATUS_UNEXPECTED("ShuffleBufferSampler: shuffle_size must be greater than 1, but got: " +
+                             std::to_string(shuffle_size_));
+  }
+  return Status::OK();
+}
+
+Status ShuffleBufferSamplerObj::to_json(nlohmann::json *const out_json) {
+  nlohmann::json args;
+  RETURN_IF_NOT_OK(SamplerObj::to_json(&args));
+  args["sampler_name"] = "ShuffleBufferSampler";
+  args["shuffle_size"] = shuffle_size_;
+  args["shuffle_seed"] = shuffle_seed_;
+  args["reshuffle_each_epoch"] = reshuffle_each_epoch_;
+  *out_json = args;
+  return Status::OK();
+}
+
+#ifndef ENABLE_ANDROID
+Status ShuffleBufferSamplerObj::from_json(nlohmann::json json_obj, std::shared_ptr<SamplerObj> *sampler) {
+  RETURN_IF_NOT_OK(ValidateParamInJson(json_obj, "shuffle_size", "ShuffleBufferSampler"));
+  RETURN_IF_NOT_OK(ValidateParamInJson(json_obj, "shuffle_seed", "ShuffleBufferSampler"));
+  RETURN_IF_NOT_OK(ValidateParamInJson(json_obj, "reshuffle_each_epoch", "ShuffleBufferSampler"));
+  int32_t shuffle_size = json_obj["shuffle_size"];
+  uint32_t shuffle_seed = json_obj["shuffle_seed"];
+  bool reshuffle_each_epoch = json_obj["reshuffle_each_epoch"];
+  *sampler = std::make_shared<ShuffleBufferSamplerObj>(shuffle_size, shuffle_seed, reshuffle_each_epoch);
+  // Run common code in super class to add children samplers
+  RETURN_IF_NOT_OK(SamplerObj::from_json(json_obj, sampler));
+  return Status::OK();
+}
+#endif
+
+Status ShuffleBufferSamplerObj::SamplerBuild(std::shared_ptr<SamplerRT> *sampler) {
+  // runtime sampler object
+  *sampler = std::make_shared<dataset::ShuffleBufferSamplerRT>(shuffle_size_, shuffle_seed_, reshuffle_each_epoch_);
+  Status s = BuildChildren(sampler);
+  sampler = s.IsOk() ? sampler : nullptr;
+  return s;
+}
+
+std::shared_ptr<SamplerObj> ShuffleBufferSamplerObj::SamplerCopy() {
+  auto sampler = std::make_shared<ShuffleBufferSamplerObj>(shuffle_size_, shuffle_seed_, reshuffle_each_epoch_);
+  for (const auto &child : children_) {
+    Status rc = sampler->AddChildSampler(child);
+    if (rc.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Error in copying the sampler. Message: " << rc;
+    }
+  }
+  return sampler;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -16,11 +16,13 @@
 #ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPERATOR_CONNECTOR_H_
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPERATOR_CONNECTOR_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
 #include "minddata/dataset/core/tensor_row.h"
 #include "minddata/dataset/engine/connector.h"
+#include "minddata/dataset/engine/perf/pipeline_trace.h"
 
 #include "minddata/dataset/include/dataset/constants.h"
 
@@ -37,9 +39,37 @@ class OperatorConnector : public Queue<TensorRow> {
   ~OperatorConnector() = default;
 
   Status PopFront(TensorRow *row) override {
+    uint64_t start_us = RowTracer::NowUs();
+    Status rc = Queue::PopFront(row);
+    uint64_t wait_us = RowTracer::NowUs() - start_us;
+    pop_wait_.Record(wait_us);
+    if (tracer_->Sampled(out_rows_count_) && rc.IsOk() && !row->eoe() && !row->eof()) {
+      tracer_->AddEvent(name_ + " pop wait", out_rows_count_, start_us, wait_us);
+    }
     out_rows_count_++;
-    return Queue::PopFront(row);
+    return rc;
   }
+
+  /// Add a row into the connector, the time producing the row and the time blocked by the full connector are recorded
+  Status Add(const TensorRow &row) noexcept {
+    uint64_t start_us = BeforeAdd(row);
+    Status rc = Queue::Add(row);
+    if (!row.eoe() && !row.eof()) {
+      AfterAdd(start_us);
+    }
+    return rc;
+  }
+
+  Status Add(TensorRow &&row) noexcept {
+    uint64_t start_us = BeforeAdd(row);
+    bool is_data = !row.eoe() && !row.eof();
+    Status rc = Queue::Add(std::move(row));
+    if (is_data) {
+      AfterAdd(start_us);
+    }
+    return rc;
+  }
+
   Status SendEOE() noexcept {
     TensorRow eoe = TensorRow(TensorRow::kFlagEOE);
     return Add(std::move(eoe));
@@ -51,8 +81,78 @@ class OperatorConnector : public Queue<TensorRow> {
   }
   auto out_rows_count() const { return out_rows_count_; }
 
+  /// Set the name of the connector in the latency summary and the trace, normally the name of the producing operator
+  void SetName(const std::string &name) { name_ = name; }
+
+  /// Histogram of the time between the rows added by the same thread, which is the time of producing a row
+  const LatencyHistogram &produce_time() const { return produce_time_; }
+
+  /// Histogram of the time the producer is blocked by the full connector
+  const LatencyHistogram &push_wait() const { return push_wait_; }
+
+  /// Histogram of the time the consumer is blocked by the empty connector
+  const LatencyHistogram &pop_wait() const { return pop_wait_; }
+
+  /// A summary of the latency histograms
+  std::string LatencySummary() const {
+    auto summary = [](const LatencyHistogram &histogram) {
+      const double kMedian = 50;
+      const double kTail = 99;
+      return "p50 " + std::to_string(histogram.Percentile(kMedian)) + "us/p99 " +
+             std::to_string(histogram.Percentile(kTail)) + "us";
+    };
+    return name_ + " rows: " + std::to_string(produce_time_.Count()) + ", produce: " + summary(produce_time_) +
+           ", push wait: " + summary(push_wait_) + ", pop wait: " + summary(pop_wait_);
+  }
+
  private:
+  // The last row added by the thread, the thread normally produces the rows of only one connector.
+  struct LastAdd {
+    const OperatorConnector *connector = nullptr;
+    uint64_t end_us = 0;
+  };
+
+  static LastAdd *ThreadLastAdd() {
+    thread_local LastAdd last_add;
+    return &last_add;
+  }
+
+  uint64_t BeforeAdd(const TensorRow &row) {
+    uint64_t start_us = RowTracer::NowUs();
+    if (row.eoe() || row.eof()) {
+      return start_us;
+    }
+    LastAdd *last_add = ThreadLastAdd();
+    if (last_add->connector == this) {
+      uint64_t produce_us = start_us - last_add->end_us;
+      produce_time_.Record(produce_us);
+      int64_t row_index = in_rows_count_.load(std::memory_order_relaxed);
+      if (tracer_->Sampled(row_index)) {
+        tracer_->AddEvent(name_ + " produce", row_index, last_add->end_us, produce_us);
+      }
+    }
+    return start_us;
+  }
+
+  void AfterAdd(uint64_t start_us) {
+    uint64_t end_us = RowTracer::NowUs();
+    LastAdd *last_add = ThreadLastAdd();
+    last_add->connector = this;
+    last_add->end_us = end_us;
+    push_wait_.Record(end_us - start_us);
+    int64_t row_index = in_rows_count_.fetch_add(1, std::memory_order_relaxed);
+    if (tracer_->Sampled(row_index)) {
+      tracer_->AddEvent(name_ + " push wait", row_index, start_us, end_us - start_us);
+    }
+  }
+
   int64_t out_rows_count_;
+  std::atomic<int64_t> in_rows_count_{0};
+  std::string name_;
+  RowTracer *tracer_{RowTracer::GetInstance()};
+  LatencyHistogram produce_time_;
+  LatencyHistogram push_wait_;
+  LatencyHistogram pop_wait_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -20,19 +20,86 @@
 #include <vector>
 
 #include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/kernels/image/normalize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "minddata/dataset/kernels/image/random_horizontal_flip_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/random_horizontal_flip_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
 
 namespace mindspore {
 namespace dataset {
+Status TensorOpFusionPass::FuseDecodeToChw(const std::shared_ptr<MapNode> &node, const std::vector<std::string> &names,
+                                           bool *const modified) {
+  constexpr size_t kDecodeIndex = 0;
+  constexpr size_t kCropIndex = 1;
+  constexpr size_t kFlipIndex = 2;
+  constexpr size_t kNormalizeIndex = 3;
+  constexpr size_t kHwcToChwIndex = 4;
+  std::vector<std::shared_ptr<TensorOperation>> ops = node->operations();
+  auto name_at = [&ops](size_t i) { return (i < ops.size() && ops[i] != nullptr) ? ops[i]->Name() : std::string(); };
+  for (size_t i = 0; i + 1 < ops.size(); ++i) {
+    if (name_at(i) != names[kDecodeIndex] || name_at(i + 1) != names[kCropIndex]) {
+      continue;
+    }
+    size_t normalize_pos = i + 2;
+    bool with_flip = name_at(normalize_pos) == names[kFlipIndex];
+    if (with_flip) {
+      ++normalize_pos;
+    }
+    if (name_at(normalize_pos) != names[kNormalizeIndex] || name_at(normalize_pos + 1) != names[kHwcToChwIndex]) {
+      continue;
+    }
+    auto crop_op = std::dynamic_pointer_cast<RandomCropAndResizeOp>(ops[i + 1]->Build());
+    auto normalize_op = std::dynamic_pointer_cast<NormalizeOp>(ops[normalize_pos]->Build());
+    RETURN_UNEXPECTED_IF_NULL(crop_op);
+    RETURN_UNEXPECTED_IF_NULL(normalize_op);
+    // The fused op normalizes the resized image of HWC only.
+    if (!normalize_op->is_hwc()) {
+      continue;
+    }
+    float flip_prob = 0.0;
+    if (with_flip) {
+      auto flip_op = std::dynamic_pointer_cast<RandomHorizontalFlipOp>(ops[i + 2]->Build());
+      RETURN_UNEXPECTED_IF_NULL(flip_op);
+      flip_prob = flip_op->probability();
+    }
+    MS_LOG(INFO) << "Fusing Decode, RandomResizedCrop, RandomHorizontalFlip, Normalize and HWC2CHW into one op.";
+    ops[i] = std::make_shared<transforms::PreBuiltOperation>(std::make_shared<RandomCropDecodeResizeNormalizeOp>(
+      *crop_op, flip_prob, normalize_op->mean(), normalize_op->std()));
+    (void)ops.erase(ops.begin() + static_cast<int64_t>(i) + 1, ops.begin() + static_cast<int64_t>(normalize_pos) + 2);
+    node->setOperations(ops);
+    *modified = true;
+    return Status::OK();
+  }
+  return Status::OK();
+}
 
 Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
   RETURN_UNEXPECTED_IF_NULL(modified);
+  // The longer chain to HWC2CHW is fused first, otherwise its Decode and RandomResizedCrop are taken below.
+  bool fused = false;
+  RETURN_IF_NOT_OK(FuseDecodeToChw(
+    node, {kDecodeOp, kRandomCropAndResizeOp, kRandomHorizontalFlipOp, kNormalizeOp, kHwcToChwOp}, &fused));
+  if (!fused) {
+    RETURN_IF_NOT_OK(FuseDecodeToChw(node,
+                                     {vision::kDecodeOperation, vision::kRandomResizedCropOperation,
+                                      vision::kRandomHorizontalFlipOperation, vision::kNormalizeOperation,
+                                      vision::kHwcToChwOperation},
+                                     &fused));
+  }
+  if (fused) {
+    *modified = true;
+    return Status::OK();
+  }
+
   std::vector<std::shared_ptr<TensorOperation>> ops = node->operations();
 
   // start temporary code, to deal with pre-built TensorOperation
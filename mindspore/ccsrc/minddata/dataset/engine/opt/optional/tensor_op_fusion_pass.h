@@ -17,6 +17,8 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TENSOR_OP_FUSION_PASS_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 #include "minddata/dataset/engine/opt/pass.h"
 
 namespace mindspore {
@@ -31,6 +33,15 @@ class TensorOpFusionPass : public IRNodePass {
   /// \param[in, out] *modified indicates whether the node has been visited
   /// \return Status The status code returned
   Status Visit(std::shared_ptr<MapNode> node, bool *const modified) override;
+
+  /// \brief Fuses Decode, RandomResizedCrop, RandomHorizontalFlip (optional), Normalize and HWC2CHW into
+  ///     RandomCropDecodeResizeNormalizeOp
+  /// \param[in] node The node being visited
+  /// \param[in] names The names of the ops to fuse in order
+  /// \param[in, out] *modified indicates whether the node has been modified
+  /// \return Status The status code returned
+  Status FuseDecodeToChw(const std::shared_ptr<MapNode> &node, const std::vector<std::string> &names,
+                         bool *const modified);
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/opt/pre/shuffle_pushdown_pass.h"
+#include "minddata/dataset/engine/ir/datasetops/dataset_node.h"
+#include "minddata/dataset/engine/ir/datasetops/shuffle_node.h"
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/shuffle_buffer_sampler_ir.h"
+
+namespace mindspore {
+namespace dataset {
+// Collect the shuffle node whose only child is a mappable source that samples the rows by SamplerRT.
+Status ShufflePushdownPass::ShuffleNodes::Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) {
+  *modified = false;
+  if (node->Children().size() != 1) {
+    return Status::OK();
+  }
+  auto child = node->Children()[0];
+  // MindDataset builds its own mindrecord samplers, and GeneratorDataset may not support random access.
+  // The cache takes over the sampler of the source, so the cached source is skipped as well.
+  if (!child->IsMappableDataSource() || child->IsCached() || child->Name() == kMindDataNode ||
+      child->Name() == kGeneratorNode) {
+    return Status::OK();
+  }
+  auto source = std::dynamic_pointer_cast<MappableSourceNode>(child);
+  if (source == nullptr || source->Sampler() == nullptr) {
+    return Status::OK();
+  }
+  nodes_to_pushdown_.push_back(node);
+  return Status::OK();
+}
+
+// Walk the tree to collect the shuffle nodes, then push them down into the samplers.
+Status ShufflePushdownPass::RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) {
+  MS_LOG(INFO) << "Pre pass: shuffle node pushdown pass started.";
+  std::unique_ptr<ShufflePushdownPass::ShuffleNodes> shuffle_nodes =
+    std::make_unique<ShufflePushdownPass::ShuffleNodes>();
+  RETURN_IF_NOT_OK(shuffle_nodes->Run(root_ir, modified));
+
+  // Update modified flag if there were any nodes identified to be pushed down
+  if (shuffle_nodes->nodes_to_pushdown().empty() == false) {
+    *modified = true;
+  }
+
+  for (auto node : shuffle_nodes->nodes_to_pushdown()) {
+    auto source = std::static_pointer_cast<MappableSourceNode>(node->Children()[0]);
+    MS_LOG(INFO) << "Pushing down Shuffle(" << node->ShuffleSize() << ") node into the sampler of " << source->Name();
+    auto new_sampler =
+      std::make_shared<ShuffleBufferSamplerObj>(node->ShuffleSize(), node->ShuffleSeed(), node->ResetEveryEpoch());
+    RETURN_IF_NOT_OK(new_sampler->AddChildSampler(source->Sampler()));
+    source->SetSampler(new_sampler);
+    RETURN_IF_NOT_OK(node->Drop());
+  }
+
+  MS_LOG(INFO) << "Pre pass: shuffle node pushdown pass is complete.";
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_SHUFFLE_PUSHDOWN_PASS_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_SHUFFLE_PUSHDOWN_PASS_H_
+
+#include <memory>
+#include <vector>
+#include "minddata/dataset/engine/opt/pass.h"
+
+namespace mindspore {
+namespace dataset {
+class ShuffleNode;
+
+/// \class ShufflePushdownPass shuffle_pushdown_pass.h
+/// \brief This is a tree pass that will push down a shuffle node into the sampler of its mappable source child.
+///     ShuffleOp buffers shuffle_size rows in memory, which is huge for the image rows. Since the mappable source can
+///     load any row by its id, the shuffle node is replaced by a ShuffleBufferSampler on top of the source sampler,
+///     which shuffles the ids in the same way and lets the source load the rows lazily.
+class ShufflePushdownPass : public IRTreePass {
+  /// \class ShuffleNodes
+  /// \brief This is a NodePass whose job is to identify which shuffle nodes can be pushed down.
+  ///     It works in conjunction with the ShufflePushdownPass.
+  class ShuffleNodes : public IRNodePass {
+   public:
+    /// \brief Constructor
+    ShuffleNodes() = default;
+
+    /// \brief Destructor
+    ~ShuffleNodes() = default;
+
+    /// \brief Perform shuffle node pushdown check on a ShuffleNode
+    /// \param[in] node The node being visited
+    /// \param[in, out] modified Indicator if the node was changed at all
+    /// \return Status The status code returned
+    Status Visit(std::shared_ptr<ShuffleNode> node, bool *const modified) override;
+
+    /// \brief Getter
+    /// \return All the shuffle nodes to be pushed down
+    const std::vector<std::shared_ptr<ShuffleNode>> &nodes_to_pushdown() const { return nodes_to_pushdown_; }
+
+   private:
+    std::vector<std::shared_ptr<ShuffleNode>> nodes_to_pushdown_;
+  };
+
+ public:
+  /// \brief Constructor
+  ShufflePushdownPass() = default;
+
+  /// \brief Destructor
+  ~ShufflePushdownPass() = default;
+
+  /// \brief Runs a shuffle_pushdown pass to replace the shuffle nodes by the samplers of their children.
+  /// \param[in, out] tree The tree to operate on.
+  /// \param[in, out] Indicate of the tree was modified.
+  /// \return Status The status code returned
+  Status RunOnTree(std::shared_ptr<DatasetNode> root_ir, bool *const modified) override;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_OPT_PRE_SHUFFLE_PUSHDOWN_PASS_H_
@@ -28,6 +28,7 @@
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/serdes.h"
 #endif
+#include "minddata/dataset/engine/datasetops/device_queue_op.h"
 #include "minddata/dataset/util/task_manager.h"
 
 namespace mindspore {
@@ -37,6 +38,7 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       profiling_manager_(profiling_mgr),
       tree_modifier_(std::make_unique<TreeModifier>(tree_adapter_)),
       leaf_op_id_(-1),
+      last_device_underflow_count_(0),
       cur_epoch_running_(1),
       last_epoch_autotuned_(0),
       cur_step_running_(1),
@@ -53,6 +55,8 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       phase_3_ID_(0),
       avg_batch_time(0.0),
       phase_3_prev_avg_(0.0),
+      model_based_(GlobalContext::config_manager()->enable_autotune_model()),
+      model_iterations_(0),
       save_autoconfig_(GlobalContext::config_manager()->save_autoconfig()) {
   max_workers_ = GlobalContext::config_manager()->num_cpu_threads();
   autotune_json_filepath_ = GlobalContext::config_manager()->get_autotune_json_filepath();
@@ -61,6 +65,10 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
 Status AutoTune::Main() {
   TaskManager::FindMe()->Post();
   MS_LOG(INFO) << "Dataset AutoTune thread has started.";
+  if (model_based_ && step_gap_ == 0) {
+    // The model is solved from the stats of a few steps, no need to wait for the whole epoch.
+    step_gap_ = MODEL_STEP_GAP;
+  }
   if (step_gap_ != 0) {
     mode_ = AutoTuneMode::kAutoTuneModeStep;
   } else {
@@ -466,6 +474,9 @@ Status AutoTune::TrackPipelineTime() {
 }
 
 Status AutoTune::RunIteration() {
+  if (model_based_) {
+    return AnalyseModel();
+  }
   RETURN_IF_NOT_OK(TrackPipelineTime());
   if (AT_phase_ == AutoTunePhase::kAutoTunePhaseTime) {
     RETURN_IF_NOT_OK(AnalyseTime());
@@ -517,11 +528,25 @@ Status AutoTune::GetEmptyQueueFrequency(float *empty_freq) const {
   return Status::OK();
 }
 
+Status AutoTune::GetDeviceUnderflows(int64_t *underflows) {
+  RETURN_UNEXPECTED_IF_NULL(underflows);
+  *underflows = 0;
+  auto device_queue_op = std::dynamic_pointer_cast<DeviceQueueOp>(tree_adapter_->tree_->root());
+  if (device_queue_op != nullptr) {
+    int64_t underflow_count = device_queue_op->DeviceUnderflowCount();
+    *underflows = underflow_count - last_device_underflow_count_;
+    last_device_underflow_count_ = underflow_count;
+  }
+  return Status::OK();
+}
+
 Status AutoTune::IsDSaBottleneck(bool *isBottleneck) {
   double usage_avg_last, avg_size, avg_capacity;
   RETURN_IF_NOT_OK(GetConnectorUtil(&usage_avg_last, &avg_size, &avg_capacity));
   float empty_freq = 0;
   RETURN_IF_NOT_OK(GetEmptyQueueFrequency(&empty_freq));
+  int64_t device_underflows = 0;
+  RETURN_IF_NOT_OK(GetDeviceUnderflows(&device_underflows));
   if (mode_ == AutoTuneMode::kAutoTuneModeStep) {
     MS_LOG(INFO) << "Step # " << cur_step_running_ << ". Status:";
   } else {
@@ -530,9 +555,13 @@ Status AutoTune::IsDSaBottleneck(bool *isBottleneck) {
   // Reporting values
   MS_LOG(INFO) << "Device Connector Size: " << avg_size << ", Connector Capacity: " << avg_capacity
                << ", Utilization: " << (usage_avg_last * TO_PERCENT) << "%"
-               << ", Empty Freq: " << (empty_freq * TO_PERCENT) << "% ";
+               << ", Empty Freq: " << (empty_freq * TO_PERCENT) << "%, Device Underflows: " << device_underflows;
   // Decision
-  if (usage_avg_last < DEVICE_CONNECTOR_UTIL_THRESHOLD) {
+  if (device_underflows > 0) {
+    MS_LOG(INFO) << "Device queue is drained " << device_underflows
+                 << " times, dataset pipeline performance may benefit from tuning.";
+    *isBottleneck = true;
+  } else if (usage_avg_last < DEVICE_CONNECTOR_UTIL_THRESHOLD) {
     MS_LOG(INFO) << "Utilization: " << (usage_avg_last * TO_PERCENT) << "% < "
                  << (DEVICE_CONNECTOR_UTIL_THRESHOLD * TO_PERCENT)
                  << "% threshold, dataset pipeline performance may benefit from tuning.";
@@ -654,6 +683,122 @@ Status AutoTune::AnalyseTime() {
   return Status::OK();
 }
 
+Status AutoTune::BuildPipelineModel(std::unique_ptr<PipelineModel> *model) {
+  std::vector<int32_t> batch_times;
+  RETURN_IF_NOT_OK(profiling_manager_->GetBatchTimeByStep(last_step_autotuned_, cur_step_running_ - 1, &batch_times));
+  double batch_time = Mean(batch_times);
+  if (batch_time <= 0) {
+    MS_LOG(INFO) << "No batch time is profiled yet, skip building the pipeline model.";
+    return Status::OK();
+  }
+  std::map<int32_t, int32_t> ops_num_workers;
+  RETURN_IF_NOT_OK(GetOpsNumWorker(&ops_num_workers));
+  std::map<int32_t, double> out_ops_queue_util;
+  std::map<int32_t, double> in_ops_queue_util;
+  RETURN_IF_NOT_OK(GetOpsQueueUtil(&out_ops_queue_util, &in_ops_queue_util));
+  std::map<int32_t, double> ops_cpu_util;
+  RETURN_IF_NOT_OK(GetOpsCpuUtil(&ops_cpu_util));
+  std::vector<OpServiceStats> ops_stats;
+  for (const auto &[op_id, op] : ops_) {
+    OpServiceStats stats;
+    stats.op_id = op_id;
+    DatasetOp *parent = nullptr;
+    op->Parent(&parent, 0);
+    stats.parent_id = parent == nullptr ? -1 : parent->id();
+    stats.num_workers = ops_num_workers[op_id];
+    stats.tunable = stats.num_workers > 0 && !op->inlined() && op->Name() != "DeviceQueueOp" && !SkipOpsCheck(op_id);
+    // The CPU utilization is the percentage of all the CPU cores.
+    stats.busy_cores = ops_cpu_util[op_id] / TO_PERCENT * max_workers_;
+    double input_queue_util = in_ops_queue_util[op_id];
+    double output_queue_util = out_ops_queue_util[op_id];
+    stats.saturated = !op->inlined() && input_queue_util - output_queue_util > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD;
+    MS_LOG(DEBUG) << "Op (" << op->NameWithID() << ") workers=" << stats.num_workers
+                  << ", busy cores=" << stats.busy_cores << ", saturated=" << stats.saturated;
+    (void)ops_stats.emplace_back(stats);
+  }
+  *model = std::make_unique<PipelineModel>(std::move(ops_stats), batch_time);
+  return Status::OK();
+}
+
+Status AutoTune::GetPipelineBudget(PipelineBudget *budget) {
+  budget->cpu_cores = max_workers_;
+  budget->min_queue_size = MIN_QUEUE_SIZE;
+  budget->max_queue_size = MAX_QUEUE_SIZE;
+  budget->target_speedup = MODEL_TARGET_SPEEDUP;
+  budget->queue_slots = 0;
+#ifndef ENABLE_ANDROID
+  std::vector<float> pss;
+  RETURN_IF_NOT_OK(profiling_manager_->GetMainProcessMemoryInfoByStep(ProcessMemoryMetric::kPSS, last_step_autotuned_,
+                                                                      cur_step_running_ - 1, &pss));
+  std::vector<float> available;
+  RETURN_IF_NOT_OK(profiling_manager_->GetSystemMemoryInfoByStep(
+    SystemMemoryMetric::kMemoryAvailable, last_step_autotuned_, cur_step_running_ - 1, &available));
+  double queued_rows = 0;
+  for (const auto &[op_id, op] : ops_) {
+    if (op->inlined()) {
+      continue;
+    }
+    std::vector<int32_t> sizes;
+    RETURN_IF_NOT_OK(
+      profiling_manager_->GetConnectorSizeByStep(op_id, last_step_autotuned_, cur_step_running_ - 1, &sizes));
+    queued_rows += Mean(sizes);
+  }
+  double process_memory = Mean(pss);
+  if (queued_rows >= 1 && process_memory > 0) {
+    // The process memory is an upper bound of the memory of the buffered rows, so the row size is overestimated.
+    double row_memory = process_memory / queued_rows;
+    budget->queue_slots = static_cast<int64_t>(Mean(available) * MODEL_MEMORY_FRACTION / row_memory + queued_rows);
+  }
+#endif
+  return Status::OK();
+}
+
+Status AutoTune::AnalyseModel() {
+  bool isBottleneck = false;
+  RETURN_IF_NOT_OK(IsDSaBottleneck(&isBottleneck));
+  if (!isBottleneck) {
+    MS_LOG(INFO) << "Dataset pipeline is not the bottleneck, model based AutoTune is complete.";
+    AT_phase_ = AutoTunePhase::kAutoTuneEnd;
+    return Status::OK();
+  }
+  std::unique_ptr<PipelineModel> model;
+  RETURN_IF_NOT_OK(BuildPipelineModel(&model));
+  if (model == nullptr) {
+    return Status::OK();
+  }
+  PipelineBudget budget;
+  RETURN_IF_NOT_OK(GetPipelineBudget(&budget));
+  std::map<int32_t, OpTuneConfig> configs;
+  RETURN_IF_NOT_OK(model->Solve(budget, &configs));
+  std::map<int32_t, int32_t> solved_workers;
+  for (const auto &[op_id, config] : configs) {
+    solved_workers[op_id] = config.num_workers;
+  }
+  MS_LOG(INFO) << "Pipeline model throughput: current " << model->Throughput({}) << " batches/ms, solved "
+               << model->Throughput(solved_workers) << " batches/ms, queue slot budget: " << budget.queue_slots;
+  bool changed = false;
+  for (const auto &[op_id, config] : configs) {
+    int32_t num_workers = ops_[op_id]->NumWorkers();
+    if (config.num_workers != num_workers) {
+      int32_t requested_workers = config.num_workers;
+      RETURN_IF_NOT_OK(RequestNumWorkerChange(op_id, num_workers, &requested_workers));
+      changed = true;
+    }
+    int64_t queue_capacity;
+    RETURN_IF_NOT_OK(GetOpConnectorCapacity(op_id, &queue_capacity));
+    if (config.queue_size != queue_capacity) {
+      RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, queue_capacity, config.queue_size));
+      changed = true;
+    }
+  }
+  ++model_iterations_;
+  if (!changed || model_iterations_ >= MODEL_MAX_ITERATIONS) {
+    MS_LOG(INFO) << "Model based AutoTune is complete after " << model_iterations_ << " iterations.";
+    AT_phase_ = AutoTunePhase::kAutoTuneEnd;
+  }
+  return Status::OK();
+}
+
 bool AutoTune::MemoryPhaseCompareMetric(double prev_avg, double cur_avg) {
   double lower_bound = prev_avg - (prev_avg * MEMORY_COMPARISON_LOWER_BOUND_PERCENT);
   // If cur_avg worse than lower bound - negative impact on performance
@@ -27,6 +27,7 @@
 #include "minddata/dataset/engine/execution_tree.h"
 #include "minddata/dataset/engine/tree_adapter.h"
 #include "minddata/dataset/engine/tree_modifier.h"
+#include "minddata/dataset/engine/perf/pipeline_model.h"
 #include "minddata/dataset/engine/perf/profiling.h"
 
 namespace mindspore {
@@ -111,6 +112,11 @@ class AutoTune {
   /// \return status code
   Status GetEmptyQueueFrequency(float *empty_freq) const;
 
+  /// Fetches the number of times the device queue is drained since the last call, only for GPU sink mode
+  /// \param[out] underflows int64_t to return the number of underflows
+  /// \return status code
+  Status GetDeviceUnderflows(int64_t *underflows);
+
   /// Check if the dataset pipeline is the bottleneck
   /// \param[out] isBottleneck bool
   /// \return Status code
@@ -155,6 +161,11 @@ class AutoTune {
   const float MEMORY_COMPARISON_LOWER_BOUND_PERCENT = 0.02;
   const float QUEUE_REDUCTION_PERCENTAGE_EPOCH = 0.5;
   const float QUEUE_REDUCTION_PERCENTAGE_STEP = 0.8;
+  // Model specifics
+  const int64_t MODEL_STEP_GAP = 50;
+  const int32_t MODEL_MAX_ITERATIONS = 4;
+  const double MODEL_TARGET_SPEEDUP = 2.0;
+  const float MODEL_MEMORY_FRACTION = 0.5;
 
   /// Get the out connector capacity of the operator
   /// \param[in] op_id operator id
@@ -192,6 +203,21 @@ class AutoTune {
   /// \return Status code
   Status AnalyseMemory();
 
+  /// Model based AutoTune algorithm, solves the workers and queue sizes of all ops by the queueing model of the
+  /// pipeline, and ends when the solution is stable
+  /// \return Status code
+  Status AnalyseModel();
+
+  /// Build the queueing model of the pipeline from the stats profiled since the last tuning
+  /// \param[out] model The pipeline model
+  /// \return Status code
+  Status BuildPipelineModel(std::unique_ptr<PipelineModel> *model);
+
+  /// Get the CPU and memory budget of the tunable ops
+  /// \param[out] budget The budget for the pipeline model
+  /// \return Status code
+  Status GetPipelineBudget(PipelineBudget *budget);
+
   /// Send a ChangeRequest to the operator to update the number of workers
   /// \param op_id operator ID
   /// \param old_workers Old number of workers for logging purposes
@@ -260,6 +286,8 @@ class AutoTune {
   int32_t leaf_op_id_;
   /// vector of pipeline time per epoch
   std::vector<double> avg_pipeline_times_;
+  /// the device queue underflow count at the last tuning
+  int64_t last_device_underflow_count_;
 
   /// the current epoch and step indices (starts from 1)
   int32_t cur_epoch_running_;
@@ -289,6 +317,10 @@ class AutoTune {
   double phase_3_prev_avg_;
   std::vector<int32_t> OP_values;
 
+  // Model based tuning
+  bool model_based_;
+  int32_t model_iterations_;
+
   /// True if should save AutoTune configuration
   bool save_autoconfig_;
 
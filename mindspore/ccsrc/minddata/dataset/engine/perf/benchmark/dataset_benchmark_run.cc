@@ -0,0 +1,631 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/perf/benchmark/dataset_benchmark_run.h"
+
+#include <opencv2/imgcodecs.hpp>
+#include <opencv2/imgproc.hpp>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/core/global_context.h"
+#include "minddata/dataset/engine/perf/profiling.h"
+#include "minddata/dataset/include/dataset/text.h"
+#include "minddata/dataset/include/dataset/vision.h"
+#include "minddata/dataset/util/path.h"
+#include "proto/example.pb.h"
+#include "utils/system/crc32c.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr char kImageFolderPipeline[] = "image_folder";
+constexpr char kMindRecordPipeline[] = "mindrecord";
+constexpr char kTFRecordPipeline[] = "tfrecord";
+constexpr char kTextPipeline[] = "text";
+const std::vector<std::string> kPipelineNames = {kImageFolderPipeline, kMindRecordPipeline, kTFRecordPipeline,
+                                                 kTextPipeline};
+
+constexpr char kMindRecordFile[] = "benchmark.mindrecord";
+constexpr char kTextFile[] = "benchmark.txt";
+constexpr int32_t kNumClasses = 4;
+constexpr int32_t kNumTFRecordFiles = 4;
+constexpr int32_t kEmbeddingSize = 64;
+constexpr int32_t kMinWordsPerLine = 16;
+constexpr int32_t kMaxWordsPerLine = 64;
+constexpr int32_t kVocabSize = 4096;
+constexpr int32_t kCropSize = 224;
+constexpr int32_t kJpegQuality = 90;
+// Sample the cpu and the memory densely, as the epochs of the synthetic data take only a few seconds.
+constexpr uint32_t kSamplingIntervalMs = 10;
+// The op ids are assigned in sequence from 0, stop at the first missing one.
+constexpr int32_t kMaxOpId = 64;
+// The seed of the synthetic data, so that all the runs read the same content.
+constexpr uint32_t kDataSeed = 5489;
+
+std::vector<std::string> SplitString(const std::string &str, char delim) {
+  std::vector<std::string> items;
+  std::stringstream ss(str);
+  std::string item;
+  while (std::getline(ss, item, delim)) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+std::string ImageFileName(int32_t row_id) {
+  std::stringstream ss;
+  ss << std::setw(6) << std::setfill('0') << row_id << ".jpg";
+  return ss.str();
+}
+
+Status WriteBinaryFile(const std::string &file_name, const std::string &content) {
+  std::ofstream writer(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(writer.is_open(), "Failed to open file: " + file_name);
+  (void)writer.write(content.data(), static_cast<std::streamsize>(content.size()));
+  CHECK_FAIL_RETURN_UNEXPECTED(writer.good(), "Failed to write file: " + file_name);
+  writer.close();
+  return Status::OK();
+}
+
+// Append one record in the TFRecord framing: the length, the masked crc of the length, the data and its masked crc.
+void AppendTFRecord(const std::string &data, std::ofstream *writer) {
+  auto length = static_cast<uint64_t>(data.size());
+  uint32_t length_crc = system::Crc32c::GetMaskCrc32cValue(reinterpret_cast<char *>(&length), sizeof(uint64_t));
+  uint32_t data_crc = system::Crc32c::GetMaskCrc32cValue(data.data(), data.size());
+  (void)writer->write(reinterpret_cast<char *>(&length), static_cast<std::streamsize>(sizeof(uint64_t)));
+  (void)writer->write(reinterpret_cast<char *>(&length_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+  (void)writer->write(data.data(), static_cast<std::streamsize>(data.size()));
+  (void)writer->write(reinterpret_cast<char *>(&data_crc), static_cast<std::streamsize>(sizeof(uint32_t)));
+}
+
+float Average(const std::vector<uint16_t> &values) {
+  if (values.empty()) {
+    return 0;
+  }
+  float sum = 0;
+  for (auto value : values) {
+    sum += value;
+  }
+  return sum / values.size();
+}
+}  // namespace
+
+DatasetBenchmarkRun::DatasetBenchmarkRun()
+    : data_dir_(kDftBenchmarkDataDir),
+      pipelines_(kPipelineNames),
+      num_rows_(kDftBenchmarkNumRows),
+      image_size_(kDftBenchmarkImageSize),
+      batch_size_(kDftBenchmarkBatchSize),
+      num_epochs_(kDftBenchmarkNumEpochs),
+      num_workers_(kDftBenchmarkWorkers),
+      tolerance_(kDftBenchmarkTolerance),
+      update_baseline_(false) {}
+
+void DatasetBenchmarkRun::PrintHelp() {
+  std::cout << "Options:\n"
+               "    -h,--help:             Show this usage message\n"
+               "    -d,--data_dir:         Set the directory of the synthetic source files. Default = "
+            << kDftBenchmarkDataDir
+            << "\n"
+               "    -p,--pipelines:        Set the comma separated pipelines to run. Default = "
+            << kImageFolderPipeline << "," << kMindRecordPipeline << "," << kTFRecordPipeline << "," << kTextPipeline
+            << "\n"
+               "    -s,--num_rows:         Set the number of rows of each source. Default = "
+            << kDftBenchmarkNumRows
+            << "\n"
+               "    -i,--image_size:       Set the height and width of the synthetic images. Default = "
+            << kDftBenchmarkImageSize
+            << "\n"
+               "    -b,--batch_size:       Set the batch size of the image pipeline. Default = "
+            << kDftBenchmarkBatchSize
+            << "\n"
+               "    -e,--epoch:            Set the number of epochs, the first one is the warm up. Default = "
+            << kDftBenchmarkNumEpochs
+            << "\n"
+               "    -w,--workers:          Set the number of parallel workers. Default = "
+            << kDftBenchmarkWorkers
+            << "\n"
+               "    -c,--baseline:         Compare the results with the baseline file, and fail on regressions\n"
+               "    -t,--tolerance:        Set the relative tolerance of the regressions. Default = "
+            << kDftBenchmarkTolerance
+            << "\n"
+               "       --update_baseline:  Save the results to the baseline file instead of comparing\n";
+}
+
+int32_t DatasetBenchmarkRun::ProcessArgsHelper(int32_t opt) {
+  int32_t rc = 0;
+  try {
+    switch (opt) {
+      case 'd': {
+        data_dir_ = optarg;
+        break;
+      }
+
+      case 'p': {
+        pipelines_ = SplitString(optarg, ',');
+        break;
+      }
+
+      case 's': {
+        num_rows_ = std::stoi(optarg);
+        break;
+      }
+
+      case 'i': {
+        image_size_ = std::stoi(optarg);
+        break;
+      }
+
+      case 'b': {
+        batch_size_ = std::stoi(optarg);
+        break;
+      }
+
+      case 'e': {
+        num_epochs_ = std::stoi(optarg);
+        break;
+      }
+
+      case 'w': {
+        num_workers_ = std::stoi(optarg);
+        break;
+      }
+
+      case 'c': {
+        baseline_file_ = optarg;
+        break;
+      }
+
+      case 't': {
+        tolerance_ = std::stof(optarg);
+        break;
+      }
+
+      case 'h':  // -h or --help
+        PrintHelp();
+        rc = -1;
+        break;
+
+      case ':':
+        std::cerr << "Missing argument for option " << char(optopt) << std::endl;
+        rc = -1;
+        break;
+
+      case '?':  // Unrecognized option
+      default:
+        std::cerr << "Unknown option " << char(optopt) << std::endl;
+        PrintHelp();
+        rc = -1;
+        break;
+    }
+  } catch (const std::exception &e) {
+    PrintHelp();
+    rc = -1;
+  }
+  return rc;
+}
+
+int32_t DatasetBenchmarkRun::ProcessArgs(int argc, char **argv) {
+  int update_baseline = 0;
+  const char *const short_opts = ":d:p:s:i:b:e:w:c:t:h";
+  const option long_opts[] = {{"data_dir", required_argument, nullptr, 'd'},
+                              {"pipelines", required_argument, nullptr, 'p'},
+                              {"num_rows", required_argument, nullptr, 's'},
+                              {"image_size", required_argument, nullptr, 'i'},
+                              {"batch_size", required_argument, nullptr, 'b'},
+                              {"epoch", required_argument, nullptr, 'e'},
+                              {"workers", required_argument, nullptr, 'w'},
+                              {"baseline", required_argument, nullptr, 'c'},
+                              {"tolerance", required_argument, nullptr, 't'},
+                              {"update_baseline", no_argument, &update_baseline, 1},
+                              {"help", no_argument, nullptr, 'h'},
+                              {nullptr, no_argument, nullptr, 0}};
+
+  int32_t rc = 0;
+  while (rc == 0) {
+    int32_t option_index;
+    const auto opt = getopt_long(argc, argv, short_opts, long_opts, &option_index);
+    if (opt == -1) {
+      if (optind < argc) {
+        rc = -1;
+        std::cerr << "Unknown arguments: ";
+        while (optind < argc) {
+          std::cerr << argv[optind++] << " ";
+        }
+        std::cerr << std::endl;
+      }
+      break;
+    }
+    if (opt == 0) {
+      update_baseline_ = (update_baseline != 0);
+      continue;
+    }
+    rc = ProcessArgsHelper(opt);
+  }
+  if (rc != 0) {
+    return rc;
+  }
+
+  for (const auto &name : pipelines_) {
+    if (std::find(kPipelineNames.begin(), kPipelineNames.end(), name) == kPipelineNames.end()) {
+      std::cerr << "Unknown pipeline " << name << "." << std::endl;
+      return -1;
+    }
+  }
+  if (pipelines_.empty() || num_rows_ <= 0 || image_size_ < kCropSize || batch_size_ <= 0 || num_epochs_ <= 0 ||
+      num_workers_ <= 0) {
+    std::cerr << "The pipelines must be non-empty, the image size must be at least " << kCropSize
+              << ", and the other numbers must be positive." << std::endl;
+    return -1;
+  }
+  if (tolerance_ < 0 || tolerance_ >= 1) {
+    std::cerr << "Tolerance must be in [0, 1)." << std::endl;
+    return -1;
+  }
+  if (update_baseline_ && baseline_file_.empty()) {
+    std::cerr << "The baseline file must be given to update the baseline." << std::endl;
+    return -1;
+  }
+  return 0;
+}
+
+void DatasetBenchmarkRun::Print(std::ostream &out) const {
+  out << "Data directory: " << data_dir_ << "\n"
+      << "Pipelines: ";
+  for (const auto &name : pipelines_) {
+    out << name << " ";
+  }
+  out << "\n"
+      << "Number of rows: " << num_rows_ << "\n"
+      << "Image size: " << image_size_ << "\n"
+      << "Batch size: " << batch_size_ << "\n"
+      << "Number of epochs: " << num_epochs_ << "\n"
+      << "Number of workers: " << num_workers_ << "\n"
+      << "Baseline: " << (baseline_file_.empty() ? "none" : baseline_file_) << "\n"
+      << "Tolerance: " << tolerance_;
+}
+
+Status DatasetBenchmarkRun::GenerateImageFolder() {
+  Path folder = Path(data_dir_) / kImageFolderPipeline;
+  if (folder.Exists()) {
+    return Status::OK();
+  }
+  std::mt19937 rnd(kDataSeed);
+  for (int32_t class_id = 0; class_id < kNumClasses; ++class_id) {
+    RETURN_IF_NOT_OK((folder / ("class_" + std::to_string(class_id))).CreateDirectories());
+  }
+  std::vector<uint8_t> jpeg;
+  for (int32_t row_id = 0; row_id < num_rows_; ++row_id) {
+    // The blurred noise is compressed to a size closer to the natural images than the raw noise.
+    cv::Mat image(image_size_, image_size_, CV_8UC3);
+    cv::randu(image, cv::Scalar::all(0), cv::Scalar::all(UINT8_MAX));
+    cv::GaussianBlur(image, image, cv::Size(5, 5), 0);
+    jpeg.clear();
+    CHECK_FAIL_RETURN_UNEXPECTED(cv::imencode(".jpg", image, jpeg, {cv::IMWRITE_JPEG_QUALITY, kJpegQuality}),
+                                 "Failed to encode the synthetic image.");
+    Path file = folder / ("class_" + std::to_string(rnd() % kNumClasses)) / ImageFileName(row_id);
+    RETURN_IF_NOT_OK(WriteBinaryFile(file.ToString(), std::string(jpeg.begin(), jpeg.end())));
+  }
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::GenerateMindRecord() {
+  Path file = Path(data_dir_) / kMindRecordFile;
+  if (file.Exists()) {
+    return Status::OK();
+  }
+  // Save the encoded images with the labels, which is how the image datasets are usually converted to MindRecord.
+  RETURN_IF_NOT_OK(GenerateImageFolder());
+  auto ds = ImageFolder((Path(data_dir_) / kImageFolderPipeline).ToString(), false,
+                        std::make_shared<SequentialSampler>());
+  CHECK_FAIL_RETURN_UNEXPECTED(ds != nullptr && ds->Save(file.ToString()),
+                               "Failed to save the synthetic MindRecord file: " + file.ToString());
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::GenerateTFRecord() {
+  Path folder = Path(data_dir_) / kTFRecordPipeline;
+  if (folder.Exists()) {
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(folder.CreateDirectories());
+  std::vector<std::ofstream> writers(kNumTFRecordFiles);
+  for (int32_t file_id = 0; file_id < kNumTFRecordFiles; ++file_id) {
+    auto file_name = (folder / (std::to_string(file_id) + ".tfrecord")).ToString();
+    writers[file_id].open(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    CHECK_FAIL_RETURN_UNEXPECTED(writers[file_id].is_open(), "Failed to open file: " + file_name);
+  }
+  std::mt19937 rnd(kDataSeed);
+  std::uniform_real_distribution<float> float_dist(-1.0, 1.0);
+  std::uniform_int_distribution<int32_t> byte_dist(0, UINT8_MAX);
+  // The bytes feature has the size of a small encoded image, and the float feature is an embedding.
+  const int32_t bytes_size = image_size_ * image_size_ / kNumClasses;
+  std::string bytes(bytes_size, '\0');
+  std::string record;
+  for (int32_t row_id = 0; row_id < num_rows_; ++row_id) {
+    dataengine::Example example;
+    auto feature_map = example.mutable_features()->mutable_feature();
+    std::generate(bytes.begin(), bytes.end(), [&rnd, &byte_dist]() { return static_cast<char>(byte_dist(rnd)); });
+    (*feature_map)["image"].mutable_bytes_list()->add_value(bytes);
+    (*feature_map)["label"].mutable_int64_list()->add_value(row_id % kNumClasses);
+    auto embedding = (*feature_map)["embedding"].mutable_float_list();
+    for (int32_t i = 0; i < kEmbeddingSize; ++i) {
+      embedding->add_value(float_dist(rnd));
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(example.SerializeToString(&record), "Failed to serialize the synthetic example.");
+    AppendTFRecord(record, &writers[row_id % kNumTFRecordFiles]);
+  }
+  for (auto &writer : writers) {
+    CHECK_FAIL_RETURN_UNEXPECTED(writer.good(), "Failed to write the synthetic TFRecord files.");
+    writer.close();
+  }
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::GenerateTextFile() {
+  Path file = Path(data_dir_) / kTextFile;
+  if (file.Exists()) {
+    return Status::OK();
+  }
+  std::mt19937 rnd(kDataSeed);
+  std::uniform_int_distribution<int32_t> letter_dist('a', 'z');
+  std::uniform_int_distribution<int32_t> word_len_dist(2, 10);
+  std::vector<std::string> vocab(kVocabSize);
+  for (auto &word : vocab) {
+    word.resize(word_len_dist(rnd));
+    std::generate(word.begin(), word.end(), [&rnd, &letter_dist]() { return static_cast<char>(letter_dist(rnd)); });
+  }
+  // Pick the words by the zipf like distribution of the natural languages.
+  std::vector<double> weights(kVocabSize);
+  for (int32_t i = 0; i < kVocabSize; ++i) {
+    weights[i] = 1.0 / (i + 1);
+  }
+  std::discrete_distribution<int32_t> word_dist(weights.begin(), weights.end());
+  std::uniform_int_distribution<int32_t> line_len_dist(kMinWordsPerLine, kMaxWordsPerLine);
+  std::string content;
+  for (int32_t row_id = 0; row_id < num_rows_; ++row_id) {
+    auto num_words = line_len_dist(rnd);
+    for (int32_t i = 0; i < num_words; ++i) {
+      content += vocab[word_dist(rnd)];
+      content += (i + 1 == num_words) ? '\n' : ' ';
+    }
+  }
+  return WriteBinaryFile(file.ToString(), content);
+}
+
+Status DatasetBenchmarkRun::BuildPipeline(const std::string &name, std::shared_ptr<Dataset> *ds) {
+  RETURN_UNEXPECTED_IF_NULL(ds);
+  Path data_dir(data_dir_);
+  if (name == kImageFolderPipeline) {
+    RETURN_IF_NOT_OK(GenerateImageFolder());
+    std::vector<std::shared_ptr<TensorTransform>> transforms = {
+      std::make_shared<vision::Decode>(), std::make_shared<vision::RandomResizedCrop>(std::vector<int32_t>{kCropSize}),
+      std::make_shared<vision::RandomHorizontalFlip>(),
+      std::make_shared<vision::Normalize>(std::vector<float>{121.0, 115.0, 100.0},
+                                          std::vector<float>{70.0, 68.0, 71.0}),
+      std::make_shared<vision::HWC2CHW>()};
+    *ds = ImageFolder((data_dir / kImageFolderPipeline).ToString(), false, std::make_shared<SequentialSampler>());
+    *ds = (*ds)->Map(transforms, {"image"});
+    *ds = (*ds)->Batch(batch_size_, true);
+  } else if (name == kMindRecordPipeline) {
+    RETURN_IF_NOT_OK(GenerateMindRecord());
+    *ds = MindData((data_dir / kMindRecordFile).ToString(), {"image", "label"}, std::make_shared<SequentialSampler>());
+  } else if (name == kTFRecordPipeline) {
+    RETURN_IF_NOT_OK(GenerateTFRecord());
+    std::vector<std::string> files;
+    for (int32_t file_id = 0; file_id < kNumTFRecordFiles; ++file_id) {
+      files.push_back((data_dir / kTFRecordPipeline / (std::to_string(file_id) + ".tfrecord")).ToString());
+    }
+    auto schema = Schema();
+    RETURN_IF_NOT_OK(schema->add_column("image", mindspore::DataType::kNumberTypeUInt8));
+    RETURN_IF_NOT_OK(schema->add_column("label", mindspore::DataType::kNumberTypeInt64, {1}));
+    RETURN_IF_NOT_OK(schema->add_column("embedding", mindspore::DataType::kNumberTypeFloat32, {kEmbeddingSize}));
+    *ds = TFRecord(files, schema, {}, 0, ShuffleMode::kFalse);
+  } else if (name == kTextPipeline) {
+    RETURN_IF_NOT_OK(GenerateTextFile());
+    *ds = TextFile({(data_dir / kTextFile).ToString()}, 0, ShuffleMode::kFalse);
+    *ds = (*ds)->Map({std::make_shared<text::WhitespaceTokenizer>()}, {"text"});
+  } else {
+    RETURN_STATUS_UNEXPECTED("Unknown pipeline: " + name);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(*ds != nullptr, "Failed to build the pipeline: " + name);
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::CollectProfiling(PipelineResult *result) {
+  RETURN_UNEXPECTED_IF_NULL(result);
+  auto profiling_manager = GlobalContext::profiling_manager();
+  int32_t num_epochs = profiling_manager->GetNumOfProfiledEpochs();
+  int32_t first_epoch = num_epochs > 1 ? 2 : 1;
+  std::vector<float> rss;
+  for (int32_t epoch = 1; epoch <= num_epochs; ++epoch) {
+    rss.clear();
+    RETURN_IF_NOT_OK(profiling_manager->GetMainProcessMemoryInfoByEpoch(ProcessMemoryMetric::kRSS, epoch, &rss));
+    if (!rss.empty()) {
+      result->peak_rss_mb = std::max(result->peak_rss_mb, *std::max_element(rss.begin(), rss.end()));
+    }
+  }
+
+  std::vector<uint16_t> user_util;
+  std::vector<uint16_t> sys_util;
+  for (int32_t op_id = 0; op_id < kMaxOpId; ++op_id) {
+    OpCpuUtil op_util;
+    bool found = true;
+    for (int32_t epoch = first_epoch; epoch <= num_epochs; ++epoch) {
+      user_util.clear();
+      sys_util.clear();
+      if (profiling_manager->GetUserCpuUtilByEpoch(op_id, epoch, &user_util).IsError() ||
+          profiling_manager->GetSysCpuUtilByEpoch(op_id, epoch, &sys_util).IsError()) {
+        found = false;
+        break;
+      }
+      op_util.user += Average(user_util);
+      op_util.sys += Average(sys_util);
+    }
+    if (!found || num_epochs < first_epoch) {
+      break;
+    }
+    auto num_measured = static_cast<float>(num_epochs - first_epoch + 1);
+    result->op_cpu_util[op_id] = {op_util.user / num_measured, op_util.sys / num_measured};
+  }
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::RunPipeline(const std::string &name, PipelineResult *result) {
+  RETURN_UNEXPECTED_IF_NULL(result);
+  result->name = name;
+  std::shared_ptr<Dataset> ds;
+  RETURN_IF_NOT_OK(BuildPipeline(name, &ds));
+
+  // The profiler is initialized again for each pipeline, as it only samples the first tree registered.
+  auto profiling_manager = GlobalContext::profiling_manager();
+  RETURN_IF_NOT_OK(profiling_manager->Init());
+  RETURN_IF_NOT_OK(profiling_manager->Start());
+  std::shared_ptr<Iterator> iter = ds->CreateIterator({}, num_epochs_);
+  if (iter == nullptr) {
+    (void)profiling_manager->Stop();
+    RETURN_STATUS_UNEXPECTED("Failed to create the iterator of the pipeline: " + name);
+  }
+
+  Status rc;
+  std::vector<mindspore::MSTensor> row;
+  for (int32_t epoch = 0; epoch < num_epochs_ && rc.IsOk(); ++epoch) {
+    int64_t num_rows = 0;
+    auto start = std::chrono::steady_clock::now();
+    rc = iter->GetNextRow(&row);
+    while (rc.IsOk() && !row.empty()) {
+      ++num_rows;
+      rc = iter->GetNextRow(&row);
+    }
+    std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start;
+    // The first epoch starts the threads and fills the caches of the file system, so it is the warm up.
+    if (epoch > 0 || num_epochs_ == 1) {
+      result->num_rows += num_rows;
+      result->seconds += cost.count();
+    }
+  }
+  iter->Stop();
+  if (rc.IsOk()) {
+    rc = CollectProfiling(result);
+  }
+  RETURN_IF_NOT_OK(profiling_manager->Stop());
+  RETURN_IF_NOT_OK(rc);
+  CHECK_FAIL_RETURN_UNEXPECTED(result->num_rows > 0, "The pipeline " + name + " produces no rows.");
+  result->rows_per_second = result->seconds > 0 ? result->num_rows / result->seconds : 0;
+  return Status::OK();
+}
+
+void DatasetBenchmarkRun::PrintResult(const PipelineResult &result) {
+  std::cout << std::fixed << std::setprecision(2) << "Pipeline " << result.name << ": " << result.num_rows
+            << " rows in " << result.seconds << " s, " << result.rows_per_second << " rows/s, peak rss "
+            << result.peak_rss_mb << " MB\n";
+  for (const auto &[op_id, util] : result.op_cpu_util) {
+    std::cout << "    op " << op_id << ": user " << util.user << "%, sys " << util.sys << "%\n";
+  }
+  std::cout << std::flush;
+}
+
+nlohmann::json DatasetBenchmarkRun::BenchmarkConfig() const {
+  return {{"num_rows", num_rows_},     {"image_size", image_size_},   {"batch_size", batch_size_},
+          {"num_epochs", num_epochs_}, {"num_workers", num_workers_}};
+}
+
+Status DatasetBenchmarkRun::CompareBaseline(const std::vector<PipelineResult> &results, bool *regressed) {
+  RETURN_UNEXPECTED_IF_NULL(regressed);
+  *regressed = false;
+  std::ifstream reader(baseline_file_);
+  CHECK_FAIL_RETURN_UNEXPECTED(reader.is_open(), "Failed to open the baseline file: " + baseline_file_);
+  nlohmann::json baseline;
+  try {
+    reader >> baseline;
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED("Failed to parse the baseline file: " + baseline_file_ + ", " + e.what());
+  }
+  // The numbers of the different configs are not comparable.
+  CHECK_FAIL_RETURN_UNEXPECTED(baseline.value("config", nlohmann::json()) == BenchmarkConfig(),
+                               "The baseline is recorded with a different config: " +
+                                 baseline.value("config", nlohmann::json()).dump());
+  auto pipelines = baseline.value("pipelines", nlohmann::json::object());
+  for (const auto &result : results) {
+    if (!pipelines.contains(result.name)) {
+      std::cout << "Pipeline " << result.name << " has no baseline.\n";
+      continue;
+    }
+    const auto &base = pipelines[result.name];
+    double base_rows_per_second = base.value("rows_per_second", 0.0);
+    double base_peak_rss_mb = base.value("peak_rss_mb", 0.0);
+    if (result.rows_per_second < base_rows_per_second * (1 - tolerance_)) {
+      std::cout << "Regression: pipeline " << result.name << " runs " << result.rows_per_second
+                << " rows/s, the baseline is " << base_rows_per_second << " rows/s.\n";
+      *regressed = true;
+    }
+    if (base_peak_rss_mb > 0 && result.peak_rss_mb > base_peak_rss_mb * (1 + tolerance_)) {
+      std::cout << "Regression: pipeline " << result.name << " uses " << result.peak_rss_mb
+                << " MB peak rss, the baseline is " << base_peak_rss_mb << " MB.\n";
+      *regressed = true;
+    }
+  }
+  std::cout << std::flush;
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::SaveBaseline(const std::vector<PipelineResult> &results) {
+  nlohmann::json pipelines = nlohmann::json::object();
+  for (const auto &result : results) {
+    pipelines[result.name] = {{"rows_per_second", result.rows_per_second}, {"peak_rss_mb", result.peak_rss_mb}};
+  }
+  nlohmann::json baseline = {{"config", BenchmarkConfig()}, {"pipelines", pipelines}};
+  RETURN_IF_NOT_OK(WriteBinaryFile(baseline_file_, baseline.dump(2) + "\n"));
+  std::cout << "Baseline is saved to " << baseline_file_ << std::endl;
+  return Status::OK();
+}
+
+Status DatasetBenchmarkRun::Run() {
+  RETURN_IF_NOT_OK(Path(data_dir_).CreateDirectories());
+  auto config_manager = GlobalContext::config_manager();
+  RETURN_IF_NOT_OK(config_manager->set_num_parallel_workers(num_workers_));
+  config_manager->set_monitor_sampling_interval(kSamplingIntervalMs);
+  config_manager->set_seed(kDataSeed);
+
+  std::vector<PipelineResult> results;
+  for (const auto &name : pipelines_) {
+    PipelineResult result;
+    RETURN_IF_NOT_OK(RunPipeline(name, &result));
+    PrintResult(result);
+    results.push_back(result);
+  }
+
+  if (baseline_file_.empty()) {
+    return Status::OK();
+  }
+  if (update_baseline_) {
+    return SaveBaseline(results);
+  }
+  bool regressed = false;
+  RETURN_IF_NOT_OK(CompareBaseline(results, &regressed));
+  CHECK_FAIL_RETURN_UNEXPECTED(!regressed, "The performance regresses from the baseline: " + baseline_file_);
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,104 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_BENCHMARK_DATASET_BENCHMARK_RUN_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_BENCHMARK_DATASET_BENCHMARK_RUN_H_
+
+#include <getopt.h>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+constexpr char kDftBenchmarkDataDir[] = "/tmp/dataset_benchmark";
+constexpr int32_t kDftBenchmarkNumRows = 1024;
+constexpr int32_t kDftBenchmarkImageSize = 256;
+constexpr int32_t kDftBenchmarkBatchSize = 32;
+constexpr int32_t kDftBenchmarkNumEpochs = 3;
+constexpr int32_t kDftBenchmarkWorkers = 8;
+constexpr float kDftBenchmarkTolerance = 0.1;
+
+// The benchmark of the representative data pipelines. The source files are synthesized into the data directory once
+// and reused by the later runs, then each pipeline is run for several epochs with the MD profiler enabled, and the
+// throughput, the cpu utilization of each op and the peak memory are reported. The first epoch is the warm up when
+// there are more than one epochs. The results are compared with the baseline file to catch the regressions, or saved
+// as the new baseline.
+class DatasetBenchmarkRun {
+ public:
+  DatasetBenchmarkRun();
+  ~DatasetBenchmarkRun() = default;
+  static void PrintHelp();
+  int32_t ProcessArgs(int argc, char **argv);
+
+  void Print(std::ostream &out) const;
+
+  friend std::ostream &operator<<(std::ostream &out, const DatasetBenchmarkRun &br) {
+    br.Print(out);
+    return out;
+  }
+
+  Status Run();
+
+ private:
+  struct OpCpuUtil {
+    float user{0};
+    float sys{0};
+  };
+
+  struct PipelineResult {
+    std::string name;
+    int64_t num_rows{0};
+    double seconds{0};
+    double rows_per_second{0};
+    float peak_rss_mb{0};
+    // The average cpu utilization in percent of the op ids in the profiling files saved by the MD profiler.
+    std::map<int32_t, OpCpuUtil> op_cpu_util;
+  };
+
+  int32_t ProcessArgsHelper(int32_t opt);
+  Status GenerateImageFolder();
+  Status GenerateMindRecord();
+  Status GenerateTFRecord();
+  Status GenerateTextFile();
+  Status BuildPipeline(const std::string &name, std::shared_ptr<Dataset> *ds);
+  Status RunPipeline(const std::string &name, PipelineResult *result);
+  Status CollectProfiling(PipelineResult *result);
+  nlohmann::json BenchmarkConfig() const;
+  Status CompareBaseline(const std::vector<PipelineResult> &results, bool *regressed);
+  Status SaveBaseline(const std::vector<PipelineResult> &results);
+  static void PrintResult(const PipelineResult &result);
+
+  std::string data_dir_;
+  std::vector<std::string> pipelines_;
+  int32_t num_rows_;
+  int32_t image_size_;
+  int32_t batch_size_;
+  int32_t num_epochs_;
+  int32_t num_workers_;
+  std::string baseline_file_;
+  float tolerance_;
+  bool update_baseline_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_BENCHMARK_DATASET_BENCHMARK_RUN_H_
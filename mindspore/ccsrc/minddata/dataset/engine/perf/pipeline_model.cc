@@ -0,0 +1,128 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/perf/pipeline_model.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+PipelineModel::PipelineModel(std::vector<OpServiceStats> ops, double batch_time)
+    : ops_(std::move(ops)), batch_time_(batch_time) {}
+
+double PipelineModel::OpThroughput(const OpServiceStats &op, int32_t num_workers) const {
+  const double kInfinity = std::numeric_limits<double>::infinity();
+  if (batch_time_ <= 0) {
+    return kInfinity;
+  }
+  if (!op.tunable || op.num_workers <= 0) {
+    // The throughput can not be changed, it only bounds the pipeline when it is the bottleneck now.
+    return op.saturated ? 1.0 / batch_time_ : kInfinity;
+  }
+  // The busy time of the workers for each batch.
+  double demand = (op.saturated ? static_cast<double>(op.num_workers) : op.busy_cores) * batch_time_;
+  if (demand <= 0) {
+    return kInfinity;
+  }
+  return num_workers / demand;
+}
+
+double PipelineModel::Throughput(const std::map<int32_t, int32_t> &num_workers) const {
+  double throughput = std::numeric_limits<double>::infinity();
+  for (const auto &op : ops_) {
+    auto itr = num_workers.find(op.op_id);
+    throughput = std::min(throughput, OpThroughput(op, itr == num_workers.end() ? op.num_workers : itr->second));
+  }
+  return throughput;
+}
+
+Status PipelineModel::Solve(const PipelineBudget &budget, std::map<int32_t, OpTuneConfig> *configs) const {
+  RETURN_UNEXPECTED_IF_NULL(configs);
+  CHECK_FAIL_RETURN_UNEXPECTED(batch_time_ > 0, "The batch time of the pipeline model should be positive.");
+  CHECK_FAIL_RETURN_UNEXPECTED(budget.min_queue_size > 0 && budget.min_queue_size <= budget.max_queue_size,
+                               "Invalid prefetch size range of the pipeline model.");
+  configs->clear();
+  // Every tunable operator starts from one worker, and the fixed operators bound the reachable throughput.
+  std::map<int32_t, int32_t> num_workers;
+  double limit = budget.target_speedup / batch_time_;
+  int32_t used_cores = 0;
+  for (const auto &op : ops_) {
+    if (op.tunable && op.num_workers > 0) {
+      num_workers[op.op_id] = 1;
+      ++used_cores;
+    } else {
+      limit = std::min(limit, OpThroughput(op, op.num_workers));
+    }
+  }
+  while (used_cores < budget.cpu_cores) {
+    const OpServiceStats *bottleneck = nullptr;
+    double bottleneck_throughput = std::numeric_limits<double>::infinity();
+    for (const auto &op : ops_) {
+      auto itr = num_workers.find(op.op_id);
+      if (itr == num_workers.end()) {
+        continue;
+      }
+      double throughput = OpThroughput(op, itr->second);
+      if (throughput < bottleneck_throughput) {
+        bottleneck = &op;
+        bottleneck_throughput = throughput;
+      }
+    }
+    if (bottleneck == nullptr || bottleneck_throughput >= limit) {
+      break;
+    }
+    ++num_workers[bottleneck->op_id];
+    ++used_cores;
+  }
+
+  // The connector buffers the rows produced by the workers of the operator and taken by the workers of its parent.
+  int64_t total_queue_size = 0;
+  for (const auto &op : ops_) {
+    auto itr = num_workers.find(op.op_id);
+    if (itr == num_workers.end()) {
+      continue;
+    }
+    int32_t parent_workers = 1;
+    auto parent_itr = num_workers.find(op.parent_id);
+    if (parent_itr != num_workers.end()) {
+      parent_workers = parent_itr->second;
+    } else {
+      auto parent = std::find_if(ops_.begin(), ops_.end(),
+                                 [&op](const OpServiceStats &other) { return other.op_id == op.parent_id; });
+      if (parent != ops_.end()) {
+        parent_workers = std::max(parent->num_workers, 1);
+      }
+    }
+    int32_t queue_size = std::clamp(itr->second + parent_workers, budget.min_queue_size, budget.max_queue_size);
+    (*configs)[op.op_id] = OpTuneConfig{itr->second, queue_size};
+    total_queue_size += queue_size;
+  }
+  if (budget.queue_slots > 0 && total_queue_size > budget.queue_slots) {
+    double scale = static_cast<double>(budget.queue_slots) / total_queue_size;
+    for (auto &config : *configs) {
+      int32_t queue_size = static_cast<int32_t>(std::floor(config.second.queue_size * scale));
+      // Keep one row for each worker, fewer rows stall the workers.
+      queue_size = std::max(queue_size, config.second.num_workers);
+      config.second.queue_size = std::clamp(queue_size, budget.min_queue_size, budget.max_queue_size);
+    }
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief The statistics of an operator profiled in the tuning window
+struct OpServiceStats {
+  int32_t op_id = -1;
+  int32_t parent_id = -1;    // ID of the operator consuming the output, -1 for the root
+  int32_t num_workers = 0;   // current number of workers, 0 for the operator without parallel workers
+  bool tunable = false;      // whether the num_parallel_workers and prefetch_size of the operator can be changed
+  double busy_cores = 0;     // average number of CPU cores used by the operator
+  bool saturated = false;    // whether the input connector is full while the output connector is starving
+};
+
+/// \brief The resources shared by the tunable operators
+struct PipelineBudget {
+  int32_t cpu_cores = 1;       // maximum total number of workers
+  int64_t queue_slots = 0;     // maximum total number of rows buffered by the connectors, 0 for no limit
+  int32_t min_queue_size = 1;  // bounds of the prefetch_size of each operator
+  int32_t max_queue_size = 1;
+  double target_speedup = 1;   // throughput to reach, relative to the current throughput
+};
+
+/// \brief The tuned configuration of an operator
+struct OpTuneConfig {
+  int32_t num_workers = 0;
+  int32_t queue_size = 0;
+};
+
+/// \brief PipelineModel is a queueing model of the pipeline built from the profiled service times of the operators.
+///     Each operator serves the batches with its workers, the service demand of a batch is the busy time of the
+///     workers per batch, so the throughput of an operator with w workers is w / demand, and the throughput of the
+///     pipeline is the minimum of its operators. The saturated operator is counted as fully busy, which covers the
+///     operators waiting on IO without using CPU.
+class PipelineModel {
+ public:
+  /// \brief Constructor
+  /// \param[in] ops The statistics of all the operators in the pipeline
+  /// \param[in] batch_time The average time in ms of a batch in the tuning window
+  PipelineModel(std::vector<OpServiceStats> ops, double batch_time);
+
+  ~PipelineModel() = default;
+
+  /// \brief Solve the number of workers and prefetch size of all tunable operators together, the workers are given to
+  ///     the bottleneck operator one by one until the target throughput is reached, the bottleneck can not be tuned
+  ///     or the CPU budget is used up. The prefetch size covers the producing and consuming workers of the connector,
+  ///     and is scaled down when the total exceeds the memory budget.
+  /// \param[in] budget The resources to share
+  /// \param[out] configs Map from the ID of tunable operator to its solved configuration
+  /// \return Status object
+  Status Solve(const PipelineBudget &budget, std::map<int32_t, OpTuneConfig> *configs) const;
+
+  /// \brief The modelled throughput in batches per ms of the pipeline
+  /// \param[in] num_workers Map from the ID of tunable operator to its number of workers, the operator not in the
+  ///     map keeps its current number of workers
+  /// \return the throughput, infinity if no operator bounds it
+  double Throughput(const std::map<int32_t, int32_t> &num_workers) const;
+
+ private:
+  /// \brief The modelled throughput in batches per ms of an operator with the given number of workers
+  double OpThroughput(const OpServiceStats &op, int32_t num_workers) const;
+
+  std::vector<OpServiceStats> ops_;
+  double batch_time_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_MODEL_H_
@@ -0,0 +1,172 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/engine/perf/pipeline_trace.h"
+
+#include <unistd.h>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <nlohmann/json.hpp>
+#include "utils/ms_utils.h"
+#include "minddata/dataset/util/log_adapter.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr int64_t kDefaultTraceInterval = 100;
+
+uint64_t CurrentThreadId() { return std::hash<std::thread::id>()(std::this_thread::get_id()); }
+
+size_t BucketIndex(uint64_t latency_us) {
+  size_t index = 0;
+  while (latency_us != 0 && index + 1 < LatencyHistogram::kNumBuckets) {
+    latency_us >>= 1;
+    ++index;
+  }
+  return index;
+}
+}  // namespace
+
+void LatencyHistogram::Record(uint64_t latency_us) {
+  thread_local size_t shard_id = CurrentThreadId() % kNumShards;
+  auto &shard = shards_[shard_id];
+  (void)shard.counts[BucketIndex(latency_us)].fetch_add(1, std::memory_order_relaxed);
+  (void)shard.total_us.fetch_add(latency_us, std::memory_order_relaxed);
+}
+
+std::vector<uint64_t> LatencyHistogram::Counts() const {
+  std::vector<uint64_t> counts(kNumBuckets, 0);
+  for (const auto &shard : shards_) {
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+    }
+  }
+  return counts;
+}
+
+uint64_t LatencyHistogram::Count() const {
+  auto counts = Counts();
+  return std::accumulate(counts.begin(), counts.end(), static_cast<uint64_t>(0));
+}
+
+uint64_t LatencyHistogram::TotalUs() const {
+  uint64_t total = 0;
+  for (const auto &shard : shards_) {
+    total += shard.total_us.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+uint64_t LatencyHistogram::Percentile(double percent) const {
+  auto counts = Counts();
+  uint64_t total = std::accumulate(counts.begin(), counts.end(), static_cast<uint64_t>(0));
+  if (total == 0) {
+    return 0;
+  }
+  const double kHundred = 100.0;
+  auto rank = static_cast<uint64_t>(std::max(1.0, percent / kHundred * total));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    seen += counts[i];
+    if (seen >= rank) {
+      return i == 0 ? 0 : (1ULL << i) - 1;
+    }
+  }
+  return (1ULL << (kNumBuckets - 1)) - 1;
+}
+
+void LatencyHistogram::Reset() {
+  for (auto &shard : shards_) {
+    for (auto &count : shard.counts) {
+      count.store(0, std::memory_order_relaxed);
+    }
+    shard.total_us.store(0, std::memory_order_relaxed);
+  }
+}
+
+RowTracer::RowTracer(std::string file_path, int64_t sample_interval)
+    : enabled_(!file_path.empty()),
+      file_path_(std::move(file_path)),
+      sample_interval_(std::max(sample_interval, static_cast<int64_t>(1))) {}
+
+RowTracer *RowTracer::GetInstance() {
+  static RowTracer instance = []() {
+    std::string interval = common::GetEnv("MS_DEV_MINDDATA_TRACE_INTERVAL");
+    int64_t sample_interval = kDefaultTraceInterval;
+    if (!interval.empty()) {
+      try {
+        sample_interval = std::stoll(interval);
+      } catch (const std::exception &e) {
+        MS_LOG(WARNING) << "Invalid env MS_DEV_MINDDATA_TRACE_INTERVAL: " << interval << ", " << e.what()
+                        << ", use the default " << kDefaultTraceInterval;
+      }
+    }
+    return RowTracer(common::GetEnv("MS_DEV_MINDDATA_TRACE_FILE"), sample_interval);
+  }();
+  return &instance;
+}
+
+void RowTracer::AddEvent(const std::string &name, int64_t row_index, uint64_t start_us, uint64_t duration_us) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (events_.size() >= kMaxEvents) {
+    return;
+  }
+  (void)events_.emplace_back(
+    TraceEvent{name, row_index, start_us, duration_us, static_cast<uint32_t>(CurrentThreadId())});
+}
+
+size_t RowTracer::EventCount() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return events_.size();
+}
+
+Status RowTracer::Save() {
+  if (!enabled_) {
+    return Status::OK();
+  }
+  nlohmann::json trace_events = nlohmann::json::array();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto pid = getpid();
+    for (const auto &event : events_) {
+      nlohmann::json trace_event;
+      trace_event["name"] = event.name;
+      trace_event["cat"] = "minddata";
+      trace_event["ph"] = "X";
+      trace_event["ts"] = event.start_us;
+      trace_event["dur"] = event.duration_us;
+      trace_event["pid"] = pid;
+      trace_event["tid"] = event.thread_id;
+      trace_event["args"]["row"] = event.row_index;
+      trace_events.push_back(std::move(trace_event));
+    }
+  }
+  nlohmann::json trace;
+  trace["traceEvents"] = std::move(trace_events);
+  trace["displayTimeUnit"] = "ms";
+  std::ofstream os(file_path_, std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(os.is_open(), "Failed to open the trace file: " + file_path_);
+  os << trace;
+  os.close();
+  MS_LOG(INFO) << "Dataset pipeline trace is saved to " << file_path_;
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
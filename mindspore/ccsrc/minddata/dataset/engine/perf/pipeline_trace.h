@@ -0,0 +1,136 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_TRACE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_TRACE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A histogram of latencies in power of 2 buckets of us. It is always on, so the counters are sharded by
+///     thread and updated by relaxed atomics without any lock.
+class LatencyHistogram {
+ public:
+  /// Bucket 0 counts the latency of 0 us, and bucket i counts the latencies in [2^(i-1), 2^i) us.
+  static constexpr size_t kNumBuckets = 32;
+
+  LatencyHistogram() = default;
+
+  ~LatencyHistogram() = default;
+
+  /// \brief Record a latency
+  /// \param[in] latency_us The latency in us
+  void Record(uint64_t latency_us);
+
+  /// \return The number of the recorded latencies
+  uint64_t Count() const;
+
+  /// \return The sum of the recorded latencies in us
+  uint64_t TotalUs() const;
+
+  /// \brief Estimate the latency at the percentile by the upper bound of its bucket
+  /// \param[in] percent The percentile in [0, 100]
+  /// \return The latency in us, 0 if no latency is recorded
+  uint64_t Percentile(double percent) const;
+
+  /// \return The merged counts of all buckets
+  std::vector<uint64_t> Counts() const;
+
+  /// \brief Clear all the counters
+  void Reset();
+
+ private:
+  static constexpr size_t kNumShards = 8;
+  static constexpr size_t kCacheLineSize = 64;
+
+  struct alignas(kCacheLineSize) Shard {
+    std::atomic<uint64_t> counts[kNumBuckets] = {};
+    std::atomic<uint64_t> total_us{0};
+  };
+
+  Shard shards_[kNumShards];
+};
+
+/// \brief RowTracer keeps the timeline of the sampled rows passing the connectors of the operators, and exports it as
+///     a Chrome trace which can be opened by chrome://tracing or Perfetto.
+///     The tracer of the process is enabled by env MS_DEV_MINDDATA_TRACE_FILE with the trace file path, one of each
+///     MS_DEV_MINDDATA_TRACE_INTERVAL rows is sampled, which is 100 by default.
+class RowTracer {
+ public:
+  /// \brief Constructor
+  /// \param[in] file_path The file to save the trace, empty to disable the tracer
+  /// \param[in] sample_interval Trace one of each sample_interval rows
+  RowTracer(std::string file_path, int64_t sample_interval);
+
+  ~RowTracer() = default;
+
+  /// \return The tracer of the process
+  static RowTracer *GetInstance();
+
+  /// \return The current time in us
+  static uint64_t NowUs() {
+    return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count());
+  }
+
+  bool enabled() const { return enabled_; }
+
+  /// \return Whether the row of the index is sampled
+  bool Sampled(int64_t row_index) const { return enabled_ && row_index % sample_interval_ == 0; }
+
+  /// \brief Add an event of the sampled row
+  /// \param[in] name Name of the event, like "MapOp(2) compute"
+  /// \param[in] row_index Index of the row in the connector
+  /// \param[in] start_us Start time of the event in us
+  /// \param[in] duration_us Duration of the event in us
+  void AddEvent(const std::string &name, int64_t row_index, uint64_t start_us, uint64_t duration_us);
+
+  /// \return The number of events kept
+  size_t EventCount();
+
+  /// \brief Save all the events to the trace file in Chrome trace format
+  /// \return Status object
+  Status Save();
+
+ private:
+  struct TraceEvent {
+    std::string name;
+    int64_t row_index;
+    uint64_t start_us;
+    uint64_t duration_us;
+    uint32_t thread_id;
+  };
+
+  // Keep the memory bounded when the pipeline runs for long.
+  static constexpr size_t kMaxEvents = 1000000;
+
+  bool enabled_;
+  std::string file_path_;
+  int64_t sample_interval_;
+  std::mutex mutex_;
+  std::vector<TraceEvent> events_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_PERF_PIPELINE_TRACE_H_
@@ -65,6 +65,7 @@
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/random_sampler_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/samplers_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/sequential_sampler_ir.h"
+#include "minddata/dataset/engine/ir/datasetops/source/samplers/shuffle_buffer_sampler_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/skip_first_epoch_sampler_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/subset_random_sampler_ir.h"
 #include "minddata/dataset/engine/ir/datasetops/source/samplers/subset_sampler_ir.h"
@@ -22,6 +22,7 @@
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 #include "minddata/dataset/engine/opt/pre/cache_transform_pass.h"
 #include "minddata/dataset/engine/opt/pre/node_offload_pass.h"
+#include "minddata/dataset/engine/opt/pre/shuffle_pushdown_pass.h"
 #include "minddata/dataset/engine/opt/post/repeat_pass.h"
 #endif
 #include "minddata/dataset/engine/opt/pass.h"
@@ -60,6 +61,12 @@ Status TreeAdapter::PrePass(std::shared_ptr<DatasetNode> ir) {
   MS_LOG(INFO) << "Running pre pass loops.";
   (void)actions.emplace_back(std::make_unique<InputValidationPass>());
   (void)actions.emplace_back(std::make_unique<CacheValidationPass>());
+#ifndef ENABLE_ANDROID
+  // Push the shuffle down into the sampler before the skip, so that the skip can be pushed down further.
+  if (optimize_) {
+    (void)actions.emplace_back(std::make_unique<ShufflePushdownPass>());
+  }
+#endif
   if (usage_ == kDeReset) {
     (void)actions.emplace_back(std::make_unique<AddSkipPass>());
     (void)actions.emplace_back(std::make_unique<SkipPushdownPass>());
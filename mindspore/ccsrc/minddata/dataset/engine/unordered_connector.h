@@ -0,0 +1,217 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_UNORDERED_CONNECTOR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_UNORDERED_CONNECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "minddata/dataset/util/cond_var.h"
+#include "minddata/dataset/util/services.h"
+#include "minddata/dataset/util/spsc_ring.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+// UnorderedConnector is a communication data structure between two group of threads that does NOT preserve the
+// order, it's used by the pipelines which don't care about the order of the elements between the workers.
+//
+// There is one lock-free SpscRing for each pair of producer and consumer, the producer pushes to the rings of the
+// consumers in roundrobin and the consumer pops from the rings of all the producers, so neither push nor pop takes
+// a lock or copies the element in the common case. The mutex and the condition variables are only used to sleep
+// when all the rings of the caller are full (push) or empty (pop), and the notification is skipped when nobody waits.
+//
+// Requirements:
+//   1. Each thread in the group of consumer or producer threads must be assigned ids starting from 0.
+//   2. Only one thread can use a producer id or a consumer id at the same time.
+//
+// Blocking conditions:
+//   1. UnorderedConnector.Push(int, T) can block when all the rings of the producer are full.
+//   2. UnorderedConnector.Pop(int) can block when all the rings of the consumer are empty.
+template <class T>
+class UnorderedConnector {
+ public:
+  // Constructor of UnorderedConnector
+  // @param n_producers The number of threads producing data into this connector.
+  // @param n_consumers The number of thread consuming data from this connector.
+  // @param queue_capacity The number of element can be pushed by each producer, which is spread to the rings of
+  //     the consumers.
+  UnorderedConnector(int32_t n_producers, int32_t n_consumers, int32_t queue_capacity)
+      : num_producers_(n_producers), num_consumers_(n_consumers) {
+    MS_LOG(DEBUG) << "An unordered connector is created with " << n_producers << " producers and " << n_consumers
+                  << " consumers.";
+    my_name_ = Services::GetUniqueID();
+    auto ring_capacity = (queue_capacity + n_consumers - 1) / n_consumers;
+    if (ring_capacity <= 0) {
+      ring_capacity = 1;
+    }
+    for (int32_t i = 0; i < n_producers * n_consumers; ++i) {
+      (void)rings_.emplace_back(std::make_unique<SpscRing<T>>(static_cast<size_t>(ring_capacity)));
+    }
+    push_to_.resize(n_producers, 0);
+    pop_from_.resize(n_consumers, 0);
+  }
+
+  ~UnorderedConnector() = default;
+
+  UnorderedConnector(const UnorderedConnector &) = delete;
+  UnorderedConnector &operator=(const UnorderedConnector &) = delete;
+
+  // Get an element from any producer, it may block when all the rings of the consumer are empty.
+  // @param worker_id The id of a worker thread calling this method.
+  // @param result The address of an object where the popped element will be moved to.
+  Status Pop(int32_t worker_id, T *result) noexcept {
+    MS_ASSERT(worker_id < num_consumers_);
+    if (!TryPop(worker_id, result)) {
+      std::unique_lock<std::mutex> lk(m_);
+      ++waiting_consumers_;
+      // Pairs with the fence in Push, either the producer sees the waiter or the consumer sees the element.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      Status rc = not_empty_cv_.Wait(&lk, [this, worker_id, result]() { return TryPop(worker_id, result); });
+      --waiting_consumers_;
+      RETURN_IF_NOT_OK(rc);
+    }
+    out_rows_count_++;
+    Notify(&waiting_producers_, &not_full_cv_);
+    return Status::OK();
+  }
+
+  // Move an element into the connector, it may block when all the rings of the producer are full.
+  // @param worker_id The id of a worker thread calling this method.
+  // @param el An element to be moved into the connector.
+  Status Push(int32_t worker_id, T &&el) noexcept {
+    MS_ASSERT(worker_id < num_producers_);
+    if (!TryPush(worker_id, &el)) {
+      std::unique_lock<std::mutex> lk(m_);
+      ++waiting_producers_;
+      // Pairs with the fence in Pop, either the consumer sees the waiter or the producer sees the free slot.
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      Status rc = not_full_cv_.Wait(&lk, [this, worker_id, &el]() { return TryPush(worker_id, &el); });
+      --waiting_producers_;
+      RETURN_IF_NOT_OK(rc);
+    }
+    Notify(&waiting_consumers_, &not_empty_cv_);
+    return Status::OK();
+  }
+
+  auto out_rows_count() const { return out_rows_count_.load(); }
+
+  // Drop all the elements so that it can be used again with new inputs, must not be called while the producers or
+  // the consumers are running.
+  void Reset() {
+    for (auto &ring : rings_) {
+      ring->Reset();
+    }
+    std::fill(push_to_.begin(), push_to_.end(), 0);
+    std::fill(pop_from_.begin(), pop_from_.end(), 0);
+    out_rows_count_ = 0;
+    MS_LOG(DEBUG) << "Unordered connector counters reset.";
+  }
+
+  // Get current size of connector.
+  size_t size() const {
+    size_t size = 0;
+    for (auto &ring : rings_) {
+      size += ring->size();
+    }
+    return size;
+  }
+
+  size_t capacity() const {
+    size_t capacity = 0;
+    for (auto &ring : rings_) {
+      capacity += ring->capacity();
+    }
+    return capacity;
+  }
+
+  // Register the internal resources with Task group for interruption service.
+  Status Register(TaskGroup *vg) {
+    RETURN_UNEXPECTED_IF_NULL(vg);
+    RETURN_IF_NOT_OK(not_empty_cv_.Register(vg->GetIntrpService()));
+    return not_full_cv_.Register(vg->GetIntrpService());
+  }
+
+ private:
+  SpscRing<T> *ring(int32_t producer_id, int32_t consumer_id) const {
+    return rings_[static_cast<size_t>(producer_id * num_consumers_ + consumer_id)].get();
+  }
+
+  // Try the rings of the consumers from the last pushed one, so that the elements are spread to all the consumers.
+  bool TryPush(int32_t producer_id, T *el) {
+    auto &next = push_to_[producer_id];
+    for (int32_t i = 0; i < num_consumers_; ++i) {
+      auto consumer_id = (next + i) % num_consumers_;
+      if (ring(producer_id, consumer_id)->TryPush(std::move(*el))) {
+        next = (consumer_id + 1) % num_consumers_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Try the rings of the producers from the last popped one, so that no producer is starved.
+  bool TryPop(int32_t consumer_id, T *result) {
+    auto &next = pop_from_[consumer_id];
+    for (int32_t i = 0; i < num_producers_; ++i) {
+      auto producer_id = (next + i) % num_producers_;
+      if (ring(producer_id, consumer_id)->TryPop(result)) {
+        next = (producer_id + 1) % num_producers_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void Notify(const std::atomic<int32_t> *waiting_num, CondVar *cv) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_num->load() == 0) {
+      return;
+    }
+    // Take the lock to make sure the waiter is either before checking the rings or already sleeping.
+    { std::unique_lock<std::mutex> lk(m_); }
+    cv->NotifyAll();
+  }
+
+  std::string my_name_;
+  int32_t num_producers_;
+  int32_t num_consumers_;
+
+  // The ring of producer p and consumer c is rings_[p * num_consumers_ + c].
+  std::vector<std::unique_ptr<SpscRing<T>>> rings_;
+
+  // The next consumer ring to push of each producer and the next producer ring to pop of each consumer, each of
+  // them is only accessed by the thread with the id.
+  std::vector<int32_t> push_to_;
+  std::vector<int32_t> pop_from_;
+
+  // Only used to sleep when the rings are full or empty.
+  std::mutex m_;
+  CondVar not_empty_cv_;
+  CondVar not_full_cv_;
+  std::atomic<int32_t> waiting_consumers_{0};
+  std::atomic<int32_t> waiting_producers_{0};
+  std::atomic<std::int64_t> out_rows_count_{0};
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_UNORDERED_CONNECTOR_H_
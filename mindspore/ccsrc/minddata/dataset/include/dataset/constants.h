@@ -349,6 +349,7 @@ using session_id_type = uint32_t;
 using row_id_type = int64_t;
 
 constexpr uint32_t kCfgAutoTuneInterval = 0;  // default number of steps
+constexpr uint32_t kCfgTensorPoolSize = 0;    // default size of the tensor memory pool in MB, 0 means disabled
 }  // namespace dataset
 }  // namespace mindspore
 
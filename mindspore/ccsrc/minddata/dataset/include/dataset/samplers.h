@@ -118,6 +118,8 @@ class MS_API DistributedSampler final : public Sampler {
   /// \param[in] offset The starting position where access to elements in the dataset begins (default=-1).
   /// \param[in] even_dist If true, each shard would return the same number of rows (default=true).
   ///     If false the total rows returned by all the shards would not have overlap.
+  /// \param[in] block_size The number of contiguous rows assigned together to a shard (default=0, assign by stride).
+  ///     If greater than 0, each shard reads a contiguous range of blocks which is rotated every epoch.
   /// \par Example
   /// \code
   ///      /* creates a distributed sampler with 2 shards in total. This shard is shard 0 */
@@ -125,7 +127,7 @@ class MS_API DistributedSampler final : public Sampler {
   ///      std::shared_ptr<Dataset> ds = MindData(file_path, {}, std::make_shared<DistributedSampler>(2, 0, false));
   /// \endcode
   DistributedSampler(int64_t num_shards, int64_t shard_id, bool shuffle = true, int64_t num_samples = 0,
-                     uint32_t seed = 1, int64_t offset = -1, bool even_dist = true);
+                     uint32_t seed = 1, int64_t offset = -1, bool even_dist = true, int64_t block_size = 0);
   /// \brief Destructor.
   ~DistributedSampler() = default;
 
@@ -142,6 +144,7 @@ class MS_API DistributedSampler final : public Sampler {
   uint32_t seed_;
   int64_t offset_;
   bool even_dist_;
+  int64_t block_size_;
 };
 
 /// \brief A class to represent a PK Sampler in the data pipeline.
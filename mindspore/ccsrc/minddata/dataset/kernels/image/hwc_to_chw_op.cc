@@ -30,6 +30,23 @@ Status HwcToChwOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr
   // output.shape == CHW
   return HwcToChw(input, output);
 }
+Status HwcToChwOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+#ifndef ENABLE_ANDROID
+  return BatchHwcToChw(input, output);
+#else
+  return TensorOp::BatchCompute(input, output);
+#endif
+}
+
+int32_t HwcToChwOp::BatchInputRank() const {
+#ifndef ENABLE_ANDROID
+  return static_cast<int32_t>(kDefaultImageRank) + 1;
+#else
+  return 0;
+#endif
+}
+
 Status HwcToChwOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
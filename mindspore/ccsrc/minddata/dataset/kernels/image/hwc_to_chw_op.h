@@ -31,6 +31,11 @@ class HwcToChwOp : public TensorOp {
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
   Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
 
+  // Convert the images batched to <N,H,W,C> to <N,C,H,W> in one call.
+  Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  int32_t BatchInputRank() const override;
+
   std::string Name() const override { return kHwcToChwOp; }
 };
 }  // namespace dataset
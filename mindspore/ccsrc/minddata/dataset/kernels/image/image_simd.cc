@@ -0,0 +1,225 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/kernels/image/image_simd.h"
+
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IMAGE_SIMD_X86
+#include <immintrin.h>
+#endif
+#if defined(ENABLE_NEON) && defined(__aarch64__)
+#define IMAGE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The SIMD kernels keep the mean and std pattern of each channel in registers, so the channels are limited.
+constexpr int64_t kMaxSimdChannels = 4;
+
+void NormalizeUint8Scalar(const uint8_t *src, float *dst, int64_t begin, int64_t size, const float *mean,
+                          const float *std, int64_t channels) {
+  for (int64_t i = begin; i < size; ++i) {
+    auto c = i % channels;
+    dst[i] = (static_cast<float>(src[i]) - mean[c]) / std[c];
+  }
+}
+
+// Fill the pattern of lanes values starting at the element offset, the pattern of [offset, offset + lanes) repeats
+// every lanes * channels elements, which is the step of the SIMD kernels.
+void FillPattern(const float *values, int64_t channels, int64_t offset, int64_t lanes, float *pattern) {
+  for (int64_t k = 0; k < lanes; ++k) {
+    pattern[k] = values[(offset + k) % channels];
+  }
+}
+
+#ifdef IMAGE_SIMD_X86
+// Returns the number of elements normalized, the rest is left to the scalar code.
+__attribute__((target("avx2"))) int64_t NormalizeUint8Avx2(const uint8_t *src, float *dst, int64_t size,
+                                                           const float *mean, const float *std, int64_t channels) {
+  constexpr int64_t kLanes = 8;
+  __m256 mean_v[kMaxSimdChannels];
+  __m256 std_v[kMaxSimdChannels];
+  for (int64_t j = 0; j < channels; ++j) {
+    float pattern[kLanes];
+    FillPattern(mean, channels, j * kLanes, kLanes, pattern);
+    mean_v[j] = _mm256_loadu_ps(pattern);
+    FillPattern(std, channels, j * kLanes, kLanes, pattern);
+    std_v[j] = _mm256_loadu_ps(pattern);
+  }
+  const int64_t step = kLanes * channels;
+  int64_t i = 0;
+  for (; i + step <= size; i += step) {
+    for (int64_t j = 0; j < channels; ++j) {
+      auto offset = i + j * kLanes;
+      __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + offset));
+      __m256 value = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+      _mm256_storeu_ps(dst + offset, _mm256_div_ps(_mm256_sub_ps(value, mean_v[j]), std_v[j]));
+    }
+  }
+  return i;
+}
+
+__attribute__((target("avx512f"))) int64_t NormalizeUint8Avx512(const uint8_t *src, float *dst, int64_t size,
+                                                                const float *mean, const float *std,
+                                                                int64_t channels) {
+  constexpr int64_t kLanes = 16;
+  __m512 mean_v[kMaxSimdChannels];
+  __m512 std_v[kMaxSimdChannels];
+  for (int64_t j = 0; j < channels; ++j) {
+    float pattern[kLanes];
+    FillPattern(mean, channels, j * kLanes, kLanes, pattern);
+    mean_v[j] = _mm512_loadu_ps(pattern);
+    FillPattern(std, channels, j * kLanes, kLanes, pattern);
+    std_v[j] = _mm512_loadu_ps(pattern);
+  }
+  const int64_t step = kLanes * channels;
+  int64_t i = 0;
+  for (; i + step <= size; i += step) {
+    for (int64_t j = 0; j < channels; ++j) {
+      auto offset = i + j * kLanes;
+      __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + offset));
+      __m512 value = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(bytes));
+      _mm512_storeu_ps(dst + offset, _mm512_div_ps(_mm512_sub_ps(value, mean_v[j]), std_v[j]));
+    }
+  }
+  return i;
+}
+#endif
+
+#ifdef IMAGE_SIMD_NEON
+int64_t NormalizeUint8Neon(const uint8_t *src, float *dst, int64_t size, const float *mean, const float *std,
+                           int64_t channels) {
+  // Each step of a channel converts 8 bytes to two float32x4.
+  constexpr int64_t kLanes = 8;
+  constexpr int64_t kHalfLanes = 4;
+  float32x4_t mean_v[kMaxSimdChannels][2];
+  float32x4_t std_v[kMaxSimdChannels][2];
+  for (int64_t j = 0; j < channels; ++j) {
+    float pattern[kLanes];
+    FillPattern(mean, channels, j * kLanes, kLanes, pattern);
+    mean_v[j][0] = vld1q_f32(pattern);
+    mean_v[j][1] = vld1q_f32(pattern + kHalfLanes);
+    FillPattern(std, channels, j * kLanes, kLanes, pattern);
+    std_v[j][0] = vld1q_f32(pattern);
+    std_v[j][1] = vld1q_f32(pattern + kHalfLanes);
+  }
+  const int64_t step = kLanes * channels;
+  int64_t i = 0;
+  for (; i + step <= size; i += step) {
+    for (int64_t j = 0; j < channels; ++j) {
+      auto offset = i + j * kLanes;
+      uint16x8_t value_u16 = vmovl_u8(vld1_u8(src + offset));
+      float32x4_t low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(value_u16)));
+      float32x4_t high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(value_u16)));
+      vst1q_f32(dst + offset, vdivq_f32(vsubq_f32(low, mean_v[j][0]), std_v[j][0]));
+      vst1q_f32(dst + offset + kHalfLanes, vdivq_f32(vsubq_f32(high, mean_v[j][1]), std_v[j][1]));
+    }
+  }
+  return i;
+}
+#endif
+
+SimdIsa DetectSimdIsa() {
+#ifdef IMAGE_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+    return SimdIsa::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return SimdIsa::kAvx2;
+  }
+#endif
+#ifdef IMAGE_SIMD_NEON
+  return SimdIsa::kNeon;
+#endif
+  return SimdIsa::kScalar;
+}
+}  // namespace
+
+SimdIsa GetSimdIsa() {
+  static const SimdIsa isa = DetectSimdIsa();
+  return isa;
+}
+
+std::string SimdIsaName(SimdIsa isa) {
+  switch (isa) {
+    case SimdIsa::kNeon:
+      return "NEON";
+    case SimdIsa::kAvx2:
+      return "AVX2";
+    case SimdIsa::kAvx512:
+      return "AVX512";
+    default:
+      return "Scalar";
+  }
+}
+
+void NormalizeUint8(const uint8_t *src, float *dst, int64_t size, const float *mean, const float *std,
+                    int64_t channels) {
+  if (size <= 0 || channels <= 0) {
+    return;
+  }
+  int64_t done = 0;
+  if (channels <= kMaxSimdChannels) {
+    switch (GetSimdIsa()) {
+#ifdef IMAGE_SIMD_X86
+      case SimdIsa::kAvx512:
+        done = NormalizeUint8Avx512(src, dst, size, mean, std, channels);
+        break;
+      case SimdIsa::kAvx2:
+        done = NormalizeUint8Avx2(src, dst, size, mean, std, channels);
+        break;
+#endif
+#ifdef IMAGE_SIMD_NEON
+      case SimdIsa::kNeon:
+        done = NormalizeUint8Neon(src, dst, size, mean, std, channels);
+        break;
+#endif
+      default:
+        break;
+    }
+  }
+  // The SIMD kernels stop at a multiple of channels, so the channel of the rest starts from 0.
+  NormalizeUint8Scalar(src, dst, done, size, mean, std, channels);
+}
+
+void NormalizeUint8HwcToChw(const uint8_t *src, float *dst, int64_t height, int64_t width, int64_t channels,
+                            const float *mean, const float *std, bool flip) {
+  if (height <= 0 || width <= 0 || channels <= 0) {
+    return;
+  }
+  // Normalize each row in SIMD to the row buffer, then scatter it to the planes of the channels.
+  const int64_t row_size = width * channels;
+  std::vector<float> row_buffer(row_size);
+  const int64_t plane_size = height * width;
+  for (int64_t y = 0; y < height; ++y) {
+    NormalizeUint8(src + y * row_size, row_buffer.data(), row_size, mean, std, channels);
+    for (int64_t c = 0; c < channels; ++c) {
+      float *row_out = dst + c * plane_size + y * width;
+      const float *row_in = row_buffer.data() + c;
+      for (int64_t x = 0; x < width; ++x) {
+        int64_t x_in = flip ? width - 1 - x : x;
+        row_out[x] = row_in[x_in * channels];
+      }
+    }
+  }
+}
+}  // namespace dataset
+}  // namespace mindspore
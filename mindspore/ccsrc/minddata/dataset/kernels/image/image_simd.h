@@ -0,0 +1,53 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_IMAGE_SIMD_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_IMAGE_SIMD_H_
+
+#include <cstdint>
+#include <string>
+
+namespace mindspore {
+namespace dataset {
+/// \brief The instruction set used by the SIMD kernels of image.
+enum class SimdIsa { kScalar, kNeon, kAvx2, kAvx512 };
+
+/// \brief Returns the best instruction set supported by the running cpu, which is detected once at the first call,
+///     so one binary runs the widest kernels on each machine of the fleet.
+SimdIsa GetSimdIsa();
+
+/// \brief Returns the name of the instruction set for logging.
+std::string SimdIsaName(SimdIsa isa);
+
+/// \brief Normalizes the uint8 pixels to float, dst[i] = (src[i] - mean[i % channels]) / std[i % channels].
+///     The result is the same as the scalar code, since the SIMD kernels subtract and divide in float too.
+/// \param src: The interleaved input of size elements, the size must be a multiple of channels.
+/// \param dst: The preallocated output of size elements.
+/// \param size: The number of elements.
+/// \param mean: The mean of each channel.
+/// \param std: The std of each channel.
+/// \param channels: The number of the interleaved channels, use 1 for one plane of CHW.
+void NormalizeUint8(const uint8_t *src, float *dst, int64_t size, const float *mean, const float *std,
+                    int64_t channels);
+
+/// \brief Normalizes the uint8 HWC image into the preallocated float CHW output, flips it horizontally if required.
+/// \param src: The input image of <H,W,C>.
+/// \param dst: The preallocated output of <C,H,W>.
+void NormalizeUint8HwcToChw(const uint8_t *src, float *dst, int64_t height, int64_t width, int64_t channels,
+                            const float *mean, const float *std, bool flip);
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_IMAGE_SIMD_H_
@@ -28,6 +28,7 @@
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/kernels/image/affine_op.h"
 #include "minddata/dataset/kernels/image/auto_contrast_op.h"
+#include "minddata/dataset/kernels/image/image_simd.h"
 #include "minddata/dataset/kernels/image/invert_op.h"
 #include "minddata/dataset/kernels/image/math_utils.h"
 #include "minddata/dataset/kernels/image/posterize_op.h"
@@ -494,7 +495,11 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
 }
 
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+                         int crop_w, int crop_h, int scale_denom) {
+  constexpr int kMaxScaleDenom = 8;
+  CHECK_FAIL_RETURN_UNEXPECTED(scale_denom > 0 && scale_denom <= kMaxScaleDenom && kMaxScaleDenom % scale_denom == 0,
+                               "JpegCropAndDecode: scale denominator should be 1, 2, 4 or 8, got: " +
+                                 std::to_string(scale_denom));
   struct jpeg_decompress_struct cinfo;
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -508,11 +513,20 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = static_cast<unsigned int>(scale_denom);
     jpeg_calc_output_dimensions(&cinfo);
     RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
   } catch (std::runtime_error &e) {
     return DestroyDecompressAndReturnError(e.what());
   }
+  if (scale_denom > 1 && crop_w != 0 && crop_h != 0) {
+    // Map the crop region to the scaled image, and keep it inside the image after rounding.
+    crop_x /= scale_denom;
+    crop_y /= scale_denom;
+    crop_w = std::max(1, std::min(crop_w / scale_denom, static_cast<int>(cinfo.output_width) - crop_x));
+    crop_h = std::max(1, std::min(crop_h / scale_denom, static_cast<int>(cinfo.output_height) - crop_y));
+  }
   CHECK_FAIL_RETURN_UNEXPECTED((std::numeric_limits<int32_t>::max() - crop_w) > crop_x,
                                "JpegCropAndDecode: addition(crop x and crop width) out of bounds, got crop x:" +
                                  std::to_string(crop_x) + ", and crop width:" + std::to_string(crop_w));
@@ -696,6 +710,64 @@ Status HwcToChw(std::shared_ptr<Tensor> input, std::shared_ptr<Tensor> *output)
   }
 }
 
+template <typename T>
+void BatchHwcToChwKernel(const T *input, T *output, int64_t num_images, int64_t plane_size, int64_t num_channels) {
+  for (int64_t n = 0; n < num_images; ++n) {
+    const T *image_in = input + n * plane_size * num_channels;
+    T *image_out = output + n * plane_size * num_channels;
+    for (int64_t c = 0; c < num_channels; ++c) {
+      // Write each channel plane contiguously so that the inner loop can be vectorized by the compiler.
+      T *plane_out = image_out + c * plane_size;
+      for (int64_t i = 0; i < plane_size; ++i) {
+        plane_out[i] = image_in[i * num_channels + c];
+      }
+    }
+  }
+}
+
+Status BatchHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  RETURN_UNEXPECTED_IF_NULL(input);
+  RETURN_UNEXPECTED_IF_NULL(output);
+  constexpr dsize_t kBatchImageRank = 4;
+  CHECK_FAIL_RETURN_UNEXPECTED(input->Rank() == kBatchImageRank,
+                               "HWC2CHW: batched image shape should be <N,H,W,C>, but got rank: " +
+                                 std::to_string(input->Rank()));
+  CHECK_FAIL_RETURN_UNEXPECTED(input->type().IsNumeric(),
+                               "HWC2CHW: batched image should be numeric, but got type: " + input->type().ToString());
+  const auto &shape = input->shape();
+  int64_t num_images = shape[0];
+  int64_t height = shape[1];
+  int64_t width = shape[2];
+  int64_t num_channels = shape[3];
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape{num_images, num_channels, height, width}, input->type(), output));
+  if (input->Size() == 0) {
+    return Status::OK();
+  }
+  int64_t plane_size = height * width;
+  // Only the element size matters to the transpose, so the types of the same size share one kernel.
+  switch (input->type().SizeInBytes()) {
+    case sizeof(uint8_t):
+      BatchHwcToChwKernel(reinterpret_cast<const uint8_t *>(input->GetBuffer()), &(*(*output)->begin<uint8_t>()),
+                          num_images, plane_size, num_channels);
+      break;
+    case sizeof(uint16_t):
+      BatchHwcToChwKernel(reinterpret_cast<const uint16_t *>(input->GetBuffer()), &(*(*output)->begin<uint16_t>()),
+                          num_images, plane_size, num_channels);
+      break;
+    case sizeof(uint32_t):
+      BatchHwcToChwKernel(reinterpret_cast<const uint32_t *>(input->GetBuffer()), &(*(*output)->begin<uint32_t>()),
+                          num_images, plane_size, num_channels);
+      break;
+    case sizeof(uint64_t):
+      BatchHwcToChwKernel(reinterpret_cast<const uint64_t *>(input->GetBuffer()), &(*(*output)->begin<uint64_t>()),
+                          num_images, plane_size, num_channels);
+      break;
+    default:
+      RETURN_STATUS_UNEXPECTED("HWC2CHW: unsupported type of batched image: " + input->type().ToString());
+  }
+  return Status::OK();
+}
+
 Status MaskWithTensor(const std::shared_ptr<Tensor> &sub_mat, std::shared_ptr<Tensor> *input, int x, int y,
                       int crop_width, int crop_height, ImageFormat image_format) {
   if (image_format == ImageFormat::HWC) {
@@ -1058,7 +1130,21 @@ Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *
                                "channels: " +
                                  std::to_string((*output)->shape()[channel_index]) +
                                  ", size of mean: " + std::to_string(mean.size()));
-  RETURN_IF_NOT_OK(Normalize_caller<float>(input, output, mean, std, is_hwc, false));
+  if (input->type() == DataType::DE_UINT8) {
+    // The decoded image is uint8 mostly, which is normalized by the SIMD kernels.
+    const uint8_t *image_in = input->GetBuffer();
+    float *image_out = &(*(*output)->begin<float>());
+    if (is_hwc) {
+      NormalizeUint8(image_in, image_out, input->Size(), mean.data(), std.data(), static_cast<int64_t>(mean.size()));
+    } else {
+      int64_t plane_size = (*output)->shape()[1] * (*output)->shape()[2];
+      for (size_t c = 0; c < mean.size(); c++) {
+        NormalizeUint8(image_in + c * plane_size, image_out + c * plane_size, plane_size, &mean[c], &std[c], 1);
+      }
+    }
+  } else {
+    RETURN_IF_NOT_OK(Normalize_caller<float>(input, output, mean, std, is_hwc, false));
+  }
 
   if (input->Rank() == kMinImageRank) {
     (*output)->Squeeze();
@@ -1066,6 +1152,164 @@ Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *
   return Status::OK();
 }
 
+template <typename T>
+void BatchNormalizeKernel(const T *input, float *output, int64_t num_images, int64_t plane_size,
+                          const std::vector<float> &mean, const std::vector<float> &std, bool is_hwc) {
+  auto num_channels = static_cast<int64_t>(mean.size());
+  if (is_hwc) {
+    int64_t num_pixels = num_images * plane_size;
+    for (int64_t i = 0; i < num_pixels; ++i) {
+      const T *pixel_in = input + i * num_channels;
+      float *pixel_out = output + i * num_channels;
+      for (int64_t c = 0; c < num_channels; ++c) {
+        pixel_out[c] = (static_cast<float>(pixel_in[c]) - mean[c]) / std[c];
+      }
+    }
+    return;
+  }
+  int64_t num_planes = num_images * num_channels;
+  for (int64_t i = 0; i < num_planes; ++i) {
+    // Each channel plane is contiguous, so the inner loop can be vectorized by the compiler.
+    const T *plane_in = input + i * plane_size;
+    float *plane_out = output + i * plane_size;
+    float plane_mean = mean[i % num_channels];
+    float plane_std = std[i % num_channels];
+    for (int64_t j = 0; j < plane_size; ++j) {
+      plane_out[j] = (static_cast<float>(plane_in[j]) - plane_mean) / plane_std;
+    }
+  }
+}
+
+template <typename T>
+void BatchNormalizeCaller(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int64_t num_images,
+                          int64_t plane_size, const std::vector<float> &mean, const std::vector<float> &std,
+                          bool is_hwc) {
+  BatchNormalizeKernel(reinterpret_cast<const T *>(input->GetBuffer()), &(*(*output)->begin<float>()), num_images,
+                       plane_size, mean, std, is_hwc);
+}
+
+// The uint8 images are normalized by the SIMD kernels, each plane of CHW is normalized as one channel.
+void BatchNormalizeUint8(const uint8_t *input, float *output, int64_t num_images, int64_t plane_size,
+                         const std::vector<float> &mean, const std::vector<float> &std, bool is_hwc) {
+  auto num_channels = static_cast<int64_t>(mean.size());
+  if (is_hwc) {
+    NormalizeUint8(input, output, num_images * plane_size * num_channels, mean.data(), std.data(), num_channels);
+    return;
+  }
+  int64_t num_planes = num_images * num_channels;
+  for (int64_t i = 0; i < num_planes; ++i) {
+    auto c = i % num_channels;
+    NormalizeUint8(input + i * plane_size, output + i * plane_size, plane_size, &mean[c], &std[c], 1);
+  }
+}
+
+Status BatchNormalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<float> mean,
+                      std::vector<float> std, bool is_hwc) {
+  RETURN_UNEXPECTED_IF_NULL(input);
+  RETURN_UNEXPECTED_IF_NULL(output);
+  constexpr dsize_t kBatchImageRank = 4;
+  CHECK_FAIL_RETURN_UNEXPECTED(input->Rank() == kBatchImageRank,
+                               "Normalize: batched image rank should be: " + std::to_string(kBatchImageRank) +
+                                 ", but got: " + std::to_string(input->Rank()));
+  CHECK_FAIL_RETURN_UNEXPECTED(std.size() == mean.size(),
+                               "Normalize: mean and std vectors are not of same size, got size of std: " +
+                                 std::to_string(std.size()) + ", and mean size: " + std::to_string(mean.size()));
+  // The channel index of the batched image is one more than the single image.
+  const auto &shape = input->shape();
+  int64_t num_channels = is_hwc ? shape[kChannelIndexHWC + 1] : shape[kChannelIndexCHW + 1];
+  if (mean.size() == 1 && num_channels != 1) {
+    mean.resize(num_channels, mean[0]);
+    std.resize(num_channels, std[0]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(num_channels == static_cast<int64_t>(mean.size()),
+                               "Normalize: number of channels does not match the size of mean and std vectors, got "
+                               "channels: " +
+                                 std::to_string(num_channels) + ", size of mean: " + std::to_string(mean.size()));
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(input->shape(), DataType(DataType::DE_FLOAT32), output));
+  if (input->Size() == 0) {
+    return Status::OK();
+  }
+  int64_t num_images = shape[0];
+  int64_t plane_size = input->Size() / (num_images * num_channels);
+  switch (static_cast<int>(input->type().value())) {
+    case DataType::DE_BOOL:
+      BatchNormalizeCaller<bool>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_INT8:
+      BatchNormalizeCaller<int8_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_UINT8:
+      BatchNormalizeUint8(input->GetBuffer(), &(*(*output)->begin<float>()), num_images, plane_size, mean, std,
+                          is_hwc);
+      break;
+    case DataType::DE_INT16:
+      BatchNormalizeCaller<int16_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_UINT16:
+      BatchNormalizeCaller<uint16_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_INT32:
+      BatchNormalizeCaller<int32_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_UINT32:
+      BatchNormalizeCaller<uint32_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_INT64:
+      BatchNormalizeCaller<int64_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_UINT64:
+      BatchNormalizeCaller<uint64_t>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_FLOAT16:
+      BatchNormalizeCaller<float16>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_FLOAT32:
+      BatchNormalizeCaller<float>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    case DataType::DE_FLOAT64:
+      BatchNormalizeCaller<double>(input, output, num_images, plane_size, mean, std, is_hwc);
+      break;
+    default:
+      RETURN_STATUS_UNEXPECTED(
+        "Normalize: unsupported type, currently supported types include "
+        "[bool,int8_t,uint8_t,int16_t,uint16_t,int32_t,uint32_t,int64_t,uint64_t,float16,float,double].");
+  }
+  return Status::OK();
+}
+
+Status NormalizeFlipHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                             std::vector<float> mean, std::vector<float> std, bool flip) {
+  RETURN_UNEXPECTED_IF_NULL(input);
+  RETURN_UNEXPECTED_IF_NULL(output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input->Rank() == kDefaultImageRank,
+                               "Normalize: image shape should be <H,W,C>, but got rank: " +
+                                 std::to_string(input->Rank()));
+  CHECK_FAIL_RETURN_UNEXPECTED(input->type() == DataType::DE_UINT8,
+                               "Normalize: image type should be uint8, but got: " + input->type().ToString());
+  CHECK_FAIL_RETURN_UNEXPECTED(std.size() == mean.size(),
+                               "Normalize: mean and std vectors are not of same size, got size of std: " +
+                                 std::to_string(std.size()) + ", and mean size: " + std::to_string(mean.size()));
+  int64_t height = input->shape()[0];
+  int64_t width = input->shape()[1];
+  int64_t num_channels = input->shape()[kChannelIndexHWC];
+  if (mean.size() == 1 && num_channels != 1) {
+    mean.resize(num_channels, mean[0]);
+    std.resize(num_channels, std[0]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(num_channels == static_cast<int64_t>(mean.size()),
+                               "Normalize: number of channels does not match the size of mean and std vectors, got "
+                               "channels: " +
+                                 std::to_string(num_channels) + ", size of mean: " + std::to_string(mean.size()));
+  RETURN_IF_NOT_OK(
+    Tensor::CreateEmpty(TensorShape{num_channels, height, width}, DataType(DataType::DE_FLOAT32), output));
+  if (input->Size() == 0) {
+    return Status::OK();
+  }
+  NormalizeUint8HwcToChw(input->GetBuffer(), &(*(*output)->begin<float>()), height, width, num_channels, mean.data(),
+                         std.data(), flip);
+  return Status::OK();
+}
+
 Status NormalizePad(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<float> mean,
                     std::vector<float> std, const std::string &dtype, bool is_hwc) {
   RETURN_IF_NOT_OK(ValidateImageRank("NormalizePad", input->Rank()));
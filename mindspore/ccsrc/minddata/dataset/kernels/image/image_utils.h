@@ -157,8 +157,12 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input);
 
 void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size);
 
+/// \brief Decodes the crop region of the jpeg image only
+/// \param x, y, w, h: The crop region in the coordinate of the original image, the whole image is decoded if all zero.
+/// \param scale_denom: Decode at 1/scale_denom of the size by the DCT scaling of libjpeg, must be 1, 2, 4 or 8.
+///     The crop region is scaled accordingly, which saves most of the decoding when the region is downsized later.
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
-                         int w = 0, int h = 0);
+                         int w = 0, int h = 0, int scale_denom = 1);
 
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
@@ -187,6 +191,11 @@ Status ConvertColor(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor
 /// \param output: Tensor of shape <C,H,W> or <H,W> and same input type.
 Status HwcToChw(std::shared_ptr<Tensor> input, std::shared_ptr<Tensor> *output);
 
+/// \brief Swaps the channels of a batch of images, i.e. converts NHWC to NCHW
+/// \param input: Tensor of shape <N,H,W,C> and any fixed size type.
+/// \param output: Tensor of shape <N,C,H,W> and same input type.
+Status BatchHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+
 /// \brief Masks the given part of the input image with a another image (sub_mat)
 /// \param[in] sub_mat The image we want to mask with
 /// \param[in] input The pointer to the image we want to mask
@@ -249,6 +258,24 @@ Status Rotate(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *out
 Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<float> mean,
                  std::vector<float> std, bool is_hwc);
 
+/// \brief Returns Normalized batch of images
+/// \param input: Tensor of shape <N,H,W,C> or <N,C,H,W> and any numeric type.
+/// \param mean: vector of float values which are mean of each channel
+/// \param std:  vector of float values which are std of each channel
+/// \param is_hwc: Check if input is NHWC/NCHW format
+/// \param output: Normalized batch Tensor of same input shape and type DE_FLOAT32
+Status BatchNormalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<float> mean,
+                      std::vector<float> std, bool is_hwc);
+
+/// \brief Normalizes the image, flips it horizontally if required and converts it from HWC to CHW in one pass
+/// \param input: Tensor of shape <H,W,C> and type DE_UINT8.
+/// \param mean: vector of float values which are mean of each channel
+/// \param std:  vector of float values which are std of each channel
+/// \param flip: Whether to flip the image horizontally
+/// \param output: Normalized image Tensor of shape <C,H,W> and type DE_FLOAT32
+Status NormalizeFlipHwcToChw(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                             std::vector<float> mean, std::vector<float> std, bool flip);
+
 /// \brief Returns Normalized and padded image
 /// \param input: Tensor of shape <H,W,C> in RGB order and any OpenCv compatible type, see CVTensor.
 /// \param mean: vector of float values which are mean of each channel
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <limits>
 #include <random>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -749,53 +750,91 @@ static bool CheckMeanAndStd(const LiteMat &src, LiteMat &dst, int channel, const
   return true;
 }
 
-bool SubStractMeanNormalize(const LiteMat &src, LiteMat &dst, const std::vector<float> &mean,
-                            const std::vector<float> &std) {
-  if (!CheckMeanAndStd(src, dst, src.channel_, mean, std)) {
-    return false;
+// Fold the mean and std of each channel into dst = (src - offset) * scale.
+static void GetNormalizeParams(const std::vector<float> &mean, const std::vector<float> &std, int channel,
+                               std::vector<float> *offset, std::vector<float> *scale) {
+  offset->assign(channel, 0.0f);
+  scale->assign(channel, 1.0f);
+  for (int c = 0; c < channel; c++) {
+    if (!mean.empty()) {
+      (*offset)[c] = mean[c];
+    }
+    if (!std.empty()) {
+      (*scale)[c] = 1.0f / std[c];
+    }
   }
-  LiteMat src_f;
-  if (src.data_type_ == LDataType::UINT8) {
-    ConvertTo(src, src_f, 1.0);
-  } else {
-    src_f = src;
-  }
-
-  const float *src_start_p = src_f;
-  float *dst_start_p = dst;
-  if ((!mean.empty()) && std.empty()) {
-    for (int h = 0; h < src_f.height_; h++) {
-      for (int w = 0; w < src_f.width_; w++) {
-        uint32_t src_start = (h * src_f.width_ + w) * src_f.channel_;
-        for (int c = 0; c < src_f.channel_; c++) {
-          uint32_t index = src_start + c;
-          dst_start_p[index] = src_start_p[index] - mean[c];
+}
+
+#ifdef ENABLE_NEON
+static inline void UInt8x8ToFloat32x4x2(uint8x8_t v_src, float32x4_t *v_low, float32x4_t *v_high) {
+  uint16x8_t v_u16 = vmovl_u8(v_src);
+  *v_low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(v_u16)));
+  *v_high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(v_u16)));
+}
+#endif
+
+template <typename T>
+static void SubStractMeanNormalizeImpl(const T *src_ptr, float *dst_ptr, int64_t pixel_num, int channel,
+                                       const float *offset, const float *scale) {
+  int64_t i = 0;
+#ifdef ENABLE_NEON
+  constexpr int kNormalizeChannel = 3;
+  if (channel == kNormalizeChannel) {
+    float32x4_t v_offset[kNormalizeChannel];
+    float32x4_t v_scale[kNormalizeChannel];
+    for (int c = 0; c < kNormalizeChannel; c++) {
+      v_offset[c] = vdupq_n_f32(offset[c]);
+      v_scale[c] = vdupq_n_f32(scale[c]);
+    }
+    if constexpr (std::is_same_v<T, uint8_t>) {
+      const int64_t step = 8;
+      for (; i <= pixel_num - step; i += step) {
+        uint8x8x3_t v_src = vld3_u8(src_ptr + i * kNormalizeChannel);
+        float32x4x3_t v_dst_low;
+        float32x4x3_t v_dst_high;
+        for (int c = 0; c < kNormalizeChannel; c++) {
+          UInt8x8ToFloat32x4x2(v_src.val[c], &v_dst_low.val[c], &v_dst_high.val[c]);
+          v_dst_low.val[c] = vmulq_f32(vsubq_f32(v_dst_low.val[c], v_offset[c]), v_scale[c]);
+          v_dst_high.val[c] = vmulq_f32(vsubq_f32(v_dst_high.val[c], v_offset[c]), v_scale[c]);
         }
+        vst3q_f32(dst_ptr + i * kNormalizeChannel, v_dst_low);
+        vst3q_f32(dst_ptr + (i + step / 2) * kNormalizeChannel, v_dst_high);
       }
-    }
-  } else if (mean.empty() && (!std.empty())) {
-    for (int h = 0; h < src_f.height_; h++) {
-      for (int w = 0; w < src_f.width_; w++) {
-        uint32_t src_start = (h * src_f.width_ + w) * src_f.channel_;
-        for (int c = 0; c < src_f.channel_; c++) {
-          uint32_t index = src_start + c;
-          dst_start_p[index] = src_start_p[index] / std[c];
+    } else {
+      const int64_t step = 4;
+      for (; i <= pixel_num - step; i += step) {
+        float32x4x3_t v_src = vld3q_f32(src_ptr + i * kNormalizeChannel);
+        for (int c = 0; c < kNormalizeChannel; c++) {
+          v_src.val[c] = vmulq_f32(vsubq_f32(v_src.val[c], v_offset[c]), v_scale[c]);
         }
+        vst3q_f32(dst_ptr + i * kNormalizeChannel, v_src);
       }
     }
-  } else if ((!mean.empty()) && (!std.empty())) {
-    for (int h = 0; h < src_f.height_; h++) {
-      for (int w = 0; w < src_f.width_; w++) {
-        uint32_t src_start = (h * src_f.width_ + w) * src_f.channel_;
-        for (int c = 0; c < src_f.channel_; c++) {
-          uint32_t index = src_start + c;
-          dst_start_p[index] = (src_start_p[index] - mean[c]) / std[c];
-        }
-      }
+  }
+#endif
+  for (; i < pixel_num; i++) {
+    for (int c = 0; c < channel; c++) {
+      int64_t index = i * channel + c;
+      dst_ptr[index] = (static_cast<float>(src_ptr[index]) - offset[c]) * scale[c];
     }
-  } else {
+  }
+}
+
+bool SubStractMeanNormalize(const LiteMat &src, LiteMat &dst, const std::vector<float> &mean,
+                            const std::vector<float> &std) {
+  if (!CheckMeanAndStd(src, dst, src.channel_, mean, std)) {
     return false;
   }
+  std::vector<float> offset;
+  std::vector<float> scale;
+  GetNormalizeParams(mean, std, src.channel_, &offset, &scale);
+  // The uint8 image is normalized directly, without converting it to a float image first.
+  int64_t pixel_num = static_cast<int64_t>(src.height_) * src.width_;
+  if (src.data_type_ == LDataType::UINT8) {
+    SubStractMeanNormalizeImpl<uint8_t>(src, dst, pixel_num, src.channel_, offset.data(), scale.data());
+  } else {
+    SubStractMeanNormalizeImpl<float>(src, dst, pixel_num, src.channel_, offset.data(), scale.data());
+  }
   return true;
 }
 
@@ -2098,5 +2137,63 @@ bool HWC2CHW(LiteMat &src, LiteMat &dst) {
   return true;
 }
 
+static void NormalizeHWC2CHWImpl(const uint8_t *src_ptr, float *dst_ptr, int64_t pixel_num, int channel,
+                                 const float *offset, const float *scale) {
+  int64_t i = 0;
+#ifdef ENABLE_NEON
+  constexpr int kNormalizeChannel = 3;
+  if (channel == kNormalizeChannel) {
+    float32x4_t v_offset[kNormalizeChannel];
+    float32x4_t v_scale[kNormalizeChannel];
+    for (int c = 0; c < kNormalizeChannel; c++) {
+      v_offset[c] = vdupq_n_f32(offset[c]);
+      v_scale[c] = vdupq_n_f32(scale[c]);
+    }
+    const int64_t step = 8;
+    for (; i <= pixel_num - step; i += step) {
+      uint8x8x3_t v_src = vld3_u8(src_ptr + i * kNormalizeChannel);
+      for (int c = 0; c < kNormalizeChannel; c++) {
+        float32x4_t v_low;
+        float32x4_t v_high;
+        UInt8x8ToFloat32x4x2(v_src.val[c], &v_low, &v_high);
+        float *dst_plane = dst_ptr + c * pixel_num + i;
+        vst1q_f32(dst_plane, vmulq_f32(vsubq_f32(v_low, v_offset[c]), v_scale[c]));
+        vst1q_f32(dst_plane + step / 2, vmulq_f32(vsubq_f32(v_high, v_offset[c]), v_scale[c]));
+      }
+    }
+  }
+#endif
+  for (; i < pixel_num; i++) {
+    for (int c = 0; c < channel; c++) {
+      dst_ptr[c * pixel_num + i] = (static_cast<float>(src_ptr[i * channel + c]) - offset[c]) * scale[c];
+    }
+  }
+}
+
+bool ResizeNormalizeHWC2CHW(const LiteMat &src, float *dst, int dst_w, int dst_h, const std::vector<float> &mean,
+                            const std::vector<float> &std) {
+  if (dst == nullptr || src.IsEmpty() || src.data_type_ != LDataType::UINT8 || dst_w <= 0 || dst_h <= 0) {
+    return false;
+  }
+  if ((!mean.empty() && mean.size() != src.channel_) || (!std.empty() && std.size() != src.channel_) ||
+      CheckZero(std)) {
+    return false;
+  }
+  LiteMat resized;
+  if (src.width_ != dst_w || src.height_ != dst_h) {
+    if (!ResizeBilinear(src, resized, dst_w, dst_h)) {
+      return false;
+    }
+  } else {
+    resized = src;
+  }
+  std::vector<float> offset;
+  std::vector<float> scale;
+  GetNormalizeParams(mean, std, src.channel_, &offset, &scale);
+  NormalizeHWC2CHWImpl(resized, dst, static_cast<int64_t>(dst_h) * dst_w, src.channel_, offset.data(),
+                       scale.data());
+  return true;
+}
+
 }  // namespace dataset
 }  // namespace mindspore
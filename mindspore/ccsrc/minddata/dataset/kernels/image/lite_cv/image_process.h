@@ -651,6 +651,28 @@ bool ResizePreserveARWithFiller(LiteMat &src, LiteMat &dst, int h, int w, float
 /// \return Return true if transform successfully.
 bool HWC2CHW(LiteMat &src, LiteMat &dst);
 
+/// \brief Resize the uint8 image by bilinear, normalize it, and transpose it to shape (C, H, W) in one pass, which
+///     writes the result straight into the float buffer, e.g. the input tensor of the model.
+/// \param[in] src Input image data, the channel supports is 3 and 1.
+/// \param[in] dst Output buffer with dst_h * dst_w * channel floats.
+/// \param[in] dst_w The width of the output image.
+/// \param[in] dst_h The height of the output image.
+/// \param[in] mean Mean of the data set, empty means no subtraction.
+/// \param[in] std Norm of the data set, empty means no division.
+/// \par Example
+/// \code
+///     /* Assume p_rgb is a pointer that points to an image with shape (width, height, channel) */
+///     LiteMat lite_mat_src(width, height, channel, (void *)p_rgb, LDataType::UINT8);
+///     float *input_data = reinterpret_cast<float *>(input_tensor->MutableData());
+///
+///     std::vector<float> means = {123.675, 116.28, 103.53};
+///     std::vector<float> stds = {58.395, 57.12, 57.375};
+///     ResizeNormalizeHWC2CHW(lite_mat_src, input_data, 224, 224, means, stds);
+/// \endcode
+/// \return Return true if transform successfully.
+bool ResizeNormalizeHWC2CHW(const LiteMat &src, float *dst, int dst_w, int dst_h, const std::vector<float> &mean,
+                            const std::vector<float> &std);
+
 }  // namespace dataset
 }  // namespace mindspore
 #endif  // IMAGE_PROCESS_H_
@@ -40,6 +40,23 @@ Status NormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_pt
 #endif
 }
 
+Status NormalizeOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+#ifndef ENABLE_ANDROID
+  return BatchNormalize(input, output, mean_, std_, is_hwc_);
+#else
+  return TensorOp::BatchCompute(input, output);
+#endif
+}
+
+int32_t NormalizeOp::BatchInputRank() const {
+#ifndef ENABLE_ANDROID
+  return static_cast<int32_t>(kDefaultImageRank) + 1;
+#else
+  return 0;
+#endif
+}
+
 void NormalizeOp::Print(std::ostream &out) const {
   out << "NormalizeOp, mean: ";
   for (const auto &m : mean_) {
@@ -36,8 +36,19 @@ class NormalizeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // Normalize the images batched to <N,H,W,C> or <N,C,H,W> in one call.
+  Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  int32_t BatchInputRank() const override;
+
   std::string Name() const override { return kNormalizeOp; }
 
+  const std::vector<float> &mean() const { return mean_; }
+
+  const std::vector<float> &std() const { return std_; }
+
+  bool is_hwc() const { return is_hwc_; }
+
  private:
   std::vector<float> mean_;
   std::vector<float> std_;
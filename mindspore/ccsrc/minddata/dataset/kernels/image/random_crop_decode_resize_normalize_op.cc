@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+
+namespace mindspore {
+namespace dataset {
+RandomCropDecodeResizeNormalizeOp::RandomCropDecodeResizeNormalizeOp(const RandomCropAndResizeOp &crop_op,
+                                                                     float flip_prob, const std::vector<float> &mean,
+                                                                     const std::vector<float> &std)
+    : RandomCropAndResizeOp(crop_op), flip_distribution_(flip_prob), mean_(mean), std_(std) {}
+
+int RandomCropDecodeResizeNormalizeOp::GetScaleDenom(int crop_height, int crop_width) const {
+  constexpr int kMaxScaleDenom = 8;
+  for (int scale_denom = kMaxScaleDenom; scale_denom > 1; scale_denom /= 2) {
+    if (crop_height / scale_denom >= target_height_ && crop_width / scale_denom >= target_width_) {
+      return scale_denom;
+    }
+  }
+  return 1;
+}
+
+Status RandomCropDecodeResizeNormalizeOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  output->resize(input.size());
+  int x = 0;
+  int y = 0;
+  int crop_height = 0;
+  int crop_width = 0;
+  // All the columns share the same crop box and flip, the same as the separated ops.
+  bool flip = false;
+  for (size_t i = 0; i < input.size(); i++) {
+    std::shared_ptr<Tensor> resized = nullptr;
+    if (IsNonEmptyJPEG(input[i])) {
+      int h_in = 0;
+      int w_in = 0;
+      RETURN_IF_NOT_OK(GetJpegImageInfo(input[i], &w_in, &h_in));
+      if (i == 0) {
+        RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
+        flip = flip_distribution_(rnd_);
+      }
+      std::shared_ptr<Tensor> decoded = nullptr;
+      RETURN_IF_NOT_OK(JpegCropAndDecode(input[i], &decoded, x, y, crop_width, crop_height,
+                                         GetScaleDenom(crop_height, crop_width)));
+      RETURN_IF_NOT_OK(Resize(decoded, &resized, target_height_, target_width_, 0.0, 0.0, interpolation_));
+    } else {
+      DecodeOp op(true);
+      std::shared_ptr<Tensor> decoded = nullptr;
+      RETURN_IF_NOT_OK(op.Compute(input[i], &decoded));
+      RETURN_IF_NOT_OK(ValidateImageRank("RandomCropDecodeResizeNormalize", decoded->Rank()));
+      if (i == 0) {
+        auto h_in = static_cast<int>(decoded->shape()[0]);
+        auto w_in = static_cast<int>(decoded->shape()[1]);
+        RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
+        flip = flip_distribution_(rnd_);
+      }
+      RETURN_IF_NOT_OK(CropAndResize(decoded, &resized, x, y, crop_height, crop_width, target_height_, target_width_,
+                                     interpolation_));
+    }
+    RETURN_IF_NOT_OK(NormalizeFlipHwcToChw(resized, &(*output)[i], mean_, std_, flip));
+  }
+  return Status::OK();
+}
+
+Status RandomCropDecodeResizeNormalizeOp::OutputShape(const std::vector<TensorShape> &inputs,
+                                                      std::vector<TensorShape> &outputs) {
+  outputs.clear();
+  // The image is always decoded to RGB.
+  (void)std::transform(inputs.begin(), inputs.end(), std::back_inserter(outputs), [this](const TensorShape &) {
+    return TensorShape{kDefaultImageChannel, target_height_, target_width_};
+  });
+  return Status::OK();
+}
+
+Status RandomCropDecodeResizeNormalizeOp::OutputType(const std::vector<DataType> &inputs,
+                                                     std::vector<DataType> &outputs) {
+  outputs = std::vector<DataType>(inputs.size(), DataType(DataType::DE_FLOAT32));
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
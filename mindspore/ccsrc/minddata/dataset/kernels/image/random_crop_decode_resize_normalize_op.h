@@ -0,0 +1,69 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+// The fusion of Decode, RandomResizedCrop, RandomHorizontalFlip, Normalize and HWC2CHW, which is the common
+// pipeline of ImageNet-style training. The jpeg image is decoded in the crop region only and downscaled by the DCT
+// scaling when the region is much larger than the target size, then the resized image is flipped, normalized and
+// transposed into the CHW float output in one pass, so the intermediate images of the separated ops are not needed.
+class RandomCropDecodeResizeNormalizeOp : public RandomCropAndResizeOp {
+ public:
+  // @param crop_op The RandomCropAndResize op to provide the crop and resize parameters.
+  // @param flip_prob The probability of the horizontal flip, 0 means no flip.
+  // @param mean The mean of each channel of Normalize.
+  // @param std The std of each channel of Normalize.
+  RandomCropDecodeResizeNormalizeOp(const RandomCropAndResizeOp &crop_op, float flip_prob,
+                                    const std::vector<float> &mean, const std::vector<float> &std);
+
+  ~RandomCropDecodeResizeNormalizeOp() override = default;
+
+  void Print(std::ostream &out) const override {
+    out << Name() << ": " << target_height_ << " " << target_width_ << " flip probability: " << flip_distribution_.p();
+  }
+
+  Status Compute(const TensorRow &input, TensorRow *output) override;
+
+  Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kRandomCropDecodeResizeNormalizeOp; }
+
+ private:
+  // Get the largest DCT scaling denominator which keeps the crop region not smaller than the target size.
+  int GetScaleDenom(int crop_height, int crop_width) const;
+
+  std::bernoulli_distribution flip_distribution_;
+  std::vector<float> mean_;
+  std::vector<float> std_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
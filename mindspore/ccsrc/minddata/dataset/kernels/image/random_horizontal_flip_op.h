@@ -53,6 +53,8 @@ class RandomHorizontalFlipOp : public TensorOp {
 
   uint32_t NumOutput() override { return 1; }
 
+  float probability() const { return static_cast<float>(distribution_.p()); }
+
  private:
   std::mt19937 rnd_;
   std::bernoulli_distribution distribution_;
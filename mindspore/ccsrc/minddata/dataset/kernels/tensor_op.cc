@@ -54,6 +54,13 @@ Status TensorOp::Compute(const std::shared_ptr<DeviceTensor> &input, std::shared
                 "different device. If so, please implement it in the derived class.");
 }
 
+Status TensorOp::BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
+  IO_CHECK(input, output);
+  return Status(StatusCode::kMDUnexpectedError,
+                "Wrong BatchCompute() function is called. If the TensorOp supports the batched input, please implement "
+                "it in the derived class.");
+}
+
 Status TensorOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   if (inputs.size() != NumInput()) {
     return Status(StatusCode::kMDUnexpectedError,
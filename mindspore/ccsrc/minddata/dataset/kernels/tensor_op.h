@@ -91,6 +91,7 @@ constexpr char kRandomColorOp[] = "RandomColorOp";
 constexpr char kRandomCropAndResizeOp[] = "RandomCropAndResizeOp";
 constexpr char kRandomCropAndResizeWithBBoxOp[] = "RandomCropAndResizeWithBBoxOp";
 constexpr char kRandomCropDecodeResizeOp[] = "RandomCropDecodeResizeOp";
+constexpr char kRandomCropDecodeResizeNormalizeOp[] = "RandomCropDecodeResizeNormalizeOp";
 constexpr char kRandomCropOp[] = "RandomCropOp";
 constexpr char kRandomCropWithBBoxOp[] = "RandomCropWithBBoxOp";
 constexpr char kRandomEqualizeOp[] = "RandomEqualizeOp";
@@ -256,6 +257,18 @@ class TensorOp {
   // @return Status
   virtual Status Compute(const std::shared_ptr<DeviceTensor> &input, std::shared_ptr<DeviceTensor> *output);
 
+  // Perform an operation on a block of rows stacked on the first dimension by the batch before the MapOp, e.g. the
+  // images of shape <N,H,W,C>, which saves the per-row call and allocation of the cheap op.
+  // The derived class that supports it should override this function together with BatchInputRank().
+  // @param input the batched Tensor of rank BatchInputRank().
+  // @param output the address to a shared_ptr where the batched result will be placed.
+  // @return Status
+  virtual Status BatchCompute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output);
+
+  // Function to determine the rank of the batched input accepted by BatchCompute(). 0: means not supported.
+  // @return int32_t
+  virtual int32_t BatchInputRank() const { return 0; }
+
   // Returns true oif the TensorOp takes one input and returns one output.
   // @return true/false
   bool OneToOne() { return NumInput() == 1 && NumOutput() == 1; }
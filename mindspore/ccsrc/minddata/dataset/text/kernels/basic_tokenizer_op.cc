@@ -24,6 +24,8 @@
 #include "unicode/errorcode.h"
 #include "unicode/normalizer2.h"
 
+#include "minddata/dataset/text/kernels/data_utils.h"
+
 namespace mindspore {
 namespace dataset {
 
@@ -139,6 +141,67 @@ Status BasicTokenizerOp::CaseFoldWithoutUnusedWords(const std::shared_ptr<Tensor
   return Tensor::CreateFromVector(strs, input->shape(), output);
 }
 
+namespace {
+constexpr unsigned char kAsciiSpace = ' ';
+constexpr unsigned char kAsciiDelete = 0x7F;
+
+// \p{Cc} in ASCII, which is replaced by the whitespace.
+bool IsAsciiWhitespaceOrControl(unsigned char c) { return c <= kAsciiSpace || c == kAsciiDelete; }
+
+// The ASCII ranges of kCommonPattern, which also cover \p{P} in ASCII.
+bool IsAsciiPunctuation(unsigned char c) {
+  return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') || (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+}
+}  // namespace
+
+Status BasicTokenizerOp::Tokenize(std::string_view str, std::vector<std::string> *splits,
+                                  std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) {
+  RETURN_UNEXPECTED_IF_NULL(splits);
+  RETURN_UNEXPECTED_IF_NULL(offsets_start);
+  RETURN_UNEXPECTED_IF_NULL(offsets_limit);
+  auto add_split = [splits, offsets_start, offsets_limit](std::string &&split, size_t start) {
+    offsets_start->push_back(static_cast<uint32_t>(start));
+    offsets_limit->push_back(static_cast<uint32_t>(start + split.size()));
+    (void)splits->emplace_back(std::move(split));
+  };
+  std::string token;
+  size_t token_start = 0;
+  for (size_t i = 0; i < str.size();) {
+    auto c = static_cast<unsigned char>(str[i]);
+    bool is_space = IsAsciiWhitespaceOrControl(c);
+    if (!is_space && !IsAsciiPunctuation(c)) {
+      if (token.empty()) {
+        token_start = i;
+      }
+      token.push_back(lower_case_ && c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : static_cast<char>(c));
+      ++i;
+      continue;
+    }
+    if (!token.empty()) {
+      add_split(std::move(token), token_start);
+      token.clear();
+    }
+    if (is_space) {
+      // The whitespaces are matched as a whole by \s+.
+      size_t end = i + 1;
+      while (end < str.size() && IsAsciiWhitespaceOrControl(static_cast<unsigned char>(str[end]))) {
+        ++end;
+      }
+      if (keep_whitespace_) {
+        add_split(std::string(end - i, kAsciiSpace), i);
+      }
+      i = end;
+    } else {
+      add_split(std::string(1, static_cast<char>(c)), i);
+      ++i;
+    }
+  }
+  if (!token.empty()) {
+    add_split(std::move(token), token_start);
+  }
+  return Status::OK();
+}
+
 Status BasicTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   IO_CHECK_VECTOR(input, output);
   CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1, "BasicTokenizer: input only support one column data.");
@@ -149,6 +212,12 @@ Status BasicTokenizerOp::Compute(const TensorRow &input, TensorRow *output) {
   if (input[0]->type() != DataType::DE_STRING) {
     RETURN_STATUS_UNEXPECTED("BasicTokenizer: the input should be of type string.");
   }
+  std::string_view text;
+  RETURN_IF_NOT_OK(input[0]->GetItemAt(&text, {}));
+  // The unused words need the regex to be preserved, so only the ASCII text without them takes the fast path.
+  if (IsAsciiString(text) && (!preserve_unused_token_ || text.find('[') == std::string_view::npos)) {
+    return TokenizerOp::Compute(input, output);
+  }
   std::shared_ptr<Tensor> cur_input;
   std::shared_ptr<Tensor> processed_tensor;
   if (lower_case_) {
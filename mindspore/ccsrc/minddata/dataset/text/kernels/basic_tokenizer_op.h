@@ -17,7 +17,9 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_BASIC_TOKENIZER_OP_H_
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/tensor_op.h"
@@ -47,6 +49,12 @@ class BasicTokenizerOp : public TokenizerOp {
 
   Status Compute(const TensorRow &input, TensorRow *output) override;
 
+  /// Tokenize the ASCII text without ICU. Every normalization form keeps the ASCII text unchanged, case folding is
+  /// tolower, the control characters become whitespaces, and the delimiters of the regex are the ASCII whitespaces and
+  /// punctuations, so one pass over the text gives the same tokens and offsets as the ICU path.
+  Status Tokenize(std::string_view str, std::vector<std::string> *splits, std::vector<uint32_t> *offsets_start,
+                  std::vector<uint32_t> *offsets_limit) override;
+
  protected:
   Status CaseFoldWithoutUnusedWords(const std::string_view &text, const std::unordered_set<std::string> &unused_words,
                                     std::string *output);
@@ -17,6 +17,7 @@
 #include "minddata/dataset/text/kernels/data_utils.h"
 
 #include <algorithm>
+#include <cstring>
 #include <string>
 
 #include "minddata/dataset/core/pybind_support.h"
@@ -65,5 +66,28 @@ Status AppendOffsetsHelper(const std::vector<uint32_t> &offsets_start, const std
   output->push_back(offsets_limit_tensor);
   return Status::OK();
 }
+
+bool IsAsciiString(std::string_view str) {
+  constexpr uint64_t kHighBitMask = 0x8080808080808080ULL;
+  const char *data = str.data();
+  size_t size = str.size();
+  size_t i = 0;
+  uint64_t high_bits = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    // std::memcpy of a fixed size is inlined as an unaligned load.
+    (void)std::memcpy(&word, data + i, sizeof(word));
+    high_bits |= word;
+  }
+  if ((high_bits & kHighBitMask) != 0) {
+    return false;
+  }
+  for (; i < size; ++i) {
+    if ((static_cast<unsigned char>(data[i]) & kHighBitMask) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/include/dataset/constants.h"
@@ -46,6 +47,11 @@ Status SlidingWindowHelper(const std::shared_ptr<Tensor> &input, std::shared_ptr
 /// \return Status return code
 Status AppendOffsetsHelper(const std::vector<uint32_t> &offsets_start, const std::vector<uint32_t> &offsets_limit,
                            TensorRow *output);
+
+/// \brief Helper method that checks whether the string only contains ASCII characters, eight bytes at a time.
+/// \param[in] str - Input string.
+/// \return Whether all the bytes are lower than 0x80
+bool IsAsciiString(std::string_view str);
 }  // namespace dataset
 }  // namespace mindspore
 #endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_TEXT_DATA_UTILS_H_
@@ -33,24 +33,16 @@ WordpieceTokenizerOp::WordpieceTokenizerOp(const std::shared_ptr<Vocab> &vocab,
       vocab_(vocab),
       suffix_indicator_(suffix_indicator),
       max_bytes_per_token_(max_bytes_per_token),
-      unknown_token_(unknown_token) {}
+      unknown_token_(unknown_token),
+      vocab_trie_(vocab, suffix_indicator) {}
 
-Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start,
-                                        bool *out_found, int *out_end) const {
+Status WordpieceTokenizerOp::LookupWord(const std::string &input_token, const int start, bool *out_found,
+                                        int *out_end) const {
   CHECK_FAIL_RETURN_UNEXPECTED(start >= 0 && start < input_token.size(), "WordpieceTokenizer: LookupWord Out of range");
-  *out_found = false;
-  for (int i = runes.size() - 1; i >= 0; i--) {
-    *out_end = runes[i].offset + runes[i].len;
-    int len = *out_end - start;
-    std::string word = input_token.substr(start, len);
-    if (start > 0) {
-      word = suffix_indicator_ + word;
-    }
-    if (vocab_->TokensToIds(word) != Vocab::kNoTokenExists) {
-      *out_found = true;
-      break;
-    }
-  }
+  // Walk the vocab trie once for the longest subword, instead of looking up every candidate from the longest.
+  size_t end = 0;
+  *out_found = vocab_trie_.LongestMatch(input_token, static_cast<size_t>(start), &end);
+  *out_end = static_cast<int>(end);
   return Status::OK();
 }
 
@@ -95,14 +87,15 @@ Status WordpieceTokenizerOp::GetTokens(const std::string &input_token, const uin
     }
     return Status::OK();
   }
+  // The ASCII token is always valid, only the others need to be decoded for the check.
   RuneStrArray runes;
-  if (!DecodeRunesInString(input_token.data(), input_token.size(), runes)) {
+  if (!IsAsciiString(input_token) && !DecodeRunesInString(input_token.data(), input_token.size(), runes)) {
     RETURN_STATUS_UNEXPECTED("WordpieceTokenizer: Decode utf8 string failed.");
   }
   int end = 0;
   for (int start = 0; start < static_cast<int>(input_token.size());) {
     bool found = false;
-    RETURN_IF_NOT_OK(LookupWord(input_token, runes, start, &found, &end));
+    RETURN_IF_NOT_OK(LookupWord(input_token, start, &found, &end));
     if (found) {
       RETURN_IF_NOT_OK(AddSubword(input_token, start, end, out_tokens));
       offsets_start->push_back(static_cast<uint32_t>(basic_start + start));
@@ -26,6 +26,7 @@
 #include "minddata/dataset/include/dataset/text.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/text/kernels/tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_vocab_trie.h"
 #include "minddata/dataset/util/status.h"
 
 using cppjieba::DecodeRunesInString;
@@ -51,8 +52,7 @@ class WordpieceTokenizerOp : public TokenizerOp {
                     std::vector<std::string> *out_tokens) const;
   Status FoundNoToken(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
                       std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
-  Status LookupWord(const std::string &input_token, const RuneStrArray &runes, const int start, bool *out_found,
-                    int *out_end) const;
+  Status LookupWord(const std::string &input_token, const int start, bool *out_found, int *out_end) const;
   Status GetTokens(const std::string &input_token, const uint32_t &basic_start, std::vector<std::string> *out_tokens,
                    std::vector<uint32_t> *offsets_start, std::vector<uint32_t> *offsets_limit) const;
 
@@ -63,6 +63,7 @@ class WordpieceTokenizerOp : public TokenizerOp {
   const std::string suffix_indicator_;
   const int max_bytes_per_token_;
   const std::string unknown_token_;
+  const WordpieceVocabTrie vocab_trie_;
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/text/kernels/wordpiece_vocab_trie.h"
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+constexpr uint32_t kNoNode = UINT32_MAX;
+constexpr unsigned char kUtf8ContinuationMask = 0xC0;
+constexpr unsigned char kUtf8ContinuationByte = 0x80;
+
+// A UTF-8 character never ends right before a continuation byte.
+bool IsCharBoundary(std::string_view text, size_t pos) {
+  return pos >= text.size() ||
+         (static_cast<unsigned char>(text[pos]) & kUtf8ContinuationMask) != kUtf8ContinuationByte;
+}
+}  // namespace
+
+WordpieceVocabTrie::WordpieceVocabTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator) {
+  // The building nodes keep the unsorted edges, node 0 and node 1 are the word root and the suffix root.
+  std::vector<std::vector<std::pair<unsigned char, uint32_t>>> children(kSuffixRoot + 1);
+  std::vector<bool> is_word(kSuffixRoot + 1, false);
+  auto insert = [&children, &is_word](uint32_t root, std::string_view word) {
+    uint32_t node = root;
+    for (char c : word) {
+      auto label = static_cast<unsigned char>(c);
+      auto &edges = children[node];
+      auto iter = std::find_if(edges.begin(), edges.end(), [label](const auto &edge) { return edge.first == label; });
+      if (iter != edges.end()) {
+        node = iter->second;
+        continue;
+      }
+      auto child = static_cast<uint32_t>(children.size());
+      edges.emplace_back(label, child);
+      children.emplace_back();
+      is_word.push_back(false);
+      node = child;
+    }
+    is_word[node] = true;
+  };
+  if (vocab != nullptr) {
+    for (const auto &[word, id] : vocab->GetVocab()) {
+      insert(kWordRoot, word);
+      if (!suffix_indicator.empty() && word.size() > suffix_indicator.size() &&
+          word.compare(0, suffix_indicator.size(), suffix_indicator) == 0) {
+        insert(kSuffixRoot, std::string_view(word).substr(suffix_indicator.size()));
+      }
+    }
+  }
+  Build(children, is_word);
+}
+
+void WordpieceVocabTrie::Build(const std::vector<std::vector<std::pair<unsigned char, uint32_t>>> &children,
+                               const std::vector<bool> &is_word) {
+  nodes_.resize(children.size());
+  for (size_t i = 0; i < children.size(); ++i) {
+    auto edges = children[i];
+    std::sort(edges.begin(), edges.end());
+    nodes_[i].edge_begin = static_cast<uint32_t>(labels_.size());
+    for (const auto &[label, child] : edges) {
+      labels_.push_back(label);
+      targets_.push_back(child);
+    }
+    nodes_[i].edge_end = static_cast<uint32_t>(labels_.size());
+    nodes_[i].is_word = is_word[i];
+  }
+}
+
+uint32_t WordpieceVocabTrie::Child(uint32_t node, unsigned char label) const {
+  auto begin = labels_.begin() + nodes_[node].edge_begin;
+  auto end = labels_.begin() + nodes_[node].edge_end;
+  auto iter = std::lower_bound(begin, end, label);
+  if (iter == end || *iter != label) {
+    return kNoNode;
+  }
+  return targets_[static_cast<size_t>(iter - labels_.begin())];
+}
+
+bool WordpieceVocabTrie::LongestMatch(std::string_view text, size_t start, size_t *end) const {
+  bool found = false;
+  uint32_t node = start == 0 ? kWordRoot : kSuffixRoot;
+  for (size_t pos = start; pos < text.size(); ++pos) {
+    node = Child(node, static_cast<unsigned char>(text[pos]));
+    if (node == kNoNode) {
+      break;
+    }
+    if (nodes_[node].is_word && IsCharBoundary(text, pos + 1)) {
+      *end = pos + 1;
+      found = true;
+    }
+  }
+  return found;
+}
+}  // namespace dataset
+}  // namespace mindspore
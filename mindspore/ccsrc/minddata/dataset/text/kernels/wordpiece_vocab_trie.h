@@ -0,0 +1,68 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_VOCAB_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_VOCAB_TRIE_H_
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "minddata/dataset/include/dataset/text.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A byte trie of the vocab for the greedy longest-match-first lookup of WordpieceTokenizer.
+/// The words are kept under the word root, and the words starting with the suffix indicator are also kept under the
+/// suffix root without the indicator, so the longest subword at any position is found in one walk, without building
+/// the candidate strings. The nodes are flattened with their edges sorted by byte after building.
+class WordpieceVocabTrie {
+ public:
+  WordpieceVocabTrie(const std::shared_ptr<Vocab> &vocab, const std::string &suffix_indicator);
+
+  ~WordpieceVocabTrie() = default;
+
+  /// \brief Find the longest word of the vocab that is a prefix of text[start:] and ends at a character boundary.
+  /// \param[in] text - The UTF-8 token.
+  /// \param[in] start - The byte offset to match from, the subwords after the first one are looked up with the suffix
+  ///     indicator.
+  /// \param[out] end - The end byte offset of the found word.
+  /// \return Whether a word is found
+  bool LongestMatch(std::string_view text, size_t start, size_t *end) const;
+
+ private:
+  struct Node {
+    uint32_t edge_begin;
+    uint32_t edge_end;
+    bool is_word;
+  };
+
+  static constexpr uint32_t kWordRoot = 0;
+  static constexpr uint32_t kSuffixRoot = 1;
+
+  void Build(const std::vector<std::vector<std::pair<unsigned char, uint32_t>>> &children,
+             const std::vector<bool> &is_word);
+
+  uint32_t Child(uint32_t node, unsigned char label) const;
+
+  std::vector<Node> nodes_;
+  std::vector<unsigned char> labels_;
+  std::vector<uint32_t> targets_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_KERNELS_WORDPIECE_VOCAB_TRIE_H_
@@ -0,0 +1,212 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/util/recycle_pool.h"
+
+#include <cstdlib>
+#include <functional>
+#include <limits>
+#include <thread>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The header before each buffer keeps the size class, and keeps the buffer aligned the same as malloc.
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kMinClassLog2 = 6;
+constexpr size_t kMinClassSize = 1UL << kMinClassLog2;
+constexpr size_t kSubClassLog2 = 2;
+constexpr size_t kSubClasses = 1UL << kSubClassLog2;
+constexpr size_t kMaxClassLog2 = 26;
+constexpr size_t kNumShards = 16;
+constexpr size_t kUnpooledIndex = std::numeric_limits<size_t>::max();
+// index 0 is kMinClassSize, then kSubClasses classes for each power of 2 up to 1 << kMaxClassLog2
+constexpr size_t kNumClasses = (kMaxClassLog2 - kMinClassLog2) * kSubClasses + 1;
+
+size_t &HeaderOf(void *p) { return *reinterpret_cast<size_t *>(reinterpret_cast<uint8_t *>(p) - kHeaderSize); }
+}  // namespace
+
+std::ostream &operator<<(std::ostream &os, const RecyclePoolStats &stats) {
+  os << "allocations: " << stats.num_allocations << ", hits: " << stats.num_hits << ", hit rate: " << stats.hit_rate()
+     << ", unpooled: " << stats.num_unpooled << ", released: " << stats.num_released
+     << ", cached bytes: " << stats.cached_bytes;
+  return os;
+}
+
+RecyclePool::RecyclePool(size_t capacity)
+    : capacity_(capacity), cached_bytes_(0), shards_(std::make_unique<Shard[]>(kNumShards)) {
+  for (size_t i = 0; i < kNumShards; ++i) {
+    shards_[i].free_lists.resize(kNumClasses);
+  }
+}
+
+RecyclePool::~RecyclePool() {
+  for (size_t i = 0; i < kNumShards; ++i) {
+    for (auto &free_list : shards_[i].free_lists) {
+      for (auto block : free_list) {
+        free(block);
+      }
+    }
+  }
+}
+
+size_t RecyclePool::SizeClassIndex(size_t n) {
+  if (n <= kMinClassSize) {
+    return 0;
+  }
+  // base < n <= 2 * base, and the range is divided into kSubClasses steps
+  size_t log2 = kMinClassLog2;
+  while ((n - 1) >> (log2 + 1)) {
+    ++log2;
+  }
+  size_t base = 1UL << log2;
+  size_t step = base >> kSubClassLog2;
+  size_t sub = (n - base + step - 1) / step;
+  return (log2 - kMinClassLog2) * kSubClasses + sub;
+}
+
+size_t RecyclePool::SizeClassSize(size_t index) {
+  if (index == 0) {
+    return kMinClassSize;
+  }
+  size_t log2 = (index - 1) / kSubClasses + kMinClassLog2;
+  size_t sub = (index - 1) % kSubClasses + 1;
+  return (1UL << log2) + sub * ((1UL << log2) >> kSubClassLog2);
+}
+
+RecyclePool::Shard *RecyclePool::ThreadShard() {
+  thread_local size_t shard_id = std::hash<std::thread::id>()(std::this_thread::get_id()) % kNumShards;
+  return &shards_[shard_id];
+}
+
+void *RecyclePool::TakeCached(size_t index, Shard *own_shard) {
+  {
+    std::lock_guard<std::mutex> lock(own_shard->mutex);
+    ++own_shard->num_allocations;
+    auto &free_list = own_shard->free_lists[index];
+    if (!free_list.empty()) {
+      ++own_shard->num_hits;
+      void *block = free_list.back();
+      free_list.pop_back();
+      return block;
+    }
+  }
+  for (size_t i = 0; i < kNumShards; ++i) {
+    Shard *shard = &shards_[i];
+    if (shard == own_shard) {
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(shard->mutex, std::try_to_lock);
+    if (!lock.owns_lock() || shard->free_lists[index].empty()) {
+      continue;
+    }
+    void *block = shard->free_lists[index].back();
+    shard->free_lists[index].pop_back();
+    lock.unlock();
+    std::lock_guard<std::mutex> own_lock(own_shard->mutex);
+    ++own_shard->num_hits;
+    return block;
+  }
+  return nullptr;
+}
+
+Status RecyclePool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  size_t index = SizeClassIndex(n);
+  Shard *shard = ThreadShard();
+  void *block = nullptr;
+  if (index >= kNumClasses) {
+    index = kUnpooledIndex;
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      ++shard->num_unpooled;
+    }
+    RETURN_IF_NOT_OK(DeMalloc(n + kHeaderSize, &block, false));
+  } else {
+    block = TakeCached(index, shard);
+    if (block != nullptr) {
+      cached_bytes_.fetch_sub(SizeClassSize(index), std::memory_order_relaxed);
+    } else {
+      RETURN_IF_NOT_OK(DeMalloc(SizeClassSize(index) + kHeaderSize, &block, false));
+    }
+  }
+  *p = reinterpret_cast<uint8_t *>(block) + kHeaderSize;
+  HeaderOf(*p) = index;
+  return Status::OK();
+}
+
+Status RecyclePool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  size_t index = HeaderOf(*p);
+  if (old_sz >= new_sz || (index != kUnpooledIndex && SizeClassSize(index) >= new_sz)) {
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  errno_t err = memcpy_s(q, new_sz, *p, old_sz);
+  if (err) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED(std::to_string(err));
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void RecyclePool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  size_t index = HeaderOf(p);
+  void *block = reinterpret_cast<uint8_t *>(p) - kHeaderSize;
+  if (index == kUnpooledIndex) {
+    free(block);
+    return;
+  }
+  size_t size = SizeClassSize(index);
+  Shard *shard = ThreadShard();
+  if (cached_bytes_.fetch_add(size, std::memory_order_relaxed) + size > capacity()) {
+    cached_bytes_.fetch_sub(size, std::memory_order_relaxed);
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      ++shard->num_released;
+    }
+    free(block);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(shard->mutex);
+  shard->free_lists[index].push_back(block);
+}
+
+uint64_t RecyclePool::get_max_size() const { return std::numeric_limits<uint64_t>::max(); }
+
+int RecyclePool::PercentFree() const { return 100; }
+
+RecyclePoolStats RecyclePool::GetStats() const {
+  RecyclePoolStats stats;
+  for (size_t i = 0; i < kNumShards; ++i) {
+    std::lock_guard<std::mutex> lock(shards_[i].mutex);
+    stats.num_allocations += shards_[i].num_allocations;
+    stats.num_hits += shards_[i].num_hits;
+    stats.num_unpooled += shards_[i].num_unpooled;
+    stats.num_released += shards_[i].num_released;
+  }
+  stats.cached_bytes = cached_bytes_.load(std::memory_order_relaxed);
+  return stats;
+}
+}  // namespace dataset
+}  // namespace mindspore
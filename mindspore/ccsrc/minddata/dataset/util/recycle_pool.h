@@ -0,0 +1,101 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+struct RecyclePoolStats {
+  uint64_t num_allocations = 0;  // allocations served by the size classes
+  uint64_t num_hits = 0;         // allocations served by a recycled buffer
+  uint64_t num_unpooled = 0;     // allocations too large to be recycled
+  uint64_t num_released = 0;     // freed buffers returned to the system because the pool is full
+  uint64_t cached_bytes = 0;     // bytes of the recycled buffers waiting for reuse
+
+  double hit_rate() const { return num_allocations == 0 ? 0 : static_cast<double>(num_hits) / num_allocations; }
+};
+
+std::ostream &operator<<(std::ostream &os, const RecyclePoolStats &stats);
+
+// A malloc based MemoryPool which keeps the freed buffers in size classes and hands them out again, so the tensors
+// of the same shape created batch after batch reuse the buffers instead of going through malloc and free.
+// The size classes have 4 steps per power of 2, so the waste is within 25%. The free lists are sharded by thread to
+// keep the lock contention low, and an allocation steals from the other shards before calling malloc, because the
+// buffer is usually freed by a thread other than the one which allocated it.
+// \note The cached bytes are capped by the capacity, the freed buffers above it are returned to the system.
+class RecyclePool : public MemoryPool {
+ public:
+  explicit RecyclePool(size_t capacity);
+
+  RecyclePool(const RecyclePool &) = delete;
+
+  RecyclePool &operator=(const RecyclePool &) = delete;
+
+  ~RecyclePool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override;
+
+  // Change the maximum bytes of the recycled buffers, 0 means to return every freed buffer to the system.
+  void set_capacity(size_t capacity) { capacity_.store(capacity, std::memory_order_relaxed); }
+
+  size_t capacity() const { return capacity_.load(std::memory_order_relaxed); }
+
+  RecyclePoolStats GetStats() const;
+
+  static size_t SizeClassIndex(size_t n);
+
+  static size_t SizeClassSize(size_t index);
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    std::vector<std::vector<void *>> free_lists;
+    uint64_t num_allocations = 0;
+    uint64_t num_hits = 0;
+    uint64_t num_unpooled = 0;
+    uint64_t num_released = 0;
+  };
+
+  void *TakeCached(size_t index, Shard *own_shard);
+
+  Shard *ThreadShard();
+
+  std::atomic<size_t> capacity_;
+  std::atomic<size_t> cached_bytes_;
+  std::unique_ptr<Shard[]> shards_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SPSC_RING_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SPSC_RING_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+// A bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+// The elements are moved into and out of the slots, so move-only types like TensorRow are handed over without copy.
+// The head is only written by the consumer and the tail is only written by the producer, and they are kept in
+// different cache lines to avoid the false sharing between the two threads.
+template <typename T>
+class SpscRing {
+ public:
+  explicit SpscRing(size_t capacity) {
+    size_t slot_num = 1;
+    while (slot_num < capacity) {
+      slot_num <<= 1;
+    }
+    capacity_ = capacity == 0 ? 1 : capacity;
+    mask_ = slot_num - 1;
+    slots_ = std::make_unique<T[]>(slot_num);
+  }
+  ~SpscRing() = default;
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  // Only called by the producer thread, return false and keep the element when the ring is full.
+  bool TryPush(T &&element) {
+    auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) >= capacity_) {
+      return false;
+    }
+    slots_[tail & mask_] = std::move(element);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Only called by the consumer thread, return false when the ring is empty.
+  bool TryPop(T *element) {
+    auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *element = std::move(slots_[head & mask_]);
+    // Leave a default element in the slot so that the resource held by the popped one is not kept by the ring.
+    slots_[head & mask_] = T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Drop all the elements, must not be called while the producer or the consumer is running.
+  void Reset() {
+    T element;
+    while (TryPop(&element)) {
+    }
+    head_.store(0);
+    tail_.store(0);
+  }
+
+  size_t size() const { return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire); }
+
+  size_t capacity() const { return capacity_; }
+
+  bool empty() const { return size() == 0; }
+
+ private:
+  static constexpr size_t kCacheLineSize = 64;
+  alignas(kCacheLineSize) std::atomic<size_t> head_{0};
+  alignas(kCacheLineSize) std::atomic<size_t> tail_{0};
+  alignas(kCacheLineSize) size_t capacity_{1};
+  size_t mask_{0};
+  std::unique_ptr<T[]> slots_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_SPSC_RING_H_
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "minddata/mindrecord/include/common/log_adapter.h"
+#include "minddata/mindrecord/include/common/shard_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+// the suffix of the columnar index file, which is written beside the sqlite meta file
+const char kColumnarIndexSuffix[] = ".idx";
+
+/// \brief The columnar index of one mindrecord file, which creates the tasks without the sqlite meta file.
+/// The rows are sorted by ROW_ID, and the location columns (ROW_ID, ROW_GROUP_ID, PAGE_ID_RAW ...) are plain arrays.
+/// Each index field is encoded by the sorted distinct values, the value id of each row and the rows of each value,
+/// so the filtering by category is a binary search. The rows of each blob page (row group) are contiguous and the
+/// row range of each page is recorded. All the sections are 8 bytes aligned, so the file can be memory mapped.
+class __attribute__((visibility("default"))) ShardColumnarIndex {
+ public:
+  ShardColumnarIndex() = default;
+
+  ~ShardColumnarIndex() = default;
+
+  /// \brief add one row of the index
+  /// \param[in] row the (placeholder, type, value) of the columns, the same as the one inserted to the sqlite
+  /// \return Status
+  Status AddRow(const std::vector<std::tuple<std::string, std::string, std::string>> &row);
+
+  /// \brief sort the rows, build the index fields and write the index to file
+  /// \param[in] file_path the path of index file
+  /// \param[in] shard_name the file name of the mindrecord file
+  /// \return Status
+  Status Save(const std::string &file_path, const std::string &shard_name);
+
+  /// \brief load the index from file
+  /// \param[in] file_path the path of index file
+  /// \param[out] index_ptr the index loaded
+  /// \return Status
+  static Status Load(const std::string &file_path, std::shared_ptr<ShardColumnarIndex> *index_ptr);
+
+  /// \brief the file name of the mindrecord file
+  const std::string &GetShardName() const { return shard_name_; }
+
+  /// \brief the number of rows
+  uint64_t GetNumRows() const { return num_rows_; }
+
+  /// \brief all the rows in order of ROW_ID
+  std::vector<uint64_t> GetAllRows() const;
+
+  /// \brief the rows of the ROW_ID
+  std::vector<uint64_t> GetRowsByRowId(uint64_t row_id) const;
+
+  /// \brief the rows in the blob page which satisfy the criteria, in order of ROW_ID
+  /// \param[in] page_id the blob page id, -1 means all the pages
+  /// \param[in] criteria the index field name and value, empty field name means no criteria
+  /// \param[out] rows the rows
+  /// \return Status
+  Status Filter(int64_t page_id, const std::pair<std::string, std::string> &criteria,
+                std::vector<uint64_t> *rows) const;
+
+  /// \brief the distinct values of the index field
+  Status GetDistinctValues(const std::string &field, std::vector<std::string> *values) const;
+
+  /// \brief the values of columns of the rows, the same format as the result of sqlite query
+  /// \param[in] columns the location columns or index fields
+  /// \param[in] rows the rows
+  /// \param[out] records the values of each row
+  /// \return Status
+  Status Select(const std::vector<std::string> &columns, const std::vector<uint64_t> &rows,
+                std::vector<std::vector<std::string>> *records) const;
+
+ private:
+  enum FieldType : uint64_t { kFieldInteger = 0, kFieldNumeric = 1, kFieldText = 2 };
+
+  struct IndexField {
+    std::string name;
+    uint64_t type = kFieldText;
+    std::vector<std::string> values;      // sorted distinct values
+    std::vector<uint64_t> value_ids;      // value id of each row
+    std::vector<uint64_t> value_offsets;  // the rows of value i are value_rows[value_offsets[i], value_offsets[i + 1])
+    std::vector<uint64_t> value_rows;     // rows grouped by value, in order of ROW_ID in each group
+  };
+
+  /// \brief less than by the field type, the number is compared by value
+  static bool ValueLess(uint64_t type, const std::string &lhs, const std::string &rhs);
+
+  /// \brief the position of location column, -1 if not a location column
+  static int GetLocationColumn(const std::string &column);
+
+  Status GetField(const std::string &field, const IndexField **field_ptr) const;
+
+  Status BuildFields(const std::vector<uint64_t> &order);
+
+  std::string shard_name_;
+  uint64_t num_rows_ = 0;
+  std::vector<std::vector<uint64_t>> locations_;      // location columns
+  std::vector<std::vector<std::string>> raw_values_;  // values of index fields added, only used when building
+  std::vector<uint64_t> page_ids_;                    // sorted blob page ids
+  std::vector<uint64_t> page_begins_;                 // the first row of each blob page
+  std::vector<uint64_t> page_ends_;                   // the end row of each blob page
+  std::vector<IndexField> fields_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_COLUMNAR_INDEX_H_
@@ -25,6 +25,7 @@
 #include <tuple>
 #include <utility>
 #include <vector>
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "./sqlite3.h"
 
@@ -60,6 +61,10 @@ class __attribute__((visibility("default"))) ShardIndexGenerator {
 
   static Status Finalize(const std::vector<std::string> file_names);
 
+  /// \brief write the columnar index file beside the sqlite meta file, which lets the reader create the tasks without
+  ///     the sqlite. It is also turned on by env MS_DEV_MINDRECORD_COLUMNAR_INDEX=1.
+  void SetColumnarIndex(bool columnar_index) { columnar_index_ = columnar_index; }
+
  private:
   static int Callback(void *not_used, int argc, char **argv, char **az_col_name);
 
@@ -97,6 +102,9 @@ class __attribute__((visibility("default"))) ShardIndexGenerator {
   Status ExecuteTransaction(const int &shard_no, sqlite3 *db, const std::vector<int> &raw_page_ids,
                             const std::map<int, int> &blob_id_to_page_id);
 
+  /// \brief write the columnar index of the shard, or remove the stale one when the columnar index is off
+  Status WriteColumnarIndex(int shard_no, ShardColumnarIndex *columnar_index);
+
   Status CreateShardNameTable(sqlite3 *db, const std::string &shard_name);
 
   Status AddBlobPageInfo(std::vector<std::tuple<std::string, std::string, std::string>> &row_data,
@@ -109,6 +117,7 @@ class __attribute__((visibility("default"))) ShardIndexGenerator {
 
   std::string file_path_;
   bool append_;
+  bool columnar_index_;
   ShardHeader shard_header_;
   uint64_t page_size_;
   uint64_t header_size_;
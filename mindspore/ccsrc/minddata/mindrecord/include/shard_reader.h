@@ -22,6 +22,10 @@
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
 #include <sys/prctl.h>
 #endif
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -29,6 +33,7 @@
 #include <chrono>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -46,6 +51,7 @@
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_category.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
@@ -63,6 +69,9 @@ using ROW_GROUPS = std::pair<std::vector<std::vector<std::vector<uint64_t>>>, st
 using ROW_GROUP_BRIEF = std::tuple<std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>>;
 const int kNumBatchInMap = 1000;  // iterator buffer size in row-reader mode
+const int kNumReadAheadTask = 16;  // number of tasks a consumer claims and reads ahead at a time in row-reader mode
+const uint64_t kMaxCoalesceGap = 65536;                  // max gap between two blobs to merge them into one read
+const uint64_t kMaxCoalescedReadSize = 64 * 1024 * 1024;  // max size of one merged read
 
 class API_PUBLIC ShardReader {
  public:
@@ -102,6 +111,11 @@ class API_PUBLIC ShardReader {
   /// \return MSRStatus the status of MSRStatus
   Status ShrinkRandomFileStreams(const int n_remove_consumers);
 
+  /// \brief read the blobs from the memory mapping of the files instead of the file streams, which saves a system
+  ///     call per row for the dataset fitting in the page cache. It is also turned on by env MS_DEV_MINDRECORD_MMAP=1.
+  /// \param[in] mmap_mode whether to map the files, must be called before Open
+  void SetMmapMode(bool mmap_mode) { mmap_mode_ = mmap_mode; }
+
   /// \brief launch threads to get batches
   /// \param[in] is_simple_reader trigger threads if false; do nothing if true
   /// \return MSRStatus the status of MSRStatus
@@ -191,6 +205,10 @@ class API_PUBLIC ShardReader {
   /// \return null
   void SetAllInIndex(bool all_in_index) { all_in_index_ = all_in_index; }
 
+  /// \brief set flag of using the columnar index file instead of the sqlite meta file when it exists
+  /// \return null
+  void SetColumnarIndex(bool use_columnar_index) { use_columnar_index_ = use_columnar_index; }
+
   /// \brief get all classes
   Status GetAllClasses(const std::string &category_field, std::shared_ptr<std::set<std::string>> category_ptr);
 
@@ -226,11 +244,26 @@ class API_PUBLIC ShardReader {
   Status ReadRowGroupByShardIDAndSampleID(const std::vector<std::string> &columns, const uint32_t &shard_id,
                                           const uint32_t &sample_id, std::shared_ptr<ROW_GROUPS> *row_group_ptr);
 
-  /// \brief read all rows in one shard
-  Status ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+  /// \brief get the index fields to read for the row groups of specified columns
+  Status GetRowGroupFields(const std::vector<std::string> &columns, std::vector<std::string> *fields);
+
+  /// \brief read all rows in one shard, or the rows of the row_id when it is not negative
+  Status ReadAllRowsInShard(int shard_id, const std::vector<std::string> &fields, int64_t row_id,
+                            const std::vector<std::string> &columns,
                             std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                             std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
 
+  /// \brief load the columnar index of the file, null when it does not exist or is not valid
+  Status LoadColumnarIndex(const std::string &file, std::shared_ptr<ShardColumnarIndex> *index_ptr);
+
+  /// \brief fall back to the sqlite meta file when the columnar index does not match the row groups
+  Status VerifyColumnarIndex(const std::vector<std::tuple<int, int, int, uint64_t>> &row_group_summary);
+
+  /// \brief query the fields of rows in the blob page by criteria from the columnar index
+  Status QueryColumnarIndex(int shard_id, const std::vector<std::string> &fields, int64_t page_id,
+                            const std::pair<std::string, std::string> &criteria,
+                            std::vector<std::vector<std::string>> *records);
+
   /// \brief initialize reader
   Status Init(const std::vector<std::string> &file_paths, bool load_dataset);
 
@@ -244,6 +277,10 @@ class API_PUBLIC ShardReader {
   std::vector<std::vector<uint64_t>> GetImageOffset(int group_id, int shard_id,
                                                     const std::pair<std::string, std::string> &criteria = {"", ""});
 
+  /// \brief convert offset address of images from the query result
+  static std::vector<std::vector<uint64_t>> ConvertImageOffset(
+    const std::vector<std::vector<std::string>> &image_offsets);
+
   /// \brief get page id by category
   Status GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                             std::shared_ptr<std::vector<uint64_t>> *pages_ptr);
@@ -283,9 +320,26 @@ class API_PUBLIC ShardReader {
   /// \brief open multiple file handle
   void FileStreamsOperator();
 
+  /// \brief map all the files into memory in read only mode
+  Status MapFiles();
+
+  /// \brief unmap all the files
+  void UnmapFiles();
+
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief read the rows of a few tasks, the blobs adjacent in the same file are read together
+  Status ConsumerTasks(const std::vector<int64_t> &task_ids, uint32_t consumer_id,
+                       std::vector<std::shared_ptr<TASK_CONTENT>> *task_contents);
+
+  /// \brief locate the blob of one task in the data file
+  Status GetTaskBlobLocation(int64_t task_id, TaskType *task_type, uint32_t *shard_id, uint64_t *file_offset,
+                             uint64_t *blob_size, json *var_fields);
+
+  /// \brief read a range of the data file of a shard by the file handle of the consumer
+  Status ReadFromShardFile(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t size, uint8_t *dest);
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
@@ -295,6 +349,10 @@ class API_PUBLIC ShardReader {
   void GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
                          std::shared_ptr<std::set<std::string>> category_ptr);
 
+  /// \brief get classes in one shard from the columnar index
+  Status GetClassesInColumnarIndex(int shard_id, const std::string &field,
+                                   std::shared_ptr<std::set<std::string>> category_ptr);
+
   /// \brief get number of classes
   int64_t GetNumClasses(const std::string &category_field);
 
@@ -310,9 +368,11 @@ class API_PUBLIC ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::shared_ptr<ShardColumnarIndex>> columnar_indexes_;            // columnar index list
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
+  std::vector<std::pair<uint8_t *, uint64_t>> mapped_files_;                     // address and size of file mapping
 
  private:
   int n_consumer_;                                         // number of workers (threads)
@@ -323,8 +383,9 @@ class API_PUBLIC ShardReader {
   std::mutex shard_locker_;                                // locker of shard
 
   // flags
-  bool all_in_index_ = true;  // if all columns are stored in index-table
-  bool interrupt_ = false;    // reader interrupted
+  bool all_in_index_ = true;        // if all columns are stored in index-table
+  bool use_columnar_index_ = true;  // if the columnar index file is used when it exists
+  bool interrupt_ = false;          // reader interrupted
 
   int64_t num_padded_;  // number of padding samples
 
@@ -345,6 +406,9 @@ class API_PUBLIC ShardReader {
   // all metadata in the index is not loaded during initialization
   bool lazy_load_;
 
+  // read the blobs from the memory mapping of the files
+  bool mmap_mode_;
+
   // indicate shard_id : inc_count
   // 0 : 15  -  shard0 has 15 samples
   // 1 : 41  -  shard1 has 26 samples
@@ -26,6 +26,7 @@
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -38,6 +39,7 @@
 #include "minddata/mindrecord/include/common/log_adapter.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
 #include "minddata/mindrecord/include/shard_column.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "minddata/mindrecord/include/shard_index.h"
@@ -68,6 +70,10 @@ class __attribute__((visibility("default"))) ShardWriter {
   /// \return MSRStatus the status of MSRStatus
   Status Commit();
 
+  /// \brief Flush the pages of a batch in background while the next batch is being prepared
+  /// \param[in] pipeline_write overlap the flushing with the preparing of the next batch if true
+  void SetPipelineWrite(bool pipeline_write) { pipeline_write_ = pipeline_write; }
+
   /// \brief Set file size
   /// \param[in] header_size the size of header, only (1<<N) is accepted
   /// \return MSRStatus the status of MSRStatus
@@ -212,6 +218,12 @@ class __attribute__((visibility("default"))) ShardWriter {
   Status WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &raw_data, vector<vector<uint8_t>> &blob_data,
                               bool sign, int *schema_count, int *row_count);
 
+  /// \brief compress blob data with multi threads
+  Status CompressBlobData(std::vector<std::vector<uint8_t>> *blob_data);
+
+  /// \brief wait for the pages of last batch flushed in background
+  Status WaitForPendingFlush();
+
   /// \brief Get full path from file name
   Status GetFullPathFromFileName(const std::vector<std::string> &paths);
 
@@ -249,6 +261,11 @@ class __attribute__((visibility("default"))) ShardWriter {
   std::mutex check_mutex_;  // mutex for data check
   std::atomic<bool> flag_{false};
   std::atomic<int64_t> compression_size_;
+
+  bool pipeline_write_;                                   // flush pages in background
+  std::future<Status> pending_flush_;                     // flushing of last batch
+  std::vector<std::vector<uint8_t>> flushing_blob_data_;  // blob data of last batch
+  std::vector<std::vector<uint8_t>> flushing_raw_data_;   // raw data of last batch
 };
 }  // namespace mindrecord
 }  // namespace mindspore
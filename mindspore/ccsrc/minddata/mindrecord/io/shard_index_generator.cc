@@ -23,6 +23,7 @@ namespace mindrecord {
 ShardIndexGenerator::ShardIndexGenerator(const std::string &file_path, bool append)
     : file_path_(file_path),
       append_(append),
+      columnar_index_(common::GetEnv("MS_DEV_MINDRECORD_COLUMNAR_INDEX") == "1"),
       page_size_(0),
       header_size_(0),
       schema_count_(0),
@@ -511,6 +512,7 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
       "-a): " +
       shard_address);
   }
+  ShardColumnarIndex columnar_index;
   (void)sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
   for (int raw_page_id : raw_page_ids) {
     std::shared_ptr<std::string> sql_ptr;
@@ -520,6 +522,11 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
                                     in);
     RELEASE_AND_RETURN_IF_NOT_OK_MR(BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr), db, in);
     MS_LOG(INFO) << "Insert " << row_data_ptr->size() << " rows to index db.";
+    if (columnar_index_) {
+      for (const auto &row : *row_data_ptr) {
+        RELEASE_AND_RETURN_IF_NOT_OK_MR(columnar_index.AddRow(row), db, in);
+      }
+    }
   }
   (void)sqlite3_exec(db, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
@@ -527,6 +534,25 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
   // Close database
   sqlite3_close(db);
   db = nullptr;
+  return WriteColumnarIndex(shard_no, &columnar_index);
+}
+
+Status ShardIndexGenerator::WriteColumnarIndex(int shard_no, ShardColumnarIndex *columnar_index) {
+  RETURN_UNEXPECTED_IF_NULL_MR(columnar_index);
+  std::string shard_address = shard_header_.GetShardAddressByID(shard_no);
+  std::string index_file = shard_address + kColumnarIndexSuffix;
+  if (!columnar_index_) {
+    // the columnar index of the old files must not be used by the reader
+    if (std::ifstream(index_file).good()) {
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(std::remove(index_file.c_str()) == 0,
+                                      "Invalid file, failed to remove the stale columnar index file: " + index_file);
+    }
+    return Status::OK();
+  }
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr));
+  RETURN_IF_NOT_OK_MR(columnar_index->Save(index_file, *fn_ptr));
+  MS_LOG(INFO) << "Generate columnar index for shard: " << shard_no << " successfully.";
   return Status::OK();
 }
 
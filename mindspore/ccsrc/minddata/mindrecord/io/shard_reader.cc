@@ -45,6 +45,7 @@ ShardReader::ShardReader()
       sample_id_position_(0),
       deliver_id_(0),
       lazy_load_(false),
+      mmap_mode_(common::GetEnv("MS_DEV_MINDRECORD_MMAP") == "1"),
       shard_sample_count_() {}
 
 Status ShardReader::GetMeta(const std::string &file_path, std::shared_ptr<json> meta_data_ptr,
@@ -82,9 +83,14 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
       *meta_data_ptr == *first_meta_data_ptr,
       "Invalid file, the metadata of mindrecord file: " + file +
         " is different from others, please make sure all the mindrecord files generated by the same script.");
+    std::shared_ptr<ShardColumnarIndex> columnar_index;
+    RETURN_IF_NOT_OK_MR(LoadColumnarIndex(file, &columnar_index));
     sqlite3 *db = nullptr;
-    RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    if (columnar_index == nullptr) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    }
     database_paths_.push_back(db);
+    columnar_indexes_.push_back(columnar_index);
   }
   ShardHeader sh = ShardHeader();
   RETURN_IF_NOT_OK_MR(sh.BuildDataset(file_paths_, load_dataset));
@@ -106,6 +112,7 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
   for (const auto &rg : row_group_summary) {
     num_rows_ += std::get<3>(rg);
   }
+  RETURN_IF_NOT_OK_MR(VerifyColumnarIndex(row_group_summary));
 
   if (num_rows_ > LAZY_LOAD_THRESHOLD) {
     lazy_load_ = true;
@@ -168,6 +175,67 @@ Status ShardReader::VerifyDataset(sqlite3 **db, const string &file) {
   return Status::OK();
 }
 
+Status ShardReader::LoadColumnarIndex(const std::string &file, std::shared_ptr<ShardColumnarIndex> *index_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index_ptr);
+  *index_ptr = nullptr;
+  std::string index_file = file + kColumnarIndexSuffix;
+  if (!use_columnar_index_ || !std::ifstream(index_file).good()) {
+    return Status::OK();
+  }
+  std::shared_ptr<ShardColumnarIndex> index;
+  auto status = ShardColumnarIndex::Load(index_file, &index);
+  if (status.IsError()) {
+    MS_LOG(WARNING) << "Failed to load the columnar index file: " << index_file
+                    << ", the meta file: " << file << ".db is used instead. " << status.ToString();
+    return Status::OK();
+  }
+  std::shared_ptr<std::string> fn_ptr;
+  RETURN_IF_NOT_OK_MR(GetFileName(file, &fn_ptr));
+  if (index->GetShardName() != *fn_ptr) {
+    MS_LOG(WARNING) << "The columnar index file: " << index_file << " and mindrecord file: " << file
+                    << " can not match, the meta file: " << file << ".db is used instead.";
+    return Status::OK();
+  }
+  MS_LOG(DEBUG) << "Succeed to load columnar index file, path: " << index_file;
+  *index_ptr = index;
+  return Status::OK();
+}
+
+Status ShardReader::VerifyColumnarIndex(const std::vector<std::tuple<int, int, int, uint64_t>> &row_group_summary) {
+  std::vector<uint64_t> shard_rows(columnar_indexes_.size(), 0);
+  for (const auto &rg : row_group_summary) {
+    auto shard_id = static_cast<size_t>(std::get<0>(rg));
+    if (shard_id < shard_rows.size()) {
+      shard_rows[shard_id] += std::get<3>(rg);
+    }
+  }
+  for (size_t shard_id = 0; shard_id < columnar_indexes_.size(); ++shard_id) {
+    if (columnar_indexes_[shard_id] == nullptr || columnar_indexes_[shard_id]->GetNumRows() == shard_rows[shard_id]) {
+      continue;
+    }
+    MS_LOG(WARNING) << "The columnar index of mindrecord file: " << file_paths_[shard_id]
+                    << " is stale, the meta file is used instead.";
+    columnar_indexes_[shard_id] = nullptr;
+    RETURN_IF_NOT_OK_MR(VerifyDataset(&database_paths_[shard_id], file_paths_[shard_id]));
+  }
+  return Status::OK();
+}
+
+Status ShardReader::QueryColumnarIndex(int shard_id, const std::vector<std::string> &fields, int64_t page_id,
+                                       const std::pair<std::string, std::string> &criteria,
+                                       std::vector<std::vector<std::string>> *records) {
+  RETURN_UNEXPECTED_IF_NULL_MR(records);
+  const auto &index = columnar_indexes_[shard_id];
+  RETURN_UNEXPECTED_IF_NULL_MR(index);
+  std::pair<std::string, std::string> field_criteria;
+  if (!criteria.first.empty()) {
+    field_criteria = {criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]), criteria.second};
+  }
+  std::vector<uint64_t> rows;
+  RETURN_IF_NOT_OK_MR(index->Filter(page_id, field_criteria, &rows));
+  return index->Select(fields, rows, records);
+}
+
 Status ShardReader::CheckColumnList(const std::vector<std::string> &selected_columns) {
   auto schema_ptr = GetShardHeader()->GetSchemas()[0];
   auto schema = schema_ptr->GetSchema()["schema"];
@@ -211,9 +279,61 @@ Status ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Succeed to open file, path: " << file;
   }
+  if (mmap_mode_) {
+    RETURN_IF_NOT_OK_MR(MapFiles());
+  }
+  return Status::OK();
+}
+
+Status ShardReader::MapFiles() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  UnmapFiles();
+  for (const auto &file : file_paths_) {
+    std::optional<std::string> dir = "";
+    std::optional<std::string> local_file_name = "";
+    FileUtils::SplitDirAndFileName(file, &dir, &local_file_name);
+    if (!dir.has_value()) {
+      dir = ".";
+    }
+
+    auto realpath = FileUtils::GetRealPath(dir.value().c_str());
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      realpath.has_value(), "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file);
+
+    std::optional<std::string> whole_path = "";
+    FileUtils::ConcatDirAndFileName(&realpath, &local_file_name, &whole_path);
+
+    int fd = open(whole_path.value().c_str(), O_RDONLY);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open mindrecord file for mapping: " + file);
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      (void)close(fd);
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the size of mindrecord file: " + file);
+    }
+    auto size = static_cast<uint64_t>(file_stat.st_size);
+    void *addr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the file descriptor is closed.
+    (void)close(fd);
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "Failed to map mindrecord file into memory: " + file);
+    mapped_files_.emplace_back(static_cast<uint8_t *>(addr), size);
+  }
+  MS_LOG(INFO) << "Succeed to map " << mapped_files_.size() << " mindrecord files into memory.";
+#else
+  MS_LOG(WARNING) << "Memory mapped read mode is not supported on this platform, the file streams are used instead.";
+  mmap_mode_ = false;
+#endif
   return Status::OK();
 }
 
+void ShardReader::UnmapFiles() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (auto &mapped_file : mapped_files_) {
+    (void)munmap(mapped_file.first, mapped_file.second);
+  }
+#endif
+  mapped_files_.clear();
+}
+
 Status ShardReader::ExtendRandomFileStreams(const int n_new_consumers) {
   CHECK_FAIL_RETURN_UNEXPECTED_MR(n_new_consumers > 0,
                                   "n_new_consumers must be a positive number. Got: " + std::to_string(n_new_consumers));
@@ -294,6 +414,7 @@ Status ShardReader::ShrinkRandomFileStreams(const int n_remove_consumers) {
 }
 
 void ShardReader::FileStreamsOperator() {
+  UnmapFiles();
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; --i) {
     if (file_streams_[i] != nullptr) {
       file_streams_[i]->close();
@@ -465,20 +586,32 @@ Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, cons
   }
   return Status::OK();
 }
-Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+Status ShardReader::ReadAllRowsInShard(int shard_id, const std::vector<std::string> &fields, int64_t row_id,
+                                       const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
   auto db = database_paths_[shard_id];
   std::vector<std::vector<std::string>> labels;
   char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
-  if (rc != SQLITE_OK) {
-    std::ostringstream oss;
-    oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
-    sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    RETURN_STATUS_UNEXPECTED_MR(oss.str());
+  if (columnar_indexes_[shard_id] != nullptr) {
+    const auto &index = columnar_indexes_[shard_id];
+    auto rows = row_id < 0 ? index->GetAllRows() : index->GetRowsByRowId(static_cast<uint64_t>(row_id));
+    RETURN_IF_NOT_OK_MR(index->Select(fields, rows, &labels));
+  } else {
+    std::string sql = "SELECT ";
+    for (size_t i = 0; i < fields.size(); ++i) {
+      sql += (i == 0 ? "" : ", ") + fields[i];
+    }
+    sql += row_id < 0 ? " FROM INDEXES ORDER BY ROW_ID ;" : " FROM INDEXES WHERE ROW_ID = " + std::to_string(row_id);
+    int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
+    if (rc != SQLITE_OK) {
+      std::ostringstream oss;
+      oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
+      sqlite3_free(errmsg);
+      sqlite3_close(db);
+      db = nullptr;
+      RETURN_STATUS_UNEXPECTED_MR(oss.str());
+    }
   }
   MS_LOG(INFO) << "Succeed to get " << labels.size() << " records from shard " << std::to_string(shard_id) << " index.";
 
@@ -523,13 +656,23 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, category_ptr);
+    if (columnar_indexes_[x] == nullptr) {
+      threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, category_ptr);
+    }
+  }
+  Status status = Status::OK();
+  for (int x = 0; x < shard_count_ && status.IsOk(); x++) {
+    if (columnar_indexes_[x] != nullptr) {
+      status = GetClassesInColumnarIndex(x, *fn_ptr, category_ptr);
+    }
   }
 
   for (int x = 0; x < shard_count_; x++) {
-    threads[x].join();
+    if (threads[x].joinable()) {
+      threads[x].join();
+    }
   }
-  return Status::OK();
+  return status;
 }
 
 void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
@@ -557,31 +700,47 @@ void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string
   sqlite3_free(errmsg);
 }
 
-Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
-                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
-  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
-    shard_count_, std::vector<std::vector<uint64_t>>{});
-  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
+Status ShardReader::GetClassesInColumnarIndex(int shard_id, const std::string &field,
+                                              std::shared_ptr<std::set<std::string>> category_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(category_ptr);
+  std::vector<std::string> values;
+  RETURN_IF_NOT_OK_MR(columnar_indexes_[shard_id]->GetDistinctValues(field, &values));
+  MS_LOG(INFO) << "Succeed to get " << values.size() << " records from shard " << std::to_string(shard_id)
+               << " columnar index.";
+  std::lock_guard<std::mutex> lck(shard_locker_);
+  category_ptr->insert(values.begin(), values.end());
+  return Status::OK();
+}
 
+Status ShardReader::GetRowGroupFields(const std::vector<std::string> &columns, std::vector<std::string> *fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(fields);
+  *fields = {"ROW_GROUP_ID", "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
   if (all_in_index_) {
     for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
       std::shared_ptr<std::string> fn_ptr;
       RETURN_IF_NOT_OK_MR(
         ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
+      fields->push_back(*fn_ptr);
     }
   } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
+    fields->insert(fields->end(), {"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"});
   }
+  return Status::OK();
+}
 
-  std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
+Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
+                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GetRowGroupFields(columns, &fields));
+  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
+    shard_count_, std::vector<std::vector<uint64_t>>{});
+  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
 
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] = std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, offset_ptr, col_val_ptr);
+    thread_read_db[x] =
+      std::thread(&ShardReader::ReadAllRowsInShard, this, x, fields, -1, columns, offset_ptr, col_val_ptr);
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -595,25 +754,13 @@ Status ShardReader::ReadRowGroupByShardIDAndSampleID(const std::vector<std::stri
                                                      const uint32_t &sample_id,
                                                      std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GetRowGroupFields(columns, &fields));
   auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
     shard_count_, std::vector<std::vector<uint64_t>>{});
   auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
-  if (all_in_index_) {
-    for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
-      std::shared_ptr<std::string> fn_ptr;
-      RETURN_IF_NOT_OK_MR(
-        ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
-    }
-  } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
-  }
-
-  std::string sql = "SELECT " + fields + " FROM INDEXES WHERE ROW_ID = " + std::to_string(sample_id);
 
-  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, columns, offset_ptr, col_val_ptr));
+  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, fields, sample_id, columns, offset_ptr, col_val_ptr));
   *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
   return Status::OK();
 }
@@ -672,6 +819,16 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
 
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
+  std::vector<std::vector<std::string>> image_offsets;
+  if (columnar_indexes_[shard_id] != nullptr) {
+    auto status =
+      QueryColumnarIndex(shard_id, {"PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"}, page_id, criteria, &image_offsets);
+    if (status.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to query the columnar index, " << status.ToString();
+      return std::vector<std::vector<uint64_t>>();
+    }
+    return ConvertImageOffset(image_offsets);
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql =
@@ -691,7 +848,6 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
     }
   }
   sql += ";";
-  std::vector<std::vector<std::string>> image_offsets;
   char *errmsg = nullptr;
   int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &image_offsets, &errmsg);
   if (rc != SQLITE_OK) {
@@ -704,6 +860,12 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
   } else {
     MS_LOG(DEBUG) << "Succeed to get " << image_offsets.size() << " records from index.";
   }
+  sqlite3_free(errmsg);
+  return ConvertImageOffset(image_offsets);
+}
+
+std::vector<std::vector<uint64_t>> ShardReader::ConvertImageOffset(
+  const std::vector<std::vector<std::string>> &image_offsets) {
   std::vector<std::vector<uint64_t>> res;
   for (int i = static_cast<int>(image_offsets.size()) - 1; i >= 0; i--) {
     res.emplace_back(std::vector<uint64_t>{0, 0});
@@ -713,13 +875,23 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
     res[i][0] = std::stoull(image_offset[0]) + kInt64Len;
     res[i][1] = std::stoull(image_offset[1]);
   }
-  sqlite3_free(errmsg);
   return res;
 }
 
 Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                                        std::shared_ptr<std::vector<uint64_t>> *pages_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(pages_ptr);
+  if (columnar_indexes_[shard_id] != nullptr) {
+    std::vector<std::vector<std::string>> page_ids;
+    RETURN_IF_NOT_OK_MR(QueryColumnarIndex(shard_id, {"PAGE_ID_BLOB"}, -1, criteria, &page_ids));
+    // the rows are in order of ROW_ID, so the same page is adjacent
+    for (size_t i = 0; i < page_ids.size(); ++i) {
+      if (i == 0 || page_ids[i][0] != page_ids[i - 1][0]) {
+        (*pages_ptr)->emplace_back(std::stoull(page_ids[i][0]));
+      }
+    }
+    return Status::OK();
+  }
   auto db = database_paths_[shard_id];
 
   std::string sql = "SELECT DISTINCT PAGE_ID_BLOB FROM INDEXES WHERE 1 = 1 ";
@@ -873,7 +1045,10 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
   std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END FROM INDEXES WHERE PAGE_ID_BLOB = " +
                     std::to_string(page_id);
   auto label_offset_ptr = std::make_shared<std::vector<std::vector<std::string>>>();
-  if (!criteria.first.empty()) {
+  if (columnar_indexes_[shard_id] != nullptr) {
+    RETURN_IF_NOT_OK_MR(QueryColumnarIndex(shard_id, {"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"}, page_id,
+                                           criteria, label_offset_ptr.get()));
+  } else if (!criteria.first.empty()) {
     sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
     RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, label_offset_ptr));
   } else {
@@ -903,19 +1078,23 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
   if (all_in_index_) {
     auto db = database_paths_[shard_id];
     std::string fields;
+    std::vector<std::string> field_list;
     for (unsigned int i = 0; i < columns.size(); ++i) {
       if (i > 0) {
         fields += ',';
       }
       uint64_t schema_id = column_schema_id_[columns[i]];
       fields += columns[i] + "_" + std::to_string(schema_id);
+      field_list.push_back(columns[i] + "_" + std::to_string(schema_id));
     }
     if (fields.empty()) {
       fields = "*";
     }
     auto labels = std::make_shared<std::vector<std::vector<std::string>>>();
     std::string sql = "SELECT " + fields + " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
-    if (!criteria.first.empty()) {
+    if (columnar_indexes_[shard_id] != nullptr) {
+      RETURN_IF_NOT_OK_MR(QueryColumnarIndex(shard_id, field_list, page_id, criteria, labels.get()));
+    } else if (!criteria.first.empty()) {
       sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria";
       RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, labels));
     } else {
@@ -989,7 +1168,16 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
   auto category_ptr = std::make_shared<std::set<std::string>>();
   sqlite3 *db = nullptr;
+  bool index_error = false;
   for (int x = 0; x < shard_count; x++) {
+    if (x < columnar_indexes_.size() && columnar_indexes_[x] != nullptr) {
+      auto status = GetClassesInColumnarIndex(x, *fn_ptr, category_ptr);
+      if (status.IsError()) {
+        MS_LOG(ERROR) << "[Internal ERROR] Failed to get classes from columnar index, " << status.ToString();
+        index_error = true;
+      }
+      continue;
+    }
     std::string path_utf8 = "";
 #if defined(_WIN32) || defined(_WIN64)
     path_utf8 = FileUtils::GB2312ToUTF_8((file_paths_[x] + ".db").data());
@@ -1007,10 +1195,12 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   }
 
   for (int x = 0; x < shard_count; x++) {
-    threads[x].join();
+    if (threads[x].joinable()) {
+      threads[x].join();
+    }
   }
   sqlite3_close(db);
-  return category_ptr->size();
+  return index_error ? -1 : category_ptr->size();
 }
 
 Status ShardReader::CountTotalRows(const std::vector<std::string> &file_paths, bool load_dataset,
@@ -1331,35 +1521,35 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
   return Status::OK();
 }
 
-Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
-                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+Status ShardReader::GetTaskBlobLocation(int64_t task_id, TaskType *task_type, uint32_t *shard_id,
+                                        uint64_t *file_offset, uint64_t *blob_size, json *var_fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_type);
+  RETURN_UNEXPECTED_IF_NULL_MR(shard_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(file_offset);
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_size);
+  RETURN_UNEXPECTED_IF_NULL_MR(var_fields);
   // All tasks are done
   CHECK_FAIL_RETURN_UNEXPECTED_MR(task_id < tasks_.Size(), "[Internal ERROR] 'task_id': " + std::to_string(task_id) +
                                                              " is out of bound: " + std::to_string(tasks_.Size()));
-  uint32_t shard_id = 0;
   uint32_t group_id = 0;
   uint32_t blob_start = 0;
   uint32_t blob_end = 0;
-  json var_fields;
   // Pick up task from task list
   ShardTask task = tasks_.GetTaskByID(task_id);
 
   // check task type
-  auto task_type = std::get<0>(task);
-  if (task_type == TaskType::kPaddedTask) {
-    *task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+  *task_type = std::get<0>(task);
+  if (*task_type == TaskType::kPaddedTask) {
     return Status::OK();
   }
 
-  shard_id = std::get<0>(std::get<1>(task));  // shard id
+  *shard_id = std::get<0>(std::get<1>(task));  // shard id
 
   if (lazy_load_ == false) {
     group_id = std::get<1>(std::get<1>(task));  // group id
     blob_start = std::get<2>(task)[0];          // blob start
     blob_end = std::get<2>(task)[1];            // blob end
-    var_fields = std::get<3>(task);             // scalar variable field
+    *var_fields = std::get<3>(task);            // scalar variable field
   } else {
     // get scalar variable fields by sample id
     uint32_t sample_id_in_shard = std::get<1>(std::get<1>(task));
@@ -1367,36 +1557,69 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
     // read the meta from index
     std::shared_ptr<ROW_GROUPS> row_group_ptr;
     RETURN_IF_NOT_OK_MR(
-      ReadRowGroupByShardIDAndSampleID(selected_columns_, shard_id, sample_id_in_shard, &row_group_ptr));
+      ReadRowGroupByShardIDAndSampleID(selected_columns_, *shard_id, sample_id_in_shard, &row_group_ptr));
     auto &offsets = std::get<0>(*row_group_ptr);
     auto &local_columns = std::get<1>(*row_group_ptr);
 
-    group_id = offsets[shard_id][0][1];       // group_id
-    blob_start = offsets[shard_id][0][2];     // blob start
-    blob_end = offsets[shard_id][0][3];       // blob end
-    var_fields = local_columns[shard_id][0];  // scalar variable field
+    group_id = offsets[*shard_id][0][1];        // group_id
+    blob_start = offsets[*shard_id][0][2];      // blob start
+    blob_end = offsets[*shard_id][0][3];        // blob end
+    *var_fields = local_columns[*shard_id][0];  // scalar variable field
   }
 
-  // read the blob from data file
+  // locate the blob in data file
   std::shared_ptr<Page> page_ptr;
-  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, *shard_id, &page_ptr));
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
+  *file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *blob_size = blob_end - blob_start;
+  return Status::OK();
+}
 
-  // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
-  auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
-
+Status ShardReader::ReadFromShardFile(uint32_t consumer_id, uint32_t shard_id, uint64_t file_offset, uint64_t size,
+                                      uint8_t *dest) {
+  RETURN_UNEXPECTED_IF_NULL_MR(dest);
+  if (!mapped_files_.empty()) {
+    // The mapping is read only and shared by all the consumers.
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id < mapped_files_.size(),
+                                    "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) + " is out of bound.");
+    auto &mapped_file = mapped_files_[shard_id];
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(file_offset <= mapped_file.second && size <= mapped_file.second - file_offset,
+                                    "[Internal ERROR] Failed to read file, the range exceeds the file size.");
+    (void)std::copy(mapped_file.first + file_offset, mapped_file.first + file_offset + size, dest);
+    return Status::OK();
+  }
   auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
   if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
     file_streams_random_[consumer_id][shard_id]->close();
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
+  auto &io_read = file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(dest), size);
   if (!io_read.good() || io_read.fail() || io_read.bad()) {
     file_streams_random_[consumer_id][shard_id]->close();
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
   }
+  return Status::OK();
+}
+
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(GetTaskBlobLocation(task_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    return Status::OK();
+  }
+
+  // Pack image list
+  std::vector<uint8_t> images(blob_size);
+  RETURN_IF_NOT_OK_MR(ReadFromShardFile(consumer_id, shard_id, file_offset, blob_size, images.data()));
 
   // Deliver batch data to output map
   std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
@@ -1406,6 +1629,75 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
   return Status::OK();
 }
 
+Status ShardReader::ConsumerTasks(const std::vector<int64_t> &task_ids, uint32_t consumer_id,
+                                  std::vector<std::shared_ptr<TASK_CONTENT>> *task_contents) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_contents);
+  struct BlobRead {
+    size_t index;
+    uint32_t shard_id;
+    uint64_t file_offset;
+    uint64_t blob_size;
+  };
+  std::vector<BlobRead> reads;
+  std::vector<std::vector<uint8_t>> images(task_ids.size());
+  std::vector<json> var_fields(task_ids.size());
+  task_contents->assign(task_ids.size(), nullptr);
+  for (size_t i = 0; i < task_ids.size(); ++i) {
+    TaskType task_type = TaskType::kCommonTask;
+    BlobRead read{i, 0, 0, 0};
+    RETURN_IF_NOT_OK_MR(GetTaskBlobLocation(task_ids[i], &task_type, &read.shard_id, &read.file_offset,
+                                            &read.blob_size, &var_fields[i]));
+    if (task_type == TaskType::kPaddedTask) {
+      (*task_contents)[i] =
+        std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    } else {
+      images[i].resize(read.blob_size);
+      reads.push_back(read);
+    }
+  }
+
+  // Merge the blobs close to each other in the same file into one read, which saves a round trip per blob on the
+  // network file systems.
+  std::sort(reads.begin(), reads.end(), [](const BlobRead &a, const BlobRead &b) {
+    return a.shard_id != b.shard_id ? a.shard_id < b.shard_id : a.file_offset < b.file_offset;
+  });
+  std::vector<uint8_t> buffer;
+  size_t begin = 0;
+  while (begin < reads.size()) {
+    auto range_start = reads[begin].file_offset;
+    auto range_end = range_start + reads[begin].blob_size;
+    size_t end = begin + 1;
+    while (end < reads.size() && reads[end].shard_id == reads[begin].shard_id &&
+           reads[end].file_offset <= range_end + kMaxCoalesceGap &&
+           std::max(range_end, reads[end].file_offset + reads[end].blob_size) - range_start <= kMaxCoalescedReadSize) {
+      range_end = std::max(range_end, reads[end].file_offset + reads[end].blob_size);
+      ++end;
+    }
+    if (end - begin == 1) {
+      auto &read = reads[begin];
+      RETURN_IF_NOT_OK_MR(
+        ReadFromShardFile(consumer_id, read.shard_id, read.file_offset, read.blob_size, images[read.index].data()));
+    } else {
+      buffer.resize(range_end - range_start);
+      RETURN_IF_NOT_OK_MR(
+        ReadFromShardFile(consumer_id, reads[begin].shard_id, range_start, buffer.size(), buffer.data()));
+      for (size_t i = begin; i < end; ++i) {
+        auto &read = reads[i];
+        auto src = buffer.begin() + static_cast<std::ptrdiff_t>(read.file_offset - range_start);
+        (void)std::copy(src, src + static_cast<std::ptrdiff_t>(read.blob_size), images[read.index].begin());
+      }
+    }
+    begin = end;
+  }
+
+  for (auto &read : reads) {
+    std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
+    batch.emplace_back(std::move(images[read.index]), std::move(var_fields[read.index]));
+    (*task_contents)[read.index] = std::make_shared<TASK_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  }
+  return Status::OK();
+}
+
 void ShardReader::ConsumerByRow(int consumer_id) {
   // Set thread name
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
@@ -1413,37 +1705,61 @@ void ShardReader::ConsumerByRow(int consumer_id) {
   prctl(PR_SET_NAME, common::SafeCStr(thread_id), 0, 0, 0);
 #endif
 
-  // Loop forever
-  for (;;) {
-    int sample_id_pos = 0;
-
-    // Get next task ID
-    sample_id_pos = sample_id_position_++;
+  // Claim the next few task positions at a time.
+  auto claim_tasks = [this](std::vector<int> *positions, std::vector<int64_t> *task_ids) {
+    positions->clear();
+    task_ids->clear();
+    int begin = sample_id_position_.fetch_add(kNumReadAheadTask);
+    int end = std::min(begin + kNumReadAheadTask, static_cast<int>(tasks_.sample_ids_.size()));
+    for (int pos = begin; pos < end; ++pos) {
+      positions->push_back(pos);
+      task_ids->push_back(tasks_.sample_ids_[pos]);
+    }
+  };
+  std::vector<int> positions;
+  std::vector<int64_t> task_ids;
+  std::vector<std::shared_ptr<TASK_CONTENT>> task_contents;
+  claim_tasks(&positions, &task_ids);
+  if (ConsumerTasks(task_ids, consumer_id, &task_contents).IsError()) {
+    MS_LOG(ERROR) << "[Internal ERROR] Error raised in ConsumerTasks function.";
+    return;
+  }
 
-    // All tasks are done
-    if (sample_id_pos >= static_cast<int>(tasks_.sample_ids_.size())) {
-      return;
+  // Loop until all tasks are done
+  while (!positions.empty()) {
+    // Read the next tasks ahead while the current ones are waiting to be delivered. Only one read is in flight per
+    // consumer, so the file handles of the consumer are never shared.
+    std::vector<int> next_positions;
+    std::vector<int64_t> next_task_ids;
+    std::vector<std::shared_ptr<TASK_CONTENT>> next_task_contents;
+    claim_tasks(&next_positions, &next_task_ids);
+    auto read_ahead = std::async(std::launch::async, [this, &next_task_ids, consumer_id, &next_task_contents]() {
+      return ConsumerTasks(next_task_ids, consumer_id, &next_task_contents);
+    });
+    for (size_t i = 0; i < positions.size(); ++i) {
+      auto sample_id_pos = positions[i];
+      auto &batch = task_contents[i]->second;
+      // Hanging if maximum map size exceeded
+      //   otherwise, set batch data in map
+      {
+        std::unique_lock<std::mutex> lck(mtx_delivery_);
+        cv_delivery_.wait(
+          lck, [sample_id_pos, this] { return interrupt_ || sample_id_pos <= deliver_id_ + kNumBatchInMap; });
+        if (interrupt_) {
+          (void)read_ahead.get();
+          return;
+        }
+        delivery_map_[sample_id_pos] =
+          std::make_shared<std::vector<std::tuple<std::vector<uint8_t>, json>>>(std::move(batch));
+      }
+      cv_iterator_.notify_one();
     }
-    auto task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kCommonTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
-    if (ConsumerOneTask(tasks_.sample_ids_[sample_id_pos], consumer_id, &task_content_ptr).IsError()) {
-      MS_LOG(ERROR) << "[Internal ERROR] Error raised in ConsumerOneTask function.";
+    if (read_ahead.get().IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Error raised in ConsumerTasks function.";
       return;
     }
-    const auto &batch = (*task_content_ptr).second;
-    // Hanging if maximum map size exceeded
-    //   otherwise, set batch data in map
-    {
-      std::unique_lock<std::mutex> lck(mtx_delivery_);
-      cv_delivery_.wait(lck,
-                        [sample_id_pos, this] { return interrupt_ || sample_id_pos <= deliver_id_ + kNumBatchInMap; });
-      if (interrupt_) {
-        return;
-      }
-      delivery_map_[sample_id_pos] =
-        std::make_shared<std::vector<std::tuple<std::vector<uint8_t>, json>>>(std::move(batch));
-    }
-    cv_iterator_.notify_one();
+    positions = std::move(next_positions);
+    task_contents = std::move(next_task_contents);
   }
 }
 
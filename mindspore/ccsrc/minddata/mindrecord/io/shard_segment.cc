@@ -23,7 +23,11 @@
 
 namespace mindspore {
 namespace mindrecord {
-ShardSegment::ShardSegment() { SetAllInIndex(false); }
+ShardSegment::ShardSegment() {
+  SetAllInIndex(false);
+  // the category fields are queried from the sqlite meta file
+  SetColumnarIndex(false);
+}
 
 Status ShardSegment::GetCategoryFields(std::shared_ptr<vector<std::string>> *fields_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(fields_ptr);
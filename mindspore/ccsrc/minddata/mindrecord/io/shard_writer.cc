@@ -23,11 +23,19 @@
 namespace mindspore {
 namespace mindrecord {
 ShardWriter::ShardWriter()
-    : shard_count_(1), header_size_(kDefaultHeaderSize), page_size_(kDefaultPageSize), row_count_(0), schema_count_(1) {
+    : shard_count_(1),
+      header_size_(kDefaultHeaderSize),
+      page_size_(kDefaultPageSize),
+      row_count_(0),
+      schema_count_(1),
+      pipeline_write_(common::GetEnv("MS_DEV_MINDRECORD_PIPELINE_WRITE") == "1") {
   compression_size_ = 0;
 }
 
 ShardWriter::~ShardWriter() {
+  if (pending_flush_.valid()) {
+    pending_flush_.wait();
+  }
   for (int i = static_cast<int>(file_streams_.size()) - 1; i >= 0; i--) {
     file_streams_[i]->close();
   }
@@ -103,6 +111,8 @@ Status ShardWriter::OpenDataFiles(bool append, bool overwrite) {
           if (res2 == 0) {
             MS_LOG(WARNING) << "Succeed to remove the old mindrecord metadata files, path: " << file + ".db";
           }
+          // the columnar index is optional, it is written again by the index generator when turned on
+          (void)std::remove((whole_path.value() + kColumnarIndexSuffix).c_str());
         } else {
           RETURN_STATUS_UNEXPECTED_MR(
             "Invalid file, mindrecord files already exist. Please check file path: " + file +
@@ -193,6 +203,7 @@ Status ShardWriter::OpenForAppend(const std::string &path) {
 }
 
 Status ShardWriter::Commit() {
+  RETURN_IF_NOT_OK_MR(WaitForPendingFlush());
   // Read pages file
   std::ifstream page_file(pages_file_.c_str());
   if (page_file.good()) {
@@ -562,13 +573,9 @@ Status ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &
     *size_ptr >= kMinFreeDiskSize,
     "No free disk to be used while writing mindrecord files, available free disk size: " + std::to_string(*size_ptr));
   // compress blob
-  if (shard_column_->CheckCompressBlob()) {
-    for (auto &blob : blob_data) {
-      int64_t compression_bytes = 0;
-      blob = shard_column_->CompressBlob(blob, &compression_bytes);
-      compression_size_ += compression_bytes;
-    }
-  }
+  RETURN_IF_NOT_OK_MR(CompressBlobData(&blob_data));
+  // the flushing of last batch uses the counters and sizes, wait for it before they are updated
+  RETURN_IF_NOT_OK_MR(WaitForPendingFlush());
 
   // Add 4-bytes dummy blob data if no any blob fields
   if (blob_data.size() == 0 && raw_data.size() > 0) {
@@ -585,6 +592,50 @@ Status ShardWriter::WriteRawDataPreCheck(std::map<uint64_t, std::vector<json>> &
   *row_count = (*count_ptr).second;
   return Status::OK();
 }
+Status ShardWriter::CompressBlobData(std::vector<std::vector<uint8_t>> *blob_data) {
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_data);
+  if (!shard_column_->CheckCompressBlob() || blob_data->empty()) {
+    return Status::OK();
+  }
+  // define the number of thread
+  size_t row_count = blob_data->size();
+  size_t thread_num = std::thread::hardware_concurrency();
+  if (thread_num == 0) {
+    thread_num = kThreadNumber;
+  }
+  thread_num = std::min(thread_num, row_count);
+  size_t group_num = (row_count + thread_num - 1) / thread_num;
+  std::vector<int64_t> compression_bytes(thread_num, 0);
+  auto compress = [this, blob_data, row_count, group_num, &compression_bytes](size_t x) {
+    size_t end_row = std::min(row_count, (x + 1) * group_num);
+    for (size_t i = x * group_num; i < end_row; ++i) {
+      int64_t bytes = 0;
+      (*blob_data)[i] = shard_column_->CompressBlob((*blob_data)[i], &bytes);
+      compression_bytes[x] += bytes;
+    }
+  };
+  std::vector<std::thread> thread_set;
+  for (size_t x = 1; x < thread_num; ++x) {
+    thread_set.emplace_back(compress, x);
+  }
+  compress(0);
+  for (auto &thread : thread_set) {
+    thread.join();
+  }
+  compression_size_ += std::accumulate(compression_bytes.begin(), compression_bytes.end(), int64_t(0));
+  return Status::OK();
+}
+
+Status ShardWriter::WaitForPendingFlush() {
+  if (!pending_flush_.valid()) {
+    return Status::OK();
+  }
+  auto status = pending_flush_.get();
+  flushing_blob_data_.clear();
+  flushing_raw_data_.clear();
+  return status;
+}
+
 Status ShardWriter::MergeBlobData(const std::vector<string> &blob_fields,
                                   const std::map<std::string, std::unique_ptr<std::vector<uint8_t>>> &row_bin_data,
                                   std::shared_ptr<std::vector<uint8_t>> *output) {
@@ -645,6 +696,16 @@ Status ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_data
   RETURN_IF_NOT_OK_MR(SetRawDataSize(bin_raw_data));
   // Set row size of blob data
   RETURN_IF_NOT_OK_MR(SetBlobDataSize(blob_data));
+  if (pipeline_write_ && !parallel_writer) {
+    // Keep the data until the background flushing is done, the caller can prepare the next batch meanwhile
+    flushing_blob_data_ = std::move(blob_data);
+    flushing_raw_data_ = std::move(bin_raw_data);
+    blob_data.clear();
+    MS_LOG(INFO) << "Start to write " << flushing_raw_data_.size() << " records in background.";
+    pending_flush_ = std::async(std::launch::async,
+                                [this]() { return ParallelWriteData(flushing_blob_data_, flushing_raw_data_); });
+    return Status::OK();
+  }
   // Write data to disk with multi threads
   RETURN_IF_NOT_OK_MR(ParallelWriteData(blob_data, bin_raw_data));
   MS_LOG(INFO) << "Succeed to write " << bin_raw_data.size() << " records.";
@@ -707,17 +768,23 @@ Status ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &b
     }
     // Start one thread for one shard
     std::vector<std::thread> thread_set(thread_num);
+    std::vector<Status> status_set(thread_num);
     if (thread_num <= kMaxThreadCount) {
       for (int x = 0; x < thread_num; ++x) {
-        int start_row = shards[current_thread + x].first;
-        int end_row = shards[current_thread + x].second;
-        thread_set[x] = std::thread(&ShardWriter::WriteByShard, this, current_thread + x, start_row, end_row,
-                                    std::ref(blob_data), std::ref(bin_raw_data));
+        int shard_id = current_thread + x;
+        int start_row = shards[shard_id].first;
+        int end_row = shards[shard_id].second;
+        thread_set[x] = std::thread([this, &status_set, &blob_data, &bin_raw_data, x, shard_id, start_row, end_row]() {
+          status_set[x] = WriteByShard(shard_id, start_row, end_row, blob_data, bin_raw_data);
+        });
       }
       // Wait for threads done
       for (int x = 0; x < thread_num; ++x) {
         thread_set[x].join();
       }
+      for (auto &status : status_set) {
+        RETURN_IF_NOT_OK_MR(status);
+      }
       left_thread -= thread_num;
       current_thread += thread_num;
     }
@@ -989,8 +1056,8 @@ Status ShardWriter::FlushBlobChunk(const std::shared_ptr<std::fstream> &out,
     }
 
     // Write the data of blob
-    auto line = blob_data[j];
-    auto &io_handle_data = out->write(reinterpret_cast<char *>(&line[0]), line_len);
+    const auto &line = blob_data[j];
+    auto &io_handle_data = out->write(reinterpret_cast<const char *>(line.data()), line_len);
     if (!io_handle_data.good() || io_handle_data.fail() || io_handle_data.bad()) {
       out->close();
       RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
@@ -1014,8 +1081,8 @@ Status ShardWriter::FlushRawChunk(const std::shared_ptr<std::fstream> &out,
     }
     // Write the data of multi schemas
     for (uint32_t j = 0; j < schema_count_; ++j) {
-      auto line = bin_raw_data[i * schema_count_ + j];
-      auto &io_handle = out->write(reinterpret_cast<char *>(&line[0]), line.size());
+      const auto &line = bin_raw_data[i * schema_count_ + j];
+      auto &io_handle = out->write(reinterpret_cast<const char *>(line.data()), line.size());
       if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
         out->close();
         RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
@@ -0,0 +1,452 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_columnar_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+const uint64_t kColumnarIndexMagic = 0x5844494d4f43524dULL;  // "MRCOMIDX"
+const uint64_t kColumnarIndexVersion = 1;
+
+const std::vector<std::string> kLocationColumns = {
+  "ROW_ID",       "ROW_GROUP_ID",     "PAGE_ID_RAW",         "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END",
+  "PAGE_ID_BLOB", "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
+const size_t kRowIdColumn = 0;
+const size_t kPageIdBlobColumn = 5;
+
+// the INC_ columns are only the primary key of the sqlite table
+const char kIncColumnPrefix[] = "INC_";
+
+void AppendUint64(uint64_t value, std::vector<uint8_t> *buffer) {
+  auto bytes = reinterpret_cast<const uint8_t *>(&value);
+  (void)buffer->insert(buffer->end(), bytes, bytes + kInt64Len);
+}
+
+void AppendArray(const std::vector<uint64_t> &values, std::vector<uint8_t> *buffer) {
+  auto bytes = reinterpret_cast<const uint8_t *>(values.data());
+  (void)buffer->insert(buffer->end(), bytes, bytes + values.size() * kInt64Len);
+}
+
+// the strings are stored as the offsets array and the chars padded to 8 bytes
+void AppendStrings(const std::vector<std::string> &values, std::vector<uint8_t> *buffer) {
+  std::vector<uint64_t> offsets(1, 0);
+  for (const auto &value : values) {
+    offsets.push_back(offsets.back() + value.size());
+  }
+  AppendArray(offsets, buffer);
+  for (const auto &value : values) {
+    (void)buffer->insert(buffer->end(), value.begin(), value.end());
+  }
+  buffer->resize(buffer->size() + (kInt64Len - offsets.back() % kInt64Len) % kInt64Len, 0);
+}
+
+class IndexFileParser {
+ public:
+  IndexFileParser(const uint8_t *data, uint64_t size) : data_(data), size_(size) {}
+
+  Status ReadUint64(uint64_t *value) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(size_ - pos_ >= kInt64Len, "Invalid file, the columnar index file is truncated.");
+    *value = *reinterpret_cast<const uint64_t *>(data_ + pos_);
+    pos_ += kInt64Len;
+    return Status::OK();
+  }
+
+  Status ReadArray(uint64_t num, std::vector<uint64_t> *values) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR((size_ - pos_) / kInt64Len >= num,
+                                    "Invalid file, the columnar index file is truncated.");
+    auto begin = reinterpret_cast<const uint64_t *>(data_ + pos_);
+    values->assign(begin, begin + num);
+    pos_ += num * kInt64Len;
+    return Status::OK();
+  }
+
+  Status ReadStrings(uint64_t num, std::vector<std::string> *values) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(num < std::numeric_limits<uint64_t>::max() / kInt64Len,
+                                    "Invalid file, the columnar index file is broken.");
+    std::vector<uint64_t> offsets;
+    RETURN_IF_NOT_OK_MR(ReadArray(num + 1, &offsets));
+    auto chars_size = offsets.back();
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(offsets[0] == 0 && std::is_sorted(offsets.begin(), offsets.end()) &&
+                                      chars_size <= size_ - pos_,
+                                    "Invalid file, the columnar index file is broken.");
+    values->clear();
+    values->reserve(num);
+    auto chars = reinterpret_cast<const char *>(data_ + pos_);
+    for (uint64_t i = 0; i < num; ++i) {
+      values->emplace_back(chars + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    pos_ += std::min(size_ - pos_, chars_size + (kInt64Len - chars_size % kInt64Len) % kInt64Len);
+    return Status::OK();
+  }
+
+  bool End() const { return pos_ == size_; }
+
+ private:
+  const uint8_t *data_;
+  uint64_t size_;
+  uint64_t pos_ = 0;
+};
+}  // namespace
+
+bool ShardColumnarIndex::ValueLess(uint64_t type, const std::string &lhs, const std::string &rhs) {
+  if (type != kFieldText) {
+    // the same as the sqlite, the number field is compared by the value
+    try {
+      if (type == kFieldInteger) {
+        return std::stoll(lhs) < std::stoll(rhs);
+      }
+      return std::stold(lhs) < std::stold(rhs);
+    } catch (...) {
+      MS_LOG(DEBUG) << "Failed to compare the values: " << lhs << " and " << rhs << " as number.";
+    }
+  }
+  return lhs < rhs;
+}
+
+int ShardColumnarIndex::GetLocationColumn(const std::string &column) {
+  auto iter = std::find(kLocationColumns.begin(), kLocationColumns.end(), column);
+  if (iter == kLocationColumns.end()) {
+    return -1;
+  }
+  return static_cast<int>(iter - kLocationColumns.begin());
+}
+
+Status ShardColumnarIndex::AddRow(const std::vector<std::tuple<std::string, std::string, std::string>> &row) {
+  if (locations_.empty()) {
+    locations_.resize(kLocationColumns.size());
+  }
+  size_t num_locations = 0;
+  size_t field_no = 0;
+  for (const auto &column : row) {
+    auto name = std::get<0>(column);
+    if (!name.empty() && name[0] == ':') {
+      name = name.substr(1);
+    }
+    if (name.compare(0, strlen(kIncColumnPrefix), kIncColumnPrefix) == 0) {
+      continue;
+    }
+    auto location = GetLocationColumn(name);
+    if (location >= 0) {
+      try {
+        locations_[location].push_back(std::stoull(std::get<2>(column)));
+      } catch (...) {
+        RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Invalid value of column: " + name + ", " + std::get<2>(column));
+      }
+      ++num_locations;
+      continue;
+    }
+    if (num_rows_ == 0) {
+      IndexField field;
+      field.name = name;
+      field.type = std::get<1>(column) == "INTEGER" ? kFieldInteger
+                                                    : (std::get<1>(column) == "NUMERIC" ? kFieldNumeric : kFieldText);
+      fields_.push_back(std::move(field));
+      raw_values_.emplace_back();
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(field_no < fields_.size() && fields_[field_no].name == name,
+                                    "[Internal ERROR] The index field: " + name + " is different from the first row.");
+    raw_values_[field_no++].push_back(std::get<2>(column));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(num_locations == kLocationColumns.size() && field_no == fields_.size(),
+                                  "[Internal ERROR] The columns of row: " + std::to_string(num_rows_) +
+                                    " are different from the first row.");
+  ++num_rows_;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::BuildFields(const std::vector<uint64_t> &order) {
+  for (size_t i = 0; i < fields_.size(); ++i) {
+    auto &field = fields_[i];
+    auto type = field.type;
+    auto less = [type](const std::string &lhs, const std::string &rhs) { return ValueLess(type, lhs, rhs); };
+    field.values = raw_values_[i];
+    std::sort(field.values.begin(), field.values.end(), less);
+    field.values.erase(std::unique(field.values.begin(), field.values.end(),
+                                   [&less](const std::string &lhs, const std::string &rhs) {
+                                     return !less(lhs, rhs) && !less(rhs, lhs);
+                                   }),
+                       field.values.end());
+    field.value_ids.resize(num_rows_);
+    field.value_offsets.assign(field.values.size() + 1, 0);
+    for (uint64_t row = 0; row < num_rows_; ++row) {
+      const auto &value = raw_values_[i][order[row]];
+      auto id = static_cast<uint64_t>(std::lower_bound(field.values.begin(), field.values.end(), value, less) -
+                                      field.values.begin());
+      field.value_ids[row] = id;
+      ++field.value_offsets[id + 1];
+    }
+    std::partial_sum(field.value_offsets.begin(), field.value_offsets.end(), field.value_offsets.begin());
+    std::vector<uint64_t> positions(field.value_offsets.begin(), field.value_offsets.end() - 1);
+    field.value_rows.resize(num_rows_);
+    for (uint64_t row = 0; row < num_rows_; ++row) {
+      field.value_rows[positions[field.value_ids[row]]++] = row;
+    }
+  }
+  raw_values_.clear();
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Save(const std::string &file_path, const std::string &shard_name) {
+  shard_name_ = shard_name;
+  if (locations_.empty()) {
+    locations_.resize(kLocationColumns.size());
+  }
+  // sort the rows by ROW_ID
+  std::vector<uint64_t> order(num_rows_);
+  std::iota(order.begin(), order.end(), 0);
+  const auto &row_ids = locations_[kRowIdColumn];
+  std::stable_sort(order.begin(), order.end(), [&row_ids](uint64_t lhs, uint64_t rhs) {
+    return row_ids[lhs] < row_ids[rhs];
+  });
+  for (auto &column : locations_) {
+    std::vector<uint64_t> sorted(num_rows_);
+    for (uint64_t row = 0; row < num_rows_; ++row) {
+      sorted[row] = column[order[row]];
+    }
+    column.swap(sorted);
+  }
+  RETURN_IF_NOT_OK_MR(BuildFields(order));
+
+  // the row range of each blob page
+  std::vector<std::tuple<uint64_t, uint64_t, uint64_t>> pages;
+  const auto &page_ids = locations_[kPageIdBlobColumn];
+  for (uint64_t row = 0; row < num_rows_; ++row) {
+    if (row == 0 || page_ids[row] != page_ids[row - 1]) {
+      pages.emplace_back(page_ids[row], row, row + 1);
+    } else {
+      std::get<2>(pages.back()) = row + 1;
+    }
+  }
+  std::sort(pages.begin(), pages.end());
+  page_ids_.clear();
+  page_begins_.clear();
+  page_ends_.clear();
+  for (const auto &page : pages) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(page_ids_.empty() || page_ids_.back() != std::get<0>(page),
+                                    "[Internal ERROR] The rows of blob page: " + std::to_string(std::get<0>(page)) +
+                                      " are not contiguous.");
+    page_ids_.push_back(std::get<0>(page));
+    page_begins_.push_back(std::get<1>(page));
+    page_ends_.push_back(std::get<2>(page));
+  }
+
+  std::vector<uint8_t> buffer;
+  AppendUint64(kColumnarIndexMagic, &buffer);
+  AppendUint64(kColumnarIndexVersion, &buffer);
+  AppendUint64(num_rows_, &buffer);
+  AppendUint64(fields_.size(), &buffer);
+  AppendUint64(page_ids_.size(), &buffer);
+  AppendStrings({shard_name_}, &buffer);
+  for (const auto &column : locations_) {
+    AppendArray(column, &buffer);
+  }
+  AppendArray(page_ids_, &buffer);
+  AppendArray(page_begins_, &buffer);
+  AppendArray(page_ends_, &buffer);
+  for (const auto &field : fields_) {
+    AppendStrings({field.name}, &buffer);
+    AppendUint64(field.type, &buffer);
+    AppendUint64(field.values.size(), &buffer);
+    AppendStrings(field.values, &buffer);
+    AppendArray(field.value_ids, &buffer);
+    AppendArray(field.value_offsets, &buffer);
+    AppendArray(field.value_rows, &buffer);
+  }
+
+  std::ofstream out(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(), "Invalid file, failed to open columnar index file: " + file_path +
+                                                ". Please check file path and permission.");
+  (void)out.write(reinterpret_cast<const char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+  out.close();
+  if (!out.good()) {
+    (void)std::remove(file_path.c_str());
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to write columnar index file: " + file_path);
+  }
+  MS_LOG(INFO) << "Succeed to write " << num_rows_ << " rows to columnar index file: " << file_path;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Load(const std::string &file_path, std::shared_ptr<ShardColumnarIndex> *index_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index_ptr);
+  std::ifstream in(file_path, std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to open columnar index file: " + file_path);
+  auto file_size = static_cast<uint64_t>(in.tellg());
+  std::vector<uint8_t> buffer(file_size);
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(file_size));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to read columnar index file: " + file_path);
+  in.close();
+
+  auto index = std::make_shared<ShardColumnarIndex>();
+  IndexFileParser parser(buffer.data(), file_size);
+  uint64_t magic = 0;
+  uint64_t version = 0;
+  uint64_t num_fields = 0;
+  uint64_t num_pages = 0;
+  RETURN_IF_NOT_OK_MR(parser.ReadUint64(&magic));
+  RETURN_IF_NOT_OK_MR(parser.ReadUint64(&version));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(magic == kColumnarIndexMagic && version == kColumnarIndexVersion,
+                                  "Invalid file, the columnar index file: " + file_path + " is not supported.");
+  RETURN_IF_NOT_OK_MR(parser.ReadUint64(&index->num_rows_));
+  RETURN_IF_NOT_OK_MR(parser.ReadUint64(&num_fields));
+  RETURN_IF_NOT_OK_MR(parser.ReadUint64(&num_pages));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(num_fields <= kMaxFieldCount,
+                                  "Invalid file, the columnar index file: " + file_path + " is broken.");
+  std::vector<std::string> names;
+  RETURN_IF_NOT_OK_MR(parser.ReadStrings(1, &names));
+  index->shard_name_ = names[0];
+  auto num_rows = index->num_rows_;
+  index->locations_.resize(kLocationColumns.size());
+  for (auto &column : index->locations_) {
+    RETURN_IF_NOT_OK_MR(parser.ReadArray(num_rows, &column));
+  }
+  RETURN_IF_NOT_OK_MR(parser.ReadArray(num_pages, &index->page_ids_));
+  RETURN_IF_NOT_OK_MR(parser.ReadArray(num_pages, &index->page_begins_));
+  RETURN_IF_NOT_OK_MR(parser.ReadArray(num_pages, &index->page_ends_));
+  for (uint64_t i = 0; i < num_pages; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(index->page_begins_[i] <= index->page_ends_[i] && index->page_ends_[i] <= num_rows,
+                                    "Invalid file, the columnar index file: " + file_path + " is broken.");
+  }
+  for (uint64_t i = 0; i < num_fields; ++i) {
+    IndexField field;
+    uint64_t num_values = 0;
+    RETURN_IF_NOT_OK_MR(parser.ReadStrings(1, &names));
+    field.name = names[0];
+    RETURN_IF_NOT_OK_MR(parser.ReadUint64(&field.type));
+    RETURN_IF_NOT_OK_MR(parser.ReadUint64(&num_values));
+    RETURN_IF_NOT_OK_MR(parser.ReadStrings(num_values, &field.values));
+    RETURN_IF_NOT_OK_MR(parser.ReadArray(num_rows, &field.value_ids));
+    RETURN_IF_NOT_OK_MR(parser.ReadArray(num_values + 1, &field.value_offsets));
+    RETURN_IF_NOT_OK_MR(parser.ReadArray(num_rows, &field.value_rows));
+    bool valid = std::all_of(field.value_ids.begin(), field.value_ids.end(),
+                             [num_values](uint64_t id) { return id < num_values; });
+    valid = valid && std::all_of(field.value_rows.begin(), field.value_rows.end(),
+                                 [num_rows](uint64_t row) { return row < num_rows; });
+    valid = valid && std::is_sorted(field.value_offsets.begin(), field.value_offsets.end()) &&
+            field.value_offsets.back() == num_rows;
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(valid, "Invalid file, the columnar index file: " + file_path + " is broken.");
+    index->fields_.push_back(std::move(field));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(parser.End(), "Invalid file, the columnar index file: " + file_path + " is broken.");
+  *index_ptr = index;
+  return Status::OK();
+}
+
+std::vector<uint64_t> ShardColumnarIndex::GetAllRows() const {
+  std::vector<uint64_t> rows(num_rows_);
+  std::iota(rows.begin(), rows.end(), 0);
+  return rows;
+}
+
+std::vector<uint64_t> ShardColumnarIndex::GetRowsByRowId(uint64_t row_id) const {
+  const auto &row_ids = locations_[kRowIdColumn];
+  auto range = std::equal_range(row_ids.begin(), row_ids.end(), row_id);
+  std::vector<uint64_t> rows(static_cast<size_t>(range.second - range.first));
+  std::iota(rows.begin(), rows.end(), static_cast<uint64_t>(range.first - row_ids.begin()));
+  return rows;
+}
+
+Status ShardColumnarIndex::GetField(const std::string &field, const IndexField **field_ptr) const {
+  auto iter = std::find_if(fields_.begin(), fields_.end(), [&field](const IndexField &f) { return f.name == field; });
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(iter != fields_.end(),
+                                  "[Internal ERROR] The field: " + field + " can not found in columnar index.");
+  *field_ptr = &(*iter);
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Filter(int64_t page_id, const std::pair<std::string, std::string> &criteria,
+                                  std::vector<uint64_t> *rows) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  rows->clear();
+  uint64_t begin = 0;
+  uint64_t end = num_rows_;
+  if (page_id >= 0) {
+    auto iter = std::lower_bound(page_ids_.begin(), page_ids_.end(), static_cast<uint64_t>(page_id));
+    if (iter == page_ids_.end() || *iter != static_cast<uint64_t>(page_id)) {
+      return Status::OK();
+    }
+    begin = page_begins_[iter - page_ids_.begin()];
+    end = page_ends_[iter - page_ids_.begin()];
+  }
+  if (criteria.first.empty()) {
+    rows->resize(end - begin);
+    std::iota(rows->begin(), rows->end(), begin);
+    return Status::OK();
+  }
+  const IndexField *field = nullptr;
+  RETURN_IF_NOT_OK_MR(GetField(criteria.first, &field));
+  auto type = field->type;
+  auto less = [type](const std::string &lhs, const std::string &rhs) { return ValueLess(type, lhs, rhs); };
+  auto iter = std::lower_bound(field->values.begin(), field->values.end(), criteria.second, less);
+  if (iter == field->values.end() || less(criteria.second, *iter)) {
+    return Status::OK();
+  }
+  auto id = iter - field->values.begin();
+  auto first = field->value_rows.begin() + field->value_offsets[id];
+  auto last = field->value_rows.begin() + field->value_offsets[id + 1];
+  rows->assign(std::lower_bound(first, last, begin), std::lower_bound(first, last, end));
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::GetDistinctValues(const std::string &field, std::vector<std::string> *values) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(values);
+  const IndexField *field_ptr = nullptr;
+  RETURN_IF_NOT_OK_MR(GetField(field, &field_ptr));
+  *values = field_ptr->values;
+  return Status::OK();
+}
+
+Status ShardColumnarIndex::Select(const std::vector<std::string> &columns, const std::vector<uint64_t> &rows,
+                                  std::vector<std::vector<std::string>> *records) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(records);
+  std::vector<int> locations;
+  std::vector<const IndexField *> fields;
+  for (const auto &column : columns) {
+    auto location = GetLocationColumn(column);
+    const IndexField *field = nullptr;
+    if (location < 0) {
+      RETURN_IF_NOT_OK_MR(GetField(column, &field));
+    }
+    locations.push_back(location);
+    fields.push_back(field);
+  }
+  records->clear();
+  records->reserve(rows.size());
+  for (auto row : rows) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(row < num_rows_, "[Internal ERROR] The row: " + std::to_string(row) +
+                                                       " is out of bound: " + std::to_string(num_rows_));
+    std::vector<std::string> record;
+    record.reserve(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (locations[i] >= 0) {
+        record.push_back(std::to_string(locations_[locations[i]][row]));
+      } else {
+        record.push_back(fields[i]->values[fields[i]->value_ids[row]]);
+      }
+    }
+    records->push_back(std::move(record));
+  }
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
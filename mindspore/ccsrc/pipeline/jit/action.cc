@@ -48,6 +48,7 @@
 #include "frontend/optimizer/ad/grad.h"
 #include "frontend/optimizer/py_pass_manager.h"
 #include "utils/ms_context.h"
+#include "utils/compile_profiler.h"
 #include "utils/ms_utils.h"
 #include "backend/graph_compiler/transform.h"
 #include "load_mindir/infer_mindir.h"
@@ -239,6 +240,7 @@ using mindspore::abstract::AnalysisContextPtr;
 abstract::AnalysisResult AbstractAnalyze(const ResourcePtr &resource, const FuncGraphPtr &func_graph,
                                          const abstract::AbstractBasePtrList &args_abs, bool clear) {
   MS_LOG(DEBUG) << "AbstractAnalyze start";
+  CompileProfileScope profile_scope("abstract_analyze", "evaluator", func_graph);
   auto engine = resource->engine();
   MS_EXCEPTION_IF_NULL(engine);
   if (clear || resource->is_load()) {
@@ -286,6 +288,7 @@ FuncGraphPtr ProgramSpecialize(const ResourcePtr &resource, const FuncGraphPtr &
                                const abstract::AnalysisContextPtr &context) {
   MS_EXCEPTION_IF_NULL(resource);
   MS_LOG(DEBUG) << "ProgramSpecialize start";
+  CompileProfileScope profile_scope("program_specialize", "evaluator", func_graph);
   abstract::ProgramSpecializer specializer(resource->engine());
   FuncGraphPtr result = specializer.Run(func_graph, context);
   auto manager = resource->manager();
@@ -708,6 +711,7 @@ bool OptimizeAction(const ResourcePtr &resource, const std::vector<PassItem> &pa
   for (auto &pass : passes) {
     WITH(MsProfile::GetProfile()->Step(pass.first))[&pass, &resource, &counter]() {
       MS_LOG(DEBUG) << "Pass " << pass.first << " start ...";
+      CompileProfileScope profile_scope(pass.first, "pass", [&resource]() { return resource->func_graph(); });
       auto result = pass.second(resource);
       if (!result) {
         MS_LOG(EXCEPTION) << "Pass running to end, failed in pass:" << pass.first;
@@ -20,6 +20,9 @@
 #include <map>
 #include <utility>
 #include <fstream>
+#include <thread>
+#include <chrono>
+#include <cstdio>
 #include "pipeline/jit/parse/data_converter.h"
 #include "include/common/utils/parallel_context.h"
 #include "include/common/debug/common.h"
@@ -47,6 +50,9 @@ constexpr char kRoleServer[] = "server_";
 constexpr char kRolePServer[] = "pserver_";
 constexpr char kRolePScheduler[] = "pscheduler_";
 constexpr char kGroupCkptFileName[] = "group.ckpt";
+constexpr char kSharedCacheTmpSuffix[] = ".tmp_rank_";
+constexpr int64_t kDefaultSharedCacheTimeout = 1800;
+constexpr int64_t kSharedCachePollInterval = 1;
 
 std::string GetUserDefinedCachePath() {
   auto user_defined_path = MsContext::GetInstance()->get_param<std::string>(MS_CTX_COMPILE_CACHE_PATH);
@@ -106,6 +112,58 @@ std::string GetDepFilesHashPath() {
 
 std::string GetGroupCkptSavePath() { return GetCompileCacheDir() + "/" + kGroupCkptFileName; }
 
+std::string GetSharedCacheDir() {
+  static const std::string shared_cache_dir = common::GetEnv("MS_COMPILER_CACHE_SHARED_PATH");
+  return shared_cache_dir;
+}
+
+// The graphs compiled in stand-alone or data parallel mode do not depend on the rank, so all the ranks with the same
+// dependency files, role and device number compile the same graph and can share one artifact. The graphs compiled
+// in the auto parallel modes hold the communication groups of each rank, which use the per-rank cache only.
+bool IsSharedCacheSupported() {
+  if (GetSharedCacheDir().empty()) {
+    return false;
+  }
+  std::string parallel_mode = parallel::ParallelContext::GetInstance()->parallel_mode();
+  if (parallel_mode != parallel::kStandalone && parallel_mode != parallel::kDataParallel) {
+    MS_LOG(INFO) << "The shared compilation cache is not supported in parallel mode " << parallel_mode
+                 << ", use the cache of each rank.";
+    return false;
+  }
+  return true;
+}
+
+// The content address of the shared artifact, the ranks with the same address are in one equivalence class.
+std::string GetSharedCachePath(const std::string &dep_files_hash, size_t idx) {
+  std::string parallel_mode = parallel::ParallelContext::GetInstance()->parallel_mode();
+  auto device_num = parallel::ParallelContext::GetInstance()->device_num();
+  std::string key = dep_files_hash + "|" + GetRole() + "|" + parallel_mode + "|" + std::to_string(device_num) + "|" +
+                    std::to_string(idx);
+  return GetSharedCacheDir() + "/" + system::sha256::GetHashFromString(key) + "/" + kCompileCacheFileName +
+         kCompileCacheFileSuffix;
+}
+
+int64_t GetSharedCacheTimeout() {
+  auto timeout_env = common::GetEnv("MS_COMPILER_CACHE_SHARED_TIMEOUT");
+  if (timeout_env.empty()) {
+    return kDefaultSharedCacheTimeout;
+  }
+  try {
+    return std::stoll(timeout_env);
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Invalid MS_COMPILER_CACHE_SHARED_TIMEOUT: " << timeout_env << ", use the default value "
+                    << kDefaultSharedCacheTimeout << ".";
+    return kDefaultSharedCacheTimeout;
+  }
+}
+
+bool IsFileExist(const std::string &path) {
+  std::ifstream f(path);
+  bool file_is_good = f.good();
+  f.close();
+  return file_is_good;
+}
+
 std::string GetCompileDepFilesHash(const py::list &dep_files) {
   MS_LOG(DEBUG) << "Dependency files size: " << dep_files.size();
   std::vector<std::string> dep_files_path;
@@ -134,9 +192,8 @@ std::map<string, ValuePtr> GenerateWeightsValueMap(const py::dict &weights) {
 }
 
 std::pair<FuncGraphPtr, LayoutMap> LoadFuncGraphFromMindIR(const py::dict &weights, bool has_parallel_info,
-                                                           size_t idx) {
+                                                           const std::string &compile_cache_path) {
   LayoutMap layout_map;
-  std::string compile_cache_path = GetCompileCachePath(idx);
   auto realpath = Common::CreatePrefixPath(compile_cache_path, true);
   if (!realpath.has_value()) {
     MS_LOG(ERROR) << "Get real path of file " << compile_cache_path << " failed.";
@@ -161,6 +218,23 @@ bool ExportFuncGraphToMindIR(const FuncGraphPtr &fg, const FuncGraphPtr &layout_
   return DumpBinaryProto(fg, compile_cache_path, layout_fg);
 }
 
+// The artifact is written to a temporary file and renamed, so the waiting ranks never load a partial file.
+bool PublishFuncGraphToSharedCache(const FuncGraphPtr &fg, const std::string &shared_cache_path) {
+  if (IsFileExist(shared_cache_path)) {
+    return true;
+  }
+  std::string tmp_path = shared_cache_path + kSharedCacheTmpSuffix + std::to_string(IsStandAlone() ? 0 : GetRank());
+  if (!DumpBinaryProto(fg, tmp_path, nullptr)) {
+    return false;
+  }
+  if (std::rename(tmp_path.c_str(), shared_cache_path.c_str()) != 0) {
+    MS_LOG(ERROR) << "Rename " << tmp_path << " to " << shared_cache_path << " failed. " << ErrnoToString(errno);
+    (void)std::remove(tmp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
 bool ExportDepFilesHash(const std::string &compile_cache_dep_files_hash) {
   std::string dep_files_hash_path = GetDepFilesHashPath();
   auto realpath = Common::CreatePrefixPath(dep_files_hash_path, true);
@@ -208,6 +282,14 @@ void CompileCacheManager::CacheFuncGraph(const FuncGraphPtr &fg, const FuncGraph
     MS_LOG(ERROR) << "Failed to cache graph: " << fg->ToString();
     return;
   }
+  if (IsSharedCachePublisher()) {
+    auto shared_cache_path = GetSharedCachePath(compile_cache_dep_files_hash_, compile_cache_id_);
+    if (PublishFuncGraphToSharedCache(fg, shared_cache_path)) {
+      MS_LOG(INFO) << "Publish the compilation cache to " << shared_cache_path;
+    } else {
+      MS_LOG(WARNING) << "Failed to publish the compilation cache to " << shared_cache_path;
+    }
+  }
   if (compile_cache_id_ == 0 && !ExportDepFilesHash(compile_cache_dep_files_hash_)) {
     MS_LOG(ERROR) << "Failed to cache the dependency files hash";
   }
@@ -260,15 +342,61 @@ FuncGraphPtr CompileCacheManager::GetCachedFuncGraph(const FuncGraphManagerPtr &
     has_parallel_info = true;
   }
   // Load the compilation cache file.
-  auto pair = LoadFuncGraphFromMindIR(weights, has_parallel_info, compile_cache_id_);
+  auto pair = LoadFuncGraphFromMindIR(weights, has_parallel_info, GetCompileCachePath(compile_cache_id_));
   if (pair.first == nullptr) {
     MS_LOG(WARNING) << "Failed to load the compilation cache file. Execute all the compilation actions.";
     return nullptr;
   }
-  auto fg = pair.first;
   layout_map_ = pair.second;
-
   MS_LOG(WARNING) << "Use the compilation cache and execute the backend actions only. Be aware of correctness risks.";
+  return ResetCachedFuncGraph(pair.first, manager, queue_name);
+}
+
+bool CompileCacheManager::EnableSharedCache() const { return IsSharedCacheSupported(); }
+
+bool CompileCacheManager::IsSharedCachePublisher() const {
+  return IsSharedCacheSupported() && !compile_cache_dep_files_hash_.empty() && (IsStandAlone() || GetRank() == 0);
+}
+
+FuncGraphPtr CompileCacheManager::GetSharedCachedFuncGraph(const FuncGraphManagerPtr &manager, const py::dict &weights,
+                                                           const std::string &queue_name) {
+  if (compile_cache_dep_files_hash_.empty()) {
+    MS_LOG(WARNING) << "Get current dependency files hash failed, skip the shared compilation cache.";
+    return nullptr;
+  }
+  auto shared_cache_path = GetSharedCachePath(compile_cache_dep_files_hash_, compile_cache_id_);
+  // The publisher compiles the graph if the artifact is not published, and the other ranks wait for it.
+  if (!IsFileExist(shared_cache_path)) {
+    if (IsSharedCachePublisher()) {
+      MS_LOG(INFO) << "The shared compilation cache " << shared_cache_path << " does not exist, compile and publish.";
+      return nullptr;
+    }
+    auto timeout = GetSharedCacheTimeout();
+    MS_LOG(INFO) << "Wait for the shared compilation cache " << shared_cache_path << " at most " << timeout << "s.";
+    auto start = std::chrono::steady_clock::now();
+    while (!IsFileExist(shared_cache_path)) {
+      if (std::chrono::steady_clock::now() - start >= std::chrono::seconds(timeout)) {
+        MS_LOG(WARNING) << "Wait for the shared compilation cache " << shared_cache_path
+                        << " timeout. Execute all the compilation actions.";
+        return nullptr;
+      }
+      std::this_thread::sleep_for(std::chrono::seconds(kSharedCachePollInterval));
+    }
+  }
+  auto pair = LoadFuncGraphFromMindIR(weights, false, shared_cache_path);
+  if (pair.first == nullptr) {
+    MS_LOG(WARNING) << "Failed to load the shared compilation cache file. Execute all the compilation actions.";
+    return nullptr;
+  }
+  layout_map_ = pair.second;
+  MS_LOG(WARNING) << "Use the shared compilation cache " << shared_cache_path
+                  << " and execute the backend actions only. Be aware of correctness risks.";
+  return ResetCachedFuncGraph(pair.first, manager, queue_name);
+}
+
+FuncGraphPtr CompileCacheManager::ResetCachedFuncGraph(const FuncGraphPtr &fg, const FuncGraphManagerPtr &manager,
+                                                       const std::string &queue_name) const {
+  MS_EXCEPTION_IF_NULL(fg);
   FuncGraphManagerPtr mng = fg->manager();
   if (mng == nullptr) {
     MS_EXCEPTION_IF_NULL(manager);
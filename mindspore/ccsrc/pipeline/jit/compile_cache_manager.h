@@ -42,12 +42,23 @@ class CompileCacheManager {
   // Load the cached func_graph from mindir file.
   FuncGraphPtr GetCachedFuncGraph(const FuncGraphManagerPtr &manager, const py::dict &weights,
                                   const std::string &queue_name);
-  // Export the func_graph to mindir file.
+  // Export the func_graph to mindir file, and publish it to the shared cache if this rank is the publisher.
   void CacheFuncGraph(const FuncGraphPtr &fg, const FuncGraphPtr &layout_fg) const;
+  // Whether the shared cache of env MS_COMPILER_CACHE_SHARED_PATH is enabled. The artifact in the shared cache is
+  // addressed by the hash of the dependency files and the compile config, so the ranks compiling the same graph
+  // share one artifact, which is compiled and published by rank 0.
+  bool EnableSharedCache() const;
+  // Load the func_graph from the shared cache, the ranks except the publisher wait until it is published.
+  FuncGraphPtr GetSharedCachedFuncGraph(const FuncGraphManagerPtr &manager, const py::dict &weights,
+                                        const std::string &queue_name);
 
   const LayoutMap &layout_map() const { return layout_map_; }
 
  private:
+  bool IsSharedCachePublisher() const;
+  FuncGraphPtr ResetCachedFuncGraph(const FuncGraphPtr &fg, const FuncGraphManagerPtr &manager,
+                                    const std::string &queue_name) const;
+
   size_t compile_cache_id_;
   std::string compile_cache_dep_files_hash_;
   LayoutMap layout_map_;
@@ -498,12 +498,14 @@ OptPassGroupMap GetOptPassesB(const opt::irpass::OptimizeIRPassLib &irpass) {
   opt::OptPassConfig updatestate_depend_eliminate = opt::OptPassConfig(opt::irpass::UpdatestateDependEliminater());
   opt::OptPassConfig updatestate_assign_eliminate = opt::OptPassConfig(opt::irpass::UpdatestateAssignEliminater());
   opt::OptPassConfig updatestate_loads_eliminate = opt::OptPassConfig(opt::irpass::UpdatestateLoadsEliminater());
+  opt::OptPassConfig switch_to_select = opt::OptPassConfig(opt::irpass::SwitchSmallBranchToSelect());
   OptPassGroupMap map({
     {"b_1", b_1},
     {"b_2", b_2},
     {"updatestate_depend_eliminate", updatestate_depend_eliminate},
     {"updatestate_assign_eliminate", updatestate_assign_eliminate},
     {"updatestate_loads_eliminate", updatestate_loads_eliminate},
+    {"switch_to_select", switch_to_select},
     {"renormalize", opt::OptPassConfig::Renormalize()},
     {"cse", opt::OptPassConfig(opt::CSEPass(false))},
   });
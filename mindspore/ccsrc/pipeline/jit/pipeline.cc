@@ -46,11 +46,13 @@
 #include "include/common/utils/convert_utils.h"
 #include "include/common/utils/convert_utils_py.h"
 #include "utils/ms_context.h"
+#include "utils/compile_profiler.h"
 #include "utils/shape_utils.h"
 #include "utils/info.h"
 #include "utils/crypto.h"
 #include "include/common/utils/comm_manager.h"
 #include "utils/interpret_node_recorder.h"
+#include "abstract/ops/infer_cache.h"
 #include "include/common/debug/anf_ir_dump.h"
 #include "include/common/debug/dump_proto.h"
 #include "pipeline/jit/debug/anf_ir_utils.h"
@@ -1117,6 +1119,7 @@ void Pipeline::Run() {
       bool result = true;
       WITH(MsProfile::GetProfile()->Step(action.first))[&result, &action, this]() {
         MS_LOG(INFO) << "Status record: start " << action.first << " action.";
+        CompileProfileScope profile_scope(action.first, "action", [this]() { return resource_->func_graph(); });
         result = action.second(resource_);
         MS_LOG(INFO) << "Status record: end " << action.first << " action.";
       };
@@ -1161,6 +1164,7 @@ void Pipeline::Run() {
   MsProfile::Print();
   MsProfile::Reset();
 #endif
+  CompileProfiler::GetInstance().Export();
 
 #ifdef ENABLE_DUMP_IR
   if (MsContext::GetInstance()->get_param<bool>(MS_CTX_SAVE_GRAPHS_FLAG) && (user_graph != nullptr)) {
@@ -1692,6 +1696,7 @@ void MemoryRecycle() {
   ad::PrimBpropOptimizer::GetPrimBpropOptimizerInst().Clear();
   abstract::AnalysisResultCacheMgr::GetInstance().Clear();
   abstract::AnalysisContext::ClearContext();
+  abstract::InferCache::GetInstance().Clear();
   g_args_cache.clear();
   // clean static variable to prevent from crash. As static variable is released after
   // Python threads is released.
@@ -1795,6 +1800,10 @@ void ClearResAtexit() {
   abstract::AnalysisContext::ClearContext();
   MS_LOG(INFO) << "End clear AnalysisContext...";
 
+  MS_LOG(INFO) << "Start clear InferCache...";
+  abstract::InferCache::GetInstance().Clear();
+  MS_LOG(INFO) << "End clear InferCache.";
+
   MS_LOG(INFO) << "Start clear AnalysisSchedule...";
   abstract::AnalysisSchedule::GetInstance().Stop();
   MS_LOG(INFO) << "End clear AnalysisSchedule...";
@@ -433,6 +433,14 @@ void Resource::GetCompileCacheResource(const py::list &compile_cache_dep_files,
   compile_cache_manager_ = std::make_shared<CompileCacheManager>(compile_cache_id);
   compile_cache_manager_->InitParallelGroupCkptSaveFile();
   MS_EXCEPTION_IF_NULL(compile_cache_consistent);
+  if (compile_cache_manager_->EnableSharedCache()) {
+    compile_cache_manager_->InitCompileCacheHash(compile_cache_dep_files);
+    func_graph_ = compile_cache_manager_->GetSharedCachedFuncGraph(manager_, weights, queue_name);
+    if (func_graph_ != nullptr) {
+      layout_map_ = compile_cache_manager_->layout_map();
+      return;
+    }
+  }
   if (!*compile_cache_consistent) {
     MS_LOG(WARNING) << "Check the consistency of dependency files hash failed. Execute all the compilation actions.";
     return;
@@ -24,6 +24,7 @@
 #include "backend/graph_compiler/transform.h"
 #include "utils/check_convert_utils.h"
 #include "utils/ms_context.h"
+#include "utils/profile.h"
 
 namespace mindspore {
 namespace pynative {
@@ -244,6 +245,7 @@ void ForwardExecutor::Init() {
   device_target_ = ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET);
   device_id_ = ms_context->get_param<uint32_t>(MS_CTX_DEVICE_ID);
   enable_mind_rt_ = ms_context->get_param<bool>(MS_CTX_ENABLE_MINDRT);
+  dispatch_profile_.enable = (common::GetEnv("MS_DEV_PYNATIVE_DISPATCH_PROFILE") == "1");
   init_ = true;
 }
 
@@ -351,23 +353,61 @@ void ForwardExecutor::GetInputAbstract(const FrontendOpRunInfoPtr &op_run_info)
   }
 }
 
+bool ForwardExecutor::MatchCallSiteCache(const FrontendOpRunInfoPtr &op_run_info) {
+  const auto &prim = op_run_info->op_prim;
+  auto iter = prim_call_site_cache_.find(prim.get());
+  if (iter == prim_call_site_cache_.end()) {
+    return false;
+  }
+  const auto &info = iter->second;
+  // The primitive may be released and another one is created at the same address.
+  if (info.prim.lock() != prim) {
+    (void)prim_call_site_cache_.erase(iter);
+    return false;
+  }
+  if (!abstract::AbstractBasePtrListDeepEqual(op_run_info->input_abs, info.input_abs) ||
+      !common::IsAttrsEqual(prim->attrs(), info.prim_attrs)) {
+    return false;
+  }
+  MS_LOG(DEBUG) << "Match call site of prim " << prim->name() << " ok " << info.abs_info.abs->ToString();
+  op_run_info->base_op_run_info.abstract = info.abs_info.abs;
+  prim->set_evaluate_added_attrs(info.abs_info.attrs);
+  return true;
+}
+
+void ForwardExecutor::UpdateCallSiteCache(const FrontendOpRunInfoPtr &op_run_info) {
+  const auto &prim = op_run_info->op_prim;
+  auto &info = prim_call_site_cache_[prim.get()];
+  info.prim = prim;
+  info.prim_attrs = prim->attrs();
+  info.input_abs = op_run_info->input_abs;
+  info.abs_info.abs = op_run_info->base_op_run_info.abstract;
+  info.abs_info.attrs = prim->evaluate_added_attrs();
+}
+
 bool ForwardExecutor::GetOutputAbstract(const FrontendOpRunInfoPtr &op_run_info) {
   MS_EXCEPTION_IF_NULL(op_run_info);
   auto op_name = op_run_info->base_op_run_info.op_name;
   auto prim = op_run_info->op_prim;
   MS_EXCEPTION_IF_NULL(prim);
 
-  bool prim_cache_hit = false;
-  AbsCacheKey key{prim->name(), prim->Hash(), prim->attrs()};
-  auto temp = prim_abs_list_.find(key);
-  if (temp != prim_abs_list_.end()) {
-    MS_LOG(DEBUG) << "Match prim input args " << op_name << mindspore::ToString(op_run_info->input_abs);
-    auto iter = temp->second.find(op_run_info->input_abs);
-    if (iter != temp->second.end()) {
-      MS_LOG(DEBUG) << "Match prim ok " << iter->second.abs->ToString();
-      op_run_info->base_op_run_info.abstract = iter->second.abs;
-      prim->set_evaluate_added_attrs(iter->second.attrs);
-      prim_cache_hit = true;
+  bool prim_cache_hit = MatchCallSiteCache(op_run_info);
+  if (prim_cache_hit) {
+    ++dispatch_profile_.call_site_hit_num;
+  } else {
+    AbsCacheKey key{prim->name(), prim->Hash(), prim->attrs()};
+    auto temp = prim_abs_list_.find(key);
+    if (temp != prim_abs_list_.end()) {
+      MS_LOG(DEBUG) << "Match prim input args " << op_name << mindspore::ToString(op_run_info->input_abs);
+      auto iter = temp->second.find(op_run_info->input_abs);
+      if (iter != temp->second.end()) {
+        MS_LOG(DEBUG) << "Match prim ok " << iter->second.abs->ToString();
+        op_run_info->base_op_run_info.abstract = iter->second.abs;
+        prim->set_evaluate_added_attrs(iter->second.attrs);
+        prim_cache_hit = true;
+        ++dispatch_profile_.abs_cache_hit_num;
+        UpdateCallSiteCache(op_run_info);
+      }
     }
   }
 
@@ -403,12 +443,17 @@ ValuePtr ForwardExecutor::RunOpForward(const FrontendOpRunInfoPtr &op_run_info)
     return RunMixedPrecisionCastOp(op_run_info);
   }
 
+  double start_time = dispatch_profile_.enable ? GetTime() : 0;
   // 1.Set cast for inputs
   SetCastForInputs(op_run_info);
   // 2. Get input abstract
   GetInputAbstract(op_run_info);
   // 3.Get output abstract
   bool prim_cache_hit = GetOutputAbstract(op_run_info);
+  if (dispatch_profile_.enable) {
+    dispatch_profile_.dispatch_time += GetTime() - start_time;
+    ++dispatch_profile_.op_num;
+  }
   // 4.Get output
   const auto &out_value = GetOutput(op_run_info, prim_cache_hit);
   // 5. Do op grad
@@ -487,6 +532,7 @@ ValuePtr ForwardExecutor::GetOutput(const FrontendOpRunInfoPtr &op_run_info, boo
     auto &out = prim_abs_list_[key];
     out[op_run_info->input_abs].abs = op_run_info->base_op_run_info.abstract;
     out[op_run_info->input_abs].attrs = prim->evaluate_added_attrs();
+    UpdateCallSiteCache(op_run_info);
   }
 
   // Run op with selected backend, nop is no need run backend
@@ -553,6 +599,8 @@ ValuePtr ForwardExecutor::RunOpWithBackendPolicy(const FrontendOpRunInfoPtr &op_
 ValuePtr ForwardExecutor::RunOpInVM(const FrontendOpRunInfoPtr &op_run_info) const {
   MS_LOG(DEBUG) << "RunOpInVM start";
   MS_EXCEPTION_IF_NULL(op_run_info);
+  // The placeholders of the lazy fusion have no data before the window is flushed.
+  lazy_fusion()->Flush();
   MS_EXCEPTION_IF_NULL(op_run_info->op_prim);
   op_run_info->run_in_vm = true;
   const auto &op_inputs = op_run_info->input_value;
@@ -620,6 +668,7 @@ bool ForwardExecutor::CellNotSetMixedPrecision(const FrontendOpRunInfoPtr &op_ru
 }
 
 void ForwardExecutor::ExecuteLazyTask() {
+  lazy_fusion()->Flush();
   mindspore::ScopedLongRunning long_running;
   session::PynativeTaskManager::GetInstance().ExecuteRemainingTasks();
   for (const auto &item : mindrt_backends_) {
@@ -687,6 +736,7 @@ void ForwardExecutor::Sync() {
       MS_EXCEPTION_IF_NULL(item.second);
       item.second->SyncStream();
     }
+    lazy_fusion()->SyncStream();
   }
 }
 
@@ -704,6 +754,17 @@ ValuePtr ForwardExecutor::RunOpInMs(const FrontendOpRunInfoPtr &op_run_info) {
   ConvertAttrToUnifyMindIR(op_run_info);
   // get graph info for checking it whether existing in the cache
   GetSingleOpGraphInfo(op_run_info);
+  if (enable_mind_rt_ && lazy_fusion()->enable()) {
+    // The ops for grad run by themselves, since the grad graph needs the real outputs of the forward ops.
+    if (!grad()->grad_flag() && lazy_fusion()->IsSupported(op_run_info)) {
+      const auto &result_v = lazy_fusion()->Record(op_run_info, device_id_);
+      dynamic_shape()->SaveOutputDynamicShape(op_run_info, op_run_info->base_op_run_info.abstract, result_v);
+      ms_context->set_param<bool>(MS_CTX_ENABLE_PYNATIVE_INFER, false);
+      MS_LOG(DEBUG) << "RunOpInMs end, the op is recorded by the lazy fusion";
+      return result_v;
+    }
+    lazy_fusion()->Flush();
+  }
   auto backend_op_run_info =
     std::make_shared<BackendOpRunInfo>(op_run_info->base_op_run_info, op_run_info->op_prim.get(), true, false);
 #if defined(__APPLE__)
@@ -727,16 +788,32 @@ ValuePtr ForwardExecutor::RunOpInMs(const FrontendOpRunInfoPtr &op_run_info) {
   return result_v;
 }
 
+void ForwardExecutor::PrintDispatchProfile() const {
+  if (!dispatch_profile_.enable || dispatch_profile_.op_num == 0) {
+    return;
+  }
+  constexpr double kSecondToUs = 1e6;
+  MS_LOG(WARNING) << "PyNative op dispatch profile: " << dispatch_profile_.op_num << " ops, average dispatch time "
+                  << dispatch_profile_.dispatch_time * kSecondToUs / dispatch_profile_.op_num
+                  << "us per op (cast, input and output abstract), call site cache hit "
+                  << dispatch_profile_.call_site_hit_num << ", abstract cache hit "
+                  << dispatch_profile_.abs_cache_hit_num << ".";
+}
+
 void ForwardExecutor::ClearRes() {
   MS_LOG(DEBUG) << "Clear forward res";
+  PrintDispatchProfile();
+  dispatch_profile_ = DispatchProfile();
   for (const auto &item : mindrt_backends_) {
     MS_EXCEPTION_IF_NULL(item.second);
     item.second->ClearOpExecutorResource();
   }
+  lazy_fusion()->Clear();
   node_abs_map_.clear();
   init_ = false;
   lazy_build_ = false;
   prim_abs_list_.clear();
+  prim_call_site_cache_.clear();
   std::stack<CellPtr>().swap(forward_cell_stack_);
   session_backends_.clear();
   mindrt_backends_.clear();
@@ -23,6 +23,7 @@
 #include <utility>
 #include <stack>
 #include "pipeline/pynative/forward/do_cast.h"
+#include "pipeline/pynative/forward/lazy_fusion.h"
 #include "pipeline/pynative/grad/grad.h"
 #include "pipeline/pynative/dynamic_shape.h"
 #include "backend/common/session/session_factory.h"
@@ -48,7 +49,9 @@ using MindrtBackendMap = std::map<std::string, std::shared_ptr<compile::MindRTBa
 class ForwardExecutor {
  public:
   ForwardExecutor()
-      : cast_operation_(std::make_shared<CastOperation>()), dynamic_shape_(std::make_shared<DynamicShape>()) {}
+      : cast_operation_(std::make_shared<CastOperation>()),
+        dynamic_shape_(std::make_shared<DynamicShape>()),
+        lazy_fusion_(std::make_shared<LazyFusion>()) {}
   ~ForwardExecutor() = default;
 
   std::function<void(py::object *, const FrontendOpRunInfoPtr &)> RunOpS = [this](auto &&PH1, auto &&PH2) {
@@ -86,6 +89,9 @@ class ForwardExecutor {
   GradExecutorPtr grad() const;
   void GetInputAbstract(const FrontendOpRunInfoPtr &op_run_info);
   bool GetOutputAbstract(const FrontendOpRunInfoPtr &op_run_info);
+  bool MatchCallSiteCache(const FrontendOpRunInfoPtr &op_run_info);
+  void UpdateCallSiteCache(const FrontendOpRunInfoPtr &op_run_info);
+  void PrintDispatchProfile() const;
   AbstractBasePtr GetInputAbs(const FrontendOpRunInfoPtr &op_run_info, const ValuePtr &v, size_t index);
   AbstractBasePtr GetTupleInputAbstract(const FrontendOpRunInfoPtr &op_run_info, const ValuePtr &v,
                                         const std::string &id, size_t input_index);
@@ -97,6 +103,10 @@ class ForwardExecutor {
     MS_EXCEPTION_IF_NULL(cast_operation_);
     return cast_operation_;
   }
+  inline LazyFusionPtr lazy_fusion() const {
+    MS_EXCEPTION_IF_NULL(lazy_fusion_);
+    return lazy_fusion_;
+  }
   ValuePtr RunOpInVM(const FrontendOpRunInfoPtr &op_run_info) const;
   ValuePtr RunOpInMs(const FrontendOpRunInfoPtr &op_run_info);
   ValuePtr RunOpWithBackendPolicy(const FrontendOpRunInfoPtr &op_run_info);
@@ -113,12 +123,22 @@ class ForwardExecutor {
   bool enable_mind_rt_{false};
   uint32_t device_id_;
   PrimAbsCache prim_abs_list_;
+  PrimCallSiteCache prim_call_site_cache_;
+  // The statistics of the dispatch overhead before running the op, enabled by env MS_DEV_PYNATIVE_DISPATCH_PROFILE=1.
+  struct DispatchProfile {
+    bool enable{false};
+    size_t op_num{0};
+    size_t call_site_hit_num{0};
+    size_t abs_cache_hit_num{0};
+    double dispatch_time{0};
+  } dispatch_profile_;
   std::string last_target_{"Unknown"};
   std::string device_target_;
   std::stack<CellPtr> forward_cell_stack_;
   GradExecutorWeakPtr grad_executor_;
   CastOperationPtr cast_operation_;
   DynamicShapePtr dynamic_shape_;
+  LazyFusionPtr lazy_fusion_;
   SessionBackendMap session_backends_;
   MindrtBackendMap mindrt_backends_;
   mindspore::HashMap<std::string, abstract::AbstractBasePtr> node_abs_map_;
@@ -0,0 +1,317 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pipeline/pynative/forward/lazy_fusion.h"
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include "pipeline/jit/resource.h"
+#include "runtime/pynative/op_executor.h"
+#include "include/common/utils/utils.h"
+#include "ir/manager.h"
+#include "utils/flags.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace pynative {
+namespace {
+bool HasSideEffect(const PrimitivePtr &prim) {
+  MS_EXCEPTION_IF_NULL(prim);
+  for (const auto &attr_name : {GRAPH_FLAG_SIDE_EFFECT_MEM, GRAPH_FLAG_SIDE_EFFECT_IO, GRAPH_FLAG_SIDE_EFFECT_HIDDEN}) {
+    auto attr = prim->GetAttr(attr_name);
+    if (attr != nullptr && attr->isa<BoolImm>() && GetValue<bool>(attr)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Get the abstracts of the outputs, which are empty if any output is not a tensor with static shape.
+AbstractBasePtrList GetOutputAbstracts(const AbstractBasePtr &abs) {
+  if (abs == nullptr) {
+    return {};
+  }
+  AbstractBasePtrList output_abs;
+  if (abs->isa<abstract::AbstractTuple>()) {
+    output_abs = abs->cast<abstract::AbstractTuplePtr>()->elements();
+  } else {
+    output_abs.push_back(abs);
+  }
+  for (const auto &item : output_abs) {
+    MS_EXCEPTION_IF_NULL(item);
+    if (!item->isa<abstract::AbstractTensor>() || item->isa<abstract::AbstractRefTensor>() ||
+        item->BuildShape()->IsDynamic()) {
+      return {};
+    }
+  }
+  return output_abs;
+}
+
+void FlattenOutputs(const BaseRef &output, std::vector<tensor::TensorPtr> *tensors) {
+  MS_EXCEPTION_IF_NULL(tensors);
+  if (utils::isa<VectorRef>(output)) {
+    for (const auto &item : utils::cast<VectorRef>(output)) {
+      FlattenOutputs(item, tensors);
+    }
+  } else if (utils::isa<tensor::TensorPtr>(output)) {
+    (void)tensors->emplace_back(utils::cast<tensor::TensorPtr>(output));
+  } else {
+    MS_LOG(EXCEPTION) << "The output of the lazy fusion graph should be tensor, but got " << output.ToString();
+  }
+}
+
+void SetPlaceholder(const tensor::TensorPtr &placeholder, const tensor::TensorPtr &output) {
+  MS_EXCEPTION_IF_NULL(placeholder);
+  MS_EXCEPTION_IF_NULL(output);
+  if (output->device_address() != nullptr) {
+    placeholder->set_device_address(output->device_address());
+    placeholder->set_sync_status(kNeedSyncDeviceToHost);
+    return;
+  }
+  // The output which is folded to a value has no device address.
+  if (placeholder->Size() != output->Size() ||
+      memcpy_s(placeholder->data_c(), placeholder->Size(), output->data_c(), output->Size()) != EOK) {
+    MS_LOG(EXCEPTION) << "Copy the output " << output->ToString() << " of the lazy fusion graph failed.";
+  }
+  placeholder->set_sync_status(kNeedSyncHostToDevice);
+}
+}  // namespace
+
+LazyFusion::LazyFusion() {
+  auto window_env = common::GetEnv("MS_DEV_PYNATIVE_LAZY_FUSION");
+  if (!window_env.empty()) {
+    try {
+      window_size_ = std::stoul(window_env);
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid MS_DEV_PYNATIVE_LAZY_FUSION: " << window_env << ", the lazy fusion is disabled.";
+    }
+  }
+  MS_LOG(INFO) << "The lazy fusion window of PyNative is " << window_size_;
+}
+
+bool LazyFusion::IsSupported(const FrontendOpRunInfoPtr &op_run_info) const {
+  MS_EXCEPTION_IF_NULL(op_run_info);
+  const auto &base_op_run_info = op_run_info->base_op_run_info;
+  if (base_op_run_info.has_dynamic_input || base_op_run_info.has_dynamic_output ||
+      base_op_run_info.is_mixed_precision_cast || HasSideEffect(op_run_info->op_prim)) {
+    return false;
+  }
+  return !GetOutputAbstracts(base_op_run_info.abstract).empty();
+}
+
+ValuePtr LazyFusion::Record(const FrontendOpRunInfoPtr &op_run_info, uint32_t device_id) {
+  MS_EXCEPTION_IF_NULL(op_run_info);
+  MS_EXCEPTION_IF_NULL(op_run_info->op_prim);
+  const auto &base_op_run_info = op_run_info->base_op_run_info;
+  if (!ops_.empty() && (base_op_run_info.device_target != device_target_ || device_id != device_id_)) {
+    Flush();
+  }
+  if (ops_.empty()) {
+    device_target_ = base_op_run_info.device_target;
+    device_id_ = device_id;
+    runtime::OpExecutor::GetInstance().RegisterLazyFusion([this]() { Flush(); });
+  }
+
+  // Decoupling of frontend PrimitivePy and backend Primitive
+  RecordedOp op{std::make_shared<Primitive>(*op_run_info->op_prim), base_op_run_info, {}};
+  std::vector<ValuePtr> outputs;
+  for (const auto &abs : GetOutputAbstracts(base_op_run_info.abstract)) {
+    auto shape = abs->BuildShape()->cast<abstract::ShapePtr>();
+    MS_EXCEPTION_IF_NULL(shape);
+    auto tensor_abs = abs->cast<abstract::AbstractTensorPtr>();
+    MS_EXCEPTION_IF_NULL(tensor_abs->element());
+    auto type = tensor_abs->element()->BuildType();
+    MS_EXCEPTION_IF_NULL(type);
+    auto placeholder = std::make_shared<tensor::Tensor>(type->type_id(), shape->shape());
+    // Waiting for the op executor flushes the window, then the placeholder has the device address.
+    placeholder->set_lazy_callback([]() { runtime::OpExecutor::GetInstance().Wait(); });
+    (void)op.outputs.emplace_back(placeholder);
+    (void)outputs.emplace_back(placeholder);
+  }
+  (void)ops_.emplace_back(std::move(op));
+  if (ops_.size() >= window_size_) {
+    Flush();
+  }
+  return std::make_shared<ValueTuple>(outputs);
+}
+
+std::string LazyFusion::GetInputSources(const std::vector<RecordedOp> &ops,
+                                        std::vector<std::vector<InputSource>> *sources, VectorRef *args) const {
+  MS_EXCEPTION_IF_NULL(sources);
+  MS_EXCEPTION_IF_NULL(args);
+  std::map<const tensor::Tensor *, std::pair<size_t, size_t>> op_outputs;
+  std::map<const tensor::Tensor *, size_t> parameters;
+  std::ostringstream key;
+  for (size_t op_index = 0; op_index < ops.size(); ++op_index) {
+    const auto &op = ops[op_index];
+    const auto &input_tensors = op.base_op_run_info.input_tensor;
+    const auto &input_mask = op.base_op_run_info.input_mask;
+    key << op.base_op_run_info.graph_info << "(";
+    std::vector<InputSource> op_sources;
+    for (size_t i = 0; i < input_tensors.size(); ++i) {
+      const auto &input_tensor = input_tensors[i];
+      MS_EXCEPTION_IF_NULL(input_tensor);
+      auto output_iter = op_outputs.find(input_tensor.get());
+      if (output_iter != op_outputs.end()) {
+        const auto &[source_op, source_output] = output_iter->second;
+        (void)op_sources.emplace_back(InputSource{InputKind::kOpOutput, source_op, source_output});
+        key << "o" << source_op << "." << source_output << ",";
+      } else if (input_mask[i] == kValueNodeTensorMask) {
+        (void)op_sources.emplace_back(InputSource{InputKind::kValue, 0, 0});
+        key << "v,";
+      } else {
+        auto parameter_iter = parameters.find(input_tensor.get());
+        if (parameter_iter == parameters.end()) {
+          parameter_iter = parameters.emplace(input_tensor.get(), args->size()).first;
+          args->push_back(input_tensor);
+        }
+        (void)op_sources.emplace_back(InputSource{InputKind::kParameter, parameter_iter->second, 0});
+        key << "p" << parameter_iter->second << ",";
+      }
+    }
+    key << ")";
+    for (size_t output_index = 0; output_index < op.outputs.size(); ++output_index) {
+      (void)op_outputs.emplace(op.outputs[output_index].get(), std::make_pair(op_index, output_index));
+    }
+    (void)sources->emplace_back(std::move(op_sources));
+  }
+  return key.str();
+}
+
+FuncGraphPtr LazyFusion::BuildGraph(const std::vector<RecordedOp> &ops,
+                                    const std::vector<std::vector<InputSource>> &sources, const VectorRef &args) const {
+  auto func_graph = std::make_shared<FuncGraph>();
+  std::vector<AnfNodePtr> parameters;
+  for (const auto &arg : args) {
+    auto tensor = utils::cast<tensor::TensorPtr>(arg);
+    MS_EXCEPTION_IF_NULL(tensor);
+    auto abs = tensor->ToAbstract()->Broaden();
+    if (abs->isa<abstract::AbstractRefTensor>()) {
+      abs = abs->cast<abstract::AbstractRefPtr>()->CloneAsTensor();
+    }
+    auto parameter = func_graph->add_parameter();
+    parameter->set_abstract(abs);
+    (void)parameters.emplace_back(parameter);
+  }
+
+  std::vector<std::vector<AnfNodePtr>> op_outputs;
+  std::vector<AnfNodePtr> make_tuple_inputs{NewValueNode(prim::kPrimMakeTuple)};
+  AbstractBasePtrList output_abs;
+  for (size_t op_index = 0; op_index < ops.size(); ++op_index) {
+    const auto &op = ops[op_index];
+    std::vector<AnfNodePtr> inputs{NewValueNode(op.prim)};
+    for (size_t i = 0; i < sources[op_index].size(); ++i) {
+      const auto &source = sources[op_index][i];
+      if (source.kind == InputKind::kOpOutput) {
+        (void)inputs.emplace_back(op_outputs[source.index][source.output_index]);
+      } else if (source.kind == InputKind::kParameter) {
+        (void)inputs.emplace_back(parameters[source.index]);
+      } else {
+        const auto &input_tensor = op.base_op_run_info.input_tensor[i];
+        auto value_node = NewValueNode(input_tensor);
+        value_node->set_abstract(input_tensor->ToAbstract());
+        (void)inputs.emplace_back(value_node);
+      }
+    }
+    auto cnode = func_graph->NewCNode(inputs);
+    MS_EXCEPTION_IF_NULL(cnode);
+    cnode->set_abstract(op.base_op_run_info.abstract);
+
+    std::vector<AnfNodePtr> outputs;
+    auto abs_list = GetOutputAbstracts(op.base_op_run_info.abstract);
+    if (op.base_op_run_info.abstract->isa<abstract::AbstractTuple>()) {
+      for (size_t output_index = 0; output_index < abs_list.size(); ++output_index) {
+        auto index_node = NewValueNode(SizeToLong(output_index));
+        index_node->set_abstract(std::make_shared<abstract::AbstractScalar>(SizeToLong(output_index)));
+        auto tuple_get_item = func_graph->NewCNode({NewValueNode(prim::kPrimTupleGetItem), cnode, index_node});
+        tuple_get_item->set_abstract(abs_list[output_index]);
+        (void)outputs.emplace_back(tuple_get_item);
+      }
+    } else {
+      (void)outputs.emplace_back(cnode);
+    }
+    (void)make_tuple_inputs.insert(make_tuple_inputs.end(), outputs.begin(), outputs.end());
+    (void)output_abs.insert(output_abs.end(), abs_list.begin(), abs_list.end());
+    (void)op_outputs.emplace_back(std::move(outputs));
+  }
+  auto output = func_graph->NewCNode(make_tuple_inputs);
+  output->set_abstract(std::make_shared<abstract::AbstractTuple>(output_abs));
+  func_graph->set_output(output);
+  return func_graph;
+}
+
+void LazyFusion::Flush() {
+  if (ops_.empty()) {
+    return;
+  }
+  // The graph runs after the window is taken, so waiting for the op executor in the run doesn't flush it again.
+  std::vector<RecordedOp> ops;
+  ops.swap(ops_);
+  MS_LOG(DEBUG) << "Flush the lazy fusion window of " << ops.size() << " ops";
+  auto ms_context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(ms_context);
+  auto infer_flag = ms_context->get_param<bool>(MS_CTX_ENABLE_PYNATIVE_INFER);
+  ms_context->set_param<bool>(MS_CTX_ENABLE_PYNATIVE_INFER, false);
+
+  std::vector<std::vector<InputSource>> sources;
+  VectorRef args;
+  auto key = device_target_ + std::to_string(device_id_) + GetInputSources(ops, &sources, &args);
+  auto iter = graphs_.find(key);
+  if (iter == graphs_.end()) {
+    auto func_graph = BuildGraph(ops, sources, args);
+    (void)Manage(func_graph, true);
+    compile::MindRTBackendPtr backend;
+    {
+      std::lock_guard<std::mutex> guard(pipeline::Resource::GetBackendInitMutex());
+      backend = std::make_shared<compile::MindRTBackend>("ms", device_target_, device_id_);
+    }
+    MS_EXCEPTION_IF_NULL(backend);
+    const auto &actor_info = backend->CompileGraphs(func_graph);
+    iter = graphs_.emplace(key, WindowGraph{backend, actor_info}).first;
+  }
+  last_backend_ = iter->second.backend;
+  VectorRef outputs;
+  iter->second.backend->RunGraph(iter->second.actor_info, args, &outputs);
+  ms_context->set_param<bool>(MS_CTX_ENABLE_PYNATIVE_INFER, infer_flag);
+
+  std::vector<tensor::TensorPtr> output_tensors;
+  FlattenOutputs(outputs, &output_tensors);
+  size_t output_index = 0;
+  for (const auto &op : ops) {
+    for (const auto &placeholder : op.outputs) {
+      if (output_index >= output_tensors.size()) {
+        MS_LOG(EXCEPTION) << "The lazy fusion graph has " << output_tensors.size()
+                          << " outputs, which are less than the outputs of the ops in the window.";
+      }
+      SetPlaceholder(placeholder, output_tensors[output_index++]);
+    }
+  }
+}
+
+void LazyFusion::SyncStream() const {
+  if (last_backend_ != nullptr) {
+    last_backend_->SyncStream();
+  }
+}
+
+void LazyFusion::Clear() {
+  ops_.clear();
+  graphs_.clear();
+  last_backend_ = nullptr;
+}
+}  // namespace pynative
+}  // namespace mindspore
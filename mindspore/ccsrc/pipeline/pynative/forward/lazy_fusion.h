@@ -0,0 +1,82 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_MINDSPORE_CCSRC_PIPELINE_PYNATIVE_LAZY_FUSION_H_
+#define MINDSPORE_MINDSPORE_CCSRC_PIPELINE_PYNATIVE_LAZY_FUSION_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "pipeline/pynative/base.h"
+#include "backend/graph_compiler/backend.h"
+
+namespace mindspore {
+namespace pynative {
+// The lazy fusion of PyNative, which is enabled by env MS_DEV_PYNATIVE_LAZY_FUSION=<window size>. The ops are recorded
+// into a window instead of being launched one by one, and their outputs are placeholder tensors. When the window is
+// flushed, the ops are built into one graph which is launched once, so they are fused by graph kernel if
+// enable_graph_kernel is set. The window is flushed when it is full, before an op which can't be recorded, and at the
+// sync points which wait for the op executor, such as asnumpy and running a graph. The graph is compiled once for each
+// structure of the window.
+class LazyFusion {
+ public:
+  LazyFusion();
+  ~LazyFusion() = default;
+  bool enable() const { return window_size_ > 0; }
+  // The ops with dynamic shape or side effect, and the ops whose outputs are not tensors, run by themselves.
+  bool IsSupported(const FrontendOpRunInfoPtr &op_run_info) const;
+  // Record the op into the window and return its placeholder outputs.
+  ValuePtr Record(const FrontendOpRunInfoPtr &op_run_info, uint32_t device_id);
+  // Run the ops of the window as one graph, then the placeholders take the device addresses of the graph outputs.
+  void Flush();
+  void SyncStream() const;
+  void Clear();
+
+ private:
+  struct RecordedOp {
+    PrimitivePtr prim;
+    BaseOpRunInfo base_op_run_info;
+    std::vector<tensor::TensorPtr> outputs;
+  };
+  // The input of a recorded op is an output of an earlier op in the window, a parameter of the graph or a value node.
+  enum class InputKind { kOpOutput, kParameter, kValue };
+  struct InputSource {
+    InputKind kind;
+    size_t index;
+    size_t output_index;
+  };
+  struct WindowGraph {
+    compile::MindRTBackendPtr backend;
+    compile::ActorInfo actor_info;
+  };
+
+  std::string GetInputSources(const std::vector<RecordedOp> &ops, std::vector<std::vector<InputSource>> *sources,
+                              VectorRef *args) const;
+  FuncGraphPtr BuildGraph(const std::vector<RecordedOp> &ops, const std::vector<std::vector<InputSource>> &sources,
+                          const VectorRef &args) const;
+
+  size_t window_size_{0};
+  std::string device_target_;
+  uint32_t device_id_{0};
+  std::vector<RecordedOp> ops_;
+  mindspore::HashMap<std::string, WindowGraph> graphs_;
+  compile::MindRTBackendPtr last_backend_{nullptr};
+};
+using LazyFusionPtr = std::shared_ptr<LazyFusion>;
+}  // namespace pynative
+}  // namespace mindspore
+
+#endif  // MINDSPORE_MINDSPORE_CCSRC_PIPELINE_PYNATIVE_LAZY_FUSION_H_
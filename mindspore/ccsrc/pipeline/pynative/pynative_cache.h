@@ -55,6 +55,17 @@ using AbstractListMap = std::unordered_map<abstract::AbstractBasePtrList, PrimAb
                                            abstract::AbstractBasePtrListHasher, abstract::AbstractBasePtrListEqual>;
 using PrimAbsCache = std::unordered_map<AbsCacheKey, AbstractListMap, AbsCacheKeyHasher, AbsCacheKeyEqual>;
 
+// The output abstract of the last call of each primitive instance, which is the call site of the op in python. The
+// call with the same primitive attrs and input abstracts as the last call reuses the output abstract directly,
+// without copying the attrs to build the AbsCacheKey and hashing the input abstracts to look up the PrimAbsCache.
+struct PrimCallSiteInfo {
+  std::weak_ptr<Primitive> prim;
+  mindspore::HashMap<std::string, ValuePtr> prim_attrs;
+  abstract::AbstractBasePtrList input_abs;
+  PrimAbsInfo abs_info;
+};
+using PrimCallSiteCache = mindspore::HashMap<const Primitive *, PrimCallSiteInfo>;
+
 // Used for id
 struct PyObjectHasher {
   size_t operator()(const py::handle &key) const { return py::hash(key); }
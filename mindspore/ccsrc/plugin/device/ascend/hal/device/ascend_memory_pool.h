@@ -18,6 +18,7 @@
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_ASCEND_ASCEND_MEMORY_POOL_H_
 
 #include <memory>
+#include <string>
 #include "common/mem_reuse/mem_dynamic_allocator.h"
 
 namespace mindspore {
@@ -32,6 +33,7 @@ class AscendMemoryPool : public DynamicMemPoolBestFit {
   size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override;
   bool FreeDeviceMem(const DeviceMemPtr &addr) override;
   size_t free_mem_size() override;
+  std::string GetMemPoolName() const override { return "Ascend"; }
   // Set mem pool block size
   void SetMemPoolBlockSize(size_t available_device_mem_size) override;
 
@@ -14,44 +14,139 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <utility>
+#include <vector>
 #include "plugin/device/ascend/optimizer/enhancer/insert_depend_for_all_gather.h"
 #include "include/common/utils/utils.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
+#include "utils/hash_map.h"
+#include "utils/hash_set.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace opt {
+namespace {
+// When the env is set to 1, the all gather of parallel optimizer is launched after the first computation using the
+// previous all gather instead of the previous all gather itself, so the parameters are gathered one fusion group
+// (generally one layer) ahead of the computation in both forward and backward, and only two groups of the
+// gathered parameters are alive at the same time.
+constexpr char kEnvAllGatherPrefetch[] = "MS_DEV_PARALLEL_OPTIMIZER_PREFETCH";
+
+bool IsForwardingNode(const AnfNodePtr &node) {
+  return IsOneOfPrimitiveCNode(node, {prim::kPrimTupleGetItem, prim::kPrimMakeTuple, prim::kPrimDepend,
+                                      prim::kPrimLoad, prim::kPrimCast, prim::kPrimConcat, prim::kPrimTensorMove});
+}
+
+// Get the computation using the output of all gather earliest in the topological order, skipping the nodes which only
+// forward the output.
+AnfNodePtr GetFirstComputeUser(const FuncGraphPtr &graph, const AnfNodePtr &all_gather,
+                               const mindspore::HashMap<AnfNodePtr, size_t> &topo_index) {
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  AnfNodePtr first_user = nullptr;
+  size_t first_index = SIZE_MAX;
+  std::vector<AnfNodePtr> todo = {all_gather};
+  mindspore::HashSet<AnfNodePtr> visited;
+  while (!todo.empty()) {
+    auto node = todo.back();
+    todo.pop_back();
+    if (!visited.insert(node).second) {
+      continue;
+    }
+    for (const auto &user : manager->node_users()[node]) {
+      if (IsPrimitiveCNode(user.first, prim::kPrimUpdateState)) {
+        continue;
+      }
+      if (IsForwardingNode(user.first)) {
+        todo.push_back(user.first);
+        continue;
+      }
+      auto iter = topo_index.find(user.first);
+      if (iter != topo_index.end() && iter->second < first_index) {
+        first_index = iter->second;
+        first_user = user.first;
+      }
+    }
+  }
+  return first_user;
+}
+
+bool InsertAllGatherDepend(const FuncGraphPtr &graph, const std::vector<AnfNodePtr> &all_gathers, bool prefetch,
+                           const mindspore::HashMap<AnfNodePtr, size_t> &topo_index) {
+  bool changed = false;
+  for (size_t i = 1; i < all_gathers.size(); ++i) {
+    auto prior_node = all_gathers[i - 1];
+    auto next_node = all_gathers[i];
+    MS_EXCEPTION_IF_NULL(next_node);
+    if (prefetch) {
+      auto first_user = GetFirstComputeUser(graph, prior_node, topo_index);
+      // Skip the prefetch if the computation of previous group uses the next group, which would make a cycle.
+      if (first_user != nullptr && !IsDepend(*graph, first_user, {next_node})) {
+        prior_node = first_user;
+      }
+    }
+    auto next_cnode = next_node->cast<CNodePtr>();
+    std::vector<AnfNodePtr> inputs = {NewValueNode(std::make_shared<Primitive>(prim::kPrimDepend->name())),
+                                      common::AnfAlgo::GetInputNode(next_cnode, 0), prior_node};
+    auto new_input = graph->NewCNode(inputs);
+    new_input->set_abstract(common::AnfAlgo::GetInputNode(next_cnode, 0)->abstract());
+    common::AnfAlgo::SetNodeInput(next_cnode, new_input, 0);
+    changed = true;
+  }
+  return changed;
+}
+}  // namespace
+
 bool InsertDependForAllGather::Run(const FuncGraphPtr &graph) {
   MS_EXCEPTION_IF_NULL(graph);
-  bool changed = false;
+  bool prefetch = common::GetEnv(kEnvAllGatherPrefetch) == "1";
   std::vector<AnfNodePtr> node_list = TopoSort(graph->get_return());
+  mindspore::HashMap<AnfNodePtr, size_t> topo_index;
   std::map<int64_t, AnfNodePtr> all_gather_node;
-  for (auto &node : node_list) {
+  std::vector<AnfNodePtr> recompute_all_gathers;
+  for (size_t i = 0; i < node_list.size(); ++i) {
+    auto &node = node_list[i];
     MS_EXCEPTION_IF_NULL(node);
+    topo_index[node] = i;
     if (!node->cast<CNodePtr>() || !AnfUtils::IsRealKernel(node)) {
       continue;
     }
     auto cnode = node->cast<CNodePtr>();
     bool is_recompute = cnode->GetAttr(kAttrDuplicated) != nullptr && GetValue<bool>(cnode->GetAttr(kAttrDuplicated));
     if (common::AnfAlgo::GetCNodeName(cnode) == kAllGatherOpName && common::AnfAlgo::HasNodeAttr(kAttrFusion, cnode) &&
-        common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrFusion) > 0 && !is_recompute) {
-      all_gather_node[common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrFusion)] = node;
+        common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrFusion) > 0) {
+      if (!is_recompute) {
+        all_gather_node[common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrFusion)] = node;
+      } else if (prefetch && common::AnfAlgo::IsFromParallelOptimizer(cnode)) {
+        recompute_all_gathers.push_back(node);
+      }
     }
   }
-  auto iter = all_gather_node.begin();
-  for (int64_t i = 0; i < SizeToInt(all_gather_node.size()) - 1; ++i) {
-    auto current_node = iter->second;
-    auto next_node = (++iter)->second;
-    MS_EXCEPTION_IF_NULL(next_node);
-    auto next_cnode = next_node->cast<CNodePtr>();
-    std::vector<AnfNodePtr> inputs = {NewValueNode(std::make_shared<Primitive>(prim::kPrimDepend->name())),
-                                      common::AnfAlgo::GetInputNode(next_cnode, 0), current_node};
-    auto new_input = graph->NewCNode(inputs);
-    new_input->set_abstract(common::AnfAlgo::GetInputNode(next_cnode, 0)->abstract());
-    common::AnfAlgo::SetNodeInput(next_cnode, new_input, 0);
-    changed = true;
+  std::vector<AnfNodePtr> forward_all_gathers;
+  (void)std::transform(all_gather_node.begin(), all_gather_node.end(), std::back_inserter(forward_all_gathers),
+                       [](const std::pair<const int64_t, AnfNodePtr> &item) { return item.second; });
+  bool changed = InsertAllGatherDepend(graph, forward_all_gathers, prefetch, topo_index);
+
+  // The recomputed all gathers in backward are in the reverse order of layers, so sort them by their computation.
+  std::vector<std::pair<size_t, AnfNodePtr>> backward_order;
+  for (const auto &all_gather : recompute_all_gathers) {
+    auto first_user = GetFirstComputeUser(graph, all_gather, topo_index);
+    if (first_user != nullptr) {
+      (void)backward_order.emplace_back(topo_index[first_user], all_gather);
+    }
   }
+  std::sort(backward_order.begin(), backward_order.end(),
+            [](const std::pair<size_t, AnfNodePtr> &a, const std::pair<size_t, AnfNodePtr> &b) {
+              return a.first < b.first;
+            });
+  std::vector<AnfNodePtr> backward_all_gathers;
+  (void)std::transform(backward_order.begin(), backward_order.end(), std::back_inserter(backward_all_gathers),
+                       [](const std::pair<size_t, AnfNodePtr> &item) { return item.second; });
+  changed = InsertAllGatherDepend(graph, backward_all_gathers, prefetch, topo_index) || changed;
   return changed;
 }
 }  // namespace opt
@@ -23,6 +23,7 @@
 #endif
 #include "plugin/factory/ms_factory.h"
 #include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
 #include "kernel/kernel_build_info.h"
 #include "plugin/device/cpu/hal/device/kernel_select_cpu.h"
 #include "utils/trace_base.h"
@@ -33,6 +34,7 @@
 #include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
 #include "plugin/device/cpu/optimizer/insert_cast_cpu.h"
 #include "plugin/device/cpu/optimizer/insert_format_transform_op.h"
+#include "plugin/device/cpu/optimizer/conv_relu_fusion_cpu.h"
 #include "backend/common/pass/communication_op_fusion.h"
 #include "backend/common/pass/replace_node_by_proxy.h"
 #include "backend/common/pass/erase_visit_attr.h"
@@ -72,7 +74,11 @@ void CPUDeviceContext::Initialize() {
   initialized_ = true;
 }
 
-void CPUDeviceContext::Destroy() { device_res_manager_->Destroy(); }
+void CPUDeviceContext::Destroy() {
+  // Save the parallel search results of this running for the later running.
+  kernel::ParallelSearchCache::GetInstance().Save();
+  device_res_manager_->Destroy();
+}
 
 void CPUDeviceResManager::Initialize() {
   mem_manager_ = std::make_shared<CPUMemoryManager>();
@@ -165,6 +171,7 @@ void CPUKernelExecutor::OptimizeGraphImpl(const KernelGraphPtr &graph) const {
   auto pm = std::make_shared<opt::PassManager>();
   pm->AddPass(std::make_shared<opt::InsertFormatTransformOpCPU>("insert_format_transform_op_cpu"));
   pm->AddPass(std::make_shared<opt::AllReduceFusion>());
+  pm->AddPass(std::make_shared<opt::ConvReluFusionCPU>());
   pm->AddPass(std::make_shared<opt::InsertCastCPU>("insert_cast"));
   pm->AddPass(std::make_shared<opt::EraseVisitAttr>());
   optimizer->AddPassManager(pm);
@@ -356,6 +363,10 @@ bool CPUKernelExecutor::LaunchKernel(const CNodePtr &kernel, const std::vector<A
     return LaunchKernelWithProfiling(kernel, inputs, workspace, outputs);
   }
 #endif
+  if (kernel::ParallelSearchCache::GetInstance().enable()) {
+    kernel::LaunchingKernelGuard launching_kernel_guard(&kernel);
+    return DoLaunchKernel(kernel_mod, inputs, workspace, outputs);
+  }
   return DoLaunchKernel(kernel_mod, inputs, workspace, outputs);
 }
 
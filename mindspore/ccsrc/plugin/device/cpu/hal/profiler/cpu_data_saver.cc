@@ -25,6 +25,11 @@
 namespace mindspore {
 namespace profiler {
 namespace cpu {
+namespace {
+// Write the op timestamps in the chrome trace event format as well when the env is set to 1.
+constexpr char kChromeTraceEnv[] = "MS_PROFILER_CHROME_TRACE";
+}  // namespace
+
 std::shared_ptr<CpuDataSaver> CpuDataSaver::cpu_data_saver_inst_ = std::make_shared<CpuDataSaver>();
 
 void CpuDataSaver::WriteFile(const std::string out_path_dir) {
@@ -58,6 +63,9 @@ void CpuDataSaver::WriteFile(const std::string out_path_dir) {
   op_side_ = "cpu";
   WriteOpDetail(out_path_dir);
   WriteOpType(out_path_dir);
+  if (common::GetEnv(kChromeTraceEnv) == "1") {
+    WriteChromeTrace(out_path_dir);
+  }
   WriteOpTimestamp(out_path_dir);
 }
 
@@ -88,6 +96,38 @@ void CpuDataSaver::WriteFrameWork(const std::string &base_dir, const std::vector
   ChangeFileMode(file_path);
   MS_LOG(INFO) << "Write framework infos into file: " << file_path;
 }
+void CpuDataSaver::WriteChromeTrace(const std::string &base_dir) {
+  std::string file_path = base_dir + "/cpu_op_trace_" + device_id_ + ".json";
+  std::ofstream ofs(file_path);
+  if (!ofs.is_open()) {
+    MS_LOG(WARNING) << "Open file '" << file_path << "' failed!";
+    return;
+  }
+  // The trace event format of chrome://tracing, the timestamp and duration are in units of microsecond.
+  constexpr double kNsToUs = 1e-3;
+  constexpr double kMsToUs = 1e3;
+  size_t event_num = 0;
+  try {
+    ofs << std::fixed << "{\"traceEvents\":[";
+    for (const auto &op_timestamp_info : op_timestamps_map_) {
+      for (const auto &start_end : op_timestamp_info.second) {
+        if (event_num++ != 0) {
+          ofs << ",";
+        }
+        ofs << "\n{\"name\":\"" << op_timestamp_info.first << "\",\"ph\":\"X\",\"pid\":" << device_id_
+            << ",\"tid\":" << start_end.tid << ",\"ts\":" << start_end.start_timestamp * kNsToUs
+            << ",\"dur\":" << start_end.duration * kMsToUs << "}";
+      }
+    }
+    ofs << "\n]}" << std::endl;
+  } catch (const std::exception &e) {
+    MS_LOG(ERROR) << "Write " << file_path << "failed: " << e.what();
+  }
+  ofs.close();
+  ChangeFileMode(file_path);
+  MS_LOG(INFO) << "Write " << event_num << " op trace events into file: " << file_path;
+}
+
 OpTimestampInfo &CpuDataSaver::GetOpTimeStampInfo() { return op_timestamps_map_; }
 
 std::shared_ptr<CpuDataSaver> &CpuDataSaver::GetInstance() { return cpu_data_saver_inst_; }
@@ -45,6 +45,9 @@ class CpuDataSaver : public DataSaver {
 
   void WriteFrameWork(const std::string &base_dir, const std::vector<CurKernelInfo> &all_kernel_info_);
 
+  // Write the op timestamps to a json file which can be loaded by chrome://tracing.
+  void WriteChromeTrace(const std::string &base_dir);
+
  private:
   static std::shared_ptr<CpuDataSaver> cpu_data_saver_inst_;
 };
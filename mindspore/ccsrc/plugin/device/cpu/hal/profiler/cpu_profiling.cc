@@ -25,6 +25,28 @@ namespace profiler {
 namespace cpu {
 namespace {
 PROFILER_REG(kCPUDevice, CPUProfiler);
+
+// Look up the actor worker id of the current thread. The id of a worker thread never changes once it is registered,
+// so it is cached per thread to keep the map lookup out of the per-op hot path.
+bool GetCurrentWorkerId(size_t *worker_id) {
+  thread_local bool cached = false;
+  thread_local size_t cached_worker_id = 0;
+  if (!cached) {
+    auto actor_manager = ActorMgr::GetActorMgrRef();
+    MS_EXCEPTION_IF_NULL(actor_manager);
+    auto thread_pool = actor_manager->GetActorThreadPool();
+    MS_EXCEPTION_IF_NULL(thread_pool);
+    const auto &worker_ids_map = thread_pool->GetWorkerIdMap();
+    auto id_iter = worker_ids_map.find(std::this_thread::get_id());
+    if (id_iter == worker_ids_map.end()) {
+      return false;
+    }
+    cached_worker_id = id_iter->second;
+    cached = true;
+  }
+  *worker_id = cached_worker_id;
+  return true;
+}
 }  // namespace
 std::shared_ptr<CPUProfiler> CPUProfiler::GetInstance() {
   auto instance = Profiler::GetInstance(kCPUDevice);
@@ -65,38 +87,28 @@ void CPUProfiler::SetRunTimeData(const std::string &op_name, const uint32_t pid,
   op_info_map_[op_name] = op_info;
 }
 
-void CPUProfiler::SetRuntimeStart(const std::string op_name, const uint64_t start_timestamp) {
+void CPUProfiler::SetRuntimeStart(const std::string &op_name, const uint64_t start_timestamp) {
   std::shared_lock<std::shared_mutex> lock(op_map_mutex_);
   auto iter = op_info_map_.find(op_name);
   if (iter != op_info_map_.end()) {
     iter->second.tmp_start_duration.start_timestamp = start_timestamp;
-    auto actor_manager = ActorMgr::GetActorMgrRef();
-    MS_EXCEPTION_IF_NULL(actor_manager);
-    auto thread_pool = actor_manager->GetActorThreadPool();
-    auto worker_ids_map = thread_pool->GetWorkerIdMap();
-    auto id_iter = worker_ids_map.find(std::this_thread::get_id());
-    if (id_iter != worker_ids_map.end()) {
-      iter->second.tmp_start_duration.tid = id_iter->second;
+    size_t worker_id = 0;
+    if (GetCurrentWorkerId(&worker_id)) {
+      iter->second.tmp_start_duration.tid = worker_id;
     }
   }
 }
 
-float CPUProfiler::SetRuntimeEnd(const std::string op_name, const uint64_t stop_timestamp) {
+float CPUProfiler::SetRuntimeEnd(const std::string &op_name, const uint64_t stop_timestamp) {
   float op_time_elapsed = 0;
   std::shared_lock<std::shared_mutex> lock(op_map_mutex_);
   auto iter = op_info_map_.find(op_name);
   if (iter != op_info_map_.end()) {
     iter->second.tmp_start_duration.duration =
       (stop_timestamp - iter->second.tmp_start_duration.start_timestamp) / kNanosecondToMillisecond;
-    auto actor_manager = ActorMgr::GetActorMgrRef();
-    MS_EXCEPTION_IF_NULL(actor_manager);
-    auto thread_pool = actor_manager->GetActorThreadPool();
-    auto worker_ids_map = thread_pool->GetWorkerIdMap();
-    auto id_iter = worker_ids_map.find(std::this_thread::get_id());
-    if (id_iter != worker_ids_map.end()) {
-      if (iter->second.tmp_start_duration.tid != id_iter->second) {
-        MS_LOG(EXCEPTION) << "Op " << op_name << " start time thread id must be equal to end thread id.";
-      }
+    size_t worker_id = 0;
+    if (GetCurrentWorkerId(&worker_id) && iter->second.tmp_start_duration.tid != worker_id) {
+      MS_LOG(EXCEPTION) << "Op " << op_name << " start time thread id must be equal to end thread id.";
     }
     (void)iter->second.start_duration.emplace_back(iter->second.tmp_start_duration);
     op_time_elapsed = iter->second.tmp_start_duration.duration;
@@ -60,8 +60,8 @@ class CPUProfiler : public Profiler {
   void OpDataProducerEnd() override;
   void OpDataProducerEndParallel(const std::string op_name);
   void OpDataProducerBeginParallel(const std::string op_name, const uint32_t pid);
-  float SetRuntimeEnd(const std::string op_name, const uint64_t stop_timestamp);
-  void SetRuntimeStart(const std::string op_name, const uint64_t start_timestamp);
+  float SetRuntimeEnd(const std::string &op_name, const uint64_t stop_timestamp);
+  void SetRuntimeStart(const std::string &op_name, const uint64_t start_timestamp);
   void RecordFrameWorkInfo(const CNodePtr &kernel);
   std::vector<CurKernelInfo> all_kernel_info_;
   std::mutex kernel_mutex_;
@@ -24,6 +24,8 @@
 #include <numeric>
 #include "kernel/oplib/oplib.h"
 #include "utils/profile.h"
+#include "utils/ms_utils.h"
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "kernel/common_utils.h"
 
@@ -264,6 +266,8 @@ ActorThreadPool *GetActorMgrInnerThreadPool() {
     MS_EXCEPTION_IF_NULL(thread_pool);
   }
   thread_pool->SetKernelThreadMaxSpinCount(kDefaultKernelSpinCount);
+  static const bool kernel_task_steal = common::GetEnv("MS_DEV_CPU_KERNEL_TASK_STEAL") == "1";
+  thread_pool->SetKernelTaskSteal(kernel_task_steal);
   return thread_pool;
 }
 
@@ -323,6 +327,8 @@ void ParallelLaunch(const std::vector<common::Task> &tasks, Content content, Thr
 
 void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
                               ParallelSearchInfo *parallel_search_info, ThreadPool *pool) {
+  const size_t AVG_COUNT = 5;
+  auto &search_cache = ParallelSearchCache::GetInstance();
   if (!parallel_search_info->kernel_thread_num_set) {
     auto thread_pool = pool == nullptr ? GetActorMgrInnerThreadPool() : pool;
     size_t kernel_thread_num = thread_pool->GetKernelThreadNum();
@@ -335,8 +341,15 @@ void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
     }
     parallel_search_info->max_pow = max_pow_current + 1;
     parallel_search_info->kernel_thread_num_set = true;
+    // Warm start from the result searched by the previous running.
+    size_t best_pow = 0;
+    if (search_cache.enable() && search_cache.Get(search_cache.GenerateKey(count, kernel_thread_num), &best_pow) &&
+        best_pow < parallel_search_info->max_pow) {
+      parallel_search_info->best_pow = best_pow;
+      parallel_search_info->best_block_size = static_cast<float>(count) / std::pow(2.0f, best_pow);
+      parallel_search_info->search_count = AVG_COUNT * parallel_search_info->max_pow;
+    }
   }
-  const size_t AVG_COUNT = 5;
   size_t current_pow = parallel_search_info->search_count / AVG_COUNT;
   if (current_pow < parallel_search_info->max_pow) {
     if (parallel_search_info->search_count % AVG_COUNT == 0) {
@@ -357,6 +370,11 @@ void ParallelLaunchAutoSearch(const CTask &task, size_t count, Content content,
       } else if (current_pow - parallel_search_info->best_pow >= 2) {
         parallel_search_info->search_count = AVG_COUNT * parallel_search_info->max_pow;
       }
+      if (search_cache.enable() && parallel_search_info->search_count >= AVG_COUNT * parallel_search_info->max_pow) {
+        auto thread_pool = pool == nullptr ? GetActorMgrInnerThreadPool() : pool;
+        search_cache.Put(search_cache.GenerateKey(count, thread_pool->GetKernelThreadNum()),
+                         parallel_search_info->best_pow);
+      }
     }
   } else {
     ParallelLaunch(task, count, parallel_search_info->best_block_size, content, pool);
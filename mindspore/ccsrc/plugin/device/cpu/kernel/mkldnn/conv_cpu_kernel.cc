@@ -87,7 +87,18 @@ void ConvCpuKernelMod::InitKernel(const CNodePtr &kernel_node) {
   const auto desc = CreateDesc<dnnl::convolution_forward::desc>(
     dnnl::prop_kind::forward_training, dnnl::algorithm::convolution_auto, src_desc, weights_desc, dst_desc, strides,
     dilates, padding_l, padding_r);
-  const auto prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(desc, engine_);
+  // The activation fused by the graph optimizer is applied by the post-op.
+  dnnl::primitive_attr prim_attr;
+  if (common::AnfAlgo::HasNodeAttr(kAttrFusedActivation, kernel_node)) {
+    const auto activation = common::AnfAlgo::GetNodeAttr<std::string>(kernel_node, kAttrFusedActivation);
+    if (activation != kReluOpName) {
+      MS_LOG(EXCEPTION) << kernel_name_ << " does not support the fused activation " << activation;
+    }
+    dnnl::post_ops post_ops;
+    post_ops.append_eltwise(1.0f, dnnl::algorithm::eltwise_relu, 0.0f, 0.0f);
+    prim_attr.set_post_ops(post_ops);
+  }
+  const auto prim_desc = CreateDesc<dnnl::convolution_forward::primitive_desc>(desc, prim_attr, engine_);
   primitive_ = CreatePrimitive<dnnl::convolution_forward>(prim_desc);
   AddArgument(DNNL_ARG_SRC, src_desc);
   AddArgument(DNNL_ARG_WEIGHTS, weights_desc);
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/moe_combine_cpu_kernel.h"
+#include <algorithm>
+#include "mindspore/core/ops/moe_combine.h"
+#include "plugin/device/cpu/hal/device/cpu_device_address.h"
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kMoeCombineInputsNum = 3;
+constexpr size_t kMoeCombineOutputsNum = 1;
+}  // namespace
+
+template <typename T>
+bool MoeCombineCpuKernelMod::LaunchKernel(const std::vector<kernel::AddressPtr> &inputs,
+                                          const std::vector<AddressPtr> &,
+                                          const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMoeCombineInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMoeCombineOutputsNum, kernel_name_);
+  const auto *expert_output = reinterpret_cast<T *>(inputs[kIndex0]->addr);
+  const auto *combine_weights = reinterpret_cast<float *>(inputs[kIndex1]->addr);
+  const auto *dispatch_index = reinterpret_cast<int32_t *>(inputs[kIndex2]->addr);
+  auto *y = reinterpret_cast<T *>(outputs[kIndex0]->addr);
+  auto top_k = top_k_;
+  auto hidden = hidden_;
+  auto slots = slots_;
+  auto task = [expert_output, combine_weights, dispatch_index, y, top_k, hidden, slots](size_t start, size_t end) {
+    for (size_t t = start; t < end; ++t) {
+      T *out = y + t * hidden;
+      std::fill(out, out + hidden, static_cast<T>(0));
+      for (size_t j = 0; j < top_k; ++j) {
+        auto index = dispatch_index[t * top_k + j];
+        if (index < 0 || IntToSize(index) >= slots) {
+          continue;
+        }
+        auto weight = static_cast<T>(combine_weights[t * top_k + j]);
+        const T *slot = expert_output + IntToSize(index) * hidden;
+        for (size_t h = 0; h < hidden; ++h) {
+          out[h] += weight * slot[h];
+        }
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(task, tokens_, this, &parallel_search_info_);
+  return true;
+}
+
+const std::vector<std::pair<KernelAttr, MoeCombineCpuKernelMod::KernelRunFunc>> &MoeCombineCpuKernelMod::GetFuncList()
+  const {
+  static const std::vector<std::pair<KernelAttr, MoeCombineCpuKernelMod::KernelRunFunc>> func_list = {
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeFloat32),
+     &MoeCombineCpuKernelMod::LaunchKernel<float>},
+  };
+  return func_list;
+}
+
+bool MoeCombineCpuKernelMod::Init(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+                                  const std::vector<KernelTensorPtr> &outputs) {
+  auto kernel_ptr = std::dynamic_pointer_cast<ops::MoeCombine>(base_operator);
+  MS_ERROR_IF_NULL_W_RET_VAL(kernel_ptr, false);
+  kernel_name_ = kernel_ptr->name();
+  if (inputs.size() != kMoeCombineInputsNum || outputs.size() != kMoeCombineOutputsNum) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', input and output size must be " << kMoeCombineInputsNum << " and "
+                  << kMoeCombineOutputsNum << ", but got " << inputs.size() << " and " << outputs.size();
+    return false;
+  }
+  return MatchKernelFunc(base_operator, inputs, outputs);
+}
+
+int MoeCombineCpuKernelMod::Resize(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+                                   const std::vector<KernelTensorPtr> &outputs,
+                                   const std::map<uint32_t, tensor::TensorPtr> &) {
+  int ret = KernelMod::Resize(base_operator, inputs, outputs);
+  if (ret != KRET_OK) {
+    return ret;
+  }
+  auto expert_shape = inputs[kIndex0]->GetShapeVector();
+  auto weights_shape = inputs[kIndex1]->GetShapeVector();
+  if (expert_shape.size() != kDim3 || weights_shape.size() != kDim2) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the rank of expert_output and combine_weights must be 3 and 2, "
+                  << "but got " << expert_shape.size() << " and " << weights_shape.size();
+    return KRET_RESIZE_FAILED;
+  }
+  slots_ = LongToSize(expert_shape[kIndex0] * expert_shape[kIndex1]);
+  hidden_ = LongToSize(expert_shape[kIndex2]);
+  tokens_ = LongToSize(weights_shape[kIndex0]);
+  top_k_ = LongToSize(weights_shape[kIndex1]);
+  return KRET_OK;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, MoeCombine, MoeCombineCpuKernelMod);
+}  // namespace mindspore::kernel
@@ -0,0 +1,171 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/moe_dispatch_cpu_kernel.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "mindspore/core/ops/moe_dispatch.h"
+#include "plugin/device/cpu/hal/device/cpu_device_address.h"
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kMoeDispatchInputsNum = 2;
+constexpr size_t kMoeDispatchOutputsNum = 3;
+constexpr size_t kMoeDispatchWorkspaceNum = 2;
+}  // namespace
+
+template <typename T>
+bool MoeDispatchCpuKernelMod::LaunchKernel(const std::vector<kernel::AddressPtr> &inputs,
+                                           const std::vector<AddressPtr> &workspace,
+                                           const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMoeDispatchInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMoeDispatchOutputsNum, kernel_name_);
+  CHECK_KERNEL_WORKSPACE_SIZE(workspace.size(), kMoeDispatchWorkspaceNum, kernel_name_);
+  const auto *x = reinterpret_cast<T *>(inputs[kIndex0]->addr);
+  const auto *gate_logits = reinterpret_cast<T *>(inputs[kIndex1]->addr);
+  auto *dispatched = reinterpret_cast<T *>(outputs[kIndex0]->addr);
+  auto *combine_weights = reinterpret_cast<float *>(outputs[kIndex1]->addr);
+  auto *dispatch_index = reinterpret_cast<int32_t *>(outputs[kIndex2]->addr);
+  auto *selected_experts = reinterpret_cast<size_t *>(workspace[kIndex0]->addr);
+  auto *selected_probs = reinterpret_cast<float *>(workspace[kIndex1]->addr);
+  if (tokens_ == 0 || experts_ == 0) {
+    return true;
+  }
+
+  // Select the top_k experts of each token by the softmax of the gate logits, the smaller expert wins the tie.
+  auto top_k = top_k_;
+  auto experts = experts_;
+  auto route_task = [gate_logits, selected_experts, selected_probs, top_k, experts](size_t start, size_t end) {
+    std::vector<float> probs(experts);
+    std::vector<size_t> order(experts);
+    for (size_t t = start; t < end; ++t) {
+      const T *logits = gate_logits + t * experts;
+      float max_logit = static_cast<float>(*std::max_element(logits, logits + experts));
+      float sum = 0;
+      for (size_t e = 0; e < experts; ++e) {
+        probs[e] = std::exp(static_cast<float>(logits[e]) - max_logit);
+        sum += probs[e];
+      }
+      std::iota(order.begin(), order.end(), 0);
+      auto greater = [&probs](size_t a, size_t b) { return probs[a] > probs[b] || (probs[a] == probs[b] && a < b); };
+      std::partial_sort(order.begin(), order.begin() + top_k, order.end(), greater);
+      for (size_t j = 0; j < top_k; ++j) {
+        selected_experts[t * top_k + j] = order[j];
+        selected_probs[t * top_k + j] = probs[order[j]] / sum;
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(route_task, tokens_, this, &parallel_search_info_);
+
+  // Assign the slots serially, the higher choices of all tokens go first and the earlier tokens win in each choice.
+  std::vector<size_t> counts(experts_, 0);
+  for (size_t j = 0; j < top_k_; ++j) {
+    for (size_t t = 0; t < tokens_; ++t) {
+      auto pos = t * top_k_ + j;
+      auto expert = selected_experts[pos];
+      if (counts[expert] < capacity_) {
+        dispatch_index[pos] = SizeToInt(expert * capacity_ + counts[expert]);
+        combine_weights[pos] = selected_probs[pos];
+        ++counts[expert];
+      } else {
+        dispatch_index[pos] = -1;
+        combine_weights[pos] = 0;
+      }
+    }
+  }
+
+  // Each slot is filled by one choice at most, so the copies do not race.
+  auto hidden = hidden_;
+  auto capacity = capacity_;
+  auto fill_task = [dispatched, hidden, capacity, &counts](size_t start, size_t end) {
+    for (size_t expert = start; expert < end; ++expert) {
+      T *slot = dispatched + (expert * capacity + counts[expert]) * hidden;
+      std::fill(slot, slot + (capacity - counts[expert]) * hidden, static_cast<T>(0));
+    }
+  };
+  ParallelLaunchAutoSearch(fill_task, experts_, this, &parallel_search_info_);
+  auto copy_task = [x, dispatched, dispatch_index, hidden, top_k](size_t start, size_t end) {
+    for (size_t pos = start; pos < end; ++pos) {
+      if (dispatch_index[pos] < 0) {
+        continue;
+      }
+      const T *token = x + (pos / top_k) * hidden;
+      std::copy(token, token + hidden, dispatched + IntToSize(dispatch_index[pos]) * hidden);
+    }
+  };
+  ParallelLaunchAutoSearch(copy_task, tokens_ * top_k_, this, &parallel_search_info_);
+  return true;
+}
+
+const std::vector<std::pair<KernelAttr, MoeDispatchCpuKernelMod::KernelRunFunc>> &MoeDispatchCpuKernelMod::GetFuncList()
+  const {
+  static const std::vector<std::pair<KernelAttr, MoeDispatchCpuKernelMod::KernelRunFunc>> func_list = {
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddOutputAttr(kNumberTypeFloat32)
+       .AddOutputAttr(kNumberTypeFloat32)
+       .AddOutputAttr(kNumberTypeInt32),
+     &MoeDispatchCpuKernelMod::LaunchKernel<float>},
+  };
+  return func_list;
+}
+
+bool MoeDispatchCpuKernelMod::Init(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+                                   const std::vector<KernelTensorPtr> &outputs) {
+  auto kernel_ptr = std::dynamic_pointer_cast<ops::MoeDispatch>(base_operator);
+  MS_ERROR_IF_NULL_W_RET_VAL(kernel_ptr, false);
+  kernel_name_ = kernel_ptr->name();
+  if (inputs.size() != kMoeDispatchInputsNum || outputs.size() != kMoeDispatchOutputsNum) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', input and output size must be " << kMoeDispatchInputsNum << " and "
+                  << kMoeDispatchOutputsNum << ", but got " << inputs.size() << " and " << outputs.size();
+    return false;
+  }
+  top_k_ = LongToSize(kernel_ptr->get_top_k());
+  return MatchKernelFunc(base_operator, inputs, outputs);
+}
+
+int MoeDispatchCpuKernelMod::Resize(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+                                    const std::vector<KernelTensorPtr> &outputs,
+                                    const std::map<uint32_t, tensor::TensorPtr> &) {
+  int ret = KernelMod::Resize(base_operator, inputs, outputs);
+  if (ret != KRET_OK) {
+    return ret;
+  }
+  auto x_shape = inputs[kIndex0]->GetShapeVector();
+  auto gate_shape = inputs[kIndex1]->GetShapeVector();
+  auto dispatched_shape = outputs[kIndex0]->GetShapeVector();
+  if (x_shape.size() != kDim2 || gate_shape.size() != kDim2 || dispatched_shape.size() != kDim3) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the rank of x, gate_logits and dispatched must be 2, 2 and 3, but "
+                  << "got " << x_shape.size() << ", " << gate_shape.size() << " and " << dispatched_shape.size();
+    return KRET_RESIZE_FAILED;
+  }
+  tokens_ = LongToSize(x_shape[kIndex0]);
+  hidden_ = LongToSize(x_shape[kIndex1]);
+  experts_ = LongToSize(gate_shape[kIndex1]);
+  capacity_ = LongToSize(dispatched_shape[kIndex1]);
+  if (top_k_ == 0 || top_k_ > experts_) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', the top_k must be in [1, " << experts_ << "], but got " << top_k_;
+    return KRET_RESIZE_FAILED;
+  }
+  workspace_size_list_.push_back(tokens_ * top_k_ * sizeof(size_t));
+  workspace_size_list_.push_back(tokens_ * top_k_ * sizeof(float));
+  return KRET_OK;
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, MoeDispatch, MoeDispatchCpuKernelMod);
+}  // namespace mindspore::kernel
@@ -0,0 +1,152 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/multi_table_embedding_lookup_cpu_kernel.h"
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include "mindspore/core/ops/multi_table_embedding_lookup.h"
+#include "plugin/device/cpu/hal/device/cpu_device_address.h"
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kMultiTableEmbeddingLookupInputsNum = 3;
+constexpr size_t kMultiTableEmbeddingLookupOutputsNum = 1;
+}  // namespace
+
+int InitMultiTableEmbeddingLayout(const std::string &kernel_name, const std::string &combiner,
+                                  const ShapeVector &params_shape, const ShapeVector &ids_shape,
+                                  MultiTableEmbeddingLayout *layout) {
+  MS_EXCEPTION_IF_NULL(layout);
+  layout->pooling_ = combiner != ops::kNone;
+  layout->mean_ = combiner == ops::kMean;
+  if (params_shape.size() != kDim2 || ids_shape.size() < (layout->pooling_ ? kDim2 : kDim1)) {
+    MS_LOG(ERROR) << "For '" << kernel_name << "', the rank of params must be 2 and the rank of ids must be at least "
+                  << (layout->pooling_ ? kDim2 : kDim1) << ", but got " << params_shape.size() << " and "
+                  << ids_shape.size();
+    return KRET_RESIZE_FAILED;
+  }
+  layout->rows_ = LongToSize(params_shape[0]);
+  layout->dim_ = LongToSize(params_shape[1]);
+  layout->table_num_ = LongToSize(ids_shape[0]);
+  auto ids_num =
+    LongToSize(std::accumulate(ids_shape.begin(), ids_shape.end(), int64_t(1), std::multiplies<int64_t>()));
+  layout->ids_per_table_ = layout->table_num_ == 0 ? 0 : ids_num / layout->table_num_;
+  layout->bag_size_ = layout->pooling_ ? LongToSize(ids_shape.back()) : 1;
+  return KRET_OK;
+}
+
+template <typename T, typename S>
+bool MultiTableEmbeddingLookupCpuKernelMod::LaunchKernel(const std::vector<kernel::AddressPtr> &inputs,
+                                                         const std::vector<AddressPtr> &,
+                                                         const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMultiTableEmbeddingLookupInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMultiTableEmbeddingLookupOutputsNum, kernel_name_);
+  const auto *params = reinterpret_cast<T *>(inputs[kIndex0]->addr);
+  const auto *ids = reinterpret_cast<S *>(inputs[kIndex1]->addr);
+  const auto *offsets = reinterpret_cast<S *>(inputs[kIndex2]->addr);
+  auto *output = reinterpret_cast<T *>(outputs[kIndex0]->addr);
+  MS_ERROR_IF_NULL_W_RET_VAL(params, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(ids, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(offsets, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(output, false);
+  if (layout_.bag_size_ == 0 || layout_.ids_per_table_ == 0) {
+    return true;
+  }
+
+  const auto layout = layout_;
+  const size_t bags_per_table = layout.ids_per_table_ / layout.bag_size_;
+  const size_t bag_num = bags_per_table * layout.table_num_;
+  // Each task owns the output rows of bags [start, end), so the tables are looked up in one launch without races.
+  auto task = [params, ids, offsets, output, layout, bags_per_table](size_t start, size_t end) {
+    for (size_t bag = start; bag < end; ++bag) {
+      auto offset = static_cast<int64_t>(offsets[bag / bags_per_table]);
+      T *out = output + bag * layout.dim_;
+      std::fill(out, out + layout.dim_, static_cast<T>(0));
+      size_t valid_num = 0;
+      for (size_t i = bag * layout.bag_size_; i < (bag + 1) * layout.bag_size_; ++i) {
+        auto id = static_cast<int64_t>(ids[i]);
+        auto row = id + offset;
+        if (id < 0 || row < 0 || row >= SizeToLong(layout.rows_)) {
+          continue;
+        }
+        const T *in = params + LongToSize(row) * layout.dim_;
+        for (size_t d = 0; d < layout.dim_; ++d) {
+          out[d] += in[d];
+        }
+        ++valid_num;
+      }
+      if (layout.mean_ && valid_num > 1) {
+        auto scale = static_cast<T>(1.0 / valid_num);
+        for (size_t d = 0; d < layout.dim_; ++d) {
+          out[d] *= scale;
+        }
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(task, bag_num, this, &parallel_search_info_);
+  return true;
+}
+
+const std::vector<std::pair<KernelAttr, MultiTableEmbeddingLookupCpuKernelMod::KernelRunFunc>>
+  &MultiTableEmbeddingLookupCpuKernelMod::GetFuncList() const {
+  static const std::vector<std::pair<KernelAttr, MultiTableEmbeddingLookupCpuKernelMod::KernelRunFunc>> func_list = {
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kNumberTypeInt32)
+       .AddInputAttr(kNumberTypeInt32)
+       .AddOutputAttr(kNumberTypeFloat32),
+     &MultiTableEmbeddingLookupCpuKernelMod::LaunchKernel<float, int32_t>},
+    {KernelAttr()
+       .AddInputAttr(kNumberTypeFloat32)
+       .AddInputAttr(kNumberTypeInt64)
+       .AddInputAttr(kNumberTypeInt64)
+       .AddOutputAttr(kNumberTypeFloat32),
+     &MultiTableEmbeddingLookupCpuKernelMod::LaunchKernel<float, int64_t>},
+  };
+  return func_list;
+}
+
+bool MultiTableEmbeddingLookupCpuKernelMod::Init(const BaseOperatorPtr &base_operator,
+                                                 const std::vector<KernelTensorPtr> &inputs,
+                                                 const std::vector<KernelTensorPtr> &outputs) {
+  auto kernel_ptr = std::dynamic_pointer_cast<ops::MultiTableEmbeddingLookup>(base_operator);
+  MS_ERROR_IF_NULL_W_RET_VAL(kernel_ptr, false);
+  kernel_name_ = kernel_ptr->name();
+  if (inputs.size() != kMultiTableEmbeddingLookupInputsNum || outputs.size() != kMultiTableEmbeddingLookupOutputsNum) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', input and output size must be "
+                  << kMultiTableEmbeddingLookupInputsNum << " and " << kMultiTableEmbeddingLookupOutputsNum
+                  << ", but got " << inputs.size() << " and " << outputs.size();
+    return false;
+  }
+  combiner_ = kernel_ptr->get_combiner();
+  return MatchKernelFunc(base_operator, inputs, outputs);
+}
+
+int MultiTableEmbeddingLookupCpuKernelMod::Resize(const BaseOperatorPtr &base_operator,
+                                                  const std::vector<KernelTensorPtr> &inputs,
+                                                  const std::vector<KernelTensorPtr> &outputs,
+                                                  const std::map<uint32_t, tensor::TensorPtr> &) {
+  int ret = KernelMod::Resize(base_operator, inputs, outputs);
+  if (ret != KRET_OK) {
+    return ret;
+  }
+  return InitMultiTableEmbeddingLayout(kernel_name_, combiner_, inputs[kIndex0]->GetShapeVector(),
+                                       inputs[kIndex1]->GetShapeVector(), &layout_);
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, MultiTableEmbeddingLookup, MultiTableEmbeddingLookupCpuKernelMod);
+}  // namespace mindspore::kernel
@@ -0,0 +1,76 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TABLE_EMBEDDING_LOOKUP_CPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TABLE_EMBEDDING_LOOKUP_CPU_KERNEL_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "plugin/device/cpu/kernel/cpu_kernel.h"
+#include "plugin/factory/ms_factory.h"
+
+namespace mindspore::kernel {
+// The layout shared by the lookup and its grad: the ids of each table are ids[t], which is viewed as
+// [bag_num, bag_size], the bag_size is the size of the last axis when pooling and 1 otherwise.
+struct MultiTableEmbeddingLayout {
+  size_t rows_{0};
+  size_t dim_{0};
+  size_t table_num_{0};
+  size_t ids_per_table_{0};
+  size_t bag_size_{1};
+  bool pooling_{false};
+  bool mean_{false};
+};
+
+class MultiTableEmbeddingLookupCpuKernelMod : public NativeCpuKernelMod,
+                                              public MatchKernelHelper<MultiTableEmbeddingLookupCpuKernelMod> {
+ public:
+  MultiTableEmbeddingLookupCpuKernelMod() = default;
+  ~MultiTableEmbeddingLookupCpuKernelMod() override = default;
+
+  bool Init(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+            const std::vector<KernelTensorPtr> &outputs) override;
+
+  int Resize(const BaseOperatorPtr &base_operator, const std::vector<KernelTensorPtr> &inputs,
+             const std::vector<KernelTensorPtr> &outputs, const std::map<uint32_t, tensor::TensorPtr> &) override;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs) override {
+    return kernel_func_(this, inputs, workspace, outputs);
+  }
+
+  const std::vector<std::pair<KernelAttr, KernelRunFunc>> &GetFuncList() const override;
+
+  std::vector<KernelAttr> GetOpSupport() override { return OpSupport(); }
+
+ private:
+  template <typename T, typename S>
+  bool LaunchKernel(const std::vector<kernel::AddressPtr> &inputs, const std::vector<AddressPtr> &,
+                    const std::vector<kernel::AddressPtr> &outputs);
+
+  std::string combiner_;
+  MultiTableEmbeddingLayout layout_;
+};
+
+// Fill the layout by the shapes of params and ids, return KRET_OK or KRET_RESIZE_FAILED.
+int InitMultiTableEmbeddingLayout(const std::string &kernel_name, const std::string &combiner,
+                                  const ShapeVector &params_shape, const ShapeVector &ids_shape,
+                                  MultiTableEmbeddingLayout *layout);
+}  // namespace mindspore::kernel
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_MULTI_TABLE_EMBEDDING_LOOKUP_CPU_KERNEL_H_
@@ -0,0 +1,132 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/multi_table_embedding_lookup_grad_cpu_kernel.h"
+#include <algorithm>
+#include "mindspore/core/ops/grad/multi_table_embedding_lookup_grad.h"
+#include "plugin/device/cpu/hal/device/cpu_device_address.h"
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kMultiTableEmbeddingLookupGradInputsNum = 4;
+constexpr size_t kMultiTableEmbeddingLookupGradOutputsNum = 1;
+}  // namespace
+
+template <typename T, typename S>
+bool MultiTableEmbeddingLookupGradCpuKernelMod::LaunchKernel(const std::vector<kernel::AddressPtr> &inputs,
+                                                             const std::vector<AddressPtr> &,
+                                                             const std::vector<kernel::AddressPtr> &outputs) {
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kMultiTableEmbeddingLookupGradInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kMultiTableEmbeddingLookupGradOutputsNum, kernel_name_);
+  const auto *ids = reinterpret_cast<S *>(inputs[kIndex1]->addr);
+  const auto *offsets = reinterpret_cast<S *>(inputs[kIndex2]->addr);
+  const auto *dout = reinterpret_cast<T *>(inputs[kIndex3]->addr);
+  auto *output = reinterpret_cast<T *>(outputs[kIndex0]->addr);
+  MS_ERROR_IF_NULL_W_RET_VAL(ids, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(offsets, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(dout, false);
+  MS_ERROR_IF_NULL_W_RET_VAL(output, false);
+  const auto layout = layout_;
+  const size_t bags_per_table = layout.bag_size_ == 0 ? 0 : layout.ids_per_table_ / layout.bag_size_;
+  const size_t bag_num = bags_per_table * layout.table_num_;
+  // The ids of different tables may hit the same row, so the tasks are split by the columns of the embedding rather
+  // than by the ids, and each task accumulates its own columns of all the rows without races.
+  auto task = [ids, offsets, dout, output, layout, bags_per_table, bag_num](size_t start, size_t end) {
+    for (size_t row = 0; row < layout.rows_; ++row) {
+      std::fill(output + row * layout.dim_ + start, output + row * layout.dim_ + end, static_cast<T>(0));
+    }
+    for (size_t bag = 0; bag < bag_num; ++bag) {
+      auto offset = static_cast<int64_t>(offsets[bag / bags_per_table]);
+      size_t valid_num = 0;
+      if (layout.mean_) {
+        for (size_t i = bag * layout.bag_size_; i < (bag + 1) * layout.bag_size_; ++i) {
+          auto id = static_cast<int64_t>(ids[i]);
+          auto row = id + offset;
+          valid_num += (id >= 0 && row >= 0 && row < SizeToLong(layout.rows_)) ? 1 : 0;
+        }
+      }
+      auto scale = valid_num > 1 ? static_cast<T>(1.0 / valid_num) : static_cast<T>(1);
+      const T *grad = dout + bag * layout.dim_;
+      for (size_t i = bag * layout.bag_size_; i < (bag + 1) * layout.bag_size_; ++i) {
+        auto id = static_cast<int64_t>(ids[i]);
+        auto row = id + offset;
+        if (id < 0 || row < 0 || row >= SizeToLong(layout.rows_)) {
+          continue;
+        }
+        T *out = output + LongToSize(row) * layout.dim_;
+        for (size_t d = start; d < end; ++d) {
+          out[d] += grad[d] * scale;
+        }
+      }
+    }
+  };
+  ParallelLaunchAutoSearch(task, layout.dim_, this, &parallel_search_info_);
+  return true;
+}
+
+const std::vector<std::pair<KernelAttr, MultiTableEmbeddingLookupGradCpuKernelMod::KernelRunFunc>>
+  &MultiTableEmbeddingLookupGradCpuKernelMod::GetFuncList() const {
+  static const std::vector<std::pair<KernelAttr, MultiTableEmbeddingLookupGradCpuKernelMod::KernelRunFunc>>
+    func_list = {
+      {KernelAttr()
+         .AddInputAttr(kNumberTypeFloat32)
+         .AddInputAttr(kNumberTypeInt32)
+         .AddInputAttr(kNumberTypeInt32)
+         .AddInputAttr(kNumberTypeFloat32)
+         .AddOutputAttr(kNumberTypeFloat32),
+       &MultiTableEmbeddingLookupGradCpuKernelMod::LaunchKernel<float, int32_t>},
+      {KernelAttr()
+         .AddInputAttr(kNumberTypeFloat32)
+         .AddInputAttr(kNumberTypeInt64)
+         .AddInputAttr(kNumberTypeInt64)
+         .AddInputAttr(kNumberTypeFloat32)
+         .AddOutputAttr(kNumberTypeFloat32),
+       &MultiTableEmbeddingLookupGradCpuKernelMod::LaunchKernel<float, int64_t>},
+    };
+  return func_list;
+}
+
+bool MultiTableEmbeddingLookupGradCpuKernelMod::Init(const BaseOperatorPtr &base_operator,
+                                                     const std::vector<KernelTensorPtr> &inputs,
+                                                     const std::vector<KernelTensorPtr> &outputs) {
+  auto kernel_ptr = std::dynamic_pointer_cast<ops::MultiTableEmbeddingLookupGrad>(base_operator);
+  MS_ERROR_IF_NULL_W_RET_VAL(kernel_ptr, false);
+  kernel_name_ = kernel_ptr->name();
+  if (inputs.size() != kMultiTableEmbeddingLookupGradInputsNum ||
+      outputs.size() != kMultiTableEmbeddingLookupGradOutputsNum) {
+    MS_LOG(ERROR) << "For '" << kernel_name_ << "', input and output size must be "
+                  << kMultiTableEmbeddingLookupGradInputsNum << " and " << kMultiTableEmbeddingLookupGradOutputsNum
+                  << ", but got " << inputs.size() << " and " << outputs.size();
+    return false;
+  }
+  combiner_ = kernel_ptr->get_combiner();
+  return MatchKernelFunc(base_operator, inputs, outputs);
+}
+
+int MultiTableEmbeddingLookupGradCpuKernelMod::Resize(const BaseOperatorPtr &base_operator,
+                                                      const std::vector<KernelTensorPtr> &inputs,
+                                                      const std::vector<KernelTensorPtr> &outputs,
+                                                      const std::map<uint32_t, tensor::TensorPtr> &) {
+  int ret = KernelMod::Resize(base_operator, inputs, outputs);
+  if (ret != KRET_OK) {
+    return ret;
+  }
+  return InitMultiTableEmbeddingLayout(kernel_name_, combiner_, inputs[kIndex0]->GetShapeVector(),
+                                       inputs[kIndex1]->GetShapeVector(), &layout_);
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, MultiTableEmbeddingLookupGrad, MultiTableEmbeddingLookupGradCpuKernelMod);
+}  // namespace mindspore::kernel
@@ -18,6 +18,8 @@
 
 #define MIN_UNIT 2
 #define MAX_UNIT 8
+#define MIN_INPUT_UNIT 4
+#define MAX_INPUT_UNIT 8
 
 #if defined(ENABLE_ARM) || (defined(ENABLE_SSE) && !defined(ENABLE_AVX))
 bool CheckConvDw1DWinograd(const ConvParameter *conv_param, int thread_num) {
@@ -82,12 +84,17 @@ int SelectOutputUnit(const ConvParameter *conv_param) {
   return unit;
 }
 
-bool CheckIfUseWinograd(int *output_unit, const ConvParameter *conv_param) {
+static bool CheckWinogradConv(const ConvParameter *conv_param) {
   if (conv_param->kernel_h_ == 1 && conv_param->kernel_w_ == 1) {
     return false;
   }
-  if (conv_param->kernel_w_ == conv_param->kernel_h_ && conv_param->dilation_h_ == 1 && conv_param->dilation_w_ == 1 &&
-      conv_param->stride_h_ == 1 && conv_param->stride_w_ == 1 && conv_param->input_channel_ != 1) {
+  return conv_param->kernel_w_ == conv_param->kernel_h_ && conv_param->dilation_h_ == 1 &&
+         conv_param->dilation_w_ == 1 && conv_param->stride_h_ == 1 && conv_param->stride_w_ == 1 &&
+         conv_param->input_channel_ != 1;
+}
+
+bool CheckIfUseWinograd(int *output_unit, const ConvParameter *conv_param) {
+  if (CheckWinogradConv(conv_param)) {
     *output_unit = SelectOutputUnit(conv_param);
     if (*output_unit > 1) {
       return true;
@@ -95,3 +102,17 @@ bool CheckIfUseWinograd(int *output_unit, const ConvParameter *conv_param) {
   }
   return false;
 }
+
+int GetWinogradOutputUnits(const ConvParameter *conv_param, int *output_units, int max_num) {
+  if (!CheckWinogradConv(conv_param)) {
+    return 0;
+  }
+  int num = 0;
+  for (int input_unit = MIN_INPUT_UNIT; input_unit <= MAX_INPUT_UNIT && num < max_num; input_unit += C2NUM) {
+    int output_unit = input_unit - conv_param->kernel_w_ + 1;
+    if (CheckWinogradInputOutputUnit(input_unit, output_unit)) {
+      output_units[num++] = output_unit;
+    }
+  }
+  return num;
+}
@@ -31,6 +31,10 @@ bool CheckWinogradInputOutputUnit(int input_unit, int output_unit);
 
 bool CheckIfUseWinograd(int *output_unit, const ConvParameter *conv_param);
 
+// Get all the output units which the winograd transforms support for the conv, such as F(6x6, 3x3) and F(4x4, 5x5)
+// by the 8x8 transforms, so the caller measures them instead of the cost model. Return the number of them.
+int GetWinogradOutputUnits(const ConvParameter *conv_param, int *output_units, int max_num);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,234 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/experimental/jit/gemm_avx512_jit.h"
+#include <string.h>
+
+// general purpose registers of System V: dst, src, weight and bias are the first four arguments.
+#define JIT_REG_RAX 0
+#define JIT_REG_RCX 1
+#define JIT_REG_RDX 2
+#define JIT_REG_RSI 6
+#define JIT_REG_RDI 7
+#define JIT_ZMM_NUM 32
+#define JIT_ZMM_BYTES 64
+#define JIT_FLOAT_BYTES 4
+#define JIT_MAX_ROW_BLOCK 12
+#define JIT_MAX_COL_BLOCK 4
+#define JIT_MAX_K_UNROLL 16
+// the opcode maps and the prefixes of EVEX.
+#define JIT_MAP_0F 1
+#define JIT_MAP_0F38 2
+#define JIT_PP_NONE 0
+#define JIT_PP_66 1
+
+typedef struct JitCode {
+  uint8_t *buf_;
+  size_t size_;
+  size_t capacity_;
+} JitCode;
+
+static void JitByte(JitCode *code, uint8_t byte) {
+  if (code->size_ < code->capacity_) {
+    code->buf_[code->size_] = byte;
+  }
+  code->size_++;
+}
+
+static void JitInt32(JitCode *code, int32_t value) {
+  uint32_t bits = (uint32_t)value;
+  for (int i = 0; i < 4; i++) {
+    JitByte(code, (uint8_t)(bits >> (8 * i)));
+  }
+}
+
+// EVEX.512 instruction, the rm is a zmm/gpr register when is_reg, otherwise it is [base + disp32].
+static void JitEvex(JitCode *code, int map, int pp, int opcode, int reg, int vvvv, int rm, int is_reg, int32_t disp) {
+  uint8_t r = (uint8_t)((reg >> 3) & 1);
+  uint8_t r1 = (uint8_t)((reg >> 4) & 1);
+  uint8_t b = (uint8_t)((rm >> 3) & 1);
+  uint8_t x = is_reg ? (uint8_t)((rm >> 4) & 1) : 0;
+  uint8_t v1 = (uint8_t)((vvvv >> 4) & 1);
+  JitByte(code, 0x62);
+  JitByte(code, (uint8_t)(((!r) << 7) | ((!x) << 6) | ((!b) << 5) | ((!r1) << 4) | map));
+  JitByte(code, (uint8_t)(((~vvvv & 0xF) << 3) | (1 << 2) | pp));
+  JitByte(code, (uint8_t)((2 << 5) | ((!v1) << 3)));
+  JitByte(code, (uint8_t)opcode);
+  if (is_reg) {
+    JitByte(code, (uint8_t)(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+  } else {
+    JitByte(code, (uint8_t)(0x80 | ((reg & 7) << 3) | (rm & 7)));
+    JitInt32(code, disp);
+  }
+}
+
+static void JitVmovupsLoad(JitCode *code, int zmm, int base, int32_t disp) {
+  JitEvex(code, JIT_MAP_0F, JIT_PP_NONE, 0x10, zmm, 0, base, 0, disp);
+}
+
+static void JitVmovupsStore(JitCode *code, int zmm, int base, int32_t disp) {
+  JitEvex(code, JIT_MAP_0F, JIT_PP_NONE, 0x11, zmm, 0, base, 0, disp);
+}
+
+static void JitVbroadcastss(JitCode *code, int zmm, int base, int32_t disp) {
+  JitEvex(code, JIT_MAP_0F38, JIT_PP_66, 0x18, zmm, 0, base, 0, disp);
+}
+
+// dst += src1 * src2
+static void JitVfmadd231ps(JitCode *code, int dst, int src1, int src2) {
+  JitEvex(code, JIT_MAP_0F38, JIT_PP_66, 0xB8, dst, src1, src2, 1, 0);
+}
+
+static void JitVpxord(JitCode *code, int dst, int src1, int src2) {
+  JitEvex(code, JIT_MAP_0F, JIT_PP_66, 0xEF, dst, src1, src2, 1, 0);
+}
+
+static void JitVmaxps(JitCode *code, int dst, int src1, int src2) {
+  JitEvex(code, JIT_MAP_0F, JIT_PP_NONE, 0x5F, dst, src1, src2, 1, 0);
+}
+
+static void JitVminps(JitCode *code, int dst, int src1, int src2) {
+  JitEvex(code, JIT_MAP_0F, JIT_PP_NONE, 0x5D, dst, src1, src2, 1, 0);
+}
+
+static void JitVpbroadcastdEax(JitCode *code, int zmm) {
+  JitEvex(code, JIT_MAP_0F38, JIT_PP_66, 0x7C, zmm, 0, JIT_REG_RAX, 1, 0);
+}
+
+static void JitMovEaxImm(JitCode *code, int32_t imm) {
+  JitByte(code, 0xB8);
+  JitInt32(code, imm);
+}
+
+// add reg64, imm32, only for the registers without REX.B.
+static void JitAddImm(JitCode *code, int reg, int32_t imm) {
+  JitByte(code, 0x48);
+  JitByte(code, 0x81);
+  JitByte(code, (uint8_t)(0xC0 | reg));
+  JitInt32(code, imm);
+}
+
+static void JitDecEax(JitCode *code) {
+  JitByte(code, 0xFF);
+  JitByte(code, 0xC8);
+}
+
+static void JitJnz(JitCode *code, size_t target) {
+  JitByte(code, 0x0F);
+  JitByte(code, 0x85);
+  JitInt32(code, (int32_t)((int64_t)target - (int64_t)(code->size_ + 4)));
+}
+
+static void JitVzeroupperRet(JitCode *code) {
+  JitByte(code, 0xC5);
+  JitByte(code, 0xF8);
+  JitByte(code, 0x77);
+  JitByte(code, 0xC3);
+}
+
+static inline int JitAccReg(const JitGemmAvx512Param *param, int row, int col) {
+  return row * param->col_block_ + col;
+}
+
+static inline int JitWeightReg(const JitGemmAvx512Param *param, int col) {
+  return JIT_ZMM_NUM - 1 - param->col_block_ + col;
+}
+
+#define JIT_BROADCAST_REG (JIT_ZMM_NUM - 1)
+
+int JitGemmAvx512CheckParam(const JitGemmAvx512Param *param) {
+  if (param == NULL || param->row_block_ < 1 || param->row_block_ > JIT_MAX_ROW_BLOCK || param->col_block_ < 1 ||
+      param->col_block_ > JIT_MAX_COL_BLOCK || param->depth_ < 0 || param->k_unroll_ < 1 ||
+      param->k_unroll_ > JIT_MAX_K_UNROLL || param->src_stride_ < 0 || param->dst_stride_ < 0) {
+    return 0;
+  }
+  // the accumulators, the weights of one depth and the broadcast src.
+  if (param->row_block_ * param->col_block_ + param->col_block_ + 1 > JIT_ZMM_NUM) {
+    return 0;
+  }
+  // the displacements of the last row must be in int32.
+  int64_t max_src_disp = ((int64_t)(param->row_block_ - 1) * param->src_stride_ + param->k_unroll_) * JIT_FLOAT_BYTES;
+  int64_t max_dst_disp =
+    ((int64_t)(param->row_block_ - 1) * param->dst_stride_ + param->col_block_ * 16) * JIT_FLOAT_BYTES;
+  return max_src_disp <= INT32_MAX && max_dst_disp <= INT32_MAX;
+}
+
+// the products of one depth, src and weight are at the offset of the depth.
+static void JitEmitDepth(JitCode *code, const JitGemmAvx512Param *param, int k) {
+  for (int j = 0; j < param->col_block_; j++) {
+    JitVmovupsLoad(code, JitWeightReg(param, j), JIT_REG_RDX, (k * param->col_block_ + j) * JIT_ZMM_BYTES);
+  }
+  for (int i = 0; i < param->row_block_; i++) {
+    JitVbroadcastss(code, JIT_BROADCAST_REG, JIT_REG_RSI, (i * param->src_stride_ + k) * JIT_FLOAT_BYTES);
+    for (int j = 0; j < param->col_block_; j++) {
+      JitVfmadd231ps(code, JitAccReg(param, i, j), JitWeightReg(param, j), JIT_BROADCAST_REG);
+    }
+  }
+}
+
+size_t JitGemmAvx512Emit(const JitGemmAvx512Param *param, uint8_t *buf, size_t capacity) {
+  if (buf == NULL || !JitGemmAvx512CheckParam(param)) {
+    return 0;
+  }
+  JitCode code = {buf, 0, capacity};
+  for (int i = 0; i < param->row_block_; i++) {
+    for (int j = 0; j < param->col_block_; j++) {
+      int acc = JitAccReg(param, i, j);
+      if (param->has_bias_) {
+        JitVmovupsLoad(&code, acc, JIT_REG_RCX, j * JIT_ZMM_BYTES);
+      } else {
+        JitVpxord(&code, acc, acc, acc);
+      }
+    }
+  }
+  int loop_num = param->depth_ / param->k_unroll_;
+  int tail = param->depth_ % param->k_unroll_;
+  if (loop_num > 0) {
+    JitMovEaxImm(&code, loop_num);
+    size_t loop_start = code.size_;
+    for (int k = 0; k < param->k_unroll_; k++) {
+      JitEmitDepth(&code, param, k);
+    }
+    JitAddImm(&code, JIT_REG_RSI, param->k_unroll_ * JIT_FLOAT_BYTES);
+    JitAddImm(&code, JIT_REG_RDX, param->k_unroll_ * param->col_block_ * JIT_ZMM_BYTES);
+    JitDecEax(&code);
+    JitJnz(&code, loop_start);
+  }
+  for (int k = 0; k < tail; k++) {
+    JitEmitDepth(&code, param, k);
+  }
+  // the relu6 clips the upper bound first, then the relu and relu6 clip the lower bound.
+  if (param->act_flag_ & 0x1) {
+    JitMovEaxImm(&code, 0x40C00000);  // 6.0f
+    JitVpbroadcastdEax(&code, JIT_BROADCAST_REG);
+    for (int i = 0; i < param->row_block_ * param->col_block_; i++) {
+      JitVminps(&code, i, i, JIT_BROADCAST_REG);
+    }
+  }
+  if (param->act_flag_ & 0x2) {
+    JitVpxord(&code, JIT_BROADCAST_REG, JIT_BROADCAST_REG, JIT_BROADCAST_REG);
+    for (int i = 0; i < param->row_block_ * param->col_block_; i++) {
+      JitVmaxps(&code, i, i, JIT_BROADCAST_REG);
+    }
+  }
+  for (int i = 0; i < param->row_block_; i++) {
+    for (int j = 0; j < param->col_block_; j++) {
+      JitVmovupsStore(&code, JitAccReg(param, i, j), JIT_REG_RDI, (i * param->dst_stride_ + j * 16) * JIT_FLOAT_BYTES);
+    }
+  }
+  JitVzeroupperRet(&code);
+  return code.size_ <= code.capacity_ ? code.size_ : 0;
+}
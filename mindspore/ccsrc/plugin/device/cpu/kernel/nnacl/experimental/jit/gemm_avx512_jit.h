@@ -0,0 +1,51 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_EXPERIMENTAL_JIT_GEMM_AVX512_JIT_H_
+#define MINDSPORE_NNACL_EXPERIMENTAL_JIT_GEMM_AVX512_JIT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define JIT_GEMM_AVX512_MAX_CODE_SIZE 65536
+
+// The shape and the epilogue, which are fixed in the generated microkernel. The generated code has the signature of
+// GemmAvx512Kernel, it computes dst = act(bias + src * weight) of the whole depth at once, which is the inc_flag 2 of
+// the HPC-generator kernels, and the arguments other than dst, src, weight and bias are ignored.
+typedef struct JitGemmAvx512Param {
+  int row_block_;   // the rows of src and dst, [1, 12]
+  int col_block_;   // the number of 16 columns, [1, 4]
+  int depth_;
+  int src_stride_;  // in float
+  int dst_stride_;  // in float
+  int act_flag_;    // 0x1 is relu6 and 0x2 is relu, the same as the HPC-generator kernels
+  int has_bias_;
+  int k_unroll_;    // the unroll of the depth loop, [1, 16]
+} JitGemmAvx512Param;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Whether the registers and the displacements of the param can be encoded.
+int JitGemmAvx512CheckParam(const JitGemmAvx512Param *param);
+
+// Emit the x86-64 machine code with System V calling convention, the code is position independent. Return the code
+// size, or 0 when the param is invalid or the capacity is not enough.
+size_t JitGemmAvx512Emit(const JitGemmAvx512Param *param, uint8_t *code, size_t capacity);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_EXPERIMENTAL_JIT_GEMM_AVX512_JIT_H_
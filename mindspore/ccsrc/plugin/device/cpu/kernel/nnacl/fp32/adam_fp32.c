@@ -219,21 +219,10 @@ int DoAdam(float *m, float *v, const float *gradient, float *weight, float beta1
     return NNACL_ERRCODE_SQRT_NEGATIVE;
   }
 
-  float update_lr = learning_rate * sqrtf(1.f - beta2_power[0]) / (1.f - beta1_power[0]);
-  const float one_minus_beta1 = 1.f - beta1;
-  const float one_minus_beta2 = 1.f - beta2;
-  if (nesterov) {  // Nadam
-    for (int i = start; i < end; ++i) {
-      m[i] += (gradient[i] - m[i]) * one_minus_beta1;
-      v[i] += (gradient[i] * gradient[i] - v[i]) * one_minus_beta2;
-      weight[i] -= update_lr * (m[i] * beta1 + one_minus_beta1 * gradient[i]) / (sqrtf(v[i]) + eps);
-    }
-  } else {
-    for (int i = start; i < end; ++i) {
-      m[i] += (gradient[i] - m[i]) * one_minus_beta1;
-      v[i] += (gradient[i] * gradient[i] - v[i]) * one_minus_beta2;
-      weight[i] -= update_lr * m[i] / (sqrtf(v[i]) + eps);
-    }
+  if (start >= end) {
+    return NNACL_OK;
   }
-  return NNACL_OK;
+  float update_lr = learning_rate * sqrtf(1.f - beta2_power[0]) / (1.f - beta1_power[0]);
+  // the same update as the Adam operator with the bias corrected learning rate, which runs in simd.
+  return AdamFp32(weight, m, v, update_lr, beta1, beta2, eps, gradient, (size_t)start, (size_t)end, nesterov);
 }
@@ -0,0 +1,154 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/flash_attention_fp32.h"
+#include <math.h>
+#include <string.h>
+#include "nnacl/errorcode.h"
+#include "nnacl/flash_attention_fp32_simd.h"
+
+static float FlashAttentionDotFp32(const float *a, const float *b, int size) {
+  float sum = 0.0f;
+  int64_t index = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionDot, index, a, b, &sum, size);
+  for (; index < size; index++) {
+    sum += a[index] * b[index];
+  }
+  return sum;
+}
+
+// scores = exp(scores - max), and return the sum of them.
+static float FlashAttentionExpSumFp32(float *scores, float max, int size) {
+  float exp_sum = 0.0f;
+  int64_t index = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionExpSum, index, scores, max, &exp_sum, size);
+  for (; index < size; index++) {
+    scores[index] = simd_exp32_f32(scores[index] - max);
+    exp_sum += scores[index];
+  }
+  return exp_sum;
+}
+
+static void FlashAttentionScaleFp32(float *data, float scale, int size) {
+  int64_t index = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionScale, index, data, scale, size);
+  for (; index < size; index++) {
+    data[index] *= scale;
+  }
+}
+
+static void FlashAttentionAxpyFp32(float *dst, const float *src, float alpha, int size) {
+  int64_t index = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionAxpy, index, dst, src, alpha, size);
+  for (; index < size; index++) {
+    dst[index] += alpha * src[index];
+  }
+}
+
+size_t FlashAttentionBufferSize(const FlashAttentionArgs *args) {
+  return (size_t)args->k_block_ + (size_t)args->q_tile_ * (args->head_size_ + 2);
+}
+
+// Update the state of a query row by a block of keys with the online softmax: the running max, the running sum of the
+// exps and the output accumulator are rescaled when the max grows, so each block is visited once.
+static void FlashAttentionUpdateRow(const float *q_row, const float *k_block, const float *v_block,
+                                    const float *mask_row, float *scores, float *row_max, float *row_sum, float *acc,
+                                    int k_num, const FlashAttentionArgs *args) {
+  int head_size = args->head_size_;
+  float block_max = -INFINITY;
+  for (int j = 0; j < k_num; ++j) {
+    float score = FlashAttentionDotFp32(q_row, k_block + (size_t)j * head_size, head_size) * args->scale_;
+    if (mask_row != NULL) {
+      score += mask_row[j];
+    }
+    scores[j] = score;
+    block_max = MSMAX(block_max, score);
+  }
+  if (block_max == -INFINITY) {
+    // all the keys of the block are masked.
+    return;
+  }
+  float new_max = MSMAX(*row_max, block_max);
+  if (*row_max != -INFINITY && *row_max != new_max) {
+    float correction = simd_exp32_f32(*row_max - new_max);
+    *row_sum *= correction;
+    FlashAttentionScaleFp32(acc, correction, head_size);
+  }
+  *row_max = new_max;
+  *row_sum += FlashAttentionExpSumFp32(scores, new_max, k_num);
+  for (int j = 0; j < k_num; ++j) {
+    FlashAttentionAxpyFp32(acc, v_block + (size_t)j * head_size, scores[j], head_size);
+  }
+}
+
+int FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *output, float *buffer,
+                       const FlashAttentionArgs *args, int task_id, int thread_num) {
+  NNACL_CHECK_NULL_RETURN_ERR(q);
+  NNACL_CHECK_NULL_RETURN_ERR(k);
+  NNACL_CHECK_NULL_RETURN_ERR(v);
+  NNACL_CHECK_NULL_RETURN_ERR(output);
+  NNACL_CHECK_NULL_RETURN_ERR(buffer);
+  NNACL_CHECK_NULL_RETURN_ERR(args);
+  if (args->q_tile_ <= 0 || args->k_block_ <= 0 || args->head_size_ <= 0 || thread_num <= 0) {
+    return NNACL_ERR;
+  }
+  int head_size = args->head_size_;
+  int q_tile_num = UP_DIV(args->q_seq_, args->q_tile_);
+  int unit_num = args->batch_ * args->head_num_ * q_tile_num;
+  float *scores = buffer;
+  float *acc = scores + args->k_block_;
+  float *row_max = acc + (size_t)args->q_tile_ * head_size;
+  float *row_sum = row_max + args->q_tile_;
+  for (int unit = task_id; unit < unit_num; unit += thread_num) {
+    int batch_head = unit / q_tile_num;
+    int batch = batch_head / args->head_num_;
+    int q_start = (unit % q_tile_num) * args->q_tile_;
+    int q_num = MSMIN(args->q_tile_, args->q_seq_ - q_start);
+    const float *q_tile = q + ((size_t)batch_head * args->q_seq_ + q_start) * head_size;
+    const float *k_head = k + (size_t)batch_head * args->k_seq_ * head_size;
+    const float *v_head = v + (size_t)batch_head * args->k_seq_ * head_size;
+    const float *mask_tile = mask == NULL ? NULL : mask + ((size_t)batch * args->q_seq_ + q_start) * args->k_seq_;
+    memset(acc, 0, (size_t)q_num * head_size * sizeof(float));
+    for (int i = 0; i < q_num; ++i) {
+      row_max[i] = -INFINITY;
+      row_sum[i] = 0.0f;
+    }
+
+    // the block of keys and values stays in cache while all the query rows of the tile are updated by it.
+    for (int k_start = 0; k_start < args->k_seq_; k_start += args->k_block_) {
+      int k_num = MSMIN(args->k_block_, args->k_seq_ - k_start);
+      for (int i = 0; i < q_num; ++i) {
+        const float *mask_row = mask_tile == NULL ? NULL : mask_tile + (size_t)i * args->k_seq_ + k_start;
+        FlashAttentionUpdateRow(q_tile + (size_t)i * head_size, k_head + (size_t)k_start * head_size,
+                                v_head + (size_t)k_start * head_size, mask_row, scores, row_max + i, row_sum + i,
+                                acc + (size_t)i * head_size, k_num, args);
+      }
+    }
+
+    float *output_tile = output + ((size_t)batch_head * args->q_seq_ + q_start) * head_size;
+    for (int i = 0; i < q_num; ++i) {
+      float *output_row = output_tile + (size_t)i * head_size;
+      if (row_sum[i] == 0.0f) {
+        // the row whose keys are all masked.
+        memset(output_row, 0, head_size * sizeof(float));
+        continue;
+      }
+      memcpy(output_row, acc + (size_t)i * head_size, head_size * sizeof(float));
+      FlashAttentionScaleFp32(output_row, 1.0f / row_sum[i], head_size);
+    }
+  }
+  return NNACL_OK;
+}
@@ -0,0 +1,48 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+#define MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+
+#include "nnacl/op_base.h"
+
+typedef struct FlashAttentionArgs {
+  int batch_;
+  int head_num_;
+  int q_seq_;
+  int k_seq_;
+  int head_size_;
+  int q_tile_;   // the number of the query rows which share each block of key and value
+  int k_block_;  // the number of the keys in each block
+  float scale_;  // the scale of the scores, which is usually 1 / sqrt(head_size)
+} FlashAttentionArgs;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// the number of the floats of the buffer of each task.
+size_t FlashAttentionBufferSize(const FlashAttentionArgs *args);
+
+// Fused attention, output = softmax(q * k^T * scale + mask) * v for each head. q and output are
+// [batch, head_num, q_seq, head_size], k and v are [batch, head_num, k_seq, head_size], and the additive mask is
+// [batch, q_seq, k_seq] or NULL. The keys are visited by blocks with the online softmax, so only the scores of a tile
+// of queries against a block of keys live in the buffer, and the memory doesn't grow with q_seq x k_seq. The tiles of
+// queries of all the heads are split among the tasks.
+int FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *output, float *buffer,
+                       const FlashAttentionArgs *args, int task_id, int thread_num);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#include <x86intrin.h>
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+
+#define BF16_AVX512_ROW_TILE 4
+#define BF16_AVX512_COL_BLOCK 2
+#define BF16_AVX512_DEEP_STEP 32
+
+static inline __mmask16 Bf16ValidMask(int num) {
+  return num >= C16NUM ? (__mmask16)0xffff : (num <= 0 ? (__mmask16)0 : (__mmask16)((1 << num) - 1));
+}
+
+// c[row_num, col] += a[row_num, deep] * b, row_num <= 4 and col <= 32, the col_block_num blocks of b are used.
+static void MatMulBf16Avx512Tile(const float *a, const uint16_t *b, float *c, const float *bias, int act_type,
+                                 int deep, int row_num, int col, int col_block_num, int stride) {
+  const int deep_align = UP_ROUND(deep, MATMUL_BF16_AVX512_DEEP_TILE);
+  const int block_size = deep_align * MATMUL_BF16_AVX512_COL_TILE;
+  __mmask16 col_mask[BF16_AVX512_COL_BLOCK] = {Bf16ValidMask(col), Bf16ValidMask(col - C16NUM)};
+  __m512 acc[BF16_AVX512_ROW_TILE][BF16_AVX512_COL_BLOCK];
+  for (int j = 0; j < BF16_AVX512_COL_BLOCK; j++) {
+    __m512 bias_val = bias == NULL ? _mm512_setzero_ps() : _mm512_maskz_loadu_ps(col_mask[j], bias + j * C16NUM);
+    for (int i = 0; i < BF16_AVX512_ROW_TILE; i++) {
+      acc[i][j] = bias_val;
+    }
+  }
+  // the rows out of the tile compute the last row again and are not stored
+  const float *a_row[BF16_AVX512_ROW_TILE];
+  for (int i = 0; i < BF16_AVX512_ROW_TILE; i++) {
+    a_row[i] = a + MSMIN(i, row_num - 1) * deep;
+  }
+
+  uint32_t a_pair[BF16_AVX512_ROW_TILE][C16NUM];
+  for (int k = 0; k < deep; k += BF16_AVX512_DEEP_STEP) {
+    int deep_num = MSMIN(BF16_AVX512_DEEP_STEP, deep - k);
+    __mmask16 low_mask = Bf16ValidMask(deep_num);
+    __mmask16 high_mask = Bf16ValidMask(deep_num - C16NUM);
+    for (int i = 0; i < BF16_AVX512_ROW_TILE; i++) {
+      __m512 low = _mm512_maskz_loadu_ps(low_mask, a_row[i] + k);
+      __m512 high = _mm512_maskz_loadu_ps(high_mask, a_row[i] + k + C16NUM);
+      _mm512_storeu_si512(a_pair[i], (__m512i)_mm512_cvtne2ps_pbh(high, low));
+    }
+    int pair_num = UP_DIV(deep_num, MATMUL_BF16_AVX512_DEEP_TILE);
+    const uint16_t *b_k = b + k * MATMUL_BF16_AVX512_COL_TILE;
+    for (int p = 0; p < pair_num; p++) {
+      __m512bh b0 = (__m512bh)_mm512_loadu_si512(b_k + p * C32NUM);
+      if (col_block_num == BF16_AVX512_COL_BLOCK) {
+        __m512bh b1 = (__m512bh)_mm512_loadu_si512(b_k + block_size + p * C32NUM);
+        for (int i = 0; i < BF16_AVX512_ROW_TILE; i++) {
+          __m512bh a_val = (__m512bh)_mm512_set1_epi32((int)a_pair[i][p]);
+          acc[i][0] = _mm512_dpbf16_ps(acc[i][0], a_val, b0);
+          acc[i][1] = _mm512_dpbf16_ps(acc[i][1], a_val, b1);
+        }
+      } else {
+        for (int i = 0; i < BF16_AVX512_ROW_TILE; i++) {
+          acc[i][0] = _mm512_dpbf16_ps(acc[i][0], (__m512bh)_mm512_set1_epi32((int)a_pair[i][p]), b0);
+        }
+      }
+    }
+  }
+
+  __m512 zero = _mm512_setzero_ps();
+  __m512 six = _mm512_set1_ps(6.0f);
+  for (int i = 0; i < row_num; i++) {
+    for (int j = 0; j < col_block_num; j++) {
+      __m512 dst = acc[i][j];
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        dst = _mm512_max_ps(dst, zero);
+      }
+      if (act_type == ActType_Relu6) {
+        dst = _mm512_min_ps(dst, six);
+      }
+      _mm512_mask_storeu_ps(c + i * stride + j * C16NUM, col_mask[j], dst);
+    }
+  }
+}
+
+void MatMulBf16Avx512Fp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep,
+                          int row, int col, int stride) {
+  const int block_size = UP_ROUND(deep, MATMUL_BF16_AVX512_DEEP_TILE) * MATMUL_BF16_AVX512_COL_TILE;
+  const int col_step = BF16_AVX512_COL_BLOCK * MATMUL_BF16_AVX512_COL_TILE;
+  // the b blocks of one column step stay in cache while all the rows go through them
+  for (int n = 0; n < col; n += col_step) {
+    int col_num = MSMIN(col_step, col - n);
+    int col_block_num = UP_DIV(col_num, MATMUL_BF16_AVX512_COL_TILE);
+    const uint16_t *b_block = b + (n / MATMUL_BF16_AVX512_COL_TILE) * block_size;
+    const float *bias_block = bias == NULL ? NULL : bias + n;
+    for (int r = 0; r < row; r += BF16_AVX512_ROW_TILE) {
+      int row_num = MSMIN(BF16_AVX512_ROW_TILE, row - r);
+      MatMulBf16Avx512Tile(a + r * deep, b_block, c + r * stride + n, bias_block, act_type, deep, row_num, col_num,
+                           col_block_num, stride);
+    }
+  }
+}
+#endif
@@ -0,0 +1,36 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_FP32_H_
+
+#include <stdint.h>
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifdef ENABLE_AVX512
+// The a is [row, deep] in fp32 and converted to bf16 on the fly, the b is packed by MATMUL_BF16_AVX512_COL_TILE and
+// MATMUL_BF16_AVX512_DEEP_TILE, the products are accumulated in fp32 by vdpbf16ps.
+void MatMulBf16Avx512Fp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep,
+                          int row, int col, int stride);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_AVX512_BF16_FP32_H_
@@ -75,6 +75,12 @@ void GemmRowxColKernelFp32(float *dst, const float *src, const float *weight, co
 
 void MatMulAvx512Fp32(const float *a, const float *b, float *c, const float *bias, const int act_type, const int depth,
                       const int cur_col, const int col_align, const int row) {
+  MatMulAvx512JitFp32(a, b, c, bias, act_type, depth, cur_col, col_align, row, NULL);
+}
+
+void MatMulAvx512JitFp32(const float *a, const float *b, float *c, const float *bias, const int act_type,
+                         const int depth, const int cur_col, const int col_align, const int row,
+                         const GemmAvx512Kernel jit_kernel[C4NUM][C13NUM]) {
   int k_block = C1500NUM;
   int act_flag = 0;
   if (act_type == ActType_Relu6) {
@@ -135,6 +141,16 @@ void MatMulAvx512Fp32(const float *a, const float *b, float *c, const float *bia
   kernel[3][5] = nnacl_gemm_avx512_5x64_kernel_nhwc_fp32;
   kernel[3][6] = nnacl_gemm_avx512_6x64_kernel_nhwc_fp32;
 #endif
+  // the jit kernels compute the whole depth at once, so they are only used without the depth blocking.
+  if (jit_kernel != NULL && depth <= k_block) {
+    for (int i = 0; i < C4NUM; i++) {
+      for (int j = 0; j < C13NUM; j++) {
+        if (jit_kernel[i][j] != NULL) {
+          kernel[i][j] = jit_kernel[i][j];
+        }
+      }
+    }
+  }
 
   int inc_flag;
   for (int k = 0; k < depth; k += k_block) {
@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_NNACL_FP32_MATMUL_AVX512_H_
 #define MINDSPORE_NNACL_FP32_MATMUL_AVX512_H_
 #include <stdint.h>
+#include "nnacl/op_base.h"
 #ifdef ENABLE_AVX512
 #include <x86intrin.h>
 typedef void (*GemmAvx512Kernel)(float *dst, const float *src, const float *weight, const float *bias,
@@ -25,12 +26,22 @@ typedef void (*GemmAvx512Kernel)(float *dst, const float *src, const float *weig
 #ifdef __cplusplus
 extern "C" {
 #endif
+// the reference kernel of the HPC-generator kernels, which is used by ENABLE_DEBUG.
+void GemmRowxColKernelFp32(float *dst, const float *src, const float *weight, const float *bias, const size_t act_flag,
+                           const size_t row_block, const size_t col_block, const size_t depth, const size_t src_stride,
+                           const size_t dst_stride, const size_t inc_flag);
+
 void MatVecMulAvx512Fp32(const float *a, const float *b, float *c, const float *bias, int act_type, int depth,
                          int cur_col, int col_align);
 
 void MatMulAvx512Fp32(const float *a, const float *b, float *c, const float *bias, int act_type, int depth, int cur_col,
                       int col_align, int row);
 
+// the same as MatMulAvx512Fp32, the non-null kernels of jit_kernel[col_block / 16 - 1][row_block] replace the
+// HPC-generator kernels, which are generated for the depth, the strides and the act_type of the matmul.
+void MatMulAvx512JitFp32(const float *a, const float *b, float *c, const float *bias, int act_type, int depth,
+                         int cur_col, int col_align, int row, const GemmAvx512Kernel jit_kernel[C4NUM][C13NUM]);
+
 int64_t GemmIsNotPackOptimizeAVX512(int64_t m_index, const float *a, const float *b, float *c, const float *bias, int m,
                                     int k, int act_type);
 
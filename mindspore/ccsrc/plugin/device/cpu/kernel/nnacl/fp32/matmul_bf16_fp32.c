@@ -0,0 +1,63 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+
+int MatmulBf16PackedSize(int deep, int col, int col_tile, int deep_tile) {
+  return UP_ROUND(col, col_tile) * UP_ROUND(deep, deep_tile);
+}
+
+void PackMatrixBToBf16(const float *src, uint16_t *dst, int deep, int col, bool src_trans, int col_tile,
+                       int deep_tile) {
+  int deep_align = UP_ROUND(deep, deep_tile);
+  int col_align = UP_ROUND(col, col_tile);
+  for (int n = 0; n < col_align; n++) {
+    int col_block = n / col_tile;
+    int col_index = n % col_tile;
+    for (int k = 0; k < deep_align; k++) {
+      int dst_index = col_block * deep_align * col_tile + (k / deep_tile) * col_tile * deep_tile +
+                      col_index * deep_tile + k % deep_tile;
+      if (n >= col || k >= deep) {
+        dst[dst_index] = 0;
+        continue;
+      }
+      float value = src_trans ? src[n * deep + k] : src[k * col + n];
+      dst[dst_index] = Float32ToBf16(value);
+    }
+  }
+}
+
+void MatMulBf16Fp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep, int row,
+                    int col, int stride, int col_tile, int deep_tile) {
+  int deep_align = UP_ROUND(deep, deep_tile);
+  for (int r = 0; r < row; r++) {
+    for (int n = 0; n < col; n++) {
+      const uint16_t *b_col = b + (n / col_tile) * deep_align * col_tile + (n % col_tile) * deep_tile;
+      float value = bias == NULL ? 0.0f : bias[n];
+      for (int k = 0; k < deep; k++) {
+        float b_value = Bf16ToFloat32(b_col[(k / deep_tile) * col_tile * deep_tile + k % deep_tile]);
+        value += Bf16ToFloat32(Float32ToBf16(a[r * deep + k])) * b_value;
+      }
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        value = MSMAX(value, 0.0f);
+      }
+      if (act_type == ActType_Relu6) {
+        value = MSMIN(value, 6.0f);
+      }
+      c[r * stride + n] = value;
+    }
+  }
+}
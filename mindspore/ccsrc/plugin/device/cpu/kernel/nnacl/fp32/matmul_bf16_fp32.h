@@ -0,0 +1,72 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "nnacl/op_base.h"
+
+// The bf16 matrix-b is packed to blocks of col_tile columns, in which every col_tile * deep_tile elements of
+// deep_tile consecutive depths are stored column by column, that is the operand layout of the bf16 dot instructions.
+#define MATMUL_BF16_AVX512_COL_TILE 16
+#define MATMUL_BF16_AVX512_DEEP_TILE 2
+#define MATMUL_BF16_BFMMLA_COL_TILE 8
+#define MATMUL_BF16_BFMMLA_DEEP_TILE 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// round to the nearest even, the same as the hardware conversion
+static inline uint16_t Float32ToBf16(float src) {
+  uint32_t bits;
+  memcpy(&bits, &src, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) {
+    return (uint16_t)((bits >> 16) | 0x40);  // quiet nan
+  }
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return (uint16_t)(bits >> 16);
+}
+
+static inline float Bf16ToFloat32(uint16_t src) {
+  uint32_t bits = (uint32_t)src << 16;
+  float dst;
+  memcpy(&dst, &bits, sizeof(dst));
+  return dst;
+}
+
+// The uint16 number of the packed matrix-b, the col is aligned to col_tile and the deep is aligned to deep_tile.
+int MatmulBf16PackedSize(int deep, int col, int col_tile, int deep_tile);
+
+// src is [deep, col], or [col, deep] when src_trans is true.
+void PackMatrixBToBf16(const float *src, uint16_t *dst, int deep, int col, bool src_trans, int col_tile,
+                       int deep_tile);
+
+// c[row, col] = a[row, deep] * b + bias, the a is rounded to bf16 and the products are accumulated in fp32.
+void MatMulBf16Fp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep, int row,
+                    int col, int stride, int col_tile, int deep_tile);
+
+#ifdef ENABLE_ARM64
+// the b is packed by MATMUL_BF16_BFMMLA_COL_TILE and MATMUL_BF16_BFMMLA_DEEP_TILE
+void MatMulBf16BfmmlaFp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep,
+                          int row, int col, int stride);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/matmul_epilogue_fp32.h"
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/activation_fp32.h"
+#include "nnacl/fp32/add_fp32.h"
+#include "nnacl/fp32/mul_fp32.h"
+
+int MatmulEpilogueHasOperand(int op_type) { return op_type == EpilogueOp_Add || op_type == EpilogueOp_Mul; }
+
+int MatmulEpilogueOperandNum(const MatmulEpilogue *epilogue) {
+  int operand_num = 0;
+  for (int i = 0; i < epilogue->op_num_ && i < MAX_EPILOGUE_OP_NUM; ++i) {
+    operand_num += MatmulEpilogueHasOperand(epilogue->ops_[i].type_);
+  }
+  return operand_num;
+}
+
+static const float *EpilogueOperand(const EpilogueOp *op, const float *data, int row_index, int col_start, int col) {
+  if (op->broadcast_ == EpilogueBroadcast_Scalar) {
+    return data;
+  }
+  if (op->broadcast_ == EpilogueBroadcast_Col) {
+    return data + col_start;
+  }
+  return data + (size_t)row_index * col + col_start;
+}
+
+static void EpilogueScalar(int op_type, float scalar, float *dst, int length) {
+  if (op_type == EpilogueOp_Add) {
+    for (int i = 0; i < length; ++i) {
+      dst[i] += scalar;
+    }
+  } else {
+    for (int i = 0; i < length; ++i) {
+      dst[i] *= scalar;
+    }
+  }
+}
+
+static int EpilogueRow(const MatmulEpilogue *epilogue, const float *const *op_data, float *dst, int row_index,
+                       int col_start, int col_num, int col) {
+  for (int i = 0; i < epilogue->op_num_; ++i) {
+    const EpilogueOp *op = &epilogue->ops_[i];
+    int ret = NNACL_OK;
+    if (MatmulEpilogueHasOperand(op->type_)) {
+      NNACL_CHECK_NULL_RETURN_ERR(op_data[i]);
+      const float *operand = EpilogueOperand(op, op_data[i], row_index, col_start, col);
+      if (op->broadcast_ == EpilogueBroadcast_Scalar) {
+        EpilogueScalar(op->type_, operand[0], dst, col_num);
+      } else if (op->type_ == EpilogueOp_Add) {
+        ret = ElementAdd(dst, operand, dst, col_num);
+      } else {
+        ret = ElementMul(dst, operand, dst, col_num);
+      }
+    } else if (op->type_ == EpilogueOp_Relu) {
+      ret = Fp32Relu(dst, col_num, dst);
+    } else if (op->type_ == EpilogueOp_Relu6) {
+      ret = Fp32Relu6(dst, col_num, dst);
+    } else if (op->type_ == EpilogueOp_Sigmoid) {
+      ret = Sigmoid(dst, col_num, dst);
+    } else if (op->type_ == EpilogueOp_Gelu || op->type_ == EpilogueOp_GeluTanh) {
+      ret = Gelu(dst, col_num, dst, op->type_ == EpilogueOp_GeluTanh);
+    } else {
+      return NNACL_ERR;
+    }
+    if (ret != NNACL_OK) {
+      return ret;
+    }
+  }
+  return NNACL_OK;
+}
+
+int MatmulEpilogueFp32(const MatmulEpilogue *epilogue, const float *const *op_data, float *dst, int dst_stride,
+                       int row_start, int row_num, int col_start, int col_num, int col) {
+  NNACL_CHECK_NULL_RETURN_ERR(epilogue);
+  NNACL_CHECK_NULL_RETURN_ERR(op_data);
+  NNACL_CHECK_NULL_RETURN_ERR(dst);
+  if (epilogue->op_num_ > MAX_EPILOGUE_OP_NUM) {
+    return NNACL_ERR;
+  }
+  for (int r = 0; r < row_num; ++r) {
+    int ret = EpilogueRow(epilogue, op_data, dst + (size_t)r * dst_stride, row_start + r, col_start, col_num, col);
+    if (ret != NNACL_OK) {
+      return ret;
+    }
+  }
+  return NNACL_OK;
+}
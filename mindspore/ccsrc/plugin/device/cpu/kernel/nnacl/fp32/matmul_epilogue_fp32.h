@@ -0,0 +1,38 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_EPILOGUE_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_EPILOGUE_FP32_H_
+
+#include "nnacl/op_base.h"
+#include "nnacl/matmul_parameter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+int MatmulEpilogueHasOperand(int op_type);
+// the number of the operands, which are the inputs of the matmul after the origin inputs.
+int MatmulEpilogueOperandNum(const MatmulEpilogue *epilogue);
+
+// Apply the epilogue to the tile of dst, whose first element is (row_start, col_start) of the output [row, col].
+// op_data holds the operand of each op of the epilogue, and it is NULL for the unary ops. The ops are applied row by
+// row, so the row of the tile stays in cache through the whole chain.
+int MatmulEpilogueFp32(const MatmulEpilogue *epilogue, const float *const *op_data, float *dst, int dst_stride,
+                       int row_start, int row_num, int col_start, int col_num, int col);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_EPILOGUE_FP32_H_
@@ -0,0 +1,394 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32_sparse/matmul_sparse_structured_fp32.h"
+#ifdef ENABLE_AVX512
+#include <x86intrin.h>
+#endif
+#ifdef ENABLE_ARM64
+#include <arm_neon.h>
+#endif
+
+static inline float SparseWeight(const float *b, int deep, int col, bool b_trans, int d, int j) {
+  return b_trans ? b[j * deep + d] : b[d * col + j];
+}
+
+#ifndef ENABLE_AVX512
+static inline float SparseAct(float value, ActType act_type) {
+  if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+    value = MSMAX(value, 0.0f);
+  }
+  if (act_type == ActType_Relu6) {
+    value = MSMIN(value, 6.0f);
+  }
+  return value;
+}
+
+static void SparseInitTile(float acc[SPARSE_ROW_TILE][SPARSE_COL_TILE], const float *bias, int cols) {
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    for (int i = 0; i < SPARSE_COL_TILE; i++) {
+      acc[r][i] = (bias != NULL && i < cols) ? bias[i] : 0.0f;
+    }
+  }
+}
+
+static void SparseStoreTile(float acc[SPARSE_ROW_TILE][SPARSE_COL_TILE], float *c, ActType act_type, int rows,
+                            int cols, int stride) {
+  for (int r = 0; r < rows; r++) {
+    for (int i = 0; i < cols; i++) {
+      c[r * stride + i] = SparseAct(acc[r][i], act_type);
+    }
+  }
+}
+#endif
+
+int SparseBlockCount(const float *b, int deep, int col, bool b_trans) {
+  int block_num = 0;
+  for (int j = 0; j < col; j += SPARSE_COL_TILE) {
+    int col_end = MSMIN(j + SPARSE_COL_TILE, col);
+    for (int d = 0; d < deep; d++) {
+      for (int jj = j; jj < col_end; jj++) {
+        if (SparseWeight(b, deep, col, b_trans, d, jj) != 0.0f) {
+          block_num++;
+          break;
+        }
+      }
+    }
+  }
+  return block_num;
+}
+
+size_t SparseBlockPackedSize(int col, int block_num) {
+  int tile_num = UP_DIV(col, SPARSE_COL_TILE);
+  return (size_t)block_num * SPARSE_COL_TILE * sizeof(float) + (size_t)(tile_num + 1 + block_num) * sizeof(int32_t);
+}
+
+void SparseBlockPack(const float *b, void *dst, int deep, int col, bool b_trans, int block_num) {
+  int tile_num = UP_DIV(col, SPARSE_COL_TILE);
+  float *values = (float *)dst;
+  int32_t *offsets = (int32_t *)(values + (size_t)block_num * SPARSE_COL_TILE);
+  int32_t *deep_index = offsets + tile_num + 1;
+  int index = 0;
+  for (int t = 0; t < tile_num; t++) {
+    offsets[t] = index;
+    int col_start = t * SPARSE_COL_TILE;
+    int cols = MSMIN(SPARSE_COL_TILE, col - col_start);
+    for (int d = 0; d < deep; d++) {
+      bool non_zero = false;
+      for (int i = 0; i < cols; i++) {
+        non_zero = non_zero || SparseWeight(b, deep, col, b_trans, d, col_start + i) != 0.0f;
+      }
+      if (!non_zero) {
+        continue;
+      }
+      float *value = values + (size_t)index * SPARSE_COL_TILE;
+      for (int i = 0; i < SPARSE_COL_TILE; i++) {
+        value[i] = i < cols ? SparseWeight(b, deep, col, b_trans, d, col_start + i) : 0.0f;
+      }
+      deep_index[index++] = d;
+    }
+  }
+  offsets[tile_num] = index;
+}
+
+#if defined(ENABLE_AVX512)
+static inline __m512 SparseActAvx512(__m512 value, ActType act_type) {
+  if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+    value = _mm512_max_ps(value, _mm512_setzero_ps());
+  }
+  if (act_type == ActType_Relu6) {
+    value = _mm512_min_ps(value, _mm512_set1_ps(6.0f));
+  }
+  return value;
+}
+
+static void SparseBlockTileAvx512(const float *a, const float *values, const int32_t *deep_index, int start, int end,
+                                  float *c, const float *bias, ActType act_type, int deep, int rows, int cols,
+                                  int stride) {
+  __mmask16 mask = (__mmask16)((1u << cols) - 1);
+  __m512 acc[SPARSE_ROW_TILE];
+  const float *a_row[SPARSE_ROW_TILE];
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    acc[r] = bias == NULL ? _mm512_setzero_ps() : _mm512_maskz_loadu_ps(mask, bias);
+    a_row[r] = a + MSMIN(r, rows - 1) * deep;
+  }
+  for (int i = start; i < end; i++) {
+    __m512 value = _mm512_loadu_ps(values + (size_t)i * SPARSE_COL_TILE);
+    int k = deep_index[i];
+    acc[0] = _mm512_fmadd_ps(_mm512_set1_ps(a_row[0][k]), value, acc[0]);
+    acc[1] = _mm512_fmadd_ps(_mm512_set1_ps(a_row[1][k]), value, acc[1]);
+    acc[2] = _mm512_fmadd_ps(_mm512_set1_ps(a_row[2][k]), value, acc[2]);
+    acc[3] = _mm512_fmadd_ps(_mm512_set1_ps(a_row[3][k]), value, acc[3]);
+  }
+  for (int r = 0; r < rows; r++) {
+    _mm512_mask_storeu_ps(c + r * stride, mask, SparseActAvx512(acc[r], act_type));
+  }
+}
+
+static void SparseNMTileAvx512(const float *a, const float *values, const uint8_t *index, float *c, const float *bias,
+                               ActType act_type, int deep, int rows, int cols, int stride, int n, int m) {
+  __mmask16 mask = (__mmask16)((1u << cols) - 1);
+  __mmask16 group_mask = (__mmask16)((1u << m) - 1);
+  __m512 acc[SPARSE_ROW_TILE];
+  const float *a_row[SPARSE_ROW_TILE];
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    acc[r] = bias == NULL ? _mm512_setzero_ps() : _mm512_maskz_loadu_ps(mask, bias);
+    a_row[r] = a + MSMIN(r, rows - 1) * deep;
+  }
+  int group_num = deep / m;
+  for (int g = 0; g < group_num; g++) {
+    // the m values of a group are selected by the index of every column.
+    __m512 group[SPARSE_ROW_TILE];
+    for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+      group[r] = _mm512_maskz_loadu_ps(group_mask, a_row[r] + g * m);
+    }
+    for (int s = 0; s < n; s++) {
+      size_t offset = ((size_t)g * n + s) * SPARSE_COL_TILE;
+      __m512 value = _mm512_loadu_ps(values + offset);
+      __m512i idx = _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i *)(index + offset)));
+      acc[0] = _mm512_fmadd_ps(_mm512_permutexvar_ps(idx, group[0]), value, acc[0]);
+      acc[1] = _mm512_fmadd_ps(_mm512_permutexvar_ps(idx, group[1]), value, acc[1]);
+      acc[2] = _mm512_fmadd_ps(_mm512_permutexvar_ps(idx, group[2]), value, acc[2]);
+      acc[3] = _mm512_fmadd_ps(_mm512_permutexvar_ps(idx, group[3]), value, acc[3]);
+    }
+  }
+  for (int r = 0; r < rows; r++) {
+    _mm512_mask_storeu_ps(c + r * stride, mask, SparseActAvx512(acc[r], act_type));
+  }
+}
+#elif defined(ENABLE_ARM64)
+#define SPARSE_C4_NUM (SPARSE_COL_TILE / C4NUM)
+static void SparseStoreTileNeon(float32x4_t acc[SPARSE_ROW_TILE][SPARSE_C4_NUM], float *c, ActType act_type,
+                                int rows, int cols, int stride) {
+  float tile[SPARSE_ROW_TILE][SPARSE_COL_TILE];
+  for (int r = 0; r < rows; r++) {
+    for (int p = 0; p < SPARSE_C4_NUM; p++) {
+      vst1q_f32(tile[r] + p * C4NUM, acc[r][p]);
+    }
+  }
+  SparseStoreTile(tile, c, act_type, rows, cols, stride);
+}
+
+static void SparseInitTileNeon(float32x4_t acc[SPARSE_ROW_TILE][SPARSE_C4_NUM], const float *bias, int cols) {
+  float tile[SPARSE_ROW_TILE][SPARSE_COL_TILE];
+  SparseInitTile(tile, bias, cols);
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    for (int p = 0; p < SPARSE_C4_NUM; p++) {
+      acc[r][p] = vld1q_f32(tile[r] + p * C4NUM);
+    }
+  }
+}
+
+static void SparseBlockTileNeon(const float *a, const float *values, const int32_t *deep_index, int start, int end,
+                                float *c, const float *bias, ActType act_type, int deep, int rows, int cols,
+                                int stride) {
+  float32x4_t acc[SPARSE_ROW_TILE][SPARSE_C4_NUM];
+  SparseInitTileNeon(acc, bias, cols);
+  const float *a_row[SPARSE_ROW_TILE];
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    a_row[r] = a + MSMIN(r, rows - 1) * deep;
+  }
+  for (int i = start; i < end; i++) {
+    const float *value = values + (size_t)i * SPARSE_COL_TILE;
+    float32x4_t v[SPARSE_C4_NUM] = {vld1q_f32(value), vld1q_f32(value + C4NUM), vld1q_f32(value + C8NUM),
+                                    vld1q_f32(value + C12NUM)};
+    int k = deep_index[i];
+    for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+      float a_value = a_row[r][k];
+      for (int p = 0; p < SPARSE_C4_NUM; p++) {
+        acc[r][p] = vfmaq_n_f32(acc[r][p], v[p], a_value);
+      }
+    }
+  }
+  SparseStoreTileNeon(acc, c, act_type, rows, cols, stride);
+}
+
+static void SparseNMTileNeon(const float *a, const float *values, const uint8_t *index, float *c, const float *bias,
+                             ActType act_type, int deep, int rows, int cols, int stride, int n, int m) {
+  static const uint8_t kLanePattern[C16NUM] = {0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3};
+  static const uint8_t kByteOffset[C16NUM] = {0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3};
+  float32x4_t acc[SPARSE_ROW_TILE][SPARSE_C4_NUM];
+  SparseInitTileNeon(acc, bias, cols);
+  const float *a_row[SPARSE_ROW_TILE];
+  for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+    a_row[r] = a + MSMIN(r, rows - 1) * deep;
+  }
+  uint8x16_t lane_pattern = vld1q_u8(kLanePattern);
+  uint8x16_t byte_offset = vld1q_u8(kByteOffset);
+  int group_num = deep / m;
+  for (int g = 0; g < group_num; g++) {
+    uint8x16x2_t group[SPARSE_ROW_TILE];
+    for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+      group[r].val[0] = vreinterpretq_u8_f32(vld1q_f32(a_row[r] + g * m));
+      group[r].val[1] = m == C8NUM ? vreinterpretq_u8_f32(vld1q_f32(a_row[r] + g * m + C4NUM)) : vdupq_n_u8(0);
+    }
+    for (int s = 0; s < n; s++) {
+      size_t offset = ((size_t)g * n + s) * SPARSE_COL_TILE;
+      uint8x16_t idx = vld1q_u8(index + offset);
+      for (int p = 0; p < SPARSE_C4_NUM; p++) {
+        // the byte index of the float selected by every lane.
+        uint8x16_t lane_idx = vqtbl1q_u8(idx, vaddq_u8(lane_pattern, vdupq_n_u8((uint8_t)(p * C4NUM))));
+        uint8x16_t byte_idx = vaddq_u8(vshlq_n_u8(lane_idx, 2), byte_offset);
+        float32x4_t v = vld1q_f32(values + offset + p * C4NUM);
+        for (int r = 0; r < SPARSE_ROW_TILE; r++) {
+          float32x4_t a_value = vreinterpretq_f32_u8(vqtbl2q_u8(group[r], byte_idx));
+          acc[r][p] = vfmaq_f32(acc[r][p], a_value, v);
+        }
+      }
+    }
+  }
+  SparseStoreTileNeon(acc, c, act_type, rows, cols, stride);
+}
+#else
+static void SparseBlockTileC(const float *a, const float *values, const int32_t *deep_index, int start, int end,
+                             float *c, const float *bias, ActType act_type, int deep, int rows, int cols, int stride) {
+  float acc[SPARSE_ROW_TILE][SPARSE_COL_TILE];
+  SparseInitTile(acc, bias, cols);
+  for (int i = start; i < end; i++) {
+    const float *value = values + (size_t)i * SPARSE_COL_TILE;
+    int k = deep_index[i];
+    for (int r = 0; r < rows; r++) {
+      float a_value = a[r * deep + k];
+      for (int j = 0; j < SPARSE_COL_TILE; j++) {
+        acc[r][j] += a_value * value[j];
+      }
+    }
+  }
+  SparseStoreTile(acc, c, act_type, rows, cols, stride);
+}
+
+static void SparseNMTileC(const float *a, const float *values, const uint8_t *index, float *c, const float *bias,
+                          ActType act_type, int deep, int rows, int cols, int stride, int n, int m) {
+  float acc[SPARSE_ROW_TILE][SPARSE_COL_TILE];
+  SparseInitTile(acc, bias, cols);
+  int group_num = deep / m;
+  for (int g = 0; g < group_num; g++) {
+    for (int s = 0; s < n; s++) {
+      size_t offset = ((size_t)g * n + s) * SPARSE_COL_TILE;
+      for (int r = 0; r < rows; r++) {
+        const float *group = a + r * deep + g * m;
+        for (int j = 0; j < SPARSE_COL_TILE; j++) {
+          acc[r][j] += group[index[offset + j]] * values[offset + j];
+        }
+      }
+    }
+  }
+  SparseStoreTile(acc, c, act_type, rows, cols, stride);
+}
+#endif
+
+void MatMulSparseBlockFp32(const float *a, const void *b, int block_num, float *c, const float *bias, ActType act_type,
+                           int deep, int row, int col, int col_start, int col_end, int stride) {
+  int tile_num = UP_DIV(col, SPARSE_COL_TILE);
+  const float *values = (const float *)b;
+  const int32_t *offsets = (const int32_t *)(values + (size_t)block_num * SPARSE_COL_TILE);
+  const int32_t *deep_index = offsets + tile_num + 1;
+  for (int j = col_start; j < col_end; j += SPARSE_COL_TILE) {
+    int t = j / SPARSE_COL_TILE;
+    int cols = MSMIN(SPARSE_COL_TILE, col_end - j);
+    const float *tile_bias = bias == NULL ? NULL : bias + j;
+    for (int r = 0; r < row; r += SPARSE_ROW_TILE) {
+      int rows = MSMIN(SPARSE_ROW_TILE, row - r);
+#if defined(ENABLE_AVX512)
+      SparseBlockTileAvx512(a + r * deep, values, deep_index, offsets[t], offsets[t + 1], c + r * stride + j, tile_bias,
+                            act_type, deep, rows, cols, stride);
+#elif defined(ENABLE_ARM64)
+      SparseBlockTileNeon(a + r * deep, values, deep_index, offsets[t], offsets[t + 1], c + r * stride + j, tile_bias,
+                          act_type, deep, rows, cols, stride);
+#else
+      SparseBlockTileC(a + r * deep, values, deep_index, offsets[t], offsets[t + 1], c + r * stride + j, tile_bias,
+                       act_type, deep, rows, cols, stride);
+#endif
+    }
+  }
+}
+
+bool SparseCheckNM(const float *b, int deep, int col, bool b_trans, int n, int m) {
+  if ((m != C4NUM && m != C8NUM) || n <= 0 || n >= m || deep % m != 0) {
+    return false;
+  }
+  for (int j = 0; j < col; j++) {
+    for (int g = 0; g < deep; g += m) {
+      int non_zero = 0;
+      for (int d = g; d < g + m; d++) {
+        non_zero += SparseWeight(b, deep, col, b_trans, d, j) != 0.0f ? 1 : 0;
+      }
+      if (non_zero > n) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+size_t SparseNMPackedSize(int deep, int col, int n, int m) {
+  size_t slot_num = (size_t)UP_DIV(col, SPARSE_COL_TILE) * (deep / m) * n * SPARSE_COL_TILE;
+  return slot_num * (sizeof(float) + sizeof(uint8_t));
+}
+
+void SparseNMPack(const float *b, void *dst, int deep, int col, bool b_trans, int n, int m) {
+  int tile_num = UP_DIV(col, SPARSE_COL_TILE);
+  int group_num = deep / m;
+  float *values = (float *)dst;
+  uint8_t *index = (uint8_t *)(values + (size_t)tile_num * group_num * n * SPARSE_COL_TILE);
+  for (int t = 0; t < tile_num; t++) {
+    for (int g = 0; g < group_num; g++) {
+      size_t offset = ((size_t)t * group_num + g) * n * SPARSE_COL_TILE;
+      for (int i = 0; i < SPARSE_COL_TILE; i++) {
+        int j = t * SPARSE_COL_TILE + i;
+        int s = 0;
+        for (int d = 0; d < m && j < col && s < n; d++) {
+          float weight = SparseWeight(b, deep, col, b_trans, g * m + d, j);
+          if (weight != 0.0f) {
+            values[offset + s * SPARSE_COL_TILE + i] = weight;
+            index[offset + s * SPARSE_COL_TILE + i] = (uint8_t)d;
+            s++;
+          }
+        }
+        for (; s < n; s++) {
+          values[offset + s * SPARSE_COL_TILE + i] = 0.0f;
+          index[offset + s * SPARSE_COL_TILE + i] = 0;
+        }
+      }
+    }
+  }
+}
+
+void MatMulSparseNMFp32(const float *a, const void *b, float *c, const float *bias, ActType act_type, int deep, int row,
+                        int col, int col_start, int col_end, int stride, int n, int m) {
+  int tile_num = UP_DIV(col, SPARSE_COL_TILE);
+  size_t tile_size = (size_t)(deep / m) * n * SPARSE_COL_TILE;
+  const float *values = (const float *)b;
+  const uint8_t *index = (const uint8_t *)(values + tile_num * tile_size);
+  for (int j = col_start; j < col_end; j += SPARSE_COL_TILE) {
+    int t = j / SPARSE_COL_TILE;
+    int cols = MSMIN(SPARSE_COL_TILE, col_end - j);
+    const float *tile_bias = bias == NULL ? NULL : bias + j;
+    for (int r = 0; r < row; r += SPARSE_ROW_TILE) {
+      int rows = MSMIN(SPARSE_ROW_TILE, row - r);
+#if defined(ENABLE_AVX512)
+      SparseNMTileAvx512(a + r * deep, values + t * tile_size, index + t * tile_size, c + r * stride + j, tile_bias,
+                         act_type, deep, rows, cols, stride, n, m);
+#elif defined(ENABLE_ARM64)
+      SparseNMTileNeon(a + r * deep, values + t * tile_size, index + t * tile_size, c + r * stride + j, tile_bias,
+                       act_type, deep, rows, cols, stride, n, m);
+#else
+      SparseNMTileC(a + r * deep, values + t * tile_size, index + t * tile_size, c + r * stride + j, tile_bias,
+                    act_type, deep, rows, cols, stride, n, m);
+#endif
+    }
+  }
+}
@@ -0,0 +1,53 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
+#define MINDSPORE_NNACL_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nnacl/op_base.h"
+
+// The weight b[deep, col] is compressed in the tiles of SPARSE_COL_TILE columns, and the kernels compute a tile of
+// SPARSE_ROW_TILE rows and SPARSE_COL_TILE columns at once, the a is row-major and not packed.
+#define SPARSE_COL_TILE 16
+#define SPARSE_ROW_TILE 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// Block sparse: a block is 1 deep x SPARSE_COL_TILE columns, only the non-zero blocks are stored. The packed data is
+// float values[block_num][SPARSE_COL_TILE], int32 offsets[col_tile_num + 1], int32 deep_index[block_num].
+int SparseBlockCount(const float *b, int deep, int col, bool b_trans);
+size_t SparseBlockPackedSize(int col, int block_num);
+void SparseBlockPack(const float *b, void *dst, int deep, int col, bool b_trans, int block_num);
+// Compute the columns [col_start, col_end), col_start is aligned to SPARSE_COL_TILE, and c is the start of output.
+void MatMulSparseBlockFp32(const float *a, const void *b, int block_num, float *c, const float *bias, ActType act_type,
+                           int deep, int row, int col, int col_start, int col_end, int stride);
+
+// N:M sparse: there are n non-zeros at most in each group of m along the deep of every column, deep is divisible by
+// m, and m is 4 or 8. The packed data is float values[col_tile_num][group][n][SPARSE_COL_TILE] and
+// uint8 index[col_tile_num][group][n][SPARSE_COL_TILE], the index is the position in the group.
+bool SparseCheckNM(const float *b, int deep, int col, bool b_trans, int n, int m);
+size_t SparseNMPackedSize(int deep, int col, int n, int m);
+void SparseNMPack(const float *b, void *dst, int deep, int col, bool b_trans, int n, int m);
+void MatMulSparseNMFp32(const float *a, const void *b, float *c, const float *bias, ActType act_type, int deep, int row,
+                        int col, int col_start, int col_end, int stride, int n, int m);
+#ifdef __cplusplus
+}
+#endif
+#endif  // MINDSPORE_NNACL_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
@@ -31,10 +31,19 @@ void Conv1x1Int8Opt(const int8_t *packed_input, const int8_t *packed_weight, int
 void Conv1x1Int8(const int8_t *packed_input, const int8_t *packed_weight, int8_t *dst, const int32_t *input_sum,
                  const int32_t *bias, int row, int col, int deep16, int32_t *left_shift, int32_t *right_shift,
                  int32_t *multiplier, ConvParameter *conv_param, const int32_t *filter_zp) {
+  Conv1x1Int8WithFunc(packed_input, packed_weight, dst, input_sum, bias, row, col, deep16, left_shift, right_shift,
+                      multiplier, conv_param, MatmulInt8Opt, filter_zp);
+  return;
+}
+
+void Conv1x1Int8WithFunc(const int8_t *packed_input, const int8_t *packed_weight, int8_t *dst,
+                         const int32_t *input_sum, const int32_t *bias, int row, int col, int deep16,
+                         int32_t *left_shift, int32_t *right_shift, int32_t *multiplier, ConvParameter *conv_param,
+                         MATMUL_OPT_INT8_FUNC matmul_func, const int32_t *filter_zp) {
   int is_per_oc = (int)conv_param->conv_quant_arg_.filter_arg_num_ != 1;
-  MatmulInt8Opt(packed_input, packed_weight, dst, row, col, deep16, input_sum, bias,
-                conv_param->conv_quant_arg_.out_act_min_[0], conv_param->conv_quant_arg_.out_act_max_[0],
-                conv_param->conv_quant_arg_.output_quant_args_[0].zp_, multiplier, left_shift, right_shift,
-                conv_param->output_channel_, is_per_oc, filter_zp);
+  matmul_func(packed_input, packed_weight, dst, row, col, deep16, input_sum, bias,
+              conv_param->conv_quant_arg_.out_act_min_[0], conv_param->conv_quant_arg_.out_act_max_[0],
+              conv_param->conv_quant_arg_.output_quant_args_[0].zp_, multiplier, left_shift, right_shift,
+              conv_param->output_channel_, is_per_oc, filter_zp);
   return;
 }
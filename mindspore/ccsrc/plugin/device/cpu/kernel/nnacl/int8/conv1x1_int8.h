@@ -34,6 +34,10 @@ extern "C" {
 void Conv1x1Int8(const int8_t *packed_input, const int8_t *packed_weight, int8_t *dst, const int32_t *input_sum,
                  const int32_t *bias, int row, int col, int deep16, int32_t *left_shift, int32_t *right_shift,
                  int32_t *multiplier, ConvParameter *conv_param, const int32_t *filter_zp);
+void Conv1x1Int8WithFunc(const int8_t *packed_input, const int8_t *packed_weight, int8_t *dst,
+                         const int32_t *input_sum, const int32_t *bias, int row, int col, int deep16,
+                         int32_t *left_shift, int32_t *right_shift, int32_t *multiplier, ConvParameter *conv_param,
+                         MATMUL_OPT_INT8_FUNC matmul_func, const int32_t *filter_zp);
 void Conv1x1Int8Opt(const int8_t *packed_input, const int8_t *packed_weight, int8_t *dst, const int32_t *input_sum,
                     const int32_t *bias, int row, int col, int deep4, int32_t *left_shift, int32_t *right_shift,
                     int32_t *multiplier, ConvParameter *conv_param, MATMUL_OPT_DP_FUNC matmul_func,
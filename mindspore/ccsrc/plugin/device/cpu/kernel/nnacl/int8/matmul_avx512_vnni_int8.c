@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/int8/matmul_avx512_vnni_int8.h"
+#ifdef ENABLE_AVX512
+#include <x86intrin.h>
+#include "nnacl/int8/matmul_int8.h"
+
+#define VNNI_COL_BLOCK_NUM 4
+#define VNNI_INPUT_OFFSET 128
+
+void MatmulInt8Avx512Vnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                          const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                          const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                          size_t stride, size_t filter_peroc, const int32_t *filter_zp) {
+  /*
+   * vpdpbusd multiplies the unsigned bytes by the signed bytes, so the input is offset by 128 to be unsigned, and the
+   * offset is removed by the column sums of the weight. One 4x16 block of the weight fills a zmm register, the 16
+   * bytes of one input row are broadcast to each 128-bit lane, so the 4 int32 of the same lane sum to one output.
+   * The tile is 4 rows and 4 weight blocks, the remaining blocks of the last tile reload the last valid block.
+   */
+  const __m512i sign_flip = _mm512_set1_epi8((char)0x80);
+  const __m512i ones = _mm512_set1_epi8(1);
+  const int deep_block = deep16 / C16NUM;
+  const int block_size = deep16 * C4NUM;
+  int32_t tile[C4NUM * VNNI_COL_BLOCK_NUM * C4NUM];
+  int32_t acc_data[C16NUM];
+  int32_t sum_data[C16NUM];
+  for (int r = 0; r < row; r += C4NUM) {
+    const int8_t *a_block = a + (r / C4NUM) * block_size;
+    for (int c = 0; c < col; c += VNNI_COL_BLOCK_NUM * C4NUM) {
+      int col_block_num = MSMIN(VNNI_COL_BLOCK_NUM, UP_DIV(col - c, C4NUM));
+      const int8_t *b_block[VNNI_COL_BLOCK_NUM];
+      for (int j = 0; j < VNNI_COL_BLOCK_NUM; j++) {
+        b_block[j] = b + (c / C4NUM + MSMIN(j, col_block_num - 1)) * block_size;
+      }
+      __m512i acc[C4NUM][VNNI_COL_BLOCK_NUM];
+      __m512i b_sum[VNNI_COL_BLOCK_NUM];
+      for (int j = 0; j < VNNI_COL_BLOCK_NUM; j++) {
+        b_sum[j] = _mm512_setzero_si512();
+        for (int i = 0; i < C4NUM; i++) {
+          acc[i][j] = _mm512_setzero_si512();
+        }
+      }
+      for (int d = 0; d < deep_block; d++) {
+        __m512i a_data[C4NUM];
+        for (int i = 0; i < C4NUM; i++) {
+          __m128i a_row = _mm_loadu_si128((const __m128i *)(a_block + d * C4NUM * C16NUM + i * C16NUM));
+          a_data[i] = _mm512_xor_si512(_mm512_broadcast_i32x4(a_row), sign_flip);
+        }
+        for (int j = 0; j < VNNI_COL_BLOCK_NUM; j++) {
+          __m512i b_data = _mm512_loadu_si512((const void *)(b_block[j] + d * C4NUM * C16NUM));
+          b_sum[j] = _mm512_dpbusd_epi32(b_sum[j], ones, b_data);
+          for (int i = 0; i < C4NUM; i++) {
+            acc[i][j] = _mm512_dpbusd_epi32(acc[i][j], a_data[i], b_data);
+          }
+        }
+      }
+      for (int j = 0; j < col_block_num; j++) {
+        _mm512_storeu_si512((void *)sum_data, b_sum[j]);
+        for (int i = 0; i < C4NUM; i++) {
+          _mm512_storeu_si512((void *)acc_data, acc[i][j]);
+          for (int k = 0; k < C4NUM; k++) {
+            int32_t value = 0;
+            int32_t b_value = 0;
+            for (int l = 0; l < C4NUM; l++) {
+              value += acc_data[k * C4NUM + l];
+              b_value += sum_data[k * C4NUM + l];
+            }
+            tile[i * VNNI_COL_BLOCK_NUM * C4NUM + j * C4NUM + k] = value - VNNI_INPUT_OFFSET * b_value;
+          }
+        }
+      }
+      MatmulInt8TileRequant(tile, VNNI_COL_BLOCK_NUM * C4NUM, dst, r, c, MSMIN(C4NUM, row - r),
+                            MSMIN(VNNI_COL_BLOCK_NUM * C4NUM, col - c), a_sums, bias, act_min, act_max, out_zp,
+                            multiplier, left_shift, right_shift, stride, filter_peroc, filter_zp);
+    }
+  }
+}
+#endif
@@ -0,0 +1,36 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_INT8_MATMUL_AVX512_VNNI_INT8_H_
+#define MINDSPORE_NNACL_INT8_MATMUL_AVX512_VNNI_INT8_H_
+
+#include "nnacl/op_base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#ifdef ENABLE_AVX512
+/* row4x16-major * row16x4-major => (int8)row-major, the same as MatmulInt8Opt */
+void MatmulInt8Avx512Vnni(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                          const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                          const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                          size_t stride, size_t filter_peroc, const int32_t *filter_zp);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_INT8_MATMUL_AVX512_VNNI_INT8_H_
@@ -330,6 +330,30 @@ void MatmulInt8Opt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int c
   return;
 }
 #endif
+
+void MatmulInt8TileRequant(const int32_t *tile, int tile_stride, int8_t *dst, int row_offset, int col_offset,
+                           int row_num, int col_num, const int32_t *a_sums, const int32_t *bias, int mini, int maxi,
+                           int out_zp, const int32_t *multiplier, const int32_t *left_shift,
+                           const int32_t *right_shift, size_t stride, size_t filter_peroc, const int32_t *filter_zp) {
+  for (int i = 0; i < row_num; i++) {
+    int r = row_offset + i;
+    for (int j = 0; j < col_num; j++) {
+      int c = col_offset + j;
+      int32_t value = tile[i * tile_stride + j];
+      int32_t cur_input_sum = filter_peroc ? a_sums[r] * filter_zp[c] : a_sums[r];
+      value -= cur_input_sum;
+      value += bias[c];
+      int32_t cur_left_shift = filter_peroc ? left_shift[c] : left_shift[0];
+      int32_t cur_right_shift = filter_peroc ? right_shift[c] : right_shift[0];
+      int32_t cur_multiplier = filter_peroc ? multiplier[c] : multiplier[0];
+      value = MultiplyByQuantizedMultiplier(value, cur_multiplier, cur_left_shift, cur_right_shift) + out_zp;
+      value = MSMIN(maxi, value);
+      value = MSMAX(mini, value);
+      dst[(int64_t)r * stride + c] = (int8_t)value;
+    }
+  }
+}
+
 void MatMulInt8_8x8_r(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
                       size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
                       const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
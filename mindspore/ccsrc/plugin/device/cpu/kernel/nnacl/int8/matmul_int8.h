@@ -45,6 +45,11 @@ void MatmulInt8Opt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int c
                    const int32_t *bias, int act_min, int act_max, int out_zp, const int32_t *multiplier,
                    const int32_t *left_shift, const int32_t *right_shift, size_t stride, size_t filter_peroc,
                    const int32_t *filter_zp);
+/* requantize the int32 accumulators of a tile which starts at (row_offset, col_offset), used by the isa kernels */
+void MatmulInt8TileRequant(const int32_t *tile, int tile_stride, int8_t *dst, int row_offset, int col_offset,
+                           int row_num, int col_num, const int32_t *a_sums, const int32_t *bias, int mini, int maxi,
+                           int out_zp, const int32_t *multiplier, const int32_t *left_shift,
+                           const int32_t *right_shift, size_t stride, size_t filter_peroc, const int32_t *filter_zp);
 /* 8x4 4x8 -> 8x8 */
 /* optimize conv */
 void RowMajor2Row8x4MajorInt8(const int8_t *src_ptr, int8_t *dst_ptr, int row, int col);
@@ -0,0 +1,107 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef ENABLE_ARM64
+#include <arm_neon.h>
+#include "nnacl/op_base.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+
+#define BFMMLA_ROW_TILE 4
+#define BFMMLA_COL_PAIR_NUM 4
+
+static inline float32x4_t BfmmlaActivation(float32x4_t src, int act_type) {
+  if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+    src = vmaxq_f32(src, vdupq_n_f32(0.0f));
+  }
+  if (act_type == ActType_Relu6) {
+    src = vminq_f32(src, vdupq_n_f32(6.0f));
+  }
+  return src;
+}
+
+void MatMulBf16BfmmlaFp32(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep,
+                          int row, int col, int stride) {
+  /*
+   * (fp32)row-major * (bf16)col8x4-major => (fp32)row-major.
+   * bfmmla multiplies a 2x4 block of the input by a 4x2 block of the weight into a 2x2 fp32 block, the input of two
+   * rows is converted to bf16 on the fly. The tile is 4 rows and 8 columns, the rows out of the tile compute the last
+   * row again and are not stored.
+   */
+  const int deep_align = UP_ROUND(deep, MATMUL_BF16_BFMMLA_DEEP_TILE);
+  const int block_size = deep_align * MATMUL_BF16_BFMMLA_COL_TILE;
+  float tile[BFMMLA_ROW_TILE * MATMUL_BF16_BFMMLA_COL_TILE];
+  float bias_tile[MATMUL_BF16_BFMMLA_COL_TILE];
+  float a_tail[BFMMLA_ROW_TILE][MATMUL_BF16_BFMMLA_DEEP_TILE];
+  for (int n = 0; n < col; n += MATMUL_BF16_BFMMLA_COL_TILE) {
+    int col_num = MSMIN(MATMUL_BF16_BFMMLA_COL_TILE, col - n);
+    const bfloat16_t *b_block = (const bfloat16_t *)(b + (n / MATMUL_BF16_BFMMLA_COL_TILE) * block_size);
+    for (int j = 0; j < MATMUL_BF16_BFMMLA_COL_TILE; j++) {
+      bias_tile[j] = (bias == NULL || j >= col_num) ? 0.0f : bias[n + j];
+    }
+    for (int r = 0; r < row; r += BFMMLA_ROW_TILE) {
+      int row_num = MSMIN(BFMMLA_ROW_TILE, row - r);
+      const float *a_row[BFMMLA_ROW_TILE];
+      for (int i = 0; i < BFMMLA_ROW_TILE; i++) {
+        a_row[i] = a + (r + MSMIN(i, row_num - 1)) * deep;
+      }
+      /* acc[row pair][column pair] holds {r0c0, r0c1, r1c0, r1c1} */
+      float32x4_t acc[C2NUM][BFMMLA_COL_PAIR_NUM];
+      for (int k = 0; k < BFMMLA_COL_PAIR_NUM; k++) {
+        float32x2_t bias_pair = vld1_f32(bias_tile + k * C2NUM);
+        acc[0][k] = vcombine_f32(bias_pair, bias_pair);
+        acc[1][k] = acc[0][k];
+      }
+      for (int d = 0; d < deep; d += MATMUL_BF16_BFMMLA_DEEP_TILE) {
+        const float *a_ptr[BFMMLA_ROW_TILE];
+        for (int i = 0; i < BFMMLA_ROW_TILE; i++) {
+          a_ptr[i] = a_row[i] + d;
+        }
+        if (d + MATMUL_BF16_BFMMLA_DEEP_TILE > deep) {
+          for (int i = 0; i < BFMMLA_ROW_TILE; i++) {
+            for (int k = 0; k < MATMUL_BF16_BFMMLA_DEEP_TILE; k++) {
+              a_tail[i][k] = d + k < deep ? a_row[i][d + k] : 0.0f;
+            }
+            a_ptr[i] = a_tail[i];
+          }
+        }
+        bfloat16x8_t a_val[C2NUM];
+        for (int i = 0; i < C2NUM; i++) {
+          bfloat16x8_t low = vcvtq_low_bf16_f32(vld1q_f32(a_ptr[C2NUM * i]));
+          a_val[i] = vcvtq_high_bf16_f32(low, vld1q_f32(a_ptr[C2NUM * i + 1]));
+        }
+        const bfloat16_t *b_ptr = b_block + d * MATMUL_BF16_BFMMLA_COL_TILE;
+        for (int k = 0; k < BFMMLA_COL_PAIR_NUM; k++) {
+          bfloat16x8_t b_val = vld1q_bf16(b_ptr + k * C8NUM);
+          acc[0][k] = vbfmmlaq_f32(acc[0][k], a_val[0], b_val);
+          acc[1][k] = vbfmmlaq_f32(acc[1][k], a_val[1], b_val);
+        }
+      }
+      for (int i = 0; i < C2NUM; i++) {
+        float *tile_row = tile + C2NUM * i * MATMUL_BF16_BFMMLA_COL_TILE;
+        for (int k = 0; k < BFMMLA_COL_PAIR_NUM; k += C2NUM) {
+          float32x4_t row0 = vcombine_f32(vget_low_f32(acc[i][k]), vget_low_f32(acc[i][k + 1]));
+          float32x4_t row1 = vcombine_f32(vget_high_f32(acc[i][k]), vget_high_f32(acc[i][k + 1]));
+          vst1q_f32(tile_row + k * C2NUM, BfmmlaActivation(row0, act_type));
+          vst1q_f32(tile_row + MATMUL_BF16_BFMMLA_COL_TILE + k * C2NUM, BfmmlaActivation(row1, act_type));
+        }
+      }
+      for (int i = 0; i < row_num; i++) {
+        memcpy(c + (r + i) * stride + n, tile + i * MATMUL_BF16_BFMMLA_COL_TILE, col_num * sizeof(float));
+      }
+    }
+  }
+}
+#endif
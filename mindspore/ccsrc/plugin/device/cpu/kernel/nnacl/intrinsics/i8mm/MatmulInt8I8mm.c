@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef ENABLE_ARM64
+#include <arm_neon.h>
+#include "nnacl/op_base.h"
+#include "nnacl/int8/matmul_int8.h"
+
+#define I8MM_COL_BLOCK_NUM 2
+
+static inline int8x16_t ZipLowInt8x8(int8x16_t x, int8x16_t y) {
+  return vreinterpretq_s8_s64(vzip1q_s64(vreinterpretq_s64_s8(x), vreinterpretq_s64_s8(y)));
+}
+
+static inline int8x16_t ZipHighInt8x8(int8x16_t x, int8x16_t y) {
+  return vreinterpretq_s8_s64(vzip2q_s64(vreinterpretq_s64_s8(x), vreinterpretq_s64_s8(y)));
+}
+
+void MatmulInt8I8mmOpt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                       const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                       const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                       size_t filter_peroc, const int32_t *filter_zp) {
+  /*
+   * row4x16-major * row16x4-major => (int8)row-major, the same layout as MatmulInt8Opt.
+   * smmla multiplies a 2x8 block of the input by a 8x2 block of the weight into a 2x2 int32 block, so the 16 bytes of
+   * two rows are interleaved by 8 bytes before the multiply. The tile is 4 rows and 2 weight blocks of 4 columns, the
+   * remaining block of the last tile reloads the last valid block.
+   */
+  const int deep_block = deep16 / C16NUM;
+  const int block_size = deep16 * C4NUM;
+  int32_t tile[C4NUM * I8MM_COL_BLOCK_NUM * C4NUM];
+  for (int r = 0; r < row; r += C4NUM) {
+    const int8_t *a_block = a + (r / C4NUM) * block_size;
+    for (int c = 0; c < col; c += I8MM_COL_BLOCK_NUM * C4NUM) {
+      int col_block_num = MSMIN(I8MM_COL_BLOCK_NUM, UP_DIV(col - c, C4NUM));
+      const int8_t *b_block[I8MM_COL_BLOCK_NUM];
+      for (int j = 0; j < I8MM_COL_BLOCK_NUM; j++) {
+        b_block[j] = b + (c / C4NUM + MSMIN(j, col_block_num - 1)) * block_size;
+      }
+      /* acc[row pair][weight block][column pair] holds {r0c0, r0c1, r1c0, r1c1} */
+      int32x4_t acc[C2NUM][I8MM_COL_BLOCK_NUM][C2NUM];
+      for (int i = 0; i < C2NUM; i++) {
+        for (int j = 0; j < I8MM_COL_BLOCK_NUM; j++) {
+          acc[i][j][0] = vdupq_n_s32(0);
+          acc[i][j][1] = vdupq_n_s32(0);
+        }
+      }
+      for (int d = 0; d < deep_block; d++) {
+        const int8_t *a_ptr = a_block + d * C4NUM * C16NUM;
+        int8x16_t a0 = vld1q_s8(a_ptr);
+        int8x16_t a1 = vld1q_s8(a_ptr + C16NUM);
+        int8x16_t a2 = vld1q_s8(a_ptr + C2NUM * C16NUM);
+        int8x16_t a3 = vld1q_s8(a_ptr + C3NUM * C16NUM);
+        int8x16_t a_low[C2NUM] = {ZipLowInt8x8(a0, a1), ZipLowInt8x8(a2, a3)};
+        int8x16_t a_high[C2NUM] = {ZipHighInt8x8(a0, a1), ZipHighInt8x8(a2, a3)};
+        for (int j = 0; j < I8MM_COL_BLOCK_NUM; j++) {
+          const int8_t *b_ptr = b_block[j] + d * C4NUM * C16NUM;
+          int8x16_t b0 = vld1q_s8(b_ptr);
+          int8x16_t b1 = vld1q_s8(b_ptr + C16NUM);
+          int8x16_t b2 = vld1q_s8(b_ptr + C2NUM * C16NUM);
+          int8x16_t b3 = vld1q_s8(b_ptr + C3NUM * C16NUM);
+          int8x16_t b_low[C2NUM] = {ZipLowInt8x8(b0, b1), ZipLowInt8x8(b2, b3)};
+          int8x16_t b_high[C2NUM] = {ZipHighInt8x8(b0, b1), ZipHighInt8x8(b2, b3)};
+          for (int i = 0; i < C2NUM; i++) {
+            for (int k = 0; k < C2NUM; k++) {
+              acc[i][j][k] = vmmlaq_s32(acc[i][j][k], a_low[i], b_low[k]);
+              acc[i][j][k] = vmmlaq_s32(acc[i][j][k], a_high[i], b_high[k]);
+            }
+          }
+        }
+      }
+      for (int i = 0; i < C2NUM; i++) {
+        for (int j = 0; j < col_block_num; j++) {
+          int64x2_t cols01 = vreinterpretq_s64_s32(acc[i][j][0]);
+          int64x2_t cols23 = vreinterpretq_s64_s32(acc[i][j][1]);
+          int32_t *tile_row = tile + C2NUM * i * I8MM_COL_BLOCK_NUM * C4NUM + j * C4NUM;
+          vst1q_s32(tile_row, vreinterpretq_s32_s64(vzip1q_s64(cols01, cols23)));
+          vst1q_s32(tile_row + I8MM_COL_BLOCK_NUM * C4NUM, vreinterpretq_s32_s64(vzip2q_s64(cols01, cols23)));
+        }
+      }
+      MatmulInt8TileRequant(tile, I8MM_COL_BLOCK_NUM * C4NUM, dst, r, c, MSMIN(C4NUM, row - r),
+                            MSMIN(I8MM_COL_BLOCK_NUM * C4NUM, col - c), a_sums, bias, act_min, act_max, out_zp,
+                            multiplier, left_shift, right_shift, stride, filter_peroc, filter_zp);
+    }
+  }
+}
+#endif
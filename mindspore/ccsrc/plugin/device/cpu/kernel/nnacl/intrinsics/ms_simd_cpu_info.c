@@ -28,6 +28,8 @@ struct X86CpuInfoContext {
   bool sse4_1_flag_;
   bool avx2_flag_;
   bool avx512_flag_;
+  bool avx512_vnni_flag_;
+  bool avx512_bf16_flag_;
 };
 
 static struct X86CpuInfoContext g_x86_cpu_info_context_;
@@ -58,18 +60,35 @@ inline const bool X86_Avx512_Support(void) {
 #endif
 }
 
-void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+inline const bool X86_Avx512Vnni_Support(void) {
+#ifdef ENABLE_AVX512
+  return g_x86_cpu_info_context_.avx512_flag_ && g_x86_cpu_info_context_.avx512_vnni_flag_;
+#else
+  return false;
+#endif
+}
+
+inline const bool X86_Avx512Bf16_Support(void) {
+#ifdef ENABLE_AVX512
+  return g_x86_cpu_info_context_.avx512_flag_ && g_x86_cpu_info_context_.avx512_bf16_flag_;
+#else
+  return false;
+#endif
+}
+
+void ExecuteCpuIdSubCmd(DWORD cmd_code, DWORD sub_cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data,
+                        DWORD *edx_data) {
   DWORD deax, debx, decx, dedx;
   asm volatile(
     "movl %4, %%eax;\n"
-    "movl $0, %%ecx;\n"
+    "movl %5, %%ecx;\n"
     "cpuid;\n"
     "movl %%eax, %0;\n"
     "movl %%ebx, %1;\n"
     "movl %%ecx, %2;\n"
     "movl %%edx, %3;\n"
     : "=r"(deax), "=r"(debx), "=r"(decx), "=r"(dedx)
-    : "r"(cmd_code)
+    : "r"(cmd_code), "r"(sub_cmd_code)
     : "%eax", "%ebx", "%ecx", "%edx");
 
   *eax_data = deax;
@@ -78,6 +97,10 @@ void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ec
   *edx_data = dedx;
 }
 
+void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
+  ExecuteCpuIdSubCmd(cmd_code, 0, eax_data, ebx_data, ecx_data, edx_data);
+}
+
 bool IsIntelX86Platform(void) {
   DWORD eax_data, ebx_data, ecx_data, edx_data;
 
@@ -109,6 +132,10 @@ int IntelX86CpuInfoInit(void) {
   ExecuteCpuIdCmd(7, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, execute cpuid to get avx2/avx512 flag
   g_x86_cpu_info_context_.avx2_flag_ = (ebx_data & (1 << 5)) == 0 ? false : true;     // avx2 flag is ecx 5 bit
   g_x86_cpu_info_context_.avx512_flag_ = (ebx_data & (1 << 16)) == 0 ? false : true;  // avx512 flag is ecx 16 bit
+  g_x86_cpu_info_context_.avx512_vnni_flag_ = (ecx_data & (1 << 11)) == 0 ? false : true;  // vnni flag is ecx 11 bit
+  // eax = 7 and ecx = 1, execute cpuid to get avx512 bf16 flag, which is eax 5 bit
+  ExecuteCpuIdSubCmd(7, 1, &eax_data, &ebx_data, &ecx_data, &edx_data);
+  g_x86_cpu_info_context_.avx512_bf16_flag_ = (eax_data & (1 << 5)) == 0 ? false : true;
 
   return NNACL_OK;
 }
@@ -48,6 +48,8 @@ const bool X86_Fma_Support(void);
 const bool X86_Sse_Support(void);
 const bool X86_Avx_Support(void);
 const bool X86_Avx512_Support(void);
+const bool X86_Avx512Vnni_Support(void);
+const bool X86_Avx512Bf16_Support(void);
 
 bool IsIntelX86Platform(void);
 X86CpuInfoErrorCodeEnum IntelX86InstructionSetSupportCheck(void);
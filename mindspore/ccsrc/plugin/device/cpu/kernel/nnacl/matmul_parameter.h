@@ -33,8 +33,44 @@ typedef void (*MATMUL_OPT_DP_FUNC)(const int8_t *a, const int8_t *b, int8_t *dst
                                    int32_t output_zp, int32_t mini, int32_t maxi, size_t per_channel,
                                    const int32_t *filter_zp);
 
+typedef void (*MATMUL_OPT_INT8_FUNC)(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                                     const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                                     const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                                     size_t stride, size_t filter_peroc, const int32_t *filter_zp);
+
 typedef enum OutType { OutType_C8 = 0, OutType_Nhwc = 1, OutType_TileC8 = 2, OutType_NC4HW4 = 3 } OutType;
 
+#define MAX_EPILOGUE_OP_NUM 8
+
+// the elementwise ops fused after the matmul, which are applied to the output tile before it is written back.
+typedef enum EpilogueOpType {
+  EpilogueOp_Add = 0,
+  EpilogueOp_Mul = 1,
+  EpilogueOp_Relu = 2,
+  EpilogueOp_Relu6 = 3,
+  EpilogueOp_Sigmoid = 4,
+  EpilogueOp_Gelu = 5,
+  EpilogueOp_GeluTanh = 6
+} EpilogueOpType;
+
+// how the operand of add and mul is broadcast to the output [row, col].
+typedef enum EpilogueBroadcastType {
+  EpilogueBroadcast_None = 0,   // the operand is [row, col]
+  EpilogueBroadcast_Col = 1,    // the operand is [col]
+  EpilogueBroadcast_Scalar = 2  // the operand is one element
+} EpilogueBroadcastType;
+
+typedef struct EpilogueOp {
+  int type_;
+  int input_index_;  // the index of the operand in the inputs of the matmul, only valid for add and mul
+  int broadcast_;
+} EpilogueOp;
+
+typedef struct MatmulEpilogue {
+  EpilogueOp ops_[MAX_EPILOGUE_OP_NUM];
+  int op_num_;
+} MatmulEpilogue;
+
 typedef struct MatMulParameter {
   // Primitive parameter
   OpParameter op_parameter_;
@@ -63,6 +99,7 @@ typedef struct MatMulParameter {
   ActType act_type_;
   bool use_axis_;
   int axis_;
+  MatmulEpilogue epilogue_;
 } MatMulParameter;
 
 typedef struct MatmulQuantParameter {
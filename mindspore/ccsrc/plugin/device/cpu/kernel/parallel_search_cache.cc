@@ -0,0 +1,140 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/parallel_search_cache.h"
+#include <fstream>
+#include <sstream>
+#include <nlohmann/json.hpp>
+#include "include/common/debug/common.h"
+#include "include/common/utils/anfalgo.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr char kParallelSearchFileEnv[] = "MS_DEV_CPU_PARALLEL_SEARCH_FILE";
+thread_local const CNodePtr *launching_kernel = nullptr;
+}  // namespace
+
+ParallelSearchCache::ParallelSearchCache() {
+  cache_file_ = common::GetEnv(kParallelSearchFileEnv);
+  enable_ = !cache_file_.empty();
+  if (enable_) {
+    std::ifstream cache_fs(cache_file_);
+    if (!cache_fs.is_open()) {
+      MS_LOG(INFO) << "The parallel search file: " << cache_file_ << " does not exist, search from scratch.";
+      return;
+    }
+    cache_fs.close();
+    (void)Import(cache_file_);
+  }
+}
+
+LaunchingKernelGuard::LaunchingKernelGuard(const CNodePtr *kernel) { launching_kernel = kernel; }
+
+LaunchingKernelGuard::~LaunchingKernelGuard() { launching_kernel = nullptr; }
+
+std::string ParallelSearchCache::GenerateKey(size_t count, size_t thread_num) const {
+  if (launching_kernel == nullptr || *launching_kernel == nullptr) {
+    return "";
+  }
+  const auto &kernel = *launching_kernel;
+  std::ostringstream key;
+  key << common::AnfAlgo::GetCNodeName(kernel);
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+  for (size_t i = 0; i < input_num; ++i) {
+    key << ";" << TypeIdToString(AnfAlgo::GetInputDeviceDataType(kernel, i)) << "[";
+    for (auto dim : AnfAlgo::GetInputDeviceShape(kernel, i)) {
+      key << dim << ",";
+    }
+    key << "]";
+  }
+  key << ";" << count << ";" << thread_num;
+  return key.str();
+}
+
+bool ParallelSearchCache::Get(const std::string &key, size_t *best_pow) {
+  MS_EXCEPTION_IF_NULL(best_pow);
+  if (!enable_ || key.empty()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto &iter = best_pows_.find(key);
+  if (iter == best_pows_.end()) {
+    return false;
+  }
+  *best_pow = iter->second;
+  return true;
+}
+
+void ParallelSearchCache::Put(const std::string &key, size_t best_pow) {
+  if (!enable_ || key.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  best_pows_[key] = best_pow;
+}
+
+bool ParallelSearchCache::Import(const std::string &file) {
+  std::ifstream cache_fs(file);
+  if (!cache_fs.is_open()) {
+    MS_LOG(WARNING) << "Open the parallel search file: " << file << " failed.";
+    return false;
+  }
+  nlohmann::json cache_json;
+  mindspore::HashMap<std::string, size_t> best_pows;
+  try {
+    cache_fs >> cache_json;
+    for (auto iter = cache_json.begin(); iter != cache_json.end(); ++iter) {
+      best_pows[iter.key()] = iter.value().get<size_t>();
+    }
+  } catch (std::exception &e) {
+    MS_LOG(WARNING) << "Parse the parallel search file: " << file << " failed: " << e.what();
+    return false;
+  }
+  cache_fs.close();
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto &best_pow : best_pows) {
+    best_pows_[best_pow.first] = best_pow.second;
+  }
+  MS_LOG(INFO) << "Import the parallel search results of " << best_pows.size() << " kernels from the file: " << file;
+  return true;
+}
+
+bool ParallelSearchCache::Export(const std::string &file) {
+  nlohmann::json cache_json = nlohmann::json::object();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &best_pow : best_pows_) {
+      cache_json[best_pow.first] = best_pow.second;
+    }
+  }
+  if (!Common::SaveStringToFile(file, cache_json.dump())) {
+    MS_LOG(WARNING) << "Export the parallel search file: " << file << " failed.";
+    return false;
+  }
+  return true;
+}
+
+void ParallelSearchCache::Save() {
+  if (!enable_) {
+    return;
+  }
+  (void)Export(cache_file_);
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
+
+#include <string>
+#include <mutex>
+#include "ir/anf.h"
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace kernel {
+// The parallel search cache records the best block size searched by ParallelLaunchAutoSearch, which is keyed by the
+// kernel type, the input shapes and dtypes, the parallel count and the kernel thread number. The block size is stored
+// as the power of two which the count is divided by, and the kernel of the cached key skips the search.
+// The records are loaded from and saved to the file of env MS_DEV_CPU_PARALLEL_SEARCH_FILE, and the cache is
+// disabled when the env is not set. The records can also be exported to and imported from the other files, so the
+// searched results are shared by the identical servers.
+class BACKEND_EXPORT ParallelSearchCache {
+ public:
+  static ParallelSearchCache &GetInstance() {
+    static ParallelSearchCache instance;
+    return instance;
+  }
+
+  bool enable() const { return enable_; }
+
+  // Generate the key of the kernel launched by the current thread, empty if no such kernel.
+  std::string GenerateKey(size_t count, size_t thread_num) const;
+
+  bool Get(const std::string &key, size_t *best_pow);
+  void Put(const std::string &key, size_t best_pow);
+
+  bool Import(const std::string &file);
+  bool Export(const std::string &file);
+  // Save the records to the cache file, which is used by the later running.
+  void Save();
+
+ private:
+  ParallelSearchCache();
+  ~ParallelSearchCache() = default;
+  DISABLE_COPY_AND_ASSIGN(ParallelSearchCache);
+
+  bool enable_{false};
+  std::string cache_file_;
+  std::mutex mutex_;
+  mindspore::HashMap<std::string, size_t> best_pows_;
+};
+
+// Set the kernel launched by the current thread in the scope of the guard, which the key is generated from.
+class BACKEND_EXPORT LaunchingKernelGuard {
+ public:
+  explicit LaunchingKernelGuard(const CNodePtr *kernel);
+  ~LaunchingKernelGuard();
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_KERNEL_PARALLEL_SEARCH_CACHE_H_
@@ -52,8 +52,8 @@ bool FIFOReplayBuffer::Push(const std::vector<AddressPtr> &inputs) {
     MS_LOG(EXCEPTION) << "Transition element num error. Expect " << schema_.size() << " , but got " << inputs.size();
   }
 
-  // Head point to the latest item.
-  head_ = head_ >= capacity_ ? 0 : head_ + 1;
+  // Head point to the latest item, it starts from -1 and wraps to 0 after the last slot of the capacity.
+  head_ = head_ + 1 >= capacity_ ? 0 : head_ + 1;
   size_ = size_ >= capacity_ ? capacity_ : size_ + 1;
 
   return Emplace(head_, inputs);
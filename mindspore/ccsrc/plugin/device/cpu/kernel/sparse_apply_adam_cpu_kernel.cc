@@ -289,6 +289,7 @@ bool SparseApplyAdamCpuKernelMod::LaunchKernel(const std::vector<kernel::Address
   param.output_grad_ = &unique_sparse_grad;
   param.max_index_ = var_first_dim_size_;
   param.value_stride_ = var_outer_dim_size_;
+  param.use_sort_reduce_ = true;
   BucketReduceSparseGradient(param);
 
   size_t total_dim_size = var_first_dim_size_ * var_outer_dim_size_;
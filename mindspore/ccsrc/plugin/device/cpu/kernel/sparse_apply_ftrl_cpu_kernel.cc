@@ -263,6 +263,7 @@ bool FusedSparseFtrlCpuKernelMod::LaunchKernel(const std::vector<kernel::Address
   param.output_grad_ = &unique_sparse_grad;
   param.max_index_ = var_first_dim_size_;
   param.value_stride_ = var_outer_dim_size_;
+  param.use_sort_reduce_ = true;
   BucketReduceSparseGradient(param);
 
   MultiThreadComputeParams<T> input_params;
@@ -264,6 +264,7 @@ bool SparseApplyLazyAdamCpuKernelMod::LaunchKernel(const std::vector<kernel::Add
   param.output_grad_ = &unique_sparse_grad;
   param.max_index_ = var_first_dim_size_;
   param.value_stride_ = var_outer_dim_size_;
+  param.use_sort_reduce_ = true;
   BucketReduceSparseGradient(param);
 
   lr = lr * std::sqrt(1 - beta2_power) / (1 - beta1_power);
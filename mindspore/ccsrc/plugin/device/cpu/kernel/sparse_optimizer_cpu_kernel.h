@@ -17,6 +17,8 @@
 #ifndef MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_SPARSE_OPTIMIZER_CPU_KERNEL_H_
 #define MINDSPORE_CCSRC_BACKEND_KERNEL_COMPILER_CPU_SPARSE_OPTIMIZER_CPU_KERNEL_H_
 
+#include <array>
+#include <climits>
 #include <vector>
 #include <memory>
 #include <unordered_map>
@@ -41,6 +43,8 @@ struct ReduceSparseGradientParam {
   SparseGradient<T> *output_grad_{nullptr};
   size_t max_index_{0};
   size_t value_stride_{0};
+  // reduce each bucket by the radix sort instead of the hash map, the unique indices of each bucket are sorted, so
+  // the rows are updated in the order of the memory.
   bool use_sort_reduce_{false};
 };
 
@@ -283,6 +287,35 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
     ParallelLaunch(tasks);
   }
 
+  // Sort the pairs of (index, global index) by the index with the LSD radix sort, the indices are in [0, max_index).
+  // The sort is stable, so the values of the same index are summed in the order of the input.
+  template <typename T>
+  static void RadixSortIndices(size_t max_index, std::vector<std::pair<T, T>> *sorted_indices) {
+    MS_EXCEPTION_IF_NULL(sorted_indices);
+    constexpr size_t kRadixBits = 8;
+    constexpr size_t kRadixSize = 1 << kRadixBits;
+    constexpr size_t kRadixMask = kRadixSize - 1;
+    std::vector<std::pair<T, T>> buffer(sorted_indices->size());
+    auto src = sorted_indices;
+    auto dst = &buffer;
+    for (size_t shift = 0; shift < sizeof(size_t) * CHAR_BIT && (max_index >> shift) > 0; shift += kRadixBits) {
+      std::array<size_t, kRadixSize + 1> offsets{};
+      for (const auto &index_pair : *src) {
+        ++offsets[((static_cast<size_t>(index_pair.first) >> shift) & kRadixMask) + 1];
+      }
+      for (size_t i = 1; i <= kRadixSize; ++i) {
+        offsets[i] += offsets[i - 1];
+      }
+      for (const auto &index_pair : *src) {
+        (*dst)[offsets[(static_cast<size_t>(index_pair.first) >> shift) & kRadixMask]++] = index_pair;
+      }
+      std::swap(src, dst);
+    }
+    if (src != sorted_indices) {
+      sorted_indices->swap(buffer);
+    }
+  }
+
   template <typename T>
   static void SortAndReduceBucketSparseGradient(const MultiThreadReduceSparseGradientParam<T> &param,
                                                 const std::shared_ptr<BucketSparseGradient<T>> &bucket,
@@ -301,7 +334,7 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
       T global_index = bucket->global_indices_[i];
       (void)sorted_indices.emplace_back(std::pair<T, T>(index, global_index));
     }
-    std::sort(sorted_indices.begin(), sorted_indices.end());
+    RadixSortIndices<T>(param.max_index_, &sorted_indices);
 
     float *global_value = param.input_grad_->value_;
     size_t unique_indices_size = 0;
@@ -330,7 +363,7 @@ class SparseOptimizerCpuKernelMod : public NativeCpuKernelMod {
       }
       last_index = index;
     }
-    reduced_bucket->indices_size_ = unique_indices_size;
+    reduced_bucket->indices_size_ = sorted_indices.empty() ? 0 : unique_indices_size + 1;
     MS_LOG(DEBUG) << "End";
   }
 
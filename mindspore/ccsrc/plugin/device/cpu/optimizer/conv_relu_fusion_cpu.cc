@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/optimizer/conv_relu_fusion_cpu.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "backend/common/optimizer/helper.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+#include "mindspore/core/ops/core_ops.h"
+
+namespace mindspore {
+namespace opt {
+const BaseRef ConvReluFusionCPU::DefinePattern() const {
+  VectorRef relu = VectorRef({prim::kPrimRelu, VectorRef({prim::kPrimConv2D, x_, w_})});
+  return relu;
+}
+
+const AnfNodePtr ConvReluFusionCPU::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                            const EquivPtr &equiv) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  MS_EXCEPTION_IF_NULL(equiv);
+  auto x = utils::cast<AnfNodePtr>((*equiv)[x_]);
+  auto w = utils::cast<AnfNodePtr>((*equiv)[w_]);
+  MS_EXCEPTION_IF_NULL(x);
+  MS_EXCEPTION_IF_NULL(w);
+
+  auto conv = common::AnfAlgo::GetInputNode(utils::cast<CNodePtr>(node), 0)->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(conv);
+  // The output of conv before the activation can't be used by the others.
+  auto users = GetRealNodeUsedList(graph, conv);
+  if (users->size() > 1 || common::AnfAlgo::HasNodeAttr(kAttrFusedActivation, conv)) {
+    return nullptr;
+  }
+  if (AnfAlgo::GetOutputDeviceDataType(conv, 0) != kNumberTypeFloat32 ||
+      AnfAlgo::GetOutputDeviceDataType(node, 0) != kNumberTypeFloat32) {
+    return nullptr;
+  }
+
+  auto conv_prim = common::AnfAlgo::GetCNodePrimitive(conv);
+  MS_EXCEPTION_IF_NULL(conv_prim);
+  auto prim = std::make_shared<Primitive>(*conv_prim);
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim), x, w};
+  auto conv_relu = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(conv_relu);
+  conv_relu->set_abstract(node->abstract());
+  conv_relu->set_scope(conv->scope());
+  common::AnfAlgo::SetNodeAttr(kAttrFusedActivation, MakeValue<std::string>(kReluOpName), conv_relu);
+  AnfAlgo::SetSelectKernelBuildInfo(AnfAlgo::GetSelectKernelBuildInfo(conv), conv_relu.get());
+  MS_LOG(DEBUG) << "Fuse " << node->fullname_with_scope() << " into " << conv->fullname_with_scope();
+  return conv_relu;
+}
+}  // namespace opt
+}  // namespace mindspore
@@ -0,0 +1,43 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_CONV_RELU_FUSION_CPU_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_CONV_RELU_FUSION_CPU_H_
+
+#include <memory>
+#include "backend/common/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// Fuse the ReLU into the Conv2D which is only used by the ReLU, the mkldnn conv kernel applies the activation by
+// the post-op of the primitive, so the output of the conv isn't written and read again by the ReLU kernel.
+class ConvReluFusionCPU : public PatternProcessPass {
+ public:
+  explicit ConvReluFusionCPU(bool multigraph = true) : PatternProcessPass("conv_relu_fusion_cpu", multigraph) {
+    x_ = std::make_shared<Var>();
+    w_ = std::make_shared<Var>();
+  }
+  ~ConvReluFusionCPU() override = default;
+  const BaseRef DefinePattern() const override;
+  const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const override;
+
+ private:
+  VarPtr x_;
+  VarPtr w_;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_OPTIMIZER_CONV_RELU_FUSION_CPU_H_
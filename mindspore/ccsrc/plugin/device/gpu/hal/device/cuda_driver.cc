@@ -15,6 +15,7 @@
  */
 
 #include "plugin/device/gpu/hal/device/cuda_driver.h"
+#include <string>
 #include "utils/log_adapter.h"
 #include "include/common/utils/convert_utils.h"
 
@@ -198,6 +199,15 @@ bool CudaDriver::RecordEvent(CudaDeviceEvent event, CudaDeviceStream stream) {
   return true;
 }
 
+bool CudaDriver::StreamWaitEvent(const CudaDeviceStream &stream, const CudaDeviceEvent &event) {
+  auto ret = cudaStreamWaitEvent((cudaStream_t)stream, (cudaEvent_t)event, 0);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaStreamWaitEvent failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
 bool CudaDriver::SyncEvent(const CudaDeviceEvent &event) {
   auto ret = cudaEventSynchronize((cudaEvent_t)event);
   if (ret != cudaSuccess) {
@@ -229,6 +239,207 @@ bool CudaDriver::ElapsedTime(float *cost_time, const CudaDeviceEvent &start, con
   }
 }
 
+bool CudaDriver::BeginStreamCapture(const CudaDeviceStream &stream) {
+  // The thread local mode forbids the unsafe calls such as cudaMalloc in the capture thread, which makes the capture
+  // fail instead of getting the wrong graph.
+  auto ret = cudaStreamBeginCapture((cudaStream_t)stream, cudaStreamCaptureModeThreadLocal);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaStreamBeginCapture failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::EndStreamCapture(const CudaDeviceStream &stream, CudaGraph *graph) {
+  auto ret = cudaStreamEndCapture((cudaStream_t)stream, reinterpret_cast<cudaGraph_t *>(graph));
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaStreamEndCapture failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::InstantiateGraph(const CudaGraph &graph, CudaGraphExec *graph_exec) {
+#if CUDART_VERSION >= 12000
+  auto ret = cudaGraphInstantiate(reinterpret_cast<cudaGraphExec_t *>(graph_exec), (cudaGraph_t)graph, 0);
+#else
+  auto ret =
+    cudaGraphInstantiate(reinterpret_cast<cudaGraphExec_t *>(graph_exec), (cudaGraph_t)graph, nullptr, nullptr, 0);
+#endif
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaGraphInstantiate failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::UpdateGraphExec(const CudaGraphExec &graph_exec, const CudaGraph &graph) {
+#if CUDART_VERSION >= 12000
+  cudaGraphExecUpdateResultInfo result_info;
+  auto ret = cudaGraphExecUpdate((cudaGraphExec_t)graph_exec, (cudaGraph_t)graph, &result_info);
+#elif CUDART_VERSION >= 10020
+  cudaGraphNode_t error_node = nullptr;
+  cudaGraphExecUpdateResult result;
+  auto ret = cudaGraphExecUpdate((cudaGraphExec_t)graph_exec, (cudaGraph_t)graph, &error_node, &result);
+#else
+  auto ret = cudaErrorNotSupported;
+#endif
+  if (ret != cudaSuccess) {
+    MS_LOG(INFO) << "cudaGraphExecUpdate failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    // Clear the error of failed update, the graph exec will be instantiated again.
+    (void)cudaGetLastError();
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::LaunchGraph(const CudaGraphExec &graph_exec, const CudaDeviceStream &stream) {
+  auto ret = cudaGraphLaunch((cudaGraphExec_t)graph_exec, (cudaStream_t)stream);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaGraphLaunch failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::DestroyGraph(const CudaGraph &graph) {
+  auto ret = cudaGraphDestroy((cudaGraph_t)graph);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaGraphDestroy failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::DestroyGraphExec(const CudaGraphExec &graph_exec) {
+  auto ret = cudaGraphExecDestroy((cudaGraphExec_t)graph_exec);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaGraphExecDestroy failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+namespace {
+bool GetCurrentMemLocation(CUmemAllocationProp *prop) {
+  int device_id = 0;
+  auto ret = cudaGetDevice(&device_id);
+  if (ret != cudaSuccess) {
+    MS_LOG(ERROR) << "cudaGetDevice failed, ret[" << static_cast<int>(ret) << "], " << cudaGetErrorString(ret);
+    return false;
+  }
+  prop->type = CU_MEM_ALLOCATION_TYPE_PINNED;
+  prop->location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  prop->location.id = device_id;
+  return true;
+}
+
+std::string CuErrorString(CUresult ret) {
+  const char *msg = nullptr;
+  (void)cuGetErrorString(ret, &msg);
+  return msg == nullptr ? "unknown error" : std::string(msg);
+}
+}  // namespace
+
+bool CudaDriver::IsVirtualMemSupported() {
+  int device_id = 0;
+  if (cudaGetDevice(&device_id) != cudaSuccess) {
+    return false;
+  }
+  CUdevice device;
+  if (cuDeviceGet(&device, device_id) != CUDA_SUCCESS) {
+    return false;
+  }
+  int supported = 0;
+  auto ret = cuDeviceGetAttribute(&supported, CU_DEVICE_ATTRIBUTE_VIRTUAL_ADDRESS_MANAGEMENT_SUPPORTED, device);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(WARNING) << "cuDeviceGetAttribute failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  return supported != 0;
+}
+
+size_t CudaDriver::VirtualMemGranularity() {
+  CUmemAllocationProp prop = {};
+  if (!GetCurrentMemLocation(&prop)) {
+    return 0;
+  }
+  size_t granularity = 0;
+  auto ret = cuMemGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemGetAllocationGranularity failed, ret[" << static_cast<int>(ret) << "], "
+                  << CuErrorString(ret);
+    return 0;
+  }
+  return granularity;
+}
+
+bool CudaDriver::ReserveVirtualMem(size_t size, DeviceMemPtr *addr) {
+  MS_EXCEPTION_IF_NULL(addr);
+  CUdeviceptr device_ptr = 0;
+  auto ret = cuMemAddressReserve(&device_ptr, size, 0, 0, 0);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemAddressReserve failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  *addr = reinterpret_cast<DeviceMemPtr>(device_ptr);
+  return true;
+}
+
+bool CudaDriver::FreeVirtualMem(const DeviceMemPtr &addr, size_t size) {
+  auto ret = cuMemAddressFree(reinterpret_cast<CUdeviceptr>(addr), size);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemAddressFree failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::MapPhysicalMem(const DeviceMemPtr &addr, size_t size, CudaMemHandle *handle) {
+  MS_EXCEPTION_IF_NULL(handle);
+  CUmemAllocationProp prop = {};
+  if (!GetCurrentMemLocation(&prop)) {
+    return false;
+  }
+  auto ret = cuMemCreate(handle, size, &prop, 0);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(WARNING) << "cuMemCreate failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  auto device_ptr = reinterpret_cast<CUdeviceptr>(addr);
+  ret = cuMemMap(device_ptr, size, 0, *handle, 0);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemMap failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    (void)cuMemRelease(*handle);
+    return false;
+  }
+  CUmemAccessDesc access_desc = {};
+  access_desc.location = prop.location;
+  access_desc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+  ret = cuMemSetAccess(device_ptr, size, &access_desc, 1);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemSetAccess failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    (void)cuMemUnmap(device_ptr, size);
+    (void)cuMemRelease(*handle);
+    return false;
+  }
+  return true;
+}
+
+bool CudaDriver::UnmapPhysicalMem(const DeviceMemPtr &addr, size_t size, const CudaMemHandle &handle) {
+  auto ret = cuMemUnmap(reinterpret_cast<CUdeviceptr>(addr), size);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemUnmap failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  ret = cuMemRelease(handle);
+  if (ret != CUDA_SUCCESS) {
+    MS_LOG(ERROR) << "cuMemRelease failed, ret[" << static_cast<int>(ret) << "], " << CuErrorString(ret);
+    return false;
+  }
+  return true;
+}
+
 int CudaDriver::device_count() {
   auto last_error = cudaGetLastError();
   if (last_error != cudaSuccess) {
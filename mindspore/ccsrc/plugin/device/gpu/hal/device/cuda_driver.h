@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_CUDA_DRIVER_H_
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_CUDA_DRIVER_H_
 
+#include <cuda.h>
 #include <cuda_runtime_api.h>
 
 namespace mindspore {
@@ -26,6 +27,9 @@ typedef void *CudaDeviceStream;
 typedef void *CudaDeviceEvent;
 typedef void *HostMemPtr;
 typedef void *DeviceMemPtr;
+typedef CUmemGenericAllocationHandle CudaMemHandle;
+typedef void *CudaGraph;
+typedef void *CudaGraphExec;
 
 class CudaDriver {
  public:
@@ -49,6 +53,15 @@ class CudaDriver {
   static size_t total_mem_size();
   static size_t free_mem_size();
 
+  // Encapsulate the cuda virtual memory management APIs, which reserve the virtual address range and map the physical
+  // memory to it on demand.
+  static bool IsVirtualMemSupported();
+  static size_t VirtualMemGranularity();
+  static bool ReserveVirtualMem(size_t size, DeviceMemPtr *addr);
+  static bool FreeVirtualMem(const DeviceMemPtr &addr, size_t size);
+  static bool MapPhysicalMem(const DeviceMemPtr &addr, size_t size, CudaMemHandle *handle);
+  static bool UnmapPhysicalMem(const DeviceMemPtr &addr, size_t size, const CudaMemHandle &handle);
+
   // Encapsulate the cuda APIs associated with device resource
   // such as Stream and Event.
   static bool CreateStream(CudaDeviceStream *stream);
@@ -58,10 +71,23 @@ class CudaDriver {
   static bool CreateEvent(CudaDeviceEvent *event, unsigned int flag = cudaEventDefault);
   static bool DestroyEvent(const CudaDeviceEvent &event);
   static bool RecordEvent(CudaDeviceEvent event, CudaDeviceStream stream = 0);
+  static bool StreamWaitEvent(const CudaDeviceStream &stream, const CudaDeviceEvent &event);
   static bool SyncEvent(const CudaDeviceEvent &event);
   static bool QueryEvent(const CudaDeviceEvent &event);
   static bool ElapsedTime(float *cost_time, const CudaDeviceEvent &start, const CudaDeviceEvent &end);
 
+  // Encapsulate the cuda graph APIs, which capture the kernels launched on the stream to a cuda graph and replay the
+  // instantiated graph with one launch.
+  static bool BeginStreamCapture(const CudaDeviceStream &stream);
+  static bool EndStreamCapture(const CudaDeviceStream &stream, CudaGraph *graph);
+  static bool InstantiateGraph(const CudaGraph &graph, CudaGraphExec *graph_exec);
+  // Update the kernel params of graph exec by the new captured graph with the same topology, return false if the
+  // topology is changed and the graph needs to be instantiated again.
+  static bool UpdateGraphExec(const CudaGraphExec &graph_exec, const CudaGraph &graph);
+  static bool LaunchGraph(const CudaGraphExec &graph_exec, const CudaDeviceStream &stream);
+  static bool DestroyGraph(const CudaGraph &graph);
+  static bool DestroyGraphExec(const CudaGraphExec &graph_exec);
+
   // Encapsulate the cuda APIs associated with device management.
   static int device_count();
   static bool SetDevice(int index);
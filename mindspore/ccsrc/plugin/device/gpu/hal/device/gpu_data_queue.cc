@@ -99,13 +99,26 @@ BlockQueueStatus_T GpuQueue::Push(std::vector<DataQueueItem> data) {
                        "configure dynamic dims of input data before running the network";
       return ERROR_INPUT;
     }
-
-    CHECK_CUDA_RET_WITH_ERROR(cudaMemcpyAsync(addr, item.data_ptr_, item.data_len_, cudaMemcpyHostToDevice, stream_),
-                              "Cuda Memcpy Error");
     item.device_addr_ = addr;
     addr = reinterpret_cast<uint8_t *>(addr) + item.data_len_;
   }
 
+  // The items of a node are contiguous on device, so the items staged contiguously on host are copied together.
+  size_t i = 0;
+  while (i < data.size()) {
+    auto host_addr = reinterpret_cast<uint8_t *>(data[i].data_ptr_);
+    size_t copy_len = data[i].data_len_;
+    size_t j = i + 1;
+    while (j < data.size() && data[j].data_ptr_ == host_addr + copy_len) {
+      copy_len += data[j].data_len_;
+      ++j;
+    }
+    CHECK_CUDA_RET_WITH_ERROR(
+      cudaMemcpyAsync(data[i].device_addr_, host_addr, copy_len, cudaMemcpyHostToDevice, stream_),
+      "Cuda Memcpy Error");
+    i = j;
+  }
+
   node_info_[tail_].event_.reset(new cudaEvent_t());
   CHECK_CUDA_RET_WITH_ERROR(cudaEventCreate(&(*(node_info_[tail_].event_))), "Cuda Create Event Failed");
   CHECK_CUDA_RET_WITH_ERROR(cudaEventRecord(*(node_info_[tail_].event_), stream_), "Cuda Create Event Failed");
@@ -22,6 +22,7 @@
 #include "ir/tensor.h"
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
 #include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+#include "plugin/device/gpu/hal/device/gpu_pinned_mem_pool.h"
 #include "plugin/device/gpu/hal/hardware/gpu_device_context.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
 #ifdef ENABLE_DEBUGGER
@@ -36,6 +37,28 @@
 namespace mindspore {
 namespace device {
 namespace gpu {
+namespace {
+// The async copy from the pageable host memory is staged by the driver and blocks the host thread, so stage the host
+// data to the pinned memory to make the copy really asynchronous. The pinned memory is freed after the copy finished.
+bool CopyHostMemToDeviceAsyncByPinnedMem(const DeviceMemPtr &dst, const void *src, size_t size, void *stream) {
+  auto &pinned_mem_pool = GPUPinnedMemPool::GetInstance();
+  auto pinned_ptr = pinned_mem_pool.AllocPinnedMem(size);
+  if (pinned_ptr == nullptr) {
+    return GPUDeviceManager::GetInstance().CopyHostMemToDeviceAsync(dst, src, size, stream);
+  }
+  auto ret = memcpy_s(pinned_ptr, size, src, size);
+  if (ret != EOK) {
+    MS_LOG(INFO) << "Memcpy to the pinned memory failed, errno[" << ret << "], size: " << size
+                 << ", copy from the host memory directly.";
+    pinned_mem_pool.FreePinnedMem(pinned_ptr);
+    return GPUDeviceManager::GetInstance().CopyHostMemToDeviceAsync(dst, src, size, stream);
+  }
+  bool result = GPUDeviceManager::GetInstance().CopyHostMemToDeviceAsync(dst, pinned_ptr, size, stream);
+  pinned_mem_pool.FreePinnedMemAfterStream(pinned_ptr, stream);
+  return result;
+}
+}  // namespace
+
 bool GPUDeviceAddress::SyncDeviceToHost(size_t size, void *host_ptr) const {
   // The input or output may be empty.
   if ((size == 0) || (size_ == 0)) {
@@ -132,7 +155,7 @@ bool GPUDeviceAddress::SyncHostToDevice(const ShapeVector &, size_t size, TypeId
   }
   auto &stream = GPUDeviceManager::GetInstance().default_stream();
   MS_EXCEPTION_IF_NULL(stream);
-  return GPUDeviceManager::GetInstance().CopyHostMemToDeviceAsync(ptr_, host_ptr, size, stream);
+  return CopyHostMemToDeviceAsyncByPinnedMem(ptr_, host_ptr, size, stream);
 }
 
 bool GPUDeviceAddress::SyncDeviceToDevice(const DeviceSync *src_device_addr) const {
@@ -171,7 +194,7 @@ bool GPUDeviceAddress::AsyncHostToDevice(const ShapeVector &, size_t size, TypeI
   MS_ERROR_IF_NULL(ptr_);
   MS_ERROR_IF_NULL(stream);
 
-  CHECK_RET_WITH_RETURN_ERROR(CudaDriver::CopyHostMemToDeviceAsync(ptr_, host_ptr, size, stream),
+  CHECK_RET_WITH_RETURN_ERROR(CopyHostMemToDeviceAsyncByPinnedMem(ptr_, host_ptr, size, stream),
                               "CopyHostMemToDeviceAsync failed");
   return true;
 }
@@ -50,6 +50,89 @@ bool GPUMemoryAllocator::Init() {
   } else {
     SetMemPoolBlockSize(std::min(available_device_memory_, total_size));
   }
+  if (common::GetEnv("MS_DEV_GPU_EXPANDABLE_SEGMENTS") == "1") {
+    InitExpandableSegment();
+  }
+  return true;
+}
+
+void GPUMemoryAllocator::InitExpandableSegment() {
+  if (!CudaDriver::IsVirtualMemSupported()) {
+    MS_LOG(WARNING) << "The GPU device doesn't support the virtual memory management, the expandable segment is "
+                    << "disabled.";
+    return;
+  }
+  segment_granularity_ = CudaDriver::VirtualMemGranularity();
+  if (segment_granularity_ == 0) {
+    return;
+  }
+  size_t reserved_size = std::min(available_device_memory_, CudaDriver::total_mem_size());
+  reserved_size = (reserved_size + segment_granularity_ - 1) / segment_granularity_ * segment_granularity_;
+  if (!CudaDriver::ReserveVirtualMem(reserved_size, &segment_base_addr_)) {
+    MS_LOG(WARNING) << "Reserve the virtual memory of size " << reserved_size
+                    << " failed, the expandable segment is disabled.";
+    return;
+  }
+  segment_reserved_size_ = reserved_size;
+  segment_mapped_size_ = 0;
+  enable_expandable_segment_ = true;
+  MS_LOG(INFO) << "Enable the GPU expandable segment, reserved virtual memory size " << segment_reserved_size_
+               << ", granularity " << segment_granularity_ << ".";
+}
+
+void GPUMemoryAllocator::FinalizeExpandableSegment() {
+  if (!enable_expandable_segment_) {
+    return;
+  }
+  for (const auto &mapped_mem : segment_mapped_mem_) {
+    (void)CudaDriver::UnmapPhysicalMem(mapped_mem.first, mapped_mem.second.first, mapped_mem.second.second);
+  }
+  segment_mapped_mem_.clear();
+  (void)CudaDriver::FreeVirtualMem(segment_base_addr_, segment_reserved_size_);
+  segment_base_addr_ = nullptr;
+  segment_reserved_size_ = 0;
+  segment_mapped_size_ = 0;
+  enable_expandable_segment_ = false;
+}
+
+size_t GPUMemoryAllocator::AllocExpandableMem(size_t size, DeviceMemPtr *addr) {
+  MS_EXCEPTION_IF_NULL(addr);
+  size_t map_size = (size + segment_granularity_ - 1) / segment_granularity_ * segment_granularity_;
+  if (segment_mapped_size_ + map_size > segment_reserved_size_) {
+    MS_LOG(WARNING) << "The expandable segment is not enough: reserved size[" << segment_reserved_size_
+                    << "], mapped size[" << segment_mapped_size_ << "], required size[" << map_size << "].";
+    return 0;
+  }
+  auto map_addr = AddressOffset(segment_base_addr_, segment_mapped_size_);
+  CudaMemHandle handle;
+  if (!CudaDriver::MapPhysicalMem(map_addr, map_size, &handle)) {
+    return 0;
+  }
+  segment_mapped_mem_[map_addr] = std::make_pair(map_size, handle);
+  segment_mapped_size_ += map_size;
+  *addr = map_addr;
+  return map_size;
+}
+
+bool GPUMemoryAllocator::FreeExpandableMem(const DeviceMemPtr &addr) {
+  auto iter = segment_mapped_mem_.find(addr);
+  if (iter == segment_mapped_mem_.end()) {
+    return false;
+  }
+  auto map_size = iter->second.first;
+  if (!CudaDriver::UnmapPhysicalMem(addr, map_size, iter->second.second)) {
+    MS_LOG(EXCEPTION) << "Unmap the physical memory[" << addr << "] of size[" << map_size << "] failed.";
+  }
+  (void)segment_mapped_mem_.erase(iter);
+  // Only the tail of segment can be mapped again, the whole segment is reusable after all the memory is freed.
+  if (segment_mapped_mem_.empty()) {
+    segment_mapped_size_ = 0;
+  } else {
+    const auto &last_mem = segment_mapped_mem_.rbegin();
+    segment_mapped_size_ =
+      static_cast<size_t>(static_cast<uint8_t *>(last_mem->first) - static_cast<uint8_t *>(segment_base_addr_)) +
+      last_mem->second.first;
+  }
   return true;
 }
 
@@ -72,17 +155,38 @@ bool GPUMemoryAllocator::Finalize() {
       return false;
     }
   }
+  FinalizeExpandableSegment();
   return true;
 }
 
 bool GPUMemoryAllocator::AllocBufferQueueMem(size_t size, DeviceMemPtr *addr) {
-  auto alloc_size = AllocDeviceMem(size, addr);
+  // The buffer queue memory is freed by cudaFree, so it can't be allocated from the expandable segment.
+  auto alloc_size = AllocCudaMem(size, addr);
   buffer_q_addr_ = *addr;
   // Buffer queue needs to ensure that the alloc_size and size is equal.
   return alloc_size == size;
 }
 
 size_t GPUMemoryAllocator::AllocDeviceMem(size_t size, DeviceMemPtr *addr) {
+  if (!enable_expandable_segment_) {
+    return AllocCudaMem(size, addr);
+  }
+  if (size == 0) {
+    MS_LOG(EXCEPTION) << "The memory alloc size is 0.";
+  }
+  auto alloc_size = AllocExpandableMem(size, addr);
+  if (alloc_size == 0) {
+    MS_LOG(EXCEPTION) << "Alloc device memory[" << size << "] from the expandable segment failed.";
+  }
+  total_used_device_memory_ += alloc_size;
+  available_device_memory_ -= std::min(available_device_memory_, alloc_size);
+  MS_LOG(INFO) << "Expandable segment alloc size[" << alloc_size << "], mapped size[" << segment_mapped_size_
+               << "], reserved size[" << segment_reserved_size_ << "]. Total used size[" << total_used_device_memory_
+               << "].";
+  return alloc_size;
+}
+
+size_t GPUMemoryAllocator::AllocCudaMem(size_t size, DeviceMemPtr *addr) {
   if (size == 0) {
     MS_LOG(EXCEPTION) << "The memory alloc size is 0.";
   }
@@ -104,7 +208,12 @@ size_t GPUMemoryAllocator::AllocDeviceMem(size_t size, DeviceMemPtr *addr) {
   return alloc_size;
 }
 
-bool GPUMemoryAllocator::FreeDeviceMem(const DeviceMemPtr &addr) { return CudaDriver::FreeDeviceMem(addr); }
+bool GPUMemoryAllocator::FreeDeviceMem(const DeviceMemPtr &addr) {
+  if (enable_expandable_segment_ && FreeExpandableMem(addr)) {
+    return true;
+  }
+  return CudaDriver::FreeDeviceMem(addr);
+}
 
 size_t GPUMemoryAllocator::free_mem_size() { return std::min(CudaDriver::free_mem_size(), available_device_memory_); }
 }  // namespace gpu
@@ -17,7 +17,10 @@
 #ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_GPU_MEMORY_ALLOCATOR_H_
 #define MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_GPU_MEMORY_ALLOCATOR_H_
 
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include "plugin/device/gpu/hal/device/cuda_driver.h"
 #include "common/mem_reuse/mem_dynamic_allocator.h"
 
@@ -35,20 +38,42 @@ class GPUMemoryAllocator : public DynamicMemPoolBestFit {
   size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override;
   bool FreeDeviceMem(const DeviceMemPtr &addr) override;
   size_t free_mem_size() override;
+  std::string GetMemPoolName() const override { return "GPU"; }
 
   static GPUMemoryAllocator &GetInstance() {
     static GPUMemoryAllocator instance;
     return instance;
   }
 
+ protected:
+  bool IsExpandableSegment() const override { return enable_expandable_segment_; }
+
  private:
   GPUMemoryAllocator() = default;
+  // Alloc the device memory by cudaMalloc.
+  size_t AllocCudaMem(size_t size, DeviceMemPtr *addr);
+  // Reserve the virtual address range of the max available memory for the expandable segment.
+  void InitExpandableSegment();
+  void FinalizeExpandableSegment();
+  // Map the physical memory to the tail of the expandable segment, so the memory blocks of pool are contiguous and
+  // can be coalesced.
+  size_t AllocExpandableMem(size_t size, DeviceMemPtr *addr);
+  bool FreeExpandableMem(const DeviceMemPtr &addr);
   GPUMemoryAllocator(const GPUMemoryAllocator &) = delete;
   GPUMemoryAllocator &operator=(const GPUMemoryAllocator &) = delete;
 
   // Used to track address of data buffer queue.
   DeviceMemPtr buffer_q_addr_{nullptr};
 
+  // The expandable segment is enabled by the environment variable MS_DEV_GPU_EXPANDABLE_SEGMENTS=1.
+  bool enable_expandable_segment_{false};
+  DeviceMemPtr segment_base_addr_{nullptr};
+  size_t segment_reserved_size_{0};
+  size_t segment_mapped_size_{0};
+  size_t segment_granularity_{0};
+  // The mapped physical memory in the expandable segment: address -> (size, handle).
+  std::map<DeviceMemPtr, std::pair<size_t, CudaMemHandle>> segment_mapped_mem_;
+
   float limited_device_memory_{0.0};
   size_t total_used_device_memory_{0};
   size_t available_device_memory_{0};
@@ -16,6 +16,7 @@
 
 #include "plugin/device/gpu/hal/device/gpu_memory_manager.h"
 #include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+#include "plugin/device/gpu/hal/device/gpu_pinned_mem_pool.h"
 #include "utils/ms_context.h"
 #include "include/common/utils/convert_utils.h"
 #include "ps/ps_cache/ps_cache_manager.h"
@@ -83,7 +84,14 @@ void GPUMemoryManager::Initialize() {
   FreeMemFromMemPool(device_addr);
 }
 
-void GPUMemoryManager::Finalize() { GPUMemoryAllocator::GetInstance().ReleaseDeviceRes(); }
+void GPUMemoryManager::Finalize() {
+  GPUMemoryAllocator::GetInstance().ReleaseDeviceRes();
+  GPUPinnedMemPool::GetInstance().Finalize();
+}
+
+void *GPUMemoryManager::MallocHostMem(size_t size) { return GPUPinnedMemPool::GetInstance().AllocPinnedMem(size); }
+
+void GPUMemoryManager::FreeHostMem(void *host_ptr) { GPUPinnedMemPool::GetInstance().FreePinnedMem(host_ptr); }
 
 uint8_t *GPUMemoryManager::MallocStaticMem(size_t size, bool, uint32_t) {
   auto context_ptr = MsContext::GetInstance();
@@ -0,0 +1,128 @@
+/**
+ * Copyright 2019 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/hal/device/gpu_pinned_mem_pool.h"
+#include <algorithm>
+#include <string>
+#include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+namespace {
+constexpr char kPinnedMemSizeEnv[] = "MS_DEV_GPU_PINNED_MEM_SIZE";
+constexpr size_t kPinnedMemUnitSize = 64 << 20;
+constexpr size_t kMBToByte = 1 << 20;
+}  // namespace
+
+GPUPinnedMemPool::GPUPinnedMemPool() {
+  const auto &size_env = common::GetEnv(kPinnedMemSizeEnv);
+  if (size_env.empty()) {
+    return;
+  }
+  try {
+    max_size_ = std::stoul(size_env) * kMBToByte;
+  } catch (const std::exception &e) {
+    MS_LOG(EXCEPTION) << "The value of env " << kPinnedMemSizeEnv << " should be a positive integer, but got "
+                      << size_env;
+  }
+  auto unit_size = std::min(kPinnedMemUnitSize, max_size_);
+  SetMemAllocUintSize(unit_size, unit_size);
+  set_enable_size_class(true);
+  MS_LOG(INFO) << "Enable the pinned host memory pool, max size: " << max_size_ << "B.";
+}
+
+void *GPUPinnedMemPool::AllocPinnedMem(size_t size) {
+  if (!enable() || size == 0) {
+    return nullptr;
+  }
+  ReclaimPendingMem();
+  return AllocTensorMem(size);
+}
+
+void GPUPinnedMemPool::FreePinnedMem(void *addr) {
+  MS_EXCEPTION_IF_NULL(addr);
+  FreeTensorMem(addr);
+}
+
+void GPUPinnedMemPool::FreePinnedMemAfterStream(void *addr, void *stream) {
+  MS_EXCEPTION_IF_NULL(addr);
+  CudaDeviceEvent event = nullptr;
+  if (!CudaDriver::CreateEvent(&event, cudaEventDisableTiming) || !CudaDriver::RecordEvent(event, stream)) {
+    // Fall back to wait the stream when the event is invalid.
+    if (event != nullptr) {
+      (void)CudaDriver::DestroyEvent(event);
+    }
+    if (!CudaDriver::SyncStream(stream)) {
+      MS_LOG(EXCEPTION) << "Sync stream failed before freeing the pinned memory.";
+    }
+    FreeTensorMem(addr);
+    return;
+  }
+  std::lock_guard<std::mutex> locker(pending_mutex_);
+  (void)pending_mem_.emplace_back(addr, event);
+}
+
+void GPUPinnedMemPool::ReclaimPendingMem() {
+  std::lock_guard<std::mutex> locker(pending_mutex_);
+  size_t pending_index = 0;
+  for (auto &pending : pending_mem_) {
+    // The events are recorded in order, but they may be on the different streams, so check all of them.
+    if (!CudaDriver::QueryEvent(pending.second)) {
+      pending_mem_[pending_index++] = pending;
+      continue;
+    }
+    (void)CudaDriver::DestroyEvent(pending.second);
+    FreeTensorMem(pending.first);
+  }
+  pending_mem_.resize(pending_index);
+}
+
+void GPUPinnedMemPool::Finalize() {
+  {
+    std::lock_guard<std::mutex> locker(pending_mutex_);
+    for (auto &pending : pending_mem_) {
+      (void)CudaDriver::SyncEvent(pending.second);
+      (void)CudaDriver::DestroyEvent(pending.second);
+    }
+    pending_mem_.clear();
+  }
+  ReleaseDeviceRes();
+  total_alloc_size_ = 0;
+}
+
+size_t GPUPinnedMemPool::AllocDeviceMem(size_t size, DeviceMemPtr *addr) {
+  MS_EXCEPTION_IF_NULL(addr);
+  auto alloc_size = CudaDriver::AllocHostPinnedMem(size, addr);
+  if (alloc_size == 0) {
+    MS_LOG(WARNING) << "Alloc the pinned host memory failed, size: " << size;
+    return 0;
+  }
+  total_alloc_size_ += alloc_size;
+  MS_LOG(INFO) << "Alloc the pinned host memory: " << alloc_size << "B, total: " << total_alloc_size_ << "B.";
+  return alloc_size;
+}
+
+bool GPUPinnedMemPool::FreeDeviceMem(const DeviceMemPtr &addr) {
+  CudaDriver::FreeHostPinnedMem(addr);
+  return true;
+}
+
+size_t GPUPinnedMemPool::free_mem_size() { return max_size_ > total_alloc_size_ ? max_size_ - total_alloc_size_ : 0; }
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2019 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_GPU_PINNED_MEM_POOL_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_GPU_PINNED_MEM_POOL_H_
+
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "plugin/device/gpu/hal/device/cuda_driver.h"
+#include "common/mem_reuse/mem_dynamic_allocator.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+// The memory pool of the page-locked host memory allocated by cudaHostAlloc. The copy between the pinned host memory
+// and device runs at the full PCIe bandwidth and is really asynchronous to the host thread. The small and medium
+// memory is allocated by the size class to reduce the fragmentation of the frequent transfers.
+// The pool is enabled by the environment variable MS_DEV_GPU_PINNED_MEM_SIZE, which is the max pinned memory size in
+// units of MB.
+class GPUPinnedMemPool : public DynamicMemPoolBestFit {
+ public:
+  ~GPUPinnedMemPool() override = default;
+
+  static GPUPinnedMemPool &GetInstance() {
+    static GPUPinnedMemPool instance;
+    return instance;
+  }
+
+  bool enable() const { return max_size_ > 0; }
+
+  // Alloc the pinned host memory, return nullptr if the pool is disabled or the pinned memory is not enough.
+  void *AllocPinnedMem(size_t size);
+  // Free the pinned host memory immediately, the caller must make sure no copy is using the memory.
+  void FreePinnedMem(void *addr);
+  // Free the pinned host memory after the tasks launched on the stream are finished, the host thread isn't blocked
+  // and the memory is reclaimed lazily by the later alloc.
+  void FreePinnedMemAfterStream(void *addr, void *stream);
+  // Wait the pending memory and release all the pinned memory.
+  void Finalize();
+
+  size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override;
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override;
+  size_t free_mem_size() override;
+  std::string GetMemPoolName() const override { return "GPUPinned"; }
+
+ private:
+  GPUPinnedMemPool();
+  GPUPinnedMemPool(const GPUPinnedMemPool &) = delete;
+  GPUPinnedMemPool &operator=(const GPUPinnedMemPool &) = delete;
+
+  // Free the pending memory whose event has been completed.
+  void ReclaimPendingMem();
+
+  size_t max_size_{0};
+  size_t total_alloc_size_{0};
+  // The memory freed by FreePinnedMemAfterStream and the event recorded on the stream, protected by the pending_mutex_.
+  std::mutex pending_mutex_;
+  std::vector<std::pair<void *, CudaDeviceEvent>> pending_mem_;
+};
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_GPU_GPU_PINNED_MEM_POOL_H_
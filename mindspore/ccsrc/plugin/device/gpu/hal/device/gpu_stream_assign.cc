@@ -20,6 +20,10 @@
 #include <memory>
 #include <algorithm>
 #include <utility>
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+#include "utils/flags.h"
+#include "utils/shape_utils.h"
 #include "kernel/graph_kernel_info.h"
 #include "plugin/device/gpu/hal/device/gpu_common.h"
 #include "plugin/device/gpu/hal/device/kernel_info_setter.h"
@@ -28,7 +32,149 @@
 namespace mindspore {
 namespace device {
 namespace gpu {
-void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph) {
+namespace {
+// The independent compute branches are assigned to at most 3 streams besides the default stream.
+constexpr size_t kMaxComputeStreamNum = 3;
+// The branch whose output elements are fewer than the threshold stays on the default stream, as the event
+// synchronization costs more than the overlap of the tiny kernels.
+constexpr size_t kDefaultComputeBranchThreshold = 1 << 20;
+
+bool EnableComputeMultiStream() {
+  static const bool enable = common::GetEnv("MS_DEV_GPU_COMPUTE_MULTI_STREAM") == "1";
+  return enable;
+}
+
+size_t GetComputeBranchThreshold() {
+  static const size_t threshold = []() {
+    auto threshold_env = common::GetEnv("MS_DEV_GPU_COMPUTE_BRANCH_THRESHOLD");
+    if (threshold_env.empty()) {
+      return kDefaultComputeBranchThreshold;
+    }
+    try {
+      return static_cast<size_t>(std::stoull(threshold_env));
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid MS_DEV_GPU_COMPUTE_BRANCH_THRESHOLD: " << threshold_env << ", use the default value "
+                      << kDefaultComputeBranchThreshold << ".";
+      return kDefaultComputeBranchThreshold;
+    }
+  }();
+  return threshold;
+}
+
+// The kernel on the other stream is only synchronized by its data inputs and outputs, so the kernels with the side
+// effect or the monad input, and the kernels whose launch needs host synchronization are kept on the default stream.
+bool IsComputeBranchKernel(const CNodePtr &kernel) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  if (common::AnfAlgo::IsCommunicationOp(kernel) || common::AnfAlgo::IsDynamicShape(kernel) ||
+      common::AnfAlgo::IsNopNode(kernel)) {
+    return false;
+  }
+  auto prim = common::AnfAlgo::GetCNodePrimitive(kernel);
+  if (prim == nullptr || prim->HasAttr(GRAPH_FLAG_SIDE_EFFECT_MEM)) {
+    return false;
+  }
+  const auto &inputs = kernel->inputs();
+  return std::none_of(inputs.begin() + 1, inputs.end(),
+                      [](const AnfNodePtr &input) { return HasAbstractMonad(input); });
+}
+
+// Estimate the cost of the kernel by the element number of its outputs.
+size_t GetKernelCost(const CNodePtr &kernel) {
+  size_t cost = 0;
+  size_t output_num = common::AnfAlgo::GetOutputTensorNum(kernel);
+  for (size_t i = 0; i < output_num; ++i) {
+    cost += SizeOf(common::AnfAlgo::GetOutputInferShape(kernel, i));
+  }
+  return cost;
+}
+
+// The chain of kernels from the user of the fork kernel to the kernel before the join kernel, each kernel of the chain
+// has only one user, and the kernels except the head have only one producer which is the previous kernel.
+struct ComputeBranch {
+  std::vector<size_t> kernels;
+  size_t join = 0;
+  size_t cost = 0;
+};
+
+class ComputeBranchFinder {
+ public:
+  explicit ComputeBranchFinder(const KernelGraphPtr &kernel_graph) : kernels_(kernel_graph->execution_order()) {
+    mindspore::HashMap<AnfNodePtr, size_t> kernel_index;
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      kernel_index[kernels_[i]] = i;
+    }
+    producers_.resize(kernels_.size());
+    users_.resize(kernels_.size());
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      size_t input_num = common::AnfAlgo::GetInputTensorNum(kernels_[i]);
+      for (size_t j = 0; j < input_num; ++j) {
+        auto iter = kernel_index.find(common::AnfAlgo::GetPrevNodeOutput(kernels_[i], j, false).first);
+        if (iter == kernel_index.end() || std::find(producers_[i].begin(), producers_[i].end(), iter->second) !=
+                                            producers_[i].end()) {
+          continue;
+        }
+        (void)producers_[i].emplace_back(iter->second);
+        (void)users_[iter->second].emplace_back(i);
+      }
+    }
+    // The graph outputs are fetched after the default stream is synchronized.
+    for (const auto &output : common::AnfAlgo::GetAllOutputWithIndex(kernel_graph->output())) {
+      auto iter = kernel_index.find(output.first);
+      if (iter != kernel_index.end()) {
+        (void)graph_outputs_.insert(iter->second);
+      }
+    }
+    assigned_.resize(kernels_.size(), false);
+  }
+  ~ComputeBranchFinder() = default;
+
+  const std::vector<CNodePtr> &kernels() const { return kernels_; }
+  const std::vector<size_t> &producers(size_t index) const { return producers_[index]; }
+  const std::vector<size_t> &users(size_t index) const { return users_[index]; }
+  void Assign(const ComputeBranch &branch) {
+    for (auto index : branch.kernels) {
+      assigned_[index] = true;
+    }
+  }
+
+  bool GrowBranch(size_t head, ComputeBranch *branch) const {
+    // The inputs of the head are all on the default stream, which are synchronized by one event.
+    const auto &head_producers = producers_[head];
+    if (std::any_of(head_producers.begin(), head_producers.end(), [this](size_t index) { return assigned_[index]; })) {
+      return false;
+    }
+    auto current = head;
+    while (IsBranchKernel(current)) {
+      (void)branch->kernels.emplace_back(current);
+      branch->cost += GetKernelCost(kernels_[current]);
+      if (users_[current].size() != 1) {
+        return false;
+      }
+      auto next = users_[current].front();
+      if (producers_[next].size() != 1 || !IsBranchKernel(next)) {
+        branch->join = next;
+        return true;
+      }
+      current = next;
+    }
+    return false;
+  }
+
+ private:
+  bool IsBranchKernel(size_t index) const {
+    return !assigned_[index] && graph_outputs_.count(index) == 0 && IsComputeBranchKernel(kernels_[index]);
+  }
+
+  std::vector<CNodePtr> kernels_;
+  std::vector<std::vector<size_t>> producers_;
+  std::vector<std::vector<size_t>> users_;
+  std::set<size_t> graph_outputs_;
+  std::vector<bool> assigned_;
+};
+}  // namespace
+
+void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                     const ComputeStreamFetcher &fetch_compute_stream) {
   MS_EXCEPTION_IF_NULL(kernel_graph);
   std::vector<CNodePtr> allreduce_kernels;
   auto execution_kernels = kernel_graph->execution_order();
@@ -55,9 +201,17 @@ void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph)
                        return allreduce_kernel;
                      });
       InsertStreamSwitchNode(kernel_graph, send_recv_pairs);
-    } else {
-      return;
     }
+    // The stream switch nodes of AllReduce are placed by the adjacent kernels in the execution order, which requires
+    // the compute kernels on one stream.
+    return;
+  }
+  if (fetch_compute_stream == nullptr || !EnableComputeMultiStream()) {
+    return;
+  }
+  std::vector<SendRecvPair> send_recv_pairs;
+  if (FindComputeStreamSwitchPos(kernel_graph, fetch_compute_stream, &send_recv_pairs)) {
+    InsertStreamSwitchNode(kernel_graph, send_recv_pairs);
   }
 }
 
@@ -159,11 +313,17 @@ void InsertStreamSwitchNode(const std::shared_ptr<session::KernelGraph> &kernel_
     CNodePtr recv_node = nullptr;
     // Step 1: Generate stream Send and Recv CNodes.
     if (stream_switch_type == kAllReduceStreamSwitch) {
-      if (!GenSendRecvCNodesForAllReduce(kernel_graph, mock_send_node, mock_recv_node, &send_node, &recv_node)) {
+      if (!GenSendRecvCNodes(kernel_graph, mock_send_node, mock_recv_node, &send_node, &recv_node)) {
         MS_LOG(EXCEPTION) << "Generating CNodes for send and recv failed. Stream switch type: kAllReduceStreamSwitch";
       }
 
       CacheSendRecvCNodesForAllReduce(kernel_graph, mock_send_node, mock_recv_node, send_node, recv_node);
+    } else if (stream_switch_type == kComputeStreamSwitch) {
+      if (!GenSendRecvCNodes(kernel_graph, mock_send_node, mock_recv_node, &send_node, &recv_node)) {
+        MS_LOG(EXCEPTION) << "Generating CNodes for send and recv failed. Stream switch type: kComputeStreamSwitch";
+      }
+
+      CacheSendRecvCNodesForComputeBranch(kernel_graph, mock_send_node, mock_recv_node, send_node, recv_node);
     }
     // Step 2: Sort send and recv CNodes by offset.
     ordered_stream_switch_nodes.insert({send_node_offset, send_node});
@@ -177,9 +337,8 @@ void InsertStreamSwitchNode(const std::shared_ptr<session::KernelGraph> &kernel_
   kernel_graph->set_execution_order(execution_kernels);
 }
 
-bool GenSendRecvCNodesForAllReduce(const std::shared_ptr<session::KernelGraph> &kernel_graph,
-                                   const CNodePtr &mock_send_node, const CNodePtr &mock_recv_node, CNodePtr *send_node,
-                                   CNodePtr *recv_node) {
+bool GenSendRecvCNodes(const std::shared_ptr<session::KernelGraph> &kernel_graph, const CNodePtr &mock_send_node,
+                       const CNodePtr &mock_recv_node, CNodePtr *send_node, CNodePtr *recv_node) {
   *send_node = CreateStreamSwitchNode(kernel_graph, kSendOpName);
   MS_EXCEPTION_IF_NULL(*send_node);
   *recv_node = CreateStreamSwitchNode(kernel_graph, kRecvOpName);
@@ -231,6 +390,74 @@ void CacheSendRecvCNodesForAllReduce(const std::shared_ptr<session::KernelGraph>
     kernel_graph->InsertSendRecvPairForParallelOpInputs(mock_recv_node, send_recv_nodes);
   }
 }
+}
+
+bool FindComputeStreamSwitchPos(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                                const ComputeStreamFetcher &fetch_compute_stream,
+                                std::vector<SendRecvPair> *send_recv_pairs) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  MS_EXCEPTION_IF_NULL(send_recv_pairs);
+  ComputeBranchFinder finder(kernel_graph);
+  const auto &kernels = finder.kernels();
+  auto threshold = GetComputeBranchThreshold();
+  size_t stream_index = 0;
+  for (size_t fork = 0; fork < kernels.size(); ++fork) {
+    if (finder.users(fork).size() < 2) {
+      continue;
+    }
+    std::vector<ComputeBranch> branches;
+    for (auto head : finder.users(fork)) {
+      ComputeBranch branch;
+      if (finder.GrowBranch(head, &branch) && branch.cost >= threshold) {
+        (void)branches.emplace_back(std::move(branch));
+      }
+    }
+    if (branches.size() < 2) {
+      continue;
+    }
+    // The most costly branch stays on the default stream, and the others run in parallel with it.
+    std::stable_sort(branches.begin(), branches.end(),
+                     [](const ComputeBranch &l, const ComputeBranch &r) { return l.cost > r.cost; });
+    for (size_t i = 1; i < branches.size(); ++i) {
+      const auto &branch = branches[i];
+      size_t stream_id = 0;
+      void *stream = nullptr;
+      if (!fetch_compute_stream(stream_index % kMaxComputeStreamNum, &stream_id, &stream) || stream == nullptr) {
+        MS_LOG(WARNING) << "Fetch the compute stream failed, the compute branches stay on the default stream.";
+        return !send_recv_pairs->empty();
+      }
+      ++stream_index;
+      for (auto index : branch.kernels) {
+        common::AnfAlgo::SetNodeAttr(kAttrStreamId, MakeValue(reinterpret_cast<uintptr_t>(stream)), kernels[index]);
+        common::AnfAlgo::SetNodeAttr(kAttrStream, MakeValue(stream_id), kernels[index]);
+      }
+      finder.Assign(branch);
+      auto head = branch.kernels.front();
+      auto tail = branch.kernels.back();
+      auto last_producer = *std::max_element(finder.producers(head).begin(), finder.producers(head).end());
+      MS_LOG(INFO) << "Assign the compute branch from " << kernels[head]->fullname_with_scope() << " to "
+                   << kernels[tail]->fullname_with_scope() << " to stream " << stream_id << ", cost: " << branch.cost;
+      SendRecvPair fork_pair = {kComputeStreamSwitch, kernels[last_producer], kernels[head], head, head};
+      SendRecvPair join_pair = {kComputeStreamSwitch, kernels[tail], kernels[branch.join], tail + 1, branch.join};
+      send_recv_pairs->push_back(fork_pair);
+      send_recv_pairs->push_back(join_pair);
+    }
+  }
+  return !send_recv_pairs->empty();
+}
+
+void CacheSendRecvCNodesForComputeBranch(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                                         const CNodePtr &mock_send_node, const CNodePtr &mock_recv_node,
+                                         const CNodePtr &send_node, const CNodePtr &recv_node) {
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  std::pair<CNodePtr, CNodePtr> send_recv_nodes(send_node, recv_node);
+  // The branch head waits for its inputs, and the user of the branch tail waits for the tail.
+  if (common::AnfAlgo::HasNodeAttr(kAttrStream, mock_recv_node)) {
+    kernel_graph->InsertSendRecvPairForParallelOpInputs(mock_recv_node, send_recv_nodes);
+  } else {
+    kernel_graph->InsertSendRecvPairForParallelOpOutputs(mock_send_node, send_recv_nodes);
+  }
+}
 }  // namespace gpu
 }  // namespace device
 }  // namespace mindspore
@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
 #include "backend/common/session/kernel_graph.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
@@ -27,7 +28,7 @@
 namespace mindspore {
 namespace device {
 namespace gpu {
-enum StreamSwitchType { kAllReduceStreamSwitch, kStreamSwitchInvalidType = 255 };
+enum StreamSwitchType { kAllReduceStreamSwitch, kComputeStreamSwitch, kStreamSwitchInvalidType = 255 };
 struct SendRecvPair {
   StreamSwitchType stream_switch_type;
   CNodePtr mock_send_node;
@@ -39,19 +40,22 @@ struct StreamSwitchNode {
   size_t offset;
   CNodePtr cnode;
   bool operator<(const StreamSwitchNode &n) const {
-    if (offset < n.offset) {
-      return true;
-    } else if (offset == n.offset) {
-      return (common::AnfAlgo::GetCNodeName(cnode) == kRecvOpName &&
-              common::AnfAlgo::GetCNodeName(n.cnode) == kSendOpName)
-               ? false
-               : true;
-    } else {
-      return false;
+    if (offset != n.offset) {
+      return offset < n.offset;
     }
+    // The send node is placed before the recv node at the same offset.
+    bool is_recv = common::AnfAlgo::GetCNodeName(cnode) == kRecvOpName;
+    bool n_is_recv = common::AnfAlgo::GetCNodeName(n.cnode) == kRecvOpName;
+    if (is_recv != n_is_recv) {
+      return !is_recv;
+    }
+    return cnode->UniqueId() < n.cnode->UniqueId();
   }
 };
-void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph);
+// Fetch the index-th stream for the independent compute branches, output the stream id and the stream.
+using ComputeStreamFetcher = std::function<bool(size_t, size_t *, void **)>;
+void AssignGpuStream(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                     const ComputeStreamFetcher &fetch_compute_stream = nullptr);
 bool FindAllReduceStreamSwitchPos(const std::shared_ptr<session::KernelGraph> &kernel_graph,
                                   std::vector<SendRecvPair> *send_recv_pairs);
 // Find Send node position according to "mock" recv node.
@@ -66,15 +70,24 @@ std::vector<CNodePtr>::iterator FindRecvNodePos(std::vector<CNodePtr>::iterator
                                                 StreamSwitchType stream_switch_type);
 void InsertStreamSwitchNode(const std::shared_ptr<session::KernelGraph> &kernel_graph,
                             const std::vector<SendRecvPair> &send_recv_pairs);
-bool GenSendRecvCNodesForAllReduce(const std::shared_ptr<session::KernelGraph> &kernel_graph,
-                                   const CNodePtr &mock_send_node, const CNodePtr &mock_recv_node, CNodePtr *send_node,
-                                   CNodePtr *recv_node);
+bool GenSendRecvCNodes(const std::shared_ptr<session::KernelGraph> &kernel_graph, const CNodePtr &mock_send_node,
+                       const CNodePtr &mock_recv_node, CNodePtr *send_node, CNodePtr *recv_node);
 CNodePtr CreateStreamSwitchNode(const std::shared_ptr<session::KernelGraph> &kernel_graph, const std::string &name);
 
 // Cache the allreduce kernel to send/recv nodes in the kernel graph.
 void CacheSendRecvCNodesForAllReduce(const std::shared_ptr<session::KernelGraph> &kernel_graph,
                                      const CNodePtr &mock_send_node, const CNodePtr &mock_recv_node,
                                      const CNodePtr &send_node, const CNodePtr &recv_node);
+
+// Assign the independent compute branches of the fork-join regions to the other compute streams, and find the
+// positions to synchronize the branch head with its inputs and the branch tail with its user.
+bool FindComputeStreamSwitchPos(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                                const ComputeStreamFetcher &fetch_compute_stream,
+                                std::vector<SendRecvPair> *send_recv_pairs);
+// Cache the compute branch head and tail to send/recv nodes in the kernel graph.
+void CacheSendRecvCNodesForComputeBranch(const std::shared_ptr<session::KernelGraph> &kernel_graph,
+                                         const CNodePtr &mock_send_node, const CNodePtr &mock_recv_node,
+                                         const CNodePtr &send_node, const CNodePtr &recv_node);
 }  // namespace gpu
 }  // namespace device
 }  // namespace mindspore
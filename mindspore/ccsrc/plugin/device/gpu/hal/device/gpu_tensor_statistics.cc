@@ -0,0 +1,145 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/hal/device/gpu_tensor_statistics.h"
+#include "include/cuda_fp16.h"
+#include "plugin/device/gpu/hal/device/cuda_driver.h"
+#include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+namespace {
+template <typename T>
+void LaunchTensorStatistics(const void *addr, size_t size, TensorStatisticsRecord *record, void *stream) {
+  CalTensorStatistics(size / sizeof(T), static_cast<const T *>(addr), record, static_cast<cudaStream_t>(stream));
+}
+}  // namespace
+
+bool GPUTensorStatistics::IsTypeSupported(TypeId type) {
+  switch (type) {
+    case kNumberTypeBool:
+    case kNumberTypeInt8:
+    case kNumberTypeInt16:
+    case kNumberTypeInt32:
+    case kNumberTypeInt64:
+    case kNumberTypeUInt8:
+    case kNumberTypeUInt16:
+    case kNumberTypeUInt32:
+    case kNumberTypeUInt64:
+    case kNumberTypeFloat16:
+    case kNumberTypeFloat32:
+    case kNumberTypeFloat64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool GPUTensorStatistics::Launch(const void *addr, size_t size, TypeId type, void *stream) {
+  MS_ERROR_IF_NULL(stream);
+  if (addr == nullptr && size != 0) {
+    MS_LOG(ERROR) << "The address of the tensor with size " << size << " is nullptr.";
+    return false;
+  }
+  if (full() || !IsTypeSupported(type)) {
+    return false;
+  }
+  if (records_ == nullptr) {
+    records_ = static_cast<TensorStatisticsRecord *>(
+      GPUMemoryAllocator::GetInstance().AllocTensorMem(kMaxRecordNum * sizeof(TensorStatisticsRecord), true));
+    if (records_ == nullptr) {
+      MS_LOG(WARNING) << "Allocate the device memory of the tensor statistics failed.";
+      return false;
+    }
+  }
+  auto record = records_ + record_num_;
+  switch (type) {
+    case kNumberTypeBool:
+      LaunchTensorStatistics<bool>(addr, size, record, stream);
+      break;
+    case kNumberTypeInt8:
+      LaunchTensorStatistics<int8_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeInt16:
+      LaunchTensorStatistics<int16_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeInt32:
+      LaunchTensorStatistics<int32_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeInt64:
+      LaunchTensorStatistics<int64_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeUInt8:
+      LaunchTensorStatistics<uint8_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeUInt16:
+      LaunchTensorStatistics<uint16_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeUInt32:
+      LaunchTensorStatistics<uint32_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeUInt64:
+      LaunchTensorStatistics<uint64_t>(addr, size, record, stream);
+      break;
+    case kNumberTypeFloat16:
+      LaunchTensorStatistics<half>(addr, size, record, stream);
+      break;
+    case kNumberTypeFloat32:
+      LaunchTensorStatistics<float>(addr, size, record, stream);
+      break;
+    case kNumberTypeFloat64:
+      LaunchTensorStatistics<double>(addr, size, record, stream);
+      break;
+    default:
+      return false;
+  }
+  ++record_num_;
+  (void)streams_.insert(stream);
+  return true;
+}
+
+bool GPUTensorStatistics::Fetch(std::vector<TensorStatisticsRecord> *records) {
+  MS_ERROR_IF_NULL(records);
+  records->resize(record_num_);
+  if (record_num_ == 0) {
+    return true;
+  }
+  auto record_num = record_num_;
+  record_num_ = 0;
+  for (const auto &stream : streams_) {
+    if (!CudaDriver::SyncStream(stream)) {
+      MS_LOG(ERROR) << "Sync the stream of the tensor statistics failed.";
+      streams_.clear();
+      return false;
+    }
+  }
+  streams_.clear();
+  return CudaDriver::CopyDeviceMemToHost(records->data(), records_, record_num * sizeof(TensorStatisticsRecord));
+}
+
+void GPUTensorStatistics::Release() {
+  if (records_ != nullptr) {
+    GPUMemoryAllocator::GetInstance().FreeTensorMem(records_);
+    records_ = nullptr;
+  }
+  record_num_ = 0;
+  streams_.clear();
+}
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,66 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_TENSOR_STATISTICS_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_TENSOR_STATISTICS_H_
+
+#include <set>
+#include <vector>
+#include "ir/dtype/type_id.h"
+#include "utils/ms_utils.h"
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/tensor_statistics_impl.cuh"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+// The statistics of the tensors for the statistic dump, which are reduced on device. The record of each tensor is
+// written to a persistent device buffer on the stream of the kernel, and all the records are copied to host in one copy
+// when they are fetched, so the tensors themselves are never copied to host.
+class GPUTensorStatistics {
+ public:
+  static GPUTensorStatistics &GetInstance() {
+    static GPUTensorStatistics instance;
+    return instance;
+  }
+
+  static bool IsTypeSupported(TypeId type);
+
+  // Launch the reduction of the tensor on the stream, whose record is the next one in the buffer. Return false if the
+  // buffer is full or the reduction can't be launched.
+  bool Launch(const void *addr, size_t size, TypeId type, void *stream);
+
+  bool full() const { return record_num_ == kMaxRecordNum; }
+  size_t record_num() const { return record_num_; }
+
+  // Wait for the reductions on their streams, and copy the records launched since the last fetch to host.
+  bool Fetch(std::vector<TensorStatisticsRecord> *records);
+
+  void Release();
+
+ private:
+  GPUTensorStatistics() = default;
+  ~GPUTensorStatistics() = default;
+  DISABLE_COPY_AND_ASSIGN(GPUTensorStatistics);
+
+  static constexpr size_t kMaxRecordNum = 4096;
+  TensorStatisticsRecord *records_{nullptr};
+  size_t record_num_{0};
+  std::set<void *> streams_;
+};
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_HAL_DEVICE_GPU_TENSOR_STATISTICS_H_
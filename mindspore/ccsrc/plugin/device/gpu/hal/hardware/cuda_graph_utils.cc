@@ -0,0 +1,64 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/hal/hardware/cuda_graph_utils.h"
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+namespace {
+// The attrs of random seed, the kernel with any of them generates the random numbers by the generator on host.
+const std::vector<std::string> kRandomSeedAttrs = {"seed", "seed2", "Seed0", "Seed1"};
+
+// The kernels which keep the state on host, besides the random kernels with seed.
+const std::set<std::string> kHostStateKernels = {kDropoutOpName,   kDropoutGenMaskOpName, "Dropout2D",
+                                                 "Dropout3D",      kGetNextOpName,        "Print",
+                                                 "Assert",         kStackInitOpName,      kStackPushOpName,
+                                                 kStackPopOpName,  kStackDestroyOpName,   "BufferAppend",
+                                                 "BufferSample",   "BufferGetItem"};
+
+// The kernel families which keep the containers on host.
+const std::vector<std::string> kHostStateKernelPrefixes = {"TensorArray", "PriorityReplayBuffer",
+                                                           "ReservoirReplayBuffer"};
+}  // namespace
+
+bool IsCudaGraphCapturable(const CNodePtr &kernel) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  // Only the kernels on the default stream are captured, and the communication kernels are launched by other library.
+  if (common::AnfAlgo::HasNodeAttr(kAttrStream, kernel) || common::AnfAlgo::IsCommunicationOp(kernel) ||
+      common::AnfAlgo::IsDynamicShape(kernel)) {
+    return false;
+  }
+  if (std::any_of(kRandomSeedAttrs.begin(), kRandomSeedAttrs.end(),
+                  [&kernel](const std::string &attr) { return common::AnfAlgo::HasNodeAttr(attr, kernel); })) {
+    return false;
+  }
+  const auto &kernel_name = common::AnfAlgo::GetCNodeName(kernel);
+  if (kHostStateKernels.count(kernel_name) > 0) {
+    return false;
+  }
+  return std::none_of(kHostStateKernelPrefixes.begin(), kHostStateKernelPrefixes.end(),
+                      [&kernel_name](const std::string &prefix) { return kernel_name.find(prefix) == 0; });
+}
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,36 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_CUDA_GRAPH_UTILS_H_
+#define MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_CUDA_GRAPH_UTILS_H_
+
+#include "ir/anf.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+// Whether the kernel can be captured to the cuda graph. The replay of cuda graph only runs the captured device work
+// with the captured parameters, so the kernel which keeps the state on host can't be captured:
+// 1. The random kernels, whose generator offset advances on host in each launch, and the replay would generate the same
+//    random numbers in every step.
+// 2. The kernels which copy the data between host and device or update the host containers in the launch, such as the
+//    data queue, print, stack, tensor array and replay buffer kernels.
+// The kernels on the other streams, the communication kernels and the dynamic shape kernels can't be captured either.
+bool IsCudaGraphCapturable(const CNodePtr &kernel);
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_CUDA_GRAPH_UTILS_H_
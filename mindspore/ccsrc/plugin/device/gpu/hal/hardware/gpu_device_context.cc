@@ -17,11 +17,13 @@
 #include "plugin/device/gpu/hal/hardware/gpu_device_context.h"
 #include <dlfcn.h>
 #include <utility>
+#include <algorithm>
 #include "plugin/device/gpu/hal/device/kernel_info_setter.h"
 #include "plugin/device/gpu/hal/device/gpu_kernel_build.h"
 #include "plugin/device/gpu/hal/device/gpu_device_address.h"
 #include "plugin/device/gpu/hal/device/gpu_memory_manager.h"
 #include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+#include "plugin/device/gpu/hal/device/gpu_tensor_statistics.h"
 #include "plugin/device/gpu/hal/device/gpu_stream_assign.h"
 #include "plugin/device/gpu/hal/device/distribution/collective_init.h"
 #include "plugin/device/gpu/hal/device/gpu_device_manager.h"
@@ -36,6 +38,7 @@
 #include "plugin/device/gpu/hal/profiler/gpu_profiling.h"
 #include "plugin/device/gpu/hal/profiler/gpu_profiling_utils.h"
 #include "backend/common/session/kernel_graph.h"
+#include "ir/graph_utils.h"
 #include "plugin/device/gpu/kernel/gpu_kernel.h"
 #include "plugin/device/gpu/kernel/gpu_kernel_factory.h"
 #include "backend/common/optimizer/common_backend_optimization.h"
@@ -76,6 +79,9 @@ void GPUDeviceContext::Initialize() {
   auto gpu_kernel_executor = dynamic_cast<GPUKernelExecutor *>(kernel_executor_.get());
   MS_EXCEPTION_IF_NULL(gpu_kernel_executor);
   gpu_kernel_executor->Initialize();
+  auto gpu_graph_executor = dynamic_cast<GPUGraphExecutor *>(graph_executor_.get());
+  MS_EXCEPTION_IF_NULL(gpu_graph_executor);
+  gpu_graph_executor->Initialize();
 
 #ifndef ENABLE_SECURITY
   // Dump json config file if dump is enabled.
@@ -177,6 +183,9 @@ void GPUDeviceResManager::Destroy() {
   // Release stream, cudnn and cublas handle, etc.
   GPUDeviceManager::GetInstance().ReleaseDevice();
 
+  // Release the device buffer of the tensor statistics for the statistic dump.
+  GPUTensorStatistics::GetInstance().Release();
+
   // Release device memory
   if (mem_manager_ != nullptr) {
     mem_manager_->Finalize();
@@ -195,11 +204,29 @@ void GPUDeviceContext::Destroy() {
     }
   }
 #endif
+  auto gpu_graph_executor = dynamic_cast<GPUGraphExecutor *>(graph_executor_.get());
+  gpu_graph_executor->Destroy();
   auto gpu_kernel_executor = dynamic_cast<GPUKernelExecutor *>(kernel_executor_.get());
   gpu_kernel_executor->Destroy();
   device_res_manager_->Destroy();
 }
 
+RunMode GPUDeviceContext::GetRunMode(const FuncGraphPtr &func_graph) const {
+  MS_EXCEPTION_IF_NULL(func_graph);
+  static const bool enable_cuda_graph = (common::GetEnv(kCudaGraphEnv) == "1");
+  auto ms_context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(ms_context);
+  if (!enable_cuda_graph || ms_context->get_param<int>(MS_CTX_EXECUTION_MODE) != kGraphMode) {
+    return RunMode::kKernelMode;
+  }
+  std::vector<AnfNodePtr> node_list = TopoSort(func_graph->get_return());
+  if (std::any_of(node_list.begin(), node_list.end(),
+                  [](const AnfNodePtr &node) { return common::AnfAlgo::IsDynamicShape(node); })) {
+    return RunMode::kKernelMode;
+  }
+  return RunMode::kGraphMode;
+}
+
 void *GPUDeviceResManager::AllocateMemory(size_t size) const {
   MS_EXCEPTION_IF_NULL(mem_manager_);
   if (!BindDeviceToCurrentThread()) {
@@ -314,6 +341,7 @@ void GPUKernelExecutor::FuseOperators(const KernelGraphPtr &graph) const {
     pm->AddPass(std::make_shared<opt::AdamWeightDecayFusion>());
     pm->AddPass(std::make_shared<opt::AdamFusion>());
     pm->AddPass(std::make_shared<opt::AllToAllFusion>());
+    pm->AddPass(std::make_shared<opt::SendRecvFusion>());
     pm->AddPass(std::make_shared<opt::ApplyMomentumWeightDecayScaleFusion>());
     pm->AddPass(std::make_shared<opt::ApplyMomentumScaleFusion>());
     pm->AddPass(std::make_shared<opt::ApplyMomentumWeightDecayFusion>());
@@ -326,6 +354,7 @@ void GPUKernelExecutor::FuseOperators(const KernelGraphPtr &graph) const {
     pm->AddPass(std::make_shared<opt::PrintReduceFusion>("print_reduce"));
     pm->AddPass(std::make_shared<opt::BCEWithLogitsLossFusion>());
     pm->AddPass(std::make_shared<opt::InsertCastGPU>("insert_cast_gpu"));
+    pm->AddPass(std::make_shared<opt::AllReduceGradCompression>());
     pm->AddPass(std::make_shared<opt::NeighborExchangeV2Fusion>());
     pm->AddPass(std::make_shared<opt::NeighborExchangeV2GradFusion>());
     pm->AddPass(std::make_shared<opt::BiasDropoutAddFusion>());
@@ -488,7 +517,9 @@ void GPUKernelExecutor::OptimizeGraph(const FuncGraphPtr &graph) const {
     }
 
     // Assign the stream and insert the send/recv node for all reduce kernel, so must be the last in the optimizer.
-    device::gpu::AssignGpuStream(kernel_graph);
+    device::gpu::AssignGpuStream(kernel_graph, [this](size_t index, size_t *stream_id, void **stream) {
+      return FetchComputeStream(index, stream_id, stream);
+    });
   }
 }
 
@@ -654,7 +685,27 @@ void *GPUKernelExecutor::GetLaunchKernelStream(const CNodePtr &kernel) const {
   return stream;
 }
 
-bool GPUDeviceResManager::SyncStream(size_t stream_id) const {
+bool GPUKernelExecutor::FetchComputeStream(size_t index, size_t *stream_id, void **stream) const {
+  MS_EXCEPTION_IF_NULL(stream_id);
+  MS_EXCEPTION_IF_NULL(stream);
+  MS_EXCEPTION_IF_NULL(res_manager_);
+  // The stream id is allocated by the common device resource manager, which is hidden by the override in gpu.
+  auto device_res_manager = static_cast<DeviceResManager *>(res_manager_);
+  std::lock_guard<std::mutex> locker(compute_stream_mutex_);
+  while (compute_stream_ids_.size() <= index) {
+    size_t new_stream_id = 0;
+    if (!device_res_manager->CreateStream(&new_stream_id)) {
+      MS_LOG(ERROR) << "Create the compute stream failed.";
+      return false;
+    }
+    compute_stream_ids_.push_back(new_stream_id);
+  }
+  *stream_id = compute_stream_ids_[index];
+  *stream = device_res_manager->GetStream(*stream_id);
+  return *stream != nullptr;
+}
+
+void *GPUDeviceResManager::FetchStream(size_t stream_id) const {
   void *stream = nullptr;
   auto iter = stream_ids_.find(stream_id);
   if (iter != stream_ids_.end()) {
@@ -665,7 +716,11 @@ bool GPUDeviceResManager::SyncStream(size_t stream_id) const {
     }
     stream = streams_[stream_id];
   }
+  return stream;
+}
 
+bool GPUDeviceResManager::SyncStream(size_t stream_id) const {
+  void *stream = FetchStream(stream_id);
   MS_EXCEPTION_IF_NULL(stream);
   bool result = GPUDeviceManager::GetInstance().SyncStream(stream);
 #ifdef ENABLE_DUMP_IR
@@ -678,6 +733,21 @@ bool GPUDeviceResManager::SyncStream(size_t stream_id) const {
   return result;
 }
 
+bool GPUDeviceResManager::StreamWaitStream(size_t wait_stream_id, size_t record_stream_id) const {
+  void *wait_stream = FetchStream(wait_stream_id);
+  void *record_stream = FetchStream(record_stream_id);
+  MS_EXCEPTION_IF_NULL(wait_stream);
+  MS_EXCEPTION_IF_NULL(record_stream);
+  CudaDeviceEvent event = nullptr;
+  if (!CudaDriver::CreateEvent(&event, cudaEventDisableTiming)) {
+    return false;
+  }
+  // The event can be destroyed after the waiting is launched, and its resource is released when the event completes.
+  bool ret = CudaDriver::RecordEvent(event, record_stream) && CudaDriver::StreamWaitEvent(wait_stream, event);
+  (void)CudaDriver::DestroyEvent(event);
+  return ret;
+}
+
 bool GPUDeviceResManager::CreateStream(void **stream) const {
   MS_EXCEPTION_IF_NULL(stream);
   if (!CudaDriver::CreateStream(stream)) {
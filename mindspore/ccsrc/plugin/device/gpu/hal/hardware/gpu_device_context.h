@@ -23,6 +23,7 @@
 #include "runtime/hardware/device_context.h"
 #include "runtime/hardware/device_context_manager.h"
 #include "runtime/device/memory_manager.h"
+#include "plugin/device/gpu/hal/hardware/gpu_graph_executor.h"
 
 namespace mindspore {
 namespace device {
@@ -47,6 +48,7 @@ class GPUDeviceResManager : public DeviceResManager {
                                        const ShapeVector &shape = ShapeVector()) const override;
 
   bool SyncStream(size_t stream_id = 0) const override;
+  bool StreamWaitStream(size_t wait_stream_id, size_t record_stream_id) const override;
 
   bool LoadCollectiveCommLib() override;
 
@@ -64,7 +66,10 @@ class GPUDeviceResManager : public DeviceResManager {
 
  private:
   friend class GPUKernelExecutor;
+  friend class GPUGraphExecutor;
   bool InitDevice();
+  // Get the stream created by 'CreateStream' or the stream initialized with device by the stream id.
+  void *FetchStream(size_t stream_id) const;
   std::shared_ptr<MemoryManager> mem_manager_;
   std::vector<void *> streams_;
 };
@@ -123,13 +128,20 @@ class GPUKernelExecutor : public DeprecatedKernelExecutor {
   // default stream.
   void *GetLaunchKernelStream(const CNodePtr &kernel) const;
 
+  // Fetch the index-th stream for the independent compute branches, the streams are created at the first fetch and
+  // shared by all the graphs.
+  bool FetchComputeStream(size_t index, size_t *stream_id, void **stream) const;
+
   // The cublas handle is not thread safety specifically, it is not recommended that multiple threads access the same
   // cublas handle at the same time, so need the launch mutex when multiple threads launch the cublas kernels.
   mutable std::mutex launch_mutex_;
   GPUDeviceResManager *res_manager_{nullptr};
+
+  mutable std::mutex compute_stream_mutex_;
+  mutable std::vector<size_t> compute_stream_ids_;
 };
 
-class GPUDeviceContext : public DeviceInterface<GPUKernelExecutor, GPUDeviceResManager> {
+class GPUDeviceContext : public DeviceInterface<GPUKernelExecutor, GPUDeviceResManager, GPUGraphExecutor> {
  public:
   explicit GPUDeviceContext(const DeviceContextKey &device_context_key)
       : DeviceInterface(device_context_key), initialized_(false) {}
@@ -141,7 +153,8 @@ class GPUDeviceContext : public DeviceInterface<GPUKernelExecutor, GPUDeviceResM
   // Release device memory, stream, cudnn and cublas handle, etc.
   void Destroy() override;
 
-  RunMode GetRunMode(const FuncGraphPtr &func_graph) const override { return RunMode::kKernelMode; }
+  // The static shape graph runs in the graph run mode when the cuda graph is enabled, otherwise in the kernel mode.
+  RunMode GetRunMode(const FuncGraphPtr &func_graph) const override;
 
  private:
   DISABLE_COPY_AND_ASSIGN(GPUDeviceContext);
@@ -0,0 +1,227 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/hal/hardware/gpu_graph_executor.h"
+#include <algorithm>
+#include <iterator>
+#include "plugin/device/gpu/hal/hardware/gpu_device_context.h"
+#include "plugin/device/gpu/hal/hardware/cuda_graph_utils.h"
+#include "plugin/device/gpu/hal/profiler/gpu_profiling.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+void GPUGraphExecutor::Initialize() {
+  res_manager_ = dynamic_cast<GPUDeviceResManager *>(device_context_->device_res_manager_.get());
+  MS_EXCEPTION_IF_NULL(res_manager_);
+}
+
+void GPUGraphExecutor::Destroy() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &captured_graph : captured_graphs_) {
+    if (captured_graph.second.graph_exec_ != nullptr) {
+      (void)CudaDriver::DestroyGraphExec(captured_graph.second.graph_exec_);
+    }
+  }
+  captured_graphs_.clear();
+  res_manager_ = nullptr;
+}
+
+bool GPUGraphExecutor::RunGraph(const FuncGraphPtr &graph, const std::vector<tensor::Tensor> &,
+                                std::vector<tensor::Tensor> *, const std::map<string, string> &) {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(res_manager_);
+  auto kernel_graph = graph->cast<KernelGraphPtr>();
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  if (!res_manager_->BindDeviceToCurrentThread()) {
+    return false;
+  }
+  if (!AllocateGraphMemory(kernel_graph)) {
+    MS_LOG(ERROR) << "Allocate memory failed, graph id: " << kernel_graph->graph_id();
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &captured_graph = captured_graphs_[kernel_graph->graph_id()];
+  if (!captured_graph.disable_capture_ && !CanCapture(kernel_graph)) {
+    MS_LOG(INFO) << "The graph " << kernel_graph->graph_id() << " can't be captured to the cuda graph.";
+    captured_graph.disable_capture_ = true;
+  }
+  if (captured_graph.disable_capture_) {
+    return LaunchKernels(kernel_graph);
+  }
+
+  auto stream = res_manager_->streams_.front();
+  MS_EXCEPTION_IF_NULL(stream);
+  auto device_ptrs = GetGraphDevicePtrs(kernel_graph);
+  if (captured_graph.graph_exec_ == nullptr || device_ptrs != captured_graph.device_ptrs_) {
+    MS_LOG(INFO) << "Capture the cuda graph, graph id: " << kernel_graph->graph_id();
+    if (!CaptureGraph(kernel_graph, &captured_graph, stream)) {
+      MS_LOG(WARNING) << "Capture the cuda graph failed and launch the kernels one by one, graph id: "
+                      << kernel_graph->graph_id();
+      captured_graph.disable_capture_ = true;
+      return LaunchKernels(kernel_graph);
+    }
+    captured_graph.device_ptrs_ = std::move(device_ptrs);
+  }
+  return CudaDriver::LaunchGraph(captured_graph.graph_exec_, stream);
+}
+
+bool GPUGraphExecutor::AllocateGraphMemory(const KernelGraphPtr &graph) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(res_manager_);
+  for (const auto &kernel : graph->execution_order()) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    auto kernel_info = dynamic_cast<KernelInfo *>(kernel->kernel_info());
+    MS_EXCEPTION_IF_NULL(kernel_info);
+    for (size_t i = 0; i < AnfAlgo::GetOutputAddressNum(kernel); ++i) {
+      auto device_address = kernel_info->GetMutableOutputAddr(i);
+      MS_EXCEPTION_IF_NULL(device_address);
+      if ((device_address->GetPtr() == nullptr) && (!res_manager_->AllocateMemory(device_address.get()))) {
+        return false;
+      }
+    }
+    for (size_t i = 0; i < kernel_info->workspace_address_list().size(); ++i) {
+      auto device_address = kernel_info->GetMutableWorkspaceAddr(i);
+      MS_EXCEPTION_IF_NULL(device_address);
+      if ((device_address->GetPtr() == nullptr) && (!res_manager_->AllocateMemory(device_address.get()))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool GPUGraphExecutor::CanCapture(const KernelGraphPtr &graph) const {
+  MS_EXCEPTION_IF_NULL(graph);
+#ifndef ENABLE_SECURITY
+  const auto &profiler_inst = profiler::gpu::GPUProfiler::GetInstance();
+  MS_EXCEPTION_IF_NULL(profiler_inst);
+  if (profiler_inst->GetEnableFlag()) {
+    return false;
+  }
+#endif
+  const auto &kernels = graph->execution_order();
+  return std::all_of(kernels.begin(), kernels.end(), [](const CNodePtr &kernel) {
+    if (IsCudaGraphCapturable(kernel)) {
+      return true;
+    }
+    MS_LOG(INFO) << "The kernel " << kernel->fullname_with_scope() << " can't be captured to the cuda graph.";
+    return false;
+  });
+}
+
+void GPUGraphExecutor::GetKernelLaunchAddress(const CNodePtr &kernel, std::vector<kernel::AddressPtr> *inputs,
+                                              std::vector<kernel::AddressPtr> *workspaces,
+                                              std::vector<kernel::AddressPtr> *outputs) const {
+  MS_EXCEPTION_IF_NULL(kernel);
+  MS_EXCEPTION_IF_NULL(inputs);
+  MS_EXCEPTION_IF_NULL(workspaces);
+  MS_EXCEPTION_IF_NULL(outputs);
+  auto kernel_info = dynamic_cast<KernelInfo *>(kernel->kernel_info());
+  MS_EXCEPTION_IF_NULL(kernel_info);
+  for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(kernel); ++i) {
+    auto device_address = AnfAlgo::GetPrevNodeOutputAddr(kernel, i, false);
+    MS_EXCEPTION_IF_NULL(device_address);
+    (void)inputs->emplace_back(
+      std::make_shared<kernel::Address>(device_address->GetMutablePtr(), device_address->GetSize()));
+  }
+  for (size_t i = 0; i < kernel_info->workspace_address_list().size(); ++i) {
+    auto device_address = kernel_info->GetWorkspaceAddr(i);
+    MS_EXCEPTION_IF_NULL(device_address);
+    (void)workspaces->emplace_back(
+      std::make_shared<kernel::Address>(device_address->GetMutablePtr(), device_address->GetSize()));
+  }
+  for (size_t i = 0; i < AnfAlgo::GetOutputAddressNum(kernel); ++i) {
+    auto device_address = kernel_info->GetOutputAddr(i);
+    MS_EXCEPTION_IF_NULL(device_address);
+    (void)outputs->emplace_back(
+      std::make_shared<kernel::Address>(device_address->GetMutablePtr(), device_address->GetSize()));
+  }
+}
+
+std::vector<void *> GPUGraphExecutor::GetGraphDevicePtrs(const KernelGraphPtr &graph) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  std::vector<void *> device_ptrs;
+  for (const auto &kernel : graph->execution_order()) {
+    std::vector<kernel::AddressPtr> inputs;
+    std::vector<kernel::AddressPtr> workspaces;
+    std::vector<kernel::AddressPtr> outputs;
+    GetKernelLaunchAddress(kernel, &inputs, &workspaces, &outputs);
+    auto collect_ptrs = [&device_ptrs](const std::vector<kernel::AddressPtr> &addresses) {
+      (void)std::transform(addresses.begin(), addresses.end(), std::back_inserter(device_ptrs),
+                           [](const kernel::AddressPtr &address) { return address->addr; });
+    };
+    collect_ptrs(inputs);
+    collect_ptrs(workspaces);
+    collect_ptrs(outputs);
+  }
+  return device_ptrs;
+}
+
+bool GPUGraphExecutor::LaunchKernels(const KernelGraphPtr &graph) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(device_context_);
+  MS_EXCEPTION_IF_NULL(device_context_->kernel_executor_);
+  for (const auto &kernel : graph->execution_order()) {
+    std::vector<kernel::AddressPtr> inputs;
+    std::vector<kernel::AddressPtr> workspaces;
+    std::vector<kernel::AddressPtr> outputs;
+    GetKernelLaunchAddress(kernel, &inputs, &workspaces, &outputs);
+    if (!device_context_->kernel_executor_->LaunchKernel(kernel, inputs, workspaces, outputs)) {
+      MS_LOG(ERROR) << "Launch kernel failed: " << kernel->fullname_with_scope();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool GPUGraphExecutor::CaptureGraph(const KernelGraphPtr &graph, CapturedGraph *captured_graph, void *stream) const {
+  MS_EXCEPTION_IF_NULL(captured_graph);
+  if (!CudaDriver::BeginStreamCapture(stream)) {
+    return false;
+  }
+  // The capture must be ended even if the kernel launch fails.
+  bool launch_ret = LaunchKernels(graph);
+  CudaGraph cuda_graph = nullptr;
+  bool capture_ret = CudaDriver::EndStreamCapture(stream, &cuda_graph);
+  if (!launch_ret || !capture_ret) {
+    if (cuda_graph != nullptr) {
+      (void)CudaDriver::DestroyGraph(cuda_graph);
+    }
+    return false;
+  }
+
+  // Update the graph exec in place when only the kernel params change, otherwise instantiate a new one.
+  auto &graph_exec = captured_graph->graph_exec_;
+  if ((graph_exec != nullptr) && !CudaDriver::UpdateGraphExec(graph_exec, cuda_graph)) {
+    (void)CudaDriver::DestroyGraphExec(graph_exec);
+    graph_exec = nullptr;
+  }
+  bool ret = true;
+  if (graph_exec == nullptr) {
+    ret = CudaDriver::InstantiateGraph(cuda_graph, &graph_exec);
+  }
+  // The graph exec doesn't depend on the captured graph after instantiating or updating.
+  (void)CudaDriver::DestroyGraph(cuda_graph);
+  return ret;
+}
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
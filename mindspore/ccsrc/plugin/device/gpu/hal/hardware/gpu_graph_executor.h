@@ -0,0 +1,77 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_GPU_GRAPH_EXECUTOR_H_
+#define MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_GPU_GRAPH_EXECUTOR_H_
+
+#include <vector>
+#include <string>
+#include <map>
+#include <mutex>
+#include "utils/hash_map.h"
+#include "runtime/hardware/device_context.h"
+#include "plugin/device/gpu/hal/device/cuda_driver.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+class GPUDeviceResManager;
+
+// Enable the graph run mode of static shape graph on gpu, the whole graph is launched by the super kernel actor.
+constexpr char kCudaGraphEnv[] = "MS_DEV_ENABLE_CUDA_GRAPH";
+
+// The graph executor launches the kernels of graph in the graph run mode. The kernel sequence is captured to a cuda
+// graph at the first launch, and the later launches replay the cuda graph to save the kernel launch overhead. The
+// kernels are captured again and the graph exec is updated when the device addresses of kernels change.
+// Note that the host logic in the kernel launch doesn't run in the replay, so the graph which can't be captured falls
+// back to launch the kernels one by one, such as the kernel launching on the other stream or calling the unsafe api.
+class GPUGraphExecutor : public GraphExecutor {
+ public:
+  GPUGraphExecutor() = default;
+  ~GPUGraphExecutor() override = default;
+
+  void Initialize();
+  void Destroy();
+
+  bool RunGraph(const FuncGraphPtr &graph, const std::vector<tensor::Tensor> &inputs,
+                std::vector<tensor::Tensor> *outputs, const std::map<string, string> &compile_options) override;
+
+ private:
+  struct CapturedGraph {
+    CudaGraphExec graph_exec_{nullptr};
+    // The device addresses used by the captured kernels.
+    std::vector<void *> device_ptrs_;
+    bool disable_capture_{false};
+  };
+
+  // The memory of kernel outputs and workspaces is allocated at the first launch and kept for the later launches.
+  bool AllocateGraphMemory(const KernelGraphPtr &graph) const;
+  bool CanCapture(const KernelGraphPtr &graph) const;
+  void GetKernelLaunchAddress(const CNodePtr &kernel, std::vector<kernel::AddressPtr> *inputs,
+                              std::vector<kernel::AddressPtr> *workspaces,
+                              std::vector<kernel::AddressPtr> *outputs) const;
+  std::vector<void *> GetGraphDevicePtrs(const KernelGraphPtr &graph) const;
+  bool LaunchKernels(const KernelGraphPtr &graph) const;
+  bool CaptureGraph(const KernelGraphPtr &graph, CapturedGraph *captured_graph, void *stream) const;
+
+  GPUDeviceResManager *res_manager_{nullptr};
+  std::mutex mutex_;
+  mindspore::HashMap<uint32_t, CapturedGraph> captured_graphs_;
+};
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_GPU_GRAPH_EXECUTOR_H_
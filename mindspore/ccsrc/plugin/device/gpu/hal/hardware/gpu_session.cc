@@ -44,6 +44,7 @@
 #include "plugin/device/gpu/optimizer/remove_redundant_format_transform.h"
 #include "plugin/device/gpu/optimizer/reduce_precision_fusion.h"
 #include "plugin/device/gpu/optimizer/insert_cast_gpu.h"
+#include "plugin/device/gpu/optimizer/all_reduce_grad_compression.h"
 #include "plugin/device/gpu/optimizer/relu_v2_pass.h"
 #include "plugin/device/gpu/optimizer/add_relu_v2_fusion.h"
 #include "plugin/device/gpu/optimizer/add_relu_grad_v2_fusion.h"
@@ -173,6 +174,7 @@ void GPUSession::Optimize(const std::shared_ptr<KernelGraph> &kernel_graph) {
   pm->AddPass(std::make_shared<opt::PrintReduceFusion>("print_reduce"));
   pm->AddPass(std::make_shared<opt::BCEWithLogitsLossFusion>());
   pm->AddPass(std::make_shared<opt::InsertCastGPU>("insert_cast_gpu"));
+  pm->AddPass(std::make_shared<opt::AllReduceGradCompression>());
   pm->AddPass(std::make_shared<opt::NeighborExchangeV2Fusion>());
   pm->AddPass(std::make_shared<opt::NeighborExchangeV2GradFusion>());
   optimizer->AddPassManager(pm);
@@ -19,6 +19,28 @@
 namespace mindspore {
 namespace device {
 namespace gpu {
+namespace {
+size_t NCCLDataTypeSize(ncclDataType_t data_type) {
+  switch (data_type) {
+    case ncclInt8:
+    case ncclUint8:
+      return sizeof(int8_t);
+    case ncclFloat16:
+      return sizeof(int16_t);
+    case ncclInt32:
+    case ncclUint32:
+    case ncclFloat32:
+      return sizeof(int32_t);
+    case ncclInt64:
+    case ncclUint64:
+    case ncclFloat64:
+      return sizeof(int64_t);
+    default:
+      return 0;
+  }
+}
+}  // namespace
+
 NvidiaCollectiveCommLib::NvidiaCollectiveCommLib() { global_group_name_ = kNCCLGlobalGroupName; }
 
 bool NvidiaCollectiveCommLib::Initialize(uint32_t global_rank, uint32_t global_rank_size) {
@@ -54,6 +76,12 @@ bool NvidiaCollectiveCommLib::AllGather(const void *send_buff, void *recv_buff,
   auto group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[group_name]);
   CHECK_IF_NULL(group);
 
+  ncclResult_t result = ncclSuccess;
+  if (HierarchicalAllGather(send_buff, recv_buff, send_count, kNCCLDataTypeMap.at(data_type), group_name,
+                            static_cast<cudaStream_t>(stream), &result)) {
+    CHECK_RET(result, ncclSuccess, "Hierarchical ncclAllGather failed.");
+    return true;
+  }
   CHECK_RET(ncclAllGather(send_buff, recv_buff, send_count, kNCCLDataTypeMap.at(data_type), group->nccl_communicator(),
                           static_cast<cudaStream_t>(stream)),
             ncclSuccess, "ncclAllGather failed.");
@@ -66,6 +94,10 @@ ncclResult_t NvidiaCollectiveCommLib::AllGather(const void *send_buff, void *rec
   CHECK_RET((groups_.count(group_name) != 0), true, "The NCCL group " + group_name + " does not existed.");
   auto group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[group_name]);
   CHECK_IF_NULL(group);
+  ncclResult_t result = ncclSuccess;
+  if (HierarchicalAllGather(send_buff, recv_buff, send_count, data_type, group_name, stream, &result)) {
+    return result;
+  }
   return ncclAllGather(send_buff, recv_buff, send_count, data_type, group->nccl_communicator(), stream);
 }
 
@@ -82,6 +114,12 @@ bool NvidiaCollectiveCommLib::AllReduce(const void *send_buff, void *recv_buff,
   auto group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[group_name]);
   CHECK_IF_NULL(group);
 
+  ncclResult_t result = ncclSuccess;
+  if (HierarchicalAllReduce(send_buff, recv_buff, send_count, kNCCLDataTypeMap.at(data_type),
+                            kNCCLReduceTypeMap.at(reduce_op), group_name, static_cast<cudaStream_t>(stream), &result)) {
+    CHECK_RET(result, ncclSuccess, "Hierarchical ncclAllReduce failed.");
+    return true;
+  }
   CHECK_RET(
     ncclAllReduce(send_buff, recv_buff, send_count, kNCCLDataTypeMap.at(data_type), kNCCLReduceTypeMap.at(reduce_op),
                   group->nccl_communicator(), static_cast<cudaStream_t>(stream)),
@@ -95,6 +133,10 @@ ncclResult_t NvidiaCollectiveCommLib::AllReduce(const void *send_buff, void *rec
   CHECK_RET((groups_.count(group_name) != 0), true, "The NCCL group " + group_name + " does not existed.");
   auto group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[group_name]);
   CHECK_IF_NULL(group);
+  ncclResult_t result = ncclSuccess;
+  if (HierarchicalAllReduce(send_buff, recv_buff, send_count, data_type, reduce_op, group_name, stream, &result)) {
+    return result;
+  }
   return ncclAllReduce(send_buff, recv_buff, send_count, data_type, reduce_op, group->nccl_communicator(), stream);
 }
 
@@ -217,6 +259,81 @@ bool NvidiaCollectiveCommLib::CheckNCCLReduceType(CollectiveOpReduceType reduce_
             "Reduce type " + std::to_string(reduce_op) + " is not supported in NCCL.");
   return true;
 }
+
+bool NvidiaCollectiveCommLib::GetHierarchicalGroups(const std::string &group_name,
+                                                    NvidiaCommunicationGroupPtr *intra_group,
+                                                    NvidiaCommunicationGroupPtr *inter_group) {
+  CHECK_IF_NULL(intra_group);
+  CHECK_IF_NULL(inter_group);
+  auto iter = hierarchical_groups_.find(group_name);
+  if (iter == hierarchical_groups_.end() || groups_.count(iter->second.first) == 0 ||
+      groups_.count(iter->second.second) == 0) {
+    return false;
+  }
+  *intra_group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[iter->second.first]);
+  *inter_group = std::dynamic_pointer_cast<NvidiaCommunicationGroup>(groups_[iter->second.second]);
+  return (*intra_group != nullptr) && (*inter_group != nullptr);
+}
+
+bool NvidiaCollectiveCommLib::HierarchicalAllReduce(const void *send_buff, void *recv_buff, size_t send_count,
+                                                    ncclDataType_t data_type, ncclRedOp_t reduce_op,
+                                                    const std::string &group_name, cudaStream_t stream,
+                                                    ncclResult_t *result) {
+  CHECK_IF_NULL(result);
+  NvidiaCommunicationGroupPtr intra_group = nullptr;
+  NvidiaCommunicationGroupPtr inter_group = nullptr;
+  if (!GetHierarchicalGroups(group_name, &intra_group, &inter_group)) {
+    return false;
+  }
+  auto type_size = NCCLDataTypeSize(data_type);
+  auto intra_size = intra_group->group_size();
+  if (type_size == 0 || intra_size == 0 || send_count % intra_size != 0) {
+    return false;
+  }
+
+  // Each rank reduces its chunk across the nodes, the chunk is in place in the recv buffer.
+  auto chunk_count = send_count / intra_size;
+  auto chunk_buff =
+    static_cast<uint8_t *>(recv_buff) + intra_group->GetGroupRank(global_rank_id_) * chunk_count * type_size;
+  *result = ncclReduceScatter(send_buff, chunk_buff, chunk_count, data_type, reduce_op,
+                              intra_group->nccl_communicator(), stream);
+  if (*result != ncclSuccess) {
+    return true;
+  }
+  *result =
+    ncclAllReduce(chunk_buff, chunk_buff, chunk_count, data_type, reduce_op, inter_group->nccl_communicator(), stream);
+  if (*result != ncclSuccess) {
+    return true;
+  }
+  *result = ncclAllGather(chunk_buff, recv_buff, chunk_count, data_type, intra_group->nccl_communicator(), stream);
+  return true;
+}
+
+bool NvidiaCollectiveCommLib::HierarchicalAllGather(const void *send_buff, void *recv_buff, size_t send_count,
+                                                    ncclDataType_t data_type, const std::string &group_name,
+                                                    cudaStream_t stream, ncclResult_t *result) {
+  CHECK_IF_NULL(result);
+  NvidiaCommunicationGroupPtr intra_group = nullptr;
+  NvidiaCommunicationGroupPtr inter_group = nullptr;
+  if (!GetHierarchicalGroups(group_name, &intra_group, &inter_group)) {
+    return false;
+  }
+  auto type_size = NCCLDataTypeSize(data_type);
+  if (type_size == 0) {
+    return false;
+  }
+
+  // The ranks of the group are sorted by the nodes, so the data of this node is in place in the recv buffer.
+  auto node_count = send_count * intra_group->group_size();
+  auto node_buff =
+    static_cast<uint8_t *>(recv_buff) + inter_group->GetGroupRank(global_rank_id_) * node_count * type_size;
+  *result = ncclAllGather(send_buff, node_buff, send_count, data_type, intra_group->nccl_communicator(), stream);
+  if (*result != ncclSuccess) {
+    return true;
+  }
+  *result = ncclAllGather(node_buff, recv_buff, node_count, data_type, inter_group->nccl_communicator(), stream);
+  return true;
+}
 }  // namespace gpu
 
 using NvidiaCollectiveCommLib = mindspore::device::gpu::NvidiaCollectiveCommLib;
@@ -106,6 +106,20 @@ class EXPORT_NCCL_WRAPPER NvidiaCollectiveCommLib : public CollectiveCommunicati
 
   // Check reduce type of collective operation is valid for NCCL.
   bool CheckNCCLReduceType(CollectiveOpReduceType reduce_op);
+
+  // Get the sub groups within and across the nodes of the group, return false if the group is not hierarchical.
+  bool GetHierarchicalGroups(const std::string &group_name, NvidiaCommunicationGroupPtr *intra_group,
+                             NvidiaCommunicationGroupPtr *inter_group);
+
+  // The hierarchical AllReduce: ReduceScatter within the node, AllReduce across the nodes and AllGather within the
+  // node. Return false if the flat AllReduce should be used instead, otherwise the NCCL result is written to 'result'.
+  bool HierarchicalAllReduce(const void *send_buff, void *recv_buff, size_t send_count, ncclDataType_t data_type,
+                             ncclRedOp_t reduce_op, const std::string &group_name, cudaStream_t stream,
+                             ncclResult_t *result);
+
+  // The hierarchical AllGather: AllGather within the node, then AllGather the data of the node across the nodes.
+  bool HierarchicalAllGather(const void *send_buff, void *recv_buff, size_t send_count, ncclDataType_t data_type,
+                             const std::string &group_name, cudaStream_t stream, ncclResult_t *result);
 };
 }  // namespace gpu
 
@@ -53,7 +53,9 @@
 #include "plugin/device/gpu/optimizer/matmul_biasadd_fusion.h"
 #include "plugin/device/gpu/optimizer/bce_with_logits_loss_fusion.h"
 #include "plugin/device/gpu/optimizer/insert_cast_gpu.h"
+#include "plugin/device/gpu/optimizer/all_reduce_grad_compression.h"
 #include "plugin/device/gpu/optimizer/neighbor_exchange_v2_fusion.h"
 #include "plugin/device/gpu/optimizer/bias_dropout_add_fusion.h"
+#include "plugin/device/gpu/optimizer/send_recv_fusion.h"
 
 #endif  // MINDSPORE_CCSRC_RUNTIME_HARDWARE_GPU_OPTIMIZER_H_
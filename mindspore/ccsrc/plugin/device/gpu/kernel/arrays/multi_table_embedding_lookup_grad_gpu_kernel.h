@@ -0,0 +1,128 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_ARRAYS_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_GPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_ARRAYS_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_GPU_KERNEL_H_
+
+#include <string>
+#include <vector>
+#include "plugin/device/gpu/kernel/gpu_kernel.h"
+#include "plugin/device/gpu/kernel/gpu_kernel_factory.h"
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/multi_table_embedding_lookup_impl.cuh"
+
+namespace mindspore {
+namespace kernel {
+template <typename T, typename S>
+class MultiTableEmbeddingLookupGradGpuKernelMod : public DeprecatedNativeGpuKernelMod {
+ public:
+  MultiTableEmbeddingLookupGradGpuKernelMod() { ResetResource(); }
+  ~MultiTableEmbeddingLookupGradGpuKernelMod() = default;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs, void *stream_ptr) override {
+    if (is_null_input_) {
+      return true;
+    }
+    VARIABLE_NOT_USED(workspace);
+    S *ids_addr = GetDeviceAddress<S>(inputs, 1);
+    S *offsets_addr = GetDeviceAddress<S>(inputs, 2);
+    T *dout_addr = GetDeviceAddress<T>(inputs, 3);
+    T *output_addr = GetDeviceAddress<T>(outputs, 0);
+    MultiTableEmbeddingLookupGrad(ids_addr, offsets_addr, dout_addr, output_addr, rows_, dim_, bag_num_,
+                                  bags_per_table_, bag_size_, mean_, reinterpret_cast<cudaStream_t>(stream_ptr));
+    return true;
+  }
+  bool Init(const CNodePtr &kernel_node) override {
+    auto kernel_name = common::AnfAlgo::GetCNodeName(kernel_node);
+    kernel_node_ = kernel_node;
+    size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel_node);
+    if (input_num != 4) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name << "', the number of inputs must be 4, but got " << input_num;
+    }
+    params_shape_ = AnfAlgo::GetInputDeviceShapeAdaptively(kernel_node, 0);
+    ids_shape_ = AnfAlgo::GetInputDeviceShapeAdaptively(kernel_node, 1);
+    offsets_shape_ = AnfAlgo::GetInputDeviceShapeAdaptively(kernel_node, 2);
+    dout_shape_ = AnfAlgo::GetInputDeviceShapeAdaptively(kernel_node, 3);
+    output_shape_ = AnfAlgo::GetOutputDeviceShapeAdaptively(kernel_node, 0);
+    is_null_input_ = CHECK_SHAPE_NULL(params_shape_, kernel_name, "params") ||
+                     CHECK_SHAPE_NULL(ids_shape_, kernel_name, "ids") ||
+                     CHECK_SHAPE_NULL(output_shape_, kernel_name, "output");
+    if (is_null_input_) {
+      InitSizeLists();
+      return true;
+    }
+    auto combiner = GetAttr<std::string>(kernel_node, "combiner");
+    bool pooling = combiner != "none";
+    mean_ = combiner == "mean";
+    const size_t min_ids_rank = pooling ? 2 : 1;
+    if (params_shape_.size() != 2 || ids_shape_.size() < min_ids_rank) {
+      MS_LOG(EXCEPTION) << "For '" << kernel_name << "', the rank of params must be 2 and the rank of ids must be at "
+                        << "least " << min_ids_rank << ", but got " << params_shape_.size() << " and "
+                        << ids_shape_.size();
+    }
+    rows_ = LongToSize(params_shape_[0]);
+    dim_ = LongToSize(params_shape_[1]);
+    bag_size_ = pooling ? LongToSize(ids_shape_.back()) : 1;
+    bag_num_ = SizeOf(ids_shape_) / bag_size_;
+    bags_per_table_ = bag_num_ / LongToSize(ids_shape_[0]);
+    InitSizeLists();
+    return true;
+  }
+  void ResetResource() noexcept override {
+    is_null_input_ = false;
+    mean_ = false;
+    rows_ = 0;
+    dim_ = 0;
+    bag_num_ = 0;
+    bags_per_table_ = 0;
+    bag_size_ = 1;
+    params_shape_.clear();
+    ids_shape_.clear();
+    offsets_shape_.clear();
+    dout_shape_.clear();
+    output_shape_.clear();
+    input_size_list_.clear();
+    output_size_list_.clear();
+    workspace_size_list_.clear();
+  }
+
+ protected:
+  void InitSizeLists() override {
+    input_size_list_.push_back(SizeOf(params_shape_) * sizeof(T));
+    input_size_list_.push_back(SizeOf(ids_shape_) * sizeof(S));
+    input_size_list_.push_back(SizeOf(offsets_shape_) * sizeof(S));
+    input_size_list_.push_back(SizeOf(dout_shape_) * sizeof(T));
+    output_size_list_.push_back(SizeOf(output_shape_) * sizeof(T));
+  }
+
+ private:
+  bool is_null_input_;
+  bool mean_;
+  size_t rows_;
+  size_t dim_;
+  size_t bag_num_;
+  size_t bags_per_table_;
+  size_t bag_size_;
+  ShapeVector params_shape_;
+  ShapeVector ids_shape_;
+  ShapeVector offsets_shape_;
+  ShapeVector dout_shape_;
+  ShapeVector output_shape_;
+};
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_ARRAYS_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_GPU_KERNEL_H_
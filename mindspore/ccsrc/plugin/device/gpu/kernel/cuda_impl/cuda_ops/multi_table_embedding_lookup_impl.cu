@@ -0,0 +1,143 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/multi_table_embedding_lookup_impl.cuh"
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/util.cuh"
+
+template <typename S>
+__device__ __forceinline__ bool GetEmbeddingRow(const S id, const S offset, const size_t rows, size_t *row) {
+  int64_t index = static_cast<int64_t>(id) + static_cast<int64_t>(offset);
+  if (id < 0 || index < 0 || index >= static_cast<int64_t>(rows)) {
+    return false;
+  }
+  *row = static_cast<size_t>(index);
+  return true;
+}
+
+template <typename S>
+__device__ __forceinline__ size_t CountValidIds(const S *ids, const S offset, const size_t rows,
+                                                const size_t bag_size) {
+  size_t valid_num = 0;
+  size_t row;
+  for (size_t i = 0; i < bag_size; ++i) {
+    valid_num += GetEmbeddingRow(ids[i], offset, rows, &row) ? 1 : 0;
+  }
+  return valid_num;
+}
+
+// One thread computes one element of the output [bag_num, dim], so the tables are looked up in one launch.
+template <typename T, typename S>
+__global__ void MultiTableEmbeddingLookupKernel(const T *params, const S *ids, const S *offsets, T *output,
+                                                const size_t rows, const size_t dim, const size_t bag_num,
+                                                const size_t bags_per_table, const size_t bag_size, const bool mean) {
+  for (size_t pos = blockIdx.x * blockDim.x + threadIdx.x; pos < bag_num * dim; pos += blockDim.x * gridDim.x) {
+    size_t bag = pos / dim;
+    size_t d = pos % dim;
+    S offset = offsets[bag / bags_per_table];
+    const S *bag_ids = ids + bag * bag_size;
+    float sum = 0;
+    size_t valid_num = 0;
+    size_t row;
+    for (size_t i = 0; i < bag_size; ++i) {
+      if (GetEmbeddingRow(bag_ids[i], offset, rows, &row)) {
+        sum += static_cast<float>(params[row * dim + d]);
+        ++valid_num;
+      }
+    }
+    if (mean && valid_num > 1) {
+      sum /= static_cast<float>(valid_num);
+    }
+    output[pos] = static_cast<T>(sum);
+  }
+}
+
+template <typename T, typename S>
+__global__ void MultiTableEmbeddingLookupGradKernel(const S *ids, const S *offsets, const T *dout, T *output,
+                                                    const size_t rows, const size_t dim, const size_t bag_num,
+                                                    const size_t bags_per_table, const size_t bag_size,
+                                                    const bool mean) {
+  size_t ids_num = bag_num * bag_size;
+  for (size_t pos = blockIdx.x * blockDim.x + threadIdx.x; pos < ids_num * dim; pos += blockDim.x * gridDim.x) {
+    size_t id_pos = pos / dim;
+    size_t d = pos % dim;
+    size_t bag = id_pos / bag_size;
+    S offset = offsets[bag / bags_per_table];
+    size_t row;
+    if (!GetEmbeddingRow(ids[id_pos], offset, rows, &row)) {
+      continue;
+    }
+    float grad = static_cast<float>(dout[bag * dim + d]);
+    if (mean) {
+      size_t valid_num = CountValidIds(ids + bag * bag_size, offset, rows, bag_size);
+      grad /= static_cast<float>(valid_num);
+    }
+    MsAtomicAdd(output + row * dim + d, static_cast<T>(grad));
+  }
+}
+
+template <typename T>
+__global__ void MultiTableEmbeddingLookupInitOutput(const size_t size, T *output) {
+  for (size_t pos = blockIdx.x * blockDim.x + threadIdx.x; pos < size; pos += blockDim.x * gridDim.x) {
+    output[pos] = static_cast<T>(0);
+  }
+}
+
+template <typename T, typename S>
+void MultiTableEmbeddingLookup(const T *params, const S *ids, const S *offsets, T *output, const size_t rows,
+                               const size_t dim, const size_t bag_num, const size_t bags_per_table,
+                               const size_t bag_size, const bool mean, cudaStream_t stream) {
+  size_t size = bag_num * dim;
+  MultiTableEmbeddingLookupKernel<<<GET_BLOCKS(size), GET_THREADS, 0, stream>>>(
+    params, ids, offsets, output, rows, dim, bag_num, bags_per_table, bag_size, mean);
+}
+
+template <typename T, typename S>
+void MultiTableEmbeddingLookupGrad(const S *ids, const S *offsets, const T *dout, T *output, const size_t rows,
+                                   const size_t dim, const size_t bag_num, const size_t bags_per_table,
+                                   const size_t bag_size, const bool mean, cudaStream_t stream) {
+  size_t size = rows * dim;
+  MultiTableEmbeddingLookupInitOutput<<<GET_BLOCKS(size), GET_THREADS, 0, stream>>>(size, output);
+  size = bag_num * bag_size * dim;
+  MultiTableEmbeddingLookupGradKernel<<<GET_BLOCKS(size), GET_THREADS, 0, stream>>>(
+    ids, offsets, dout, output, rows, dim, bag_num, bags_per_table, bag_size, mean);
+}
+
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookup<float, int>(
+  const float *params, const int *ids, const int *offsets, float *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookup<float, int64_t>(
+  const float *params, const int64_t *ids, const int64_t *offsets, float *output, const size_t rows,
+  const size_t dim, const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean,
+  cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookup<half, int>(
+  const half *params, const int *ids, const int *offsets, half *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookup<half, int64_t>(
+  const half *params, const int64_t *ids, const int64_t *offsets, half *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookupGrad<float, int>(
+  const int *ids, const int *offsets, const float *dout, float *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookupGrad<float, int64_t>(
+  const int64_t *ids, const int64_t *offsets, const float *dout, float *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookupGrad<half, int>(
+  const int *ids, const int *offsets, const half *dout, half *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
+template CUDA_LIB_EXPORT void MultiTableEmbeddingLookupGrad<half, int64_t>(
+  const int64_t *ids, const int64_t *offsets, const half *dout, half *output, const size_t rows, const size_t dim,
+  const size_t bag_num, const size_t bags_per_table, const size_t bag_size, const bool mean, cudaStream_t stream);
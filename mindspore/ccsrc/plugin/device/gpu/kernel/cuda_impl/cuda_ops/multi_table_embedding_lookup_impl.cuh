@@ -0,0 +1,31 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_IMPL_CUH_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_IMPL_CUH_
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/cuda_common.h"
+// The ids are viewed as [table_num, bags_per_table, bag_size], the bag_size is 1 when the combiner is "none".
+template <typename T, typename S>
+CUDA_LIB_EXPORT void MultiTableEmbeddingLookup(const T *params, const S *ids, const S *offsets, T *output,
+                                               const size_t rows, const size_t dim, const size_t bag_num,
+                                               const size_t bags_per_table, const size_t bag_size, const bool mean,
+                                               cudaStream_t stream);
+template <typename T, typename S>
+CUDA_LIB_EXPORT void MultiTableEmbeddingLookupGrad(const S *ids, const S *offsets, const T *dout, T *output,
+                                                   const size_t rows, const size_t dim, const size_t bag_num,
+                                                   const size_t bags_per_table, const size_t bag_size,
+                                                   const bool mean, cudaStream_t stream);
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_IMPL_CUH_
@@ -0,0 +1,165 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/tensor_statistics_impl.cuh"
+#include <cfloat>
+#include <algorithm>
+#include "include/cuda_fp16.h"
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/util.cuh"
+
+namespace {
+// The thread number must be a power of 2 for the reduction in block.
+constexpr size_t kStatisticsThreadNum = 256;
+constexpr size_t kStatisticsMaxBlockNum = 512;
+
+enum StatisticsCountIndex : size_t {
+  kValueNumIndex = 0,
+  kNegCountIndex,
+  kPosCountIndex,
+  kNanCountIndex,
+  kNegInfCountIndex,
+  kPosInfCountIndex,
+  kStatisticsCountNum
+};
+}  // namespace
+
+template <typename T>
+__device__ __forceinline__ double StatisticsValue(T value) {
+  return static_cast<double>(value);
+}
+
+template <>
+__device__ __forceinline__ double StatisticsValue(half value) {
+  return static_cast<double>(__half2float(value));
+}
+
+__global__ void ResetTensorStatistics(TensorStatisticsRecord *record) {
+  record->max_value = -DBL_MAX;
+  record->min_value = DBL_MAX;
+  record->sum = 0;
+  record->value_num = 0;
+  record->neg_count = 0;
+  record->pos_count = 0;
+  record->nan_count = 0;
+  record->neg_inf_count = 0;
+  record->pos_inf_count = 0;
+}
+
+// Each thread accumulates the elements of a grid-stride loop, then the threads of a block are reduced in shared
+// memory, and only the first thread of each block updates the record by the atomic operations.
+template <typename T>
+__global__ void TensorStatistics(const size_t size, const T *input, TensorStatisticsRecord *record) {
+  __shared__ double max_values[kStatisticsThreadNum];
+  __shared__ double min_values[kStatisticsThreadNum];
+  __shared__ double sums[kStatisticsThreadNum];
+  __shared__ unsigned long long counts[kStatisticsCountNum][kStatisticsThreadNum];  // NOLINT
+
+  double max_value = -DBL_MAX;
+  double min_value = DBL_MAX;
+  double sum = 0;
+  unsigned long long count[kStatisticsCountNum] = {0};  // NOLINT
+  for (size_t pos = blockIdx.x * blockDim.x + threadIdx.x; pos < size; pos += blockDim.x * gridDim.x) {
+    double value = StatisticsValue(input[pos]);
+    if (isnan(value)) {
+      ++count[kNanCountIndex];
+      continue;
+    }
+    if (isinf(value)) {
+      ++count[value > 0 ? kPosInfCountIndex : kNegInfCountIndex];
+      continue;
+    }
+    if (value < 0) {
+      ++count[kNegCountIndex];
+    } else if (value > 0) {
+      ++count[kPosCountIndex];
+    }
+    max_value = fmax(max_value, value);
+    min_value = fmin(min_value, value);
+    sum += value;
+    ++count[kValueNumIndex];
+  }
+
+  const size_t tid = threadIdx.x;
+  max_values[tid] = max_value;
+  min_values[tid] = min_value;
+  sums[tid] = sum;
+  for (size_t i = 0; i < kStatisticsCountNum; ++i) {
+    counts[i][tid] = count[i];
+  }
+  __syncthreads();
+  for (size_t stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+    if (tid < stride) {
+      max_values[tid] = fmax(max_values[tid], max_values[tid + stride]);
+      min_values[tid] = fmin(min_values[tid], min_values[tid + stride]);
+      sums[tid] += sums[tid + stride];
+      for (size_t i = 0; i < kStatisticsCountNum; ++i) {
+        counts[i][tid] += counts[i][tid + stride];
+      }
+    }
+    __syncthreads();
+  }
+
+  if (tid == 0) {
+    if (counts[kValueNumIndex][0] > 0) {
+      (void)MsAtomicMax(&record->max_value, max_values[0]);
+      (void)MsAtomicMin(&record->min_value, min_values[0]);
+      (void)MsAtomicAdd(&record->sum, sums[0]);
+      (void)MsAtomicAdd(&record->value_num, counts[kValueNumIndex][0]);
+      (void)MsAtomicAdd(&record->neg_count, counts[kNegCountIndex][0]);
+      (void)MsAtomicAdd(&record->pos_count, counts[kPosCountIndex][0]);
+    }
+    (void)MsAtomicAdd(&record->nan_count, counts[kNanCountIndex][0]);
+    (void)MsAtomicAdd(&record->neg_inf_count, counts[kNegInfCountIndex][0]);
+    (void)MsAtomicAdd(&record->pos_inf_count, counts[kPosInfCountIndex][0]);
+  }
+}
+
+template <typename T>
+void CalTensorStatistics(const size_t size, const T *input, TensorStatisticsRecord *record,
+                         cudaStream_t cuda_stream) {
+  ResetTensorStatistics<<<1, 1, 0, cuda_stream>>>(record);
+  if (size == 0) {
+    return;
+  }
+  size_t block_num = std::min((size + kStatisticsThreadNum - 1) / kStatisticsThreadNum, kStatisticsMaxBlockNum);
+  TensorStatistics<<<block_num, kStatisticsThreadNum, 0, cuda_stream>>>(size, input, record);
+  return;
+}
+
+template CUDA_LIB_EXPORT void CalTensorStatistics<bool>(const size_t size, const bool *input,
+                                                        TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<int8_t>(const size_t size, const int8_t *input,
+                                                          TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<int16_t>(const size_t size, const int16_t *input,
+                                                           TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<int32_t>(const size_t size, const int32_t *input,
+                                                           TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<int64_t>(const size_t size, const int64_t *input,
+                                                           TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<uint8_t>(const size_t size, const uint8_t *input,
+                                                           TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<uint16_t>(const size_t size, const uint16_t *input,
+                                                            TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<uint32_t>(const size_t size, const uint32_t *input,
+                                                            TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<uint64_t>(const size_t size, const uint64_t *input,
+                                                            TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<half>(const size_t size, const half *input,
+                                                        TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<float>(const size_t size, const float *input,
+                                                         TensorStatisticsRecord *record, cudaStream_t cuda_stream);
+template CUDA_LIB_EXPORT void CalTensorStatistics<double>(const size_t size, const double *input,
+                                                          TensorStatisticsRecord *record, cudaStream_t cuda_stream);
@@ -0,0 +1,39 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_TENSOR_STATISTICS_IMPL_CUH_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_TENSOR_STATISTICS_IMPL_CUH_
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/cuda_common.h"
+
+// The statistics of a tensor for the statistic dump. The max, min and sum only count the values which are neither nan
+// nor inf, and value_num is the number of these values.
+struct TensorStatisticsRecord {
+  double max_value;
+  double min_value;
+  double sum;
+  unsigned long long value_num;      // NOLINT
+  unsigned long long neg_count;      // NOLINT
+  unsigned long long pos_count;      // NOLINT
+  unsigned long long nan_count;      // NOLINT
+  unsigned long long neg_inf_count;  // NOLINT
+  unsigned long long pos_inf_count;  // NOLINT
+};
+
+// Reduce the input to the record on device, the record is reset before the reduction.
+template <typename T>
+CUDA_LIB_EXPORT void CalTensorStatistics(const size_t size, const T *input, TensorStatisticsRecord *record,
+                                         cudaStream_t cuda_stream);
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_CUDA_OPS_TENSOR_STATISTICS_IMPL_CUH_
@@ -0,0 +1,142 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/kernel/cuda_impl/rl/priority_buffer_impl.cuh"
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/util.cuh"
+
+namespace {
+constexpr float kMinPriority = 1e-7;
+constexpr size_t kMinTreeOffset = 2;
+}  // namespace
+
+// The min of two nodes, in which the empty nodes with zero priority are skipped.
+__device__ __forceinline__ float MinPriority(float lhs, float rhs) {
+  if (lhs == 0) {
+    return rhs;
+  }
+  if (rhs == 0) {
+    return lhs;
+  }
+  return fminf(lhs, rhs);
+}
+
+__device__ __forceinline__ void SetLeaf(const size_t capacity_pow_two, const size_t slot, const float priority,
+                                        float *tree) {
+  tree[capacity_pow_two + slot] = priority;
+  tree[kMinTreeOffset * capacity_pow_two + capacity_pow_two + slot] = priority;
+}
+
+__global__ void SetAppendLeaves(const size_t capacity, const size_t capacity_pow_two, const int *index,
+                                const int exp_batch, const float *max_priority, unsigned int *leaf_indices,
+                                float *tree) {
+  float priority = max_priority[0] > 0 ? max_priority[0] : 1.0f;
+  for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < static_cast<size_t>(exp_batch);
+       i += blockDim.x * gridDim.x) {
+    size_t slot = (static_cast<size_t>(index[0]) + i) % capacity;
+    leaf_indices[i] = slot;
+    SetLeaf(capacity_pow_two, slot, priority, tree);
+  }
+}
+
+__global__ void SetUpdateLeaves(const size_t capacity, const size_t capacity_pow_two, const float alpha,
+                                const int *indices, const float *priorities, const size_t batch_size,
+                                float *max_priority, float *tree) {
+  for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < batch_size; i += blockDim.x * gridDim.x) {
+    // The negative indices are out of the capacity after the cast too.
+    if (static_cast<size_t>(indices[i]) >= capacity) {
+      continue;
+    }
+    float priority = powf(fmaxf(priorities[i], kMinPriority), alpha);
+    (void)MsAtomicMax(max_priority, priority);
+    SetLeaf(capacity_pow_two, indices[i], priority, tree);
+  }
+}
+
+// Recompute the ancestors of the batch of leaves at the level above the leaves. The levels are updated one launch
+// after another from the bottom, so a node is always computed from its updated children, and the leaves sharing an
+// ancestor write the same value to it.
+template <typename T>
+__global__ void UpdateAncestorsAtLevel(const size_t capacity, const size_t capacity_pow_two, const T *leaf_indices,
+                                       const size_t batch_size, const size_t level, float *tree) {
+  float *min_tree = tree + kMinTreeOffset * capacity_pow_two;
+  for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < batch_size; i += blockDim.x * gridDim.x) {
+    if (static_cast<size_t>(leaf_indices[i]) >= capacity) {
+      continue;
+    }
+    size_t node = (capacity_pow_two + leaf_indices[i]) >> level;
+    size_t left = node << 1;
+    tree[node] = tree[left] + tree[left + 1];
+    min_tree[node] = MinPriority(min_tree[left], min_tree[left + 1]);
+  }
+}
+
+template <typename T>
+void UpdateAncestors(const size_t capacity, const size_t capacity_pow_two, const T *leaf_indices,
+                     const size_t batch_size, float *tree, cudaStream_t cuda_stream) {
+  for (size_t level = 1; (capacity_pow_two >> level) > 0; ++level) {
+    UpdateAncestorsAtLevel<<<GET_BLOCKS(batch_size), GET_THREADS, 0, cuda_stream>>>(
+      capacity, capacity_pow_two, leaf_indices, batch_size, level, tree);
+  }
+}
+
+__global__ void SampleKernel(const size_t capacity_pow_two, const float *tree, const float beta,
+                             const size_t batch_size, curandState *state, int *indices, float *weights) {
+  const float *min_tree = tree + kMinTreeOffset * capacity_pow_two;
+  for (size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < batch_size; i += blockDim.x * gridDim.x) {
+    // Stratified sampling: the i-th sample is drawn from the i-th of the batch_size equal segments.
+    float prefix_sum = (static_cast<float>(i) + curand_uniform(&state[i])) / batch_size * tree[1];
+    size_t node = 1;
+    while (node < capacity_pow_two) {
+      size_t left = node << 1;
+      // The rounding error may point past the last slot with priority, whose right side is empty.
+      if (prefix_sum <= tree[left] || tree[left + 1] == 0) {
+        node = left;
+      } else {
+        prefix_sum -= tree[left];
+        node = left + 1;
+      }
+    }
+    if (tree[node] == 0) {
+      // Only an empty tree reaches an empty leaf.
+      indices[i] = 0;
+      weights[i] = 0;
+      continue;
+    }
+    indices[i] = static_cast<int>(node - capacity_pow_two);
+    weights[i] = powf(tree[node] / min_tree[1], -beta);
+  }
+}
+
+void PriorityTreeAppend(const size_t capacity, const size_t capacity_pow_two, const int *index, const int exp_batch,
+                        const float *max_priority, unsigned int *leaf_indices, float *tree, cudaStream_t cuda_stream) {
+  SetAppendLeaves<<<GET_BLOCKS(exp_batch), GET_THREADS, 0, cuda_stream>>>(capacity, capacity_pow_two, index,
+                                                                          exp_batch, max_priority, leaf_indices, tree);
+  UpdateAncestors(capacity, capacity_pow_two, leaf_indices, static_cast<size_t>(exp_batch), tree, cuda_stream);
+}
+
+void PriorityTreeUpdate(const size_t capacity, const size_t capacity_pow_two, const float alpha, const int *indices,
+                        const float *priorities, const size_t batch_size, float *max_priority, float *tree,
+                        cudaStream_t cuda_stream) {
+  SetUpdateLeaves<<<GET_BLOCKS(batch_size), GET_THREADS, 0, cuda_stream>>>(
+    capacity, capacity_pow_two, alpha, indices, priorities, batch_size, max_priority, tree);
+  UpdateAncestors(capacity, capacity_pow_two, indices, batch_size, tree, cuda_stream);
+}
+
+void PriorityTreeSample(const size_t capacity_pow_two, const float *tree, const float beta, const size_t batch_size,
+                        curandState *state, int *indices, float *weights, cudaStream_t cuda_stream) {
+  SampleKernel<<<GET_BLOCKS(batch_size), GET_THREADS, 0, cuda_stream>>>(capacity_pow_two, tree, beta, batch_size,
+                                                                         state, indices, weights);
+}
@@ -0,0 +1,42 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_RL_PRIORITY_BUFFER_IMPL_CUH_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_RL_PRIORITY_BUFFER_IMPL_CUH_
+#include <curand_kernel.h>
+#include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/cuda_common.h"
+
+// The priority tree of the replay buffer is a float tensor of 4 * capacity_pow_two elements. The sum tree takes the
+// first half and the min tree takes the second half, the root of each is node 1 and the leaf of slot i is node
+// capacity_pow_two + i. The empty slots have zero priority, so a zero initialized tensor is an empty tree.
+
+// Give the exp_batch slots appended by BufferAppend from index the max priority, which is 1 before any update.
+CUDA_LIB_EXPORT void PriorityTreeAppend(const size_t capacity, const size_t capacity_pow_two, const int *index,
+                                        const int exp_batch, const float *max_priority, unsigned int *leaf_indices,
+                                        float *tree, cudaStream_t cuda_stream);
+
+// Set the priorities of the batch of slots to priority^alpha and update the max priority. The indices out of the
+// capacity are ignored.
+CUDA_LIB_EXPORT void PriorityTreeUpdate(const size_t capacity, const size_t capacity_pow_two, const float alpha,
+                                        const int *indices, const float *priorities, const size_t batch_size,
+                                        float *max_priority, float *tree, cudaStream_t cuda_stream);
+
+// Sample a slot from each of the batch_size segments of the total priority, and the importance sampling weight
+// (priority / min_priority)^-beta, which is normalized by the max weight.
+CUDA_LIB_EXPORT void PriorityTreeSample(const size_t capacity_pow_two, const float *tree, const float beta,
+                                        const size_t batch_size, curandState *state, int *indices, float *weights,
+                                        cudaStream_t cuda_stream);
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_CUDA_IMPL_RL_PRIORITY_BUFFER_IMPL_CUH_
@@ -0,0 +1,210 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/kernel/rl/priority_buffer_gpu_kernel.h"
+
+#include <chrono>
+#include <random>
+#include "kernel/common_utils.h"
+#include "plugin/device/gpu/kernel/cuda_impl/rl/rl_buffer_impl.cuh"
+#include "plugin/device/gpu/kernel/cuda_impl/rl/priority_buffer_impl.cuh"
+#include "plugin/device/gpu/hal/device/gpu_common.h"
+#include "plugin/device/gpu/hal/device/gpu_memory_allocator.h"
+
+namespace mindspore {
+namespace kernel {
+namespace {
+constexpr size_t kDouble = 2;
+constexpr size_t kPriorityTreeNum = 2;
+constexpr size_t kAppendTreeOffset = 2;
+constexpr size_t kAppendMaxPriorityOffset = 3;
+constexpr size_t kSampleTreeOffset = 2;
+constexpr size_t kUpdateTreeIndex = 0;
+constexpr size_t kUpdateMaxPriorityIndex = 1;
+constexpr size_t kUpdateIndicesIndex = 2;
+constexpr size_t kUpdatePrioritiesIndex = 3;
+
+size_t CapacityPowTwo(const CNodePtr &kernel_node, int64_t capacity) {
+  if (capacity <= 0) {
+    MS_LOG(EXCEPTION) << "For '" << common::AnfAlgo::GetCNodeName(kernel_node)
+                      << "', the capacity should be greater than 0, but got " << capacity;
+  }
+  size_t capacity_pow_two = 1;
+  while (capacity_pow_two < LongToSize(capacity)) {
+    capacity_pow_two *= kDouble;
+  }
+  return capacity_pow_two;
+}
+
+// The sum tree and the min tree, each of which has 2 * capacity_pow_two nodes.
+size_t PriorityTreeSize(size_t capacity_pow_two) {
+  return kPriorityTreeNum * kDouble * capacity_pow_two * sizeof(float);
+}
+}  // namespace
+
+bool PriorityBufferAppendKernelMod::Init(const CNodePtr &kernel_node) {
+  kernel_node_ = kernel_node;
+  auto shapes = GetAttr<std::vector<int64_t>>(kernel_node, "buffer_elements");
+  auto types = GetAttr<std::vector<TypePtr>>(kernel_node, "buffer_dtype");
+  capacity_ = GetAttr<int64_t>(kernel_node, "capacity");
+  exp_batch_ = GetAttr<int64_t>(kernel_node, "exp_batch");
+  capacity_pow_two_ = CapacityPowTwo(kernel_node, capacity_);
+  element_nums_ = shapes.size();
+  for (size_t i = 0; i < element_nums_; i++) {
+    exp_element_list_.push_back(shapes[i] * UnitSizeInBytes(types[i]->type_id()));
+  }
+  // buffer size
+  for (auto i : exp_element_list_) {
+    input_size_list_.push_back(i * capacity_);
+  }
+  // exp size
+  for (auto i : exp_element_list_) {
+    input_size_list_.push_back(i * exp_batch_);
+  }
+  // count and head
+  input_size_list_.push_back(sizeof(int));
+  input_size_list_.push_back(sizeof(int));
+  // priority tree and max priority
+  input_size_list_.push_back(PriorityTreeSize(capacity_pow_two_));
+  input_size_list_.push_back(sizeof(float));
+  output_size_list_.push_back(0);
+  // append index and the slots of the appended experiences
+  workspace_size_list_.push_back(sizeof(int));
+  workspace_size_list_.push_back(LongToSize(exp_batch_) * sizeof(unsigned int));
+  return true;
+}
+
+bool PriorityBufferAppendKernelMod::Launch(const std::vector<AddressPtr> &inputs,
+                                           const std::vector<AddressPtr> &workspace, const std::vector<AddressPtr> &,
+                                           void *stream) {
+  int *count_addr = GetDeviceAddress<int>(inputs, kDouble * element_nums_);
+  int *head_addr = GetDeviceAddress<int>(inputs, kDouble * element_nums_ + 1);
+  float *tree_addr = GetDeviceAddress<float>(inputs, kDouble * element_nums_ + kAppendTreeOffset);
+  float *max_priority_addr = GetDeviceAddress<float>(inputs, kDouble * element_nums_ + kAppendMaxPriorityOffset);
+  int *index_addr = GetDeviceAddress<int>(workspace, 0);
+  unsigned int *slot_addr = GetDeviceAddress<unsigned int>(workspace, 1);
+  auto cuda_stream = reinterpret_cast<cudaStream_t>(stream);
+  IncreaseCount(capacity_, LongToInt(exp_batch_), count_addr, head_addr, index_addr, cuda_stream);
+  for (size_t i = 0; i < element_nums_; i++) {
+    auto buffer_addr = GetDeviceAddress<unsigned char>(inputs, i);
+    auto exp_addr = GetDeviceAddress<unsigned char>(inputs, i + element_nums_);
+    size_t one_exp_len = input_size_list_[i + element_nums_];
+    BufferAppend(capacity_, one_exp_len, index_addr, LongToInt(exp_batch_), buffer_addr, exp_addr, cuda_stream);
+  }
+  PriorityTreeAppend(LongToSize(capacity_), capacity_pow_two_, index_addr, LongToInt(exp_batch_), max_priority_addr,
+                     slot_addr, tree_addr, cuda_stream);
+  return true;
+}
+
+PriorityBufferSampleKernelMod::~PriorityBufferSampleKernelMod() {
+  if (dev_states_ != nullptr) {
+    device::gpu::GPUMemoryAllocator::GetInstance().FreeTensorMem(static_cast<void *>(dev_states_));
+  }
+}
+
+bool PriorityBufferSampleKernelMod::Init(const CNodePtr &kernel_node) {
+  auto kernel_name = common::AnfAlgo::GetCNodeName(kernel_node);
+  kernel_node_ = kernel_node;
+  auto shapes = GetAttr<std::vector<int64_t>>(kernel_node, "buffer_elements");
+  auto types = GetAttr<std::vector<TypePtr>>(kernel_node, "buffer_dtype");
+  capacity_ = GetAttr<int64_t>(kernel_node, "capacity");
+  seed_ = GetAttr<int64_t>(kernel_node, "seed");
+  beta_ = GetAttr<float>(kernel_node, "beta");
+  batch_size_ = LongToSize(GetAttr<int64_t>(kernel_node, "batch_size"));
+  capacity_pow_two_ = CapacityPowTwo(kernel_node, capacity_);
+  element_nums_ = shapes.size();
+  // Set default seed, if seed == 0
+  if (seed_ == 0) {
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    seed_ = generator();
+  }
+  // Keep the device memory for curandstate
+  const size_t state_size = sizeof(curandState) * batch_size_;
+  void *dev_state = device::gpu::GPUMemoryAllocator::GetInstance().AllocTensorMem(state_size);
+  if (dev_state == nullptr) {
+    MS_LOG(EXCEPTION) << "For '" << kernel_name << "', failed to alloc dev_state, size is " << state_size;
+  }
+  dev_states_ = reinterpret_cast<curandState *>(dev_state);
+
+  for (size_t i = 0; i < element_nums_; i++) {
+    auto element = shapes[i] * UnitSizeInBytes(types[i]->type_id());
+    exp_element_list_.push_back(element);
+    input_size_list_.push_back(capacity_ * element);
+    output_size_list_.push_back(batch_size_ * element);
+  }
+  // count, head and priority tree
+  input_size_list_.push_back(sizeof(int));
+  input_size_list_.push_back(sizeof(int));
+  input_size_list_.push_back(PriorityTreeSize(capacity_pow_two_));
+  // indices and weights
+  output_size_list_.push_back(batch_size_ * sizeof(int));
+  output_size_list_.push_back(batch_size_ * sizeof(float));
+  return true;
+}
+
+bool PriorityBufferSampleKernelMod::Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &,
+                                           const std::vector<AddressPtr> &outputs, void *stream) {
+  int *count_addr = GetDeviceAddress<int>(inputs, element_nums_);
+  int *head_addr = GetDeviceAddress<int>(inputs, element_nums_ + 1);
+  float *tree_addr = GetDeviceAddress<float>(inputs, element_nums_ + kSampleTreeOffset);
+  int *indices_addr = GetDeviceAddress<int>(outputs, element_nums_);
+  float *weights_addr = GetDeviceAddress<float>(outputs, element_nums_ + 1);
+  auto cuda_stream = reinterpret_cast<cudaStream_t>(stream);
+  CheckBatchSize(count_addr, head_addr, batch_size_, capacity_, cuda_stream);
+  if (!states_init_) {
+    RandInit(batch_size_, seed_, dev_states_, cuda_stream);
+    states_init_ = true;
+  }
+  PriorityTreeSample(capacity_pow_two_, tree_addr, beta_, batch_size_, dev_states_, indices_addr, weights_addr,
+                     cuda_stream);
+  // The sampled indices are in [0, capacity), so they are the same as unsigned.
+  auto indexes = reinterpret_cast<unsigned int *>(indices_addr);
+  for (size_t i = 0; i < element_nums_; i++) {
+    auto buffer_addr = GetDeviceAddress<unsigned char>(inputs, i);
+    auto out_addr = GetDeviceAddress<unsigned char>(outputs, i);
+    size_t size = batch_size_ * exp_element_list_[i];
+    BufferSample(size, exp_element_list_[i], indexes, buffer_addr, out_addr, cuda_stream);
+  }
+  return true;
+}
+
+bool PriorityBufferUpdateKernelMod::Init(const CNodePtr &kernel_node) {
+  kernel_node_ = kernel_node;
+  capacity_ = GetAttr<int64_t>(kernel_node, "capacity");
+  alpha_ = GetAttr<float>(kernel_node, "alpha");
+  batch_size_ = LongToSize(GetAttr<int64_t>(kernel_node, "batch_size"));
+  capacity_pow_two_ = CapacityPowTwo(kernel_node, capacity_);
+  input_size_list_.push_back(PriorityTreeSize(capacity_pow_two_));
+  input_size_list_.push_back(sizeof(float));
+  input_size_list_.push_back(batch_size_ * sizeof(int));
+  input_size_list_.push_back(batch_size_ * sizeof(float));
+  output_size_list_.push_back(0);
+  return true;
+}
+
+bool PriorityBufferUpdateKernelMod::Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &,
+                                           const std::vector<AddressPtr> &, void *stream) {
+  float *tree_addr = GetDeviceAddress<float>(inputs, kUpdateTreeIndex);
+  float *max_priority_addr = GetDeviceAddress<float>(inputs, kUpdateMaxPriorityIndex);
+  int *indices_addr = GetDeviceAddress<int>(inputs, kUpdateIndicesIndex);
+  float *priorities_addr = GetDeviceAddress<float>(inputs, kUpdatePrioritiesIndex);
+  auto cuda_stream = reinterpret_cast<cudaStream_t>(stream);
+  PriorityTreeUpdate(LongToSize(capacity_), capacity_pow_two_, alpha_, indices_addr, priorities_addr, batch_size_,
+                     max_priority_addr, tree_addr, cuda_stream);
+  return true;
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_RL_PRIORITY_BUFFER_GPU_KERNEL_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_RL_PRIORITY_BUFFER_GPU_KERNEL_H_
+
+#include <curand_kernel.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "plugin/device/gpu/kernel/gpu_kernel.h"
+#include "plugin/device/gpu/kernel/gpu_kernel_factory.h"
+
+namespace mindspore {
+namespace kernel {
+// The prioritized experience replay on the buffers of BufferAppend, BufferSample and BufferGet. The priorities are
+// kept in a priority tree tensor of 4 * capacity_pow_two float32 and a max priority tensor of one float32, which are
+// zero initialized parameters shared by PriorityBufferAppend, PriorityBufferSample and PriorityBufferUpdate, so the
+// whole replay stays on device.
+
+// PriorityBufferAppend appends the experiences as BufferAppend, and gives them the max priority.
+// Inputs: buffers, experiences, count, head, priority tree, max priority.
+class PriorityBufferAppendKernelMod : public DeprecatedNativeGpuKernelMod {
+ public:
+  PriorityBufferAppendKernelMod() = default;
+  ~PriorityBufferAppendKernelMod() override = default;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs, void *stream_ptr) override;
+  bool Init(const CNodePtr &kernel_node) override;
+
+ protected:
+  void InitSizeLists() override {}
+
+ private:
+  size_t element_nums_{0};
+  int64_t exp_batch_{0};
+  int64_t capacity_{0};
+  size_t capacity_pow_two_{0};
+  std::vector<size_t> exp_element_list_;
+};
+
+// PriorityBufferSample samples a batch of the experiences in proportion to their priorities.
+// Inputs: buffers, count, head, priority tree.
+// Outputs: the sampled experiences, the int32 indices and the float32 importance sampling weights.
+class PriorityBufferSampleKernelMod : public DeprecatedNativeGpuKernelMod {
+ public:
+  PriorityBufferSampleKernelMod() = default;
+  ~PriorityBufferSampleKernelMod() override;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs, void *stream_ptr) override;
+  bool Init(const CNodePtr &kernel_node) override;
+
+ protected:
+  void InitSizeLists() override {}
+
+ private:
+  size_t element_nums_{0};
+  int64_t capacity_{0};
+  size_t capacity_pow_two_{0};
+  size_t batch_size_{0};
+  int64_t seed_{0};
+  float beta_{1.0};
+  bool states_init_{false};
+  curandState *dev_states_{nullptr};
+  std::vector<size_t> exp_element_list_;
+};
+
+// PriorityBufferUpdate updates the priorities of a batch of the experiences, such as the sampled ones.
+// Inputs: priority tree, max priority, int32 indices, float32 priorities.
+class PriorityBufferUpdateKernelMod : public DeprecatedNativeGpuKernelMod {
+ public:
+  PriorityBufferUpdateKernelMod() = default;
+  ~PriorityBufferUpdateKernelMod() override = default;
+
+  bool Launch(const std::vector<AddressPtr> &inputs, const std::vector<AddressPtr> &workspace,
+              const std::vector<AddressPtr> &outputs, void *stream_ptr) override;
+  bool Init(const CNodePtr &kernel_node) override;
+
+ protected:
+  void InitSizeLists() override {}
+
+ private:
+  int64_t capacity_{0};
+  size_t capacity_pow_two_{0};
+  size_t batch_size_{0};
+  float alpha_{1.0};
+};
+
+MS_REG_GPU_KERNEL(PriorityBufferAppend, PriorityBufferAppendKernelMod)
+MS_REG_GPU_KERNEL(PriorityBufferSample, PriorityBufferSampleKernelMod)
+MS_REG_GPU_KERNEL(PriorityBufferUpdate, PriorityBufferUpdateKernelMod)
+}  // namespace kernel
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_KERNEL_RL_PRIORITY_BUFFER_GPU_KERNEL_H_
@@ -73,8 +73,8 @@ PriorityReplayBuffer::~PriorityReplayBuffer() {
 }
 
 bool PriorityReplayBuffer::Push(const std::vector<AddressPtr> &transition, cudaStream_t stream) {
-  // Head point to the latest item.
-  head_ = head_ >= capacity_ ? 0 : head_ + 1;
+  // Head point to the latest item, it starts from -1UL and wraps to 0 after the last slot of the capacity.
+  head_ = head_ + 1 >= capacity_ ? 0 : head_ + 1;
   valid_size_ = valid_size_ >= capacity_ ? capacity_ : valid_size_ + 1;
 
   // Copy transition to FIFO.
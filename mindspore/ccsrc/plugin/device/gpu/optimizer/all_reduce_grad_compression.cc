@@ -0,0 +1,113 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/optimizer/all_reduce_grad_compression.h"
+
+#include <string>
+#include <vector>
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "ir/primitive.h"
+#include "include/common/utils/utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+constexpr auto kCompressionFp16 = "fp16";
+constexpr auto kReduceOpSum = "sum";
+
+AnfNodePtr CreateCast(const FuncGraphPtr &graph, const AnfNodePtr &input, TypeId dst_type) {
+  auto prim = std::make_shared<Primitive>(prim::kPrimCast->name());
+  std::vector<AnfNodePtr> inputs = {NewValueNode(prim), input};
+  auto cast = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(cast);
+  common::AnfAlgo::SetOutputTypeAndDetailShape({dst_type}, {common::AnfAlgo::GetOutputDetailShape(input, 0)},
+                                               cast.get());
+  return cast;
+}
+}  // namespace
+
+AllReduceGradCompression::AllReduceGradCompression(bool multigraph)
+    : PatternProcessPass("all_reduce_grad_compression", multigraph) {
+  input_ = std::make_shared<Var>();
+  auto compression = common::GetEnv("MS_DEV_ALLREDUCE_GRAD_COMPRESSION");
+  if (compression.empty()) {
+    return;
+  }
+  auto pos = compression.find(':');
+  if (compression.substr(0, pos) != kCompressionFp16) {
+    MS_LOG(WARNING) << "Unsupported gradient compression: " << compression << ", only " << kCompressionFp16
+                    << " is supported.";
+    return;
+  }
+  enable_ = true;
+  while (pos != std::string::npos) {
+    auto next_pos = compression.find(',', pos + 1);
+    auto fusion_id = compression.substr(pos + 1, next_pos == std::string::npos ? next_pos : next_pos - pos - 1);
+    try {
+      (void)fusion_ids_.insert(std::stoll(fusion_id));
+    } catch (const std::exception &) {
+      MS_LOG(EXCEPTION) << "Invalid fusion id '" << fusion_id << "' in MS_DEV_ALLREDUCE_GRAD_COMPRESSION: "
+                        << compression;
+    }
+    pos = next_pos;
+  }
+}
+
+const BaseRef AllReduceGradCompression::DefinePattern() const {
+  VectorRef all_reduce = VectorRef({prim::kPrimAllReduce, input_});
+  return all_reduce;
+}
+
+const AnfNodePtr AllReduceGradCompression::Process(const FuncGraphPtr &graph, const AnfNodePtr &node,
+                                                   const EquivPtr &) const {
+  MS_EXCEPTION_IF_NULL(graph);
+  MS_EXCEPTION_IF_NULL(node);
+  if (!enable_) {
+    return nullptr;
+  }
+  auto cnode = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(cnode);
+  // Only the gradients in the fusion buckets are compressed, the other AllReduce such as the statistics of
+  // SyncBatchNorm keep the precision. The overflow of float16 sum is caught by the overflow check of loss scale after
+  // the AllReduce.
+  if (!common::AnfAlgo::HasNodeAttr(kAttrFusion, cnode) || !common::AnfAlgo::HasNodeAttr(kAttrOp, cnode)) {
+    return nullptr;
+  }
+  auto fusion_id = common::AnfAlgo::GetNodeAttr<int64_t>(cnode, kAttrFusion);
+  if (fusion_id == 0 || (!fusion_ids_.empty() && fusion_ids_.count(fusion_id) == 0) ||
+      common::AnfAlgo::GetNodeAttr<std::string>(cnode, kAttrOp) != kReduceOpSum ||
+      common::AnfAlgo::GetOutputInferDataType(cnode, 0) != kNumberTypeFloat32 ||
+      common::AnfAlgo::IsDynamicShape(cnode)) {
+    return nullptr;
+  }
+
+  auto input = common::AnfAlgo::GetInputNode(cnode, 0);
+  MS_EXCEPTION_IF_NULL(input);
+  auto prim = std::make_shared<Primitive>(prim::kPrimAllReduce->name());
+  auto new_all_reduce = graph->NewCNode({NewValueNode(prim), CreateCast(graph, input, kNumberTypeFloat16)});
+  MS_EXCEPTION_IF_NULL(new_all_reduce);
+  new_all_reduce->set_scope(cnode->scope());
+  common::AnfAlgo::CopyNodeAttrs(cnode, new_all_reduce);
+  common::AnfAlgo::SetOutputTypeAndDetailShape({kNumberTypeFloat16}, {common::AnfAlgo::GetOutputDetailShape(cnode, 0)},
+                                               new_all_reduce.get());
+  MS_LOG(INFO) << "Compress the gradient of " << cnode->fullname_with_scope() << " to float16, fusion id: "
+               << fusion_id;
+  return CreateCast(graph, new_all_reduce, kNumberTypeFloat32);
+}
+}  // namespace opt
+}  // namespace mindspore
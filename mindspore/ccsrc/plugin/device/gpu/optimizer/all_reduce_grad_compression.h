@@ -0,0 +1,45 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_ALL_REDUCE_GRAD_COMPRESSION_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_ALL_REDUCE_GRAD_COMPRESSION_H_
+
+#include <memory>
+#include <set>
+#include "backend/common/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// Compress the float32 gradients of AllReduce to float16 on the wire: Cast(fp16) -> AllReduce -> Cast(fp32), which
+// halves the communication size of the fusion buckets. It is enabled by the env MS_DEV_ALLREDUCE_GRAD_COMPRESSION,
+// "fp16" for all the fused AllReduce, or "fp16:1,2" for the AllReduce whose fusion ids are 1 or 2 only, so that the
+// compression can be configured for the parameter groups by their comm fusion ids.
+class AllReduceGradCompression : public PatternProcessPass {
+ public:
+  explicit AllReduceGradCompression(bool multigraph = true);
+  ~AllReduceGradCompression() override = default;
+  const BaseRef DefinePattern() const override;
+  const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const override;
+
+ private:
+  bool enable_{false};
+  // The fusion ids to compress, empty means all the fused AllReduce.
+  std::set<int64_t> fusion_ids_;
+  VarPtr input_;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_ALL_REDUCE_GRAD_COMPRESSION_H_
@@ -0,0 +1,212 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/gpu/optimizer/send_recv_fusion.h"
+
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+#include "backend/common/optimizer/helper.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/utils/utils.h"
+#include "ir/primitive.h"
+#include "utils/hash_map.h"
+#include "utils/hash_set.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+constexpr size_t kSendInputNum = 1;
+
+struct SendRecvBatch {
+  std::string group_;
+  TypeId type_{kTypeUnknown};
+  size_t first_index_{0};
+  std::vector<CNodePtr> sends_;
+  std::vector<CNodePtr> recvs_;
+  mindspore::HashSet<AnfNodePtr> nodes_;
+
+  void Clear() {
+    sends_.clear();
+    recvs_.clear();
+    nodes_.clear();
+  }
+};
+
+// The send is fused only if its output is only used for the control dependency.
+bool IsFusibleSend(const FuncGraphManagerPtr &manager, const CNodePtr &send) {
+  if (common::AnfAlgo::GetInputTensorNum(send) != kSendInputNum || send->size() != kSendInputNum + 1) {
+    return false;
+  }
+  auto &node_users = manager->node_users();
+  auto iter = node_users.find(send);
+  if (iter == node_users.end()) {
+    return false;
+  }
+  for (const auto &user : iter->second) {
+    bool control_user = (IsPrimitiveCNode(user.first, prim::kPrimDepend) && user.second == kDependAttachNodeIndex) ||
+                        IsPrimitiveCNode(user.first, prim::kPrimUpdateState);
+    if (!control_user) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The inputs of the receive are only the placeholders, which are dropped after fusion.
+bool IsFusibleRecv(const CNodePtr &recv) {
+  if (common::AnfAlgo::GetOutputTensorNum(recv) != 1) {
+    return false;
+  }
+  for (size_t i = 1; i < recv->size(); ++i) {
+    if (recv->input(i)->isa<CNode>()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether the node depends on any node of the batch, the nodes before the batch in the topological order are skipped.
+bool DependOnBatch(const CNodePtr &node, const SendRecvBatch &batch,
+                   const mindspore::HashMap<AnfNodePtr, size_t> &topo_index) {
+  std::queue<AnfNodePtr> to_visit;
+  mindspore::HashSet<AnfNodePtr> visited;
+  to_visit.push(node);
+  while (!to_visit.empty()) {
+    auto cnode = to_visit.front()->cast<CNodePtr>();
+    to_visit.pop();
+    for (const auto &input : cnode->inputs()) {
+      if (!input->isa<CNode>() || visited.count(input) > 0) {
+        continue;
+      }
+      (void)visited.insert(input);
+      if (batch.nodes_.count(input) > 0) {
+        return true;
+      }
+      auto iter = topo_index.find(input);
+      if (iter != topo_index.end() && iter->second > batch.first_index_) {
+        to_visit.push(input);
+      }
+    }
+  }
+  return false;
+}
+
+bool FuseBatch(const FuncGraphPtr &graph, const SendRecvBatch &batch) {
+  // The AllToAllv kernel needs both the inputs and the outputs.
+  if (batch.sends_.empty() || batch.recvs_.empty()) {
+    return false;
+  }
+  std::vector<AnfNodePtr> inputs = {NewValueNode(std::make_shared<Primitive>(kAllToAllVOpName))};
+  std::vector<int64_t> send_rank_ids;
+  for (const auto &send : batch.sends_) {
+    inputs.push_back(send->input(1));
+    send_rank_ids.push_back(common::AnfAlgo::GetNodeAttr<int64_t>(send, kAttrDestRank));
+  }
+  auto all_to_all_v = graph->NewCNode(inputs);
+  MS_EXCEPTION_IF_NULL(all_to_all_v);
+
+  std::vector<int64_t> recv_rank_ids;
+  std::vector<TypeId> types;
+  std::vector<BaseShapePtr> shapes;
+  for (const auto &recv : batch.recvs_) {
+    recv_rank_ids.push_back(common::AnfAlgo::GetNodeAttr<int64_t>(recv, kAttrSrcRank));
+    types.push_back(common::AnfAlgo::GetOutputInferDataType(recv, 0));
+    shapes.push_back(common::AnfAlgo::GetOutputDetailShape(recv, 0));
+  }
+  common::AnfAlgo::SetOutputTypeAndDetailShape(types, shapes, all_to_all_v.get());
+  common::AnfAlgo::SetNodeAttr(kAttrSendRankIds, MakeValue<std::vector<int64_t>>(send_rank_ids), all_to_all_v);
+  common::AnfAlgo::SetNodeAttr(kAttrRecvRankIds, MakeValue<std::vector<int64_t>>(recv_rank_ids), all_to_all_v);
+  common::AnfAlgo::SetNodeAttr(kAttrGroup, MakeValue<std::string>(batch.group_), all_to_all_v);
+
+  std::vector<AnfNodePtr> outputs;
+  CreateMultipleOutputsOfAnfNode(graph, all_to_all_v, batch.recvs_.size(), &outputs);
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  for (size_t i = 0; i < batch.recvs_.size(); ++i) {
+    (void)manager->Replace(batch.recvs_[i], outputs[i]);
+  }
+  for (const auto &send : batch.sends_) {
+    (void)manager->Replace(send, all_to_all_v);
+  }
+  MS_LOG(INFO) << "Fuse " << batch.sends_.size() << " Send and " << batch.recvs_.size() << " Receive of group "
+               << batch.group_ << " to " << all_to_all_v->fullname_with_scope();
+  return true;
+}
+}  // namespace
+
+bool SendRecvFusion::Run(const FuncGraphPtr &graph) {
+  MS_EXCEPTION_IF_NULL(graph);
+  static const bool enable = common::GetEnv("MS_DEV_GPU_SEND_RECV_FUSION") == "1";
+  if (!enable) {
+    return false;
+  }
+  auto manager = graph->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto node_list = TopoSort(graph->get_return());
+  mindspore::HashMap<AnfNodePtr, size_t> topo_index;
+  for (size_t i = 0; i < node_list.size(); ++i) {
+    topo_index[node_list[i]] = i;
+  }
+
+  // Only one batch is open at a time, so the fused batches keep the topological order of each other and the fusion
+  // can not make a cycle between them.
+  std::vector<SendRecvBatch> batches;
+  SendRecvBatch batch;
+  auto close_batch = [&batches, &batch]() {
+    if (batch.nodes_.size() > 1) {
+      batches.push_back(batch);
+    }
+    batch.Clear();
+  };
+  for (size_t i = 0; i < node_list.size(); ++i) {
+    auto cnode = node_list[i]->cast<CNodePtr>();
+    bool is_send = IsPrimitiveCNode(cnode, prim::kPrimSend);
+    bool is_recv = IsPrimitiveCNode(cnode, prim::kPrimReceive);
+    if (!is_send && !is_recv) {
+      continue;
+    }
+    if ((is_send && !IsFusibleSend(manager, cnode)) || (is_recv && !IsFusibleRecv(cnode))) {
+      close_batch();
+      continue;
+    }
+    auto group = common::AnfAlgo::GetNodeAttr<std::string>(cnode, kAttrGroup);
+    auto type = is_send ? common::AnfAlgo::GetPrevNodeOutputInferDataType(cnode, 0)
+                        : common::AnfAlgo::GetOutputInferDataType(cnode, 0);
+    if (!batch.nodes_.empty() &&
+        (group != batch.group_ || type != batch.type_ || DependOnBatch(cnode, batch, topo_index))) {
+      close_batch();
+    }
+    if (batch.nodes_.empty()) {
+      batch.group_ = group;
+      batch.type_ = type;
+      batch.first_index_ = i;
+    }
+    (void)batch.nodes_.insert(cnode);
+    (is_send ? batch.sends_ : batch.recvs_).push_back(cnode);
+  }
+  close_batch();
+
+  bool changed = false;
+  for (const auto &fused_batch : batches) {
+    changed = FuseBatch(graph, fused_batch) || changed;
+  }
+  return changed;
+}
+}  // namespace opt
+}  // namespace mindspore
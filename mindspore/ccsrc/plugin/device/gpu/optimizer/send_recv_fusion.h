@@ -0,0 +1,36 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_SEND_RECV_FUSION_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_SEND_RECV_FUSION_H_
+
+#include "backend/common/optimizer/optimizer.h"
+
+namespace mindspore {
+namespace opt {
+// Fuse the adjacent independent Send and Receive of the same group and data type to one AllToAllv, whose kernel issues
+// all the transfers in one ncclGroupStart/ncclGroupEnd, so the pipeline parallel does not launch a NCCL kernel for
+// each tiny transfer. The fusion changes the issue order of the transfers, and it is enabled by the env
+// MS_DEV_GPU_SEND_RECV_FUSION=1.
+class SendRecvFusion : public Pass {
+ public:
+  SendRecvFusion() : Pass("send_recv_fusion") {}
+  ~SendRecvFusion() override = default;
+  bool Run(const FuncGraphPtr &graph) override;
+};
+}  // namespace opt
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_GPU_OPTIMIZER_SEND_RECV_FUSION_H_
@@ -36,6 +36,9 @@ constexpr char kEnvCommType[] = "MS_COMM_TYPE";
 constexpr char kEnvInterface[] = "MS_INTERFACE";
 constexpr char kEnvPServerNum[] = "MS_SERVER_NUM";
 constexpr char kEnvWorkerNum[] = "MS_WORKER_NUM";
+// The staleness bound of the stale synchronous parallel training, the bulk synchronous training is used when it is not
+// set or set to 0.
+constexpr char kEnvPsStaleness[] = "MS_PS_STALENESS";
 constexpr char kEnvSchedulerHost[] = "MS_SCHED_HOST";
 constexpr char kEnvSchedulerPort[] = "MS_SCHED_PORT";
 constexpr char kEnvSchedulerManagePort[] = "MS_SCHED_MANAGE_PORT";
@@ -97,6 +100,7 @@ constexpr char kErrorCode[] = "1";
 
 constexpr int64_t kSubmitTaskIntervalInMs = 1;
 constexpr int64_t kMaxTaskNum = 10240;
+constexpr size_t kMaxDispatchBatchSize = 64;
 constexpr int64_t kSubmitTimeOutInMs = 30000;
 constexpr int64_t kRetryCount = 60;
 constexpr int64_t kRetryIntervalInMs = 10;
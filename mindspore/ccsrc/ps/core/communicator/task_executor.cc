@@ -15,6 +15,8 @@
  */
 
 #include "ps/core/communicator/task_executor.h"
+#include <algorithm>
+#include <utility>
 
 namespace mindspore {
 namespace ps {
@@ -22,54 +24,20 @@ namespace core {
 TaskExecutor::TaskExecutor(size_t thread_num, size_t max_task_num, size_t submit_timeout)
     : running_(true),
       thread_num_(thread_num),
-      idle_thread_num_(0),
       submit_timeout_(submit_timeout),
       max_task_num_(max_task_num),
       task_num_(0) {
   for (size_t i = 0; i < thread_num; i++) {
     working_threads_.emplace_back([this]() {
-      std::function<void()> task;
-      while (true) {
-        std::unique_lock<std::mutex> lock(mtx_);
-        // Idle thread number increases when the mtx_ is locked.
-        idle_thread_num_++;
-
-        if (!running_) {
-          // To avoid thread from blocking after destructor.
-          return;
-        }
-
-        cv_.wait(lock);
-
-        if (!running_ || task_queue_.empty()) {
-          return;
+      std::vector<std::function<void()>> tasks;
+      while (TakeTasks(&tasks)) {
+        for (auto &task : tasks) {
+          task();
         }
-
-        task = task_queue_.front();
-        task_queue_.pop();
-        if (lock.owns_lock()) {
-          lock.unlock();
-        }
-
-        task();
+        tasks.clear();
       }
     });
   }
-  notify_thread_ = std::thread([this]() {
-    // If there is no idle thread, wait until the working thread is available.
-    while (running_) {
-      {
-        std::unique_lock<std::mutex> lock(mtx_);
-        if (idle_thread_num_ > 0 && task_num_ > 0) {
-          idle_thread_num_--;
-          task_num_--;
-          lock.unlock();
-          cv_.notify_one();
-        }
-      }
-      std::this_thread::sleep_for(std::chrono::milliseconds(kSubmitTaskIntervalInMs));
-    }
-  });
 }
 
 TaskExecutor::~TaskExecutor() {
@@ -81,7 +49,26 @@ TaskExecutor::~TaskExecutor() {
   for (auto &t : working_threads_) {
     t.join();
   }
-  notify_thread_.join();
+}
+
+bool TaskExecutor::TakeTasks(std::vector<std::function<void()>> *tasks) {
+  MS_EXCEPTION_IF_NULL(tasks);
+  std::unique_lock<std::mutex> lock(mtx_);
+  cv_.wait(lock, [this] { return !running_ || !task_queue_.empty(); });
+  if (!running_) {
+    // To avoid thread from blocking after destructor.
+    return false;
+  }
+  size_t batch_size = std::min(std::max<size_t>(task_queue_.size() / thread_num_, 1), kMaxDispatchBatchSize);
+  for (size_t i = 0; i < batch_size; ++i) {
+    tasks->emplace_back(std::move(task_queue_.front()));
+    task_queue_.pop();
+  }
+  task_num_ -= batch_size;
+  if (!task_queue_.empty()) {
+    cv_.notify_one();
+  }
+  return true;
 }
 }  // namespace core
 }  // namespace ps
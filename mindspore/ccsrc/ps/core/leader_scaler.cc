@@ -19,8 +19,7 @@
 namespace mindspore {
 namespace ps {
 namespace core {
-void LeaderScaler::ScaleOutAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager) {
-  MS_EXCEPTION_IF_NULL(client);
+void LeaderScaler::ScaleOutAsync(const std::vector<std::shared_ptr<TcpClient>> &clients, const NodeManager &manager) {
   MS_EXCEPTION_IF_NULL(node_);
   auto message_meta = std::make_shared<MessageMeta>();
   MS_EXCEPTION_IF_NULL(message_meta);
@@ -30,17 +29,17 @@ void LeaderScaler::ScaleOutAsync(const std::shared_ptr<TcpClient> &client, const
   scale_out_message.set_worker_num(manager.worker_num());
   scale_out_message.set_server_num(manager.server_num());
 
-  if (!node_->SendMessageSync(client, message_meta, Protos::PROTOBUF, scale_out_message.SerializeAsString().data(),
-                              scale_out_message.ByteSizeLong())) {
+  std::string data = scale_out_message.SerializeAsString();
+  if (!node_->BroadcastMessageSync(clients, message_meta, Protos::PROTOBUF, data.data(), data.size())) {
     MS_LOG(WARNING) << "Send scale out timeout!";
   }
 
   MS_LOG(INFO) << "The scheduler is sending scale out to workers and servers!";
 }
 
-void LeaderScaler::ScaleInAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager,
-                                bool is_node_scale_in) {
-  MS_EXCEPTION_IF_NULL(client);
+void LeaderScaler::ScaleInAsync(const std::vector<std::shared_ptr<TcpClient>> &clients,
+                                const std::vector<std::shared_ptr<TcpClient>> &scale_in_clients,
+                                const NodeManager &manager) {
   MS_EXCEPTION_IF_NULL(node_);
   auto message_meta = std::make_shared<MessageMeta>();
   MS_EXCEPTION_IF_NULL(message_meta);
@@ -49,25 +48,30 @@ void LeaderScaler::ScaleInAsync(const std::shared_ptr<TcpClient> &client, const
   ScaleInMessage scale_in_message;
   scale_in_message.set_worker_num(manager.worker_num());
   scale_in_message.set_server_num(manager.server_num());
-  scale_in_message.set_is_node_scale_in(is_node_scale_in);
+  scale_in_message.set_is_node_scale_in(false);
+  std::string data = scale_in_message.SerializeAsString();
+  if (!node_->BroadcastMessageSync(clients, message_meta, Protos::PROTOBUF, data.data(), data.size())) {
+    MS_LOG(WARNING) << "Send scale in timeout!";
+  }
 
-  if (!node_->SendMessageSync(client, message_meta, Protos::PROTOBUF, scale_in_message.SerializeAsString().data(),
-                              scale_in_message.ByteSizeLong())) {
+  scale_in_message.set_is_node_scale_in(true);
+  data = scale_in_message.SerializeAsString();
+  if (!node_->BroadcastMessageSync(scale_in_clients, message_meta, Protos::PROTOBUF, data.data(), data.size())) {
     MS_LOG(WARNING) << "Send scale in timeout!";
   }
 
   MS_LOG(INFO) << "The scheduler is sending scale in to workers and servers!";
 }
 
-void LeaderScaler::ScaleOutRollbackAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager) {
-  MS_EXCEPTION_IF_NULL(client);
+void LeaderScaler::ScaleOutRollbackAsync(const std::vector<std::shared_ptr<TcpClient>> &clients,
+                                         const NodeManager &) {
   MS_EXCEPTION_IF_NULL(node_);
   auto message_meta = std::make_shared<MessageMeta>();
   MS_EXCEPTION_IF_NULL(message_meta);
   message_meta->set_cmd(NodeCommand::SCALE_OUT_ROLLBACK);
 
   std::string data = "";
-  if (!node_->SendMessageSync(client, message_meta, Protos::PROTOBUF, data.data(), data.size())) {
+  if (!node_->BroadcastMessageSync(clients, message_meta, Protos::PROTOBUF, data.data(), data.size())) {
     MS_LOG(WARNING) << "Send scale out rollback timeout!";
   }
 
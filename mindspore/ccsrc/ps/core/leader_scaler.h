@@ -39,12 +39,16 @@ class LeaderScaler {
   explicit LeaderScaler(Node *const node) : node_(node) {}
   ~LeaderScaler() = default;
 
+  // The scale messages are broadcast to all the nodes at once, so that a slow node only delays itself instead of all
+  // the nodes behind it, and the cluster pauses for one round trip of the slowest node.
   // When the scheduler receives the scale out message, it will send this message to the workers and servers.
-  void ScaleOutAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager);
-  // When the scheduler receives the scale in message, it will send this message to the workers and servers.
-  void ScaleInAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager, bool is_node_scale_in);
+  void ScaleOutAsync(const std::vector<std::shared_ptr<TcpClient>> &clients, const NodeManager &manager);
+  // When the scheduler receives the scale in message, it will send this message to the workers and servers, the
+  // clients of the nodes to be scaled in are in scale_in_clients.
+  void ScaleInAsync(const std::vector<std::shared_ptr<TcpClient>> &clients,
+                    const std::vector<std::shared_ptr<TcpClient>> &scale_in_clients, const NodeManager &manager);
 
-  void ScaleOutRollbackAsync(const std::shared_ptr<TcpClient> &client, const NodeManager &manager);
+  void ScaleOutRollbackAsync(const std::vector<std::shared_ptr<TcpClient>> &clients, const NodeManager &manager);
 
  private:
   // The node_ will only be instantiated with scheduler node.
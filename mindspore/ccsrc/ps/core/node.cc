@@ -80,6 +80,28 @@ bool Node::SendMessageSync(const std::shared_ptr<TcpClient> &client, const std::
   return Wait(request_id, timeout);
 }
 
+bool Node::BroadcastMessageSync(const std::vector<std::shared_ptr<TcpClient>> &clients,
+                                const std::shared_ptr<MessageMeta> &meta, const Protos &protos, const void *data,
+                                size_t size, const uint32_t &timeout) {
+  MS_EXCEPTION_IF_NULL(meta);
+  MS_EXCEPTION_IF_NULL(data);
+  if (clients.empty()) {
+    return true;
+  }
+  uint64_t request_id = AddMessageTrack(SizeToUint(clients.size()));
+  meta->set_request_id(request_id);
+  for (const auto &client : clients) {
+    MS_EXCEPTION_IF_NULL(client);
+    if (!client->SendMessage(meta, protos, data, size)) {
+      MS_LOG(WARNING) << "Client send message failed.";
+    }
+  }
+  MS_LOG(DEBUG) << "The node role is:" << CommUtil::NodeRoleToString(node_info_.node_role_)
+                << ", the node id is:" << node_info_.node_id_ << " broadcast the request id is:" << request_id
+                << " to " << clients.size() << " nodes.";
+  return Wait(request_id, timeout);
+}
+
 bool Node::EnableRecovery() const {
   MS_EXCEPTION_IF_NULL(config_);
   return config_->Exists(kKeyRecovery);
@@ -72,6 +72,12 @@ class BACKEND_EXPORT Node {
   bool SendMessageSync(const std::shared_ptr<TcpClient> &client, const std::shared_ptr<MessageMeta> &, const Protos &,
                        const void *, size_t size, const uint32_t &timeout = kCommTimeoutInSeconds);
 
+  // Send the same message to all the clients at once and wait for all the responses, so the total latency is that of
+  // the slowest node rather than the sum of the nodes.
+  bool BroadcastMessageSync(const std::vector<std::shared_ptr<TcpClient>> &clients,
+                            const std::shared_ptr<MessageMeta> &meta, const Protos &protos, const void *data,
+                            size_t size, const uint32_t &timeout = kCommTimeoutInSeconds);
+
   // Whether to enable disaster recovery.
   bool EnableRecovery() const;
 
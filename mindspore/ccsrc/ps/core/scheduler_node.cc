@@ -971,12 +971,14 @@ void SchedulerNode::ProcessScaleOutRollback(const std::shared_ptr<HttpMessageHan
   node_manager_.UpdateClusterState(ClusterState::CLUSTER_SCALE_OUT_ROLLBACK);
   auto node_infos = node_manager_.nodes_info();
   node_manager_.ResetMetadata();
+  std::vector<std::shared_ptr<TcpClient>> clients;
   for (const auto &kvs : node_infos) {
     auto client = GetOrCreateClient(kvs.second);
     MS_EXCEPTION_IF_NULL(client);
-    MS_EXCEPTION_IF_NULL(leader_scaler_);
-    leader_scaler_->ScaleOutRollbackAsync(client, node_manager_);
+    (void)clients.emplace_back(client);
   }
+  MS_EXCEPTION_IF_NULL(leader_scaler_);
+  leader_scaler_->ScaleOutRollbackAsync(clients, node_manager_);
 
   MS_LOG(INFO) << "Scheduler send scale out rollback successful.";
   nlohmann::json js;
@@ -1080,12 +1082,14 @@ void SchedulerNode::ProcessScaleOut(const std::shared_ptr<HttpMessageHandler> &r
   node_manager_.UpdateClusterState(ClusterState::CLUSTER_SCALE_OUT);
   auto node_infos = node_manager_.nodes_info();
   node_manager_.ResetMetadata();
+  std::vector<std::shared_ptr<TcpClient>> clients;
   for (const auto &kvs : node_infos) {
     auto client = GetOrCreateClient(kvs.second);
     MS_EXCEPTION_IF_NULL(client);
-    MS_EXCEPTION_IF_NULL(leader_scaler_);
-    leader_scaler_->ScaleOutAsync(client, node_manager_);
+    (void)clients.emplace_back(client);
   }
+  MS_EXCEPTION_IF_NULL(leader_scaler_);
+  leader_scaler_->ScaleOutAsync(clients, node_manager_);
   MS_LOG(INFO) << "Scheduler send scale out successful.";
 
   nlohmann::json js;
@@ -1160,15 +1164,19 @@ void SchedulerNode::ProcessScaleIn(const std::shared_ptr<HttpMessageHandler> &re
   node_manager_.set_worker_num(total_worker_num);
   node_manager_.set_server_num(total_server_num);
   node_manager_.set_total_node_num(total_worker_num + total_server_num);
+  std::vector<std::shared_ptr<TcpClient>> clients;
+  std::vector<std::shared_ptr<TcpClient>> scale_in_clients;
   for (const auto &kvs : node_infos) {
     auto client = GetOrCreateClient(kvs.second);
-    bool is_node_scale_in = false;
+    MS_EXCEPTION_IF_NULL(client);
     if (scale_in_nodes.count(kvs.first)) {
-      is_node_scale_in = true;
+      (void)scale_in_clients.emplace_back(client);
+    } else {
+      (void)clients.emplace_back(client);
     }
-    MS_EXCEPTION_IF_NULL(leader_scaler_);
-    leader_scaler_->ScaleInAsync(client, node_manager_, is_node_scale_in);
   }
+  MS_EXCEPTION_IF_NULL(leader_scaler_);
+  leader_scaler_->ScaleInAsync(clients, scale_in_clients, node_manager_);
 
   nlohmann::json js;
   js["message"] = "Cluster begin to scale in.";
@@ -65,6 +65,7 @@ void ParameterServer::Run(const FuncGraphPtr &func_graph) {
 bool ParameterServer::Init(const FuncGraphPtr &func_graph) {
   pserver_num_ = std::strtol(mindspore::common::GetEnv(kEnvPServerNum).c_str(), nullptr, kBase);
   worker_num_ = std::strtol(mindspore::common::GetEnv(kEnvWorkerNum).c_str(), nullptr, kBase);
+  staleness_ = std::strtoull(mindspore::common::GetEnv(kEnvPsStaleness).c_str(), nullptr, kBase);
   func_graph_ = func_graph;
   handler_.reset(new ServerHandler(this));
   handler_->Init();
@@ -171,6 +172,7 @@ void ParameterServer::InitWeight(const Key &key, const WeightPtr &weight) {
     MS_LOG(INFO) << "Initializing weight for key " << key << ", server rank " << server_node_->rank_id();
     weights_[key] = weight;
     tokens_[key] = 0;
+    weight_versions_[key] = 0;
     is_embedding_[key] = false;
   }
 }
@@ -312,6 +314,8 @@ void ParameterServer::PersistInitParameters(const Key &key, const WeightPtr &par
   MS_EXCEPTION_IF_NULL(persistent_weight);
   std::map<std::string, std::string> config_map;
   config_map[distributed::storage::kFileStoragePath] = real_storage_file_path;
+  // Only the updated rows of embedding tables are persisted to the delta files after the first persistence.
+  config_map[distributed::storage::kIncrementalPersist] = "true";
   persistent_weight->Initialize(config_map);
 
   (void)weights_dirty_info_.emplace(key, distributed::storage::DirtyInfo());
@@ -383,6 +387,7 @@ void ParameterServer::InitEmbeddingTable(const Key &key,
     weights_[key] = embedding;
     MS_LOG(DEBUG) << "The key:" << key << " the embedding:" << *(embedding->MutableData());
     tokens_[key] = 0;
+    weight_versions_[key] = 0;
     is_embedding_[key] = true;
 
     grads_accum_counter_[key] = 0;
@@ -443,6 +448,7 @@ void ParameterServer::UpdateWeights() {
       if (!is_embedding_[key]) {
         tokens_[key] = worker_num_;
       }
+      weight_versions_[key]++;
     }
     ResetGradAccumCount();
   }
@@ -489,10 +495,17 @@ WeightPtr ParameterServer::weight(const Key &key) {
   }
   WeightPtr weight_ptr = weights_[key];
   MS_EXCEPTION_IF_NULL(weight_ptr);
-  tokens_[key] -= 1;
+  if (staleness_ == 0) {
+    tokens_[key] -= 1;
+  }
   return weight_ptr;
 }
 
+uint64_t ParameterServer::weight_version(const Key &key) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return weight_versions_[key];
+}
+
 void ParameterServer::DoEmbeddingLookup(Key key, const LookupIds &lookup_ids, KVMessage *res) {
   if (EnableRecovery()) {
     while (!finish_recovery_) {
@@ -610,6 +623,10 @@ inline bool ParameterServer::ReadyForPush(const Key &key) {
     MS_LOG(EXCEPTION) << "The weights in server is empty. Many reasons could cause this: 1.The Worker didn't send "
                          "kInitWeightsCmd command. 2.The Server failed to initialize weights.";
   }
+  if (staleness_ > 0) {
+    // The workers check the staleness by the weight versions, so only the gradients of the current round are limited.
+    return grad_accum_count_ < weights_.size() && grads_accum_counter_[key] < worker_num_;
+  }
   return grad_accum_count_ < weights_.size() && tokens_[key] == 0;
 }
 
@@ -619,7 +636,7 @@ inline bool ParameterServer::ReadyForPull(const Key &key) {
     MS_LOG(EXCEPTION) << "Invalid weight key " << key;
   }
   MS_LOG(INFO) << "ReadyForPull: " << (tokens_[key] > 0);
-  return tokens_[key] > 0;
+  return staleness_ > 0 || tokens_[key] > 0;
 }
 
 inline void ParameterServer::ResetGradAccumCount() {
@@ -943,10 +960,13 @@ void ParameterServer::ServerHandler::HandlePullReq(const void *data, size_t size
   KVMessage res_data;
   *res_data.mutable_keys() = input.keys();
   Key key = input.keys()[0];
+  // The version is read before the weight, so the weight is at least as new as the version.
+  auto version = ps_->weight_version(key);
   auto weight = ps_->weight(key);
   auto weight_data = weight->MutableData();
   MS_EXCEPTION_IF_NULL(weight_data);
   *res_data.mutable_values() = {weight_data->begin(), weight_data->end()};
+  res_data.add_len(SizeToInt(version));
   res->resize(res_data.ByteSizeLong());
   size_t dest_size = res_data.ByteSizeLong();
   size_t src_size = res_data.ByteSizeLong();
@@ -1069,6 +1089,7 @@ void ParameterServer::ServerHandler::HandleCheckReadyForPush(const void *data, s
   KVMessage res_data;
   res_data.add_keys(key);
   res_data.add_values(ready);
+  res_data.add_len(SizeToInt(ps_->weight_version(key)));
   res->resize(res_data.ByteSizeLong());
   size_t dest_size = res_data.ByteSizeLong();
   size_t src_size = res_data.ByteSizeLong();
@@ -1088,6 +1109,7 @@ void ParameterServer::ServerHandler::HandleCheckReadyForPull(const void *data, s
   KVMessage res_data;
   res_data.add_keys(key);
   res_data.add_values(ready);
+  res_data.add_len(SizeToInt(ps_->weight_version(key)));
   res->resize(res_data.ByteSizeLong());
   size_t dest_size = res_data.ByteSizeLong();
   size_t src_size = res_data.ByteSizeLong();
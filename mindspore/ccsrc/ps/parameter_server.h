@@ -161,6 +161,7 @@ class BACKEND_EXPORT ParameterServer {
   inline bool ReadyForPush(const Key &key);
   inline bool ReadyForPull(const Key &key);
   inline void ResetGradAccumCount();
+  uint64_t weight_version(const Key &key);
   const CNodePtr GetCNode(const std::string &name) const;
   inline std::mutex &mutex();
   void GetEmbeddingTableParamPtr();
@@ -227,6 +228,10 @@ class BACKEND_EXPORT ParameterServer {
   mindspore::HashMap<Key, size_t> grads_accum_counter_;
   mindspore::HashMap<Key, std::shared_ptr<PServerKernel>> embedding_lookup_ops_;
   mindspore::HashMap<Key, uint64_t> tokens_;
+  // The staleness bound of the stale synchronous mode, in which the workers pull without the tokens and the weights
+  // are tagged by the versions for the workers to check the staleness.
+  uint64_t staleness_{0};
+  mindspore::HashMap<Key, uint64_t> weight_versions_;
 
   std::mutex mutex_;
   std::condition_variable apply_grads_cv_;
@@ -403,6 +403,11 @@ bool PsCacheManager::ProcessData() {
     MS_LOG(ERROR) << "The data_size can not be zero.";
     return false;
   }
+  auto data_type = PsDataPrefetch::GetInstance().data_type(channel_name_);
+  if (data_type != kInt32DataType) {
+    MS_LOG(ERROR) << "Ps cache manager only supports input ids with data type[int32], but got[" << data_type << "]";
+    return false;
+  }
   auto batch_ids = reinterpret_cast<int *>(data);
   auto batch_ids_len = data_size / sizeof(int);
   std::unique_ptr<int[]> hash_index = std::make_unique<int[]>(batch_ids_len);
@@ -42,11 +42,12 @@ void PsDataChannel::TryWakeChannel(bool force_wake) {
   current_graph_step_++;
 }
 
-void PsDataChannel::set_data(const void *data, const size_t data_size) {
+void PsDataChannel::set_data(const void *data, const size_t data_size, const std::string &data_type) {
   MS_EXCEPTION_IF_NULL(data);
   TryLockChannel();
   data_ = const_cast<void *>(data);
   data_size_ = data_size;
+  data_type_ = data_type;
 }
 }  // namespace ps
 }  // namespace mindspore
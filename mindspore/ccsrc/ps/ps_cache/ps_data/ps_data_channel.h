@@ -33,9 +33,10 @@ class PsDataChannel {
         data_(nullptr),
         data_size_(0) {}
   virtual ~PsDataChannel() = default;
-  void set_data(const void *data, const size_t data_size);
+  void set_data(const void *data, const size_t data_size, const std::string &data_type);
   const void *data() const { return data_; }
   size_t data_size() const { return data_size_; }
+  const std::string &data_type() const { return data_type_; }
   void ResetData() { data_ = nullptr; }
   void set_step_num(size_t step_num) { step_num_ = step_num; }
   void TryWakeChannel(bool force_wake = false);
@@ -52,6 +53,7 @@ class PsDataChannel {
   std::condition_variable channel_;
   void *data_;
   size_t data_size_;
+  std::string data_type_;
 };
 }  // namespace ps
 }  // namespace mindspore
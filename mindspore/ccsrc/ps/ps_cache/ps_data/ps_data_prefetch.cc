@@ -58,10 +58,10 @@ bool PsDataPrefetch::PrefetchData(const std::string &channel_name, void *data, c
   if (cache_enable_ == false) {
     return true;
   }
-  // In ps cache mode, input ids are from dataset and data type transmitted from minddata must be 'int32'
-  const std::string supported_data_type = "int32";
-  if (data_type != supported_data_type) {
-    MS_LOG(ERROR) << "Parameter server cache mode need input id with data type[int32], but got[" << data_type << "]";
+  // In ps cache mode, input ids are from dataset and data type transmitted from minddata must be 'int32' or 'int64'
+  if (data_type != kInt32DataType && data_type != kInt64DataType) {
+    MS_LOG(ERROR) << "Parameter server cache mode need input id with data type[int32, int64], but got[" << data_type
+                  << "]";
     invalid_data_type_ = true;
     return false;
   }
@@ -71,7 +71,7 @@ bool PsDataPrefetch::PrefetchData(const std::string &channel_name, void *data, c
   }
   auto channel = ps_data_channel(channel_name);
   MS_ERROR_IF_NULL(channel);
-  channel->set_data(data, data_size);
+  channel->set_data(data, data_size, data_type);
   std::unique_lock<std::mutex> locker(data_mutex_);
   data_ready_ = true;
   data_process_.notify_one();
@@ -143,6 +143,14 @@ size_t PsDataPrefetch::data_size(const std::string &channel_name) const {
   return channel->data_size();
 }
 
+std::string PsDataPrefetch::data_type(const std::string &channel_name) const {
+  auto channel = ps_data_channel(channel_name);
+  if (channel == nullptr) {
+    return "";
+  }
+  return channel->data_type();
+}
+
 void PsDataPrefetch::NotifyFinalize() {
   static std::mutex mtx;
   std::lock_guard<std::mutex> lock(mtx);
@@ -27,6 +27,10 @@
 
 namespace mindspore {
 namespace ps {
+// The data types of input ids supported by ps cache mode.
+constexpr char kInt32DataType[] = "int32";
+constexpr char kInt64DataType[] = "int64";
+
 class EXPORT PsDataPrefetch {
  public:
   EXPORT static PsDataPrefetch &GetInstance();
@@ -40,6 +44,7 @@ class EXPORT PsDataPrefetch {
   EXPORT void NotifyFinalize();
   EXPORT bool QueryData(const std::string &channel_name, void **data_ptr) const;
   EXPORT size_t data_size(const std::string &channel_name) const;
+  EXPORT std::string data_type(const std::string &channel_name) const;
   EXPORT bool TryWakeChannel(const std::string &channel_name) const;
 
  private:
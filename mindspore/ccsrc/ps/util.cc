@@ -125,6 +125,7 @@ void Util::ReduceSparseGradient(float *gradients, int *indices, const size_t ind
   param.output_grad_ = unique_sparse_grad;
   param.max_index_ = first_dim_size;
   param.value_stride_ = outer_dim_size;
+  param.use_sort_reduce_ = true;
 
   mindspore::kernel::SparseOptimizerCpuKernelMod::BucketReduceSparseGradient(param);
 }
@@ -21,6 +21,10 @@ namespace mindspore {
 namespace ps {
 namespace {
 constexpr int kRetryDuration = 2000;
+// The row looked up from the servers for this number of times is cached as a hot row.
+constexpr size_t kHotRowAccessThreshold = 8;
+constexpr size_t kMaxHotRowNum = 65536;
+constexpr size_t kMaxTrackedRowNum = 1 << 20;
 }  // namespace
 
 Worker &Worker::GetInstance() {
@@ -108,9 +112,14 @@ void Worker::Push(const std::vector<size_t> &keys, std::vector<uintptr_t> addrs,
   }
   MS_LOG(INFO) << "The total size is:" << total_size;
 
-  while (running_ && (!IsReadyForPush(keys[0]))) {
+  // In the stale synchronous mode, the push of the clock c waits until the update of the clock c - staleness is done,
+  // so that the fast workers run at most the staleness bound of steps ahead of the weights they read.
+  uint64_t version = 0;
+  auto &clock = push_clocks_[key];
+  while (running_ && (!IsReadyForPush(keys[0], &version) || (staleness_ > 0 && version + staleness_ < clock))) {
     continue;
   }
+  ++clock;
   std::vector<int> sizes_int;
   (void)std::transform(sizes.begin(), sizes.end(), std::back_inserter(sizes_int),
                        [](const int64_t &value) { return static_cast<int>(value); });
@@ -130,6 +139,10 @@ void Worker::Push(const std::vector<size_t> &keys, std::vector<uintptr_t> addrs,
 
 void Worker::Pull(const size_t key, void *dev_addr, const size_t size) {
   MS_EXCEPTION_IF_NULL(dev_addr);
+  if (staleness_ > 0) {
+    PullWithinStaleness(key, dev_addr, size);
+    return;
+  }
   std::vector<float> variables(size / sizeof(float), 0);
   while (running_ && (!IsReadyForPull(key))) {
     continue;
@@ -145,6 +158,26 @@ void Worker::Pull(const size_t key, void *dev_addr, const size_t size) {
   }
 }
 
+void Worker::PullWithinStaleness(const size_t key, void *dev_addr, const size_t size) {
+  auto clock = push_clocks_[key];
+  uint64_t required_version = clock > staleness_ ? clock - staleness_ : 0;
+  auto &cache = weight_caches_[key];
+  if (cache.second.size() * sizeof(float) != size || cache.first < required_version) {
+    uint64_t version = 0;
+    while (running_ && (!IsReadyForPull(key, &version) || version < required_version)) {
+      continue;
+    }
+    std::vector<int> lens;
+    PullData({key}, &cache.second, &lens, kPullCmd);
+    cache.first = lens.empty() ? version : IntToSize(lens[0]);
+    MS_LOG(DEBUG) << "Pull the weight of key " << key << " with version " << cache.first << " at clock " << clock;
+  }
+  auto ret = memcpy_s(dev_addr, size, cache.second.data(), cache.second.size() * sizeof(float));
+  if (ret != 0) {
+    MS_LOG(EXCEPTION) << "memcpy_s error, errorno(" << ret << ")";
+  }
+}
+
 size_t Worker::SetParamKey(const std::string &param_name) {
   size_t key = UINT64_MAX;
   if (param_to_key_.count(param_name)) {
@@ -289,6 +322,58 @@ void Worker::InitPSParamAndOptim(const AnfNodePtr &input_node, const tensor::Ten
 bool Worker::DoPSEmbeddingLookup(const Key &key, const std::vector<int> &lookup_ids, std::vector<float> *lookup_result,
                                  int64_t cmd) {
   MS_EXCEPTION_IF_NULL(lookup_result);
+  if (staleness_ > 0 && !lookup_ids.empty()) {
+    return LookupWithHotRowCache(key, lookup_ids, lookup_result, cmd);
+  }
+  return LookupFromServers(key, lookup_ids, lookup_result, cmd);
+}
+
+bool Worker::LookupWithHotRowCache(const Key &key, const std::vector<int> &lookup_ids,
+                                   std::vector<float> *lookup_result, int64_t cmd) {
+  size_t row_len = lookup_result->size() / lookup_ids.size();
+  auto clock = push_clocks_[key];
+  auto &cache = hot_row_caches_[key];
+  std::vector<int> missed_ids;
+  std::vector<size_t> missed_indices;
+  for (size_t i = 0; i < lookup_ids.size(); ++i) {
+    auto iter = cache.rows.find(lookup_ids[i]);
+    if (iter != cache.rows.end() && iter->second.first + staleness_ >= clock) {
+      (void)std::copy(iter->second.second.begin(), iter->second.second.end(), lookup_result->begin() + i * row_len);
+      continue;
+    }
+    missed_ids.push_back(lookup_ids[i]);
+    missed_indices.push_back(i);
+  }
+  MS_LOG(DEBUG) << "Key " << key << " looks up " << lookup_ids.size() << " rows, " << missed_ids.size()
+                << " of them are not in the hot row cache.";
+  if (missed_ids.empty()) {
+    return true;
+  }
+
+  std::vector<float> missed_result(missed_ids.size() * row_len, 0);
+  if (!LookupFromServers(key, missed_ids, &missed_result, cmd)) {
+    return false;
+  }
+  if (cache.access_counts.size() > kMaxTrackedRowNum) {
+    cache.access_counts.clear();
+  }
+  for (size_t i = 0; i < missed_ids.size(); ++i) {
+    auto row_begin = missed_result.begin() + i * row_len;
+    (void)std::copy(row_begin, row_begin + row_len, lookup_result->begin() + missed_indices[i] * row_len);
+    auto id = missed_ids[i];
+    if (++cache.access_counts[id] < kHotRowAccessThreshold) {
+      continue;
+    }
+    if (cache.rows.size() < kMaxHotRowNum || cache.rows.count(id) != 0) {
+      cache.rows[id] = std::make_pair(clock, std::vector<float>(row_begin, row_begin + row_len));
+    }
+  }
+  return true;
+}
+
+bool Worker::LookupFromServers(const Key &key, const std::vector<int> &lookup_ids, std::vector<float> *lookup_result,
+                               int64_t cmd) {
+  MS_EXCEPTION_IF_NULL(lookup_result);
   EmbeddingTableLookup embedding_table_lookup;
   embedding_table_lookup.set_key(key);
   *embedding_table_lookup.mutable_keys() = {lookup_ids.begin(), lookup_ids.end()};
@@ -371,6 +456,17 @@ bool Worker::DoPSEmbeddingLookup(const Key &key, const std::vector<int> &lookup_
 
 bool Worker::UpdateEmbeddingTable(const std::vector<Key> &keys, const std::vector<int> &lookup_ids,
                                   const std::vector<float> &vals) {
+  // Write through the replicated hot rows, so that the later lookups read the updated rows.
+  if (!keys.empty() && !lookup_ids.empty() && hot_row_caches_.count(keys[0]) != 0) {
+    auto &rows = hot_row_caches_[keys[0]].rows;
+    size_t row_len = vals.size() / lookup_ids.size();
+    for (size_t i = 0; i < lookup_ids.size(); ++i) {
+      auto iter = rows.find(lookup_ids[i]);
+      if (iter != rows.end()) {
+        iter->second.second.assign(vals.begin() + i * row_len, vals.begin() + (i + 1) * row_len);
+      }
+    }
+  }
   KVMessage kvs;
   *kvs.mutable_keys() = {keys.begin(), keys.end()};
   *kvs.mutable_len() = {lookup_ids.begin(), lookup_ids.end()};
@@ -413,6 +509,8 @@ void Worker::Finalize() {
 }
 
 void Worker::Initialize() {
+  staleness_ = std::strtoull(common::GetEnv(kEnvPsStaleness).c_str(), nullptr, kBase);
+  MS_LOG(INFO) << "The staleness bound of the worker is " << staleness_;
   lookup_partitioner_ = [this](auto &&send, auto &&partition, auto &&attrs) {
     LookupIdPartitioner(send, partition, attrs);
   };
@@ -503,9 +601,13 @@ void Worker::InitPSParamData(const std::vector<size_t> &keys, void *const origin
   init_keys_[key[0]] = true;
 }
 
-bool Worker::IsReadyForPush(const Key &key) {
+bool Worker::IsReadyForPush(const Key &key, uint64_t *version) {
   std::vector<float> result(1, 0);
-  PullData({key}, &result, nullptr, kCheckReadyForPushCmd);
+  std::vector<int> lens;
+  PullData({key}, &result, &lens, kCheckReadyForPushCmd);
+  if (version != nullptr && !lens.empty()) {
+    *version = IntToSize(lens[0]);
+  }
   MS_LOG(INFO) << "key:" << key;
   if (result[0] > 0) {
     MS_LOG(INFO) << "IsReadyForPush:";
@@ -516,9 +618,13 @@ bool Worker::IsReadyForPush(const Key &key) {
   }
 }
 
-bool Worker::IsReadyForPull(const Key &key) {
+bool Worker::IsReadyForPull(const Key &key, uint64_t *version) {
   std::vector<float> result(1, 0);
-  PullData({key}, &result, nullptr, kCheckReadyForPullCmd);
+  std::vector<int> lens;
+  PullData({key}, &result, &lens, kCheckReadyForPullCmd);
+  if (version != nullptr && !lens.empty()) {
+    *version = IntToSize(lens[0]);
+  }
   if (result[0] > 0) {
     MS_LOG(INFO) << "IsReadyForPull";
     return true;
@@ -86,13 +86,23 @@ class BACKEND_EXPORT Worker {
 
   void Initialize();
   bool IsKeyInit(const size_t key);
+  // Look up the rows from the servers owning the row ranges of the embedding table.
+  bool LookupFromServers(const Key &key, const std::vector<int> &lookup_ids, std::vector<float> *lookup_result,
+                         int64_t cmd);
+  // In the stale synchronous mode, the rows frequently looked up by this worker are replicated in the hot row cache and
+  // read from it within the staleness bound, which takes the traffic of the hot rows off the server owning them.
+  bool LookupWithHotRowCache(const Key &key, const std::vector<int> &lookup_ids, std::vector<float> *lookup_result,
+                             int64_t cmd);
   void AddKeyToServerId(const Key &key);
   void AddKeyByHashMod(const Key &key);
   void InitPSOptimId(const size_t param_key);
   void InitPSOptimInputShapes(const size_t key);
   void InitPSParamData(const std::vector<size_t> &keys, void *const origin_addr, size_t size);
-  bool IsReadyForPush(const Key &key);
-  bool IsReadyForPull(const Key &key);
+  // The version of the weight on the server, which is the number of the updates, is returned by the version.
+  bool IsReadyForPush(const Key &key, uint64_t *version = nullptr);
+  bool IsReadyForPull(const Key &key, uint64_t *version = nullptr);
+  // Pull in the stale synchronous mode, the cached weight is used if it is not older than the staleness bound.
+  void PullWithinStaleness(const size_t key, void *dev_addr, const size_t size);
   void PrepareSparseGradient(const size_t begin, const size_t end, const mindspore::HashSet<int> &distinct_ids,
                              const std::vector<std::pair<int, float *>> &indice_to_grads, const int *all_indice,
                              const size_t segment_size, float *gradient, int *indices);
@@ -135,6 +145,21 @@ class BACKEND_EXPORT Worker {
   std::map<std::string, bool> param_to_init_in_server_;
   core::PSWorkerNode worker_node_;
 
+  // The staleness bound of the stale synchronous mode, 0 means the bulk synchronous mode.
+  uint64_t staleness_{0};
+  // The number of the pushes of each key, which is the clock of this worker.
+  std::map<size_t, uint64_t> push_clocks_;
+  // The version and data of the weights pulled from the servers.
+  std::map<size_t, std::pair<uint64_t, std::vector<float>>> weight_caches_;
+
+  struct HotRowCache {
+    // The number of the lookups of each row from the servers.
+    mindspore::HashMap<int, size_t> access_counts;
+    // The clock when the row is cached and the row data.
+    mindspore::HashMap<int, std::pair<uint64_t, std::vector<float>>> rows;
+  };
+  mindspore::HashMap<Key, HotRowCache> hot_row_caches_;
+
   EmbeddingPartitioner lookup_partitioner_;
   KVPartitioner sparse_partitioner_;
   KVPartitioner round_robin_partitioner_;
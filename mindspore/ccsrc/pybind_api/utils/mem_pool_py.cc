@@ -0,0 +1,116 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include "include/common/pybind_api/api_register.h"
+#include "common/mem_reuse/mem_dynamic_allocator.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace {
+using device::AllocatorType;
+using device::DynamicMemPoolBestFit;
+
+const char *AllocatorTypeName(AllocatorType type) {
+  switch (type) {
+    case AllocatorType::kWeight:
+      return "weight";
+    case AllocatorType::kConstantValue:
+      return "constant_value";
+    case AllocatorType::kKernelOutput:
+      return "kernel_output";
+    default:
+      return "other";
+  }
+}
+
+// Get the statistics snapshot of all the alive dynamic memory pools.
+py::list GetMemPoolStats() {
+  py::list stats_list;
+  for (auto mem_pool : DynamicMemPoolBestFit::GetAllMemPools()) {
+    MS_EXCEPTION_IF_NULL(mem_pool);
+    auto stats = mem_pool->GetMemPoolStats();
+    py::dict stats_dict;
+    stats_dict["name"] = mem_pool->GetMemPoolName();
+    stats_dict["total_mem_size"] = stats.total_mem_size_;
+    stats_dict["total_used_mem_size"] = stats.total_used_mem_size_;
+    stats_dict["used_mem_peak_size"] = stats.used_mem_peak_size_;
+    stats_dict["total_idle_mem_size"] = stats.total_idle_mem_size_;
+    stats_dict["total_cached_mem_size"] = stats.total_cached_mem_size_;
+    stats_dict["largest_idle_mem_buf_size"] = stats.largest_idle_mem_buf_size_;
+    stats_dict["idle_mem_buf_count"] = stats.idle_mem_buf_count_;
+    stats_dict["mem_block_count"] = stats.mem_block_count_;
+    stats_dict["fragmentation_ratio"] = stats.fragmentation_ratio_;
+    stats_dict["thread_cached_mem_size"] = stats.thread_cached_mem_size_;
+    stats_dict["thread_cache_hit_count"] = stats.thread_cache_hit_count_;
+    stats_dict["thread_cache_miss_count"] = stats.thread_cache_miss_count_;
+    py::dict used_by_type;
+    py::dict peak_by_type;
+    for (int i = 0; i < device::ALLOCATOR_TYPE_NUM; ++i) {
+      auto type_name = AllocatorTypeName(static_cast<AllocatorType>(i));
+      used_by_type[type_name] = stats.used_mem_size_by_type_[i];
+      peak_by_type[type_name] = stats.used_mem_peak_size_by_type_[i];
+    }
+    stats_dict["used_mem_size_by_type"] = used_by_type;
+    stats_dict["used_mem_peak_size_by_type"] = peak_by_type;
+    stats_list.append(stats_dict);
+  }
+  return stats_list;
+}
+
+// Enable the alloc and free event timeline of the dynamic memory pool by the name.
+void EnableMemPoolTimeline(const std::string &name, size_t capacity) {
+  for (auto mem_pool : DynamicMemPoolBestFit::GetAllMemPools()) {
+    MS_EXCEPTION_IF_NULL(mem_pool);
+    if (mem_pool->GetMemPoolName() == name) {
+      mem_pool->EnableMemEventTimeline(capacity);
+    }
+  }
+}
+
+// Get the alloc and free event timeline of the dynamic memory pool by the name.
+py::list GetMemPoolTimeline(const std::string &name) {
+  py::list event_list;
+  for (auto mem_pool : DynamicMemPoolBestFit::GetAllMemPools()) {
+    MS_EXCEPTION_IF_NULL(mem_pool);
+    if (mem_pool->GetMemPoolName() != name) {
+      continue;
+    }
+    for (const auto &event : mem_pool->GetMemEventTimeline()) {
+      py::dict event_dict;
+      event_dict["time_stamp"] = event.time_stamp_;
+      event_dict["is_alloc"] = event.is_alloc_;
+      event_dict["address"] = reinterpret_cast<uintptr_t>(event.device_addr_);
+      event_dict["size"] = event.size_;
+      event_dict["type"] = AllocatorTypeName(event.allocator_type_);
+      event_dict["total_used_mem_size"] = event.total_used_mem_size_;
+      event_list.append(event_dict);
+    }
+  }
+  return event_list;
+}
+}  // namespace
+
+// Define python wrapper to query the statistics of the dynamic memory pool.
+REGISTER_PYBIND_DEFINE(mem_pool, ([](py::module *const m) {
+                         auto m_sub = m->def_submodule("mem_pool", "submodule for dynamic memory pool");
+                         (void)m_sub.def("get_stats", &GetMemPoolStats, "Get the statistics of memory pools.");
+                         (void)m_sub.def("enable_timeline", &EnableMemPoolTimeline, py::arg("name"),
+                                         py::arg("capacity"), "Enable the alloc and free event timeline.");
+                         (void)m_sub.def("get_timeline", &GetMemPoolTimeline, py::arg("name"),
+                                         "Get the alloc and free event timeline.");
+                       }));
+}  // namespace mindspore
@@ -30,6 +30,7 @@ bool CollectiveCommunicationLib::Finalize() {
     }
   }
   groups_.clear();
+  hierarchical_groups_.clear();
   initialized_ = false;
   finalized_ = true;
   return true;
@@ -45,9 +46,16 @@ bool CollectiveCommunicationLib::DestroyCommunicationGroup(const std::string &gr
     return false;
   }
   (void)groups_.erase(group_name);
+  (void)hierarchical_groups_.erase(group_name);
   return true;
 }
 
+void CollectiveCommunicationLib::SetHierarchicalGroups(const std::string &group_name,
+                                                       const std::string &intra_group_name,
+                                                       const std::string &inter_group_name) {
+  hierarchical_groups_[group_name] = std::make_pair(intra_group_name, inter_group_name);
+}
+
 uint32_t CollectiveCommunicationLib::GetRankId(const std::string &group_name) {
   CHECK_RET(groups_.count(group_name) != 0, true, "The group " + group_name + " does not exist.");
   auto group = groups_[group_name];
@@ -22,6 +22,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <utility>
 #include "ir/dtype/type_id.h"
 #include "runtime/collective/communication_group.h"
 
@@ -126,6 +127,11 @@ class CollectiveCommunicationLib {
   // Returns global rank size. This is used to create global communication group.
   uint32_t global_rank_size() const;
 
+  // Set the sub groups of the group for the hierarchical collectives: the group within the node of this process and the
+  // group across the nodes which consists of the ranks with the same local index.
+  void SetHierarchicalGroups(const std::string &group_name, const std::string &intra_group_name,
+                             const std::string &inter_group_name);
+
  protected:
   // Whether this collective communication library is initialized.
   bool initialized_;
@@ -147,6 +153,9 @@ class CollectiveCommunicationLib {
 
   // This map stores the groups which will be accessed and used by the caller.
   std::map<std::string, std::shared_ptr<CommunicationGroup>> groups_;
+
+  // The sub groups of the hierarchical collectives, key: group name, value: the groups within and across the nodes.
+  std::map<std::string, std::pair<std::string, std::string>> hierarchical_groups_;
 };
 using CollectiveCommunicationLibPtr = CollectiveCommunicationLib *;
 }  // namespace device
@@ -15,6 +15,8 @@
  */
 
 #include "runtime/data_queue/blocking_queue.h"
+#include <algorithm>
+#include <chrono>
 #include "utils/log_adapter.h"
 
 namespace mindspore {
@@ -25,6 +27,7 @@ void BlockingQueue::RegisterRelease(const std::function<void(void *, int32_t)> &
 BlockQueueStatus_T BlockingQueue::Push(const std::vector<DataQueueItem> &data, unsigned int) {
   std::unique_lock<std::mutex> locker(mutex_);
   if (queue_->IsFull()) {
+    ++statistics_.push_full_count_;
     if (not_full_cond_.wait_for(locker, std::chrono::microseconds(kTimeout)) == std::cv_status::timeout) {
       return TIMEOUT;
     }
@@ -33,15 +36,26 @@ BlockQueueStatus_T BlockingQueue::Push(const std::vector<DataQueueItem> &data, u
   if (ret != SUCCESS) {
     return ret;
   }
+  ++statistics_.push_count_;
   not_empty_cond_.notify_one();
   return SUCCESS;
 }
 
 BlockQueueStatus_T BlockingQueue::Front(std::vector<DataQueueItem> *data) {
-  std::unique_lock<std::mutex> locker(mutex_);
-  bool timeout = not_empty_cond_.wait_for(locker, std::chrono::seconds(30), [this] { return !queue_->IsEmpty(); });
-  if (!timeout) {
-    return TIMEOUT;
+  {
+    std::unique_lock<std::mutex> locker(mutex_);
+    ++statistics_.front_count_;
+    if (queue_->IsEmpty()) {
+      ++statistics_.front_empty_count_;
+      auto start_time = std::chrono::steady_clock::now();
+      bool timeout = not_empty_cond_.wait_for(locker, std::chrono::seconds(30), [this] { return !queue_->IsEmpty(); });
+      std::chrono::duration<double, std::milli> wait_time = std::chrono::steady_clock::now() - start_time;
+      statistics_.front_wait_time_ += wait_time.count();
+      statistics_.max_front_wait_time_ = std::max(statistics_.max_front_wait_time_, wait_time.count());
+      if (!timeout) {
+        return TIMEOUT;
+      }
+    }
   }
   return queue_->Front(data);
 }
@@ -57,6 +71,11 @@ BlockQueueStatus_T BlockingQueue::Pop() {
   return SUCCESS;
 }
 
+DataQueueStatistics BlockingQueue::Statistics() {
+  std::unique_lock<std::mutex> locker(mutex_);
+  return statistics_;
+}
+
 BlockQueueStatus_T BlockingQueue::Create(const std::shared_ptr<DataQueue> &data_queue) {
   this->queue_ = data_queue;
   return SUCCESS;
@@ -28,6 +28,21 @@
 #include "runtime/data_queue/data_queue.h"
 namespace mindspore {
 namespace device {
+// The statistics of data queue for diagnosing the jitter of data handoff, the time is in units of millisecond.
+struct DataQueueStatistics {
+  size_t push_count_{0};
+  // The producer stalls because the queue is full.
+  size_t push_full_count_{0};
+  size_t front_count_{0};
+  // The consumer stalls because the queue is empty.
+  size_t front_empty_count_{0};
+  double front_wait_time_{0};
+  double max_front_wait_time_{0};
+};
+
+// The blocking queue is pushed by one producer thread and fetched by one consumer thread. The consumer only accesses
+// the head node of the data queue which is not modified by the producer, so the data queue Front, which may wait for
+// the data copy to device, is called outside the lock and does not block the producer.
 class BlockingQueue {
  public:
   BlockingQueue() : queue_(nullptr) {}
@@ -42,12 +57,14 @@ class BlockingQueue {
   bool Destroy();
   size_t Size() { return queue_->Size(); }
   size_t Capacity() { return queue_->Capacity(); }
+  DataQueueStatistics Statistics();
 
  private:
   std::mutex mutex_;
   std::condition_variable not_full_cond_;
   std::condition_variable not_empty_cond_;
   std::shared_ptr<DataQueue> queue_;
+  DataQueueStatistics statistics_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -185,6 +185,12 @@ bool DataQueueMgr::Destroy() {
   for (auto iter = name_queue_map_.begin(); iter != name_queue_map_.end(); ++iter) {
     std::shared_ptr<BlockingQueue> queue = iter->second;
     if (queue != nullptr) {
+      auto statistics = queue->Statistics();
+      MS_LOG(INFO) << "The statistics of data queue " << iter->first << ": push count " << statistics.push_count_
+                   << ", producer stall count " << statistics.push_full_count_ << ", front count "
+                   << statistics.front_count_ << ", consumer stall count " << statistics.front_empty_count_
+                   << ", consumer wait time " << statistics.front_wait_time_ << " ms, max consumer wait time "
+                   << statistics.max_front_wait_time_ << " ms.";
       if (!queue->Destroy()) {
         return false;
       }
@@ -238,6 +244,15 @@ size_t DataQueueMgr::Capacity(const std::string &channel_name) {
   return name_queue_map_.at(channel_name)->Capacity();
 }
 
+DataQueueStatistics DataQueueMgr::Statistics(const std::string &channel_name) {
+  auto iter = name_queue_map_.find(channel_name);
+  if (iter == name_queue_map_.end()) {
+    MS_LOG(ERROR) << "Queue not exist " << channel_name;
+    return DataQueueStatistics();
+  }
+  return iter->second->Statistics();
+}
+
 bool PopDataFromDataQueue(const AnfNodePtr &data_kernel) {
   auto queue_name = common::AnfAlgo::GetNodeAttr<std::string>(data_kernel, "shared_name");
   device::DataQueueMgr &buf_mgr = device::DataQueueMgr::GetInstance();
@@ -292,6 +307,8 @@ struct DataQueueHandlerRegister {
                                         unsigned int timeout) -> device::BlockQueueStatus_T {
       return DataQueueMgr::GetInstance().Push(channel, items, timeout);
     });
+    DataQueueHandler::SetSizeHandler(
+      [](const std::string &channel) -> size_t { return DataQueueMgr::GetInstance().Size(channel); });
   }
 } callback_register;
 }  // namespace
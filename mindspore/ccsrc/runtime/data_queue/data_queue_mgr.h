@@ -104,6 +104,8 @@ class DataQueueMgr {
 
   EXPORT size_t Capacity(const std::string &channel_name);
 
+  EXPORT DataQueueStatistics Statistics(const std::string &channel_name);
+
  private:
   int cur_dev_id_;
   bool init_;
@@ -28,6 +28,11 @@ void *MemHandler::MallocHost(size_t mem_size) {
     mem_que.pop();
     return ret;
   }
+  auto host_ptr = memory_manager_->MallocHostMem(mem_size);
+  if (host_ptr != nullptr) {
+    device_host_mem_map_[host_ptr] = mem_size;
+    return host_ptr;
+  }
   auto block = std::make_shared<std::vector<uint8_t>>();
   try {
     block->resize(mem_size, 0);
@@ -39,8 +44,19 @@ void *MemHandler::MallocHost(size_t mem_size) {
   }
 }
 
+MemHandler::~MemHandler() {
+  for (auto &host_mem : device_host_mem_map_) {
+    memory_manager_->FreeHostMem(host_mem.first);
+  }
+}
+
 void MemHandler::FreeHost(void *ptr) {
   MS_EXCEPTION_IF_NULL(ptr);
+  auto host_mem_iter = device_host_mem_map_.find(ptr);
+  if (host_mem_iter != device_host_mem_map_.end()) {
+    cached_host_mem_[host_mem_iter->second].emplace(ptr);
+    return;
+  }
   auto iter = host_mem_block_map_.find(ptr);
   if (iter == host_mem_block_map_.end()) {
     MS_LOG(EXCEPTION) << "Free ptr not be created from manager!";
@@ -49,6 +65,19 @@ void MemHandler::FreeHost(void *ptr) {
   cached_host_mem_[mem_size].emplace(iter->first);
 }
 
+void MemHandler::ReleaseHost(void *ptr) {
+  MS_EXCEPTION_IF_NULL(ptr);
+  auto host_mem_iter = device_host_mem_map_.find(ptr);
+  if (host_mem_iter != device_host_mem_map_.end()) {
+    memory_manager_->FreeHostMem(ptr);
+    (void)device_host_mem_map_.erase(host_mem_iter);
+    return;
+  }
+  if (host_mem_block_map_.erase(ptr) == 0) {
+    MS_LOG(EXCEPTION) << "Release ptr not be created from manager!";
+  }
+}
+
 void AutoMemoryOffload::SetInitHostPtr(const void *key, void *host_ptr, size_t mem_size) {
   init_from_host_keys_.insert(key);
   init_host_ptr_[key] = host_ptr;
@@ -75,6 +104,7 @@ void *AutoMemoryOffload::Get(const void *key, void *stream, const HashSet<const
   }
   void *host_ptr = nullptr;
   bool from_init = false;
+  LoadFromDisk(key);
   GetHostPtr(key, &host_ptr, &from_init);
   if (host_ptr == nullptr) {
     return nullptr;
@@ -86,8 +116,7 @@ void *AutoMemoryOffload::Get(const void *key, void *stream, const HashSet<const
   }
   mem_handler_->SwapIn(host_ptr, device_ptr, mem_size, stream);
   if (!from_init) {
-    (void)swap_host_ptr_.erase(key);
-    mem_handler_->FreeHost(host_ptr);
+    FreeSwapHostPtr(key);
   }
   mem_result_[key] = device_ptr;
   return device_ptr;
@@ -208,6 +237,7 @@ void *AutoMemoryOffload::SwapOut(const void *key, void *stream) {
   bool from_init = false;
   const auto mem_size = GetMemSize(key);
   if (iter == mem_result_.end()) {
+    LoadFromDisk(key);
     GetHostPtr(key, &host_ptr, &from_init);
     if (host_ptr == nullptr) {
       MS_LOG(EXCEPTION) << "Can not find device ptr for key " << key;
@@ -215,6 +245,11 @@ void *AutoMemoryOffload::SwapOut(const void *key, void *stream) {
     return host_ptr;
   }
   const auto device_ptr = iter->second;
+  // The device memory is newer than the spilled host memory.
+  CancelSpill(key);
+  if (disk_offload_ != nullptr) {
+    disk_offload_->RemoveSwapFile(key);
+  }
   GetOrMallocHostPtr(key, mem_size, &host_ptr, &from_init);
   MS_EXCEPTION_IF_NULL(host_ptr);
   auto updated_iter = from_init ? updated_device_mem_.find(key) : updated_device_mem_.end();
@@ -224,6 +259,9 @@ void *AutoMemoryOffload::SwapOut(const void *key, void *stream) {
       (void)updated_device_mem_.erase(updated_iter);
     }
   }
+  if (!from_init) {
+    SpillSwapHostMem(key);
+  }
   return host_ptr;
 }
 
@@ -235,16 +273,135 @@ void *AutoMemoryOffload::SwapIn(const void *key, void *stream) {
   }
   bool from_init = true;
   void *host_ptr = nullptr;
+  LoadFromDisk(key);
   GetHostPtr(key, &host_ptr, &from_init);
   MS_EXCEPTION_IF_NULL(host_ptr);
   mem_handler_->SwapIn(host_ptr, iter->second, mem_size, stream);
   if (!from_init) {
-    mem_handler_->FreeHost(host_ptr);
-    (void)swap_host_ptr_.erase(key);
+    FreeSwapHostPtr(key);
   }
   return iter->second;
 }
 
+void AutoMemoryOffload::PrefetchFromDisk(const void *key) {
+  if (disk_offload_ == nullptr || swap_host_ptr_.count(key) != 0 || !disk_offload_->HasSwapFile(key)) {
+    return;
+  }
+  const auto mem_size = GetMemSize(key);
+  auto host_ptr = mem_handler_->MallocHost(mem_size);
+  MS_EXCEPTION_IF_NULL(host_ptr);
+  swap_host_ptr_[key] = host_ptr;
+  swap_host_mem_size_ += mem_size;
+  disk_offload_->AsyncRead(key, host_ptr, mem_size);
+}
+
+void AutoMemoryOffload::FreeSwapHostPtr(const void *key) {
+  const auto &iter = swap_host_ptr_.find(key);
+  if (iter == swap_host_ptr_.end()) {
+    return;
+  }
+  if (disk_offload_ == nullptr) {
+    mem_handler_->FreeHost(iter->second);
+    (void)swap_host_ptr_.erase(iter);
+    return;
+  }
+  CancelSpill(key);
+  disk_offload_->RemoveSwapFile(key);
+  auto candidate_iter = spill_candidate_iters_.find(key);
+  if (candidate_iter != spill_candidate_iters_.end()) {
+    (void)spill_candidates_.erase(candidate_iter->second);
+    (void)spill_candidate_iters_.erase(candidate_iter);
+  }
+  swap_host_mem_size_ -= GetMemSize(key);
+  mem_handler_->FreeHost(iter->second);
+  (void)swap_host_ptr_.erase(iter);
+}
+
+void AutoMemoryOffload::SpillSwapHostMem(const void *swap_out_key) {
+  if (disk_offload_ == nullptr) {
+    return;
+  }
+  ReapSpilledHostMem();
+  // The swap out of memory manager has finished copying when it returns, so the host memory can be written. The key
+  // swapped out latest is the hottest one, which is spilled at last.
+  auto candidate_iter = spill_candidate_iters_.find(swap_out_key);
+  if (candidate_iter != spill_candidate_iters_.end()) {
+    (void)spill_candidates_.erase(candidate_iter->second);
+  }
+  spill_candidate_iters_[swap_out_key] = spill_candidates_.insert(spill_candidates_.end(), swap_out_key);
+
+  while (swap_host_mem_size_ - spilling_mem_size_ > disk_offload_->host_mem_limit() && !spill_candidates_.empty()) {
+    const auto key = spill_candidates_.front();
+    spill_candidates_.pop_front();
+    (void)spill_candidate_iters_.erase(key);
+    const auto &host_iter = swap_host_ptr_.find(key);
+    if (host_iter == swap_host_ptr_.end() || disk_offload_->IsPending(key)) {
+      continue;
+    }
+    const auto mem_size = GetMemSize(key);
+    MS_LOG(DEBUG) << "Spill the swap host memory of key " << key << " to disk, size: " << mem_size;
+    disk_offload_->AsyncWrite(key, host_iter->second, mem_size);
+    (void)spilling_keys_.insert(key);
+    spilling_mem_size_ += mem_size;
+  }
+}
+
+void AutoMemoryOffload::ReapSpilledHostMem() {
+  for (auto iter = spilling_keys_.begin(); iter != spilling_keys_.end();) {
+    const auto key = *iter;
+    if (!disk_offload_->IsFinished(key)) {
+      ++iter;
+      continue;
+    }
+    iter = spilling_keys_.erase(iter);
+    const auto mem_size = GetMemSize(key);
+    spilling_mem_size_ -= mem_size;
+    if (!disk_offload_->Wait(key)) {
+      MS_LOG(WARNING) << "Spill the swap host memory of key " << key << " failed, keep it in host memory.";
+      disk_offload_->RemoveSwapFile(key);
+      continue;
+    }
+    // Release the host memory really, otherwise the cached host memory isn't reduced by the spill.
+    const auto &host_iter = swap_host_ptr_.find(key);
+    if (host_iter != swap_host_ptr_.end()) {
+      mem_handler_->ReleaseHost(host_iter->second);
+      (void)swap_host_ptr_.erase(host_iter);
+      swap_host_mem_size_ -= mem_size;
+    }
+  }
+}
+
+void AutoMemoryOffload::CancelSpill(const void *key) {
+  if (disk_offload_ == nullptr || spilling_keys_.erase(key) == 0) {
+    return;
+  }
+  // The host memory can be reused only after the writing finished.
+  (void)disk_offload_->Wait(key);
+  spilling_mem_size_ -= GetMemSize(key);
+  disk_offload_->RemoveSwapFile(key);
+}
+
+void AutoMemoryOffload::LoadFromDisk(const void *key) {
+  if (disk_offload_ == nullptr) {
+    return;
+  }
+  if (spilling_keys_.count(key) != 0) {
+    CancelSpill(key);
+    return;
+  }
+  if (!disk_offload_->HasSwapFile(key)) {
+    return;
+  }
+  // Read the swap file if it hasn't been prefetched.
+  if (swap_host_ptr_.count(key) == 0) {
+    PrefetchFromDisk(key);
+  }
+  if (!disk_offload_->Wait(key)) {
+    MS_LOG(EXCEPTION) << "Read the swap file of key " << key << " failed.";
+  }
+  disk_offload_->RemoveSwapFile(key);
+}
+
 size_t AutoMemoryOffload::GetMemSize(const void *key) {
   const auto &iter = mem_size_.find(key);
   if (iter == mem_size_.end()) {
@@ -262,6 +419,7 @@ void AutoMemoryOffload::GetOrMallocHostPtr(const void *key, size_t mem_size, voi
   *host_ptr = mem_handler_->MallocHost(mem_size);
   *from_init = false;
   swap_host_ptr_[key] = *host_ptr;
+  swap_host_mem_size_ += mem_size;
 }
 
 void AutoMemoryOffload::GetHostPtr(const void *key, void **host_ptr, bool *from_init) {
@@ -284,6 +442,14 @@ void AutoMemoryOffload::Clear() {
   if (mem_handler_ == nullptr) {
     return;
   }
+  if (disk_offload_ != nullptr) {
+    disk_offload_->Clear();
+    spill_candidates_.clear();
+    spill_candidate_iters_.clear();
+    spilling_keys_.clear();
+    spilling_mem_size_ = 0;
+  }
+  swap_host_mem_size_ = 0;
   for (auto &item : mem_result_) {
     mem_handler_->FreeDevice(item.second);
   }
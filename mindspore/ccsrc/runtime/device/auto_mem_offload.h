@@ -19,10 +19,12 @@
 #include <utility>
 #include <queue>
 #include <map>
+#include <list>
 #include <vector>
 #include <memory>
 
 #include "runtime/device/memory_manager.h"
+#include "runtime/device/disk_offload.h"
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
 
@@ -31,12 +33,14 @@ namespace device {
 class MemHandler {
  public:
   explicit MemHandler(std::shared_ptr<MemoryManager> memory_manager) : memory_manager_(std::move(memory_manager)) {}
-  ~MemHandler() = default;
+  ~MemHandler();
   size_t GetAvailableMemSize() { return memory_manager_->GetAvailableMemSize(); }
   void *MallocDevice(size_t mem_size) { return memory_manager_->MallocMemFromMemPool(mem_size, false); }
   void FreeDevice(void *ptr) { memory_manager_->FreeMemFromMemPool(ptr); }
   void *MallocHost(size_t mem_size);
   void FreeHost(void *ptr);
+  // Release the host memory to system instead of caching it for the later malloc.
+  void ReleaseHost(void *ptr);
   void SwapIn(const void *host_ptr, void *device_ptr, size_t mem_size, void *stream) {
     memory_manager_->SwapIn(host_ptr, device_ptr, mem_size, stream);
   }
@@ -51,11 +55,14 @@ class MemHandler {
   std::shared_ptr<MemoryManager> memory_manager_;
   std::map<size_t, std::queue<void *>> cached_host_mem_;
   std::map<void *, std::shared_ptr<std::vector<uint8_t>>> host_mem_block_map_;
+  // The host memory mallocated by the memory manager: address -> size.
+  std::map<void *, size_t> device_host_mem_map_;
 };
 
 class AutoMemoryOffload {
  public:
-  explicit AutoMemoryOffload(std::shared_ptr<MemHandler> mem_handler) : mem_handler_(std::move(mem_handler)) {}
+  explicit AutoMemoryOffload(std::shared_ptr<MemHandler> mem_handler)
+      : mem_handler_(std::move(mem_handler)), disk_offload_(DiskOffload::CreateFromEnv()) {}
   ~AutoMemoryOffload() = default;
   void *Get(const void *key, void *stream = nullptr, const HashSet<const void *> &not_offload = {});
   void *Malloc(const void *key, size_t mem_size, void *stream, const HashSet<const void *> &not_offload);
@@ -70,11 +77,20 @@ class AutoMemoryOffload {
   void *SwapOut(const void *key, void *stream);
   // Return the device ptr where the data is copied to
   void *SwapIn(const void *key, void *stream);
+  // Read the swap file of the key to host memory in advance of the swap in, if the host memory has been spilled.
+  void PrefetchFromDisk(const void *key);
 
  private:
   size_t GetMemSize(const void *key);
   void GetHostPtr(const void *key, void **host_ptr, bool *from_init);
   void GetOrMallocHostPtr(const void *key, size_t mem_size, void **host_ptr, bool *from_init);
+  void FreeSwapHostPtr(const void *key);
+  // The disk tier operations, the swap host memory of the earliest swapped out keys is spilled to disk when the host
+  // memory used by swap exceeds the limit.
+  void SpillSwapHostMem(const void *swap_out_key);
+  void ReapSpilledHostMem();
+  void CancelSpill(const void *key);
+  void LoadFromDisk(const void *key);
   std::shared_ptr<MemHandler> mem_handler_;
   HashMap<const void *, void *> mem_result_;
   HashMap<const void *, size_t> mem_size_;
@@ -83,6 +99,13 @@ class AutoMemoryOffload {
   HashSet<const void *> continuous_mem_key_;
   HashMap<const void *, void *> init_host_ptr_;
   HashMap<const void *, void *> swap_host_ptr_;
+  // The disk tier of swap, which is nullptr if not enabled.
+  std::shared_ptr<DiskOffload> disk_offload_;
+  size_t swap_host_mem_size_{0};
+  size_t spilling_mem_size_{0};
+  std::list<const void *> spill_candidates_;
+  HashMap<const void *, std::list<const void *>::iterator> spill_candidate_iters_;
+  HashSet<const void *> spilling_keys_;
 };
 }  // namespace device
 }  // namespace mindspore
@@ -51,8 +51,10 @@ void Bucket::Launch() {
   pre_event_->RecordEvent();
   pre_event_->WaitEvent();
   LaunchAllReduce();
+  // The compute stream waits for the AllReduce lazily, so that the backward kernels of the remaining grads are
+  // overlapped with the AllReduce on the communication stream.
   post_event_->RecordEvent();
-  post_event_->WaitEvent();
+  launched_ = true;
   UpdateTensorAddr();
   MS_LOG(INFO) << "Bucket launch cost:" << (GetTime() - start) * 1e6 << " us";
 }
@@ -121,8 +123,19 @@ void Bucket::UpdateTensorAddr() {
   }
 }
 
+void Bucket::WaitLaunchFinish() {
+  if (!launched_) {
+    return;
+  }
+  MS_EXCEPTION_IF_NULL(post_event_);
+  post_event_->WaitEvent();
+  launched_ = false;
+}
+
 void Bucket::Release() {
   MS_LOG(INFO) << "Clear bucket:" << id_;
+  // The AllReduce memory can't be reused by the compute stream until the AllReduce finishes.
+  WaitLaunchFinish();
   grad_tensor_list_.clear();
   align_size_list_.clear();
   new_tensor_output_addrs_.clear();
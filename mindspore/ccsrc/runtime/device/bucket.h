@@ -34,6 +34,7 @@ class Bucket {
       : id_(id),
         bucket_size_(bucket_size),
         full_(false),
+        launched_(false),
         stream_(nullptr),
         compute_stream_(nullptr),
         total_size_(0),
@@ -49,6 +50,8 @@ class Bucket {
   uint32_t bucket_size() const { return bucket_size_; }
   bool full() const { return full_; }
   void Launch();
+  // Make the compute stream wait for the AllReduce of the launched bucket.
+  void WaitLaunchFinish();
   void Release();
   void AddGradTensor(const tensor::TensorPtr &tensor);
   virtual void Init(const std::vector<void *> &compute_streams, const std::vector<void *> &communication_streams) = 0;
@@ -57,6 +60,7 @@ class Bucket {
   uint32_t id_;
   uint32_t bucket_size_;
   bool full_;
+  bool launched_;
   void *stream_;
   void *compute_stream_;
   size_t total_size_;
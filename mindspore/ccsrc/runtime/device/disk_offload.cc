@@ -0,0 +1,245 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/device/disk_offload.h"
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include "utils/log_adapter.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace device {
+namespace {
+constexpr char kDiskPathEnv[] = "MS_DEV_MEM_OFFLOAD_DISK_PATH";
+constexpr char kHostMemSizeEnv[] = "MS_DEV_MEM_OFFLOAD_HOST_MEM_SIZE";
+constexpr size_t kMBToByte = 1 << 20;
+constexpr size_t kDirectIOAlignSize = 4096;
+
+bool IsDirectIOAligned(const void *host_ptr, size_t size) {
+  return reinterpret_cast<uintptr_t>(host_ptr) % kDirectIOAlignSize == 0 && size % kDirectIOAlignSize == 0;
+}
+
+#ifndef _MSC_VER
+int OpenSwapFile(const std::string &file_name, int flags, bool direct_io) {
+#ifdef O_DIRECT
+  if (direct_io) {
+    auto fd = open(file_name.c_str(), flags | O_DIRECT, S_IRUSR | S_IWUSR);
+    if (fd >= 0) {
+      return fd;
+    }
+    // Some file systems such as tmpfs don't support the direct io.
+  }
+#endif
+  return open(file_name.c_str(), flags, S_IRUSR | S_IWUSR);
+}
+#endif
+}  // namespace
+
+DiskOffload::DiskOffload(std::string swap_path, size_t host_mem_limit)
+    : swap_path_(std::move(swap_path)), host_mem_limit_(host_mem_limit) {
+  static std::atomic<size_t> instance_count{0};
+  instance_id_ = instance_count++;
+  worker_ = std::thread(&DiskOffload::Run, this);
+}
+
+DiskOffload::~DiskOffload() {
+  Clear();
+  {
+    std::lock_guard<std::mutex> locker(task_mutex_);
+    stopped_ = true;
+  }
+  task_cond_.notify_one();
+  if (worker_.joinable()) {
+    worker_.join();
+  }
+}
+
+std::shared_ptr<DiskOffload> DiskOffload::CreateFromEnv() {
+  const auto &swap_path = common::GetEnv(kDiskPathEnv);
+  const auto &host_mem_size = common::GetEnv(kHostMemSizeEnv);
+  if (swap_path.empty() || host_mem_size.empty()) {
+    return nullptr;
+  }
+#ifdef _MSC_VER
+  MS_LOG(WARNING) << "The disk tier of memory offload is not supported on windows.";
+  return nullptr;
+#else
+  size_t host_mem_limit = 0;
+  try {
+    host_mem_limit = std::stoul(host_mem_size) * kMBToByte;
+  } catch (const std::exception &e) {
+    MS_LOG(EXCEPTION) << "The value of env " << kHostMemSizeEnv << " should be a positive integer, but got "
+                      << host_mem_size;
+  }
+  if (access(swap_path.c_str(), W_OK) != 0) {
+    MS_LOG(EXCEPTION) << "The swap path " << swap_path << " of env " << kDiskPathEnv << " is not writable.";
+  }
+  MS_LOG(INFO) << "Enable the disk tier of memory offload, swap path: " << swap_path
+               << ", host memory limit: " << host_mem_limit << "B.";
+  return std::make_shared<DiskOffload>(swap_path, host_mem_limit);
+#endif
+}
+
+void DiskOffload::AsyncWrite(const void *key, const void *host_ptr, size_t size) {
+  MS_EXCEPTION_IF_NULL(host_ptr);
+  (void)Wait(key);
+  (void)swap_files_.insert(key);
+  auto file_name = GetSwapFileName(key);
+  PushTask(key, [this, file_name, host_ptr, size]() { return Write(file_name, host_ptr, size); });
+}
+
+void DiskOffload::AsyncRead(const void *key, void *host_ptr, size_t size) {
+  MS_EXCEPTION_IF_NULL(host_ptr);
+  (void)Wait(key);
+  if (!HasSwapFile(key)) {
+    MS_LOG(EXCEPTION) << "Can not find the swap file for key " << key;
+  }
+  auto file_name = GetSwapFileName(key);
+  PushTask(key, [this, file_name, host_ptr, size]() { return Read(file_name, host_ptr, size); });
+}
+
+bool DiskOffload::IsFinished(const void *key) const {
+  const auto &iter = pending_io_.find(key);
+  if (iter == pending_io_.end()) {
+    return true;
+  }
+  return iter->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+bool DiskOffload::Wait(const void *key) {
+  auto iter = pending_io_.find(key);
+  if (iter == pending_io_.end()) {
+    return true;
+  }
+  auto ret = iter->second.get();
+  (void)pending_io_.erase(iter);
+  return ret;
+}
+
+void DiskOffload::WaitAll() {
+  for (auto &io : pending_io_) {
+    (void)io.second.get();
+  }
+  pending_io_.clear();
+}
+
+void DiskOffload::RemoveSwapFile(const void *key) {
+  (void)Wait(key);
+  if (swap_files_.erase(key) != 0) {
+    (void)remove(GetSwapFileName(key).c_str());
+  }
+}
+
+void DiskOffload::Clear() {
+  WaitAll();
+  for (const auto &key : swap_files_) {
+    (void)remove(GetSwapFileName(key).c_str());
+  }
+  swap_files_.clear();
+}
+
+void DiskOffload::PushTask(const void *key, std::function<bool()> &&task) {
+  std::packaged_task<bool()> io_task(std::move(task));
+  pending_io_[key] = io_task.get_future();
+  {
+    std::lock_guard<std::mutex> locker(task_mutex_);
+    tasks_.push(std::move(io_task));
+  }
+  task_cond_.notify_one();
+}
+
+void DiskOffload::Run() {
+  while (true) {
+    std::packaged_task<bool()> task;
+    {
+      std::unique_lock<std::mutex> locker(task_mutex_);
+      task_cond_.wait(locker, [this]() { return stopped_ || !tasks_.empty(); });
+      // Finish all the pushed io before stopped, the waiters must not be blocked forever.
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop();
+    }
+    task();
+  }
+}
+
+std::string DiskOffload::GetSwapFileName(const void *key) const {
+#ifdef _MSC_VER
+  const std::string pid;
+#else
+  const auto pid = std::to_string(getpid());
+#endif
+  return swap_path_ + "/ms_mem_offload_" + pid + "_" + std::to_string(instance_id_) + "_" +
+         std::to_string(reinterpret_cast<uintptr_t>(key)) + ".swap";
+}
+
+#ifdef _MSC_VER
+bool DiskOffload::Write(const std::string &, const void *, size_t) const { return false; }
+
+bool DiskOffload::Read(const std::string &, void *, size_t) const { return false; }
+#else
+
+bool DiskOffload::Write(const std::string &file_name, const void *host_ptr, size_t size) const {
+  auto fd = OpenSwapFile(file_name, O_WRONLY | O_CREAT | O_TRUNC, IsDirectIOAligned(host_ptr, size));
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Open the swap file " << file_name << " failed, errno: " << errno;
+    return false;
+  }
+  size_t offset = 0;
+  while (offset < size) {
+    auto ret = pwrite(fd, static_cast<const uint8_t *>(host_ptr) + offset, size - offset, static_cast<off_t>(offset));
+    if (ret <= 0) {
+      MS_LOG(ERROR) << "Write the swap file " << file_name << " failed, errno: " << errno;
+      (void)close(fd);
+      return false;
+    }
+    offset += static_cast<size_t>(ret);
+  }
+  return close(fd) == 0;
+}
+
+bool DiskOffload::Read(const std::string &file_name, void *host_ptr, size_t size) const {
+  auto fd = OpenSwapFile(file_name, O_RDONLY, IsDirectIOAligned(host_ptr, size));
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Open the swap file " << file_name << " failed, errno: " << errno;
+    return false;
+  }
+  size_t offset = 0;
+  while (offset < size) {
+    auto ret = pread(fd, static_cast<uint8_t *>(host_ptr) + offset, size - offset, static_cast<off_t>(offset));
+    if (ret <= 0) {
+      MS_LOG(ERROR) << "Read the swap file " << file_name << " failed, errno: " << errno;
+      (void)close(fd);
+      return false;
+    }
+    offset += static_cast<size_t>(ret);
+  }
+  return close(fd) == 0;
+}
+#endif
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_DISK_OFFLOAD_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_DISK_OFFLOAD_H_
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+
+#include "utils/hash_map.h"
+#include "utils/hash_set.h"
+
+namespace mindspore {
+namespace device {
+// The disk tier of the memory offload, which spills the cold host memory of the swapped tensors to the swap files on
+// the local disk (such as NVMe) when the host memory used by swap exceeds the limit. The file io runs on a background
+// thread and uses the direct io when the host memory and size are aligned to the page, so the spill and the prefetch
+// are asynchronous to the compute.
+// It is enabled by the environment variables MS_DEV_MEM_OFFLOAD_DISK_PATH (the directory of the swap files) and
+// MS_DEV_MEM_OFFLOAD_HOST_MEM_SIZE (the limit of host memory used by swap in units of MB).
+class DiskOffload {
+ public:
+  DiskOffload(std::string swap_path, size_t host_mem_limit);
+  ~DiskOffload();
+
+  // Return nullptr if the disk tier is not enabled by the environment variables.
+  static std::shared_ptr<DiskOffload> CreateFromEnv();
+
+  size_t host_mem_limit() const { return host_mem_limit_; }
+
+  // Write the host memory to the swap file of the key, the host memory must be kept until the write is finished.
+  void AsyncWrite(const void *key, const void *host_ptr, size_t size);
+  // Read the swap file of the key to the host memory.
+  void AsyncRead(const void *key, void *host_ptr, size_t size);
+  // Whether the io of the key is pending, and whether it is finished without blocking.
+  bool IsPending(const void *key) const { return pending_io_.count(key) != 0; }
+  bool IsFinished(const void *key) const;
+  // Wait for the pending io of the key, return false if the io failed.
+  bool Wait(const void *key);
+  void WaitAll();
+
+  bool HasSwapFile(const void *key) const { return swap_files_.count(key) != 0; }
+  void RemoveSwapFile(const void *key);
+  // Wait for all the pending io and remove all the swap files.
+  void Clear();
+
+ private:
+  DiskOffload(const DiskOffload &) = delete;
+  DiskOffload &operator=(const DiskOffload &) = delete;
+
+  void Run();
+  void PushTask(const void *key, std::function<bool()> &&task);
+  std::string GetSwapFileName(const void *key) const;
+  bool Write(const std::string &file_name, const void *host_ptr, size_t size) const;
+  bool Read(const std::string &file_name, void *host_ptr, size_t size) const;
+
+  std::string swap_path_;
+  size_t host_mem_limit_;
+  size_t instance_id_;
+
+  // The io tasks are run by the worker thread in order.
+  std::thread worker_;
+  std::mutex task_mutex_;
+  std::condition_variable task_cond_;
+  std::queue<std::packaged_task<bool()>> tasks_;
+  bool stopped_{false};
+
+  // The pending io and the swap files are only accessed by the thread of memory offload.
+  HashMap<const void *, std::future<bool>> pending_io_;
+  HashSet<const void *> swap_files_;
+};
+}  // namespace device
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_DISK_OFFLOAD_H_
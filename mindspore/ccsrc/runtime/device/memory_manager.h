@@ -73,6 +73,10 @@ class MemoryManager {
     MS_LOG(ERROR) << "Return default 0 mem size!";
     return 0;
   }
+  // Malloc the host memory for the swap, such as the page-locked host memory which makes the copy between host and
+  // device really asynchronous. Return nullptr if the device doesn't support it, and the caller mallocs by itself.
+  virtual void *MallocHostMem(size_t size) { return nullptr; }
+  virtual void FreeHostMem(void *host_ptr) {}
 
  protected:
   virtual uint8_t *MallocStaticMem(size_t size, bool communication_mem, uint32_t graph_id) = 0;
@@ -152,6 +152,7 @@ void MemOffloadStrategy::GenEventSpan() {
 
 void MemOffloadStrategy::GenSwapEventSet() {
   swap_events_.clear();
+  swap_mem_used_.clear();
   // manual offload strategy
   if (!manual_offload_keys_.empty()) {
     for (const auto &iter : event_span_) {
@@ -183,6 +184,7 @@ void MemOffloadStrategy::GenSwapEventSet() {
     auto span = iter.second.second;
     AddToSwapEventSetIfOutOfMem(event, span, &cur_mem_used);
   }
+  swap_mem_used_ = std::move(cur_mem_used);
 }
 
 void MemOffloadStrategy::AddToSwapEventSetIfOutOfMem(const std::shared_ptr<MemEvent> &event, size_t span,
@@ -356,10 +358,11 @@ void MemOffloadStrategy::GenComputeMemEvents() {
         (void)post_compute_events_[pre_index].emplace_back(swap_out_event);
         // avoid swap-in-event follow init-event
         if (i != kFirstGetMemEventIndex || first_event->type != kInit) {
-          auto swap_in_event = std::make_shared<MemEvent>(kSwapIn, event->index);
+          auto swap_in_index = GetSwapInIndex(event, pre_index, first_event->mem_size);
+          auto swap_in_event = std::make_shared<MemEvent>(kSwapIn, swap_in_index);
           swap_in_event->key = item.first;
           swap_in_event->mem_size = first_event->mem_size;
-          (void)pre_compute_events_[event->index].emplace_back(swap_in_event);
+          (void)pre_compute_events_[swap_in_index].emplace_back(swap_in_event);
         }
       }
       if (event->index < pre_compute_events_.size()) {
@@ -373,6 +376,38 @@ void MemOffloadStrategy::GenComputeMemEvents() {
   }
 }
 
+size_t MemOffloadStrategy::GetSwapInIndex(const MemEventPtr &get_event, size_t pre_index, size_t mem_size) {
+  MS_EXCEPTION_IF_NULL(get_event);
+  const size_t get_index = get_event->index;
+  // The swap in is launched just before the compute when the running cost hasn't been profiled, the memory is swapped
+  // out in the previous iteration, or the memory is continuous which is allocated together.
+  if (compute_time_.size() != total_step_ || swap_mem_used_.size() != total_step_ || swap_bandwidth_ <= 0 ||
+      pre_index >= get_index || continuous_mem_info_helper_->IsContinuousMem(get_event->key)) {
+    return get_index;
+  }
+  // Move the swap in forward until the compute time of the overlapped steps covers the copy time, and the memory used
+  // of every overlapped step is in the budget.
+  const double swap_time = mem_size / swap_bandwidth_;
+  double overlapped_time = 0;
+  size_t swap_in_index = get_index;
+  for (size_t index = get_index - 1; index > pre_index && overlapped_time < swap_time; --index) {
+    if (swap_mem_used_[index] + mem_size > mem_size_) {
+      break;
+    }
+    overlapped_time += compute_time_[index];
+    swap_in_index = index;
+  }
+  for (size_t index = swap_in_index; index < get_index; ++index) {
+    swap_mem_used_[index] += mem_size;
+  }
+  if (swap_in_index != get_index) {
+    MS_LOG(DEBUG) << "Prefetch the memory of key: " << get_event->key << " at step " << swap_in_index
+                  << " before the get event at step " << get_index << ", overlapped time: " << overlapped_time
+                  << "us, swap time: " << swap_time << "us.";
+  }
+  return swap_in_index;
+}
+
 void MemOffloadStrategy::GenFreeEvent(const std::shared_ptr<MemEvent> &last_event) {
   MS_EXCEPTION_IF_NULL(last_event);
   auto free_event = std::make_shared<MemEvent>(kFree, last_event->index);
@@ -107,6 +107,9 @@ class MemOffloadStrategy {
 
   void SetComputeTime(const std::vector<double> &compute_time) { compute_time_ = compute_time; }
 
+  // Set the bandwidth of the swap between host and device in units of byte per microsecond.
+  void SetSwapBandwidth(double swap_bandwidth) { swap_bandwidth_ = swap_bandwidth; }
+
   MemEventPtrList &GetPreComputeEvents(size_t step);
 
   MemEventPtrList &GetPostComputeEvents(size_t step);
@@ -130,6 +133,10 @@ class MemOffloadStrategy {
 
   void GenFreeEvent(const MemEventPtr &last_event);
 
+  // Get the step to launch the swap in event, which is early enough to overlap the copy with the compute of the
+  // previous steps under the memory budget.
+  size_t GetSwapInIndex(const MemEventPtr &get_event, size_t pre_index, size_t mem_size);
+
   void AddToSwapEventSetIfOutOfMem(const MemEventPtr &mem_event, size_t span, std::vector<size_t> *mem_used);
 
   void GenContinuousMemSwapEvent(const ContinuousMemInfoPtr &continuous_mem_info, std::vector<size_t> *mem_used,
@@ -163,11 +170,14 @@ class MemOffloadStrategy {
 
   size_t mem_size_{0};
   std::vector<double> compute_time_;
+  double swap_bandwidth_{0};
   bool need_swap_{false};
   std::multimap<size_t, std::pair<MemEventPtr, size_t>> event_span_;
   std::multimap<size_t, std::pair<MemEventPtr, size_t>> continuous_input_event_span_;
   std::set<MemEventPtr> swap_events_;
   std::vector<size_t> min_mem_used_;
+  // The memory used of each step with the swap events, which is used to prefetch the swap in memory.
+  std::vector<size_t> swap_mem_used_;
   size_t mem_used_without_swap_{0};
   size_t min_mem_needed_{0};
   std::shared_ptr<ContinuousMemInfoHelper> continuous_mem_info_helper_{nullptr};
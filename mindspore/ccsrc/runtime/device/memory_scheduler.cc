@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <queue>
 #include <set>
+#include <string>
 #ifdef _MSC_VER
 #include <time.h>
 #else
@@ -25,6 +26,7 @@
 #endif
 #include "utils/log_adapter.h"
 #include "utils/convert_utils_base.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace device {
@@ -33,6 +35,9 @@ constexpr float kMaxMemReuseFactor = 1.0;
 constexpr float kMinMemReuseFactor = 0.5;
 constexpr float kRetryFactor = 0.1;
 constexpr size_t kMockTimes = 5;
+// The swap in memory spilled to disk is read to host in advance by the steps, to overlap the file io with the compute.
+constexpr size_t kDiskPrefetchStep = 3;
+constexpr char kProfileStepsEnv[] = "MS_DEV_MEM_OFFLOAD_PROFILE_STEPS";
 
 double GetCurrentTime() {
 #ifdef _MSC_VER
@@ -43,6 +48,20 @@ double GetCurrentTime() {
   return tv.tv_sec * 1.0e6 + tv.tv_usec;
 #endif
 }
+
+size_t GetProfileIterationNum() {
+  const auto &steps_env = common::GetEnv(kProfileStepsEnv);
+  if (steps_env.empty()) {
+    return 1;
+  }
+  try {
+    auto steps = std::stoul(steps_env);
+    return steps == 0 ? 1 : steps;
+  } catch (const std::exception &e) {
+    MS_LOG(EXCEPTION) << "The value of env " << kProfileStepsEnv << " should be a positive integer, but got "
+                      << steps_env;
+  }
+}
 }  // namespace
 
 void MemScheduler::AddContinuousMemInfo(bool is_input, size_t compute_index, size_t total_size,
@@ -178,7 +197,13 @@ bool MemScheduler::PreCompute(void *stream) {
     } else if (event->type == kMalloc) {
       ret = PreComputeMalloc(event, stream);
     } else if (event->type == kSwapIn) {
+      const bool record_swap_time = record_compute_time_ && !updated_;
+      auto swap_start_time = record_swap_time ? GetCurrentTime() : 0;
       ret = PreComputeSwapIn(event, stream);
+      if (record_swap_time) {
+        swap_time_ += GetCurrentTime() - swap_start_time;
+        swap_size_ += event->mem_size;
+      }
     } else if (event->type == kGet) {
       ret = PreComputeGet(event, stream);
     }
@@ -187,6 +212,13 @@ bool MemScheduler::PreCompute(void *stream) {
       return false;
     }
   }
+  if (optimized_ && current_step_ + kDiskPrefetchStep < total_step_) {
+    for (const auto &event : strategy_->GetPreComputeEvents(current_step_ + kDiskPrefetchStep)) {
+      if (event->type == kSwapIn) {
+        auto_mem_offload_->PrefetchFromDisk(event->key);
+      }
+    }
+  }
   if (record_compute_time_ && !updated_) {
     compute_start_time_ = GetCurrentTime();
   }
@@ -200,7 +232,7 @@ bool MemScheduler::PostCompute(void *stream) {
     return true;
   }
   if (record_compute_time_ && !updated_ && current_step_ < compute_time_.size()) {
-    compute_time_[current_step_] = GetCurrentTime() - compute_start_time_;
+    compute_time_[current_step_] += GetCurrentTime() - compute_start_time_;
   }
   auto &events = strategy_->GetPostComputeEvents(current_step_);
   for (auto &event : events) {
@@ -311,10 +343,24 @@ void MemScheduler::Update() {
 
   if (!record_compute_time_) {
     record_compute_time_ = true;
+    profile_iteration_num_ = GetProfileIterationNum();
     return;
   }
 
+  if (++recorded_iteration_num_ < profile_iteration_num_) {
+    return;
+  }
+  for (auto &compute_time : compute_time_) {
+    compute_time /= recorded_iteration_num_;
+  }
   strategy_->SetComputeTime(compute_time_);
+  // The swap time is measured on the host side, which is close to the copy time when the swap of pageable host
+  // memory blocks the host thread.
+  if (swap_time_ > 0) {
+    strategy_->SetSwapBandwidth(swap_size_ / swap_time_);
+  }
+  MS_LOG(INFO) << "Update the memory offload strategy by the profiling of " << recorded_iteration_num_
+               << " iterations, swap size: " << swap_size_ << ", swap time: " << swap_time_ << "us.";
   strategy_->Execute();
   updated_ = true;
 }
@@ -116,9 +116,14 @@ class MemScheduler {
   std::shared_ptr<ContinuousMemInfoHelper> continuous_mem_info_helper_{std::make_shared<ContinuousMemInfoHelper>()};
   std::set<std::shared_ptr<ContinuousMemInfo>> cur_step_allocated_continuous_mem_;
   std::set<const void *> manual_offload_keys_;
-  // Compute time
+  // Compute time, which is averaged over the profiled iterations set by env MS_DEV_MEM_OFFLOAD_PROFILE_STEPS.
   std::vector<double> compute_time_;
   double compute_start_time_{0};
+  size_t profile_iteration_num_{1};
+  size_t recorded_iteration_num_{0};
+  // The swap size and time in the profiled iterations, which is used to estimate the swap bandwidth.
+  size_t swap_size_{0};
+  double swap_time_{0};
 
   std::shared_ptr<AutoMemoryOffload> auto_mem_offload_;
   std::shared_ptr<MemHandler> mem_handler_{nullptr};
@@ -26,11 +26,18 @@ void AbstractActor::RunOpData(OpData<DeviceTensor> *const input_data, OpContext<
   MS_EXCEPTION_IF_NULL(input_data->data_->GetPtr());
   MS_EXCEPTION_IF_NULL(context);
   auto &sequential_num = context->sequential_num_;
-  (void)input_op_datas_[sequential_num].emplace_back(input_data);
+  auto &input_datas = input_op_datas_[sequential_num];
+  if ((input_datas.capacity() == 0) && (!recycled_input_op_datas_.empty())) {
+    input_datas.swap(recycled_input_op_datas_.back());
+    recycled_input_op_datas_.pop_back();
+  }
+  (void)input_datas.emplace_back(input_data);
 
   auto is_run = CheckRunningCondition(context);
   MS_LOG(DEBUG) << "Actor(" << GetAID().Name() << ") receive the input op data and check running condition:" << is_run;
   if (is_run) {
+    last_input_data_ = input_data;
+    last_input_control_ = nullptr;
     Run(context);
   }
 }
@@ -38,12 +45,19 @@ void AbstractActor::RunOpData(OpData<DeviceTensor> *const input_data, OpContext<
 void AbstractActor::RunOpControl(AID *const input_control, OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   auto &sequential_num = context->sequential_num_;
-  (void)input_op_controls_[sequential_num].emplace_back(input_control);
+  auto &input_controls = input_op_controls_[sequential_num];
+  if ((input_controls.capacity() == 0) && (!recycled_input_op_controls_.empty())) {
+    input_controls.swap(recycled_input_op_controls_.back());
+    recycled_input_op_controls_.pop_back();
+  }
+  (void)input_controls.emplace_back(input_control);
 
   auto is_run = CheckRunningCondition(context);
   MS_LOG(DEBUG) << "Actor(" << GetAID().Name()
                 << ") receive the input op control and check running condition:" << is_run;
   if (is_run) {
+    last_input_data_ = nullptr;
+    last_input_control_ = input_control;
     Run(context);
   }
 }
@@ -91,24 +105,31 @@ bool AbstractActor::CheckRunningCondition(const OpContext<DeviceTensor> *context
 
 void AbstractActor::EraseInput(const OpContext<DeviceTensor> *context) {
   MS_EXCEPTION_IF_NULL(context);
+  // The input vectors are recycled for the next steps, so the steady state steps have no allocation of them.
   if ((input_datas_num_ != 0) && (!input_op_datas_.empty())) {
-    auto ret = input_op_datas_.erase(context->sequential_num_);
-    if (ret == 0) {
+    auto data_iter = input_op_datas_.find(context->sequential_num_);
+    if (data_iter == input_op_datas_.end()) {
       std::string error_info = "Erase input data failed: " + GetAID().Name();
       // The sequential num may be invalid, can't set the promise value of context.
       MS_LOG(ERROR) << error_info << ", sequential_num: " << context->sequential_num_;
       return;
     }
+    data_iter->second.clear();
+    (void)recycled_input_op_datas_.emplace_back(std::move(data_iter->second));
+    (void)input_op_datas_.erase(data_iter);
   }
 
   if ((input_controls_num_ != 0) && (!input_op_controls_.empty())) {
-    auto ret = input_op_controls_.erase(context->sequential_num_);
-    if (ret == 0) {
+    auto control_iter = input_op_controls_.find(context->sequential_num_);
+    if (control_iter == input_op_controls_.end()) {
       std::string error_info = "Erase input controls failed: " + GetAID().Name();
       // The sequential num may be invalid, can't set the promise value of context.
       MS_LOG(ERROR) << error_info << ", sequential_num: " << context->sequential_num_;
       return;
     }
+    control_iter->second.clear();
+    (void)recycled_input_op_controls_.emplace_back(std::move(control_iter->second));
+    (void)input_op_controls_.erase(control_iter);
   }
 }
 
@@ -185,15 +206,22 @@ void AbstractActor::SendOutput(OpContext<DeviceTensor> *const context) {
         ActorDispatcher::Send(to_op_id, &AbstractActor::RunBatchOpData, &batch_output_data_[to_op_id.Name()], context);
       }
     } else if (TEST_FLAG(output_data.second, kOutputDataFlagToStack)) {
-      // Create a new op data for stack actor.
-      auto to_stack_data =
-        std::make_unique<OpData<DeviceTensor>>(to_op_id, output_data.first->data_, output_data.first->index_);
-      (void)to_stack_data_.emplace_back(std::move(to_stack_data));
+      // Fetch a new op data for stack actor, which reuses the op data allocated by the previous steps.
+      if (to_stack_data_num_ < to_stack_data_.size()) {
+        auto &to_stack_data = to_stack_data_[to_stack_data_num_];
+        to_stack_data->op_id_ = to_op_id;
+        to_stack_data->data_ = output_data.first->data_;
+        to_stack_data->index_ = output_data.first->index_;
+      } else {
+        (void)to_stack_data_.emplace_back(
+          std::make_unique<OpData<DeviceTensor>>(to_op_id, output_data.first->data_, output_data.first->index_));
+      }
+      auto to_stack_data = to_stack_data_[to_stack_data_num_++].get();
       if (TEST_FLAG(output_data.second, kOutputDataFlagBetweenFusion)) {
         const auto &to_actor = FetchSubActorInFusionActor(to_op_id.Name());
-        ActorDispatcher::SendSync(to_actor, &OpActor::RunOpData, to_stack_data_.back().get(), context);
+        ActorDispatcher::SendSync(to_actor, &OpActor::RunOpData, to_stack_data, context);
       } else {
-        ActorDispatcher::Send(to_op_id, &OpActor::RunOpData, to_stack_data_.back().get(), context);
+        ActorDispatcher::Send(to_op_id, &OpActor::RunOpData, to_stack_data, context);
       }
     } else if (!TEST_FLAG(output_data.second, kOutputDataFlagBatch)) {
       // The batch output data only send when the output flag is kOutputDataFlagLastBatch.
@@ -237,5 +265,20 @@ AbstractActor *AbstractActor::FetchSubActorInFusionActor(const std::string &sub_
   }
   return (parent_fusion_actor_->sub_actors_[sub_actor_name]).get();
 }
+
+std::string AbstractActor::FetchLastInputActorName() const {
+  if (last_input_control_ != nullptr) {
+    return last_input_control_->Name();
+  }
+  if (last_input_data_ != nullptr) {
+    for (const auto &input_data_arrow_aid : input_data_arrow_aids_) {
+      MS_EXCEPTION_IF_NULL(input_data_arrow_aid.second);
+      if (input_data_arrow_aid.second->to_input_index_ == last_input_data_->index_) {
+        return input_data_arrow_aid.first.Name();
+      }
+    }
+  }
+  return "";
+}
 }  // namespace runtime
 }  // namespace mindspore
@@ -118,6 +118,8 @@ class AbstractActor : public OpActor<DeviceTensor> {
 
   // Fetch the sub actor in the fusion actor by the name.
   AbstractActor *FetchSubActorInFusionActor(const std::string &sub_actor_name);
+  // Fetch the name of input actor whose message triggers the running, which is used by the actor trace.
+  std::string FetchLastInputActorName() const;
 
   KernelTransformType type_;
 
@@ -140,8 +142,14 @@ class AbstractActor : public OpActor<DeviceTensor> {
   // When there is recursion in the graph, the actor will send data to the same stack actor multiple times. Since
   // messages are sent asynchronously between actors, there will be multiple messages that remain unprocessed in
   // the channel. In order to prevent old data from being overwritten, it is necessary to allocate a new op data,
-  // and these op data will be uniformly cleared by the scheduler after the step ends.
+  // and these op data will be uniformly recycled by the scheduler after the step ends, then reused by the next steps.
   std::vector<OpDataUniquePtr<DeviceTensor>> to_stack_data_;
+  // The number of op data in to_stack_data_ used by the current step.
+  size_t to_stack_data_num_{0};
+
+  // The input vectors of the erased steps, which are reused by the next steps to avoid the allocation.
+  std::vector<std::vector<OpData<DeviceTensor> *>> recycled_input_op_datas_;
+  std::vector<std::vector<AID *>> recycled_input_op_controls_;
 
   // The dependent device tensor stores, the dependent expression is pair<index, AnfNode>.
   // Index is the input position, AnfNode is the key of the device tensor store.
@@ -163,6 +171,9 @@ class AbstractActor : public OpActor<DeviceTensor> {
 
   // The dependent messages number of actor running.
   int running_dependent_msg_num_;
+  // The last received input message which satisfies the running condition.
+  const OpData<DeviceTensor> *last_input_data_{nullptr};
+  const AID *last_input_control_{nullptr};
 
   // Indicates whether the actor is in fusion actor.
   AbstractActor *parent_fusion_actor_;
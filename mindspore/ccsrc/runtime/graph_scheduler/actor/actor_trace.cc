@@ -0,0 +1,122 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/actor/actor_trace.h"
+#include <fstream>
+#include <algorithm>
+#include <nlohmann/json.hpp>
+#include "utils/hash_map.h"
+#include "utils/hash_set.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr char kActorTraceFileEnv[] = "MS_DEV_ACTOR_TRACE_FILE";
+constexpr double kSecondsToMilliseconds = 1000;
+
+double Elapsed(double start_time, double end_time) {
+  return (end_time > start_time) ? (end_time - start_time) * kSecondsToMilliseconds : 0;
+}
+}  // namespace
+
+ActorTrace::ActorTrace() {
+  trace_file_ = common::GetEnv(kActorTraceFileEnv);
+  enable_ = !trace_file_.empty();
+}
+
+void ActorTrace::Record(ActorTraceRecord &&record) {
+  if (!enable_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  (void)records_.emplace_back(std::move(record));
+}
+
+void ActorTrace::AnalyzeStep(const std::string &actor_set_name, double step_start_time, double step_end_time) {
+  if (!enable_) {
+    return;
+  }
+  std::vector<ActorTraceRecord> records;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    records.swap(records_);
+  }
+  ++step_;
+  if (records.empty()) {
+    return;
+  }
+
+  // The actor runs once in a step, and the latest finished actor is the end of the critical path.
+  mindspore::HashMap<std::string, const ActorTraceRecord *> name_to_records;
+  const ActorTraceRecord *last_record = &records[0];
+  for (const auto &record : records) {
+    name_to_records[record.actor_name_] = &record;
+    if (record.finish_time_ > last_record->finish_time_) {
+      last_record = &record;
+    }
+  }
+
+  // Walk back along the last arrived inputs, the time from the finish of the predecessor to the ready of the actor is
+  // the data waiting, which includes the message passing and the scheduling of actor thread.
+  double data_wait_time = 0;
+  double memory_alloc_time = 0;
+  double launch_overhead_time = 0;
+  double launch_time = 0;
+  std::vector<std::string> critical_path;
+  mindspore::HashSet<std::string> visited;
+  const ActorTraceRecord *record = last_record;
+  while (record != nullptr && visited.insert(record->actor_name_).second) {
+    (void)critical_path.emplace_back(record->actor_name_);
+    memory_alloc_time += Elapsed(record->ready_time_, record->alloc_finish_time_);
+    launch_overhead_time += Elapsed(record->alloc_finish_time_, record->launch_start_time_) +
+                            Elapsed(record->launch_end_time_, record->finish_time_);
+    launch_time += Elapsed(record->launch_start_time_, record->launch_end_time_);
+
+    const auto &iter = name_to_records.find(record->last_input_actor_);
+    const ActorTraceRecord *prev_record = (iter == name_to_records.end()) ? nullptr : iter->second;
+    data_wait_time +=
+      Elapsed((prev_record == nullptr) ? step_start_time : prev_record->finish_time_, record->ready_time_);
+    record = prev_record;
+  }
+  std::reverse(critical_path.begin(), critical_path.end());
+
+  double step_time = Elapsed(step_start_time, step_end_time);
+  MS_LOG(INFO) << "The critical path of actor set: " << actor_set_name << " step: " << step_ << " has "
+               << critical_path.size() << " actors, step time: " << step_time << " ms, data waiting: " << data_wait_time
+               << " ms, memory allocation: " << memory_alloc_time << " ms, launch overhead: " << launch_overhead_time
+               << " ms, kernel launch: " << launch_time << " ms.";
+
+  nlohmann::json step_json;
+  step_json["actor_set"] = actor_set_name;
+  step_json["step"] = step_;
+  step_json["actor_num"] = records.size();
+  step_json["step_time"] = step_time;
+  step_json["data_wait_time"] = data_wait_time;
+  step_json["memory_alloc_time"] = memory_alloc_time;
+  step_json["launch_overhead_time"] = launch_overhead_time;
+  step_json["launch_time"] = launch_time;
+  step_json["critical_path"] = critical_path;
+  std::ofstream ofs(trace_file_, std::ios::app);
+  if (!ofs.is_open()) {
+    MS_LOG(WARNING) << "Open the actor trace file: " << trace_file_ << " failed.";
+    return;
+  }
+  ofs << step_json.dump() << std::endl;
+  ofs.close();
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_ACTOR_TRACE_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_ACTOR_TRACE_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace runtime {
+// The timestamps of one running of the kernel actor, in units of second.
+struct ActorTraceRecord {
+  std::string actor_name_;
+  // The input actor whose message triggers the running, which is the predecessor on the critical path.
+  std::string last_input_actor_;
+  double ready_time_{0};
+  double alloc_finish_time_{0};
+  double launch_start_time_{0};
+  double launch_end_time_{0};
+  double finish_time_{0};
+};
+
+// The actor trace records the running timestamps of the kernel actors in each step, reconstructs the critical path of
+// the step by the last arrived inputs, and attributes the time on the critical path to data waiting, memory allocation,
+// launch overhead and kernel launch. The step results are appended to the file of env MS_DEV_ACTOR_TRACE_FILE in json
+// lines, and the trace is disabled when the env is not set.
+class ActorTrace {
+ public:
+  static ActorTrace &GetInstance() {
+    static ActorTrace instance;
+    return instance;
+  }
+
+  bool enable() const { return enable_; }
+
+  void Record(ActorTraceRecord &&record);
+
+  // Analyze the critical path of the step which starts at the step_start_time and clear the records.
+  void AnalyzeStep(const std::string &actor_set_name, double step_start_time, double step_end_time);
+
+ private:
+  ActorTrace();
+  ~ActorTrace() = default;
+  DISABLE_COPY_AND_ASSIGN(ActorTrace);
+
+  bool enable_{false};
+  std::string trace_file_;
+  size_t step_{0};
+  std::mutex mutex_;
+  std::vector<ActorTraceRecord> records_;
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_ACTOR_TRACE_H_
@@ -26,6 +26,10 @@
 
 namespace mindspore {
 namespace runtime {
+namespace {
+constexpr char kAsyncHostToDeviceEnv[] = "MS_DEV_ENABLE_ASYNC_HOST_TO_DEVICE";
+}  // namespace
+
 void DataSourceActor::Init() {
   // Check device contexts number.
   if (device_contexts_.size() < device::kDeviceContextsNumOne) {
@@ -243,6 +247,43 @@ void HostQueueDataSourceActor::SendMemoryFreeReq(OpContext<DeviceTensor> *const
   }
 }
 
+void HostQueueDataSourceActor::Init() {
+  DataSourceActor::Init();
+
+  // Only the GPU device supports the stream waiting for the event currently.
+  if (common::GetEnv(kAsyncHostToDeviceEnv) != "1" || !IsSameDeviceType() ||
+      device_contexts_[0]->GetDeviceType() != device::DeviceType::kGPU) {
+    return;
+  }
+  MS_EXCEPTION_IF_NULL(device_contexts_[0]->device_res_manager_);
+  if (!device_contexts_[0]->device_res_manager_->CreateStream(&copy_stream_id_)) {
+    MS_LOG(WARNING) << "Create the copy stream failed for actor: " << GetAID().Name()
+                    << ", the host tensors are copied to device synchronously.";
+    return;
+  }
+  enable_async_copy_ = true;
+  MS_LOG(INFO) << "Actor: " << GetAID().Name() << " copies the host tensors on stream: " << copy_stream_id_;
+}
+
+bool HostQueueDataSourceActor::AsyncCopyHostTensor(const TensorPtr &host_tensor, const DeviceTensor *device_tensor,
+                                                   size_t index) {
+  MS_EXCEPTION_IF_NULL(host_tensor);
+  MS_EXCEPTION_IF_NULL(device_tensor);
+  // The copy with the type or format conversion is done synchronously by the SyncHostToDevice.
+  size_t size = LongToSize(host_tensor->data().nbytes());
+  if ((host_tensor->data_type() != device_tensor->type_id()) || (size > device_tensor->GetSize()) ||
+      (device_tensor->format() != host_tensor->device_info().host_format_ &&
+       !host_tensor->device_info().host_format_.empty())) {
+    return false;
+  }
+  if (size == 0) {
+    return true;
+  }
+  auto shape = trans::GetRuntimePaddingShape(data_node_with_indexs_[index].first, data_node_with_indexs_[index].second);
+  auto stream = device_contexts_[0]->device_res_manager_->GetStream(copy_stream_id_);
+  return device_tensor->AsyncHostToDevice(shape, size, host_tensor->data_type(), host_tensor->data_c(), stream);
+}
+
 void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   if (IsRunningFailed(context)) {
@@ -282,6 +323,10 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
       continue;
     }
 
+    if (enable_async_copy_ && AsyncCopyHostTensor(host_tensor, device_tensor, i)) {
+      continue;
+    }
+
     // Sync data from host_tensor to device_tensor.
     if (!device_tensor->SyncHostToDevice(
           trans::GetRuntimePaddingShape(data_node_with_indexs_[i].first, data_node_with_indexs_[i].second),
@@ -290,6 +335,16 @@ void HostQueueDataSourceActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *cons
       SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "SyncHostToDevice failed.");
     }
   }
+
+  if (enable_async_copy_) {
+    // The kernels on the compute stream are launched after the copy finished, and fall back to block the actor thread
+    // if the device event isn't supported.
+    const auto &res_manager = device_contexts_[0]->device_res_manager_;
+    if (!res_manager->StreamWaitStream(0, copy_stream_id_) && !res_manager->SyncStream(copy_stream_id_)) {
+      SET_OPCONTEXT_FAIL_RET_WITH_ERROR((*context), "Sync the copy stream failed.");
+    }
+    last_host_tensors_ = host_tensors;
+  }
   host_queue_->Pop();
 
   PostRun(context);
@@ -119,6 +119,8 @@ class HostQueueDataSourceActor : public DataSourceActor {
         host_queue_(host_queue) {}
   ~HostQueueDataSourceActor() override = default;
 
+  void Init() override;
+
   // The memory related operation interface.
   void SendMemoryAllocReq(OpContext<DeviceTensor> *const context) override;
   void SendMemoryFreeReq(OpContext<DeviceTensor> *const context) override;
@@ -140,6 +142,9 @@ class HostQueueDataSourceActor : public DataSourceActor {
 
   // Judge all the data_nodes_ is from the same device.
   bool IsSameDeviceType() const;
+  // Copy the host tensor to the device tensor asynchronously on the copy stream, return false if the copy needs the
+  // data conversion and can only be done synchronously.
+  bool AsyncCopyHostTensor(const TensorPtr &host_tensor, const DeviceTensor *device_tensor, size_t index);
 
   HostTensorQueuePtr host_queue_;
   // Input data nodes fetch data from host queue.
@@ -147,6 +152,15 @@ class HostQueueDataSourceActor : public DataSourceActor {
 
   // The location of the data node in the data source actor.
   std::map<KernelWithIndex, size_t> data_node_position_map_;
+
+  // The host tensors are copied to device on the copy stream which is independent of the compute stream when the env
+  // MS_DEV_ENABLE_ASYNC_HOST_TO_DEVICE is set, and the compute stream waits for the copy by the device event instead
+  // of blocking the actor thread for each tensor.
+  bool enable_async_copy_{false};
+  size_t copy_stream_id_{0};
+  // The host tensors of current step are held until the copy of next step is launched, because the async copy may be
+  // still reading the host memory after the tensors are popped from the host queue.
+  std::vector<TensorPtr> last_host_tensors_;
 };
 
 using DataSourceActorPtr = std::shared_ptr<DataSourceActor>;
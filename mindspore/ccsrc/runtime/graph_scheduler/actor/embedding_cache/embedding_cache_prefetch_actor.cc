@@ -15,6 +15,8 @@
  */
 
 #include "runtime/graph_scheduler/actor/embedding_cache/embedding_cache_prefetch_actor.h"
+#include <algorithm>
+#include <future>
 #include <limits>
 #include "backend/common/optimizer/dynamic_shape/dynamic_shape_helper.h"
 #include "kernel/common_utils.h"
@@ -39,8 +41,48 @@ const size_t kInputIndexTwo = 2;
 constexpr size_t kMaxThreadNum = 16;
 // Maximum number of feature ids processed per thread.
 constexpr size_t kMaxIdsPerThread = 10000;
+// The maximum number of ids synchronized from local storage to remote at a time.
+constexpr size_t kMaxSyncStorageIdsNum = 1000000;
 
 namespace {
+// The buffers of the swap information parsed by one thread.
+struct SwapInfoBuffer {
+  explicit SwapInfoBuffer(size_t ids_num)
+      : device_to_host_index_(ids_num),
+        device_to_host_ids_(ids_num),
+        host_cache_device_to_host_index_(ids_num),
+        host_to_device_index_(ids_num),
+        host_to_device_ids_(ids_num),
+        host_cache_host_to_device_index_(ids_num),
+        host_to_server_index_(ids_num * 2),
+        host_to_server_ids_(ids_num * 2),
+        server_to_host_index_(ids_num),
+        server_to_host_ids_(ids_num) {
+    swap_info_.device_to_host_index_ = device_to_host_index_.data();
+    swap_info_.device_to_host_ids_ = device_to_host_ids_.data();
+    swap_info_.host_cache_device_to_host_index_ = host_cache_device_to_host_index_.data();
+    swap_info_.host_to_device_index_ = host_to_device_index_.data();
+    swap_info_.host_to_device_ids_ = host_to_device_ids_.data();
+    swap_info_.host_cache_host_to_device_index_ = host_cache_host_to_device_index_.data();
+    swap_info_.host_to_server_index_ = host_to_server_index_.data();
+    swap_info_.host_to_server_ids_ = host_to_server_ids_.data();
+    swap_info_.server_to_host_index_ = server_to_host_index_.data();
+    swap_info_.server_to_host_ids_ = server_to_host_ids_.data();
+  }
+
+  std::vector<int> device_to_host_index_;
+  std::vector<int64_t> device_to_host_ids_;
+  std::vector<int> host_cache_device_to_host_index_;
+  std::vector<int> host_to_device_index_;
+  std::vector<int64_t> host_to_device_ids_;
+  std::vector<int> host_cache_host_to_device_index_;
+  std::vector<int> host_to_server_index_;
+  std::vector<int64_t> host_to_server_ids_;
+  std::vector<int> server_to_host_index_;
+  std::vector<int64_t> server_to_host_ids_;
+  EmbeddingCacheSwapInfo swap_info_;
+};
+
 ParameterPtr NewParameter(const KernelGraphPtr &graph, TypePtr type, const ShapeVector &shape) {
   MS_EXCEPTION_IF_NULL(graph);
   MS_EXCEPTION_IF_NULL(type);
@@ -186,6 +228,13 @@ int32_t GetCacheOpsServiceId(const std::string &cache_operation, int32_t param_k
   return id;
 }
 
+// The hash index of the id out of the range of local embedding table slice only needs to be out of the range of local
+// device cache, so it is saturated to int.
+int SaturateToInt(int64_t value) {
+  return static_cast<int>(std::min<int64_t>(std::max<int64_t>(value, std::numeric_limits<int>::min()),
+                                            std::numeric_limits<int>::max()));
+}
+
 // Async copy host memory to device.
 bool MemcpyHostToDeviceAsync(void *dst, const void *src, size_t size, const DeviceContext *device_context,
                              size_t stream_id) {
@@ -245,6 +294,15 @@ void EmbeddingCachePrefetchActor::Initialize() {
   MS_EXCEPTION_IF_NULL(embedding_device_cache_);
   embedding_host_cache_ = embedding_cache_table_manager.embedding_host_cache_;
   MS_EXCEPTION_IF_NULL(embedding_host_cache_);
+  embedding_host_optimizer_ = embedding_cache_table_manager.embedding_host_optimizer_;
+  MS_EXCEPTION_IF_NULL(embedding_device_cache_->device_hash_map_);
+  MS_EXCEPTION_IF_NULL(embedding_host_cache_->host_hash_map_);
+  auto device_shard_num = embedding_device_cache_->device_hash_map_->shard_num();
+  auto host_shard_num = embedding_host_cache_->host_hash_map_->shard_num();
+  if (device_shard_num != host_shard_num) {
+    MS_LOG(EXCEPTION) << "The shard number of device hash map: " << device_shard_num
+                      << " is not equal to the shard number of local host hash map: " << host_shard_num;
+  }
   local_embedding_slice_bounds_ = embedding_cache_table_manager.local_embedding_slice_bounds_;
   local_device_cache_bounds_ = embedding_cache_table_manager.local_device_cache_bounds_;
 
@@ -266,6 +324,7 @@ void EmbeddingCachePrefetchActor::Finalize() {
     return;
   }
   SyncEmbeddingTable();
+  embedding_cache_table_manager.DumpTableStatistics();
 
   running_ = false;
   (void)FinalizeRemote();
@@ -520,8 +579,22 @@ bool EmbeddingCachePrefetchActor::PrefetchCache() {
     MS_LOG(ERROR) << "The data size of batch ids can not be zero.";
     return false;
   }
-  auto batch_ids = reinterpret_cast<int *>(data);
-  auto batch_ids_num = data_size / sizeof(int);
+  // The input ids are parsed as int64 ids, and the hash indices are written back with the data type of input ids.
+  auto data_type = PsDataPrefetch::GetInstance().data_type(channel_name_);
+  bool is_int64_ids = (data_type == ps::kInt64DataType);
+  if (!is_int64_ids && data_type != ps::kInt32DataType) {
+    MS_LOG(ERROR) << "The data type of batch ids should be int32 or int64, but got: " << data_type;
+    return false;
+  }
+  size_t id_size = is_int64_ids ? sizeof(int64_t) : sizeof(int);
+  auto batch_ids_num = data_size / id_size;
+  std::vector<int64_t> int64_batch_ids;
+  const int64_t *batch_ids = reinterpret_cast<int64_t *>(data);
+  if (!is_int64_ids) {
+    auto int32_batch_ids = reinterpret_cast<int *>(data);
+    int64_batch_ids.assign(int32_batch_ids, int32_batch_ids + batch_ids_num);
+    batch_ids = int64_batch_ids.data();
+  }
   std::unique_ptr<int[]> hash_index = std::make_unique<int[]>(batch_ids_num);
   auto ret = memset_s(&statistics_info_, sizeof(statistics_info_), 0, sizeof(statistics_info_));
   if (ret != EOK) {
@@ -540,13 +613,18 @@ bool EmbeddingCachePrefetchActor::PrefetchCache() {
 
   // 3. If the device cache does not reach 100% hit rate, the cache needs to be updated.
   RETURN_IF_FALSE_WITH_LOG(UpdateCache(), "Update local cache failed.");
+  embedding_cache_table_manager.UpdateTableStatistics(statistics_info_);
 
   // 4. Replace the batch_ids by hash index for GetNext operator to get hash index as input.
-  size_t dest_len = data_size;
-  ret = memcpy_s(data, dest_len, hash_index.get(), data_size);
-  if (ret != EOK) {
-    MS_LOG(ERROR) << "Memcpy hash index failed, errno[" << ret << "]";
-    return false;
+  if (is_int64_ids) {
+    (void)std::copy(hash_index.get(), hash_index.get() + batch_ids_num, reinterpret_cast<int64_t *>(data));
+  } else {
+    size_t dest_len = data_size;
+    ret = memcpy_s(data, dest_len, hash_index.get(), data_size);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << "Memcpy hash index failed, errno[" << ret << "]";
+      return false;
+    }
   }
   RETURN_IF_FALSE_WITH_LOG(PsDataPrefetch::GetInstance().FinalizeData(channel_name_), "Finalize data failed.");
   return true;
@@ -567,7 +645,8 @@ bool EmbeddingCachePrefetchActor::IncreaseStep() {
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::CountCacheMissIds(const int *batch_ids, const size_t batch_ids_num, int *hash_index) {
+bool EmbeddingCachePrefetchActor::CountCacheMissIds(const int64_t *batch_ids, const size_t batch_ids_num,
+                                                    int *hash_index) {
   MS_ERROR_IF_NULL(batch_ids);
   MS_ERROR_IF_NULL(hash_index);
 
@@ -592,72 +671,194 @@ bool EmbeddingCachePrefetchActor::CountCacheMissIds(const int *batch_ids, const
   RETURN_IF_FALSE_WITH_LOG(ResetEmbeddingHashMap(), "Reset embedding hash map failed.");
 
   // 2.calculate the swapping and mapping(feature id to cache index) information of the missing feature id that needs to
-  // be inserted into the cache.
+  // be inserted into the cache. The missing ids are grouped by the shard of hash maps.
+  MS_ERROR_IF_NULL(embedding_device_cache_);
+  const auto &device_hash_map = embedding_device_cache_->device_hash_map_;
+  MS_ERROR_IF_NULL(device_hash_map);
+  size_t shard_num = device_hash_map->shard_num();
+  std::vector<std::vector<size_t>> miss_positions(shard_num);
   for (size_t i = 0; i < batch_ids_num; i++) {
     if (in_device[i] || out_range[i]) {
       continue;
     }
+    miss_positions[device_hash_map->ShardIndex(batch_ids[i])].push_back(i);
+  }
+  if (shard_num > 1) {
+    return ParseCacheMissIdsInParallel(batch_ids, miss_positions, hash_index);
+  }
+
+  MS_ERROR_IF_NULL(embedding_host_cache_);
+  EmbeddingCacheSwapInfo swap_info;
+  swap_info.device_to_host_index_ = embedding_device_cache_->device_to_host_index.get();
+  swap_info.device_to_host_ids_ = embedding_device_cache_->device_to_host_ids.get();
+  swap_info.host_cache_device_to_host_index_ = embedding_host_cache_->device_to_host_index.get();
+  swap_info.host_to_device_index_ = embedding_device_cache_->host_to_device_index.get();
+  swap_info.host_to_device_ids_ = embedding_device_cache_->host_to_device_ids.get();
+  swap_info.host_cache_host_to_device_index_ = embedding_host_cache_->host_to_device_index.get();
+  swap_info.host_to_server_index_ = embedding_host_cache_->host_to_server_index.get();
+  swap_info.host_to_server_ids_ = embedding_host_cache_->host_to_server_ids.get();
+  swap_info.server_to_host_index_ = embedding_host_cache_->server_to_host_index.get();
+  swap_info.server_to_host_ids_ = embedding_host_cache_->server_to_host_ids.get();
+  RETURN_IF_FALSE(ParseCacheMissIds(batch_ids, miss_positions.front(), hash_index, &swap_info));
+  UpdateStatisticsInfo(swap_info);
+  return true;
+}
+
+bool EmbeddingCachePrefetchActor::ParseCacheMissIds(const int64_t *batch_ids,
+                                                    const std::vector<size_t> &miss_positions, int *hash_index,
+                                                    EmbeddingCacheSwapInfo *swap_info) {
+  MS_ERROR_IF_NULL(batch_ids);
+  MS_ERROR_IF_NULL(hash_index);
+  MS_ERROR_IF_NULL(swap_info);
+  for (auto i : miss_positions) {
     bool need_swap_host_to_device = true;
     bool need_swap_device_to_host = true;
     int index = INVALID_INDEX_VALUE;
     RETURN_IF_FALSE_WITH_LOG(
-      ParseDeviceData(batch_ids[i], &need_swap_device_to_host, &need_swap_host_to_device, &index),
+      ParseDeviceData(batch_ids[i], &need_swap_device_to_host, &need_swap_host_to_device, &index, swap_info),
       "Parse device cache data failed.");
     hash_index[i] = index + local_device_cache_bounds_.first;
     if (need_swap_host_to_device) {
-      RETURN_IF_FALSE_WITH_LOG(ParseHostDataHostToDevice(batch_ids[i]),
+      RETURN_IF_FALSE_WITH_LOG(ParseHostDataHostToDevice(batch_ids[i], swap_info),
                                "Parse local host cache data(swap local host cache to device) failed.");
     }
     if (need_swap_device_to_host) {
-      RETURN_IF_FALSE_WITH_LOG(ParseHostDataDeviceToHost(),
+      RETURN_IF_FALSE_WITH_LOG(ParseHostDataDeviceToHost(swap_info),
                                "Parse local host cache data(swap device cache to local host) failed.");
     }
   }
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::ParseDeviceData(int id, bool *need_swap_device_to_host,
-                                                  bool *need_swap_host_to_device, int *hash_index) {
+bool EmbeddingCachePrefetchActor::ParseCacheMissIdsInParallel(const int64_t *batch_ids,
+                                                              const std::vector<std::vector<size_t>> &miss_positions,
+                                                              int *hash_index) {
+  MS_ERROR_IF_NULL(batch_ids);
+  MS_ERROR_IF_NULL(hash_index);
+  size_t thread_num = miss_positions.size();
+  if (thread_num > kMaxThreadNum) {
+    MS_LOG(ERROR) << "The shard number of hash map: " << thread_num << " exceeds the maximum thread number.";
+    return false;
+  }
+
+  // Each shard records the swap information to its own buffers, the size of buffers is the number of cache miss ids
+  // in the shard, except that both the new ids and the ids swapped out of device cache may swap local host cache out.
+  std::vector<std::unique_ptr<SwapInfoBuffer>> swap_info_buffers;
+  for (const auto &positions : miss_positions) {
+    (void)swap_info_buffers.emplace_back(std::make_unique<SwapInfoBuffer>(positions.size()));
+  }
+  // The pipelined threads are created for every batch, as the parsing may block to wait the computed graph, and it
+  // must not occupy the threads of the common thread pool used by the computed graph.
+  std::thread threads[kMaxThreadNum];
+  bool results[kMaxThreadNum] = {false};
+  for (size_t i = 0; i < thread_num; ++i) {
+    threads[i] = std::thread([this, i, batch_ids, hash_index, &miss_positions, &swap_info_buffers, &results]() {
+      results[i] = ParseCacheMissIds(batch_ids, miss_positions[i], hash_index, &(swap_info_buffers[i]->swap_info_));
+    });
+  }
+  for (size_t i = 0; i < thread_num; ++i) {
+    threads[i].join();
+  }
+
+  // Merge the swap information in the order of shards.
+  for (size_t i = 0; i < thread_num; ++i) {
+    if (!results[i]) {
+      MS_LOG(ERROR) << "Parse the cache miss ids of hash map shard " << i << " failed.";
+      return false;
+    }
+    MergeSwapInfo(swap_info_buffers[i]->swap_info_);
+  }
+  return true;
+}
+
+void EmbeddingCachePrefetchActor::MergeSwapInfo(const EmbeddingCacheSwapInfo &swap_info) {
+  auto device_to_host_offset = statistics_info_.device_to_host_size_;
+  auto device_to_host_size = swap_info.device_to_host_size_;
+  (void)std::copy_n(swap_info.device_to_host_index_, device_to_host_size,
+                    embedding_device_cache_->device_to_host_index.get() + device_to_host_offset);
+  (void)std::copy_n(swap_info.device_to_host_ids_, device_to_host_size,
+                    embedding_device_cache_->device_to_host_ids.get() + device_to_host_offset);
+  (void)std::copy_n(swap_info.host_cache_device_to_host_index_, device_to_host_size,
+                    embedding_host_cache_->device_to_host_index.get() + device_to_host_offset);
+
+  auto host_to_device_offset = statistics_info_.host_to_device_size_;
+  auto host_to_device_size = swap_info.host_to_device_size_;
+  (void)std::copy_n(swap_info.host_to_device_index_, host_to_device_size,
+                    embedding_device_cache_->host_to_device_index.get() + host_to_device_offset);
+  (void)std::copy_n(swap_info.host_to_device_ids_, host_to_device_size,
+                    embedding_device_cache_->host_to_device_ids.get() + host_to_device_offset);
+  (void)std::copy_n(swap_info.host_cache_host_to_device_index_, host_to_device_size,
+                    embedding_host_cache_->host_to_device_index.get() + host_to_device_offset);
+
+  auto host_to_server_offset = statistics_info_.host_to_server_size_;
+  auto host_to_server_size = swap_info.host_to_server_size_;
+  (void)std::copy_n(swap_info.host_to_server_index_, host_to_server_size,
+                    embedding_host_cache_->host_to_server_index.get() + host_to_server_offset);
+  (void)std::copy_n(swap_info.host_to_server_ids_, host_to_server_size,
+                    embedding_host_cache_->host_to_server_ids.get() + host_to_server_offset);
+
+  auto server_to_host_offset = statistics_info_.server_to_host_size_;
+  auto server_to_host_size = swap_info.server_to_host_size_;
+  (void)std::copy_n(swap_info.server_to_host_index_, server_to_host_size,
+                    embedding_host_cache_->server_to_host_index.get() + server_to_host_offset);
+  (void)std::copy_n(swap_info.server_to_host_ids_, server_to_host_size,
+                    embedding_host_cache_->server_to_host_ids.get() + server_to_host_offset);
+
+  UpdateStatisticsInfo(swap_info);
+}
+
+void EmbeddingCachePrefetchActor::UpdateStatisticsInfo(const EmbeddingCacheSwapInfo &swap_info) {
+  statistics_info_.device_to_host_size_ += swap_info.device_to_host_size_;
+  statistics_info_.host_to_device_size_ += swap_info.host_to_device_size_;
+  statistics_info_.host_to_server_size_ += swap_info.host_to_server_size_;
+  statistics_info_.server_to_host_size_ += swap_info.server_to_host_size_;
+  statistics_info_.hash_hit_count_ += swap_info.hash_hit_count_;
+  device_cache_need_wait_graph_ = device_cache_need_wait_graph_ || swap_info.device_cache_need_wait_graph_;
+  host_cache_need_wait_graph_ = host_cache_need_wait_graph_ || swap_info.host_cache_need_wait_graph_;
+}
+
+bool EmbeddingCachePrefetchActor::ParseDeviceData(int64_t id, bool *need_swap_device_to_host,
+                                                  bool *need_swap_host_to_device, int *hash_index,
+                                                  EmbeddingCacheSwapInfo *swap_info) {
   MS_ERROR_IF_NULL(need_swap_device_to_host);
   MS_ERROR_IF_NULL(need_swap_host_to_device);
   MS_ERROR_IF_NULL(hash_index);
+  MS_ERROR_IF_NULL(swap_info);
   MS_ERROR_IF_NULL(embedding_device_cache_);
   auto &device_hash_map = embedding_device_cache_->device_hash_map_;
   MS_ERROR_IF_NULL(device_hash_map);
 
-  int index = INVALID_INDEX_VALUE;
-  const auto &hash_id_to_index = device_hash_map->hash_id_to_index();
-  const auto &iter = hash_id_to_index.find(id);
-  if (iter != hash_id_to_index.end()) {
+  int index = device_hash_map->GetIndex(id);
+  if (index != INVALID_INDEX_VALUE) {
     *need_swap_device_to_host = false;
     *need_swap_host_to_device = false;
-    index = iter->second;
     if (device_hash_map->hash_step(index) != data_step_) {
-      statistics_info_.hash_hit_count_++;
+      swap_info->hash_hit_count_++;
       device_hash_map->set_hash_step(index, data_step_);
+      device_hash_map->RecordAccess(index);
     }
   } else {
-    int *device_to_host_index = embedding_device_cache_->device_to_host_index.get();
-    int *device_to_host_ids = embedding_device_cache_->device_to_host_ids.get();
-    int *host_to_device_index = embedding_device_cache_->host_to_device_index.get();
-    int *host_to_device_ids = embedding_device_cache_->host_to_device_ids.get();
+    int *host_to_device_index = swap_info->host_to_device_index_;
+    int64_t *host_to_device_ids = swap_info->host_to_device_ids_;
     MS_ERROR_IF_NULL(host_to_device_index);
     MS_ERROR_IF_NULL(host_to_device_ids);
-    auto tmp_device_to_host_size = statistics_info_.device_to_host_size_;
+    auto tmp_device_to_host_size = swap_info->device_to_host_size_;
     while (true) {
       // Calculate the mapping of id to index.
-      index = device_hash_map->ParseData(id, device_to_host_index, device_to_host_ids, data_step_, graph_running_step_,
-                                         &(statistics_info_.device_to_host_size_), &device_cache_need_wait_graph_);
+      size_t graph_running_step = graph_running_step_;
+      index = device_hash_map->ParseData(id, swap_info->device_to_host_index_, swap_info->device_to_host_ids_,
+                                         data_step_, graph_running_step, &(swap_info->device_to_host_size_),
+                                         &(swap_info->device_cache_need_wait_graph_));
       if (index == INVALID_INDEX_VALUE) {
-        if (!WaitGraphRun()) {
+        if (!WaitGraphRun(graph_running_step)) {
           return false;
         }
         continue;
       }
-      host_to_device_index[statistics_info_.host_to_device_size_] = index;
-      host_to_device_ids[statistics_info_.host_to_device_size_] = id;
-      statistics_info_.host_to_device_size_++;
-      *need_swap_device_to_host = statistics_info_.device_to_host_size_ > tmp_device_to_host_size;
+      host_to_device_index[swap_info->host_to_device_size_] = index;
+      host_to_device_ids[swap_info->host_to_device_size_] = id;
+      swap_info->host_to_device_size_++;
+      *need_swap_device_to_host = swap_info->device_to_host_size_ > tmp_device_to_host_size;
       break;
     }
   }
@@ -666,40 +867,38 @@ bool EmbeddingCachePrefetchActor::ParseDeviceData(int id, bool *need_swap_device
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::ParseHostDataHostToDevice(int id) {
+bool EmbeddingCachePrefetchActor::ParseHostDataHostToDevice(int64_t id, EmbeddingCacheSwapInfo *swap_info) {
+  MS_ERROR_IF_NULL(swap_info);
   MS_ERROR_IF_NULL(embedding_host_cache_);
-  int *host_to_device_index = embedding_host_cache_->host_to_device_index.get();
+  int *host_to_device_index = swap_info->host_cache_host_to_device_index_;
   MS_ERROR_IF_NULL(host_to_device_index);
   auto &host_hash_map = embedding_host_cache_->host_hash_map_;
   MS_ERROR_IF_NULL(host_hash_map);
 
-  const auto &hash_id_to_index = host_hash_map->hash_id_to_index();
-  const auto &iter = hash_id_to_index.find(id);
-  if (iter != hash_id_to_index.end()) {
-    auto index = iter->second;
+  auto index = host_hash_map->GetIndex(id);
+  if (index != INVALID_INDEX_VALUE) {
     if (host_hash_map->hash_step(index) != data_step_) {
       host_hash_map->set_hash_step(index, data_step_);
     }
-    host_to_device_index[statistics_info_.host_to_device_size_ - 1] = index;
+    host_to_device_index[swap_info->host_to_device_size_ - 1] = index;
   } else {
-    int *host_to_server_index = embedding_host_cache_->host_to_server_index.get();
-    int *host_to_server_ids = embedding_host_cache_->host_to_server_ids.get();
-    int *server_to_host_index = embedding_host_cache_->server_to_host_index.get();
-    int *server_to_host_ids = embedding_host_cache_->server_to_host_ids.get();
+    int *server_to_host_index = swap_info->server_to_host_index_;
+    int64_t *server_to_host_ids = swap_info->server_to_host_ids_;
     MS_ERROR_IF_NULL(server_to_host_index);
     MS_ERROR_IF_NULL(server_to_host_ids);
     while (true) {
       // Calculate the mapping of id to index.
-      auto index =
-        host_hash_map->ParseData(id, host_to_server_index, host_to_server_ids, data_step_, graph_running_step_,
-                                 &statistics_info_.host_to_server_size_, &host_cache_need_wait_graph_);
+      size_t graph_running_step = graph_running_step_;
+      index = host_hash_map->ParseData(id, swap_info->host_to_server_index_, swap_info->host_to_server_ids_,
+                                       data_step_, graph_running_step, &(swap_info->host_to_server_size_),
+                                       &(swap_info->host_cache_need_wait_graph_));
       if (index == INVALID_INDEX_VALUE) {
-        RETURN_IF_FALSE_WITH_LOG(WaitGraphRun(), "Wait graph run failed.");
+        RETURN_IF_FALSE_WITH_LOG(WaitGraphRun(graph_running_step), "Wait graph run failed.");
         continue;
       }
-      host_to_device_index[statistics_info_.host_to_device_size_ - 1] = index;
-      server_to_host_index[statistics_info_.server_to_host_size_] = index;
-      server_to_host_ids[statistics_info_.server_to_host_size_++] = id;
+      host_to_device_index[swap_info->host_to_device_size_ - 1] = index;
+      server_to_host_index[swap_info->server_to_host_size_] = index;
+      server_to_host_ids[swap_info->server_to_host_size_++] = id;
       break;
     }
   }
@@ -707,38 +906,35 @@ bool EmbeddingCachePrefetchActor::ParseHostDataHostToDevice(int id) {
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::ParseHostDataDeviceToHost() {
-  MS_ERROR_IF_NULL(embedding_device_cache_);
+bool EmbeddingCachePrefetchActor::ParseHostDataDeviceToHost(EmbeddingCacheSwapInfo *swap_info) {
+  MS_ERROR_IF_NULL(swap_info);
   MS_ERROR_IF_NULL(embedding_host_cache_);
-  int *device_to_host_ids = embedding_device_cache_->device_to_host_ids.get();
-  int *device_to_host_index = embedding_host_cache_->device_to_host_index.get();
+  int64_t *device_to_host_ids = swap_info->device_to_host_ids_;
+  int *device_to_host_index = swap_info->host_cache_device_to_host_index_;
   MS_ERROR_IF_NULL(device_to_host_ids);
   MS_ERROR_IF_NULL(device_to_host_index);
 
   auto &host_hash_map = embedding_host_cache_->host_hash_map_;
   MS_ERROR_IF_NULL(host_hash_map);
-  int swap_device_to_host_id = device_to_host_ids[statistics_info_.device_to_host_size_ - 1];
-  const auto &hash_id_to_index = host_hash_map->hash_id_to_index();
-  const auto &iter = hash_id_to_index.find(swap_device_to_host_id);
-  if (iter != hash_id_to_index.end()) {
-    auto index = iter->second;
+  int64_t swap_device_to_host_id = device_to_host_ids[swap_info->device_to_host_size_ - 1];
+  auto index = host_hash_map->GetIndex(swap_device_to_host_id);
+  if (index != INVALID_INDEX_VALUE) {
     if (host_hash_map->hash_step(index) != data_step_) {
       host_hash_map->set_hash_step(index, data_step_);
     }
-    device_to_host_index[statistics_info_.device_to_host_size_ - 1] = index;
+    device_to_host_index[swap_info->device_to_host_size_ - 1] = index;
   } else {
-    int *host_to_server_index = embedding_host_cache_->host_to_server_index.get();
-    int *host_to_server_ids = embedding_host_cache_->host_to_server_ids.get();
     while (true) {
       // Calculate the mapping of id to index.
-      auto index = host_hash_map->ParseData(swap_device_to_host_id, host_to_server_index, host_to_server_ids,
-                                            data_step_, graph_running_step_, &statistics_info_.host_to_server_size_,
-                                            &host_cache_need_wait_graph_);
+      size_t graph_running_step = graph_running_step_;
+      index = host_hash_map->ParseData(swap_device_to_host_id, swap_info->host_to_server_index_,
+                                       swap_info->host_to_server_ids_, data_step_, graph_running_step,
+                                       &(swap_info->host_to_server_size_), &(swap_info->host_cache_need_wait_graph_));
       if (index == INVALID_INDEX_VALUE) {
-        RETURN_IF_FALSE_WITH_LOG(WaitGraphRun(), "Wait graph run");
+        RETURN_IF_FALSE_WITH_LOG(WaitGraphRun(graph_running_step), "Wait graph run");
         continue;
       }
-      device_to_host_index[statistics_info_.device_to_host_size_ - 1] = index;
+      device_to_host_index[swap_info->device_to_host_size_ - 1] = index;
       break;
     }
   }
@@ -746,36 +942,41 @@ bool EmbeddingCachePrefetchActor::ParseHostDataDeviceToHost() {
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRangeFunc(const int *batch_ids, const size_t batch_ids_num,
+bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRangeFunc(const int64_t *batch_ids, const size_t batch_ids_num,
                                                               int *hash_index, bool *in_device, bool *out_range,
-                                                              size_t *hash_hit_count) {
+                                                              size_t *hash_hit_count, std::vector<int> *hit_indices) {
   MS_ERROR_IF_NULL(batch_ids);
   MS_ERROR_IF_NULL(hash_index);
   MS_ERROR_IF_NULL(in_device);
   MS_ERROR_IF_NULL(out_range);
   MS_ERROR_IF_NULL(hash_hit_count);
+  MS_ERROR_IF_NULL(hit_indices);
   MS_ERROR_IF_NULL(embedding_device_cache_);
   auto &device_hash_map = embedding_device_cache_->device_hash_map_;
   MS_ERROR_IF_NULL(device_hash_map);
-  const auto &hash_id_to_index = device_hash_map->hash_id_to_index();
+  bool need_record_access = device_hash_map->policy_type() != distributed::EmbeddingCachePolicyType::kStepExpiry;
 
   for (size_t i = 0; i < batch_ids_num; ++i) {
     if (batch_ids[i] < local_embedding_slice_bounds_.first) {
-      hash_index[i] = batch_ids[i] - local_embedding_slice_bounds_.first + local_device_cache_bounds_.first;
+      hash_index[i] =
+        SaturateToInt(batch_ids[i] - local_embedding_slice_bounds_.first + local_device_cache_bounds_.first);
       out_range[i] = true;
       continue;
     }
     if (batch_ids[i] >= local_embedding_slice_bounds_.second) {
-      hash_index[i] = batch_ids[i] + local_device_cache_bounds_.second;
+      hash_index[i] = SaturateToInt(batch_ids[i] + local_device_cache_bounds_.second);
       out_range[i] = true;
       continue;
     }
-    auto iter = hash_id_to_index.find(batch_ids[i]);
-    if (iter != hash_id_to_index.end()) {
-      hash_index[i] = iter->second + local_device_cache_bounds_.first;
-      if (device_hash_map->hash_step(iter->second) != data_step_) {
+    auto index = device_hash_map->GetIndex(batch_ids[i]);
+    if (index != INVALID_INDEX_VALUE) {
+      hash_index[i] = index + local_device_cache_bounds_.first;
+      if (device_hash_map->hash_step(index) != data_step_) {
         ++(*hash_hit_count);
-        device_hash_map->set_hash_step(iter->second, data_step_);
+        device_hash_map->set_hash_step(index, data_step_);
+        if (need_record_access) {
+          hit_indices->push_back(index);
+        }
       }
       in_device[i] = true;
     }
@@ -783,7 +984,7 @@ bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRangeFunc(const int *batch_i
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int *batch_ids, const size_t batch_ids_num,
+bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int64_t *batch_ids, const size_t batch_ids_num,
                                                           int *hash_index, bool *in_device, bool *out_range) {
   MS_ERROR_IF_NULL(batch_ids);
   MS_ERROR_IF_NULL(hash_index);
@@ -794,6 +995,7 @@ bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int *batch_ids,
   thread_num = thread_num > kMaxThreadNum ? kMaxThreadNum : thread_num;
   std::thread threads[kMaxThreadNum];
   size_t hash_hit_count[kMaxThreadNum] = {0};
+  std::vector<int> hit_indices[kMaxThreadNum];
   size_t i = 0;
   size_t offset = 0;
 
@@ -803,7 +1005,8 @@ bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int *batch_ids,
     }
     size_t proc_len = batch_ids_num / thread_num + (i < (batch_ids_num % thread_num) ? 1 : 0);
     threads[i] = std::thread(&EmbeddingCachePrefetchActor::CheckCacheHitOrOutRangeFunc, this, batch_ids + offset,
-                             proc_len, hash_index + offset, in_device + offset, out_range + offset, hash_hit_count + i);
+                             proc_len, hash_index + offset, in_device + offset, out_range + offset, hash_hit_count + i,
+                             hit_indices + i);
     offset += proc_len;
   }
   if (offset != batch_ids_num) {
@@ -816,6 +1019,15 @@ bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int *batch_ids,
   for (size_t j = 0; j < i; j++) {
     statistics_info_.hash_hit_count_ += hash_hit_count[j];
   }
+  // The eviction policy is not thread safe, so the accesses are recorded after the parallel checking.
+  MS_ERROR_IF_NULL(embedding_device_cache_);
+  const auto &device_hash_map = embedding_device_cache_->device_hash_map_;
+  MS_ERROR_IF_NULL(device_hash_map);
+  for (size_t j = 0; j < i; j++) {
+    for (auto index : hit_indices[j]) {
+      device_hash_map->RecordAccess(index);
+    }
+  }
   return true;
 }
 
@@ -833,9 +1045,13 @@ bool EmbeddingCachePrefetchActor::ResetEmbeddingHashMap() {
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::WaitGraphRun() {
-  MS_LOG(INFO) << "Hash table has no space to insert new data and retries within 2 minutes.";
+bool EmbeddingCachePrefetchActor::WaitGraphRun(size_t graph_running_step) {
   std::unique_lock<std::mutex> locker(data_mutex_);
+  // Another parsing thread has waited the computed graph, retry with the new graph running step.
+  if (graph_running_step != graph_running_step_) {
+    return true;
+  }
+  MS_LOG(INFO) << "Hash table has no space to insert new data and retries within 2 minutes.";
   const int64_t longest_time_to_wait = 120;
   if (!data_parser_.wait_for(locker, std::chrono::seconds(longest_time_to_wait),
                              [this] { return graph_step_ > graph_running_step_; })) {
@@ -853,14 +1069,85 @@ bool EmbeddingCachePrefetchActor::WaitGraphRun() {
 bool EmbeddingCachePrefetchActor::UpdateCache() {
   for (const auto &item : hash_tables_) {
     auto hash_info = item.second;
+    if (hash_info.embedding_store != nullptr) {
+      RETURN_IF_FALSE_WITH_LOG(UpdateLocalHostCacheWithStorage(hash_info),
+                               "Update local host cache with local storage failed.");
+      continue;
+    }
     RETURN_IF_FALSE_WITH_LOG(PushCacheFromLocalHostToRemote(hash_info), "Push cache from local host to remote failed.");
     RETURN_IF_FALSE_WITH_LOG(PushCacheFromDeviceToLocalHost(hash_info), "Push cache from device to local host failed.");
     RETURN_IF_FALSE_WITH_LOG(PullCacheFromRemoteToLocalHost(hash_info), "Pull cache from remote to local host failed.");
-    RETURN_IF_FALSE_WITH_LOG(PullCacheFromLocalHostToDevice(hash_info), "Pull cache from local host to device failed.");
+  }
+
+  // The var, m and v of a row are in different tables, so the missed steps are applied after the rows to swap into the
+  // device cache are ready in the local host cache of all the tables.
+  if (embedding_host_optimizer_ != nullptr) {
+    MS_ERROR_IF_NULL(embedding_device_cache_);
+    MS_ERROR_IF_NULL(embedding_host_cache_);
+    embedding_host_optimizer_->RecordSwapOut(embedding_device_cache_->device_to_host_ids.get(),
+                                             statistics_info_.device_to_host_size_, data_step_);
+    RETURN_IF_FALSE_WITH_LOG(
+      embedding_host_optimizer_->ApplyMissedSteps(embedding_device_cache_->host_to_device_ids.get(),
+                                                  embedding_host_cache_->host_to_device_index.get(),
+                                                  statistics_info_.host_to_device_size_, data_step_),
+      "Apply the missed steps of host optimizer failed.");
+  }
+
+  for (const auto &item : hash_tables_) {
+    RETURN_IF_FALSE_WITH_LOG(PullCacheFromLocalHostToDevice(item.second),
+                             "Pull cache from local host to device failed.");
   }
   return true;
 }
 
+bool EmbeddingCachePrefetchActor::UpdateLocalHostCacheWithStorage(const HashTableInfo &hash_info) {
+  const auto &embedding_store = hash_info.embedding_store;
+  MS_ERROR_IF_NULL(embedding_store);
+  MS_ERROR_IF_NULL(embedding_host_cache_);
+  auto server_to_host_ids = embedding_host_cache_->server_to_host_ids.get();
+  MS_ERROR_IF_NULL(server_to_host_ids);
+  auto page_in_size = statistics_info_.server_to_host_size_;
+  std::vector<float> page_in_data(page_in_size * hash_info.embedding_size, 0);
+  auto in_storage = std::make_unique<bool[]>(page_in_size);
+
+  // The ids swapped out from and into the local host cache are disjoint, so the page-in from local storage can overlap
+  // with the swapping out of local host cache and the swapping between device and local host cache.
+  auto page_in = std::async(std::launch::async, [&]() {
+    return page_in_size == 0 ||
+           embedding_store->Get(server_to_host_ids, page_in_size, page_in_data.data(), in_storage.get());
+  });
+  RETURN_IF_FALSE_WITH_LOG(PushCacheFromLocalHostToStorage(hash_info), "Push cache from local host to storage failed.");
+  RETURN_IF_FALSE_WITH_LOG(PushCacheFromDeviceToLocalHost(hash_info), "Push cache from device to local host failed.");
+  RETURN_IF_FALSE_WITH_LOG(page_in.get(), "Page in embeddings from local storage failed.");
+  RETURN_IF_FALSE_WITH_LOG(PullCacheFromStorageToLocalHost(hash_info, in_storage.get(), page_in_data.data()),
+                           "Pull cache from storage to local host failed.");
+  return true;
+}
+
+bool EmbeddingCachePrefetchActor::PushCacheFromLocalHostToStorage(const HashTableInfo &hash_info) {
+  auto swap_indices_size = statistics_info_.host_to_server_size_;
+  if (swap_indices_size == 0) {
+    return true;
+  }
+
+  MS_ERROR_IF_NULL(embedding_host_cache_);
+  MS_ERROR_IF_NULL(hash_info.embedding_store);
+  auto host_to_server_ids = embedding_host_cache_->host_to_server_ids.get();
+  MS_ERROR_IF_NULL(host_to_server_ids);
+  auto host_to_server_index = embedding_host_cache_->host_to_server_index.get();
+  MS_ERROR_IF_NULL(host_to_server_index);
+
+  auto embedding_size = hash_info.embedding_size;
+  std::vector<float> swap_out_data(swap_indices_size * embedding_size);
+  auto host_hash_table_addr = reinterpret_cast<float *>(hash_info.host_address.get());
+  RETURN_IF_FALSE_WITH_LOG(LookupLocalHostCache(embedding_size, swap_indices_size, host_hash_table_addr,
+                                                host_to_server_index, swap_out_data.data()),
+                           "Lookup local host cache failed.");
+  RETURN_IF_FALSE_WITH_LOG(hash_info.embedding_store->Put(host_to_server_ids, swap_indices_size, swap_out_data.data()),
+                           "Put embeddings to local storage failed.");
+  return true;
+}
+
 bool EmbeddingCachePrefetchActor::PushCacheFromLocalHostToRemote(const HashTableInfo &hash_info) {
   auto swap_indices_size = statistics_info_.host_to_server_size_;
   if (swap_indices_size == 0) {
@@ -957,6 +1244,50 @@ bool EmbeddingCachePrefetchActor::PullCacheFromRemoteToLocalHost(const HashTable
   return true;
 }
 
+bool EmbeddingCachePrefetchActor::PullCacheFromStorageToLocalHost(const HashTableInfo &hash_info,
+                                                                  const bool *in_storage, float *page_in_data) {
+  auto swap_indices_size = statistics_info_.server_to_host_size_;
+  if (swap_indices_size == 0) {
+    return true;
+  }
+
+  MS_ERROR_IF_NULL(in_storage);
+  MS_ERROR_IF_NULL(page_in_data);
+  MS_ERROR_IF_NULL(embedding_host_cache_);
+  auto server_to_host_ids = embedding_host_cache_->server_to_host_ids.get();
+  MS_ERROR_IF_NULL(server_to_host_ids);
+  auto server_to_host_index = embedding_host_cache_->server_to_host_index.get();
+  MS_ERROR_IF_NULL(server_to_host_index);
+  auto host_hash_table_addr = reinterpret_cast<float *>(hash_info.host_address.get());
+  MS_ERROR_IF_NULL(host_hash_table_addr);
+  auto embedding_size = hash_info.embedding_size;
+
+  // The ids which have never been swapped out from local host cache are pulled from remote.
+  std::vector<int64_t> remote_ids;
+  std::vector<size_t> remote_positions;
+  for (size_t i = 0; i < swap_indices_size; ++i) {
+    if (!in_storage[i]) {
+      remote_ids.push_back(server_to_host_ids[i]);
+      remote_positions.push_back(i);
+    }
+  }
+  if (!remote_ids.empty()) {
+    std::vector<float> lookup_result(remote_ids.size() * embedding_size, 0);
+    RETURN_IF_FALSE_WITH_LOG(
+      PullEembeddingsFromRemote(hash_info.param_key_, remote_ids.data(), remote_ids.size(), &lookup_result),
+      "Pull embedding from remote failed.");
+    for (size_t i = 0; i < remote_positions.size(); ++i) {
+      (void)std::copy_n(lookup_result.data() + i * embedding_size, embedding_size,
+                        page_in_data + remote_positions[i] * embedding_size);
+    }
+  }
+
+  RETURN_IF_FALSE_WITH_LOG(InsertLocalHostCache(embedding_size, IntToSize(swap_indices_size), server_to_host_index,
+                                                page_in_data, host_hash_table_addr),
+                           "Insert local host cache failed.");
+  return true;
+}
+
 bool EmbeddingCachePrefetchActor::PullCacheFromLocalHostToDevice(const HashTableInfo &hash_info) {
   auto swap_indices_size = statistics_info_.host_to_device_size_;
   if (swap_indices_size == 0) {
@@ -1118,7 +1449,7 @@ bool EmbeddingCachePrefetchActor::LookupLocalHostCache(size_t embedding_size, si
   return running_;
 }
 
-bool EmbeddingCachePrefetchActor::PullEembeddingsFromRemote(int32_t param_key, const int *ids, size_t ids_num,
+bool EmbeddingCachePrefetchActor::PullEembeddingsFromRemote(int32_t param_key, const int64_t *ids, size_t ids_num,
                                                             std::vector<float> *outputs) {
   MS_ERROR_IF_NULL(ids);
   MS_ERROR_IF_NULL(outputs);
@@ -1171,7 +1502,7 @@ bool EmbeddingCachePrefetchActor::PullEembeddingsFromRemote(int32_t param_key, c
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::PushEmbeddingsToRemote(int32_t param_key, const int *ids, size_t ids_num,
+bool EmbeddingCachePrefetchActor::PushEmbeddingsToRemote(int32_t param_key, const int64_t *ids, size_t ids_num,
                                                          const float *embeddings, size_t embeddings_len) {
   MS_ERROR_IF_NULL(ids);
   MS_ERROR_IF_NULL(embeddings);
@@ -1218,33 +1549,38 @@ void EmbeddingCachePrefetchActor::GetRemoteEmbeddingSliceBound() {
     remote_embedding_slice_sizes[i] += 1;
   }
 
-  size_t begin;
-  size_t end;
+  int64_t begin;
+  int64_t end;
   for (size_t i = 0; i < server_num_; i++) {
+    if (remote_embedding_slice_sizes[i] > static_cast<size_t>(std::numeric_limits<int>::max())) {
+      MS_LOG(EXCEPTION) << "The embedding table slice size on server: " << remote_embedding_slice_sizes[i]
+                        << " exceeds the maximum value of int32, please increase the server number.";
+    }
     if (i == 0) {
       begin = 0;
-      end = remote_embedding_slice_sizes[0] - 1;
+      end = SizeToLong(remote_embedding_slice_sizes[0]) - 1;
     } else {
       begin = remote_embedding_slice_bounds_[i - 1].second + 1;
-      end = begin + remote_embedding_slice_sizes[i] - 1;
+      end = begin + SizeToLong(remote_embedding_slice_sizes[i]) - 1;
     }
     (void)remote_embedding_slice_bounds_.emplace_back(begin, end);
   }
 }
 
-bool EmbeddingCachePrefetchActor::PartitionIds(const int *ids, size_t ids_num,
+bool EmbeddingCachePrefetchActor::PartitionIds(const int64_t *ids, size_t ids_num,
                                                std::vector<std::vector<int>> *slice_ids_list) {
   MS_ERROR_IF_NULL(ids);
   MS_ERROR_IF_NULL(slice_ids_list);
 
   for (size_t i = 0; i < slice_ids_list->size(); i++) {
-    int begin = SizeToInt(remote_embedding_slice_bounds_[i].first);
-    int end = SizeToInt(remote_embedding_slice_bounds_[i].second);
+    int64_t begin = remote_embedding_slice_bounds_[i].first;
+    int64_t end = remote_embedding_slice_bounds_[i].second;
 
+    // The size of embedding table slice on server does not exceed int32, so do the ids minus begin.
     mindspore::HashSet<int> unique_ids;
-    (void)std::for_each(ids, ids + ids_num, [&](int id) {
+    (void)std::for_each(ids, ids + ids_num, [&](int64_t id) {
       if (id >= begin && id <= end) {
-        (void)unique_ids.insert(id);
+        (void)unique_ids.insert(static_cast<int>(id - begin));
       }
     });
 
@@ -1255,7 +1591,8 @@ bool EmbeddingCachePrefetchActor::PartitionIds(const int *ids, size_t ids_num,
   return true;
 }
 
-bool EmbeddingCachePrefetchActor::PartitionIdsAndEmbeddings(const int *ids, size_t ids_num, const float *embeddings,
+bool EmbeddingCachePrefetchActor::PartitionIdsAndEmbeddings(const int64_t *ids, size_t ids_num,
+                                                            const float *embeddings,
                                                             size_t embeddings_len,
                                                             std::vector<std::vector<int>> *slice_ids_list,
                                                             std::vector<std::vector<float>> *slice_embeddings_list) {
@@ -1272,16 +1609,16 @@ bool EmbeddingCachePrefetchActor::PartitionIdsAndEmbeddings(const int *ids, size
   size_t embedding_dim = (embeddings_len / ids_num) / sizeof(float);
   size_t partition_num = slice_ids_list->size();
   for (size_t i = 0; i < partition_num; i++) {
-    int begin = SizeToInt(remote_embedding_slice_bounds_[i].first);
-    int end = SizeToInt(remote_embedding_slice_bounds_[i].second);
+    int64_t begin = remote_embedding_slice_bounds_[i].first;
+    int64_t end = remote_embedding_slice_bounds_[i].second;
 
     std::vector<int> &slice_ids = slice_ids_list->at(i);
     std::vector<float> &slice_embeddings = slice_embeddings_list->at(i);
     // Ids range offset for multi server.
-    int offset = SizeToInt(remote_embedding_slice_bounds_.at(i).first);
+    int64_t offset = remote_embedding_slice_bounds_.at(i).first;
     for (size_t j = 0; j < ids_num; j++) {
       if (ids[j] >= begin && ids[j] <= end) {
-        slice_ids.push_back(ids[j] - offset);
+        slice_ids.push_back(static_cast<int>(ids[j] - offset));
         (void)slice_embeddings.insert(slice_embeddings.end(), embeddings + (j * embedding_dim),
                                       embeddings + (j * embedding_dim) + embedding_dim);
       }
@@ -1353,7 +1690,7 @@ std::unique_ptr<std::vector<char>> EmbeddingCachePrefetchActor::ReceiveFromRemot
 }
 
 bool EmbeddingCachePrefetchActor::RetrieveEmbeddings(
-  const int *ids, size_t ids_num, const std::vector<std::vector<int>> &slice_ids_list,
+  const int64_t *ids, size_t ids_num, const std::vector<std::vector<int>> &slice_ids_list,
   const std::vector<std::unique_ptr<std::vector<char>>> &slice_embeddings_list, std::vector<float> *outputs) const {
   MS_ERROR_IF_NULL(ids);
   MS_ERROR_IF_NULL(outputs);
@@ -1364,7 +1701,7 @@ bool EmbeddingCachePrefetchActor::RetrieveEmbeddings(
   }
 
   // Merge all slice ids and embedding data address into ids_to_addrs map.
-  mindspore::HashMap<int, const float *> ids_to_addrs;
+  mindspore::HashMap<int64_t, const float *> ids_to_addrs;
   size_t embedding_dim = outputs->size() / ids_num;
   size_t offset = 0;
   for (size_t i = 0; i < slice_ids_list.size(); i++) {
@@ -1375,8 +1712,10 @@ bool EmbeddingCachePrefetchActor::RetrieveEmbeddings(
     const std::unique_ptr<std::vector<char>> &slice_embeddings = slice_embeddings_list[i];
     MS_ERROR_IF_NULL(slice_embeddings);
     const float *embeddings_data = reinterpret_cast<float *>(slice_embeddings->data());
+    // The slice ids are the ids minus the begin of embedding table slice on the server.
+    int64_t slice_begin = remote_embedding_slice_bounds_[i].first;
     for (size_t j = 0; j < slice_ids.size(); j++) {
-      (void)ids_to_addrs.emplace(slice_ids[j], embeddings_data + offset);
+      (void)ids_to_addrs.emplace(slice_ids[j] + slice_begin, embeddings_data + offset);
       offset += embedding_dim;
     }
     offset = 0;
@@ -1419,6 +1758,11 @@ void EmbeddingCachePrefetchActor::SyncEmbeddingTable() {
   if (!initialized_) {
     return;
   }
+  // The embeddings in local storage are older than the ones in local host cache, and the ones in local host cache are
+  // older than the ones in device cache, so they are synchronized in this order.
+  if (!SyncStorageEmbeddingTable()) {
+    MS_LOG(ERROR) << "SyncStorageEmbeddingTable failed.";
+  }
   if (!SyncHostEmbeddingTable()) {
     MS_LOG(ERROR) << "SyncHostEmbeddingTable failed.";
   }
@@ -1428,23 +1772,54 @@ void EmbeddingCachePrefetchActor::SyncEmbeddingTable() {
   finish_sync_embedding_table_ = true;
 }
 
+bool EmbeddingCachePrefetchActor::SyncStorageEmbeddingTable() {
+  for (const auto &item : hash_tables_) {
+    const auto &hash_info = item.second;
+    const auto &embedding_store = hash_info.embedding_store;
+    if (embedding_store == nullptr) {
+      continue;
+    }
+    auto ids = embedding_store->GetAllIds();
+    auto embedding_size = hash_info.embedding_size;
+    // Push the embeddings in batches to limit the memory used.
+    for (size_t offset = 0; offset < ids.size(); offset += kMaxSyncStorageIdsNum) {
+      auto ids_num = std::min(kMaxSyncStorageIdsNum, ids.size() - offset);
+      std::vector<float> swap_out_data(ids_num * embedding_size);
+      auto found = std::make_unique<bool[]>(ids_num);
+      RETURN_IF_FALSE_WITH_LOG(embedding_store->Get(ids.data() + offset, ids_num, swap_out_data.data(), found.get()),
+                               "Get embeddings from local storage failed.");
+      RETURN_IF_FALSE_WITH_LOG(PushEmbeddingsToRemote(hash_info.param_key_, ids.data() + offset, ids_num,
+                                                      swap_out_data.data(), swap_out_data.size() * sizeof(float)),
+                               "Push embeddings to remote failed.");
+    }
+  }
+  return true;
+}
+
 bool EmbeddingCachePrefetchActor::SyncHostEmbeddingTable() {
   MS_ERROR_IF_NULL(embedding_host_cache_);
   MS_ERROR_IF_NULL(embedding_host_cache_->host_hash_map_);
-  const auto &hash_id_to_index = embedding_host_cache_->host_hash_map_->hash_id_to_index();
-  size_t swap_indices_lens = hash_id_to_index.size();
+  const auto &host_hash_map = embedding_host_cache_->host_hash_map_;
+  size_t swap_indices_lens = host_hash_map->id_num();
   if (swap_indices_lens == 0) {
     return true;
   }
 
-  std::unique_ptr<int[]> host_to_server_ids_ptr = std::make_unique<int[]>(swap_indices_lens);
+  std::unique_ptr<int64_t[]> host_to_server_ids_ptr = std::make_unique<int64_t[]>(swap_indices_lens);
   MS_ERROR_IF_NULL(host_to_server_ids_ptr);
   std::unique_ptr<int[]> host_to_server_indices_ptr = std::make_unique<int[]>(swap_indices_lens);
   MS_ERROR_IF_NULL(host_to_server_indices_ptr);
   size_t idx = 0;
-  for (const auto &item : hash_id_to_index) {
-    host_to_server_ids_ptr[idx] = item.first;
-    host_to_server_indices_ptr[idx++] = item.second;
+  host_hash_map->ForEach([&host_to_server_ids_ptr, &host_to_server_indices_ptr, &idx](int64_t id, int index) {
+    host_to_server_ids_ptr[idx] = id;
+    host_to_server_indices_ptr[idx++] = index;
+  });
+  // The rows in the local host cache also catch up the steps missed until the end of training.
+  if (embedding_host_optimizer_ != nullptr) {
+    RETURN_IF_FALSE_WITH_LOG(
+      embedding_host_optimizer_->ApplyMissedSteps(host_to_server_ids_ptr.get(), host_to_server_indices_ptr.get(),
+                                                  swap_indices_lens, data_step_ + 1),
+      "Apply the missed steps of host optimizer failed.");
   }
   for (const auto &item : hash_tables_) {
     const auto &hash_info = item.second;
@@ -1468,22 +1843,21 @@ bool EmbeddingCachePrefetchActor::SyncDeviceEmbeddingTable() {
   MS_ERROR_IF_NULL(embedding_device_cache_);
   const auto &device_hash_map = embedding_device_cache_->device_hash_map_;
   MS_ERROR_IF_NULL(device_hash_map);
-  const auto &hash_id_to_index = device_hash_map->hash_id_to_index();
-  size_t swap_indices_lens = hash_id_to_index.size();
+  size_t swap_indices_lens = device_hash_map->id_num();
   if (swap_indices_lens == 0) {
     return true;
   }
   MS_ERROR_IF_NULL(device_context_);
   MS_ERROR_IF_NULL(device_context_->device_res_manager_);
-  std::unique_ptr<int[]> device_to_server_ids_ptr = std::make_unique<int[]>(swap_indices_lens);
+  std::unique_ptr<int64_t[]> device_to_server_ids_ptr = std::make_unique<int64_t[]>(swap_indices_lens);
   MS_ERROR_IF_NULL(device_to_server_ids_ptr);
   std::unique_ptr<int[]> device_to_server_indices_ptr = std::make_unique<int[]>(swap_indices_lens);
   MS_ERROR_IF_NULL(device_to_server_indices_ptr);
   size_t idx = 0;
-  for (const auto &item : hash_id_to_index) {
-    device_to_server_ids_ptr[idx] = item.first;
-    device_to_server_indices_ptr[idx++] = item.second;
-  }
+  device_hash_map->ForEach([&device_to_server_ids_ptr, &device_to_server_indices_ptr, &idx](int64_t id, int index) {
+    device_to_server_ids_ptr[idx] = id;
+    device_to_server_indices_ptr[idx++] = index;
+  });
   for (const auto &item : hash_tables_) {
     const auto &hash_info = item.second;
     std::vector<float> swap_out_data;
@@ -1657,7 +2031,7 @@ Sender::~Sender() {
 }
 
 bool Sender::ConnectServer() {
-  client_ = std::make_unique<TCPClient>();
+  client_ = distributed::rpc::CreateRPCClient();
   MS_ERROR_IF_NULL(client_);
   if (!client_->Initialize()) {
     MS_LOG(ERROR) << "Failed to initialize tcp server for send actor.";
@@ -1760,7 +2134,7 @@ std::unique_ptr<std::vector<char>> Receiver::Receive() {
 
 bool Receiver::StartServer() {
   // 1. Create a tcp server and start listening.
-  server_ = std::make_unique<TCPServer>();
+  server_ = distributed::rpc::CreateRPCServer();
   MS_EXCEPTION_IF_NULL(server_);
   if (!server_->Initialize()) {
     MS_LOG(EXCEPTION) << "Failed to initialize tcp server for recv actor";
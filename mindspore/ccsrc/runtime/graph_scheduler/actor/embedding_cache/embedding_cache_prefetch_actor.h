@@ -27,8 +27,7 @@
 #include "ir/anf.h"
 #include "backend/common/session/kernel_graph.h"
 #include "distributed/cluster/cluster_context.h"
-#include "distributed/rpc/tcp/tcp_client.h"
-#include "distributed/rpc/tcp/tcp_server.h"
+#include "distributed/rpc/rpc_transport.h"
 #include "utils/hash_map.h"
 #include "distributed/embedding_cache/embedding_cache_utils.h"
 
@@ -55,14 +54,48 @@ using SendRecvPairList = std::vector<SendRecvPair>;
 using distributed::EmbeddingCacheStatisticsInfo;
 using distributed::EmbeddingDeviceCache;
 using distributed::EmbeddingHostCache;
+using distributed::EmbeddingHostOptimizer;
 using distributed::HashTableInfo;
 using distributed::INVALID_INDEX_VALUE;
 using distributed::INVALID_STEP_VALUE;
 
 using distributed::cluster::ActorRouteTableProxy;
 using distributed::cluster::ActorRouteTableProxyPtr;
-using distributed::rpc::TCPClient;
-using distributed::rpc::TCPServer;
+using distributed::rpc::RPCClientBase;
+using distributed::rpc::RPCServerBase;
+
+// The swap information of the device and local host cache, which is produced by parsing the cache miss ids. The ids of
+// different hash map shards are parsed by different threads, and each thread records the swap information to its own
+// buffers.
+struct EmbeddingCacheSwapInfo {
+  // The device cache indices and ids which are swapped out from device cache to local host cache, and the local host
+  // cache indices to store them.
+  int *device_to_host_index_{nullptr};
+  int64_t *device_to_host_ids_{nullptr};
+  int *host_cache_device_to_host_index_{nullptr};
+  size_t device_to_host_size_{0};
+
+  // The device cache indices and ids which are swapped in from local host cache to device cache, and the local host
+  // cache indices to load them.
+  int *host_to_device_index_{nullptr};
+  int64_t *host_to_device_ids_{nullptr};
+  int *host_cache_host_to_device_index_{nullptr};
+  size_t host_to_device_size_{0};
+
+  // The local host cache indices and ids which are swapped out from local host cache to remote.
+  int *host_to_server_index_{nullptr};
+  int64_t *host_to_server_ids_{nullptr};
+  size_t host_to_server_size_{0};
+
+  // The local host cache indices and ids which are swapped in from remote to local host cache.
+  int *server_to_host_index_{nullptr};
+  int64_t *server_to_host_ids_{nullptr};
+  size_t server_to_host_size_{0};
+
+  size_t hash_hit_count_{0};
+  bool device_cache_need_wait_graph_{false};
+  bool host_cache_need_wait_graph_{false};
+};
 
 // The EmbeddingCachePrefetchActor is used to cache large embedding table scenarios. The cache level is: Device
 // Cache->Local Host Cache->Remote Cache. This Actor is used to perform Local and Device Cache hit analysis and cache
@@ -99,48 +132,74 @@ class EmbeddingCachePrefetchActor : public ActorBase {
 
   // Analyze the hit/miss info of the local host cache and device cache, and calculate the swapping and
   // mapping information of the missing feature id that needs to be inserted into the cache.
-  bool CountCacheMissIds(const int *batch_ids, const size_t batch_ids_len, int *hash_index);
+  bool CountCacheMissIds(const int64_t *batch_ids, const size_t batch_ids_len, int *hash_index);
 
   // Increase the current global step of cache prefetching operation.
   bool IncreaseStep();
 
   // Wait the computed graph finish current step when there is not enough free memory space in the cache, in order to
   // delete the feature vector used by the current step from the cache.
-  bool WaitGraphRun();
+  bool WaitGraphRun() { return WaitGraphRun(graph_running_step_); }
+  // The parameter 'graph_running_step' is the graph running step used to parse the ids, and the waiting is skipped if
+  // the graph running step has been updated by another parsing thread.
+  bool WaitGraphRun(size_t graph_running_step);
+
+  // Parse the swapping and mapping information of the cache miss ids at 'miss_positions' of the batch ids, all the
+  // ids belong to the same shard of the hash maps.
+  bool ParseCacheMissIds(const int64_t *batch_ids, const std::vector<size_t> &miss_positions, int *hash_index,
+                         EmbeddingCacheSwapInfo *swap_info);
+  // Parse the cache miss ids of different hash map shards by multiple threads and merge the swap information.
+  bool ParseCacheMissIdsInParallel(const int64_t *batch_ids, const std::vector<std::vector<size_t>> &miss_positions,
+                                   int *hash_index);
+  // Append the swap information parsed by one thread to the swap information of the device and local host cache.
+  void MergeSwapInfo(const EmbeddingCacheSwapInfo &swap_info);
+  // Accumulate the sizes of the swap information to the cache statistics info.
+  void UpdateStatisticsInfo(const EmbeddingCacheSwapInfo &swap_info);
 
   // Parse the hit and swap information of the currently preprocessed id in the device cache.
-  bool ParseDeviceData(int id, bool *need_swap_device_to_host, bool *need_swap_host_to_device, int *hash_index);
+  bool ParseDeviceData(int64_t id, bool *need_swap_device_to_host, bool *need_swap_host_to_device, int *hash_index,
+                       EmbeddingCacheSwapInfo *swap_info);
   // Parse the hit and swap out to device cache information of the currently preprocessed id of the local host cache.
-  bool ParseHostDataHostToDevice(int id);
+  bool ParseHostDataHostToDevice(int64_t id, EmbeddingCacheSwapInfo *swap_info);
   // Parse the swap in information from device cache of the currently preprocessed id of the local host cache.
-  bool ParseHostDataDeviceToHost();
+  bool ParseHostDataDeviceToHost(EmbeddingCacheSwapInfo *swap_info);
 
   // Batch preprocess the current batch ids information of cache hitting or exceeding the range of the embedding table
   // slice corresponding to the process.
-  bool CheckCacheHitOrOutRange(const int *batch_ids, const size_t batch_ids_len, int *hash_index, bool *in_device,
+  bool CheckCacheHitOrOutRange(const int64_t *batch_ids, const size_t batch_ids_len, int *hash_index, bool *in_device,
                                bool *out_range);
   // Thread execution function of method 'CheckCacheHitOrOutRange'.
-  bool CheckCacheHitOrOutRangeFunc(const int *batch_ids, const size_t batch_ids_len, int *hash_index, bool *in_device,
-                                   bool *out_range, size_t *hash_hit_count);
+  bool CheckCacheHitOrOutRangeFunc(const int64_t *batch_ids, const size_t batch_ids_len, int *hash_index,
+                                   bool *in_device, bool *out_range, size_t *hash_hit_count,
+                                   std::vector<int> *hit_indices);
 
   // Reset EmbeddingHashMap for device and local host cache.
   bool ResetEmbeddingHashMap();
 
   // Update the current computed graph's step to real global step at the time when this actor starts to prefetch cache
   // for a batch ids.
-  void set_current_graph_step() { graph_running_step_ = graph_step_; }
+  void set_current_graph_step() { graph_running_step_ = graph_step_.load(); }
 
   // When the device cache does not reach 100% hit, the cache needs to be updated, which involves cache insertion and
   // deletion. That is, push the non-hotspot embeddings on the local side to the remote, and pull the missing embeddings
   // on the local side from the remote.
   bool UpdateCache();
 
+  // Update the local host cache of the embedding table with the local storage tier below it, the embeddings missing on
+  // local host cache are paged in from the local storage asynchronously.
+  bool UpdateLocalHostCacheWithStorage(const HashTableInfo &hash_info);
+
   // Push non-hotspot embeddings on local host cache to remote.
   bool PushCacheFromLocalHostToRemote(const HashTableInfo &hash_info);
+  // Push non-hotspot embeddings on local host cache to local storage.
+  bool PushCacheFromLocalHostToStorage(const HashTableInfo &hash_info);
   // Push non-hotspot embeddings on device cache to local host cache.
   bool PushCacheFromDeviceToLocalHost(const HashTableInfo &hash_info);
   // Pull missing embeddings on local cache from remote.
   bool PullCacheFromRemoteToLocalHost(const HashTableInfo &hash_info);
+  // Insert the embeddings paged in from local storage to local host cache, and the embeddings not in local storage are
+  // pulled from remote.
+  bool PullCacheFromStorageToLocalHost(const HashTableInfo &hash_info, const bool *in_storage, float *page_in_data);
   // Pull missing embeddings on device cache from local host.
   bool PullCacheFromLocalHostToDevice(const HashTableInfo &hash_info);
 
@@ -155,9 +214,9 @@ class EmbeddingCachePrefetchActor : public ActorBase {
                             const int *indices_addr, float *output_addr);
 
   // Lookup embedding from Remote and get embeddings via RPC.
-  bool PullEembeddingsFromRemote(int32_t param_key, const int *ids, size_t ids_num, std::vector<float> *outputs);
+  bool PullEembeddingsFromRemote(int32_t param_key, const int64_t *ids, size_t ids_num, std::vector<float> *outputs);
   // Push the local embedding cache that requires evict to the remote.
-  bool PushEmbeddingsToRemote(int32_t param_key, const int *ids, size_t ids_num, const float *embeddings,
+  bool PushEmbeddingsToRemote(int32_t param_key, const int64_t *ids, size_t ids_num, const float *embeddings,
                               size_t embeddings_len);
 
   // Get the id range of each server's embedding table slice.
@@ -167,9 +226,11 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // different feature id ranges. Therefore, when the local side performs the push or pull embeddings operation, the
   // embeddings and ids need to be divided, and then communicate with the corresponding remote: Partition ids by
   // remote embedding slice bound and get unique ids.
-  bool PartitionIds(const int *ids, size_t ids_num, std::vector<std::vector<int>> *slice_ids_list);
+  // The partitioned ids are the ids minus the begin of the embedding table slice on the remote, which are sent to the
+  // remote as int32 data.
+  bool PartitionIds(const int64_t *ids, size_t ids_num, std::vector<std::vector<int>> *slice_ids_list);
   // Partition ids end embeddings by remote embedding slice bound.
-  bool PartitionIdsAndEmbeddings(const int *ids, size_t ids_num, const float *embeddings, size_t embeddings_len,
+  bool PartitionIdsAndEmbeddings(const int64_t *ids, size_t ids_num, const float *embeddings, size_t embeddings_len,
                                  std::vector<std::vector<int>> *slice_ids_list,
                                  std::vector<std::vector<float>> *slice_embeddings_list);
 
@@ -183,13 +244,15 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   std::unique_ptr<std::vector<char>> ReceiveFromRemote(const std::string &cache_operation, int32_t param_key,
                                                        size_t server_rank_id) const;
   // Retrieve embeddings by input ids order.
-  bool RetrieveEmbeddings(const int *ids, size_t ids_num, const std::vector<std::vector<int>> &slice_ids_list,
+  bool RetrieveEmbeddings(const int64_t *ids, size_t ids_num, const std::vector<std::vector<int>> &slice_ids_list,
                           const std::vector<std::unique_ptr<std::vector<char>>> &slice_embeddings_list,
                           std::vector<float> *outputs) const;
 
   // Send finalize request to remote and finalize it.
   bool FinalizeRemote();
 
+  // Sync the embeddings in local storage to remote.
+  bool SyncStorageEmbeddingTable();
   // Sync latest local host embedding cache to remote.
   bool SyncHostEmbeddingTable();
   // Sync latest device embedding cache to remote.
@@ -273,13 +336,15 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Record the public information of all local host embedding cache tables, such as the mapping relationship of id to
   // index, the information that needs to be updated (swap in and swap out), etc.
   std::shared_ptr<EmbeddingHostCache> embedding_host_cache_{nullptr};
+  // Apply the Adam steps missed by the rows out of the device cache on the local host, which is nullptr if not enabled.
+  std::shared_ptr<EmbeddingHostOptimizer> embedding_host_optimizer_{nullptr};
 
   // Statistics on the cache hit rate of the host and device and the information used to update cache.
   EmbeddingCacheStatisticsInfo statistics_info_;
 
   // Model parallelism is used between multiple workers, and local_embedding_slice_bounds_ records the feature range
   // corresponding to the embedding table slice of the process.
-  std::pair<int, int> local_embedding_slice_bounds_;
+  std::pair<int64_t, int64_t> local_embedding_slice_bounds_;
 
   // Model parallelism is used between multiple workers, and local_device_cache_bounds_ records the local device cache
   // range corresponding to the embedding table slice of the process.
@@ -288,7 +353,7 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // In a multi-server scenario, the embeddings need to be segmented, and each server saves the embeddings of
   // different feature id ranges, remote_embedding_slice_bounds_ records the feature range of the embedding table
   // slice on each server.
-  std::vector<std::pair<size_t, size_t>> remote_embedding_slice_bounds_;
+  std::vector<std::pair<int64_t, int64_t>> remote_embedding_slice_bounds_;
 
   // Total server number of cluster.
   size_t server_num_{0};
@@ -307,8 +372,9 @@ class EmbeddingCachePrefetchActor : public ActorBase {
 
   // The current global step of the computed graph.
   std::atomic_ulong graph_step_{0};
-  // The computed graph's global step at the time when this actor starts to prefetch cache for a batch ids.
-  size_t graph_running_step_{0};
+  // The computed graph's global step at the time when this actor starts to prefetch cache for a batch ids, it is
+  // updated by the parsing threads after waiting the computed graph.
+  std::atomic_ulong graph_running_step_{0};
   // The current global step of cache prefetching operation.
   size_t data_step_{0};
 
@@ -391,7 +457,7 @@ class Sender : public RpcOperator {
   // The url of the peer receiver's tcp server.
   std::string server_url_;
 
-  std::unique_ptr<TCPClient> client_;
+  std::unique_ptr<RPCClientBase> client_;
 
   // The sender and the receiver are used in pairs. The information sent by the sender contains the url of the
   // corresponding receiver, so a reference to the receiver is maintained in the sender.
@@ -428,7 +494,7 @@ class Receiver : public RpcOperator {
   std::string ip_;
   uint32_t port_;
 
-  std::unique_ptr<TCPServer> server_;
+  std::unique_ptr<RPCServerBase> server_;
 
   // The buffer used save received content of message.
   std::unique_ptr<std::vector<char>> received_buffer_;
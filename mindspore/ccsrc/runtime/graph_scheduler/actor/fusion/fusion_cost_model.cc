@@ -0,0 +1,115 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/actor/fusion/fusion_cost_model.h"
+#include <fstream>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "include/common/debug/common.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr char kFusionCostFileEnv[] = "MS_DEV_ACTOR_FUSION_COST_FILE";
+// The kernel needs enough records to eliminate the fluctuation of running time.
+constexpr size_t kMinRecordCount = 3;
+constexpr size_t kLaunchTimeIndex = 0;
+constexpr size_t kOverheadIndex = 1;
+constexpr size_t kCountIndex = 2;
+}  // namespace
+
+FusionCostModel::FusionCostModel() { Initialize(common::GetEnv(kFusionCostFileEnv)); }
+
+void FusionCostModel::Initialize(const std::string &cost_file) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  kernel_costs_.clear();
+  cost_file_ = cost_file;
+  enable_ = !cost_file_.empty();
+  if (enable_) {
+    Load();
+  }
+}
+
+void FusionCostModel::Record(const std::string &kernel_name, double launch_time, double overhead) {
+  if (!enable_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &kernel_cost = kernel_costs_[kernel_name];
+  kernel_cost.launch_time_ += launch_time;
+  kernel_cost.overhead_ += overhead;
+  ++kernel_cost.count_;
+}
+
+bool FusionCostModel::IsTinyKernel(const std::string &kernel_name) {
+  if (!enable_) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto &iter = kernel_costs_.find(kernel_name);
+  if (iter == kernel_costs_.end() || iter->second.count_ < kMinRecordCount) {
+    return false;
+  }
+  // The kernel costs are accumulated by the same count, so compare the total cost directly.
+  return iter->second.overhead_ > iter->second.launch_time_;
+}
+
+void FusionCostModel::Load() {
+  std::ifstream cost_fs(cost_file_);
+  if (!cost_fs.is_open()) {
+    MS_LOG(INFO) << "The actor fusion cost file: " << cost_file_ << " does not exist, record the cost from scratch.";
+    return;
+  }
+  nlohmann::json cost_json;
+  try {
+    cost_fs >> cost_json;
+    for (auto iter = cost_json.begin(); iter != cost_json.end(); ++iter) {
+      const std::vector<double> &cost = iter.value();
+      if (cost.size() <= kCountIndex) {
+        continue;
+      }
+      auto &kernel_cost = kernel_costs_[iter.key()];
+      kernel_cost.launch_time_ = cost[kLaunchTimeIndex];
+      kernel_cost.overhead_ = cost[kOverheadIndex];
+      kernel_cost.count_ = static_cast<size_t>(cost[kCountIndex]);
+    }
+  } catch (std::exception &e) {
+    MS_LOG(WARNING) << "Parse the actor fusion cost file: " << cost_file_ << " failed: " << e.what();
+    kernel_costs_.clear();
+  }
+  cost_fs.close();
+  MS_LOG(INFO) << "Load the cost of " << kernel_costs_.size() << " kernels from the file: " << cost_file_;
+}
+
+void FusionCostModel::Save() {
+  if (!enable_) {
+    return;
+  }
+  nlohmann::json cost_json;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &kernel_cost : kernel_costs_) {
+      cost_json[kernel_cost.first] = std::vector<double>{kernel_cost.second.launch_time_, kernel_cost.second.overhead_,
+                                                         static_cast<double>(kernel_cost.second.count_)};
+    }
+  }
+  if (!Common::SaveStringToFile(cost_file_, cost_json.dump())) {
+    MS_LOG(WARNING) << "Save the actor fusion cost file: " << cost_file_ << " failed.";
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_FUSION_COST_MODEL_H_
+#define MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_FUSION_COST_MODEL_H_
+
+#include <string>
+#include <mutex>
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace runtime {
+// The cost model of actor fusion records the running cost of kernel actors in the previous steps. The kernel whose
+// actor overhead (fetching inputs, allocating memory and sending outputs) is larger than its launch time is the tiny
+// kernel, and the tiny kernel actors are fused to the fusion actor to save the message passing overhead.
+// The records are loaded from and saved to the file of env MS_DEV_ACTOR_FUSION_COST_FILE, and the cost model is
+// disabled when the env is not set.
+class FusionCostModel {
+ public:
+  static FusionCostModel &GetInstance() {
+    static FusionCostModel instance;
+    return instance;
+  }
+
+  bool enable() const { return enable_; }
+
+  // Clear the records and load them from the cost file, the cost model is disabled by the empty file path.
+  void Initialize(const std::string &cost_file);
+
+  // Record the cost of one running of the kernel actor, in units of second. The launch time is the host time of the
+  // kernel launch, and the overhead is the host time of the actor excluding the kernel launch and memory manager.
+  void Record(const std::string &kernel_name, double launch_time, double overhead);
+
+  // Whether the kernel is tiny by the records, the kernel without enough records is not tiny.
+  bool IsTinyKernel(const std::string &kernel_name);
+
+  // Save the records to the cost file, which is used by the later running.
+  void Save();
+
+ private:
+  FusionCostModel();
+  ~FusionCostModel() = default;
+  DISABLE_COPY_AND_ASSIGN(FusionCostModel);
+
+  void Load();
+
+  struct KernelCost {
+    double launch_time_{0};
+    double overhead_{0};
+    size_t count_{0};
+  };
+
+  bool enable_{false};
+  std::string cost_file_;
+  std::mutex mutex_;
+  mindspore::HashMap<std::string, KernelCost> kernel_costs_;
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_FRAMEWORK_ACTOR_FUSION_COST_MODEL_H_
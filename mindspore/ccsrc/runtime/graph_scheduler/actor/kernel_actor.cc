@@ -19,16 +19,32 @@
 #include "runtime/graph_scheduler/actor/output_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
+#include "runtime/graph_scheduler/actor/fusion/fusion_cost_model.h"
 #include "mindrt/include/async/async.h"
 #include "utils/log_adapter.h"
 #include "distributed/recovery/recovery_context.h"
 #include "distributed/collective/collective_manager.h"
 #include "kernel/common_utils.h"
+#include "utils/profile.h"
+#ifdef ENABLE_DUMP_IR
+#include "debug/rdr/step_trace_recorder.h"
+#endif
 
 namespace mindspore {
 namespace runtime {
 using distributed::collective::CollectiveManager;
 using distributed::recovery::RecoveryContext;
+#ifdef ENABLE_DUMP_IR
+namespace {
+size_t GetDeviceTensorsSize(const std::vector<DeviceTensor *> &device_tensors) {
+  size_t size = 0;
+  for (const auto &device_tensor : device_tensors) {
+    size += (device_tensor == nullptr) ? 0 : device_tensor->GetSize();
+  }
+  return size;
+}
+}  // namespace
+#endif
 
 void KernelActor::Init() {
   // Check device contexts number.
@@ -43,6 +59,14 @@ void KernelActor::Init() {
   real_input_num_ = common::AnfAlgo::GetInputTensorNum(kernel_);
   kernel_info_ = dynamic_cast<KernelInfo *>(kernel_->kernel_info());
   is_dynamic_shape_ = common::AnfAlgo::IsDynamicShape(kernel_);
+  // The dynamic shape kernel waits for the kernel finishing to update the output shape, which is not the overhead.
+  record_fusion_cost_ = FusionCostModel::GetInstance().enable() && (strategy_ == GraphExecutionStrategy::kPipeline) &&
+                        (!is_dynamic_shape_);
+  record_trace_ = ActorTrace::GetInstance().enable() && (strategy_ == GraphExecutionStrategy::kPipeline);
+  trace_record_.actor_name_ = GetAID().Name();
+#ifdef ENABLE_DUMP_IR
+  record_step_trace_ = RDR::StepTraceEnable();
+#endif
 
   for (size_t i = 0; i < real_input_num_; ++i) {
     const auto &input_device_tensor = AnfAlgo::GetPrevNodeMutableOutputAddr(kernel_, i, false);
@@ -104,6 +128,15 @@ void KernelActor::Init() {
 void KernelActor::Run(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(context);
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+  if (record_fusion_cost_) {
+    launch_time_ = 0;
+    actor_overhead_ = 0;
+    segment_start_time_ = GetTime();
+  }
+  if (record_trace_) {
+    trace_record_.ready_time_ = GetTime();
+    trace_record_.last_input_actor_ = FetchLastInputActorName();
+  }
 
   FetchInputDeviceTensor(context);
   FetchOutputDeviceTensor(context);
@@ -111,6 +144,10 @@ void KernelActor::Run(OpContext<DeviceTensor> *const context) {
     FetchWorkspaceDeviceTensor();
   }
 
+  // The queueing and allocation in the memory manager actor are not the overhead of this actor.
+  if (record_fusion_cost_) {
+    EndCostSegment();
+  }
   if (memory_alloc_list_.size() > 0) {
     SendMemoryAllocReq(context);
   } else {
@@ -193,6 +230,12 @@ void FreeMemory(const std::vector<DeviceTensor *> &free_list, const DeviceContex
 
 void KernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
   running_dependent_msg_num_ = 1;
+#ifdef ENABLE_DUMP_IR
+  if (record_step_trace_) {
+    RDR::RecordStepTraceEvent(StepTraceEventType::kMemoryAlloc, GetAID().Name(),
+                              GetDeviceTensorsSize(memory_alloc_list_));
+  }
+#endif
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
     if (ActorDispatcher::is_memory_allocation_sync()) {
       ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::AllocateMemory, &memory_alloc_list_,
@@ -209,6 +252,12 @@ void KernelActor::SendMemoryAllocReq(OpContext<DeviceTensor> *const context) {
 
 void KernelActor::SendMemoryFreeReq(OpContext<DeviceTensor> *const context) {
   MS_EXCEPTION_IF_NULL(device_contexts_[0]);
+#ifdef ENABLE_DUMP_IR
+  if (record_step_trace_) {
+    RDR::RecordStepTraceEvent(StepTraceEventType::kMemoryFree, GetAID().Name(),
+                              GetDeviceTensorsSize(memory_free_list_));
+  }
+#endif
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
     if (ActorDispatcher::is_memory_free_sync()) {
       ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &memory_free_list_,
@@ -236,6 +285,12 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
   if (IsRunningFailed(context)) {
     return;
   }
+  if (record_fusion_cost_) {
+    segment_start_time_ = GetTime();
+  }
+  if (record_trace_) {
+    trace_record_.alloc_finish_time_ = GetTime();
+  }
   PreLaunchKernel(context);
 
   try {
@@ -245,7 +300,24 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
       MS_LOG(WARNING) << "Collective communication need reinitialize, skip launch kernel: "
                       << kernel_->fullname_with_scope();
     } else {
+#ifdef ENABLE_DUMP_IR
+      if (record_step_trace_) {
+        RDR::RecordStepTraceEvent(StepTraceEventType::kKernelLaunch, GetAID().Name());
+      }
+#endif
+      if (record_fusion_cost_) {
+        EndCostSegment();
+      }
+      double launch_start_time = (record_fusion_cost_ || record_trace_) ? GetTime() : 0;
       auto ret = LaunchKernel(context);
+      if (record_fusion_cost_) {
+        segment_start_time_ = GetTime();
+        launch_time_ = segment_start_time_ - launch_start_time;
+      }
+      if (record_trace_) {
+        trace_record_.launch_start_time_ = launch_start_time;
+        trace_record_.launch_end_time_ = GetTime();
+      }
       if (!ret) {
         std::string error_info = "Launch kernel failed: " + kernel_->fullname_with_scope();
         SET_OPCONTEXT_FAIL_RET_WITH_ERROR_BY_STRATEGY(strategy_, (*context), error_info);
@@ -270,8 +342,14 @@ void KernelActor::OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) {
 
 void KernelActor::SendDebugReq(OpContext<DeviceTensor> *const context) {
   running_dependent_msg_num_ = 1;
+  if (record_fusion_cost_) {
+    EndCostSegment();
+  }
   ActorDispatcher::SendSync(*debug_aid_, &DebugActor::Debug, kernel_, &launch_info_, device_contexts_[0], context,
                             &GetAID());
+  if (record_fusion_cost_) {
+    segment_start_time_ = GetTime();
+  }
   OnDebugFinish(context);
 }
 
@@ -513,6 +591,21 @@ void KernelActor::PostLaunchKernel(OpContext<DeviceTensor> *const context) {
   if (strategy_ == GraphExecutionStrategy::kPipeline) {
     SendOutput(context);
   }
+
+  if (record_fusion_cost_) {
+    EndCostSegment();
+    FusionCostModel::GetInstance().Record(kernel_->fullname_with_scope(), launch_time_, actor_overhead_);
+  }
+  if (record_trace_) {
+    trace_record_.finish_time_ = GetTime();
+    ActorTrace::GetInstance().Record(ActorTraceRecord(trace_record_));
+  }
+}
+
+void KernelActor::EndCostSegment() {
+  auto current_time = GetTime();
+  actor_overhead_ += current_time - segment_start_time_;
+  segment_start_time_ = current_time;
 }
 
 void KernelActor::RefreshDeviceTensorCopyStore(OpContext<DeviceTensor> *const context) {
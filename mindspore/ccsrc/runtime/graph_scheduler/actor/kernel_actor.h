@@ -25,6 +25,7 @@
 #include "utils/hash_map.h"
 #include "runtime/graph_scheduler/actor/actor_common.h"
 #include "runtime/graph_scheduler/actor/debug_aware_actor.h"
+#include "runtime/graph_scheduler/actor/actor_trace.h"
 #include "runtime/hardware/device_context.h"
 #include "runtime/graph_scheduler/device_tensor_store.h"
 #include "kernel/kernel.h"
@@ -143,6 +144,8 @@ class KernelActor : public DebugAwareActor {
   void PostLaunchKernel(OpContext<DeviceTensor> *const context);
   // Back refresh the dynamic device tensor stores that have been triggered copy.
   void RefreshDeviceTensorCopyStore(OpContext<DeviceTensor> *const context);
+  // Accumulate the time since the start of current running segment to the actor overhead, and start a new segment.
+  void EndCostSegment();
 
   // The real input number of kernel launch.
   size_t real_input_num_;
@@ -161,6 +164,20 @@ class KernelActor : public DebugAwareActor {
 
   // Whether skip the kernel launch.
   bool is_launch_skipped_;
+
+  // Record the running cost for the cost-driven actor fusion, in units of second. The actor overhead only counts the
+  // host work of this actor, and the kernel launch, memory manager and debug actor are excluded.
+  bool record_fusion_cost_{false};
+  double segment_start_time_{0};
+  double launch_time_{0};
+  double actor_overhead_{0};
+
+  // Record the running timestamps for the critical path analysis of actor trace.
+  bool record_trace_{false};
+  ActorTraceRecord trace_record_;
+
+  // Record the runtime events to the step trace of RDR for diagnosing the slow step.
+  bool record_step_trace_{false};
 };
 
 using KernelActorPtr = std::shared_ptr<KernelActor>;
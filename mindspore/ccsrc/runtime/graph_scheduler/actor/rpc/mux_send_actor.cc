@@ -38,8 +38,8 @@ bool MuxSendActor::LaunchKernel(OpContext<DeviceTensor> *const context) {
   auto message = BuildRpcMessage(send_output, peer_server_url);
   MS_EXCEPTION_IF_NULL(message);
   MS_LOG(INFO) << "Rpc actor send message to: " << peer_server_url;
-  client_->SendAsync(std::move(message));
-  return true;
+  SendRpcMessage(std::move(message));
+  return WaitRpcMessagesSent();
 }
 }  // namespace runtime
 }  // namespace mindspore
@@ -87,7 +87,7 @@ class RecvActor : public RpcActor {
    */
   virtual void *AllocateMessage(size_t size);
 
-  std::unique_ptr<TCPServer> server_;
+  std::unique_ptr<RPCServerBase> server_;
 
   // The variables used to ensure thread-safe of op context visited by recv actor.
   bool is_context_valid_;
@@ -24,8 +24,7 @@
 #include <utility>
 #include "runtime/graph_scheduler/actor/kernel_actor.h"
 #include "distributed/cluster/cluster_context.h"
-#include "distributed/rpc/tcp/tcp_client.h"
-#include "distributed/rpc/tcp/tcp_server.h"
+#include "distributed/rpc/rpc_transport.h"
 #include "proto/rpc.pb.h"
 #include "proto/topology.pb.h"
 
@@ -35,8 +34,8 @@ using distributed::cluster::ActorRouteTableProxy;
 using distributed::cluster::ActorRouteTableProxyPtr;
 using distributed::cluster::ClusterContext;
 using distributed::cluster::topology::ActorAddress;
-using distributed::rpc::TCPClient;
-using distributed::rpc::TCPServer;
+using distributed::rpc::RPCClientBase;
+using distributed::rpc::RPCServerBase;
 using mindspore::device::KernelInfo;
 
 // The inter-process edge mark between two nodes.
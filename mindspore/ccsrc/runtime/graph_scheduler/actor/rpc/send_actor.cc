@@ -17,10 +17,15 @@
 #include "runtime/graph_scheduler/actor/rpc/send_actor.h"
 
 #include <utility>
+#include <chrono>
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 
 namespace mindspore {
 namespace runtime {
+namespace {
+constexpr int64_t kZeroCopySendTimeoutInSec = 300;
+}  // namespace
+
 SendActor::~SendActor() {
   if (client_) {
     try {
@@ -39,11 +44,12 @@ void SendActor::SetRouteInfo(uint32_t, const std::string &, const std::string &s
 }
 
 bool SendActor::ConnectServer() {
-  client_ = std::make_unique<TCPClient>();
+  client_ = distributed::rpc::CreateRPCClient();
   MS_EXCEPTION_IF_NULL(client_);
   if (!client_->Initialize()) {
     MS_LOG(EXCEPTION) << "Failed to initialize tcp server for send actor.";
   }
+  zero_copy_ = !common::GetEnv("use_void").empty() && common::GetEnv("MS_DEV_RPC_ZERO_COPY") == "1";
   // Lookup actor addresses for each peer actor.
   for (const auto &peer_actor_id : peer_actor_ids_) {
     MS_EXCEPTION_IF_NULL(actor_route_table_proxy_);
@@ -84,7 +90,29 @@ bool SendActor::LaunchKernel(OpContext<DeviceTensor> *const context) {
     auto message = BuildRpcMessage(send_output, peer_server_url);
     MS_ERROR_IF_NULL_W_RET_VAL(message, false);
     MS_LOG(INFO) << "Rpc actor send message for inter-process edge: " << peer.first;
-    client_->SendAsync(std::move(message));
+    SendRpcMessage(std::move(message));
+  }
+  return WaitRpcMessagesSent();
+}
+
+void SendActor::SendRpcMessage(std::unique_ptr<MessageBase> &&message) {
+  MS_EXCEPTION_IF_NULL(client_);
+  if (zero_copy_) {
+    std::lock_guard<std::mutex> lock(pending_msg_mutex_);
+    ++pending_msg_num_;
+  }
+  client_->SendAsync(std::move(message));
+}
+
+bool SendActor::WaitRpcMessagesSent() {
+  if (!zero_copy_) {
+    return true;
+  }
+  std::unique_lock<std::mutex> lock(pending_msg_mutex_);
+  if (!pending_msg_cv_.wait_for(lock, std::chrono::seconds(kZeroCopySendTimeoutInSec),
+                                [this] { return pending_msg_num_ == 0; })) {
+    MS_LOG(ERROR) << "Timeout to wait for " << pending_msg_num_ << " zero-copy messages sent for actor " << GetAID();
+    return false;
   }
   return true;
 }
@@ -124,6 +152,13 @@ bool SendActor::FreeMessage(void *data) {
   auto memory_free_list = FindDeviceTensorNeedsFree(data);
   ActorDispatcher::SendSync(memory_manager_aid_, &MemoryManagerActor::FreeMemory, &memory_free_list,
                             device_contexts_[0], context_, GetAID());
+  if (zero_copy_) {
+    std::lock_guard<std::mutex> lock(pending_msg_mutex_);
+    if (pending_msg_num_ > 0) {
+      --pending_msg_num_;
+    }
+    pending_msg_cv_.notify_all();
+  }
   return true;
 }
 
@@ -239,6 +274,15 @@ void SendActor::SerializeCommonMessage(MessageBase *message, const kernel::Addre
     for (const auto &data : data_list) {
       (void)message->body.append(static_cast<RpcDataPtr>(data->addr), data->size);
     }
+  } else if (zero_copy_ && data_list.size() <= static_cast<size_t>(distributed::rpc::SEND_MSG_SEGMENT_NUM)) {
+    // The inputs are sent from their own memory by scatter-gather io, and the workspace with zero size only carries
+    // the free callback after the message is sent.
+    for (const auto &data : data_list) {
+      MS_EXCEPTION_IF_NULL(data);
+      (void)message->segments.emplace_back(data->addr, data->size);
+    }
+    message->data = workspace_addr->addr;
+    message->size = 0;
   } else {
     if (workspace_addr->size != total_size) {
       MS_LOG(EXCEPTION) << "Workspace size should be the same as inputs size. But got " << workspace_addr->size
@@ -21,6 +21,8 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
 #include "runtime/graph_scheduler/actor/rpc/rpc_actor.h"
 
 namespace mindspore {
@@ -36,7 +38,9 @@ class SendActor : public RpcActor {
                  modifiable_ref_input_indexes, modifiable_ref_output_indexes, KernelTransformType::kSendActor),
         client_(nullptr),
         context_(nullptr),
-        server_url_("") {}
+        server_url_(""),
+        zero_copy_(false),
+        pending_msg_num_(0) {}
   ~SendActor() override;
 
   // Set send actor's destination peer info, in another word, send actor's output.
@@ -63,8 +67,15 @@ class SendActor : public RpcActor {
    */
   virtual bool FreeMessage(void *data);
 
+  // Send the message to remote asynchronously and record it as pending in zero-copy mode.
+  void SendRpcMessage(std::unique_ptr<MessageBase> &&message);
+
+  // In zero-copy mode, the messages borrow the memory of inputs which is freed after launching, so wait until all the
+  // pending messages are sent or dropped.
+  bool WaitRpcMessagesSent();
+
   // The tcp client connection to multiple servers.
-  std::unique_ptr<TCPClient> client_;
+  std::unique_ptr<RPCClientBase> client_;
 
  private:
   /**
@@ -127,6 +138,14 @@ class SendActor : public RpcActor {
 
   // The url of the peer recv actor's tcp server.
   std::string server_url_;
+
+  // Whether to send the inputs by scatter-gather io directly, which is enabled by env MS_DEV_RPC_ZERO_COPY when using
+  // void* message.
+  bool zero_copy_;
+  // The number of the zero-copy messages which are not sent yet.
+  size_t pending_msg_num_;
+  std::mutex pending_msg_mutex_;
+  std::condition_variable pending_msg_cv_;
 };
 
 using SendActorPtr = std::shared_ptr<SendActor>;
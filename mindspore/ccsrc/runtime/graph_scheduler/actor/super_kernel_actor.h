@@ -34,6 +34,7 @@ using mindspore::device::DeviceAddress;
 using mindspore::device::DeviceContext;
 
 // The Super kernel actor is used to represent the sink executing of graph which is the combination of kernels.
+// On gpu, the graph executor captures the kernels of static shape graph to the cuda graph and replays it.
 class SuperKernelActor : public DebugAwareActor {
  public:
   SuperKernelActor(const std::string &name, const KernelGraphPtr &graph, const DeviceContext *device_context,
@@ -18,6 +18,7 @@
 #include <string>
 #include <memory>
 #include <functional>
+#include <vector>
 #include "runtime/graph_scheduler/actor/embedding_cache/embedding_cache_prefetch_actor.h"
 #include "distributed/embedding_cache/embedding_cache_utils.h"
 #include "utils/ms_context.h"
@@ -187,6 +188,81 @@ void CheckGraphValidForEmbeddingCache(const KernelGraph &graph) {
     }
   }
 }
+
+// Get the float scalar of the kernel input, which should be a value node or a parameter with default value.
+bool GetConstFloatInput(const CNodePtr &kernel, size_t input_index, float *value) {
+  MS_EXCEPTION_IF_NULL(value);
+  auto input = common::AnfAlgo::GetPrevNodeOutput(kernel, input_index, true).first;
+  MS_EXCEPTION_IF_NULL(input);
+  ValuePtr input_value = nullptr;
+  if (input->isa<ValueNode>()) {
+    input_value = input->cast<ValueNodePtr>()->value();
+  } else if (input->isa<Parameter>()) {
+    input_value = input->cast<ParameterPtr>()->default_param();
+  }
+  if (input_value == nullptr) {
+    return false;
+  }
+  if (input_value->isa<FP32Imm>()) {
+    *value = GetValue<float>(input_value);
+    return true;
+  }
+  auto tensor = input_value->cast<tensor::TensorPtr>();
+  if (tensor == nullptr || tensor->data_type() != kNumberTypeFloat32 || tensor->DataSize() != 1) {
+    return false;
+  }
+  *value = *static_cast<float *>(tensor->data_c());
+  return true;
+}
+
+// Add the embedding cache tables updated by FusedSparseAdam to the host optimizer, which applies the steps missed by
+// the rows out of the device cache with the hyper parameters, so they should be constant.
+void AddHostOptimizerTables(const KernelGraph &graph) {
+  if (!embedding_cache_table_manager.enable_host_optimizer()) {
+    return;
+  }
+  // The inputs of FusedSparseAdam: var, m, v, beta1_power, beta2_power, lr, beta1, beta2, epsilon, grad, indices.
+  constexpr size_t kVarIndex = 0;
+  constexpr size_t kMIndex = 1;
+  constexpr size_t kVIndex = 2;
+  constexpr size_t kLrIndex = 5;
+  constexpr size_t kBeta1Index = 6;
+  constexpr size_t kBeta2Index = 7;
+  constexpr size_t kEpsilonIndex = 8;
+  for (const auto &kernel : graph.execution_order()) {
+    MS_EXCEPTION_IF_NULL(kernel);
+    if (common::AnfAlgo::GetCNodeName(kernel) != kFusedSparseAdamName) {
+      continue;
+    }
+    std::vector<std::string> state_names;
+    for (size_t i : {kVarIndex, kMIndex, kVIndex}) {
+      auto state = common::AnfAlgo::GetPrevNodeOutput(kernel, i, true).first;
+      MS_EXCEPTION_IF_NULL(state);
+      (void)state_names.emplace_back(state->fullname_with_scope());
+    }
+    if (!embedding_cache_table_manager.IsEmbeddingCacheTable(state_names[kVarIndex])) {
+      continue;
+    }
+    if (common::AnfAlgo::HasNodeAttr("use_nesterov", kernel) &&
+        common::AnfAlgo::GetNodeAttr<bool>(kernel, "use_nesterov")) {
+      MS_LOG(WARNING) << "The host optimizer doesn't support the nesterov Adam: " << kernel->fullname_with_scope()
+                      << ", the embedding cache table: " << state_names[kVarIndex]
+                      << " doesn't apply the missed steps.";
+      continue;
+    }
+    distributed::AdamHyperParams params;
+    if (!GetConstFloatInput(kernel, kLrIndex, &params.lr) || !GetConstFloatInput(kernel, kBeta1Index, &params.beta1) ||
+        !GetConstFloatInput(kernel, kBeta2Index, &params.beta2) ||
+        !GetConstFloatInput(kernel, kEpsilonIndex, &params.epsilon)) {
+      MS_LOG(WARNING) << "The hyper parameters of Adam: " << kernel->fullname_with_scope()
+                      << " are not constant, the embedding cache table: " << state_names[kVarIndex]
+                      << " doesn't apply the missed steps.";
+      continue;
+    }
+    embedding_cache_table_manager.AddHostAdamTable(state_names[kVarIndex], state_names[kMIndex], state_names[kVIndex],
+                                                   params);
+  }
+}
 }  // namespace
 
 EmbeddingCacheScheduler &EmbeddingCacheScheduler::GetInstance() {
@@ -298,6 +374,7 @@ void EmbeddingCacheScheduler::SetEmbedCachedParamAddress(const DeviceContext *de
 
     if (!checked_embedding_cache) {
       CheckGraphValidForEmbeddingCache(*graph);
+      AddHostOptimizerTables(*graph);
       checked_embedding_cache = true;
     }
 
@@ -676,7 +676,8 @@ GraphId GraphCompiler::CompileWholeGraphForGraphRunMode(const FuncGraphPtr &func
 
   // set executing sink true in graph mode
   root_graph->set_run_mode(device::RunMode::kGraphMode);
-  root_graph->set_is_loop_count_sink(true);
+  // The gpu graph executor launches the graph once per step, so the loop count can't sink to device.
+  root_graph->set_is_loop_count_sink(device_target != device::DeviceType::kGPU);
 #ifdef WITH_BACKEND
   // Embedding cache need global step of compute graph, can not enable loop sink, move loop control to loop count actor.
   if (ps::PSContext::instance()->cache_enable()) {
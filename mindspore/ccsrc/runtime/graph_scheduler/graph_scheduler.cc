@@ -20,6 +20,8 @@
 #include "runtime/graph_scheduler/actor/memory_manager_actor.h"
 #include "runtime/graph_scheduler/actor/debug_actor.h"
 #include "runtime/graph_scheduler/actor/recorder_actor.h"
+#include "runtime/graph_scheduler/actor/fusion/fusion_cost_model.h"
+#include "runtime/graph_scheduler/actor/actor_trace.h"
 #include "runtime/graph_scheduler/optimizer/optimizer.h"
 #include "runtime/graph_scheduler/optimizer/invalid_data_arrow_elimination.h"
 #include "runtime/graph_scheduler/optimizer/batch_data_arrow_fusion.h"
@@ -45,6 +47,7 @@
 #endif
 #ifdef ENABLE_DUMP_IR
 #include "include/common/debug/rdr/recorder_manager.h"
+#include "debug/rdr/step_trace_recorder.h"
 #endif
 #ifdef ENABLE_DEBUGGER
 #include "debug/debugger/debugger.h"
@@ -79,6 +82,9 @@ using distributed::recovery::RecoveryContext;
 namespace {
 constexpr char kNumaEnableEnv[] = "MS_ENABLE_NUMA";
 constexpr char kNumaEnableEnv2[] = "DATASET_ENABLE_NUMA";
+constexpr char kLockFreeMailBoxEnv[] = "MS_DEV_ENABLE_LOCK_FREE_MAILBOX";
+constexpr char kActorWorkStealingEnv[] = "MS_DEV_ENABLE_ACTOR_WORK_STEALING";
+constexpr char kActorPriorityScheduleEnv[] = "MS_DEV_ENABLE_ACTOR_PRIORITY_SCHEDULE";
 
 // For the transform state synchronization.
 constexpr char kTransformFinishPrefix[] = "TRANSFORM_FINISH_";
@@ -268,6 +274,33 @@ void DoDisasterRecovery(const std::string &actor_set_name) {
   }
 }
 #endif
+
+// Fetch the nodes of the compute branch which ends with the node and runs on the same stream of the node.
+std::vector<CNodePtr> FetchStreamBranchNodes(const CNodePtr &tail_node) {
+  MS_EXCEPTION_IF_NULL(tail_node);
+  std::vector<CNodePtr> branch_nodes = {tail_node};
+  if (!common::AnfAlgo::HasNodeAttr(kAttrStream, tail_node)) {
+    return branch_nodes;
+  }
+  auto stream_id = common::AnfAlgo::GetNodeAttr<size_t>(tail_node, kAttrStream);
+  for (size_t index = 0; index < branch_nodes.size(); ++index) {
+    auto node = branch_nodes[index];
+    for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(node); ++i) {
+      auto input_node = common::AnfAlgo::GetPrevNodeOutput(node, i, false).first;
+      MS_EXCEPTION_IF_NULL(input_node);
+      if (!input_node->isa<CNode>()) {
+        continue;
+      }
+      auto input_cnode = input_node->cast<CNodePtr>();
+      if (common::AnfAlgo::HasNodeAttr(kAttrStream, input_cnode) &&
+          common::AnfAlgo::GetNodeAttr<size_t>(input_cnode, kAttrStream) == stream_id &&
+          std::find(branch_nodes.begin(), branch_nodes.end(), input_cnode) == branch_nodes.end()) {
+        (void)branch_nodes.emplace_back(input_cnode);
+      }
+    }
+  }
+  return branch_nodes;
+}
 }  // namespace
 
 GraphScheduler &GraphScheduler::GetInstance() noexcept {
@@ -322,6 +355,9 @@ void GraphScheduler::Clear(const ActorInfo &actor_info, const std::vector<Kernel
 }
 
 void GraphScheduler::Clear() {
+  // Save the kernel costs of this running for the actor fusion of later running.
+  FusionCostModel::GetInstance().Save();
+
   // Terminate all actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
@@ -358,11 +394,11 @@ void GraphScheduler::ClearActorData(const ActorSet *actor_set) {
 
   control_node_scheduler_.ClearActorData(actor_set->control_actors_.get());
 
-  // At the end of the step, the op data sent to the stack actor in each actor should be clear.
+  // At the end of the step, the op data sent to the stack actor in each actor should be recycled.
   auto total_actors = SchedulerHelper::CollectActors(actor_set);
   for (auto &actor : total_actors) {
     MS_EXCEPTION_IF_NULL(actor);
-    actor->to_stack_data_.clear();
+    actor->to_stack_data_num_ = 0;
   }
 }
 
@@ -398,6 +434,8 @@ void GraphScheduler::Initialize() {
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
   size_t actor_queue_size = 81920;
+  ActorThreadPool::set_enable_work_stealing(common::GetEnv(kActorWorkStealingEnv) == "1");
+  ActorThreadPool::set_enable_priority_schedule(common::GetEnv(kActorPriorityScheduleEnv) == "1");
   auto ret = actor_manager->Initialize(true, actor_thread_num, actor_and_kernel_thread_num, actor_queue_size);
   if (ret != MINDRT_OK) {
     MS_LOG(EXCEPTION) << "Actor manager init failed.";
@@ -539,10 +577,18 @@ void GraphScheduler::Schedule(const ActorSet *actor_set) {
   // Schedule actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
+  static const bool enable_lock_free_mailbox = (common::GetEnv(kLockFreeMailBoxEnv) == "1");
+  static const bool enable_priority_schedule = (common::GetEnv(kActorPriorityScheduleEnv) == "1");
+  if (enable_priority_schedule) {
+    SchedulerHelper::SetCriticalPathPriority(actor_set);
+  }
   for (auto actor : actors) {
     MS_EXCEPTION_IF_NULL(actor);
     // The sub actors in the fusion actor do not participate in message interaction.
     if (actor->parent_fusion_actor_ == nullptr) {
+      if (enable_lock_free_mailbox) {
+        actor->set_mailbox_type(MailBoxType::kLockFree);
+      }
       (void)actor_manager->Spawn(actor);
     } else {
       actor->Init();
@@ -632,7 +678,11 @@ void GraphScheduler::Run(ActorSet *const actor_set, const std::vector<std::vecto
   }
 
   double end_time = GetTime();
+  ActorTrace::GetInstance().AnalyzeStep(actor_set->name_, start_time, end_time);
   const size_t kSecondsToMilliseconds = 1000;
+#ifdef ENABLE_DUMP_IR
+  RDR::RecordStepEnd(actor_set->name_, (end_time - start_time) * kSecondsToMilliseconds);
+#endif
   SetActorExecutionStrategy(actor_set, strategy, (end_time - start_time) * kSecondsToMilliseconds);
 
 #ifdef WITH_BACKEND
@@ -1689,22 +1739,25 @@ void GraphScheduler::LinkControlArrowBySendRecvNodes(const KernelGraphPtr &graph
       }
 
       // In the scene of allreduce op and computing op parallel multi stream, the input memory of allreduce can be
-      // reused only when the recv node runs finished, which is expressed by the reference count increased.
-      for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(parallel_node); ++i) {
-        auto device_tensor = AnfAlgo::GetPrevNodeMutableOutputAddr(parallel_node, i, false);
-        MS_EXCEPTION_IF_NULL(device_tensor);
-        UpdateRefCount(device_tensor.get());
-        (void)recv_actor->external_reference_tensors_.emplace_back(device_tensor.get());
-      }
+      // reused only when the recv node runs finished, which is expressed by the reference count increased. So is the
+      // memory of the whole compute branch on the other stream, which ends with the parallel node.
+      for (const auto &branch_node : FetchStreamBranchNodes(parallel_node)) {
+        for (size_t i = 0; i < common::AnfAlgo::GetInputTensorNum(branch_node); ++i) {
+          auto device_tensor = AnfAlgo::GetPrevNodeMutableOutputAddr(branch_node, i, false);
+          MS_EXCEPTION_IF_NULL(device_tensor);
+          UpdateRefCount(device_tensor.get());
+          (void)recv_actor->external_reference_tensors_.emplace_back(device_tensor.get());
+        }
 
-      auto kernel_mod = AnfAlgo::GetKernelMod(parallel_node);
-      MS_EXCEPTION_IF_NULL(kernel_mod);
-      auto workspace_num = kernel_mod->GetWorkspaceSizeList().size();
-      for (size_t i = 0; i < workspace_num; ++i) {
-        auto device_tensor = AnfAlgo::GetMutableWorkspaceAddr(parallel_node, i);
-        MS_EXCEPTION_IF_NULL(device_tensor);
-        UpdateRefCount(device_tensor.get());
-        (void)recv_actor->external_reference_tensors_.emplace_back(device_tensor.get());
+        auto kernel_mod = AnfAlgo::GetKernelMod(branch_node);
+        MS_EXCEPTION_IF_NULL(kernel_mod);
+        auto workspace_num = kernel_mod->GetWorkspaceSizeList().size();
+        for (size_t i = 0; i < workspace_num; ++i) {
+          auto device_tensor = AnfAlgo::GetMutableWorkspaceAddr(branch_node, i);
+          MS_EXCEPTION_IF_NULL(device_tensor);
+          UpdateRefCount(device_tensor.get());
+          (void)recv_actor->external_reference_tensors_.emplace_back(device_tensor.get());
+        }
       }
     }
   }
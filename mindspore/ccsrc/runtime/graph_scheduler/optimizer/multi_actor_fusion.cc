@@ -17,7 +17,9 @@
 #include "runtime/graph_scheduler/optimizer/multi_actor_fusion.h"
 #include <vector>
 #include <queue>
+#include <algorithm>
 #include "runtime/graph_scheduler/scheduler_helper.h"
+#include "runtime/graph_scheduler/actor/fusion/fusion_cost_model.h"
 
 namespace mindspore {
 namespace runtime {
@@ -32,6 +34,18 @@ bool SupportFusion(const AbstractActorPtr &actor) {
   }
   return false;
 }
+
+// Whether the actor is the kernel actor whose actor overhead is larger than the kernel launch time by the cost model.
+bool IsTinyKernelActor(const AbstractActorPtr &actor) {
+  MS_EXCEPTION_IF_NULL(actor);
+  if (actor->type() != KernelTransformType::kKernelActor) {
+    return false;
+  }
+  auto kernel_actor = dynamic_cast<KernelActor *>(actor.get());
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  MS_EXCEPTION_IF_NULL(kernel_actor->kernel());
+  return FusionCostModel::GetInstance().IsTinyKernel(kernel_actor->kernel()->fullname_with_scope());
+}
 }  // namespace
 
 // The max actors num in fusion actor.
@@ -198,7 +212,19 @@ bool GetDependentActors(std::vector<AbstractActorPtr> *const output_actors, cons
     }
   }
 
-  return (is_need_processed && (output_actors->size() == 1));
+  if (!is_need_processed || output_actors->empty()) {
+    return false;
+  }
+  // The actors without concurrent outputs can be fused by the fixed rule.
+  if (output_actors->size() == 1) {
+    return true;
+  }
+  // The concurrent outputs are fused by the cost model when all of them are tiny kernel actors, because running them
+  // serially in the fusion actor is faster than sending messages to run them concurrently.
+  return IsTinyKernelActor(actor) && std::all_of(output_actors->begin(), output_actors->end(),
+                                                 [](const AbstractActorPtr &output_actor) {
+                                                   return IsTinyKernelActor(output_actor);
+                                                 });
 }
 
 std::vector<FusionActorPtr> BuildFusionActorBySeed(
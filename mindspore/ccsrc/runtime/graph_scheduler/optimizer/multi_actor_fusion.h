@@ -26,6 +26,8 @@
 namespace mindspore {
 namespace runtime {
 // Fuse the actors which have the execution dependency to a big actor. These actors can't execute concurrently.
+// When the cost model of actor fusion is enabled, the concurrent tiny kernel actors whose actor overhead is larger than
+// the kernel launch time in the previous steps are also fused.
 class MultiActorFusion : public ActorPass {
  public:
   MultiActorFusion() : ActorPass("multi_actor_fusion", false) {}
@@ -458,6 +458,99 @@ void SchedulerHelper::AddArrowForFusionActor(FusionActor *fusion_actor) {
   }
 }
 
+namespace {
+// The static cost of actor, the kernel actor cost is estimated by the output size in units of KB.
+int64_t GetActorStaticCost(const AbstractActor *actor) {
+  MS_EXCEPTION_IF_NULL(actor);
+  constexpr size_t kCostUnitSize = 1024;
+  int64_t cost = 1;
+  if (actor->type() != KernelTransformType::kKernelActor) {
+    return cost;
+  }
+  auto kernel_actor = dynamic_cast<const KernelActor *>(actor);
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  MS_EXCEPTION_IF_NULL(kernel_actor->kernel());
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel_actor->kernel());
+  if (kernel_mod == nullptr) {
+    return cost;
+  }
+  for (auto size : kernel_mod->GetOutputSizeList()) {
+    cost += static_cast<int64_t>(size / kCostUnitSize);
+  }
+  return cost;
+}
+}  // namespace
+
+void SchedulerHelper::SetCriticalPathPriority(const ActorSet *actor_set) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  auto actors = CollectActors(actor_set);
+  mindspore::HashMap<std::string, AbstractActor *> actor_name_to_actor;
+  for (const auto &actor : actors) {
+    MS_EXCEPTION_IF_NULL(actor);
+    (void)actor_name_to_actor.emplace(actor->GetAID().Name(), actor.get());
+  }
+
+  auto get_output_actors = [&actor_name_to_actor](const AbstractActor *actor) {
+    std::vector<AbstractActor *> output_actors;
+    auto add_output_actor = [&actor_name_to_actor, &output_actors](const AID &to_op_id) {
+      const auto &iter = actor_name_to_actor.find(to_op_id.Name());
+      if (iter != actor_name_to_actor.end()) {
+        (void)output_actors.emplace_back(iter->second);
+      }
+    };
+    for (const auto &data_arrow : actor->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(data_arrow);
+      add_output_actor(data_arrow->to_op_id_);
+    }
+    for (const auto &control_arrow : actor->output_control_arrows()) {
+      MS_EXCEPTION_IF_NULL(control_arrow);
+      add_output_actor(control_arrow->to_op_id_);
+    }
+    return output_actors;
+  };
+
+  // The priority is the longest cost path from the actor to the end, computed by the post order of depth first search.
+  // The loop edges of control flow are ignored when the output actor is still being visited.
+  enum VisitStatus { kVisiting, kVisited };
+  mindspore::HashMap<AbstractActor *, VisitStatus> visit_status;
+  mindspore::HashMap<AbstractActor *, int64_t> priorities;
+  for (const auto &actor : actors) {
+    if (visit_status.count(actor.get()) > 0) {
+      continue;
+    }
+    std::vector<std::pair<AbstractActor *, std::vector<AbstractActor *>>> visit_stack;
+    (void)visit_stack.emplace_back(actor.get(), get_output_actors(actor.get()));
+    visit_status[actor.get()] = kVisiting;
+    while (!visit_stack.empty()) {
+      auto &top = visit_stack.back();
+      if (!top.second.empty()) {
+        auto output_actor = top.second.back();
+        top.second.pop_back();
+        if (visit_status.count(output_actor) == 0) {
+          visit_status[output_actor] = kVisiting;
+          (void)visit_stack.emplace_back(output_actor, get_output_actors(output_actor));
+        }
+        continue;
+      }
+      auto current_actor = top.first;
+      int64_t max_output_priority = 0;
+      for (auto output_actor : get_output_actors(current_actor)) {
+        if (visit_status[output_actor] == kVisited) {
+          max_output_priority = std::max(max_output_priority, priorities[output_actor]);
+        }
+      }
+      priorities[current_actor] = GetActorStaticCost(current_actor) + max_output_priority;
+      visit_status[current_actor] = kVisited;
+      visit_stack.pop_back();
+    }
+  }
+
+  for (const auto &actor : actors) {
+    actor->set_priority(priorities[actor.get()]);
+    MS_LOG(DEBUG) << "The priority of actor:" << actor->GetAID().Name() << " is " << actor->priority();
+  }
+}
+
 namespace {
 void CheckKernelActorValid(const std::vector<KernelActorPtr> &kernel_actors) {
   for (const auto &kernel_actor : kernel_actors) {
@@ -77,6 +77,10 @@ class SchedulerHelper {
   static FusionActorPtr BuildFusionActor(const std::vector<AbstractActorPtr> &actors);
   static void AddArrowForFusionActor(FusionActor *fusion_actor);
 
+  // Set the actor priority by the static cost of the longest path from the actor to the end of actor set, so the
+  // actors on the critical path run firstly in the priority schedule mode.
+  static void SetCriticalPathPriority(const ActorSet *actor_set);
+
   // Check whether the actor set is valid.
   static void CheckActorValid(const ActorSet *actor_set);
 
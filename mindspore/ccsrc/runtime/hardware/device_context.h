@@ -132,6 +132,10 @@ class DeviceResManager {
   // interface is implemented by subclasses.
   virtual bool SyncStream(size_t stream_id = 0) const { return true; }
 
+  // Make the stream of 'wait_stream_id' wait for the tasks which have been launched on the stream of 'record_stream_id'
+  // by the device event, which doesn't block the host thread. Return false if the device doesn't support the event.
+  virtual bool StreamWaitStream(size_t wait_stream_id, size_t record_stream_id) const { return false; }
+
   // Destroy all streams created by 'CreateStream'.
   bool DestroyAllStreams();
 
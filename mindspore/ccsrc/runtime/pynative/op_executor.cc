@@ -22,7 +22,22 @@ OpExecutor &OpExecutor::GetInstance() {
   return instance;
 }
 
-OpExecutor::OpExecutor() { worker_ = std::make_shared<std::thread>(&OpExecutor::WorkerLoop, this); }
+OpExecutor::OpExecutor() {
+  auto window_env = common::GetEnv("MS_DEV_PYNATIVE_LAZY_BUILD_WINDOW");
+  if (!window_env.empty()) {
+    try {
+      auto window = std::stoul(window_env);
+      if (window > 0) {
+        max_build_queue_size_ = window;
+      }
+    } catch (const std::exception &e) {
+      MS_LOG(WARNING) << "Invalid MS_DEV_PYNATIVE_LAZY_BUILD_WINDOW: " << window_env << ", use the default value "
+                      << max_build_queue_size_ << ".";
+    }
+  }
+  MS_LOG(INFO) << "The lazy build window of PyNative is " << max_build_queue_size_;
+  worker_ = std::make_shared<std::thread>(&OpExecutor::WorkerLoop, this);
+}
 
 OpExecutor::~OpExecutor() { WorkerJoin(); }
 
@@ -31,9 +46,12 @@ void OpExecutor::Register(const std::function<void()> &callback) {
   registered_ = true;
 }
 
+void OpExecutor::RegisterLazyFusion(const std::function<void()> &callback) { lazy_fusion_callback_ = callback; }
+
 void OpExecutor::Reset() {
   ClearResources();
   batch_build_callback_ = nullptr;
+  lazy_fusion_callback_ = nullptr;
   registered_ = false;
 
   // There is still one task in progress
@@ -77,6 +95,9 @@ void OpExecutor::WaitForRun() {
 }
 
 void OpExecutor::Wait() {
+  if (lazy_fusion_callback_ != nullptr) {
+    lazy_fusion_callback_();
+  }
   WaitForBuild();
   WaitForRun();
 }
@@ -114,7 +135,7 @@ bool OpExecutor::RunQueueEmpty() {
 
 bool OpExecutor::BuildQueueFull() {
   std::lock_guard<std::mutex> lock(task_mutex_);
-  return op_build_tasks_.size() > kMaxQueueSize;
+  return op_build_tasks_.size() > max_build_queue_size_;
 }
 
 bool OpExecutor::ActorInQueue(const std::string &actor_info) {
@@ -46,6 +46,10 @@ class BACKEND_EXPORT OpExecutor {
   // Register build callback function
   void Register(const std::function<void()> &callback);
 
+  // Register the callback which flushes the ops recorded by the lazy fusion of PyNative, it runs before waiting for the
+  // tasks, so the recorded ops are launched at every sync point.
+  void RegisterLazyFusion(const std::function<void()> &callback);
+
   void PushOpBuildTask(const std::shared_ptr<OpBuildTask> &op_build_task);
 
   void PushOpRunTask(const std::shared_ptr<OpTask> &op_run_task);
@@ -90,7 +94,10 @@ class BACKEND_EXPORT OpExecutor {
   std::queue<std::shared_ptr<OpTask>> op_run_tasks_;
   std::set<std::string> actor_in_queue_;
   std::function<void()> batch_build_callback_{nullptr};
-  inline static size_t kMaxQueueSize = 20;
+  std::function<void()> lazy_fusion_callback_{nullptr};
+  // The number of the ops recorded in one window of lazy build before the batch build, which is set by env
+  // MS_DEV_PYNATIVE_LAZY_BUILD_WINDOW. The window is also flushed at the sync points, such as asnumpy.
+  size_t max_build_queue_size_{20};
   bool executing_{false};
   bool registered_{false};
   std::shared_ptr<std::thread> worker_;
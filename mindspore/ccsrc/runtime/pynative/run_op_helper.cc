@@ -430,6 +430,10 @@ void UpdateDynamicShape(const CNodePtr &kernel) {
     MS_LOG(EXCEPTION) << "Akg kernel do not support dynamic shape: " << kernel->fullname_with_scope();
   }
   opt::dynamic_shape::InferOp(kernel);
+  if (opt::dynamic_shape::ResizeCache::GetInstance().CheckResizeHit(kernel)) {
+    MS_LOG(DEBUG) << "The input shapes of " << kernel->fullname_with_scope() << " are not changed, skip the resize.";
+    return;
+  }
   auto args = kernel::GetArgsFromCNode(kernel);
   if (kernel_mod->GetKernelModType() == kernel::KernelModType::NativeGpuKernelMod ||
       kernel_mod->GetKernelModType() == kernel::KernelModType::NativeCpuKernelMod) {
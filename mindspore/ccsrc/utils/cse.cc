@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <set>
+#include <utility>
 
 #include "ir/anf.h"
 #include "ir/scalar.h"
@@ -126,10 +127,22 @@ bool CSE::BuildOrderGroupAndDoReplaceForOneGraph(const FuncGraphPtr &fg, const F
 }
 
 bool CSE::BuildOrderGroupAndDoReplace(const FuncGraphManagerPtr manager) const {
+  if (clean_graphs_manager_ != manager.get()) {
+    clean_graphs_.clear();
+    clean_graphs_manager_ = manager.get();
+  }
   bool changed = false;
+  mindspore::HashMap<const FuncGraph *, std::pair<std::size_t, const AnfNode *>> clean_graphs;
   for (FuncGraphPtr fg : manager->func_graphs()) {
-    changed = BuildOrderGroupAndDoReplaceForOneGraph(fg, manager) || changed;
+    auto iter = clean_graphs_.find(fg.get());
+    if (iter == clean_graphs_.end() || iter->second.first != manager->change_version(fg) ||
+        iter->second.second != fg->output().get()) {
+      changed = BuildOrderGroupAndDoReplaceForOneGraph(fg, manager) || changed;
+    }
+    // The replacement in the later graphs may change this graph again, which renews its version.
+    clean_graphs[fg.get()] = std::make_pair(manager->change_version(fg), fg->output().get());
   }
+  clean_graphs_ = std::move(clean_graphs);
   return changed;
 }
 
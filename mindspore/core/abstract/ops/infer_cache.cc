@@ -0,0 +1,183 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "abstract/ops/infer_cache.h"
+#include <algorithm>
+#include <chrono>
+#include <utility>
+#include "abstract/ops/primitive_infer_map.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace abstract {
+namespace {
+constexpr auto kInferCacheEnv = "MS_DEV_INFER_CACHE";
+// The cache is cleared when it is full, as the abstracts of the released graphs are never hit again.
+constexpr size_t kMaxCacheSize = 100000;
+
+double ElapsedUs(const std::chrono::steady_clock::time_point &start) {
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// The context which the infer functions read, such as the device target in the infer of BatchMatMul and MaxPool, so
+// the abstracts inferred under another context are never hit.
+std::string GetInferContext() {
+  auto context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context);
+  return context->get_param<std::string>(MS_CTX_DEVICE_TARGET) + "_" +
+         std::to_string(context->get_param<bool>(MS_CTX_GRAD_FOR_SCALAR)) + "_" + common::GetEnv("MS_ENABLE_GE");
+}
+
+// The AbstractRefTensor is compared without the ref key, and the function, the undetermined, the dictionary and the
+// other abstracts may be compared by pointer or carry the states which are not in the abstract, so only the plain
+// abstracts are cacheable.
+bool IsCacheableAbstract(const AbstractBasePtr &abs) {
+  if (abs == nullptr || abs->isa<AbstractRefTensor>()) {
+    return false;
+  }
+  if (abs->isa<AbstractSequence>()) {
+    const auto &elements = abs->cast<AbstractSequencePtr>()->elements();
+    return std::all_of(elements.begin(), elements.end(), IsCacheableAbstract);
+  }
+  return abs->isa<AbstractTensor>() || abs->isa<AbstractScalar>() || abs->isa<AbstractType>() ||
+         abs->isa<AbstractNone>() || abs->isa<AbstractMonad>();
+}
+}  // namespace
+
+double InferCache::Statistics::HitRate() const {
+  auto total = hit_count + miss_count;
+  return total == 0 ? 0 : static_cast<double>(hit_count) / total;
+}
+
+double InferCache::Statistics::SavedTimeUs() const {
+  if (miss_count == 0) {
+    return 0;
+  }
+  return miss_time_us / miss_count * hit_count - hit_time_us;
+}
+
+InferCache &InferCache::GetInstance() {
+  static InferCache instance;
+  return instance;
+}
+
+InferCache::InferCache() { enable_ = (common::GetEnv(kInferCacheEnv) != "0"); }
+
+bool InferCache::IsCacheable(const PrimitivePtr &primitive, const AbstractBasePtrList &input_args) const {
+  if (!GetValueDependArgIndices(primitive->name(), input_args.size()).empty()) {
+    return false;
+  }
+  return std::all_of(input_args.begin(), input_args.end(), IsCacheableAbstract);
+}
+
+AbstractBasePtr InferCache::Infer(const PrimitivePtr &primitive, const AbstractBasePtrList &input_args,
+                                  const InferFunc &infer) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  if (!enable_) {
+    return infer();
+  }
+  if (!IsCacheable(primitive, input_args)) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++statistics_[primitive->name()].bypass_count;
+    return infer();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  CacheKey key{primitive->name(), primitive->attrs(), input_args, GetInferContext()};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = cache_.find(key);
+    if (iter != cache_.end()) {
+      for (const auto &attr : iter->second.added_attrs) {
+        (void)primitive->AddAttr(attr.first, attr.second);
+      }
+      auto abs = iter->second.abs->Clone();
+      auto &statistics = statistics_[key.prim_name];
+      ++statistics.hit_count;
+      statistics.hit_time_us += ElapsedUs(start);
+      return abs;
+    }
+  }
+
+  // Run the infer without the lock, as the infer of the sub graphs may be run in other threads at the same time.
+  auto abs = infer();
+  auto miss_time_us = ElapsedUs(start);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &statistics = statistics_[key.prim_name];
+  ++statistics.miss_count;
+  statistics.miss_time_us += miss_time_us;
+  if (abs == nullptr) {
+    return abs;
+  }
+  CacheValue value{abs->Clone(), {}};
+  const auto &attrs = primitive->attrs();
+  for (const auto &attr : attrs) {
+    auto old_attr = key.prim_attrs.find(attr.first);
+    if (old_attr == key.prim_attrs.end() || !common::IsEqual(old_attr->second, attr.second)) {
+      (void)value.added_attrs.emplace(attr.first, attr.second);
+    }
+  }
+  // The attrs erased by the infer can not be replayed on hit.
+  if (std::any_of(key.prim_attrs.begin(), key.prim_attrs.end(),
+                  [&attrs](const auto &attr) { return attrs.find(attr.first) == attrs.end(); })) {
+    return abs;
+  }
+  if (cache_.size() >= kMaxCacheSize) {
+    MS_LOG(INFO) << "The infer cache is full, clear " << cache_.size() << " cached abstracts.";
+    cache_.clear();
+  }
+  (void)cache_.emplace(std::move(key), std::move(value));
+  return abs;
+}
+
+InferCache::Statistics InferCache::GetStatistics(const std::string &prim_name) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = statistics_.find(prim_name);
+  return iter == statistics_.end() ? Statistics() : iter->second;
+}
+
+void InferCache::DumpStatistics() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Statistics total;
+  double total_saved_us = 0;
+  for (const auto &[prim_name, statistics] : statistics_) {
+    if (statistics.hit_count + statistics.miss_count == 0) {
+      continue;
+    }
+    MS_LOG(DEBUG) << "Infer cache of " << prim_name << ": hit " << statistics.hit_count << ", miss "
+                  << statistics.miss_count << ", bypass " << statistics.bypass_count << ", hit rate "
+                  << statistics.HitRate() << ", saved " << statistics.SavedTimeUs() << " us.";
+    total.hit_count += statistics.hit_count;
+    total.miss_count += statistics.miss_count;
+    total.bypass_count += statistics.bypass_count;
+    total_saved_us += statistics.SavedTimeUs();
+  }
+  if (total.hit_count + total.miss_count == 0) {
+    return;
+  }
+  MS_LOG(INFO) << "Infer cache: hit " << total.hit_count << ", miss " << total.miss_count << ", bypass "
+               << total.bypass_count << ", hit rate " << total.HitRate() << ", cached " << cache_.size()
+               << " abstracts, saved " << total_saved_us << " us.";
+}
+
+void InferCache::Clear() {
+  DumpStatistics();
+  std::lock_guard<std::mutex> lock(mutex_);
+  cache_.clear();
+  statistics_.clear();
+}
+}  // namespace abstract
+}  // namespace mindspore
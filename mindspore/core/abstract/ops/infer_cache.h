@@ -0,0 +1,111 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_ABSTRACT_OPS_INFER_CACHE_H_
+#define MINDSPORE_CORE_ABSTRACT_OPS_INFER_CACHE_H_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "utils/hash_map.h"
+#include "utils/ms_utils.h"
+#include "ir/primitive.h"
+#include "abstract/abstract_value.h"
+
+namespace mindspore {
+namespace abstract {
+// The infer cache memorizes the output abstract of the standard primitive infer, which is run again and again with the
+// same inputs by the renormalize, the backend dynamic shape inference and the pynative op dispatch. The key is the
+// primitive name, the primitive attrs before the infer, the input abstracts and the context read by the infer functions,
+// and the attrs added by the infer are recorded and added to the primitive again on hit. The ops which depend on the values of inputs and the inputs which
+// are not tensor, scalar, type, none, monad or sequence of them bypass the cache.
+// It is enabled by default and disabled by the env MS_DEV_INFER_CACHE=0.
+class MS_CORE_API InferCache {
+ public:
+  using InferFunc = std::function<AbstractBasePtr()>;
+
+  static InferCache &GetInstance();
+
+  bool enable() const { return enable_; }
+
+  // Look up the cache, or run the infer and insert the result if not found.
+  AbstractBasePtr Infer(const PrimitivePtr &primitive, const AbstractBasePtrList &input_args, const InferFunc &infer);
+
+  // Log the statistics and clear the cached abstracts and the statistics.
+  void Clear();
+
+  // Log the hit rate and the infer time saved of each primitive.
+  void DumpStatistics();
+
+  struct Statistics {
+    size_t hit_count{0};
+    size_t miss_count{0};
+    size_t bypass_count{0};
+    // The time of the infer on miss, and the time of the look up on hit.
+    double miss_time_us{0};
+    double hit_time_us{0};
+
+    double HitRate() const;
+    // Estimate the saved time by the average infer time on miss.
+    double SavedTimeUs() const;
+  };
+  Statistics GetStatistics(const std::string &prim_name);
+
+ private:
+  InferCache();
+  ~InferCache() = default;
+  DISABLE_COPY_AND_ASSIGN(InferCache);
+
+  struct CacheKey {
+    std::string prim_name;
+    mindspore::HashMap<std::string, ValuePtr> prim_attrs;
+    AbstractBasePtrList input_args;
+    // The device target, the grad for scalar flag of the context and the MS_ENABLE_GE env.
+    std::string context;
+  };
+
+  struct CacheKeyHasher {
+    size_t operator()(const CacheKey &key) const {
+      return hash_combine({std::hash<std::string>()(key.prim_name), AbstractBasePtrListHash(key.input_args),
+                           std::hash<std::string>()(key.context)});
+    }
+  };
+
+  struct CacheKeyEqual {
+    bool operator()(const CacheKey &lhs, const CacheKey &rhs) const {
+      return lhs.prim_name == rhs.prim_name && lhs.context == rhs.context &&
+             AbstractBasePtrListDeepEqual(lhs.input_args, rhs.input_args) &&
+             common::IsAttrsEqual(lhs.prim_attrs, rhs.prim_attrs);
+    }
+  };
+
+  struct CacheValue {
+    AbstractBasePtr abs;
+    mindspore::HashMap<std::string, ValuePtr> added_attrs;
+  };
+
+  bool IsCacheable(const PrimitivePtr &primitive, const AbstractBasePtrList &input_args) const;
+
+  bool enable_{true};
+  std::mutex mutex_;
+  std::unordered_map<CacheKey, CacheValue, CacheKeyHasher, CacheKeyEqual> cache_;
+  std::map<std::string, Statistics> statistics_;
+};
+}  // namespace abstract
+}  // namespace mindspore
+#endif  // MINDSPORE_CORE_ABSTRACT_OPS_INFER_CACHE_H_
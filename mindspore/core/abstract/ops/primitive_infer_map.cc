@@ -42,6 +42,7 @@
 #include "ops/reduce_prod.h"
 #include "abstract/abstract_function.h"
 #include "abstract/ops/infer_functions.h"
+#include "abstract/ops/infer_cache.h"
 #include "utils/ms_context.h"
 #include "ops/tile.h"
 #include "ops/slice.h"
@@ -510,7 +511,9 @@ AbstractBasePtr StandardPrimitiveImplReg::InferShapeAndType(const abstract::Anal
     return nullptr;
   }
 
-  return op_infer_->InferShapeAndType(engine, primitive, input_args);
+  return InferCache::GetInstance().Infer(primitive, input_args, [this, &engine, &primitive, &input_args]() {
+    return op_infer_->InferShapeAndType(engine, primitive, input_args);
+  });
 }
 
 BaseShapePtr StandardPrimitiveImplReg::InferShape(const PrimitivePtr &prim, const AbstractBasePtrList &args) const {
@@ -21,6 +21,7 @@
 #include "utils/trace_base.h"
 #include "ir/manager.h"
 #include "utils/ordered_set.h"
+#include "utils/node_pool.h"
 #include "utils/convert_utils_base.h"
 #include "abstract/abstract_function.h"
 
@@ -90,14 +91,14 @@ const std::vector<AnfNodePtr> FuncGraph::get_inputs() const {
 
 ParameterPtr FuncGraph::add_parameter() {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph);
+  ParameterPtr param = MakePooledShared<Parameter>(this_func_graph);
   add_parameter(param);
   return param;
 }
 
 ParameterPtr FuncGraph::add_parameter(NodeDebugInfoPtr &&debug_info) {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph, std::move(debug_info));
+  ParameterPtr param = MakePooledShared<Parameter>(this_func_graph, std::move(debug_info));
   add_parameter(param);
   return param;
 }
@@ -112,7 +113,7 @@ void FuncGraph::add_parameter(const ParameterPtr &param) {
 
 ParameterPtr FuncGraph::InsertFrontParameter() {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph);
+  ParameterPtr param = MakePooledShared<Parameter>(this_func_graph);
   InsertFrontParameter(param);
   return param;
 }
@@ -127,7 +128,7 @@ void FuncGraph::InsertFrontParameter(const ParameterPtr &param) {
 
 ParameterPtr FuncGraph::AddFvParameter(const std::string &name, const ValuePtr &default_value) {
   FuncGraphPtr this_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_graph);
+  ParameterPtr param = MakePooledShared<Parameter>(this_graph);
   param->set_name(name);
   param->debug_info()->set_name(name);
   MS_EXCEPTION_IF_NULL(default_value);
@@ -165,11 +166,11 @@ ValuePtr FuncGraph::get_attr(const std::string &key) const {
 }
 
 CNodePtr FuncGraph::NewCNode(std::vector<AnfNodePtr> &&inputs) {
-  return std::make_shared<CNode>(std::move(inputs), shared_from_base<FuncGraph>());
+  return MakePooledShared<CNode>(std::move(inputs), shared_from_base<FuncGraph>());
 }
 
 CNodePtr FuncGraph::NewCNode(const std::vector<AnfNodePtr> &inputs) {
-  return std::make_shared<CNode>(inputs, shared_from_base<FuncGraph>());
+  return MakePooledShared<CNode>(inputs, shared_from_base<FuncGraph>());
 }
 
 CNodePtr FuncGraph::NewCNodeInOrder(std::vector<AnfNodePtr> &&inputs) {
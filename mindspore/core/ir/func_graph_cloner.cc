@@ -24,6 +24,7 @@
 #include "utils/convert_utils_base.h"
 #include "utils/log_adapter.h"
 #include "utils/profile.h"
+#include "utils/node_pool.h"
 #include "utils/ms_context.h"
 #include "ir/graph_utils.h"
 #include "utils/parallel_node_check.h"
@@ -91,7 +92,7 @@ void Cloner::CloneParameter(const AnfNodePtr &node, const FuncGraphPtr &target,
   MS_EXCEPTION_IF_NULL(old_param);
   auto debug_info = CloneNodeDebugInfo(node->debug_info(), relation_);
   auto new_param = (is_add ? target->add_parameter(std::move(debug_info))
-                           : std::make_shared<Parameter>(target, std::move(debug_info)));
+                           : MakePooledShared<Parameter>(target, std::move(debug_info)));
   new_param->set_abstract(old_param->abstract());
   new_param->set_name(old_param->name());
   if (old_param->has_default()) {
@@ -117,7 +118,7 @@ void Cloner::CloneCNode(const AnfNodePtr &node, const FuncGraphPtr &target) {
     debug_info = node->debug_info();
   }
   auto cloned_debug_info = CloneNodeDebugInfo(debug_info, relation_);
-  CNodePtr new_node = std::make_shared<CNode>(std::move(inputs), target, std::move(cloned_debug_info));
+  CNodePtr new_node = MakePooledShared<CNode>(std::move(inputs), target, std::move(cloned_debug_info));
   new_node->CloneCNodeInfo(old_node);
   ScopePtr scope;
   if (this->update_info() != nullptr && this->update_info()->scope_ != nullptr) {
@@ -332,7 +333,7 @@ void Cloner::CloneParameter(const ParameterPtr &param, const AnfNodePtr &node) c
 
 ParameterPtr Cloner::AddParameter(const FuncGraphPtr &func_graph, const AnfNodePtr &node, bool is_add) {
   auto debug_info = CloneNodeDebugInfo(node->debug_info());
-  ParameterPtr param = std::make_shared<Parameter>(func_graph, std::move(debug_info));
+  ParameterPtr param = MakePooledShared<Parameter>(func_graph, std::move(debug_info));
   CloneParameter(param, node);
   if (is_add) {
     func_graph->add_parameter(param);
@@ -19,6 +19,7 @@
 #include "ir/manager.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 
 #include "ir/func_graph.h"
@@ -363,6 +364,7 @@ void FuncGraphManager::Clear() noexcept {
   all_nodes_.clear();
   node_users_.clear();
   roots_.clear();
+  change_versions_.clear();
 
   signals_->InvalidateComputer();
 }
@@ -428,6 +430,7 @@ void FuncGraphManager::AddIntoManaged(const FuncGraphPtr &fg) {
   }
   func_graphs_.add(fg);
   fg->IncAttachedMngCnt();
+  RenewChangeVersion(fg);
 }
 
 void FuncGraphManager::MaybeDropFuncGraphs(const FuncGraphSet &func_graphs, bool ignore_users) {
@@ -696,7 +699,7 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->AddFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->AddFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        signals_->InvalidateFuncGraphsUsed(fg);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -705,7 +708,7 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->AddFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateFreeVariables(fg);
     }
   }
 }
@@ -718,7 +721,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->DropFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->DropFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        signals_->InvalidateFuncGraphsUsed(fg);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -727,7 +730,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->DropFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      signals_->InvalidateFreeVariables(fg);
     }
   }
 }
@@ -739,6 +742,7 @@ void FuncGraphManager::MoveAllNodes(const FuncGraphPtr &source, const FuncGraphP
   target->CopyFreeVariables(source);
   target->CopyFuncGraphsUsed(source);
   target->CopyMetaFgPrimValueNodes(source);
+  RenewChangeVersion(target);
   source->ClearAllManagerInfo();
   signals_->InvalidateComputer();
 }
@@ -753,6 +757,7 @@ void FuncGraphManager::CommitChanges(std::vector<change::ChangePtr> &&changes) {
 
   // Process added edges.
   counter.ForEachAddedEdges([this](const change::Edge &edge) {  //
+    RenewChangeVersion(edge.cnode->func_graph());
     ProcessEdgeAdd(edge.cnode, edge.index, edge.input);
   });
 
@@ -761,6 +766,7 @@ void FuncGraphManager::CommitChanges(std::vector<change::ChangePtr> &&changes) {
 
   // Process removed edges.
   counter.ForEachRemovedEdges([this](const change::Edge &edge) {  //
+    RenewChangeVersion(edge.cnode->func_graph());
     ProcessEdgeRemove(edge.cnode, edge.index, edge.input);
   });
 
@@ -771,12 +777,27 @@ void FuncGraphManager::CommitChanges(std::vector<change::ChangePtr> &&changes) {
   }
 }
 
+size_t FuncGraphManager::change_version(const FuncGraphPtr &fg) const {
+  MS_EXCEPTION_IF_NULL(fg);
+  auto iter = change_versions_.find(fg.get());
+  return iter == change_versions_.end() ? 0 : iter->second;
+}
+
+void FuncGraphManager::RenewChangeVersion(const FuncGraphPtr &fg) {
+  // The versions are unique among all managers, so a graph never gets back a version seen before.
+  static std::atomic<size_t> last_version{0};
+  if (fg != nullptr) {
+    change_versions_[fg.get()] = ++last_version;
+  }
+}
+
 void FuncGraphManager::EraseOneGraph(const FuncGraphPtr &fg) {
   MS_EXCEPTION_IF_NULL(fg);
   bool erase_ret = func_graphs_.erase(fg->shared_from_base<FuncGraph>());
   if (!erase_ret) {
     return;
   }
+  (void)change_versions_.erase(fg.get());
   fg->DecAttachedMngCnt();
   if (fg->attached_mng_cnt() == 0) {
     fg->ClearAllManagerInfo();
@@ -854,6 +875,8 @@ void FuncGraphTransaction::Commit() { manager_->CommitChanges(std::move(changes_
 DepComputer::DepComputer(const FuncGraphManager *const manager) : manager_(manager), validate_(false) {
   MS_EXCEPTION_IF_NULL(manager_);
   manager_->signals()->InvalidateComputer.connect(this, &DepComputer::OnInvalidateComputer);
+  manager_->signals()->InvalidateFreeVariables.connect(this, &DepComputer::OnInvalidateFreeVariables);
+  manager_->signals()->InvalidateFuncGraphsUsed.connect(this, &DepComputer::OnInvalidateFuncGraphsUsed);
 }
 
 void DepComputer::Recompute() {
@@ -1038,6 +1061,19 @@ void FuncGraphsUsedTotalComputer::RealRecompute(FuncGraphPtr fg) {
   }
 }
 
+void FuncGraphsUsedTotalComputer::OnInvalidateFuncGraphsUsed(const FuncGraphPtr &fg) {
+  std::vector<FuncGraphPtr> dirty_fgs;
+  for (auto &[user_fg, used_total] : func_graph_used_total_analysis_) {
+    if (user_fg == fg || used_total.contains(fg)) {
+      dirty_fgs.push_back(user_fg);
+    }
+  }
+  for (auto &dirty_fg : dirty_fgs) {
+    (void)func_graph_used_total_analysis_.erase(dirty_fg);
+    (void)func_graphs_validate_.erase(dirty_fg);
+  }
+}
+
 bool CheckRecursive(const FuncGraphManager *const manager, const FuncGraphPtr &fg) {
   MS_EXCEPTION_IF_NULL(manager);
   std::vector<FuncGraphPtr> todo;
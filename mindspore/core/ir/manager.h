@@ -74,6 +74,10 @@ MS_CORE_API FuncGraphManagerPtr MakeManager(const std::vector<FuncGraphPtr> &fun
 
 struct Signals {
   Signal<void()> InvalidateComputer;
+  // The free variables of the graph are changed.
+  Signal<void(const FuncGraphPtr &)> InvalidateFreeVariables;
+  // The func graphs used by the graph are changed.
+  Signal<void(const FuncGraphPtr &)> InvalidateFuncGraphsUsed;
 };
 
 using CNodeIndexPair = std::pair<AnfNodePtr, int>;
@@ -96,6 +100,12 @@ class DepComputer {
 
   void OnInvalidateComputer() { Reset(); }
 
+  // All the results are reset by default when the relation of one graph is changed, the computer whose results
+  // do not depend on the changed relation, or only partially depend on it, overrides these to keep the others.
+  virtual void OnInvalidateFreeVariables(const FuncGraphPtr &) { Reset(); }
+
+  virtual void OnInvalidateFuncGraphsUsed(const FuncGraphPtr &) { Reset(); }
+
   void Recompute();
 
   void Recompute(const FuncGraphPtr &fg);
@@ -226,6 +236,12 @@ class FuncGraphsUsedTotalComputer final : public DepComputer {
 
   FuncGraphToFuncGraphSetMap func_graph_used_total_analysis_;
 
+  // The used graphs do not depend on the free variables.
+  void OnInvalidateFreeVariables(const FuncGraphPtr &) override {}
+
+  // Only the results of the graph and the graphs using it are dirty.
+  void OnInvalidateFuncGraphsUsed(const FuncGraphPtr &fg) override;
+
  protected:
   void ExtraReset() override { func_graph_used_total_analysis_.clear(); }
 
@@ -250,6 +266,9 @@ class RecursiveComputer final : public DepComputer {
   RecursiveMap recursive_map_;
   FuncGraphToBoolMap recursive_analysis_;
 
+  // The recursion only depends on the used graphs.
+  void OnInvalidateFreeVariables(const FuncGraphPtr &) override {}
+
  protected:
   void ExtraReset() override {
     recursive_analysis_.clear();
@@ -338,6 +357,10 @@ class MS_CORE_API FuncGraphManager : public std::enable_shared_from_this<FuncGra
 
   std::shared_ptr<Signals> signals() const { return signals_; }
 
+  // The change version of the managed graph, it is a process-wide unique number renewed when the graph is added or
+  // the edges of its nodes are changed by the manager, so a pass can skip the graphs unchanged since its last run.
+  size_t change_version(const FuncGraphPtr &fg) const;
+
   // Static Analysis
   NodeUsersMap node_users_;
   AnfNodeSet all_nodes_;  // managed nodes
@@ -358,6 +381,7 @@ class MS_CORE_API FuncGraphManager : public std::enable_shared_from_this<FuncGra
   void OnEdgeAdded(const AnfNodePtr &node, int index, const AnfNodePtr &input);
   void OnEdgeRemoved(const AnfNodePtr &node, int index, const AnfNodePtr &input);
   void MoveAllNodes(const FuncGraphPtr &source, const FuncGraphPtr &target);
+  void RenewChangeVersion(const FuncGraphPtr &fg);
 
   FuncGraphSet roots_;        // Managed roots.
   FuncGraphSet func_graphs_;  // Managed func graphs.
@@ -373,6 +397,8 @@ class MS_CORE_API FuncGraphManager : public std::enable_shared_from_this<FuncGra
   std::shared_ptr<RecursiveComputer> recursive_;
   std::shared_ptr<FuncGraphMetaFgPrimTotalComputer> meta_fg_prim_total_;
 
+  mindspore::HashMap<const FuncGraph *, size_t> change_versions_;
+
   bool is_manage_;
 };
 
@@ -489,6 +489,52 @@ class CompressionTensorData : public TensorDataImpl<T> {
   ~CompressionTensorData() override = default;
 };
 
+// TensorExternalData provides tensor data from the buffer of other frameworks without copy, and the buffer is released
+// by the deleter when the tensor data is destroyed.
+template <typename T>
+class TensorExternalData : public TensorData {
+ public:
+  TensorExternalData(const ShapeVector &shape, void *data, const TensorDataDeleter &deleter)
+      : ndim_(shape.size()), data_size_(SizeOf(shape)), data_(data), deleter_(deleter) {
+    if (data_ == nullptr) {
+      MS_LOG(EXCEPTION) << "The external data of tensor is nullptr.";
+    }
+  }
+
+  ~TensorExternalData() override {
+    if (deleter_ != nullptr) {
+      deleter_(data_);
+    }
+  }
+
+  ssize_t size() const override { return static_cast<ssize_t>(data_size_); }
+
+  ssize_t itemsize() const override { return static_cast<ssize_t>(sizeof(T)); }
+
+  ssize_t nbytes() const override { return size() * itemsize(); }
+
+  ssize_t ndim() const override { return static_cast<ssize_t>(ndim_); }
+
+  bool is_sub_data() const override { return false; }
+
+  bool has_sub_data() const override { return false; }
+
+  void *data() override { return data_; }
+
+  const void *const_data() const override { return data_; }
+
+  std::string ToString(TypeId type, const ShapeVector &shape, bool use_comma) const override {
+    TensorStringifier<T> stringifier{static_cast<const T *>(data_), data_size_, ndim_};
+    return stringifier.ToString(type, shape, use_comma);
+  }
+
+ private:
+  size_t ndim_{0};
+  size_t data_size_{0};
+  void *data_{nullptr};
+  TensorDataDeleter deleter_{nullptr};
+};
+
 // TensorSubData is the base class to provide tensor data as a segment from an owner tensor data.
 class TensorSubData : public TensorData {
  public:
@@ -634,7 +680,10 @@ Tensor::Tensor(const Tensor &tensor, TypeId data_type)
     : MetaTensor(data_type, tensor.shape_),
       init_flag_(tensor.init_flag_),
       is_forward_output_(tensor.is_forward_output_),
-      data_(MakeTensorData(data_type, tensor.shape_, tensor.data_->data(), tensor.data_type_)),
+      // Share the tensor data as the copy constructor does if the data type is not changed.
+      data_(tensor.data_type_ != data_type ? MakeTensorData(data_type, tensor.shape_, tensor.data_->data(),
+                                                            tensor.data_type_)
+                                           : tensor.data_),
       id_(tensor.data_type_ != data_type ? MakeId() : tensor.id_),
       event_(tensor.event_),
       need_wait_(tensor.need_wait_),
@@ -663,6 +712,9 @@ Tensor::Tensor(TypeId data_type, const ShapeVector &shape, void *data, size_t da
 Tensor::Tensor(TypeId data_type, const ShapeVector &shape, void *data, TypeId src_data_type)
     : Tensor(data_type, shape, MakeTensorData(data_type, shape, data, src_data_type)) {}
 
+Tensor::Tensor(TypeId data_type, const ShapeVector &shape, void *data, const TensorDataDeleter &deleter)
+    : Tensor(data_type, shape, MakeTensorData<TensorExternalData>(data_type, shape, data, deleter)) {}
+
 Tensor::Tensor(const std::vector<int64_t> &input, const TypePtr &data_type)
     : MetaTensor(TypeIdOf(data_type, kNumberTypeInt64), {static_cast<int>(input.size())}),
       data_(MakeTensorData(data_type_, shape_, input.data(), input.size())),
@@ -18,6 +18,7 @@
 #define MINDSPORE_CORE_IR_TENSOR_H_
 
 #include <memory>
+#include <functional>
 #include <string>
 #include <vector>
 #include <numeric>
@@ -127,6 +128,8 @@ class MS_CORE_API TensorData {
 };
 
 using TensorDataPtr = std::shared_ptr<TensorData>;
+// The deleter to release the external buffer which is shared by the tensor.
+using TensorDataDeleter = std::function<void(void *)>;
 
 class WaitEvent : public ExceptionListener {
  public:
@@ -209,6 +212,14 @@ class MS_CORE_API Tensor final : public MetaTensor {
   /// \param[in] src_data_type The source data type.
   Tensor(TypeId data_type, const ShapeVector &shape, void *data, TypeId src_data_type);
 
+  /// \brief Create a tensor sharing the external data buffer without copy.
+  ///
+  /// \param[in] data_type [TypeId] Data type of the tensor.
+  /// \param[in] shape The shape represented by ShapeVector of the tensor.
+  /// \param[in] data The external data buffer in row-major order, which must be alive until the deleter is called.
+  /// \param[in] deleter The deleter called with the data when the tensor data is destroyed, it can be nullptr.
+  Tensor(TypeId data_type, const ShapeVector &shape, void *data, const TensorDataDeleter &deleter);
+
   /// \brief Create 1 dimension tensor from an int vector.
   ///
   /// \param[in] input [std::vector<int64_t>] the data for tensor.
@@ -32,6 +32,7 @@
 #include "ir/dtype/ref.h"
 #include "utils/hashing.h"
 #include "utils/ms_utils.h"
+#include "utils/node_pool.h"
 
 namespace mindspore {
 /// \brief ValueSequence defines a Value class whose type is Sequence.
@@ -582,10 +583,10 @@ std::vector<U> GetValue(const ValuePtr &value) {
   return rets;
 }
 
-inline ValueNodePtr NewValueNode(const ValuePtr &t) { return std::make_shared<ValueNode>(t); }
+inline ValueNodePtr NewValueNode(const ValuePtr &t) { return MakePooledShared<ValueNode>(t); }
 
 inline ValueNodePtr NewValueNode(const ValuePtr &t, NodeDebugInfoPtr &&debug_info) {
-  return std::make_shared<ValueNode>(t, std::move(debug_info));
+  return MakePooledShared<ValueNode>(t, std::move(debug_info));
 }
 
 template <typename T, typename _ = typename std::enable_if<!std::is_base_of<Value, T>::value>::type>
@@ -493,48 +493,27 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
   if (!tensor_proto.has_external_data()) {
     return false;
   }
+  auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor_info->data_c());
+  MS_EXCEPTION_IF_NULL(tensor_data_buf);
+  const auto &location = tensor_proto.external_data().location();
+  if (mindir_dec_key_ == nullptr) {
+    return ReadTensorDataFromExternalFile(tensor_proto, tensor_data_buf, tensor_info->data().nbytes());
+  }
   const unsigned char *data = nullptr;
-  auto it = tenor_data_.find(tensor_proto.external_data().location());
+  auto it = tenor_data_.find(location);
   if (it != tenor_data_.end()) {
     data = it->second.get();
   } else {
-    std::string file = mindir_path_ + "/" + tensor_proto.external_data().location();
-    if (mindir_dec_key_ != nullptr) {
-      size_t plain_len;
-      auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
-      if (plain_data == nullptr) {
-        MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
-        return false;
-      }
-      data = plain_data.get();
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(), std::move(plain_data));
-    } else {
-      // Read file
-      std::basic_ifstream<char> fid(file, std::ios::in | std::ios::binary);
-      if (!fid) {
-        MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
-      }
-      (void)fid.seekg(0, std::ios_base::end);
-      size_t file_size = static_cast<size_t>(fid.tellg());
-      fid.clear();
-      (void)fid.seekg(0);
-      auto plain_data = std::make_unique<char[]>(file_size);
-      constexpr Byte is_little_endian = 1;
-      constexpr int byte_order_index = 0;
-      (void)fid.read(plain_data.get(), SizeToLong(file_size));
-      fid.close();
-      // if byte order is not same return false
-      if ((plain_data[byte_order_index] == is_little_endian) ^ little_endian()) {
-        MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
-        return false;
-      }
-      data = reinterpret_cast<const unsigned char *>(plain_data.get());
-      (void)tenor_data_.emplace(tensor_proto.external_data().location(),
-                                std::unique_ptr<Byte[]>(reinterpret_cast<Byte *>(plain_data.release())));
+    std::string file = mindir_path_ + "/" + location;
+    size_t plain_len;
+    auto plain_data = Decrypt(&plain_len, file, mindir_dec_key_, mindir_key_size_, mindir_dec_mode_);
+    if (plain_data == nullptr) {
+      MS_LOG(ERROR) << "Decrypt MindIR file failed, please check the correctness of the dec_key or dec_mode.";
+      return false;
     }
+    data = plain_data.get();
+    (void)tenor_data_.emplace(location, std::move(plain_data));
   }
-  auto *tensor_data_buf = reinterpret_cast<uint8_t *>(tensor_info->data_c());
-  MS_EXCEPTION_IF_NULL(tensor_data_buf);
   MS_EXCEPTION_IF_NULL(data);
   auto ret =
     common::huge_memcpy(tensor_data_buf, tensor_info->data().nbytes(), data + tensor_proto.external_data().offset(),
@@ -546,6 +525,45 @@ bool MSANFModelParser::GetTensorDataFromExternal(const mind_ir::TensorProto &ten
   return true;
 }
 
+bool MSANFModelParser::ReadTensorDataFromExternalFile(const mind_ir::TensorProto &tensor_proto,
+                                                      uint8_t *tensor_data_buf, size_t tensor_data_size) {
+  // Only the range of the tensor is read, instead of reading the whole external file into a buffer and copying it to
+  // the tensors again, which doubles the memory of the weights.
+  const auto &location = tensor_proto.external_data().location();
+  auto &fid = external_data_files_[location];
+  if (fid == nullptr) {
+    std::string file = mindir_path_ + "/" + location;
+    fid = std::make_unique<std::ifstream>(file, std::ios::in | std::ios::binary);
+    if (!fid->is_open()) {
+      MS_LOG(EXCEPTION) << "Open file '" << file << "' failed, please check the correct of the file.";
+    }
+    constexpr char is_little_endian = 1;
+    char byte_order = 0;
+    (void)fid->read(&byte_order, sizeof(byte_order));
+    // if byte order is not same return false
+    if (!(*fid) || ((byte_order == is_little_endian) ^ little_endian())) {
+      MS_LOG(ERROR) << "The byte order of export MindIr device and load MindIr device is not same!";
+      (void)external_data_files_.erase(location);
+      return false;
+    }
+  }
+  auto length = LongToSize(tensor_proto.external_data().length());
+  if (length > tensor_data_size) {
+    MS_LOG(ERROR) << "The external data length " << length << " of tensor " << tensor_proto.name()
+                  << " is larger than the tensor size " << tensor_data_size;
+    return false;
+  }
+  fid->clear();
+  (void)fid->seekg(tensor_proto.external_data().offset(), std::ios_base::beg);
+  (void)fid->read(reinterpret_cast<char *>(tensor_data_buf), SizeToLong(length));
+  if (!(*fid)) {
+    MS_LOG(ERROR) << "Read the external data of tensor " << tensor_proto.name() << " from file " << location
+                  << " failed.";
+    return false;
+  }
+  return true;
+}
+
 bool MSANFModelParser::BuildInputForFuncGraph(const ParameterPtr &node, const mind_ir::ValueInfoProto &value_proto) {
   MS_EXCEPTION_IF_NULL(node);
 
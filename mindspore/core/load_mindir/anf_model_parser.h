@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <vector>
+#include <fstream>
 #include "utils/hash_map.h"
 #include "google/protobuf/io/zero_copy_stream_impl.h"
 #include "ir/func_graph.h"
@@ -95,6 +96,8 @@ class MSANFModelParser {
   bool BuildParameterForFuncGraph(const ParameterPtr &node, const mind_ir::TensorProto &parameter_proto);
   bool SetValueForTopGraphParameter(const FuncGraphPtr &topGraph, const std::map<std::string, ValuePtr> &weights);
   bool GetTensorDataFromExternal(const mind_ir::TensorProto &tensor_proto, const tensor::TensorPtr &tensor_info);
+  bool ReadTensorDataFromExternalFile(const mind_ir::TensorProto &tensor_proto, uint8_t *tensor_data_buf,
+                                      size_t tensor_data_size);
   bool BuildInputForFuncGraph(const ParameterPtr &node, const mind_ir::ValueInfoProto &value_proto);
   abstract::AbstractTensorPtr GetAbsTensorFromTensorProto(const mind_ir::TensorProto &tensor_proto);
   CNodePtr BuildCNodeForFuncGraph(const FuncGraphPtr &outputFuncGraph, const mind_ir::NodeProto &node_proto);
@@ -143,6 +146,8 @@ class MSANFModelParser {
   std::string mindir_dec_mode_;
   bool little_endian_ = common::IsLittleByteOrder();
   std::map<std::string, std::unique_ptr<Byte[]>> tenor_data_;
+  // The opened plain external data files, the data of each tensor is read from the file into the tensor directly.
+  std::map<std::string, std::unique_ptr<std::ifstream>> external_data_files_;
   static std::map<std::string, tensor::TensorPtr> load_tensor_map_;
 };
 }  // namespace mindspore
@@ -86,6 +86,14 @@ class MS_CORE_API ActorBase {
   inline void set_actor_mgr(const std::shared_ptr<ActorMgr> &mgr) { actor_mgr_ = mgr; }
   inline std::shared_ptr<ActorMgr> get_actor_mgr() const { return actor_mgr_; }
 
+  // Select the mailbox type before spawning, it takes effect only for the actor which shares the thread pool.
+  inline void set_mailbox_type(MailBoxType mailbox_type) { mailbox_type_ = mailbox_type; }
+  inline MailBoxType mailbox_type() const { return mailbox_type_; }
+
+  // The actor with higher priority runs firstly when several actors are ready in the priority schedule mode.
+  inline void set_priority(int64_t priority) { priority_ = priority; }
+  inline int64_t priority() const { return priority_; }
+
  protected:
   using ActorFunction = std::function<void(const std::unique_ptr<MessageBase> &msg)>;
 
@@ -215,6 +223,8 @@ class MS_CORE_API ActorBase {
 
   ActorThreadPool *pool_{nullptr};
   std::shared_ptr<ActorMgr> actor_mgr_;
+  MailBoxType mailbox_type_{MailBoxType::kNonblocking};
+  int64_t priority_{0};
 };
 using ActorReference = std::shared_ptr<ActorBase>;
 };  // namespace mindspore
@@ -19,6 +19,7 @@
 
 #include <utility>
 #include <string>
+#include <vector>
 
 #include "actor/aid.h"
 
@@ -84,6 +85,10 @@ class MessageBase {
   void *data;
   size_t size;
 
+  // The raw buffers sent right after the data by scatter-gather io without copying them to the message. The buffers
+  // are borrowed from the sender, which must keep them alive until the message is sent or dropped.
+  std::vector<std::pair<void *, size_t>> segments;
+
   Type type;
 };
 }  // namespace mindspore
@@ -19,6 +19,7 @@
 
 #include <tuple>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "actor/actor.h"
@@ -26,6 +27,7 @@
 #include "actor/actormgr.h"
 #include "async/apply.h"
 #include "async/future.h"
+#include "async/object_pool.h"
 
 namespace mindspore {
 using MessageHandler = std::function<void(ActorBase *)>;
@@ -40,7 +42,28 @@ class MessageAsync : public MessageBase {
   MessageHandler handler;
 };
 
+// The async message keeping the handler inline instead of in a std::function, and its memory is recycled by the object
+// pool, which is used by the void methods in the hot path of the actor message passing.
+template <typename F>
+class MessageAsyncCall : public MessageBase {
+ public:
+  explicit MessageAsyncCall(F &&h) : MessageBase("Async", Type::KASYNC), handler(std::move(h)) {}
+  ~MessageAsyncCall() override = default;
+  void Run(ActorBase *actor) override { handler(actor); }
+
+  MINDRT_USE_OBJECT_POOL(MessageAsyncCall<F>)
+
+ private:
+  F handler;
+};
+
 namespace internal {
+template <typename F>
+std::unique_ptr<MessageBase> MakeAsyncMessage(F &&f) {
+  auto msg = std::unique_ptr<MessageBase>(new (std::nothrow) MessageAsyncCall<std::decay_t<F>>(std::forward<F>(f)));
+  MINDRT_OOM_EXIT(msg);
+  return msg;
+}
 
 template <typename R>
 struct AsyncHelper;
@@ -108,27 +131,23 @@ void Async(const AID &aid, void (T::*method)()) {
 
 template <typename T, typename Arg0, typename Arg1>
 void Async(const AID &aid, void (T::*method)(Arg0), Arg1 &&arg) {
-  std::function<void(ActorBase *)> handler = [method, arg](ActorBase *actor) {
+  auto msg = internal::MakeAsyncMessage([method, arg](ActorBase *actor) {
     MINDRT_ASSERT(actor != nullptr);
     T *t = static_cast<T *>(actor);
     MINDRT_ASSERT(t != nullptr);
     (t->*method)(arg);
-  };
-  auto msg = std::unique_ptr<MessageBase>(new (std::nothrow) MessageAsync(std::move(handler)));
-  MINDRT_OOM_EXIT(msg);
+  });
   (void)ActorMgr::GetActorMgrRef()->Send(aid, std::move(msg));
 }
 
 template <typename T, typename... Args0, typename... Args1>
 void Async(const AID &aid, void (T::*method)(Args0...), std::tuple<Args1...> &&tuple) {
-  std::function<void(ActorBase *)> handler = [method, tuple](ActorBase *actor) {
+  auto msg = internal::MakeAsyncMessage([method, tuple](ActorBase *actor) {
     MINDRT_ASSERT(actor != nullptr);
     T *t = static_cast<T *>(actor);
     MINDRT_ASSERT(t != nullptr);
     Apply(t, method, tuple);
-  };
-  auto msg = std::unique_ptr<MessageBase>(new (std::nothrow) MessageAsync(std::move(handler)));
-  MINDRT_OOM_EXIT(msg);
+  });
   (void)ActorMgr::GetActorMgrRef()->Send(aid, std::move(msg));
 }
 
@@ -141,14 +160,12 @@ void Async(const AID &aid, void (T::*method)(Args0...), Args1 &&... args) {
 template <typename T, typename... Args0, typename... Args1>
 void Async(const AID &aid, const std::shared_ptr<ActorMgr> &mgr, void (T::*method)(Args0...),
            std::tuple<Args1...> &&tuple) {
-  std::function<void(ActorBase *)> handler = [method, tuple](ActorBase *actor) {
+  auto msg = internal::MakeAsyncMessage([method, tuple](ActorBase *actor) {
     MINDRT_ASSERT(actor != nullptr);
     T *t = static_cast<T *>(actor);
     MINDRT_ASSERT(t != nullptr);
     Apply(t, method, tuple);
-  };
-  auto msg = std::unique_ptr<MessageBase>(new (std::nothrow) MessageAsync(std::move(handler)));
-  MINDRT_OOM_EXIT(msg);
+  });
   (void)mgr->Send(aid, std::move(msg));
 }
 
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_INCLUDE_ASYNC_OBJECT_POOL_H
+#define MINDSPORE_CORE_MINDRT_INCLUDE_ASYNC_OBJECT_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace mindspore {
+// The pool of the memory blocks for the objects of type T, which are created and destroyed in each message passing,
+// such as the async messages and the mailbox nodes. Each thread keeps its own free list, so a block allocated by the
+// sender thread is recycled by the receiver thread without any lock, and the steady state has no allocator traffic.
+template <typename T>
+class ObjectPool {
+ public:
+  static void *Allocate(const std::nothrow_t &) noexcept {
+    auto &blocks = FreeBlocks();
+    if (alive_ && !blocks.empty()) {
+      void *block = blocks.back();
+      blocks.pop_back();
+      return block;
+    }
+    return ::operator new(sizeof(T), std::nothrow);
+  }
+
+  static void *Allocate() {
+    void *block = Allocate(std::nothrow);
+    if (block == nullptr) {
+      throw std::bad_alloc();
+    }
+    return block;
+  }
+
+  static void Free(void *block) noexcept {
+    if (block == nullptr) {
+      return;
+    }
+    auto &blocks = FreeBlocks();
+    if (!alive_ || blocks.size() >= kMaxFreeBlockNum) {
+      ::operator delete(block);
+      return;
+    }
+    try {
+      blocks.push_back(block);
+    } catch (...) {
+      ::operator delete(block);
+    }
+  }
+
+  // The number of the free blocks cached by the current thread.
+  static size_t FreeBlockNum() { return alive_ ? FreeBlocks().size() : 0; }
+
+ private:
+  // Bound the cached blocks of each thread, as the blocks may drift from the sender threads to the receiver threads.
+  static constexpr size_t kMaxFreeBlockNum = 4096;
+
+  struct FreeBlockList {
+    FreeBlockList() { alive_ = true; }
+    ~FreeBlockList() {
+      // The objects destroyed after the thread local storage, e.g. by the static actor manager, bypass the pool.
+      alive_ = false;
+      for (auto block : blocks_) {
+        ::operator delete(block);
+      }
+    }
+    std::vector<void *> blocks_;
+  };
+
+  static std::vector<void *> &FreeBlocks() {
+    thread_local FreeBlockList free_block_list;
+    return free_block_list.blocks_;
+  }
+
+  static thread_local bool alive_;
+};
+
+template <typename T>
+thread_local bool ObjectPool<T>::alive_ = false;
+
+// Route the new and delete of the class T to the object pool, the derived classes of other size use the global heap.
+#define MINDRT_USE_OBJECT_POOL(T)                                                                  \
+  static void *operator new(size_t size) {                                                         \
+    return size == sizeof(T) ? mindspore::ObjectPool<T>::Allocate() : ::operator new(size);        \
+  }                                                                                                \
+  static void *operator new(size_t size, const std::nothrow_t &tag) noexcept {                     \
+    return size == sizeof(T) ? mindspore::ObjectPool<T>::Allocate(tag) : ::operator new(size, tag); \
+  }                                                                                                \
+  static void operator delete(void *ptr, size_t size) noexcept {                                   \
+    if (size == sizeof(T)) {                                                                       \
+      mindspore::ObjectPool<T>::Free(ptr);                                                         \
+    } else {                                                                                       \
+      ::operator delete(ptr);                                                                      \
+    }                                                                                              \
+  }
+}  // namespace mindspore
+
+#endif
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "actor/mailbox.h"
+#include <thread>
 
 namespace mindspore {
 int BlockingMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
@@ -85,4 +86,62 @@ std::unique_ptr<MessageBase> HQueMailBox::GetMsg() {
   std::unique_ptr<MessageBase> msg(mailbox.Dequeue());
   return msg;
 }
+
+LockFreeMailBox::~LockFreeMailBox() {
+  while (auto msg = Dequeue()) {
+    delete msg;
+  }
+  if (tail_ != &stub_) {
+    delete tail_;
+  }
+  tail_ = nullptr;
+}
+
+int LockFreeMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  auto node = new (std::nothrow) Node();
+  MINDRT_OOM_EXIT(node);
+  node->msg_ = msg.release();
+  // Count the message before it is linked, so the consumer never releases the actor with a message in flight.
+  auto count = msg_count_.fetch_add(1, std::memory_order_acq_rel);
+  auto prev = head_.exchange(node, std::memory_order_acq_rel);
+  prev->next_.store(node, std::memory_order_release);
+  if (count == 0 && notifyHook) {
+    (*notifyHook.get())();
+  }
+  return 0;
+}
+
+MessageBase *LockFreeMailBox::Dequeue() {
+  auto tail = tail_;
+  auto next = tail->next_.load(std::memory_order_acquire);
+  if (next == nullptr) {
+    return nullptr;
+  }
+  // The dequeued node becomes the new dummy tail, and the previous one can be freed.
+  tail_ = next;
+  auto msg = next->msg_;
+  next->msg_ = nullptr;
+  if (tail != &stub_) {
+    delete tail;
+  }
+  return msg;
+}
+
+std::unique_ptr<MessageBase> LockFreeMailBox::GetMsg() {
+  while (true) {
+    auto msg = Dequeue();
+    if (msg != nullptr) {
+      ++consumed_count_;
+      return std::unique_ptr<MessageBase>(msg);
+    }
+    auto remain_count = msg_count_.fetch_sub(consumed_count_, std::memory_order_acq_rel) - consumed_count_;
+    consumed_count_ = 0;
+    if (remain_count == 0) {
+      // Released, the next enqueued message notifies the actor again.
+      return nullptr;
+    }
+    // Some producer has counted its message but not linked it yet.
+    std::this_thread::yield();
+  }
+}
 }  // namespace mindspore
@@ -16,6 +16,7 @@
 
 #ifndef MINDSPORE_MAILBOX_H
 #define MINDSPORE_MAILBOX_H
+#include <atomic>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -23,9 +24,13 @@
 #include <functional>
 #include <utility>
 #include "actor/msg.h"
+#include "async/object_pool.h"
 #include "thread/hqueue.h"
 
 namespace mindspore {
+// The mailbox type of the actor which shares the threads of actor thread pool.
+enum class MailBoxType { kNonblocking = 0, kLockFree };
+
 class MailBox {
  public:
   virtual ~MailBox() = default;
@@ -94,6 +99,35 @@ class HQueMailBox : public MailBox {
   HQueue<MessageBase> mailbox;
   static const int32_t MAX_MSG_QUE_SIZE = 4096;
 };
+
+// The multi-producer single-consumer mailbox based on the lock-free linked list, the producers never block each other
+// and the consumer takes one message each time. The actor is notified only when the message count increases from zero,
+// and it is released only when all the counted messages are consumed.
+class LockFreeMailBox : public MailBox {
+ public:
+  LockFreeMailBox() : head_(&stub_), tail_(&stub_) { takeAllMsgsEachTime = false; }
+  ~LockFreeMailBox() override;
+  int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
+  std::list<std::unique_ptr<MessageBase>> *GetMsgs() override { return nullptr; }
+  std::unique_ptr<MessageBase> GetMsg() override;
+
+ private:
+  struct Node {
+    std::atomic<Node *> next_{nullptr};
+    MessageBase *msg_{nullptr};
+
+    MINDRT_USE_OBJECT_POOL(Node)
+  };
+  MessageBase *Dequeue();
+
+  // The producers append the node at the head, and the consumer takes the node from the tail.
+  std::atomic<Node *> head_;
+  Node stub_;
+  Node *tail_;
+  std::atomic<int64_t> msg_count_{0};
+  // The messages taken by the consumer since the last release check, only accessed by the consumer.
+  int64_t consumed_count_{0};
+};
 }  // namespace mindspore
 
 #endif  // MINDSPORE_MAILBOX_H
@@ -22,11 +22,20 @@
 
 namespace mindspore {
 size_t ActorThreadPool::actor_queue_size_ = kMaxHqueueSize;
+bool ActorThreadPool::enable_work_stealing_ = false;
+bool ActorThreadPool::enable_priority_schedule_ = false;
+namespace {
+// The actor thread pool and worker id of current actor thread.
+thread_local ActorThreadPool *current_actor_pool = nullptr;
+thread_local size_t current_actor_worker_id = 0;
+}  // namespace
 
 void ActorWorker::CreateThread() { thread_ = std::thread(&ActorWorker::RunWithSpin, this); }
 
 void ActorWorker::RunWithSpin() {
   SetAffinity();
+  current_actor_pool = reinterpret_cast<ActorThreadPool *>(pool_);
+  current_actor_worker_id = worker_id_;
 #if !defined(__APPLE__) && !defined(SUPPORT_MSVC)
   static std::atomic_int index = {0};
   (void)pthread_setname_np(pthread_self(), ("ActorThread_" + std::to_string(index++)).c_str());
@@ -39,11 +48,13 @@ void ActorWorker::RunWithSpin() {
   while (alive_) {
     // only run either local KernelTask or PoolQueue ActorTask
     if (RunLocalKernelTask() || RunQueueActorTask()) {
+      UpdateSpinBudget();
       spin_count_ = 0;
     } else {
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > spin_budget()) {
+      parked_ = true;
       WaitUntilActive();
       spin_count_ = 1;
     }
@@ -54,7 +65,7 @@ bool ActorWorker::RunQueueActorTask() {
   if (pool_ == nullptr) {
     return false;
   }
-  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorFromQueue();
+  auto actor = reinterpret_cast<ActorThreadPool *>(pool_)->PopActorForWorker(worker_id_);
   if (actor == nullptr) {
     return false;
   }
@@ -81,14 +92,7 @@ ActorThreadPool::~ActorThreadPool() {
   bool terminate = false;
   int count = 0;
   do {
-    {
-#ifdef USE_HQUEUE
-      terminate = actor_queue_.Empty();
-#else
-      std::lock_guard<std::mutex> _l(actor_mutex_);
-      terminate = actor_queue_.empty();
-#endif
-    }
+    terminate = ActorQueuesEmpty();
     if (!terminate) {
       for (auto &worker : workers_) {
         worker->Active();
@@ -106,7 +110,60 @@ ActorThreadPool::~ActorThreadPool() {
 #endif
 }
 
+bool ActorThreadPool::ActorQueuesEmpty() {
+  if (priority_schedule_) {
+    std::lock_guard<std::mutex> _l(actor_mutex_);
+    return priority_actor_queue_.empty();
+  }
+  for (const auto &local_actor_queue : local_actor_queues_) {
+    if (!local_actor_queue->Empty()) {
+      return false;
+    }
+  }
+#ifdef USE_HQUEUE
+  return actor_queue_.Empty();
+#else
+  std::lock_guard<std::mutex> _l(actor_mutex_);
+  return actor_queue_.empty();
+#endif
+}
+
+ActorBase *ActorThreadPool::PopActorForWorker(size_t worker_id) {
+  if (local_actor_queues_.empty()) {
+    return PopActorFromQueue();
+  }
+  if (worker_id < local_actor_queues_.size()) {
+    auto actor = local_actor_queues_[worker_id]->Pop();
+    if (actor != nullptr) {
+      return actor;
+    }
+  }
+  auto actor = PopActorFromQueue();
+  if (actor != nullptr) {
+    return actor;
+  }
+  // Steal from the neighbours firstly.
+  size_t queue_num = local_actor_queues_.size();
+  for (size_t i = 1; i < queue_num; ++i) {
+    actor = local_actor_queues_[(worker_id + i) % queue_num]->Steal();
+    if (actor != nullptr) {
+      THREAD_DEBUG("actor[%s] is stolen by worker %zu", actor->GetAID().Name().c_str(), worker_id);
+      return actor;
+    }
+  }
+  return nullptr;
+}
+
 ActorBase *ActorThreadPool::PopActorFromQueue() {
+  if (priority_schedule_) {
+    std::lock_guard<std::mutex> _l(actor_mutex_);
+    if (priority_actor_queue_.empty()) {
+      return nullptr;
+    }
+    auto actor = priority_actor_queue_.top();
+    priority_actor_queue_.pop();
+    return actor;
+  }
 #ifdef USE_HQUEUE
   return actor_queue_.Dequeue();
 #else
@@ -124,7 +181,14 @@ void ActorThreadPool::PushActorToQueue(ActorBase *actor) {
   if (!actor) {
     return;
   }
-  {
+  if (priority_schedule_) {
+    std::lock_guard<std::mutex> _l(actor_mutex_);
+    priority_actor_queue_.push(actor);
+  } else if (current_actor_pool == this && current_actor_worker_id < local_actor_queues_.size() &&
+             local_actor_queues_[current_actor_worker_id]->Push(actor)) {
+    THREAD_DEBUG("actor[%s] enqueue to local deque of worker %zu", actor->GetAID().Name().c_str(),
+                 current_actor_worker_id);
+  } else {
 #ifdef USE_HQUEUE
     while (!actor_queue_.Enqueue(actor)) {
     }
@@ -174,6 +238,15 @@ int ActorThreadPool::CreateThreads(size_t actor_thread_num, size_t all_thread_nu
   if (TaskQueuesInit(total_thread_num) != THREAD_OK) {
     return THREAD_ERROR;
   }
+  // The priority of ready actors is global, so it is exclusive with the local deques of work stealing.
+  priority_schedule_ = enable_priority_schedule_;
+  // The local deques must be ready before the actor threads start to run.
+  if (!priority_schedule_ && enable_work_stealing_ && actor_thread_num_ > 1) {
+    for (size_t i = 0; i < actor_thread_num_; ++i) {
+      local_actor_queues_.emplace_back(std::make_unique<WorkStealingDeque<ActorBase>>(actor_queue_size_));
+    }
+    THREAD_INFO("Enable work stealing of actor threads.");
+  }
 
   if (ThreadPool::CreateThreads<ActorWorker>(actor_thread_num_, core_list) != THREAD_OK) {
     return THREAD_ERROR;
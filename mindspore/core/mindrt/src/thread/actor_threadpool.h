@@ -19,6 +19,7 @@
 
 #include <queue>
 #include <vector>
+#include <memory>
 #include <mutex>
 #include <atomic>
 #include <condition_variable>
@@ -26,6 +27,7 @@
 #include "thread/core_affinity.h"
 #include "actor/actor.h"
 #include "thread/hqueue.h"
+#include "thread/work_stealing_deque.h"
 #ifndef USE_HQUEUE
 #define USE_HQUEUE
 #endif
@@ -58,10 +60,19 @@ class ActorThreadPool : public ThreadPool {
   ~ActorThreadPool() override;
 
   static void set_actor_queue_size(size_t actor_queue_size) { actor_queue_size_ = actor_queue_size; }
+  // In work stealing mode, the actor enqueued by the actor thread is pushed to its local deque and runs on it firstly,
+  // and the idle actor threads steal the actors from the local deques of the busy ones.
+  static void set_enable_work_stealing(bool enable_work_stealing) { enable_work_stealing_ = enable_work_stealing; }
+  // In priority schedule mode, the ready actors are dequeued in the order of actor priority instead of FIFO.
+  static void set_enable_priority_schedule(bool enable_priority_schedule) {
+    enable_priority_schedule_ = enable_priority_schedule;
+  }
 
   virtual int ActorQueueInit();
   virtual void PushActorToQueue(ActorBase *actor);
   virtual ActorBase *PopActorFromQueue();
+  // Pop the actor for the actor thread, in the order of local deque, global queue and stealing from the others.
+  ActorBase *PopActorForWorker(size_t worker_id);
 
  protected:
   ActorThreadPool() = default;
@@ -76,9 +87,22 @@ class ActorThreadPool : public ThreadPool {
 
  private:
   int CreateThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list);
+  bool ActorQueuesEmpty();
+
+  struct ActorPriorityCompare {
+    bool operator()(const ActorBase *lhs, const ActorBase *rhs) const { return lhs->priority() < rhs->priority(); }
+  };
+  // The ready actors in priority schedule mode, guarded by actor_mutex_.
+  bool priority_schedule_{false};
+  std::priority_queue<ActorBase *, std::vector<ActorBase *>, ActorPriorityCompare> priority_actor_queue_;
+
+  // The local deques of actor threads, indexed by the worker id.
+  std::vector<std::unique_ptr<WorkStealingDeque<ActorBase>>> local_actor_queues_;
 
   // Support to set the size of actor queue.
   static size_t actor_queue_size_;
+  static bool enable_work_stealing_;
+  static bool enable_priority_schedule_;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_MINDRT_RUNTIME_ACTOR_THREADPOOL_H_
@@ -27,6 +27,8 @@
 #include "thread/threadpool.h"
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <unistd.h>
 #endif
 
 namespace mindspore {
@@ -215,6 +217,23 @@ int GetMaxFrequency(int core_id) {
   return max_freq;
 }
 
+int GetNumaNode(int core_id) {
+#if defined(__linux__) || defined(__ANDROID__)
+  constexpr int kMaxNumaNodeNum = 64;
+  for (int node = 0; node < kMaxNumaNodeNum; ++node) {
+    std::string node_dir = "/sys/devices/system/node/node" + std::to_string(node);
+    if (access(node_dir.c_str(), F_OK) != 0) {
+      break;
+    }
+    std::string core_link = node_dir + "/cpu" + std::to_string(core_id);
+    if (access(core_link.c_str(), F_OK) == 0) {
+      return node;
+    }
+  }
+#endif
+  return -1;
+}
+
 float CoreAffinity::GetServerFrequency() {
   float max_freq = -1.0f;
 #ifdef PARALLEL_INFERENCE
@@ -325,6 +344,30 @@ std::vector<int> CoreAffinity::GetCoreId(size_t thread_num, BindMode bind_mode)
 #endif
   return bind_id;
 }
+
+std::vector<int> CoreAffinity::GetClusterCoreId(CoreCluster cluster) const {
+  std::vector<int> core_list;
+#ifdef BIND_CORE
+  if (sorted_id_.empty() || core_num_ != sorted_id_.size()) {
+    THREAD_ERROR("init sorted core id failed");
+    return core_list;
+  }
+  int max_freq = core_freq_[sorted_id_.front()];
+  int min_freq = core_freq_[sorted_id_.back()];
+  for (int core_id : sorted_id_) {
+    int freq = core_freq_[core_id];
+    if ((cluster == Cluster_Big && freq == max_freq) || (cluster == Cluster_Little && freq == min_freq) ||
+        (cluster == Cluster_Middle && freq != max_freq && freq != min_freq)) {
+      core_list.push_back(core_id);
+    }
+  }
+  if (core_list.empty() && cluster == Cluster_Middle) {
+    return GetClusterCoreId(Cluster_Big);
+  }
+#endif
+  return core_list;
+}
+
 void CoreAffinity::SetCoreId(const std::vector<int> &core_list) { bind_id_ = core_list; }
 
 int CoreAffinity::InitBindCoreId(size_t thread_num, BindMode bind_mode) {
@@ -381,32 +424,34 @@ int CoreAffinity::FreeScheduleThreads(const std::vector<Worker *> &workers) {
     if (ret != THREAD_OK) {
       return THREAD_ERROR;
     }
+    worker->set_numa_node(-1);
   }
 #endif  // BIND_CORE
   return THREAD_OK;
 }
 
-int CoreAffinity::BindThreadsToCoreList(const std::vector<Worker *> &workers) {
+int CoreAffinity::BindThreadsToCoreList(const std::vector<Worker *> &workers, const std::vector<int> &core_list) {
 #ifdef _WIN32
   return THREAD_OK;
 #elif defined(BIND_CORE)
-  if (bind_id_.empty()) {
+  if (core_list.empty()) {
     THREAD_ERROR("bind id is empty");
     return THREAD_ERROR;
   }
-  size_t window = bind_id_.size();
+  size_t window = core_list.size();
   size_t thread_num = workers.size();
   for (size_t i = 0; i < thread_num; ++i) {
     cpu_set_t mask;
     CPU_ZERO(&mask);
-    CPU_SET(bind_id_[i % window], &mask);
+    CPU_SET(core_list[i % window], &mask);
     // affinity mask determines the CPU core which it is eligible to run
     int ret = SetAffinity(workers[i]->handle(), &mask);
     if (ret != THREAD_OK) {
       return THREAD_ERROR;
     }
-    THREAD_INFO("set thread[%zu] affinity to core[%d] success", i, bind_id_[i % window]);
-    workers[i]->set_frequency(core_freq_[bind_id_[i]]);
+    THREAD_INFO("set thread[%zu] affinity to core[%d] success", i, core_list[i % window]);
+    workers[i]->set_frequency(core_freq_[core_list[i % window]]);
+    workers[i]->set_numa_node(GetNumaNode(core_list[i % window]));
   }
 #endif  // BIND_CORE
   return THREAD_OK;
@@ -447,13 +492,22 @@ int CoreAffinity::BindThreads(const std::vector<Worker *> &workers, BindMode bin
   if (bind_mode == Power_NoBind) {
     return FreeScheduleThreads(workers);
   } else {
-    return BindThreadsToCoreList(workers);
+    return BindThreadsToCoreList(workers, bind_id_);
   }
 }
 
 int CoreAffinity::BindThreads(const std::vector<Worker *> &workers, const std::vector<int> &core_list) {
   // the size of core_list doesn't have to be the same as the size of workers(thread_num)
   bind_id_ = core_list;
-  return BindThreadsToCoreList(workers);
+  return BindThreadsToCoreList(workers, bind_id_);
+}
+
+int CoreAffinity::BindThreadsToCluster(const std::vector<Worker *> &workers, CoreCluster cluster) {
+  auto core_list = GetClusterCoreId(cluster);
+  if (core_list.empty()) {
+    THREAD_ERROR("no core in cluster %d", static_cast<int>(cluster));
+    return THREAD_ERROR;
+  }
+  return BindThreadsToCoreList(workers, core_list);
 }
 }  // namespace mindspore
@@ -37,6 +37,12 @@ enum BindMode {
   Power_Higher = 1,
   Power_Middle = 2,
 };
+// the cores are grouped to the clusters by the max frequency
+enum CoreCluster {
+  Cluster_Big = 0,     // the cores with the highest frequency
+  Cluster_Middle = 1,  // the cores between the highest and the lowest frequency, the big cores if no such cores
+  Cluster_Little = 2,  // the cores with the lowest frequency
+};
 #define PARSE_CPU_GAP 3
 #define PARSE_CPU_DEC 10
 #define PARSE_CPU_HEX 16
@@ -44,6 +50,8 @@ enum BindMode {
 #ifdef _WIN32
 void SetWindowsSelfAffinity(uint64_t core_id);
 #endif
+// get the numa node of the core from the system files, -1 if unknown
+int GetNumaNode(int core_id);
 
 class Worker;
 class CoreAffinity {
@@ -55,8 +63,10 @@ class CoreAffinity {
 
   int BindThreads(const std::vector<Worker *> &workers, const std::vector<int> &core_list);
   int BindThreads(const std::vector<Worker *> &workers, BindMode bind_mode);
+  int BindThreadsToCluster(const std::vector<Worker *> &workers, CoreCluster cluster);
   int BindProcess(BindMode bind_mode);
   std::vector<int> GetCoreId(size_t thread_num, BindMode bind_mode) const;
+  std::vector<int> GetClusterCoreId(CoreCluster cluster) const;
   void SetCoreId(const std::vector<int> &core_list);
   static float GetServerFrequency();
 
@@ -69,7 +79,7 @@ class CoreAffinity {
 
   int InitBindCoreId(size_t thread_num, BindMode bind_mode);
 
-  int BindThreadsToCoreList(const std::vector<Worker *> &workers);
+  int BindThreadsToCoreList(const std::vector<Worker *> &workers, const std::vector<int> &core_list);
   int FreeScheduleThreads(const std::vector<Worker *> &workers);
 
   // bind_id contains the CPU cores to bind
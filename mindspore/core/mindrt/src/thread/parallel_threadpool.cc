@@ -38,11 +38,16 @@ void ParallelWorker::Run() {
   while (alive_) {
     // only run either local KernelTask or PoolQueue ActorTask
     if (RunLocalKernelTask() || RunQueueActorTask()) {
+      UpdateSpinBudget();
       spin_count_ = 0;
     } else {
-      if (++spin_count_ > max_spin_count_) {
+      if (spin_count_ == 0) {
+        MarkIdleStart();
+      }
+      if (++spin_count_ > spin_budget()) {
+        parked_ = true;
         WaitUntilActive();
-        spin_count_ = 0;
+        spin_count_ = 1;
       } else {
         std::this_thread::yield();
       }
@@ -85,6 +85,7 @@ void Worker::InitWorkerMask(const std::vector<int> &core_list, const size_t work
     CPU_SET(core_list[workers_size % core_list.size()], &mask);
   }
   this->set_mask(mask);
+  numa_node_ = GetNumaNode(core_list[workers_size % core_list.size()]);
 #endif
   return;
 }
@@ -102,18 +103,51 @@ void Worker::Run() {
 #endif
   while (alive_) {
     if (RunLocalKernelTask()) {
+      UpdateSpinBudget();
       spin_count_ = 0;
     } else {
       RunOtherKernelTask();
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (spin_count_ > spin_budget()) {
+      parked_ = true;
       WaitUntilActive();
       spin_count_ = 1;
     }
   }
 }
 
+void Worker::MarkIdleStart() {
+  if (adaptive_spin_) {
+    idle_start_ = std::chrono::steady_clock::now();
+    parked_ = false;
+  }
+}
+
+// The spin budget covers the expected idle gap, so the task arriving soon is taken without the wake-up latency, and
+// the worker parks at once when the gaps are longer than the max spin count. The gap is counted in spins, which is
+// converted from the idle time by the spin speed learned when the task arrives during spinning.
+void Worker::UpdateSpinBudget() {
+  if (!adaptive_spin_ || spin_count_ == 0) {
+    return;
+  }
+  auto idle_ns = std::chrono::duration<float, std::nano>(std::chrono::steady_clock::now() - idle_start_).count();
+  float gap_spins;
+  if (!parked_) {
+    gap_spins = static_cast<float>(spin_count_);
+    auto cur_ns_per_spin = idle_ns / spin_count_;
+    ns_per_spin_ =
+      ns_per_spin_ > 0 ? ns_per_spin_ + kIdleGapWeight * (cur_ns_per_spin - ns_per_spin_) : cur_ns_per_spin;
+  } else {
+    gap_spins = ns_per_spin_ > 0 ? idle_ns / ns_per_spin_ : kSpinBudgetMargin * max_spin_count_;
+  }
+  idle_gap_spins_ += kIdleGapWeight * (gap_spins - idle_gap_spins_);
+  auto expected_spins = idle_gap_spins_ * kSpinBudgetMargin;
+  adaptive_spin_count_ = expected_spins <= max_spin_count_ ? std::max(static_cast<int>(expected_spins), kMinSpinCount)
+                                                           : kMinSpinCount;
+  parked_ = false;
+}
+
 bool Worker::TryRunTask(TaskSplit *task_split) {
   if (task_split == nullptr) {
     return false;
@@ -144,16 +178,28 @@ bool Worker::RunLocalKernelTask() {
 }
 
 void Worker::RunOtherKernelTask() {
-  if (pool_ == nullptr || pool_->actor_thread_num() <= kMinActorRunOther) {
+  if (pool_ == nullptr) {
+    return;
+  }
+  bool steal = pool_->kernel_task_steal();
+  if (!steal && pool_->actor_thread_num() <= kMinActorRunOther) {
     return;
   }
+  // the queues of the workers on the same numa node are visited in the first round, whose task splits are more likely
+  // to access the local memory.
+  bool numa_first = steal && numa_node_ >= 0;
   auto queues_length = pool_->task_queues().size();
-  for (size_t i = 0; i < queues_length; ++i) {
-    size_t index = (worker_id_ + i + 1) % queues_length;
-    while (!pool_->task_queues()[index]->Empty()) {
-      auto task_split = pool_->task_queues()[index]->Dequeue();
-      if (TryRunTask(task_split)) {
-        return;
+  for (int round = numa_first ? 0 : 1; round < 2; ++round) {
+    for (size_t i = 0; i < queues_length; ++i) {
+      size_t index = (worker_id_ + i + 1) % queues_length;
+      if (numa_first && (pool_->worker_numa_node(index) == numa_node_) != (round == 0)) {
+        continue;
+      }
+      while (!pool_->task_queues()[index]->Empty()) {
+        auto task_split = pool_->task_queues()[index]->Dequeue();
+        if (TryRunTask(task_split)) {
+          return;
+        }
       }
     }
   }
@@ -162,6 +208,7 @@ void Worker::RunOtherKernelTask() {
 void Worker::YieldAndDeactive() {
   // deactivate this worker only on the first entry
   if (spin_count_ == 0) {
+    MarkIdleStart();
     std::lock_guard<std::mutex> _l(mutex_);
     if (local_task_queue_->Empty()) {
       status_.store(kThreadIdle);
@@ -328,6 +375,13 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
     }
   }
 
+  if (kernel_task_steal_) {
+    // the same task splits are assigned to the same numa node in each launch, so the data first touched by the
+    // previous kernels is mostly local.
+    std::stable_sort(assigned.begin(), assigned.end(),
+                     [](const Worker *lhs, const Worker *rhs) { return lhs->numa_node() < rhs->numa_node(); });
+  }
+
   if (use_curr) {
     assigned.push_back(curr);
     sum_frequency += curr->frequency();
@@ -485,6 +539,25 @@ void ThreadPool::SetMaxSpinCount(int spin_count) {
   max_spin_count_ = spin_count;
 }
 
+void ThreadPool::SetAdaptiveSpin(bool adaptive_spin) {
+  for (auto worker : workers_) {
+    THREAD_RETURN_IF_NULL(worker);
+    worker->set_adaptive_spin(adaptive_spin);
+  }
+}
+
+int ThreadPool::SetThreadGroupAffinity(size_t start, size_t end, CoreCluster cluster) {
+  if (start >= end || end > workers_.size()) {
+    THREAD_ERROR("invalid thread group [%zu, %zu) of %zu workers.", start, end, workers_.size());
+    return THREAD_ERROR;
+  }
+  if (affinity_ == nullptr) {
+    return THREAD_OK;
+  }
+  std::vector<Worker *> group(workers_.begin() + start, workers_.begin() + end);
+  return affinity_->BindThreadsToCluster(group, cluster);
+}
+
 void ThreadPool::SetMinSpinCount(int spin_count) {
   if (spin_count <= 0) {
     return;
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CORE_MINDRT_RUNTIME_THREADPOOL_H_
 #define MINDSPORE_CORE_MINDRT_RUNTIME_THREADPOOL_H_
 
+#include <algorithm>
 #include <queue>
 #include <new>
 #include <vector>
@@ -24,6 +25,7 @@
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <functional>
@@ -48,6 +50,8 @@ constexpr int kDefaultFrequency = 1;
 constexpr float kMaxScale = 1.;
 constexpr size_t kMaxHqueueSize = 8192;
 constexpr size_t kMinActorRunOther = 2;
+constexpr float kSpinBudgetMargin = 2.0f;
+constexpr float kIdleGapWeight = 0.125f;
 /* Thread status */
 constexpr int kThreadBusy = 0;  // busy, the thread is running task
 constexpr int kThreadHeld = 1;  // held, the thread has been marked as occupied
@@ -94,11 +98,17 @@ class Worker {
   bool TryRunTask(TaskSplit *task_split);
   // set max spin count before running
   void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
+  // learn the spin count before parking from the idle gaps between the tasks, bounded by the max spin count
+  void set_adaptive_spin(bool adaptive_spin) { adaptive_spin_ = adaptive_spin; }
+  int spin_budget() const { return adaptive_spin_ ? std::min(adaptive_spin_count_, max_spin_count_) : max_spin_count_; }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
   void InitLocalTaskQueue(HQueue<TaskSplit> *task_queue) { local_task_queue_ = task_queue; }
 
   void set_frequency(int frequency) { frequency_ = frequency; }
   int frequency() const { return frequency_; }
+  // the numa node of the core which the worker is bound to, -1 if the worker isn't bound
+  void set_numa_node(int numa_node) { numa_node_ = numa_node; }
+  int numa_node() const { return numa_node_; }
 
   void set_scale(float lhs_scale, float rhs_scale);
   float lhs_scale() const { return lhs_scale_; }
@@ -121,6 +131,8 @@ class Worker {
   void Run();
   void YieldAndDeactive();
   virtual void WaitUntilActive();
+  void MarkIdleStart();
+  void UpdateSpinBudget();
 
   bool alive_{true};
   std::thread thread_;
@@ -140,8 +152,15 @@ class Worker {
   float lhs_scale_{0.};
   float rhs_scale_{kMaxScale};
   int frequency_{kDefaultFrequency};
+  int numa_node_{-1};
   int spin_count_{0};
   int max_spin_count_{kMinSpinCount};
+  std::atomic_bool adaptive_spin_{false};
+  bool parked_{false};
+  int adaptive_spin_count_{kDefaultSpinCount};
+  float ns_per_spin_{0.};
+  float idle_gap_spins_{0.};
+  std::chrono::steady_clock::time_point idle_start_;
   ThreadPool *pool_{nullptr};
   HQueue<TaskSplit> *local_task_queue_;
   size_t worker_id_{0};
@@ -172,6 +191,14 @@ class MS_CORE_API ThreadPool {
   void SetSpinCountMinValue();
   void SetMaxSpinCount(int spin_count);
   void SetMinSpinCount(int spin_count);
+  void SetAdaptiveSpin(bool adaptive_spin);
+  // the idle kernel workers steal the task splits from the other workers, the workers on the same numa node first,
+  // and the continuous task splits are assigned to the workers on the same numa node.
+  void SetKernelTaskSteal(bool kernel_task_steal) { kernel_task_steal_ = kernel_task_steal; }
+  bool kernel_task_steal() const { return kernel_task_steal_; }
+  int worker_numa_node(size_t index) const { return index < workers_.size() ? workers_[index]->numa_node() : -1; }
+  // bind the workers in [start, end) to the cores of the cluster.
+  int SetThreadGroupAffinity(size_t start, size_t end, CoreCluster cluster);
   virtual void ActiveWorkers();
   void SetWorkerIdMap();
   // init task queues
@@ -230,6 +257,7 @@ class MS_CORE_API ThreadPool {
   size_t actor_thread_num_{0};
   size_t kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  bool kernel_task_steal_{false};
   int max_spin_count_{kDefaultSpinCount};
   int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_MINDRT_RUNTIME_WORK_STEALING_DEQUE_H_
+#define MINDSPORE_CORE_MINDRT_RUNTIME_WORK_STEALING_DEQUE_H_
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace mindspore {
+// implement a bounded lock-free work stealing deque
+// refer to https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+// The owner thread pushes and pops at the bottom, and the other threads steal at the top.
+template <typename T>
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque(const WorkStealingDeque &) = delete;
+  WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+  explicit WorkStealingDeque(size_t capacity) {
+    capacity_ = 1;
+    while (capacity_ < capacity) {
+      capacity_ <<= 1;
+    }
+    mask_ = capacity_ - 1;
+    buffer_ = std::make_unique<std::atomic<T *>[]>(capacity_);
+  }
+  ~WorkStealingDeque() = default;
+
+  // Only called by the owner thread, return false when the deque is full.
+  bool Push(T *value) {
+    auto bottom = bottom_.load(std::memory_order_relaxed);
+    auto top = top_.load(std::memory_order_acquire);
+    if (bottom - top >= static_cast<int64_t>(capacity_)) {
+      return false;
+    }
+    buffer_[bottom & mask_].store(value, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Only called by the owner thread, take the latest pushed value.
+  T *Pop() {
+    auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = top_.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T *value = buffer_[bottom & mask_].load(std::memory_order_relaxed);
+    if (top == bottom) {
+      // The last one, compete with the thieves.
+      if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        value = nullptr;
+      }
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return value;
+  }
+
+  // Called by any thread, take the earliest pushed value.
+  T *Steal() {
+    auto top = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = bottom_.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return nullptr;
+    }
+    T *value = buffer_[top & mask_].load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return value;
+  }
+
+  bool Empty() const { return top_.load(std::memory_order_acquire) >= bottom_.load(std::memory_order_acquire); }
+
+ private:
+  std::atomic<int64_t> top_{0};
+  std::atomic<int64_t> bottom_{0};
+  size_t capacity_{1};
+  size_t mask_{0};
+  std::unique_ptr<std::atomic<T *>[]> buffer_;
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_MINDRT_RUNTIME_WORK_STEALING_DEQUE_H_
@@ -448,6 +448,9 @@ GVAR_DEF(PrimitivePtr, kPrimDynamicShape, std::make_shared<Primitive>(kDynamicSh
 GVAR_DEF(PrimitivePtr, kPrimCheckNumerics, std::make_shared<Primitive>(kCheckNumerics));
 GVAR_DEF(PrimitivePtr, kPrimEmbeddingLookup, std::make_shared<Primitive>("EmbeddingLookup"));
 GVAR_DEF(PrimitivePtr, kPrimEmbeddingLookupCommGrad, std::make_shared<Primitive>("EmbeddingLookupCommGrad"));
+GVAR_DEF(PrimitivePtr, kPrimMultiTableEmbeddingLookup, std::make_shared<Primitive>("MultiTableEmbeddingLookup"));
+GVAR_DEF(PrimitivePtr, kPrimMultiTableEmbeddingLookupGrad,
+         std::make_shared<Primitive>("MultiTableEmbeddingLookupGrad"));
 GVAR_DEF(PrimitivePtr, kPrimSize, std::make_shared<Primitive>("Size"));
 GVAR_DEF(PrimitivePtr, kPrimArgMax, std::make_shared<Primitive>("Argmax"));
 GVAR_DEF(PrimitivePtr, kPrimArgMin, std::make_shared<Primitive>("Argmin"));
@@ -883,6 +886,8 @@ GVAR_DEF(PrimitivePtr, kPrimNeighborExchange, std::make_shared<Primitive>("Neigh
 GVAR_DEF(PrimitivePtr, kPrimNeighborExchangeV2, std::make_shared<Primitive>("NeighborExchangeV2"));
 GVAR_DEF(PrimitivePtr, kPrimNeighborExchangeV2Grad, std::make_shared<Primitive>("NeighborExchangeV2Grad"));
 GVAR_DEF(PrimitivePtr, kPrimAllToAll, std::make_shared<Primitive>("AlltoAll"));
+GVAR_DEF(PrimitivePtr, kPrimMoeDispatch, std::make_shared<Primitive>("MoeDispatch"));
+GVAR_DEF(PrimitivePtr, kPrimMoeCombine, std::make_shared<Primitive>("MoeCombine"));
 GVAR_DEF(PrimitivePtr, kPrimAllToAllv, std::make_shared<Primitive>("AllToAllv"));
 GVAR_DEF(PrimitivePtr, kPrimAllSwap, std::make_shared<Primitive>("_AllSwap"));
 GVAR_DEF(PrimitivePtr, kPrimBroadcast, std::make_shared<Primitive>("Broadcast"));
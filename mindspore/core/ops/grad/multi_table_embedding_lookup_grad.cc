@@ -0,0 +1,73 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ops/grad/multi_table_embedding_lookup_grad.h"
+#include <map>
+#include <set>
+#include "ops/op_utils.h"
+#include "utils/check_convert_utils.h"
+#include "abstract/ops/primitive_infer_map.h"
+#include "mindapi/src/helper.h"
+
+namespace mindspore {
+namespace ops {
+namespace {
+constexpr size_t kMultiTableEmbeddingLookupGradInputsNum = 4;
+
+abstract::ShapePtr MultiTableEmbeddingLookupGradInferShape(const std::vector<AbstractBasePtr> &input_args) {
+  auto params_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex0]->BuildShape())[kShape];
+  return std::make_shared<abstract::Shape>(params_shape);
+}
+
+TypePtr MultiTableEmbeddingLookupGradInferType(const PrimitivePtr &primitive,
+                                               const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  std::map<std::string, TypePtr> value_types;
+  (void)value_types.emplace("params", input_args[kInputIndex0]->BuildType());
+  (void)value_types.emplace("dout", input_args[kInputIndex3]->BuildType());
+  (void)CheckAndConvertUtils::CheckTensorTypeSame(value_types, {kFloat16, kFloat32}, prim_name);
+  std::map<std::string, TypePtr> index_types;
+  (void)index_types.emplace("ids", input_args[kInputIndex1]->BuildType());
+  (void)index_types.emplace("table_offsets", input_args[kInputIndex2]->BuildType());
+  (void)CheckAndConvertUtils::CheckTensorTypeSame(index_types, {kInt32, kInt64}, prim_name);
+  return input_args[kInputIndex3]->BuildType();
+}
+}  // namespace
+
+void MultiTableEmbeddingLookupGrad::Init(const std::string &combiner) { set_combiner(combiner); }
+
+void MultiTableEmbeddingLookupGrad::set_combiner(const std::string &combiner) {
+  (void)this->AddAttr(kCombiner, api::MakeValue(combiner));
+}
+
+std::string MultiTableEmbeddingLookupGrad::get_combiner() const {
+  return GetValue<std::string>(GetAttr(kCombiner));
+}
+
+MIND_API_OPERATOR_IMPL(MultiTableEmbeddingLookupGrad, BaseOperator);
+AbstractBasePtr MultiTableEmbeddingLookupGradInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                                   const std::vector<AbstractBasePtr> &input_args) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  (void)CheckAndConvertUtils::CheckInputArgs(input_args, kEqual, kMultiTableEmbeddingLookupGradInputsNum,
+                                             primitive->name());
+  auto infer_type = MultiTableEmbeddingLookupGradInferType(primitive, input_args);
+  auto infer_shape = MultiTableEmbeddingLookupGradInferShape(input_args);
+  return abstract::MakeAbstract(infer_shape, infer_type);
+}
+REGISTER_PRIMITIVE_EVAL_IMPL(MultiTableEmbeddingLookupGrad, prim::kPrimMultiTableEmbeddingLookupGrad,
+                             MultiTableEmbeddingLookupGradInfer, nullptr, true);
+}  // namespace ops
+}  // namespace mindspore
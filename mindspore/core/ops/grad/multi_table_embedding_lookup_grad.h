@@ -0,0 +1,54 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_GRAD_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_H_
+#define MINDSPORE_CORE_OPS_GRAD_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_H_
+#include <memory>
+#include <string>
+#include <vector>
+#include "ops/base_operator.h"
+#include "ops/op_name.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameMultiTableEmbeddingLookupGrad = "MultiTableEmbeddingLookupGrad";
+/// \brief Computes the gradient of the params of MultiTableEmbeddingLookup, which accumulates the dout to the rows
+/// looked up, the params is only used for the shape of the gradient.
+class MIND_API MultiTableEmbeddingLookupGrad : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(MultiTableEmbeddingLookupGrad);
+  /// \brief Constructor.
+  MultiTableEmbeddingLookupGrad() : BaseOperator(kNameMultiTableEmbeddingLookupGrad) {
+    InitIOName({"params", "ids", "table_offsets", "dout"}, {"output"});
+  }
+  /// \brief Init.
+  void Init(const std::string &combiner = kNone);
+  /// \brief Set combiner, one of "none", "sum" and "mean".
+  void set_combiner(const std::string &combiner);
+  /// \brief Get combiner.
+  ///
+  /// \return combiner.
+  std::string get_combiner() const;
+};
+
+abstract::AbstractBasePtr MultiTableEmbeddingLookupGradInfer(const abstract::AnalysisEnginePtr &,
+                                                             const PrimitivePtr &primitive,
+                                                             const std::vector<abstract::AbstractBasePtr> &input_args);
+using PrimMultiTableEmbeddingLookupGradPtr = std::shared_ptr<MultiTableEmbeddingLookupGrad>;
+}  // namespace ops
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_OPS_GRAD_MULTI_TABLE_EMBEDDING_LOOKUP_GRAD_H_
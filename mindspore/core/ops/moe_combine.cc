@@ -0,0 +1,77 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ops/moe_combine.h"
+#include <map>
+#include <set>
+#include <string>
+#include "ops/op_utils.h"
+#include "utils/check_convert_utils.h"
+#include "utils/shape_utils.h"
+#include "abstract/ops/primitive_infer_map.h"
+#include "mindapi/src/helper.h"
+
+namespace mindspore {
+namespace ops {
+namespace {
+constexpr size_t kMoeCombineInputsNum = 3;
+
+abstract::ShapePtr MoeCombineInferShape(const PrimitivePtr &primitive, const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  auto expert_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex0]->BuildShape())[kShape];
+  auto weights_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex1]->BuildShape())[kShape];
+  auto index_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex2]->BuildShape())[kShape];
+  if (IsDynamicRank(expert_shape) || IsDynamicRank(weights_shape)) {
+    return std::make_shared<abstract::Shape>(ShapeVector{UNKNOWN_RANK});
+  }
+  const int64_t expert_rank = 3;
+  const int64_t route_rank = 2;
+  (void)CheckAndConvertUtils::CheckInteger("rank of expert_output", SizeToLong(expert_shape.size()), kEqual,
+                                           expert_rank, prim_name);
+  (void)CheckAndConvertUtils::CheckInteger("rank of combine_weights", SizeToLong(weights_shape.size()), kEqual,
+                                           route_rank, prim_name);
+  if (!IsDynamicRank(index_shape) && !IsDynamic(index_shape) && !IsDynamic(weights_shape) &&
+      index_shape != weights_shape) {
+    MS_EXCEPTION(ValueError) << "For '" << prim_name << "', the shape of combine_weights and dispatch_index must be "
+                             << "the same, but got " << weights_shape << " and " << index_shape;
+  }
+  return std::make_shared<abstract::Shape>(ShapeVector{weights_shape[0], expert_shape[kInputIndex2]});
+}
+
+TypePtr MoeCombineInferType(const PrimitivePtr &primitive, const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  auto expert_type = input_args[kInputIndex0]->BuildType();
+  (void)CheckAndConvertUtils::CheckTensorTypeValid("expert_output", expert_type, {kFloat16, kFloat32}, prim_name);
+  (void)CheckAndConvertUtils::CheckTensorTypeValid("combine_weights", input_args[kInputIndex1]->BuildType(),
+                                                   {kFloat32}, prim_name);
+  (void)CheckAndConvertUtils::CheckTensorTypeValid("dispatch_index", input_args[kInputIndex2]->BuildType(), {kInt32},
+                                                   prim_name);
+  return expert_type;
+}
+}  // namespace
+
+MIND_API_OPERATOR_IMPL(MoeCombine, BaseOperator);
+AbstractBasePtr MoeCombineInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                const std::vector<AbstractBasePtr> &input_args) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  (void)CheckAndConvertUtils::CheckInputArgs(input_args, kEqual, kMoeCombineInputsNum, primitive->name());
+  auto infer_type = MoeCombineInferType(primitive, input_args);
+  auto infer_shape = MoeCombineInferShape(primitive, input_args);
+  return abstract::MakeAbstract(infer_shape, infer_type);
+}
+REGISTER_PRIMITIVE_EVAL_IMPL(MoeCombine, prim::kPrimMoeCombine, MoeCombineInfer, nullptr, true);
+}  // namespace ops
+}  // namespace mindspore
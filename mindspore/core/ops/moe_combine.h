@@ -0,0 +1,45 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_MOE_COMBINE_H_
+#define MINDSPORE_CORE_OPS_MOE_COMBINE_H_
+#include <memory>
+#include <vector>
+#include "ops/base_operator.h"
+#include "mindapi/base/types.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameMoeCombine = "MoeCombine";
+/// \brief Combines the expert_output of shape [experts, capacity, hidden] back to the tokens by the combine_weights
+/// and the dispatch_index of shape [tokens, top_k] generated by MoeDispatch, the output of shape [tokens, hidden] is
+/// the weighted sum of the expert outputs of the selected slots, and the dropped choices are skipped.
+class MIND_API MoeCombine : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(MoeCombine);
+  /// \brief Constructor.
+  MoeCombine() : BaseOperator(kNameMoeCombine) {
+    InitIOName({"expert_output", "combine_weights", "dispatch_index"}, {"y"});
+  }
+};
+
+abstract::AbstractBasePtr MoeCombineInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                          const std::vector<abstract::AbstractBasePtr> &input_args);
+using PrimMoeCombinePtr = std::shared_ptr<MoeCombine>;
+}  // namespace ops
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_OPS_MOE_COMBINE_H_
@@ -0,0 +1,115 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ops/moe_dispatch.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <set>
+#include <string>
+#include "ops/op_utils.h"
+#include "utils/check_convert_utils.h"
+#include "utils/shape_utils.h"
+#include "abstract/ops/primitive_infer_map.h"
+#include "mindapi/src/helper.h"
+
+namespace mindspore {
+namespace ops {
+namespace {
+constexpr size_t kMoeDispatchInputsNum = 2;
+
+int64_t GetMoeCapacity(int64_t tokens, int64_t experts, int64_t top_k, float capacity_factor) {
+  if (experts <= 0) {
+    return 0;
+  }
+  auto capacity = static_cast<int64_t>(std::ceil(capacity_factor * tokens * top_k / static_cast<float>(experts)));
+  return std::max<int64_t>(capacity, 1);
+}
+
+abstract::TupleShapePtr MoeDispatchInferShape(const PrimitivePtr &primitive,
+                                              const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  auto x_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex0]->BuildShape())[kShape];
+  auto gate_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex1]->BuildShape())[kShape];
+  auto top_k = GetValue<int64_t>(primitive->GetAttr(kTopK));
+  auto capacity_factor = GetValue<float>(primitive->GetAttr(kCapacityFactor));
+  if (capacity_factor <= 0) {
+    MS_EXCEPTION(ValueError) << "For '" << prim_name << "', the capacity_factor must be positive, but got "
+                             << capacity_factor;
+  }
+  if (IsDynamicRank(x_shape) || IsDynamicRank(gate_shape)) {
+    auto unknown = std::make_shared<abstract::Shape>(ShapeVector{UNKNOWN_RANK});
+    return std::make_shared<abstract::TupleShape>(std::vector<abstract::BaseShapePtr>{unknown, unknown, unknown});
+  }
+  const int64_t input_rank = 2;
+  (void)CheckAndConvertUtils::CheckInteger("rank of x", SizeToLong(x_shape.size()), kEqual, input_rank, prim_name);
+  (void)CheckAndConvertUtils::CheckInteger("rank of gate_logits", SizeToLong(gate_shape.size()), kEqual, input_rank,
+                                           prim_name);
+  auto tokens = x_shape[0];
+  auto hidden = x_shape[1];
+  auto experts = gate_shape[1];
+  if (tokens >= 0 && gate_shape[0] >= 0 && tokens != gate_shape[0]) {
+    MS_EXCEPTION(ValueError) << "For '" << prim_name << "', the first dimension of x and gate_logits must be the same, "
+                             << "but got " << tokens << " and " << gate_shape[0];
+  }
+  if (experts >= 0) {
+    (void)CheckAndConvertUtils::CheckInRange<int64_t>("top_k", top_k, kIncludeBoth, {1, experts}, prim_name);
+  }
+  auto capacity = (tokens < 0 || experts < 0) ? abstract::Shape::SHP_ANY
+                                              : GetMoeCapacity(tokens, experts, top_k, capacity_factor);
+  auto dispatched_shape = std::make_shared<abstract::Shape>(ShapeVector{experts, capacity, hidden});
+  auto route_shape = std::make_shared<abstract::Shape>(ShapeVector{tokens, top_k});
+  return std::make_shared<abstract::TupleShape>(
+    std::vector<abstract::BaseShapePtr>{dispatched_shape, route_shape, route_shape});
+}
+
+TuplePtr MoeDispatchInferType(const PrimitivePtr &primitive, const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  std::map<std::string, TypePtr> types;
+  (void)types.emplace("x", input_args[kInputIndex0]->BuildType());
+  (void)types.emplace("gate_logits", input_args[kInputIndex1]->BuildType());
+  auto type = CheckAndConvertUtils::CheckTensorTypeSame(types, {kFloat16, kFloat32}, prim_name);
+  return std::make_shared<Tuple>(std::vector<TypePtr>{type, kFloat32, kInt32});
+}
+}  // namespace
+
+void MoeDispatch::Init(const int64_t top_k, const float capacity_factor) {
+  set_top_k(top_k);
+  set_capacity_factor(capacity_factor);
+}
+
+void MoeDispatch::set_top_k(const int64_t top_k) { (void)this->AddAttr(kTopK, api::MakeValue(top_k)); }
+
+int64_t MoeDispatch::get_top_k() const { return GetValue<int64_t>(GetAttr(kTopK)); }
+
+void MoeDispatch::set_capacity_factor(const float capacity_factor) {
+  (void)this->AddAttr(kCapacityFactor, api::MakeValue(capacity_factor));
+}
+
+float MoeDispatch::get_capacity_factor() const { return GetValue<float>(GetAttr(kCapacityFactor)); }
+
+MIND_API_OPERATOR_IMPL(MoeDispatch, BaseOperator);
+AbstractBasePtr MoeDispatchInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                 const std::vector<AbstractBasePtr> &input_args) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  (void)CheckAndConvertUtils::CheckInputArgs(input_args, kEqual, kMoeDispatchInputsNum, primitive->name());
+  auto infer_type = MoeDispatchInferType(primitive, input_args);
+  auto infer_shape = MoeDispatchInferShape(primitive, input_args);
+  return abstract::MakeAbstract(infer_shape, infer_type);
+}
+REGISTER_PRIMITIVE_EVAL_IMPL(MoeDispatch, prim::kPrimMoeDispatch, MoeDispatchInfer, nullptr, true);
+}  // namespace ops
+}  // namespace mindspore
@@ -0,0 +1,63 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_MOE_DISPATCH_H_
+#define MINDSPORE_CORE_OPS_MOE_DISPATCH_H_
+#include <memory>
+#include <vector>
+#include "ops/base_operator.h"
+#include "mindapi/base/types.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameMoeDispatch = "MoeDispatch";
+/// \brief Routes the tokens x of shape [tokens, hidden] to the experts by the top_k of the gate_logits of shape
+/// [tokens, experts]. Each expert accepts at most capacity = ceil(capacity_factor * tokens * top_k / experts) tokens,
+/// the earlier tokens of the higher choices are accepted first and the overflowed ones are dropped. The outputs are
+/// the dispatched tokens of shape [experts, capacity, hidden], which are exchanged among the expert parallel devices by
+/// AllToAll, the combine weights of shape [tokens, top_k], which are the softmax probabilities of the selected experts
+/// and zeros for the dropped ones, and the dispatch index of shape [tokens, top_k], which is the slot
+/// expert * capacity + position of each choice and -1 for the dropped ones.
+class MIND_API MoeDispatch : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(MoeDispatch);
+  /// \brief Constructor.
+  MoeDispatch() : BaseOperator(kNameMoeDispatch) {
+    InitIOName({"x", "gate_logits"}, {"dispatched", "combine_weights", "dispatch_index"});
+  }
+  /// \brief Init.
+  void Init(const int64_t top_k = 1, const float capacity_factor = 1.0);
+  /// \brief Set top_k, the number of the experts selected by each token.
+  void set_top_k(const int64_t top_k);
+  /// \brief Get top_k.
+  ///
+  /// \return top_k.
+  int64_t get_top_k() const;
+  /// \brief Set capacity_factor, the ratio of the capacity of each expert to the tokens routed evenly.
+  void set_capacity_factor(const float capacity_factor);
+  /// \brief Get capacity_factor.
+  ///
+  /// \return capacity_factor.
+  float get_capacity_factor() const;
+};
+
+abstract::AbstractBasePtr MoeDispatchInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                           const std::vector<abstract::AbstractBasePtr> &input_args);
+using PrimMoeDispatchPtr = std::shared_ptr<MoeDispatch>;
+}  // namespace ops
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_OPS_MOE_DISPATCH_H_
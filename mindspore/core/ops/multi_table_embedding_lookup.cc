@@ -0,0 +1,98 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ops/multi_table_embedding_lookup.h"
+#include <map>
+#include <set>
+#include "ops/op_utils.h"
+#include "utils/check_convert_utils.h"
+#include "utils/shape_utils.h"
+#include "abstract/ops/primitive_infer_map.h"
+#include "mindapi/src/helper.h"
+
+namespace mindspore {
+namespace ops {
+namespace {
+constexpr size_t kMultiTableEmbeddingLookupInputsNum = 3;
+
+abstract::ShapePtr MultiTableEmbeddingLookupInferShape(const PrimitivePtr &primitive,
+                                                       const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  auto params_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex0]->BuildShape())[kShape];
+  auto ids_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex1]->BuildShape())[kShape];
+  auto offsets_shape = CheckAndConvertUtils::ConvertShapePtrToShapeMap(input_args[kInputIndex2]->BuildShape())[kShape];
+  auto combiner = GetValue<std::string>(primitive->GetAttr(kCombiner));
+  if (combiner != kNone && combiner != kSum && combiner != kMean) {
+    MS_EXCEPTION(ValueError) << "For '" << prim_name
+                             << "', the combiner must be one of 'none', 'sum' and 'mean', but got " << combiner;
+  }
+  if (IsDynamicRank(params_shape) || IsDynamicRank(ids_shape)) {
+    return std::make_shared<abstract::Shape>(ShapeVector{UNKNOWN_RANK});
+  }
+  const int64_t params_rank = 2;
+  (void)CheckAndConvertUtils::CheckInteger("rank of params", SizeToLong(params_shape.size()), kEqual, params_rank,
+                                           prim_name);
+  const int64_t min_ids_rank = combiner == kNone ? 1 : 2;
+  (void)CheckAndConvertUtils::CheckInteger("rank of ids", SizeToLong(ids_shape.size()), kGreaterEqual, min_ids_rank,
+                                           prim_name);
+  if (!IsDynamicRank(offsets_shape)) {
+    (void)CheckAndConvertUtils::CheckInteger("rank of table_offsets", SizeToLong(offsets_shape.size()), kEqual, 1,
+                                             prim_name);
+    if (offsets_shape[0] >= 0 && ids_shape[0] >= 0 && offsets_shape[0] != ids_shape[0]) {
+      MS_EXCEPTION(ValueError) << "For '" << prim_name << "', the size of table_offsets must be equal to the first "
+                               << "dimension of ids, but got " << offsets_shape[0] << " and " << ids_shape[0];
+    }
+  }
+  ShapeVector output_shape(ids_shape.begin(), combiner == kNone ? ids_shape.end() : ids_shape.end() - 1);
+  output_shape.push_back(params_shape[1]);
+  return std::make_shared<abstract::Shape>(output_shape);
+}
+
+TypePtr MultiTableEmbeddingLookupInferType(const PrimitivePtr &primitive,
+                                           const std::vector<AbstractBasePtr> &input_args) {
+  auto prim_name = primitive->name();
+  auto params_type = input_args[kInputIndex0]->BuildType();
+  (void)CheckAndConvertUtils::CheckTensorTypeValid("params", params_type, {kFloat16, kFloat32}, prim_name);
+  std::map<std::string, TypePtr> index_types;
+  (void)index_types.emplace("ids", input_args[kInputIndex1]->BuildType());
+  (void)index_types.emplace("table_offsets", input_args[kInputIndex2]->BuildType());
+  (void)CheckAndConvertUtils::CheckTensorTypeSame(index_types, {kInt32, kInt64}, prim_name);
+  return params_type;
+}
+}  // namespace
+
+void MultiTableEmbeddingLookup::Init(const std::string &combiner) { set_combiner(combiner); }
+
+void MultiTableEmbeddingLookup::set_combiner(const std::string &combiner) {
+  (void)this->AddAttr(kCombiner, api::MakeValue(combiner));
+}
+
+std::string MultiTableEmbeddingLookup::get_combiner() const { return GetValue<std::string>(GetAttr(kCombiner)); }
+
+MIND_API_OPERATOR_IMPL(MultiTableEmbeddingLookup, BaseOperator);
+AbstractBasePtr MultiTableEmbeddingLookupInfer(const abstract::AnalysisEnginePtr &, const PrimitivePtr &primitive,
+                                               const std::vector<AbstractBasePtr> &input_args) {
+  MS_EXCEPTION_IF_NULL(primitive);
+  (void)CheckAndConvertUtils::CheckInputArgs(input_args, kEqual, kMultiTableEmbeddingLookupInputsNum,
+                                             primitive->name());
+  auto infer_type = MultiTableEmbeddingLookupInferType(primitive, input_args);
+  auto infer_shape = MultiTableEmbeddingLookupInferShape(primitive, input_args);
+  return abstract::MakeAbstract(infer_shape, infer_type);
+}
+REGISTER_PRIMITIVE_EVAL_IMPL(MultiTableEmbeddingLookup, prim::kPrimMultiTableEmbeddingLookup,
+                             MultiTableEmbeddingLookupInfer, nullptr, true);
+}  // namespace ops
+}  // namespace mindspore
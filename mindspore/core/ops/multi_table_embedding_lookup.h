@@ -0,0 +1,57 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_H_
+#define MINDSPORE_CORE_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_H_
+#include <memory>
+#include <string>
+#include <vector>
+#include "ops/base_operator.h"
+#include "ops/op_name.h"
+
+namespace mindspore {
+namespace ops {
+constexpr auto kNameMultiTableEmbeddingLookup = "MultiTableEmbeddingLookup";
+/// \brief Looks up the embeddings of multiple tables in one operator. The tables are concatenated to the params of
+/// shape [rows, dim], the ids of the i-th table are the ids[i], which are offset by the table_offsets[i] to the rows
+/// of the params. The negative and the out of range ids are the padding, whose embeddings are zeros. The combiner
+/// "none" outputs the embeddings of shape ids_shape + [dim], and "sum" or "mean" pools the embeddings of the last
+/// axis of ids, the output shape is ids_shape[:-1] + [dim].
+class MIND_API MultiTableEmbeddingLookup : public BaseOperator {
+ public:
+  MIND_API_BASE_MEMBER(MultiTableEmbeddingLookup);
+  /// \brief Constructor.
+  MultiTableEmbeddingLookup() : BaseOperator(kNameMultiTableEmbeddingLookup) {
+    InitIOName({"params", "ids", "table_offsets"}, {"output"});
+  }
+  /// \brief Init.
+  void Init(const std::string &combiner = kNone);
+  /// \brief Set combiner, one of "none", "sum" and "mean".
+  void set_combiner(const std::string &combiner);
+  /// \brief Get combiner.
+  ///
+  /// \return combiner.
+  std::string get_combiner() const;
+};
+
+abstract::AbstractBasePtr MultiTableEmbeddingLookupInfer(const abstract::AnalysisEnginePtr &,
+                                                         const PrimitivePtr &primitive,
+                                                         const std::vector<abstract::AbstractBasePtr> &input_args);
+using PrimMultiTableEmbeddingLookupPtr = std::shared_ptr<MultiTableEmbeddingLookup>;
+}  // namespace ops
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_OPS_MULTI_TABLE_EMBEDDING_LOOKUP_H_
@@ -186,6 +186,7 @@ constexpr auto kPreNmsTopn = "pre_nms_topn";
 constexpr auto kRankSize = "rank_size";
 constexpr auto kRatio = "ratio";
 constexpr auto kReduction = "reduction";
+constexpr auto kCombiner = "combiner";
 constexpr auto kRootRank = "root_rank";
 constexpr auto kRoundMode = "round_mode";
 constexpr auto kRtol = "rtol";
@@ -331,6 +332,7 @@ constexpr auto kWithOffset = "with_offset";
 constexpr auto kLinearSumAssignment = "linear_sum_assignment";
 constexpr auto kNbins = "nbins";
 constexpr auto kCapacity = "capacity";
+constexpr auto kCapacityFactor = "capacity_factor";
 constexpr auto kShapes = "shapes";
 constexpr auto kTypes = "types";
 constexpr auto kSchema = "schema";
@@ -0,0 +1,222 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/compile_profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include "ir/graph_utils.h"
+#include "ir/manager.h"
+#include "utils/log_adapter.h"
+#include "utils/profile.h"
+
+namespace mindspore {
+namespace {
+constexpr double kUsPerSecond = 1000000.0;
+constexpr auto kCompileProfileEnv = "MS_DEV_COMPILE_PROFILE";
+constexpr auto kCompileProfileFormatEnv = "MS_DEV_COMPILE_PROFILE_FORMAT";
+
+size_t CountNodes(const FuncGraphPtr &graph) {
+  if (graph == nullptr) {
+    return 0;
+  }
+  auto manager = graph->manager();
+  if (manager != nullptr) {
+    return manager->all_nodes().size();
+  }
+  return TopoSort(graph->get_return()).size();
+}
+
+// Read the current and the peak RSS in units of kB from /proc/self/status.
+void ReadRss(size_t *rss_kb, size_t *peak_kb) {
+  *rss_kb = 0;
+  *peak_kb = 0;
+#ifdef __linux__
+  std::ifstream ifs("/proc/self/status");
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    std::string key;
+    size_t value = 0;
+    iss >> key >> value;
+    if (key == "VmRSS:") {
+      *rss_kb = value;
+    } else if (key == "VmHWM:") {
+      *peak_kb = value;
+    }
+  }
+#endif
+}
+
+// Reset the peak RSS of the process to the current RSS.
+void ResetPeakRss() {
+#ifdef __linux__
+  std::ofstream ofs("/proc/self/clear_refs");
+  ofs << "5";
+#endif
+}
+
+std::string Escape(const std::string &str) {
+  std::string result;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') {
+      result.push_back('\\');
+    }
+    result.push_back(c);
+  }
+  return result;
+}
+}  // namespace
+
+CompileProfiler &CompileProfiler::GetInstance() {
+  static CompileProfiler instance;
+  return instance;
+}
+
+CompileProfiler::CompileProfiler() {
+  Init(common::GetEnv(kCompileProfileEnv), common::GetEnv(kCompileProfileFormatEnv) == "trace");
+}
+
+void CompileProfiler::Init(const std::string &file, bool trace_format) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  file_ = file;
+  enable_ = !file_.empty();
+  trace_format_ = trace_format;
+  records_.clear();
+  running_.clear();
+  thread_indexes_.clear();
+  if (enable_) {
+    MS_LOG(INFO) << "Compile profiler is enabled, the records are exported to " << file_;
+  }
+}
+
+void CompileProfiler::Start(const std::string &name, const std::string &category, const FuncGraphPtr &graph) {
+  if (!enable_) {
+    return;
+  }
+  Record record;
+  record.name_ = name;
+  record.category_ = category;
+  record.nodes_before_ = CountNodes(graph);
+  size_t peak_kb = 0;
+  ReadRss(&record.rss_before_kb_, &peak_kb);
+  record.peak_rss_kb_ = record.rss_before_kb_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto thread_id = std::this_thread::get_id();
+  auto &running = running_[thread_id];
+  // The peak so far belongs to the running phases, since the peak is reset for the new phase.
+  for (auto index : running) {
+    records_[index].peak_rss_kb_ = std::max(records_[index].peak_rss_kb_, peak_kb);
+  }
+  auto thread_iter = thread_indexes_.emplace(thread_id, thread_indexes_.size()).first;
+  record.thread_ = thread_iter->second;
+  record.depth_ = running.size();
+  running.push_back(records_.size());
+  ResetPeakRss();
+  record.start_us_ = GetTime() * kUsPerSecond;
+  records_.push_back(std::move(record));
+}
+
+void CompileProfiler::End(const FuncGraphPtr &graph) {
+  if (!enable_) {
+    return;
+  }
+  auto end_us = GetTime() * kUsPerSecond;
+  auto nodes_after = CountNodes(graph);
+  size_t rss_kb = 0;
+  size_t peak_kb = 0;
+  ReadRss(&rss_kb, &peak_kb);
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &running = running_[std::this_thread::get_id()];
+  if (running.empty()) {
+    MS_LOG(WARNING) << "Compile profiler ends a phase which is not started.";
+    return;
+  }
+  auto &record = records_[running.back()];
+  running.pop_back();
+  record.duration_us_ = end_us - record.start_us_;
+  record.nodes_after_ = nodes_after;
+  record.rss_after_kb_ = rss_kb;
+  record.peak_rss_kb_ = std::max(record.peak_rss_kb_, peak_kb);
+  for (auto index : running) {
+    records_[index].peak_rss_kb_ = std::max(records_[index].peak_rss_kb_, record.peak_rss_kb_);
+  }
+}
+
+void CompileProfiler::Export() {
+  if (!enable_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::ofstream ofs(file_, std::ios::trunc | std::ios::out);
+  if (!ofs.good()) {
+    MS_LOG(WARNING) << "Open compile profile file " << file_ << " failed.";
+    return;
+  }
+  ofs << std::fixed << std::setprecision(3);
+  trace_format_ ? ExportTrace(&ofs) : ExportJson(&ofs);
+  ofs.close();
+  MS_LOG(INFO) << "Export " << records_.size() << " compile profile records to " << file_;
+}
+
+void CompileProfiler::ExportJson(std::ostream *ofs) const {
+  *ofs << "{\n  \"records\": [";
+  for (size_t i = 0; i < records_.size(); ++i) {
+    auto &record = records_[i];
+    *ofs << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << Escape(record.name_) << "\", \"category\": \""
+         << record.category_ << "\", \"depth\": " << record.depth_ << ", \"thread\": " << record.thread_
+         << ", \"start_us\": " << record.start_us_ << ", \"duration_us\": " << record.duration_us_
+         << ", \"nodes_before\": " << record.nodes_before_ << ", \"nodes_after\": " << record.nodes_after_
+         << ", \"rss_before_kb\": " << record.rss_before_kb_ << ", \"rss_after_kb\": " << record.rss_after_kb_
+         << ", \"peak_rss_kb\": " << record.peak_rss_kb_ << "}";
+  }
+  *ofs << "\n  ]\n}\n";
+}
+
+void CompileProfiler::ExportTrace(std::ostream *ofs) const {
+  *ofs << "{\n  \"traceEvents\": [";
+  for (size_t i = 0; i < records_.size(); ++i) {
+    auto &record = records_[i];
+    *ofs << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << Escape(record.name_) << "\", \"cat\": \""
+         << record.category_ << "\", \"ph\": \"X\", \"ts\": " << record.start_us_ << ", \"dur\": "
+         << record.duration_us_ << ", \"pid\": 1, \"tid\": " << record.thread_
+         << ", \"args\": {\"nodes_before\": " << record.nodes_before_ << ", \"nodes_after\": " << record.nodes_after_
+         << ", \"rss_before_kb\": " << record.rss_before_kb_ << ", \"rss_after_kb\": " << record.rss_after_kb_
+         << ", \"peak_rss_kb\": " << record.peak_rss_kb_ << "}}";
+  }
+  *ofs << "\n  ],\n  \"displayTimeUnit\": \"ms\"\n}\n";
+}
+
+CompileProfileScope::CompileProfileScope(const std::string &name, const std::string &category,
+                                         const GraphGetter &graph_getter)
+    : enable_(CompileProfiler::GetInstance().enable()) {
+  if (enable_) {
+    graph_getter_ = graph_getter;
+    CompileProfiler::GetInstance().Start(name, category, graph_getter_());
+  }
+}
+
+CompileProfileScope::CompileProfileScope(const std::string &name, const std::string &category,
+                                         const FuncGraphPtr &graph)
+    : CompileProfileScope(name, category, [graph]() { return graph; }) {}
+
+CompileProfileScope::~CompileProfileScope() {
+  if (enable_) {
+    CompileProfiler::GetInstance().End(graph_getter_());
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,100 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_UTILS_COMPILE_PROFILER_H_
+#define MINDSPORE_CORE_UTILS_COMPILE_PROFILER_H_
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ir/func_graph.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+// The compile profiler records the wall time, the node number before and after, and the peak RSS of each pipeline
+// action, optimizer pass, backend pass and evaluator phase of the graph compiling. It is enabled by the env
+// MS_DEV_COMPILE_PROFILE which is the file to export to, and the records are exported as a chrome trace if the env
+// MS_DEV_COMPILE_PROFILE_FORMAT is "trace", or as a json list otherwise.
+// The peak RSS of a phase is got by resetting the peak RSS of the process at the start, so it is only supported on
+// linux, and it is the peak of the process if the phases run in several threads at the same time.
+class MS_CORE_API CompileProfiler {
+ public:
+  static CompileProfiler &GetInstance();
+
+  // Init by the env at the construction, the records are cleared and the profiler is disabled if the file is empty.
+  void Init(const std::string &file, bool trace_format);
+  bool enable() const { return enable_; }
+
+  // The phases started in the same thread are nested as a stack.
+  void Start(const std::string &name, const std::string &category, const FuncGraphPtr &graph);
+  void End(const FuncGraphPtr &graph);
+
+  // Export all the records so far to the file, the file is overwritten at each exporting.
+  void Export();
+
+ private:
+  CompileProfiler();
+  ~CompileProfiler() = default;
+  DISABLE_COPY_AND_ASSIGN(CompileProfiler);
+
+  void ExportJson(std::ostream *ofs) const;
+  void ExportTrace(std::ostream *ofs) const;
+
+  struct Record {
+    std::string name_;
+    std::string category_;
+    size_t depth_{0};
+    size_t thread_{0};
+    double start_us_{0};
+    double duration_us_{0};
+    size_t nodes_before_{0};
+    size_t nodes_after_{0};
+    size_t rss_before_kb_{0};
+    size_t rss_after_kb_{0};
+    size_t peak_rss_kb_{0};
+  };
+
+  bool enable_{false};
+  bool trace_format_{false};
+  std::string file_;
+  std::mutex mutex_;
+  std::vector<Record> records_;
+  // the indexes of the running records of each thread.
+  std::map<std::thread::id, std::vector<size_t>> running_;
+  std::map<std::thread::id, size_t> thread_indexes_;
+};
+
+// Record the phase in the scope, the graph is got by the getter at the start and the end since the phase may replace
+// the graph.
+class MS_CORE_API CompileProfileScope {
+ public:
+  using GraphGetter = std::function<FuncGraphPtr()>;
+  CompileProfileScope(const std::string &name, const std::string &category, const GraphGetter &graph_getter);
+  CompileProfileScope(const std::string &name, const std::string &category, const FuncGraphPtr &graph);
+  ~CompileProfileScope();
+  CompileProfileScope(const CompileProfileScope &) = delete;
+  CompileProfileScope &operator=(const CompileProfileScope &) = delete;
+
+ private:
+  bool enable_{false};
+  GraphGetter graph_getter_;
+};
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_UTILS_COMPILE_PROFILER_H_
@@ -45,6 +45,7 @@ class MS_EXPORT DataQueueHandler {
   HANDLER_DEFINE(device::BlockQueueStatus_T, Clear, const std::string &);
   HANDLER_DEFINE(device::BlockQueueStatus_T, Push, const std::string &, const std::vector<device::DataQueueItem> &,
                  unsigned int);
+  HANDLER_DEFINE(size_t, Size, const std::string &);
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_CCSRC_INCLUDE_COMMON_UTILS_DATA_QUEUE_HANDLER_H_
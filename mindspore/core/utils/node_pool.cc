@@ -0,0 +1,195 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utils/node_pool.h"
+#include <array>
+#include <mutex>
+#include <new>
+#include <vector>
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kBlockAlign = 16;
+constexpr size_t kMaxBlockSize = 512;
+constexpr size_t kSizeClassNum = kMaxBlockSize / kBlockAlign;
+constexpr size_t kChunkSize = 64 * 1024;
+// The thread returns the blocks to the global pool in batch when it holds too many free blocks of one size class.
+constexpr size_t kMaxThreadFreeBlocks = 4096;
+constexpr size_t kTransferBlocks = 256;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+struct FreeList {
+  FreeBlock *head{nullptr};
+  size_t count{0};
+
+  void Push(FreeBlock *block) {
+    block->next = head;
+    head = block;
+    ++count;
+  }
+
+  FreeBlock *Pop() {
+    auto block = head;
+    if (block != nullptr) {
+      head = block->next;
+      --count;
+    }
+    return block;
+  }
+
+  // Move at most num blocks to the other list.
+  void MoveTo(FreeList *other, size_t num) {
+    while (num-- > 0 && head != nullptr) {
+      other->Push(Pop());
+    }
+  }
+};
+
+inline size_t SizeClass(size_t size) { return (size + kBlockAlign - 1) / kBlockAlign - 1; }
+
+// The blocks shared by all the threads, and the chunks carving the new blocks.
+class GlobalPool {
+ public:
+  // Never destroyed, the nodes may be released by the static objects at exit.
+  static GlobalPool &GetInstance() {
+    static GlobalPool *instance = new GlobalPool();
+    return *instance;
+  }
+
+  void Fetch(size_t size_class, FreeList *list) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_lists_[size_class].MoveTo(list, kTransferBlocks);
+    }
+    if (list->head != nullptr) {
+      return;
+    }
+    // Carve a new chunk to the blocks of this size class.
+    size_t block_size = (size_class + 1) * kBlockAlign;
+    auto chunk = static_cast<char *>(::operator new(kChunkSize));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      chunks_.push_back(chunk);
+    }
+    for (size_t offset = 0; offset + block_size <= kChunkSize; offset += block_size) {
+      list->Push(reinterpret_cast<FreeBlock *>(chunk + offset));
+    }
+  }
+
+  void Return(size_t size_class, FreeList *list, size_t num) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    list->MoveTo(&free_lists_[size_class], num);
+  }
+
+ private:
+  GlobalPool() = default;
+  ~GlobalPool() = default;
+  DISABLE_COPY_AND_ASSIGN(GlobalPool);
+
+  std::mutex mutex_;
+  std::array<FreeList, kSizeClassNum> free_lists_;
+  std::vector<char *> chunks_;
+};
+
+class ThreadCache {
+ public:
+  ThreadCache() = default;
+  ~ThreadCache();
+
+  void *Allocate(size_t size_class) {
+    auto &list = free_lists_[size_class];
+    if (list.head == nullptr) {
+      GlobalPool::GetInstance().Fetch(size_class, &list);
+    }
+    return list.Pop();
+  }
+
+  void Free(void *ptr, size_t size_class) {
+    auto &list = free_lists_[size_class];
+    list.Push(static_cast<FreeBlock *>(ptr));
+    if (list.count > kMaxThreadFreeBlocks) {
+      GlobalPool::GetInstance().Return(size_class, &list, kTransferBlocks);
+    }
+  }
+
+ private:
+  std::array<FreeList, kSizeClassNum> free_lists_;
+};
+
+// The nodes may be released after the cache of the thread is destroyed, such as by the other thread_local objects,
+// then the blocks go to the global pool directly.
+thread_local bool thread_cache_destroyed = false;
+
+ThreadCache::~ThreadCache() {
+  for (size_t i = 0; i < kSizeClassNum; ++i) {
+    GlobalPool::GetInstance().Return(i, &free_lists_[i], free_lists_[i].count);
+  }
+  thread_cache_destroyed = true;
+}
+
+ThreadCache *GetThreadCache() {
+  if (thread_cache_destroyed) {
+    return nullptr;
+  }
+  thread_local ThreadCache cache;
+  return &cache;
+}
+}  // namespace
+
+bool NodePool::enable() {
+  static const bool enable = (common::GetEnv("MS_DEV_IR_NODE_POOL") != "0");
+  return enable;
+}
+
+void *NodePool::Allocate(size_t size) {
+  if (size > kMaxBlockSize) {
+    return ::operator new(size);
+  }
+  auto size_class = SizeClass(size);
+  auto cache = GetThreadCache();
+  if (cache != nullptr) {
+    return cache->Allocate(size_class);
+  }
+  FreeList list;
+  GlobalPool::GetInstance().Fetch(size_class, &list);
+  auto block = list.Pop();
+  GlobalPool::GetInstance().Return(size_class, &list, list.count);
+  return block;
+}
+
+void NodePool::Free(void *ptr, size_t size) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (size > kMaxBlockSize) {
+    ::operator delete(ptr);
+    return;
+  }
+  auto size_class = SizeClass(size);
+  auto cache = GetThreadCache();
+  if (cache != nullptr) {
+    cache->Free(ptr, size_class);
+    return;
+  }
+  FreeList list;
+  list.Push(static_cast<FreeBlock *>(ptr));
+  GlobalPool::GetInstance().Return(size_class, &list, list.count);
+}
+}  // namespace mindspore
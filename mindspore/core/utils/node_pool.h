@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_UTILS_NODE_POOL_H_
+#define MINDSPORE_CORE_UTILS_NODE_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include "utils/visible.h"
+
+namespace mindspore {
+// The pool of the small blocks for the IR objects created in large numbers, such as the CNode, the ValueNode and the
+// Parameter. The object and its shared_ptr control block are allocated in one block, which is taken from the free list
+// of the thread and recycled to it, so creating and releasing the nodes avoids most of the malloc calls. The blocks are
+// carved from the big chunks which are never returned to the system, so the freed blocks are reused by the later
+// created nodes. The pool is disabled by env MS_DEV_IR_NODE_POOL=0.
+class MS_CORE_API NodePool {
+ public:
+  static bool enable();
+  static void *Allocate(size_t size);
+  static void Free(void *ptr, size_t size) noexcept;
+};
+
+template <typename T>
+class NodePoolAllocator {
+ public:
+  using value_type = T;
+
+  NodePoolAllocator() noexcept = default;
+  template <typename U>
+  NodePoolAllocator(const NodePoolAllocator<U> &) noexcept {}  // NOLINT
+
+  T *allocate(size_t n) { return static_cast<T *>(NodePool::Allocate(n * sizeof(T))); }
+  void deallocate(T *ptr, size_t n) noexcept { NodePool::Free(ptr, n * sizeof(T)); }
+
+  template <typename U>
+  bool operator==(const NodePoolAllocator<U> &) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const NodePoolAllocator<U> &) const noexcept {
+    return false;
+  }
+};
+
+// Create the IR object in the node pool, the same as std::make_shared when the pool is disabled.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakePooledShared(Args &&... args) {
+  if (!NodePool::enable()) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(NodePoolAllocator<T>(), std::forward<Args>(args)...);
+}
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CORE_UTILS_NODE_POOL_H_
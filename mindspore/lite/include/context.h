@@ -26,6 +26,7 @@ namespace mindspore::lite {
 typedef struct CpuDeviceInfo {
   bool enable_float16_ = false; /**< prior enable float16 inference */
   CpuBindMode cpu_bind_mode_ = MID_CPU;
+  bool enable_bfloat16_ = false; /**< store the constant weights of matmul in bfloat16 */
 } CpuDeviceInfo;
 
 /// \brief GpuDeviceInfo defined for GPU's configuration information.
@@ -54,11 +54,13 @@ class TrainCfg {
     this->loss_name_ = rhs.loss_name_;
     this->mix_precision_cfg_ = rhs.mix_precision_cfg_;
     this->accumulate_gradients_ = rhs.accumulate_gradients_;
+    this->recompute_memory_budget_ = rhs.recompute_memory_budget_;
   }
   TrainCfg &operator=(const TrainCfg &rhs) = default;
   std::vector<std::string> loss_name_ = {"loss_fct"}; /**< Set part of the name that identify a loss kernel */
   MixPrecisionCfg mix_precision_cfg_;                 /**< Mix precision configuration */
   bool accumulate_gradients_ = false; /**< If true gardents are accmulated and can be read by GetGradients */
+  size_t recompute_memory_budget_ = 0; /**< Tensor memory budget in bytes, activations are recomputed to fit it */
 };
 
 }  // namespace lite
@@ -65,9 +65,51 @@ static const char *const kMSCacheModelPath = "cache_model_path";
 static const char *const kMSCacheVocabSize = "vocab_size";
 static const char *const kMSCacheDeviceSize = "device_cache_size";
 static const char *const kMSCacheSerializePath = "serialize_path";
+static const char *const kMSCacheEngineCacheDir = "engine_cache_dir";
 // weight path
 static const char *const kWeight = "weight";
 static const char *const kWeightPath = "weight_path";
+// model load
+static const char *const kModelLoad = "model_load";
+static const char *const kModelLoadMmap = "mmap";
+// shape bucket
+static const char *const kShapeBucket = "shape_bucket";
+static const char *const kShapeBucketWarmUpShapes = "warm_up_shapes";
+// pack cache
+static const char *const kPackCache = "pack_cache";
+static const char *const kPackCacheDir = "cache_dir";
+// heterogeneous partition
+static const char *const kHeteroPartition = "hetero_partition";
+static const char *const kHeteroPartitionProfilePath = "profile_path";
+static const char *const kHeteroPartitionPlanPath = "plan_path";
+// thread cost model
+static const char *const kThreadCostModel = "thread_cost_model";
+static const char *const kThreadCostModelCalibrationFile = "calibration_file";
+// thread pool
+static const char *const kThreadPool = "thread_pool";
+static const char *const kThreadPoolAdaptiveSpin = "adaptive_spin";
+static const char *const kThreadPoolClusterGroups = "cluster_groups";
+// jit kernel
+static const char *const kJitKernel = "jit_kernel";
+static const char *const kJitKernelEnable = "enable";
+static const char *const kJitKernelCacheDir = "cache_dir";
+// kernel tune
+static const char *const kKernelTune = "kernel_tune";
+static const char *const kKernelTuneEnable = "enable";
+static const char *const kKernelTuneCacheFile = "cache_file";
+// opencl
+static const char *const kOpenCL = "opencl";
+static const char *const kOpenCLTuningMode = "tuning_mode";
+static const char *const kOpenCLBinaryCacheFile = "binary_cache_file";
+static const char *const kOpenCLEnableSvm = "enable_svm";
+// layout select
+static const char *const kLayoutSelect = "layout_select";
+static const char *const kLayoutSelectProfilePath = "profile_path";
+static const char *const kLayoutSelectPlanPath = "plan_path";
+// weight decode
+static const char *const kWeightDecode = "weight_decode";
+static const char *const kWeightDecodeLazy = "lazy_decode";
+static const char *const kWeightDecodeCacheSize = "decoded_cache_size";
 
 static const char *const kIsOptimized = "isOptimized";
 }  // namespace lite
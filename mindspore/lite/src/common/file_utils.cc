@@ -23,6 +23,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <sys/mman.h>
 #endif
 
 #include <cstdlib>
@@ -187,6 +188,52 @@ char *ReadFile(const char *file, size_t *size) {
   return buf;
 }
 
+char *MmapFile(const char *file, size_t *size) {
+#ifdef _WIN32
+  MS_LOG(WARNING) << "mmap is not supported on windows.";
+  return nullptr;
+#else
+  if (file == nullptr) {
+    MS_LOG(ERROR) << "File path is nullptr";
+    return nullptr;
+  }
+  MS_ASSERT(size != nullptr);
+  std::string real_path = RealPath(file);
+  if (real_path.empty()) {
+    MS_LOG(DEBUG) << "File path not regular: " << file;
+    return nullptr;
+  }
+  auto fd = open(real_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Open file " << real_path << " failed.";
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    MS_LOG(ERROR) << "Get size of file " << real_path << " failed.";
+    (void)close(fd);
+    return nullptr;
+  }
+  *size = static_cast<size_t>(file_stat.st_size);
+  // the pages are private, so the in-place modification of the weights does not write back to the file.
+  auto buf = mmap(nullptr, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  (void)close(fd);
+  if (buf == MAP_FAILED) {
+    MS_LOG(ERROR) << "mmap file " << real_path << " failed.";
+    return nullptr;
+  }
+  return static_cast<char *>(buf);
+#endif
+}
+
+void UnmapFile(char *buf, size_t size) {
+#ifndef _WIN32
+  if (buf != nullptr && munmap(buf, size) != 0) {
+    MS_LOG(WARNING) << "munmap model buffer failed.";
+  }
+#endif
+}
+
 std::string RealPath(const char *path) {
   if (path == nullptr) {
     MS_LOG(ERROR) << "path is nullptr";
@@ -51,6 +51,12 @@ char *ReadFileSegment(const std::string &file, int64_t offset, int64_t len);
 
 char *ReadFile(const char *file, size_t *size);
 
+// map the file to memory with copy-on-write pages, the constant data is read from the page cache directly. Return
+// nullptr when mmap is not supported, the buffer must be released by UnmapFile.
+char *MmapFile(const char *file, size_t *size);
+
+void UnmapFile(char *buf, size_t size);
+
 std::string RealPath(const char *path);
 
 int CreateOutputDir(std::string *file_path);
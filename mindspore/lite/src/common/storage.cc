@@ -27,9 +27,24 @@ namespace mindspore {
 namespace lite {
 namespace {
 constexpr size_t kMaxNum1024 = 1024;
+// The estimated size of the table fields besides the data of a tensor or a node.
+constexpr size_t kTableReservedSize = 256;
+
+// Reserve the builder by the size of the weights, the builder doubles the buffer and copies the built content when it
+// is full, which costs several copies of the weights for a large model.
+size_t EstimateBufferSize(const schema::MetaGraphT &graph) {
+  size_t size = kMaxNum1024 + (graph.nodes.size() + graph.allTensors.size()) * kTableReservedSize;
+  for (const auto &tensor : graph.allTensors) {
+    if (tensor != nullptr) {
+      size += tensor->data.size();
+    }
+  }
+  return size;
 }
+}  // namespace
+
 int Storage::Save(const schema::MetaGraphT &graph, const std::string &outputPath) {
-  flatbuffers::FlatBufferBuilder builder(kMaxNum1024);
+  flatbuffers::FlatBufferBuilder builder(EstimateBufferSize(graph));
   auto offset = schema::MetaGraph::Pack(builder, &graph);
   builder.Finish(offset);
   schema::FinishMetaGraphBuffer(builder, offset);
@@ -80,19 +95,34 @@ schema::MetaGraphT *Storage::Load(const std::string &inputPath) {
   if (filename.substr(filename.find_last_of(".") + 1) != "ms") {
     filename = filename + ".ms";
   }
-  auto buf = ReadFile(filename.c_str(), &size);
+  // The file is only read once when unpacking, so map it instead of copying it to a heap buffer first.
+  bool is_mmap = true;
+  auto buf = MmapFile(filename.c_str(), &size);
+  if (buf == nullptr) {
+    is_mmap = false;
+    buf = ReadFile(filename.c_str(), &size);
+  }
   if (buf == nullptr) {
     MS_LOG(ERROR) << "the file buffer is nullptr";
     return nullptr;
   }
+  auto release_buf = [is_mmap, buf, size]() {
+    if (is_mmap) {
+      UnmapFile(buf, size);
+    } else {
+      delete[] buf;
+    }
+  };
 
   flatbuffers::Verifier verify((const uint8_t *)buf, size);
   if (!schema::VerifyMetaGraphBuffer(verify)) {
     MS_LOG(ERROR) << "the buffer is invalid and fail to create meta graph";
+    release_buf();
     return nullptr;
   }
 
   auto graphDefT = schema::UnPackMetaGraph(buf);
+  release_buf();
   return graphDefT.release();
 }
 }  // namespace lite
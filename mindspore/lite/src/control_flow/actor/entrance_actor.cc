@@ -25,18 +25,20 @@ const constexpr int kToExitIndex = 0;
 }
 namespace mindspore::lite {
 void LiteEntranceOpActor::RunOpData(OpData<Tensor> *inputs, OpContext<Tensor> *context) {
-  input_actor_id_data_[inputs->op_id_].push_back(inputs);
-  if (input_actor_id_data_[inputs->op_id_].size() < kernel_->in_tensors().size()) {
+  // hashing the aid builds its name string, so look up the input data of the sender only once in each iteration.
+  auto &input_datas = input_actor_id_data_[inputs->op_id_];
+  input_datas.push_back(inputs);
+  if (input_datas.size() < kernel_->in_tensors().size()) {
     return;
   }
 
-  entrance_input_aid_ = input_actor_id_data_[inputs->op_id_].front()->op_id_;
-  for (auto item : input_actor_id_data_[inputs->op_id_]) {
+  entrance_input_aid_ = input_datas.front()->op_id_;
+  for (auto item : input_datas) {
     inputs_data_[item->index_] = item->data_;
   }
 
   InitInputData();
-  input_actor_id_data_[inputs->op_id_].clear();
+  input_datas.clear();
   AsyncOutput(context);
   SetOutputData(context);
   return;
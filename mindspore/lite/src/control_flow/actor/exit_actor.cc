@@ -16,6 +16,7 @@
 
 #include "src/control_flow/actor/exit_actor.h"
 #include <algorithm>
+#include <iterator>
 #include "src/control_flow/kernel/exit_subgraph_kernel.h"
 #include "src/litert/kernel_exec_util.h"
 #include "src/common/tensor_util.h"
@@ -93,31 +94,27 @@ int LiteExitOpActor::PrepareOutputData() {
 }
 
 void LiteExitOpActor::AsyncOutput(OpContext<Tensor> *context) {
-  AID to_op_id;
-  bool find_to_op_aid = false;
-  for (auto info : all_mapping_info_) {
-    if (info.partial_input_aid == entrance_input_aid_) {
-      find_to_op_aid = true;
-      to_op_id = info.call_output_aid;
+  if (last_mapping_index_ >= all_mapping_info_.size() ||
+      all_mapping_info_[last_mapping_index_].partial_input_aid != entrance_input_aid_) {
+    auto iter = std::find_if(all_mapping_info_.rbegin(), all_mapping_info_.rend(), [this](const MappingInfo &info) {
+      return info.partial_input_aid == entrance_input_aid_;
+    });
+    if (iter == all_mapping_info_.rend()) {
+      MS_LOG(ERROR) << "exit actor can not find output actor.";
+      context->SetFailed(RET_ERROR);
+      return;
     }
+    last_mapping_index_ = static_cast<size_t>(std::distance(iter, all_mapping_info_.rend())) - 1;
   }
 
-  if (!find_to_op_aid) {
-    MS_LOG(ERROR) << "exit actor can not find output actor.";
-    context->SetFailed(RET_ERROR);
-    return;
-  }
-
-  if (to_op_id.Name() == "") {
+  const auto &info = all_mapping_info_[last_mapping_index_];
+  if (info.call_output_aid.Name() == "") {
     SetOutputData(context);
   }
 
-  for (size_t i = 0; i < output_data_arrows_.size(); i++) {
-    if (output_data_arrows_[i]->to_op_id_ != to_op_id && output_data_arrows_[i]->to_op_id_.Name() != "") {
-      continue;
-    }
-    auto data = outputs_data_.at(i);
-    Async(to_op_id, get_actor_mgr(), &mindspore::OpActor<Tensor>::RunOpData, data.get(), context);
+  for (auto index : info.output_data_indices) {
+    auto data = outputs_data_.at(index);
+    Async(info.call_output_aid, get_actor_mgr(), &mindspore::OpActor<Tensor>::RunOpData, data.get(), context);
   }
 }
 
@@ -196,9 +193,22 @@ int LiteExitOpActor::PostInit() {
   }
 
   RecordPartialNodeInputActor();
+  RecordOutputDataIndices();
   return RET_OK;
 }
 
+void LiteExitOpActor::RecordOutputDataIndices() {
+  for (auto &info : all_mapping_info_) {
+    info.output_data_indices.clear();
+    for (size_t i = 0; i < output_data_arrows_.size(); i++) {
+      auto &to_op_id = output_data_arrows_[i]->to_op_id_;
+      if (to_op_id == info.call_output_aid || to_op_id.Name() == "") {
+        info.output_data_indices.push_back(i);
+      }
+    }
+  }
+}
+
 void LiteExitOpActor::RecordPartialNodeInputActor() {
   for (auto actor : *actors_) {
     auto actor_partial_nodes = actor->GetPartialKernels();
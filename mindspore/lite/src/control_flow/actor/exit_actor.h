@@ -45,16 +45,21 @@ class LiteExitOpActor : public LiteOpActor {
     kernel::KernelExec *call_node = nullptr;
     AID partial_input_aid;
     AID call_output_aid;
+    // the indices of the output data sent to the call output actor, which are fixed after the arrows are compiled.
+    std::vector<size_t> output_data_indices;
   };
   int CreateMappingInfo();
   int RecordCallNodeOutputActor(std::vector<std::shared_ptr<LiteOpActor>> *actors);
   void RecordPartialNodeInputActor();
+  void RecordOutputDataIndices();
   void SetEntranceInputAID(OpData<Tensor> *inputs);
   bool IsSubSet(const std::vector<lite::Tensor *> &all_set, const std::vector<lite::Tensor *> &sub_set);
 
   std::vector<std::shared_ptr<LiteOpActor>> *actors_{};
   std::vector<MappingInfo> all_mapping_info_{};
   AID entrance_input_aid_;
+  // the mapping info used by the last run, which is reused when the same partial calls again, such as in a loop.
+  size_t last_mapping_index_{0};
 };
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_CONTROL_FLOW_ACTOR_EXIT_ACTOR_H_
@@ -256,8 +256,8 @@ void LiteSwitchOpActor::AsyncBranchOutput(const size_t &index, OpContext<Tensor>
     context->SetFailed(RET_ERROR);
     return;
   }
-  auto branch_output_data_arrows = all_branch_output_data_arrows_.at(index);
-  auto branch_outputs_data = all_branchs_output_data_.at(index);
+  const auto &branch_output_data_arrows = all_branch_output_data_arrows_.at(index);
+  const auto &branch_outputs_data = all_branchs_output_data_.at(index);
   if (branch_output_data_arrows.size() != branch_outputs_data.size()) {
     MS_LOG(ERROR) << "index " << index
                   << " extend all_branchs_output_data_.size(): " << all_branchs_output_data_.size();
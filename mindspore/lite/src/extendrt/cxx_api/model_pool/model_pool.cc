@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "src/extendrt/cxx_api/model_pool/model_pool.h"
+#include <sched.h>
 #include <unistd.h>
 #include <future>
 #include "mindspore/ccsrc/plugin/device/cpu/kernel/nnacl/op_base.h"
@@ -24,6 +25,7 @@
 #include "src/litert/pack_weight_manager.h"
 #include "src/extendrt/numa_adapter.h"
 #include "src/common/common.h"
+#include "src/common/utils.h"
 namespace mindspore {
 namespace {
 constexpr int kNumDeviceInfo = 2;
@@ -35,6 +37,11 @@ constexpr int kDefaultWorkerNumPerPhysicalCpu = 2;
 constexpr int kDefaultThreadsNum = 8;
 constexpr int kInvalidNumaId = -1;
 constexpr int kNumDefaultInterOpParallel = 4;
+constexpr auto kModelPoolSection = "model_pool";
+constexpr auto kDynamicBatchSizeKey = "dynamic_batch_size";
+constexpr auto kDynamicBatchDelayKey = "dynamic_batch_delay_us";
+constexpr auto kDynamicBatchPadKey = "dynamic_batch_pad_sequence";
+constexpr auto kNumaPartitionKey = "numa_partition";
 
 Status DistinguishPhysicalAndLogical(std::vector<int> *physical_list, std::vector<int> *logical_list) {
   int processor_id = -1;
@@ -778,6 +785,8 @@ Status ModelPool::CreateModelPoolWorker(const char *model_buf, size_t size, Mode
     MS_LOG(ERROR) << "predict task queue init failed, status=" << status;
     return kLiteError;
   }
+  model_pool_info_[strategy].predict_task_queue_->SetDynamicBatchConfig(dynamic_batch_config_);
+  model_pool_info_[strategy].predict_task_queue_->SetStealTask(numa_partition_ && model_pool_info_[strategy].use_numa);
 
   status = CreateWorkers(model_buf, size, model_pool_config, strategy);
   if (status != kSuccess) {
@@ -864,12 +873,95 @@ Status ModelPool::InitAdvancedStrategy(const char *model_buf, size_t size, int b
   return kSuccess;
 }
 
+Status ModelPool::InitDynamicBatchConfig(const std::shared_ptr<RunnerConfig> &runner_config) {
+  if (runner_config == nullptr) {
+    return kSuccess;
+  }
+  auto config_info = runner_config->GetConfigInfo();
+  auto section = config_info.find(kModelPoolSection);
+  if (section == config_info.end()) {
+    return kSuccess;
+  }
+  auto &configs = section->second;
+  int value = 0;
+  if (configs.find(kDynamicBatchSizeKey) != configs.end()) {
+    if (!lite::ConvertStrToInt(configs[kDynamicBatchSizeKey], &value) || value <= 0 || value > kNumMaxTaskQueueSize) {
+      MS_LOG(ERROR) << kDynamicBatchSizeKey << " should be in range [1, " << kNumMaxTaskQueueSize
+                    << "], but got: " << configs[kDynamicBatchSizeKey];
+      return kLiteParamInvalid;
+    }
+    dynamic_batch_config_.max_batch_size = static_cast<size_t>(value);
+  }
+  if (configs.find(kDynamicBatchDelayKey) != configs.end()) {
+    if (!lite::ConvertStrToInt(configs[kDynamicBatchDelayKey], &value) || value < 0) {
+      MS_LOG(ERROR) << kDynamicBatchDelayKey << " should not be less than 0, but got: "
+                    << configs[kDynamicBatchDelayKey];
+      return kLiteParamInvalid;
+    }
+    dynamic_batch_config_.max_delay_us = value;
+  }
+  if (configs.find(kDynamicBatchPadKey) != configs.end()) {
+    dynamic_batch_config_.pad_sequence = configs[kDynamicBatchPadKey] == "true";
+  }
+  MS_LOG(INFO) << "dynamic batch size: " << dynamic_batch_config_.max_batch_size
+               << " | max delay: " << dynamic_batch_config_.max_delay_us
+               << "us | pad sequence: " << dynamic_batch_config_.pad_sequence;
+  return kSuccess;
+}
+
+Status ModelPool::InitNumaPartitionConfig(const std::shared_ptr<RunnerConfig> &runner_config) {
+  if (runner_config == nullptr) {
+    return kSuccess;
+  }
+  auto config_info = runner_config->GetConfigInfo();
+  auto section = config_info.find(kModelPoolSection);
+  if (section == config_info.end()) {
+    return kSuccess;
+  }
+  auto &configs = section->second;
+  if (configs.find(kNumaPartitionKey) == configs.end() || configs[kNumaPartitionKey] != "true") {
+    return kSuccess;
+  }
+  if (!numa_available_) {
+    MS_LOG(WARNING) << "numa is not available, " << kNumaPartitionKey << " is ignored.";
+    return kSuccess;
+  }
+  auto set_core_numa_id = [this](const std::vector<int> &numa_cores, int numa_id) {
+    for (auto core_id : numa_cores) {
+      if (core_id < 0) {
+        continue;
+      }
+      if (static_cast<size_t>(core_id) >= core_numa_id_.size()) {
+        core_numa_id_.resize(core_id + 1, kInvalidNumaId);
+      }
+      core_numa_id_[core_id] = numa_id;
+    }
+  };
+  for (size_t numa_id = 0; numa_id < numa_physical_cores_.size(); numa_id++) {
+    set_core_numa_id(numa_physical_cores_[numa_id], static_cast<int>(numa_id));
+    set_core_numa_id(numa_logical_cores_.at(numa_id), static_cast<int>(numa_id));
+  }
+  numa_partition_ = true;
+  MS_LOG(INFO) << "numa partition is enabled, numa node num: " << numa_node_num_;
+  return kSuccess;
+}
+
 Status ModelPool::Init(const char *model_buf, size_t size, const std::shared_ptr<RunnerConfig> &runner_config) {
   auto status = InitNumaParameter(runner_config);
   if (status != kSuccess) {
     MS_LOG(ERROR) << "Init numa parameter failed.";
     return kLiteError;
   }
+  status = InitDynamicBatchConfig(runner_config);
+  if (status != kSuccess) {
+    MS_LOG(ERROR) << "Init dynamic batch config failed.";
+    return status;
+  }
+  status = InitNumaPartitionConfig(runner_config);
+  if (status != kSuccess) {
+    MS_LOG(ERROR) << "Init numa partition config failed.";
+    return status;
+  }
 
   status = InitBaseStrategy(model_buf, size, runner_config);
   if (status != kSuccess) {
@@ -908,6 +1000,26 @@ Status ModelPool::InitByBuf(const char *model_data, size_t size, const std::shar
 }
 
 Status ModelPool::InitByPath(const std::string &model_path, const std::shared_ptr<RunnerConfig> &runner_config) {
+  if (runner_config != nullptr) {
+    auto config_info = runner_config->GetConfigInfo();
+    auto model_load = config_info.find(lite::kModelLoad);
+    if (model_load != config_info.end() && model_load->second[lite::kModelLoadMmap] == "true") {
+      // the workers copy the model buffer to their numa nodes, so the mapped file is only read once without the
+      // intermediate heap copy.
+      size_t mmap_size = 0;
+      auto mmap_buf = lite::MmapFile(model_path.c_str(), &mmap_size);
+      if (mmap_buf != nullptr) {
+        auto status = Init(mmap_buf, mmap_size, runner_config);
+        lite::UnmapFile(mmap_buf, mmap_size);
+        if (status != kSuccess) {
+          MS_LOG(ERROR) << "init failed.";
+          return kLiteError;
+        }
+        return kSuccess;
+      }
+      MS_LOG(WARNING) << "mmap model file failed, read the model file instead.";
+    }
+  }
   size_t size = 0;
   auto model_buf = lite::ReadFile(model_path.c_str(), &size);
   if (model_buf == nullptr) {
@@ -943,6 +1055,32 @@ Status ModelPool::UpdateConfig(const std::string &section, const std::pair<std::
   return kSuccess;
 }
 
+int ModelPool::GetMaxWaitTaskQueueId(Strategy strategy) {
+  int max_wait_worker_node_id = 0;
+  int max_wait_worker_num = model_pool_info_[strategy].predict_task_queue_->GetWaitModelNum(0);
+  for (int i = 1; i < model_pool_info_[strategy].task_queue_num_; i++) {
+    int worker_num = model_pool_info_[strategy].predict_task_queue_->GetWaitModelNum(i);
+    if (max_wait_worker_num <= worker_num) {
+      max_wait_worker_num = worker_num;
+      max_wait_worker_node_id = i;
+    }
+  }
+  return max_wait_worker_node_id;
+}
+
+int ModelPool::GetLocalTaskQueueId(Strategy strategy) {
+  if (!numa_partition_ || !model_pool_info_[strategy].use_numa) {
+    return -1;
+  }
+  auto core_id = sched_getcpu();
+  if (core_id < 0 || static_cast<size_t>(core_id) >= core_numa_id_.size()) {
+    return -1;
+  }
+  // the task queue id of the worker is the numa id it binds to.
+  auto numa_id = core_numa_id_[core_id];
+  return numa_id < model_pool_info_[strategy].task_queue_num_ ? numa_id : -1;
+}
+
 std::shared_ptr<ModelWorker> ModelPool::GetMaxWaitWorkerNum(int *max_wait_worker_node_id, int *max_wait_worker_num,
                                                             Strategy strategy) {
   *max_wait_worker_node_id = 0;
@@ -955,12 +1093,22 @@ std::shared_ptr<ModelWorker> ModelPool::GetMaxWaitWorkerNum(int *max_wait_worker
       *max_wait_worker_node_id = i;
     }
   }
+  auto local_task_queue_id = GetLocalTaskQueueId(strategy);
+  if (local_task_queue_id >= 0) {
+    int local_wait_worker_num = model_pool_info_[strategy].predict_task_queue_->GetWaitModelNum(local_task_queue_id);
+    // keep the task on the local numa node unless only the remote node has idle workers, the queued task of the
+    // overloaded node is stolen by the idle remote workers.
+    if (local_wait_worker_num > 0 || *max_wait_worker_num <= 0) {
+      *max_wait_worker_num = local_wait_worker_num;
+      *max_wait_worker_node_id = local_task_queue_id;
+    }
+  }
   if (*max_wait_worker_num > 0) {
     auto task_queue_id = *max_wait_worker_node_id;
     for (auto worker_info : all_workers_[strategy]) {
       auto worker = worker_info->worker;
       auto worker_config = worker_info->worker_config;
-      if (worker->IsAvailable()) {
+      if (worker_config->task_queue_id == task_queue_id && worker->IsAvailable()) {
         *max_wait_worker_num = model_pool_info_[strategy].predict_task_queue_->GetWaitModelNum(task_queue_id);
         *max_wait_worker_node_id = task_queue_id;
         return worker;
@@ -1016,7 +1164,13 @@ Status ModelPool::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTen
   if (use_advanced_strategy_) {
     strategy = UpdateStrategy();
   }
-  auto available_worker = GetMaxWaitWorkerNum(&max_wait_worker_node_id, &max_wait_worker_num, strategy);
+  std::shared_ptr<ModelWorker> available_worker = nullptr;
+  if (dynamic_batch_config_.max_batch_size > 1) {
+    // not dispatch to the idle worker directly, so that the concurrent tasks can be merged in the task queue.
+    max_wait_worker_node_id = GetMaxWaitTaskQueueId(strategy);
+  } else {
+    available_worker = GetMaxWaitWorkerNum(&max_wait_worker_node_id, &max_wait_worker_num, strategy);
+  }
   if (inputs.size() == 0) {
     predict_task_mutex_.unlock();
     MS_LOG(ERROR) << "inputs is invalid. input size: " << inputs.size();
@@ -89,6 +89,14 @@ class ModelPool {
   Status SetBindStrategy(std::vector<std::vector<int>> *all_model_bind_list, std::vector<int> *numa_node_id,
                          std::vector<int> *task_queue_id, int thread_num, Strategy strategy);
 
+  Status InitDynamicBatchConfig(const std::shared_ptr<RunnerConfig> &runner_config);
+
+  Status InitNumaPartitionConfig(const std::shared_ptr<RunnerConfig> &runner_config);
+
+  int GetLocalTaskQueueId(Strategy strategy);
+
+  int GetMaxWaitTaskQueueId(Strategy strategy);
+
   std::shared_ptr<ModelWorker> GetMaxWaitWorkerNum(int *max_wait_worker_node_id, int *max_wait_worker_num,
                                                    Strategy strategy);
 
@@ -153,6 +161,9 @@ class ModelPool {
   std::mutex task_id_mutex_;
   std::queue<size_t> free_tasks_id_;
 
+  // dynamic batching, the tasks are always pushed to the task queue to be merged by the workers
+  DynamicBatchConfig dynamic_batch_config_;
+
   // bind core
   bool is_user_core_list_ = false;
 
@@ -162,6 +173,10 @@ class ModelPool {
   // numa id -> core id
   std::vector<std::vector<int>> numa_physical_cores_;
   std::vector<std::vector<int>> numa_logical_cores_;
+  // numa partition: the requests are served by the workers and the weight of the numa node the caller runs on.
+  bool numa_partition_ = false;
+  // core id -> numa id
+  std::vector<int> core_numa_id_;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_MODEL_POOL_H_
@@ -14,11 +14,30 @@
  * limitations under the License.
  */
 #include "src/extendrt/cxx_api/model_pool/model_worker.h"
+#include <algorithm>
 #include "src/common/log_adapter.h"
 #include "src/extendrt/numa_adapter.h"
 #include "src/common/common.h"
 #include "nnacl/op_base.h"
 namespace mindspore {
+namespace {
+constexpr size_t kBatchDim = 0;
+constexpr size_t kSeqDim = 1;
+
+size_t GetInnerSize(const std::vector<int64_t> &shape, size_t begin) {
+  size_t inner_size = 1;
+  for (size_t i = begin; i < shape.size(); i++) {
+    inner_size *= static_cast<size_t>(shape[i]);
+  }
+  return inner_size;
+}
+
+size_t GetElementSize(const MSTensor &tensor) {
+  auto element_num = tensor.ElementNum();
+  return element_num > 0 ? tensor.DataSize() / static_cast<size_t>(element_num) : 0;
+}
+}  // namespace
+
 void ModelWorker::PrintWorkerInfo() {
   MS_LOG(ERROR) << "worker id: " << worker_config_->worker_id << " | strategy: " << worker_config_->strategy
                 << " | bind core mode: " << worker_config_->context->GetThreadAffinityMode()
@@ -66,7 +85,22 @@ void ModelWorker::Run() {
   int task_queue_id = worker_config_->task_queue_id;
   create_work_done_ = true;
   create_work_done_condition_.notify_one();
+  std::vector<PredictTask *> tasks;
   while (!predict_task_queue_->IsPredictTaskDone()) {
+    if (predict_task_queue_->EnableDynamicBatch()) {
+      predict_task_queue_->GetPredictTasks(task_queue_id, this, &tasks);
+      if (tasks.empty()) {
+        available_ = true;
+        continue;
+      }
+      available_ = false;
+      PredictBatch(tasks);
+      for (auto batch_task : tasks) {
+        batch_task->ready = true;
+        predict_task_queue_->ActiveTask(batch_task);
+      }
+      continue;
+    }
     auto task = predict_task_queue_->GetPredictTask(task_queue_id, this);
     if (task == nullptr) {
       MS_LOG(DEBUG) << "task queue is empty, wait task ...";
@@ -90,6 +124,167 @@ void ModelWorker::Run() {
   }
 }
 
+void ModelWorker::PredictBatch(const std::vector<PredictTask *> &tasks) {
+  if (tasks.size() > 1 && CanMergeTasks(tasks)) {
+    std::vector<MSTensor> batch_inputs;
+    std::vector<int64_t> seq_lens;
+    std::vector<MSTensor> batch_outputs;
+    auto status = MergeInputs(tasks, &batch_inputs, &seq_lens);
+    if (status == kSuccess) {
+      status = Predict(batch_inputs, &batch_outputs);
+    }
+    if (status == kSuccess) {
+      status = SplitOutputs(tasks, batch_outputs, seq_lens);
+    }
+    if (status == kSuccess) {
+      MS_LOG(DEBUG) << "worker " << worker_config_->worker_id << " predict " << tasks.size() << " tasks in one batch.";
+      return;
+    }
+    MS_LOG(WARNING) << "batched predict failed, predict the " << tasks.size() << " tasks one by one.";
+  }
+  for (auto task : tasks) {
+    auto status = Predict(*task->inputs, task->outputs, task->before, task->after);
+    if (status != kSuccess) {
+      PrintWorkerInfo();
+      MS_LOG(ERROR) << "model predict failed.";
+    }
+  }
+}
+
+bool ModelWorker::CanMergeTasks(const std::vector<PredictTask *> &tasks) {
+  auto pad_sequence = predict_task_queue_->GetDynamicBatchConfig().pad_sequence;
+  auto &first_inputs = *tasks.front()->inputs;
+  for (auto task : tasks) {
+    // the callbacks and the user set outputs belong to one task, they can not be shared by the batch.
+    if (task->before != nullptr || task->after != nullptr) {
+      return false;
+    }
+    for (auto &output : *task->outputs) {
+      if (output.Data() != nullptr) {
+        return false;
+      }
+    }
+    auto &inputs = *task->inputs;
+    if (inputs.size() != first_inputs.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < inputs.size(); i++) {
+      auto shape = inputs[i].Shape();
+      auto first_shape = first_inputs[i].Shape();
+      if (inputs[i].DataType() != first_inputs[i].DataType() || inputs[i].DataType() == DataType::kObjectTypeString ||
+          shape.size() != first_shape.size() || shape.empty() || inputs[i].Data() == nullptr) {
+        return false;
+      }
+      for (size_t j = kSeqDim; j < shape.size(); j++) {
+        if (shape[j] != first_shape[j] && !(pad_sequence && j == kSeqDim)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+Status ModelWorker::MergeInputs(const std::vector<PredictTask *> &tasks, std::vector<MSTensor> *batch_inputs,
+                                std::vector<int64_t> *seq_lens) {
+  auto &first_inputs = *tasks.front()->inputs;
+  bool padded = false;
+  for (size_t i = 0; i < first_inputs.size(); i++) {
+    auto batch_shape = first_inputs[i].Shape();
+    batch_shape[kBatchDim] = 0;
+    for (auto task : tasks) {
+      auto shape = task->inputs->at(i).Shape();
+      batch_shape[kBatchDim] += shape[kBatchDim];
+      if (batch_shape.size() > kSeqDim) {
+        batch_shape[kSeqDim] = std::max(batch_shape[kSeqDim], shape[kSeqDim]);
+      }
+    }
+    auto element_size = GetElementSize(first_inputs[i]);
+    // the padded rows are kept as zero.
+    std::vector<uint8_t> batch_data(GetInnerSize(batch_shape, kBatchDim) * element_size, 0);
+    auto batch_row_size = GetInnerSize(batch_shape, kSeqDim) * element_size;
+    size_t offset = 0;
+    bool need_pad = false;
+    for (auto task : tasks) {
+      auto &input = task->inputs->at(i);
+      auto shape = input.Shape();
+      auto row_size = GetInnerSize(shape, kSeqDim) * element_size;
+      need_pad = need_pad || (row_size != batch_row_size);
+      auto src = static_cast<const uint8_t *>(input.Data().get());
+      for (int64_t b = 0; b < shape[kBatchDim]; b++) {
+        memcpy(batch_data.data() + offset, src + b * row_size, row_size);
+        offset += batch_row_size;
+      }
+    }
+    // the sequence length of the first padded input is used to trim the padded outputs.
+    if (need_pad && !padded) {
+      padded = true;
+      for (auto task : tasks) {
+        seq_lens->push_back(task->inputs->at(i).Shape()[kSeqDim]);
+      }
+    }
+    auto batch_input = MSTensor::CreateTensor(first_inputs[i].Name(), first_inputs[i].DataType(), batch_shape,
+                                              batch_data.data(), batch_data.size());
+    if (batch_input == nullptr) {
+      MS_LOG(ERROR) << "create batched input tensor failed.";
+      return kLiteNullptr;
+    }
+    batch_inputs->push_back(*batch_input);
+    MSTensor::DestroyTensorPtr(batch_input);
+  }
+  return kSuccess;
+}
+
+Status ModelWorker::SplitOutputs(const std::vector<PredictTask *> &tasks, const std::vector<MSTensor> &batch_outputs,
+                                 const std::vector<int64_t> &seq_lens) {
+  int64_t batch_size = 0;
+  for (auto task : tasks) {
+    batch_size += task->inputs->front().Shape()[kBatchDim];
+  }
+  for (auto &batch_output : batch_outputs) {
+    auto batch_shape = batch_output.Shape();
+    if (batch_shape.empty() || batch_shape[kBatchDim] != batch_size) {
+      MS_LOG(WARNING) << "output " << batch_output.Name() << " is not batched by the first dim.";
+      return kLiteError;
+    }
+  }
+  for (auto task : tasks) {
+    task->outputs->clear();
+  }
+  auto max_seq_len = seq_lens.empty() ? 0 : *std::max_element(seq_lens.begin(), seq_lens.end());
+  for (auto &batch_output : batch_outputs) {
+    auto batch_shape = batch_output.Shape();
+    // the output keeps the padded sequence dim, so trim it to the sequence length of each task.
+    bool need_trim = !seq_lens.empty() && batch_shape.size() > kSeqDim && batch_shape[kSeqDim] == max_seq_len;
+    auto element_size = GetElementSize(batch_output);
+    auto batch_row_size = GetInnerSize(batch_shape, kSeqDim) * element_size;
+    auto src = static_cast<const uint8_t *>(batch_output.Data().get());
+    size_t offset = 0;
+    for (size_t t = 0; t < tasks.size(); t++) {
+      auto shape = batch_shape;
+      shape[kBatchDim] = tasks[t]->inputs->front().Shape()[kBatchDim];
+      if (need_trim) {
+        shape[kSeqDim] = seq_lens[t];
+      }
+      auto row_size = GetInnerSize(shape, kSeqDim) * element_size;
+      std::vector<uint8_t> data(GetInnerSize(shape, kBatchDim) * element_size);
+      for (int64_t b = 0; b < shape[kBatchDim]; b++) {
+        memcpy(data.data() + b * row_size, src + offset, row_size);
+        offset += batch_row_size;
+      }
+      auto output = MSTensor::CreateTensor(batch_output.Name(), batch_output.DataType(), shape, data.data(),
+                                           data.size());
+      if (output == nullptr) {
+        MS_LOG(ERROR) << "create output tensor of task failed.";
+        return kLiteNullptr;
+      }
+      tasks[t]->outputs->push_back(*output);
+      MSTensor::DestroyTensorPtr(output);
+    }
+  }
+  return kSuccess;
+}
+
 Status ModelWorker::Init(const char *model_buf, size_t size) {
   MS_CHECK_TRUE_MSG(model_buf != nullptr, kLiteError, "model_buf is nullptr in model worker.");
   model_ = std::make_shared<Model>();
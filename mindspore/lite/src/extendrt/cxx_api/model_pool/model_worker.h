@@ -28,6 +28,7 @@
 #include "src/extendrt/cxx_api/model_pool/predict_task_queue.h"
 namespace mindspore {
 class PredictTaskQueue;
+struct PredictTask;
 enum Strategy { BASE = 0, ADVANCED = 1 };
 
 struct WorkerConfig {
@@ -66,6 +67,17 @@ class ModelWorker {
  private:
   void Run();
 
+  // predict the tasks got by dynamic batching, the tasks which can not be merged are predicted one by one.
+  void PredictBatch(const std::vector<PredictTask *> &tasks);
+
+  bool CanMergeTasks(const std::vector<PredictTask *> &tasks);
+
+  Status MergeInputs(const std::vector<PredictTask *> &tasks, std::vector<MSTensor> *batch_inputs,
+                     std::vector<int64_t> *seq_lens);
+
+  Status SplitOutputs(const std::vector<PredictTask *> &tasks, const std::vector<MSTensor> &batch_outputs,
+                      const std::vector<int64_t> &seq_lens);
+
   std::pair<std::vector<std::vector<int64_t>>, bool> GetModelResize(const std::vector<MSTensor> &model_inputs,
                                                                     const std::vector<MSTensor> &inputs);
 
@@ -15,6 +15,7 @@
  */
 
 #include "src/extendrt/cxx_api/model_pool/predict_task_queue.h"
+#include <chrono>
 #include "src/common/log_adapter.h"
 namespace mindspore {
 PredictTaskQueue::~PredictTaskQueue() {
@@ -62,6 +63,8 @@ Status PredictTaskQueue::InitTaskQueue(size_t num, size_t max_queue_size) {
     MS_LOG(ERROR) << "new wait worker num list failed.";
     return kLiteError;
   }
+  batch_collecting_.assign(num, false);
+  task_queue_num_ = static_cast<int>(num);
   return kSuccess;
 }
 
@@ -91,16 +94,46 @@ void PredictTaskQueue::PushPredictTask(PredictTask *task, int node_id) {
 
 PredictTask *PredictTaskQueue::GetPredictTask(int node_id, ModelWorker *worker) {
   std::unique_lock<std::mutex> task_lock(mtx_predict_task_);
-#ifdef USE_HQUEUE
-  while ((predict_task_[node_id].Empty() || (!worker->IsAvailable())) && (!predict_task_done_)) {
+  int task_queue_id = GetReadyTaskQueueId(node_id);
+  while ((task_queue_id < 0 || (!worker->IsAvailable())) && (!predict_task_done_)) {
     task_push_cond_.wait(task_lock);
+    task_queue_id = GetReadyTaskQueueId(node_id);
+  }
+  if (predict_task_done_ || task_queue_id < 0) {
+    return nullptr;
+  }
+  return PopTask(task_queue_id);
+}
+
+int PredictTaskQueue::GetReadyTaskQueueId(int node_id) {
+  if (!TaskQueueEmpty(node_id)) {
+    return node_id;
+  }
+  if (!steal_task_) {
+    return -1;
+  }
+  // the pending tasks of an overloaded task queue outnumber its idle workers, they are taken by the other numa nodes.
+  for (int i = 0; i < task_queue_num_; i++) {
+    if (i != node_id && idle_worker_num_[i] < 0 && !TaskQueueEmpty(i)) {
+      return i;
+    }
   }
+  return -1;
+}
+
+bool PredictTaskQueue::TaskQueueEmpty(int node_id) {
+#ifdef USE_HQUEUE
+  return predict_task_[node_id].Empty();
+#else
+  return predict_task_[node_id].empty();
+#endif
+}
+
+PredictTask *PredictTaskQueue::PopTask(int node_id) {
+#ifdef USE_HQUEUE
   return predict_task_[node_id].Dequeue();
 #else
-  while ((predict_task_[node_id].empty() || (!worker->IsAvailable())) && (!predict_task_done_)) {
-    task_push_cond_.wait(task_lock);
-  }
-  if (predict_task_done_) {
+  if (predict_task_[node_id].empty()) {
     return nullptr;
   }
   auto predict_task = predict_task_[node_id].front();
@@ -108,4 +141,33 @@ PredictTask *PredictTaskQueue::GetPredictTask(int node_id, ModelWorker *worker)
   return predict_task;
 #endif
 }
+
+void PredictTaskQueue::GetPredictTasks(int node_id, ModelWorker *worker, std::vector<PredictTask *> *tasks) {
+  tasks->clear();
+  std::unique_lock<std::mutex> task_lock(mtx_predict_task_);
+  while ((batch_collecting_[node_id] || TaskQueueEmpty(node_id) || (!worker->IsAvailable())) &&
+         (!predict_task_done_)) {
+    task_push_cond_.wait(task_lock);
+  }
+  if (predict_task_done_) {
+    return;
+  }
+  batch_collecting_[node_id] = true;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(dynamic_batch_config_.max_delay_us);
+  while (tasks->size() < dynamic_batch_config_.max_batch_size) {
+    auto predict_task = PopTask(node_id);
+    if (predict_task != nullptr) {
+      tasks->push_back(predict_task);
+      continue;
+    }
+    if (predict_task_done_ || std::chrono::steady_clock::now() >= deadline) {
+      break;
+    }
+    (void)task_push_cond_.wait_until(task_lock, deadline);
+  }
+  batch_collecting_[node_id] = false;
+  task_lock.unlock();
+  // wake up the other workers of this task queue to collect the next batch.
+  task_push_cond_.notify_all();
+}
 }  // namespace mindspore
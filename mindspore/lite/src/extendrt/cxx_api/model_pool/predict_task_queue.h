@@ -43,6 +43,15 @@ struct PredictTask {
   std::mutex task_done_mutex;
 };
 
+// dynamic batching: the worker coalesces the concurrent tasks of one task queue into one batched predict, the
+// collection stops when max_batch_size tasks are got or max_delay_us passed since the first task is got.
+struct DynamicBatchConfig {
+  size_t max_batch_size = 1;
+  int64_t max_delay_us = 0;
+  // pad the inputs of different sequence length (the second dim) to the longest one with zero.
+  bool pad_sequence = false;
+};
+
 class PredictTaskQueue {
  public:
   PredictTaskQueue() = default;
@@ -51,6 +60,7 @@ class PredictTaskQueue {
   void PushPredictTask(PredictTask *task, int node_id);
   void WaitUntilPredictActive(PredictTask *task, int node_id);
   PredictTask *GetPredictTask(int node_id, ModelWorker *worker);
+  void GetPredictTasks(int node_id, ModelWorker *worker, std::vector<PredictTask *> *tasks);
   void ActiveTask(PredictTask *task);
   void ActiveTaskQueue() { task_push_cond_.notify_all(); }
   Status InitTaskQueue(size_t num, size_t max_queue_size);
@@ -61,7 +71,18 @@ class PredictTaskQueue {
   void DecreaseWaitModelNum(int num, int node_id) { idle_worker_num_[node_id] -= num; }
   void IncreaseWaitModelNum(int num, int node_id) { idle_worker_num_[node_id] += num; }
 
+  void SetDynamicBatchConfig(const DynamicBatchConfig &config) { dynamic_batch_config_ = config; }
+  const DynamicBatchConfig &GetDynamicBatchConfig() const { return dynamic_batch_config_; }
+  bool EnableDynamicBatch() const { return dynamic_batch_config_.max_batch_size > 1; }
+
+  // numa partition: the idle worker takes the task of the other task queue only when that queue is overloaded.
+  void SetStealTask(bool steal_task) { steal_task_ = steal_task; }
+
  private:
+  bool TaskQueueEmpty(int node_id);
+  PredictTask *PopTask(int node_id);
+  int GetReadyTaskQueueId(int node_id);
+
   // use an array to save predict tasks, different numa nodes correspond to different arrays
 #ifdef USE_HQUEUE
   HQueue<PredictTask> *predict_task_;
@@ -69,10 +90,15 @@ class PredictTaskQueue {
   std::queue<PredictTask *> *predict_task_;
 #endif
   std::atomic_int *idle_worker_num_;
+  int task_queue_num_ = 0;
+  bool steal_task_ = false;
   std::mutex mtx_predict_task_;
   std::condition_variable task_pop_cond_;
   std::condition_variable task_push_cond_;
   bool predict_task_done_ = false;
+  DynamicBatchConfig dynamic_batch_config_;
+  // only one worker of a task queue collects the batch at a time.
+  std::vector<bool> batch_collecting_;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_PREDICT_TASK_QUEUE_H_
@@ -17,16 +17,119 @@
 #include <memory>
 #include "src/common/utils.h"
 #include "src/common/log_adapter.h"
+#include "src/common/common.h"
 
 namespace mindspore {
-void *DynamicMemAllocator::Malloc(size_t size) { return mem_oper_->Malloc(size); }
+namespace {
+// the buckets cache the blocks from 256B to 64M, the larger ones are managed by the memory operator directly.
+constexpr size_t kMinBucketSize = 256;
+constexpr size_t kBucketNum = 19;
+constexpr size_t kMaxBucketSize = kMinBucketSize << (kBucketNum - 1);
+// the cached blocks of a bucket are released after it is not used in so many idle periods.
+constexpr size_t kMaxBucketIdleCount = 8;
 
-void DynamicMemAllocator::Free(void *ptr) { mem_oper_->Free(ptr); }
+size_t GetBucket(size_t size) {
+  size_t bucket = 0;
+  while ((kMinBucketSize << bucket) < size) {
+    bucket++;
+  }
+  return bucket;
+}
+}  // namespace
+
+DynamicMemAllocator::DynamicMemAllocator(int node_id) {
+  mem_oper_ = mem_manager_.GetMemOperator(node_id);
+  free_buckets_.resize(kBucketNum);
+  bucket_active_.resize(kBucketNum, false);
+  bucket_idle_count_.resize(kBucketNum, 0);
+}
+
+DynamicMemAllocator::~DynamicMemAllocator() {
+  MS_LOG(INFO) << "dynamic mem allocator malloc count: " << stats_.malloc_count
+               << " | cache hit rate: " << stats_.HitRate() << " | cached size: " << stats_.cached_size
+               << " | released size: " << stats_.released_size;
+}
+
+void *DynamicMemAllocator::Malloc(size_t size) {
+  if (size == 0 || size > kMaxBucketSize) {
+    return mem_oper_->Malloc(size);
+  }
+  auto bucket = GetBucket(size);
+  auto bucket_size = kMinBucketSize << bucket;
+  std::lock_guard<std::mutex> locker(mutex_);
+  stats_.malloc_count++;
+  bucket_active_[bucket] = true;
+  void *data = nullptr;
+  auto &free_blocks = free_buckets_[bucket];
+  if (!free_blocks.empty()) {
+    data = free_blocks.back();
+    free_blocks.pop_back();
+    stats_.hit_count++;
+    stats_.cached_size -= bucket_size;
+  } else {
+    data = mem_oper_->Malloc(bucket_size);
+    if (MS_UNLIKELY(data == nullptr && stats_.cached_size > 0)) {
+      MS_LOG(WARNING) << "Malloc memory(" << bucket_size << ") failed, release the cached blocks and malloc again.";
+      for (size_t i = 0; i < kBucketNum; i++) {
+        ReleaseBucket(i);
+      }
+      data = mem_oper_->Malloc(bucket_size);
+    }
+    if (MS_UNLIKELY(data == nullptr)) {
+      return nullptr;
+    }
+  }
+  auto &block = cached_blocks_[data];
+  block.bucket = bucket;
+  block.size = size;
+  block.ref_count = 0;
+  block.used = true;
+  in_use_block_num_++;
+  stats_.requested_size += size;
+  stats_.in_use_size += bucket_size;
+  return data;
+}
+
+void DynamicMemAllocator::Free(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    auto iter = cached_blocks_.find(ptr);
+    if (iter != cached_blocks_.end()) {
+      auto &block = iter->second;
+      if (!block.used) {
+        return;
+      }
+      auto bucket_size = kMinBucketSize << block.bucket;
+      block.used = false;
+      block.ref_count = 0;
+      stats_.requested_size -= block.size;
+      stats_.in_use_size -= bucket_size;
+      stats_.cached_size += bucket_size;
+      free_buckets_[block.bucket].push_back(ptr);
+      // no cached block is in use, the worker is idle between the requests.
+      if (--in_use_block_num_ == 0) {
+        ReleaseIdleBuckets();
+      }
+      return;
+    }
+  }
+  mem_oper_->Free(ptr);
+}
 
 int DynamicMemAllocator::RefCount(void *ptr) {
   if (ptr == nullptr) {
     return -1;
   }
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    auto iter = cached_blocks_.find(ptr);
+    if (iter != cached_blocks_.end()) {
+      return iter->second.ref_count;
+    }
+  }
   return mem_oper_->RefCount(ptr);
 }
 
@@ -34,6 +137,14 @@ int DynamicMemAllocator::SetRefCount(void *ptr, int ref_count) {
   if (ptr == nullptr) {
     return -1;
   }
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    auto iter = cached_blocks_.find(ptr);
+    if (iter != cached_blocks_.end()) {
+      iter->second.ref_count = ref_count;
+      return ref_count;
+    }
+  }
   return mem_oper_->SetRefCount(ptr, ref_count);
 }
 
@@ -41,6 +152,14 @@ int DynamicMemAllocator::IncRefCount(void *ptr, int ref_count) {
   if (ptr == nullptr) {
     return -1;
   }
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    auto iter = cached_blocks_.find(ptr);
+    if (iter != cached_blocks_.end()) {
+      iter->second.ref_count += ref_count;
+      return iter->second.ref_count;
+    }
+  }
   return mem_oper_->IncRefCount(ptr, ref_count);
 }
 
@@ -48,8 +167,59 @@ int DynamicMemAllocator::DecRefCount(void *ptr, int ref_count) {
   if (ptr == nullptr) {
     return -1;
   }
+  {
+    std::lock_guard<std::mutex> locker(mutex_);
+    auto iter = cached_blocks_.find(ptr);
+    if (iter != cached_blocks_.end()) {
+      iter->second.ref_count -= ref_count;
+      return iter->second.ref_count;
+    }
+  }
   return mem_oper_->DecRefCount(ptr, ref_count);
 }
 
-DynamicMemAllocator::DynamicMemAllocator(int node_id) { mem_oper_ = mem_manager_.GetMemOperator(node_id); }
+MemCacheStats DynamicMemAllocator::GetCacheStats() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  return stats_;
+}
+
+void DynamicMemAllocator::ReleaseCache() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  for (size_t i = 0; i < kBucketNum; i++) {
+    ReleaseBucket(i);
+  }
+  stats_.released_size += mem_oper_->ReleaseFreeMemory();
+}
+
+void DynamicMemAllocator::ReleaseBucket(size_t bucket) {
+  auto bucket_size = kMinBucketSize << bucket;
+  for (auto data : free_buckets_[bucket]) {
+    (void)cached_blocks_.erase(data);
+    mem_oper_->Free(data);
+    stats_.cached_size -= bucket_size;
+  }
+  free_buckets_[bucket].clear();
+  bucket_idle_count_[bucket] = 0;
+}
+
+void DynamicMemAllocator::ReleaseIdleBuckets() {
+  bool released = false;
+  for (size_t i = 0; i < kBucketNum; i++) {
+    if (bucket_active_[i]) {
+      bucket_active_[i] = false;
+      bucket_idle_count_[i] = 0;
+      continue;
+    }
+    if (free_buckets_[i].empty()) {
+      continue;
+    }
+    if (++bucket_idle_count_[i] >= kMaxBucketIdleCount) {
+      ReleaseBucket(i);
+      released = true;
+    }
+  }
+  if (released) {
+    stats_.released_size += mem_oper_->ReleaseFreeMemory();
+  }
+}
 }  // namespace mindspore
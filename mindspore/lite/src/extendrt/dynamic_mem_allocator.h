@@ -21,14 +21,34 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 #include "include/api/allocator.h"
 #include "src/extendrt/dynamic_mem_manager.h"
 
 namespace mindspore {
+struct MemCacheStats {
+  size_t malloc_count = 0;
+  size_t hit_count = 0;
+  // the size requested by the in use cached blocks and the rounded bucket size of them.
+  size_t requested_size = 0;
+  size_t in_use_size = 0;
+  size_t cached_size = 0;
+  size_t released_size = 0;
+
+  float HitRate() const { return malloc_count == 0 ? 0.0f : static_cast<float>(hit_count) / malloc_count; }
+  // the ratio of the in use bytes wasted by the power-of-two rounding.
+  float Fragmentation() const {
+    return in_use_size == 0 ? 0.0f : 1.0f - static_cast<float>(requested_size) / in_use_size;
+  }
+};
+
+// The small and middle size memory is rounded up to the power of two and cached in buckets by the allocator, so the
+// tensors resized in each request reuse the cached blocks without the lock of the shared memory operator. Each worker
+// of the model pool owns its allocator, the buckets not hit for several idle periods are returned to the system.
 class DynamicMemAllocator : public Allocator {
  public:
   explicit DynamicMemAllocator(int node_id);
-  virtual ~DynamicMemAllocator() = default;
+  virtual ~DynamicMemAllocator();
   void *Malloc(size_t size) override;
   void Free(void *ptr) override;
   int RefCount(void *ptr) override;
@@ -36,9 +56,32 @@ class DynamicMemAllocator : public Allocator {
   int IncRefCount(void *ptr, int ref_count) override;
   int DecRefCount(void *ptr, int ref_count) override;
 
+  MemCacheStats GetCacheStats();
+  // return all the cached blocks to the memory operator and the totally free memory units to the system.
+  void ReleaseCache();
+
  private:
+  struct CachedBlock {
+    size_t bucket = 0;
+    size_t size = 0;
+    int ref_count = 0;
+    bool used = false;
+  };
+
+  void ReleaseBucket(size_t bucket);
+  void ReleaseIdleBuckets();
+
   DynamicMemManager mem_manager_;
   std::shared_ptr<MemOperator> mem_oper_;
+
+  std::mutex mutex_;
+  // the bucket i caches the free blocks of size (kMinBucketSize << i).
+  std::vector<std::vector<void *>> free_buckets_;
+  std::vector<bool> bucket_active_;
+  std::vector<size_t> bucket_idle_count_;
+  std::unordered_map<void *, CachedBlock> cached_blocks_;
+  size_t in_use_block_num_ = 0;
+  MemCacheStats stats_;
 };
 }  // namespace mindspore
 
@@ -89,6 +89,18 @@ void *MemOperator::Allocate(size_t rounded_size, int node_id, size_t *allocate_s
   return data;
 }
 
+void MemOperator::FreeData(void *data, size_t size) {
+#ifdef _WIN32
+  _aligned_free(data);
+#else
+  if (node_id_ >= 0) {
+    numa_instance_->Free(data, size);
+  } else {
+    free(data);
+  }
+#endif
+}
+
 Block *MemOperator::GetBlock() {
   Block *block;
   if (garbage_block_ != kInvalidIndex) {
@@ -241,6 +253,7 @@ MemOperator::MemOperator(int node_id) {
     return;
   }
   all_datas_.emplace(block->data_, allocate_size);
+  init_data_ = block->data_;
   block->size_ = allocate_size;
   free_blocks_.emplace(allocate_size, block->index_);
 }
@@ -248,15 +261,7 @@ MemOperator::MemOperator(int node_id) {
 MemOperator::~MemOperator() {
   MS_LOG(DEBUG) << "~MemOperator() begin.";
   for (auto &&data : all_datas_) {
-#ifdef _WIN32
-    _aligned_free(data.first);
-#else
-    if (node_id_ >= 0) {
-      numa_instance_->Free(data.first, data.second);
-    } else {
-      free(data.first);
-    }
-#endif
+    FreeData(data.first, data.second);
   }
   free_blocks_.clear();
   all_datas_.clear();
@@ -306,6 +311,38 @@ int MemOperator::RefCount(void *ptr) {
   return kInvalidRefCount;
 }
 
+size_t MemOperator::ReleaseFreeMemory() {
+  std::lock_guard<std::mutex> locker(mutex_);
+  size_t released_size = 0;
+  for (auto iter = all_datas_.begin(); iter != all_datas_.end();) {
+    auto data = iter->first;
+    auto size = iter->second;
+    if (data == init_data_) {
+      ++iter;
+      continue;
+    }
+    // the blocks of a memory unit are merged into one free block when all of them are freed.
+    int64_t index = kInvalidIndex;
+    auto range = free_blocks_.equal_range(size);
+    for (auto item = range.first; item != range.second; ++item) {
+      if (blocks_[item->second].data_ == data) {
+        index = item->second;
+        free_blocks_.erase(item);
+        break;
+      }
+    }
+    if (index == kInvalidIndex) {
+      ++iter;
+      continue;
+    }
+    AddGarbageBlock(index);
+    FreeData(data, size);
+    released_size += size;
+    iter = all_datas_.erase(iter);
+  }
+  return released_size;
+}
+
 std::shared_ptr<MemOperator> DynamicMemManager::GetMemOperator(const int node_id) {
   std::map<int, std::shared_ptr<MemOperator>>::iterator iter;
   int numa_node_id = node_id;
@@ -48,6 +48,8 @@ class MemOperator {
   int IncRefCount(void *ptr, int ref_count);
   int DecRefCount(void *ptr, int ref_count);
   int RefCount(void *ptr);
+  // return the dynamically extended memory units that are totally free to the system, return the released size.
+  size_t ReleaseFreeMemory();
   inline void set_node_id(int node_id) { node_id_ = node_id; }
   inline int node_id(void) const { return node_id_; }
 
@@ -56,6 +58,7 @@ class MemOperator {
   void EraseFreeBlock(const int64_t index);
   void AddGarbageBlock(const int64_t index);
   void *Allocate(size_t rounded_size, int node_id, size_t *allocate_size);
+  void FreeData(void *data, size_t size);
 
  private:
   int node_id_ = -1;
@@ -70,6 +73,8 @@ class MemOperator {
   // key: data addr, value: Block index
   std::unordered_map<void *, int64_t> datas_;
   std::unordered_map<void *, size_t> all_datas_;
+  // the memory unit allocated at init is kept until destruction.
+  void *init_data_ = nullptr;
 };
 
 class DynamicMemManager {
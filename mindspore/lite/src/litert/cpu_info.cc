@@ -22,6 +22,15 @@
 #if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(MS_COMPILE_IOS)
 #include <sys/auxv.h>
 #include <asm/hwcap.h>
+#ifndef AT_HWCAP2
+#define AT_HWCAP2 26
+#endif
+#ifndef HWCAP2_I8MM
+#define HWCAP2_I8MM (1 << 13)
+#endif
+#ifndef HWCAP2_BF16
+#define HWCAP2_BF16 (1 << 14)
+#endif
 #endif
 #ifdef MS_COMPILE_IOS
 #include <mach/mach.h>
@@ -203,5 +212,31 @@ bool CpuInfo::ArmIsSupportFp16() {
   return fp16_flag_;
 #endif
 }
+
+bool CpuInfo::ArmIsSupportI8mm() {
+#if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(MS_COMPILE_IOS) && \
+  (defined(__ANDROID__) || defined(MACHINE_LINUX_ARM64))
+  const auto hwcap2 = getauxval(AT_HWCAP2);
+  if (hwcap2 & HWCAP2_I8MM) {
+    MS_LOG(DEBUG) << "Hw cap support I8MM, hwcap2: 0x" << hwcap2;
+    return true;
+  }
+  MS_LOG(DEBUG) << "Hw cap NOT support I8MM, hwcap2: 0x" << hwcap2;
+#endif
+  return false;
+}
+
+bool CpuInfo::ArmIsSupportBf16() {
+#if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(MS_COMPILE_IOS) && \
+  (defined(__ANDROID__) || defined(MACHINE_LINUX_ARM64))
+  const auto hwcap2 = getauxval(AT_HWCAP2);
+  if (hwcap2 & HWCAP2_BF16) {
+    MS_LOG(DEBUG) << "Hw cap support BF16, hwcap2: 0x" << hwcap2;
+    return true;
+  }
+  MS_LOG(DEBUG) << "Hw cap NOT support BF16, hwcap2: 0x" << hwcap2;
+#endif
+  return false;
+}
 }  // namespace mindspore::lite
 #endif
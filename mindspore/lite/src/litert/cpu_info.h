@@ -63,6 +63,8 @@ class CpuInfo {
   CpuInfo() = default;
   virtual ~CpuInfo() = default;
   bool ArmIsSupportFp16();
+  bool ArmIsSupportI8mm();
+  bool ArmIsSupportBf16();
 
  private:
 #ifndef MS_COMPILE_IOS
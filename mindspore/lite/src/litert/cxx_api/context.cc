@@ -25,6 +25,7 @@
 
 namespace mindspore {
 constexpr auto kModelOptionCpuEnableFP16 = "mindspore.option.cpu.enable_fp16";
+constexpr auto kModelOptionCpuPrecisionMode = "mindspore.option.cpu.precision_mode";
 constexpr auto kModelOptionGPUEnableFP16 = "mindspore.option.gpu.enable_fp16";
 constexpr auto kModelOptionGPUEnableGLTexture = "mindspore.option.gpu.enable_gl_texture_";
 constexpr auto kModelOptionGPUGLContext = "mindspore.option.gpu.gl_context_";
@@ -267,6 +268,23 @@ bool CPUDeviceInfo::GetEnableFP16() const {
   return GetValue<bool>(data_, kModelOptionCpuEnableFP16);
 }
 
+void CPUDeviceInfo::SetPrecisionMode(const std::vector<char> &precision_mode) {
+  if (data_ == nullptr) {
+    MS_LOG(ERROR) << "Invalid context.";
+    return;
+  }
+  data_->params[kModelOptionCpuPrecisionMode] = CharToString(precision_mode);
+}
+
+std::vector<char> CPUDeviceInfo::GetPrecisionModeChar() const {
+  if (data_ == nullptr) {
+    MS_LOG(ERROR) << "Invalid context.";
+    return std::vector<char>();
+  }
+  const std::string &ref = GetValue<std::string>(data_, kModelOptionCpuPrecisionMode);
+  return StringToChar(ref);
+}
+
 void GPUDeviceInfo::SetEnableFP16(bool is_fp16) {
   if (data_ == nullptr) {
     MS_LOG(ERROR) << "Invalid context.";
@@ -23,6 +23,8 @@ constexpr static int kDefaultThreadNumTwo = 2;
 constexpr static int kDefaultThreadNumFour = 4;
 constexpr static int kDefaultInterOpParallelNum = 1;
 constexpr static int kCoreNumThreshold = 32;
+constexpr static auto kPrecisionModeOrigin = "origin";
+constexpr static auto kPrecisionModeBF16 = "bf16";
 
 void ContextUtils::SetContextAttr(int32_t thread_num, int32_t inter_op_parallel_num, bool enable_parallel,
                                   const std::vector<int32_t> &affinity_core_list,
@@ -37,7 +39,7 @@ void ContextUtils::SetContextAttr(int32_t thread_num, int32_t inter_op_parallel_
 }
 
 Status ContextUtils::AddCpuDevice(const std::shared_ptr<Allocator> &allocator, int affinity_mode, bool enable_fp16,
-                                  const std::string &provider, const std::string &provider_device,
+                                  bool enable_bf16, const std::string &provider, const std::string &provider_device,
                                   lite::InnerContext *inner_context) {
   inner_context->allocator = allocator;
   if (!IsAffinityModeValid(affinity_mode)) {
@@ -45,7 +47,7 @@ Status ContextUtils::AddCpuDevice(const std::shared_ptr<Allocator> &allocator, i
     return kLiteInputParamInvalid;
   }
   lite::DeviceInfo device_info;
-  device_info.cpu_device_info_ = {enable_fp16, static_cast<lite::CpuBindMode>(affinity_mode)};
+  device_info.cpu_device_info_ = {enable_fp16, static_cast<lite::CpuBindMode>(affinity_mode), enable_bf16};
   inner_context->device_list_.push_back({lite::DT_CPU, device_info, provider, provider_device, allocator});
   return kSuccess;
 }
@@ -129,8 +131,14 @@ lite::InnerContext *ContextUtils::Convert(Context *context) {
       if (cpu_context->GetAllocator() == nullptr) {
         cpu_context->SetAllocator(Allocator::Create());
       }
+      auto precision_mode = cpu_context->GetPrecisionMode();
+      if (!precision_mode.empty() && precision_mode != kPrecisionModeOrigin && precision_mode != kPrecisionModeBF16) {
+        MS_LOG(ERROR) << "Invalid cpu precision mode: " << precision_mode << ", only supports origin and bf16.";
+        return nullptr;
+      }
       ret = AddCpuDevice(cpu_context->GetAllocator(), context->GetThreadAffinityMode(), cpu_context->GetEnableFP16(),
-                         cpu_context->GetProvider(), cpu_context->GetProviderDevice(), inner_context.get());
+                         precision_mode == kPrecisionModeBF16, cpu_context->GetProvider(),
+                         cpu_context->GetProviderDevice(), inner_context.get());
     } else if (device->GetDeviceType() == kGPU) {
       auto gpu_context = device->Cast<GPUDeviceInfo>();
       bool enable_gl_texture = gpu_context->GetEnableGLTexture();
@@ -176,7 +184,7 @@ lite::InnerContext *ContextUtils::Convert(const ContextC *context_c) {
       if (device_info_c->allocator == nullptr) {
         device_info_c->allocator = Allocator::Create();
       }
-      ret = AddCpuDevice(device_info_c->allocator, context_c->affinity_mode, device_info_c->enable_fp16,
+      ret = AddCpuDevice(device_info_c->allocator, context_c->affinity_mode, device_info_c->enable_fp16, false,
                          device_info_c->provider, device_info_c->provider_device, inner_context.get());
     } else if (device_info_c->device_type == kMSDeviceTypeGPU) {
       ret = AddGpuDevice(device_info_c->enable_fp16, 0, 0, 0, false, nullptr, nullptr, device_info_c->provider,
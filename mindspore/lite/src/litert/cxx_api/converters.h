@@ -37,7 +37,7 @@ class ContextUtils {
                              const std::vector<int32_t> &affinity_core_list, const std::shared_ptr<Delegate> &delegate,
                              lite::InnerContext *inner_context, bool float_mode = false);
   static Status AddCpuDevice(const std::shared_ptr<Allocator> &allocator, int affinity_mode, bool enable_fp16,
-                             const std::string &provider, const std::string &provider_device,
+                             bool enable_bf16, const std::string &provider, const std::string &provider_device,
                              lite::InnerContext *inner_context);
   static Status AddGpuDevice(bool enable_fp16, uint32_t device_id, int rank_id, int group_size, bool enable_gl_texture,
                              void *gl_context, void *gl_display, const std::string &provider,
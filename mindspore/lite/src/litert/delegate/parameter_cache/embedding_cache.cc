@@ -151,6 +151,15 @@ Status EmbeddingCache::Init(uint32_t device_id, const void *context, mindspore::
   if (ret != kSuccess) {
     return ret;
   }
+  // the device hash table runs on the stream of the delegate, the host lfu cache is used without the stream.
+  if (context != nullptr) {
+    device_hash_ = std::make_shared<gpu::GPUCacheHash>();
+    if (!device_hash_->Init(device_cache_size_, batch_elements_, min_host_index_, max_host_index_,
+                            static_cast<int>(device_start_index_), context)) {
+      MS_LOG(WARNING) << "init device cache hash failed, use the host lfu cache instead.";
+      device_hash_ = nullptr;
+    }
+  }
 
   MS_LOG(INFO) << "init succ,  rank_group_size_ num:" << rank_group_size_ << ", rank id:" << rank_id_
                << ", vocab_size_:" << vocab_size_ << ", host_cache_size_:" << host_cache_size_
@@ -177,6 +186,17 @@ Status EmbeddingCache::SetHostCacheAddr(void *addr, size_t size) {
 
   // init cache
   auto index_num = device_cache_size_;
+  if (device_hash_ != nullptr) {
+    std::vector<int> slot_keys(index_num);
+    for (size_t i = 0; i < index_num; i++) {
+      slot_keys[i] = min_host_index_ + i;
+    }
+    if (!device_hash_->Reset(slot_keys)) {
+      MS_LOG(ERROR) << "init device cache hash table failed";
+      return kLiteError;
+    }
+    return kSuccess;
+  }
   for (size_t i = 0; i < index_num; i++) {
     cache_->Put(min_host_index_ + i, i);
   }
@@ -204,33 +224,63 @@ Status EmbeddingCache::CheckCacheHit(const int *batch_ids, const size_t batch_id
     MS_LOG(ERROR) << "CheckCacheHit failed";
     return ret;
   }
-  auto swap_indices_size = need_swap_indies.size();
-  if (swap_indices_size > 0) {
-    LookUpTableTask(swap_indices_size, host_cache_size_, static_cast<char *>(host_addr_), need_swap_indies.data(),
-                    static_cast<char *>(hash_swap_value_addr_), embedding_size_ * sizeof_data_type_, min_host_index_);
+  return SwapIn(need_swap_indies, need_swap_indies_cache_index);
+}
 
-    auto device_cache_ret = device_cache_->CopyHostMemToDevice(hash_swap_value_device_addr_, hash_swap_value_addr_,
-                                                               swap_indices_size * embedding_size_ * sizeof_data_type_);
-    if (!device_cache_ret) {
-      MS_LOG(ERROR) << "copy swap value to device failed";
-      return kLiteMemoryFailed;
-    }
+Status EmbeddingCache::CheckCacheHitOnDevice(const int *batch_ids, const size_t batch_ids_len,
+                                             int *device_cache_index) {
+  std::vector<int> miss_ids;
+  if (!device_hash_->Lookup(batch_ids, batch_ids_len, device_cache_index, &miss_ids)) {
+    MS_LOG(ERROR) << "device cache hash lookup failed";
+    return kLiteError;
+  }
+  if (miss_ids.empty()) {
+    return kSuccess;
+  }
+  std::vector<int> swap_slots;
+  if (!device_hash_->Swap(miss_ids, &swap_slots)) {
+    MS_LOG(ERROR) << "device cache hash swap failed";
+    return kLiteError;
+  }
+  auto ret = SwapIn(miss_ids, swap_slots);
+  if (ret != kSuccess) {
+    return ret;
+  }
+  if (!device_hash_->Fill(batch_ids_len, device_cache_index)) {
+    MS_LOG(ERROR) << "device cache hash fill failed";
+    return kLiteError;
+  }
+  return kSuccess;
+}
 
-    device_cache_ret = device_cache_->CopyHostMemToDevice(hash_swap_index_addr_, need_swap_indies_cache_index.data(),
-                                                          swap_indices_size * sizeof(int));
-    if (!device_cache_ret) {
-      MS_LOG(ERROR) << "copy swap indies to device failed";
-      return kLiteMemoryFailed;
-    }
+Status EmbeddingCache::SwapIn(const std::vector<int> &host_indices, const std::vector<int> &cache_indices) {
+  auto swap_indices_size = host_indices.size();
+  if (swap_indices_size == 0) {
+    return kSuccess;
+  }
+  LookUpTableTask(swap_indices_size, host_cache_size_, static_cast<char *>(host_addr_), host_indices.data(),
+                  static_cast<char *>(hash_swap_value_addr_), embedding_size_ * sizeof_data_type_, min_host_index_);
 
-    device_cache_ret = device_cache_->HashSwapIn(device_addr_, hash_swap_value_device_addr_, hash_swap_index_addr_,
-                                                 device_cache_size_, embedding_size_, swap_indices_size);
-    if (!device_cache_ret) {
-      MS_LOG(ERROR) << "HashSwapIn failed";
-      return kLiteMemoryFailed;
-    }
+  auto device_cache_ret = device_cache_->CopyHostMemToDevice(hash_swap_value_device_addr_, hash_swap_value_addr_,
+                                                             swap_indices_size * embedding_size_ * sizeof_data_type_);
+  if (!device_cache_ret) {
+    MS_LOG(ERROR) << "copy swap value to device failed";
+    return kLiteMemoryFailed;
   }
 
+  device_cache_ret = device_cache_->CopyHostMemToDevice(hash_swap_index_addr_, cache_indices.data(),
+                                                        swap_indices_size * sizeof(int));
+  if (!device_cache_ret) {
+    MS_LOG(ERROR) << "copy swap indies to device failed";
+    return kLiteMemoryFailed;
+  }
+
+  device_cache_ret = device_cache_->HashSwapIn(device_addr_, hash_swap_value_device_addr_, hash_swap_index_addr_,
+                                               device_cache_size_, embedding_size_, swap_indices_size);
+  if (!device_cache_ret) {
+    MS_LOG(ERROR) << "HashSwapIn failed";
+    return kLiteMemoryFailed;
+  }
   return kSuccess;
 }
 }  // namespace cache
@@ -19,12 +19,14 @@
 #include <cmath>
 #include <algorithm>
 #include <memory>
+#include <vector>
 #include "include/api/status.h"
 #include "include/api/types.h"
 #include "include/api/data_type.h"
 #include "src/common/log_adapter.h"
 #include "src/litert/delegate/parameter_cache/cache_algorithm.h"
 #include "src/litert/delegate/parameter_cache/cache_mem_base.h"
+#include "src/litert/delegate/parameter_cache/gpu/gpu_cache_hash.h"
 
 namespace mindspore {
 namespace cache {
@@ -53,15 +55,20 @@ class EmbeddingCache {
   Status SetHostCacheAddr(void *addr, size_t size);
   Status SetDeviceCacheAddr(void *host_mem_addr, size_t size);
   Status CheckCacheHit(const int *batch_ids, const size_t batch_ids_len, int *hash_index);
+  // the hits are found by the device hash table, and the cache index is written to the device memory directly.
+  Status CheckCacheHitOnDevice(const int *batch_ids, const size_t batch_ids_len, int *device_cache_index);
+  bool UseDeviceHash() const { return device_hash_ != nullptr; }
   size_t GetDeviceStartIndex() { return device_start_index_; }
 
  private:
   Status Init(mindspore::MSTensor host_cache_tensor, mindspore::MSTensor device_tensor);
   Status MallocCacheMemory();
+  Status SwapIn(const std::vector<int> &host_indices, const std::vector<int> &cache_indices);
 
  private:
   std::shared_ptr<cache::CacheMemBase> device_cache_{nullptr};
   std::shared_ptr<CacheAlgorithm> cache_{nullptr};
+  std::shared_ptr<gpu::GPUCacheHash> device_hash_{nullptr};
 
   size_t vocab_size_{0};         // total size
   size_t host_cache_size_{0};    // local host size
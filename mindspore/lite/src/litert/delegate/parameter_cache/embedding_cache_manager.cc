@@ -166,6 +166,17 @@ int EmbeddingCacheManager::CacheHandle(const std::string &tensor_name, mindspore
     return lite::RET_ERROR;
   }
   auto cache = cache_iter->second;
+  if (cache->UseDeviceHash()) {
+    auto ret =
+      cache->CheckCacheHitOnDevice(static_cast<int *>(model_input_tensor.MutableData()),
+                                   model_input_tensor.ElementNum(), static_cast<int *>(model_input_device_addr));
+    if (ret != kSuccess) {
+      MS_LOG(ERROR) << "CheckCacheHitOnDevice failed, " << model_input_tensor.Name();
+      return lite::RET_ERROR;
+    }
+    MS_LOG(INFO) << "cache handle on device succ, " << model_input_tensor.Name() << "," << tensor_name;
+    return lite::RET_OK;
+  }
   hash_indices_.resize(model_input_tensor.ElementNum());
   auto ret = cache->CheckCacheHit(static_cast<int *>(model_input_tensor.MutableData()), hash_indices_.size(),
                                   hash_indices_.data());
@@ -0,0 +1,241 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/delegate/parameter_cache/gpu/gpu_cache_hash.h"
+#include <cuda_runtime.h>
+#include <algorithm>
+#include "src/litert/delegate/tensorrt/cuda_impl/hash.cuh"
+#include "src/common/log_adapter.h"
+
+namespace mindspore {
+namespace cache {
+namespace gpu {
+namespace {
+constexpr int kUpdateBufferNum = 3;
+// the table is rebuilt when the live, erased and pending keys take more than 3/4 of the capacity.
+constexpr size_t kMaxLoadFactorNumerator = 3;
+constexpr size_t kMaxLoadFactorDenominator = 4;
+
+bool CheckCudaRet(cudaError_t cuda_ret, const char *msg) {
+  if (cuda_ret != cudaSuccess) {
+    MS_LOG(ERROR) << msg << " failed, cuda_ret " << cuda_ret << " " << cudaGetErrorString(cuda_ret);
+    return false;
+  }
+  return true;
+}
+
+bool MallocInts(int **ptr, size_t num) {
+  return CheckCudaRet(cudaMalloc(reinterpret_cast<void **>(ptr), num * sizeof(int)), "cudaMalloc");
+}
+}  // namespace
+
+GPUCacheHash::~GPUCacheHash() { FreeMemory(); }
+
+void GPUCacheHash::FreeMemory() {
+  for (auto ptr : {&table_keys_, &table_values_, &slot_frequency_, &slot_last_use_, &batch_ids_, &miss_ids_,
+                   &miss_count_, &update_buffer_}) {
+    if (*ptr == nullptr) {
+      continue;
+    }
+    auto cuda_ret = cudaFree(*ptr);
+    if (cuda_ret != cudaSuccess && cuda_ret != cudaErrorCudartUnloading) {
+      MS_LOG(WARNING) << "free cuda memory failed, cuda_ret " << cuda_ret << " " << cudaGetErrorString(cuda_ret);
+    }
+    *ptr = nullptr;
+  }
+}
+
+bool GPUCacheHash::Init(size_t cache_size, size_t batch_elements, int min_host_index, int max_host_index,
+                        int index_offset, const void *context) {
+  if (cache_size == 0 || batch_elements == 0 || context == nullptr) {
+    MS_LOG(ERROR) << "invalid cache size " << cache_size << " or batch elements " << batch_elements;
+    return false;
+  }
+  stream_ = *(reinterpret_cast<const cudaStream_t *>(context));
+  cache_size_ = cache_size;
+  batch_elements_ = batch_elements;
+  min_host_index_ = min_host_index;
+  max_host_index_ = max_host_index;
+  index_offset_ = index_offset;
+  size_t capacity = 1;
+  while (capacity < (cache_size_ + batch_elements_) * 2) {
+    capacity <<= 1;
+  }
+  if (capacity > static_cast<size_t>(INT32_MAX)) {
+    MS_LOG(ERROR) << "the cache size " << cache_size_ << " is too large for the device hash table.";
+    return false;
+  }
+  capacity_ = static_cast<int>(capacity);
+  auto update_buffer_size = std::max(batch_elements_ * kUpdateBufferNum, cache_size_);
+  if (!MallocInts(&table_keys_, capacity) || !MallocInts(&table_values_, capacity) ||
+      !MallocInts(&slot_frequency_, cache_size_) || !MallocInts(&slot_last_use_, cache_size_) ||
+      !MallocInts(&batch_ids_, batch_elements_) || !MallocInts(&miss_ids_, batch_elements_) ||
+      !MallocInts(&miss_count_, 1) || !MallocInts(&update_buffer_, update_buffer_size)) {
+    FreeMemory();
+    return false;
+  }
+  if (!CheckCudaRet(cudaMemsetAsync(slot_frequency_, 0, cache_size_ * sizeof(int), stream_), "cudaMemsetAsync") ||
+      !CheckCudaRet(cudaMemsetAsync(slot_last_use_, 0xff, cache_size_ * sizeof(int), stream_), "cudaMemsetAsync")) {
+    return false;
+  }
+  slot_keys_.assign(cache_size_, kCacheHashEmptyKey);
+  MS_LOG(INFO) << "device cache hash init succ, cache size " << cache_size_ << ", table capacity " << capacity_;
+  return Reset(slot_keys_);
+}
+
+bool GPUCacheHash::Reset(const std::vector<int> &slot_keys) {
+  if (slot_keys.size() != cache_size_) {
+    MS_LOG(ERROR) << "the slot keys size " << slot_keys.size() << " != cache size " << cache_size_;
+    return false;
+  }
+  if (&slot_keys != &slot_keys_) {
+    slot_keys_ = slot_keys;
+  }
+  erased_num_ = 0;
+  auto table_size = static_cast<size_t>(capacity_) * sizeof(int);
+  if (!CheckCudaRet(cudaMemsetAsync(table_keys_, 0xff, table_size, stream_), "cudaMemsetAsync") ||
+      !CheckCudaRet(cudaMemsetAsync(table_values_, 0xff, table_size, stream_), "cudaMemsetAsync") ||
+      !CheckCudaRet(cudaMemcpyAsync(update_buffer_, slot_keys_.data(), cache_size_ * sizeof(int),
+                                    cudaMemcpyHostToDevice, stream_),
+                    "cudaMemcpyAsync")) {
+    return false;
+  }
+  DoCacheHashBuild(table_keys_, table_values_, capacity_, update_buffer_, static_cast<int>(cache_size_), stream_);
+  return CheckCudaRet(cudaStreamSynchronize(stream_), "cudaStreamSynchronize");
+}
+
+bool GPUCacheHash::Lookup(const int *batch_ids, size_t batch_size, int *device_cache_index,
+                          std::vector<int> *miss_ids) {
+  if (batch_size > batch_elements_) {
+    MS_LOG(ERROR) << "the batch size " << batch_size << " is larger than the batch elements " << batch_elements_;
+    return false;
+  }
+  miss_ids->clear();
+  if (batch_size == 0) {
+    return true;
+  }
+  batch_seq_++;
+  if (!CheckCudaRet(cudaMemcpyAsync(batch_ids_, batch_ids, batch_size * sizeof(int), cudaMemcpyHostToDevice, stream_),
+                    "cudaMemcpyAsync") ||
+      !CheckCudaRet(cudaMemsetAsync(miss_count_, 0, sizeof(int), stream_), "cudaMemsetAsync")) {
+    return false;
+  }
+  DoCacheHashLookup(table_keys_, table_values_, capacity_, batch_ids_, static_cast<int>(batch_size), min_host_index_,
+                    max_host_index_, index_offset_, device_cache_index, slot_frequency_, slot_last_use_, batch_seq_,
+                    miss_ids_, miss_count_, stream_);
+  int miss_count = 0;
+  if (!CheckCudaRet(cudaMemcpyAsync(&miss_count, miss_count_, sizeof(int), cudaMemcpyDeviceToHost, stream_),
+                    "cudaMemcpyAsync") ||
+      !CheckCudaRet(cudaStreamSynchronize(stream_), "cudaStreamSynchronize")) {
+    return false;
+  }
+  if (miss_count == 0) {
+    return true;
+  }
+  miss_ids->resize(miss_count);
+  return CheckCudaRet(cudaMemcpyAsync(miss_ids->data(), miss_ids_, miss_count * sizeof(int), cudaMemcpyDeviceToHost,
+                                      stream_),
+                      "cudaMemcpyAsync") &&
+         CheckCudaRet(cudaStreamSynchronize(stream_), "cudaStreamSynchronize");
+}
+
+// the slots used by the current batch are never evicted, the others are evicted in the order of frequency.
+bool GPUCacheHash::SelectSwapSlots(size_t swap_size, std::vector<int> *swap_slots) {
+  std::vector<int> frequency(cache_size_);
+  std::vector<int> last_use(cache_size_);
+  if (!CheckCudaRet(cudaMemcpyAsync(frequency.data(), slot_frequency_, cache_size_ * sizeof(int),
+                                    cudaMemcpyDeviceToHost, stream_),
+                    "cudaMemcpyAsync") ||
+      !CheckCudaRet(cudaMemcpyAsync(last_use.data(), slot_last_use_, cache_size_ * sizeof(int),
+                                    cudaMemcpyDeviceToHost, stream_),
+                    "cudaMemcpyAsync") ||
+      !CheckCudaRet(cudaStreamSynchronize(stream_), "cudaStreamSynchronize")) {
+    return false;
+  }
+  std::vector<int> candidates;
+  candidates.reserve(cache_size_);
+  for (size_t i = 0; i < cache_size_; i++) {
+    if (last_use[i] != batch_seq_) {
+      candidates.push_back(static_cast<int>(i));
+    }
+  }
+  if (candidates.size() < swap_size) {
+    MS_LOG(ERROR) << "the batch needs " << swap_size << " slots to swap in, but only " << candidates.size()
+                  << " slots could be evicted.";
+    return false;
+  }
+  auto less_frequent = [this, &frequency](int lhs, int rhs) {
+    // the free slot goes first
+    auto lhs_key = slot_keys_[lhs] < 0 ? -1 : frequency[lhs];
+    auto rhs_key = slot_keys_[rhs] < 0 ? -1 : frequency[rhs];
+    return lhs_key != rhs_key ? lhs_key < rhs_key : lhs < rhs;
+  };
+  std::nth_element(candidates.begin(), candidates.begin() + swap_size - 1, candidates.end(), less_frequent);
+  swap_slots->assign(candidates.begin(), candidates.begin() + swap_size);
+  return true;
+}
+
+bool GPUCacheHash::Swap(const std::vector<int> &miss_ids, std::vector<int> *swap_slots) {
+  auto swap_size = miss_ids.size();
+  swap_slots->clear();
+  if (swap_size == 0) {
+    return true;
+  }
+  if (!SelectSwapSlots(swap_size, swap_slots)) {
+    // drop the pending keys of the failed batch
+    (void)Reset(slot_keys_);
+    return false;
+  }
+  std::vector<int> update(swap_size * kUpdateBufferNum);
+  for (size_t i = 0; i < swap_size; i++) {
+    auto slot = (*swap_slots)[i];
+    update[i] = slot_keys_[slot];
+    update[swap_size + i] = miss_ids[i];
+    update[swap_size * 2 + i] = slot;
+    erased_num_ += slot_keys_[slot] < 0 ? 0 : 1;
+    slot_keys_[slot] = miss_ids[i];
+  }
+  if (!CheckCudaRet(cudaMemcpyAsync(update_buffer_, update.data(), update.size() * sizeof(int),
+                                    cudaMemcpyHostToDevice, stream_),
+                    "cudaMemcpyAsync")) {
+    return false;
+  }
+  DoCacheHashUpdate(table_keys_, table_values_, capacity_, update_buffer_, update_buffer_ + swap_size,
+                    update_buffer_ + swap_size * 2, static_cast<int>(swap_size), slot_frequency_, slot_last_use_,
+                    batch_seq_, stream_);
+  // the update buffer is reused by the rebuild, and the update vector is released when returned.
+  if (!CheckCudaRet(cudaStreamSynchronize(stream_), "cudaStreamSynchronize")) {
+    return false;
+  }
+  if ((cache_size_ + erased_num_ + batch_elements_) * kMaxLoadFactorDenominator >
+      static_cast<size_t>(capacity_) * kMaxLoadFactorNumerator) {
+    MS_LOG(INFO) << "rebuild the device cache hash table, erased keys " << erased_num_;
+    return Reset(slot_keys_);
+  }
+  return true;
+}
+
+bool GPUCacheHash::Fill(size_t batch_size, int *device_cache_index) {
+  if (batch_size == 0) {
+    return true;
+  }
+  DoCacheHashFill(table_keys_, table_values_, capacity_, batch_ids_, static_cast<int>(batch_size), min_host_index_,
+                  max_host_index_, index_offset_, device_cache_index, stream_);
+  return CheckCudaRet(cudaGetLastError(), "DoCacheHashFill");
+}
+}  // namespace gpu
+}  // namespace cache
+}  // namespace mindspore
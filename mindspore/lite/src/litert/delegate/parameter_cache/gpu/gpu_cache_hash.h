@@ -0,0 +1,81 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_PARAMETER_CACHE_GPU_GPU_CACHE_HASH_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_PARAMETER_CACHE_GPU_GPU_CACHE_HASH_H_
+
+#include <cuda_runtime_api.h>
+#include <vector>
+
+namespace mindspore {
+namespace cache {
+namespace gpu {
+// The device side index of the embedding cache. The hash table and the frequency of the cache slots stay on device,
+// so the hits of a batch are found without the host, and only the missed ids are copied back to choose the evicted
+// slots with the least frequency.
+class GPUCacheHash {
+ public:
+  GPUCacheHash() = default;
+  ~GPUCacheHash();
+
+  bool Init(size_t cache_size, size_t batch_elements, int min_host_index, int max_host_index, int index_offset,
+            const void *context);
+
+  // rebuild the table with the host index of every cache slot, -1 means the slot is free.
+  bool Reset(const std::vector<int> &slot_keys);
+
+  // write the cache index of the batch ids to device_cache_index, and return the unique missed ids.
+  bool Lookup(const int *batch_ids, size_t batch_size, int *device_cache_index, std::vector<int> *miss_ids);
+
+  // evict the slots for the missed ids of the last lookup and fill their cache index, swap_slots[i] is the slot
+  // assigned to miss_ids[i], whose value should be swapped in by the caller.
+  bool Swap(const std::vector<int> &miss_ids, std::vector<int> *swap_slots);
+
+  bool Fill(size_t batch_size, int *device_cache_index);
+
+ private:
+  bool SelectSwapSlots(size_t swap_size, std::vector<int> *swap_slots);
+
+  void FreeMemory();
+
+  cudaStream_t stream_{nullptr};
+  size_t cache_size_{0};
+  size_t batch_elements_{0};
+  int capacity_{0};
+  int min_host_index_{0};
+  int max_host_index_{0};
+  int index_offset_{0};
+  int batch_seq_{0};
+  size_t erased_num_{0};
+
+  // the host mirror of the key in every cache slot, only the host changes the slot of a key.
+  std::vector<int> slot_keys_;
+
+  int *table_keys_{nullptr};
+  int *table_values_{nullptr};
+  int *slot_frequency_{nullptr};
+  int *slot_last_use_{nullptr};
+  // the ids of the last lookup, the missed ids and the miss count.
+  int *batch_ids_{nullptr};
+  int *miss_ids_{nullptr};
+  int *miss_count_{nullptr};
+  // the erased keys, the inserted keys and the slots of the update, or the slot keys of the rebuild.
+  int *update_buffer_{nullptr};
+};
+}  // namespace gpu
+}  // namespace cache
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_PARAMETER_CACHE_GPU_GPU_CACHE_HASH_H_
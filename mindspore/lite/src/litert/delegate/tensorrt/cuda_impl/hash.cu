@@ -57,6 +57,158 @@ void DoHashSwapIn(T *hash_table, const T *swap_in_value, const int *swap_in_inde
   return;
 }
 
+__device__ __forceinline__ int CacheHashPos(const int key, const int mask) {
+  return static_cast<int>((static_cast<unsigned int>(key) * 2654435761u) & static_cast<unsigned int>(mask));
+}
+
+// return the position of the key in the table, or -1 when the key is absent.
+__device__ __forceinline__ int CacheHashFind(const int *table_keys, const int capacity, const int key) {
+  int mask = capacity - 1;
+  int pos = CacheHashPos(key, mask);
+  for (int probe = 0; probe < capacity; probe++, pos = (pos + 1) & mask) {
+    int cur = table_keys[pos];
+    if (cur == key) {
+      return pos;
+    }
+    if (cur == kCacheHashEmptyKey) {
+      return -1;
+    }
+  }
+  return -1;
+}
+
+// insert the key if it's absent, return true if this thread inserted it.
+__device__ __forceinline__ bool CacheHashInsert(int *table_keys, const int capacity, const int key, int *key_pos) {
+  int mask = capacity - 1;
+  int pos = CacheHashPos(key, mask);
+  for (int probe = 0; probe < capacity; probe++, pos = (pos + 1) & mask) {
+    int cur = table_keys[pos];
+    if (cur == key) {
+      *key_pos = pos;
+      return false;
+    }
+    if (cur != kCacheHashEmptyKey) {
+      continue;
+    }
+    int old = atomicCAS(&table_keys[pos], kCacheHashEmptyKey, key);
+    if (old == kCacheHashEmptyKey || old == key) {
+      *key_pos = pos;
+      return old == kCacheHashEmptyKey;
+    }
+  }
+  *key_pos = -1;
+  return false;
+}
+
+__global__ void CacheHashBuild(int *table_keys, int *table_values, const int capacity, const int *slot_keys,
+                               const int cache_size) {
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < cache_size; i += blockDim.x * gridDim.x) {
+    int pos = -1;
+    if (slot_keys[i] >= 0 && CacheHashInsert(table_keys, capacity, slot_keys[i], &pos)) {
+      table_values[pos] = i;
+    }
+  }
+  return;
+}
+
+__global__ void CacheHashLookup(int *table_keys, const int *table_values, const int capacity, const int *batch_ids,
+                                const int batch_size, const int min_host_index, const int max_host_index,
+                                const int index_offset, int *cache_index, int *slot_frequency, int *slot_last_use,
+                                const int batch_seq, int *miss_ids, int *miss_count) {
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < batch_size; i += blockDim.x * gridDim.x) {
+    int key = batch_ids[i];
+    cache_index[i] = -1;
+    if (key < min_host_index || key >= max_host_index) {
+      continue;
+    }
+    int pos = -1;
+    if (CacheHashInsert(table_keys, capacity, key, &pos)) {
+      miss_ids[atomicAdd(miss_count, 1)] = key;
+      continue;
+    }
+    int slot = pos < 0 ? -1 : table_values[pos];
+    if (slot < 0) {
+      continue;
+    }
+    atomicAdd(&slot_frequency[slot], 1);
+    slot_last_use[slot] = batch_seq;
+    cache_index[i] = slot + index_offset;
+  }
+  return;
+}
+
+__global__ void CacheHashUpdate(int *table_keys, int *table_values, const int capacity, const int *erase_keys,
+                                const int *insert_keys, const int *slots, const int update_size, int *slot_frequency,
+                                int *slot_last_use, const int batch_seq) {
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < update_size; i += blockDim.x * gridDim.x) {
+    if (erase_keys[i] >= 0) {
+      int erase_pos = CacheHashFind(table_keys, capacity, erase_keys[i]);
+      if (erase_pos >= 0) {
+        table_values[erase_pos] = -1;
+        table_keys[erase_pos] = kCacheHashErasedKey;
+      }
+    }
+    int insert_pos = CacheHashFind(table_keys, capacity, insert_keys[i]);
+    if (insert_pos >= 0) {
+      table_values[insert_pos] = slots[i];
+    }
+    slot_frequency[slots[i]] = 1;
+    slot_last_use[slots[i]] = batch_seq;
+  }
+  return;
+}
+
+__global__ void CacheHashFill(const int *table_keys, const int *table_values, const int capacity,
+                              const int *batch_ids, const int batch_size, const int min_host_index,
+                              const int max_host_index, const int index_offset, int *cache_index) {
+  for (int i = blockIdx.x * blockDim.x + threadIdx.x; i < batch_size; i += blockDim.x * gridDim.x) {
+    int key = batch_ids[i];
+    if (cache_index[i] >= 0 || key < min_host_index || key >= max_host_index) {
+      continue;
+    }
+    int pos = CacheHashFind(table_keys, capacity, key);
+    if (pos >= 0 && table_values[pos] >= 0) {
+      cache_index[i] = table_values[pos] + index_offset;
+    }
+  }
+  return;
+}
+
+void DoCacheHashBuild(int *table_keys, int *table_values, const int capacity, const int *slot_keys,
+                      const int cache_size, cudaStream_t cuda_stream) {
+  CacheHashBuild<<<GET_BLOCKS(cache_size), GET_THREADS, 0, cuda_stream>>>(table_keys, table_values, capacity,
+                                                                          slot_keys, cache_size);
+  return;
+}
+
+void DoCacheHashLookup(int *table_keys, const int *table_values, const int capacity, const int *batch_ids,
+                       const int batch_size, const int min_host_index, const int max_host_index,
+                       const int index_offset, int *cache_index, int *slot_frequency, int *slot_last_use,
+                       const int batch_seq, int *miss_ids, int *miss_count, cudaStream_t cuda_stream) {
+  CacheHashLookup<<<GET_BLOCKS(batch_size), GET_THREADS, 0, cuda_stream>>>(
+    table_keys, table_values, capacity, batch_ids, batch_size, min_host_index, max_host_index, index_offset,
+    cache_index, slot_frequency, slot_last_use, batch_seq, miss_ids, miss_count);
+  return;
+}
+
+void DoCacheHashUpdate(int *table_keys, int *table_values, const int capacity, const int *erase_keys,
+                       const int *insert_keys, const int *slots, const int update_size, int *slot_frequency,
+                       int *slot_last_use, const int batch_seq, cudaStream_t cuda_stream) {
+  CacheHashUpdate<<<GET_BLOCKS(update_size), GET_THREADS, 0, cuda_stream>>>(
+    table_keys, table_values, capacity, erase_keys, insert_keys, slots, update_size, slot_frequency, slot_last_use,
+    batch_seq);
+  return;
+}
+
+void DoCacheHashFill(const int *table_keys, const int *table_values, const int capacity, const int *batch_ids,
+                     const int batch_size, const int min_host_index, const int max_host_index,
+                     const int index_offset, int *cache_index, cudaStream_t cuda_stream) {
+  CacheHashFill<<<GET_BLOCKS(batch_size), GET_THREADS, 0, cuda_stream>>>(
+    table_keys, table_values, capacity, batch_ids, batch_size, min_host_index, max_host_index, index_offset,
+    cache_index);
+  return;
+}
+
 template void DoHashSwapOut<float>(const float *hash_table, float *swap_out_value, const int *swap_out_index,
                                    const int index_size, const int hash_dim, cudaStream_t cuda_stream);
 
@@ -24,4 +24,29 @@ void DoHashSwapOut(const T *hash_table, T *swap_out_value, const int *swap_out_i
 template <typename T>
 void DoHashSwapIn(T *hash_table, const T *swap_in_value, const int *swap_in_index, const int index_size,
                   const int hash_dim, cudaStream_t cuda_stream);
+
+// the open addressing table of the device embedding cache maps the host index to the cache index, the capacity is a
+// power of 2. Both keys and values are reset with 0xff bytes, a negative value is the key being swapped in.
+constexpr int kCacheHashEmptyKey = -1;
+constexpr int kCacheHashErasedKey = -2;
+
+void DoCacheHashBuild(int *table_keys, int *table_values, const int capacity, const int *slot_keys,
+                      const int cache_size, cudaStream_t cuda_stream);
+
+// the hit ids get the cache index with the offset and update the frequency of the slot, the unique missed ids are
+// inserted as pending and appended to miss_ids, and the out range ids get -1.
+void DoCacheHashLookup(int *table_keys, const int *table_values, const int capacity, const int *batch_ids,
+                       const int batch_size, const int min_host_index, const int max_host_index,
+                       const int index_offset, int *cache_index, int *slot_frequency, int *slot_last_use,
+                       const int batch_seq, int *miss_ids, int *miss_count, cudaStream_t cuda_stream);
+
+// erase the evicted keys and assign the slots to the pending keys, erase_keys[i] < 0 means the slot is free.
+void DoCacheHashUpdate(int *table_keys, int *table_values, const int capacity, const int *erase_keys,
+                       const int *insert_keys, const int *slots, const int update_size, int *slot_frequency,
+                       int *slot_last_use, const int batch_seq, cudaStream_t cuda_stream);
+
+// fill the cache index of the ids swapped in by DoCacheHashUpdate.
+void DoCacheHashFill(const int *table_keys, const int *table_values, const int capacity, const int *batch_ids,
+                     const int batch_size, const int min_host_index, const int max_host_index,
+                     const int index_offset, int *cache_index, cudaStream_t cuda_stream);
 #endif  // MINDSPORE_LITE_SRC_DELEGATE_TENSORRT_CDUA_IMPL_HASH_H_
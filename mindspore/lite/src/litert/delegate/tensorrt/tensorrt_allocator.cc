@@ -16,6 +16,7 @@
 
 #include "src/litert/delegate/tensorrt/tensorrt_allocator.h"
 #include <cuda_runtime.h>
+#include <cstring>
 #include <mutex>
 #include "src/common/log_adapter.h"
 #include "src/litert/delegate/tensorrt/tensorrt_utils.h"
@@ -123,18 +124,70 @@ int TensorRTAllocator::SyncMemInHostAndDevice(void *host_data, const std::string
     return RET_ERROR;
   }
 
-  void *src_ptr = is_host2device ? host_data : device_ptr;
-  void *dst_ptr = is_host2device ? device_ptr : host_data;
+  // the copy of pageable memory serializes with the other streams, so the data is staged in pinned memory and copied
+  // asynchronously on the stream of the delegate.
+  auto staging_ptr = MallocStagingMem(&current_cuda_tensor, data_size);
+  if (staging_ptr == nullptr) {
+    return RET_ERROR;
+  }
+  if (is_host2device) {
+    memcpy(staging_ptr, host_data, data_size);
+  }
+  void *src_ptr = is_host2device ? staging_ptr : device_ptr;
+  void *dst_ptr = is_host2device ? device_ptr : staging_ptr;
   cudaMemcpyKind kind = is_host2device ? cudaMemcpyHostToDevice : cudaMemcpyDeviceToHost;
-  auto cuda_ret = cudaMemcpy(dst_ptr, src_ptr, data_size, kind);
+  auto cuda_ret = cudaMemcpyAsync(dst_ptr, src_ptr, data_size, kind, stream_);
   if (cuda_ret != cudaSuccess) {
     MS_LOG(ERROR) << "copy mem failed,ret " << cudaGetErrorName(cuda_ret);
     return RET_ERROR;
   }
+  if (!is_host2device) {
+    pending_copies_.push_back({host_data, staging_ptr, data_size});
+  }
   MS_LOG(INFO) << "cuda memcpy success for " << device_tensor_name;
+  return sync ? SyncStream() : RET_OK;
+}
+
+int TensorRTAllocator::SyncStream() {
+  auto cuda_ret = cudaStreamSynchronize(stream_);
+  if (cuda_ret != cudaSuccess) {
+    MS_LOG(ERROR) << "synchronize cuda stream failed, ret " << cudaGetErrorName(cuda_ret);
+    pending_copies_.clear();
+    return RET_ERROR;
+  }
+  for (auto &copy : pending_copies_) {
+    memcpy(copy.host_data, copy.staging_data, copy.size);
+  }
+  pending_copies_.clear();
   return RET_OK;
 }
 
+void *TensorRTAllocator::MallocStagingMem(CudaTensorParam *cuda_tensor, size_t size) {
+  if (cuda_tensor->host_data != nullptr && size <= cuda_tensor->host_size) {
+    return cuda_tensor->host_data;
+  }
+  // the old staging memory may be used by the copies on the stream.
+  if (SyncStream() != RET_OK) {
+    return nullptr;
+  }
+  if (cuda_tensor->host_data != nullptr) {
+    auto cuda_ret = cudaFreeHost(cuda_tensor->host_data);
+    if (cuda_ret != cudaSuccess && cuda_ret != cudaErrorCudartUnloading) {
+      MS_LOG(WARNING) << "free pinned host memory failed for " << cudaGetErrorName(cuda_ret);
+    }
+    cuda_tensor->host_data = nullptr;
+    cuda_tensor->host_size = 0;
+  }
+  auto cuda_ret = cudaMallocHost(&cuda_tensor->host_data, size);
+  if (cuda_ret != cudaSuccess) {
+    MS_LOG(ERROR) << "malloc pinned host memory failed for size: " << size;
+    cuda_tensor->host_data = nullptr;
+    return nullptr;
+  }
+  cuda_tensor->host_size = size;
+  return cuda_tensor->host_data;
+}
+
 int TensorRTAllocator::ClearDeviceMem() {
   for (auto &iter : cuda_tensor_map_) {
     auto cuda_ret = cudaFree(iter.second.data);
@@ -143,7 +196,16 @@ int TensorRTAllocator::ClearDeviceMem() {
     }
     iter.second.data = nullptr;
     iter.second.is_valid_mem = false;
+    if (iter.second.host_data != nullptr) {
+      cuda_ret = cudaFreeHost(iter.second.host_data);
+      if (cuda_ret != cudaSuccess && cuda_ret != cudaErrorCudartUnloading) {
+        MS_LOG(WARNING) << "free pinned host memory failed for " << cudaGetErrorName(cuda_ret);
+      }
+      iter.second.host_data = nullptr;
+      iter.second.host_size = 0;
+    }
   }
+  pending_copies_.clear();
   return RET_OK;
 }
 std::map<std::string, CudaTensorParam> TensorRTAllocator::GetAllDevicePtr() { return this->cuda_tensor_map_; }
@@ -19,6 +19,7 @@
 #include "src/litert/delegate/tensorrt/tensorrt_allocator.h"
 #include <map>
 #include <string>
+#include <vector>
 #include <NvInfer.h>
 #include "include/api/types.h"
 
@@ -27,6 +28,9 @@ struct CudaTensorParam {
   void *data = nullptr;
   bool is_valid_mem = false;
   size_t size = 0;
+  // the pinned host memory to stage the async copies between host and device.
+  void *host_data = nullptr;
+  size_t host_size = 0;
 };
 class TensorRTAllocator {
  public:
@@ -50,6 +54,9 @@ class TensorRTAllocator {
   int SyncMemInHostAndDevice(void *host_data, const std::string &device_tensor_name, size_t data_size,
                              bool is_host2device, bool sync = true);
 
+  // wait for the async copies on the stream, and copy the staged outputs to the host tensors.
+  int SyncStream();
+
   int ClearDeviceMem();
 
   void MarkMemValid(const std::string &name, bool isValid);
@@ -57,8 +64,17 @@ class TensorRTAllocator {
   bool GetMemIsValid(const std::string &name);
 
  private:
+  struct PendingCopy {
+    void *host_data;
+    void *staging_data;
+    size_t size;
+  };
+
+  void *MallocStagingMem(CudaTensorParam *cuda_tensor, size_t size);
+
   std::map<std::string, CudaTensorParam> cuda_tensor_map_;
-  cudaStream_t stream_;
+  std::vector<PendingCopy> pending_copies_;
+  cudaStream_t stream_{nullptr};
 };
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_TENSORRT_TENSORRT_ALLOCATOR_H_
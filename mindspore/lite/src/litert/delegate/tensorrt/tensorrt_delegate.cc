@@ -21,6 +21,7 @@
 #include <string>
 #include "src/litert/delegate/delegate_utils.h"
 #include "src/litert/delegate/auto_registration_factory.h"
+#include "src/common/utils.h"
 
 namespace mindspore::lite {
 TensorRTDelegate::~TensorRTDelegate() {
@@ -76,7 +77,8 @@ Status TensorRTDelegate::Init() {
   }
   runtime_->SetDeviceID(device_info_->GetDeviceID());
 
-  auto cuda_ret = cudaStreamCreate(&stream_);
+  // the non-blocking stream doesn't synchronize with the default stream, so the instances run concurrently.
+  auto cuda_ret = cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking);
   if (cuda_ret != cudaSuccess) {
     MS_LOG(ERROR) << "Cuda create stream failed";
     return mindspore::kLiteError;
@@ -93,6 +95,10 @@ Status TensorRTDelegate::Init() {
     return cache_ret;
   }
 
+  if (!engine_cache_dir_.empty()) {
+    engine_cache_ = std::make_shared<TensorRTEngineCache>(engine_cache_dir_);
+  }
+
   return mindspore::kSuccess;
 }
 
@@ -157,6 +163,12 @@ Status TensorRTDelegate::Build(DelegateModel<schema::Primitive> *model) {
     }
   }
 
+  auto parse_ret = ParseProfileShapes(model->inputs());
+  if (parse_ret != kSuccess) {
+    MS_LOG(ERROR) << "parse shape buckets of optimization profiles failed.";
+    return parse_ret;
+  }
+
   auto build_ret = BuildSubGraph(model);
   if (build_ret != kSuccess) {
     MS_LOG(INFO) << "BuildSubGraph failed";
@@ -166,6 +178,35 @@ Status TensorRTDelegate::Build(DelegateModel<schema::Primitive> *model) {
   return mindspore::kSuccess;
 }
 
+// the shape buckets are configured as "1,32:1,32;4,32:4,32", the buckets are separated by ';' and the shapes of the
+// graph inputs in one bucket are separated by ':'.
+Status TensorRTDelegate::ParseProfileShapes(const std::vector<mindspore::MSTensor> &graph_inputs) {
+  profile_shapes_.clear();
+  if (profile_shapes_str_.empty()) {
+    return mindspore::kSuccess;
+  }
+  for (auto &bucket : StrSplit(profile_shapes_str_, ";")) {
+    auto shapes = StrSplit(bucket, ":");
+    if (shapes.size() != graph_inputs.size()) {
+      MS_LOG(ERROR) << "The shape bucket " << bucket << " should contain " << graph_inputs.size() << " input shapes.";
+      return mindspore::kLiteParamInvalid;
+    }
+    for (size_t i = 0; i < shapes.size(); i++) {
+      std::vector<int64_t> shape;
+      for (auto &value : StrSplit(shapes[i], ",")) {
+        int dim_value = 0;
+        if (!ConvertStrToInt(value, &dim_value) || dim_value <= 0) {
+          MS_LOG(ERROR) << "The shape bucket " << bucket << " is invalid.";
+          return mindspore::kLiteParamInvalid;
+        }
+        shape.push_back(dim_value);
+      }
+      profile_shapes_[graph_inputs[i].Name()].push_back(shape);
+    }
+  }
+  return mindspore::kSuccess;
+}
+
 TensorRTOp *TensorRTDelegate::FindTensorRTOp(kernel::Kernel *kernel, const schema::Primitive *primitive) {
   auto in_tensors = kernel->inputs();
   auto out_tensors = kernel->outputs();
@@ -214,6 +255,9 @@ TensorRTSubGraph *TensorRTDelegate::CreateTensorRTGraph(const std::vector<Tensor
     return nullptr;
   }
   tensorrt_graph->SetCacheManager(cache_mgr_);
+  // the serialize path of the subgraph index takes precedence over the managed engine cache.
+  tensorrt_graph->SetEngineCache(engine_cache_);
+  tensorrt_graph->SetProfileShapes(profile_shapes_);
   if (serialize_path_.size() > 0) {
     tensorrt_graph->SetSerializePath(serialize_path_ + "_trt" + std::to_string(GetRankID()) + ".bin_" +
                                      std::to_string(index));
@@ -17,6 +17,7 @@
 #define MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_TENSORRT_TENSORRT_DELEGATE_H_
 #include <string>
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
@@ -32,12 +33,15 @@ namespace mindspore::lite {
 class TensorRTDelegate : public Delegate {
  public:
   explicit TensorRTDelegate(mindspore::Context *context, const std::string &cache_model_path, size_t vocab_size,
-                            size_t device_cache_size, const std::string &serialize_path)
+                            size_t device_cache_size, const std::string &serialize_path,
+                            const std::string &engine_cache_dir = "", const std::string &profile_shapes = "")
       : context_(context),
         cache_model_path_(cache_model_path),
         vocab_size_(vocab_size),
         device_cache_size_(device_cache_size),
-        serialize_path_(serialize_path) {}
+        serialize_path_(serialize_path),
+        engine_cache_dir_(engine_cache_dir),
+        profile_shapes_str_(profile_shapes) {}
 
   ~TensorRTDelegate() override;
 
@@ -48,6 +52,8 @@ class TensorRTDelegate : public Delegate {
  private:
   Status BuildSubGraph(DelegateModel<schema::Primitive> *model);
 
+  Status ParseProfileShapes(const std::vector<mindspore::MSTensor> &graph_inputs);
+
   TensorRTOp *FindTensorRTOp(kernel::Kernel *kernel, const schema::Primitive *primitive);
 
   TensorRTSubGraph *CreateTensorRTGraph(const std::vector<TensorRTOp *> &ops, DelegateModel<schema::Primitive> *model,
@@ -64,6 +70,10 @@ class TensorRTDelegate : public Delegate {
   size_t device_cache_size_{0};
   std::shared_ptr<cache::EmbeddingCacheManager> cache_mgr_{nullptr};
   const std::string serialize_path_;
+  const std::string engine_cache_dir_;
+  std::shared_ptr<TensorRTEngineCache> engine_cache_{nullptr};
+  const std::string profile_shapes_str_;
+  std::map<std::string, std::vector<std::vector<int64_t>>> profile_shapes_;
   cudaStream_t stream_{nullptr};
 };
 }  // namespace mindspore::lite
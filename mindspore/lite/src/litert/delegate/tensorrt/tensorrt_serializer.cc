@@ -15,10 +15,75 @@
  */
 
 #include "src/litert/delegate/tensorrt/tensorrt_serializer.h"
+#include <cuda_runtime.h>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
 #include "src/litert/delegate/tensorrt/tensorrt_runtime.h"
 #include "src/common/file_utils.h"
 
 namespace mindspore::lite {
+namespace {
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+std::string HashToString(uint64_t hash) {
+  std::ostringstream oss;
+  oss << std::hex << std::setw(sizeof(uint64_t) * 2) << std::setfill('0') << hash;
+  return oss.str();
+}
+
+// write to a temporary file and rename it, so the other processes never load a part of the file.
+int WriteFileAtomically(const std::string &file_path, void *data, size_t size) {
+  auto tmp_file = file_path + ".tmp";
+  if (WriteToBin(tmp_file, data, size) != RET_OK) {
+    return RET_ERROR;
+  }
+  if (std::rename(tmp_file.c_str(), file_path.c_str()) != 0) {
+    (void)std::remove(tmp_file.c_str());
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+}  // namespace
+
+std::shared_ptr<nvinfer1::ICudaEngine> TensorRTEngineManager::Find(const std::string &key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = engines_.find(key);
+  if (iter == engines_.end()) {
+    return nullptr;
+  }
+  auto engine = iter->second.lock();
+  if (engine == nullptr) {
+    (void)engines_.erase(iter);
+  }
+  return engine;
+}
+
+std::shared_ptr<nvinfer1::ICudaEngine> TensorRTEngineManager::Insert(const std::string &key,
+                                                                     nvinfer1::ICudaEngine *engine) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = engines_.find(key);
+  if (iter != engines_.end()) {
+    auto shared_engine = iter->second.lock();
+    if (shared_engine != nullptr) {
+      engine->destroy();
+      return shared_engine;
+    }
+  }
+  std::shared_ptr<nvinfer1::ICudaEngine> shared_engine(engine, [](nvinfer1::ICudaEngine *ptr) { ptr->destroy(); });
+  engines_[key] = shared_engine;
+  return shared_engine;
+}
+
+uint64_t TensorRTCacheHash(const void *data, size_t size, uint64_t hash) {
+  auto bytes = static_cast<const uint8_t *>(data);
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * kFnvPrime;
+  }
+  return hash;
+}
+
 nvinfer1::ICudaEngine *TensorRTSerializer::GetSerializedEngine() {
   if (serialize_file_path_.size() == 0) {
     return nullptr;
@@ -51,7 +116,7 @@ void TensorRTSerializer::SaveSerializedEngine(nvinfer1::ICudaEngine *engine) {
     return;
   }
 
-  int ret = WriteToBin(serialize_file_path_, ptr->data(), ptr->size());
+  int ret = WriteFileAtomically(serialize_file_path_, ptr->data(), ptr->size());
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "save engine failed " << serialize_file_path_;
   } else {
@@ -60,4 +125,58 @@ void TensorRTSerializer::SaveSerializedEngine(nvinfer1::ICudaEngine *engine) {
   ptr->destroy();
   return;
 }
+
+TensorRTEngineCache::TensorRTEngineCache(const std::string &cache_dir) : cache_dir_(cache_dir) {
+  int device_id = 0;
+  cudaDeviceProp prop;
+  std::string gpu_sku = "unknown";
+  if (cudaGetDevice(&device_id) == cudaSuccess && cudaGetDeviceProperties(&prop, device_id) == cudaSuccess) {
+    // the cards of the same compute capability differ in the sm count and the memory, which the tactics depend on.
+    std::ostringstream sku;
+    sku << prop.name << prop.major << prop.minor << prop.multiProcessorCount << prop.totalGlobalMem;
+    auto sku_str = sku.str();
+    gpu_sku = "sm" + std::to_string(prop.major) + std::to_string(prop.minor) + "_" +
+              HashToString(TensorRTCacheHash(sku_str.data(), sku_str.size(), kFnvOffsetBasis));
+  }
+  platform_key_ = "trt" + std::to_string(getInferLibVersion()) + "_" + gpu_sku;
+  MS_LOG(INFO) << "tensorrt engine cache " << cache_dir_ << " for platform " << platform_key_;
+}
+
+std::string TensorRTEngineCache::GetEngineFilePath(const std::string &subgraph_key) const {
+  auto hash = TensorRTCacheHash(subgraph_key.data(), subgraph_key.size(), kFnvOffsetBasis);
+  return cache_dir_ + FILE_SEPARATOR + platform_key_ + "_" + HashToString(hash) + ".engine";
+}
+
+#if TRT_VERSION_GE(8, 0)
+nvinfer1::ITimingCache *TensorRTEngineCache::LoadTimingCache(nvinfer1::IBuilderConfig *config) const {
+  auto timing_file = cache_dir_ + FILE_SEPARATOR + platform_key_ + ".timing";
+  size_t size = 0;
+  auto data = ReadFile(timing_file.c_str(), &size);
+  auto timing_cache = config->createTimingCache(data, data == nullptr ? 0 : size);
+  delete[] data;
+  if (timing_cache == nullptr) {
+    MS_LOG(WARNING) << "create timing cache failed.";
+    return nullptr;
+  }
+  if (!config->setTimingCache(*timing_cache, false)) {
+    MS_LOG(WARNING) << "set timing cache failed.";
+    timing_cache->destroy();
+    return nullptr;
+  }
+  return timing_cache;
+}
+
+void TensorRTEngineCache::SaveTimingCache(const nvinfer1::ITimingCache *timing_cache) const {
+  auto timing_file = cache_dir_ + FILE_SEPARATOR + platform_key_ + ".timing";
+  nvinfer1::IHostMemory *ptr = timing_cache->serialize();
+  if (ptr == nullptr) {
+    MS_LOG(WARNING) << "serialize timing cache failed.";
+    return;
+  }
+  if (WriteFileAtomically(timing_file, ptr->data(), ptr->size()) != RET_OK) {
+    MS_LOG(WARNING) << "save timing cache failed " << timing_file;
+  }
+  ptr->destroy();
+}
+#endif
 }  // namespace mindspore::lite
@@ -15,6 +15,10 @@
  */
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_TENSORRT_TENSORRT_SERIALIZER_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_TENSORRT_TENSORRT_SERIALIZER_H_
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <NvInfer.h>
@@ -41,5 +45,54 @@ class TensorRTSerializer {
   std::string serialize_file_path_;
   TensorRTLogger logger_;
 };
+
+// the engines are shared by the subgraphs of the concurrent model instances with the same engine file, and every
+// subgraph runs its own execution context on the cuda stream of its delegate.
+class TensorRTEngineManager {
+ public:
+  static TensorRTEngineManager &GetInstance() {
+    static TensorRTEngineManager instance;
+    return instance;
+  }
+
+  std::shared_ptr<nvinfer1::ICudaEngine> Find(const std::string &key);
+
+  // take the ownership of the engine, the engine registered by another instance in the meantime is returned instead.
+  std::shared_ptr<nvinfer1::ICudaEngine> Insert(const std::string &key, nvinfer1::ICudaEngine *engine);
+
+ private:
+  TensorRTEngineManager() = default;
+
+  ~TensorRTEngineManager() = default;
+
+  std::mutex mutex_;
+  std::map<std::string, std::weak_ptr<nvinfer1::ICudaEngine>> engines_;
+};
+
+uint64_t TensorRTCacheHash(const void *data, size_t size, uint64_t hash);
+
+// the managed cache of the engines and the timing cache in the engine_cache_dir of the ms_cache config.
+// the engine file is keyed by the hash of the subgraph and its input profiles, together with the version of tensorrt
+// and the sku of the gpu, so the engine is never loaded by another tensorrt or gpu. The timing cache is shared by all
+// the subgraphs built on the same platform, so the tactics measured once are reused by the later builds.
+class TensorRTEngineCache {
+ public:
+  explicit TensorRTEngineCache(const std::string &cache_dir);
+
+  ~TensorRTEngineCache() = default;
+
+  std::string GetEngineFilePath(const std::string &subgraph_key) const;
+
+#if TRT_VERSION_GE(8, 0)
+  // the returned timing cache is attached to the config, and it's owned by the caller.
+  nvinfer1::ITimingCache *LoadTimingCache(nvinfer1::IBuilderConfig *config) const;
+
+  void SaveTimingCache(const nvinfer1::ITimingCache *timing_cache) const;
+#endif
+
+ private:
+  std::string cache_dir_;
+  std::string platform_key_;
+};
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_DELEGATE_TENSORRT_TENSORRT_SERIALIZER_H_
@@ -18,6 +18,7 @@
 #include <cuda_runtime_api.h>
 #include <string>
 #include <vector>
+#include <sstream>
 #include <set>
 #include <queue>
 #include <algorithm>
@@ -32,10 +33,20 @@ TensorRTSubGraph::~TensorRTSubGraph() {
     config_->destroy();
     config_ = nullptr;
   }
+#if TRT_VERSION_GE(8, 0)
+  if (timing_cache_ != nullptr) {
+    timing_cache_->destroy();
+    timing_cache_ = nullptr;
+  }
+#endif
   if (trt_context_ != nullptr) {
     trt_context_->destroy();
     trt_context_ = nullptr;
   }
+  if (shared_engine_ != nullptr) {
+    shared_engine_ = nullptr;
+    engine_ = nullptr;
+  }
   if (engine_ != nullptr) {
     engine_->destroy();
     engine_ = nullptr;
@@ -73,47 +84,257 @@ int TensorRTSubGraph::Init(cudaStream_t stream) {
   if (SetDeviceConfig(stream) != RET_OK) {
     MS_LOG(WARNING) << "set tensorrt config failed.";
   }
+  // the input profiles of the deserialized engine are parsed the same as the built one.
+  for (size_t i = 0; i < inputs_.size(); i++) {
+    if (inputs_[i].Shape().size() != DIMENSION_4D) {
+      input_hw_index_ = -1;
+    }
+  }
+  if (engine_cache_ != nullptr && serialize_file_path_.empty()) {
+    serialize_file_path_ = engine_cache_->GetEngineFilePath(GetEngineCacheKey());
+  }
   serializer_ = std::make_shared<TensorRTSerializer>(serialize_file_path_);
   if (serializer_ == nullptr) {
     MS_LOG(ERROR) << "create Serializer failed.";
     return RET_ERROR;
   }
-  engine_ = serializer_->GetSerializedEngine();
-  if (engine_ != nullptr) {
-    MS_LOG(INFO) << "using serialized engine " << serialize_file_path_;
-    return RET_OK;
+#if TRT_VERSION_GE(8, 0)
+  // the execution contexts of one engine run concurrently on different streams since tensorrt 8.
+  if (!serialize_file_path_.empty()) {
+    engine_key_ = serialize_file_path_ + "@" + std::to_string(device_info_->GetDeviceID());
+    shared_engine_ = TensorRTEngineManager::GetInstance().Find(engine_key_);
+    engine_ = shared_engine_.get();
   }
-  for (size_t i = 0; i < inputs_.size(); i++) {
-    if (inputs_[i].Shape().size() != DIMENSION_4D) {
-      input_hw_index_ = -1;
+#endif
+  if (engine_ != nullptr) {
+    MS_LOG(INFO) << "using shared engine " << serialize_file_path_;
+  } else {
+    engine_ = serializer_->GetSerializedEngine();
+    if (engine_ != nullptr) {
+      MS_LOG(INFO) << "using serialized engine " << serialize_file_path_;
+      ShareEngine();
     }
   }
   return RET_OK;
 }
 
+std::string TensorRTSubGraph::GetEngineCacheKey() {
+  std::ostringstream key;
+  auto append_tensor = [&key](const mindspore::MSTensor &tensor) {
+    key << tensor.Name() << ":" << static_cast<int>(tensor.DataType()) << ":" << static_cast<int>(tensor.format());
+    for (auto dim : tensor.Shape()) {
+      key << "," << dim;
+    }
+    if (tensor.IsConst() && tensor.Data() != nullptr) {
+      key << ":" << TensorRTCacheHash(tensor.Data().get(), tensor.DataSize(), 0);
+    }
+    key << ";";
+  };
+  key << "fp16:" << device_info_->GetEnableFP16() << ";int8:" << IsInt8Mode() << ";batch:" << input_batchsize_index_
+      << ";hw:" << input_hw_index_ << ";";
+  for (auto &in_tensor : inputs_) {
+    append_tensor(in_tensor);
+  }
+  for (auto &out_tensor : outputs_) {
+    append_tensor(out_tensor);
+  }
+  for (auto &in_tensor : inputs_) {
+    auto iter = profile_shapes_.find(in_tensor.Name());
+    if (iter == profile_shapes_.end()) {
+      continue;
+    }
+    key << "profile:" << in_tensor.Name();
+    for (auto &shape : iter->second) {
+      key << ":";
+      for (auto dim : shape) {
+        key << dim << ",";
+      }
+    }
+    key << ";";
+  }
+  for (auto op : all_ops_) {
+    key << op->GetOpName() << ":" << static_cast<int>(op->type()) << ":" << static_cast<int>(op->GetQuantType()) << "(";
+    for (auto &in_tensor : op->inputs()) {
+      append_tensor(in_tensor);
+    }
+    for (auto &out_tensor : op->outputs()) {
+      append_tensor(out_tensor);
+    }
+    key << ")";
+  }
+  return key.str();
+}
+
 int TensorRTSubGraph::BuildEngine() {
   // print all network ops
   if (this->config_->addOptimizationProfile(profile_) == -1) {
     MS_LOG(ERROR) << "addOptimizationProfile failed.";
     return RET_ERROR;
   }
+  if (AddShapeBucketProfiles() != RET_OK) {
+    MS_LOG(ERROR) << "add optimization profiles of shape buckets failed.";
+    return RET_ERROR;
+  }
   MS_LOG(INFO) << "build engine for tensorrt network: " << ctx_->network()->getName();
   for (int i = 0; i < ctx_->network()->getNbLayers(); i++) {
     MS_LOG(DEBUG) << "tensorrt op: " << ctx_->network()->getLayer(i)->getName();
   }
   MS_LOG(DEBUG) << "end of tensorrt network: " << ctx_->network()->getName();
 
+#if TRT_VERSION_GE(8, 0)
+  if (engine_cache_ != nullptr && timing_cache_ == nullptr) {
+    timing_cache_ = engine_cache_->LoadTimingCache(config_);
+  }
+#endif
   this->engine_ = runtime_->GetBuilder()->buildEngineWithConfig(*ctx_->network(), *this->config_);
   if (this->engine_ == nullptr) {
     MS_LOG(ERROR) << "Create engine failed in TensorRT network";
     return RET_ERROR;
   }
+#if TRT_VERSION_GE(8, 0)
+  if (timing_cache_ != nullptr) {
+    engine_cache_->SaveTimingCache(timing_cache_);
+  }
+#endif
   if (serialize_file_path_.size() > 0) {
     serializer_->SaveSerializedEngine(engine_);
   }
+  ShareEngine();
   return RET_OK;
 }
 
+void TensorRTSubGraph::ShareEngine() {
+  if (engine_key_.empty() || engine_ == nullptr || shared_engine_ != nullptr) {
+    return;
+  }
+  shared_engine_ = TensorRTEngineManager::GetInstance().Insert(engine_key_, engine_);
+  engine_ = shared_engine_.get();
+}
+
+// Every shape bucket gets its own profile whose opt and max dims are the bucket shape, so the tactics are tuned for the
+// bucket instead of the largest shape. The inputs without a bucket keep the dims of the default profile.
+int TensorRTSubGraph::AddShapeBucketProfiles() {
+  if (input_batchsize_index_ == -1 || profile_shapes_.empty()) {
+    return RET_OK;
+  }
+  size_t bucket_num = 0;
+  for (auto &item : profile_shapes_) {
+    bucket_num = std::max(bucket_num, item.second.size());
+  }
+  auto network = ctx_->network();
+  for (size_t k = 0; k < bucket_num; k++) {
+    auto profile = runtime_->GetBuilder()->createOptimizationProfile();
+    if (profile == nullptr) {
+      MS_LOG(ERROR) << "createOptimizationProfile failed.";
+      return RET_ERROR;
+    }
+    bool has_bucket = false;
+    for (int i = 0; i < network->getNbInputs(); i++) {
+      auto name = network->getInput(i)->getName();
+      auto min_dims = profile_->getDimensions(name, nvinfer1::OptProfileSelector::kMIN);
+      auto opt_dims = profile_->getDimensions(name, nvinfer1::OptProfileSelector::kOPT);
+      auto max_dims = profile_->getDimensions(name, nvinfer1::OptProfileSelector::kMAX);
+      auto iter = profile_shapes_.find(name);
+      if (iter != profile_shapes_.end() && k < iter->second.size()) {
+        auto &shape = iter->second[k];
+        auto construct_dims = network->getInput(i)->getDimensions();
+        bool valid = static_cast<size_t>(construct_dims.nbDims) == shape.size();
+        for (int d = 0; valid && d < construct_dims.nbDims; d++) {
+          valid = construct_dims.d[d] == -1 ? shape[d] >= min_dims.d[d] : construct_dims.d[d] == shape[d];
+        }
+        if (valid) {
+          opt_dims = ConvertCudaDims(shape);
+          max_dims = opt_dims;
+          has_bucket = true;
+        } else {
+          MS_LOG(WARNING) << "shape bucket " << k << " of " << name << " mismatches the network input, use default.";
+        }
+      }
+      if (!profile->setDimensions(name, nvinfer1::OptProfileSelector::kMIN, min_dims) ||
+          !profile->setDimensions(name, nvinfer1::OptProfileSelector::kOPT, opt_dims) ||
+          !profile->setDimensions(name, nvinfer1::OptProfileSelector::kMAX, max_dims)) {
+        MS_LOG(ERROR) << "setDimensions of shape bucket " << k << " failed for " << name;
+        return RET_ERROR;
+      }
+    }
+    if (!has_bucket) {
+      continue;
+    }
+    if (this->config_->addOptimizationProfile(profile) == -1) {
+      MS_LOG(ERROR) << "addOptimizationProfile of shape bucket " << k << " failed.";
+      return RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+// select the profile with the least max volume which covers the current input shapes.
+int TensorRTSubGraph::SelectProfile() {
+  int profile_num = this->engine_->getNbOptimizationProfiles();
+  if (profile_num <= 1) {
+    return RET_OK;
+  }
+  int selected = -1;
+  int64_t selected_volume = 0;
+  for (int k = 0; k < profile_num; k++) {
+    bool fit = true;
+    int64_t volume = 0;
+    for (size_t i = 0; fit && i < trt_in_tensor_name_.size(); i++) {
+      int index = this->engine_->getBindingIndex(trt_in_tensor_name_[i].c_str());
+      auto min_dims = this->engine_->getProfileDimensions(index, k, nvinfer1::OptProfileSelector::kMIN);
+      auto max_dims = this->engine_->getProfileDimensions(index, k, nvinfer1::OptProfileSelector::kMAX);
+      auto shape = inputs_[i].Shape();
+      if (static_cast<size_t>(max_dims.nbDims) != shape.size()) {
+        fit = false;
+        break;
+      }
+      int64_t input_volume = 1;
+      for (int d = 0; d < max_dims.nbDims; d++) {
+        fit = fit && shape[d] >= min_dims.d[d] && shape[d] <= max_dims.d[d];
+        input_volume *= max_dims.d[d];
+      }
+      volume += input_volume;
+    }
+    if (fit && (selected == -1 || volume < selected_volume)) {
+      selected = k;
+      selected_volume = volume;
+    }
+  }
+  if (selected == -1) {
+    MS_LOG(ERROR) << "no optimization profile covers the input shapes.";
+    return RET_ERROR;
+  }
+  if (selected == profile_index_) {
+    return RET_OK;
+  }
+#if TRT_VERSION_GE(8, 0)
+  bool ret = this->trt_context_->setOptimizationProfileAsync(selected, stream_);
+#else
+  bool ret = this->trt_context_->setOptimizationProfile(selected);
+#endif
+  if (!ret) {
+    MS_LOG(ERROR) << "set optimization profile " << selected << " failed.";
+    return RET_ERROR;
+  }
+  MS_LOG(INFO) << "switch optimization profile from " << profile_index_ << " to " << selected;
+  profile_index_ = selected;
+  return RET_OK;
+}
+
+// the bindings of profile k are behind the bindings of profile 0 with the offset of k * bindings_per_profile_.
+int TensorRTSubGraph::GetBindingIndex(const std::string &name) {
+  return this->engine_->getBindingIndex(name.c_str()) + profile_index_ * bindings_per_profile_;
+}
+
+// all profiles bind the same device memory of the tensor in the allocator.
+void TensorRTSubGraph::SetTensorBinding(const std::string &name, void *device_ptr) {
+  int index = this->engine_->getBindingIndex(name.c_str());
+  int profile_num = this->engine_->getNbOptimizationProfiles();
+  for (int k = 0; k < profile_num; k++) {
+    tensor_bindings_[index + k * bindings_per_profile_] = device_ptr;
+  }
+}
+
 int TensorRTSubGraph::SetDeviceConfig(cudaStream_t stream) {
   if (config_ == nullptr) {
     this->config_ = runtime_->GetBuilder()->createBuilderConfig();
@@ -391,6 +612,7 @@ int TensorRTSubGraph::Prepare() {
     MS_LOG(ERROR) << "malloc tensor binding array failed.";
     return RET_ERROR;
   }
+  bindings_per_profile_ = binding_num / std::max(this->engine_->getNbOptimizationProfiles(), 1);
 
   for (auto tensor : inputs_) {
     auto device_ptr = runtime_->GetAllocator()->MallocDeviceMem(tensor, tensor.DataSize());
@@ -398,9 +620,14 @@ int TensorRTSubGraph::Prepare() {
       MS_LOG(ERROR) << "malloc for inputs tensor device memory failed.";
       return RET_ERROR;
     }
-    int index = this->engine_->getBindingIndex(tensor.Name().c_str());
-    tensor_bindings_[index] = device_ptr;
+    SetTensorBinding(tensor.Name(), device_ptr);
     trt_in_tensor_name_.push_back(tensor.Name());
+  }
+  if (SelectProfile() != RET_OK) {
+    return RET_ERROR;
+  }
+  for (auto tensor : inputs_) {
+    int index = GetBindingIndex(tensor.Name());
     nvinfer1::Dims input_dims = ConvertCudaDims(tensor.Shape());
     for (int od = 0; od < input_dims.nbDims; od++) {
       MS_LOG(DEBUG) << "in tensor " << tensor.Name() << " dims at " << od << " is " << input_dims.d[od];
@@ -417,8 +644,7 @@ int TensorRTSubGraph::Prepare() {
     size_t data_size = cache_mgr_->GetCacheDataSize(cache_tensor);
     auto device_ptr = runtime_->GetAllocator()->MallocDeviceMem(cache_tensor, data_size);
     runtime_->GetAllocator()->MarkMemValid(cache_tensor.Name().c_str(), true);
-    int index = this->engine_->getBindingIndex(cache_tensor.Name().c_str());
-    tensor_bindings_[index] = device_ptr;
+    SetTensorBinding(cache_tensor.Name(), device_ptr);
     auto cache_ret = cache_mgr_->SetDeviceCacheAddr(cache_tensor.Name(), device_ptr, data_size);
     if (cache_ret != kSuccess) {
       MS_LOG(ERROR) << "SetDeviceCacheAddr failed, cache tensor: " << cache_tensor.Name();
@@ -444,8 +670,7 @@ int TensorRTSubGraph::Prepare() {
       MS_LOG(ERROR) << "malloc for outputs tensor device memory failed.";
       return RET_ERROR;
     }
-    int index = this->engine_->getBindingIndex(tensor.Name().c_str());
-    tensor_bindings_[index] = device_ptr;
+    SetTensorBinding(tensor.Name(), device_ptr);
     trt_out_tensor_name_.push_back(tensor.Name());
   }
   return RET_OK;
@@ -456,6 +681,10 @@ int TensorRTSubGraph::ReSize() {
     MS_LOG(ERROR) << "current network don't support resize.";
     return RET_ERROR;
   }
+  if (SelectProfile() != RET_OK) {
+    MS_LOG(ERROR) << "select optimization profile for resize failed.";
+    return RET_ERROR;
+  }
   for (size_t i = 0; i < trt_in_tensor_name_.size(); i++) {
     if (ctx_->network() != nullptr) {
       for (int j = 0; j < ctx_->network()->getNbInputs(); j++) {
@@ -482,8 +711,8 @@ int TensorRTSubGraph::ReSize() {
       MS_LOG(ERROR) << "realloc for input tensor device memory failed.";
       return RET_ERROR;
     }
-    int index = this->engine_->getBindingIndex(trt_in_tensor_name_[i].c_str());
-    tensor_bindings_[index] = device_ptr;
+    SetTensorBinding(trt_in_tensor_name_[i], device_ptr);
+    int index = GetBindingIndex(trt_in_tensor_name_[i]);
     // Set actual input size
     nvinfer1::Dims input_dims = ConvertCudaDims(inputs_[i].Shape());
     for (int od = 0; od < input_dims.nbDims; od++) {
@@ -501,14 +730,13 @@ int TensorRTSubGraph::ReSize() {
   }
 
   for (size_t i = 0; i < trt_out_tensor_name_.size(); i++) {
-    int index = this->engine_->getBindingIndex(trt_out_tensor_name_[i].c_str());
     auto device_ptr = runtime_->GetAllocator()->MallocDeviceMem(trt_out_tensor_name_[i], outputs_[i].DataSize(),
                                                                 ConvertDataType(outputs_[i].DataType()));
     if (device_ptr == nullptr) {
       MS_LOG(ERROR) << "realloc for outputs tensor device memory failed.";
       return RET_ERROR;
     }
-    tensor_bindings_[index] = device_ptr;
+    SetTensorBinding(trt_out_tensor_name_[i], device_ptr);
   }
   return RET_OK;
 }
@@ -562,7 +790,7 @@ int TensorRTSubGraph::Execute() {
       continue;
     }
 
-    ret = runtime_->GetAllocator()->SyncMemInHostAndDevice(inputs_[i], trt_in_tensor_name_[i], true);
+    ret = runtime_->GetAllocator()->SyncMemInHostAndDevice(inputs_[i], trt_in_tensor_name_[i], true, false);
     if (ret != RET_OK) {
       MS_LOG(ERROR) << "sync mem from host to device failed for " << trt_in_tensor_name_[i];
       return ret;
@@ -570,13 +798,14 @@ int TensorRTSubGraph::Execute() {
     runtime_->GetAllocator()->MarkMemValid(trt_in_tensor_name_[i], true);
   }
 
-  if (!this->trt_context_->executeV2(tensor_bindings_)) {
+  // enqueue on the stream of the delegate, so the concurrent instances don't serialize on the default stream.
+  if (!this->trt_context_->enqueueV2(tensor_bindings_, stream_, nullptr)) {
     MS_LOG(ERROR) << "TensorRT execute failed.";
     return RET_ERROR;
   }
 
   for (size_t i = 0; i < trt_out_tensor_name_.size(); i++) {
-    int index = this->engine_->getBindingIndex(trt_out_tensor_name_[i].c_str());
+    int index = GetBindingIndex(trt_out_tensor_name_[i]);
     // actual output tensor dims
     auto out_dims = this->trt_context_->getBindingDimensions(index);
     std::vector<int64_t> new_shape = lite::ConvertMSShape(out_dims);
@@ -596,13 +825,19 @@ int TensorRTSubGraph::Execute() {
       return RET_ERROR;
     }
     runtime_->GetAllocator()->MarkMemValid(trt_out_tensor_name_[i], true);
-    int sync_ret = runtime_->GetAllocator()->SyncMemInHostAndDevice(outputs_[i], trt_out_tensor_name_[i], false);
+    int sync_ret =
+      runtime_->GetAllocator()->SyncMemInHostAndDevice(outputs_[i], trt_out_tensor_name_[i], false, false);
     if (sync_ret != RET_OK) {
       MS_LOG(ERROR) << "sync mem from device to host failed for " << trt_out_tensor_name_[i];
       return sync_ret;
     }
     runtime_->GetAllocator()->MarkMemValid(trt_out_tensor_name_[i], false);
   }
+  ret = runtime_->GetAllocator()->SyncStream();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "sync outputs from device to host failed.";
+    return ret;
+  }
   // make mem invalid, prepare for next execute
   for (size_t i = 0; i < inputs_.size(); i++) {
     runtime_->GetAllocator()->MarkMemValid(trt_in_tensor_name_[i], false);
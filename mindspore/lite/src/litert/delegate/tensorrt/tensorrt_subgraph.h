@@ -80,9 +80,20 @@ class TensorRTSubGraph : public kernel::Kernel {
 
   void SetSerializePath(const std::string &path) { serialize_file_path_ = std::move(path); }
 
+  void SetEngineCache(const std::shared_ptr<TensorRTEngineCache> &engine_cache) { engine_cache_ = engine_cache; }
+
+  // the shape buckets of the graph inputs, each bucket is built as one more optimization profile of the engine.
+  void SetProfileShapes(const std::map<std::string, std::vector<std::vector<int64_t>>> &profile_shapes) {
+    profile_shapes_ = profile_shapes;
+  }
+
  private:
   int BuildEngine();
 
+  void ShareEngine();
+
+  std::string GetEngineCacheKey();
+
   int SetDeviceConfig(cudaStream_t stream);
 
   bool IsInt8Mode();
@@ -106,6 +117,14 @@ class TensorRTSubGraph : public kernel::Kernel {
   nvinfer1::Dims ParseInputDimsProfile(const mindspore::MSTensor &in_tensor);
   int ParseInputsProfile();
 
+  int AddShapeBucketProfiles();
+
+  int SelectProfile();
+
+  int GetBindingIndex(const std::string &name);
+
+  void SetTensorBinding(const std::string &name, void *device_ptr);
+
   bool ValidInputResizeDims(const nvinfer1::Dims &construct_dims, const std::vector<int64_t> &resize_input_shape);
 
   std::vector<TensorRTOp *> all_ops_{};
@@ -132,8 +151,14 @@ class TensorRTSubGraph : public kernel::Kernel {
   nvinfer1::INetworkDefinition *network_{nullptr};
   nvinfer1::IBuilderConfig *config_{nullptr};
   nvinfer1::ICudaEngine *engine_{nullptr};
+  // the engine_ is owned by shared_engine_ when it's shared with the other instances by TensorRTEngineManager.
+  std::shared_ptr<nvinfer1::ICudaEngine> shared_engine_{nullptr};
+  std::string engine_key_;
   nvinfer1::IExecutionContext *trt_context_{nullptr};
   nvinfer1::IOptimizationProfile *profile_{nullptr};
+  std::map<std::string, std::vector<std::vector<int64_t>>> profile_shapes_;
+  int profile_index_{0};
+  int bindings_per_profile_{0};
 
   TensorRTContext *ctx_;
 
@@ -149,6 +174,10 @@ class TensorRTSubGraph : public kernel::Kernel {
   std::shared_ptr<TensorRTSerializer> serializer_{nullptr};
 
   std::string serialize_file_path_;
+  std::shared_ptr<TensorRTEngineCache> engine_cache_{nullptr};
+#if TRT_VERSION_GE(8, 0)
+  nvinfer1::ITimingCache *timing_cache_{nullptr};
+#endif
   cudaStream_t stream_{nullptr};
 };
 }  // namespace mindspore::lite
@@ -24,6 +24,7 @@
 #include "schema/model_generated.h"
 #include "include/errorcode.h"
 #include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_epilogue_fp32.h"
 #include "src/tensorlist.h"
 #include "include/registry/register_kernel_interface.h"
 #include "src/litert/kernel_registry.h"
@@ -32,6 +33,17 @@ namespace mindspore {
 namespace lite {
 namespace {
 static const size_t kNumMaxMallocSize = GetMaxMallocSize();
+
+// the operands of the elementwise epilogue fused into the matmul are not the inputs of the matmul infer.
+size_t GetInferInputNum(const std::vector<lite::Tensor *> &inputs, const OpParameter *parameter) {
+  if (parameter->type_ != schema::PrimitiveType_MatMulFusion &&
+      parameter->type_ != schema::PrimitiveType_FullConnection) {
+    return inputs.size();
+  }
+  auto operand_num =
+    static_cast<size_t>(MatmulEpilogueOperandNum(&reinterpret_cast<const MatMulParameter *>(parameter)->epilogue_));
+  return inputs.size() > operand_num ? inputs.size() - operand_num : inputs.size();
+}
 }
 
 int KernelInferShape(const std::vector<lite::Tensor *> &inputs, const std::vector<lite::Tensor *> &outputs,
@@ -144,7 +156,8 @@ int KernelInferShape(const std::vector<lite::Tensor *> &inputs, const std::vecto
     return RET_OK;
   }
 
-  int ret = GenerateInTensorC(inputs, &in_tensors, allocator);
+  std::vector<lite::Tensor *> infer_inputs(inputs.begin(), inputs.begin() + GetInferInputNum(inputs, parameter));
+  int ret = GenerateInTensorC(infer_inputs, &in_tensors, allocator);
   if (ret != RET_OK) {
     FreeAllTensorC(&in_tensors, allocator);
     return RET_ERROR;
@@ -253,6 +253,13 @@ bool InnerContext::IsCpuFloat16Enabled() const {
   return GetDeviceInfo(DT_CPU).cpu_device_info_.enable_float16_;
 }
 
+bool InnerContext::IsCpuBFloat16Enabled() const {
+  if (!IsDeviceTypeEnabled(DT_CPU)) {
+    return false;
+  }
+  return GetDeviceInfo(DT_CPU).cpu_device_info_.enable_bfloat16_;
+}
+
 bool InnerContext::IsGpuFloat16Enabled() const {
 #ifdef GPU_OPENCL
   if (!IsDeviceTypeEnabled(DT_GPU)) {
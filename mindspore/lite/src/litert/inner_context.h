@@ -45,6 +45,8 @@ struct InnerContext : public Context {
 
   bool IsCpuFloat16Enabled() const;
 
+  bool IsCpuBFloat16Enabled() const;
+
   bool IsGpuFloat16Enabled() const;
 
   bool IsGLTextureEnabled() const;
@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/jit_kernel_manager.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include "src/common/file_utils.h"
+#include "src/common/log_adapter.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr uint32_t kJitCacheMagic = 0x4a54534d;  // "MSTJ"
+constexpr uint32_t kJitCacheVersion = 1;
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+struct JitCacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t code_size;
+  uint64_t checksum;
+};
+
+uint64_t HashCode(const uint8_t *code, size_t size) {
+  uint64_t hash = kFnvOffsetBasis ^ size;
+  for (size_t i = 0; i < size; ++i) {
+    hash = (hash ^ code[i]) * kFnvPrime;
+  }
+  return hash;
+}
+}  // namespace
+
+JitKernelManager *JitKernelManager::GetInstance() {
+  static JitKernelManager instance;
+  return &instance;
+}
+
+JitKernelManager::~JitKernelManager() {
+#ifdef __linux__
+  for (auto &page : code_pages_) {
+    (void)munmap(page.first, page.second);
+  }
+#endif
+  code_pages_.clear();
+  kernels_.clear();
+}
+
+void JitKernelManager::Init(bool enable, const std::string &cache_dir) {
+  std::lock_guard<std::mutex> lock(mtx_);
+#ifdef __linux__
+  enable_ = enable_ || enable;
+#else
+  if (enable) {
+    MS_LOG(WARNING) << "jit kernel is only supported on linux.";
+  }
+#endif
+  if (!cache_dir.empty()) {
+    cache_dir_ = cache_dir;
+  }
+}
+
+void *JitKernelManager::GetKernel(const std::string &key, size_t max_code_size, const JitEmitFunc &emit_func) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!enable_) {
+    return nullptr;
+  }
+  auto iter = kernels_.find(key);
+  if (iter != kernels_.end()) {
+    return iter->second;
+  }
+  std::vector<uint8_t> code;
+  if (!LoadCode(key, &code)) {
+    code.resize(max_code_size);
+    auto code_size = emit_func(code.data(), code.size());
+    if (code_size == 0) {
+      MS_LOG(INFO) << "emit jit kernel " << key << " failed.";
+      kernels_[key] = nullptr;
+      return nullptr;
+    }
+    code.resize(code_size);
+    SaveCode(key, code);
+  }
+  auto kernel = MapCode(code);
+  kernels_[key] = kernel;
+  return kernel;
+}
+
+bool JitKernelManager::LoadCode(const std::string &key, std::vector<uint8_t> *code) const {
+  if (cache_dir_.empty()) {
+    return false;
+  }
+  auto cache_file = cache_dir_ + FILE_SEPARATOR + key + ".jit";
+  std::ifstream ifs(cache_file, std::ios::binary);
+  if (!ifs.good()) {
+    return false;
+  }
+  JitCacheHeader header;
+  ifs.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!ifs.good() || header.magic != kJitCacheMagic || header.version != kJitCacheVersion || header.code_size == 0) {
+    MS_LOG(WARNING) << "jit cache " << cache_file << " is invalid, ignore it.";
+    return false;
+  }
+  code->resize(header.code_size);
+  ifs.read(reinterpret_cast<char *>(code->data()), static_cast<std::streamsize>(header.code_size));
+  if (!ifs.good() || HashCode(code->data(), code->size()) != header.checksum) {
+    MS_LOG(WARNING) << "jit cache " << cache_file << " is broken, ignore it.";
+    code->clear();
+    return false;
+  }
+  return true;
+}
+
+void JitKernelManager::SaveCode(const std::string &key, const std::vector<uint8_t> &code) const {
+  if (cache_dir_.empty()) {
+    return;
+  }
+  auto cache_file = cache_dir_ + FILE_SEPARATOR + key + ".jit";
+  JitCacheHeader header = {kJitCacheMagic, kJitCacheVersion, code.size(), HashCode(code.data(), code.size())};
+  // write to a temporary file and rename it, so the other processes never load a part of the code.
+  auto tmp_file = cache_file + ".tmp";
+  std::ofstream ofs(tmp_file, std::ios::binary | std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(WARNING) << "open jit cache " << tmp_file << " failed.";
+    return;
+  }
+  ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  ofs.write(reinterpret_cast<const char *>(code.data()), static_cast<std::streamsize>(code.size()));
+  ofs.close();
+  if (!ofs.good() || std::rename(tmp_file.c_str(), cache_file.c_str()) != 0) {
+    MS_LOG(WARNING) << "save jit cache " << cache_file << " failed.";
+    (void)std::remove(tmp_file.c_str());
+  }
+}
+
+void *JitKernelManager::MapCode(const std::vector<uint8_t> &code) {
+#ifdef __linux__
+  auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  auto map_size = (code.size() + page_size - 1) / page_size * page_size;
+  auto page = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (page == MAP_FAILED) {
+    MS_LOG(WARNING) << "mmap jit code failed.";
+    return nullptr;
+  }
+  memcpy(page, code.data(), code.size());
+  // the code page is never writable and executable at the same time.
+  if (mprotect(page, map_size, PROT_READ | PROT_EXEC) != 0) {
+    MS_LOG(WARNING) << "mprotect jit code failed.";
+    (void)munmap(page, map_size);
+    return nullptr;
+  }
+  code_pages_.emplace_back(page, map_size);
+  return page;
+#else
+  return nullptr;
+#endif
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_JIT_KERNEL_MANAGER_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_JIT_KERNEL_MANAGER_H_
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mindspore::lite {
+// emit the machine code to the buffer of the capacity, return the code size, or 0 when failed.
+using JitEmitFunc = std::function<size_t(uint8_t *code, size_t capacity)>;
+
+// the manager of the microkernels which are generated at the runtime for the shapes known when the kernels are
+// prepared, it is enabled by the jit_kernel enable config of the session.
+// the executable code of one kernel is shared by all the sessions, and it is saved to the cache_dir of jit_kernel, so
+// the next process of the same kernel skips generating.
+class JitKernelManager {
+ public:
+  static JitKernelManager *GetInstance();
+  void Init(bool enable, const std::string &cache_dir);
+  bool enable() const { return enable_; }
+  // return the executable code of the key, which is generated by emit_func when not cached, nullptr if the jit is
+  // disabled or failed.
+  void *GetKernel(const std::string &key, size_t max_code_size, const JitEmitFunc &emit_func);
+
+ private:
+  JitKernelManager() = default;
+  ~JitKernelManager();
+  bool LoadCode(const std::string &key, std::vector<uint8_t> *code) const;
+  void SaveCode(const std::string &key, const std::vector<uint8_t> &code) const;
+  void *MapCode(const std::vector<uint8_t> &code);
+
+  std::mutex mtx_;
+  bool enable_ = false;
+  std::string cache_dir_;
+  std::map<std::string, void *> kernels_;
+  // the mapped code pages and their size.
+  std::vector<std::pair<void *, size_t>> code_pages_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_JIT_KERNEL_MANAGER_H_
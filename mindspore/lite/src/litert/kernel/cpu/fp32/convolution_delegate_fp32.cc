@@ -15,7 +15,11 @@
  */
 
 #include "src/litert/kernel/cpu/fp32/convolution_delegate_fp32.h"
+#include <algorithm>
+#include <sstream>
 #include "src/litert/kernel_registry.h"
+#include "src/litert/kernel_tune_cache.h"
+#include "src/common/utils.h"
 #include "src/litert/kernel/cpu/fp32/convolution_fp32.h"
 #include "src/litert/kernel/cpu/fp32/convolution_1x1_fp32.h"
 #include "src/litert/kernel/cpu/fp32/convolution_winograd_fp32.h"
@@ -47,6 +51,28 @@ using mindspore::schema::PrimitiveType_Conv2DFusion;
 namespace mindspore::kernel {
 namespace {
 constexpr int kMaxDwConvSWSize = 32;
+constexpr int kMaxWinogradUnitNum = 4;
+constexpr int kTuneWarmUpNum = 1;
+constexpr int kTuneRunNum = 3;
+
+// return the least time of the runs in us, or -1 if the kernel fails.
+int64_t MeasureConvKernel(kernel::LiteKernel *kernel) {
+  if (kernel->Prepare() != RET_OK || kernel->ReSize() != RET_OK) {
+    return -1;
+  }
+  int64_t cost = -1;
+  for (int i = 0; i < kTuneWarmUpNum + kTuneRunNum; ++i) {
+    auto start = lite::GetTimeUs();
+    if (kernel->Run() != RET_OK) {
+      return -1;
+    }
+    auto time = static_cast<int64_t>(lite::GetTimeUs() - start);
+    if (i >= kTuneWarmUpNum && (cost < 0 || time < cost)) {
+      cost = time;
+    }
+  }
+  return cost;
+}
 }  // namespace
 
 float *ConvolutionDelegateCPUKernel::CopyData(const lite::Tensor *tensor) {
@@ -214,10 +240,154 @@ bool ConvolutionDelegateCPUKernel::CheckAvxUseSWConv(const ConvParameter *conv_p
   return false;
 }
 
+std::vector<ConvolutionDelegateCPUKernel::ConvAlgo> ConvolutionDelegateCPUKernel::GetConvAlgoCandidates(
+  const ConvParameter *conv_param) {
+  std::vector<ConvAlgo> candidates;
+  int output_units[kMaxWinogradUnitNum];
+  int unit_num = GetWinogradOutputUnits(conv_param, output_units, kMaxWinogradUnitNum);
+  for (int i = 0; i < unit_num; ++i) {
+    candidates.push_back({kConvAlgoWinograd, output_units[i]});
+  }
+  bool is_1x1 = conv_param->kernel_h_ == 1 && conv_param->kernel_w_ == 1;
+#ifdef ENABLE_AVX
+  // the sliding window of 1x1 is only valid for the conditions checked.
+  if (!is_1x1 || CheckAvxUseSWConv(conv_param)) {
+    candidates.push_back({kConvAlgoSlideWindow, 0});
+  }
+#endif
+  if (is_1x1) {
+    candidates.push_back({kConvAlgo1x1, 0});
+  }
+  candidates.push_back({kConvAlgoIm2Col, 0});
+  return candidates;
+}
+
+std::string ConvolutionDelegateCPUKernel::GetConvTuneKey(const ConvParameter *conv_param) const {
+  std::ostringstream key;
+  key << "conv2d_fp32_" << conv_param->input_batch_ << "x" << conv_param->input_h_ << "x" << conv_param->input_w_ << "x"
+      << conv_param->input_channel_ << "_o" << conv_param->output_channel_ << "_k" << conv_param->kernel_h_ << "x"
+      << conv_param->kernel_w_ << "_s" << conv_param->stride_h_ << "x" << conv_param->stride_w_ << "_d"
+      << conv_param->dilation_h_ << "x" << conv_param->dilation_w_ << "_p" << conv_param->pad_u_ << "x"
+      << conv_param->pad_d_ << "x" << conv_param->pad_l_ << "x" << conv_param->pad_r_ << "_a" << conv_param->act_type_
+      << "_t" << op_parameter_->thread_num_;
+  return key.str();
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CreateConvKernel(const ConvAlgo &algo, OpParameter *parameter,
+                                                                   const std::vector<lite::Tensor *> &inputs,
+                                                                   const std::vector<lite::Tensor *> &outputs,
+                                                                   float *weight) {
+  auto ctx = static_cast<const lite::InnerContext *>(this->ms_context_);
+  if (algo.type_ == kConvAlgoWinograd) {
+    return new (std::nothrow)
+      kernel::ConvolutionWinogradCPUKernel(parameter, inputs, outputs, ctx, algo.output_unit_, weight, origin_bias_);
+  }
+#ifdef ENABLE_AVX
+  if (algo.type_ == kConvAlgoSlideWindow) {
+    return new (std::nothrow) kernel::ConvolutionSWCPUKernel(parameter, inputs, outputs, ctx, weight, origin_bias_);
+  }
+#endif
+  if (algo.type_ == kConvAlgo1x1) {
+    return new (std::nothrow) kernel::Convolution1x1CPUKernel(parameter, inputs, outputs, ctx, weight, origin_bias_);
+  }
+  if (algo.type_ == kConvAlgoIm2Col) {
+    return new (std::nothrow) kernel::ConvolutionCPUKernel(parameter, inputs, outputs, ctx, weight, origin_bias_);
+  }
+  return nullptr;
+}
+
+int ConvolutionDelegateCPUKernel::TuneConvAlgo(const std::vector<ConvAlgo> &candidates, ConvAlgo *best) {
+  auto input = in_tensors_.at(kInputIndex);
+  auto weight = in_tensors_.at(kWeightIndex);
+  auto output = out_tensors_.at(kOutputIndex);
+  // the candidates run on the scratch tensors, so the tensors of the graph are untouched, and the packed weight of the
+  // candidates is never shared with the selected kernel by the pack weight manager.
+  lite::Tensor scratch_input(input->data_type(), input->shape(), input->format());
+  lite::Tensor scratch_weight(weight->data_type(), weight->shape(), weight->format());
+  lite::Tensor scratch_output(output->data_type(), output->shape(), output->format());
+  for (auto tensor : {&scratch_input, &scratch_weight, &scratch_output}) {
+    if (tensor->MallocData() != RET_OK) {
+      MS_LOG(ERROR) << "Malloc data of the scratch tensor failed.";
+      return RET_ERROR;
+    }
+    (void)memset(tensor->data(), 0, tensor->Size());
+  }
+  std::vector<lite::Tensor *> inputs = {&scratch_input, &scratch_weight};
+  if (in_tensors_.size() == kInputSize2) {
+    inputs.push_back(in_tensors_.at(kBiasIndex));
+  }
+  std::vector<lite::Tensor *> outputs = {&scratch_output};
+
+  int64_t best_cost = -1;
+  for (auto &algo : candidates) {
+    // each candidate owns a copy of the parameter, which the kernels modify when they are resized.
+    auto parameter = reinterpret_cast<OpParameter *>(malloc(sizeof(ConvParameter)));
+    if (parameter == nullptr) {
+      MS_LOG(ERROR) << "Malloc ConvParameter failed.";
+      return RET_ERROR;
+    }
+    (void)memcpy(parameter, op_parameter_, sizeof(ConvParameter));
+    auto kernel = CreateConvKernel(algo, parameter, inputs, outputs, reinterpret_cast<float *>(scratch_weight.data()));
+    if (kernel == nullptr) {
+      free(parameter);
+      continue;
+    }
+    kernel->set_name(name_ + "_tune");
+    auto cost = MeasureConvKernel(kernel);
+    delete kernel;
+    MS_LOG(INFO) << name_ << " conv algo " << algo.type_ << " output unit " << algo.output_unit_ << " costs " << cost
+                 << " us.";
+    if (cost >= 0 && (best_cost < 0 || cost < best_cost)) {
+      best_cost = cost;
+      *best = algo;
+    }
+  }
+  return best_cost < 0 ? RET_ERROR : RET_OK;
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32TunedKernelSelect() {
+  auto conv_param = reinterpret_cast<ConvParameter *>(op_parameter_);
+  if (origin_weight_ == nullptr || in_tensors_.at(kWeightIndex)->data_type() != kNumberTypeFloat32) {
+    return nullptr;
+  }
+  auto candidates = GetConvAlgoCandidates(conv_param);
+  if (candidates.size() <= 1) {
+    return nullptr;
+  }
+  auto is_candidate = [&candidates](const ConvAlgo &algo) {
+    return std::any_of(candidates.begin(), candidates.end(), [&algo](const ConvAlgo &candidate) {
+      return candidate.type_ == algo.type_ && candidate.output_unit_ == algo.output_unit_;
+    });
+  };
+  auto tune_cache = lite::KernelTuneCache::GetInstance();
+  auto key = GetConvTuneKey(conv_param);
+  std::string value;
+  ConvAlgo algo = {kConvAlgoIm2Col, 0};
+  char separator = 0;
+  bool cached = tune_cache->Find(key, &value) &&
+                static_cast<bool>(std::istringstream(value) >> algo.type_ >> separator >> algo.output_unit_) &&
+                is_candidate(algo);
+  if (!cached) {
+    if (TuneConvAlgo(candidates, &algo) != RET_OK) {
+      MS_LOG(WARNING) << "Tune conv " << name_ << " failed, select the kernel by the cost model.";
+      return nullptr;
+    }
+    tune_cache->Update(key, std::to_string(algo.type_) + "_" + std::to_string(algo.output_unit_));
+  }
+  return CreateConvKernel(algo, op_parameter_, in_tensors_, out_tensors_, origin_weight_);
+}
+
 kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32NHWCKernelSelect() {
   kernel::LiteKernel *kernel = nullptr;
   auto conv_param = reinterpret_cast<ConvParameter *>(op_parameter_);
 
+  if (lite::KernelTuneCache::GetInstance()->enable() && !op_parameter_->is_train_session_) {
+    kernel = CpuConvFp32TunedKernelSelect();
+    if (kernel != nullptr) {
+      return kernel;
+    }
+  }
+
   int out_unit;
   if (CheckIfUseWinograd(&out_unit, conv_param)) {
     kernel = new (std::nothrow) kernel::ConvolutionWinogradCPUKernel(
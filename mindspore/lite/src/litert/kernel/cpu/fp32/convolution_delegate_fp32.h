@@ -16,6 +16,7 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 
+#include <string>
 #include <vector>
 #include "src/litert/lite_kernel.h"
 #include "nnacl/conv_parameter.h"
@@ -85,6 +86,20 @@ class ConvolutionDelegateCPUKernel : public LiteKernel {
   kernel::LiteKernel *CpuConvFp32NC4KernelSelect();
   kernel::LiteKernel *CpuConvFp32NHWCKernelSelect();
   bool CheckAvxUseSWConv(const ConvParameter *conv_param);
+
+  // the implementations of conv, which are measured to select the fastest when the kernel tune is enabled.
+  enum ConvAlgoType { kConvAlgoIm2Col = 0, kConvAlgo1x1 = 1, kConvAlgoSlideWindow = 2, kConvAlgoWinograd = 3 };
+  struct ConvAlgo {
+    int type_;
+    int output_unit_;  // only valid for winograd
+  };
+  kernel::LiteKernel *CpuConvFp32TunedKernelSelect();
+  std::vector<ConvAlgo> GetConvAlgoCandidates(const ConvParameter *conv_param);
+  std::string GetConvTuneKey(const ConvParameter *conv_param) const;
+  int TuneConvAlgo(const std::vector<ConvAlgo> &candidates, ConvAlgo *best);
+  kernel::LiteKernel *CreateConvKernel(const ConvAlgo &algo, OpParameter *parameter,
+                                       const std::vector<lite::Tensor *> &inputs,
+                                       const std::vector<lite::Tensor *> &outputs, float *weight);
   // If inferShape process can't complete in Init part, initialization of weight and bis will be implemented in runtime
   // via Resize() API. However,data of const tensor(weight and bias) doesn't exist anymore in runtime stage.Thus,
   // copying data of const tensor is necessary. Otherwise, just pass origin raw pointer of data.
@@ -23,6 +23,14 @@
 #include "nnacl/intrinsics/ms_simd_cpu_info.h"
 #include "nnacl/fp32/matmul_fp32.h"
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_bf16.h"
+#endif
+
+#ifdef MSLITE_ENABLE_SPARSE_COMPUTE
+#include "src/litert/kernel/cpu/fp32_sparse/matmul_sparse_structured_fp32.h"
+#endif
+
 #if defined(ENABLE_AVX512)
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_avx512.h"
 #endif
@@ -49,6 +57,19 @@ class FullconnectionCPUKernel : public LiteKernel {
   FullconnectionCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
                           const std::vector<lite::Tensor *> &outputs, const mindspore::lite::InnerContext *ctx)
       : LiteKernel(parameter, inputs, outputs, ctx) {
+#ifdef MSLITE_ENABLE_SPARSE_COMPUTE
+    auto sparse_info = MatmulStructuredSparseCPUKernel::AnalyzeWeight(parameter, inputs, true);
+    if (sparse_info.format != kSparseWeightNone) {
+      matmul_base_ = new (std::nothrow) MatmulStructuredSparseCPUKernel(parameter, inputs, outputs, ctx, sparse_info);
+    }
+#endif
+
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+    if (matmul_base_ == nullptr && MatmulFp32BF16CPUKernel::IsSupported(parameter, inputs, ctx, true)) {
+      matmul_base_ = new (std::nothrow) MatmulFp32BF16CPUKernel(parameter, inputs, outputs, ctx);
+    }
+#endif
+
 #if defined(ENABLE_AVX512)
     if (matmul_base_ == nullptr) {
       AVX512_HARDWARE_SELF_AWARENESS_BEGIN
@@ -20,6 +20,14 @@
 #include <vector>
 #include "nnacl/matmul_parameter.h"
 #include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_bf16.h"
+#endif
+
+#ifdef MSLITE_ENABLE_SPARSE_COMPUTE
+#include "src/litert/kernel/cpu/fp32_sparse/matmul_sparse_structured_fp32.h"
+#endif
+
 #if defined(ENABLE_AVX512)
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_avx512.h"
 #endif
@@ -48,6 +56,22 @@ class MatmulCPUKernel : public LiteKernel {
   explicit MatmulCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
                            const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx)
       : LiteKernel(parameter, inputs, outputs, ctx) {
+#ifdef MSLITE_ENABLE_SPARSE_COMPUTE
+    auto sparse_info = MatmulStructuredSparseCPUKernel::AnalyzeWeight(
+      parameter, inputs, reinterpret_cast<MatMulParameter *>(parameter)->b_transpose_);
+    if (sparse_info.format != kSparseWeightNone) {
+      matmul_base_ = new (std::nothrow) MatmulStructuredSparseCPUKernel(parameter, inputs, outputs, ctx, sparse_info);
+    }
+#endif
+
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+    if (matmul_base_ == nullptr &&
+        MatmulFp32BF16CPUKernel::IsSupported(parameter, inputs, ctx,
+                                             reinterpret_cast<MatMulParameter *>(parameter)->b_transpose_)) {
+      matmul_base_ = new (std::nothrow) MatmulFp32BF16CPUKernel(parameter, inputs, outputs, ctx);
+    }
+#endif
+
 #if defined(ENABLE_AVX512)
     if (matmul_base_ == nullptr) {
       AVX512_HARDWARE_SELF_AWARENESS_BEGIN
@@ -69,7 +93,9 @@ class MatmulCPUKernel : public LiteKernel {
 #endif
 
 #if defined(ENABLE_ARM64)
-    matmul_base_ = new (std::nothrow) MatmulFp32ARM64CPUKernel(parameter, inputs, outputs, ctx);
+    if (matmul_base_ == nullptr) {
+      matmul_base_ = new (std::nothrow) MatmulFp32ARM64CPUKernel(parameter, inputs, outputs, ctx);
+    }
 #elif defined(ENABLE_ARM32)
     matmul_base_ = new (std::nothrow) MatmulFp32ARM32CPUKernel(parameter, inputs, outputs, ctx);
 #endif
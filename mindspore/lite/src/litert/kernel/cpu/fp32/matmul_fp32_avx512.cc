@@ -16,12 +16,26 @@
  */
 
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_avx512.h"
+#include <string>
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+#include "src/litert/jit_kernel_manager.h"
 #include "nnacl/fp32/matmul_avx512_fp32.h"
 #include "nnacl/fp32/matmul_fp32.h"
 #include "nnacl/fp32/pack_fp32.h"
+#include "nnacl/experimental/jit/gemm_avx512_jit.h"
 
 namespace mindspore::kernel {
+namespace {
+constexpr int kJitKUnroll = 4;
+
+std::string GetJitKernelKey(const JitGemmAvx512Param &param) {
+  return "gemm_avx512_" + std::to_string(param.row_block_) + "x" + std::to_string(param.col_block_ * C16NUM) + "_d" +
+         std::to_string(param.depth_) + "_s" + std::to_string(param.src_stride_) + "_" +
+         std::to_string(param.dst_stride_) + "_a" + std::to_string(param.act_flag_) + "_b" +
+         std::to_string(param.has_bias_) + "_u" + std::to_string(param.k_unroll_);
+}
+}  // namespace
+
 void MatmulFp32AVX512CPUKernel::InitGlobalVariable() {
   matrix_a_.need_pack = true;
   matrix_b_.need_pack = true;
@@ -34,6 +48,45 @@ void MatmulFp32AVX512CPUKernel::InitGlobalVariable() {
   out_need_aligned_ = true;
 }
 
+// the jit kernels compute the whole depth at once, so they replace the static kernels only when the depth is not
+// blocked.
+int MatmulFp32AVX512CPUKernel::InitJitKernel() {
+  has_jit_kernel_ = false;
+  auto jit_manager = lite::JitKernelManager::GetInstance();
+  if (!jit_manager->enable() || params_->deep_ > C1500NUM) {
+    return RET_OK;
+  }
+  int act_flag = 0;
+  if (params_->act_type_ == ActType_Relu6) {
+    act_flag += 1;
+  }
+  if (params_->act_type_ == ActType_Relu || params_->act_type_ == ActType_Relu6) {
+    act_flag += C2NUM;
+  }
+  int max_shape[C4NUM] = {C12NUM, C12NUM, C8NUM, C6NUM};
+  for (int col_block = 1; col_block <= C4NUM; ++col_block) {
+    for (int row_block = 1; row_block <= max_shape[col_block - 1]; ++row_block) {
+      JitGemmAvx512Param param = {row_block, col_block, params_->deep_, params_->deep_, params_->col_align_, act_flag,
+                                  matrix_c_.pack_ptr != nullptr, kJitKUnroll};
+      auto emit_func = [&param](uint8_t *code, size_t capacity) { return JitGemmAvx512Emit(&param, code, capacity); };
+      auto kernel = jit_manager->GetKernel(GetJitKernelKey(param), JIT_GEMM_AVX512_MAX_CODE_SIZE, emit_func);
+      jit_kernel_[col_block - 1][row_block] = reinterpret_cast<GemmAvx512Kernel>(kernel);
+      has_jit_kernel_ = has_jit_kernel_ || kernel != nullptr;
+    }
+  }
+  return RET_OK;
+}
+
+void MatmulFp32AVX512CPUKernel::RunMatMul(const float *a, const float *b, float *c, const float *bias, int cur_col,
+                                          int row) const {
+  if (has_jit_kernel_) {
+    MatMulAvx512JitFp32(a, b, c, bias, params_->act_type_, params_->deep_, cur_col, params_->col_align_, row,
+                        jit_kernel_);
+  } else {
+    MatMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, cur_col, params_->col_align_, row);
+  }
+}
+
 int MatmulFp32AVX512CPUKernel::PackMatrixAImplOpt() {
   MS_LOG(ERROR) << "Matmul: don't support optimized-packing, only support single-thread currently.";
   return RET_ERROR;
@@ -54,8 +107,7 @@ int MatmulFp32AVX512CPUKernel::ParallelRunByBatch(int task_id) const {
 
     auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr;
     if (func_flag == 0) {
-      MatMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, col_step_, params_->col_align_,
-                       params_->row_);
+      RunMatMul(a, b, c, bias, col_step_, params_->row_);
     } else if (func_flag == C1NUM) {
       MatVecMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, col_step_, params_->col_align_);
     } else {
@@ -84,8 +136,7 @@ int MatmulFp32AVX512CPUKernel::ParallelRunByRow(int task_id) const {
     }
     gemmIsNotPackFun(input, matrix_b_.pack_ptr, output, &bias, row_num, params_->deep_, params_->act_type_);
   } else {
-    MatMulAvx512Fp32(input, matrix_b_.pack_ptr, output, matrix_c_.pack_ptr, params_->act_type_, params_->deep_,
-                     params_->col_align_, params_->col_align_, row_num);
+    RunMatMul(input, matrix_b_.pack_ptr, output, matrix_c_.pack_ptr, params_->col_align_, row_num);
   }
   return RET_OK;
 }
@@ -111,8 +162,7 @@ int MatmulFp32AVX512CPUKernel::ParallelRunByOC(int task_id) const {
     auto c = output_data_ + i * params_->row_ * col_step_ + start_oc;
     auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr + start_oc;
     if (func_flag == 0) {
-      MatMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, compute_oc, params_->col_align_,
-                       params_->row_);
+      RunMatMul(a, b, c, bias, compute_oc, params_->row_);
     } else if (func_flag == C1NUM) {
       MatVecMulAvx512Fp32(a, b, c, bias, params_->act_type_, params_->deep_, compute_oc, params_->col_align_);
     } else {
@@ -20,6 +20,7 @@
 #ifdef ENABLE_AVX512
 #include <vector>
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+#include "nnacl/fp32/matmul_avx512_fp32.h"
 namespace mindspore::kernel {
 class MatmulFp32AVX512CPUKernel : public MatmulFp32BaseCPUKernel {
  public:
@@ -35,6 +36,14 @@ class MatmulFp32AVX512CPUKernel : public MatmulFp32BaseCPUKernel {
   int ParallelRunByOC(int task_id) const override;
   bool CheckThreadCuttingByRow() override;
   bool SupportMulBatchCuttingByRow() { return true; }
+  int InitJitKernel() override;
+
+ private:
+  void RunMatMul(const float *a, const float *b, float *c, const float *bias, int cur_col, int row) const;
+
+  // the kernels generated for the depth, the strides, the act_type and the bias, indexed as the HPC-generator ones.
+  GemmAvx512Kernel jit_kernel_[C4NUM][C13NUM] = {};
+  bool has_jit_kernel_ = false;
 };
 }  // namespace mindspore::kernel
 #endif
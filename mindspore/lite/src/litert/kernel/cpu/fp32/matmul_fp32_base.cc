@@ -17,6 +17,7 @@
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
 #include <algorithm>
 #include "nnacl/fp32/matmul_fp32.h"
+#include "nnacl/fp32/matmul_epilogue_fp32.h"
 #include "nnacl/fp32/pack_fp32.h"
 #include "nnacl/fp32/pack_fp32_opt.h"
 
@@ -37,6 +38,11 @@ int MatmulRun(void *cdata, int task_id, float, float) {
     MS_LOG(ERROR) << "MatmulRun error task_id[" << task_id << "] error_code[" << error_code << "]";
     return RET_ERROR;
   }
+  error_code = op->RunEpilogue(task_id);
+  if (error_code != RET_OK) {
+    MS_LOG(ERROR) << "MatmulRun epilogue error task_id[" << task_id << "] error_code[" << error_code << "]";
+    return RET_ERROR;
+  }
   return RET_OK;
 }
 
@@ -258,7 +264,7 @@ void MatmulFp32BaseCPUKernel::FreePackedMatrixB() {
 }
 
 int MatmulFp32BaseCPUKernel::PackBiasMatrix() {
-  if (in_tensors_.size() != FOURTH_INPUT) {
+  if (MatmulInputNum() != FOURTH_INPUT) {
     return RET_OK;
   }
   if (matrix_c_.has_packed) {
@@ -319,7 +325,7 @@ int MatmulFp32BaseCPUKernel::Prepare() {
                     "matrix-a's data type is invalid.");
   MS_CHECK_TRUE_MSG(in_tensors_[SECOND_INPUT]->data_type() == kNumberTypeFloat32, RET_ERROR,
                     "matrix-b's data type is invalid.");
-  if (in_tensors_.size() == FOURTH_INPUT) {
+  if (MatmulInputNum() == FOURTH_INPUT) {
     MS_CHECK_TRUE_MSG(in_tensors_[THIRD_INPUT]->IsConst(), RET_ERROR, "matrix-c must be const when existing.");
     MS_CHECK_TRUE_MSG(in_tensors_[THIRD_INPUT]->data_type() == kNumberTypeFloat32, RET_ERROR,
                       "matrix-c's data type is invalid.");
@@ -342,7 +348,7 @@ int MatmulFp32BaseCPUKernel::Prepare() {
     matrix_b_.has_packed = true;
   }
   if (!InferShapeDone()) {
-    if (in_tensors_.size() == FOURTH_INPUT && !op_parameter_->is_train_session_) {
+    if (MatmulInputNum() == FOURTH_INPUT && !op_parameter_->is_train_session_) {
       ret = BackupConstMatrix(&matrix_c_, THIRD_INPUT);
       MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "backup matrix-c failed.");
     }
@@ -442,6 +448,8 @@ int MatmulFp32BaseCPUKernel::MatmulPrepare() {
 int MatmulFp32BaseCPUKernel::ReSize() {
   auto ret = InitParameter();
   MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "Init parameters failed.");
+  ret = CheckEpilogue();
+  MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "the fused epilogue doesn't support the shapes.");
   if (op_parameter_->is_train_session_) {
     set_workspace_size((matrix_a_.pack_size + matrix_b_.pack_size) * static_cast<int>(sizeof(float)));
   }
@@ -460,7 +468,7 @@ int MatmulFp32BaseCPUKernel::ReSize() {
     MS_LOG(ERROR) << "InitTmpOutBuffer error!";
     return ret;
   }
-  return RET_OK;
+  return InitJitKernel();
 }
 
 int MatmulFp32BaseCPUKernel::InitBroadcastParams() {
@@ -586,7 +594,7 @@ int MatmulFp32BaseCPUKernel::InitParameter() {
   MS_CHECK_INT_MUL_NOT_OVERFLOW(a_batch_, params_->col_align_, RET_ERROR);
   MS_CHECK_INT_MUL_NOT_OVERFLOW(a_batch_ * params_->col_align_, params_->deep_, RET_ERROR);
   auto a_pack_size = a_batch_ * params_->row_align_ * params_->deep_;
-  auto b_pack_size = b_batch_ * params_->col_align_ * params_->deep_;
+  auto b_pack_size = b_batch_ * GetMatrixBBatchPackSize();
   if ((matrix_a_.has_packed && matrix_a_.pack_size != a_pack_size) ||
       (matrix_b_.has_packed && matrix_b_.pack_size != b_pack_size)) {
     MS_LOG(ERROR) << "matmul don't support dynamic packing if matrix is a constant.";
@@ -676,6 +684,68 @@ void MatmulFp32BaseCPUKernel::GetThreadCuttingInfoByRow() {
   thread_count_ = split_points_.size();
 }
 
+size_t MatmulFp32BaseCPUKernel::MatmulInputNum() const {
+  return in_tensors_.size() - static_cast<size_t>(MatmulEpilogueOperandNum(&params_->epilogue_));
+}
+
+int MatmulFp32BaseCPUKernel::CheckEpilogue() const {
+  auto &epilogue = params_->epilogue_;
+  MS_CHECK_TRUE_RET(epilogue.op_num_ >= 0 && epilogue.op_num_ <= MAX_EPILOGUE_OP_NUM, RET_ERROR);
+  int64_t out_num = static_cast<int64_t>(params_->batch) * params_->row_ * params_->col_;
+  for (int i = 0; i < epilogue.op_num_; ++i) {
+    auto &op = epilogue.ops_[i];
+    if (!MatmulEpilogueHasOperand(op.type_)) {
+      continue;
+    }
+    MS_CHECK_TRUE_RET(op.input_index_ >= 0 && op.input_index_ < static_cast<int>(in_tensors_.size()), RET_ERROR);
+    auto operand = in_tensors_[op.input_index_];
+    MS_CHECK_TRUE_RET(operand != nullptr && operand->data_type() == kNumberTypeFloat32, RET_ERROR);
+    auto operand_num = static_cast<int64_t>(operand->ElementsNum());
+    if (op.broadcast_ == EpilogueBroadcast_None) {
+      MS_CHECK_TRUE_RET(operand_num == out_num, RET_ERROR);
+    } else if (op.broadcast_ == EpilogueBroadcast_Col) {
+      MS_CHECK_TRUE_RET(operand_num == params_->col_ && operand->shape().back() == params_->col_, RET_ERROR);
+    } else {
+      MS_CHECK_TRUE_RET(operand_num == 1, RET_ERROR);
+    }
+  }
+  return RET_OK;
+}
+
+// the output part of the task is decided by the thread cutting policy, the same as the parallel run functions.
+int MatmulFp32BaseCPUKernel::RunEpilogue(int task_id) const {
+  if (params_->epilogue_.op_num_ == 0) {
+    return RET_OK;
+  }
+  int total_row = params_->batch * params_->row_;
+  int row_start = 0;
+  int row_end = total_row;
+  int col_start = 0;
+  int col_end = params_->col_;
+  int dst_stride = col_step_;
+  if (parallel_fun_ == &MatmulFp32BaseCPUKernel::ParallelRunByBatch ||
+      parallel_fun_ == &MatmulFp32BaseCPUKernel::ParallelRunIsNotPackByBatch) {
+    row_start = task_id * batch_stride_ * params_->row_;
+    row_end = MSMIN(total_row, row_start + batch_stride_ * params_->row_);
+    if (parallel_fun_ == &MatmulFp32BaseCPUKernel::ParallelRunIsNotPackByBatch) {
+      dst_stride = params_->col_;
+    }
+  } else if (parallel_fun_ == &MatmulFp32BaseCPUKernel::ParallelRunByRow) {
+    row_start = split_points_[task_id];
+    row_end = task_id < (thread_count_ - 1) ? split_points_[task_id + 1] : row_num_;
+  } else {
+    col_start = split_points_[task_id];
+    col_end = MSMIN(params_->col_, task_id < (thread_count_ - 1) ? split_points_[task_id + 1] : col_step_);
+  }
+  if (row_start >= row_end || col_start >= col_end) {
+    return RET_OK;
+  }
+  auto ret = MatmulEpilogueFp32(&params_->epilogue_, epilogue_data_, output_data_ + row_start * dst_stride + col_start,
+                                dst_stride, row_start, row_end - row_start, col_start, col_end - col_start,
+                                params_->col_);
+  return ret == NNACL_OK ? RET_OK : RET_ERROR;
+}
+
 int MatmulFp32BaseCPUKernel::Run() {
   auto out_data = reinterpret_cast<float *>(out_tensors_.front()->data());
   CHECK_NULL_RETURN(out_data);
@@ -692,6 +762,12 @@ int MatmulFp32BaseCPUKernel::Run() {
   }
   MS_CHECK_TRUE_MSG(matrix_a_.pack_ptr != nullptr, RET_ERROR, "matrix-a pack ptr is a nullptr.");
   MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+  for (int i = 0; i < params_->epilogue_.op_num_; ++i) {
+    auto &op = params_->epilogue_.ops_[i];
+    epilogue_data_[i] = MatmulEpilogueHasOperand(op.type_)
+                          ? reinterpret_cast<const float *>(in_tensors_[op.input_index_]->data())
+                          : nullptr;
+  }
 
   auto ret = ParallelLaunch(this->ms_context_, MatmulRun, this, thread_count_);
   if (ret != RET_OK) {
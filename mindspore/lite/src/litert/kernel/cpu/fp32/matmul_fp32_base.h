@@ -48,6 +48,8 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   int FullConnectionReSize();
   int MatmulReSize();
   int Run() override;
+  // run the fused elementwise epilogue on the output part of the task, right after the task computes it.
+  int RunEpilogue(int task_id) const;
 
   using ParallelRun = int (MatmulFp32BaseCPUKernel::*)(int task_id) const;
   ParallelRun parallel_fun_ = nullptr;
@@ -71,10 +73,14 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   int PackMatrixA();
   int PackMatrixB();
   int PackMatrixAImpl();
-  int PackMatrixBImpl();
+  virtual int PackMatrixBImpl();
   virtual int PackMatrixAImplOpt();
+  // the float number of the packed matrix-b of one batch.
+  virtual int GetMatrixBBatchPackSize() const { return params_->col_align_ * params_->deep_; }
   bool CheckRow1OptimalConditions();
   virtual bool SupportMulBatchCuttingByRow() { return false; }
+  // generate the kernels specialized for the shapes after resized, the static kernels are used when not generated.
+  virtual int InitJitKernel() { return RET_OK; }
   int PackBiasMatrix();
   void FreePackedMatrixA();
   void FreePackedMatrixB();
@@ -86,6 +92,9 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   void InitShapeA();
   void InitShapeB();
   int InitBroadcastParams();
+  // the number of the matmul inputs, the operands of the epilogue are after them.
+  size_t MatmulInputNum() const;
+  int CheckEpilogue() const;
 
  protected:
   MatMulParameter *params_ = nullptr;
@@ -112,6 +121,7 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   bool pack_opt_{false};  // indicate whether packing can be multi-threads, currently, only support in ARM64 && packA.
   MatrixPackFun matrix_a_pack_fun_ = nullptr;
   MatrixPackFun matrix_b_pack_fun_ = nullptr;
+  const float *epilogue_data_[MAX_EPILOGUE_OP_NUM] = {};
 };
 }  // namespace mindspore::kernel
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BASE_H_
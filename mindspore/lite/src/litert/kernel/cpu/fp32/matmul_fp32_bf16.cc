@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_bf16.h"
+#include "src/litert/cpu_info.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#include "nnacl/fp32/matmul_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+
+namespace mindspore::kernel {
+namespace {
+#if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && !defined(MACHINE_LINUX_ARM64)
+#define ENABLE_MATMUL_BF16_BFMMLA
+#endif
+#ifdef ENABLE_AVX512
+constexpr int kBf16ColTile = MATMUL_BF16_AVX512_COL_TILE;
+constexpr int kBf16DeepTile = MATMUL_BF16_AVX512_DEEP_TILE;
+constexpr int kBf16ColMinUnit = C32NUM;
+#else
+constexpr int kBf16ColTile = MATMUL_BF16_BFMMLA_COL_TILE;
+constexpr int kBf16DeepTile = MATMUL_BF16_BFMMLA_DEEP_TILE;
+constexpr int kBf16ColMinUnit = C16NUM;
+#endif
+}  // namespace
+
+bool MatmulFp32BF16CPUKernel::IsSupported(const OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                                          const mindspore::lite::InnerContext *ctx, bool b_transpose) {
+  if (parameter == nullptr || ctx == nullptr || parameter->is_train_session_ || !ctx->IsCpuBFloat16Enabled()) {
+    return false;
+  }
+  if (inputs.size() < C2NUM || inputs[SECOND_INPUT] == nullptr || !inputs[SECOND_INPUT]->IsConst() ||
+      inputs[SECOND_INPUT]->data_type() != kNumberTypeFloat32) {
+    return false;
+  }
+  auto b_shape = inputs[SECOND_INPUT]->shape();
+  if (b_shape.size() < C2NUM) {
+    return false;
+  }
+  auto col = b_transpose ? b_shape[b_shape.size() - C2NUM] : b_shape.back();
+  if (col <= 1) {
+    return false;
+  }
+#if defined(ENABLE_AVX512)
+  return X86_Avx512Bf16_Support();
+#elif defined(ENABLE_MATMUL_BF16_BFMMLA)
+  return lite::CpuInfo().ArmIsSupportBf16();
+#else
+  return false;
+#endif
+}
+
+void MatmulFp32BF16CPUKernel::InitGlobalVariable() {
+  matrix_a_.need_pack = params_->a_transpose_;
+  matrix_b_.need_pack = true;
+  matrix_a_pack_fun_ = params_->a_transpose_ ? RowMajor2ColMajor : RowMajor2RowMajor;
+  row_tile_ = C1NUM;
+  col_tile_ = kBf16ColTile;
+  col_min_unit_ = kBf16ColMinUnit;
+  out_need_aligned_ = false;
+#if defined(ENABLE_AVX512)
+  matmul_bf16_fun_ = MatMulBf16Avx512Fp32;
+#elif defined(ENABLE_MATMUL_BF16_BFMMLA)
+  matmul_bf16_fun_ = MatMulBf16BfmmlaFp32;
+#endif
+}
+
+int MatmulFp32BF16CPUKernel::GetMatrixBBatchPackSize() const {
+  // two bfloat16 elements take the room of one float.
+  return UP_DIV(MatmulBf16PackedSize(params_->deep_, params_->col_, kBf16ColTile, kBf16DeepTile), C2NUM);
+}
+
+int MatmulFp32BF16CPUKernel::PackMatrixBImpl() {
+  auto src_ptr =
+    matrix_b_.has_origin ? matrix_b_.origin_ptr : reinterpret_cast<float *>(in_tensors_[SECOND_INPUT]->data());
+  MS_CHECK_TRUE_MSG(src_ptr != nullptr, RET_ERROR, "matrix-b source ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+  auto dst_ptr = reinterpret_cast<uint16_t *>(matrix_b_.pack_ptr);
+  int batch_pack_size = GetMatrixBBatchPackSize() * C2NUM;
+  for (int i = 0; i < b_batch_; i++) {
+    PackMatrixBToBf16(src_ptr + i * params_->deep_ * params_->col_, dst_ptr + i * batch_pack_size, params_->deep_,
+                      params_->col_, params_->b_transpose_, kBf16ColTile, kBf16DeepTile);
+  }
+  return RET_OK;
+}
+
+int MatmulFp32BF16CPUKernel::ParallelRunByBatch(int task_id) const {
+  MS_CHECK_TRUE_MSG(matmul_bf16_fun_ != nullptr, RET_ERROR, "matmul bf16 func is a nullptr.");
+  int start_batch = task_id * batch_stride_;
+  int end_batch = MSMIN(params_->batch, start_batch + batch_stride_);
+  auto b_ptr = reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr);
+  int batch_pack_size = GetMatrixBBatchPackSize() * C2NUM;
+  for (int index = start_batch; index < end_batch; ++index) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[index] * params_->row_align_ * params_->deep_;
+    const uint16_t *b = b_ptr + b_offset_[index] * batch_pack_size;
+    float *c = output_data_ + index * params_->row_ * col_step_;
+    matmul_bf16_fun_(a, b, c, matrix_c_.pack_ptr, params_->act_type_, params_->deep_, params_->row_, params_->col_,
+                     col_step_);
+  }
+  return RET_OK;
+}
+
+int MatmulFp32BF16CPUKernel::ParallelRunByRow(int task_id) const {
+  MS_CHECK_TRUE_MSG(matmul_bf16_fun_ != nullptr, RET_ERROR, "matmul bf16 func is a nullptr.");
+  int start_row = split_points_[task_id];
+  int end_row = row_num_;
+  if (task_id < (thread_count_ - 1)) {
+    end_row = split_points_[task_id + 1];
+  }
+  int row_num = end_row - start_row;
+  if (row_num <= 0) {
+    return RET_OK;
+  }
+  const float *input = matrix_a_.pack_ptr + start_row * params_->deep_;
+  float *output = output_data_ + start_row * col_step_;
+  matmul_bf16_fun_(input, reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr), output, matrix_c_.pack_ptr,
+                   params_->act_type_, params_->deep_, row_num, params_->col_, col_step_);
+  return RET_OK;
+}
+
+int MatmulFp32BF16CPUKernel::ParallelRunByOC(int task_id) const {
+  MS_CHECK_TRUE_MSG(matmul_bf16_fun_ != nullptr, RET_ERROR, "matmul bf16 func is a nullptr.");
+  int start_oc = split_points_[task_id];
+  int end_oc = col_step_;
+  if (task_id < (thread_count_ - 1)) {
+    end_oc = split_points_[task_id + 1];
+  }
+  int compute_oc = end_oc - start_oc;
+  if (compute_oc <= 0) {
+    return RET_OK;
+  }
+  auto b_ptr = reinterpret_cast<const uint16_t *>(matrix_b_.pack_ptr);
+  int batch_pack_size = GetMatrixBBatchPackSize() * C2NUM;
+  // the start of output-channel is aligned to the col-tile, so the packed blocks before it are all complete.
+  int deep_align = UP_ROUND(params_->deep_, kBf16DeepTile);
+  for (int i = 0; i < params_->batch; ++i) {
+    auto a = matrix_a_.pack_ptr + a_offset_[i] * params_->row_align_ * params_->deep_;
+    auto b = b_ptr + b_offset_[i] * batch_pack_size + start_oc * deep_align;
+    auto c = output_data_ + i * params_->row_ * col_step_ + start_oc;
+    auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr + start_oc;
+    matmul_bf16_fun_(a, b, c, bias, params_->act_type_, params_->deep_, params_->row_, compute_oc, col_step_);
+  }
+  return RET_OK;
+}
+
+bool MatmulFp32BF16CPUKernel::CheckThreadCuttingByRow() {
+  if (b_batch_ != C1NUM) {
+    return false;
+  }
+  if (row_num_ < op_parameter_->thread_num_) {
+    return false;
+  }
+  row_min_unit_ = C4NUM;
+  return MSMIN(row_num_ / row_min_unit_, op_parameter_->thread_num_) >
+         MSMIN(col_step_ / col_min_unit_, op_parameter_->thread_num_);
+}
+}  // namespace mindspore::kernel
+#endif
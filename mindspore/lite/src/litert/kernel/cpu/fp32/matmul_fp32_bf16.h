@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
+
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+#include <vector>
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+namespace mindspore::kernel {
+using MatmulBf16Fun = void (*)(const float *a, const uint16_t *b, float *c, const float *bias, int act_type, int deep,
+                               int row, int col, int stride);
+
+// The constant matrix-b is stored in bfloat16, and the products are accumulated in fp32 by the bf16 dot-product
+// instructions, AVX512_BF16 on x86 and BFMMLA on ARMv8.6.
+class MatmulFp32BF16CPUKernel : public MatmulFp32BaseCPUKernel {
+ public:
+  MatmulFp32BF16CPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                          const std::vector<lite::Tensor *> &outputs, const mindspore::lite::InnerContext *ctx)
+      : MatmulFp32BaseCPUKernel(parameter, inputs, outputs, ctx) {}
+  ~MatmulFp32BF16CPUKernel() = default;
+
+  // Only the constant matrix-b is supported, which is packed only once, and the precision mode must be bf16.
+  static bool IsSupported(const OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                          const mindspore::lite::InnerContext *ctx, bool b_transpose);
+
+  void InitGlobalVariable() override;
+  int PackMatrixBImpl() override;
+  int GetMatrixBBatchPackSize() const override;
+  int ParallelRunByBatch(int task_id) const override;
+  int ParallelRunByRow(int task_id) const override;
+  int ParallelRunByOC(int task_id) const override;
+  bool CheckThreadCuttingByRow() override;
+  bool SupportMulBatchCuttingByRow() override { return true; }
+
+ private:
+  MatmulBf16Fun matmul_bf16_fun_ = nullptr;
+};
+}  // namespace mindspore::kernel
+#endif
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BF16_H_
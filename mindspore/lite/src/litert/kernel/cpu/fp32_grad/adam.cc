@@ -42,8 +42,8 @@ constexpr static int kGradientIdx = 9;
 
 int AdamCPUKernel::ReSize() { return RET_OK; }
 
-int AdamCPUKernel::DoExecute(int task_id) {
-  CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_10D);
+int AdamCPUKernel::DoAdamUpdate(const float *gradient, int start, int end) {
+  CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_10D - 1);
   auto weight = reinterpret_cast<float *>(in_tensors_.at(kWeightIdx)->MutableData());
   auto m = reinterpret_cast<float *>(in_tensors_.at(kMomentVector1stIdx)->MutableData());
   auto v = reinterpret_cast<float *>(in_tensors_.at(kMomentVector2stIdx)->MutableData());
@@ -53,20 +53,32 @@ int AdamCPUKernel::DoExecute(int task_id) {
   auto beta1 = reinterpret_cast<float *>(in_tensors_.at(kBeta1Idx)->MutableData())[0];
   auto beta2 = reinterpret_cast<float *>(in_tensors_.at(kBeta2Idx)->MutableData())[0];
   auto eps = reinterpret_cast<float *>(in_tensors_.at(kEpsilonIdx)->MutableData())[0];
-  auto gradient = reinterpret_cast<float *>(in_tensors_.at(kGradientIdx)->MutableData());
-  int length = in_tensors_.at(kWeightIdx)->ElementsNum();
   CHECK_NULL_RETURN(weight);
   CHECK_NULL_RETURN(m);
   CHECK_NULL_RETURN(v);
   CHECK_NULL_RETURN(gradient);
+  return DoAdam(m, v, gradient, weight, beta1, beta2, beta1_power, beta2_power, eps, learning_rate,
+                adam_param_->use_nesterov_, start, end);
+}
+
+int AdamCPUKernel::DoExecute(int task_id) {
+  CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_10D);
+  auto gradient = reinterpret_cast<float *>(in_tensors_.at(kGradientIdx)->MutableData());
+  int length = in_tensors_.at(kWeightIdx)->ElementsNum();
 
   int stride = UP_DIV(length, thread_count_);
   int count = MSMIN(stride, length - stride * task_id);
   int start = stride * task_id;
   int end = start + count;
+  return DoAdamUpdate(gradient, start, end);
+}
 
-  return DoAdam(m, v, gradient, weight, beta1, beta2, beta1_power, beta2_power, eps, learning_rate,
-                adam_param_->use_nesterov_, start, end);
+int AdamCPUKernel::UpdateWeight(int start, int end) {
+  if (get_optimizer_mode() != WeightUpdateMode::NORMAL) {
+    return AccumulateGrads(start, end);
+  }
+  CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_10D);
+  return DoAdamUpdate(reinterpret_cast<float *>(in_tensors_.at(kGradientIdx)->MutableData()), start, end);
 }
 
 int AdamRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
@@ -114,26 +126,11 @@ std::vector<int> AdamCPUKernel::GetOptimizerParamsIdxs() const {
 
 int AdamCPUKernel::OptimizerStep() {
   CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_10D - 1);
-  auto weight = reinterpret_cast<float *>(in_tensors_.at(kWeightIdx)->MutableData());
-  auto m = reinterpret_cast<float *>(in_tensors_.at(kMomentVector1stIdx)->MutableData());
-  auto v = reinterpret_cast<float *>(in_tensors_.at(kMomentVector2stIdx)->MutableData());
-  auto beta1_power = reinterpret_cast<float *>(in_tensors_.at(kBeta1PowerIdx)->MutableData());
-  auto beta2_power = reinterpret_cast<float *>(in_tensors_.at(kBeta2PowerIdx)->MutableData());
-  auto learning_rate = lr_;
-  auto beta1 = reinterpret_cast<float *>(in_tensors_.at(kBeta1Idx)->MutableData())[0];
-  auto beta2 = reinterpret_cast<float *>(in_tensors_.at(kBeta2Idx)->MutableData())[0];
-  auto eps = reinterpret_cast<float *>(in_tensors_.at(kEpsilonIdx)->MutableData())[0];
   size_t length = in_tensors_.at(kWeightIdx)->ElementsNum();
-  CHECK_NULL_RETURN(weight);
-  CHECK_NULL_RETURN(m);
-  CHECK_NULL_RETURN(v);
 
   int ret = RET_OK;
   if (grad_sum_ != nullptr && valid_grad_sum_) {
-    size_t start = 0;
-    size_t end = length;
-    ret = DoAdam(m, v, grad_sum_, weight, beta1, beta2, beta1_power, beta2_power, eps, learning_rate,
-                 adam_param_->use_nesterov_, start, end);
+    ret = DoAdamUpdate(grad_sum_, 0, static_cast<int>(length));
     std::fill(grad_sum_, grad_sum_ + length, 0);
     OptimizerKernel::OptimizerStep();
   }
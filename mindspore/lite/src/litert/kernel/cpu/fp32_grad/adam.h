@@ -41,8 +41,11 @@ class AdamCPUKernel : public OptimizerKernel {
   int DoExecute(int task_id);
   int OptimizerStep() override;
   std::vector<int> GetOptimizerParamsIdxs() const override;
+  bool SupportFusedUpdate() const override { return true; }
+  int UpdateWeight(int start, int end) override;
 
  private:
+  int DoAdamUpdate(const float *gradient, int start, int end);
   int thread_count_;
   AdamParameter *adam_param_;
 };
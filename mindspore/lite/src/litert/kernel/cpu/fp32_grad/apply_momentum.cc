@@ -45,7 +45,7 @@ static int DoApplyMomentum(float *weight, float *accumulate, float learning_rate
   return RET_OK;
 }
 
-int ApplyMomentumCPUKernel::DoExecute(int task_id) {
+int ApplyMomentumCPUKernel::DoMomentumUpdate(int start, int end) {
   CHECK_LESS_RETURN(in_tensors_.size(), DIMENSION_5D);
   auto weight = reinterpret_cast<float *>(in_tensors_.at(FIRST_INPUT)->data());
   CHECK_NULL_RETURN(weight);
@@ -56,18 +56,26 @@ int ApplyMomentumCPUKernel::DoExecute(int task_id) {
   CHECK_NULL_RETURN(gradient);
   CHECK_NULL_RETURN(in_tensors_.at(FIFTH_INPUT)->data());
   float moment = reinterpret_cast<float *>(in_tensors_.at(FIFTH_INPUT)->data())[0];
-  int length = in_tensors_.at(FIRST_INPUT)->ElementsNum();
+  DoApplyMomentum(weight, accumulate, learning_rate, gradient, moment, apply_momentum_param_->use_nesterov_, start,
+                  end);
+  return RET_OK;
+}
 
+int ApplyMomentumCPUKernel::DoExecute(int task_id) {
+  int length = in_tensors_.at(FIRST_INPUT)->ElementsNum();
   MS_CHECK_TRUE_RET(thread_count_ > 0, RET_ERROR);
   int stride = UP_DIV(length, thread_count_);
   int count = MSMIN(stride, length - stride * task_id);
   count = (count < 0) ? 0 : count;
   int start = stride * task_id;
-  int end = start + count;
+  return DoMomentumUpdate(start, start + count);
+}
 
-  DoApplyMomentum(weight, accumulate, learning_rate, gradient, moment, apply_momentum_param_->use_nesterov_, start,
-                  end);
-  return RET_OK;
+int ApplyMomentumCPUKernel::UpdateWeight(int start, int end) {
+  if (get_optimizer_mode() != WeightUpdateMode::NORMAL) {
+    return AccumulateGrads(start, end);
+  }
+  return DoMomentumUpdate(start, end);
 }
 
 int ApplyMomentumRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
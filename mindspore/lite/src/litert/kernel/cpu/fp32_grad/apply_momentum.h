@@ -43,8 +43,11 @@ class ApplyMomentumCPUKernel : public OptimizerKernel {
   int Run() override;
   int OptimizerStep() override;
   std::vector<int> GetOptimizerParamsIdxs() const override;
+  bool SupportFusedUpdate() const override { return true; }
+  int UpdateWeight(int start, int end) override;
 
  private:
+  int DoMomentumUpdate(int start, int end);
   int thread_count_;
   ApplyMomentumParameter *apply_momentum_param_;
 };
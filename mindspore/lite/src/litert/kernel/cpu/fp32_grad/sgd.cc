@@ -83,7 +83,7 @@ int DoSgdInit(float *weight, float *accumulate, float *gradient, float learning_
   return RET_OK;
 }
 
-int SgdCPUKernel::DoExecute(int task_id) {
+int SgdCPUKernel::DoSgdUpdate(int start, int end, bool init) {
   auto weight = reinterpret_cast<float *>(in_tensors_.at(0)->MutableData());
   CHECK_NULL_RETURN(weight);
   auto accumulate = reinterpret_cast<float *>(in_tensors_.at(3)->MutableData());
@@ -93,17 +93,49 @@ int SgdCPUKernel::DoExecute(int task_id) {
   CHECK_NULL_RETURN(gradient);
   CHECK_NULL_RETURN(in_tensors_.at(4)->MutableData());
   float moment = reinterpret_cast<float *>(in_tensors_.at(4)->MutableData())[0];
+  if (init) {
+    (void)DoSgdInit(weight, accumulate, gradient, learning_rate, moment, sgd_param_->use_nesterov_,
+                    sgd_param_->weight_decay_, start, end);
+  } else {
+    DoSgd(weight, accumulate, gradient, learning_rate, sgd_param_->dampening_, moment, sgd_param_->use_nesterov_,
+          sgd_param_->weight_decay_, start, end);
+  }
+  return RET_OK;
+}
+
+int SgdCPUKernel::DoExecute(int task_id) {
   int length = in_tensors_.at(0)->ElementsNum();
 
   int stride = UP_DIV(length, thread_count_);
   int count = MSMIN(stride, length - stride * task_id);
   count = (count < 0) ? 0 : count;
   int start = stride * task_id;
-  int end = start + count;
+  return DoSgdUpdate(start, start + count, false);
+}
 
-  DoSgd(weight, accumulate, gradient, learning_rate, sgd_param_->dampening_, moment, sgd_param_->use_nesterov_,
-        sgd_param_->weight_decay_, start, end);
+int SgdCPUKernel::BeginFusedUpdate() {
+  auto stat = reinterpret_cast<float *>(in_tensors_.at(5)->MutableData());
+  CHECK_NULL_RETURN(stat);
+  fused_init_ = *stat > 0.0f;
+  return RET_OK;
+}
 
+// the same modes as SgdRun and SgdRunInit.
+int SgdCPUKernel::UpdateWeight(int start, int end) {
+  auto mode = get_optimizer_mode();
+  if (fused_init_) {
+    return mode == WeightUpdateMode::VIRTUAL_BATCH ? AccumulateGrads(start, end) : DoSgdUpdate(start, end, true);
+  }
+  return mode == WeightUpdateMode::NORMAL ? DoSgdUpdate(start, end, false) : AccumulateGrads(start, end);
+}
+
+int SgdCPUKernel::EndFusedUpdate() {
+  if (fused_init_ && get_optimizer_mode() != WeightUpdateMode::VIRTUAL_BATCH) {
+    auto stat = reinterpret_cast<float *>(in_tensors_.at(5)->MutableData());
+    CHECK_NULL_RETURN(stat);
+    *stat = 0.0f;
+  }
+  fused_init_ = false;
   return RET_OK;
 }
 
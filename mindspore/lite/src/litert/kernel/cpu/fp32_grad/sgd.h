@@ -43,11 +43,18 @@ class SgdCPUKernel : public OptimizerKernel {
   int DoExecute(int task_id);
   int OptimizerStep() override;
   std::vector<int> GetOptimizerParamsIdxs() const override;
+  bool SupportFusedUpdate() const override { return true; }
+  int BeginFusedUpdate() override;
+  int UpdateWeight(int start, int end) override;
+  int EndFusedUpdate() override;
 
  private:
+  int DoSgdUpdate(int start, int end, bool init);
   int thread_count_;
   SgdParameter *sgd_param_;
   std::atomic<float> sgd_stat_{0.0f};
+  // the first step of the fused update initializes the accumulation by the gradient.
+  bool fused_init_ = false;
 };
 }  // namespace mindspore::kernel
 
@@ -0,0 +1,162 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel/cpu/fp32_sparse/matmul_sparse_structured_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+#include "nnacl/fp32_sparse/matmul_sparse_structured_fp32.h"
+
+namespace mindspore::kernel {
+namespace {
+// the block sparse is used when the non-zero blocks are less than this ratio.
+constexpr float kBlockSparseDensityThreshold = 0.4f;
+// the N:M patterns, which are tried in order.
+constexpr int kSparseNMPatterns[][C2NUM] = {{C1NUM, C4NUM}, {C2NUM, C4NUM}, {C4NUM, C8NUM}};
+}  // namespace
+
+SparseWeightInfo MatmulStructuredSparseCPUKernel::AnalyzeWeight(const OpParameter *parameter,
+                                                                const std::vector<lite::Tensor *> &inputs,
+                                                                bool b_transpose) {
+  SparseWeightInfo info;
+  if (parameter == nullptr || parameter->is_train_session_ || inputs.size() < C2NUM) {
+    return info;
+  }
+  auto weight = inputs[SECOND_INPUT];
+  if (weight == nullptr || !weight->IsConst() || weight->data() == nullptr ||
+      weight->data_type() != kNumberTypeFloat32 || weight->shape().size() != C2NUM) {
+    return info;
+  }
+  auto shape = weight->shape();
+  int deep = b_transpose ? shape[1] : shape[0];
+  int col = b_transpose ? shape[0] : shape[1];
+  if (deep <= 0 || col <= 1) {
+    return info;
+  }
+  auto data = reinterpret_cast<const float *>(weight->data());
+  for (auto pattern : kSparseNMPatterns) {
+    if (SparseCheckNM(data, deep, col, b_transpose, pattern[0], pattern[1])) {
+      info.format = kSparseWeightNM;
+      info.n = pattern[0];
+      info.m = pattern[1];
+      return info;
+    }
+  }
+  int block_num = SparseBlockCount(data, deep, col, b_transpose);
+  if (block_num < kBlockSparseDensityThreshold * deep * UP_DIV(col, SPARSE_COL_TILE)) {
+    info.format = kSparseWeightBlock;
+    info.block_num = block_num;
+  }
+  return info;
+}
+
+void MatmulStructuredSparseCPUKernel::InitGlobalVariable() {
+  matrix_a_.need_pack = params_->a_transpose_;
+  matrix_b_.need_pack = true;
+  matrix_a_pack_fun_ = params_->a_transpose_ ? RowMajor2ColMajor : RowMajor2RowMajor;
+  row_tile_ = C1NUM;
+  col_tile_ = SPARSE_COL_TILE;
+  col_min_unit_ = SPARSE_COL_TILE;
+  out_need_aligned_ = false;
+}
+
+int MatmulStructuredSparseCPUKernel::GetMatrixBBatchPackSize() const {
+  size_t pack_size = sparse_info_.format == kSparseWeightNM
+                       ? SparseNMPackedSize(params_->deep_, params_->col_, sparse_info_.n, sparse_info_.m)
+                       : SparseBlockPackedSize(params_->col_, sparse_info_.block_num);
+  return static_cast<int>(UP_DIV(pack_size, sizeof(float)));
+}
+
+int MatmulStructuredSparseCPUKernel::PackMatrixBImpl() {
+  auto src_ptr =
+    matrix_b_.has_origin ? matrix_b_.origin_ptr : reinterpret_cast<float *>(in_tensors_[SECOND_INPUT]->data());
+  MS_CHECK_TRUE_MSG(src_ptr != nullptr, RET_ERROR, "matrix-b source ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(b_batch_ == 1, RET_ERROR, "structured sparse matmul only support one batch of matrix-b.");
+  if (sparse_info_.format == kSparseWeightNM) {
+    SparseNMPack(src_ptr, matrix_b_.pack_ptr, params_->deep_, params_->col_, params_->b_transpose_, sparse_info_.n,
+                 sparse_info_.m);
+  } else {
+    SparseBlockPack(src_ptr, matrix_b_.pack_ptr, params_->deep_, params_->col_, params_->b_transpose_,
+                    sparse_info_.block_num);
+  }
+  return RET_OK;
+}
+
+void MatmulStructuredSparseCPUKernel::Compute(const float *a, float *c, int row, int col_start, int col_end) const {
+  auto act_type = static_cast<ActType>(params_->act_type_);
+  if (sparse_info_.format == kSparseWeightNM) {
+    MatMulSparseNMFp32(a, matrix_b_.pack_ptr, c, matrix_c_.pack_ptr, act_type, params_->deep_, row, params_->col_,
+                       col_start, col_end, col_step_, sparse_info_.n, sparse_info_.m);
+  } else {
+    MatMulSparseBlockFp32(a, matrix_b_.pack_ptr, sparse_info_.block_num, c, matrix_c_.pack_ptr, act_type,
+                          params_->deep_, row, params_->col_, col_start, col_end, col_step_);
+  }
+}
+
+int MatmulStructuredSparseCPUKernel::ParallelRunByBatch(int task_id) const {
+  int start_batch = task_id * batch_stride_;
+  int end_batch = MSMIN(params_->batch, start_batch + batch_stride_);
+  for (int index = start_batch; index < end_batch; ++index) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[index] * params_->row_align_ * params_->deep_;
+    float *c = output_data_ + index * params_->row_ * col_step_;
+    Compute(a, c, params_->row_, 0, params_->col_);
+  }
+  return RET_OK;
+}
+
+int MatmulStructuredSparseCPUKernel::ParallelRunByRow(int task_id) const {
+  int start_row = split_points_[task_id];
+  int end_row = row_num_;
+  if (task_id < (thread_count_ - 1)) {
+    end_row = split_points_[task_id + 1];
+  }
+  int row_num = end_row - start_row;
+  if (row_num <= 0) {
+    return RET_OK;
+  }
+  Compute(matrix_a_.pack_ptr + start_row * params_->deep_, output_data_ + start_row * col_step_, row_num, 0,
+          params_->col_);
+  return RET_OK;
+}
+
+int MatmulStructuredSparseCPUKernel::ParallelRunByOC(int task_id) const {
+  int start_oc = split_points_[task_id];
+  int end_oc = col_step_;
+  if (task_id < (thread_count_ - 1)) {
+    end_oc = split_points_[task_id + 1];
+  }
+  if (end_oc <= start_oc) {
+    return RET_OK;
+  }
+  for (int i = 0; i < params_->batch; ++i) {
+    const float *a = matrix_a_.pack_ptr + a_offset_[i] * params_->row_align_ * params_->deep_;
+    float *c = output_data_ + i * params_->row_ * col_step_;
+    Compute(a, c, params_->row_, start_oc, end_oc);
+  }
+  return RET_OK;
+}
+
+bool MatmulStructuredSparseCPUKernel::CheckThreadCuttingByRow() {
+  if (b_batch_ != C1NUM) {
+    return false;
+  }
+  if (row_num_ < op_parameter_->thread_num_) {
+    return false;
+  }
+  row_min_unit_ = SPARSE_ROW_TILE;
+  return MSMIN(row_num_ / row_min_unit_, op_parameter_->thread_num_) >
+         MSMIN(col_step_ / col_min_unit_, op_parameter_->thread_num_);
+}
+}  // namespace mindspore::kernel
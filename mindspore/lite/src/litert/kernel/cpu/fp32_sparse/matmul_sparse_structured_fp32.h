@@ -0,0 +1,62 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
+
+#include <vector>
+#include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
+
+namespace mindspore::kernel {
+enum SparseWeightFormat { kSparseWeightNone = 0, kSparseWeightBlock, kSparseWeightNM };
+
+struct SparseWeightInfo {
+  SparseWeightFormat format = kSparseWeightNone;
+  int n = 0;           // only valid for N:M
+  int m = 0;           // only valid for N:M
+  int block_num = 0;   // only valid for block sparse
+};
+
+// The constant matrix-b is compressed once, and the zeros of the weight are skipped by the kernels. The N:M pattern
+// is preferred, and the block sparse is used when the non-zero blocks are few enough.
+class MatmulStructuredSparseCPUKernel : public MatmulFp32BaseCPUKernel {
+ public:
+  MatmulStructuredSparseCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                                  const std::vector<lite::Tensor *> &outputs, const mindspore::lite::InnerContext *ctx,
+                                  const SparseWeightInfo &sparse_info)
+      : MatmulFp32BaseCPUKernel(parameter, inputs, outputs, ctx), sparse_info_(sparse_info) {}
+  ~MatmulStructuredSparseCPUKernel() = default;
+
+  // Analyze the sparsity of the constant matrix-b, kSparseWeightNone means the dense kernel is better.
+  static SparseWeightInfo AnalyzeWeight(const OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                                        bool b_transpose);
+
+  void InitGlobalVariable() override;
+  int PackMatrixBImpl() override;
+  int GetMatrixBBatchPackSize() const override;
+  int ParallelRunByBatch(int task_id) const override;
+  int ParallelRunByRow(int task_id) const override;
+  int ParallelRunByOC(int task_id) const override;
+  bool CheckThreadCuttingByRow() override;
+  bool SupportMulBatchCuttingByRow() override { return true; }
+
+ private:
+  void Compute(const float *a, float *c, int row, int col_start, int col_end) const;
+
+  SparseWeightInfo sparse_info_;
+};
+}  // namespace mindspore::kernel
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_SPARSE_MATMUL_SPARSE_STRUCTURED_FP32_H_
@@ -17,6 +17,7 @@
 #include "src/litert/kernel/cpu/int8/convolution_1x1_int8.h"
 #include "src/common/file_utils.h"
 #include "src/litert/kernel/cpu/int8/opt_op_handler.h"
+#include "src/litert/cpu_info.h"
 
 using mindspore::lite::RET_ERROR;
 using mindspore::lite::RET_MEMORY_FAILED;
@@ -139,8 +140,20 @@ void Convolution1x1Int8CPUKernel::FreeRunBuf() {
 void Convolution1x1Int8CPUKernel::CheckSupportOptimize() {
   support_optimize_ = false;
   matmul_func_ = MatMulInt8_4x16_r;
+#ifdef ENABLE_AVX512
+  if (X86_Avx512Vnni_Support()) {
+    int8_matmul_func_ = MatmulInt8Avx512Vnni;
+  }
+#endif
 #if defined(ENABLE_ARM64)
 #if !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && !defined(MACHINE_LINUX_ARM64)
+  if (lite::CpuInfo().ArmIsSupportI8mm()) {
+    // smmla runs on the 4x16 blocks of the common path, so the sdot path is skipped.
+    support_optimize_ = false;
+    matmul_func_ = nullptr;
+    int8_matmul_func_ = MatmulInt8I8mmOpt;
+    return;
+  }
   if (mindspore::lite::IsSupportSDot()) {
     support_optimize_ = true;
     matmul_func_ = MatMulDpInt8_optimize_handler;
@@ -452,9 +465,9 @@ int Convolution1x1Int8CPUKernel::RunArmHw(int task_id) {
                              UP_ROUND(cur_hw, C4NUM), matmul_param_->deep_16_);
   }
 
-  Conv1x1Int8(hw_packed_in, packed_weight_sub_, hw_out, hw_input_sum, reinterpret_cast<int32_t *>(bias_data_), cur_hw,
-              matmul_param_->col_, matmul_param_->deep_16_, left_shift_, right_shift_, multiplier_, conv_param_,
-              filter_zp_ptr_);
+  Conv1x1Int8WithFunc(hw_packed_in, packed_weight_sub_, hw_out, hw_input_sum, reinterpret_cast<int32_t *>(bias_data_),
+                      cur_hw, matmul_param_->col_, matmul_param_->deep_16_, left_shift_, right_shift_, multiplier_,
+                      conv_param_, int8_matmul_func_, filter_zp_ptr_);
   return RET_OK;
 }
 
@@ -529,9 +542,10 @@ int Convolution1x1Int8CPUKernel::RunArmOc(int task_id) {
   CHECK_NULL_RETURN(cur_left_shift);
   CHECK_NULL_RETURN(cur_right_shift);
   CHECK_NULL_RETURN(cur_multiplier);
-  Conv1x1Int8(packed_input_, packed_weight_sub_ + cur_stride * matmul_param_->deep_16_, output_ptr_ + cur_stride,
-              input_sum_, reinterpret_cast<int32_t *>(bias_data_) + cur_stride, matmul_param_->row_, cur_oc,
-              matmul_param_->deep_16_, cur_left_shift, cur_right_shift, cur_multiplier, conv_param_, cur_zp);
+  Conv1x1Int8WithFunc(packed_input_, packed_weight_sub_ + cur_stride * matmul_param_->deep_16_,
+                      output_ptr_ + cur_stride, input_sum_, reinterpret_cast<int32_t *>(bias_data_) + cur_stride,
+                      matmul_param_->row_, cur_oc, matmul_param_->deep_16_, cur_left_shift, cur_right_shift,
+                      cur_multiplier, conv_param_, int8_matmul_func_, cur_zp);
 
   return RET_OK;
 }
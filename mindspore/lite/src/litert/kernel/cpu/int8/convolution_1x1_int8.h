@@ -25,6 +25,7 @@
 #include "nnacl/int8/conv1x1_int8.h"
 #include "nnacl/base/conv1x1_base.h"
 #include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/matmul_avx512_vnni_int8.h"
 #include "nnacl/matmul_parameter.h"
 #include "src/common/utils.h"
 
@@ -83,6 +84,7 @@ class Convolution1x1Int8CPUKernel : public ConvolutionBaseCPUKernel {
   size_t input_sum_size_ = 0;
   MatMulParameter *matmul_param_ = nullptr;
   MATMUL_OPT_DP_FUNC matmul_func_ = nullptr;
+  MATMUL_OPT_INT8_FUNC int8_matmul_func_ = MatmulInt8Opt;
   bool support_optimize_ = false;
   bool filter_peroc_ = false;
 };
@@ -26,6 +26,7 @@
 #include "nnacl/int8/quantize.h"
 #include "nnacl/int8/common_func_int8.h"
 #include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/matmul_avx512_vnni_int8.h"
 
 namespace mindspore::kernel {
 class MatmulBaseInt8CPUKernel : public LiteKernel {
@@ -88,6 +89,7 @@ class MatmulBaseInt8CPUKernel : public LiteKernel {
   int deep_tile_ = C16NUM;
   int channel_num_ = 0;
   bool support_sdot_ = false;
+  MATMUL_OPT_INT8_FUNC matmul_func_ = MatmulInt8Opt;
   PackFunc a_pack_func_{nullptr};
   PackFunc b_pack_func_{nullptr};
 };
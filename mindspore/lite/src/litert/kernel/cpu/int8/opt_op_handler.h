@@ -30,6 +30,10 @@ void MatmulInt8DpNeon64(const int8_t *a, const int8_t *b, int8_t *dst, int row8,
 void MatmulInt8DpOpt(const int8_t *a, const int8_t *b, int8_t *dst, size_t row8, size_t col8, size_t deep4,
                      const int *a_sums, const int *bias, int act_min, int act_max, int out_zp, const int *multiplier,
                      const int *left_shift, const int *right_shift, size_t stride, size_t peroc, const int *filter_zp);
+void MatmulInt8I8mmOpt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                       const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                       const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                       size_t filter_peroc, const int32_t *filter_zp);
 #ifdef ENABLE_ARM64
 void IndirectGemmInt8_optimize_handler(int8_t *dst, const int8_t *src, const int8_t *weight, const int32_t *bias,
                                        size_t ksize, size_t ic4, size_t output_channel, size_t offset,
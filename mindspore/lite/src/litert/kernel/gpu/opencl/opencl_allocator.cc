@@ -286,6 +286,12 @@ void OpenCLAllocator::Free(void *buf) {
     auto mem_buf = iter->second;
     mem_buf->ref_count_ = 0;
     allocated_list_.erase(iter);
+    if (mem_buf->external_) {
+      delete static_cast<cl::Buffer *>(mem_buf->device_ptr_);
+      delete mem_buf;
+      UnLock();
+      return;
+    }
     free_list_.insert(std::make_pair(mem_buf->size_, mem_buf));
     UnLock();
     MS_LOG(DEBUG) << "Free device buffer. size: " << mem_buf->size_ << ", host addr: " << mem_buf->host_ptr_
@@ -372,6 +378,63 @@ size_t OpenCLAllocator::total_size() {
   return totalSize;
 }
 
+void *OpenCLAllocator::ImportHostMemory(void *host_ptr, size_t size) {
+  if (host_ptr == nullptr || size == 0) {
+    return nullptr;
+  }
+  // the svm kernels take the host pointer as the argument, which must be allocated by clSVMAlloc.
+  if (ocl_runtime_->GetSVMCapabilities() || !ocl_runtime_->isExtensionEnable(EXT_ARM_IMPORT_MEMORY_HOST)) {
+    MS_LOG(INFO) << "The device can not import host memory.";
+    return nullptr;
+  }
+  auto cache_line_size = ocl_runtime_->GetCacheLineSize();
+  if (reinterpret_cast<uintptr_t>(host_ptr) % cache_line_size != 0 || size % cache_line_size != 0) {
+    MS_LOG(INFO) << "The host memory " << host_ptr << " of size " << size << " is not aligned to the cache line "
+                 << cache_line_size << ", can not be imported.";
+    return nullptr;
+  }
+  Lock();
+  UNLOCK_AND_RETURN_NULL(allocated_list_.find(host_ptr) != allocated_list_.end(), host_ptr);
+  cl::Buffer *buffer = ocl_runtime_->CreateSharedMemoryBuffer(size, host_ptr);
+  UNLOCK_AND_RETURN_NULL(buffer == nullptr, nullptr);
+  MemBuf *mem_buf = new (std::nothrow) MemBuf;
+  if (mem_buf == nullptr) {
+    delete buffer;
+    UnLock();
+    return nullptr;
+  }
+  mem_buf->size_ = size;
+  mem_buf->device_ptr_ = static_cast<void *>(buffer);
+  mem_buf->host_ptr_ = host_ptr;
+  mem_buf->mem_type_ = MemType::SHARED;
+  mem_buf->external_ = true;
+  allocated_list_[host_ptr] = mem_buf;
+  UnLock();
+  MS_LOG(DEBUG) << "Import host memory " << host_ptr << ", size: " << size << ", device addr: " << buffer;
+  return host_ptr;
+}
+
+void OpenCLAllocator::ReleaseHostMemory(void *host_ptr) {
+  Lock();
+  auto iter = allocated_list_.find(host_ptr);
+  if (iter == allocated_list_.end() || !iter->second->external_) {
+    UnLock();
+    return;
+  }
+  auto mem_buf = iter->second;
+  allocated_list_.erase(iter);
+  delete static_cast<cl::Buffer *>(mem_buf->device_ptr_);
+  delete mem_buf;
+  UnLock();
+}
+
+bool OpenCLAllocator::IsAllocated(void *host_ptr) {
+  Lock();
+  bool allocated = allocated_list_.find(host_ptr) != allocated_list_.end();
+  UnLock();
+  return allocated;
+}
+
 cl::Image2D *OpenCLAllocator::GetImage(void *buffer) {
   auto it = allocated_list_.find(buffer);
   if (it != allocated_list_.end()) {
@@ -421,7 +484,7 @@ void OpenCLAllocator::ClearMemList(T *list) {
         delete image;
         it->second->image_ptr_ = nullptr;
       }
-      if (it->second->mem_type_ == MemType::SHARED) {
+      if (it->second->mem_type_ == MemType::SHARED && !it->second->external_) {
         free(it->second->host_ptr_);
         it->second->host_ptr_ = nullptr;
       }
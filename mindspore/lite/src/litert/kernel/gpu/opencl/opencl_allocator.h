@@ -71,6 +71,11 @@ class OpenCLAllocator : public mindspore::Allocator {
   size_t total_size();
 
   void Clear();
+  // wrap the memory owned by the caller, such as a camera frame, into a shared buffer, so the kernels read it without
+  // copies. Only valid on the devices supporting cl_arm_import_memory_host, return nullptr if it can not be imported.
+  void *ImportHostMemory(void *host_ptr, size_t size);
+  void ReleaseHostMemory(void *host_ptr);
+  bool IsAllocated(void *host_ptr);
   cl::Image2D *GetImage(void *host_ptr);
   void *GetOpenclMemPtr(void *buffer, MemType *type, bool force_buffer = false);
   void *MapBuffer(void *host_ptr, int flags, void *command_queue = nullptr, bool sync = true);
@@ -108,6 +113,8 @@ class OpenCLAllocator : public mindspore::Allocator {
     MemType mem_type_{MemType::BUF};
     ImageSize img_size_;
     bool map_flags_{false};
+    // the host memory is imported from the caller, which is not freed by the allocator.
+    bool external_{false};
   };
 
   // <membuf->buf, membuf>
@@ -112,6 +112,7 @@ int OpenCLRuntime::InitGPUDevice(std::vector<cl::Platform> *platforms) {
                << max_work_item_sizes_[2];
 
   gpu_info_ = ParseGpuInfo(device_name, device_version);
+  device_signature_ = device_name + "|" + device_version + "|" + device_->getInfo<CL_DRIVER_VERSION>();
   // get cache size, compute units and frequency.
   ret = device_->getInfo(CL_DEVICE_GLOBAL_MEM_CACHE_SIZE, &global_memery_cachesize_);
   if (ret != CL_SUCCESS) {
@@ -755,6 +756,13 @@ void OpenCLRuntime::LoadCache() {
     MS_LOG(ERROR) << "Load opencl cache fail: gpu_cache == nullptr";
     return;
   }
+  // the binaries built by another device or driver can not be loaded, they are rebuilt from the sources and the cache
+  // is overwritten.
+  if (gpu_cache->name() == nullptr || gpu_cache->name()->str() != device_signature_ ||
+      gpu_cache->version() == nullptr || gpu_cache->version()->str() != cache_version_) {
+    MS_LOG(WARNING) << "The opencl cache " << cache_path_ << " is built for another device or driver, skip it.";
+    return;
+  }
   auto *bins = gpu_cache->allBins();
   if (bins == nullptr) {
     MS_LOG(ERROR) << "Load opencl cache fail: bins == nullptr";
@@ -807,7 +815,7 @@ int OpenCLRuntime::StoreCache() {
   }
 
   auto data = fbb->CreateVector<flatbuffers::Offset<schema::ProgramBinary>>(program_binarys);
-  auto name = fbb->CreateString("OpenCLCache");
+  auto name = fbb->CreateString(device_signature_);
   auto version = fbb->CreateString(cache_version_);
   auto gpu_cache = schema::CreateGpuCache(*fbb, name, version, data);
   fbb->Finish(gpu_cache);
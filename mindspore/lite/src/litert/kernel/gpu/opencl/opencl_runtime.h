@@ -161,6 +161,14 @@ class OpenCLRuntime {
   bool isExtensionEnable(std::string ext) { return supported_extensions_.find(ext) != std::string::npos; }
   cl::Buffer *CreateSharedMemoryBuffer(size_t size, void *host_ptr);
   uint GetCacheLineSize() const { return cache_line_size_; }
+  // the name, version and driver version of the device, the caches of the programs and the tuned local sizes are
+  // only valid for the same signature.
+  const std::string &GetDeviceSignature() const { return device_signature_; }
+  // enable the program binary cache and store it to the path, must be called before Init.
+  void SetBinaryCachePath(const std::string &cache_path) {
+    enable_cache_ = true;
+    cache_path_ = cache_path;
+  }
 
  private:
   static OpenCLRuntime *GetInstance();
@@ -194,6 +202,7 @@ class OpenCLRuntime {
   uint32_t max_freq_{0};
   std::string default_build_option_{"-cl-mad-enable -cl-fast-relaxed-math -Werror"};
   GpuInfo gpu_info_;
+  std::string device_signature_;
   bool support_fp16_{false};
   bool fp16_enable_{false};
   bool svm_enable_{false};
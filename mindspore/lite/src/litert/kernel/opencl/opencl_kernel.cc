@@ -14,10 +14,15 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <sstream>
 #include "src/litert/infer_manager.h"
 #include "src/litert/kernel/opencl/opencl_kernel.h"
 #include "src/litert/weight_decoder.h"
 #include "src/common/file_utils.h"
+#include "src/litert/kernel_tune_cache.h"
 
 using mindspore::lite::RET_ERROR;
 using mindspore::lite::RET_OK;
@@ -279,7 +284,73 @@ int OpenCLKernel::AssignTuningParam(const BaseTuningParameter &param) {
   return RET_OK;
 }
 
+// the tuned param depends on the device, the kernel signature and the shapes, the key must not contain any space.
+std::string OpenCLKernel::TuneCacheKey() {
+  std::string key = "opencl_" + std::to_string(std::hash<std::string>{}(ocl_runtime_->GetDeviceSignature())) + "_" +
+                    Key() + (ocl_runtime_->GetFp16Enable() ? "_fp16" : "_fp32");
+  for (auto tensor : in_tensors_) {
+    key += "_in";
+    for (auto dim : tensor->shape()) {
+      key += "_" + std::to_string(dim);
+    }
+  }
+  for (auto tensor : out_tensors_) {
+    key += "_out";
+    for (auto dim : tensor->shape()) {
+      key += "_" + std::to_string(dim);
+    }
+  }
+  std::replace(key.begin(), key.end(), ' ', '_');
+  return key;
+}
+
+bool OpenCLKernel::FindTunedParam(const std::string &key, BaseTuningParameter *param) {
+  auto iter = tuned_param_cache_.find(key);
+  if (iter != tuned_param_cache_.end()) {
+    *param = iter->second;
+    return true;
+  }
+  auto tune_cache = lite::KernelTuneCache::GetInstance();
+  std::string value;
+  if (!tune_cache->enable() || !tune_cache->Find(key, &value)) {
+    return false;
+  }
+  std::vector<size_t> local_size;
+  std::istringstream iss(value);
+  std::string item;
+  while (std::getline(iss, item, ',')) {
+    local_size.push_back(static_cast<size_t>(std::strtoul(item.c_str(), nullptr, 10)));
+  }
+  size_t group_size = std::accumulate(local_size.begin(), local_size.end(), size_t(1), std::multiplies<size_t>());
+  if (local_size.empty() || group_size == 0 || group_size > ocl_runtime_->GetMaxWorkGroupSize(kernel_)) {
+    MS_LOG(WARNING) << "Invalid tuned param of " << name() << " in the cache: " << value;
+    return false;
+  }
+  param->local_size = local_size;
+  tuned_param_cache_[key] = *param;
+  return true;
+}
+
+void OpenCLKernel::SaveTunedParam(const std::string &key, const BaseTuningParameter &param) {
+  tuned_param_cache_[key] = param;
+  auto tune_cache = lite::KernelTuneCache::GetInstance();
+  if (!tune_cache->enable() || param.local_size.empty()) {
+    return;
+  }
+  std::string value;
+  for (auto size : param.local_size) {
+    value += (value.empty() ? "" : ",") + std::to_string(size);
+  }
+  tune_cache->Update(key, value);
+}
+
 int OpenCLKernel::Tune() {
+  auto cache_key = TuneCacheKey();
+  BaseTuningParameter tuned_param;
+  if (FindTunedParam(cache_key, &tuned_param)) {
+    MS_LOG(DEBUG) << "Tuning " << name() << " hits the cache: param (" << tuned_param << ")";
+    return AssignTuningParam(tuned_param);
+  }
   if (!ocl_runtime_->isProfiling()) {
     MS_LOG(WARNING) << "Tuning mode require opencl runtime profiling.";
     return RET_OK;
@@ -318,6 +389,7 @@ int OpenCLKernel::Tune() {
     MS_LOG(INFO) << "Tuning " << name() << " result: param (" << tuning_params[index] << ") exectime " << min_time
                  << "ms";
     AssignTuningParam(tuning_params[index]);
+    SaveTunedParam(cache_key, tuning_params[index]);
   } else {
     MS_LOG(WARNING) << "Cannot find suitable param.";
   }
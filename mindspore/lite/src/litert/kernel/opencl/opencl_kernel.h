@@ -307,6 +307,9 @@ class OpenCLKernel : public LiteKernel {
  protected:
   void PrintShape(lite::Tensor *output_tensor);
   static std::set<size_t> GenerateLocalByGlobal(size_t global_i);
+  std::string TuneCacheKey();
+  bool FindTunedParam(const std::string &key, BaseTuningParameter *param);
+  void SaveTunedParam(const std::string &key, const BaseTuningParameter &param);
 
   virtual std::string Key() {
     std::string key = schema::EnumNamePrimitiveType(type());
@@ -512,33 +512,63 @@ int OpenCLSubGraph::ReSize(bool interrupt) {
   return RET_OK;
 }
 
-int OpenCLSubGraph::Execute() {
-  if (executor_ == nullptr) {
-    MS_LOG(ERROR) << "executor is nullptr";
-    return RET_ERROR;
-  }
-  int ret;
+// The input set by the caller, such as a camera frame or a cpu kernel output, is not allocated by the opencl
+// allocator, it is imported as a shared buffer, so the gpu kernels read the same memory without copies.
+int OpenCLSubGraph::PrepareInputs() {
   for (auto &tensor : in_tensors()) {
     MS_ASSERT(tensor);
     if (tensor->data() == nullptr) {
       MS_LOG(ERROR) << "OpenCL subgraph input tensor data is null";
       return RET_ERROR;
     }
-    ret = allocator_->UnmapBuffer(tensor->data());
+    if (!allocator_->IsAllocated(tensor->data())) {
+      if (allocator_->ImportHostMemory(tensor->data(), tensor->Size()) == nullptr) {
+        MS_LOG(ERROR) << "OpenCL subgraph input " << tensor->tensor_name()
+                      << " is not allocated by the opencl allocator and can not be imported, copy it to the tensor "
+                      << "data instead.";
+        return RET_ERROR;
+      }
+      imported_inputs_.push_back(tensor->data());
+      continue;
+    }
+    auto ret = allocator_->UnmapBuffer(tensor->data());
     if (ret != RET_OK) {
       return ret;
     }
   }
+  return RET_OK;
+}
+
+void OpenCLSubGraph::ReleaseImportedInputs() {
+  for (auto data : imported_inputs_) {
+    allocator_->ReleaseHostMemory(data);
+  }
+  imported_inputs_.clear();
+}
+
+int OpenCLSubGraph::Execute() {
+  if (executor_ == nullptr) {
+    MS_LOG(ERROR) << "executor is nullptr";
+    return RET_ERROR;
+  }
+  auto ret = PrepareInputs();
+  if (ret != RET_OK) {
+    ReleaseImportedInputs();
+    return ret;
+  }
 
   ret = executor_->Run(in_tensors(), out_tensors(), nodes_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Run opencl executor failed: " << ret;
+    ReleaseImportedInputs();
     return ret;
   }
   if (!ocl_runtime_->SyncCommandQueue()) {
     MS_LOG(ERROR) << "SyncCommandQueue failed.";
+    ReleaseImportedInputs();
     return RET_ERROR;
   }
+  ReleaseImportedInputs();
   return RET_OK;
 }
 
@@ -547,28 +577,24 @@ int OpenCLSubGraph::Execute(const KernelCallBack &before, const KernelCallBack &
     MS_LOG(ERROR) << "executor is nullptr";
     return RET_ERROR;
   }
-  int ret;
-  for (auto &tensor : in_tensors()) {
-    MS_ASSERT(tensor);
-    if (tensor->data() == nullptr) {
-      MS_LOG(ERROR) << "OpenCL subgraph input tensor data is null";
-      return RET_ERROR;
-    }
-    ret = allocator_->UnmapBuffer(tensor->data());
-    if (ret != RET_OK) {
-      return ret;
-    }
+  auto ret = PrepareInputs();
+  if (ret != RET_OK) {
+    ReleaseImportedInputs();
+    return ret;
   }
 
   ret = executor_->Run(in_tensors(), out_tensors(), nodes_, before, after);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Run opencl executor failed: " << ret;
+    ReleaseImportedInputs();
     return ret;
   }
   if (!ocl_runtime_->SyncCommandQueue()) {
     MS_LOG(ERROR) << "SyncCommandQueue failed.";
+    ReleaseImportedInputs();
     return RET_ERROR;
   }
+  ReleaseImportedInputs();
   return RET_OK;
 }
 }  // namespace mindspore::kernel
@@ -73,6 +73,8 @@ class OpenCLSubGraph : public SubGraphKernel {
                   std::vector<lite::Tensor *> *out_tensors,
                   std::vector<OpenGLTexture2DToOpenCLParameter *> *out_parameters,
                   std::vector<KernelExec *> *out_convert_ops, lite::opencl::MemType mem_type);
+  int PrepareInputs();
+  void ReleaseImportedInputs();
   void GetKernelFromToTensor(const std::vector<lite::Tensor *> &in_tensors,
                              const std::vector<kernel::KernelExec *> &in_kernels,
                              std::vector<std::vector<kernel::KernelExec *>> *out_kernels, bool is_from);
@@ -93,6 +95,8 @@ class OpenCLSubGraph : public SubGraphKernel {
   std::vector<OpenGLTexture2DToOpenCLParameter *> gl_out_parameters_;
   std::vector<KernelExec *> in_convert_ops_;
   std::vector<KernelExec *> out_convert_ops_;
+  // the input memory owned by the caller, which is imported for one running.
+  std::vector<void *> imported_inputs_;
   std::set<KernelExec *> nodes_set_;
   lite::opencl::OpenCLRuntimeInnerWrapper ocl_runtime_wrap_;
   lite::opencl::OpenCLRuntime *ocl_runtime_{nullptr};
@@ -19,6 +19,7 @@
 #include "src/tensor.h"
 #include "src/common/utils.h"
 #include "src/common/version_manager.h"
+#include "src/litert/lazy_weight_decoder.h"
 
 namespace mindspore::kernel {
 using mindspore::lite::RET_ERROR;
@@ -77,7 +78,17 @@ std::string KernelExec::ToString() const {
 }
 
 int KernelExec::DoExecute() {
+  if (lazy_weight_) {
+    auto ret = lite::LazyWeightDecoder::GetInstance()->AcquireTensors(in_tensors());
+    if (ret != lite::RET_OK) {
+      MS_LOG(ERROR) << "Decode the weights of " << this->name() << " failed: " << ret;
+      return ret;
+    }
+  }
   auto ret = kernel_->Execute();
+  if (lazy_weight_) {
+    lite::LazyWeightDecoder::GetInstance()->ReleaseTensors(in_tensors());
+  }
   if ((ret == lite::RET_OK) && (desc_.provider != kBuiltin)) {
     for (auto *output : out_tensors()) {
       MS_ASSERT(output != nullptr);
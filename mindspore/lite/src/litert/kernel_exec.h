@@ -198,6 +198,9 @@ class KernelExec {
 
   bool is_model_output() const { return this->is_model_output_; }
 
+  // the weights of the kernel are decoded by the lazy weight decoder just before running.
+  void set_lazy_weight(bool lazy_weight) { this->lazy_weight_ = lazy_weight; }
+
   bool InferShapeDone() const {
     auto shape = out_tensors().front()->shape();
     if (std::find(shape.begin(), shape.end(), -1) != shape.end()) {
@@ -384,6 +387,7 @@ class KernelExec {
   mutable std::vector<lite::Tensor *> mutable_in_tensors_;
   mutable std::vector<lite::Tensor *> mutable_out_tensors_;
   bool is_model_output_ = false;
+  bool lazy_weight_ = false;
   SubGraphType subgraph_type_ = kNotSubGraph;
   const lite::InnerContext *context_ = nullptr;
   bool enable_gl_texture_ = false;
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel_tune_cache.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "src/common/log_adapter.h"
+
+namespace mindspore::lite {
+KernelTuneCache *KernelTuneCache::GetInstance() {
+  static KernelTuneCache instance;
+  return &instance;
+}
+
+void KernelTuneCache::Init(bool enable, const std::string &cache_file) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  enable_ = enable_ || enable;
+  if (!cache_file.empty() && cache_file != cache_file_) {
+    cache_file_ = cache_file;
+    Load();
+  }
+}
+
+bool KernelTuneCache::Find(const std::string &key, std::string *value) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = choices_.find(key);
+  if (iter == choices_.end()) {
+    return false;
+  }
+  *value = iter->second;
+  return true;
+}
+
+void KernelTuneCache::Update(const std::string &key, const std::string &value) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = choices_.find(key);
+  if (iter != choices_.end() && iter->second == value) {
+    return;
+  }
+  choices_[key] = value;
+  Save();
+}
+
+void KernelTuneCache::Load() {
+  std::ifstream ifs(cache_file_);
+  if (!ifs.good()) {
+    return;
+  }
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    std::string key;
+    std::string value;
+    if (!(iss >> key >> value)) {
+      MS_LOG(WARNING) << "invalid line of kernel tune cache " << cache_file_ << ": " << line;
+      continue;
+    }
+    choices_[key] = value;
+  }
+}
+
+void KernelTuneCache::Save() const {
+  if (cache_file_.empty()) {
+    return;
+  }
+  // write to a temporary file and rename it, so the other processes never load a part of the file.
+  auto tmp_file = cache_file_ + ".tmp";
+  std::ofstream ofs(tmp_file, std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(WARNING) << "open kernel tune cache " << tmp_file << " failed.";
+    return;
+  }
+  for (auto &choice : choices_) {
+    ofs << choice.first << " " << choice.second << "\n";
+  }
+  ofs.close();
+  if (!ofs.good() || std::rename(tmp_file.c_str(), cache_file_.c_str()) != 0) {
+    MS_LOG(WARNING) << "save kernel tune cache " << cache_file_ << " failed.";
+    (void)std::remove(tmp_file.c_str());
+  }
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace mindspore::lite {
+// the cache of the fastest implementation of the kernels, which is measured by the kernels when they are prepared at
+// the first time, it is enabled by the kernel_tune enable config of the session.
+// the choices are saved to the cache_file of kernel_tune as the lines of "key value", so the next process on the same
+// device skips measuring. The key must hold everything the choice depends on, such as the shape and the thread num.
+class KernelTuneCache {
+ public:
+  static KernelTuneCache *GetInstance();
+  void Init(bool enable, const std::string &cache_file);
+  bool enable() const { return enable_; }
+  // return false if the key is not tuned yet.
+  bool Find(const std::string &key, std::string *value);
+  void Update(const std::string &key, const std::string &value);
+
+ private:
+  KernelTuneCache() = default;
+  ~KernelTuneCache() = default;
+  void Load();
+  void Save() const;
+
+  std::mutex mtx_;
+  bool enable_ = false;
+  std::string cache_file_;
+  std::map<std::string, std::string> choices_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNE_CACHE_H_
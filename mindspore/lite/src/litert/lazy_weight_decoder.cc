@@ -0,0 +1,208 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/lazy_weight_decoder.h"
+#include "src/litert/weight_decoder.h"
+#include "src/common/utils.h"
+#include "src/common/log_adapter.h"
+
+namespace mindspore::lite {
+LazyWeightDecoder *LazyWeightDecoder::GetInstance() {
+  static LazyWeightDecoder instance;
+  return &instance;
+}
+
+LazyWeightDecoder::~LazyWeightDecoder() {
+  for (auto &item : lazy_tensors_) {
+    free(item.second.decoded_data);
+    item.second.decoded_data = nullptr;
+  }
+}
+
+void LazyWeightDecoder::Init(bool enable, size_t cache_size) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  enable_ = enable_ || enable;
+  if (cache_size > cache_size_) {
+    cache_size_ = cache_size;
+  }
+}
+
+bool LazyWeightDecoder::NeedDefer(const OpParameter *op_parameter, const Tensor *tensor) const {
+  // the gather kernels read the whole table at each run, the others pack or keep the weights while preparing.
+  if (op_parameter->type_ != schema::PrimitiveType_Gather || !tensor->IsConst()) {
+    return false;
+  }
+  auto quant_params = tensor->quant_params();
+  if (!quant_params.empty()) {
+    return quant_params.front().inited &&
+           (tensor->data_type() == kNumberTypeInt8 || tensor->data_type() == kNumberTypeInt16 ||
+            tensor->data_type() == kNumberTypeInt32);
+  }
+  return !tensor->quant_clusters().empty();
+}
+
+int LazyWeightDecoder::DeferDequantNode(const OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors,
+                                        TypeId dst_data_type, const std::string &model_version, bool float_mode) {
+#ifndef WEIGHT_DECODE_CLIP
+  if (!enable_ || (dst_data_type != kNumberTypeFloat32 && dst_data_type != kNumberTypeFloat16)) {
+    return RET_NO_CHANGE;
+  }
+  if (op_parameter->quant_type_ != static_cast<int>(schema::QuantType_QUANT_WEIGHT) &&
+      !(op_parameter->quant_type_ == static_cast<int>(schema::QuantType_QUANT_ALL) && float_mode)) {
+    return RET_NO_CHANGE;
+  }
+  std::lock_guard<std::mutex> lock(mtx_);
+  bool deferred = false;
+  for (auto &tensor : in_tensors) {
+    MS_CHECK_TRUE_RET(tensor != nullptr, RET_ERROR);
+    deferred = deferred || lazy_tensors_.find(tensor) != lazy_tensors_.end() || NeedDefer(op_parameter, tensor);
+  }
+  if (!deferred) {
+    return RET_NO_CHANGE;
+  }
+  int index = 0;
+  for (auto &tensor : in_tensors) {
+    auto preferred_dim =
+      WeightDecoder::GetPreferredDim(in_tensors, op_parameter, index++, tensor->shape(), model_version);
+    auto iter = lazy_tensors_.find(tensor);
+    if (iter != lazy_tensors_.end()) {
+      // scheduled again by another data type, the weight is never decoded before running.
+      iter->second.dst_data_type = dst_data_type;
+      tensor->set_data_type(dst_data_type);
+      continue;
+    }
+    if (NeedDefer(op_parameter, tensor)) {
+      auto &lazy_tensor = lazy_tensors_[tensor];
+      lazy_tensor.quant_data = tensor->data();
+      lazy_tensor.own_quant_data = tensor->own_data();
+      lazy_tensor.quant_data_type = tensor->data_type();
+      lazy_tensor.quant_params = tensor->quant_params();
+      lazy_tensor.quant_clusters = tensor->quant_clusters();
+      lazy_tensor.preferred_dim = preferred_dim;
+      lazy_tensor.dst_data_type = dst_data_type;
+      lazy_tensor.lru_iter = idle_tensors_.end();
+      tensor->set_data_type(dst_data_type);
+    }
+    tensor->ClearQuantParam();
+  }
+  return RET_OK;
+#else
+  return RET_NO_CHANGE;
+#endif
+}
+
+int LazyWeightDecoder::Decode(Tensor *tensor, LazyTensor *lazy_tensor) {
+#ifndef WEIGHT_DECODE_CLIP
+  Tensor quant_tensor(lazy_tensor->quant_data_type, tensor->shape(), tensor->format(), Category::CONST_TENSOR);
+  quant_tensor.set_data(lazy_tensor->quant_data);
+  quant_tensor.set_own_data(false);
+  quant_tensor.set_quant_params(lazy_tensor->quant_params);
+  quant_tensor.set_quant_clusters(lazy_tensor->quant_clusters);
+  auto ret = WeightDecoder::DequantTensor(&quant_tensor, lazy_tensor->preferred_dim, lazy_tensor->dst_data_type);
+  if (ret != RET_OK || quant_tensor.data() == lazy_tensor->quant_data) {
+    MS_LOG(ERROR) << "Decode weight " << tensor->tensor_name() << " failed: " << ret;
+    quant_tensor.set_data(nullptr);
+    return RET_ERROR;
+  }
+  lazy_tensor->decoded_data = quant_tensor.data();
+  lazy_tensor->decoded_size = quant_tensor.Size();
+  // the decoded data is owned by the cache now.
+  quant_tensor.set_data(nullptr);
+  used_size_ += lazy_tensor->decoded_size;
+  return RET_OK;
+#else
+  MS_LOG(ERROR) << "Do not support lazy weight decode.";
+  return RET_NOT_SUPPORT;
+#endif
+}
+
+void LazyWeightDecoder::Evict(size_t extra_size) {
+  while (used_size_ + extra_size > cache_size_ && !idle_tensors_.empty()) {
+    auto &lazy_tensor = lazy_tensors_[idle_tensors_.front()];
+    idle_tensors_.pop_front();
+    lazy_tensor.lru_iter = idle_tensors_.end();
+    free(lazy_tensor.decoded_data);
+    lazy_tensor.decoded_data = nullptr;
+    used_size_ -= lazy_tensor.decoded_size;
+    lazy_tensor.decoded_size = 0;
+  }
+}
+
+int LazyWeightDecoder::AcquireTensors(const std::vector<Tensor *> &tensors) {
+  std::unique_lock<std::mutex> lock(mtx_);
+  for (size_t i = 0; i < tensors.size(); ++i) {
+    auto tensor = tensors[i];
+    auto iter = lazy_tensors_.find(tensor);
+    if (iter == lazy_tensors_.end()) {
+      continue;
+    }
+    auto &lazy_tensor = iter->second;
+    if (lazy_tensor.decoded_data == nullptr) {
+      Evict(tensor->ElementsNum() * DataTypeSize(lazy_tensor.dst_data_type));
+      auto ret = Decode(tensor, &lazy_tensor);
+      if (ret != RET_OK) {
+        lock.unlock();
+        ReleaseTensors(std::vector<Tensor *>(tensors.begin(), tensors.begin() + i));
+        return ret;
+      }
+    } else if (lazy_tensor.lru_iter != idle_tensors_.end()) {
+      idle_tensors_.erase(lazy_tensor.lru_iter);
+      lazy_tensor.lru_iter = idle_tensors_.end();
+    }
+    if (lazy_tensor.ref_count++ == 0) {
+      tensor->set_data(lazy_tensor.decoded_data);
+      tensor->set_own_data(false);
+    }
+  }
+  return RET_OK;
+}
+
+void LazyWeightDecoder::ReleaseTensors(const std::vector<Tensor *> &tensors) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  for (auto &tensor : tensors) {
+    auto iter = lazy_tensors_.find(tensor);
+    if (iter == lazy_tensors_.end() || iter->second.ref_count == 0) {
+      continue;
+    }
+    auto &lazy_tensor = iter->second;
+    if (--lazy_tensor.ref_count == 0) {
+      tensor->set_data(lazy_tensor.quant_data);
+      tensor->set_own_data(lazy_tensor.own_quant_data);
+      lazy_tensor.lru_iter = idle_tensors_.insert(idle_tensors_.end(), tensor);
+    }
+  }
+  Evict(0);
+}
+
+void LazyWeightDecoder::Unregister(const std::vector<Tensor *> &tensors) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  for (auto &tensor : tensors) {
+    auto iter = lazy_tensors_.find(tensor);
+    if (iter == lazy_tensors_.end()) {
+      continue;
+    }
+    auto &lazy_tensor = iter->second;
+    if (lazy_tensor.lru_iter != idle_tensors_.end()) {
+      idle_tensors_.erase(lazy_tensor.lru_iter);
+    }
+    tensor->set_data(lazy_tensor.quant_data);
+    tensor->set_own_data(lazy_tensor.own_quant_data);
+    free(lazy_tensor.decoded_data);
+    used_size_ -= lazy_tensor.decoded_size;
+    (void)lazy_tensors_.erase(iter);
+  }
+}
+}  // namespace mindspore::lite
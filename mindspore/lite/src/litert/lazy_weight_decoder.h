@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_LAZY_WEIGHT_DECODER_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_LAZY_WEIGHT_DECODER_H_
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "src/tensor.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore::lite {
+// the lazy decoder keeps the quantized weights of the nodes compressed after scheduling, and decodes them just before
+// the kernel runs into a cache of the decoded weights, which is bounded by decoded_cache_size of the weight_decode
+// config and evicts the least recently used weights not in use. It is enabled by the lazy_decode config of the session.
+// Only the kernels which read the weights at each run, and never keep the data pointer, are decoded lazily.
+class LazyWeightDecoder {
+ public:
+  static LazyWeightDecoder *GetInstance();
+  void Init(bool enable, size_t cache_size);
+  bool enable() const { return enable_; }
+  // return RET_NO_CHANGE if the weights of the node are not decoded lazily, then they are dequantized at once. The
+  // data type of the deferred weights is set to dst_data_type, while their data keeps compressed.
+  int DeferDequantNode(const OpParameter *op_parameter, const std::vector<Tensor *> &in_tensors, TypeId dst_data_type,
+                       const std::string &model_version, bool float_mode);
+  // set the decoded data to the deferred tensors, which must be paired with ReleaseTensors after the kernel runs. The
+  // acquired tensors are released when it fails.
+  int AcquireTensors(const std::vector<Tensor *> &tensors);
+  void ReleaseTensors(const std::vector<Tensor *> &tensors);
+  // restore the compressed data and drop the decoded data, called before the tensors are freed.
+  void Unregister(const std::vector<Tensor *> &tensors);
+
+ private:
+  LazyWeightDecoder() = default;
+  ~LazyWeightDecoder();
+
+  struct LazyTensor {
+    void *quant_data = nullptr;
+    bool own_quant_data = false;
+    TypeId quant_data_type = kTypeUnknown;
+    std::vector<LiteQuantParam> quant_params;
+    std::vector<float> quant_clusters;
+    int preferred_dim = 0;
+    TypeId dst_data_type = kNumberTypeFloat32;
+    void *decoded_data = nullptr;
+    size_t decoded_size = 0;
+    int ref_count = 0;
+    std::list<Tensor *>::iterator lru_iter;
+  };
+
+  bool NeedDefer(const OpParameter *op_parameter, const Tensor *tensor) const;
+  int Decode(Tensor *tensor, LazyTensor *lazy_tensor);
+  // free the idle decoded weights until extra_size more bytes fit into the cache.
+  void Evict(size_t extra_size);
+
+  std::mutex mtx_;
+  bool enable_ = false;
+  size_t cache_size_ = 0;
+  size_t used_size_ = 0;
+  std::unordered_map<Tensor *, LazyTensor> lazy_tensors_;
+  // the decoded tensors not in use, the front is the least recently used.
+  std::list<Tensor *> idle_tensors_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_LAZY_WEIGHT_DECODER_H_
@@ -37,7 +37,11 @@ constexpr size_t kMaxModelBufferSize = static_cast<size_t>(1024) * 1024 * 1024 *
 
 void LiteModel::Free() {
   if (this->buf != nullptr) {
-    delete[](this->buf);
+    if (model_buf_by_mmap_) {
+      UnmapFile(this->buf, this->buf_size_);
+    } else {
+      delete[](this->buf);
+    }
     this->buf = nullptr;
   }
   auto nodes_size = this->graph_.all_nodes_.size();
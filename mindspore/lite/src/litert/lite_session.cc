@@ -15,8 +15,13 @@
  */
 
 #include "src/litert/lite_session.h"
+#include <algorithm>
 #include <set>
 #include "src/litert/pack_weight_manager.h"
+#include "src/litert/thread_cost_model.h"
+#include "src/litert/jit_kernel_manager.h"
+#include "src/litert/kernel_tune_cache.h"
+#include "src/litert/lazy_weight_decoder.h"
 #include "src/litert/runtime_pass.h"
 #if defined(LINUX_RUNTIME)
 #include <malloc.h>
@@ -65,6 +70,9 @@ extern void mindspore_log_init();
 #endif
 namespace lite {
 namespace {
+constexpr size_t kMaxShapeBucketNum = 16;
+constexpr size_t kClusterGroupItemNum = 2;
+
 bool ExistCustomCpuKernel() {
 #ifndef CUSTOM_KERNEL_REGISTRY_CLIP
   const std::string kArchCPU = "CPU";
@@ -533,6 +541,22 @@ int LiteSession::CompileGraph(Model *model) {
     MS_LOG(ERROR) << "StoreOriginTensorData failed.";
     return RET_ERROR;
   }
+  ret = InitPackCache(model);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init pack cache failed.";
+    is_running_.store(false);
+    return ret;
+  }
+  InitThreadCostModel();
+  InitJitKernel();
+  InitKernelTune();
+  InitLazyWeightDecode();
+  ret = InitThreadPoolPolicy();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init thread pool policy failed.";
+    is_running_.store(false);
+    return ret;
+  }
   InitGraphInputTensors(model);
   InitGraphOutputTensors(model);
 
@@ -557,6 +581,10 @@ int LiteSession::CompileGraph(Model *model) {
     is_running_.store(false);
     return ret;
   }
+  if (pack_cache_model_buf_ != nullptr &&
+      lite::PackWeightManager::GetInstance()->SavePackCache(pack_cache_model_buf_) != RET_OK) {
+    MS_LOG(WARNING) << "Save pack cache failed, the weights will be packed again next time.";
+  }
 
   if (is_train_session_) {
     is_running_.store(false);
@@ -580,12 +608,205 @@ int LiteSession::CompileGraph(Model *model) {
   }
 
   is_running_.store(false);
+  ret = WarmUpShapeBuckets();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Warm up shape buckets failed.";
+    return ret;
+  }
 #if defined(LINUX_RUNTIME)
   (void)malloc_trim(0);
 #endif
   return RET_OK;
 }
 
+// the kernel costs and the thread wake-up cost of the device are calibrated before the kernels decide their thread
+// num, the default costs are kept when the calibration fails.
+void LiteSession::InitThreadCostModel() {
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto cost_model_iter = config_info_->find(kThreadCostModel);
+  if (cost_model_iter == config_info_->end()) {
+    return;
+  }
+  auto file_iter = cost_model_iter->second.find(kThreadCostModelCalibrationFile);
+  if (file_iter == cost_model_iter->second.end() || file_iter->second.empty()) {
+    return;
+  }
+  if (CalibrateThreadCostModel(file_iter->second, context_->thread_pool()) != RET_OK) {
+    MS_LOG(WARNING) << "Calibrate thread cost model failed, use the default costs.";
+  }
+}
+
+// the jit kernels are generated when the kernels are prepared, and the generated code is cached in the directory
+// configured by jit_kernel cache_dir.
+void LiteSession::InitJitKernel() {
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto jit_iter = config_info_->find(kJitKernel);
+  if (jit_iter == config_info_->end()) {
+    return;
+  }
+  auto enable_iter = jit_iter->second.find(kJitKernelEnable);
+  if (enable_iter == jit_iter->second.end() || enable_iter->second != "true") {
+    return;
+  }
+  auto dir_iter = jit_iter->second.find(kJitKernelCacheDir);
+  auto cache_dir = dir_iter == jit_iter->second.end() ? std::string() : dir_iter->second;
+  lite::JitKernelManager::GetInstance()->Init(true, cache_dir);
+}
+
+void LiteSession::InitKernelTune() {
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto tune_iter = config_info_->find(kKernelTune);
+  if (tune_iter == config_info_->end()) {
+    return;
+  }
+  auto enable_iter = tune_iter->second.find(kKernelTuneEnable);
+  if (enable_iter == tune_iter->second.end() || enable_iter->second != "true") {
+    return;
+  }
+  auto file_iter = tune_iter->second.find(kKernelTuneCacheFile);
+  auto cache_file = file_iter == tune_iter->second.end() ? std::string() : file_iter->second;
+  lite::KernelTuneCache::GetInstance()->Init(true, cache_file);
+}
+
+// the decoded_cache_size of weight_decode is in units of MB.
+void LiteSession::InitLazyWeightDecode() {
+  if (config_info_ == nullptr || is_train_session_) {
+    return;
+  }
+  auto decode_iter = config_info_->find(kWeightDecode);
+  if (decode_iter == config_info_->end()) {
+    return;
+  }
+  auto lazy_iter = decode_iter->second.find(kWeightDecodeLazy);
+  if (lazy_iter == decode_iter->second.end() || lazy_iter->second != "true") {
+    return;
+  }
+  constexpr int kDefaultDecodedCacheSize = 64;
+  constexpr size_t kMBSize = 1024 * 1024;
+  int cache_size = kDefaultDecodedCacheSize;
+  auto size_iter = decode_iter->second.find(kWeightDecodeCacheSize);
+  if (size_iter != decode_iter->second.end() && (!ConvertStrToInt(size_iter->second, &cache_size) || cache_size < 0)) {
+    MS_LOG(WARNING) << "Invalid decoded_cache_size: " << size_iter->second << ", use the default size.";
+    cache_size = kDefaultDecodedCacheSize;
+  }
+  lite::LazyWeightDecoder::GetInstance()->Init(true, static_cast<size_t>(cache_size) * kMBSize);
+}
+
+// the cluster groups are configured as "big:2;little:2", the workers of the thread pool are bound to the clusters
+// group by group in the order of the workers.
+int LiteSession::InitThreadPoolPolicy() {
+  if (config_info_ == nullptr) {
+    return RET_OK;
+  }
+  auto thread_pool_iter = config_info_->find(kThreadPool);
+  if (thread_pool_iter == config_info_->end()) {
+    return RET_OK;
+  }
+  auto thread_pool = context_->thread_pool();
+  MS_CHECK_TRUE_MSG(thread_pool != nullptr, RET_ERROR, "thread pool is nullptr.");
+  auto spin_iter = thread_pool_iter->second.find(kThreadPoolAdaptiveSpin);
+  if (spin_iter != thread_pool_iter->second.end()) {
+    thread_pool->SetAdaptiveSpin(spin_iter->second == "true");
+  }
+  auto groups_iter = thread_pool_iter->second.find(kThreadPoolClusterGroups);
+  if (groups_iter == thread_pool_iter->second.end()) {
+    return RET_OK;
+  }
+  static const std::map<std::string, CoreCluster> kClusters = {
+    {"big", Cluster_Big}, {"middle", Cluster_Middle}, {"little", Cluster_Little}};
+  size_t start = 0;
+  for (auto &group : StrSplit(groups_iter->second, ";")) {
+    auto items = StrSplit(group, ":");
+    int thread_num = 0;
+    if (items.size() != kClusterGroupItemNum || kClusters.find(items[0]) == kClusters.end() ||
+        !ConvertStrToInt(items[1], &thread_num) || thread_num <= 0) {
+      MS_LOG(ERROR) << "Invalid cluster group: " << group;
+      return RET_ERROR;
+    }
+    auto end = std::min(start + static_cast<size_t>(thread_num), thread_pool->thread_num());
+    if (start < end && thread_pool->SetThreadGroupAffinity(start, end, kClusters.at(items[0])) != THREAD_OK) {
+      MS_LOG(WARNING) << "Bind thread group " << group << " failed.";
+    }
+    start = end;
+  }
+  return RET_OK;
+}
+
+// the packed weights are cached in the directory configured by pack_cache cache_dir, the training session always
+// packs the weights because they are updated.
+int LiteSession::InitPackCache(const Model *model) {
+  if (config_info_ == nullptr || is_train_session_ || model->buf == nullptr || model->buf_size_ == 0) {
+    return RET_OK;
+  }
+  auto pack_cache_iter = config_info_->find(kPackCache);
+  if (pack_cache_iter == config_info_->end()) {
+    return RET_OK;
+  }
+  auto dir_iter = pack_cache_iter->second.find(kPackCacheDir);
+  if (dir_iter == pack_cache_iter->second.end() || dir_iter->second.empty()) {
+    return RET_OK;
+  }
+  auto ret = lite::PackWeightManager::GetInstance()->InitPackCache(dir_iter->second, model->buf, model->buf_size_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "InitPackCache failed.";
+    return ret;
+  }
+  pack_cache_model_buf_ = model->buf;
+  return RET_OK;
+}
+
+// the warm up shapes are configured as "1,32:1,32;4,32:4,32", the buckets are separated by ';' and the shapes of
+// the graph inputs in one bucket are separated by ':'.
+int LiteSession::WarmUpShapeBuckets() {
+  if (config_info_ == nullptr) {
+    return RET_OK;
+  }
+  auto bucket_iter = config_info_->find(kShapeBucket);
+  if (bucket_iter == config_info_->end()) {
+    return RET_OK;
+  }
+  auto shapes_iter = bucket_iter->second.find(kShapeBucketWarmUpShapes);
+  if (shapes_iter == bucket_iter->second.end()) {
+    return RET_OK;
+  }
+  std::vector<std::vector<int>> origin_dims;
+  for (auto input : inputs_) {
+    origin_dims.push_back(input->shape());
+  }
+  for (auto &bucket : StrSplit(shapes_iter->second, ";")) {
+    auto shapes = StrSplit(bucket, ":");
+    if (shapes.size() != inputs_.size()) {
+      MS_LOG(ERROR) << "The shape bucket " << bucket << " should contain " << inputs_.size() << " input shapes.";
+      return RET_PARAM_INVALID;
+    }
+    std::vector<std::vector<int>> dims;
+    for (auto &shape : shapes) {
+      std::vector<int> dim;
+      for (auto &value : StrSplit(shape, ",")) {
+        int dim_value = 0;
+        if (!ConvertStrToInt(value, &dim_value) || dim_value <= 0) {
+          MS_LOG(ERROR) << "The shape bucket " << bucket << " is invalid.";
+          return RET_PARAM_INVALID;
+        }
+        dim.push_back(dim_value);
+      }
+      dims.push_back(dim);
+    }
+    auto ret = Resize(inputs_, dims);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Resize to shape bucket " << bucket << " failed.";
+      return ret;
+    }
+  }
+  return Resize(inputs_, origin_dims);
+}
+
 bool LiteSession::IsIsolatedSubGraph(const kernel::KernelExec *kernel) {
   auto cur_in_tensors = kernel->in_tensors();
   for (auto cur_kernel : this->kernels_) {
@@ -761,6 +982,8 @@ int LiteSession::CreateTensorRTDelegate() {
 #if GPU_TENSORRT
   std::string cache_model_path;
   std::string serialize_path;
+  std::string engine_cache_dir;
+  std::string profile_shapes;
   size_t vocab_size = 0;
   size_t device_cache_size = 0;
   if (config_info_ != nullptr) {
@@ -792,11 +1015,24 @@ int LiteSession::CreateTensorRTDelegate() {
       if (serialize_path_iter != ms_cache.end()) {
         serialize_path = serialize_path_iter->second;
       }
+
+      auto engine_cache_dir_iter = ms_cache.find(kMSCacheEngineCacheDir);
+      if (engine_cache_dir_iter != ms_cache.end()) {
+        engine_cache_dir = engine_cache_dir_iter->second;
+      }
+    }
+    // the warm up shape buckets are built as the optimization profiles of the tensorrt engine.
+    auto bucket_iter = config_info_->find(kShapeBucket);
+    if (bucket_iter != config_info_->end()) {
+      auto shapes_iter = bucket_iter->second.find(kShapeBucketWarmUpShapes);
+      if (shapes_iter != bucket_iter->second.end()) {
+        profile_shapes = shapes_iter->second;
+      }
     }
   }
 
-  delegate_ =
-    std::make_shared<TensorRTDelegate>(ms_context_, cache_model_path, vocab_size, device_cache_size, serialize_path);
+  delegate_ = std::make_shared<TensorRTDelegate>(ms_context_, cache_model_path, vocab_size, device_cache_size,
+                                                 serialize_path, engine_cache_dir, profile_shapes);
   if (delegate_ == nullptr) {
     MS_LOG(ERROR) << "New tensorrt delegate_ failed";
     return RET_ERROR;
@@ -909,6 +1145,13 @@ LiteSession::~LiteSession() {
     delete kernel;
     kernel = nullptr;
   }
+  if (pack_cache_model_buf_ != nullptr) {
+    lite::PackWeightManager::GetInstance()->FreePackCache(pack_cache_model_buf_);
+    pack_cache_model_buf_ = nullptr;
+  }
+  if (lite::LazyWeightDecoder::GetInstance()->enable()) {
+    lite::LazyWeightDecoder::GetInstance()->Unregister(tensors_);
+  }
   for (auto tensor : tensors_) {
     if (tensor == nullptr) {
       continue;
@@ -1154,6 +1397,88 @@ int LiteSession::BindGLTexture2DMemory(const std::map<std::string, unsigned int>
   return RET_OK;
 }
 
+bool LiteSession::IsInputShapesUnchanged(const std::vector<mindspore::lite::Tensor *> &inputs,
+                                         const std::vector<std::vector<int>> &dims) {
+  if (is_infershape_ != RET_OK || inputs.size() != inputs_.size() || dims.size() != inputs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (inputs[i] != inputs_[i] || inputs_[i]->shape() != dims[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int LiteSession::RuntimeAllocatorInitByBucket(const std::vector<std::vector<int>> &dims, bool *bucket_hit) {
+  *bucket_hit = false;
+  auto plan_iter = shape_bucket_plans_.find(dims);
+  if (runtime_allocator_ == nullptr || plan_iter == shape_bucket_plans_.end() || RuntimeAllocatorValid() != RET_OK ||
+      ExistCustomCpuKernel()) {
+    auto ret = RuntimeAllocatorInit();
+    if (ret == RET_OK) {
+      SaveShapeBucketPlan(dims);
+    }
+    return ret;
+  }
+  auto &plan = plan_iter->second;
+  runtime_allocator_->Clear(context_->allocator);
+  for (auto tensor : plan.runtime_allocated_tensors) {
+    tensor->set_allocator(runtime_allocator_);
+  }
+  runtime_allocator_->RestorePlan(plan.data_offsets, plan.data_size);
+  *bucket_hit = true;
+  return RuntimeAllocatorSetData();
+}
+
+size_t LiteSession::GetSubGraphNodeNum() {
+  size_t node_num = 0;
+  for (auto subgraph : kernels_) {
+    if (subgraph->desc().arch == kernel::KERNEL_ARCH::kCPU) {
+      node_num += reinterpret_cast<kernel::SubGraphKernel *>(subgraph)->nodes().size();
+    }
+  }
+  return node_num;
+}
+
+void LiteSession::SaveShapeBucketPlan(const std::vector<std::vector<int>> &dims) {
+  if (runtime_allocator_ == nullptr || runtime_allocator_->GetOffsetMap().empty() ||
+      shape_bucket_plans_.size() >= kMaxShapeBucketNum || RuntimeAllocatorValid() != RET_OK) {
+    return;
+  }
+  ShapeBucketPlan plan;
+  plan.data_offsets = runtime_allocator_->GetOffsetMap();
+  plan.data_size = runtime_allocator_->total_size();
+  std::set<Tensor *> runtime_allocated_tensors;
+  for (auto subgraph : kernels_) {
+    if (subgraph->desc().arch != kernel::KERNEL_ARCH::kCPU) {
+      continue;
+    }
+    for (auto kernel : reinterpret_cast<kernel::SubGraphKernel *>(subgraph)->nodes()) {
+      for (auto tensor : kernel->in_tensors()) {
+        if (tensor->allocator() == runtime_allocator_) {
+          runtime_allocated_tensors.insert(tensor);
+        }
+      }
+      for (auto tensor : kernel->out_tensors()) {
+        if (tensor->allocator() == runtime_allocator_) {
+          runtime_allocated_tensors.insert(tensor);
+        }
+      }
+    }
+  }
+  for (auto &item : isolate_graph_output_map_) {
+    if (item.second->allocator() == runtime_allocator_) {
+      runtime_allocated_tensors.insert(item.second);
+    }
+  }
+  for (auto &item : plan.data_offsets) {
+    runtime_allocated_tensors.insert(item.first);
+  }
+  plan.runtime_allocated_tensors.assign(runtime_allocated_tensors.begin(), runtime_allocated_tensors.end());
+  shape_bucket_plans_[dims] = std::move(plan);
+}
+
 int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
                         const std::vector<std::vector<int>> &dims) {
   bool expected = false;
@@ -1161,6 +1486,11 @@ int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
     MS_LOG(ERROR) << "Not support multi-threading";
     return RET_ERROR;
   }
+  if (IsInputShapesUnchanged(inputs, dims)) {
+    MS_LOG(DEBUG) << "The input shapes are not changed, skip resize.";
+    is_running_.store(false);
+    return RET_OK;
+  }
   std::vector<std::vector<int>> old_dims;
   for (size_t i = 0; i < inputs_.size(); ++i) {
     old_dims.push_back(inputs_[i]->shape());
@@ -1183,21 +1513,30 @@ int LiteSession::Resize(const std::vector<mindspore::lite::Tensor *> &inputs,
     return ret;
   }
 
-  if (RuntimeAllocatorInit() != RET_OK) {
+  bool bucket_hit = false;
+  if (RuntimeAllocatorInitByBucket(dims, &bucket_hit) != RET_OK) {
     MS_LOG(ERROR) << "Runtime allocator in resize failed.";
     is_running_.store(false);
     return RET_ERROR;
   }
 
+  auto node_num = GetSubGraphNodeNum();
   auto status = GraphOptimizePass(&kernels_);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "GraphOptimizePass failed.";
     return RET_ERROR;
   }
+  if (node_num != GetSubGraphNodeNum()) {
+    // the lifetime of tensors is changed by the deleted kernels, so the memory plans are stale.
+    shape_bucket_plans_.clear();
+  }
 
   is_running_.store(false);
 #if defined(LINUX_RUNTIME)
-  (void)malloc_trim(0);
+  // the memory of the known shape bucket will be used again soon, not trim it.
+  if (!bucket_hit) {
+    (void)malloc_trim(0);
+  }
 #endif
   ret = UpdateInputShapeMap();
   if (ret != RET_OK) {
@@ -1431,6 +1770,7 @@ int LiteSession::RuntimeAllocatorInit() {
 
   RuntimeAllocatorInitGraphOutput();
 
+  runtime_allocator_->OptimizePlan();
   auto ret = RuntimeAllocatorSetData();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "using optimize allocator failed.";
@@ -1458,6 +1798,42 @@ int LiteSession::RuntimeAllocatorSetData() {
   return RET_OK;
 }
 
+#if GPU_OPENCL
+// the tuned local sizes are saved to the cache_file of kernel_tune, and the built programs are saved to the
+// binary_cache_file of opencl, so the next process on the same device skips both the tuning and the compiling.
+void LiteSession::InitOpenCLConfig(opencl::OpenCLRuntime *opencl_runtime) {
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto opencl_iter = config_info_->find(kOpenCL);
+  if (opencl_iter == config_info_->end()) {
+    return;
+  }
+  static const std::map<std::string, opencl::TuningMode> kTuningModes = {{"default", opencl::TuningMode::DEFAULT},
+                                                                         {"fast", opencl::TuningMode::FAST},
+                                                                         {"extreme", opencl::TuningMode::EXTREME}};
+  auto mode_iter = opencl_iter->second.find(kOpenCLTuningMode);
+  if (mode_iter != opencl_iter->second.end()) {
+    auto tuning_mode = kTuningModes.find(mode_iter->second);
+    if (tuning_mode == kTuningModes.end()) {
+      MS_LOG(WARNING) << "Invalid opencl tuning_mode: " << mode_iter->second << ", use the default mode.";
+    } else {
+      opencl_runtime->SetTuningMode(tuning_mode->second);
+    }
+  }
+  auto cache_iter = opencl_iter->second.find(kOpenCLBinaryCacheFile);
+  if (cache_iter != opencl_iter->second.end() && !cache_iter->second.empty()) {
+    opencl_runtime->SetBinaryCachePath(cache_iter->second);
+  }
+  // the tensors are allocated as shared virtual memory if the device supports it, so the cpu and gpu kernels access
+  // the same memory without mapping.
+  auto svm_iter = opencl_iter->second.find(kOpenCLEnableSvm);
+  if (svm_iter != opencl_iter->second.end() && svm_iter->second == "true") {
+    opencl_runtime->SetSVMEnable(true);
+  }
+}
+#endif
+
 int LiteSession::InitGPURuntime() {
   if (context_->IsDeviceTypeEnabled(DT_CPU)) {
     CpuBindMode cpu_bind_mode = context_->GetDeviceInfo(DT_CPU).cpu_device_info_.cpu_bind_mode_;
@@ -1481,6 +1857,7 @@ int LiteSession::InitGPURuntime() {
     opencl_runtime->SetGLTextureEnable(gpu_device_info.enable_gl_texture_);
     opencl_runtime->SetGLContext(gpu_device_info.gl_context_);
     opencl_runtime->SetGLDisplay(gpu_device_info.gl_display_);
+    InitOpenCLConfig(opencl_runtime);
     if (opencl_runtime->Init() != RET_OK) {
       if (gpu_device_info.enable_gl_texture_) {
         MS_LOG(ERROR) << "Init OpenCL runtime failed, enable_gl_texture set true, only support GPU mode.";
@@ -1665,7 +2042,75 @@ int lite::LiteSession::LoadModelAndCompileByBuf(const char *model_buf, mindspore
   return RET_OK;
 }
 
+bool lite::LiteSession::IsModelLoadByMmap() {
+  if (config_info_ == nullptr) {
+    return false;
+  }
+  auto model_load_iter = config_info_->find(kModelLoad);
+  if (model_load_iter == config_info_->end()) {
+    return false;
+  }
+  auto mmap_iter = model_load_iter->second.find(kModelLoadMmap);
+  return mmap_iter != model_load_iter->second.end() && mmap_iter->second == "true";
+}
+
+// the constant tensors point to the mapped file directly, and the model buffer is unmapped when the model is freed.
+int lite::LiteSession::LoadModelAndCompileByMmap(const std::string &model_path, mindspore::ModelType model_type) {
+  size_t model_size = 0;
+  auto model_buf = MmapFile(model_path.c_str(), &model_size);
+  if (model_buf == nullptr) {
+    return RET_NOT_SUPPORT;
+  }
+  size_t lite_buf_size = 0;
+  char *lite_buf = nullptr;
+  auto buf_model_type = LoadModelByBuff(model_buf, model_size, &lite_buf, &lite_buf_size, model_type);
+  if (buf_model_type == mindspore::ModelType::kUnknownType || lite_buf == nullptr) {
+    MS_LOG(ERROR) << "Invalid model file: " << model_path;
+    UnmapFile(model_buf, model_size);
+    return RET_ERROR;
+  }
+  bool by_mmap = (lite_buf == model_buf);
+  if (!by_mmap) {
+    // the model is converted to a new buffer at runtime, the mapped file is not used any more.
+    UnmapFile(model_buf, model_size);
+  }
+  auto *model = lite::ImportFromBuffer(lite_buf, lite_buf_size, true, model_type, model_path);
+  if (model == nullptr) {
+    MS_LOG(ERROR) << "Import model failed";
+    if (by_mmap) {
+      UnmapFile(lite_buf, lite_buf_size);
+    } else {
+      delete[] lite_buf;
+    }
+    return RET_ERROR;
+  }
+  auto lite_model = reinterpret_cast<lite::LiteModel *>(model);
+  lite_model->set_model_buf_by_mmap(by_mmap);
+  lite_model->set_keep_model_buf(true);
+  auto status = lite::PackWeightManager::GetInstance()->InitPackWeightByBuf(lite_buf, lite_buf_size);
+  if (status != RET_OK) {
+    MS_LOG(ERROR) << "InitPackWeightByBuf failed.";
+    delete model;
+    return RET_ERROR;
+  }
+  auto ret = CompileGraph(model);
+  if (ret != lite::RET_OK) {
+    MS_LOG(ERROR) << "Compile model failed";
+    delete model;
+    return RET_ERROR;
+  }
+  set_model(model);
+  return RET_OK;
+}
+
 int lite::LiteSession::LoadModelAndCompileByPath(const std::string &model_path, mindspore::ModelType model_type) {
+  if (IsModelLoadByMmap()) {
+    auto ret = LoadModelAndCompileByMmap(model_path, model_type);
+    if (ret != RET_NOT_SUPPORT) {
+      return ret;
+    }
+    MS_LOG(WARNING) << "Load model by mmap is not supported, read the model file instead.";
+  }
   size_t model_size;
   auto model_buf = LoadModelByPath(model_path, model_type, &model_size);
   if (model_buf == nullptr) {
@@ -132,17 +132,31 @@ class LiteSession {
     const std::unordered_map<Tensor *, Tensor *> &isolate_input_map = std::unordered_map<Tensor *, Tensor *>());
   static void FreePackOpWeight(const std::vector<kernel::KernelExec *> &kernels);
   std::string ParseWeightPath();
+  bool IsModelLoadByMmap();
+  int LoadModelAndCompileByMmap(const std::string &model_path, mindspore::ModelType model_type);
 
  private:
   int PreCheck(Model *model);
   int InitExecutor();
   void ResetInputsShape(const std::vector<std::vector<int>> &dims);
+  bool IsInputShapesUnchanged(const std::vector<mindspore::lite::Tensor *> &inputs,
+                              const std::vector<std::vector<int>> &dims);
+  int WarmUpShapeBuckets();
+  int InitPackCache(const Model *model);
+  void InitThreadCostModel();
+  void InitJitKernel();
+  void InitKernelTune();
+  void InitLazyWeightDecode();
+  int InitThreadPoolPolicy();
   int ContextInit(InnerContext *context);
   int CreateTensorRTDelegate();
   int CreateNPUDelegate();
   int CreateCoreMLDelegate();
   int DelegateInit();
   int InitGPURuntime();
+#if GPU_OPENCL
+  void InitOpenCLConfig(opencl::OpenCLRuntime *opencl_runtime);
+#endif
 
  private:
   int IsolateOutputTensor();
@@ -161,6 +175,21 @@ class LiteSession {
   virtual int RuntimeAllocatorValid();
   RuntimeAllocatorPtr runtime_allocator_ = nullptr;
 
+ private:
+  // the memory plan of one input shape bucket, which is restored instead of planning again when resizing back to
+  // the known input shapes.
+  struct ShapeBucketPlan {
+    std::unordered_map<Tensor *, size_t> data_offsets;
+    std::vector<Tensor *> runtime_allocated_tensors;
+    size_t data_size = 0;
+  };
+  int RuntimeAllocatorInitByBucket(const std::vector<std::vector<int>> &dims, bool *bucket_hit);
+  void SaveShapeBucketPlan(const std::vector<std::vector<int>> &dims);
+  size_t GetSubGraphNodeNum();
+  std::map<std::vector<std::vector<int>>, ShapeBucketPlan> shape_bucket_plans_;
+  // the model buffer whose packed weights are cached on disk, the cache is freed after the kernels.
+  const char *pack_cache_model_buf_ = nullptr;
+
  protected:
   InnerContext *context_ = nullptr;
   mindspore::Context *ms_context_ = nullptr;
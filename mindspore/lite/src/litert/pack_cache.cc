@@ -0,0 +1,211 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/pack_cache.h"
+#include <cstdio>
+#include <fstream>
+#include <vector>
+#include "src/common/file_utils.h"
+#include "src/common/log_adapter.h"
+#include "nnacl/op_base.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr uint32_t kPackCacheMagic = 0x4350534d;  // "MSPC"
+constexpr uint32_t kPackCacheVersion = 1;
+constexpr size_t kPackCacheAlign = 64;
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+struct PackCacheHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t entry_num;
+};
+
+struct PackCacheEntry {
+  uint64_t model_offset;
+  uint64_t packed_size;
+  uint64_t data_offset;
+};
+
+const char *GetInstructionSet() {
+#if defined(ENABLE_AVX512)
+  return "avx512";
+#elif defined(ENABLE_AVX)
+  return "avx";
+#elif defined(ENABLE_SSE)
+  return "sse";
+#elif defined(ENABLE_ARM64)
+  return "arm64";
+#elif defined(ENABLE_ARM32)
+  return "arm32";
+#else
+  return "generic";
+#endif
+}
+
+uint64_t HashModelBuffer(const char *model_buf, size_t model_size) {
+  uint64_t hash = kFnvOffsetBasis ^ model_size;
+  size_t word_num = model_size / sizeof(uint64_t);
+  for (size_t i = 0; i < word_num; ++i) {
+    uint64_t word;
+    memcpy(&word, model_buf + i * sizeof(uint64_t), sizeof(uint64_t));
+    hash = (hash ^ word) * kFnvPrime;
+  }
+  for (size_t i = word_num * sizeof(uint64_t); i < model_size; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(model_buf[i])) * kFnvPrime;
+  }
+  return hash;
+}
+
+size_t AlignSize(size_t size) { return (size + kPackCacheAlign - 1) / kPackCacheAlign * kPackCacheAlign; }
+}  // namespace
+
+PackCache::~PackCache() {
+  if (cache_buf_ != nullptr) {
+    UnmapFile(cache_buf_, cache_size_);
+    cache_buf_ = nullptr;
+  }
+}
+
+STATUS PackCache::Init(const std::string &cache_dir, const char *model_buf, size_t model_size) {
+  MS_CHECK_TRUE_MSG(model_buf != nullptr && model_size != 0, RET_ERROR, "model buf is invalid in pack cache.");
+  std::lock_guard<std::mutex> lock(mtx_);
+  model_buf_ = model_buf;
+  model_size_ = model_size;
+  cache_file_ = cache_dir + FILE_SEPARATOR + std::to_string(HashModelBuffer(model_buf, model_size)) + "_" +
+                GetInstructionSet() + ".pack";
+  return Load();
+}
+
+STATUS PackCache::Load() {
+  std::ifstream ifs(cache_file_);
+  if (!ifs.good()) {
+    MS_LOG(INFO) << "pack cache " << cache_file_ << " is not exist, the packed weights will be saved to it.";
+    return RET_OK;
+  }
+  ifs.close();
+  cache_buf_ = MmapFile(cache_file_.c_str(), &cache_size_);
+  if (cache_buf_ == nullptr || cache_size_ < sizeof(PackCacheHeader)) {
+    MS_LOG(WARNING) << "load pack cache " << cache_file_ << " failed.";
+    return RET_OK;
+  }
+  auto header = reinterpret_cast<const PackCacheHeader *>(cache_buf_);
+  if (header->magic != kPackCacheMagic || header->version != kPackCacheVersion ||
+      sizeof(PackCacheHeader) + header->entry_num * sizeof(PackCacheEntry) > cache_size_) {
+    MS_LOG(WARNING) << "pack cache " << cache_file_ << " is invalid, ignore it.";
+    return RET_OK;
+  }
+  auto entries = reinterpret_cast<const PackCacheEntry *>(cache_buf_ + sizeof(PackCacheHeader));
+  for (size_t i = 0; i < header->entry_num; ++i) {
+    auto &entry = entries[i];
+    if (entry.data_offset + entry.packed_size > cache_size_) {
+      MS_LOG(WARNING) << "pack cache " << cache_file_ << " is truncated, ignore it.";
+      cached_data_.clear();
+      return RET_OK;
+    }
+    cached_data_[{entry.model_offset, entry.packed_size}] = cache_buf_ + entry.data_offset;
+  }
+  MS_LOG(INFO) << "load " << cached_data_.size() << " packed weights from pack cache " << cache_file_;
+  return RET_OK;
+}
+
+bool PackCache::GetModelOffset(const void *origin_data, size_t *offset) const {
+  auto data = static_cast<const char *>(origin_data);
+  if (data < model_buf_ || data >= model_buf_ + model_size_) {
+    return false;
+  }
+  *offset = static_cast<size_t>(data - model_buf_);
+  return true;
+}
+
+void *PackCache::Find(const void *origin_data, size_t packed_size) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  size_t offset = 0;
+  if (!GetModelOffset(origin_data, &offset)) {
+    return nullptr;
+  }
+  auto iter = cached_data_.find({offset, packed_size});
+  return iter == cached_data_.end() ? nullptr : iter->second;
+}
+
+void PackCache::Record(const void *origin_data, size_t packed_size, void *packed_data) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  size_t offset = 0;
+  if (packed_data == nullptr || !GetModelOffset(origin_data, &offset)) {
+    return;
+  }
+  recorded_data_[{offset, packed_size}] = packed_data;
+}
+
+bool PackCache::Release(void *packed_data) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto data = static_cast<char *>(packed_data);
+  if (cache_buf_ != nullptr && data >= cache_buf_ && data < cache_buf_ + cache_size_) {
+    return true;
+  }
+  for (auto iter = recorded_data_.begin(); iter != recorded_data_.end(); ++iter) {
+    if (iter->second == packed_data) {
+      recorded_data_.erase(iter);
+      break;
+    }
+  }
+  return false;
+}
+
+STATUS PackCache::Save() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (recorded_data_.empty()) {
+    return RET_OK;
+  }
+  auto all_data = cached_data_;
+  all_data.insert(recorded_data_.begin(), recorded_data_.end());
+  PackCacheHeader header = {kPackCacheMagic, kPackCacheVersion, all_data.size()};
+  std::vector<PackCacheEntry> entries;
+  size_t data_offset = AlignSize(sizeof(PackCacheHeader) + all_data.size() * sizeof(PackCacheEntry));
+  for (auto &item : all_data) {
+    entries.push_back({item.first.first, item.first.second, data_offset});
+    data_offset = AlignSize(data_offset + item.first.second);
+  }
+  // write to a temporary file and rename it, so the other sessions never see a part of the cache.
+  auto tmp_file = cache_file_ + ".tmp";
+  std::ofstream ofs(tmp_file, std::ios::binary | std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(WARNING) << "open pack cache " << tmp_file << " failed.";
+    return RET_ERROR;
+  }
+  ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  ofs.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(PackCacheEntry));
+  std::vector<char> padding(kPackCacheAlign, 0);
+  size_t i = 0;
+  for (auto &item : all_data) {
+    auto pos = static_cast<size_t>(ofs.tellp());
+    ofs.write(padding.data(), entries[i].data_offset - pos);
+    ofs.write(static_cast<const char *>(item.second), item.first.second);
+    ++i;
+  }
+  ofs.close();
+  if (!ofs.good() || std::rename(tmp_file.c_str(), cache_file_.c_str()) != 0) {
+    MS_LOG(WARNING) << "save pack cache " << cache_file_ << " failed.";
+    (void)std::remove(tmp_file.c_str());
+    return RET_ERROR;
+  }
+  MS_LOG(INFO) << "save " << all_data.size() << " packed weights to pack cache " << cache_file_;
+  recorded_data_.clear();
+  return RET_OK;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,60 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_PACK_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_PACK_CACHE_H_
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+// the on-disk cache of the packed const weights, which is saved after the kernels are prepared and mmaped by the next
+// session of the same model, so the kernels skip repacking.
+// the cache file is named by the model hash and the instruction set, and the packed data is keyed by the offset of
+// the origin weight in the model buffer and the packed size, which is decided by the tile parameters of the kernel.
+class PackCache {
+ public:
+  PackCache() = default;
+  ~PackCache();
+
+  STATUS Init(const std::string &cache_dir, const char *model_buf, size_t model_size);
+  // return the cached packed data of the origin weight, nullptr if not cached.
+  void *Find(const void *origin_data, size_t packed_size);
+  // record the packed data which is written by the kernel, saved in Save.
+  void Record(const void *origin_data, size_t packed_size, void *packed_data);
+  // the cached data is owned by the cache, and the recorded data is freed by the kernel.
+  bool Release(void *packed_data);
+  STATUS Save();
+  const std::string &cache_file() const { return cache_file_; }
+
+ private:
+  bool GetModelOffset(const void *origin_data, size_t *offset) const;
+  STATUS Load();
+
+  std::mutex mtx_;
+  std::string cache_file_;
+  const char *model_buf_ = nullptr;
+  size_t model_size_ = 0;
+  char *cache_buf_ = nullptr;
+  size_t cache_size_ = 0;
+  // <model offset, packed size> -> packed data
+  std::map<std::pair<size_t, size_t>, void *> cached_data_;
+  std::map<std::pair<size_t, size_t>, void *> recorded_data_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_PACK_CACHE_H_
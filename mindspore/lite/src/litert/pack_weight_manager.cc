@@ -146,17 +146,86 @@ void *PackWeightManager::MallocData(size_t size) {
   return data;
 }
 
+STATUS PackWeightManager::InitPackCache(const std::string &cache_dir, const char *model_buf, size_t model_size) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  auto iter = pack_caches_.find(model_buf);
+  if (iter != pack_caches_.end()) {
+    ++iter->second.second;
+    return RET_OK;
+  }
+  auto pack_cache = std::make_shared<PackCache>();
+  if (pack_cache == nullptr) {
+    MS_LOG(ERROR) << "pack_cache is nullptr.";
+    return RET_ERROR;
+  }
+  auto ret = pack_cache->Init(cache_dir, model_buf, model_size);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "init pack cache failed.";
+    return ret;
+  }
+  pack_caches_[model_buf] = std::make_pair(pack_cache, 1);
+  return RET_OK;
+}
+
+STATUS PackWeightManager::SavePackCache(const char *model_buf) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  auto iter = pack_caches_.find(model_buf);
+  if (iter == pack_caches_.end()) {
+    return RET_OK;
+  }
+  return iter->second.first->Save();
+}
+
+// the cached packed data is used by the kernels until they are freed, so the cache is freed after the kernels.
+void PackWeightManager::FreePackCache(const char *model_buf) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  auto iter = pack_caches_.find(model_buf);
+  if (iter != pack_caches_.end() && --iter->second.second <= 0) {
+    (void)pack_caches_.erase(iter);
+  }
+}
+
+void *PackWeightManager::GetCachedPackData(const void *tensor_data, size_t size) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  for (auto &item : pack_caches_) {
+    auto data = item.second.first->Find(tensor_data, size);
+    if (data != nullptr) {
+      return data;
+    }
+  }
+  return nullptr;
+}
+
+void PackWeightManager::RecordPackData(const void *tensor_data, size_t size, void *packed_data) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  for (auto &item : pack_caches_) {
+    item.second.first->Record(tensor_data, size, packed_data);
+  }
+}
+
+bool PackWeightManager::ReleaseCachedPackData(void *packed_data) {
+  std::lock_guard<std::mutex> lock(pack_cache_mtx_);
+  bool is_cached = false;
+  for (auto &item : pack_caches_) {
+    is_cached = item.second.first->Release(packed_data) || is_cached;
+  }
+  return is_cached;
+}
+
 void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size, bool *is_packed) {
 #ifdef SHARING_MODEL_WEIGHT
-  if (pack_weight_ == nullptr) {
-    void *data = MallocData(size);
-    *is_packed = false;
-    return data;
+  if (pack_weight_ != nullptr) {
+    return pack_weight_->GetPackData(tensor_data, size, is_packed);
   }
-  return pack_weight_->GetPackData(tensor_data, size, is_packed);
 #endif
+  auto cached_data = GetCachedPackData(tensor_data, size);
+  if (cached_data != nullptr) {
+    *is_packed = true;
+    return cached_data;
+  }
   void *data = MallocData(size);
   *is_packed = false;
+  RecordPackData(tensor_data, size, data);
   return data;
 }
 
@@ -172,6 +241,9 @@ void PackWeightManager::FreeData(void *tensor_data) {
 }
 
 void PackWeightManager::Free(void *tensor_data) {
+  if (ReleaseCachedPackData(tensor_data)) {
+    return;
+  }
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     FreeData(tensor_data);
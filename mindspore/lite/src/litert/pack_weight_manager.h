@@ -16,11 +16,16 @@
 
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 #include <vector>
 #include "include/model.h"
 #include "include/errorcode.h"
 #include "src/tensor.h"
+#include "src/litert/pack_cache.h"
 #ifdef SHARING_MODEL_WEIGHT
 #include "src/litert/pack_weight.h"
 #endif
@@ -37,12 +42,21 @@ class PackWeightManager {
   void Free(void *tensor_data);
   bool IsCopyTensor(int op_type);
   void *ReplaceFp16Data(void *origin_fp16_data, size_t size, bool *replace);
+  STATUS InitPackCache(const std::string &cache_dir, const char *model_buf, size_t model_size);
+  STATUS SavePackCache(const char *model_buf);
+  void FreePackCache(const char *model_buf);
 
  private:
   void *MallocData(size_t size);
   void FreeData(void *tensor_data);
+  void *GetCachedPackData(const void *tensor_data, size_t size);
+  void RecordPackData(const void *tensor_data, size_t size, void *packed_data);
+  bool ReleaseCachedPackData(void *packed_data);
   PackWeightManager() = default;
   bool is_parallel_ = false;
+  std::mutex pack_cache_mtx_;
+  // model buf -> <pack cache, the number of sessions using it>
+  std::map<const char *, std::pair<std::shared_ptr<PackCache>, int>> pack_caches_;
 #ifdef SHARING_MODEL_WEIGHT
   std::shared_ptr<PackWeight> pack_weight_ = nullptr;
 #endif
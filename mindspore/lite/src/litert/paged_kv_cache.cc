@@ -0,0 +1,197 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/paged_kv_cache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "src/common/log_adapter.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr int kKeyIndex = 0;
+constexpr int kValueIndex = 1;
+constexpr int kKVNum = 2;
+}  // namespace
+
+PagedKVCache::~PagedKVCache() {
+  free(data_);
+  data_ = nullptr;
+}
+
+int PagedKVCache::Init() {
+  if (layer_num_ <= 0 || head_num_ <= 0 || head_size_ <= 0 || block_size_ <= 0 || block_num_ <= 0) {
+    MS_LOG(ERROR) << "invalid kv cache config, layer num: " << layer_num_ << ", head num: " << head_num_
+                  << ", head size: " << head_size_ << ", block size: " << block_size_ << ", block num: " << block_num_;
+    return RET_PARAM_INVALID;
+  }
+  token_size_ = static_cast<size_t>(head_num_) * head_size_;
+  auto total_size = static_cast<size_t>(block_num_) * layer_num_ * kKVNum * block_size_ * token_size_;
+  data_ = reinterpret_cast<float *>(malloc(total_size * sizeof(float)));
+  if (data_ == nullptr) {
+    MS_LOG(ERROR) << "malloc kv cache failed, size: " << total_size * sizeof(float);
+    return RET_MEMORY_FAILED;
+  }
+  free_blocks_.resize(block_num_);
+  // pop the blocks from the back, so the sequences get the blocks from the start of the storage first.
+  for (int i = 0; i < block_num_; ++i) {
+    free_blocks_[i] = block_num_ - 1 - i;
+  }
+  return RET_OK;
+}
+
+int PagedKVCache::AddSequence(int64_t seq_id) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (!sequences_.emplace(seq_id, Sequence()).second) {
+    MS_LOG(ERROR) << "sequence " << seq_id << " is already in the kv cache.";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+int PagedKVCache::RemoveSequence(int64_t seq_id) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    MS_LOG(ERROR) << "sequence " << seq_id << " is not in the kv cache.";
+    return RET_ERROR;
+  }
+  free_blocks_.insert(free_blocks_.end(), iter->second.blocks.rbegin(), iter->second.blocks.rend());
+  sequences_.erase(iter);
+  return RET_OK;
+}
+
+int PagedKVCache::Reserve(int64_t seq_id, int token_num) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    MS_LOG(ERROR) << "sequence " << seq_id << " is not in the kv cache.";
+    return RET_ERROR;
+  }
+  auto &seq = iter->second;
+  if (token_num <= 0 || seq.reserved != 0) {
+    MS_LOG(ERROR) << "reserve " << token_num << " tokens for sequence " << seq_id << " failed, reserved "
+                  << seq.reserved << " tokens not committed.";
+    return RET_ERROR;
+  }
+  auto need_block_num = (seq.length + token_num + block_size_ - 1) / block_size_;
+  auto new_block_num = need_block_num - static_cast<int>(seq.blocks.size());
+  if (new_block_num > static_cast<int>(free_blocks_.size())) {
+    MS_LOG(ERROR) << "the kv cache is out of blocks, need " << new_block_num << " blocks for sequence " << seq_id
+                  << ", but only " << free_blocks_.size() << " blocks are free.";
+    return RET_OUT_OF_TENSOR_RANGE;
+  }
+  for (int i = 0; i < new_block_num; ++i) {
+    seq.blocks.push_back(free_blocks_.back());
+    free_blocks_.pop_back();
+  }
+  seq.reserved = token_num;
+  return RET_OK;
+}
+
+int PagedKVCache::Append(int64_t seq_id, int layer, const float *key, const float *value) {
+  auto seq = GetSequence(seq_id);
+  if (seq == nullptr || layer < 0 || layer >= layer_num_ || key == nullptr || value == nullptr) {
+    MS_LOG(ERROR) << "append layer " << layer << " of sequence " << seq_id << " to kv cache failed.";
+    return RET_ERROR;
+  }
+  auto token_bytes = token_size_ * sizeof(float);
+  for (int i = 0; i < seq->reserved; ++i) {
+    auto token = seq->length + i;
+    (void)memcpy(GetTokenData(*seq, layer, kKeyIndex, token), key + i * token_size_, token_bytes);
+    (void)memcpy(GetTokenData(*seq, layer, kValueIndex, token), value + i * token_size_, token_bytes);
+  }
+  return RET_OK;
+}
+
+int PagedKVCache::Attention(int64_t seq_id, int layer, const float *query, float *output) {
+  auto seq = GetSequence(seq_id);
+  if (seq == nullptr || layer < 0 || layer >= layer_num_ || query == nullptr || output == nullptr) {
+    MS_LOG(ERROR) << "attention of layer " << layer << " of sequence " << seq_id << " failed.";
+    return RET_ERROR;
+  }
+  auto scale = 1.0f / std::sqrt(static_cast<float>(head_size_));
+  std::vector<float> scores(seq->length + seq->reserved);
+  for (int i = 0; i < seq->reserved; ++i) {
+    // the causal mask, the token attends to itself and the tokens before it.
+    auto token_num = seq->length + i + 1;
+    for (int h = 0; h < head_num_; ++h) {
+      auto head_offset = i * token_size_ + h * head_size_;
+      const float *q = query + head_offset;
+      float max_score = -INFINITY;
+      for (int t = 0; t < token_num; ++t) {
+        const float *k = GetTokenData(*seq, layer, kKeyIndex, t) + h * head_size_;
+        float score = 0.0f;
+        for (int d = 0; d < head_size_; ++d) {
+          score += q[d] * k[d];
+        }
+        scores[t] = score * scale;
+        max_score = std::max(max_score, scores[t]);
+      }
+      float sum = 0.0f;
+      for (int t = 0; t < token_num; ++t) {
+        scores[t] = std::exp(scores[t] - max_score);
+        sum += scores[t];
+      }
+      float *out = output + head_offset;
+      std::fill(out, out + head_size_, 0.0f);
+      for (int t = 0; t < token_num; ++t) {
+        const float *v = GetTokenData(*seq, layer, kValueIndex, t) + h * head_size_;
+        auto weight = scores[t] / sum;
+        for (int d = 0; d < head_size_; ++d) {
+          out[d] += weight * v[d];
+        }
+      }
+    }
+  }
+  return RET_OK;
+}
+
+int PagedKVCache::Commit(int64_t seq_id) {
+  auto seq = GetSequence(seq_id);
+  if (seq == nullptr) {
+    MS_LOG(ERROR) << "sequence " << seq_id << " is not in the kv cache.";
+    return RET_ERROR;
+  }
+  seq->length += seq->reserved;
+  seq->reserved = 0;
+  return RET_OK;
+}
+
+int PagedKVCache::GetSequenceLength(int64_t seq_id) {
+  auto seq = GetSequence(seq_id);
+  return seq == nullptr ? -1 : seq->length;
+}
+
+int PagedKVCache::free_block_num() {
+  std::lock_guard<std::mutex> lock(mtx_);
+  return static_cast<int>(free_blocks_.size());
+}
+
+PagedKVCache::Sequence *PagedKVCache::GetSequence(int64_t seq_id) {
+  // the node of the map is stable, and each sequence is only run by one step at a time, so only the lookup is locked.
+  std::lock_guard<std::mutex> lock(mtx_);
+  auto iter = sequences_.find(seq_id);
+  return iter == sequences_.end() ? nullptr : &iter->second;
+}
+
+float *PagedKVCache::GetTokenData(const Sequence &seq, int layer, int kv_index, int token) const {
+  auto block = static_cast<size_t>(seq.blocks[token / block_size_]);
+  auto offset = ((block * layer_num_ + layer) * kKVNum + kv_index) * block_size_ + token % block_size_;
+  return data_ + offset * token_size_;
+}
+}  // namespace mindspore::lite
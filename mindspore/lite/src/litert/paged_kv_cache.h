@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_PAGED_KV_CACHE_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_PAGED_KV_CACHE_H_
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+// the keys and values of the attention layers of the sequences in the incremental decoding, so each step only
+// computes the new tokens instead of the whole prefix, and the past keys and values are not copied in and out of the
+// model.
+// the storage is preallocated as fixed size blocks of block_size tokens, which hold the keys and values of all layers
+// of these tokens. the blocks of a sequence are allocated when the sequence grows and returned when it is removed, so
+// the sequences of different lengths share the storage without fragmentation.
+// each decoding step of a sequence calls Reserve for the new tokens, then Append and Attention for each layer, and
+// Commit at the end of the step.
+class PagedKVCache {
+ public:
+  PagedKVCache(int layer_num, int head_num, int head_size, int block_size, int block_num)
+      : layer_num_(layer_num), head_num_(head_num), head_size_(head_size), block_size_(block_size),
+        block_num_(block_num) {}
+  ~PagedKVCache();
+
+  int Init();
+  int AddSequence(int64_t seq_id);
+  int RemoveSequence(int64_t seq_id);
+  // allocate the blocks of token_num new tokens of the sequence, which fails if the free blocks are not enough.
+  int Reserve(int64_t seq_id, int token_num);
+  // write the keys and values of the reserved tokens of the layer in place, in the shape of
+  // [token_num, head_num, head_size].
+  int Append(int64_t seq_id, int layer, const float *key, const float *value);
+  // the causal attention of the queries of the reserved tokens over the committed and the reserved tokens of the
+  // layer, which reads the blocks directly. the query and the output are in the shape of [token_num, head_num,
+  // head_size].
+  int Attention(int64_t seq_id, int layer, const float *query, float *output);
+  int Commit(int64_t seq_id);
+
+  int GetSequenceLength(int64_t seq_id);
+  int free_block_num();
+
+ private:
+  struct Sequence {
+    int length = 0;
+    int reserved = 0;
+    std::vector<int> blocks;
+  };
+
+  Sequence *GetSequence(int64_t seq_id);
+  float *GetTokenData(const Sequence &seq, int layer, int kv_index, int token) const;
+
+  int layer_num_;
+  int head_num_;
+  int head_size_;
+  int block_size_;
+  int block_num_;
+  size_t token_size_ = 0;
+  float *data_ = nullptr;
+  std::mutex mtx_;
+  std::vector<int> free_blocks_;
+  std::map<int64_t, Sequence> sequences_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_PAGED_KV_CACHE_H_
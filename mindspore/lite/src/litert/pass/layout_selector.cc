@@ -0,0 +1,306 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/pass/layout_selector.h"
+#include <algorithm>
+#include <fstream>
+#include <queue>
+#include <sstream>
+#include "src/litert/pass/transpose_strategy.h"
+#include "include/errorcode.h"
+
+namespace mindspore::lite::pass {
+namespace {
+// the estimated bytes transposed per us for the tensor without profile, about 2GB/s for the nhwc <-> ncx packing.
+constexpr float kDefaultTransposeBytesPerUs = 2000.0f;
+constexpr double kInfiniteCost = 1e30;
+constexpr double kMinCapacity = 1e-9;
+const std::map<std::string, Format> kProfileFormats = {{"NHWC", NHWC}, {"NC4HW4", NC4HW4}, {"NC8HW8", NC8HW8}};
+
+std::string FormatName(Format format) {
+  auto iter = std::find_if(kProfileFormats.begin(), kProfileFormats.end(),
+                           [format](const auto &item) { return item.second == format; });
+  return iter == kProfileFormats.end() ? std::string("NHWC") : iter->first;
+}
+
+// the transpose can be moved through the kernel without axis attribute, like activation and arithmetic.
+bool IsLayoutTransparent(const kernel::KernelExec *kernel) {
+  auto iter = dynamic_format_kernel_lists.find(kernel->type());
+  return iter != dynamic_format_kernel_lists.end() && !iter->second;
+}
+
+kernel::KernelExec *FindProducer(const kernel::KernelExec *kernel, const Tensor *tensor) {
+  for (auto in_kernel : kernel->in_kernels()) {
+    auto &out_tensors = in_kernel->out_tensors();
+    if (std::find(out_tensors.begin(), out_tensors.end(), tensor) != out_tensors.end()) {
+      return in_kernel;
+    }
+  }
+  return nullptr;
+}
+
+// Collect the format related kernels producing the tensor through the layout transparent kernels, nullptr stands for
+// the graph input.
+void CollectProducers(const kernel::KernelExec *kernel, const Tensor *tensor, std::set<kernel::KernelExec *> *visited,
+                      std::set<kernel::KernelExec *> *ends) {
+  auto producer = FindProducer(kernel, tensor);
+  if (producer == nullptr || !IsLayoutTransparent(producer)) {
+    ends->insert(producer);
+    return;
+  }
+  if (!visited->insert(producer).second) {
+    return;
+  }
+  for (auto input : producer->in_tensors()) {
+    if (input != nullptr && !input->IsConst()) {
+      CollectProducers(producer, input, visited, ends);
+    }
+  }
+}
+
+// Collect the format related kernels consuming the outputs through the layout transparent kernels, nullptr stands for
+// the graph output.
+void CollectConsumers(const kernel::SubGraphKernel *subgraph, kernel::KernelExec *kernel,
+                      std::set<kernel::KernelExec *> *visited, std::set<kernel::KernelExec *> *ends) {
+  auto &graph_outputs = subgraph->out_tensors();
+  for (auto output : kernel->out_tensors()) {
+    if (std::find(graph_outputs.begin(), graph_outputs.end(), output) != graph_outputs.end()) {
+      ends->insert(nullptr);
+    }
+  }
+  for (auto out_kernel : kernel->out_kernels()) {
+    if (!IsLayoutTransparent(out_kernel)) {
+      ends->insert(out_kernel);
+      continue;
+    }
+    if (visited->insert(out_kernel).second) {
+      CollectConsumers(subgraph, out_kernel, visited, ends);
+    }
+  }
+}
+
+// Edmonds-Karp maximum flow, the nodes reachable from the source in the residual graph are on the source side of the
+// minimum cut.
+std::vector<bool> MinCutSourceSide(std::vector<std::vector<double>> *capacity, size_t source, size_t sink) {
+  auto node_num = capacity->size();
+  auto &cap = *capacity;
+  auto bfs = [&cap, node_num, source](std::vector<size_t> *parent) {
+    std::vector<bool> reached(node_num, false);
+    std::queue<size_t> nodes;
+    nodes.push(source);
+    reached[source] = true;
+    while (!nodes.empty()) {
+      auto node = nodes.front();
+      nodes.pop();
+      for (size_t next = 0; next < node_num; next++) {
+        if (!reached[next] && cap[node][next] > kMinCapacity) {
+          reached[next] = true;
+          (*parent)[next] = node;
+          nodes.push(next);
+        }
+      }
+    }
+    return reached;
+  };
+  std::vector<size_t> parent(node_num, source);
+  auto reached = bfs(&parent);
+  while (reached[sink]) {
+    double flow = kInfiniteCost;
+    for (auto node = sink; node != source; node = parent[node]) {
+      flow = std::min(flow, cap[parent[node]][node]);
+    }
+    for (auto node = sink; node != source; node = parent[node]) {
+      cap[parent[node]][node] -= flow;
+      cap[node][parent[node]] += flow;
+    }
+    reached = bfs(&parent);
+  }
+  return reached;
+}
+}  // namespace
+
+int LayoutSelector::LoadProfile(const std::string &profile_path) {
+  std::ifstream ifs(profile_path);
+  if (!ifs.good()) {
+    MS_LOG(ERROR) << "open layout profile " << profile_path << " failed.";
+    return RET_ERROR;
+  }
+  op_latency_.clear();
+  edge_cost_.clear();
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string kind;
+    std::string name;
+    iss >> kind >> name;
+    if (kind == "op") {
+      std::string format;
+      float latency = 0;
+      iss >> format >> latency;
+      auto iter = kProfileFormats.find(format);
+      if (iss.fail() || iter == kProfileFormats.end() || latency < 0) {
+        MS_LOG(ERROR) << "invalid op line in layout profile: " << line;
+        return RET_ERROR;
+      }
+      auto &op_latency = op_latency_[name];
+      (iter->second == NHWC ? op_latency.nhwc_ : op_latency.ncx_) = latency;
+    } else if (kind == "edge") {
+      float cost = 0;
+      iss >> cost;
+      if (iss.fail() || cost < 0) {
+        MS_LOG(ERROR) << "invalid edge line in layout profile: " << line;
+        return RET_ERROR;
+      }
+      edge_cost_[name] = cost;
+    } else {
+      MS_LOG(ERROR) << "invalid line in layout profile: " << line;
+      return RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+int LayoutSelector::LoadPlan(const std::string &plan_path) {
+  std::ifstream ifs(plan_path);
+  if (!ifs.good()) {
+    return RET_NO_CHANGE;
+  }
+  std::map<std::string, Format> plan;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string name;
+    std::string format;
+    iss >> name >> format;
+    auto iter = kProfileFormats.find(format);
+    if (iss.fail() || iter == kProfileFormats.end()) {
+      MS_LOG(WARNING) << "invalid line in layout plan " << plan_path << ": " << line;
+      return RET_ERROR;
+    }
+    plan[name] = iter->second;
+  }
+  plan_ = std::move(plan);
+  return RET_OK;
+}
+
+int LayoutSelector::ExportPlan(const std::string &plan_path) const {
+  std::ofstream ofs(plan_path, std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(ERROR) << "open layout plan " << plan_path << " failed.";
+    return RET_ERROR;
+  }
+  for (auto &item : plan_) {
+    ofs << item.first << " " << FormatName(item.second) << "\n";
+  }
+  ofs.close();
+  return ofs.good() ? RET_OK : RET_ERROR;
+}
+
+float LayoutSelector::TransposeCost(const Tensor *tensor) const {
+  auto iter = edge_cost_.find(tensor->tensor_name());
+  if (iter != edge_cost_.end()) {
+    return iter->second;
+  }
+  return static_cast<float>(tensor->Size()) / kDefaultTransposeBytesPerUs;
+}
+
+void LayoutSelector::SolvePlan(const kernel::SubGraphKernel *subgraph,
+                               const std::vector<kernel::KernelExec *> &candidates, Format ncx_format) {
+  auto node_num = candidates.size();
+  auto source = node_num;
+  auto sink = node_num + 1;
+  std::map<kernel::KernelExec *, size_t> indexes;
+  for (size_t i = 0; i < node_num; i++) {
+    indexes[candidates[i]] = i;
+  }
+  // The source side is the ncx format and the sink side is nhwc, so the edge from the source is cut by the nhwc kernel
+  // and the edge to the sink is cut by the ncx kernel. The edge between the candidates is cut by the transpose
+  // between them, and the transpose at the boundary is paid by the ncx kernel.
+  std::vector<std::vector<double>> capacity(node_num + 2, std::vector<double>(node_num + 2, 0));
+  for (size_t i = 0; i < node_num; i++) {
+    auto kernel = candidates[i];
+    auto latency_iter = op_latency_.find(kernel->name());
+    bool profiled =
+      latency_iter != op_latency_.end() && latency_iter->second.nhwc_ >= 0 && latency_iter->second.ncx_ >= 0;
+    // the kernel without profile keeps the ncx format.
+    double ncx_cost = profiled ? latency_iter->second.ncx_ : 0;
+    double nhwc_cost = profiled ? latency_iter->second.nhwc_ : kInfiniteCost;
+
+    std::set<kernel::KernelExec *> visited;
+    std::set<kernel::KernelExec *> ends;
+    auto input = kernel->in_tensors().front();
+    double input_cost = TransposeCost(input);
+    CollectProducers(kernel, input, &visited, &ends);
+    bool boundary = false;
+    for (auto end : ends) {
+      auto iter = indexes.find(end);
+      if (iter == indexes.end()) {
+        boundary = true;
+        continue;
+      }
+      capacity[i][iter->second] += input_cost;
+      capacity[iter->second][i] += input_cost;
+    }
+    ncx_cost += boundary ? input_cost : 0;
+
+    // the transpose between the candidates is counted by the input of the consumer.
+    visited.clear();
+    ends.clear();
+    CollectConsumers(subgraph, kernel, &visited, &ends);
+    if (std::any_of(ends.begin(), ends.end(), [&indexes](auto end) { return indexes.find(end) == indexes.end(); })) {
+      ncx_cost += TransposeCost(kernel->out_tensors().front());
+    }
+    capacity[source][i] = nhwc_cost;
+    capacity[i][sink] = ncx_cost;
+  }
+
+  auto ncx_side = MinCutSourceSide(&capacity, source, sink);
+  size_t ncx_num = 0;
+  for (size_t i = 0; i < node_num; i++) {
+    plan_[candidates[i]->name()] = ncx_side[i] ? ncx_format : NHWC;
+    ncx_num += ncx_side[i] ? 1 : 0;
+  }
+  MS_LOG(INFO) << "layout selector runs " << ncx_num << " of " << node_num << " kernels of " << subgraph->name()
+               << " in " << FormatName(ncx_format);
+}
+
+void LayoutSelector::Select(kernel::SubGraphKernel *subgraph, const std::set<schema::PrimitiveType> &candidate_types,
+                            Format ncx_format, std::set<std::string> *nhwc_kernels) {
+  std::vector<kernel::KernelExec *> candidates;
+  for (auto kernel : subgraph->nodes()) {
+    if (candidate_types.find(kernel->type()) != candidate_types.end() && plan_.find(kernel->name()) == plan_.end() &&
+        !kernel->in_tensors().empty() && !kernel->out_tensors().empty()) {
+      candidates.push_back(kernel);
+    }
+  }
+  if (!candidates.empty() && !op_latency_.empty()) {
+    SolvePlan(subgraph, candidates, ncx_format);
+  }
+  for (auto kernel : subgraph->nodes()) {
+    auto iter = plan_.find(kernel->name());
+    if (candidate_types.find(kernel->type()) != candidate_types.end() && iter != plan_.end() &&
+        iter->second == NHWC) {
+      nhwc_kernels->insert(kernel->name());
+    }
+  }
+}
+}  // namespace mindspore::lite::pass
@@ -0,0 +1,69 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_PASS_LAYOUT_SELECTOR_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_PASS_LAYOUT_SELECTOR_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "src/litert/kernel_exec.h"
+#include "src/litert/sub_graph_kernel.h"
+#include "schema/ops_generated.h"
+
+namespace mindspore::lite::pass {
+/* LayoutSelector
+ * Select the executed format of the format related kernels, NHWC or the runtime NCX format (NC4HW4 for fp32 and
+ * NC8HW8 for fp16), by the on-device latency profile instead of turning all of them to the NCX format.
+ * The kernel time plus the transpose cost is minimized globally over the subgraph, which is a binary labeling with
+ * the pairwise transpose cost between the neighbouring kernels in different formats, and is solved exactly by the
+ * minimum cut.
+ * The profile lines are "op <kernel_name> <NHWC|NC4HW4|NC8HW8> <latency>" and "edge <tensor_name> <latency>", where
+ * the edge is the cost of transposing the tensor, and the cost of the tensor without profile is estimated by its size.
+ * The plan lines are "<kernel_name> <NHWC|NC4HW4|NC8HW8>", and the kernel without profile or plan keeps the NCX
+ * format as before. */
+class LayoutSelector {
+ public:
+  LayoutSelector() = default;
+  ~LayoutSelector() = default;
+
+  int LoadProfile(const std::string &profile_path);
+  // return RET_NO_CHANGE if the plan does not exist.
+  int LoadPlan(const std::string &plan_path);
+  int ExportPlan(const std::string &plan_path) const;
+
+  // The candidate kernels of the subgraph kept in NHWC are added to nhwc_kernels.
+  void Select(kernel::SubGraphKernel *subgraph, const std::set<schema::PrimitiveType> &candidate_types,
+              Format ncx_format, std::set<std::string> *nhwc_kernels);
+
+ private:
+  struct OpLatency {
+    float nhwc_ = -1.0f;
+    float ncx_ = -1.0f;
+  };
+
+  float TransposeCost(const Tensor *tensor) const;
+  void SolvePlan(const kernel::SubGraphKernel *subgraph, const std::vector<kernel::KernelExec *> &candidates,
+                 Format ncx_format);
+
+  std::map<std::string, OpLatency> op_latency_;
+  std::map<std::string, float> edge_cost_;
+  // the selected format of the candidate kernels, loaded from the plan or solved by the profile.
+  std::map<std::string, Format> plan_;
+};
+}  // namespace mindspore::lite::pass
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_PASS_LAYOUT_SELECTOR_H_
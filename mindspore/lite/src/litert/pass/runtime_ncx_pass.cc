@@ -17,11 +17,14 @@
 #include "src/litert/pass/runtime_ncx_pass.h"
 #include <set>
 #include <memory>
+#include <string>
 #ifdef ENABLE_RUNTIME_NCX_PASS
 #include "src/litert/pass/runtime_optimizer.h"
 #include "src/litert/pass/to_nchw_format.h"
 #include "src/litert/pass/decrease_transpose_algo.h"
 #include "src/litert/pass/infershape_pass.h"
+#include "src/litert/pass/layout_selector.h"
+#include "src/common/common.h"
 #endif
 
 namespace mindspore::lite::pass {
@@ -45,10 +48,50 @@ bool RuntimeNCXPassVaild(kernel::SubGraphKernel *subgraph) {
   }
   return true;
 }
+
+// return RET_NO_CHANGE when the layout selection is not configured.
+int InitLayoutSelector(const std::map<std::string, std::map<std::string, std::string>> *config_info,
+                       LayoutSelector *selector, std::string *plan_path, bool *plan_loaded) {
+  if (config_info == nullptr) {
+    return RET_NO_CHANGE;
+  }
+  auto select_iter = config_info->find(kLayoutSelect);
+  if (select_iter == config_info->end()) {
+    return RET_NO_CHANGE;
+  }
+  auto get_config = [&select_iter](const std::string &key) {
+    auto iter = select_iter->second.find(key);
+    return iter == select_iter->second.end() ? std::string() : iter->second;
+  };
+  *plan_path = get_config(kLayoutSelectPlanPath);
+  auto profile_path = get_config(kLayoutSelectProfilePath);
+  auto ret = plan_path->empty() ? RET_NO_CHANGE : selector->LoadPlan(*plan_path);
+  *plan_loaded = ret == RET_OK;
+  if (*plan_loaded) {
+    return RET_OK;
+  }
+  if (profile_path.empty()) {
+    MS_LOG(ERROR) << "neither layout plan nor layout profile is valid.";
+    return RET_ERROR;
+  }
+  if (selector->LoadProfile(profile_path) != RET_OK) {
+    MS_LOG(ERROR) << "load layout profile failed.";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
 #endif
 
-int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Tensor *> *tensors) {
+int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Tensor *> *tensors,
+                   const std::map<std::string, std::map<std::string, std::string>> *config_info) {
 #ifdef ENABLE_RUNTIME_NCX_PASS
+  LayoutSelector selector;
+  std::string plan_path;
+  bool plan_loaded = false;
+  auto select_ret = InitLayoutSelector(config_info, &selector, &plan_path, &plan_loaded);
+  if (select_ret == RET_ERROR) {
+    return RET_ERROR;
+  }
   for (auto subgraph : *subgraphs) {
     if (subgraph->desc().arch == kernel::kDelegate) {
       continue;
@@ -60,7 +103,11 @@ int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Ten
 
     RuntimeOptimizer optimize;
     Format runtime_format = subgraph->subgraph_type() == kernel::kCpuFP32SubGraph ? NC4HW4 : NC8HW8;
-    optimize.AddPass(std::make_shared<ToNCHWFormat>(NHWC, runtime_format, ncxhwx_kernels));
+    std::set<std::string> nhwc_kernels;
+    if (select_ret == RET_OK) {
+      selector.Select(graph, ncxhwx_kernels, runtime_format, &nhwc_kernels);
+    }
+    optimize.AddPass(std::make_shared<ToNCHWFormat>(NHWC, runtime_format, ncxhwx_kernels, nhwc_kernels));
     optimize.AddPass(std::make_shared<DecreaseTransposeAlgo>(runtime_format));
     optimize.AddPass(std::make_shared<Infershape>());
     auto ret = optimize.Run(graph, tensors);
@@ -69,6 +116,9 @@ int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Ten
       return RET_ERROR;
     }
   }
+  if (select_ret == RET_OK && !plan_loaded && !plan_path.empty() && selector.ExportPlan(plan_path) != RET_OK) {
+    MS_LOG(WARNING) << "export layout plan to " << plan_path << " failed.";
+  }
 #endif
   return RET_OK;
 }
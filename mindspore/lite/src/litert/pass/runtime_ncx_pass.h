@@ -17,12 +17,16 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_PASS_RUNTIME_NCX_PASS_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_PASS_RUNTIME_NCX_PASS_H_
 
+#include <map>
+#include <string>
 #include <vector>
 #include "src/litert/kernel_exec.h"
 #include "src/litert/sub_graph_kernel.h"
 
 namespace mindspore::lite::pass {
-// To support NC4HW4(fp32) or NC8HW8(fp16) runtime kernel.
-int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Tensor *> *tensors);
+// To support NC4HW4(fp32) or NC8HW8(fp16) runtime kernel, the kernels run in NC4HW4 or NC8HW8 are selected by the
+// layout profile of the config when it is set.
+int RuntimeNCXPass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Tensor *> *tensors,
+                   const std::map<std::string, std::map<std::string, std::string>> *config_info = nullptr);
 }  // namespace mindspore::lite::pass
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_PASS_RUNTIME_NCX_PASS_H_
@@ -104,7 +104,8 @@ int ToNCHWFormat::Run(kernel::SubGraphKernel *subgraph, std::vector<Tensor *> *t
   for (size_t i = 0; i < origin_kernel_size; i++) {
     auto kernel = kernels.at(i);
     CHECK_NULL_RETURN(kernel);
-    if (to_trans_kernels_.find(kernel->type()) == to_trans_kernels_.end()) {
+    if (to_trans_kernels_.find(kernel->type()) == to_trans_kernels_.end() ||
+        kept_kernels_.find(kernel->name()) != kept_kernels_.end()) {
       continue;
     }
 
@@ -19,6 +19,7 @@
 
 #include <vector>
 #include <set>
+#include <string>
 #include "src/litert/kernel_exec.h"
 #include "src/litert/pass/runtime_optimizer.h"
 #include "schema/ops_generated.h"
@@ -36,8 +37,12 @@ namespace mindspore::lite::pass {
 
 class ToNCHWFormat : public RuntimePass {
  public:
-  ToNCHWFormat(Format src_format, Format dst_format, std::set<schema::PrimitiveType> to_trans_kernels)
-      : src_format_(src_format), dst_format_(dst_format), to_trans_kernels_(to_trans_kernels) {}
+  ToNCHWFormat(Format src_format, Format dst_format, std::set<schema::PrimitiveType> to_trans_kernels,
+               std::set<std::string> kept_kernels = {})
+      : src_format_(src_format),
+        dst_format_(dst_format),
+        to_trans_kernels_(to_trans_kernels),
+        kept_kernels_(kept_kernels) {}
   ~ToNCHWFormat() override = default;
   int Run(kernel::SubGraphKernel *subgraph, std::vector<Tensor *> *tensors) override;
 
@@ -54,6 +59,8 @@ class ToNCHWFormat : public RuntimePass {
   /* to_trans_kernels_ contains the specific kernels that will be changed it's  executed format. */
   /* In ToNCHWFormat Run function, the pre and post transpose kernels are inserted to ensure the format in the graph. */
   std::set<schema::PrimitiveType> to_trans_kernels_;
+  /* kept_kernels_ contains the names of the kernels of to_trans_kernels_ that keep the src_format_. */
+  std::set<std::string> kept_kernels_;
 };
 }  // namespace mindspore::lite::pass
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_PASS_TO_NCHW_FORMAT_H_
@@ -15,6 +15,9 @@
  */
 
 #include "src/litert/runtime_allocator.h"
+#include <algorithm>
+#include <limits>
+#include "src/common/log_adapter.h"
 
 namespace mindspore {
 RuntimeAllocator::RuntimeAllocator(size_t aligned_size) {
@@ -50,6 +53,11 @@ size_t RuntimeAllocator::FindMinFree(size_t size) {
 
 void RuntimeAllocator::FreeTensorData(lite::Tensor *tensor) {
   size_t offset = offset_map_[tensor];
+  auto live_iter = live_buffers_.find(offset);
+  if (live_iter != live_buffers_.end()) {
+    buffers_[live_iter->second].end_ = event_id_++;
+    live_buffers_.erase(live_iter);
+  }
   free_list_[offset] = used_list_[offset];
   used_list_.erase(offset);
 
@@ -76,9 +84,23 @@ void RuntimeAllocator::FreeTensorData(lite::Tensor *tensor) {
 
 void RuntimeAllocator::SetDataOffset(lite::Tensor *tensor, size_t offset) {
   offset_map_[tensor] = offset;
+  auto live_iter = live_buffers_.find(offset);
+  if (live_iter != live_buffers_.end()) {
+    tensor_buffers_[tensor] = live_iter->second;
+  }
   return;
 }
 
+void RuntimeAllocator::RestorePlan(const std::unordered_map<lite::Tensor *, size_t> &offset_map, size_t total_size) {
+  offset_map_ = offset_map;
+  total_size_ = total_size;
+  free_list_.clear();
+  used_list_.clear();
+  buffers_.clear();
+  live_buffers_.clear();
+  tensor_buffers_.clear();
+}
+
 void RuntimeAllocator::Clear(AllocatorPtr default_allocator) {
   total_size_ = 0;
   for (auto iter : offset_map_) {
@@ -92,6 +114,10 @@ void RuntimeAllocator::Clear(AllocatorPtr default_allocator) {
   offset_map_.clear();
   free_list_.clear();
   used_list_.clear();
+  buffers_.clear();
+  live_buffers_.clear();
+  tensor_buffers_.clear();
+  event_id_ = 0;
 }
 
 void RuntimeAllocator::MallocTensorData(lite::Tensor *tensor) {
@@ -119,5 +145,70 @@ void RuntimeAllocator::MallocTensorData(lite::Tensor *tensor) {
 
   used_list_[offset] = size;
   offset_map_[tensor] = offset;
+  live_buffers_[offset] = buffers_.size();
+  tensor_buffers_[tensor] = buffers_.size();
+  buffers_.push_back({size, event_id_++, std::numeric_limits<size_t>::max(), 0});
+}
+
+// best-fit decreasing: the larger buffers are placed first, each buffer is placed to the smallest gap between the
+// placed buffers whose lifetime overlaps with it.
+size_t RuntimeAllocator::SolveBufferOffsets() {
+  std::vector<size_t> order(buffers_.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [this](size_t a, size_t b) { return buffers_[a].size_ > buffers_[b].size_; });
+  std::vector<size_t> placed;
+  size_t total_size = 0;
+  for (auto id : order) {
+    auto &buffer = buffers_[id];
+    std::vector<std::pair<size_t, size_t>> conflicts; /* offset, end offset */
+    for (auto placed_id : placed) {
+      auto &other = buffers_[placed_id];
+      if (buffer.start_ < other.end_ && other.start_ < buffer.end_) {
+        conflicts.emplace_back(other.offset_, other.offset_ + other.size_);
+      }
+    }
+    std::sort(conflicts.begin(), conflicts.end());
+    size_t best_offset = 0;
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    size_t gap_begin = 0;
+    for (auto &conflict : conflicts) {
+      if (conflict.first > gap_begin) {
+        auto gap = conflict.first - gap_begin;
+        if (gap >= buffer.size_ && gap < best_gap) {
+          best_gap = gap;
+          best_offset = gap_begin;
+        }
+      }
+      gap_begin = std::max(gap_begin, conflict.second);
+    }
+    buffer.offset_ = best_gap == std::numeric_limits<size_t>::max() ? gap_begin : best_offset;
+    total_size = std::max(total_size, buffer.offset_ + buffer.size_);
+    placed.push_back(id);
+  }
+  return total_size;
+}
+
+void RuntimeAllocator::OptimizePlan() {
+  if (buffers_.empty() || data_ != nullptr) {
+    return;
+  }
+  for (auto &item : offset_map_) {
+    if (tensor_buffers_.find(item.first) == tensor_buffers_.end()) {
+      MS_LOG(DEBUG) << "The buffer of tensor " << item.first->tensor_name() << " is unknown, keep the greedy plan.";
+      return;
+    }
+  }
+  auto total_size = SolveBufferOffsets();
+  MS_LOG(DEBUG) << "Runtime allocator greedy plan size: " << total_size_ << ", optimized plan size: " << total_size;
+  if (total_size >= total_size_) {
+    return;
+  }
+  for (auto &item : offset_map_) {
+    item.second = buffers_[tensor_buffers_[item.first]].offset_;
+  }
+  total_size_ = total_size;
 }
 }  // namespace mindspore
@@ -20,6 +20,7 @@
 #include <memory>
 #include <map>
 #include <unordered_map>
+#include <vector>
 #include "include/api/allocator.h"
 #include "include/errorcode.h"
 #include "src/tensor.h"
@@ -44,17 +45,36 @@ class RuntimeAllocator : public Allocator {
   void FreeTensorData(lite::Tensor *tensor);
   void *MallocOptData();
   const std::unordered_map<lite::Tensor *, size_t> &GetOffsetMap() const { return offset_map_; }
+  size_t total_size() const { return total_size_; }
+  // restore the offsets planned before, the data is malloced by MallocOptData.
+  void RestorePlan(const std::unordered_map<lite::Tensor *, size_t> &offset_map, size_t total_size);
   void Clear(AllocatorPtr default_allocator);
+  // replan the offsets by the lifetime of the buffers recorded in MallocTensorData and FreeTensorData, the greedy
+  // offsets are kept if the replanned total size is not smaller.
+  void OptimizePlan();
 
  private:
   size_t FindMinFree(size_t size);
 
+  // the buffer lives from the malloc event to the free event.
+  struct BufferInterval {
+    size_t size_;
+    size_t start_;
+    size_t end_;
+    size_t offset_;
+  };
+  size_t SolveBufferOffsets();
+
  private:
   void *data_ = nullptr;
   size_t total_size_ = 0;
   std::unordered_map<lite::Tensor *, size_t> offset_map_;
   std::map<size_t, size_t> free_list_; /* offset, size */
   std::map<size_t, size_t> used_list_; /* offset, size */
+  std::vector<BufferInterval> buffers_;
+  std::map<size_t, size_t> live_buffers_; /* offset, buffer id */
+  std::unordered_map<lite::Tensor *, size_t> tensor_buffers_; /* tensor, buffer id */
+  size_t event_id_ = 0;
 };
 
 using RuntimeAllocatorPtr = std::shared_ptr<RuntimeAllocator>;
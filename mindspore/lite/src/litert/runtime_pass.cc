@@ -15,7 +15,11 @@
  */
 
 #include "src/litert/runtime_pass.h"
+#include <algorithm>
 #include "nnacl/conv_parameter.h"
+#include "nnacl/matmul_parameter.h"
+#include "nnacl/arithmetic.h"
+#include "nnacl/fp32/activation_fp32.h"
 
 namespace mindspore::lite {
 #ifndef RUNTIME_PASS_CLIP
@@ -253,6 +257,209 @@ void ConvNormC4PassAct(std::vector<kernel::KernelExec *> *kernels) {
   return;
 }
 
+bool IsFp32BuiltinKernel(const kernel::KernelExec *kernel) {
+  return kernel->desc().arch == kernel::KERNEL_ARCH::kCPU && kernel->desc().data_type == kNumberTypeFloat32 &&
+         kernel->desc().provider == kernel::kBuiltin && kernel->op_parameter() != nullptr &&
+         kernel->op_parameter()->quant_type_ == schema::QuantType_QUANT_NONE &&
+         !kernel->op_parameter()->is_train_session_;
+}
+
+bool IsShapeKnown(const Tensor *tensor) {
+  auto shape = tensor->shape();
+  return std::all_of(shape.begin(), shape.end(), [](int dim) { return dim > 0; });
+}
+
+// the operand is ready when the matmul runs, it is const or computed by the kernels before the matmul.
+bool IsEpilogueOperandReady(const std::vector<kernel::KernelExec *> &kernels, const kernel::KernelExec *matmul,
+                            const Tensor *operand) {
+  if (operand->IsConst()) {
+    return true;
+  }
+  auto matmul_iter = std::find(kernels.begin(), kernels.end(), matmul);
+  for (auto iter = kernels.begin(); iter != matmul_iter; ++iter) {
+    if (IsContain((*iter)->out_tensors(), const_cast<Tensor *>(operand))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool GetEpilogueBroadcast(const Tensor *out, const Tensor *operand, int *broadcast) {
+  if (!IsShapeKnown(operand)) {
+    return false;
+  }
+  if (operand->shape() == out->shape()) {
+    *broadcast = EpilogueBroadcast_None;
+  } else if (operand->ElementsNum() == 1) {
+    *broadcast = EpilogueBroadcast_Scalar;
+  } else if (operand->ElementsNum() == out->shape().back() && operand->shape().back() == out->shape().back()) {
+    *broadcast = EpilogueBroadcast_Col;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool GetActEpilogueOp(int act_type, EpilogueOp *op) {
+  if (act_type == ActType_Relu) {
+    op->type_ = EpilogueOp_Relu;
+  } else if (act_type == ActType_Relu6) {
+    op->type_ = EpilogueOp_Relu6;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// match the elementwise kernel consuming the tensor, return the epilogue ops of it, and the operand for add and mul.
+bool MatchEpilogueKernel(const std::vector<kernel::KernelExec *> &kernels, const kernel::KernelExec *matmul,
+                         const kernel::KernelExec *kernel, const Tensor *in, std::vector<EpilogueOp> *ops,
+                         Tensor **operand) {
+  if (!IsFp32BuiltinKernel(kernel) || kernel->out_tensors().size() != 1 ||
+      kernel->out_tensors().front()->shape() != in->shape()) {
+    return false;
+  }
+  *operand = nullptr;
+  if (kernel->type() == schema::PrimitiveType_AddFusion || kernel->type() == schema::PrimitiveType_MulFusion) {
+    auto &inputs = kernel->in_tensors();
+    if (inputs.size() != C2NUM || inputs[0] == inputs[1] || (inputs[0] != in && inputs[1] != in)) {
+      return false;
+    }
+    *operand = inputs[0] == in ? inputs[1] : inputs[0];
+    EpilogueOp op = {kernel->type() == schema::PrimitiveType_AddFusion ? EpilogueOp_Add : EpilogueOp_Mul, 0, 0};
+    if ((*operand)->data_type() != kNumberTypeFloat32 || !GetEpilogueBroadcast(in, *operand, &op.broadcast_) ||
+        !IsEpilogueOperandReady(kernels, matmul, *operand)) {
+      return false;
+    }
+    ops->push_back(op);
+    auto act_type = reinterpret_cast<ArithmeticParameter *>(kernel->op_parameter())->activation_type_;
+    EpilogueOp act_op = {0, 0, 0};
+    if (GetActEpilogueOp(act_type, &act_op)) {
+      ops->push_back(act_op);
+    } else if (act_type != ActType_No) {
+      return false;
+    }
+    return true;
+  }
+  if (kernel->type() == schema::PrimitiveType_Activation && kernel->in_tensors().size() == 1) {
+    auto param = reinterpret_cast<ActivationParameter *>(kernel->op_parameter());
+    EpilogueOp op = {0, 0, 0};
+    if (param->type_ == schema::ActivationType_RELU) {
+      op.type_ = EpilogueOp_Relu;
+    } else if (param->type_ == schema::ActivationType_RELU6) {
+      op.type_ = EpilogueOp_Relu6;
+    } else if (param->type_ == schema::ActivationType_SIGMOID) {
+      op.type_ = EpilogueOp_Sigmoid;
+    } else if (param->type_ == schema::ActivationType_GELU) {
+      op.type_ = param->approximate_ ? EpilogueOp_GeluTanh : EpilogueOp_Gelu;
+    } else {
+      return false;
+    }
+    ops->push_back(op);
+    return true;
+  }
+  return false;
+}
+
+void MatmulEpiloguePassReplace(std::vector<kernel::KernelExec *> *kernels, std::vector<Tensor *> *tensors,
+                               kernel::KernelExec *matmul, const std::vector<kernel::KernelExec *> &fused_kernels,
+                               const std::vector<Tensor *> &operands, const std::vector<EpilogueOp> &ops) {
+  auto param = reinterpret_cast<MatMulParameter *>(matmul->op_parameter());
+  auto in_tensors = matmul->in_tensors();
+  auto in_kernels = matmul->in_kernels();
+  size_t operand_index = 0;
+  for (auto op : ops) {
+    if (op.type_ == EpilogueOp_Add || op.type_ == EpilogueOp_Mul) {
+      auto operand = operands[operand_index++];
+      op.input_index_ = static_cast<int>(in_tensors.size());
+      in_tensors.push_back(operand);
+      for (auto fused : fused_kernels) {
+        for (auto producer : fused->in_kernels()) {
+          if (IsContain(producer->out_tensors(), operand) && !IsContain(in_kernels, producer)) {
+            in_kernels.push_back(producer);
+          }
+        }
+      }
+    }
+    param->epilogue_.ops_[param->epilogue_.op_num_++] = op;
+  }
+  for (auto producer : in_kernels) {
+    auto out_kernels = producer->out_kernels();
+    for (auto fused : fused_kernels) {
+      (void)VectorReplace(&out_kernels, fused, matmul);
+    }
+    producer->set_out_kernels(out_kernels);
+  }
+  auto last = fused_kernels.back();
+  for (auto post : last->out_kernels()) {
+    auto post_in_kernels = post->in_kernels();
+    (void)VectorReplace(&post_in_kernels, last, matmul);
+    post->set_in_kernels(post_in_kernels);
+  }
+  matmul->set_in_tensors(in_tensors);
+  matmul->set_in_kernels(in_kernels);
+  matmul->set_out_kernels(last->out_kernels());
+
+  std::vector<Tensor *> dead_tensors = {matmul->out_tensors().front()};
+  for (size_t i = 0; i + 1 < fused_kernels.size(); ++i) {
+    dead_tensors.push_back(fused_kernels[i]->out_tensors().front());
+  }
+  matmul->set_out_tensors({last->out_tensors().front()});
+  for (auto fused : fused_kernels) {
+    (void)VectorErase(kernels, fused);
+    delete fused;
+  }
+  for (auto tensor : dead_tensors) {
+    (void)VectorSetNull(tensors, tensor);
+    delete tensor;
+  }
+}
+
+void MatmulEpiloguePass(kernel::SubGraphKernel *subgraph, std::vector<Tensor *> *tensors) {
+  auto &kernels = subgraph->nodes();
+  auto in_nodes = subgraph->in_nodes();
+  auto out_nodes = subgraph->out_nodes();
+  for (size_t index = 0; index < kernels.size(); ++index) {
+    auto matmul = kernels[index];
+    if (!IsContain(MatmulEpilogueOpList, static_cast<schema::PrimitiveType>(matmul->type())) ||
+        !IsFp32BuiltinKernel(matmul) || matmul->out_tensors().size() != 1 ||
+        reinterpret_cast<MatMulParameter *>(matmul->op_parameter())->epilogue_.op_num_ != 0) {
+      continue;
+    }
+    std::vector<kernel::KernelExec *> fused_kernels;
+    std::vector<Tensor *> operands;
+    std::vector<EpilogueOp> ops;
+    auto cur = matmul;
+    while (true) {
+      auto out = cur->out_tensors().front();
+      if (out->IsGraphOutput() || out->shape().empty() || !IsShapeKnown(out) || cur->out_kernels().size() != 1 ||
+          IsContain(out_nodes, cur)) {
+        break;
+      }
+      auto next = cur->out_kernels().front();
+      std::vector<EpilogueOp> next_ops;
+      Tensor *operand = nullptr;
+      // the fused kernels are deleted, so they must not be referred by the subgraph.
+      if (!IsContain(kernels, next) || IsContain(in_nodes, next) || IsContain(out_nodes, next) ||
+          !MatchEpilogueKernel(kernels, matmul, next, out, &next_ops, &operand) ||
+          ops.size() + next_ops.size() > MAX_EPILOGUE_OP_NUM) {
+        break;
+      }
+      fused_kernels.push_back(next);
+      if (operand != nullptr) {
+        operands.push_back(operand);
+      }
+      ops.insert(ops.end(), next_ops.begin(), next_ops.end());
+      cur = next;
+    }
+    if (fused_kernels.empty()) {
+      continue;
+    }
+    MS_LOG(INFO) << "fuse " << fused_kernels.size() << " elementwise kernels into " << matmul->name();
+    MatmulEpiloguePassReplace(&kernels, tensors, matmul, fused_kernels, operands, ops);
+  }
+}
+
 STATUS DeleteRedundantTrans(std::vector<kernel::KernelExec *> *kernels) {
   for (auto *pre_kernel : *kernels) {
     if (pre_kernel->subgraph_type() != kernel::kNotSubGraph) {
@@ -325,6 +532,7 @@ STATUS RuntimePass(std::vector<kernel::KernelExec *> *subgraphs, std::vector<Ten
       MS_LOG(ERROR) << "DeleteRedundantTrans failed.";
       return RET_ERROR;
     }
+    MatmulEpiloguePass(sub, tensors);
   }
 #endif
   return RET_OK;
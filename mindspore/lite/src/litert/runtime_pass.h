@@ -46,6 +46,16 @@ static const std::vector<schema::PrimitiveType> Nc4hw4FormatInOpList = {schema::
 static const schema::PrimitiveType ConvNormC4OpConv2DFusion = schema::PrimitiveType_Conv2DFusion;
 static const schema::PrimitiveType ConvNormC4OpActivation = schema::PrimitiveType_Activation;
 static const schema::PrimitiveType ConvNormC4OpInstanceNorm = schema::PrimitiveType_InstanceNorm;
+
+/*
+ * MatmulEpilogue PASS
+ * before  : -- MATMUL --(out)-- ADD(residual) --(out)-- MUL --(out)-- ACT(gelu) --
+ * after   : -- MATMUL(+residual, +mul, +gelu) --
+ * the operands of add and mul are appended to the inputs of the matmul, and the chain is applied to the output tile of
+ * each matmul task, so the intermediate tensors are never written to memory.
+ * */
+static const std::vector<schema::PrimitiveType> MatmulEpilogueOpList = {schema::PrimitiveType_MatMulFusion,
+                                                                        schema::PrimitiveType_FullConnection};
 #endif
 }  // namespace mindspore::lite
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_RUNTIME_PASS_H_
@@ -25,6 +25,7 @@
 #include "include/errorcode.h"
 #include "src/common/graph_util.h"
 #include "src/common/utils.h"
+#include "src/common/common.h"
 #include "src/litert/kernel_registry.h"
 #ifndef CUSTOM_KERNEL_REGISTRY_CLIP
 #include "include/registry/register_kernel.h"
@@ -44,6 +45,7 @@
 #include "src/litert/sub_graph_split.h"
 #endif
 #include "src/litert/weight_decoder.h"
+#include "src/litert/lazy_weight_decoder.h"
 #include "src/litert/kernel/cpu/fp16/fp16_op_handler.h"
 #include "nnacl/nnacl_common.h"
 #if GPU_OPENCL
@@ -264,6 +266,39 @@ int Scheduler::InitKernels(std::vector<kernel::KernelExec *> &&dst_kernels) {
   return RET_OK;
 }
 
+int Scheduler::PartitionByCostProfile() {
+  if (config_info_ == nullptr) {
+    return RET_OK;
+  }
+  auto partition_iter = config_info_->find(kHeteroPartition);
+  if (partition_iter == config_info_->end()) {
+    return RET_OK;
+  }
+#ifndef AUTO_PARALLEL_CLIP
+  auto get_config = [&partition_iter](const std::string &key) {
+    auto iter = partition_iter->second.find(key);
+    return iter == partition_iter->second.end() ? std::string() : iter->second;
+  };
+  auto search_sub_graph =
+    SearchSubGraph(context_, src_model_, src_tensors_, &op_parameters_, &graph_output_node_indexes_);
+  auto ret = search_sub_graph.SubGraphSplitByCostProfile(get_config(kHeteroPartitionProfilePath),
+                                                         get_config(kHeteroPartitionPlanPath));
+  if (ret == RET_NOT_SUPPORT) {
+    return RET_OK;
+  }
+  if (ret != RET_OK) {
+    return ret;
+  }
+  for (auto node : src_model_->graph_.all_nodes_) {
+    planned_device_types_[node->name_] = node->device_type_;
+  }
+  return RET_OK;
+#else
+  MS_LOG(ERROR) << unsupport_auto_parallel_log;
+  return RET_NOT_SUPPORT;
+#endif
+}
+
 int Scheduler::SchedulePreProcess() {
   schema_version_ = reinterpret_cast<LiteModel *>(src_model_)->GetSchemaVersion();
 
@@ -280,6 +315,12 @@ int Scheduler::SchedulePreProcess() {
     return *is_infershape_;
   }
 
+  auto ret = PartitionByCostProfile();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "partition by cost profile failed.";
+    return ret;
+  }
+
   if (context_->enable_parallel_ || context_->inter_op_parallel_num_ > 1) {
 #ifndef AUTO_PARALLEL_CLIP
     auto search_sub_graph =
@@ -493,7 +534,7 @@ int Scheduler::Schedule(std::vector<kernel::KernelExec *> *dst_kernels) {
   }
   // Support NC4HW4(fp32) or NC8HW8(fp16) runtime kernel.
   if (CheckRunNCXPass()) {
-    status = pass::RuntimeNCXPass(dst_kernels, src_tensors_);
+    status = pass::RuntimeNCXPass(dst_kernels, src_tensors_, config_info_);
     if (status != RET_OK) {
       MS_LOG(ERROR) << "runtime pass failed.";
       return RET_ERROR;
@@ -649,6 +690,11 @@ int Scheduler::InitDelegateKernels(std::vector<kernel::KernelExec *> *dst_kernel
       VectorErase(&src_kernels, kernel);
       bool priority_ret =
         DeviceTypePriority(context_, delegate_device_type_, KernelArchToDeviceType(kernel->desc().arch));
+      // the kernel is kept on the device decided by the cost profile partition.
+      auto planned_iter = planned_device_types_.find(kernel->name());
+      if (planned_iter != planned_device_types_.end() && planned_iter->second != delegate_device_type_) {
+        priority_ret = false;
+      }
       if (priority_ret == true) {
         tmp_kernels.push_back(kernel);
       } else {
@@ -1051,8 +1097,15 @@ int Scheduler::FindCpuKernel(const std::vector<Tensor *> &in_tensors, const std:
     }
     cpu_desc.data_type = kNumberTypeFloat16;
   }
-  auto ret = WeightDecoder::DequantNode(op_parameter, in_tensors, kernel_data_type, src_model_->graph_.version_,
-                                        context_->float_mode);
+  auto ret = is_train_session_ ? RET_NO_CHANGE
+                               : LazyWeightDecoder::GetInstance()->DeferDequantNode(
+                                   op_parameter, in_tensors, kernel_data_type, src_model_->graph_.version_,
+                                   context_->float_mode);
+  bool lazy_weight = ret == RET_OK;
+  if (ret == RET_NO_CHANGE) {
+    ret = WeightDecoder::DequantNode(op_parameter, in_tensors, kernel_data_type, src_model_->graph_.version_,
+                                     context_->float_mode);
+  }
   if (ret != RET_OK) {
     MS_LOG(DEBUG) << "Dequant input tensors failed: " << ret;
     return RET_NOT_SUPPORT;
@@ -1072,6 +1125,7 @@ int Scheduler::FindCpuKernel(const std::vector<Tensor *> &in_tensors, const std:
   if (ret == RET_OK) {
     MS_LOG(DEBUG) << "Get TypeId(expect = " << kernel_data_type << ", real = " << cpu_desc.data_type
                   << ") op success: " << PrimitiveCurVersionTypeName(op_type);
+    (*kernel)->set_lazy_weight(lazy_weight);
     if (is_train_session_) {
       (*kernel)->Prepare();
       RestoreTensorData(&restored_origin_tensors);
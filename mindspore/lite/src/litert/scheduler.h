@@ -64,6 +64,7 @@ class Scheduler {
  private:
   bool CheckRunNCXPass();
   int SchedulePreProcess();
+  int PartitionByCostProfile();
   int CheckInputParam(std::vector<kernel::KernelExec *> *dst_kernels);
   void FindNodeInoutTensors(const LiteGraph::Node &node, std::vector<Tensor *> *inputs, std::vector<Tensor *> *outputs);
   LiteGraph::Node *NodeInputIsPartial(const LiteGraph::Node *node);
@@ -171,6 +172,8 @@ class Scheduler {
   std::map<std::string, TypeId> *execution_plan_ = nullptr;
   const std::map<std::string, std::map<std::string, std::string>> *config_info_ = nullptr;
   std::shared_ptr<ShapeFusionPass> shape_fusion_pass_ = nullptr;
+  // node name -> device type decided by the cost profile partition
+  std::unordered_map<std::string, int> planned_device_types_{};
 };
 }  // namespace mindspore::lite
 
@@ -15,12 +15,16 @@
  */
 
 #include "src/litert/sub_graph_split.h"
+#include <cfloat>
 #include <cstdlib>
 #include <utility>
 #include <algorithm>
 #include <iterator>
 #include <vector>
 #include <queue>
+#include <fstream>
+#include <sstream>
+#include <string>
 #include "src/tensor.h"
 #include "schema/ops_generated.h"
 #include "schema/model_generated.h"
@@ -34,6 +38,8 @@
 namespace {
 constexpr const int kMaxDepth = 2048;
 constexpr int kOperatorMaxThreadNum = 16;
+const std::map<std::string, mindspore::lite::DeviceType> kProfileDeviceTypes = {
+  {"cpu", mindspore::lite::DT_CPU}, {"gpu", mindspore::lite::DT_GPU}, {"npu", mindspore::lite::DT_NPU}};
 }  // namespace
 
 namespace mindspore::lite {
@@ -1157,6 +1163,324 @@ void SearchSubGraph::SubGraphSplitByOperator() {
       sub_graphs_.push_back(std::move(subgraph));
     }
   }
+  AssignBranchThreadBudget(&sub_graphs_);
   ConvertSubGraphToModel(&sub_graphs_);
 }
+
+// the conv cost is calculated only when the shapes are inferred, and the other node costs 1.
+size_t SearchSubGraph::CalculateBranchCost(const Subgraph &subgraph) {
+  size_t cost = 0;
+  for (auto node_index : subgraph.nodes_) {
+    LiteGraph::Node *node = model_->graph_.all_nodes_[node_index];
+    if (GetPrimitiveType(node->primitive_, SCHEMA_VERSION::SCHEMA_CUR) != schema::PrimitiveType_Conv2DFusion ||
+        node->input_indices_.size() < kInputSize1 || node->output_indices_.empty() ||
+        op_parameters_->find(node->output_indices_[0]) == op_parameters_->end()) {
+      cost += 1;
+      continue;
+    }
+    auto weight_shape = src_tensors_->at(node->input_indices_[1])->shape();
+    auto output_shape = src_tensors_->at(node->output_indices_[0])->shape();
+    auto is_valid = [](const std::vector<int> &shape) {
+      return shape.size() == DIMENSION_4D && std::all_of(shape.begin(), shape.end(), [](int dim) { return dim > 0; });
+    };
+    cost += (is_valid(weight_shape) && is_valid(output_shape)) ? CalculateConv2DFusion(node).cost() : 1;
+  }
+  return cost;
+}
+
+// the branches in the same dependency level run concurrently on the inter-op threads, and they share the thread
+// budget of the context. When the level has no more branches than the inter-op parallel num, each branch gets the
+// intra-op threads in proportion to its cost, otherwise the budget is split evenly by the inter-op parallel num. The
+// thread cost model decides the threads of each kernel within the budget of its branch.
+void SearchSubGraph::AssignBranchThreadBudget(std::vector<Subgraph> *sub_graphs) {
+  if (sub_graphs->size() < kDefaultSubGraphSize) {
+    return;
+  }
+  std::unordered_map<uint32_t, size_t> node_branch;
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    for (auto node_index : sub_graphs->at(i).nodes_) {
+      node_branch[node_index] = i;
+    }
+  }
+  // the level of branch is the longest dependency path from the graph inputs, the rounds are limited in case of the
+  // dependency cycle between the branches.
+  std::vector<size_t> levels(sub_graphs->size(), 0);
+  bool changed = true;
+  for (size_t round = 0; changed && round < sub_graphs->size(); round++) {
+    changed = false;
+    for (size_t i = 0; i < sub_graphs->size(); i++) {
+      for (auto node_index : sub_graphs->at(i).nodes_) {
+        for (auto in : model_->graph_.all_nodes_[node_index]->input_indices_) {
+          if (tensors_[in].out_nodes_.empty()) {
+            continue;
+          }
+          auto iter = node_branch.find(tensors_[in].out_nodes_.front());
+          if (iter == node_branch.end() || iter->second == i || levels[iter->second] + 1 <= levels[i]) {
+            continue;
+          }
+          levels[i] = levels[iter->second] + 1;
+          changed = true;
+        }
+      }
+    }
+  }
+  std::map<size_t, std::vector<size_t>> level_branches;
+  for (size_t i = 0; i < sub_graphs->size(); i++) {
+    level_branches[levels[i]].push_back(i);
+  }
+  int thread_budget = std::min(context_->thread_num_, kOperatorMaxThreadNum);
+  int inter_op_num = std::max(context_->inter_op_parallel_num_, 1);
+  for (auto &item : level_branches) {
+    auto &branches = item.second;
+    if (static_cast<int>(branches.size()) > inter_op_num) {
+      for (auto branch : branches) {
+        sub_graphs->at(branch).thread_ = static_cast<size_t>(std::max(thread_budget / inter_op_num, 1));
+      }
+      continue;
+    }
+    std::vector<size_t> costs;
+    size_t level_cost = 0;
+    for (auto branch : branches) {
+      costs.push_back(CalculateBranchCost(sub_graphs->at(branch)));
+      level_cost += costs.back();
+    }
+    for (size_t i = 0; i < branches.size(); i++) {
+      auto threads = static_cast<int>(static_cast<double>(thread_budget) * costs[i] / std::max(level_cost, size_t(1)));
+      sub_graphs->at(branches[i]).thread_ = static_cast<size_t>(std::max(threads, 1));
+    }
+  }
+}
+
+// the profile is a text file, each line is "op <node name> <cpu|gpu|npu> <latency>" or "edge <tensor name> <cost>",
+// the latency and the transfer cost are in the same unit, and the lines beginning with '#' are comments.
+int SearchSubGraph::LoadCostProfile(const std::string &profile_path) {
+  std::ifstream ifs(profile_path);
+  if (!ifs.good()) {
+    MS_LOG(ERROR) << "open cost profile " << profile_path << " failed.";
+    return RET_ERROR;
+  }
+  op_latency_.clear();
+  edge_cost_.clear();
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string kind;
+    std::string name;
+    iss >> kind >> name;
+    if (kind == "op") {
+      std::string device;
+      float latency = 0;
+      iss >> device >> latency;
+      auto iter = kProfileDeviceTypes.find(device);
+      if (iss.fail() || iter == kProfileDeviceTypes.end() || latency < 0) {
+        MS_LOG(ERROR) << "invalid op line in cost profile: " << line;
+        return RET_ERROR;
+      }
+      op_latency_[name][iter->second] = latency;
+    } else if (kind == "edge") {
+      float cost = 0;
+      iss >> cost;
+      if (iss.fail() || cost < 0) {
+        MS_LOG(ERROR) << "invalid edge line in cost profile: " << line;
+        return RET_ERROR;
+      }
+      edge_cost_[name] = cost;
+    } else {
+      MS_LOG(ERROR) << "invalid line in cost profile: " << line;
+      return RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+// the plan is a text file, each line is "<node name> <cpu|gpu|npu>".
+int SearchSubGraph::LoadPartitionPlan(const std::string &plan_path, std::vector<DeviceType> *plan) {
+  std::ifstream ifs(plan_path);
+  if (!ifs.good()) {
+    return RET_NO_CHANGE;
+  }
+  std::unordered_map<std::string, DeviceType> node_devices;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string name;
+    std::string device;
+    iss >> name >> device;
+    auto iter = kProfileDeviceTypes.find(device);
+    if (iss.fail() || iter == kProfileDeviceTypes.end() || !context_->IsDeviceTypeEnabled(iter->second)) {
+      MS_LOG(WARNING) << "invalid line in partition plan " << plan_path << ": " << line;
+      return RET_ERROR;
+    }
+    node_devices[name] = iter->second;
+  }
+  plan->assign(model_->graph_.all_nodes_.size(), DT_CPU);
+  for (size_t i = 0; i < model_->graph_.all_nodes_.size(); i++) {
+    auto iter = node_devices.find(model_->graph_.all_nodes_[i]->name_);
+    if (iter == node_devices.end()) {
+      MS_LOG(WARNING) << "partition plan " << plan_path << " does not match the model.";
+      return RET_ERROR;
+    }
+    plan->at(i) = iter->second;
+  }
+  return RET_OK;
+}
+
+int SearchSubGraph::ExportPartitionPlan(const std::string &plan_path, const std::vector<DeviceType> &plan) {
+  std::ofstream ofs(plan_path, std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(ERROR) << "open partition plan " << plan_path << " failed.";
+    return RET_ERROR;
+  }
+  for (size_t i = 0; i < plan.size(); i++) {
+    auto iter = std::find_if(kProfileDeviceTypes.begin(), kProfileDeviceTypes.end(),
+                             [&plan, i](const auto &item) { return item.second == plan[i]; });
+    ofs << model_->graph_.all_nodes_[i]->name_ << " " << iter->first << "\n";
+  }
+  ofs.close();
+  return ofs.good() ? RET_OK : RET_ERROR;
+}
+
+// the node is placed on the enabled devices which are profiled, and the node without profile runs on cpu.
+std::vector<DeviceType> SearchSubGraph::GetCandidateDevices(uint32_t node_index) {
+  std::vector<DeviceType> devices;
+  auto iter = op_latency_.find(model_->graph_.all_nodes_[node_index]->name_);
+  if (iter != op_latency_.end()) {
+    for (auto &item : iter->second) {
+      if (item.first == DT_CPU || context_->IsDeviceTypeEnabled(item.first)) {
+        devices.push_back(item.first);
+      }
+    }
+  }
+  if (devices.empty()) {
+    devices.push_back(DT_CPU);
+  }
+  return devices;
+}
+
+float SearchSubGraph::GetOpLatency(uint32_t node_index, DeviceType device) {
+  auto iter = op_latency_.find(model_->graph_.all_nodes_[node_index]->name_);
+  if (iter == op_latency_.end()) {
+    return 0;
+  }
+  auto latency_iter = iter->second.find(device);
+  return latency_iter == iter->second.end() ? 0 : latency_iter->second;
+}
+
+// estimate the end-to-end latency by list scheduling: each device runs its nodes one by one in the graph order, and
+// the node starts when the device is idle and all the inputs are transferred to the device. The graph inputs are
+// on cpu.
+float SearchSubGraph::EstimateLatency(const std::vector<DeviceType> &plan, size_t node_num) {
+  auto &node_indices = model_->graph_.sub_graphs_.front()->node_indices_;
+  std::vector<float> finish_time(model_->graph_.all_nodes_.size(), 0);
+  std::map<DeviceType, float> device_ready;
+  float latency = 0;
+  for (size_t i = 0; i < node_num && i < node_indices.size(); i++) {
+    auto node_index = node_indices[i];
+    auto device = plan[node_index];
+    float start = device_ready[device];
+    for (auto in : model_->graph_.all_nodes_[node_index]->input_indices_) {
+      if (tensors_[in].type_ == CONST) {
+        continue;
+      }
+      float ready = 0;
+      DeviceType src_device = DT_CPU;
+      if (!tensors_[in].out_nodes_.empty()) {
+        auto src_node = tensors_[in].out_nodes_.front();
+        ready = finish_time[src_node];
+        src_device = plan[src_node];
+      }
+      if (src_device != device) {
+        auto iter = edge_cost_.find(src_tensors_->at(in)->tensor_name());
+        ready += iter == edge_cost_.end() ? 0 : iter->second;
+      }
+      start = std::max(start, ready);
+    }
+    finish_time[node_index] = start + GetOpLatency(node_index, device);
+    device_ready[device] = finish_time[node_index];
+    latency = std::max(latency, finish_time[node_index]);
+  }
+  return latency;
+}
+
+// place the nodes one by one on the device with the earliest finish time, then move the single node to another
+// device while the estimated latency is reduced.
+void SearchSubGraph::SolvePartitionPlan(std::vector<DeviceType> *plan) {
+  auto &node_indices = model_->graph_.sub_graphs_.front()->node_indices_;
+  plan->assign(model_->graph_.all_nodes_.size(), DT_CPU);
+  for (size_t i = 0; i < node_indices.size(); i++) {
+    auto node_index = node_indices[i];
+    float best_latency = FLT_MAX;
+    DeviceType best_device = DT_CPU;
+    for (auto device : GetCandidateDevices(node_index)) {
+      plan->at(node_index) = device;
+      auto latency = EstimateLatency(*plan, i + 1);
+      if (latency < best_latency) {
+        best_latency = latency;
+        best_device = device;
+      }
+    }
+    plan->at(node_index) = best_device;
+  }
+
+  auto latency = EstimateLatency(*plan, node_indices.size());
+  for (int round = 0; round < kMaxPartitionRefineRound; round++) {
+    bool improved = false;
+    for (auto node_index : node_indices) {
+      auto origin_device = plan->at(node_index);
+      for (auto device : GetCandidateDevices(node_index)) {
+        if (device == plan->at(node_index)) {
+          continue;
+        }
+        plan->at(node_index) = device;
+        auto new_latency = EstimateLatency(*plan, node_indices.size());
+        if (new_latency < latency) {
+          latency = new_latency;
+          origin_device = device;
+          improved = true;
+        }
+        plan->at(node_index) = origin_device;
+      }
+    }
+    if (!improved) {
+      break;
+    }
+  }
+  MS_LOG(INFO) << "the estimated latency of the partition plan is " << latency;
+}
+
+// partition the main graph to the devices by the latency profile, the device of each node is set to the node, and
+// the kernels of one device are scheduled to the same subgraph. The plan is exported to plan_path, and reused when
+// plan_path exists.
+int SearchSubGraph::SubGraphSplitByCostProfile(const std::string &profile_path, const std::string &plan_path) {
+  if (model_->graph_.sub_graphs_.size() > 1) {
+    MS_LOG(WARNING) << "partition by cost profile only supports the model with one subgraph.";
+    return RET_NOT_SUPPORT;
+  }
+  std::vector<DeviceType> plan;
+  auto ret = plan_path.empty() ? RET_NO_CHANGE : LoadPartitionPlan(plan_path, &plan);
+  if (ret != RET_OK) {
+    if (profile_path.empty()) {
+      MS_LOG(ERROR) << "neither partition plan nor cost profile is valid.";
+      return RET_ERROR;
+    }
+    if (LoadCostProfile(profile_path) != RET_OK) {
+      MS_LOG(ERROR) << "load cost profile failed.";
+      return RET_ERROR;
+    }
+    SolvePartitionPlan(&plan);
+    if (!plan_path.empty() && ExportPartitionPlan(plan_path, plan) != RET_OK) {
+      MS_LOG(WARNING) << "export partition plan to " << plan_path << " failed.";
+    }
+  }
+  for (size_t i = 0; i < plan.size(); i++) {
+    model_->graph_.all_nodes_[i]->device_type_ = plan[i];
+  }
+  return RET_OK;
+}
 }  // namespace mindspore::lite
@@ -21,6 +21,7 @@
 #include <vector>
 #include <map>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include "include/model.h"
 #include "src/litert/kernel_exec.h"
@@ -38,6 +39,7 @@ constexpr int kMaxMultyInNode = 20;
 constexpr int kMaxSubGraphCount = 10;
 constexpr int kMinSubgraphCost = 50;
 constexpr double kDefaultGpu = 0.5;
+constexpr int kMaxPartitionRefineRound = 4;
 class SearchSubGraph {
   enum TensorType { NORMAL, CONST, INPUT };
 
@@ -90,6 +92,8 @@ class SearchSubGraph {
   void SubGraphSplit();
   void SubGraphSplitByOperator();
   void InsertNodeBegin(uint32_t index, Subgraph *subgraph, std::vector<size_t> *outputs);
+  void AssignBranchThreadBudget(std::vector<Subgraph> *sub_graphs);
+  int SubGraphSplitByCostProfile(const std::string &profile_path, const std::string &plan_path);
 
  private: /* split by output */
   void SubGraphSplitByOutput();
@@ -110,6 +114,15 @@ class SearchSubGraph {
   void UpdateOfflineParallelFlag();
   bool CheckIsParallelSubGraph(const std::vector<Subgraph> &subgraphs);
 
+ private: /* split by cost profile */
+  int LoadCostProfile(const std::string &profile_path);
+  int LoadPartitionPlan(const std::string &plan_path, std::vector<DeviceType> *plan);
+  int ExportPartitionPlan(const std::string &plan_path, const std::vector<DeviceType> &plan);
+  void SolvePartitionPlan(std::vector<DeviceType> *plan);
+  std::vector<DeviceType> GetCandidateDevices(uint32_t node_index);
+  float GetOpLatency(uint32_t node_index, DeviceType device);
+  float EstimateLatency(const std::vector<DeviceType> &plan, size_t node_num);
+
  private: /* public graph func  */
   void RemoveConstNode(std::vector<uint32_t> *nodes);
   void InitSearchTensor();
@@ -131,6 +144,7 @@ class SearchSubGraph {
 
  private: /* public cost-model func  */
   CostModel CalculateConv2DFusion(const LiteGraph::Node *node);
+  size_t CalculateBranchCost(const Subgraph &subgraph);
   void dfs(int i, int n, int current_sum, int except_value, int *min_value, std::vector<bool> *tmp_group,
            std::vector<bool> *cor_group, std::vector<Subgraph> *sub_graphs);
 
@@ -150,6 +164,9 @@ class SearchSubGraph {
   size_t minor_thread_;
   size_t total_cost_ = 0;
   bool offline_parallel_enable_ = false;
+  // node name -> <device, latency>, tensor name -> transfer cost between the devices
+  std::unordered_map<std::string, std::map<DeviceType, float>> op_latency_;
+  std::unordered_map<std::string, float> edge_cost_;
 };
 }  // namespace mindspore::lite
 
@@ -15,13 +15,22 @@
  */
 
 #include "src/litert/thread_cost_model.h"
+#include <chrono>
+#include <fstream>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
 #include "src/common/log_util.h"
 #include "src/litert/inner_context.h"
 #include "thread/threadpool.h"
+#include "nnacl/fp32/activation_fp32.h"
+#include "nnacl/fp32/add_fp32.h"
+#include "nnacl/fp32/mul_fp32.h"
 
 namespace mindspore::lite {
-const std::map<int32_t, float> kernel_compute_cost_map_ = {
+std::map<int32_t, float> kernel_compute_cost_map_ = {
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU), 1.806f},        // dataNum about 100k
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU6), 1.806f},       // dataNum about 100k
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_LEAKY_RELU), 1.806f},  // dataNum about 100k
@@ -131,4 +140,172 @@ int UpdateThreadNum(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_
   }
   return thread_num;
 }
+namespace {
+constexpr int kCalibrationElementNum = 64 * 1024;
+constexpr int kCalibrationLoopNum = 32;
+constexpr int kCalibrationLaunchNum = 256;
+constexpr float kMinComputeCost = 0.01f;
+
+struct CalibrationKernel {
+  std::vector<int32_t> kernel_types;  // the kernel types sharing the cost of the benchmark
+  int64_t per_unit_load_num;
+  int64_t per_unit_store_num;
+  std::function<void(const float *, const float *, float *, int)> run;
+};
+
+// nanoseconds of running the function once, the best of the loops is taken to skip the cold start.
+template <typename Fn>
+double MeasureNanoseconds(const Fn &fn, int loop_num) {
+  double best = 0;
+  for (int i = 0; i < loop_num; i++) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto cost = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    best = (i == 0 || cost < best) ? cost : best;
+  }
+  return best;
+}
+
+const std::vector<CalibrationKernel> &GetCalibrationKernels() {
+  static const std::vector<CalibrationKernel> kernels = {
+    {{TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_TANH)},
+     1,
+     1,
+     [](const float *in0, const float *, float *out, int size) { (void)Tanh(in0, size, out); }},
+    {{TC_TYPE(schema::PrimitiveType_AddFusion, schema::ActivationType_NO_ACTIVATION),
+      TC_TYPE(schema::PrimitiveType_SubFusion, schema::ActivationType_NO_ACTIVATION)},
+     2,
+     1,
+     [](const float *in0, const float *in1, float *out, int size) { (void)ElementAdd(in0, in1, out, size); }},
+    {{TC_TYPE(schema::PrimitiveType_MulFusion, schema::ActivationType_NO_ACTIVATION)},
+     2,
+     1,
+     [](const float *in0, const float *in1, float *out, int size) { (void)ElementMul(in0, in1, out, size); }},
+  };
+  return kernels;
+}
+
+int LoadCalibration(const std::string &calibration_file) {
+  std::ifstream ifs(calibration_file);
+  if (!ifs.good()) {
+    return RET_NO_CHANGE;
+  }
+  std::map<int32_t, float> kernel_costs;
+  float thread_costs[3] = {0};
+  std::string line;
+  while (std::getline(ifs, line)) {
+    std::istringstream iss(line);
+    std::string key;
+    iss >> key;
+    if (key == "thread") {
+      iss >> thread_costs[0] >> thread_costs[1] >> thread_costs[2];
+    } else if (key == "kernel") {
+      int32_t kernel_type = 0;
+      float cost = 0;
+      iss >> kernel_type >> cost;
+      kernel_costs[kernel_type] = cost;
+    } else {
+      continue;
+    }
+    if (iss.fail()) {
+      MS_LOG(WARNING) << "invalid line in thread cost calibration file: " << line;
+      return RET_ERROR;
+    }
+  }
+  if (thread_costs[0] <= 0 || thread_costs[1] <= 0 || thread_costs[2] <= 0) {
+    MS_LOG(WARNING) << "thread costs are missing in thread cost calibration file " << calibration_file;
+    return RET_ERROR;
+  }
+  ThreadCostModel::thread_startup_cost_ = thread_costs[0];
+  ThreadCostModel::single_thread_cost_ = thread_costs[1];
+  ThreadCostModel::parallel_thread_cost_ = thread_costs[2];
+  for (auto &item : kernel_costs) {
+    kernel_compute_cost_map_[item.first] = item.second;
+  }
+  return RET_OK;
+}
+
+int SaveCalibration(const std::string &calibration_file) {
+  std::ofstream ofs(calibration_file, std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(WARNING) << "open thread cost calibration file " << calibration_file << " failed.";
+    return RET_ERROR;
+  }
+  ofs << "thread " << ThreadCostModel::thread_startup_cost_ << " " << ThreadCostModel::single_thread_cost_ << " "
+      << ThreadCostModel::parallel_thread_cost_ << "\n";
+  for (auto &kernel : GetCalibrationKernels()) {
+    for (auto kernel_type : kernel.kernel_types) {
+      ofs << "kernel " << kernel_type << " " << kernel_compute_cost_map_[kernel_type] << "\n";
+    }
+  }
+  ofs.close();
+  return ofs.good() ? RET_OK : RET_ERROR;
+}
+
+// the cost unit is anchored by relu, whose cost is kept, so the costs of the other kernels and the thread wake-up
+// are measured in the same unit as the hard-coded costs.
+int RunCalibration(ThreadPool *thread_pool) {
+  std::vector<float> in0(kCalibrationElementNum, 0.5f);
+  std::vector<float> in1(kCalibrationElementNum, -0.25f);
+  std::vector<float> out(kCalibrationElementNum, 0.0f);
+  const int32_t relu_type = TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU);
+  auto relu_ns = MeasureNanoseconds(
+    [&in0, &out]() { (void)Fp32Relu(in0.data(), kCalibrationElementNum, out.data()); }, kCalibrationLoopNum);
+  ThreadCostContext relu_context = {kCalibrationElementNum, 1, 1, kernel_compute_cost_map_.at(relu_type)};
+  auto ns_per_cost = relu_ns / ThreadCostModel::TotalCost(&relu_context);
+  if (ns_per_cost <= 0) {
+    MS_LOG(WARNING) << "the timer is too coarse to calibrate the thread cost model.";
+    return RET_ERROR;
+  }
+
+  for (auto &kernel : GetCalibrationKernels()) {
+    auto kernel_ns = MeasureNanoseconds(
+      [&kernel, &in0, &in1, &out]() { kernel.run(in0.data(), in1.data(), out.data(), kCalibrationElementNum); },
+      kCalibrationLoopNum);
+    auto io_cost = ThreadCostModel::per_unit_load_cost_ * kernel.per_unit_load_num +
+                   ThreadCostModel::per_unit_store_cost_ * kernel.per_unit_store_num;
+    auto compute_cost = static_cast<float>(kernel_ns / ns_per_cost / kCalibrationElementNum - io_cost);
+    for (auto kernel_type : kernel.kernel_types) {
+      kernel_compute_cost_map_[kernel_type] = MSMAX(compute_cost, kMinComputeCost);
+    }
+  }
+
+  if (thread_pool != nullptr && thread_pool->GetKernelThreadNum() > 1) {
+    auto empty_task = [](void *, int, float, float) { return 0; };
+    auto task_num = static_cast<int>(thread_pool->GetKernelThreadNum());
+    auto launch_ns = MeasureNanoseconds(
+      [&thread_pool, &empty_task, task_num]() {
+        for (int i = 0; i < kCalibrationLaunchNum; i++) {
+          (void)thread_pool->ParallelLaunch(empty_task, nullptr, task_num);
+        }
+      },
+      1) / kCalibrationLaunchNum;
+    // the single thread and parallel thread costs are the thresholds relative to the wake-up cost.
+    auto startup_cost = static_cast<float>(launch_ns / ns_per_cost);
+    auto scale = startup_cost / ThreadCostModel::thread_startup_cost_;
+    ThreadCostModel::thread_startup_cost_ = startup_cost;
+    ThreadCostModel::single_thread_cost_ *= scale;
+    ThreadCostModel::parallel_thread_cost_ *= scale;
+  }
+  MS_LOG(INFO) << "calibrated thread cost model, thread startup cost: " << ThreadCostModel::thread_startup_cost_;
+  return RET_OK;
+}
+}  // namespace
+
+int CalibrateThreadCostModel(const std::string &calibration_file, ThreadPool *thread_pool) {
+  static std::once_flag calibration_flag;
+  int ret = RET_OK;
+  std::call_once(calibration_flag, [&calibration_file, thread_pool, &ret]() {
+    ret = LoadCalibration(calibration_file);
+    if (ret == RET_OK) {
+      return;
+    }
+    ret = RunCalibration(thread_pool);
+    if (ret != RET_OK) {
+      return;
+    }
+    ret = SaveCalibration(calibration_file);
+  });
+  return ret;
+}
 }  // namespace mindspore::lite
@@ -18,9 +18,12 @@
 #define MINDSPORE_LITE_SRC_RUNTIME_THREAD_COST_MODEL_H_
 
 #include <stdint.h>
+#include <string>
 #include "nnacl/op_base.h"
 #include "include/api/context.h"
 #include "schema/ops_generated.h"
+#include "include/errorcode.h"
+#include "thread/threadpool.h"
 
 namespace mindspore::lite {
 typedef struct ThreadCostContext {
@@ -76,11 +79,15 @@ int ThreadNumUpdateStrategy(const ThreadCostContext *thread_cost_context, int ta
 #ifdef DYNAMIC_THREAD_DISTRIBUTE
 int UpdateThreadNum(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num, int64_t unit_num,
                     int thread_num);
+// load the costs of the device from the calibration file, or microbenchmark them and save to the file at the first
+// run. It only takes effect once in the process.
+int CalibrateThreadCostModel(const std::string &calibration_file, ThreadPool *thread_pool);
 #else
 inline int UpdateThreadNum(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num, int64_t unit_num,
                            int thread_num) {
   return thread_num;
 }
+inline int CalibrateThreadCostModel(const std::string &calibration_file, ThreadPool *thread_pool) { return RET_OK; }
 #endif
 }  // namespace mindspore::lite
 
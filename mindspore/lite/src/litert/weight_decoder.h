@@ -97,6 +97,9 @@ class WeightDecoder {
 #ifndef WEIGHT_DECODE_CLIP
 
  private:
+  // the lazy decoder dequantizes the deferred weights just before the kernels run.
+  friend class LazyWeightDecoder;
+
   static int DequantTensor(Tensor *tensor, int preferred_dim, TypeId dst_data_type = kNumberTypeFloat32);
 
   static int UnPackToInt(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/train/fused_optimizer.h"
+#include <algorithm>
+#include "src/common/log_adapter.h"
+
+namespace mindspore {
+namespace lite {
+namespace {
+int FusedOptimizerRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  auto fused_optimizer = reinterpret_cast<FusedOptimizer *>(cdata);
+  CHECK_NULL_RETURN(fused_optimizer);
+  return fused_optimizer->DoTask(task_id);
+}
+}  // namespace
+
+FusedOptimizer::FusedOptimizer(const InnerContext *context, const std::vector<kernel::KernelExec *> &kernels)
+    : context_(context) {
+  for (auto kernel : kernels) {
+    optimizers_.push_back(static_cast<kernel::OptimizerKernel *>(kernel->kernel()));
+  }
+  thread_num_ = context_ == nullptr ? 1 : MSMAX(context_->thread_num_, 1);
+}
+
+int FusedOptimizer::Run() {
+  for (auto optimizer : optimizers_) {
+    // the gradients are checked and unscaled by the preprocess of the kernels.
+    auto ret = optimizer->PreProcess();
+    if (ret != RET_OK) {
+      return ret;
+    }
+    ret = optimizer->BeginFusedUpdate();
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Begin the fused update of " << optimizer->name() << " failed.";
+      return ret;
+    }
+  }
+  offsets_.assign(1, 0);
+  for (auto optimizer : optimizers_) {
+    offsets_.push_back(offsets_.back() + optimizer->WeightElementsNum());
+  }
+  auto ret = ParallelLaunch(context_, FusedOptimizerRun, this, thread_num_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Fused optimizer run failed: " << ret;
+    return RET_ERROR;
+  }
+  for (auto optimizer : optimizers_) {
+    ret = optimizer->EndFusedUpdate();
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "End the fused update of " << optimizer->name() << " failed.";
+      return ret;
+    }
+    ret = optimizer->PostProcess();
+    if (ret != RET_OK) {
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+
+int FusedOptimizer::DoTask(int task_id) {
+  // the slices are aligned to the simd width of the optimizers.
+  int stride = UP_ROUND(UP_DIV(offsets_.back(), thread_num_), C16NUM);
+  int start = MSMIN(stride * task_id, offsets_.back());
+  int end = MSMIN(start + stride, offsets_.back());
+  auto iter = std::upper_bound(offsets_.begin(), offsets_.end(), start);
+  for (size_t i = static_cast<size_t>(iter - offsets_.begin()) - 1; i < optimizers_.size() && offsets_[i] < end; ++i) {
+    auto weight_start = MSMAX(start, offsets_[i]) - offsets_[i];
+    auto weight_end = MSMIN(end, offsets_[i + 1]) - offsets_[i];
+    if (weight_start >= weight_end) {
+      continue;
+    }
+    auto ret = optimizers_[i]->UpdateWeight(weight_start, weight_end);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Update the weight of " << optimizers_[i]->name() << " failed: " << ret;
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+}  // namespace lite
+}  // namespace mindspore
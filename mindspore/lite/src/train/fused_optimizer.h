@@ -0,0 +1,46 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_TRAIN_FUSED_OPTIMIZER_H_
+#define MINDSPORE_LITE_SRC_TRAIN_FUSED_OPTIMIZER_H_
+
+#include <vector>
+#include "src/litert/inner_context.h"
+#include "src/train/optimizer_kernel.h"
+
+namespace mindspore {
+namespace lite {
+// The fused optimizer updates the weights of all the optimizer kernels in one parallel launch, instead of one launch
+// and one pass over the memory per weight. The elements of all the weights are split evenly to the threads, so the
+// threads are kept busy by the small weights, such as the biases.
+class FusedOptimizer {
+ public:
+  FusedOptimizer(const InnerContext *context, const std::vector<kernel::KernelExec *> &kernels);
+  ~FusedOptimizer() = default;
+
+  int Run();
+  int DoTask(int task_id);
+
+ private:
+  const InnerContext *context_;
+  std::vector<kernel::OptimizerKernel *> optimizers_;
+  // the first element of each weight in all the elements.
+  std::vector<int> offsets_;
+  int thread_num_ = 1;
+};
+}  // namespace lite
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_SRC_TRAIN_FUSED_OPTIMIZER_H_
@@ -24,7 +24,9 @@
 #include <iostream>
 #include "src/litert/kernel_exec.h"
 #include "include/errorcode.h"
+#include "nnacl/fp32/add_fp32.h"
 using mindspore::lite::RET_ERROR;
+using mindspore::lite::RET_NOT_SUPPORT;
 using mindspore::lite::RET_OK;
 using mindspore::lite::RET_OUT_OF_TENSOR_RANGE;
 
@@ -118,16 +120,20 @@ class OptimizerKernel : public LiteKernel {
 
   int SetOptimizerMode(WeightUpdateMode mod) {
     if (mod == WeightUpdateMode::VIRTUAL_BATCH || mod == WeightUpdateMode::ACCUMULATE_GRADS) {
-      if (grad_sum_ != nullptr) {
+      size_t size = in_tensors_.at(grad_idx_)->Size();
+      size_t elem_num = in_tensors_.at(grad_idx_)->ElementsNum();
+      // the accumulation buffer is kept while the size of the gradient is unchanged.
+      if (grad_sum_ != nullptr && grad_sum_size_ != size) {
         ms_context_->allocator->Free(grad_sum_);
         grad_sum_ = nullptr;
       }
-      size_t size = in_tensors_.at(grad_idx_)->Size();
-      size_t elem_num = in_tensors_.at(grad_idx_)->ElementsNum();
-      grad_sum_ = reinterpret_cast<float *>(ms_context_->allocator->Malloc(size));
       if (grad_sum_ == nullptr) {
-        MS_LOG(ERROR) << "failed to malloc grad sum tensor, size=" << size;
-        return RET_ERROR;
+        grad_sum_ = reinterpret_cast<float *>(ms_context_->allocator->Malloc(size));
+        if (grad_sum_ == nullptr) {
+          MS_LOG(ERROR) << "failed to malloc grad sum tensor, size=" << size;
+          return RET_ERROR;
+        }
+        grad_sum_size_ = size;
       }
       valid_grad_sum_ = false;
       std::fill(grad_sum_, grad_sum_ + elem_num, 0);
@@ -141,26 +147,41 @@ class OptimizerKernel : public LiteKernel {
         }
         ms_context_->allocator->Free(grad_sum_);
         grad_sum_ = nullptr;
+        grad_sum_size_ = 0;
       }
     }
     return RET_OK;
   }
 
   int ExecuteVirtualBatch(int task_id) {
-    auto gradient = reinterpret_cast<float *>(in_tensors_.at(grad_idx_)->MutableData());
     int length = in_tensors_.at(grad_idx_)->ElementsNum();
-
     int stride = UP_DIV(length, ms_context_->thread_num_);
     int count = MSMIN(stride, length - stride * task_id);
     int start = stride * task_id;
-    int end = start + count;
-    for (int i = start; i < end; ++i) {
-      grad_sum_[i] += gradient[i];
+    return AccumulateGrads(start, start + count);
+  }
+
+  int AccumulateGrads(int start, int end) {
+    if (end <= start) {
+      return RET_OK;
     }
+    auto gradient = reinterpret_cast<float *>(in_tensors_.at(grad_idx_)->MutableData());
+    CHECK_NULL_RETURN(gradient);
+    CHECK_NULL_RETURN(grad_sum_);
+    (void)ElementAdd(grad_sum_ + start, gradient + start, grad_sum_ + start, end - start);
     valid_grad_sum_ = true;
     return RET_OK;
   }
 
+  // the fused optimizer of the train session updates the weights of all the optimizer kernels in one parallel pass,
+  // BeginFusedUpdate and EndFusedUpdate are called once for the kernel around the pass, and UpdateWeight updates the
+  // elements [start, end) of the weight in the current mode.
+  virtual bool SupportFusedUpdate() const { return false; }
+  virtual int BeginFusedUpdate() { return RET_OK; }
+  virtual int UpdateWeight(int start, int end) { return RET_NOT_SUPPORT; }
+  virtual int EndFusedUpdate() { return RET_OK; }
+  int WeightElementsNum() const { return static_cast<int>(in_tensors_.at(grad_idx_)->ElementsNum()); }
+
   virtual int OptimizerStep() {
     valid_grad_sum_ = false;
     return RET_OK;
@@ -218,6 +239,7 @@ class OptimizerKernel : public LiteKernel {
   int lr_idx_ = 0;
   int grad_idx_ = 0;
   float *grad_sum_ = nullptr;
+  size_t grad_sum_size_ = 0;
   std::atomic_bool valid_grad_sum_ = false;
 
  private:
@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/train/recompute_planner.h"
+#include <algorithm>
+#include <map>
+#include <utility>
+#include "src/train/opt_allocator.h"
+
+namespace mindspore {
+namespace lite {
+namespace {
+using TensorVersion = std::pair<lite::Tensor *, size_t>;
+}  // namespace
+
+RecomputePlanner::RecomputePlanner(const std::vector<kernel::KernelExec *> &kernels, size_t forward_num,
+                                   const std::vector<bool> &recomputable)
+    : kernels_(kernels), forward_num_(std::min(forward_num, kernels.size())), recomputable_(recomputable) {
+  recomputable_.resize(forward_num_, false);
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    for (auto tensor : kernels_[i]->in_tensors()) {
+      if (i < forward_num_) {
+        forward_consumers_[tensor].push_back(i);
+      } else {
+        (void)backward_inputs_.insert(tensor);
+      }
+      external_refs_[tensor]--;
+    }
+    for (auto tensor : kernels_[i]->out_tensors()) {
+      external_refs_[tensor] += tensor->init_ref_count();
+    }
+  }
+  for (size_t i = 0; i < forward_num_; ++i) {
+    for (auto tensor : kernels_[i]->out_tensors()) {
+      if (backward_inputs_.find(tensor) != backward_inputs_.end()) {
+        activation_size_ += tensor->Size();
+      }
+    }
+  }
+}
+
+std::vector<std::vector<size_t>> RecomputePlanner::SplitSegments(size_t segment_limit) const {
+  std::vector<std::vector<size_t>> segments;
+  std::vector<size_t> segment;
+  size_t segment_size = 0;
+  for (size_t i = 0; i < forward_num_; ++i) {
+    if (!recomputable_[i]) {
+      // the output of the kernel which can not be run again is always kept.
+      if (!segment.empty()) {
+        segments.push_back(std::move(segment));
+      }
+      segment.clear();
+      segment_size = 0;
+      continue;
+    }
+    size_t size = 0;
+    for (auto tensor : kernels_[i]->out_tensors()) {
+      if (backward_inputs_.find(tensor) != backward_inputs_.end()) {
+        size += tensor->Size();
+      }
+    }
+    if (!segment.empty() && segment_size + size > segment_limit) {
+      segments.push_back(std::move(segment));
+      segment.clear();
+      segment_size = 0;
+    }
+    segment.push_back(i);
+    segment_size += size;
+  }
+  if (!segment.empty()) {
+    segments.push_back(std::move(segment));
+  }
+  return segments;
+}
+
+size_t RecomputePlanner::Plan(size_t segment_limit) {
+  auto segments = SplitSegments(segment_limit);
+  std::vector<int> segment_ids(forward_num_, -1);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    for (auto index : segments[i]) {
+      segment_ids[index] = static_cast<int>(i);
+    }
+  }
+  // the activations dropped after the forward are used by the backward, and only by the forward kernels of the same
+  // segment, the others are the checkpoints.
+  std::unordered_map<lite::Tensor *, int> dropped_tensors;
+  for (size_t i = 0; i < forward_num_; ++i) {
+    if (segment_ids[i] < 0) {
+      continue;
+    }
+    for (auto tensor : kernels_[i]->out_tensors()) {
+      if (backward_inputs_.find(tensor) == backward_inputs_.end() || external_refs_[tensor] > 0) {
+        continue;
+      }
+      auto &consumers = forward_consumers_[tensor];
+      if (std::all_of(consumers.begin(), consumers.end(),
+                      [&segment_ids, i](size_t index) { return segment_ids[index] == segment_ids[i]; })) {
+        dropped_tensors[tensor] = segment_ids[i];
+      }
+    }
+  }
+  schedule_.assign(kernels_.begin(), kernels_.begin() + forward_num_);
+  std::vector<bool> recomputed(segments.size(), false);
+  for (size_t i = forward_num_; i < kernels_.size(); ++i) {
+    for (auto tensor : kernels_[i]->in_tensors()) {
+      auto iter = dropped_tensors.find(tensor);
+      if (iter == dropped_tensors.end() || recomputed[iter->second]) {
+        continue;
+      }
+      recomputed[iter->second] = true;
+      for (auto index : segments[iter->second]) {
+        schedule_.push_back(kernels_[index]);
+      }
+    }
+    schedule_.push_back(kernels_[i]);
+  }
+  return Allocate();
+}
+
+size_t RecomputePlanner::Allocate() {
+  // count the uses of each version of the tensors, a version is named by the step producing it.
+  std::map<TensorVersion, int> ref_count;
+  std::unordered_map<lite::Tensor *, size_t> versions;
+  for (size_t step = 0; step < schedule_.size(); ++step) {
+    for (auto tensor : schedule_[step]->in_tensors()) {
+      auto iter = versions.find(tensor);
+      if (tensor->category() == lite::Category::VAR && iter != versions.end()) {
+        ref_count[{tensor, iter->second}]++;
+      }
+    }
+    for (auto tensor : schedule_[step]->out_tensors()) {
+      versions[tensor] = step;
+    }
+  }
+  OptAllocator allocator;
+  std::map<TensorVersion, size_t> offset_map;
+  versions.clear();
+  offsets_.assign(schedule_.size(), {});
+  for (size_t step = 0; step < schedule_.size(); ++step) {
+    std::vector<TensorVersion> inputs;
+    for (auto tensor : schedule_[step]->in_tensors()) {
+      auto iter = versions.find(tensor);
+      if (tensor->category() == lite::Category::VAR && iter != versions.end()) {
+        inputs.emplace_back(tensor, iter->second);
+      }
+    }
+    for (auto tensor : schedule_[step]->out_tensors()) {
+      auto offset = allocator.Malloc(tensor->Size());
+      offsets_[step].push_back(offset);
+      offset_map[{tensor, step}] = offset;
+      versions[tensor] = step;
+    }
+    for (auto &input : inputs) {
+      if (--ref_count[input] == 0 && external_refs_[input.first] <= 0) {
+        allocator.Free(offset_map[input]);
+      }
+    }
+  }
+  return allocator.total_size();
+}
+}  // namespace lite
+}  // namespace mindspore
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_TRAIN_RECOMPUTE_PLANNER_H_
+#define MINDSPORE_LITE_SRC_TRAIN_RECOMPUTE_PLANNER_H_
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "src/litert/kernel_exec.h"
+
+namespace mindspore {
+namespace lite {
+// The recompute planner splits the forward kernels into the checkpointed segments. The activations which are only
+// used inside its segment and by the backward kernels are freed after the forward, and the segment is run again just
+// before the first backward kernel using them. The memory of the tensors is planned by the versions of each tensor, a
+// tensor gets a new offset each time it is produced, which is set to the tensor before the kernel runs.
+class RecomputePlanner {
+ public:
+  // the first forward_num kernels are the forward kernels, the recomputable ones must keep no state between runs.
+  RecomputePlanner(const std::vector<kernel::KernelExec *> &kernels, size_t forward_num,
+                   const std::vector<bool> &recomputable);
+  ~RecomputePlanner() = default;
+
+  // plan the segments whose activations used by the backward are at most segment_limit bytes, return the total size
+  // of the tensor memory.
+  size_t Plan(size_t segment_limit);
+  // the kernels to run, including the recomputed segments.
+  const std::vector<kernel::KernelExec *> &schedule() const { return schedule_; }
+  // the offsets of the output tensors of each kernel in the schedule.
+  const std::vector<std::vector<size_t>> &offsets() const { return offsets_; }
+  // the bytes of the forward outputs used by the backward kernels.
+  size_t activation_size() const { return activation_size_; }
+
+ private:
+  std::vector<std::vector<size_t>> SplitSegments(size_t segment_limit) const;
+  size_t Allocate();
+
+  std::vector<kernel::KernelExec *> kernels_;
+  size_t forward_num_;
+  std::vector<bool> recomputable_;
+  size_t activation_size_ = 0;
+  std::unordered_set<lite::Tensor *> backward_inputs_;
+  std::unordered_map<lite::Tensor *, std::vector<size_t>> forward_consumers_;
+  // the refs of the tensor not from the kernels, such as the graph outputs, which are never freed.
+  std::unordered_map<lite::Tensor *, int> external_refs_;
+  std::vector<kernel::KernelExec *> schedule_;
+  std::vector<std::vector<size_t>> offsets_;
+};
+}  // namespace lite
+}  // namespace mindspore
+#endif  // MINDSPORE_LITE_SRC_TRAIN_RECOMPUTE_PLANNER_H_
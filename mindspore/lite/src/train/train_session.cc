@@ -37,6 +37,7 @@
 #include "src/train/train_utils.h"
 #include "src/train/train_export.h"
 #include "src/train/opt_allocator.h"
+#include "src/train/recompute_planner.h"
 #include "src/train/static_allocator.h"
 #include "src/train/train_populate_parameter.h"
 #include "src/train/train_populate_parameter_v0.h"
@@ -261,6 +262,8 @@ int TrainSession::UpdateWeights(std::vector<lite::Tensor *> modify_tensors) {
 
 int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels) {
   if (!IS_STATIC_ALLOCATOR(allocator_)) return RET_OK;
+  recompute_kernels_.clear();
+  recompute_offsets_.clear();
   OptAllocator allocator;
   std::unordered_map<lite::Tensor *, int> ref_count;
   std::unordered_map<lite::Tensor *, size_t> offset_map;
@@ -296,6 +299,9 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
   }
   // Set Tensor data
   auto size = allocator.total_size();
+  if (&kernels == &train_kernels_ && cfg_.recompute_memory_budget_ > 0 && size > cfg_.recompute_memory_budget_) {
+    PlanRecompute(&size);
+  }
   if (size > tensors_data_size_) {
     free(tensors_data_);
     tensors_data_ = nullptr;
@@ -319,9 +325,71 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
       }
     }
   }
+  for (size_t i = 0; i < recompute_kernels_.size(); ++i) {
+    SetRecomputeTensorData(recompute_kernels_, i);
+  }
   return RET_OK;
 }
 
+bool TrainSession::IsRecomputable(kernel::KernelExec *kernel) const {
+  // the kernels updating the states or generating the random numbers get different outputs when run again.
+  if (!kernel->IsBuiltin() || IsLossKernel(kernel) || IsMaskOutput(kernel) || IsBN(kernel) ||
+      kernel->type() == schema::PrimitiveType_Dropout) {
+    return false;
+  }
+  return std::all_of(kernel->out_tensors().begin(), kernel->out_tensors().end(),
+                     [](const lite::Tensor *tensor) { return tensor->category() == lite::Category::VAR; });
+}
+
+// choose the largest checkpointed segments which fit the tensors into the recompute memory budget by halving the
+// bytes of the activations kept in one segment, or the plan of the least memory if none fits.
+void TrainSession::PlanRecompute(size_t *size) {
+  size_t forward_num = 0;
+  while (forward_num < train_kernels_.size() && !IsGradKernel(train_kernels_[forward_num])) {
+    forward_num++;
+  }
+  std::vector<bool> recomputable;
+  for (size_t i = 0; i < forward_num; ++i) {
+    recomputable.push_back(IsRecomputable(train_kernels_[i]));
+  }
+  RecomputePlanner planner(train_kernels_, forward_num, recomputable);
+  auto best_size = *size;
+  for (auto limit = planner.activation_size() / 2; limit > 0; limit /= 2) {
+    auto plan_size = planner.Plan(limit);
+    if (plan_size < best_size) {
+      best_size = plan_size;
+      recompute_kernels_ = planner.schedule();
+      recompute_offsets_ = planner.offsets();
+    }
+    if (best_size <= cfg_.recompute_memory_budget_) {
+      break;
+    }
+  }
+  if (recompute_kernels_.empty()) {
+    MS_LOG(WARNING) << "Recompute can not reduce the tensor memory " << *size;
+    return;
+  }
+  if (best_size > cfg_.recompute_memory_budget_) {
+    MS_LOG(WARNING) << "The tensor memory " << best_size << " exceeds the recompute memory budget "
+                    << cfg_.recompute_memory_budget_;
+  }
+  MS_LOG(INFO) << "Recompute " << (recompute_kernels_.size() - train_kernels_.size()) << " kernels, reduce the tensor "
+               << "memory from " << *size << " to " << best_size;
+  *size = best_size;
+}
+
+// the tensors get the offsets of their versions produced by the kernel in the recompute schedule.
+void TrainSession::SetRecomputeTensorData(const std::vector<kernel::KernelExec *> &run_kernels, size_t index) {
+  if (&run_kernels != &recompute_kernels_) {
+    return;
+  }
+  auto &out_tensors = run_kernels[index]->out_tensors();
+  auto &offsets = recompute_offsets_[index];
+  for (size_t i = 0; i < out_tensors.size() && i < offsets.size(); ++i) {
+    out_tensors[i]->set_data(reinterpret_cast<void *>(reinterpret_cast<char *>(tensors_data_) + offsets[i]));
+  }
+}
+
 int TrainSession::CompileGraph(lite::Model *model) { return lite::RET_ERROR; }
 
 int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
@@ -349,6 +417,7 @@ int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
   RestoreOps(restore);
   CompileTrainKernels();      // Prepare a list of train kernels
   CompileOptimizedKernels();  // Prepare a list of kernels which are optimized (weight update step)
+  CompileFusedOptimizer();    // Update the weights of the optimizer kernels in one pass
   CompileTrainOutputs();      // prepare outputs in train mode
   CompileEvalOutputs();       // prepare outputs in eval mode
   // Prepare a list of eval kernels
@@ -379,8 +448,23 @@ TrainSession::~TrainSession() {
 
 int TrainSession::ExecKernels(const KernelCallBack &before, const KernelCallBack &after,
                               const std::vector<kernel::KernelExec *> &run_kernels) {
-  for (auto *kernel : run_kernels) {
+  for (size_t i = 0; i < run_kernels.size(); ++i) {
+    auto *kernel = run_kernels[i];
     MS_ASSERT(kernel != nullptr);
+    SetRecomputeTensorData(run_kernels, i);
+    // the callbacks of each optimizer kernel are kept by running them one by one.
+    if (before == nullptr && after == nullptr &&
+        fused_optimizer_kernels_.find(kernel) != fused_optimizer_kernels_.end()) {
+      if (kernel != fused_optimizer_last_) {
+        continue;
+      }
+      auto ret = fused_optimizer_->Run();
+      if (RET_OK != ret) {
+        MS_LOG(ERROR) << "Execute fused optimizer failed.";
+        return ret;
+      }
+      continue;
+    }
     auto ret = kernel->Execute(before, after);
     if (RET_OK != ret) {
       MS_LOG(ERROR) << "Execute kernel failed, name: " << kernel->name();
@@ -498,8 +582,10 @@ int TrainSession::MixPrecisionPostProcess(kernel::KernelExec *kernel) {
 int TrainSession::MixPrecisionExecKernels(const KernelCallBack &before, const KernelCallBack &after,
                                           const std::vector<kernel::KernelExec *> &run_kernels) {
   float scale = cfg_.mix_precision_cfg_.loss_scale_;
-  for (auto *kernel : run_kernels) {
+  for (size_t i = 0; i < run_kernels.size(); ++i) {
+    auto *kernel = run_kernels[i];
     MS_ASSERT(kernel != nullptr);
+    SetRecomputeTensorData(run_kernels, i);
     auto ret = MixPrecisionPreProcess(kernel, scale);
     if (ret != RET_OK) {
       MS_LOG(ERROR) << "MixPrecisionPreProcess failed.";
@@ -562,7 +648,8 @@ int TrainSession::RunGraph(const KernelCallBack &before, const KernelCallBack &a
     MS_LOG(ERROR) << "context is null";
     return lite::RET_NULL_PTR;
   }
-  auto &run_kernels = (train_mode_) ? train_kernels_ : inference_kernels_;
+  auto &run_kernels = (train_mode_) ? (recompute_kernels_.empty() ? train_kernels_ : recompute_kernels_)
+                                    : inference_kernels_;
   if (context_->IsCpuFloat16Enabled()) {
     ret = MixPrecisionExecKernels(before, after, run_kernels);
   } else {
@@ -830,6 +917,28 @@ void TrainSession::CompileOptimizedKernels() {
   }
 }
 
+void TrainSession::CompileFusedOptimizer() {
+  fused_optimizer_ = nullptr;
+  fused_optimizer_kernels_.clear();
+  fused_optimizer_last_ = nullptr;
+  std::vector<kernel::KernelExec *> optimizers;
+  for (auto kernel : this->train_kernels_) {
+    // the update of the fused optimizer runs later, so the outputs must not be used by the other kernels.
+    if (!IsOptimizer(kernel) || !kernel->IsBuiltin() || !kernel->out_kernels().empty() ||
+        kernel->desc().data_type != kNumberTypeFloat32 ||
+        !static_cast<kernel::OptimizerKernel *>(kernel->kernel())->SupportFusedUpdate()) {
+      continue;
+    }
+    optimizers.push_back(kernel);
+  }
+  if (optimizers.size() <= 1) {
+    return;
+  }
+  fused_optimizer_ = std::make_unique<FusedOptimizer>(context_, optimizers);
+  fused_optimizer_kernels_.insert(optimizers.begin(), optimizers.end());
+  fused_optimizer_last_ = optimizers.back();
+}
+
 int TrainSession::SetLearningRate(float learning_rate) {
   if (learning_rate < 0.0f) {
     MS_LOG(ERROR) << "learning rate should more than 0";
@@ -19,10 +19,12 @@
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <map>
 #include "include/train/train_cfg.h"
 #include "src/litert/lite_session.h"
+#include "src/train/fused_optimizer.h"
 
 /*
        Inheritance Diagram
@@ -120,6 +122,7 @@ class TrainSession : virtual public lite::LiteSession {
   virtual void CompileTrainKernels();
   virtual int CompileInferenceKernels();
   virtual void CompileOptimizedKernels();
+  virtual void CompileFusedOptimizer();
   virtual void CompileTrainOutputs();
   virtual void CompileEvalOutputs();
   virtual int InitCallBack();
@@ -158,6 +161,9 @@ class TrainSession : virtual public lite::LiteSession {
   bool AllInputsNeedScale(kernel::KernelExec *kernel);
   void FreeWorkSpace();
   int AllocTensors(const std::vector<kernel::KernelExec *> &kernels);
+  bool IsRecomputable(kernel::KernelExec *kernel) const;
+  void PlanRecompute(size_t *size);
+  void SetRecomputeTensorData(const std::vector<kernel::KernelExec *> &run_kernels, size_t index);
   bool IsInPlaceKernel(kernel::KernelExec *kernel);
   bool IsInPlaceTensor(kernel::KernelExec *kernel, uint32_t idx,
                        const std::unordered_map<lite::Tensor *, int> &ref_count, uint32_t *input_idx);
@@ -174,6 +180,13 @@ class TrainSession : virtual public lite::LiteSession {
   bool train_mode_ = false;
   void *tensors_data_ = nullptr;
   size_t tensors_data_size_ = 0;
+  // the train kernels with the recomputed segments and the offsets of their outputs, empty if not recomputed.
+  std::vector<kernel::KernelExec *> recompute_kernels_;
+  std::vector<std::vector<size_t>> recompute_offsets_;
+  // the optimizer kernels updated by the fused optimizer, which runs at the last one of them.
+  std::unique_ptr<FusedOptimizer> fused_optimizer_;
+  std::unordered_set<kernel::KernelExec *> fused_optimizer_kernels_;
+  kernel::KernelExec *fused_optimizer_last_ = nullptr;
   std::shared_ptr<Allocator> allocator_;
 };
 
@@ -21,6 +21,7 @@
 #include "ir/dtype/type_id.h"
 #include "include/model.h"
 #include "src/litert/lite_session.h"
+#include "src/litert/runtime_allocator.h"
 
 namespace mindspore {
 namespace lite {
@@ -168,4 +169,27 @@ TEST_F(OptimizeAllocator, RuntimeAllocator1) {
 
   delete lite_session;
 }
+
+TEST_F(OptimizeAllocator, RuntimeAllocatorOptimizePlan) {
+  lite::Tensor tensor_a(kNumberTypeFloat32, {8});
+  lite::Tensor tensor_b(kNumberTypeFloat32, {16});
+  lite::Tensor tensor_c(kNumberTypeFloat32, {16});
+  lite::Tensor tensor_d(kNumberTypeFloat32, {16});
+  RuntimeAllocator allocator;
+  allocator.MallocTensorData(&tensor_a);
+  allocator.MallocTensorData(&tensor_b);
+  allocator.SetDataOffset(&tensor_d, allocator.GetOffsetMap().at(&tensor_b));
+  allocator.FreeTensorData(&tensor_a);
+  // the freed gap of tensor_a is too small for tensor_c, so the greedy plan appends it.
+  allocator.MallocTensorData(&tensor_c);
+  ASSERT_EQ(allocator.total_size(), 160);
+
+  allocator.OptimizePlan();
+  ASSERT_EQ(allocator.total_size(), 128);
+  auto &offsets = allocator.GetOffsetMap();
+  ASSERT_EQ(offsets.at(&tensor_d), offsets.at(&tensor_b));
+  ASSERT_NE(offsets.at(&tensor_b), offsets.at(&tensor_c));
+  ASSERT_EQ(offsets.at(&tensor_a), offsets.at(&tensor_c));
+  ASSERT_NE(allocator.MallocOptData(), nullptr);
+}
 }  // namespace mindspore
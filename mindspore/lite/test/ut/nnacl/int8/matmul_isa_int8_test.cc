@@ -0,0 +1,102 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <random>
+#include "src/common/log_adapter.h"
+#include "common/common_test.h"
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/matmul_avx512_vnni_int8.h"
+#include "src/litert/cpu_info.h"
+#include "src/litert/kernel/cpu/int8/opt_op_handler.h"
+
+namespace mindspore {
+class MatmulIsaInt8Test : public mindspore::CommonTest {
+ public:
+  MatmulIsaInt8Test() {}
+};
+
+// Compare the isa kernel with the reference kernel on the packed 4x16 blocks, both per-layer and per-channel.
+void CompareWithMatmulInt8Opt(MATMUL_OPT_INT8_FUNC matmul_func, int row, int col, int deep, bool peroc,
+                              int act_min = INT8_MIN, int act_max = INT8_MAX, int out_zp = 1) {
+  int row4 = UP_ROUND(row, C4NUM);
+  int col4 = UP_ROUND(col, C4NUM);
+  int deep16 = UP_ROUND(deep, C16NUM);
+  std::mt19937 gen(row * col + deep);
+  std::uniform_int_distribution<int> dist(INT8_MIN, INT8_MAX);
+  std::vector<int8_t> a(row * deep);
+  std::vector<int8_t> b(col * deep);
+  for (auto &value : a) {
+    value = static_cast<int8_t>(dist(gen));
+  }
+  for (auto &value : b) {
+    value = static_cast<int8_t>(dist(gen));
+  }
+  std::vector<int8_t> pack_a(row4 * deep16, 0);
+  std::vector<int8_t> pack_b(col4 * deep16, 0);
+  RowMajor2Row16x4MajorInt8(a.data(), pack_a.data(), row, deep);
+  RowMajor2Row16x4MajorInt8(b.data(), pack_b.data(), col, deep);
+
+  std::vector<int32_t> a_sums(row4);
+  std::vector<int32_t> bias(col4);
+  for (auto &value : a_sums) {
+    value = dist(gen);
+  }
+  for (auto &value : bias) {
+    value = dist(gen);
+  }
+  int channel = peroc ? col4 : 1;
+  std::vector<int32_t> multiplier(channel, 1 << 30);
+  std::vector<int32_t> left_shift(channel, 0);
+  std::vector<int32_t> right_shift(channel, -10);
+  std::vector<int32_t> filter_zp(channel, 1);
+  std::vector<int8_t> expect(row * col);
+  std::vector<int8_t> output(row * col);
+  MatmulInt8Opt(pack_a.data(), pack_b.data(), expect.data(), row, col, deep16, a_sums.data(), bias.data(), act_min,
+                act_max, out_zp, multiplier.data(), left_shift.data(), right_shift.data(), col, peroc,
+                filter_zp.data());
+  matmul_func(pack_a.data(), pack_b.data(), output.data(), row, col, deep16, a_sums.data(), bias.data(), act_min,
+              act_max, out_zp, multiplier.data(), left_shift.data(), right_shift.data(), col, peroc, filter_zp.data());
+  ASSERT_EQ(0, CommonTest::CompareOutputData(output.data(), expect.data(), row * col, 0));
+}
+
+TEST_F(MatmulIsaInt8Test, MatmulInt8IsaTest) {
+  MATMUL_OPT_INT8_FUNC matmul_func = nullptr;
+#ifdef ENABLE_AVX512
+  // The cpu flags are initialized by the model build, which isn't run by this test.
+  (void)IntelX86CpuInfoInit();
+  if (X86_Avx512Vnni_Support()) {
+    matmul_func = MatmulInt8Avx512Vnni;
+  }
+#endif
+#if defined(ENABLE_ARM64) && !defined(SUPPORT_NNIE) && !defined(SUPPORT_34XX) && !defined(MACHINE_LINUX_ARM64)
+  if (lite::CpuInfo().ArmIsSupportI8mm()) {
+    matmul_func = MatmulInt8I8mmOpt;
+  }
+#endif
+  if (matmul_func == nullptr) {
+    MS_LOG(INFO) << "The platform does not support the int8 isa kernels.";
+    return;
+  }
+  std::vector<std::vector<int>> shapes = {{1, 1, 1}, {5, 7, 19}, {17, 33, 70}, {64, 96, 128}, {3, 20, 16}};
+  for (auto &shape : shapes) {
+    CompareWithMatmulInt8Opt(matmul_func, shape[0], shape[1], shape[2], false);
+    CompareWithMatmulInt8Opt(matmul_func, shape[0], shape[1], shape[2], true);
+    // The activation clamps a part of the outputs, and the output zero point shifts them.
+    CompareWithMatmulInt8Opt(matmul_func, shape[0], shape[1], shape[2], true, -50, 60, -3);
+  }
+}
+}  // namespace mindspore
@@ -15,6 +15,8 @@
  */
 #include "include/api/model_parallel_runner.h"
 #include <memory>
+#include <thread>
+#include <vector>
 #include "common/common_test.h"
 #include "src/common/file_utils.h"
 
@@ -240,4 +242,55 @@ TEST_F(ModelParallelRunnerTest, RunnerInitByBuf) {
     tensor.SetData(nullptr);
   }
 }
+
+TEST_F(ModelParallelRunnerTest, RunnerPredictWithDynamicBatch) {
+  auto config = std::make_shared<RunnerConfig>();
+  ASSERT_NE(nullptr, config);
+
+  auto context = std::make_shared<Context>();
+  ASSERT_NE(nullptr, context);
+  auto &device_list = context->MutableDeviceInfo();
+  auto device_info = std::make_shared<mindspore::CPUDeviceInfo>();
+  ASSERT_NE(nullptr, device_info);
+  device_list.push_back(device_info);
+  ASSERT_EQ(device_list.size(), 1);
+
+  config->SetContext(context);
+  config->SetWorkersNum(1);
+  config->SetConfigInfo("model_pool", {{"dynamic_batch_size", "4"}, {"dynamic_batch_delay_us", "2000"}});
+  ModelParallelRunner runner;
+  auto status = runner.Init(model_path, config);
+  ASSERT_EQ(status, kSuccess);
+
+  constexpr size_t kRequestNum = 4;
+  std::vector<std::vector<MSTensor>> all_inputs(kRequestNum);
+  std::vector<std::vector<MSTensor>> all_outputs(kRequestNum);
+  std::vector<Status> all_status(kRequestNum);
+  for (auto &inputs : all_inputs) {
+    inputs = runner.GetInputs();
+    SetInputTensorData(&inputs);
+  }
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kRequestNum; i++) {
+    threads.emplace_back([&, i]() { all_status[i] = runner.Predict(all_inputs[i], &all_outputs[i]); });
+  }
+  for (auto &th : threads) {
+    th.join();
+  }
+  for (size_t i = 0; i < kRequestNum; i++) {
+    ASSERT_EQ(all_status[i], kSuccess);
+    ASSERT_EQ(all_outputs[i].size(), 1);
+    // the outputs of the merged batch are scattered back to each request
+    ASSERT_EQ(all_outputs[i].front().DataSize(), kOutputDataSize);
+    ASSERT_EQ(memcmp(all_outputs[i].front().Data().get(), all_outputs[0].front().Data().get(), kOutputDataSize), 0);
+  }
+  // free user data
+  for (auto &inputs : all_inputs) {
+    for (auto &tensor : inputs) {
+      char *data = static_cast<char *>(tensor.MutableData());
+      delete[] data;
+      tensor.SetData(nullptr);
+    }
+  }
+}
 }  // namespace mindspore
@@ -18,6 +18,7 @@
 #include "src/common/utils.h"
 #define private public
 #include "src/extendrt/dynamic_mem_manager.h"
+#include "src/extendrt/dynamic_mem_allocator.h"
 #include "src/extendrt/numa_adapter.h"
 #undef private
 
@@ -539,6 +540,41 @@ TEST_F(DynamicMemManagerTest, test_set_ref_count) {
   ref_count = mem->DecRefCount(data, 1);
   ASSERT_EQ(ref_count, 2);
 }
+
+TEST_F(DynamicMemManagerTest, test_release_free_memory) {
+  DynamicMemManager mem_manager;
+  auto mem = mem_manager.GetMemOperator(-1);
+  ASSERT_NE(mem, nullptr);
+  auto data = mem->Malloc(kAllocUnitSize + kTestAllocSize);
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(mem->all_datas_.size(), 2);
+  ASSERT_EQ(mem->ReleaseFreeMemory(), 0);
+  mem->Free(data);
+  ASSERT_EQ(mem->ReleaseFreeMemory(), kAllocUnitSize + kTestAllocSize);
+  ASSERT_EQ(mem->all_datas_.size(), 1);
+  ASSERT_EQ(mem->free_blocks_.size(), 1);
+}
+
+TEST_F(DynamicMemManagerTest, test_allocator_bucket_cache) {
+  DynamicMemAllocator allocator(-1);
+  auto data = allocator.Malloc(kTestAllocSize3);
+  ASSERT_NE(data, nullptr);
+  ASSERT_EQ(allocator.SetRefCount(data, 1), 1);
+  ASSERT_EQ(allocator.DecRefCount(data, 1), 0);
+  allocator.Free(data);
+  // the size rounded up to the same power of two bucket reuses the cached block.
+  auto data2 = allocator.Malloc(kTestAllocSize3 + kTestAllocSize);
+  ASSERT_EQ(data2, data);
+  auto stats = allocator.GetCacheStats();
+  ASSERT_EQ(stats.malloc_count, 2);
+  ASSERT_EQ(stats.hit_count, 1);
+  ASSERT_GT(stats.Fragmentation(), 0.0f);
+  allocator.Free(data2);
+  allocator.ReleaseCache();
+  stats = allocator.GetCacheStats();
+  ASSERT_EQ(stats.cached_size, 0);
+  ASSERT_EQ(stats.in_use_size, 0);
+}
 }  // namespace mindspore
 
 #endif
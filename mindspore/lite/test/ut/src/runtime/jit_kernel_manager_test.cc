@@ -0,0 +1,179 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/jit_kernel_manager.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_avx512_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#include "nnacl/experimental/jit/gemm_avx512_jit.h"
+#endif
+
+namespace mindspore {
+class JitKernelManagerTest : public mindspore::CommonTest {
+ public:
+  JitKernelManagerTest() = default;
+};
+
+#if defined(ENABLE_AVX512) && defined(__linux__)
+namespace {
+// Compare the jit kernel of one block with the reference C kernel GemmRowxColKernelFp32 on the same data, dst has a
+// larger stride than the block, so the columns out of the block must not be written.
+void CompareWithReferenceKernel(int row_block, int col_block, int depth, int act_flag, bool has_bias, int k_unroll) {
+  int col = col_block * C16NUM;
+  int dst_stride = col + C16NUM;
+  JitGemmAvx512Param param = {row_block, col_block, depth, depth, dst_stride, act_flag, has_bias ? 1 : 0, k_unroll};
+  auto key = "jit_kernel_manager_test_" + std::to_string(row_block) + "x" + std::to_string(col) + "_d" +
+             std::to_string(depth) + "_a" + std::to_string(act_flag) + "_b" + std::to_string(param.has_bias_) + "_u" +
+             std::to_string(k_unroll);
+  auto emit_func = [&param](uint8_t *code, size_t capacity) { return JitGemmAvx512Emit(&param, code, capacity); };
+  auto kernel = reinterpret_cast<GemmAvx512Kernel>(
+    lite::JitKernelManager::GetInstance()->GetKernel(key, JIT_GEMM_AVX512_MAX_CODE_SIZE, emit_func));
+  ASSERT_NE(kernel, nullptr) << key;
+  std::vector<float> src(row_block * depth);
+  std::vector<float> weight(depth * col);
+  std::vector<float> bias(col);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<float>(i % 13) * 0.25f - 1.25f;
+  }
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<float>(i % 11) * 0.0625f - 0.25f;
+  }
+  for (size_t i = 0; i < bias.size(); ++i) {
+    bias[i] = static_cast<float>(i % 5) - 1.0f;
+  }
+  const float *bias_data = has_bias ? bias.data() : nullptr;
+  std::vector<float> expect(row_block * dst_stride, 0.0f);
+  std::vector<float> output(row_block * dst_stride, 0.0f);
+  GemmRowxColKernelFp32(expect.data(), src.data(), weight.data(), bias_data, act_flag, row_block, col_block, depth,
+                        depth, dst_stride, 2);
+  kernel(output.data(), src.data(), weight.data(), bias_data, act_flag, row_block, col_block, depth, depth, dst_stride,
+         2);
+  EXPECT_EQ(0, CommonTest::CompareOutputData(output.data(), expect.data(), output.size(), 1e-6)) << key;
+  (void)std::remove(("./" + key + ".jit").c_str());
+}
+}  // namespace
+#endif
+
+#ifdef __linux__
+TEST_F(JitKernelManagerTest, test_generate_and_cache) {
+  auto jit_manager = lite::JitKernelManager::GetInstance();
+  jit_manager->Init(true, ".");
+  ASSERT_TRUE(jit_manager->enable());
+  const std::string key = "jit_kernel_manager_test_ret";
+  (void)std::remove(("./" + key + ".jit").c_str());
+  int emit_num = 0;
+  auto emit_func = [&emit_num](uint8_t *code, size_t capacity) -> size_t {
+    ++emit_num;
+    if (capacity < 1) {
+      return 0;
+    }
+    code[0] = 0xc3;  // ret
+    return 1;
+  };
+  auto kernel = jit_manager->GetKernel(key, 16, emit_func);
+  ASSERT_NE(kernel, nullptr);
+  ASSERT_EQ(*static_cast<uint8_t *>(kernel), 0xc3);
+  ASSERT_EQ(jit_manager->GetKernel(key, 16, emit_func), kernel);
+  ASSERT_EQ(emit_num, 1);
+  std::ifstream ifs("./" + key + ".jit", std::ios::binary);
+  ASSERT_TRUE(ifs.good());
+  ifs.close();
+  (void)std::remove(("./" + key + ".jit").c_str());
+
+  auto failed_func = [](uint8_t *, size_t) -> size_t { return 0; };
+  ASSERT_EQ(jit_manager->GetKernel("jit_kernel_manager_test_failed", 16, failed_func), nullptr);
+}
+#endif
+
+#if defined(ENABLE_AVX512) && defined(__linux__)
+TEST_F(JitKernelManagerTest, test_gemm_avx512) {
+  // The cpu flags are initialized by the model build, which isn't run by this test.
+  (void)IntelX86CpuInfoInit();
+  if (!X86_Avx512_Support()) {
+    return;
+  }
+  auto jit_manager = lite::JitKernelManager::GetInstance();
+  jit_manager->Init(true, "");
+  constexpr int kRow = 5;
+  constexpr int kColBlock = 2;
+  constexpr int kCol = kColBlock * 16;
+  constexpr int kDepth = 37;
+  constexpr int kDstStride = 48;
+  std::vector<float> src(kRow * kDepth);
+  std::vector<float> weight(kDepth * kCol);
+  std::vector<float> bias(kCol);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<float>(i % 13) * 0.25f - 1.5f;
+  }
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<float>(i % 7) * 0.125f - 0.375f;
+  }
+  for (size_t i = 0; i < bias.size(); ++i) {
+    bias[i] = static_cast<float>(i % 5) - 2.0f;
+  }
+  // relu6
+  JitGemmAvx512Param param = {kRow, kColBlock, kDepth, kDepth, kDstStride, 0x3, 1, 4};
+  auto kernel = reinterpret_cast<GemmAvx512Kernel>(jit_manager->GetKernel(
+    "jit_kernel_manager_test_gemm", JIT_GEMM_AVX512_MAX_CODE_SIZE,
+    [&param](uint8_t *code, size_t capacity) { return JitGemmAvx512Emit(&param, code, capacity); }));
+  ASSERT_NE(kernel, nullptr);
+  std::vector<float> dst(kRow * kDstStride, 0.0f);
+  kernel(dst.data(), src.data(), weight.data(), bias.data(), 0x3, kRow, kColBlock, kDepth, kDepth, kDstStride, 2);
+  std::vector<float> expect(kRow * kDstStride, 0.0f);
+  for (int i = 0; i < kRow; ++i) {
+    for (int j = 0; j < kCol; ++j) {
+      float sum = bias[j];
+      for (int k = 0; k < kDepth; ++k) {
+        sum += src[i * kDepth + k] * weight[k * kCol + j];
+      }
+      expect[i * kDstStride + j] = std::min(std::max(sum, 0.0f), 6.0f);
+    }
+  }
+  ASSERT_EQ(0, CompareOutputData(dst.data(), expect.data(), dst.size(), 1e-5));
+  (void)std::remove("./jit_kernel_manager_test_gemm.jit");
+}
+
+TEST_F(JitKernelManagerTest, test_gemm_avx512_with_reference_kernel) {
+  (void)IntelX86CpuInfoInit();
+  if (!X86_Avx512_Support()) {
+    return;
+  }
+  lite::JitKernelManager::GetInstance()->Init(true, "");
+  // all the blocks which MatmulFp32AVX512CPUKernel generates, with the depth shorter than, equal to and not a multiple
+  // of the unroll.
+  int max_shape[C4NUM] = {C12NUM, C12NUM, C8NUM, C6NUM};
+  for (int col_block = 1; col_block <= C4NUM; ++col_block) {
+    for (int row_block = 1; row_block <= max_shape[col_block - 1]; ++row_block) {
+      for (int depth : {1, 16, 37}) {
+        // no activation, relu and relu6
+        for (int act_flag : {0, 2, 3}) {
+          for (int k_unroll : {1, 4, 16}) {
+            CompareWithReferenceKernel(row_block, col_block, depth, act_flag, true, k_unroll);
+          }
+          CompareWithReferenceKernel(row_block, col_block, depth, act_flag, false, 4);
+        }
+      }
+    }
+  }
+}
+#endif
+}  // namespace mindspore
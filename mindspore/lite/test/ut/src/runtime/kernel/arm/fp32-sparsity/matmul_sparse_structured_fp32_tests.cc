@@ -0,0 +1,132 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32_sparse/matmul_sparse_structured_fp32.h"
+
+namespace mindspore {
+class TestMatmulSparseStructuredFp32 : public mindspore::CommonTest {
+ public:
+  TestMatmulSparseStructuredFp32() = default;
+};
+
+namespace {
+constexpr int kRow = 11;
+constexpr int kDeep = 40;
+constexpr int kCol = 37;
+
+void NaiveMatmul(const std::vector<float> &a, const std::vector<float> &b, const std::vector<float> &bias,
+                 std::vector<float> *c, ActType act_type) {
+  for (int r = 0; r < kRow; r++) {
+    for (int j = 0; j < kCol; j++) {
+      float value = bias[j];
+      for (int d = 0; d < kDeep; d++) {
+        value += a[r * kDeep + d] * b[d * kCol + j];
+      }
+      if (act_type == ActType_Relu) {
+        value = std::max(value, 0.0f);
+      }
+      (*c)[r * kCol + j] = value;
+    }
+  }
+}
+
+void InitData(std::vector<float> *a, std::vector<float> *bias) {
+  a->resize(kRow * kDeep);
+  bias->resize(kCol);
+  for (int i = 0; i < kRow * kDeep; i++) {
+    (*a)[i] = static_cast<float>((i * 7) % 13) / 13.0f - 0.5f;
+  }
+  for (int j = 0; j < kCol; j++) {
+    (*bias)[j] = static_cast<float>(j % 5) * 0.1f - 0.2f;
+  }
+}
+
+std::vector<float> Transpose(const std::vector<float> &b) {
+  std::vector<float> b_trans(kCol * kDeep);
+  for (int d = 0; d < kDeep; d++) {
+    for (int j = 0; j < kCol; j++) {
+      b_trans[j * kDeep + d] = b[d * kCol + j];
+    }
+  }
+  return b_trans;
+}
+}  // namespace
+
+TEST_F(TestMatmulSparseStructuredFp32, BlockSparse) {
+  std::vector<float> a, bias;
+  InitData(&a, &bias);
+  // only a few deep rows of every column tile are non-zero.
+  std::vector<float> b(kDeep * kCol, 0.0f);
+  for (int d = 0; d < kDeep; d++) {
+    for (int j = 0; j < kCol; j++) {
+      if ((d + j / SPARSE_COL_TILE) % 3 == 0) {
+        b[d * kCol + j] = static_cast<float>((d * 5 + j * 3) % 17) / 17.0f - 0.5f;
+      }
+    }
+  }
+  std::vector<float> expect(kRow * kCol);
+  NaiveMatmul(a, b, bias, &expect, ActType_Relu);
+
+  int block_num = SparseBlockCount(b.data(), kDeep, kCol, false);
+  ASSERT_EQ(block_num, SparseBlockCount(Transpose(b).data(), kDeep, kCol, true));
+  ASSERT_LT(block_num, kDeep * UP_DIV(kCol, SPARSE_COL_TILE) / 2);
+  std::vector<uint8_t> packed(SparseBlockPackedSize(kCol, block_num));
+  SparseBlockPack(b.data(), packed.data(), kDeep, kCol, false, block_num);
+  std::vector<float> out(kRow * kCol, 0.0f);
+  // the columns are computed by two parts, as the multi-thread cutting does.
+  MatMulSparseBlockFp32(a.data(), packed.data(), block_num, out.data(), bias.data(), ActType_Relu, kDeep, kRow, kCol, 0,
+                        SPARSE_COL_TILE, kCol);
+  MatMulSparseBlockFp32(a.data(), packed.data(), block_num, out.data(), bias.data(), ActType_Relu, kDeep, kRow, kCol,
+                        SPARSE_COL_TILE, kCol, kCol);
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), kRow * kCol, 1e-5));
+}
+
+TEST_F(TestMatmulSparseStructuredFp32, NMSparse) {
+  std::vector<float> a, bias;
+  InitData(&a, &bias);
+  const int patterns[][2] = {{C2NUM, C4NUM}, {C4NUM, C8NUM}};
+  for (auto pattern : patterns) {
+    int n = pattern[0];
+    int m = pattern[1];
+    std::vector<float> b(kDeep * kCol, 0.0f);
+    for (int j = 0; j < kCol; j++) {
+      for (int g = 0; g < kDeep; g += m) {
+        // keep n non-zeros at the different positions of every group.
+        for (int s = 0; s < n; s++) {
+          int d = g + (j + g + s * (m / n)) % m;
+          b[d * kCol + j] = static_cast<float>((d * 5 + j * 3) % 17) / 17.0f - 0.4f;
+        }
+      }
+    }
+    ASSERT_TRUE(SparseCheckNM(b.data(), kDeep, kCol, false, n, m));
+    ASSERT_FALSE(SparseCheckNM(b.data(), kDeep, kCol, false, n - 1, m));
+    auto b_trans = Transpose(b);
+    ASSERT_TRUE(SparseCheckNM(b_trans.data(), kDeep, kCol, true, n, m));
+
+    std::vector<float> expect(kRow * kCol);
+    NaiveMatmul(a, b, bias, &expect, ActType_No);
+    std::vector<uint8_t> packed(SparseNMPackedSize(kDeep, kCol, n, m));
+    SparseNMPack(b_trans.data(), packed.data(), kDeep, kCol, true, n, m);
+    std::vector<float> out(kRow * kCol, 0.0f);
+    MatMulSparseNMFp32(a.data(), packed.data(), out.data(), bias.data(), ActType_No, kDeep, kRow, kCol, 0, kCol, kCol,
+                       n, m);
+    ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), kRow * kCol, 1e-5));
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,170 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/flash_attention_fp32.h"
+
+namespace mindspore {
+class TestFlashAttentionFp32 : public mindspore::CommonTest {
+ public:
+  TestFlashAttentionFp32() {}
+};
+
+namespace {
+std::vector<float> MakeData(size_t size, float factor) {
+  std::vector<float> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = std::sin(factor * (i + 1)) * 0.8f;
+  }
+  return data;
+}
+
+// softmax(q * k^T * scale + mask) * v with the full score matrix.
+std::vector<float> AttentionReference(const std::vector<float> &q, const std::vector<float> &k,
+                                      const std::vector<float> &v, const float *mask, const FlashAttentionArgs &args) {
+  int head_size = args.head_size_;
+  std::vector<float> output(q.size(), 0.0f);
+  std::vector<float> scores(args.k_seq_);
+  for (int b = 0; b < args.batch_; ++b) {
+    for (int h = 0; h < args.head_num_; ++h) {
+      size_t head = static_cast<size_t>(b) * args.head_num_ + h;
+      for (int i = 0; i < args.q_seq_; ++i) {
+        float max = -INFINITY;
+        for (int j = 0; j < args.k_seq_; ++j) {
+          float score = 0.0f;
+          for (int d = 0; d < head_size; ++d) {
+            score += q[(head * args.q_seq_ + i) * head_size + d] * k[(head * args.k_seq_ + j) * head_size + d];
+          }
+          scores[j] = score * args.scale_ + (mask == nullptr ? 0.0f : mask[(b * args.q_seq_ + i) * args.k_seq_ + j]);
+          max = std::max(max, scores[j]);
+        }
+        if (max == -INFINITY) {
+          continue;
+        }
+        float sum = 0.0f;
+        for (int j = 0; j < args.k_seq_; ++j) {
+          scores[j] = std::exp(scores[j] - max);
+          sum += scores[j];
+        }
+        for (int j = 0; j < args.k_seq_; ++j) {
+          for (int d = 0; d < head_size; ++d) {
+            output[(head * args.q_seq_ + i) * head_size + d] +=
+              scores[j] / sum * v[(head * args.k_seq_ + j) * head_size + d];
+          }
+        }
+      }
+    }
+  }
+  return output;
+}
+
+std::vector<float> RunFlashAttention(const std::vector<float> &q, const std::vector<float> &k,
+                                     const std::vector<float> &v, const float *mask, const FlashAttentionArgs &args,
+                                     int thread_num) {
+  std::vector<float> output(q.size(), -1.0f);
+  std::vector<float> buffer(FlashAttentionBufferSize(&args) * thread_num);
+  for (int task_id = 0; task_id < thread_num; ++task_id) {
+    int ret = FlashAttentionFp32(q.data(), k.data(), v.data(), mask, output.data(),
+                                 buffer.data() + FlashAttentionBufferSize(&args) * task_id, &args, task_id, thread_num);
+    EXPECT_EQ(ret, NNACL_OK);
+  }
+  return output;
+}
+
+void ExpectOutputNear(const std::vector<float> &output, const std::vector<float> &expect) {
+  ASSERT_EQ(output.size(), expect.size());
+  for (size_t i = 0; i < output.size(); ++i) {
+    ASSERT_NEAR(output[i], expect[i], 1e-4) << "index " << i;
+  }
+}
+}  // namespace
+
+/// Feature: FlashAttentionFp32
+/// Description: Attention whose sequences and head size are not multiples of the tile, block and simd width, with a
+/// mask which masks some keys, split among 3 tasks
+/// Expectation: The output is the same as the attention with the full score matrix
+TEST_F(TestFlashAttentionFp32, MaskedMultiBlock) {
+  FlashAttentionArgs args = {2, 3, 37, 53, 20, 8, 16, 1.0f / std::sqrt(20.0f)};
+  auto q = MakeData(static_cast<size_t>(args.batch_) * args.head_num_ * args.q_seq_ * args.head_size_, 0.37f);
+  auto k = MakeData(static_cast<size_t>(args.batch_) * args.head_num_ * args.k_seq_ * args.head_size_, 0.53f);
+  auto v = MakeData(static_cast<size_t>(args.batch_) * args.head_num_ * args.k_seq_ * args.head_size_, 0.71f);
+  std::vector<float> mask(static_cast<size_t>(args.batch_) * args.q_seq_ * args.k_seq_, 0.0f);
+  for (int b = 0; b < args.batch_; ++b) {
+    for (int i = 0; i < args.q_seq_; ++i) {
+      for (int j = 0; j < args.k_seq_; ++j) {
+        // a causal mask on the first batch, and a padding mask on the second one.
+        bool masked = b == 0 ? j > i : j >= args.k_seq_ - 10;
+        mask[(b * args.q_seq_ + i) * args.k_seq_ + j] = masked ? -INFINITY : 0.1f * (j % 3);
+      }
+    }
+  }
+  auto expect = AttentionReference(q, k, v, mask.data(), args);
+  auto output = RunFlashAttention(q, k, v, mask.data(), args, 3);
+  ExpectOutputNear(output, expect);
+}
+
+/// Feature: FlashAttentionFp32
+/// Description: Attention without mask by one block of keys and by blocks of one key, and a row whose keys are all
+/// masked
+/// Expectation: The outputs of the blocks are the same as the attention with the full score matrix, and the masked row
+/// is zero
+TEST_F(TestFlashAttentionFp32, BlockSizeAndMaskedRow) {
+  FlashAttentionArgs args = {1, 2, 5, 9, 16, 4, 9, 0.25f};
+  auto q = MakeData(static_cast<size_t>(args.head_num_) * args.q_seq_ * args.head_size_, 1.3f);
+  auto k = MakeData(static_cast<size_t>(args.head_num_) * args.k_seq_ * args.head_size_, 0.9f);
+  auto v = MakeData(static_cast<size_t>(args.head_num_) * args.k_seq_ * args.head_size_, 0.2f);
+  auto expect = AttentionReference(q, k, v, nullptr, args);
+  ExpectOutputNear(RunFlashAttention(q, k, v, nullptr, args, 1), expect);
+  args.k_block_ = 1;
+  args.q_tile_ = 1;
+  ExpectOutputNear(RunFlashAttention(q, k, v, nullptr, args, 2), expect);
+
+  std::vector<float> mask(static_cast<size_t>(args.q_seq_) * args.k_seq_, 0.0f);
+  for (int j = 0; j < args.k_seq_; ++j) {
+    mask[2 * args.k_seq_ + j] = -INFINITY;
+  }
+  args.k_block_ = 4;
+  auto output = RunFlashAttention(q, k, v, mask.data(), args, 1);
+  expect = AttentionReference(q, k, v, mask.data(), args);
+  ExpectOutputNear(output, expect);
+  for (int h = 0; h < args.head_num_; ++h) {
+    for (int d = 0; d < args.head_size_; ++d) {
+      ASSERT_EQ(output[(h * args.q_seq_ + 2) * args.head_size_ + d], 0.0f);
+    }
+  }
+}
+
+/// Feature: FlashAttentionFp32
+/// Description: Attention with an empty tile or block
+/// Expectation: Return error
+TEST_F(TestFlashAttentionFp32, InvalidArgs) {
+  FlashAttentionArgs args = {1, 1, 2, 2, 4, 0, 2, 1.0f};
+  std::vector<float> data(8, 1.0f);
+  std::vector<float> output(8);
+  std::vector<float> buffer(64);
+  ASSERT_EQ(FlashAttentionFp32(data.data(), data.data(), data.data(), nullptr, output.data(), buffer.data(), &args, 0,
+                               1),
+            NNACL_ERR);
+  args.q_tile_ = 1;
+  args.k_block_ = 0;
+  ASSERT_EQ(FlashAttentionFp32(data.data(), data.data(), data.data(), nullptr, output.data(), buffer.data(), &args, 0,
+                               1),
+            NNACL_ERR);
+}
+}  // namespace mindspore
@@ -0,0 +1,184 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_avx512_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
+#ifdef ENABLE_ARM64
+#include "src/litert/cpu_info.h"
+#endif
+
+namespace mindspore {
+class TestMatmulBf16Fp32 : public mindspore::CommonTest {
+ public:
+  TestMatmulBf16Fp32() {}
+};
+
+namespace {
+constexpr int kRow = 7;
+constexpr int kDeep = 37;
+constexpr int kCol = 45;
+
+// The reference matmul of the bf16-rounded a and b[deep, col], the products are accumulated in fp32.
+void NaiveMatmulBf16(const std::vector<float> &a, const std::vector<float> &b, const std::vector<float> &bias,
+                     std::vector<float> *c, bool relu) {
+  for (int r = 0; r < kRow; r++) {
+    for (int j = 0; j < kCol; j++) {
+      float value = bias[j];
+      for (int d = 0; d < kDeep; d++) {
+        value += Bf16ToFloat32(Float32ToBf16(a[r * kDeep + d])) * Bf16ToFloat32(Float32ToBf16(b[d * kCol + j]));
+      }
+      (*c)[r * kCol + j] = relu ? std::max(value, 0.0f) : value;
+    }
+  }
+}
+
+void InitData(std::vector<float> *a, std::vector<float> *b, std::vector<float> *b_trans, std::vector<float> *bias) {
+  a->resize(kRow * kDeep);
+  b->resize(kDeep * kCol);
+  b_trans->resize(kCol * kDeep);
+  bias->resize(kCol);
+  for (int i = 0; i < kRow * kDeep; i++) {
+    (*a)[i] = static_cast<float>((i * 7) % 13) / 13.0f - 0.5f;
+  }
+  for (int d = 0; d < kDeep; d++) {
+    for (int j = 0; j < kCol; j++) {
+      float value = static_cast<float>((d * 5 + j * 3) % 17) / 17.0f - 0.5f;
+      (*b)[d * kCol + j] = value;
+      (*b_trans)[j * kDeep + d] = value;
+    }
+  }
+  for (int j = 0; j < kCol; j++) {
+    (*bias)[j] = static_cast<float>(j % 5) * 0.1f - 0.2f;
+  }
+}
+
+#if defined(ENABLE_AVX512) || defined(ENABLE_ARM64)
+using MatmulBf16IsaFunc = void (*)(const float *a, const uint16_t *b, float *c, const float *bias, int act_type,
+                                   int deep, int row, int col, int stride);
+
+// Compare the isa kernel with the reference c kernel MatMulBf16Fp32 on the same packed weight. Both accumulate in
+// fp32 but in a different order, so the results are only close.
+void CompareWithMatMulBf16Fp32(MatmulBf16IsaFunc matmul_func, int col_tile, int deep_tile, int row, int deep, int col,
+                               int act_type) {
+  std::vector<float> a(row * deep);
+  std::vector<float> b_trans(col * deep);
+  std::vector<float> bias(col);
+  // Mostly positive, so that the large sums are clipped by relu6 and the negative ones by relu.
+  for (int i = 0; i < row * deep; i++) {
+    a[i] = static_cast<float>((i * 7) % 13) / 13.0f - 0.25f;
+  }
+  for (int i = 0; i < col * deep; i++) {
+    b_trans[i] = static_cast<float>((i * 5) % 17) / 17.0f - 0.25f;
+  }
+  for (int j = 0; j < col; j++) {
+    bias[j] = static_cast<float>(j % 5) * 0.1f - 0.2f;
+  }
+  std::vector<uint16_t> packed(MatmulBf16PackedSize(deep, col, col_tile, deep_tile));
+  PackMatrixBToBf16(b_trans.data(), packed.data(), deep, col, true, col_tile, deep_tile);
+  std::vector<float> expect(row * col, 0.0f);
+  std::vector<float> out(row * col, 0.0f);
+  MatMulBf16Fp32(a.data(), packed.data(), expect.data(), bias.data(), act_type, deep, row, col, col, col_tile,
+                 deep_tile);
+  matmul_func(a.data(), packed.data(), out.data(), bias.data(), act_type, deep, row, col, col);
+  ASSERT_EQ(0, CommonTest::CompareOutputData(out.data(), expect.data(), row * col, 1e-5));
+}
+
+const std::vector<std::vector<int>> kIsaShapes = {{1, 1, 1}, {7, 37, 45}, {16, 64, 48}, {13, 130, 17}, {3, 2, 9}};
+#endif
+}  // namespace
+
+TEST_F(TestMatmulBf16Fp32, Bf16Round) {
+  ASSERT_EQ(Float32ToBf16(1.0f), 0x3F80);
+  ASSERT_EQ(Bf16ToFloat32(0x3F80), 1.0f);
+  // 1 + 2^-8 is the tie between 1.0 and 1 + 2^-7, which is rounded to the even one.
+  ASSERT_EQ(Float32ToBf16(1.00390625f), 0x3F80);
+  ASSERT_EQ(Float32ToBf16(1.01171875f), 0x3F82);
+  ASSERT_TRUE(std::isnan(Bf16ToFloat32(Float32ToBf16(NAN))));
+}
+
+TEST_F(TestMatmulBf16Fp32, PackAndMatmul) {
+  std::vector<float> a, b, b_trans, bias;
+  InitData(&a, &b, &b_trans, &bias);
+  std::vector<float> expect(kRow * kCol);
+  NaiveMatmulBf16(a, b, bias, &expect, true);
+
+  const int tiles[][2] = {{MATMUL_BF16_AVX512_COL_TILE, MATMUL_BF16_AVX512_DEEP_TILE},
+                          {MATMUL_BF16_BFMMLA_COL_TILE, MATMUL_BF16_BFMMLA_DEEP_TILE}};
+  for (auto tile : tiles) {
+    int pack_size = MatmulBf16PackedSize(kDeep, kCol, tile[0], tile[1]);
+    ASSERT_EQ(pack_size, UP_ROUND(kDeep, tile[1]) * UP_ROUND(kCol, tile[0]));
+    std::vector<uint16_t> packed(pack_size);
+    std::vector<uint16_t> packed_trans(pack_size);
+    PackMatrixBToBf16(b.data(), packed.data(), kDeep, kCol, false, tile[0], tile[1]);
+    PackMatrixBToBf16(b_trans.data(), packed_trans.data(), kDeep, kCol, true, tile[0], tile[1]);
+    ASSERT_EQ(packed, packed_trans);
+
+    std::vector<float> out(kRow * kCol, 0.0f);
+    MatMulBf16Fp32(a.data(), packed.data(), out.data(), bias.data(), ActType_Relu, kDeep, kRow, kCol, kCol, tile[0],
+                   tile[1]);
+    ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), kRow * kCol, 1e-5));
+  }
+}
+
+#ifdef ENABLE_AVX512
+TEST_F(TestMatmulBf16Fp32, Avx512Bf16Matmul) {
+  // The cpu flags are initialized by the model build, which isn't run by this test.
+  (void)IntelX86CpuInfoInit();
+  if (!X86_Avx512Bf16_Support()) {
+    return;
+  }
+  std::vector<float> a, b, b_trans, bias;
+  InitData(&a, &b, &b_trans, &bias);
+  std::vector<float> expect(kRow * kCol);
+  NaiveMatmulBf16(a, b, bias, &expect, false);
+
+  std::vector<uint16_t> packed(
+    MatmulBf16PackedSize(kDeep, kCol, MATMUL_BF16_AVX512_COL_TILE, MATMUL_BF16_AVX512_DEEP_TILE));
+  PackMatrixBToBf16(b_trans.data(), packed.data(), kDeep, kCol, true, MATMUL_BF16_AVX512_COL_TILE,
+                    MATMUL_BF16_AVX512_DEEP_TILE);
+  std::vector<float> out(kRow * kCol, 0.0f);
+  MatMulBf16Avx512Fp32(a.data(), packed.data(), out.data(), bias.data(), ActType_No, kDeep, kRow, kCol, kCol);
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), kRow * kCol, 1e-5));
+  for (auto &shape : kIsaShapes) {
+    for (int act_type : {ActType_No, ActType_Relu, ActType_Relu6}) {
+      CompareWithMatMulBf16Fp32(MatMulBf16Avx512Fp32, MATMUL_BF16_AVX512_COL_TILE, MATMUL_BF16_AVX512_DEEP_TILE,
+                                shape[0], shape[1], shape[2], act_type);
+    }
+  }
+}
+#endif
+
+#ifdef ENABLE_ARM64
+TEST_F(TestMatmulBf16Fp32, BfmmlaMatmul) {
+  if (!lite::CpuInfo().ArmIsSupportBf16()) {
+    return;
+  }
+  for (auto &shape : kIsaShapes) {
+    for (int act_type : {ActType_No, ActType_Relu, ActType_Relu6}) {
+      CompareWithMatMulBf16Fp32(MatMulBf16BfmmlaFp32, MATMUL_BF16_BFMMLA_COL_TILE, MATMUL_BF16_BFMMLA_DEEP_TILE,
+                                shape[0], shape[1], shape[2], act_type);
+    }
+  }
+}
+#endif
+}  // namespace mindspore
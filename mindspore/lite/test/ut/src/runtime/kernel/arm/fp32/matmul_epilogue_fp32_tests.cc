@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_epilogue_fp32.h"
+
+namespace mindspore {
+class TestMatmulEpilogueFp32 : public mindspore::CommonTest {
+ public:
+  TestMatmulEpilogueFp32() {}
+};
+
+TEST_F(TestMatmulEpilogueFp32, AddMulGelu) {
+  constexpr int row = 3;
+  constexpr int col = 5;
+  constexpr int stride = 8;
+  std::vector<float> dst(row * stride, 0.0f);
+  std::vector<float> residual(row * col);
+  std::vector<float> scale(col);
+  for (int r = 0; r < row; ++r) {
+    for (int c = 0; c < col; ++c) {
+      dst[r * stride + c] = 0.1f * (r * col + c) - 0.7f;
+      residual[r * col + c] = 0.05f * c - 0.2f * r;
+    }
+  }
+  for (int c = 0; c < col; ++c) {
+    scale[c] = 0.5f + 0.25f * c;
+  }
+  std::vector<float> expect(row * stride, 0.0f);
+  for (int r = 0; r < row; ++r) {
+    for (int c = 0; c < col; ++c) {
+      float x = (dst[r * stride + c] + residual[r * col + c]) * scale[c];
+      expect[r * stride + c] = 0.5f * x * (1.0f + erff(x / sqrtf(2.0f)));
+    }
+  }
+
+  MatmulEpilogue epilogue = {};
+  epilogue.ops_[0] = {EpilogueOp_Add, 0, EpilogueBroadcast_None};
+  epilogue.ops_[1] = {EpilogueOp_Mul, 1, EpilogueBroadcast_Col};
+  epilogue.ops_[2] = {EpilogueOp_Gelu, 0, EpilogueBroadcast_None};
+  epilogue.op_num_ = 3;
+  ASSERT_EQ(MatmulEpilogueOperandNum(&epilogue), 2);
+  const float *op_data[MAX_EPILOGUE_OP_NUM] = {residual.data(), scale.data()};
+
+  // apply the epilogue by two tiles, as the threads of the matmul do.
+  ASSERT_EQ(MatmulEpilogueFp32(&epilogue, op_data, dst.data(), stride, 0, row, 0, 2, col), NNACL_OK);
+  ASSERT_EQ(MatmulEpilogueFp32(&epilogue, op_data, dst.data() + 2, stride, 0, row, 2, col - 2, col), NNACL_OK);
+  ASSERT_EQ(0, CompareOutputData(dst.data(), expect.data(), row * stride, 0.0001));
+}
+
+TEST_F(TestMatmulEpilogueFp32, ScalarRelu6) {
+  constexpr int row = 2;
+  constexpr int col = 4;
+  std::vector<float> dst = {-3.0f, -1.0f, 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  float bias = 2.0f;
+  std::vector<float> expect = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 6.0f};
+
+  MatmulEpilogue epilogue = {};
+  epilogue.ops_[0] = {EpilogueOp_Add, 0, EpilogueBroadcast_Scalar};
+  epilogue.ops_[1] = {EpilogueOp_Relu6, 0, EpilogueBroadcast_None};
+  epilogue.op_num_ = 2;
+  const float *op_data[MAX_EPILOGUE_OP_NUM] = {&bias};
+
+  // the second row only, then the first one.
+  ASSERT_EQ(MatmulEpilogueFp32(&epilogue, op_data, dst.data() + col, col, 1, 1, 0, col, col), NNACL_OK);
+  ASSERT_EQ(MatmulEpilogueFp32(&epilogue, op_data, dst.data(), col, 0, 1, 0, col, col), NNACL_OK);
+  ASSERT_EQ(0, CompareOutputData(dst.data(), expect.data(), row * col, 0.0001));
+}
+}  // namespace mindspore
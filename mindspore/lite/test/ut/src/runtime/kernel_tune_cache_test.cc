@@ -0,0 +1,55 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "common/common_test.h"
+#include "src/litert/kernel_tune_cache.h"
+
+namespace mindspore {
+class KernelTuneCacheTest : public mindspore::CommonTest {
+ public:
+  KernelTuneCacheTest() = default;
+};
+
+TEST_F(KernelTuneCacheTest, test_update_and_load) {
+  const std::string cache_file = "./kernel_tune_cache_test.txt";
+  {
+    std::ofstream ofs(cache_file, std::ios::trunc);
+    ofs << "conv2d_fp32_cached 3_6\n";
+    ofs << "invalid_line\n";
+  }
+  auto tune_cache = lite::KernelTuneCache::GetInstance();
+  tune_cache->Init(true, cache_file);
+  ASSERT_TRUE(tune_cache->enable());
+  std::string value;
+  ASSERT_TRUE(tune_cache->Find("conv2d_fp32_cached", &value));
+  ASSERT_EQ(value, "3_6");
+  ASSERT_FALSE(tune_cache->Find("invalid_line", &value));
+  ASSERT_FALSE(tune_cache->Find("conv2d_fp32_new", &value));
+
+  tune_cache->Update("conv2d_fp32_new", "0_0");
+  ASSERT_TRUE(tune_cache->Find("conv2d_fp32_new", &value));
+  ASSERT_EQ(value, "0_0");
+  std::ifstream ifs(cache_file);
+  std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  ASSERT_NE(content.find("conv2d_fp32_cached 3_6\n"), std::string::npos);
+  ASSERT_NE(content.find("conv2d_fp32_new 0_0\n"), std::string::npos);
+  (void)std::remove(cache_file.c_str());
+}
+}  // namespace mindspore
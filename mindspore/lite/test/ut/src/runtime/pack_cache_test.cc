@@ -0,0 +1,64 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/pack_cache.h"
+
+namespace mindspore {
+class PackCacheTest : public mindspore::CommonTest {
+ public:
+  PackCacheTest() = default;
+};
+
+TEST_F(PackCacheTest, test_save_and_load) {
+  std::vector<char> model_buf(1024);
+  for (size_t i = 0; i < model_buf.size(); ++i) {
+    model_buf[i] = static_cast<char>(i % 127);
+  }
+  const void *weight = model_buf.data() + 256;
+  std::vector<float> packed(96, 0.5f);
+  constexpr size_t kPackedSize = 96 * sizeof(float);
+  {
+    lite::PackCache pack_cache;
+    ASSERT_EQ(pack_cache.Init(".", model_buf.data(), model_buf.size()), lite::RET_OK);
+    ASSERT_EQ(pack_cache.Find(weight, kPackedSize), nullptr);
+    pack_cache.Record(weight, kPackedSize, packed.data());
+    // the weight out of the model buffer is not cached.
+    pack_cache.Record(packed.data(), kPackedSize, packed.data());
+    ASSERT_EQ(pack_cache.Save(), lite::RET_OK);
+  }
+  lite::PackCache pack_cache;
+  ASSERT_EQ(pack_cache.Init(".", model_buf.data(), model_buf.size()), lite::RET_OK);
+  ASSERT_EQ(pack_cache.Find(weight, kPackedSize - sizeof(float)), nullptr);
+  ASSERT_EQ(pack_cache.Find(packed.data(), kPackedSize), nullptr);
+  auto cached = pack_cache.Find(weight, kPackedSize);
+  ASSERT_NE(cached, nullptr);
+  ASSERT_EQ(memcmp(cached, packed.data(), kPackedSize), 0);
+  ASSERT_TRUE(pack_cache.Release(cached));
+  ASSERT_FALSE(pack_cache.Release(packed.data()));
+
+  // the changed model is not matched to the saved cache.
+  model_buf[0] = 'x';
+  lite::PackCache changed_cache;
+  ASSERT_EQ(changed_cache.Init(".", model_buf.data(), model_buf.size()), lite::RET_OK);
+  ASSERT_EQ(changed_cache.Find(weight, kPackedSize), nullptr);
+  (void)std::remove(pack_cache.cache_file().c_str());
+}
+}  // namespace mindspore
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/paged_kv_cache.h"
+
+namespace mindspore {
+namespace {
+constexpr int kLayerNum = 2;
+constexpr int kHeadNum = 2;
+constexpr int kHeadSize = 4;
+constexpr int kBlockSize = 4;
+constexpr int kBlockNum = 4;
+constexpr int kTokenSize = kHeadNum * kHeadSize;
+
+std::vector<float> MakeData(int token_num, float seed) {
+  std::vector<float> data(token_num * kTokenSize);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = std::sin(seed + static_cast<float>(i));
+  }
+  return data;
+}
+
+// the causal attention over the contiguous keys and values, the queries are the last tokens.
+std::vector<float> RefAttention(const std::vector<float> &query, const std::vector<float> &keys,
+                                const std::vector<float> &values) {
+  int query_num = static_cast<int>(query.size()) / kTokenSize;
+  int total_num = static_cast<int>(keys.size()) / kTokenSize;
+  std::vector<float> output(query.size(), 0.0f);
+  for (int i = 0; i < query_num; ++i) {
+    int token_num = total_num - query_num + i + 1;
+    for (int h = 0; h < kHeadNum; ++h) {
+      std::vector<float> scores(token_num);
+      for (int t = 0; t < token_num; ++t) {
+        float score = 0.0f;
+        for (int d = 0; d < kHeadSize; ++d) {
+          score += query[i * kTokenSize + h * kHeadSize + d] * keys[t * kTokenSize + h * kHeadSize + d];
+        }
+        scores[t] = score / std::sqrt(static_cast<float>(kHeadSize));
+      }
+      float max_score = *std::max_element(scores.begin(), scores.end());
+      float sum = 0.0f;
+      for (auto &score : scores) {
+        score = std::exp(score - max_score);
+        sum += score;
+      }
+      for (int t = 0; t < token_num; ++t) {
+        for (int d = 0; d < kHeadSize; ++d) {
+          output[i * kTokenSize + h * kHeadSize + d] += scores[t] / sum * values[t * kTokenSize + h * kHeadSize + d];
+        }
+      }
+    }
+  }
+  return output;
+}
+}  // namespace
+
+class PagedKVCacheTest : public mindspore::CommonTest {
+ public:
+  PagedKVCacheTest() = default;
+};
+
+TEST_F(PagedKVCacheTest, test_prefill_and_decode) {
+  lite::PagedKVCache cache(kLayerNum, kHeadNum, kHeadSize, kBlockSize, kBlockNum);
+  ASSERT_EQ(cache.Init(), lite::RET_OK);
+  ASSERT_EQ(cache.AddSequence(0), lite::RET_OK);
+
+  std::vector<std::vector<float>> keys(kLayerNum);
+  std::vector<std::vector<float>> values(kLayerNum);
+  // the prefill of 6 tokens, then the decoding of 1 token, which crosses the boundary of the blocks.
+  std::vector<int> step_tokens{6, 1};
+  for (size_t step = 0; step < step_tokens.size(); ++step) {
+    auto token_num = step_tokens[step];
+    ASSERT_EQ(cache.Reserve(0, token_num), lite::RET_OK);
+    for (int layer = 0; layer < kLayerNum; ++layer) {
+      auto seed = static_cast<float>(step * kLayerNum + layer);
+      auto key = MakeData(token_num, seed);
+      auto value = MakeData(token_num, seed + 0.5f);
+      auto query = MakeData(token_num, seed + 0.25f);
+      ASSERT_EQ(cache.Append(0, layer, key.data(), value.data()), lite::RET_OK);
+      keys[layer].insert(keys[layer].end(), key.begin(), key.end());
+      values[layer].insert(values[layer].end(), value.begin(), value.end());
+
+      std::vector<float> output(query.size());
+      ASSERT_EQ(cache.Attention(0, layer, query.data(), output.data()), lite::RET_OK);
+      auto expect = RefAttention(query, keys[layer], values[layer]);
+      ASSERT_EQ(0, CompareOutputData(output.data(), expect.data(), static_cast<int>(expect.size()), 1e-5));
+    }
+    ASSERT_EQ(cache.Commit(0), lite::RET_OK);
+  }
+  ASSERT_EQ(cache.GetSequenceLength(0), 7);
+  ASSERT_EQ(cache.free_block_num(), 2);
+}
+
+TEST_F(PagedKVCacheTest, test_blocks_reuse) {
+  lite::PagedKVCache cache(kLayerNum, kHeadNum, kHeadSize, kBlockSize, kBlockNum);
+  ASSERT_EQ(cache.Init(), lite::RET_OK);
+  ASSERT_EQ(cache.AddSequence(0), lite::RET_OK);
+  ASSERT_EQ(cache.AddSequence(1), lite::RET_OK);
+  ASSERT_NE(cache.AddSequence(1), lite::RET_OK);
+  ASSERT_EQ(cache.Reserve(0, 5), lite::RET_OK);
+  ASSERT_NE(cache.Reserve(0, 1), lite::RET_OK);
+  ASSERT_EQ(cache.Commit(0), lite::RET_OK);
+  ASSERT_EQ(cache.Reserve(1, 9), lite::RET_OUT_OF_TENSOR_RANGE);
+  ASSERT_EQ(cache.RemoveSequence(0), lite::RET_OK);
+  ASSERT_EQ(cache.free_block_num(), kBlockNum);
+  ASSERT_EQ(cache.Reserve(1, 9), lite::RET_OK);
+  ASSERT_EQ(cache.free_block_num(), 1);
+  ASSERT_EQ(cache.GetSequenceLength(0), -1);
+}
+}  // namespace mindspore
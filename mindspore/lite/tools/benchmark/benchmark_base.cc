@@ -429,12 +429,27 @@ int BenchmarkBase::Init() {
   std::cout << "EnableParallel = " << this->flags_->enable_parallel_ << std::endl;
   std::cout << "calibDataPath = " << this->flags_->benchmark_data_file_ << std::endl;
   std::cout << "EnableGLTexture = " << this->flags_->enable_gl_texture_ << std::endl;
+  if (this->flags_->load_qps_ > 0) {
+    std::cout << "LoadQps = " << this->flags_->load_qps_ << std::endl;
+    std::cout << "LoadRequestNum = " << this->flags_->load_request_num_ << std::endl;
+  }
   if (this->flags_->loop_count_ < 1) {
     MS_LOG(ERROR) << "LoopCount:" << this->flags_->loop_count_ << " must be greater than 0";
     std::cerr << "LoopCount:" << this->flags_->loop_count_ << " must be greater than 0" << std::endl;
     return RET_ERROR;
   }
 
+  bool load_valid = this->flags_->load_qps_ == 0 ||
+                    (this->flags_->load_qps_ > 0 && this->flags_->enable_parallel_predict_ &&
+                     this->flags_->load_request_num_ > 0);
+  if (!load_valid) {
+    MS_LOG(ERROR) << "loadQps must be non-negative, and loadRequestNum must be greater than 0 with "
+                  << "enableParallelPredict";
+    std::cerr << "ERROR: loadQps must be non-negative, and loadRequestNum must be greater than 0 with "
+              << "enableParallelPredict" << std::endl;
+    return RET_ERROR;
+  }
+
   if (this->flags_->enable_gl_texture_ == true && this->flags_->device_ != "GPU") {
     MS_LOG(ERROR) << "device must be GPU if you want to enable GLTexture";
     std::cerr << "ERROR: device must be GPU if you want to enable GLTexture" << std::endl;
@@ -133,6 +133,14 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::perf_profiling_, "perfProfiling",
             "Perf event profiling(only instructions statics enabled currently)", false);
     AddFlag(&BenchmarkFlags::perf_event_, "perfEvent", "CYCLE|CACHE|STALL", "CYCLE");
+    AddFlag(&BenchmarkFlags::peak_gflops_, "peakGflops",
+            "peak GFLOP/s of the device, used by the roofline of time profiling, unknown when the value is 0", 0.0f);
+    AddFlag(&BenchmarkFlags::peak_bandwidth_, "peakBandwidth",
+            "peak memory bandwidth in GB/s of the device, used by the roofline of time profiling", 0.0f);
+    AddFlag(&BenchmarkFlags::hw_counter_, "hwCounter",
+            "Collect the cycles, instructions and cache misses of each op by perf_event in time profiling, only on "
+            "linux and android",
+            false);
     // MarkAccuracy
     AddFlag(&BenchmarkFlags::benchmark_data_file_, "benchmarkDataFile", "Benchmark data file path", "");
     AddFlag(&BenchmarkFlags::benchmark_data_type_, "benchmarkDataType",
@@ -152,6 +160,13 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
     AddFlag(&BenchmarkFlags::parallel_task_num_, "parallelTaskNum",
             "parallel task num of parallel predict, unlimited number of tasks when the value is -1", 2);
     AddFlag(&BenchmarkFlags::workers_num_, "workersNum", "works num of parallel predict", 2);
+    AddFlag(&BenchmarkFlags::load_qps_, "loadQps",
+            "target qps of the open-loop load generator of parallel predict, the requests arrive as a poisson process "
+            "and are served by parallelNum clients, disabled when the value is 0",
+            0.0);
+    AddFlag(&BenchmarkFlags::load_request_num_, "loadRequestNum", "request num sent by the load generator", 1000);
+    AddFlag(&BenchmarkFlags::latency_report_file_, "latencyReportFile",
+            "latency report file of the load generator, json if it ends with .json, csv otherwise", "");
     AddFlag(&BenchmarkFlags::core_list_str_, "cpuCoreList", "The core id of the bundled core, e.g. 0,1,2,3", "");
     AddFlag(&BenchmarkFlags::inter_op_parallel_num_, "interOpParallelNum", "parallel number of operators in predict",
             1);
@@ -173,6 +188,9 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
   int parallel_task_num_ = 2;
   int inter_op_parallel_num_ = 1;
   int workers_num_ = 2;
+  double load_qps_ = 0;
+  int load_request_num_ = 1000;
+  std::string latency_report_file_;
   std::string model_file_;
   std::string in_data_file_;
   std::string config_file_;
@@ -203,6 +221,9 @@ class MS_API BenchmarkFlags : public virtual FlagParser {
   bool time_profiling_ = false;
   bool perf_profiling_ = false;
   std::string perf_event_ = "CYCLE";
+  float peak_gflops_ = 0.0f;
+  float peak_bandwidth_ = 0.0f;
+  bool hw_counter_ = false;
   bool dump_tensor_data_ = false;
   bool print_tensor_data_ = false;
   std::string decrypt_key_str_;
@@ -40,7 +40,13 @@
 #include "include/mpi_vb.h"
 #endif
 #ifdef PARALLEL_INFERENCE
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <random>
 #include <thread>
+#include "tools/benchmark/latency_recorder.h"
 #endif
 namespace mindspore {
 constexpr size_t kDataToStringMaxNum = 40;
@@ -51,6 +57,9 @@ constexpr int kDumpInputsAndOutputs = 0;
 constexpr int kDumpOutputs = 2;
 #ifdef PARALLEL_INFERENCE
 constexpr int kMaxRequestNum = 200;
+// the fixed seed of the arrivals, so the load of the runs with the same flags is reproducible.
+constexpr uint64_t kLoadGeneratorSeed = 20220901;
+constexpr double kUsPerSecond = 1000000.0;
 #endif
 namespace lite {
 int BenchmarkUnifiedApi::GenerateGLTexture(std::map<std::string, GLuint> *input_gl_texture) {
@@ -767,6 +776,8 @@ int BenchmarkUnifiedApi::MarkPerformance() {
     const std::vector<std::string> per_op_type = {"opType", "avg(ms)", "percent", "calledTimes", "opTotalTime"};
     PrintResult(per_op_name, op_times_by_name_);
     PrintResult(per_op_type, op_times_by_type_);
+    roofline_profiler_.Print("opName", op_times_by_name_, false);
+    roofline_profiler_.Print("opType", op_times_by_type_, true);
 #ifdef ENABLE_ARM64
   } else if (flags_->perf_profiling_) {
     if (flags_->perf_event_ == "CACHE") {
@@ -958,6 +969,93 @@ void BenchmarkUnifiedApi::ModelParallelRunnerRun(int task_num, int parallel_idx)
   }
 }
 
+int BenchmarkUnifiedApi::ModelParallelRunnerPredict(int idx, std::vector<mindspore::MSTensor> *output) {
+  auto in = model_runner_.GetInputs();
+  for (size_t tensor_index = 0; tensor_index < in.size(); tensor_index++) {
+    in.at(tensor_index).SetData(all_inputs_data_.at(idx)[tensor_index]);
+    in.at(tensor_index).SetShape(resize_dims_.at(tensor_index));
+  }
+  auto ret = model_runner_.Predict(in, output);
+  for (auto &item : in) {
+    item.SetData(nullptr);
+  }
+  if (ret != kSuccess) {
+    MS_LOG(ERROR) << "model pool predict failed.";
+    return RET_ERROR;
+  }
+  return RET_OK;
+}
+
+// Open-loop load: the arrivals are generated as a poisson process of the target qps regardless of the completions,
+// and the parallelNum clients serve them in order. The latency is measured from the scheduled arrival, so the
+// queueing delay under overload is counted instead of being hidden by the slow requests.
+int BenchmarkUnifiedApi::RunLoadGenerator() {
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::deque<uint64_t> arrivals;
+  bool done = false;
+  LatencyRecorder recorder;
+  auto client = [&, this](int client_idx) {
+    int idx = client_idx + flags_->warm_up_loop_count_;
+    auto output = all_outputs_[idx];
+    while (true) {
+      uint64_t arrival;
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&arrivals, &done]() { return done || !arrivals.empty(); });
+        if (arrivals.empty()) {
+          return;
+        }
+        arrival = arrivals.front();
+        arrivals.pop_front();
+      }
+      if (model_parallel_runner_ret_failed_) {
+        continue;
+      }
+      if (ModelParallelRunnerPredict(idx, &output) != RET_OK) {
+        model_parallel_runner_ret_failed_ = true;
+        continue;
+      }
+      auto end = GetTimeUs();
+      recorder.Record(end > arrival ? end - arrival : 0);
+    }
+  };
+  std::vector<std::thread> clients;
+  for (int i = 0; i < flags_->parallel_num_; i++) {
+    clients.emplace_back(client, i);
+  }
+
+  std::mt19937_64 engine(kLoadGeneratorSeed);
+  std::exponential_distribution<double> interval(flags_->load_qps_);
+  auto start = GetTimeUs();
+  double next_arrival = static_cast<double>(start);
+  for (int i = 0; i < flags_->load_request_num_ && !model_parallel_runner_ret_failed_; i++) {
+    next_arrival += interval(engine) * kUsPerSecond;
+    auto now = GetTimeUs();
+    if (next_arrival > now) {
+      std::this_thread::sleep_for(std::chrono::microseconds(static_cast<uint64_t>(next_arrival) - now));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      arrivals.push_back(static_cast<uint64_t>(next_arrival));
+    }
+    cv.notify_one();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    done = true;
+  }
+  cv.notify_all();
+  for (auto &client_thread : clients) {
+    client_thread.join();
+  }
+  auto end = GetTimeUs();
+  if (model_parallel_runner_ret_failed_) {
+    return RET_ERROR;
+  }
+  return recorder.Report(flags_->latency_report_file_, end - start, flags_->load_qps_);
+}
+
 int BenchmarkUnifiedApi::AddConfigInfo(const std::shared_ptr<RunnerConfig> &runner_config) {
   auto env = std::getenv("BENCHMARK_WEIGHT_PATH");
   if (env == nullptr) {
@@ -1023,6 +1121,10 @@ int BenchmarkUnifiedApi::ParallelInference(std::shared_ptr<mindspore::Context> c
     return RET_ERROR;
   }
   std::cout << "=============== end warm up ===============\n";
+  if (flags_->load_qps_ > 0) {
+    std::cout << "parallel predict init time: " << (model_init_end - model_init_start) / kFloatMSEC << " ms\n";
+    return RunLoadGenerator();
+  }
   // do loop count
   std::vector<std::thread> model_thread_run;
   for (int parallel_num_idx = 0; parallel_num_idx < flags_->parallel_num_; parallel_num_idx++) {
@@ -1176,6 +1278,12 @@ int BenchmarkUnifiedApi::RunBenchmark() {
 }
 
 int BenchmarkUnifiedApi::InitTimeProfilingCallbackParameter() {
+  // the counters of perf_event only count the opening thread, so they are disabled with the inter op parallel.
+  if (flags_->hw_counter_ && flags_->inter_op_parallel_num_ > 1) {
+    MS_LOG(WARNING) << "hwCounter is not supported with interOpParallelNum greater than 1.";
+  }
+  (void)roofline_profiler_.Init(flags_->peak_gflops_, flags_->peak_bandwidth_,
+                                flags_->hw_counter_ && flags_->inter_op_parallel_num_ <= 1);
   if (flags_->inter_op_parallel_num_ > 1) {
     // before callback
     ms_before_call_back_ = [&](const std::vector<mindspore::MSTensor> &before_inputs,
@@ -1225,6 +1333,7 @@ int BenchmarkUnifiedApi::InitTimeProfilingCallbackParameter() {
         op_times_by_name_[call_param.node_name].first++;
         op_times_by_name_[call_param.node_name].second += cost;
       }
+      roofline_profiler_.End(call_param.node_name, call_param.node_type, after_inputs, after_outputs);
       return true;
     };
   } else {
@@ -1246,6 +1355,7 @@ int BenchmarkUnifiedApi::InitTimeProfilingCallbackParameter() {
       }
 
       op_call_times_total_++;
+      roofline_profiler_.Begin();
       op_begin_ = GetTimeUs();
       return true;
     };
@@ -1272,6 +1382,7 @@ int BenchmarkUnifiedApi::InitTimeProfilingCallbackParameter() {
       op_times_by_type_[call_param.node_type].second += cost;
       op_times_by_name_[call_param.node_name].first++;
       op_times_by_name_[call_param.node_name].second += cost;
+      roofline_profiler_.End(call_param.node_name, call_param.node_type, after_inputs, after_outputs);
       return true;
     };
   }
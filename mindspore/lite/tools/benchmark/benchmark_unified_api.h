@@ -34,6 +34,7 @@
 #include <nlohmann/json.hpp>
 #endif
 #include "tools/benchmark/benchmark_base.h"
+#include "tools/benchmark/op_roofline.h"
 #include "tools/common/flag_parser.h"
 #include "src/common/file_utils.h"
 #include "src/common/utils.h"
@@ -101,6 +102,8 @@ class MS_API BenchmarkUnifiedApi : public BenchmarkBase {
   void ModelParallelRunnerRun(int task_num, int parallel_idx);
   int ParallelInference(std::shared_ptr<mindspore::Context> context);
   int AddConfigInfo(const std::shared_ptr<RunnerConfig> &runner_config);
+  int ModelParallelRunnerPredict(int idx, std::vector<mindspore::MSTensor> *output);
+  int RunLoadGenerator();
 #endif
 
   template <typename T>
@@ -129,6 +132,7 @@ class MS_API BenchmarkUnifiedApi : public BenchmarkBase {
 
   MSKernelCallBack ms_before_call_back_ = nullptr;
   MSKernelCallBack ms_after_call_back_ = nullptr;
+  RooflineProfiler roofline_profiler_;
 #ifdef PARALLEL_INFERENCE
   std::vector<std::vector<int64_t>> resize_dims_;
   std::vector<std::vector<void *>> all_inputs_data_;
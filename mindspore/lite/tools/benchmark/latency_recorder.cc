@@ -0,0 +1,137 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tools/benchmark/latency_recorder.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <utility>
+#include "src/common/log_adapter.h"
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr double kUsPerMs = 1000.0;
+constexpr double kUsPerSecond = 1000000.0;
+constexpr double kMaxPercentile = 100.0;
+const std::vector<std::pair<std::string, double>> kReportPercentiles = {
+  {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p999", 99.9}};
+
+bool EndsWith(const std::string &str, const std::string &suffix) {
+  return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+}  // namespace
+
+void LatencyRecorder::Record(uint64_t latency_us) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  latencies_.push_back(latency_us);
+  sorted_ = false;
+}
+
+// nearest-rank percentile of the recorded latencies.
+uint64_t LatencyRecorder::Percentile(double percentile) {
+  std::lock_guard<std::mutex> lock(mtx_);
+  if (latencies_.empty()) {
+    return 0;
+  }
+  if (!sorted_) {
+    std::sort(latencies_.begin(), latencies_.end());
+    sorted_ = true;
+  }
+  percentile = std::min(std::max(percentile, 0.0), kMaxPercentile);
+  auto rank = static_cast<size_t>(std::ceil(percentile / kMaxPercentile * latencies_.size()));
+  return latencies_[rank == 0 ? 0 : rank - 1];
+}
+
+int LatencyRecorder::Report(const std::string &report_file, uint64_t elapsed_us, double target_qps) {
+  auto elapsed_s = static_cast<double>(elapsed_us) / kUsPerSecond;
+  auto throughput = elapsed_s > 0 ? static_cast<double>(count()) / elapsed_s : 0;
+  std::cout << "=================================" << std::endl;
+  std::cout << "load generator target qps: " << target_qps << ", requests: " << count()
+            << ", throughput: " << throughput << " qps" << std::endl;
+  for (auto &percentile : kReportPercentiles) {
+    std::cout << percentile.first << " latency: " << Percentile(percentile.second) / kUsPerMs << " ms" << std::endl;
+  }
+  std::cout << "max latency: " << Percentile(kMaxPercentile) / kUsPerMs << " ms" << std::endl;
+  std::cout << "=================================" << std::endl;
+  if (report_file.empty()) {
+    return RET_OK;
+  }
+  return WriteReport(report_file, elapsed_us, target_qps);
+}
+
+// the histogram buckets are the powers of 2 in units of us, the bucket of the upper bound 2^k counts the latencies in
+// the range of (2^(k-1), 2^k].
+int LatencyRecorder::WriteReport(const std::string &report_file, uint64_t elapsed_us, double target_qps) {
+  std::map<uint64_t, size_t> histogram;
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    for (auto latency : latencies_) {
+      uint64_t upper = 1;
+      while (upper < latency) {
+        upper <<= 1;
+      }
+      histogram[upper]++;
+    }
+  }
+  std::ofstream ofs(report_file, std::ios::trunc);
+  if (!ofs.good()) {
+    MS_LOG(ERROR) << "open latency report file " << report_file << " failed.";
+    return RET_ERROR;
+  }
+  auto elapsed_s = static_cast<double>(elapsed_us) / kUsPerSecond;
+  auto throughput = elapsed_s > 0 ? static_cast<double>(count()) / elapsed_s : 0;
+  ofs << std::fixed << std::setprecision(3);
+  if (EndsWith(report_file, ".json")) {
+    ofs << "{\n  \"target_qps\": " << target_qps << ",\n  \"requests\": " << count()
+        << ",\n  \"elapsed_ms\": " << elapsed_us / kUsPerMs << ",\n  \"throughput_qps\": " << throughput
+        << ",\n  \"latency_ms\": {";
+    for (auto &percentile : kReportPercentiles) {
+      ofs << "\"" << percentile.first << "\": " << Percentile(percentile.second) / kUsPerMs << ", ";
+    }
+    ofs << "\"max\": " << Percentile(kMaxPercentile) / kUsPerMs << "},\n  \"histogram\": [";
+    for (auto iter = histogram.begin(); iter != histogram.end(); ++iter) {
+      ofs << (iter == histogram.begin() ? "" : ", ") << "{\"upper_ms\": " << iter->first / kUsPerMs
+          << ", \"count\": " << iter->second << "}";
+    }
+    ofs << "]\n}\n";
+  } else {
+    ofs << "metric,value\n"
+        << "target_qps," << target_qps << "\n"
+        << "requests," << count() << "\n"
+        << "elapsed_ms," << elapsed_us / kUsPerMs << "\n"
+        << "throughput_qps," << throughput << "\n";
+    for (auto &percentile : kReportPercentiles) {
+      ofs << percentile.first << "_ms," << Percentile(percentile.second) / kUsPerMs << "\n";
+    }
+    ofs << "max_ms," << Percentile(kMaxPercentile) / kUsPerMs << "\n";
+    ofs << "\nhistogram_upper_ms,count\n";
+    for (auto &bucket : histogram) {
+      ofs << bucket.first / kUsPerMs << "," << bucket.second << "\n";
+    }
+  }
+  ofs.close();
+  if (!ofs.good()) {
+    MS_LOG(ERROR) << "write latency report file " << report_file << " failed.";
+    return RET_ERROR;
+  }
+  std::cout << "latency report is written to " << report_file << std::endl;
+  return RET_OK;
+}
+}  // namespace mindspore::lite
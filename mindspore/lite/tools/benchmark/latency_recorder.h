@@ -0,0 +1,49 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_TOOLS_BENCHMARK_LATENCY_RECORDER_H_
+#define MINDSPORE_LITE_TOOLS_BENCHMARK_LATENCY_RECORDER_H_
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace mindspore::lite {
+// record the latency of the requests sent by the load generator of the benchmark, and report the percentiles and the
+// histogram of the latency, the report is written as json if the file name ends with ".json", or csv otherwise.
+class LatencyRecorder {
+ public:
+  LatencyRecorder() = default;
+  ~LatencyRecorder() = default;
+
+  // thread safe, the latency is in units of us.
+  void Record(uint64_t latency_us);
+  size_t count() const { return latencies_.size(); }
+  // the latency of the percentile in units of us, the percentile is in the range of [0, 100].
+  uint64_t Percentile(double percentile);
+  // print the summary and write the report file if it is not empty, the elapsed time is in units of us.
+  int Report(const std::string &report_file, uint64_t elapsed_us, double target_qps);
+
+ private:
+  int WriteReport(const std::string &report_file, uint64_t elapsed_us, double target_qps);
+
+  std::mutex mtx_;
+  bool sorted_ = false;
+  std::vector<uint64_t> latencies_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_TOOLS_BENCHMARK_LATENCY_RECORDER_H_
@@ -0,0 +1,265 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tools/benchmark/op_roofline.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "src/common/log_adapter.h"
+#include "include/errorcode.h"
+
+namespace mindspore::lite {
+namespace {
+constexpr double kFlopsPerMac = 2.0;
+// the cost is in units of ms, so the work per ms over 1e6 is the work per ns, i.e. giga per second.
+constexpr double kGigaPerMs = 1e6;
+constexpr double kPercent = 100.0;
+constexpr double kKilo = 1000.0;
+constexpr int kColumnLen = 4;
+constexpr int kValueLenMax = 32;
+const std::set<std::string> kDataMovementOps = {"Reshape",     "Transpose",    "Concat",       "Split",
+                                                "Gather",      "GatherNd",     "Squeeze",      "Unsqueeze",
+                                                "ExpandDims",  "Flatten",      "Shape",        "Cast",
+                                                "SliceFusion", "StridedSlice", "PadFusion",    "TileFusion",
+                                                "Stack",       "Unstack",      "BroadcastTo",  "DepthToSpace",
+                                                "SpaceToDepth"};
+
+bool IsMatMul(const std::string &op_type) {
+  return op_type == "MatMulFusion" || op_type == "FullConnection" || op_type == "BatchMatMul";
+}
+
+double ElementNum(const mindspore::MSTensor &tensor) {
+  return static_cast<double>(std::max<int64_t>(tensor.ElementNum(), 0));
+}
+
+std::string FormatValue(const char *format, double value) {
+  char buf[kValueLenMax] = {};
+  (void)snprintf(buf, sizeof(buf), format, value);
+  return buf;
+}
+}  // namespace
+
+OpWork EstimateOpWork(const std::string &op_type, const std::vector<mindspore::MSTensor> &inputs,
+                      const std::vector<mindspore::MSTensor> &outputs) {
+  OpWork work;
+  for (auto &tensor : inputs) {
+    work.bytes += static_cast<double>(tensor.DataSize());
+  }
+  for (auto &tensor : outputs) {
+    work.bytes += static_cast<double>(tensor.DataSize());
+  }
+  if (inputs.empty() || outputs.empty() || kDataMovementOps.find(op_type) != kDataMovementOps.end()) {
+    return work;
+  }
+  auto out_num = ElementNum(outputs.front());
+  auto in_num = ElementNum(inputs.front());
+  if (op_type == "Conv2DFusion" && inputs.size() > 1) {
+    // the weight is in the layout of (out_channel, kernel_h, kernel_w, in_channel / group).
+    auto &weight_shape = inputs[1].Shape();
+    if (!weight_shape.empty() && weight_shape.front() > 0) {
+      work.flops = kFlopsPerMac * out_num * ElementNum(inputs[1]) / static_cast<double>(weight_shape.front());
+    }
+  } else if (op_type == "Conv2dTransposeFusion" && inputs.size() > 1) {
+    // each input point of the nhwc input is scattered to (kernel_h * kernel_w * out_channel / group) output points.
+    auto &in_shape = inputs.front().Shape();
+    if (!in_shape.empty() && in_shape.back() > 0) {
+      work.flops = kFlopsPerMac * in_num * ElementNum(inputs[1]) / static_cast<double>(in_shape.back());
+    }
+  } else if (IsMatMul(op_type) && inputs.size() > 1) {
+    // (batch, row, deep) x (deep, col), the deep is got by the output rows to be agnostic of the transpose.
+    auto &out_shape = outputs.front().Shape();
+    if (!out_shape.empty() && out_shape.back() > 0) {
+      auto rows = out_num / static_cast<double>(out_shape.back());
+      work.flops = rows > 0 ? kFlopsPerMac * out_num * in_num / rows : 0;
+    }
+  } else {
+    // the element-wise, activation, pooling and reduction ops take about one operation per element.
+    work.flops = std::max(in_num, out_num);
+  }
+  return work;
+}
+
+HwCounter::~HwCounter() { Close(); }
+
+void HwCounter::Close() {
+#if defined(__linux__)
+  for (auto &fd : fds_) {
+    if (fd != -1) {
+      (void)close(fd);
+      fd = -1;
+    }
+  }
+#endif
+  group_fd_ = -1;
+}
+
+int HwCounter::Open() {
+#if defined(__linux__)
+  const uint64_t configs[kHwCounterNum] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                           PERF_COUNT_HW_CACHE_MISSES};
+  for (int i = 0; i < kHwCounterNum; ++i) {
+    struct perf_event_attr attr;
+    (void)memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = configs[i];
+    attr.disabled = (i == 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    int leader = (i == 0) ? -1 : fds_[0];
+    fds_[i] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+    if (fds_[i] == -1) {
+      MS_LOG(WARNING) << "perf_event_open failed for the hardware counter " << i
+                      << ", check the /proc/sys/kernel/perf_event_paranoid.";
+      Close();
+      return RET_NOT_SUPPORT;
+    }
+  }
+  group_fd_ = fds_[0];
+  return RET_OK;
+#else
+  MS_LOG(WARNING) << "The hardware counter is only supported on linux and android.";
+  return RET_NOT_SUPPORT;
+#endif
+}
+
+void HwCounter::Start() {
+#if defined(__linux__)
+  (void)ioctl(group_fd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  (void)ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+void HwCounter::Stop(uint64_t counts[kHwCounterNum]) {
+  for (int i = 0; i < kHwCounterNum; ++i) {
+    counts[i] = 0;
+  }
+#if defined(__linux__)
+  (void)ioctl(group_fd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  struct {
+    uint64_t nr;
+    uint64_t values[kHwCounterNum];
+  } group_read = {};
+  if (read(group_fd_, &group_read, sizeof(group_read)) <= 0) {
+    return;
+  }
+  for (uint64_t i = 0; i < std::min<uint64_t>(group_read.nr, kHwCounterNum); ++i) {
+    counts[i] = group_read.values[i];
+  }
+#endif
+}
+
+int RooflineProfiler::Init(float peak_gflops, float peak_bandwidth, bool enable_hw_counter) {
+  peak_gflops_ = peak_gflops;
+  peak_bandwidth_ = peak_bandwidth;
+  if (enable_hw_counter && hw_counter_.Open() != RET_OK) {
+    MS_LOG(WARNING) << "The hardware counter is unavailable, only the roofline metrics are reported.";
+  }
+  return RET_OK;
+}
+
+void RooflineProfiler::Begin() {
+  if (hw_counter_.opened()) {
+    hw_counter_.Start();
+  }
+}
+
+void RooflineProfiler::End(const std::string &op_name, const std::string &op_type,
+                           const std::vector<mindspore::MSTensor> &inputs,
+                           const std::vector<mindspore::MSTensor> &outputs) {
+  uint64_t counts[kHwCounterNum] = {0, 0, 0};
+  if (hw_counter_.opened()) {
+    hw_counter_.Stop(counts);
+  }
+  auto work = EstimateOpWork(op_type, inputs, outputs);
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto record : {&records_by_name_[op_name], &records_by_type_[op_type]}) {
+    record->flops += work.flops;
+    record->bytes += work.bytes;
+    for (int i = 0; i < kHwCounterNum; ++i) {
+      record->hw_counts[i] += counts[i];
+    }
+  }
+}
+
+void RooflineProfiler::Print(const std::string &title, const std::map<std::string, std::pair<int, float>> &op_times,
+                             bool by_type) const {
+  std::vector<std::string> titles = {title, "GFLOP/s", "GB/s", "FLOP/B", "roofline(%)", "bound"};
+  if (hw_counter_.opened()) {
+    titles.emplace_back("IPC");
+    titles.emplace_back("cacheMiss(k)");
+  }
+  auto &records = by_type ? records_by_type_ : records_by_name_;
+  bool has_peak = peak_gflops_ > 0 && peak_bandwidth_ > 0;
+  std::vector<std::vector<std::string>> rows;
+  for (auto &iter : records) {
+    auto time_iter = op_times.find(iter.first);
+    if (time_iter == op_times.end() || time_iter->second.second <= 0 || time_iter->second.first <= 0) {
+      continue;
+    }
+    auto &record = iter.second;
+    double cost = time_iter->second.second;
+    double gflops = record.flops / cost / kGigaPerMs;
+    double bandwidth = record.bytes / cost / kGigaPerMs;
+    double intensity = record.bytes > 0 ? record.flops / record.bytes : 0;
+    std::vector<std::string> row = {iter.first, FormatValue("%.3f", gflops), FormatValue("%.3f", bandwidth),
+                                    FormatValue("%.3f", intensity)};
+    if (has_peak) {
+      // the attainable performance is bounded by the peak flops and the bandwidth times the intensity.
+      double attainable = std::min(static_cast<double>(peak_gflops_), intensity * peak_bandwidth_);
+      row.emplace_back(attainable > 0 ? FormatValue("%.2f", gflops / attainable * kPercent) : "-");
+      row.emplace_back(intensity < peak_gflops_ / peak_bandwidth_ ? "memory" : "compute");
+    } else {
+      row.emplace_back("-");
+      row.emplace_back("-");
+    }
+    if (hw_counter_.opened()) {
+      auto cycles = static_cast<double>(record.hw_counts[kHwCycles]);
+      row.emplace_back(cycles > 0 ? FormatValue("%.3f", record.hw_counts[kHwInstructions] / cycles) : "-");
+      row.emplace_back(FormatValue("%.3f", record.hw_counts[kHwCacheMisses] / kKilo / time_iter->second.first));
+    }
+    rows.push_back(row);
+  }
+
+  std::vector<size_t> column_len(titles.size());
+  for (size_t i = 0; i < titles.size(); ++i) {
+    column_len[i] = titles[i].size();
+    for (auto &row : rows) {
+      column_len[i] = std::max(column_len[i], row[i].size() + kColumnLen);
+    }
+  }
+  printf("-------------------------------------------------------------------------\n");
+  auto print_row = [&column_len](std::vector<std::string> row) {
+    for (size_t i = 0; i < row.size(); ++i) {
+      row[i].resize(column_len[i], ' ');
+      printf("%s\t", row[i].c_str());
+    }
+    printf("\n");
+  };
+  print_row(titles);
+  for (auto &row : rows) {
+    print_row(row);
+  }
+}
+}  // namespace mindspore::lite
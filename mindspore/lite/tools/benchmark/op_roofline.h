@@ -0,0 +1,91 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_TOOLS_BENCHMARK_OP_ROOFLINE_H_
+#define MINDSPORE_LITE_TOOLS_BENCHMARK_OP_ROOFLINE_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "include/api/types.h"
+
+namespace mindspore::lite {
+// the work of one running of the op, the flops are estimated from the op type and the shapes, and the bytes are the
+// sizes of the input and output tensors, which is the lower bound of the memory traffic of the op.
+struct OpWork {
+  double flops = 0;
+  double bytes = 0;
+};
+
+OpWork EstimateOpWork(const std::string &op_type, const std::vector<mindspore::MSTensor> &inputs,
+                      const std::vector<mindspore::MSTensor> &outputs);
+
+enum HwCounterIndex { kHwCycles = 0, kHwInstructions = 1, kHwCacheMisses = 2, kHwCounterNum = 3 };
+
+// the hardware counters of the calling thread read by perf_event, only supported on linux and android.
+class HwCounter {
+ public:
+  HwCounter() = default;
+  ~HwCounter();
+
+  int Open();
+  bool opened() const { return group_fd_ != -1; }
+  void Start();
+  void Stop(uint64_t counts[kHwCounterNum]);
+
+ private:
+  void Close();
+
+  int group_fd_ = -1;
+  int fds_[kHwCounterNum] = {-1, -1, -1};
+};
+
+// accumulate the work and the hardware counters of the ops in time profiling, and report the achieved GFLOP/s and
+// GB/s, the fraction of the roofline and whether the op is memory bound, the roofline needs the peak of the device.
+class RooflineProfiler {
+ public:
+  RooflineProfiler() = default;
+  ~RooflineProfiler() = default;
+
+  // the peak flops is in units of GFLOP/s and the peak bandwidth is in units of GB/s, 0 means unknown.
+  int Init(float peak_gflops, float peak_bandwidth, bool enable_hw_counter);
+  // only called by the thread running the op when the hardware counter is enabled.
+  void Begin();
+  void End(const std::string &op_name, const std::string &op_type, const std::vector<mindspore::MSTensor> &inputs,
+           const std::vector<mindspore::MSTensor> &outputs);
+  // the op times are the total cost in units of ms, collected by the time profiling.
+  void Print(const std::string &title, const std::map<std::string, std::pair<int, float>> &op_times,
+             bool by_type) const;
+
+ private:
+  struct OpRecord {
+    double flops = 0;
+    double bytes = 0;
+    uint64_t hw_counts[kHwCounterNum] = {0, 0, 0};
+  };
+
+  float peak_gflops_ = 0;
+  float peak_bandwidth_ = 0;
+  HwCounter hw_counter_;
+  std::mutex mutex_;
+  std::map<std::string, OpRecord> records_by_name_;
+  std::map<std::string, OpRecord> records_by_type_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_TOOLS_BENCHMARK_OP_ROOFLINE_H_
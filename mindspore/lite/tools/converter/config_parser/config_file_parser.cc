@@ -145,6 +145,7 @@ int ConfigFileParser::ParseCommonQuantString(const std::map<std::string, std::ma
       {"min_quant_weight_channel", common_quant_string_.min_quant_weight_channel},
       {"skip_quant_node", common_quant_string_.skip_quant_node},
       {"debug_info_save_path", common_quant_string_.debug_info_save_path},
+      {"thread_num", common_quant_string_.thread_num},
     };
     return SetMapData(map, parse_map, kCommonQuantParam);
   }
@@ -173,6 +174,7 @@ int ConfigFileParser::ParseFullQuantString(const std::map<std::string, std::map<
       {"bias_correction", full_quant_string_.bias_correction},
       {"target_device", full_quant_string_.target_device},
       {"per_channel", full_quant_string_.per_channel},
+      {"calibrate_session_num", full_quant_string_.calibrate_session_num},
     };
     return SetMapData(map, parse_map, kFullQuantParam);
   }
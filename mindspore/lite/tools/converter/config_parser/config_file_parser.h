@@ -43,6 +43,7 @@ struct CommonQuantString {
   std::string min_quant_weight_channel;
   std::string skip_quant_node;
   std::string debug_info_save_path;
+  std::string thread_num;
 };
 
 struct MixedBitWeightQuantString {
@@ -57,6 +58,7 @@ struct FullQuantString {
   std::string bias_correction;
   std::string target_device;
   std::string per_channel;
+  std::string calibrate_session_num;
 };
 
 struct RegistryInfoString {
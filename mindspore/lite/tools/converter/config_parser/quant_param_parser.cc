@@ -27,6 +27,8 @@ constexpr int kQuantBitNumInt16 = 16;
 constexpr int kQuantBitNumInt8 = 8;
 constexpr int kMinSize = 0;
 constexpr int kMaxSize = 65535;
+constexpr int kMinThreadNum = 1;
+constexpr int kMaxThreadNum = 64;
 }  // namespace
 int QuantParamParser::ParseFilter(const CommonQuantString &common_quant_string, quant::CommonQuantParam *common_quant) {
   MS_ASSERT(common_quant != nullptr);
@@ -107,6 +109,17 @@ int QuantParamParser::ParseCommonQuant(const CommonQuantString &common_quant_str
     return ret;
   }
 
+  if (!common_quant_string.thread_num.empty()) {
+    if (!ConvertIntNum(common_quant_string.thread_num, &common_quant->thread_num)) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: thread_num should be a valid number.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+    if (common_quant->thread_num < kMinThreadNum || common_quant->thread_num > kMaxThreadNum) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: thread_num should be in the range [1,64].";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
+
   common_quant->debug_info_save_path = common_quant_string.debug_info_save_path;
   if (!common_quant->debug_info_save_path.empty()) {
     common_quant->is_debug = true;
@@ -173,6 +186,16 @@ int QuantParamParser::ParseFullQuant(const FullQuantString &full_quant_string, q
     MS_LOG(ERROR) << "INPUT ILLEGAL: per_channel should be true or false.";
     return RET_INPUT_PARAM_INVALID;
   }
+  if (!full_quant_string.calibrate_session_num.empty()) {
+    if (!ConvertIntNum(full_quant_string.calibrate_session_num, &full_quant->calibrate_session_num)) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: calibrate_session_num should be a valid number.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+    if (full_quant->calibrate_session_num < kMinThreadNum || full_quant->calibrate_session_num > kMaxThreadNum) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: calibrate_session_num should be in the range [1,64].";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
   return RET_OK;
 }
 
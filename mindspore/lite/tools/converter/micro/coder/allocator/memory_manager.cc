@@ -15,6 +15,7 @@
  */
 
 #include "tools/converter/micro/coder/allocator/memory_manager.h"
+#include <set>
 #include <vector>
 #include "mindspore/ccsrc/plugin/device/cpu/kernel/nnacl/op_base.h"
 #include "tools/converter/micro/coder/opcoders/op_coder.h"
@@ -23,6 +24,14 @@ namespace mindspore::lite::micro {
 constexpr auto kDefaultMemAlignSize = 8;
 constexpr auto kDefaultMemRemainder = 32;
 
+// ops whose coders read each input element before writing the output element at the same position, so the output
+// can share the buffer of an input of the same shape
+static const std::set<int> kInplaceViewOps = {schema::PrimitiveType_Reshape,   schema::PrimitiveType_Flatten,
+                                              schema::PrimitiveType_ExpandDims, schema::PrimitiveType_Squeeze,
+                                              schema::PrimitiveType_Unsqueeze};
+static const std::set<int> kInplaceElementwiseOps = {schema::PrimitiveType_Activation, schema::PrimitiveType_AddFusion,
+                                                     schema::PrimitiveType_SubFusion, schema::PrimitiveType_MulFusion};
+
 static size_t AlignMemorySize(size_t size) {
   return ((size + kDefaultMemAlignSize - 1) / kDefaultMemAlignSize) * kDefaultMemAlignSize;
 }
@@ -60,6 +69,9 @@ void MemoryManager::AssignOutputs(const std::unique_ptr<OperatorCoder> &node) {
       return;
     }
     size_t size = AlignMemorySize(output->Size());
+    if (AliasInplaceInput(node, output, size)) {
+      continue;
+    }
     std::map<size_t, size_t> size_map = GetReusableMembufMap(size);
     if (size_map.empty()) {
       AssignNewMembuf(output, size);
@@ -70,6 +82,36 @@ void MemoryManager::AssignOutputs(const std::unique_ptr<OperatorCoder> &node) {
   }
 }
 
+bool MemoryManager::AliasInplaceInput(const std::unique_ptr<OperatorCoder> &node, Tensor *output, size_t size) {
+  bool is_view = kInplaceViewOps.find(node->type()) != kInplaceViewOps.end();
+  bool is_elementwise = kInplaceElementwiseOps.find(node->type()) != kInplaceElementwiseOps.end();
+  if (!is_view && !is_elementwise) {
+    return false;
+  }
+  for (const auto &input : node->input_tensors()) {
+    if (input == nullptr || input->category() != Category::VAR || input->data() != nullptr) {
+      continue;
+    }
+    // the input dies at this node, nobody else reads it after the output is written
+    if (input->ref_count() != 1 || input->data_type() != output->data_type()) {
+      continue;
+    }
+    if (AlignMemorySize(input->Size()) != size || (is_elementwise && input->shape() != output->shape())) {
+      continue;
+    }
+    auto item = std::find_if(membuf_list_.begin(), membuf_list_.end(),
+                             [input](const MembufPtr &membuf) { return membuf->key_ == input; });
+    if (item == membuf_list_.end() || (*item)->status_ != kReused) {
+      continue;
+    }
+    // hand the membuf over to the output, so releasing the input does not free it
+    MS_LOG(DEBUG) << "output of " << node->name() << " reuses the membuf of its input in place: " << size;
+    UpdataMembufInfo(*item, output);
+    return true;
+  }
+  return false;
+}
+
 void MemoryManager::ReleaseInputs(const std::unique_ptr<OperatorCoder> &node) {
   // release node input and workspace
   for (const auto &input : node->input_tensors()) {
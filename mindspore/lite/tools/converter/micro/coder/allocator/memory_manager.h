@@ -52,6 +52,7 @@ class MemoryManager {
 
  private:
   void AssignOutputs(const std::unique_ptr<OperatorCoder> &node);
+  bool AliasInplaceInput(const std::unique_ptr<OperatorCoder> &node, Tensor *output, size_t size);
   void ReleaseInputs(const std::unique_ptr<OperatorCoder> &node);
 
   void SplitMembuf(size_t index, size_t size);
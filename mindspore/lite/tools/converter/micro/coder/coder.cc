@@ -122,13 +122,19 @@ int Coder::MicroSourceCodeGeneration(const schema::MetaGraphT &graph, const std:
 
 int Coder::Init(const std::string &code_mode, const std::string &target, bool support_parallel, bool debug_mode) const {
   static const std::map<std::string, Target> kTargetMap = {
-    {"x86", kX86}, {"Cortex-M", kCortex_M}, {"ARM32", kARM32}, {"ARM64", kARM64}, {"All", kAllTargets}};
+    {"x86", kX86},     {"Cortex-M", kCortex_M},   {"Cortex-M55", kCortex_M}, {"Cortex-M85", kCortex_M},
+    {"ARM32", kARM32}, {"ARM64", kARM64}, {"All", kAllTargets}};
+  static const std::map<std::string, std::string> kHeliumCpuMap = {{"Cortex-M55", "cortex-m55"},
+                                                                   {"Cortex-M85", "cortex-m85"}};
   static const std::map<std::string, CodeMode> kCodeModeMap = {{"Inference", Inference}, {"Train", Train}};
   Configurator *config = Configurator::GetInstance();
 
   auto target_item = kTargetMap.find(target);
   MS_CHECK_TRUE_MSG(target_item != kTargetMap.end(), RET_ERROR, "unsupported target: " + target);
   config->set_target(target_item->second);
+  auto helium_item = kHeliumCpuMap.find(target);
+  config->set_enable_helium(helium_item != kHeliumCpuMap.end());
+  config->set_cpu(helium_item != kHeliumCpuMap.end() ? helium_item->second : "");
 
   auto code_item = kCodeModeMap.find(code_mode);
   MS_CHECK_TRUE_MSG(code_item != kCodeModeMap.end(), RET_ERROR, "unsupported code mode: " + code_mode);
@@ -167,6 +173,7 @@ int Coder::Init(const std::string &code_mode, const std::string &target, bool su
 
   print_parameter("projectName", config->proj_dir());
   print_parameter("target", config->target());
+  print_parameter("enableHelium", config->enable_helium());
   print_parameter("codePath", config->code_path());
   print_parameter("codeMode", config->code_mode());
   print_parameter("debugMode", config->debug_mode());
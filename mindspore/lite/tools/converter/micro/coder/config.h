@@ -53,6 +53,14 @@ class Configurator {
   void set_support_parallel(bool parallel) { support_parallel_ = parallel; }
   bool support_parallel() const { return support_parallel_; }
 
+  // Cortex-M55/M85 cores with the Armv8.1-M Helium (MVE) extension, the cmsis-nn kernels are built with their MVE
+  // implementations, which need workspace sizes different from the DSP ones
+  void set_enable_helium(bool enable_helium) { enable_helium_ = enable_helium; }
+  bool enable_helium() const { return enable_helium_; }
+
+  void set_cpu(const std::string &cpu) { cpu_ = cpu; }
+  std::string cpu() const { return cpu_; }
+
   void set_proj_dir(std::string dir) { proj_dir_ = dir; }
   std::string proj_dir() const { return proj_dir_; }
 
@@ -64,6 +72,8 @@ class Configurator {
   CodeMode code_mode_{Code_Unknown};
   bool support_parallel_{false};
   bool debug_mode_{false};
+  bool enable_helium_{false};
+  std::string cpu_;
   std::string proj_dir_;
 };
 }  // namespace mindspore::lite::micro
@@ -25,6 +25,11 @@ void CodeCMakeNetLibrary(std::ofstream &ofs, const std::unique_ptr<CoderContext>
     ofs << "include_directories(${OP_HEADER_PATH}/CMSIS/NN/Include)\n"
         << "include_directories(${OP_HEADER_PATH}/CMSIS/DSP/Include)\n"
         << "include_directories(${OP_HEADER_PATH}/CMSIS/Core/Include)\n";
+    if (config->enable_helium()) {
+      // the workspaces are sized for the MVE kernels of cmsis-nn, so the net must be built for the Helium core
+      ofs << "add_compile_options(-mcpu=" << config->cpu() << ")\n"
+          << "add_compile_definitions(ARM_MATH_MVEI)\n";
+    }
   }
   ofs << "set(OP_SRC\n";
   for (const std::string &c_file : ctx->c_files()) {
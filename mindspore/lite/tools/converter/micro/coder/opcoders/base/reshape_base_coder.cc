@@ -32,6 +32,10 @@ int ReshapeBaseCoder::Prepare(CoderContext *const context) { return RET_OK; }
 
 int ReshapeBaseCoder::DoCode(CoderContext *const context) {
   Serializer coder;
+  // the memory manager may place the output in the buffer of the input, then there is nothing to copy
+  if (allocator_->GetRuntimeAddr(input_tensor_) == allocator_->GetRuntimeAddr(output_tensor_)) {
+    return RET_OK;
+  }
 
   size_t size = input_tensor_->Size();
   coder.CodeFunction("memcpy", output_tensor_, input_tensor_, size);
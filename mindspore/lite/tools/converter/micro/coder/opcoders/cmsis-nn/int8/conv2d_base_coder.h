@@ -20,6 +20,7 @@
 #include <string>
 #include <vector>
 #include "coder/opcoders/base/conv2d_base_coder.h"
+#include "coder/config.h"
 #include "nnacl/conv_parameter.h"
 
 namespace mindspore::lite::micro::cmsis {
@@ -36,6 +37,8 @@ class Conv2DBaseCoder : public micro::Conv2DBaseCoder {
 
  protected:
   int SetQuantArgs();
+  // the MVE kernels of cmsis-nn work on int8 im2col buffers and need their own workspace size
+  bool EnableHelium() const { return Configurator::GetInstance()->enable_helium(); }
 
   int32_t *output_mult_{nullptr};
   int32_t *output_shift_{nullptr};
@@ -15,6 +15,7 @@
  */
 
 #include "coder/opcoders/cmsis-nn/int8/conv2d_int8_coder.h"
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <memory>
@@ -150,16 +151,19 @@ void Conv2DInt8Coder::CheckSupportOptimize() {
 
 int Conv2DInt8Coder::InitTmpBuffer() {
   const size_t kPartial = 2;
+  // arm_nn_mat_mult_s8 of the MVE build keeps four im2col columns, each padded to the eight int8 lanes of a Q register
+  const size_t kMveColumns = 4;
+  const size_t kMveLanes = 8;
+  size_t col_length =
+    static_cast<size_t>(input_tensor_->Channel() * filter_tensor_->Width() * filter_tensor_->Height());
+  size_t dsp_size = kPartial * col_length * sizeof(int16_t);
+  size_t mve_size = kMveColumns * UP_ROUND(col_length, kMveLanes) * sizeof(int8_t);
   switch (opt_) {
     case Basic:
-      buffer_size_ =
-        static_cast<size_t>(kPartial * input_tensor_->Channel() * filter_tensor_->Width() * filter_tensor_->Height()) *
-        sizeof(int16_t);
+      buffer_size_ = EnableHelium() ? mve_size : dsp_size;
       break;
     case Convolve_1_x_n:
-      buffer_size_ =
-        static_cast<size_t>(kPartial * input_tensor_->Channel() * filter_tensor_->Width() * filter_tensor_->Height()) *
-        sizeof(int16_t);
+      buffer_size_ = EnableHelium() ? std::max(mve_size, dsp_size) : dsp_size;
       break;
     case Convolve_1x1_fast:
       // do nothing
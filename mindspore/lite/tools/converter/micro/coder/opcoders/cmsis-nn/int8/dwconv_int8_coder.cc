@@ -143,7 +143,13 @@ void DWConvInt8Coder::CheckSupportOptimize() {
       buffer_size_ = 0;
     } else {
       optimize_ = Conv_opt;
-      buffer_size_ = input_ch_ * kernel_x_ * kernel_y_ * sizeof(int16_t);
+      // arm_depthwise_conv_s8_opt of the MVE build processes the channels in blocks of CH_IN_BLOCK_MVE, and the
+      // extra bytes cover the out of bounds read of its lhs buffers
+      const int kMveChannelBlock = 124;
+      const int kMveColumns = 4;
+      const int kMveTail = 4;
+      buffer_size_ = EnableHelium() ? kMveColumns * kMveChannelBlock * kernel_x_ * kernel_y_ * sizeof(int8_t) + kMveTail
+                                    : input_ch_ * kernel_x_ * kernel_y_ * sizeof(int16_t);
     }
   } else {
     optimize_ = Basic;
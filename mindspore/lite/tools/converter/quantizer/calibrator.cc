@@ -27,9 +27,9 @@ namespace mindspore::lite::quant {
 namespace {
 constexpr int kDefaultBinNumber = 2048;
 }  // namespace
-int Calibrator::RecordMaxMinValue(const std::vector<float> &data,
-                                  const std::unique_ptr<DataDistribution> &diverg_info) {
-  auto ret = diverg_info->RecordMaxMinValueArray(data);
+int Calibrator::RecordMaxMinValue(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info,
+                                  size_t calib_index) {
+  auto ret = diverg_info->RecordMaxMinValueArray(data, calib_index);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Record max min value array failed.";
     return ret;
@@ -37,18 +37,24 @@ int Calibrator::RecordMaxMinValue(const std::vector<float> &data,
   return RET_OK;
 }
 
-int Calibrator::ComputeThreshold() {
+int Calibrator::ComputeThreshold(size_t thread_num) {
+  std::vector<DataDistribution *> diverg_infos;
   for (auto &kv : this->outputs_diverg_info_) {
     auto &outputs_diverg_info = kv.second;
     for (auto &diverg_info : outputs_diverg_info) {
-      auto ret = diverg_info.second->ComputeThreshold();
-      if (ret != RET_OK) {
-        MS_LOG(ERROR) << "Compute threshold failed.";
-        return ret;
-      }
+      diverg_infos.push_back(diverg_info.second.get());
     }
   }
+  auto compute_threshold = [&diverg_infos](size_t task_id, size_t) {
+    return diverg_infos[task_id]->ComputeThreshold();
+  };
+  auto ret = ParallelRun(diverg_infos.size(), thread_num, compute_threshold);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Compute threshold failed.";
+    return ret;
+  }
   // node A's input may be node B's output, no need to re-compute the node A's input quant param which is the same as
+  diverg_infos.clear();
   for (auto &kv : this->inputs_diverg_info_) {
     auto &input_infos = kv.second;
     for (size_t i = 0; i < input_infos.size(); i++) {
@@ -76,14 +82,15 @@ int Calibrator::ComputeThreshold() {
         }
       }
       if (!already_computed) {
-        auto ret = input_infos[i]->ComputeThreshold();
-        if (ret != RET_OK) {
-          MS_LOG(ERROR) << "ComputeThreshold failed.";
-          return ret;
-        }
+        diverg_infos.push_back(input_infos[i].get());
       }
     }
   }
+  ret = ParallelRun(diverg_infos.size(), thread_num, compute_threshold);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "ComputeThreshold failed.";
+    return ret;
+  }
   return RET_OK;
 }
 
@@ -114,6 +121,7 @@ int Calibrator::AddQuantizedOp(const CNodePtr &cnode) {
     return RET_ERROR;
   }
   auto node_name = cnode->fullname_with_scope();
+  (void)node_mutexes_.emplace(node_name, std::make_unique<std::mutex>());
   auto input_size = cnode->inputs().size();
   int index = 0;
   for (size_t i = 1; i < input_size; i++) {
@@ -163,11 +171,14 @@ int Calibrator::GenerateInputData(const std::string &input_name, size_t image_in
 int Calibrator::CollectDataDistribution(
   const std::string &node_name, const std::vector<mindspore::MSTensor> &tensors,
   std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> *diverg_info_map,
-  CollectType collect_type) {
+  CollectType collect_type, size_t calib_index) {
   MS_CHECK_TRUE_MSG(diverg_info_map != nullptr, RET_ERROR, "diverg_info_map is nullptr.");
-  if (diverg_info_map->find(node_name) == diverg_info_map->end()) {
+  auto iter = diverg_info_map->find(node_name);
+  if (iter == diverg_info_map->end()) {
     return RET_OK;
   }
+  auto &diverg_infos = iter->second;
+  auto &node_mutex = node_mutexes_.at(node_name);
   for (size_t i = 0; i < tensors.size(); i++) {
     auto tensor = tensors[i];
     if (tensor.IsConst() || tensor.DataType() != DataType::kNumberTypeFloat32) {
@@ -181,16 +192,17 @@ int Calibrator::CollectDataDistribution(
     size_t elem_count = static_cast<size_t>(tensor.ElementNum());
     MS_CHECK_GT(elem_count, 0, RET_ERROR);
     std::vector<float> data(tensor_data, tensor_data + elem_count);
+    std::lock_guard<std::mutex> lock(*node_mutex);
     if (collect_type == MIN_MAX) {
-      MS_CHECK_LT(i, (*diverg_info_map)[node_name].size(), RET_ERROR);
-      auto ret = RecordMaxMinValue(data, (*diverg_info_map)[node_name][i]);
+      MS_CHECK_LT(i, diverg_infos.size(), RET_ERROR);
+      auto ret = RecordMaxMinValue(data, diverg_infos.at(i), calib_index);
       if (ret != RET_OK) {
         MS_LOG(ERROR) << tensor.Name() << " record max min value failed.";
         return RET_ERROR;
       }
     } else if (collect_type == KL_BIN) {
-      MS_CHECK_LT(i, (*diverg_info_map)[node_name].size(), RET_ERROR);
-      auto ret = UpdateDataFrequency(data, (*diverg_info_map)[node_name][i]);
+      MS_CHECK_LT(i, diverg_infos.size(), RET_ERROR);
+      auto ret = UpdateDataFrequency(data, diverg_infos.at(i));
       if (ret != RET_OK) {
         MS_LOG(ERROR) << tensor.Name() << " update data frequency failed.";
         return RET_ERROR;
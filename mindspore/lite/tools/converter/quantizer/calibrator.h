@@ -21,6 +21,7 @@
 #include <unordered_map>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include "tools/converter/quantizer/quant_params.h"
 #include "tools/converter/quantizer/quantize_util.h"
 #include "tools/converter/quantizer/data_distribution.h"
@@ -47,13 +48,15 @@ class Calibrator {
 
   int AddQuantizedOp(const CNodePtr &cnode);
 
-  int RecordMaxMinValue(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info);
+  int RecordMaxMinValue(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info,
+                        size_t calib_index = 0);
 
   int UpdateDivergInterval();
 
   int UpdateDataFrequency(const std::vector<float> &data, const std::unique_ptr<DataDistribution> &diverg_info);
 
-  int ComputeThreshold();
+  // The thresholds of the tensors are computed by at most thread_num threads.
+  int ComputeThreshold(size_t thread_num = 1);
 
   size_t GetBatchNum() const { return data_pre_process_param_.calibrate_size; }
 
@@ -67,16 +70,20 @@ class Calibrator {
     return &this->outputs_diverg_info_;
   }
 
+  // It can be called by the inferences of the different calibration rounds at the same time, the data distributions
+  // of the same node are updated exclusively.
   int CollectDataDistribution(
     const std::string &node_name, const std::vector<mindspore::MSTensor> &tensors,
     std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> *diverg_info_map,
-    CollectType collect_type);
+    CollectType collect_type, size_t calib_index = 0);
 
  private:
   // {node_name,{tensor_index,DataDistribution}}
   std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> inputs_diverg_info_;
   // {node_name,{tensor_index,DataDistribution}}
   std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> outputs_diverg_info_;
+  // {node_name,mutex}, created with the data distributions of the node.
+  std::unordered_map<std::string, std::unique_ptr<std::mutex>> node_mutexes_;
   size_t bit_num_;
   int quant_max_;
   int quant_min_;
@@ -23,7 +23,7 @@
 #include "tools/common/statistic_utils.h"
 
 namespace mindspore::lite::quant {
-int DataDistribution::RecordMaxMinValueArray(const std::vector<float> &data) {
+int DataDistribution::RecordMaxMinValueArray(const std::vector<float> &data, size_t calib_index) {
   if (data.empty()) {
     return RET_ERROR;
   }
@@ -44,8 +44,8 @@ int DataDistribution::RecordMaxMinValueArray(const std::vector<float> &data) {
     auto quantile_max = bak_data.at(quantile_max_index);
     MS_LOG(DEBUG) << "real_min_:" << real_min_ << " real_max_:" << real_max_ << " quantile_min:" << quantile_min
                   << " quantile_max:" << quantile_max;
-    this->min_datas_.emplace_back(quantile_min);
-    this->max_datas_.emplace_back(quantile_max);
+    (void)this->min_datas_.emplace(calib_index, quantile_min);
+    (void)this->max_datas_.emplace(calib_index, quantile_max);
   }
   return RET_OK;
 }
@@ -184,12 +184,13 @@ double DataDistribution::CalculateRemovalOutlierScale() {
   return CalculateScale(percent_result_.first, percent_result_.second);
 }
 
-std::pair<float, float> DataDistribution::CalQuantileMinMax(const std::vector<float> &min_datas,
-                                                            const std::vector<float> &max_datas) {
+std::pair<float, float> DataDistribution::CalQuantileMinMax(const std::multimap<size_t, float> &min_datas,
+                                                            const std::multimap<size_t, float> &max_datas) {
   MS_ASSERT(!min_datas.empty());
   MS_ASSERT(!max_datas.empty());
-  auto avg_min = accumulate(min_datas.begin(), min_datas.end(), 0.0) / min_datas.size();
-  auto avg_max = accumulate(max_datas.begin(), max_datas.end(), 0.0) / max_datas.size();
+  auto add_value = [](double sum, const std::pair<const size_t, float> &item) { return sum + item.second; };
+  auto avg_min = accumulate(min_datas.begin(), min_datas.end(), 0.0, add_value) / min_datas.size();
+  auto avg_max = accumulate(max_datas.begin(), max_datas.end(), 0.0, add_value) / max_datas.size();
   return {avg_min, avg_max};
 }
 
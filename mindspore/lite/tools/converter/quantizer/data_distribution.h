@@ -18,6 +18,7 @@
 #define MINDSPORE_LITE_TOOLS_CONVERTER_QUANTIZER_DATA_DISTRIBUTION_H_
 
 #include <vector>
+#include <map>
 #include <utility>
 #include <limits>
 #include "tools/converter/quantizer/quant_params.h"
@@ -50,7 +51,9 @@ class DataDistribution {
     }
   }
 
-  int RecordMaxMinValueArray(const std::vector<float> &data);
+  // The quantiles of REMOVAL_OUTLIER are recorded by the calibration index, so the scale is independent of the order
+  // of the calibration rounds when they are run in parallel.
+  int RecordMaxMinValueArray(const std::vector<float> &data, size_t calib_index = 0);
 
   void UpdateInterval();
 
@@ -86,7 +89,8 @@ class DataDistribution {
 
   double CalculateScale(float min_value, float max_value);
 
-  std::pair<float, float> CalQuantileMinMax(const std::vector<float> &min_datas, const std::vector<float> &max_datas);
+  std::pair<float, float> CalQuantileMinMax(const std::multimap<size_t, float> &min_datas,
+                                            const std::multimap<size_t, float> &max_datas);
 
  private:
   std::vector<float> histogram_;
@@ -102,8 +106,8 @@ class DataDistribution {
   int quant_max_ = 255;
   int quant_min_ = 0;
   ActivationQuantizedMethod activation_quant_method_ = MAX_MIN;
-  std::vector<float> min_datas_;
-  std::vector<float> max_datas_;
+  std::multimap<size_t, float> min_datas_;
+  std::multimap<size_t, float> max_datas_;
   std::pair<float, float> percent_result_{0.0, 0.0};
   double scale_ = 0;
   int zero_point_ = 0;
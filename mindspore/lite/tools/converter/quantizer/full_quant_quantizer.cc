@@ -18,6 +18,7 @@
 
 #include "tools/converter/quantizer/full_quant_quantizer.h"
 #include <dirent.h>
+#include <algorithm>
 #include <set>
 #include <memory>
 #include <unordered_map>
@@ -397,7 +398,7 @@ int FullQuantQuantizer::QuantWithKL() {
     return status;
   }
   MS_LOG(INFO) << "compute the best threshold";
-  status = this->calibrator_->ComputeThreshold();
+  status = this->calibrator_->ComputeThreshold(param_->commonQuantParam.thread_num);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "compute threshold failed.";
     return status;
@@ -612,6 +613,24 @@ int FullQuantQuantizer::InitDeviceConfig(const FuncGraphPtr &func_graph) {
   return RET_OK;
 }
 
+int FullQuantQuantizer::BuildCalibrateModels(const FuncGraphPtr &func_graph) {
+  calibrate_models_ = {fp32_ms_model_};
+  auto model_num = std::min(static_cast<size_t>(param_->fullQuantParam.calibrate_session_num),
+                            calibrator_->GetBatchNum());
+  for (size_t i = 1; i < model_num; ++i) {
+    auto model = std::make_shared<mindspore::Model>();
+    size_t size = 0;
+    auto ret = BuildModelByFuncGraph(model, func_graph, param_, &size);
+    if (ret != mindspore::kSuccess) {
+      MS_LOG(ERROR) << "Build calibrate model " << i << " failed.";
+      return RET_ERROR;
+    }
+    calibrate_models_.push_back(model);
+  }
+  MS_LOG(INFO) << "Run the calibration by " << calibrate_models_.size() << " models.";
+  return RET_OK;
+}
+
 int FullQuantQuantizer::DoInference(CollectType collect_type) {
   // get input tensor
   vector<mindspore::MSTensor> inputs = fp32_ms_model_->GetInputs();
@@ -620,43 +639,53 @@ int FullQuantQuantizer::DoInference(CollectType collect_type) {
                   << " calibrator count:" << calibrator_->GetInputNum();
     return RET_ERROR;
   }
+  // Each model runs one calibration round at a time, and the data distributions are recorded independent of the order
+  // of the rounds, so the result is the same as running the rounds one by one.
+  return ParallelRun(calibrator_->GetBatchNum(), calibrate_models_.size(),
+                     [this, collect_type](size_t calib_index, size_t model_index) {
+                       return DoInference(calibrate_models_[model_index], calib_index, collect_type);
+                     });
+}
 
-  for (size_t calib_index = 0; calib_index < calibrator_->GetBatchNum(); calib_index++) {
-    MS_LOG(INFO) << "Do inference round: " << calib_index;
-    // set multi-input data
-    for (auto tensor : inputs) {
-      int status = calibrator_->GenerateInputData(tensor.Name(), calib_index, &tensor);
-      MS_CHECK_TRUE_MSG(status == RET_OK, RET_ERROR, "generate input data from images failed!");
+int FullQuantQuantizer::DoInference(const std::shared_ptr<mindspore::Model> &model, size_t calib_index,
+                                    CollectType collect_type) {
+  MS_LOG(INFO) << "Do inference round: " << calib_index;
+  vector<mindspore::MSTensor> inputs = model->GetInputs();
+  // set multi-input data
+  for (auto tensor : inputs) {
+    int status = calibrator_->GenerateInputData(tensor.Name(), calib_index, &tensor);
+    MS_CHECK_TRUE_MSG(status == RET_OK, RET_ERROR, "generate input data from images failed!");
+  }
+  MSKernelCallBack beforeCallBack = [&](const std::vector<mindspore::MSTensor> &beforeInputs,
+                                        const std::vector<mindspore::MSTensor> &beforeOutputs,
+                                        const MSCallBackParam &callParam) -> bool {
+    auto diverg_info_map = calibrator_->GetInputDivergInfo();
+    auto ret = calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, diverg_info_map, collect_type,
+                                                    calib_index);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "CollectDataDistribution failed.";
+      return false;
     }
-    MSKernelCallBack beforeCallBack = [&](const std::vector<mindspore::MSTensor> &beforeInputs,
-                                          const std::vector<mindspore::MSTensor> &beforeOutputs,
-                                          const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetInputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, diverg_info_map, collect_type);
-      if (ret != RET_OK) {
-        MS_LOG(ERROR) << "CollectDataDistribution failed.";
-        return false;
-      }
-      return true;
-    };
-    // func
-    MSKernelCallBack afterCallBack = [&](const std::vector<mindspore::MSTensor> &afterInputs,
-                                         const std::vector<mindspore::MSTensor> &afterOutputs,
-                                         const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetOutputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, diverg_info_map, collect_type);
-      if (ret != RET_OK) {
-        MS_LOG(ERROR) << "CollectDataDistribution failed.";
-        return false;
-      }
-      return true;
-    };
-    auto outputs = fp32_ms_model_->GetOutputs();
-    auto status = fp32_ms_model_->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
-    if (status != mindspore::kSuccess) {
-      MS_LOG(ERROR) << "run model failed!";
-      return RET_ERROR;
+    return true;
+  };
+  // func
+  MSKernelCallBack afterCallBack = [&](const std::vector<mindspore::MSTensor> &afterInputs,
+                                       const std::vector<mindspore::MSTensor> &afterOutputs,
+                                       const MSCallBackParam &callParam) -> bool {
+    auto diverg_info_map = calibrator_->GetOutputDivergInfo();
+    auto ret = calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, diverg_info_map, collect_type,
+                                                    calib_index);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "CollectDataDistribution failed.";
+      return false;
     }
+    return true;
+  };
+  auto outputs = model->GetOutputs();
+  auto status = model->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
+  if (status != mindspore::kSuccess) {
+    MS_LOG(ERROR) << "run model failed!";
+    return RET_ERROR;
   }
   return RET_OK;
 }
@@ -688,6 +717,11 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
     MS_LOG(ERROR) << "Build model failed.";
     return RET_ERROR;
   }
+  status = BuildCalibrateModels(func_graph);
+  if (status != RET_OK) {
+    MS_LOG(ERROR) << "Build calibrate models failed.";
+    return status;
+  }
   MS_LOG(INFO) << "start to update divergence's max value";
   status = DoInference(MIN_MAX);
   if (status != RET_OK) {
@@ -703,6 +737,9 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
     }
   }
 
+  // Only the fp32_ms_model_ is used by the bias correction.
+  calibrate_models_.clear();
+
   MS_LOG(INFO) << "start to generate quant param and quantize tensor's data";
   status = QuantNode(func_graph);
   if (status != RET_OK) {
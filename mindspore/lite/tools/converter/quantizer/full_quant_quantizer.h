@@ -67,8 +67,12 @@ class FullQuantQuantizer : public Quantizer {
  private:
   int InitDeviceConfig(const FuncGraphPtr &func_graph);
 
+  int BuildCalibrateModels(const FuncGraphPtr &func_graph);
+
   int DoInference(CollectType collect_type);
 
+  int DoInference(const std::shared_ptr<mindspore::Model> &model, size_t calib_index, CollectType collect_type);
+
   int UpdateDivergeInterval();
 
   int QuantNodeSimpleOp(const CNodePtr &cnode);
@@ -116,6 +120,8 @@ class FullQuantQuantizer : public Quantizer {
   std::shared_ptr<Calibrator> calibrator_{nullptr};
   std::shared_ptr<QuantStrategy> quant_strategy_{nullptr};
   std::shared_ptr<mindspore::Model> fp32_ms_model_{nullptr};
+  // The models run the calibration rounds in parallel, the first one is the fp32_ms_model_.
+  std::vector<std::shared_ptr<mindspore::Model>> calibrate_models_;
 
   // key is tensor_name
   std::map<std::string, std::vector<schema::QuantParamT>> weight_quant_params_bak_;
@@ -87,6 +87,7 @@ struct FullQuantParam {
   bool bias_correction = true;
   bool per_channel = true;
   TargetDevice target_device = CPU;
+  int calibrate_session_num = 1;
 };
 }  // namespace mindspore::lite::quant
 
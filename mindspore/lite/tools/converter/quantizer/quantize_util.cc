@@ -24,6 +24,8 @@
 #include <set>
 #include <functional>
 #include <deque>
+#include <atomic>
+#include <thread>
 #include "tools/common/graph_util.h"
 #include "ops/fusion/mat_mul_fusion.h"
 #include "ops/fusion/conv2d_transpose_fusion.h"
@@ -679,4 +681,37 @@ int GetBucketAllIndex(const std::vector<int> &dims, int preferred_dim,
   }
   return RET_OK;
 }
+
+int ParallelRun(size_t task_num, size_t thread_num, const std::function<int(size_t task_id, size_t thread_id)> &task) {
+  thread_num = std::max<size_t>(std::min(thread_num, task_num), 1);
+  std::atomic<size_t> next_task_id{0};
+  std::atomic<int> status{RET_OK};
+  auto worker = [&](size_t thread_id) {
+    for (auto task_id = next_task_id++; task_id < task_num && status == RET_OK; task_id = next_task_id++) {
+      int ret = RET_ERROR;
+      try {
+        ret = task(task_id, thread_id);
+      } catch (const std::exception &e) {
+        MS_LOG(ERROR) << "Run task " << task_id << " failed: " << e.what();
+      }
+      if (ret != RET_OK) {
+        int expected = RET_OK;
+        (void)status.compare_exchange_strong(expected, ret);
+      }
+    }
+  };
+  if (thread_num == 1) {
+    worker(0);
+    return status;
+  }
+  std::vector<std::thread> threads;
+  for (size_t thread_id = 1; thread_id < thread_num; ++thread_id) {
+    (void)threads.emplace_back(worker, thread_id);
+  }
+  worker(0);
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return status;
+}
 }  // namespace mindspore::lite::quant
@@ -182,5 +182,10 @@ int GetElementNumFromShape(const std::vector<int> &dims, int *total_size);
 
 int GetBucketAllIndex(const std::vector<int> &dims, int preferred_dim,
                       std::vector<std::vector<int>> *buckets_data_index);
+
+// Run the tasks of index [0, task_num) by at most thread_num threads, the task is called with its index and the id of
+// the thread in [0, thread_num) which runs it. The tasks are not run any more after the first failed one, whose error
+// code is returned.
+int ParallelRun(size_t task_num, size_t thread_num, const std::function<int(size_t task_id, size_t thread_id)> &task);
 }  // namespace mindspore::lite::quant
 #endif  // MINDSPORE_LITE_TOOLS_CONVERTER_QUANTIZER_QUANTIZE_UTIL_H_
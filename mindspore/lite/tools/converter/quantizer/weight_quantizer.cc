@@ -17,6 +17,7 @@
 #define USE_DEPRECATED_API
 #include "tools/converter/quantizer/weight_quantizer.h"
 #include <list>
+#include <map>
 #include <string>
 #include <utility>
 #include <set>
@@ -42,6 +43,9 @@ int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
                                  const std::set<PrimitivePtr> &support_weight_quant_types,
                                  const std::set<PrimitivePtr> &per_layer_types,
                                  const std::set<PrimitivePtr> &symmetric_types, bool compression) {
+  auto manager = mindspore::Manage(func_graph, true);
+  CHECK_NULL_RETURN(manager);
+  std::vector<std::pair<CNodePtr, std::vector<int>>> quant_nodes;
   for (auto &cnode : func_graph->GetOrderedCnodes()) {
     auto primitive = GetValueNode<std::shared_ptr<ops::PrimitiveC>>(cnode->input(0));
     if (primitive == nullptr) {
@@ -73,11 +77,7 @@ int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
     }
 
     if (linear_quant) {
-      auto ret = LinearQuant(func_graph, cnode, per_layer_types, symmetric_types, weight_indices, compression);
-      if (ret != RET_OK) {
-        MS_LOG(ERROR) << cnode->fullname_with_scope() << " execute linear weight quantize error.";
-        return RET_ERROR;
-      }
+      (void)quant_nodes.emplace_back(cnode, weight_indices);
     } else {
       ClusterQuantization cluster;
       auto ret = cluster.KMeansQuantization(cnode, weight_indices);
@@ -87,10 +87,67 @@ int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
       }
     }
   }
+  return ParallelLinearQuant(manager, quant_nodes, per_layer_types, symmetric_types, compression);
+}
+
+int WeightQuantizer::ParallelLinearQuant(const FuncGraphManagerPtr &manager,
+                                         const std::vector<std::pair<CNodePtr, std::vector<int>>> &quant_nodes,
+                                         const std::set<PrimitivePtr> &per_layer_types,
+                                         const std::set<PrimitivePtr> &symmetric_types, bool compression) {
+  // The weight shared by several nodes is quantized by the first node which can quantize it, so the shared weights are
+  // quantized node by node in order after the others, which are quantized by the nodes in parallel.
+  std::map<AnfNodePtr, size_t> weight_user_nums;
+  for (const auto &[cnode, weight_indices] : quant_nodes) {
+    for (auto idx : weight_indices) {
+      ++weight_user_nums[cnode->input(idx)];
+    }
+  }
+  std::vector<std::pair<CNodePtr, std::vector<int>>> parallel_nodes;
+  std::vector<std::pair<CNodePtr, std::vector<int>>> serial_nodes;
+  for (const auto &[cnode, weight_indices] : quant_nodes) {
+    std::vector<int> parallel_indices;
+    std::vector<int> serial_indices;
+    for (auto idx : weight_indices) {
+      if (weight_user_nums[cnode->input(idx)] > 1) {
+        serial_indices.push_back(idx);
+      } else {
+        parallel_indices.push_back(idx);
+      }
+    }
+    if (!parallel_indices.empty()) {
+      (void)parallel_nodes.emplace_back(cnode, parallel_indices);
+    }
+    if (!serial_indices.empty()) {
+      (void)serial_nodes.emplace_back(cnode, serial_indices);
+    }
+  }
+  auto do_linear_quant = [&, this](const std::pair<CNodePtr, std::vector<int>> &quant_node) {
+    auto ret = LinearQuant(manager, quant_node.first, per_layer_types, symmetric_types, quant_node.second, compression);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << quant_node.first->fullname_with_scope() << " execute linear weight quantize error.";
+      return RET_ERROR;
+    }
+    return RET_OK;
+  };
+  // The mixed bit quantization searches the scale by the whole model, so it is run serially.
+  size_t thread_num = is_mixed_bit_ ? 1 : static_cast<size_t>(param_->commonQuantParam.thread_num);
+  auto ret = ParallelRun(parallel_nodes.size(), thread_num,
+                         [&do_linear_quant, &parallel_nodes](size_t task_id, size_t) {
+                           return do_linear_quant(parallel_nodes[task_id]);
+                         });
+  if (ret != RET_OK) {
+    return ret;
+  }
+  for (const auto &quant_node : serial_nodes) {
+    ret = do_linear_quant(quant_node);
+    if (ret != RET_OK) {
+      return ret;
+    }
+  }
   return RET_OK;
 }
 
-int WeightQuantizer::LinearQuant(const FuncGraphPtr &func_graph, const CNodePtr &cnode,
+int WeightQuantizer::LinearQuant(const FuncGraphManagerPtr &manager, const CNodePtr &cnode,
                                  const std::set<PrimitivePtr> &per_layer_types,
                                  const std::set<PrimitivePtr> &symmetric_types, const std::vector<int> &weight_indices,
                                  bool compression) {
@@ -108,7 +165,7 @@ int WeightQuantizer::LinearQuant(const FuncGraphPtr &func_graph, const CNodePtr
   }
 
   auto status =
-    DoCNodeWeightQuant(func_graph, cnode, weight_indices, weight_quant_type, q_min, q_max, symmetric, compression);
+    DoCNodeWeightQuant(manager, cnode, weight_indices, weight_quant_type, q_min, q_max, symmetric, compression);
   if (status != RET_OK) {
     MS_LOG(ERROR) << cnode->fullname_with_scope() << " do weight quantize error";
     return RET_ERROR;
@@ -175,14 +232,14 @@ int WeightQuantizer::DoMixBitQuant(const CNodePtr &cnode, const ParameterPtr &pa
   return status;
 }
 
-int WeightQuantizer::DoCNodeWeightQuant(const FuncGraphPtr &func_graph, const CNodePtr &cnode,
+int WeightQuantizer::DoCNodeWeightQuant(const FuncGraphManagerPtr &manager, const CNodePtr &cnode,
                                         const std::vector<int> &weight_indices, WeightQuantType weight_quant_type,
                                         int q_min, int q_max, bool symmetric, bool compression) {
   CHECK_NULL_RETURN(cnode);
   auto primitive = GetValueNode<PrimitivePtr>(cnode->input(0));
   CHECK_NULL_RETURN(primitive);
-  auto manager = mindspore::Manage(func_graph, true);
   CHECK_NULL_RETURN(manager);
+  const auto &node_map = manager->node_users();
   for (auto idx : weight_indices) {
     auto input = cnode->input(idx);
     ParameterPtr parameter;
@@ -203,10 +260,10 @@ int WeightQuantizer::DoCNodeWeightQuant(const FuncGraphPtr &func_graph, const CN
       continue;
     }
     // support for matmul shared weight
-    auto node_map = manager->node_users();
-    auto node_user = node_map[input];
+    auto node_user = node_map.find(input);
     auto tmp_weight_quant_type = weight_quant_type;
-    if (node_user.size() > 1 && opt::CheckPrimitiveType(cnode, prim::kPrimMatMulFusion)) {
+    if (node_user != node_map.end() && node_user->second.size() > 1 &&
+        opt::CheckPrimitiveType(cnode, prim::kPrimMatMulFusion)) {
       MS_LOG(INFO) << input->fullname_with_scope() << " is shared weight.";
       tmp_weight_quant_type = WeightQuantType::FIXED_BIT_PER_LAYER;
     }
@@ -235,6 +292,7 @@ int WeightQuantizer::DoCNodeWeightQuant(const FuncGraphPtr &func_graph, const CN
         return status;
       }
     }
+    std::lock_guard<std::mutex> lock(weight_quantized_tensors_mutex_);
     weight_quantized_tensors_.insert(tensor_info);
   }
   return RET_OK;
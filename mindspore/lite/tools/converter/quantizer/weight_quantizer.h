@@ -19,6 +19,7 @@
 
 #include <future>
 #include <memory>
+#include <mutex>
 #include <map>
 #include <list>
 #include <string>
@@ -76,14 +77,18 @@ class WeightQuantizer : public Quantizer {
   float GetMinScale() const;
 
  private:
-  int LinearQuant(const FuncGraphPtr &func_graph, const CNodePtr &cnode, const std::set<PrimitivePtr> &per_layer_types,
-                  const std::set<PrimitivePtr> &symmetric_types, const std::vector<int> &weight_indices,
-                  bool compression = true);
+  int LinearQuant(const FuncGraphManagerPtr &manager, const CNodePtr &cnode,
+                  const std::set<PrimitivePtr> &per_layer_types, const std::set<PrimitivePtr> &symmetric_types,
+                  const std::vector<int> &weight_indices, bool compression = true);
+  int ParallelLinearQuant(const FuncGraphManagerPtr &manager,
+                          const std::vector<std::pair<CNodePtr, std::vector<int>>> &quant_nodes,
+                          const std::set<PrimitivePtr> &per_layer_types, const std::set<PrimitivePtr> &symmetric_types,
+                          bool compression);
   int MarkWeightQuantizationInNodes(const FuncGraphPtr &);
   int DoMarkWeightQuantizeIfQuantized(const CNodePtr &);
-  int DoCNodeWeightQuant(const FuncGraphPtr &func_graph, const CNodePtr &cnode, const std::vector<int> &weight_indices,
-                         WeightQuantType weight_quant_type, int q_min, int q_max, bool symmetric = false,
-                         bool compression = true);
+  int DoCNodeWeightQuant(const FuncGraphManagerPtr &manager, const CNodePtr &cnode,
+                         const std::vector<int> &weight_indices, WeightQuantType weight_quant_type, int q_min,
+                         int q_max, bool symmetric = false, bool compression = true);
   int DoCompression(const CNodePtr &cnode, const ParameterPtr &parameter, int idx);
   int DoMixBitQuant(const CNodePtr &cnode, const ParameterPtr &parameter, int idx, const tensor::TensorPtr &tensor_info,
                     int preferred_dim, WeightQuantType weight_quant_type, bool symmetric = true);
@@ -93,6 +98,7 @@ class WeightQuantizer : public Quantizer {
   size_t bit_num_{8};
   // delete it in the future.
   std::set<tensor::TensorPtr> weight_quantized_tensors_;
+  std::mutex weight_quantized_tensors_mutex_;
   bool is_auto_tune_ = false;
   bool is_mixed_bit_ = false;
   double mixed_bit_init_scale_ = 0.02;
@@ -0,0 +1,128 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "abstract/ops/infer_cache.h"
+#include "mindspore/core/ops/core_ops.h"
+#include "utils/ms_context.h"
+
+namespace mindspore {
+namespace abstract {
+class TestInferCache : public UT::Common {
+ public:
+  TestInferCache() {}
+  void SetUp() override { InferCache::GetInstance().Clear(); }
+  void TearDown() override { InferCache::GetInstance().Clear(); }
+};
+
+namespace {
+AbstractBasePtr MakeTensorAbstract(const ShapeVector &shape) {
+  return std::make_shared<AbstractTensor>(kFloat32, std::make_shared<Shape>(shape));
+}
+}  // namespace
+
+/// Feature: InferCache
+/// Description: Infer the same primitive and attrs with the same and the different input abstracts
+/// Expectation: The infer runs once for the same inputs, and the attrs added by the infer are added again on hit
+TEST_F(TestInferCache, test_infer_cache_hit) {
+  auto &cache = InferCache::GetInstance();
+  if (!cache.enable()) {
+    return;
+  }
+  size_t infer_count = 0;
+  auto infer = [&infer_count](const PrimitivePtr &prim, const AbstractBasePtrList &args) {
+    ++infer_count;
+    (void)prim->AddAttr("infer_count", MakeValue(static_cast<int64_t>(infer_count)));
+    return args[0]->Clone();
+  };
+  auto prim = std::make_shared<Primitive>("InferCacheTestOp");
+  (void)prim->AddAttr("axis", MakeValue(static_cast<int64_t>(0)));
+  AbstractBasePtrList args{MakeTensorAbstract({2, 3}), MakeTensorAbstract({2, 3})};
+  auto out1 = cache.Infer(prim, args, [&]() { return infer(prim, args); });
+
+  auto same_prim = std::make_shared<Primitive>("InferCacheTestOp");
+  (void)same_prim->AddAttr("axis", MakeValue(static_cast<int64_t>(0)));
+  AbstractBasePtrList same_args{MakeTensorAbstract({2, 3}), MakeTensorAbstract({2, 3})};
+  auto out2 = cache.Infer(same_prim, same_args, [&]() { return infer(same_prim, same_args); });
+  ASSERT_EQ(infer_count, 1);
+  ASSERT_NE(out1, out2);
+  ASSERT_EQ(*out1, *out2);
+  ASSERT_TRUE(same_prim->HasAttr("infer_count"));
+
+  AbstractBasePtrList other_args{MakeTensorAbstract({4, 3}), MakeTensorAbstract({4, 3})};
+  (void)cache.Infer(prim, other_args, [&]() { return infer(prim, other_args); });
+  ASSERT_EQ(infer_count, 2);
+
+  auto statistics = cache.GetStatistics("InferCacheTestOp");
+  ASSERT_EQ(statistics.hit_count, 1);
+  ASSERT_EQ(statistics.miss_count, 2);
+}
+
+/// Feature: InferCache
+/// Description: Infer the same primitive and input abstracts again after the device target of the context is changed
+/// Expectation: The infer runs again under the new device target, and the result of each device target is hit
+TEST_F(TestInferCache, test_infer_cache_context) {
+  auto &cache = InferCache::GetInstance();
+  if (!cache.enable()) {
+    return;
+  }
+  auto context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context);
+  auto device_target = context->get_param<std::string>(MS_CTX_DEVICE_TARGET);
+  std::string other_device_target = (device_target == kCPUDevice) ? kGPUDevice : kCPUDevice;
+  size_t infer_count = 0;
+  auto prim = std::make_shared<Primitive>("InferCacheTestOp");
+  AbstractBasePtrList args{MakeTensorAbstract({2, 3})};
+  auto infer = [&infer_count, &context]() {
+    ++infer_count;
+    // The output depends on the device target, like the infer of BatchMatMul.
+    auto dim = context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice ? 1 : 2;
+    return MakeTensorAbstract({dim});
+  };
+  auto out = cache.Infer(prim, args, infer);
+  context->set_param<std::string>(MS_CTX_DEVICE_TARGET, other_device_target);
+  auto other_out = cache.Infer(prim, args, infer);
+  ASSERT_EQ(infer_count, 2);
+  ASSERT_FALSE(*out == *other_out);
+  ASSERT_EQ(*cache.Infer(prim, args, infer), *other_out);
+  context->set_param<std::string>(MS_CTX_DEVICE_TARGET, device_target);
+  ASSERT_EQ(*cache.Infer(prim, args, infer), *out);
+  ASSERT_EQ(infer_count, 2);
+}
+
+/// Feature: InferCache
+/// Description: Infer the value depend primitive with the same input abstracts twice
+/// Expectation: The cache is bypassed and the infer runs each time
+TEST_F(TestInferCache, test_infer_cache_bypass_value_depend) {
+  auto &cache = InferCache::GetInstance();
+  if (!cache.enable()) {
+    return;
+  }
+  size_t infer_count = 0;
+  auto prim = std::make_shared<Primitive>(prim::kPrimReshape->name());
+  AbstractBasePtrList args{MakeTensorAbstract({2, 3}), MakeTensorAbstract({2})};
+  for (size_t i = 0; i < 2; ++i) {
+    (void)cache.Infer(prim, args, [&infer_count]() {
+      ++infer_count;
+      return MakeTensorAbstract({3, 2});
+    });
+  }
+  ASSERT_EQ(infer_count, 2);
+  ASSERT_EQ(cache.GetStatistics(prim->name()).bypass_count, 2);
+}
+}  // namespace abstract
+}  // namespace mindspore
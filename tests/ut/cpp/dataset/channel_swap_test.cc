@@ -52,3 +52,33 @@ TEST_F(MindDataTestChannelSwap, TestOp) {
   EXPECT_EQ(success, true);
   MS_LOG(INFO) << "MindDataTestChannelSwap end.";
 }
+
+/// Feature: HwcToChw op
+/// Description: Test BatchCompute on the images batched before the map
+/// Expectation: Each image of the batch is converted from HWC to CHW
+TEST_F(MindDataTestChannelSwap, TestBatchCompute) {
+  std::vector<int32_t> images(2 * 2 * 2 * 3);
+  for (size_t i = 0; i < images.size(); ++i) {
+    images[i] = static_cast<int32_t>(i);
+  }
+  std::shared_ptr<Tensor> batch_tensor;
+  ASSERT_TRUE(Tensor::CreateFromVector(images, TensorShape({2, 2, 2, 3}), &batch_tensor).IsOk());
+  auto op = std::make_unique<HwcToChwOp>();
+  ASSERT_EQ(op->BatchInputRank(), 4);
+  std::shared_ptr<Tensor> batch_output;
+  ASSERT_TRUE(op->BatchCompute(batch_tensor, &batch_output).IsOk());
+  ASSERT_EQ(batch_output->shape(), TensorShape({2, 3, 2, 2}));
+  for (dsize_t n = 0; n < 2; ++n) {
+    for (dsize_t c = 0; c < 3; ++c) {
+      for (dsize_t h = 0; h < 2; ++h) {
+        for (dsize_t w = 0; w < 2; ++w) {
+          int32_t in_value = 0;
+          int32_t out_value = 0;
+          ASSERT_TRUE(batch_tensor->GetItemAt(&in_value, {n, h, w, c}).IsOk());
+          ASSERT_TRUE(batch_output->GetItemAt(&out_value, {n, c, h, w}).IsOk());
+          ASSERT_EQ(in_value, out_value);
+        }
+      }
+    }
+  }
+}
@@ -23,6 +23,7 @@
 #include "minddata/dataset/engine/datasetops/source/sampler/distributed_sampler.h"
 #include "utils/log_adapter.h"
 
+#include <memory>
 #include <vector>
 #include <unordered_set>
 
@@ -122,3 +123,72 @@ TEST_F(MindDataTestDistributedSampler, TestThreeShards) {
   ASSERT_EQ(m_sampler.GetNextSample(&row), Status::OK());
   ASSERT_EQ(row.eoe(), true);
 }
+
+/// Feature: DistributedSampler
+/// Description: Test DistributedSampler with block_size=3 and shuffle=false over two epochs
+/// Expectation: Each shard takes a contiguous range of blocks, which is rotated by one shard in the next epoch
+TEST_F(MindDataTestDistributedSampler, TestBlockAssignment) {
+  uint64_t num_rows = 10;
+  auto get_epoch = [](DistributedSamplerRT *sampler) {
+    TensorRow row;
+    std::vector<int64_t> out;
+    EXPECT_EQ(sampler->GetNextSample(&row), Status::OK());
+    for (const auto &t : row) {
+      for (auto it = t->begin<int64_t>(); it != t->end<int64_t>(); it++) {
+        out.push_back(*it);
+      }
+    }
+    EXPECT_EQ(sampler->GetNextSample(&row), Status::OK());
+    EXPECT_EQ(row.eoe(), true);
+    return out;
+  };
+
+  DistributedSamplerRT shard0(2, 0, false, 0, 0, -1, true, 3);
+  DistributedSamplerRT shard1(2, 1, false, 0, 0, -1, true, 3);
+  DummyRandomAccessOp dummyRandomAccessOp(num_rows);
+  shard0.HandshakeRandomAccessOp(&dummyRandomAccessOp);
+  shard1.HandshakeRandomAccessOp(&dummyRandomAccessOp);
+  ASSERT_EQ(get_epoch(&shard0), std::vector<int64_t>({0, 1, 2, 3, 4}));
+  ASSERT_EQ(get_epoch(&shard1), std::vector<int64_t>({5, 6, 7, 8, 9}));
+
+  // The blocks are rotated by 2 blocks, the order of blocks is {6, 7, 8}, {9}, {0, 1, 2}, {3, 4, 5}.
+  ASSERT_EQ(shard0.ResetSampler(), Status::OK());
+  ASSERT_EQ(shard1.ResetSampler(), Status::OK());
+  ASSERT_EQ(get_epoch(&shard0), std::vector<int64_t>({6, 7, 8, 9, 0}));
+  ASSERT_EQ(get_epoch(&shard1), std::vector<int64_t>({1, 2, 3, 4, 5}));
+}
+
+/// Feature: DistributedSampler
+/// Description: Test DistributedSampler with block_size=4 and shuffle=true
+/// Expectation: The shards cover all the rows without overlap and the rows in a block are in order
+TEST_F(MindDataTestDistributedSampler, TestBlockAssignmentShuffle) {
+  uint64_t num_rows = 30;
+  int64_t num_shards = 3;
+  std::vector<std::unique_ptr<DistributedSamplerRT>> samplers;
+  DummyRandomAccessOp dummyRandomAccessOp(num_rows);
+  for (int64_t i = 0; i < num_shards; ++i) {
+    samplers.push_back(std::make_unique<DistributedSamplerRT>(num_shards, i, true, 0, 5, -1, true, 4));
+    samplers.back()->HandshakeRandomAccessOp(&dummyRandomAccessOp);
+  }
+  for (int epoch = 0; epoch < 2; ++epoch) {
+    std::unordered_set<int64_t> all_rows;
+    for (auto &sampler : samplers) {
+      if (epoch > 0) {
+        ASSERT_EQ(sampler->ResetSampler(), Status::OK());
+      }
+      TensorRow row;
+      ASSERT_EQ(sampler->GetNextSample(&row), Status::OK());
+      std::vector<int64_t> out(row[0]->begin<int64_t>(), row[0]->end<int64_t>());
+      ASSERT_EQ(out.size(), 10);
+      for (size_t i = 1; i < out.size(); ++i) {
+        if (out[i] % 4 != 0) {
+          ASSERT_EQ(out[i], out[i - 1] + 1);
+        }
+      }
+      all_rows.insert(out.begin(), out.end());
+      ASSERT_EQ(sampler->GetNextSample(&row), Status::OK());
+      ASSERT_EQ(row.eoe(), true);
+    }
+    ASSERT_EQ(all_rows.size(), num_rows);
+  }
+}
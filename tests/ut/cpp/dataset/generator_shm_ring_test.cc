@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/engine/datasetops/source/generator_shm_ring.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestGeneratorShmRing : public UT::Common {
+ public:
+  MindDataTestGeneratorShmRing() {}
+};
+
+/// Feature: GeneratorShmRing
+/// Description: Test a worker attached by the key writes a row in place and the row is popped from the ring
+/// Expectation: The tensors share the slot memory, and the slot is free again after the tensors are destroyed
+TEST_F(MindDataTestGeneratorShmRing, TestWriteAndPopRow) {
+  std::shared_ptr<GeneratorShmRing> ring;
+  ASSERT_OK(GeneratorShmRing::Create(2, 1024, &ring));
+  std::shared_ptr<GeneratorShmRing> worker;
+  ASSERT_OK(GeneratorShmRing::Attach(ring->key(), &worker));
+  ASSERT_EQ(worker->num_slots(), 2);
+  ASSERT_EQ(worker->slot_size(), 1024);
+
+  int32_t slot = -1;
+  ASSERT_OK(worker->AcquireSlot(&slot));
+  ASSERT_GE(slot, 0);
+  auto data = reinterpret_cast<int32_t *>(worker->SlotData(slot));
+  for (int32_t i = 0; i < 6; ++i) {
+    data[i] = i;
+  }
+  ASSERT_OK(worker->SetColumn(slot, 0, DataType(DataType::DE_INT32), TensorShape({2, 2}), 0));
+  ASSERT_OK(worker->SetColumn(slot, 1, DataType(DataType::DE_INT32), TensorShape({2}), 16));
+  // The row exceeding the slot is rejected.
+  ASSERT_ERROR(worker->SetColumn(slot, 2, DataType(DataType::DE_INT32), TensorShape({256}), 16));
+  ASSERT_OK(worker->CommitSlot(slot, 2));
+
+  TensorRow row;
+  ASSERT_OK(ring->PopRow(slot, &row));
+  ASSERT_EQ(row.size(), 2);
+  ASSERT_EQ(row[0]->shape(), TensorShape({2, 2}));
+  ASSERT_EQ(row[0]->GetBuffer(), ring->SlotData(slot));
+  int32_t value = 0;
+  ASSERT_OK(row[1]->GetItemAt(&value, {1}));
+  ASSERT_EQ(value, 5);
+  // The slot can not be popped twice.
+  TensorRow dup_row;
+  ASSERT_ERROR(ring->PopRow(slot, &dup_row));
+
+  ASSERT_EQ(ring->NumSlotsInUse(), 1);
+  row[0].reset();
+  ASSERT_EQ(ring->NumSlotsInUse(), 1);
+  row.clear();
+  ASSERT_EQ(ring->NumSlotsInUse(), 0);
+}
+
+/// Feature: GeneratorShmRing
+/// Description: Test acquiring the slots when all of them are in use
+/// Expectation: No slot is given until one of them is freed
+TEST_F(MindDataTestGeneratorShmRing, TestRingFull) {
+  std::shared_ptr<GeneratorShmRing> ring;
+  ASSERT_OK(GeneratorShmRing::Create(2, 64, &ring));
+  std::vector<int32_t> slots(3, -1);
+  for (auto &slot : slots) {
+    ASSERT_OK(ring->AcquireSlot(&slot));
+  }
+  ASSERT_GE(slots[0], 0);
+  ASSERT_GE(slots[1], 0);
+  ASSERT_NE(slots[0], slots[1]);
+  ASSERT_EQ(slots[2], -1);
+
+  // An empty row frees the slot once it is popped.
+  ASSERT_OK(ring->CommitSlot(slots[0], 0));
+  TensorRow row;
+  ASSERT_OK(ring->PopRow(slots[0], &row));
+  ASSERT_TRUE(row.empty());
+  ASSERT_OK(ring->AcquireSlot(&slots[2]));
+  ASSERT_EQ(slots[2], slots[0]);
+}
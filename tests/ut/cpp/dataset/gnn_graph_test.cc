@@ -326,6 +326,57 @@ TEST_F(MindDataTestGNNGraph, TestGetSampledNeighbors) {
   EXPECT_TRUE(s.ToString().find("Invalid node id:301") != std::string::npos);
 }
 
+/// Feature: GNNGraph
+/// Description: Test GetSampledNeighbors with a batch of nodes large enough to be sampled by multiple workers
+/// Expectation: Every sampled neighbor of each row is a neighbor of the node of the row
+TEST_F(MindDataTestGNNGraph, TestGetSampledNeighborsBatch) {
+  std::string path = "data/mindrecord/testGraphData/testdata";
+  GraphDataImpl graph("mindrecord", path, 4);
+  Status s = graph.Init();
+  EXPECT_TRUE(s.IsOk());
+
+  MetaInfo meta_info;
+  s = graph.GetMetaInfo(&meta_info);
+  EXPECT_TRUE(s.IsOk());
+  std::shared_ptr<Tensor> nodes;
+  s = graph.GetAllNodes(meta_info.node_type[0], &nodes);
+  EXPECT_TRUE(s.IsOk());
+  std::vector<NodeIdType> all_nodes(nodes->begin<NodeIdType>(), nodes->end<NodeIdType>());
+  std::vector<NodeIdType> node_list;
+  constexpr size_t kBatchSize = 2048;
+  for (size_t i = 0; i < kBatchSize; ++i) {
+    node_list.push_back(all_nodes[i % all_nodes.size()]);
+  }
+
+  std::shared_ptr<Tensor> all_neighbors;
+  s = graph.GetAllNeighbors(all_nodes, meta_info.node_type[1], OutputFormat::kNormal, &all_neighbors);
+  EXPECT_TRUE(s.IsOk());
+  std::unordered_map<NodeIdType, std::unordered_set<NodeIdType>> neighbor_sets;
+  dsize_t max_degree = all_neighbors->shape()[1];
+  auto neighbor_itr = all_neighbors->begin<NodeIdType>();
+  for (size_t i = 0; i < all_nodes.size(); ++i) {
+    for (dsize_t j = 0; j < max_degree; ++j, ++neighbor_itr) {
+      neighbor_sets[all_nodes[i]].insert(*neighbor_itr);
+    }
+  }
+
+  for (auto strategy : {SamplingStrategy::kRandom, SamplingStrategy::kEdgeWeight}) {
+    std::shared_ptr<Tensor> neighbors;
+    s = graph.GetSampledNeighbors(node_list, {3}, {meta_info.node_type[1]}, strategy, &neighbors);
+    EXPECT_TRUE(s.IsOk());
+    EXPECT_EQ(neighbors->shape()[0], kBatchSize);
+    EXPECT_EQ(neighbors->shape()[1], 4);
+    auto itr = neighbors->begin<NodeIdType>();
+    for (size_t i = 0; i < kBatchSize; ++i) {
+      NodeIdType node = *itr++;
+      EXPECT_EQ(node, node_list[i]);
+      for (int j = 0; j < 3; ++j, ++itr) {
+        EXPECT_TRUE(neighbor_sets[node].count(*itr) > 0);
+      }
+    }
+  }
+}
+
 /// Feature: GNNGraph
 /// Description: Test GetNegSampledNeighbors from graph basic usage
 /// Expectation: Output is equal to the expected output
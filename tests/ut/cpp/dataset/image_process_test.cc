@@ -2256,3 +2256,34 @@ TEST_F(MindDataImageProcess, TestHWCTOCHWImage) {
   bool ret = compare_mat_shape(src, expect_value);
   ASSERT_TRUE(ret == true);
 }
+
+/// Feature: ResizeNormalizeHWC2CHW
+/// Description: Test the fused resize, normalize and HWC2CHW against the separate operations.
+/// Expectation: Success and the output buffer is the same as the result of the separate operations.
+TEST_F(MindDataImageProcess, TestResizeNormalizeHWC2CHW) {
+  std::string filename = "data/dataset/apple.jpg";
+  cv::Mat image = cv::imread(filename, cv::ImreadModes::IMREAD_COLOR);
+  LiteMat src(image.cols, image.rows, image.channels(), image.data, LDataType(LDataType::UINT8));
+  const int dst_w = 37;
+  const int dst_h = 29;
+  std::vector<float> means = {123.675, 116.28, 103.53};
+  std::vector<float> stds = {58.395, 57.12, 57.375};
+
+  LiteMat resized;
+  ASSERT_TRUE(ResizeBilinear(src, resized, dst_w, dst_h));
+  LiteMat normalized;
+  ASSERT_TRUE(SubStractMeanNormalize(resized, normalized, means, stds));
+  LiteMat expect_value;
+  ASSERT_TRUE(HWC2CHW(normalized, expect_value));
+
+  std::vector<float> dst(dst_w * dst_h * src.channel_);
+  ASSERT_TRUE(ResizeNormalizeHWC2CHW(src, dst.data(), dst_w, dst_h, means, stds));
+  const float *expect_ptr = expect_value;
+  for (size_t i = 0; i < dst.size(); i++) {
+    EXPECT_FLOAT_EQ(dst[i], expect_ptr[i]);
+  }
+
+  // The mean and std must match the channel of the image.
+  std::vector<float> bad_means = {123.675};
+  ASSERT_FALSE(ResizeNormalizeHWC2CHW(src, dst.data(), dst_w, dst_h, bad_means, stds));
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/kernels/image/image_simd.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestImageSimd : public UT::Common {
+ public:
+  MindDataTestImageSimd() = default;
+};
+
+/// Feature: Image SIMD kernels
+/// Description: Test NormalizeUint8 with the channels handled by the SIMD kernels and the scalar code
+/// Expectation: The result is the same as the scalar normalization
+TEST_F(MindDataTestImageSimd, TestNormalizeUint8) {
+  MS_LOG(INFO) << "The image SIMD kernels run with " << SimdIsaName(GetSimdIsa());
+  std::vector<float> mean = {121.0, 115.0, 100.0, 50.0, 7.0};
+  std::vector<float> std = {70.0, 68.0, 71.0, 3.0, 9.0};
+  for (int64_t channels = 1; channels <= static_cast<int64_t>(mean.size()); ++channels) {
+    // Not a multiple of the SIMD step, so the scalar tail is tested too.
+    int64_t size = (100 + 3) * channels;
+    std::vector<uint8_t> src(size);
+    for (int64_t i = 0; i < size; ++i) {
+      src[i] = static_cast<uint8_t>(i * 37);
+    }
+    std::vector<float> dst(size);
+    NormalizeUint8(src.data(), dst.data(), size, mean.data(), std.data(), channels);
+    for (int64_t i = 0; i < size; ++i) {
+      float expect = (static_cast<float>(src[i]) - mean[i % channels]) / std[i % channels];
+      ASSERT_EQ(dst[i], expect);
+    }
+  }
+}
+
+/// Feature: Image SIMD kernels
+/// Description: Test NormalizeUint8HwcToChw with and without the horizontal flip
+/// Expectation: Each pixel is normalized and placed in the CHW output
+TEST_F(MindDataTestImageSimd, TestNormalizeUint8HwcToChw) {
+  constexpr int64_t kHeight = 5;
+  constexpr int64_t kWidth = 7;
+  constexpr int64_t kChannels = 3;
+  std::vector<uint8_t> src(kHeight * kWidth * kChannels);
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = static_cast<uint8_t>(i * 3);
+  }
+  std::vector<float> mean = {1.0, 2.0, 3.0};
+  std::vector<float> std = {2.0, 3.0, 4.0};
+  for (bool flip : {false, true}) {
+    std::vector<float> dst(src.size());
+    NormalizeUint8HwcToChw(src.data(), dst.data(), kHeight, kWidth, kChannels, mean.data(), std.data(), flip);
+    for (int64_t c = 0; c < kChannels; ++c) {
+      for (int64_t y = 0; y < kHeight; ++y) {
+        for (int64_t x = 0; x < kWidth; ++x) {
+          int64_t x_in = flip ? kWidth - 1 - x : x;
+          float expect = (static_cast<float>(src[(y * kWidth + x_in) * kChannels + c]) - mean[c]) / std[c];
+          ASSERT_EQ(dst[(c * kHeight + y) * kWidth + x], expect);
+        }
+      }
+    }
+  }
+}
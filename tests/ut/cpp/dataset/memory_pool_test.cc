@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <thread>
 #include "minddata/dataset/util/memory_pool.h"
 #include "minddata/dataset/util/circular_pool.h"
+#include "minddata/dataset/util/recycle_pool.h"
 #include "minddata/dataset/util/allocator.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
@@ -100,3 +102,63 @@ TEST_F(MindDataTestMemoryPool, TestMemGuard) {
     p[sz / 2] = 'a';
   }
 }
+
+/// Feature: RecyclePool
+/// Description: Test the mapping between the size and the size class
+/// Expectation: The size class covers the size and the waste is within 25%
+TEST_F(MindDataTestMemoryPool, TestRecyclePoolSizeClass) {
+  size_t last_index = 0;
+  for (size_t size = 1; size <= (1UL << 20); size += 7) {
+    size_t index = RecyclePool::SizeClassIndex(size);
+    ASSERT_GE(index, last_index);
+    size_t class_size = RecyclePool::SizeClassSize(index);
+    ASSERT_GE(class_size, size);
+    ASSERT_TRUE(class_size <= 64 || class_size - size <= size / 4);
+    ASSERT_EQ(RecyclePool::SizeClassIndex(class_size), index);
+    last_index = index;
+  }
+}
+
+/// Feature: RecyclePool
+/// Description: Test the freed buffers are reused by the later allocations of the same size class
+/// Expectation: The buffers are reused, the cached bytes are capped by the capacity and the stats are counted
+TEST_F(MindDataTestMemoryPool, TestRecyclePoolReuse) {
+  const size_t kBufSize = 1000;
+  const size_t kClassSize = RecyclePool::SizeClassSize(RecyclePool::SizeClassIndex(kBufSize));
+  RecyclePool pool(kClassSize);
+  void *p1 = nullptr;
+  void *p2 = nullptr;
+  ASSERT_OK(pool.Allocate(kBufSize, &p1));
+  ASSERT_OK(pool.Allocate(kBufSize, &p2));
+  pool.Deallocate(p1);
+  // Only one buffer fits in the capacity, the other is returned to the system.
+  pool.Deallocate(p2);
+  ASSERT_EQ(pool.GetStats().cached_bytes, kClassSize);
+  ASSERT_EQ(pool.GetStats().num_released, 1);
+
+  void *p3 = nullptr;
+  ASSERT_OK(pool.Allocate(kBufSize - 10, &p3));
+  ASSERT_EQ(p3, p1);
+  ASSERT_OK(pool.Reallocate(&p3, kBufSize - 10, kClassSize));
+  ASSERT_EQ(p3, p1);
+
+  // The buffer freed by other thread is reused as well.
+  std::thread free_thread([&pool, p3]() { pool.Deallocate(p3); });
+  free_thread.join();
+  void *p4 = nullptr;
+  ASSERT_OK(pool.Allocate(kBufSize, &p4));
+  ASSERT_EQ(p4, p1);
+  pool.Deallocate(p4);
+
+  // The huge buffer is not pooled.
+  void *p5 = nullptr;
+  ASSERT_OK(pool.Allocate(1UL << 27, &p5));
+  pool.Deallocate(p5);
+
+  RecyclePoolStats stats = pool.GetStats();
+  MS_LOG(INFO) << stats;
+  ASSERT_EQ(stats.num_allocations, 4);
+  ASSERT_EQ(stats.num_hits, 2);
+  ASSERT_EQ(stats.num_unpooled, 1);
+  ASSERT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+}
@@ -55,3 +55,35 @@ TEST_F(MindDataTestNormalizeOP, TestOp) {
   cv::FileStorage file(output_filename, cv::FileStorage::WRITE);
   file << "imageData" << cv_output_image;
 }
+
+/// Feature: Normalize op
+/// Description: Test BatchCompute on the images batched before the map
+/// Expectation: The batched result is the same as normalizing each image by Compute
+TEST_F(MindDataTestNormalizeOP, TestBatchCompute) {
+  std::vector<uint8_t> images(2 * 2 * 2 * 3);
+  for (size_t i = 0; i < images.size(); ++i) {
+    images[i] = static_cast<uint8_t>(i * 10);
+  }
+  std::shared_ptr<Tensor> batch_tensor;
+  ASSERT_TRUE(Tensor::CreateFromVector(images, TensorShape({2, 2, 2, 3}), &batch_tensor).IsOk());
+  for (bool is_hwc : {true, false}) {
+    auto op = std::make_unique<NormalizeOp>(std::vector<float>{121.0, 115.0, 100.0},
+                                            std::vector<float>{70.0, 68.0, 71.0}, is_hwc);
+    ASSERT_EQ(op->BatchInputRank(), 4);
+    std::shared_ptr<Tensor> batch_output;
+    ASSERT_TRUE(op->BatchCompute(batch_tensor, &batch_output).IsOk());
+    ASSERT_EQ(batch_output->shape(), batch_tensor->shape());
+    auto batch_itr = batch_output->begin<float>();
+    for (size_t n = 0; n < 2; ++n) {
+      std::vector<uint8_t> image(images.begin() + n * 12, images.begin() + (n + 1) * 12);
+      std::shared_ptr<Tensor> image_tensor;
+      TensorShape image_shape = is_hwc ? TensorShape({2, 2, 3}) : TensorShape({3, 2, 2});
+      ASSERT_TRUE(Tensor::CreateFromVector(image, image_shape, &image_tensor).IsOk());
+      std::shared_ptr<Tensor> image_output;
+      ASSERT_TRUE(op->Compute(image_tensor, &image_output).IsOk());
+      for (auto itr = image_output->begin<float>(); itr != image_output->end<float>(); ++itr, ++batch_itr) {
+        ASSERT_FLOAT_EQ(*itr, *batch_itr);
+      }
+    }
+  }
+}
@@ -31,6 +31,7 @@
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/tensor_op.h"
 
 using namespace mindspore::dataset;
 
@@ -120,3 +121,31 @@ TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassPreBuiltTensorO
   ASSERT_EQ(fused_ops.size(), 1);
   ASSERT_EQ(fused_ops[0]->Name(), kRandomCropDecodeResizeOp);
 }
+
+/// Feature: IR Optimization
+/// Description: Test TensorOpFusionPass by fusing Decode, RandomResizedCrop, RandomHorizontalFlip, Normalize, HWC2CHW
+/// Expectation: The five tensor operations are fused into RandomCropDecodeResizeNormalizeOp
+TEST_F(MindDataTestOptimizationPass, MindDataTestTensorFusionPassDecodeToChw) {
+  MS_LOG(INFO) << "Doing MindDataTestOptimizationPass-MindDataTestTensorFusionPassDecodeToChw.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  auto decode_op = vision::Decode();
+  auto random_resized_crop_op = vision::RandomResizedCrop({100});
+  auto random_horizontal_flip_op = vision::RandomHorizontalFlip(0.5);
+  auto normalize_op = vision::Normalize({121.0, 115.0, 100.0}, {70.0, 68.0, 71.0});
+  auto hwc2chw_op = vision::HWC2CHW();
+  std::shared_ptr<Dataset> root = ImageFolder(folder_path, false)
+                                    ->Map({decode_op, random_resized_crop_op, random_horizontal_flip_op, normalize_op,
+                                           hwc2chw_op},
+                                          {"image"});
+
+  TensorOpFusionPass fusion_pass;
+  bool modified = false;
+  std::shared_ptr<MapNode> map_node = std::dynamic_pointer_cast<MapNode>(root->IRNode());
+  // no deepcopy is performed because this doesn't go through tree_adapter
+  ASSERT_OK(fusion_pass.Run(root->IRNode(), &modified));
+  EXPECT_EQ(modified, true);
+  ASSERT_NE(map_node, nullptr);
+  auto fused_ops = map_node->operations();
+  ASSERT_EQ(fused_ops.size(), 1);
+  ASSERT_EQ(fused_ops[0]->Name(), kRandomCropDecodeResizeNormalizeOp);
+}
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <map>
+#include <vector>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/perf/pipeline_model.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestPipelineModel : public UT::Common {
+ public:
+  MindDataTestPipelineModel() {}
+
+ protected:
+  // DeviceQueueOp(0) <- MapOp(1) <- ImageFolderOp(2)
+  std::vector<OpServiceStats> BuildOps(bool leaf_tunable, bool leaf_saturated) {
+    OpServiceStats root{0, -1, 0, false, 0.1, false};
+    OpServiceStats map{1, 0, 2, true, 2.0, false};
+    OpServiceStats leaf{2, 1, 4, leaf_tunable, 0.5, leaf_saturated};
+    return {root, map, leaf};
+  }
+
+  PipelineBudget BuildBudget(int32_t cpu_cores, int64_t queue_slots) {
+    PipelineBudget budget;
+    budget.cpu_cores = cpu_cores;
+    budget.queue_slots = queue_slots;
+    budget.min_queue_size = 1;
+    budget.max_queue_size = 128;
+    budget.target_speedup = 2.0;
+    return budget;
+  }
+
+  const double kBatchTime = 10.0;
+};
+
+/// Feature: PipelineModel
+/// Description: Test solving the workers of all tunable ops to reach the target throughput
+/// Expectation: The workers are given to the bottleneck op and the prefetch size covers both sides of the connector
+TEST_F(MindDataTestPipelineModel, TestSolveWorkers) {
+  PipelineModel model(BuildOps(true, false), kBatchTime);
+  EXPECT_DOUBLE_EQ(model.Throughput({}), 0.1);
+  std::map<int32_t, OpTuneConfig> configs;
+  ASSERT_OK(model.Solve(BuildBudget(16, 0), &configs));
+  ASSERT_EQ(configs.size(), 2);
+  EXPECT_EQ(configs[1].num_workers, 4);
+  EXPECT_EQ(configs[2].num_workers, 1);
+  EXPECT_EQ(configs[1].queue_size, 5);
+  EXPECT_EQ(configs[2].queue_size, 5);
+  EXPECT_DOUBLE_EQ(model.Throughput({{1, 4}, {2, 1}}), 0.2);
+}
+
+/// Feature: PipelineModel
+/// Description: Test solving the pipeline under the CPU and memory budget and with a fixed bottleneck
+/// Expectation: The workers and the prefetch sizes are bounded by the budget and the fixed bottleneck
+TEST_F(MindDataTestPipelineModel, TestSolveBudget) {
+  std::map<int32_t, OpTuneConfig> configs;
+  PipelineModel model(BuildOps(true, false), kBatchTime);
+  ASSERT_OK(model.Solve(BuildBudget(3, 0), &configs));
+  EXPECT_EQ(configs[1].num_workers, 2);
+  EXPECT_EQ(configs[2].num_workers, 1);
+
+  // The prefetch sizes are scaled down, but not below the number of workers.
+  ASSERT_OK(model.Solve(BuildBudget(16, 6), &configs));
+  EXPECT_EQ(configs[1].queue_size, 4);
+  EXPECT_EQ(configs[2].queue_size, 3);
+
+  // The saturated leaf can not be tuned, so more workers of map do not help.
+  PipelineModel fixed_model(BuildOps(false, true), kBatchTime);
+  ASSERT_OK(fixed_model.Solve(BuildBudget(16, 0), &configs));
+  ASSERT_EQ(configs.size(), 1);
+  EXPECT_EQ(configs[1].num_workers, 2);
+  EXPECT_EQ(configs[1].queue_size, 3);
+  EXPECT_DOUBLE_EQ(fixed_model.Throughput({}), 0.1);
+}
@@ -0,0 +1,116 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/engine/operator_connector.h"
+#include "minddata/dataset/engine/perf/pipeline_trace.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestPipelineTrace : public UT::Common {
+ public:
+  MindDataTestPipelineTrace() {}
+};
+
+/// Feature: LatencyHistogram
+/// Description: Test recording the latencies from multiple threads and estimating the percentiles
+/// Expectation: All latencies are counted and the percentiles are the upper bounds of the buckets
+TEST_F(MindDataTestPipelineTrace, TestLatencyHistogram) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Percentile(50), 0);
+  const int kThreadNum = 4;
+  const int kRecordNum = 1000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&histogram]() {
+      for (int j = 0; j < kRecordNum; ++j) {
+        // 99% of latencies are 10us, the others are 1000us.
+        histogram.Record(j % 100 == 0 ? 1000 : 10);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(histogram.Count(), kThreadNum * kRecordNum);
+  EXPECT_EQ(histogram.TotalUs(), kThreadNum * (990 * 10 + 10 * 1000));
+  EXPECT_EQ(histogram.Percentile(50), 15);
+  EXPECT_EQ(histogram.Percentile(99), 15);
+  EXPECT_EQ(histogram.Percentile(100), 1023);
+  histogram.Reset();
+  EXPECT_EQ(histogram.Count(), 0);
+}
+
+/// Feature: RowTracer
+/// Description: Test sampling the row events and saving them as a Chrome trace
+/// Expectation: Only the sampled rows are traced and the trace file is in Chrome trace format
+TEST_F(MindDataTestPipelineTrace, TestRowTracer) {
+  std::string file_path = "./test_pipeline_trace.json";
+  RowTracer tracer(file_path, 10);
+  ASSERT_TRUE(tracer.enabled());
+  for (int64_t i = 0; i < 100; ++i) {
+    if (tracer.Sampled(i)) {
+      tracer.AddEvent("MapOp(ID:1) produce", i, RowTracer::NowUs(), 5);
+    }
+  }
+  ASSERT_EQ(tracer.EventCount(), 10);
+  ASSERT_OK(tracer.Save());
+  std::ifstream is(file_path);
+  nlohmann::json trace = nlohmann::json::parse(is);
+  ASSERT_EQ(trace["traceEvents"].size(), 10);
+  EXPECT_EQ(trace["traceEvents"][1]["name"], "MapOp(ID:1) produce");
+  EXPECT_EQ(trace["traceEvents"][1]["ph"], "X");
+  EXPECT_EQ(trace["traceEvents"][1]["dur"], 5);
+  EXPECT_EQ(trace["traceEvents"][1]["args"]["row"], 10);
+  is.close();
+  (void)remove(file_path.c_str());
+
+  RowTracer disabled_tracer("", 10);
+  EXPECT_FALSE(disabled_tracer.Sampled(0));
+}
+
+/// Feature: OperatorConnector
+/// Description: Test the latencies of the rows passing the connector are recorded
+/// Expectation: The produce time skips the first row of the thread, and the control rows are not counted
+TEST_F(MindDataTestPipelineTrace, TestConnectorLatency) {
+  OperatorConnector connector(4);
+  connector.SetName("TestOp(ID:0)");
+  for (int i = 0; i < 3; ++i) {
+    TensorRow data_row;
+    data_row.setId(i);
+    if (i % 2 == 0) {
+      ASSERT_OK(connector.Add(data_row));
+    } else {
+      ASSERT_OK(connector.Add(std::move(data_row)));
+    }
+  }
+  ASSERT_OK(connector.SendEOE());
+  TensorRow row;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(connector.PopFront(&row));
+  }
+  EXPECT_TRUE(row.eoe());
+  EXPECT_EQ(connector.produce_time().Count(), 2);
+  EXPECT_EQ(connector.push_wait().Count(), 3);
+  EXPECT_EQ(connector.pop_wait().Count(), 4);
+  MS_LOG(INFO) << connector.LatencySummary();
+}
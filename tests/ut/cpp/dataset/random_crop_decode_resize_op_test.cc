@@ -18,6 +18,7 @@
 #include "common/cvop_common.h"
 #include "minddata/dataset/kernels/image/decode_op.h"
 #include "minddata/dataset/kernels/image/random_crop_and_resize_op.h"
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
 #include "minddata/dataset/core/config_manager.h"
 #include "utils/log_adapter.h"
@@ -161,3 +162,38 @@ TEST_F(MindDataTestRandomCropDecodeResizeOp, TestOp1) {
   }
   MS_LOG(INFO) << "RandomCropDecodeResizeOp test 2 finished";
 }
+
+/// Feature: RandomCropDecodeResizeNormalize op
+/// Description: Test the fused op of Decode, RandomResizedCrop, RandomHorizontalFlip, Normalize and HWC2CHW
+/// Expectation: The output is the normalized CHW float image of the target size, and the flip mirrors the width
+TEST_F(MindDataTestRandomCropDecodeResizeOp, TestFusedNormalizeOp) {
+  constexpr int target_height = 224;
+  constexpr int target_width = 224;
+  GlobalContext::config_manager()->set_seed(42);
+  RandomCropAndResizeOp crop_op(target_height, target_width);
+  std::vector<float> mean = {121.0, 115.0, 100.0};
+  std::vector<float> std = {70.0, 68.0, 71.0};
+  // Both ops copy the random state of crop_op, so the crop boxes are the same.
+  RandomCropDecodeResizeNormalizeOp no_flip_op(crop_op, 0.0, mean, std);
+  RandomCropDecodeResizeNormalizeOp flip_op(crop_op, 1.0, mean, std);
+  TensorRow input_row;
+  input_row.push_back(raw_input_tensor_);
+  TensorRow no_flip_output;
+  TensorRow flip_output;
+  ASSERT_TRUE(no_flip_op.Compute(input_row, &no_flip_output).IsOk());
+  ASSERT_TRUE(flip_op.Compute(input_row, &flip_output).IsOk());
+  ASSERT_EQ(no_flip_output[0]->shape(), TensorShape({3, target_height, target_width}));
+  ASSERT_EQ(no_flip_output[0]->type(), DataType(DataType::DE_FLOAT32));
+  ASSERT_EQ(flip_output[0]->shape(), no_flip_output[0]->shape());
+  for (dsize_t c = 0; c < 3; ++c) {
+    for (dsize_t y = 0; y < target_height; y += 16) {
+      for (dsize_t x = 0; x < target_width; x += 16) {
+        float flip_value = 0;
+        float no_flip_value = 0;
+        ASSERT_TRUE(flip_output[0]->GetItemAt(&flip_value, {c, y, x}).IsOk());
+        ASSERT_TRUE(no_flip_output[0]->GetItemAt(&no_flip_value, {c, y, target_width - 1 - x}).IsOk());
+        ASSERT_FLOAT_EQ(flip_value, no_flip_value);
+      }
+    }
+  }
+}
@@ -0,0 +1,150 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/datasetops/source/sampler/shuffle_buffer_sampler.h"
+#include "minddata/dataset/engine/opt/pre/shuffle_pushdown_pass.h"
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/include/dataset/samplers.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestShufflePushdownPass : public UT::DatasetOpTesting {
+ public:
+  class DummyRandomAccessOp : public RandomAccessOp {
+   public:
+    explicit DummyRandomAccessOp(int64_t num_rows) { num_rows_ = num_rows; }
+  };
+
+ protected:
+  /// \brief Get all the rows of num_epochs epochs in the form of json strings
+  /// \param[in] tree_adapter The compiled tree
+  /// \param[in] num_epochs The number of epochs to run
+  /// \param[out] rows The rows fetched
+  /// \return Status of the function
+  Status GetRows(const std::shared_ptr<TreeAdapter> &tree_adapter, int32_t num_epochs,
+                 std::vector<std::string> *rows) {
+    for (int32_t epoch = 0; epoch < num_epochs; ++epoch) {
+      TensorRow row;
+      RETURN_IF_NOT_OK(tree_adapter->GetNext(&row));
+      while (!row.empty()) {
+        std::string row_str;
+        for (auto &tensor : row) {
+          nlohmann::json out_json;
+          RETURN_IF_NOT_OK(tensor->to_json(&out_json));
+          row_str += out_json.dump();
+        }
+        rows->push_back(row_str);
+        RETURN_IF_NOT_OK(tree_adapter->GetNext(&row));
+      }
+    }
+    return Status::OK();
+  }
+};
+
+/// Feature: ShuffleBufferSampler
+/// Description: Test the ids of ShuffleBufferSampler against the shuffle buffer algorithm of ShuffleOp
+/// Expectation: The ids are the same as the reference in each epoch, and each id is sampled once in an epoch
+TEST_F(MindDataTestShufflePushdownPass, TestShuffleBufferSampler) {
+  MS_LOG(INFO) << "Doing MindDataTestShufflePushdownPass-TestShuffleBufferSampler.";
+  constexpr int64_t kNumRows = 1000;
+  constexpr int32_t kShuffleSize = 37;
+  constexpr uint32_t kSeed = 5;
+  ShuffleBufferSamplerRT sampler(kShuffleSize, kSeed, true, 100);
+  DummyRandomAccessOp dummy_random_access_op(kNumRows);
+  ASSERT_OK(sampler.HandshakeRandomAccessOp(&dummy_random_access_op));
+
+  // The same algorithm as ShuffleOp, on the ids rather than the rows.
+  std::mt19937_64 rng(kSeed);
+  for (int epoch = 0; epoch < 2; ++epoch) {
+    std::vector<int64_t> buffer;
+    int64_t next_input = 0;
+    while (next_input < kNumRows && buffer.size() < static_cast<size_t>(kShuffleSize)) {
+      buffer.push_back(next_input++);
+    }
+    std::vector<int64_t> expect;
+    int64_t last = static_cast<int64_t>(buffer.size()) - 1;
+    while (last >= 0) {
+      int64_t slot = rng() % (last + 1);
+      expect.push_back(buffer[slot]);
+      buffer[slot] = buffer[last];
+      if (next_input < kNumRows) {
+        buffer[last] = next_input++;
+      } else {
+        last--;
+      }
+    }
+
+    std::vector<int64_t> out;
+    TensorRow row;
+    ASSERT_OK(sampler.GetNextSample(&row));
+    while (!row.eoe()) {
+      for (auto it = row[0]->begin<int64_t>(); it != row[0]->end<int64_t>(); ++it) {
+        out.push_back(*it);
+      }
+      ASSERT_OK(sampler.GetNextSample(&row));
+    }
+    ASSERT_EQ(out, expect);
+    std::vector<int64_t> sorted_out(out);
+    std::sort(sorted_out.begin(), sorted_out.end());
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      ASSERT_EQ(sorted_out[i], i);
+    }
+    ASSERT_OK(sampler.ResetSampler());
+  }
+}
+
+/// Feature: ShufflePushdownPass
+/// Description: Test the shuffle node above ImageFolderDataset is pushed down into its sampler
+/// Expectation: The shuffle node is removed, and the rows are in the same order as the ShuffleOp
+TEST_F(MindDataTestShufflePushdownPass, TestShufflePushdownMappableSource) {
+  MS_LOG(INFO) << "Doing MindDataTestShufflePushdownPass-TestShufflePushdownMappableSource.";
+  uint32_t original_seed = GlobalContext::config_manager()->seed();
+  GlobalContext::config_manager()->set_seed(135);
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  constexpr int32_t kNumEpochs = 2;
+  auto ds = ImageFolder(folder_path, false, std::make_shared<SequentialSampler>(0, 30))->Shuffle(8);
+
+  auto tree_adapter = std::make_shared<TreeAdapter>();
+  tree_adapter->SetOptimize(false);
+  ASSERT_OK(tree_adapter->Compile(ds->IRNode(), kNumEpochs));
+  auto tree_adapter_pushdown = std::make_shared<TreeAdapter>();
+  tree_adapter_pushdown->SetOptimize(true);
+  ASSERT_OK(tree_adapter_pushdown->Compile(ds->IRNode(), kNumEpochs));
+
+  // The shuffle node is pushed down, so the leaf is the only node below the epoch control.
+  auto node = tree_adapter_pushdown->RootIRNode();
+  while (!node->Children().empty()) {
+    ASSERT_EQ(node->Children().size(), 1);
+    node = node->Children()[0];
+    EXPECT_NE(node->Name(), kShuffleNode);
+  }
+  EXPECT_EQ(node->Name(), kImageFolderNode);
+
+  std::vector<std::string> expect;
+  ASSERT_OK(GetRows(tree_adapter, kNumEpochs, &expect));
+  std::vector<std::string> rows;
+  ASSERT_OK(GetRows(tree_adapter_pushdown, kNumEpochs, &rows));
+  EXPECT_EQ(expect.size(), 30 * kNumEpochs);
+  EXPECT_EQ(rows, expect);
+  GlobalContext::config_manager()->set_seed(original_seed);
+}
@@ -19,6 +19,7 @@
 
 #include "minddata/dataset/core/client.h"
 #include "minddata/dataset/engine/data_schema.h"
+#include "minddata/dataset/engine/datasetops/source/tf_example_parser.h"
 #include "minddata/dataset/engine/jagged_connector.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
@@ -378,3 +379,62 @@ TEST_F(MindDataTestTFReaderOp, TestTotalRowsBasic) {
   TFReaderOp::CountTotalRows(&total_rows, filenames, 729, true);
   ASSERT_EQ(total_rows, 60);
 }
+
+namespace {
+// Serialize a length delimited field, the length must be less than 128.
+std::string LengthDelimited(char tag, const std::string &data) {
+  return tag + std::string(1, static_cast<char>(data.size())) + data;
+}
+
+std::string ExampleWithFeatures(const std::vector<std::pair<std::string, std::string>> &features) {
+  std::string entries;
+  for (auto &feature : features) {
+    std::string entry = LengthDelimited('\x0a', feature.first) + LengthDelimited('\x12', feature.second);
+    entries += LengthDelimited('\x0a', entry);
+  }
+  return LengthDelimited('\x0a', entries);
+}
+}  // namespace
+
+/// Feature: TFExampleParser
+/// Description: Test the fast parser with the packed and unpacked lists, the missing and the empty features
+/// Expectation: The values are decoded correctly and the rows to be merged are left to protobuf
+TEST_F(MindDataTestTFReaderOp, TestTFExampleParser) {
+  // int64_list {value: [1, -1, 300]} in packed encoding, -1 takes 10 bytes
+  std::string packed_ints = std::string("\x01", 1) + std::string(9, '\xff') + std::string("\x01\xac\x02", 3);
+  std::string ids = LengthDelimited('\x1a', LengthDelimited('\x0a', packed_ints));
+  // float_list {value: [1.0, 2.0]} in unpacked encoding
+  std::string floats = std::string("\x0d\x00\x00\x80\x3f\x0d\x00\x00\x00\x40", 10);
+  std::string vals = LengthDelimited('\x12', floats);
+  std::string other = LengthDelimited('\x1a', std::string("\x08\x05", 2));
+  std::string example = ExampleWithFeatures({{"other", other}, {"ids", ids}, {"vals", vals}, {"empty", ""}});
+
+  TFExampleParser parser({"vals", "ids", "empty", "missing"});
+  std::vector<TFExampleParser::FeatureView> features;
+  ASSERT_TRUE(parser.Parse(example, &features));
+  ASSERT_EQ(features.size(), 4);
+  ASSERT_EQ(features[0].kind, TFExampleParser::FeatureKind::kFloatList);
+  ASSERT_EQ(features[1].kind, TFExampleParser::FeatureKind::kInt64List);
+  ASSERT_EQ(features[2].kind, TFExampleParser::FeatureKind::kNotSet);
+  ASSERT_EQ(features[3].kind, TFExampleParser::FeatureKind::kNotFound);
+
+  int64_t num_values = 0;
+  ASSERT_TRUE(TFExampleParser::CountInt64List(features[1], &num_values));
+  ASSERT_EQ(num_values, 3);
+  std::vector<int64_t> int_values(num_values);
+  ASSERT_TRUE(TFExampleParser::DecodeInt64List<int64_t>(features[1], int_values.data(), num_values));
+  ASSERT_EQ(int_values, std::vector<int64_t>({1, -1, 300}));
+  std::vector<uint8_t> uint8_values(num_values);
+  ASSERT_TRUE(TFExampleParser::DecodeInt64List<uint8_t>(features[1], uint8_values.data(), num_values));
+  ASSERT_EQ(uint8_values, std::vector<uint8_t>({1, 255, 44}));
+
+  ASSERT_TRUE(TFExampleParser::CountFloatList(features[0], &num_values));
+  ASSERT_EQ(num_values, 2);
+  std::vector<float> float_values(num_values);
+  ASSERT_TRUE(TFExampleParser::DecodeFloatList(features[0], float_values.data(), num_values));
+  ASSERT_EQ(float_values, std::vector<float>({1.0, 2.0}));
+
+  // the list split into two fields needs merging, and the truncated row is malformed
+  ASSERT_FALSE(parser.Parse(ExampleWithFeatures({{"ids", ids + ids}}), &features));
+  ASSERT_FALSE(parser.Parse(example.substr(0, example.size() - 1), &features));
+}
@@ -16,6 +16,8 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include "common/common.h"
 #include "minddata/dataset/text/kernels/basic_tokenizer_op.h"
@@ -26,6 +28,7 @@
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/unicode_script_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 
@@ -382,4 +385,58 @@ std::shared_ptr<Tensor> input;
   TensorRow output;
   Status s = basic_tokenizer->Compute(TensorRow(0, {input}), &output);
   EXPECT_TRUE(s.IsOk());
-}
\ No newline at end of file
+}
+
+namespace {
+void CheckTokens(const TensorRow &output, const std::vector<std::string> &tokens, const std::vector<uint32_t> &starts,
+                 const std::vector<uint32_t> &limits) {
+  ASSERT_EQ(output.size(), 3);
+  ASSERT_EQ(output[0]->Size(), tokens.size());
+  for (dsize_t i = 0; i < static_cast<dsize_t>(tokens.size()); ++i) {
+    std::string_view token;
+    uint32_t start = 0;
+    uint32_t limit = 0;
+    ASSERT_OK(output[0]->GetItemAt(&token, {i}));
+    ASSERT_OK(output[1]->GetItemAt(&start, {i}));
+    ASSERT_OK(output[2]->GetItemAt(&limit, {i}));
+    EXPECT_EQ(std::string(token), tokens[i]);
+    EXPECT_EQ(start, starts[i]);
+    EXPECT_EQ(limit, limits[i]);
+  }
+}
+}  // namespace
+
+/// Feature: BasicTokenizer op
+/// Description: Test the ASCII fast path of BasicTokenizerOp with and without keeping the whitespaces
+/// Expectation: The tokens and offsets are the same as those of the ICU path
+TEST_F(MindDataTestTokenizerOp, TestBasicTokenizerAscii) {
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateScalar<std::string>("Hello, World!\tIt's OK", &input));
+  TensorRow output;
+  BasicTokenizerOp tokenizer(true, false, NormalizeForm::kNone, true, true);
+  ASSERT_OK(tokenizer.Compute(TensorRow(0, {input}), &output));
+  CheckTokens(output, {"hello", ",", "world", "!", "it", "'", "s", "ok"}, {0, 5, 7, 12, 14, 16, 17, 19},
+              {5, 6, 12, 13, 16, 17, 18, 21});
+
+  output.clear();
+  BasicTokenizerOp keep_whitespace_tokenizer(false, true, NormalizeForm::kNfkc, true, true);
+  ASSERT_OK(keep_whitespace_tokenizer.Compute(TensorRow(0, {input}), &output));
+  CheckTokens(output, {"Hello", ",", " ", "World", "!", " ", "It", "'", "s", " ", "OK"},
+              {0, 5, 6, 7, 12, 13, 14, 16, 17, 18, 19}, {5, 6, 7, 12, 13, 14, 16, 17, 18, 19, 21});
+}
+
+/// Feature: WordpieceTokenizer op
+/// Description: Test the greedy longest-match-first lookup of WordpieceTokenizerOp on the vocab trie
+/// Expectation: The longest subwords are found for both ASCII and non-ASCII tokens, and the unknown token otherwise
+TEST_F(MindDataTestTokenizerOp, TestWordpieceTokenizerLookup) {
+  std::shared_ptr<Vocab> vocab;
+  std::unordered_map<WordType, WordIdType> words = {{"un", 0}, {"##a", 1}, {"##aff", 2}, {"##able", 3},
+                                                    {"中", 4}, {"##国", 5}, {"[UNK]", 6}};
+  ASSERT_OK(Vocab::BuildFromUnorderedMap(words, &vocab));
+  WordpieceTokenizerOp tokenizer(vocab, "##", 100, "[UNK]", true);
+  std::shared_ptr<Tensor> input;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"unaffable", "中国", "xyz"}, &input));
+  TensorRow output;
+  ASSERT_OK(tokenizer.Compute(TensorRow(0, {input}), &output));
+  CheckTokens(output, {"un", "##aff", "##able", "中", "##国", "[UNK]"}, {0, 2, 5, 0, 3, 0}, {2, 5, 9, 3, 6, 3});
+}
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/unordered_connector.h"
+#include "minddata/dataset/util/task_manager.h"
+#include "minddata/dataset/util/wait_post.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestUnorderedConnector : public UT::Common {
+ public:
+  MindDataTestUnorderedConnector() = default;
+};
+
+/// Feature: UnorderedConnector
+/// Description: Test the move-only elements pushed and popped by single producer and single consumer
+/// Expectation: The elements are moved out in the pushed order and the connector is empty after reset
+TEST_F(MindDataTestUnorderedConnector, TestSingleProducerConsumer) {
+  UnorderedConnector<std::unique_ptr<uint32_t>> conn(1, 1, 2);
+  ASSERT_EQ(conn.capacity(), 2);
+  for (uint32_t i = 0; i < 2; ++i) {
+    auto el = std::make_unique<uint32_t>(i);
+    ASSERT_TRUE(conn.Push(0, std::move(el)).IsOk());
+    ASSERT_EQ(el, nullptr);
+  }
+  ASSERT_EQ(conn.size(), 2);
+  std::unique_ptr<uint32_t> res;
+  ASSERT_TRUE(conn.Pop(0, &res).IsOk());
+  ASSERT_EQ(*res, 0);
+  ASSERT_EQ(conn.out_rows_count(), 1);
+  conn.Reset();
+  ASSERT_EQ(conn.size(), 0);
+  ASSERT_EQ(conn.out_rows_count(), 0);
+}
+
+/// Feature: UnorderedConnector
+/// Description: Test multiple producers and multiple consumers handing off the move-only elements concurrently
+/// Expectation: Each element is popped exactly once
+TEST_F(MindDataTestUnorderedConnector, TestMultiProducerConsumer) {
+  constexpr int32_t kProducerNum = 4;
+  constexpr int32_t kConsumerNum = 3;
+  constexpr uint32_t kValueNum = 30000;
+  auto tg = std::make_unique<TaskGroup>();
+  WaitPost wp;
+  ASSERT_TRUE(wp.Register(tg.get()).IsOk());
+  auto conn = std::make_shared<UnorderedConnector<std::unique_ptr<uint32_t>>>(kProducerNum, kConsumerNum, 8);
+  ASSERT_TRUE(conn->Register(tg.get()).IsOk());
+  std::vector<std::atomic<int32_t>> popped_counts(kValueNum);
+  std::atomic<uint32_t> popped_num{0};
+
+  for (int32_t i = 0; i < kProducerNum; ++i) {
+    auto push = [conn, i]() -> Status {
+      TaskManager::FindMe()->Post();
+      for (uint32_t value = i; value < kValueNum; value += kProducerNum) {
+        RETURN_IF_NOT_OK(conn->Push(i, std::make_unique<uint32_t>(value)));
+      }
+      return Status::OK();
+    };
+    ASSERT_TRUE(tg->CreateAsyncTask("Unordered Push", push).IsOk());
+  }
+  for (int32_t i = 0; i < kConsumerNum; ++i) {
+    auto pop = [conn, i, &popped_counts, &popped_num, &wp]() -> Status {
+      TaskManager::FindMe()->Post();
+      while (true) {
+        std::unique_ptr<uint32_t> res;
+        RETURN_IF_NOT_OK(conn->Pop(i, &res));
+        ++popped_counts[*res];
+        if (++popped_num == kValueNum) {
+          wp.Set();
+        }
+      }
+    };
+    ASSERT_TRUE(tg->CreateAsyncTask("Unordered Pop", pop).IsOk());
+  }
+  ASSERT_TRUE(wp.Wait().IsOk());
+  tg->interrupt_all();
+  tg->join_all(Task::WaitFlag::kNonBlocking);
+  ASSERT_EQ(conn->out_rows_count(), kValueNum);
+  for (uint32_t value = 0; value < kValueNum; ++value) {
+    ASSERT_EQ(popped_counts[value].load(), 1);
+  }
+  ASSERT_TRUE(TaskManager::GetMasterThreadRc().IsOk());
+}
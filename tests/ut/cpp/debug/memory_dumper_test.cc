@@ -16,6 +16,8 @@
 #include <fcntl.h>
 #include <iostream>
 #include <memory>
+#include <vector>
+#include <algorithm>
 #include "common/common_test.h"
 #include "utils/system/file_system.h"
 #include "utils/system/env.h"
@@ -109,4 +111,39 @@ TEST_F(TestMemoryDumper, test_DumpToFileNotExistDir) {
 
   ASSERT_EQ(ret, true);
 }
+
+/// Feature: Dump with the background writer.
+/// Description: Dump the data with env MS_DUMP_ASYNC_WRITE and modify the source data after DumpToFile returns.
+/// Expectation: The dump file has the data when DumpToFile is called after waiting for the writer.
+TEST_F(TestMemoryDumper, test_DumpToFileAsync) {
+  int len = 1000;
+  std::vector<int> data(len, 0);
+  for (int i = 0; i < len; i++) {
+    data[i] = i % 10;
+  }
+  std::vector<int> expect_data = data;
+
+  (void)setenv("MS_DUMP_ASYNC_WRITE", "1", 1);
+  const std::string filename = "/tmp/dumpToFileAsyncTestFile";
+  bool ret = DumpJsonParser::DumpToFile(filename, data.data(), len * sizeof(int), ShapeVector{10, 100},
+                                        kNumberTypeInt32);
+  (void)unsetenv("MS_DUMP_ASYNC_WRITE");
+  ASSERT_EQ(ret, true);
+  std::fill(data.begin(), data.end(), -1);
+  DumpJsonParser::WaitDumpFilesWritten();
+
+  int fd = open((filename + ".npy").c_str(), O_RDONLY);
+  int header_size = 32;
+  std::vector<int> read_back(len + header_size, 0);
+  int read_size = read(fd, read_back.data(), read_back.size() * sizeof(int));
+  (void)close(fd);
+  ASSERT_EQ(read_size, read_back.size() * sizeof(int));
+  for (int i = 0; i < len; i++) {
+    ASSERT_EQ(read_back[i + header_size], expect_data[i]);
+  }
+  std::shared_ptr<system::FileSystem> fs = system::Env::GetFileSystem();
+  if (fs->FileExist(filename + ".npy")) {
+    fs->DeleteFile(filename + ".npy");
+  }
+}
 }  // namespace mindspore
@@ -0,0 +1,89 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "common/common_test.h"
+#include "debug/debugger/tensor_summary.h"
+
+namespace mindspore {
+namespace {
+// More than one chunk of the multi-threaded statistics, 10000 elements per chunk at least.
+constexpr size_t kMultiChunkElementNum = 35000;
+constexpr double kMeanTolerance = 1e-9;
+}  // namespace
+
+class TestTensorSummary : public UT::Common {
+ public:
+  TestTensorSummary() {}
+};
+
+/// Feature: TensorSummary statistics
+/// Description: Calculate the statistics of a float tensor split into several chunks, whose values grow from chunk to
+/// chunk and whose last chunk has nan and inf
+/// Expectation: The mean is the mean of all the finite values, and the nan and inf are counted
+TEST_F(TestTensorSummary, test_multi_chunk_float_mean) {
+  std::vector<float> data(kMultiChunkElementNum);
+  double sum = 0.0;
+  uint64_t value_num = 0;
+  uint64_t nan_num = 0;
+  uint64_t inf_num = 0;
+  for (size_t i = 0; i < data.size(); ++i) {
+    if (i > kMultiChunkElementNum / 4 * 3 && i % 3 == 0) {
+      data[i] = std::numeric_limits<float>::quiet_NaN();
+      ++nan_num;
+    } else if (i > kMultiChunkElementNum / 4 * 3 && i % 5 == 0) {
+      data[i] = std::numeric_limits<float>::infinity();
+      ++inf_num;
+    } else {
+      data[i] = static_cast<float>(i / 1000) - 10.0f;
+      sum += static_cast<double>(data[i]);
+      ++value_num;
+    }
+  }
+  TensorSummary<float> summary(data.data(), nullptr, data.size(), 0);
+  summary.TensorStatistics(DT_FLOAT32);
+  EXPECT_EQ(summary.count(), kMultiChunkElementNum);
+  EXPECT_EQ(summary.nan_count(), nan_num);
+  EXPECT_EQ(summary.pos_inf_count(), inf_num);
+  EXPECT_EQ(summary.neg_inf_count(), 0);
+  EXPECT_EQ(summary.min_value(), -10.0);
+  EXPECT_EQ(summary.max_value(), static_cast<double>((kMultiChunkElementNum - 1) / 1000) - 10.0);
+  double expect_mean = sum / value_num;
+  EXPECT_NEAR(summary.avg_value(), expect_mean, std::abs(expect_mean) * kMeanTolerance);
+}
+
+/// Feature: TensorSummary statistics
+/// Description: Calculate the statistics of an int32 tensor split into several chunks
+/// Expectation: The mean is the mean of all the elements, and the zeros are counted
+TEST_F(TestTensorSummary, test_multi_chunk_int_mean) {
+  std::vector<int32_t> data(kMultiChunkElementNum);
+  double sum = 0.0;
+  uint64_t zero_num = 0;
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int32_t>(i % 100) * static_cast<int32_t>(i / 5000);
+    sum += static_cast<double>(data[i]);
+    zero_num += data[i] == 0 ? 1 : 0;
+  }
+  TensorSummary<int32_t> summary(data.data(), nullptr, data.size(), 0);
+  summary.TensorStatistics(DT_INT32);
+  EXPECT_EQ(summary.count(), kMultiChunkElementNum);
+  EXPECT_EQ(summary.nan_count(), 0);
+  EXPECT_EQ(summary.zero_count(), zero_num);
+  double expect_mean = sum / kMultiChunkElementNum;
+  EXPECT_NEAR(summary.avg_value(), expect_mean, std::abs(expect_mean) * kMeanTolerance);
+}
+}  // namespace mindspore
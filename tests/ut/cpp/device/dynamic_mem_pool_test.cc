@@ -0,0 +1,277 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include <thread>
+#include "common/common_test.h"
+#include "common/mem_reuse/mem_dynamic_allocator.h"
+
+namespace mindspore::device {
+constexpr size_t kTestUnitSize = 16 << 20;
+constexpr size_t kHostMemPoolSize = kTestUnitSize;
+
+class HostMemPoolStub : public DynamicMemPoolBestFit {
+ public:
+  explicit HostMemPoolStub(size_t pool_size = kHostMemPoolSize) : pool_size_(pool_size) {
+    host_mem_.resize(pool_size_, 0);
+  }
+  ~HostMemPoolStub() override = default;
+
+  size_t AllocDeviceMem(size_t size, DeviceMemPtr *addr) override {
+    if (used_size_ + size > pool_size_) {
+      return 0;
+    }
+    *addr = host_mem_.data() + used_size_;
+    used_size_ += size;
+    return size;
+  }
+  bool FreeDeviceMem(const DeviceMemPtr &addr) override { return true; }
+  size_t free_mem_size() override { return pool_size_ - used_size_; }
+
+ private:
+  size_t pool_size_;
+  std::vector<uint8_t> host_mem_;
+  size_t used_size_{0};
+};
+
+class ExpandableMemPoolStub : public HostMemPoolStub {
+ public:
+  explicit ExpandableMemPoolStub(size_t pool_size = kHostMemPoolSize) : HostMemPoolStub(pool_size) {}
+  ~ExpandableMemPoolStub() override = default;
+
+ protected:
+  bool IsExpandableSegment() const override { return true; }
+};
+
+class TestDynamicMemPool : public UT::Common {
+ public:
+  TestDynamicMemPool() {}
+};
+
+/// Feature: DynamicMemPoolBestFit size class
+/// Description: Test the mapping between the size and the size class
+/// Expectation: The size class covers the size and the waste is within 25%
+TEST_F(TestDynamicMemPool, test_size_class_index) {
+  ASSERT_EQ(DynamicMemPoolBestFit::SizeClassIndex(0), DynamicMemPoolBestFit::kSizeClassInvalidIndex);
+  ASSERT_EQ(DynamicMemPoolBestFit::SizeClassIndex(DYNAMIC_MEM_SIZE_CLASS_MAX_SIZE + DYNAMIC_MEM_ALIGN_SIZE),
+            DynamicMemPoolBestFit::kSizeClassInvalidIndex);
+  size_t last_index = 0;
+  for (size_t size = DYNAMIC_MEM_ALIGN_SIZE; size <= DYNAMIC_MEM_SIZE_CLASS_MAX_SIZE; size += DYNAMIC_MEM_ALIGN_SIZE) {
+    auto index = DynamicMemPoolBestFit::SizeClassIndex(size);
+    ASSERT_NE(index, DynamicMemPoolBestFit::kSizeClassInvalidIndex);
+    ASSERT_GE(index, last_index);
+    auto class_size = DynamicMemPoolBestFit::SizeClassSize(index);
+    ASSERT_GE(class_size, size);
+    ASSERT_LE(class_size - size, size / 4);
+    ASSERT_EQ(DynamicMemPoolBestFit::SizeClassIndex(class_size), index);
+    last_index = index;
+  }
+}
+
+/// Feature: DynamicMemPoolBestFit size class
+/// Description: Test the memory reuse from the size class free list
+/// Expectation: The freed memory is reused by the same size class and released when the idle memory is not enough
+TEST_F(TestDynamicMemPool, test_size_class_alloc_free) {
+  HostMemPoolStub mem_pool;
+  mem_pool.SetMemAllocUintSize(kTestUnitSize, kTestUnitSize);
+  mem_pool.set_enable_size_class(true);
+  auto addr1 = mem_pool.AllocTensorMem(3000);
+  ASSERT_NE(addr1, nullptr);
+  mem_pool.FreeTensorMem(addr1);
+  ASSERT_EQ(mem_pool.TotalCachedMemStatistics(), DynamicMemPoolBestFit::SizeClassSize(
+                                                   DynamicMemPoolBestFit::SizeClassIndex(3072)));
+  auto addr2 = mem_pool.AllocTensorMem(2600);
+  ASSERT_EQ(addr1, addr2);
+  ASSERT_EQ(mem_pool.TotalCachedMemStatistics(), 0);
+  mem_pool.FreeTensorMem(addr2);
+
+  // The whole block is required, the cached memory buf must be combined firstly.
+  auto addr3 = mem_pool.AllocTensorMem(kTestUnitSize);
+  ASSERT_NE(addr3, nullptr);
+  ASSERT_EQ(mem_pool.TotalCachedMemStatistics(), 0);
+  mem_pool.FreeTensorMem(addr3);
+  ASSERT_EQ(mem_pool.TotalUsedMemStatistics(), 0);
+  mem_pool.ReleaseDeviceRes();
+}
+
+/// Feature: DynamicMemPoolBestFit thread cache
+/// Description: Test the memory alloc and free from the thread caches of different threads
+/// Expectation: The memory is reused in the owner thread cache and reconciled to the memory pool
+TEST_F(TestDynamicMemPool, test_thread_cache_alloc_free) {
+  HostMemPoolStub mem_pool;
+  mem_pool.SetMemAllocUintSize(kTestUnitSize, kTestUnitSize);
+  mem_pool.set_enable_thread_cache(true);
+  auto addr1 = mem_pool.AllocTensorMem(1024);
+  ASSERT_NE(addr1, nullptr);
+  mem_pool.FreeTensorMem(addr1);
+  ASSERT_EQ(mem_pool.TotalThreadCachedMemStatistics(), 1024);
+  auto addr2 = mem_pool.AllocTensorMem(1000);
+  ASSERT_EQ(addr1, addr2);
+
+  // The memory freed by other thread is collected to the owner thread cache.
+  DeviceMemPtr addr3 = nullptr;
+  std::thread alloc_thread([&mem_pool, &addr3]() { addr3 = mem_pool.AllocTensorMem(1024); });
+  alloc_thread.join();
+  ASSERT_NE(addr3, nullptr);
+  ASSERT_NE(addr3, addr2);
+  mem_pool.FreeTensorMem(addr3);
+  mem_pool.FreeTensorMem(addr2);
+  ASSERT_EQ(mem_pool.TotalThreadCachedMemStatistics(), 2048);
+  ASSERT_EQ(mem_pool.TotalUsedMemStatistics(), 2048);
+
+  mem_pool.ReconcileThreadCaches();
+  ASSERT_EQ(mem_pool.TotalThreadCachedMemStatistics(), 0);
+  ASSERT_EQ(mem_pool.TotalUsedMemStatistics(), 0);
+  mem_pool.ReleaseDeviceRes();
+}
+
+/// Feature: DynamicMemPoolBestFit thread cache statistics
+/// Description: Test the allocator type of the memory reused from the thread cache and freed by other thread
+/// Expectation: The statistics and the free event use the allocator type of the memory user, and hits are counted
+TEST_F(TestDynamicMemPool, test_thread_cache_stats) {
+  HostMemPoolStub mem_pool;
+  mem_pool.SetMemAllocUintSize(kTestUnitSize, kTestUnitSize);
+  mem_pool.set_enable_thread_cache(true);
+  mem_pool.EnableMemEventTimeline(1);
+  constexpr auto kWeight = static_cast<int>(AllocatorType::kWeight);
+  constexpr auto kKernelOutput = static_cast<int>(AllocatorType::kKernelOutput);
+  DynamicMemAllocatorDebugInfo::SetDebugInfo("weight", AllocatorType::kWeight);
+  auto addr1 = mem_pool.AllocTensorMem(1024);
+  ASSERT_NE(addr1, nullptr);
+  mem_pool.FreeTensorMem(addr1);
+  auto stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.used_mem_size_by_type_[kWeight], 0);
+  ASSERT_EQ(stats.thread_cached_mem_size_, 1024);
+
+  // The cached memory is reused by the kernel output.
+  DynamicMemAllocatorDebugInfo::SetDebugInfo("output", AllocatorType::kKernelOutput);
+  auto addr2 = mem_pool.AllocTensorMem(1024);
+  ASSERT_EQ(addr2, addr1);
+  stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.used_mem_size_by_type_[kWeight], 0);
+  ASSERT_EQ(stats.used_mem_size_by_type_[kKernelOutput], 1024);
+  ASSERT_EQ(stats.thread_cached_mem_size_, 0);
+  ASSERT_EQ(stats.thread_cache_hit_count_, 1);
+  ASSERT_EQ(stats.thread_cache_miss_count_, 1);
+
+  // The memory is freed by other thread whose allocator type is different.
+  std::thread free_thread([&mem_pool, addr2]() {
+    DynamicMemAllocatorDebugInfo::SetDebugInfo("other", AllocatorType::kOther);
+    mem_pool.FreeTensorMem(addr2);
+  });
+  free_thread.join();
+  auto events = mem_pool.GetMemEventTimeline();
+  ASSERT_EQ(events.size(), 1);
+  ASSERT_FALSE(events[0].is_alloc_);
+  ASSERT_EQ(events[0].allocator_type_, AllocatorType::kKernelOutput);
+  stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.used_mem_size_by_type_[kKernelOutput], 0);
+
+  mem_pool.ReconcileThreadCaches();
+  stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.total_used_mem_size_, 0);
+  for (int i = 0; i < ALLOCATOR_TYPE_NUM; ++i) {
+    ASSERT_EQ(stats.used_mem_size_by_type_[i], 0);
+  }
+  mem_pool.ReleaseDeviceRes();
+}
+
+/// Feature: DynamicMemPoolBestFit statistics
+/// Description: Test the statistics snapshot and the event timeline of memory pool
+/// Expectation: The fragmentation, peak size of allocator type and events are recorded correctly
+TEST_F(TestDynamicMemPool, test_mem_pool_stats) {
+  HostMemPoolStub mem_pool;
+  mem_pool.SetMemAllocUintSize(kTestUnitSize, kTestUnitSize);
+  mem_pool.EnableMemEventTimeline(2);
+  DynamicMemAllocatorDebugInfo::SetDebugInfo("weight", AllocatorType::kWeight);
+  auto addr1 = mem_pool.AllocTensorMem(kTestUnitSize / 2);
+  DynamicMemAllocatorDebugInfo::SetDebugInfo("output", AllocatorType::kKernelOutput);
+  auto addr2 = mem_pool.AllocTensorMem(kTestUnitSize / 4);
+  ASSERT_NE(addr1, nullptr);
+  ASSERT_NE(addr2, nullptr);
+  mem_pool.FreeTensorMem(addr1);
+
+  auto stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.total_mem_size_, kTestUnitSize);
+  ASSERT_EQ(stats.total_used_mem_size_, kTestUnitSize / 4);
+  ASSERT_EQ(stats.total_idle_mem_size_, kTestUnitSize / 4 * 3);
+  ASSERT_EQ(stats.largest_idle_mem_buf_size_, kTestUnitSize / 2);
+  ASSERT_EQ(stats.idle_mem_buf_count_, 2);
+  ASSERT_GT(stats.fragmentation_ratio_, 0.3f);
+  ASSERT_EQ(stats.used_mem_size_by_type_[static_cast<int>(AllocatorType::kWeight)], 0);
+  ASSERT_EQ(stats.used_mem_peak_size_by_type_[static_cast<int>(AllocatorType::kWeight)], kTestUnitSize / 2);
+  ASSERT_EQ(stats.used_mem_size_by_type_[static_cast<int>(AllocatorType::kKernelOutput)], kTestUnitSize / 4);
+
+  // The capacity of timeline is 2, so only the latest alloc and free event are kept.
+  auto events = mem_pool.GetMemEventTimeline();
+  ASSERT_EQ(events.size(), 2);
+  ASSERT_TRUE(events[0].is_alloc_);
+  ASSERT_EQ(events[0].device_addr_, addr2);
+  ASSERT_FALSE(events[1].is_alloc_);
+  ASSERT_EQ(events[1].device_addr_, addr1);
+  ASSERT_EQ(events[1].size_, kTestUnitSize / 2);
+  ASSERT_EQ(events[1].total_used_mem_size_, kTestUnitSize / 4);
+  mem_pool.FreeTensorMem(addr2);
+  mem_pool.ReleaseDeviceRes();
+}
+
+/// Feature: DynamicMemPoolBestFit expandable memory block
+/// Description: Test the memory block is expanded by the contiguous device memory
+/// Expectation: Only one memory block is created and the tail idle memory is combined with the new device memory
+TEST_F(TestDynamicMemPool, test_expand_mem_block) {
+  constexpr size_t kSmallUnitSize = kTestUnitSize / 4;
+  ExpandableMemPoolStub mem_pool(kTestUnitSize * 2);
+  mem_pool.SetMemAllocUintSize(kSmallUnitSize, kSmallUnitSize);
+  auto addr1 = mem_pool.AllocTensorMem(kSmallUnitSize / 4 * 3);
+  auto addr2 = mem_pool.AllocTensorMem(kSmallUnitSize / 4 * 3);
+  ASSERT_NE(addr1, nullptr);
+  ASSERT_EQ(static_cast<uint8_t *>(addr2), static_cast<uint8_t *>(addr1) + kSmallUnitSize / 4 * 3);
+  auto addr3 = mem_pool.AllocTensorMem(kSmallUnitSize / 2 * 3);
+  ASSERT_NE(addr3, nullptr);
+  auto stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.mem_block_count_, 1);
+  ASSERT_EQ(stats.total_mem_size_, kTestUnitSize);
+  mem_pool.FreeTensorMem(addr1);
+  mem_pool.FreeTensorMem(addr2);
+  mem_pool.FreeTensorMem(addr3);
+  stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.idle_mem_buf_count_, 1);
+  ASSERT_EQ(stats.largest_idle_mem_buf_size_, kTestUnitSize);
+  mem_pool.ReleaseDeviceRes();
+}
+
+/// Feature: DynamicMemPoolBestFit expandable memory block
+/// Description: Test the contiguous device memory of the pool without expandable segment
+/// Expectation: The memory blocks are kept separate and the idle memory bufs aren't combined across blocks
+TEST_F(TestDynamicMemPool, test_separate_mem_block) {
+  constexpr size_t kSmallUnitSize = kTestUnitSize / 4;
+  HostMemPoolStub mem_pool(kTestUnitSize * 2);
+  mem_pool.SetMemAllocUintSize(kSmallUnitSize, kSmallUnitSize);
+  auto addr1 = mem_pool.AllocTensorMem(kSmallUnitSize / 4 * 3);
+  auto addr2 = mem_pool.AllocTensorMem(kSmallUnitSize / 4 * 3);
+  ASSERT_NE(addr1, nullptr);
+  ASSERT_EQ(static_cast<uint8_t *>(addr2), static_cast<uint8_t *>(addr1) + kSmallUnitSize);
+  auto stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.mem_block_count_, 2);
+  ASSERT_EQ(stats.total_mem_size_, kSmallUnitSize * 2);
+  mem_pool.FreeTensorMem(addr1);
+  mem_pool.FreeTensorMem(addr2);
+  stats = mem_pool.GetMemPoolStats();
+  ASSERT_EQ(stats.idle_mem_buf_count_, 2);
+  ASSERT_EQ(stats.largest_idle_mem_buf_size_, kSmallUnitSize);
+  mem_pool.ReleaseDeviceRes();
+}
+}  // namespace mindspore::device
@@ -77,6 +77,17 @@ class MemoryManagerStub : public MemoryManager {
   std::map<void *, size_t> device_mem_size_;
 };
 
+class MemoryCopyManagerStub : public MemoryManagerStub {
+ public:
+  void SwapIn(const void *host_ptr, void *device_ptr, size_t mem_size, void *stream) override {
+    (void)memcpy_s(device_ptr, mem_size, host_ptr, mem_size);
+  }
+
+  void SwapOut(const void *device_ptr, void *host_ptr, size_t mem_size, void *stream) override {
+    (void)memcpy_s(host_ptr, mem_size, device_ptr, mem_size);
+  }
+};
+
 class TestMemScheduler : public UT::Common {
  public:
   TestMemScheduler() {}
@@ -183,6 +194,73 @@ TEST_F(TestMemScheduler, test_mem_scheduler) {
   Run(scheduler);
 }
 
+/// Feature: MemScheduler profile-guided strategy
+/// Description: Test the strategy is updated by the compute time and swap bandwidth profiled in several iterations
+/// Expectation: MemScheduler GetOrMalloc return valid ptr before and after the strategy updated
+TEST_F(TestMemScheduler, test_profiled_mem_scheduler) {
+  (void)setenv("MS_DEV_MEM_OFFLOAD_PROFILE_STEPS", "2", 1);
+  MemSchedulerManager mem_scheduler_manager;
+  auto scheduler = mem_scheduler_manager.GetOrCreateMemScheduler(0);
+  ASSERT_NE(scheduler, nullptr);
+  std::shared_ptr<MemHandler> mem_handler = std::make_shared<MemHandler>(std::make_shared<MemoryManagerStub>());
+  scheduler->SetMemHandler(mem_handler);
+
+  used_tensor_num_ = 10;
+  total_step_ = 8;
+  std::vector<uint8_t> tensor_keys(used_tensor_num_, 0);
+  std::vector<uint8_t> tensor_datas(used_tensor_num_, 0);
+  std::vector<size_t> init_tensors = {0, 2, 4};
+  std::vector<std::vector<size_t>> step_used_tensors = {{0, 1},    {1, 2, 3}, {3, 4, 5}, {5, 6},
+                                                        {4, 6, 7}, {3, 7, 8}, {2, 8, 9}, {1, 9}};
+  tensor_keys_.swap(tensor_keys);
+  tensor_datas_.swap(tensor_datas);
+  init_tensors_.swap(init_tensors);
+  step_used_tensors_.swap(step_used_tensors);
+  scheduler->SetTotalStep(total_step_);
+
+  Record(scheduler);
+  ASSERT_TRUE(scheduler->Optimize());
+  // The first iteration starts the profiling, the next two iterations are profiled and the strategy is updated in the
+  // fourth iteration.
+  constexpr size_t kRunIterationNum = 5;
+  for (size_t i = 0; i < kRunIterationNum; ++i) {
+    Run(scheduler);
+  }
+  (void)unsetenv("MS_DEV_MEM_OFFLOAD_PROFILE_STEPS");
+}
+
+/// Feature: AutoMemoryOffload disk tier
+/// Description: Test the swap host memory is spilled to disk when the host memory limit is exceeded
+/// Expectation: The data is the same after swapped out to host and disk and swapped in again
+TEST_F(TestMemScheduler, test_disk_offload) {
+  (void)setenv("MS_DEV_MEM_OFFLOAD_DISK_PATH", "/tmp", 1);
+  (void)setenv("MS_DEV_MEM_OFFLOAD_HOST_MEM_SIZE", "0", 1);
+  std::shared_ptr<MemHandler> mem_handler = std::make_shared<MemHandler>(std::make_shared<MemoryCopyManagerStub>());
+  AutoMemoryOffload auto_mem_offload(mem_handler);
+  (void)unsetenv("MS_DEV_MEM_OFFLOAD_DISK_PATH");
+  (void)unsetenv("MS_DEV_MEM_OFFLOAD_HOST_MEM_SIZE");
+
+  constexpr size_t kKeyNum = 3;
+  std::vector<uint8_t> keys(kKeyNum, 0);
+  // A fake stream to enable the swap in of Get.
+  uint8_t stream = 0;
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    auto device_ptr = static_cast<uint8_t *>(auto_mem_offload.Malloc(keys.data() + i, 1, &stream, {}));
+    ASSERT_NE(device_ptr, nullptr);
+    *device_ptr = static_cast<uint8_t>(i + 1);
+    ASSERT_NE(auto_mem_offload.SwapOut(keys.data() + i, &stream), nullptr);
+    auto_mem_offload.Free(keys.data() + i);
+  }
+  auto_mem_offload.PrefetchFromDisk(keys.data());
+  for (size_t i = 0; i < kKeyNum; ++i) {
+    auto device_ptr = static_cast<uint8_t *>(auto_mem_offload.Get(keys.data() + i, &stream));
+    ASSERT_NE(device_ptr, nullptr);
+    ASSERT_EQ(*device_ptr, i + 1);
+    auto_mem_offload.Free(keys.data() + i);
+  }
+  auto_mem_offload.Clear();
+}
+
 /// Feature: MemScheduler
 /// Description: Test MemScheduler interface
 /// Expectation: MemScheduler GetOrMalloc return valid ptr
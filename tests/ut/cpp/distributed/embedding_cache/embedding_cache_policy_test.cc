@@ -0,0 +1,148 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <vector>
+#include "common/common_test.h"
+#include "distributed/embedding_cache/embedding_cache_policy.h"
+#include "distributed/embedding_cache/embedding_hash_map.h"
+
+namespace mindspore {
+namespace distributed {
+class TestEmbeddingCachePolicy : public UT::Common {
+ public:
+  TestEmbeddingCachePolicy() = default;
+  virtual ~TestEmbeddingCachePolicy() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+namespace {
+const auto kAllEvictable = [](int) { return true; };
+}  // namespace
+
+/// Feature: LRUCachePolicy
+/// Description: Test the least recently accessed position is evicted
+/// Expectation: The positions are evicted in the order of last access, and nothing is evicted if it is not evictable
+TEST_F(TestEmbeddingCachePolicy, test_lru_policy) {
+  LRUCachePolicy policy(0, 4);
+  for (int index = 0; index < 4; ++index) {
+    policy.Insert(index + 10, index);
+  }
+  policy.Access(0);
+  ASSERT_EQ(policy.Evict(20, [](int index) { return index != 1; }), INVALID_INDEX_VALUE);
+  ASSERT_EQ(policy.Evict(20, kAllEvictable), 1);
+  ASSERT_EQ(policy.Evict(21, kAllEvictable), 2);
+  policy.Insert(20, 1);
+  ASSERT_EQ(policy.Evict(22, kAllEvictable), 3);
+  ASSERT_EQ(policy.Evict(23, kAllEvictable), 0);
+  ASSERT_EQ(policy.Evict(24, kAllEvictable), 1);
+  ASSERT_EQ(policy.Evict(25, kAllEvictable), INVALID_INDEX_VALUE);
+}
+
+/// Feature: LFUCachePolicy
+/// Description: Test the least frequently accessed position is evicted
+/// Expectation: The positions are evicted in the order of access frequency, and the least recently accessed one of
+/// the same frequency is evicted firstly
+TEST_F(TestEmbeddingCachePolicy, test_lfu_policy) {
+  LFUCachePolicy policy(4, 8);
+  for (int index = 4; index < 8; ++index) {
+    policy.Insert(index, index);
+  }
+  policy.Access(6);
+  policy.Access(6);
+  policy.Access(4);
+  ASSERT_EQ(policy.Evict(20, kAllEvictable), 5);
+  ASSERT_EQ(policy.Evict(21, kAllEvictable), 7);
+  // The position of frequency 2 is not evictable, so the position of higher frequency is evicted.
+  ASSERT_EQ(policy.Evict(22, [](int index) { return index != 4; }), 6);
+  ASSERT_EQ(policy.Evict(23, kAllEvictable), 4);
+  ASSERT_EQ(policy.Evict(24, kAllEvictable), INVALID_INDEX_VALUE);
+}
+
+/// Feature: ARCCachePolicy
+/// Description: Test the position is evicted from the recent or frequent list by the adaptive target size
+/// Expectation: The id hit in the history is inserted to the frequent list, and the eviction follows the target size
+TEST_F(TestEmbeddingCachePolicy, test_arc_policy) {
+  ARCCachePolicy policy(0, 2);
+  policy.Insert(1, 0);
+  policy.Insert(2, 1);
+  // Both positions are in the recent list and the target size of recent list is 0.
+  ASSERT_EQ(policy.Evict(3, kAllEvictable), 0);
+  policy.Insert(3, 0);
+  ASSERT_EQ(policy.Evict(1, kAllEvictable), 1);
+  // The id 1 is hit in the recent history, so it is inserted to the frequent list and the target size becomes 1.
+  policy.Insert(1, 1);
+  ASSERT_EQ(policy.Evict(4, kAllEvictable), 1);
+  policy.Insert(4, 1);
+  ASSERT_EQ(policy.Evict(5, kAllEvictable), 0);
+  // The frequent list is preferred as the recent list reaches the target size, and the recent list is tried when the
+  // frequent list has no evictable position.
+  policy.Insert(5, 0);
+  policy.Access(1);
+  ASSERT_EQ(policy.Evict(6, [](int index) { return index != 1; }), 0);
+}
+
+/// Feature: EmbeddingHashMap with eviction policy
+/// Description: Test the hash map swaps out the expired ids by the LRU policy
+/// Expectation: The empty positions are used firstly, and then the least recently accessed expired id is swapped out
+TEST_F(TestEmbeddingCachePolicy, test_hash_map_with_lru_policy) {
+  // The front and back positions are reserved.
+  constexpr size_t kCapacity = 6;
+  EmbeddingHashMap hash_map(0, kCapacity, 1, EmbeddingCachePolicyType::kLRU);
+  ASSERT_EQ(hash_map.policy_type(), EmbeddingCachePolicyType::kLRU);
+  std::vector<int> swap_out_index(kCapacity);
+  std::vector<int64_t> swap_out_ids(kCapacity);
+  size_t swap_out_size = 0;
+  bool need_wait_graph = false;
+
+  std::vector<int64_t> ids = {10, 11, 12, 13};
+  std::vector<int> hash_indices(ids.size());
+  size_t data_step = 1;
+  size_t graph_running_step = 0;
+  ASSERT_EQ(hash_map.ParseData(ids.data(), ids.size(), hash_indices.data(), swap_out_index.data(),
+                               swap_out_ids.data(), data_step, graph_running_step, &swap_out_size, &need_wait_graph),
+            ids.size());
+  ASSERT_EQ(swap_out_size, 0);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    ASSERT_EQ(hash_indices[i], SizeToInt(i + 1));
+  }
+
+  // The id 10 is hit in step 2, so the id 11 is the least recently accessed one.
+  hash_map.Reset();
+  data_step = 2;
+  graph_running_step = 2;
+  hash_map.set_hash_step(hash_indices[0], data_step);
+  hash_map.RecordAccess(hash_indices[0]);
+  auto index = hash_map.ParseData(20, swap_out_index.data(), swap_out_ids.data(), data_step, graph_running_step,
+                                  &swap_out_size, &need_wait_graph);
+  ASSERT_EQ(index, hash_indices[1]);
+  ASSERT_EQ(swap_out_size, 1);
+  ASSERT_EQ(swap_out_ids[0], 11);
+  ASSERT_EQ(hash_map.GetIndex(11), INVALID_INDEX_VALUE);
+  ASSERT_EQ(hash_map.GetIndex(20), index);
+  ASSERT_FALSE(need_wait_graph);
+
+  // The ids of the running step can be swapped out only after the graph completed.
+  graph_running_step = 1;
+  index = hash_map.ParseData(21, swap_out_index.data(), swap_out_ids.data(), data_step, graph_running_step,
+                             &swap_out_size, &need_wait_graph);
+  ASSERT_EQ(index, hash_indices[2]);
+  ASSERT_EQ(swap_out_ids[1], 12);
+  ASSERT_TRUE(need_wait_graph);
+}
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,215 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "distributed/embedding_cache/embedding_hash_map.h"
+
+namespace mindspore {
+namespace distributed {
+class TestEmbeddingHashMap : public UT::Common {
+ public:
+  TestEmbeddingHashMap() = default;
+  virtual ~TestEmbeddingHashMap() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: EmbeddingIdIndexMap
+/// Description: Test the insert, find, erase and rehash of the open addressing id -> index map
+/// Expectation: The mappings are found after insertion and not found after erasing, and rehash keeps the mappings
+TEST_F(TestEmbeddingHashMap, test_id_index_map) {
+  constexpr int kIdNum = 1000;
+  EmbeddingIdIndexMap id_index_map(kIdNum);
+  for (int id = 0; id < kIdNum; ++id) {
+    ASSERT_TRUE(id_index_map.Insert(id * 7, id));
+  }
+  ASSERT_EQ(id_index_map.size(), kIdNum);
+  ASSERT_TRUE(id_index_map.Insert(7, 100));
+  ASSERT_EQ(id_index_map.size(), kIdNum);
+  ASSERT_EQ(id_index_map.Find(7), 100);
+  ASSERT_EQ(id_index_map.Find(8), INVALID_INDEX_VALUE);
+
+  for (int id = 0; id < kIdNum; id += 2) {
+    ASSERT_TRUE(id_index_map.Erase(id * 7));
+  }
+  ASSERT_FALSE(id_index_map.Erase(0));
+  ASSERT_EQ(id_index_map.size(), kIdNum / 2);
+  ASSERT_EQ(id_index_map.deleted_num(), kIdNum / 2);
+  id_index_map.Rehash();
+  ASSERT_EQ(id_index_map.deleted_num(), 0);
+
+  std::vector<int64_t> ids = {0, 7, 14, 21, 1};
+  std::vector<int> indices(ids.size());
+  id_index_map.Find(ids.data(), ids.size(), indices.data());
+  std::vector<int> expect_indices = {INVALID_INDEX_VALUE, 100, INVALID_INDEX_VALUE, 3, INVALID_INDEX_VALUE};
+  ASSERT_EQ(indices, expect_indices);
+
+  size_t count = 0;
+  id_index_map.ForEach([&count](int64_t id, int index) {
+    EXPECT_EQ(id % 14, 7);
+    ++count;
+  });
+  ASSERT_EQ(count, kIdNum / 2);
+
+  // The ids exceed the range of int32.
+  constexpr int64_t kLargeId = (static_cast<int64_t>(1) << 40) + 7;
+  ASSERT_TRUE(id_index_map.Insert(kLargeId, 1));
+  ASSERT_EQ(id_index_map.Find(kLargeId), 1);
+  ASSERT_EQ(id_index_map.Find(kLargeId - (static_cast<int64_t>(1) << 32)), INVALID_INDEX_VALUE);
+}
+
+/// Feature: EmbeddingIdIndexMap
+/// Description: Test the readers look up the map while the writer keeps inserting and erasing ids
+/// Expectation: The readers always find the ids which are never erased with the right index
+TEST_F(TestEmbeddingHashMap, test_id_index_map_concurrent_read) {
+  constexpr int kStableIdNum = 1000;
+  constexpr int kRound = 100;
+  EmbeddingIdIndexMap id_index_map(kStableIdNum * 2);
+  for (int id = 0; id < kStableIdNum; ++id) {
+    ASSERT_TRUE(id_index_map.Insert(id, id + 1));
+  }
+
+  std::atomic_bool done{false};
+  std::atomic<size_t> error_num{0};
+  std::vector<std::thread> readers;
+  for (size_t i = 0; i < 3; ++i) {
+    readers.emplace_back([&id_index_map, &done, &error_num]() {
+      while (!done.load()) {
+        for (int id = 0; id < kStableIdNum; ++id) {
+          if (id_index_map.Find(id) != id + 1) {
+            ++error_num;
+          }
+        }
+      }
+    });
+  }
+  for (int round = 0; round < kRound; ++round) {
+    for (int id = kStableIdNum; id < kStableIdNum * 2; ++id) {
+      ASSERT_TRUE(id_index_map.Insert(id + round * kStableIdNum, id));
+    }
+    for (int id = kStableIdNum; id < kStableIdNum * 2; ++id) {
+      ASSERT_TRUE(id_index_map.Erase(id + round * kStableIdNum));
+    }
+  }
+  done = true;
+  for (auto &reader : readers) {
+    reader.join();
+  }
+  ASSERT_EQ(error_num.load(), 0);
+  ASSERT_EQ(id_index_map.size(), kStableIdNum);
+}
+
+/// Feature: EmbeddingHashMap
+/// Description: Test the batched ParseData inserts the ids and swaps out the expired ids when the map is full
+/// Expectation: The ids are mapped to the valid positions and the expired ids are swapped out
+TEST_F(TestEmbeddingHashMap, test_batch_parse_data) {
+  // The front and back positions are reserved.
+  constexpr size_t kCapacity = 6;
+  EmbeddingHashMap hash_map(0, kCapacity);
+  std::vector<int> swap_out_index(kCapacity);
+  std::vector<int64_t> swap_out_ids(kCapacity);
+  size_t swap_out_size = 0;
+  bool need_wait_graph = false;
+
+  std::vector<int64_t> ids = {10, 11, 12, 13};
+  std::vector<int> hash_indices(ids.size());
+  size_t data_step = 1;
+  size_t graph_running_step = 0;
+  ASSERT_EQ(hash_map.ParseData(ids.data(), ids.size(), hash_indices.data(), swap_out_index.data(),
+                               swap_out_ids.data(), data_step, graph_running_step, &swap_out_size, &need_wait_graph),
+            ids.size());
+  ASSERT_EQ(swap_out_size, 0);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    ASSERT_EQ(hash_map.GetIndex(ids[i]), hash_indices[i]);
+  }
+
+  // The ids of step 1 are expired after the graph finishes step 1.
+  hash_map.Reset();
+  std::vector<int64_t> new_ids = {20, 21};
+  data_step = 2;
+  graph_running_step = 2;
+  ASSERT_EQ(hash_map.ParseData(new_ids.data(), new_ids.size(), hash_indices.data(), swap_out_index.data(),
+                               swap_out_ids.data(), data_step, graph_running_step, &swap_out_size, &need_wait_graph),
+            new_ids.size());
+  ASSERT_EQ(swap_out_size, new_ids.size());
+  ASSERT_EQ(hash_map.id_num(), ids.size());
+  for (size_t i = 0; i < swap_out_size; ++i) {
+    ASSERT_EQ(hash_map.GetIndex(swap_out_ids[i]), INVALID_INDEX_VALUE);
+    ASSERT_EQ(hash_map.GetIndex(new_ids[i]), swap_out_index[i]);
+  }
+}
+
+/// Feature: EmbeddingHashMap
+/// Description: Test the int64 ids of different shards are parsed by different threads at the same time
+/// Expectation: Each id is mapped to the position of its own shard, and the positions are not overlapped
+TEST_F(TestEmbeddingHashMap, test_sharded_parse_data) {
+  constexpr size_t kShardNum = 4;
+  constexpr size_t kCapacity = kMinHashMapShardCapacity * kShardNum;
+  constexpr size_t kIdNumPerShard = kMinHashMapShardCapacity / 2;
+  EmbeddingHashMap hash_map(0, kCapacity, kShardNum);
+  ASSERT_EQ(hash_map.shard_num(), kShardNum);
+  ASSERT_EQ(EmbeddingHashMap(0, kMinHashMapShardCapacity, kShardNum).shard_num(), 1);
+
+  // The ids exceed the range of int32, and are grouped by the shard.
+  constexpr int64_t kIdBase = static_cast<int64_t>(1) << 40;
+  std::vector<std::vector<int64_t>> shard_ids(kShardNum);
+  for (size_t i = 0; i < kShardNum * kIdNumPerShard; ++i) {
+    int64_t id = kIdBase + static_cast<int64_t>(i);
+    shard_ids[hash_map.ShardIndex(id)].push_back(id);
+  }
+  std::vector<std::vector<int>> shard_indices(kShardNum);
+  std::vector<size_t> parsed_nums(kShardNum, 0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kShardNum; ++i) {
+    threads.emplace_back([&hash_map, &shard_ids, &shard_indices, &parsed_nums, i]() {
+      std::vector<int> swap_out_index(shard_ids[i].size());
+      std::vector<int64_t> swap_out_ids(shard_ids[i].size());
+      size_t swap_out_size = 0;
+      bool need_wait_graph = false;
+      shard_indices[i].resize(shard_ids[i].size());
+      parsed_nums[i] =
+        hash_map.ParseData(shard_ids[i].data(), shard_ids[i].size(), shard_indices[i].data(), swap_out_index.data(),
+                           swap_out_ids.data(), 1, 0, &swap_out_size, &need_wait_graph);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  std::vector<bool> used(kCapacity, false);
+  for (size_t i = 0; i < kShardNum; ++i) {
+    ASSERT_EQ(parsed_nums[i], shard_ids[i].size());
+    for (size_t j = 0; j < shard_ids[i].size(); ++j) {
+      auto index = shard_indices[i][j];
+      ASSERT_EQ(hash_map.GetIndex(shard_ids[i][j]), index);
+      ASSERT_GE(index, SizeToInt(kMinHashMapShardCapacity * i));
+      ASSERT_LT(index, SizeToInt(kMinHashMapShardCapacity * (i + 1)));
+      ASSERT_FALSE(used[index]);
+      used[index] = true;
+    }
+  }
+  ASSERT_EQ(hash_map.id_num(), kShardNum * kIdNumPerShard);
+
+  size_t count = 0;
+  hash_map.ForEach([&count](int64_t id, int index) { ++count; });
+  ASSERT_EQ(count, kShardNum * kIdNumPerShard);
+}
+}  // namespace distributed
+}  // namespace mindspore
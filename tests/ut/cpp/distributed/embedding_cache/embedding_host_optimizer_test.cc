@@ -0,0 +1,143 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <set>
+#include <vector>
+#include "common/common_test.h"
+#include "distributed/embedding_cache/embedding_host_optimizer.h"
+
+namespace mindspore {
+namespace distributed {
+namespace {
+constexpr size_t kEmbeddingSize = 3;
+constexpr size_t kRowNum = 2;
+constexpr float kTolerance = 1e-5;
+const AdamHyperParams kAdamParams{0.01, 0.9, 0.999, 1e-8};
+
+// The var, m and v of an embedding table.
+struct AdamTableData {
+  AdamTableData() : var(kRowNum * kEmbeddingSize), m(kRowNum * kEmbeddingSize), v(kRowNum * kEmbeddingSize) {
+    for (size_t i = 0; i < var.size(); ++i) {
+      var[i] = 0.1f * (i + 1);
+    }
+  }
+  std::vector<float> var;
+  std::vector<float> m;
+  std::vector<float> v;
+};
+
+float Grad(size_t row, uint64_t step) { return 0.05f * (row + 1) - 0.01f * (step % 7); }
+
+// The step of FusedSparseAdam on the rows, the rows with gradient are in grad_rows and the other rows only decay.
+void AdamStep(AdamTableData *data, const std::set<size_t> &rows, const std::set<size_t> &grad_rows, uint64_t step) {
+  auto lr = static_cast<float>(kAdamParams.lr * std::sqrt(1 - std::pow(kAdamParams.beta2, step)) /
+                               (1 - std::pow(kAdamParams.beta1, step)));
+  for (auto row : rows) {
+    for (size_t i = row * kEmbeddingSize; i < (row + 1) * kEmbeddingSize; ++i) {
+      data->m[i] *= kAdamParams.beta1;
+      data->v[i] *= kAdamParams.beta2;
+      if (grad_rows.count(row) != 0) {
+        auto grad = Grad(row, step);
+        data->m[i] += (1 - kAdamParams.beta1) * grad;
+        data->v[i] += (1 - kAdamParams.beta2) * grad * grad;
+      }
+      data->var[i] -= lr * data->m[i] / (std::sqrt(data->v[i]) + kAdamParams.epsilon);
+    }
+  }
+}
+
+void ExpectNear(const std::vector<float> &actual, const std::vector<float> &expect) {
+  ASSERT_EQ(actual.size(), expect.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(actual[i], expect[i], kTolerance * std::max(1.0f, std::abs(expect[i]))) << "index " << i;
+  }
+}
+
+// Train the two rows for the steps [1, end_step], the row 0 has gradient in each step except the steps
+// [swap_out_step, swap_in_step), in which it is out of the device cache and only the row 1 is updated. Compare the
+// tables of the host optimizer with the ones updated by the dense Adam on all the rows in each step.
+void CheckApplyMissedSteps(uint64_t swap_out_step, uint64_t swap_in_step, uint64_t end_step) {
+  AdamTableData expect;
+  AdamTableData actual;
+  EmbeddingHostOptimizer host_optimizer;
+  host_optimizer.AddAdamTable(actual.var.data(), actual.m.data(), actual.v.data(), kEmbeddingSize, kAdamParams);
+  const int64_t id = 100;
+  const int host_index = 0;
+  for (uint64_t step = 1; step <= end_step; ++step) {
+    bool out_of_cache = step >= swap_out_step && step < swap_in_step;
+    std::set<size_t> grad_rows = out_of_cache ? std::set<size_t>{1} : std::set<size_t>{0, 1};
+    AdamStep(&expect, {0, 1}, grad_rows, step);
+    if (step == swap_out_step) {
+      host_optimizer.RecordSwapOut(&id, 1, step);
+    }
+    if (step == swap_in_step) {
+      ASSERT_TRUE(host_optimizer.ApplyMissedSteps(&id, &host_index, 1, step));
+    }
+    AdamStep(&actual, grad_rows, grad_rows, step);
+  }
+  ExpectNear(actual.var, expect.var);
+  ExpectNear(actual.m, expect.m);
+  ExpectNear(actual.v, expect.v);
+}
+}  // namespace
+
+class TestEmbeddingHostOptimizer : public UT::Common {
+ public:
+  TestEmbeddingHostOptimizer() = default;
+  virtual ~TestEmbeddingHostOptimizer() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: EmbeddingHostOptimizer
+/// Description: Swap a row out of the device cache for several steps, and apply the missed steps when it is swapped in
+/// Expectation: The var, m and v are the same as the ones updated by the dense Adam on all the rows in each step
+TEST_F(TestEmbeddingHostOptimizer, test_apply_missed_adam_steps) { CheckApplyMissedSteps(4, 10, 15); }
+
+/// Feature: EmbeddingHostOptimizer
+/// Description: Swap a row out of the device cache for many steps, in which its m decays below the float precision
+/// Expectation: The var, m and v are the same as the ones updated by the dense Adam on all the rows in each step
+TEST_F(TestEmbeddingHostOptimizer, test_apply_many_missed_adam_steps) { CheckApplyMissedSteps(3, 2000, 2005); }
+
+/// Feature: EmbeddingHostOptimizer
+/// Description: Swap in the ids which have never been swapped out, or are swapped in at the step of swapping out
+/// Expectation: The rows are unchanged, and the record of swapping out is consumed by swapping in
+TEST_F(TestEmbeddingHostOptimizer, test_no_missed_step) {
+  AdamTableData data;
+  data.m.assign(data.m.size(), 0.1f);
+  data.v.assign(data.v.size(), 0.01f);
+  auto origin_var = data.var;
+  EmbeddingHostOptimizer host_optimizer;
+  host_optimizer.AddAdamTable(data.var.data(), data.m.data(), data.v.data(), kEmbeddingSize, kAdamParams);
+  const int64_t ids[kRowNum] = {100, 101};
+  const int host_indices[kRowNum] = {0, 1};
+  ASSERT_TRUE(host_optimizer.ApplyMissedSteps(ids, host_indices, kRowNum, 5));
+  host_optimizer.RecordSwapOut(ids, 1, 5);
+  ASSERT_TRUE(host_optimizer.ApplyMissedSteps(ids, host_indices, 1, 5));
+  ASSERT_EQ(data.var, origin_var);
+  ASSERT_EQ(data.m, std::vector<float>(data.m.size(), 0.1f));
+
+  host_optimizer.RecordSwapOut(ids, 1, 6);
+  ASSERT_TRUE(host_optimizer.ApplyMissedSteps(ids, host_indices, 1, 8));
+  ASSERT_NE(data.var, origin_var);
+  auto updated_var = data.var;
+  ASSERT_TRUE(host_optimizer.ApplyMissedSteps(ids, host_indices, 1, 10));
+  ASSERT_EQ(data.var, updated_var);
+}
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/common_test.h"
+#include "distributed/persistent/storage/embedding_store.h"
+#include "distributed/persistent/storage/file_io_utils.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+class TestEmbeddingStore : public UT::Common {
+ public:
+  TestEmbeddingStore() = default;
+  virtual ~TestEmbeddingStore() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: EmbeddingStore
+/// Description: Test the put and get of the embeddings in the local storage with several segment files
+/// Expectation: The ids in the store are found with the latest values, and the segment files are removed at finalizing
+TEST_F(TestEmbeddingStore, test_put_get) {
+  constexpr size_t kEmbeddingSize = 4;
+  constexpr size_t kValueLength = kEmbeddingSize * sizeof(float);
+  std::string storage_path = "./embedding_store";
+  // Each segment file holds 3 embeddings.
+  EmbeddingStore store(storage_path, kValueLength, kValueLength * 3);
+  store.Initialize();
+
+  std::vector<int64_t> ids = {100, 3, 50, 7, 1000000000000};
+  std::vector<float> values(ids.size() * kEmbeddingSize);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i);
+  }
+  ASSERT_TRUE(store.Put(ids.data(), ids.size(), values.data()));
+  ASSERT_EQ(store.size(), ids.size());
+  ASSERT_TRUE(FileIOUtils::IsFileOrDirExist(storage_path + "/" + kSegmentFilePrefix + "1"));
+
+  // Overwrite the value of id 50 in place.
+  int64_t update_id = 50;
+  std::vector<float> update_value(kEmbeddingSize, -1);
+  ASSERT_TRUE(store.Put(&update_id, 1, update_value.data()));
+  ASSERT_EQ(store.size(), ids.size());
+
+  std::vector<int64_t> query_ids = {7, 8, 50, 1000000000000};
+  std::vector<float> results(query_ids.size() * kEmbeddingSize, 0);
+  auto found = std::make_unique<bool[]>(query_ids.size());
+  ASSERT_TRUE(store.Get(query_ids.data(), query_ids.size(), results.data(), found.get()));
+  ASSERT_TRUE(found[0]);
+  ASSERT_FALSE(found[1]);
+  ASSERT_TRUE(found[2]);
+  ASSERT_TRUE(found[3]);
+  for (size_t j = 0; j < kEmbeddingSize; ++j) {
+    EXPECT_EQ(results[j], values[3 * kEmbeddingSize + j]);
+    EXPECT_EQ(results[kEmbeddingSize + j], 0);
+    EXPECT_EQ(results[2 * kEmbeddingSize + j], -1);
+    EXPECT_EQ(results[3 * kEmbeddingSize + j], values[4 * kEmbeddingSize + j]);
+  }
+  ASSERT_EQ(store.GetAllIds().size(), ids.size());
+
+  store.Finalize();
+  ASSERT_EQ(store.size(), 0);
+  ASSERT_FALSE(FileIOUtils::IsFileOrDirExist(storage_path + "/" + kSegmentFilePrefix + "0"));
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
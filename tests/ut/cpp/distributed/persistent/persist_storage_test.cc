@@ -22,6 +22,7 @@
 #include <string>
 
 #include "distributed/persistent/data.h"
+#include "distributed/persistent/storage/local_file.h"
 #include "utils/file_utils.h"
 
 namespace mindspore {
@@ -98,6 +99,73 @@ TEST_F(TestPersistStorage, test_embedding_storage) {
     EXPECT_EQ(data[i], embdding_table_data->at(i));
   }
 }
+
+/// Feature: test incremental persistent storage and compaction.
+/// Description: Persist the dirty rows of the embedding table to the delta files, restore it and compact the delta
+/// files to the block files.
+/// Expectation: The content restored from the block files and delta files is consistent with expectations.
+TEST_F(TestPersistStorage, test_incremental_storage) {
+  constexpr int kVocab = 64;
+  constexpr int kEmbDim = 4;
+  std::vector<float> data(kVocab * kEmbDim, 1);
+  std::vector<int> shape = {kVocab, kEmbDim};
+  auto update_row = [&data](int row, float value) {
+    for (int i = 0; i < kEmbDim; ++i) {
+      data[row * kEmbDim + i] = value;
+    }
+  };
+
+  std::string storage_file_path = "./incremental_storage";
+  if (!distributed::storage::FileIOUtils::IsFileOrDirExist(storage_file_path)) {
+    distributed::storage::FileIOUtils::CreateDir(storage_file_path);
+  }
+  auto ret = FileUtils::GetRealPath(storage_file_path.c_str());
+  ASSERT_TRUE(ret.has_value());
+  std::map<std::string, std::string> config_map;
+  config_map[distributed::storage::kFileStoragePath] = ret.value();
+  // Each block holds 16 rows, and at most 2 delta files are kept for a block.
+  config_map[distributed::storage::kMaxBlockLength] = std::to_string(16 * kEmbDim * sizeof(float));
+  config_map[distributed::storage::kIncrementalPersist] = "true";
+  config_map[distributed::storage::kMaxDeltaNum] = "2";
+  auto block_file = [&ret](int block_index, int delta_index) {
+    return ret.value() + "/" + distributed::storage::kBlockFilePrefix + std::to_string(block_index) +
+           distributed::storage::kDeltaFileInfix + std::to_string(delta_index);
+  };
+  auto check_restore = [&config_map, &data]() {
+    distributed::storage::LocalFile local_file(config_map);
+    std::vector<float> restore_data(data.size(), 0);
+    local_file.Read(std::make_pair(restore_data.data(), restore_data.size() * sizeof(float)));
+    for (size_t i = 0; i < data.size(); ++i) {
+      EXPECT_EQ(data[i], restore_data[i]);
+    }
+  };
+
+  distributed::storage::LocalFile local_file(config_map);
+  auto input = std::make_tuple(shape, static_cast<const void *>(data.data()), data.size() * sizeof(float));
+  EXPECT_NO_THROW(local_file.Write(input, distributed::storage::DirtyInfo()));
+
+  // The unsorted and duplicated dirty rows are written to the delta files of block 0 and block 1.
+  update_row(20, 2);
+  update_row(3, 3);
+  EXPECT_NO_THROW(local_file.Write(input, distributed::storage::DirtyInfo({20, 3, 3})));
+  EXPECT_TRUE(distributed::storage::FileIOUtils::IsFileOrDirExist(block_file(0, 0)));
+  EXPECT_TRUE(distributed::storage::FileIOUtils::IsFileOrDirExist(block_file(1, 0)));
+  check_restore();
+
+  // The block 0 is rewritten and its delta files are removed when the delta files reach the maximum number.
+  update_row(5, 4);
+  EXPECT_NO_THROW(local_file.Write(input, distributed::storage::DirtyInfo({5})));
+  EXPECT_TRUE(distributed::storage::FileIOUtils::IsFileOrDirExist(block_file(0, 1)));
+  update_row(6, 5);
+  EXPECT_NO_THROW(local_file.Write(input, distributed::storage::DirtyInfo({6})));
+  EXPECT_FALSE(distributed::storage::FileIOUtils::IsFileOrDirExist(block_file(0, 0)));
+  check_restore();
+
+  distributed::storage::LocalFile compact_file(config_map);
+  EXPECT_NO_THROW(compact_file.Compact());
+  EXPECT_FALSE(distributed::storage::FileIOUtils::IsFileOrDirExist(block_file(1, 0)));
+  check_restore();
+}
 }  // namespace persistent
 }  // namespace distributed
 }  // namespace mindspore
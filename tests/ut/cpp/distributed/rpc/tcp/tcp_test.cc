@@ -21,6 +21,8 @@
 #include <string>
 #include <thread>
 #include <csignal>
+#include <vector>
+#include <memory>
 
 #include <gtest/gtest.h>
 #define private public
@@ -35,7 +37,7 @@ namespace rpc {
 int g_recv_num = 0;
 int g_exit_msg_num = 0;
 
-static size_t g_data_msg_num = 0;
+static std::atomic<size_t> g_data_msg_num{0};
 
 static void Init() { g_data_msg_num = 0; }
 
@@ -388,6 +390,63 @@ TEST_F(TCPTest, DeleteInvalidConnectionForTcpClient) {
     ASSERT_TRUE(disconnected);
   }
 }
+
+/// Feature: test the sharded event loops of tcp comm.
+/// Description: start two tcp servers and a tcp client with four event loop shards, and send messages to both servers.
+/// Expectation: all the messages are received and the busy time of each shard is reported.
+TEST_F(TCPTest, SendMessagesWithShardedEventLoops) {
+  Init();
+  (void)setenv(kEnvEventLoopNum, "4", 1);
+
+  // Start the tcp servers.
+  std::vector<std::string> server_urls = {"127.0.0.1:8081", "127.0.0.1:8082"};
+  std::vector<std::unique_ptr<TCPServer>> servers;
+  for (const auto &server_url : server_urls) {
+    auto server = std::make_unique<TCPServer>();
+    ASSERT_TRUE(server->Initialize(server_url));
+    server->SetMessageHandler([](MessageBase *const message) -> MessageBase *const {
+      IncrDataMsgNum(1);
+      return NULL_MSG;
+    });
+    servers.push_back(std::move(server));
+  }
+
+  // Start the tcp client.
+  auto client_url = "127.0.0.1:1234";
+  std::unique_ptr<TCPClient> client = std::make_unique<TCPClient>();
+  ASSERT_TRUE(client->Initialize());
+  ASSERT_EQ(client->tcp_comm_->GetEventLoopBusyTime().size(), 4);
+
+  // Send the messages.
+  size_t msg_num_per_server = 10;
+  for (const auto &server_url : server_urls) {
+    ASSERT_TRUE(client->Connect(server_url));
+    for (size_t i = 0; i < msg_num_per_server; ++i) {
+      client->SendAsync(CreateMessage(server_url, client_url));
+    }
+  }
+
+  // Wait timeout: 5s
+  WaitForDataMsg(msg_num_per_server * server_urls.size(), 5);
+
+  // Check result
+  EXPECT_EQ(msg_num_per_server * server_urls.size(), GetDataMsgNum());
+  uint64_t send_busy_time = 0;
+  for (const auto &busy_time : client->tcp_comm_->GetEventLoopBusyTime()) {
+    send_busy_time += busy_time.second;
+  }
+  EXPECT_GT(send_busy_time, 0);
+
+  // Destroy
+  for (const auto &server_url : server_urls) {
+    client->Disconnect(server_url);
+  }
+  client->Finalize();
+  for (auto &server : servers) {
+    server->Finalize();
+  }
+  (void)unsetenv(kEnvEventLoopNum);
+}
 }  // namespace rpc
 }  // namespace distributed
 }  // namespace mindspore
@@ -0,0 +1,230 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "fl/compression/decode_executor.h"
+#include "fl/compression/encode_executor.h"
+
+namespace mindspore {
+namespace fl {
+namespace compression {
+namespace {
+constexpr size_t kNumBits = 8;
+
+// The decoding which materializes the dequantized and the desparsified copies of all the parameters.
+bool ReferenceDeQuantSparseDiff(std::map<std::string, std::vector<float>> *weight_map,
+                                const std::vector<CompressFeatureMap> &compress_feature_maps, float upload_sparse_rate,
+                                int seed, const std::vector<std::string> &name_vec, size_t data_size,
+                                const std::map<std::string, kernel::AddressPtr> &feature_maps) {
+  std::vector<size_t> shape_vec;
+  size_t param_num = 0;
+  for (const auto &name : name_vec) {
+    size_t shape = feature_maps.at(name)->size / sizeof(float);
+    shape_vec.push_back(shape);
+    param_num += shape;
+  }
+
+  // quant decode
+  auto temp1 = static_cast<float>(1 << kNumBits) - 1.0f;
+  auto temp2 = static_cast<float>(1 << (kNumBits - 1));
+  std::vector<float> de_min_max_feature_map;
+  for (const auto &compress_feature_map : compress_feature_maps) {
+    float min_val = compress_feature_map.min_val;
+    float max_val = compress_feature_map.max_val;
+    float scale_val = static_cast<float>(max_val - min_val) / temp1 + 1e-10f;
+    for (auto data : compress_feature_map.compress_data) {
+      de_min_max_feature_map.push_back((static_cast<float>(data) + temp2) * scale_val + min_val);
+    }
+  }
+
+  // sparse decode
+  std::vector<int> mask_array = DecodeExecutor::GetInstance().ConstructMaskArray(seed, upload_sparse_rate, param_num);
+  std::vector<std::vector<float>> decompress_feature_maps;
+  size_t index = 0;
+  size_t de_min_max_feature_map_index = 0;
+  for (const auto &shape : shape_vec) {
+    std::vector<float> feature_map(shape);
+    for (size_t i = 0; i < shape; ++i) {
+      if (mask_array[index] == 1) {
+        if (de_min_max_feature_map_index >= de_min_max_feature_map.size()) {
+          return false;
+        }
+        feature_map[i] = de_min_max_feature_map[de_min_max_feature_map_index];
+        de_min_max_feature_map_index += 1;
+      } else {
+        feature_map[i] = 0.0f;
+      }
+      index += 1;
+    }
+    decompress_feature_maps.push_back(feature_map);
+  }
+
+  // difference decode
+  for (size_t i = 0; i < decompress_feature_maps.size(); ++i) {
+    float *weight_data = reinterpret_cast<float *>(feature_maps.at(name_vec[i])->addr);
+    auto &weight_item = (*weight_map)[name_vec[i]];
+    weight_item.resize(decompress_feature_maps[i].size());
+    for (size_t j = 0; j < weight_item.size(); ++j) {
+      weight_item[j] = decompress_feature_maps[i][j] + data_size * weight_data[j];
+    }
+  }
+  return true;
+}
+}  // namespace
+
+class TestDecodeExecutor : public UT::Common {
+ public:
+  TestDecodeExecutor() = default;
+};
+
+/// Feature: DecodeExecutor DeQuantSparseDiff
+/// Description: Decode the quantized, sparsified and differenced upload of several parameters, whose compressed data
+/// is split across several feature maps with different ranges
+/// Expectation: The fused decoding is byte identical to the decoding with the intermediate copies
+TEST_F(TestDecodeExecutor, test_fused_decode_same_as_reference) {
+  constexpr float kUploadSparseRate = 0.3;
+  constexpr int kSeed = 7;
+  constexpr size_t kDataSize = 3;
+  const std::vector<std::string> name_vec = {"conv.weight", "fc.weight", "fc.bias"};
+  const std::vector<size_t> shape_vec = {97, 200, 13};
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<float> weight_dist(-1.0f, 1.0f);
+  std::uniform_int_distribution<int> data_dist(-128, 127);
+
+  std::vector<std::vector<float>> last_weights(name_vec.size());
+  std::map<std::string, kernel::AddressPtr> feature_maps;
+  size_t param_num = 0;
+  for (size_t i = 0; i < name_vec.size(); ++i) {
+    last_weights[i].resize(shape_vec[i]);
+    for (auto &weight : last_weights[i]) {
+      weight = weight_dist(generator);
+    }
+    feature_maps[name_vec[i]] = std::make_shared<kernel::Address>(last_weights[i].data(), shape_vec[i] * sizeof(float));
+    param_num += shape_vec[i];
+  }
+
+  size_t retain_num = size_t(static_cast<float>(param_num) * kUploadSparseRate);
+  const std::vector<size_t> compress_sizes = {retain_num / 3, 0, retain_num - retain_num / 3};
+  std::vector<CompressFeatureMap> compress_feature_maps;
+  for (size_t i = 0; i < compress_sizes.size(); ++i) {
+    CompressFeatureMap compress_feature_map;
+    compress_feature_map.weight_fullname = "compress_" + std::to_string(i);
+    compress_feature_map.min_val = -0.5f * static_cast<float>(i + 1);
+    compress_feature_map.max_val = 0.25f * static_cast<float>(i + 1);
+    for (size_t j = 0; j < compress_sizes[i]; ++j) {
+      compress_feature_map.compress_data.push_back(static_cast<int8_t>(data_dist(generator)));
+    }
+    compress_feature_maps.push_back(compress_feature_map);
+  }
+
+  std::map<std::string, std::vector<float>> expect_weight_map;
+  ASSERT_TRUE(ReferenceDeQuantSparseDiff(&expect_weight_map, compress_feature_maps, kUploadSparseRate, kSeed, name_vec,
+                                         kDataSize, feature_maps));
+  std::map<std::string, std::vector<float>> weight_map;
+  ASSERT_TRUE(DecodeExecutor::GetInstance().DeQuantSparseDiff(&weight_map, compress_feature_maps, kNumBits,
+                                                              kUploadSparseRate, kSeed, name_vec, kDataSize,
+                                                              feature_maps));
+  ASSERT_EQ(weight_map.size(), expect_weight_map.size());
+  for (const auto &name : name_vec) {
+    const auto &weight = weight_map[name];
+    const auto &expect_weight = expect_weight_map[name];
+    ASSERT_EQ(weight.size(), expect_weight.size());
+    ASSERT_EQ(memcmp(weight.data(), expect_weight.data(), weight.size() * sizeof(float)), 0);
+  }
+
+  // The upload with too few parameters is rejected.
+  compress_feature_maps.back().compress_data.pop_back();
+  weight_map.clear();
+  ASSERT_FALSE(DecodeExecutor::GetInstance().DeQuantSparseDiff(&weight_map, compress_feature_maps, kNumBits,
+                                                               kUploadSparseRate, kSeed, name_vec, kDataSize,
+                                                               feature_maps));
+}
+
+/// Feature: CompressAggregator
+/// Description: Aggregate the 8-bit and 4-bit dense uploads and the top-k uploads of a parameter in the compressed
+/// domain
+/// Expectation: The aggregation is the sum of the new weights decoded from each upload
+TEST_F(TestDecodeExecutor, test_compressed_domain_aggregation) {
+  constexpr size_t kParamNum = 1000;
+  constexpr size_t kK = 50;
+  std::mt19937 generator(2);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> last_weight(kParamNum);
+  for (auto &weight : last_weight) {
+    weight = dist(generator);
+  }
+  std::vector<double> expect(kParamNum, 0.0);
+  size_t data_size_sum = 0;
+  CompressAggregator aggregator(kParamNum);
+  auto &decoder = DecodeExecutor::GetInstance();
+  for (size_t client = 0; client < 4; ++client) {
+    std::vector<float> diff(kParamNum);
+    for (auto &value : diff) {
+      value = dist(generator) * static_cast<float>(client + 1);
+    }
+    size_t data_size = client + 2;
+    data_size_sum += data_size;
+    size_t num_bits = client % 2 == 0 ? kStochasticQuantBits8 : kStochasticQuantBits4;
+    CompressFeatureMap compress_feature_map;
+    std::vector<float> decoded;
+    if (client < 2) {
+      CompressWeight compress_weight;
+      ASSERT_TRUE(CompressExecutor::GetInstance().StochasticQuant(diff, num_bits, client, &compress_weight));
+      compress_feature_map.compress_data = compress_weight.compress_data;
+      compress_feature_map.min_val = compress_weight.min_val;
+      compress_feature_map.max_val = compress_weight.max_val;
+      ASSERT_TRUE(decoder.DeQuantStochastic(compress_feature_map, num_bits, kParamNum, &decoded));
+      for (size_t i = 0; i < kParamNum; ++i) {
+        expect[i] += decoded[i];
+      }
+      ASSERT_TRUE(aggregator.AccumulateQuant(compress_feature_map, num_bits, data_size));
+    } else {
+      TopKCompressWeight compress_weight;
+      ASSERT_TRUE(CompressExecutor::GetInstance().TopKSparse(diff, kK, num_bits, client, &compress_weight));
+      compress_feature_map.compress_data = compress_weight.value_weight.compress_data;
+      compress_feature_map.min_val = compress_weight.value_weight.min_val;
+      compress_feature_map.max_val = compress_weight.value_weight.max_val;
+      std::vector<size_t> indices;
+      ASSERT_TRUE(decoder.DecodeTopKIndices(compress_weight.index_data, kK, kParamNum, &indices));
+      ASSERT_TRUE(decoder.DeQuantStochastic(compress_feature_map, num_bits, kK, &decoded));
+      for (size_t i = 0; i < kK; ++i) {
+        expect[indices[i]] += decoded[i];
+      }
+      ASSERT_TRUE(aggregator.AccumulateTopK(compress_weight.index_data, kK, compress_feature_map, num_bits, data_size));
+      // The upload whose values don't match the indices is rejected.
+      ASSERT_FALSE(
+        aggregator.AccumulateTopK(compress_weight.index_data, kK - 1, compress_feature_map, num_bits, data_size));
+    }
+  }
+
+  std::vector<float> aggregate;
+  ASSERT_TRUE(aggregator.Finalize(last_weight.data(), kParamNum, &aggregate));
+  ASSERT_EQ(aggregate.size(), kParamNum);
+  for (size_t i = 0; i < kParamNum; ++i) {
+    expect[i] += static_cast<double>(data_size_sum) * last_weight[i];
+    EXPECT_NEAR(aggregate[i], expect[i], 1e-4) << "index " << i;
+  }
+  ASSERT_FALSE(aggregator.Finalize(last_weight.data(), kParamNum - 1, &aggregate));
+}
+}  // namespace compression
+}  // namespace fl
+}  // namespace mindspore
@@ -0,0 +1,134 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "common/common_test.h"
+#include "fl/compression/encode_executor.h"
+#include "fl/compression/decode_executor.h"
+
+namespace mindspore {
+namespace fl {
+namespace compression {
+namespace {
+std::vector<float> RandomValues(size_t size, uint32_t seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<float> distribution(0.0f, 0.5f);
+  std::vector<float> values(size);
+  for (auto &value : values) {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+CompressFeatureMap ToFeatureMap(const CompressWeight &compress_weight) {
+  CompressFeatureMap compress_feature_map;
+  compress_feature_map.compress_data = compress_weight.compress_data;
+  compress_feature_map.min_val = compress_weight.min_val;
+  compress_feature_map.max_val = compress_weight.max_val;
+  return compress_feature_map;
+}
+}  // namespace
+
+class TestEncodeExecutor : public UT::Common {
+ public:
+  TestEncodeExecutor() = default;
+};
+
+/// Feature: CompressExecutor StochasticQuant
+/// Description: Quantize the values to 8 and 4 bits, and dequantize them
+/// Expectation: The data is 1 and 1/2 byte per value, each value is decoded to one of the two nearest levels, and the
+/// mean of the decoded values over many seeds is the value itself
+TEST_F(TestEncodeExecutor, test_stochastic_quant) {
+  constexpr size_t kValueNum = 101;
+  constexpr size_t kRoundNum = 400;
+  auto values = RandomValues(kValueNum, 1);
+  for (size_t num_bits : {kStochasticQuantBits8, kStochasticQuantBits4}) {
+    std::vector<double> mean(kValueNum, 0.0);
+    float scale = 0.0f;
+    for (uint32_t seed = 0; seed < kRoundNum; ++seed) {
+      CompressWeight compress_weight;
+      ASSERT_TRUE(CompressExecutor::GetInstance().StochasticQuant(values, num_bits, seed, &compress_weight));
+      ASSERT_EQ(compress_weight.compress_data_len, kValueNum);
+      ASSERT_EQ(compress_weight.compress_data.size(), (kValueNum * num_bits + 7) / 8);
+      scale = (compress_weight.max_val - compress_weight.min_val) / static_cast<float>((1 << num_bits) - 1);
+      std::vector<float> decoded;
+      ASSERT_TRUE(
+        DecodeExecutor::GetInstance().DeQuantStochastic(ToFeatureMap(compress_weight), num_bits, kValueNum, &decoded));
+      for (size_t i = 0; i < kValueNum; ++i) {
+        ASSERT_LE(std::abs(decoded[i] - values[i]), scale * 1.001f);
+        mean[i] += decoded[i] / kRoundNum;
+      }
+    }
+    for (size_t i = 0; i < kValueNum; ++i) {
+      EXPECT_NEAR(mean[i], values[i], scale * 0.15f) << "bits " << num_bits << " index " << i;
+    }
+  }
+
+  CompressWeight compress_weight;
+  ASSERT_FALSE(CompressExecutor::GetInstance().StochasticQuant(values, 2, 0, &compress_weight));
+  ASSERT_FALSE(CompressExecutor::GetInstance().StochasticQuant({}, kStochasticQuantBits8, 0, &compress_weight));
+}
+
+/// Feature: CompressExecutor TopKSparse
+/// Description: Keep the top-k values of a parameter, whose largest values are far apart
+/// Expectation: The decoded indices are the ones of the largest magnitudes, the small gaps take one byte and the
+/// values are decoded within one quantization step
+TEST_F(TestEncodeExecutor, test_top_k_sparse) {
+  constexpr size_t kValueNum = 5000;
+  constexpr size_t kK = 64;
+  auto values = RandomValues(kValueNum, 2);
+  values[kValueNum - 1] = 100.0f;
+
+  TopKCompressWeight compress_weight;
+  ASSERT_TRUE(CompressExecutor::GetInstance().TopKSparse(values, kK, kStochasticQuantBits8, 3, &compress_weight));
+  ASSERT_EQ(compress_weight.index_num, kK);
+  ASSERT_LT(compress_weight.index_data.size(), kK * 2);
+
+  std::vector<size_t> indices;
+  ASSERT_TRUE(DecodeExecutor::GetInstance().DecodeTopKIndices(compress_weight.index_data, kK, kValueNum, &indices));
+  std::vector<float> magnitudes(values.size());
+  std::transform(values.begin(), values.end(), magnitudes.begin(), [](float value) { return std::abs(value); });
+  std::vector<float> sorted_magnitudes = magnitudes;
+  std::sort(sorted_magnitudes.begin(), sorted_magnitudes.end(), std::greater<float>());
+  ASSERT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  ASSERT_EQ(indices.back(), kValueNum - 1);
+  for (auto index : indices) {
+    ASSERT_GE(magnitudes[index], sorted_magnitudes[kK - 1]);
+  }
+
+  std::vector<float> decoded;
+  const auto &value_weight = compress_weight.value_weight;
+  ASSERT_TRUE(
+    DecodeExecutor::GetInstance().DeQuantStochastic(ToFeatureMap(value_weight), kStochasticQuantBits8, kK, &decoded));
+  float scale = (value_weight.max_val - value_weight.min_val) / 255.0f;
+  for (size_t i = 0; i < kK; ++i) {
+    ASSERT_LE(std::abs(decoded[i] - values[indices[i]]), scale * 1.001f);
+  }
+
+  // The corrupted index data is rejected.
+  auto &decoder = DecodeExecutor::GetInstance();
+  ASSERT_FALSE(decoder.DecodeTopKIndices(compress_weight.index_data, kK, kValueNum - 1, &indices));
+  ASSERT_FALSE(decoder.DecodeTopKIndices(compress_weight.index_data, kK + 1, kValueNum, &indices));
+  ASSERT_FALSE(decoder.DecodeTopKIndices({0, 0}, 2, kValueNum, &indices));
+  ASSERT_FALSE(decoder.DecodeTopKIndices({static_cast<int8_t>(0x80)}, 1, kValueNum, &indices));
+  ASSERT_FALSE(CompressExecutor::GetInstance().TopKSparse(values, 0, kStochasticQuantBits8, 3, &compress_weight));
+}
+}  // namespace compression
+}  // namespace fl
+}  // namespace mindspore
@@ -375,6 +375,24 @@ TEST_F(TestManager, test_scalar_replace) {
   mng->Replace(cnode_add, x);
 }
 
+/// Feature: Change version of the managed func graph
+/// Description: Read the change version before and after a node of the graph is replaced
+/// Expectation: The version is only renewed by the replacement
+TEST_F(TestManager, test_change_version) {
+  FuncGraphPtr func_graph = std::make_shared<FuncGraph>();
+  ParameterPtr x = func_graph->add_parameter();
+  ParameterPtr y = func_graph->add_parameter();
+  CNodePtr cnode_add = func_graph->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, y});
+  func_graph->set_output(cnode_add);
+
+  auto mng = Manage(func_graph);
+  auto version = mng->change_version(func_graph);
+  ASSERT_NE(version, std::size_t(0));
+  ASSERT_EQ(mng->change_version(func_graph), version);
+  mng->Replace(cnode_add, x);
+  ASSERT_NE(mng->change_version(func_graph), version);
+}
+
 TEST_F(TestManager, test_nested_manual) {
   auto graphs = MakeNestedGraph();
   auto f = graphs[0];
@@ -762,4 +780,36 @@ TEST_F(TestManager, test_set_edge) {
   ASSERT_EQ(mgr->node_users()[t].front().first, get_item);
 }
 
+/// Feature: FuncGraphManager
+/// Description: Change the used graphs of one graph after the func_graphs_used_total is computed
+/// Expectation: The results of the changed graph and its users are recomputed, and the others are kept
+TEST_F(TestManager, test_func_graphs_used_total_incremental) {
+  // f() -> g(), g() -> 1, k() -> 2, h() -> 3
+  auto make_const_graph = [](int64_t value) {
+    FuncGraphPtr fg = std::make_shared<FuncGraph>();
+    fg->set_output(NewValueNode(value));
+    return fg;
+  };
+  auto g = make_const_graph(1);
+  auto k = make_const_graph(2);
+  auto h = make_const_graph(3);
+  FuncGraphPtr f = std::make_shared<FuncGraph>();
+  f->set_output(f->NewCNode({NewValueNode(g)}));
+  auto mng = Manage(std::vector<FuncGraphPtr>{f, k});
+  ASSERT_EQ(mng->func_graphs_used_total(f).size(), 1);
+  ASSERT_EQ(mng->func_graphs_used_total(k).size(), 0);
+  ASSERT_FALSE(mng->recursive(f));
+
+  // Make g call h, the used graphs of f include h then.
+  ASSERT_TRUE(mng->Replace(g->output(), g->NewCNode({NewValueNode(h)})));
+  ASSERT_TRUE(mng->func_graphs_used_total(f).contains(h));
+  ASSERT_TRUE(mng->func_graphs_used_total(g).contains(h));
+  ASSERT_EQ(mng->func_graphs_used_total(k).size(), 0);
+
+  // Make h call f, all of them are recursive.
+  ASSERT_TRUE(mng->Replace(h->output(), h->NewCNode({NewValueNode(f)})));
+  ASSERT_TRUE(mng->func_graphs_used_total(g).contains(f));
+  ASSERT_TRUE(mng->recursive(f));
+}
+
 }  // namespace mindspore
@@ -401,6 +401,53 @@ TEST_F(TestTensor, TensorWithUserData) {
   ASSERT_EQ(tensor1->user_data<std::string>("mykey"), mydata);
 }
 
+/// Feature: Tensor
+/// Description: Test the tensor sharing the external data buffer.
+/// Expectation: The tensor uses the buffer without copy and the deleter is called when the tensor is destroyed.
+TEST_F(TestTensor, TensorWithExternalData) {
+  std::vector<float> buffer = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  bool deleted = false;
+  {
+    auto tensor = std::make_shared<Tensor>(kNumberTypeFloat32, ShapeVector{2, 3}, buffer.data(),
+                                           [&deleted, &buffer](void *data) {
+                                             ASSERT_EQ(data, buffer.data());
+                                             deleted = true;
+                                           });
+    ASSERT_EQ(tensor->data_c(), buffer.data());
+    ASSERT_EQ(tensor->DataSize(), buffer.size());
+    ASSERT_EQ(tensor->Size(), buffer.size() * sizeof(float));
+    static_cast<float *>(tensor->data_c())[0] = 7.0;
+    ASSERT_EQ(buffer[0], 7.0);
+
+    // The copied tensor shares the same tensor data.
+    auto tensor1 = std::make_shared<Tensor>(*tensor);
+    tensor = nullptr;
+    ASSERT_FALSE(deleted);
+    ASSERT_EQ(tensor1->data_c(), buffer.data());
+  }
+  ASSERT_TRUE(deleted);
+}
+
+/// Feature: Tensor
+/// Description: Test create tensor from another tensor with the data type.
+/// Expectation: The tensor data is shared for the same data type, and converted for the different data type.
+TEST_F(TestTensor, InitByTensorWithDataTypeTest) {
+  std::vector<int32_t> buffer = {1, 2, 3, 4, 5, 6};
+  Tensor tensor(kNumberTypeInt32, ShapeVector{2, 3}, buffer.data(), buffer.size() * sizeof(int32_t));
+
+  Tensor same_type_tensor(tensor, kNumberTypeInt32);
+  ASSERT_EQ(same_type_tensor.data_c(), tensor.data_c());
+  ASSERT_EQ(same_type_tensor.id(), tensor.id());
+
+  Tensor float_tensor(tensor, kNumberTypeFloat32);
+  ASSERT_NE(float_tensor.data_c(), tensor.data_c());
+  ASSERT_EQ(float_tensor.data_type(), kNumberTypeFloat32);
+  auto float_data = static_cast<float *>(float_tensor.data_c());
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    ASSERT_EQ(float_data[i], static_cast<float>(buffer[i]));
+  }
+}
+
 /// Feature: Tensor
 /// Description: Test set new shape for tensor.
 /// Expectation: Tensor's shape will be changed and data will be reinitialized.
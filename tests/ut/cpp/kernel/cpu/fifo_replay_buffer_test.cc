@@ -0,0 +1,51 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "plugin/device/cpu/kernel/rl/fifo_replay_buffer.h"
+
+namespace mindspore {
+namespace kernel {
+class FIFOReplayBufferTest : public UT::Common {
+ public:
+  FIFOReplayBufferTest() = default;
+};
+
+/// Feature: FIFOReplayBuffer
+/// Description: Push one more transition than the capacity into the replay buffer
+/// Expectation: The head wraps to 0 right after the last slot, and the oldest transition is overridden
+TEST_F(FIFOReplayBufferTest, test_head_wraparound) {
+  constexpr size_t kCapacity = 4;
+  FIFOReplayBuffer buffer(kCapacity, {sizeof(float)});
+  for (size_t i = 0; i <= kCapacity; ++i) {
+    float value = static_cast<float>(i);
+    std::vector<AddressPtr> transition = {std::make_shared<Address>(&value, sizeof(float))};
+    ASSERT_TRUE(buffer.Push(transition));
+    ASSERT_EQ(buffer.head(), i % kCapacity);
+  }
+  ASSERT_EQ(buffer.head(), 0);
+  ASSERT_EQ(buffer.size(), kCapacity);
+  std::vector<float> expect = {4, 1, 2, 3};
+  for (size_t i = 0; i < kCapacity; ++i) {
+    auto item = buffer.GetItem(i);
+    ASSERT_EQ(item.size(), 1);
+    ASSERT_EQ(*static_cast<float *>(item[0]->addr), expect[i]);
+  }
+}
+}  // namespace kernel
+}  // namespace mindspore
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <map>
 #include <vector>
 #include "common/common_test.h"
 #include "plugin/device/cpu/kernel/sparse_optimizer_cpu_kernel.h"
@@ -130,5 +131,41 @@ TEST_F(CommonUtilTest, BucketReduceSparseGradient2) {
     EXPECT_EQ(unique_grad.value_[i], expect_value[i]);
   }
 }
+
+TEST_F(CommonUtilTest, BucketReduceSparseGradientBySort) {
+  // The indices is a vector and the grad is a tensor with shape (6, 2), the index 301 is out of range
+  std::vector<int> indices{300, 2, 300, 7, 2, 301};
+  std::vector<float> grad;
+  for (int i = 0; i < 6 * 2; i++) {
+    grad.push_back(i);
+  }
+  std::vector<int> unique_indices(6);
+  std::vector<float> summed_grad(12);
+  std::vector<int> tmp_indices(6);
+  std::vector<float> tmp_grad(12);
+  SparseGradient<int> unique_grad({summed_grad.data(), unique_indices.data(), 6});
+  SparseGradient<int> workspace_grad({tmp_grad.data(), tmp_indices.data(), 6});
+  SparseGradient<int> input_grad({grad.data(), indices.data(), 6});
+
+  ReduceSparseGradientParam<int> param;
+  param.input_grad_ = &input_grad;
+  param.workspace_grad_ = &workspace_grad;
+  param.output_grad_ = &unique_grad;
+  param.max_index_ = 301;
+  param.value_stride_ = 2;
+  param.use_sort_reduce_ = true;
+  SparseOptimizerCpuKernelMod::BucketReduceSparseGradient(param);
+
+  // The order of the unique indices depends on the buckets, check the summed value of each index.
+  EXPECT_EQ(unique_grad.indices_size_, 3);
+  std::map<int, std::vector<float>> expect_values{{2, {10, 12}}, {7, {6, 7}}, {300, {4, 6}}};
+  for (size_t i = 0; i < unique_grad.indices_size_; ++i) {
+    auto iter = expect_values.find(unique_grad.indices_[i]);
+    ASSERT_TRUE(iter != expect_values.end());
+    EXPECT_EQ(unique_grad.value_[i * 2], iter->second[0]);
+    EXPECT_EQ(unique_grad.value_[i * 2 + 1], iter->second[1]);
+    (void)expect_values.erase(iter);
+  }
+}
 }  // namespace kernel
 }  // namespace mindspore
@@ -0,0 +1,122 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utils/log_adapter.h"
+#include "minddata/mindrecord/include/shard_columnar_index.h"
+#include "ut_common.h"
+
+namespace mindspore {
+namespace mindrecord {
+class TestShardColumnarIndex : public UT::Common {
+ public:
+  TestShardColumnarIndex() {}
+};
+
+namespace {
+// Two blob pages of two rows, the rows are added in the order of raw pages which is different from ROW_ID.
+ShardColumnarIndex BuildColumnarIndex() {
+  const std::vector<int> labels = {5, 3, 5, 10};
+  ShardColumnarIndex index;
+  for (int row_id : {2, 3, 0, 1}) {
+    std::vector<std::tuple<std::string, std::string, std::string>> row;
+    row.emplace_back(":ROW_ID", "INTEGER", std::to_string(row_id));
+    row.emplace_back(":ROW_GROUP_ID", "INTEGER", std::to_string(row_id / 2));
+    row.emplace_back(":PAGE_ID_RAW", "INTEGER", "7");
+    row.emplace_back(":PAGE_OFFSET_RAW", "INTEGER", std::to_string(row_id * 10));
+    row.emplace_back(":PAGE_OFFSET_RAW_END", "INTEGER", std::to_string(row_id * 10 + 10));
+    row.emplace_back(":PAGE_ID_BLOB", "INTEGER", std::to_string(row_id / 2));
+    row.emplace_back(":PAGE_OFFSET_BLOB", "INTEGER", std::to_string(row_id * 100));
+    row.emplace_back(":PAGE_OFFSET_BLOB_END", "INTEGER", std::to_string(row_id * 100 + 100));
+    row.emplace_back(":INC_0", "INTEGER", "0");
+    row.emplace_back(":label_0", "INTEGER", std::to_string(labels[row_id]));
+    row.emplace_back(":INC_1", "INTEGER", "0");
+    row.emplace_back(":file_name_0", "TEXT", "file" + std::to_string(row_id % 2));
+    EXPECT_TRUE(index.AddRow(row).IsOk());
+  }
+  return index;
+}
+}  // namespace
+
+/// Feature: ShardColumnarIndex
+/// Description: Test save and load the columnar index, then filter and select the rows
+/// Expectation: The rows are sorted by ROW_ID and the query results are the same as the sqlite meta file
+TEST_F(TestShardColumnarIndex, TestSaveLoadQuery) {
+  const std::string file_path = "./columnar_index_test.mindrecord" + std::string(kColumnarIndexSuffix);
+  auto index = BuildColumnarIndex();
+  ASSERT_TRUE(index.Save(file_path, "columnar_index_test.mindrecord").IsOk());
+  std::shared_ptr<ShardColumnarIndex> loaded;
+  ASSERT_TRUE(ShardColumnarIndex::Load(file_path, &loaded).IsOk());
+  ASSERT_EQ(loaded->GetShardName(), "columnar_index_test.mindrecord");
+  ASSERT_EQ(loaded->GetNumRows(), 4);
+
+  // the number field is sorted by value
+  std::vector<std::string> values;
+  ASSERT_TRUE(loaded->GetDistinctValues("label_0", &values).IsOk());
+  ASSERT_EQ(values, std::vector<std::string>({"3", "5", "10"}));
+
+  std::vector<uint64_t> rows;
+  ASSERT_TRUE(loaded->Filter(-1, {"label_0", "5"}, &rows).IsOk());
+  ASSERT_EQ(rows, std::vector<uint64_t>({0, 2}));
+  ASSERT_TRUE(loaded->Filter(1, {"label_0", "5"}, &rows).IsOk());
+  ASSERT_EQ(rows, std::vector<uint64_t>({2}));
+  ASSERT_TRUE(loaded->Filter(0, {"", ""}, &rows).IsOk());
+  ASSERT_EQ(rows, std::vector<uint64_t>({0, 1}));
+  ASSERT_TRUE(loaded->Filter(-1, {"file_name_0", "file1"}, &rows).IsOk());
+  ASSERT_EQ(rows, std::vector<uint64_t>({1, 3}));
+  ASSERT_TRUE(loaded->Filter(-1, {"label_0", "4"}, &rows).IsOk());
+  ASSERT_TRUE(rows.empty());
+  ASSERT_TRUE(loaded->Filter(3, {"", ""}, &rows).IsOk());
+  ASSERT_TRUE(rows.empty());
+  ASSERT_EQ(loaded->GetRowsByRowId(2), std::vector<uint64_t>({2}));
+
+  std::vector<std::vector<std::string>> records;
+  ASSERT_TRUE(
+    loaded->Select({"ROW_GROUP_ID", "PAGE_OFFSET_BLOB", "label_0", "file_name_0"}, loaded->GetAllRows(), &records)
+      .IsOk());
+  ASSERT_EQ(records.size(), 4);
+  ASSERT_EQ(records[3], std::vector<std::string>({"1", "300", "10", "file1"}));
+  ASSERT_FALSE(loaded->Select({"unknown_0"}, rows, &records).IsOk());
+  (void)std::remove(file_path.c_str());
+}
+
+/// Feature: ShardColumnarIndex
+/// Description: Test load the truncated columnar index file
+/// Expectation: The loading fails, so the reader falls back to the sqlite meta file
+TEST_F(TestShardColumnarIndex, TestLoadTruncatedFile) {
+  const std::string file_path = "./columnar_index_truncated.mindrecord" + std::string(kColumnarIndexSuffix);
+  auto index = BuildColumnarIndex();
+  ASSERT_TRUE(index.Save(file_path, "columnar_index_truncated.mindrecord").IsOk());
+  std::ifstream in(file_path, std::ios::binary);
+  std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream out(file_path, std::ios::binary | std::ios::trunc);
+  out.write(content.data(), static_cast<std::streamsize>(content.size() / 2));
+  out.close();
+  std::shared_ptr<ShardColumnarIndex> loaded;
+  ASSERT_FALSE(ShardColumnarIndex::Load(file_path, &loaded).IsOk());
+  (void)std::remove(file_path.c_str());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
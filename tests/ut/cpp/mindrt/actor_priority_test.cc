@@ -0,0 +1,121 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "async/async.h"
+#include "thread/actor_threadpool.h"
+
+namespace mindspore {
+namespace {
+// The actor which occupies the only actor thread until the gate is opened, so the other actors stay in the ready queue.
+class GateActor : public ActorBase {
+ public:
+  GateActor(const std::string &name, std::shared_future<void> open) : ActorBase(name), open_(std::move(open)) {}
+  ~GateActor() override = default;
+
+  void Wait() {
+    entered_.set_value();
+    open_.wait();
+  }
+  std::future<void> GetEnteredFuture() { return entered_.get_future(); }
+
+ private:
+  std::shared_future<void> open_;
+  std::promise<void> entered_;
+};
+
+// The run order of the actors, and the promise fulfilled when the expected number of actors have run.
+struct RunOrder {
+  std::mutex mutex;
+  std::vector<std::string> names;
+  size_t expected_num{0};
+  std::promise<void> done;
+};
+
+class RecordActor : public ActorBase {
+ public:
+  RecordActor(const std::string &name, RunOrder *run_order) : ActorBase(name), run_order_(run_order) {}
+  ~RecordActor() override = default;
+
+  void Record() {
+    std::lock_guard<std::mutex> lock(run_order_->mutex);
+    run_order_->names.push_back(GetAID().Name());
+    if (run_order_->names.size() == run_order_->expected_num) {
+      run_order_->done.set_value();
+    }
+  }
+
+ private:
+  RunOrder *run_order_;
+};
+}  // namespace
+
+class TestActorPriority : public UT::Common {
+ public:
+  TestActorPriority() {}
+  void TearDown() override { ActorThreadPool::set_enable_priority_schedule(false); }
+};
+
+/// Feature: Priority schedule of actor thread pool
+/// Description: Make the actors ready in the order of low, high and middle priority while the only actor thread is busy
+/// Expectation: The actors run in the descending order of priority after the actor thread is free
+TEST_F(TestActorPriority, test_ready_queue_order) {
+  ActorThreadPool::set_enable_priority_schedule(true);
+  auto thread_pool = ActorThreadPool::CreateThreadPool(1);
+  ASSERT_NE(thread_pool, nullptr);
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+
+  std::promise<void> open;
+  auto gate = std::make_shared<GateActor>("gate_actor", open.get_future().share());
+  auto entered = gate->GetEnteredFuture();
+  gate->set_thread_pool(thread_pool);
+  auto gate_aid = actor_manager->Spawn(gate);
+
+  RunOrder run_order;
+  run_order.expected_num = 3;
+  auto done = run_order.done.get_future();
+  std::vector<std::pair<std::string, int64_t>> actor_priorities = {{"low", 1}, {"high", 3}, {"middle", 2}};
+  std::vector<AID> aids;
+  for (const auto &actor_priority : actor_priorities) {
+    auto actor = std::make_shared<RecordActor>(actor_priority.first, &run_order);
+    actor->set_thread_pool(thread_pool);
+    actor->set_priority(actor_priority.second);
+    (void)aids.emplace_back(actor_manager->Spawn(actor));
+  }
+
+  Async(gate_aid, &GateActor::Wait);
+  entered.wait();
+  for (const auto &aid : aids) {
+    Async(aid, &RecordActor::Record);
+  }
+  open.set_value();
+  done.wait();
+
+  std::vector<std::string> expect_names = {"high", "middle", "low"};
+  ASSERT_EQ(run_order.names, expect_names);
+  actor_manager->Terminate(gate_aid);
+  for (const auto &aid : aids) {
+    actor_manager->Terminate(aid);
+  }
+  delete thread_pool;
+}
+}  // namespace mindspore
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "async/async.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kChainActorNum = 10000;
+constexpr size_t kChainStepNum = 10;
+
+class ChainActor : public ActorBase {
+ public:
+  explicit ChainActor(const std::string &name) : ActorBase(name) {}
+  ~ChainActor() override = default;
+
+  void RunOpData(size_t *const hop_count, void *const context) { ++(*hop_count); }
+};
+
+// Pass the message through the chain of actors step by step, which emulates the data arrows between the kernel
+// actors, and return the addresses of the messages in the last step.
+template <typename MakeMessage>
+std::vector<MessageBase *> RunChain(const std::vector<std::unique_ptr<ChainActor>> &actors, size_t *hop_count,
+                                    const MakeMessage &make_message) {
+  std::vector<MessageBase *> msg_addrs;
+  for (size_t step = 0; step < kChainStepNum; ++step) {
+    msg_addrs.clear();
+    for (auto &actor : actors) {
+      auto msg = make_message(hop_count);
+      msg_addrs.push_back(msg.get());
+      msg->Run(actor.get());
+    }
+  }
+  return msg_addrs;
+}
+
+// The same captures as the handler created by Async for the actor method with arguments.
+struct ChainHandler {
+  void operator()(ActorBase *actor) const { (static_cast<ChainActor *>(actor)->*method)(hop_count, context); }
+  void (ChainActor::*method)(size_t *const, void *const);
+  size_t *hop_count;
+  void *context;
+};
+using PooledMessage = MessageAsyncCall<ChainHandler>;
+
+std::unique_ptr<MessageBase> MakePooledMessage(size_t *hop_count) {
+  return internal::MakeAsyncMessage(ChainHandler{&ChainActor::RunOpData, hop_count, nullptr});
+}
+
+std::unique_ptr<MessageBase> MakeFunctionMessage(size_t *hop_count) {
+  void *context = nullptr;
+  auto method = &ChainActor::RunOpData;
+  std::function<void(ActorBase *)> handler = [method, hop_count, context](ActorBase *actor) {
+    (static_cast<ChainActor *>(actor)->*method)(hop_count, context);
+  };
+  return std::make_unique<MessageAsync>(std::move(handler));
+}
+}  // namespace
+
+class TestAsync : public UT::Common {
+ public:
+  TestAsync() {}
+};
+
+/// Feature: ObjectPool
+/// Description: Test the memory block of the destroyed async message is reused by the next message
+/// Expectation: The next message has the same address, and the free blocks are cached by the thread
+TEST_F(TestAsync, test_object_pool_recycle) {
+  size_t hop_count = 0;
+  auto msg = MakePooledMessage(&hop_count);
+  auto msg_addr = msg.get();
+  auto free_block_num = ObjectPool<PooledMessage>::FreeBlockNum();
+  msg.reset();
+  ASSERT_EQ(ObjectPool<PooledMessage>::FreeBlockNum(), free_block_num + 1);
+  auto next_msg = MakePooledMessage(&hop_count);
+  ASSERT_EQ(next_msg.get(), msg_addr);
+  ASSERT_EQ(ObjectPool<PooledMessage>::FreeBlockNum(), free_block_num);
+}
+
+/// Feature: MessageAsyncCall
+/// Description: Benchmark the step overhead of a chain of 10k actors with the pooled messages and std::function ones
+/// Expectation: All the hops are run, and the steady state steps of pooled messages reuse the same memory block
+TEST_F(TestAsync, test_async_message_chain_benchmark) {
+  std::vector<std::unique_ptr<ChainActor>> actors;
+  for (size_t i = 0; i < kChainActorNum; ++i) {
+    actors.emplace_back(std::make_unique<ChainActor>("ChainActor" + std::to_string(i)));
+  }
+  auto benchmark = [&actors](const std::string &name, const auto &make_message) {
+    size_t hop_count = 0;
+    auto start = std::chrono::steady_clock::now();
+    auto msg_addrs = RunChain(actors, &hop_count, make_message);
+    auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    MS_LOG(INFO) << name << " runs " << kChainStepNum << " steps of " << kChainActorNum << " actors chain in "
+                 << cost.count() << " us, " << (cost.count() / kChainStepNum) << " us per step";
+    EXPECT_EQ(hop_count, kChainActorNum * kChainStepNum);
+    return msg_addrs;
+  };
+  (void)benchmark("std::function message", MakeFunctionMessage);
+  auto msg_addrs = benchmark("pooled message", MakePooledMessage);
+  for (auto msg_addr : msg_addrs) {
+    ASSERT_EQ(msg_addr, msg_addrs.front());
+  }
+}
+}  // namespace mindspore
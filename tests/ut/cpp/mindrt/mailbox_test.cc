@@ -0,0 +1,191 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "actor/mailbox.h"
+#include "async/async.h"
+#include "thread/actor_threadpool.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kProducerNum = 4;
+constexpr size_t kMsgNumPerProducer = 20000;
+constexpr size_t kActorThreadNum = 2;
+
+// Emulate the actor thread pool: the notify hook marks the actor ready, and the worker runs the actor until the
+// mailbox releases it, the same as ActorBase::Run. Return the sequences received from each producer.
+std::vector<std::vector<size_t>> RunMailBox(MailBox *mailbox) {
+  std::atomic<int64_t> ready_count{0};
+  mailbox->SetNotifyHook(std::make_unique<std::function<void()>>([&ready_count]() { ++ready_count; }));
+  const size_t total_msg_num = kProducerNum * kMsgNumPerProducer;
+  size_t received_num = 0;
+  std::vector<std::vector<size_t>> received_seqs(kProducerNum);
+  auto handle_msg = [&received_num, &received_seqs](const std::unique_ptr<MessageBase> &msg) {
+    auto producer = std::stoul(msg->Name());
+    received_seqs[producer].push_back(std::stoul(msg->Body()));
+    ++received_num;
+  };
+  std::thread worker([&]() {
+    while (received_num < total_msg_num) {
+      if (ready_count.load() == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      --ready_count;
+      if (mailbox->TakeAllMsgsEachTime()) {
+        while (auto msgs = mailbox->GetMsgs()) {
+          for (auto &msg : *msgs) {
+            handle_msg(msg);
+          }
+          msgs->clear();
+        }
+      } else {
+        while (auto msg = mailbox->GetMsg()) {
+          handle_msg(msg);
+        }
+      }
+    }
+  });
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducerNum; ++i) {
+    producers.emplace_back([mailbox, i]() {
+      for (size_t seq = 1; seq <= kMsgNumPerProducer; ++seq) {
+        auto msg = std::make_unique<MessageBase>(AID(), AID(), std::to_string(i), std::to_string(seq));
+        (void)mailbox->EnqueueMessage(std::move(msg));
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  worker.join();
+  // The actor must be released after all messages are taken, and never be scheduled twice at the same time.
+  EXPECT_EQ(ready_count.load(), 0);
+  return received_seqs;
+}
+
+// Each producer's messages are all received exactly once and in the order they are sent.
+void CheckReceivedSeqs(const std::vector<std::vector<size_t>> &received_seqs) {
+  ASSERT_EQ(received_seqs.size(), kProducerNum);
+  for (const auto &seqs : received_seqs) {
+    ASSERT_EQ(seqs.size(), kMsgNumPerProducer);
+    for (size_t i = 0; i < seqs.size(); ++i) {
+      ASSERT_EQ(seqs[i], i + 1);
+    }
+  }
+}
+
+// The actor which counts the messages from the producers and fulfills the promise when all of them are received.
+class SinkActor : public ActorBase {
+ public:
+  SinkActor(const std::string &name, size_t total_msg_num) : ActorBase(name), total_msg_num_(total_msg_num) {}
+  ~SinkActor() override = default;
+
+  void Receive(size_t producer, size_t seq) {
+    in_order_ = in_order_ && (seq == last_seq_[producer] + 1);
+    last_seq_[producer] = seq;
+    if (++received_num_ == total_msg_num_) {
+      done_.set_value(in_order_);
+    }
+  }
+  std::future<bool> GetFuture() { return done_.get_future(); }
+
+ private:
+  size_t total_msg_num_;
+  size_t received_num_{0};
+  bool in_order_{true};
+  std::vector<size_t> last_seq_ = std::vector<size_t>(kProducerNum, 0);
+  std::promise<bool> done_;
+};
+
+// Spawn the sink actor with the mailbox, send the messages of all the producers to it by Async, and return the time
+// until the last message is handled. The actor shares the threads of the actor thread pool, or it occupies one of them
+// with the blocking mailbox.
+int64_t RunSinkActor(const std::string &name, MailBoxType mailbox_type, bool share_thread) {
+  auto actor = std::make_shared<SinkActor>(name, kProducerNum * kMsgNumPerProducer);
+  auto done = actor->GetFuture();
+  auto thread_pool = ActorThreadPool::CreateThreadPool(kActorThreadNum);
+  MS_EXCEPTION_IF_NULL(thread_pool);
+  actor->set_thread_pool(thread_pool);
+  actor->set_mailbox_type(mailbox_type);
+  auto actor_manager = ActorMgr::GetActorMgrRef();
+  auto aid = actor_manager->Spawn(actor, share_thread);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < kProducerNum; ++i) {
+    producers.emplace_back([&aid, i]() {
+      for (size_t seq = 1; seq <= kMsgNumPerProducer; ++seq) {
+        Async(aid, &SinkActor::Receive, i, seq);
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  EXPECT_TRUE(done.get());
+  auto cost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+  actor_manager->Terminate(aid);
+  delete thread_pool;
+  return cost.count();
+}
+}  // namespace
+
+class TestMailBox : public UT::Common {
+ public:
+  TestMailBox() {}
+};
+
+/// Feature: LockFreeMailBox
+/// Description: Test the messages enqueued by multiple producers are consumed by the actor worker
+/// Expectation: All the messages are received in the order of each producer, and the actor is released at last
+TEST_F(TestMailBox, test_lock_free_mailbox) {
+  LockFreeMailBox mailbox;
+  ASSERT_FALSE(mailbox.TakeAllMsgsEachTime());
+  ASSERT_EQ(mailbox.GetMsg(), nullptr);
+  CheckReceivedSeqs(RunMailBox(&mailbox));
+  ASSERT_EQ(mailbox.GetMsg(), nullptr);
+}
+
+/// Feature: NonblockingMailBox
+/// Description: Test the messages enqueued by multiple producers are taken in batches by the actor worker
+/// Expectation: All the messages are received in the order of each producer, and the actor is released at last
+TEST_F(TestMailBox, test_nonblocking_mailbox) {
+  NonblockingMailBox mailbox;
+  ASSERT_TRUE(mailbox.TakeAllMsgsEachTime());
+  CheckReceivedSeqs(RunMailBox(&mailbox));
+}
+
+/// Feature: LockFreeMailBox
+/// Description: Benchmark the lock-free mailbox against the mutex based mailboxes with the actor on ActorThreadPool
+/// Expectation: Every mailbox delivers all the messages in the order of each producer
+TEST_F(TestMailBox, test_mailbox_benchmark) {
+  auto lock_free_cost = RunSinkActor("LockFreeSinkActor", MailBoxType::kLockFree, true);
+  auto nonblocking_cost = RunSinkActor("NonblockingSinkActor", MailBoxType::kNonblocking, true);
+  auto blocking_cost = RunSinkActor("BlockingSinkActor", MailBoxType::kNonblocking, false);
+  MS_LOG(INFO) << kProducerNum << " producers send " << (kProducerNum * kMsgNumPerProducer)
+               << " messages to one actor, LockFreeMailBox on ActorThreadPool: " << lock_free_cost
+               << " us, NonblockingMailBox on ActorThreadPool: " << nonblocking_cost
+               << " us, BlockingMailBox on ActorThreadPool: " << blocking_cost << " us";
+}
+}  // namespace mindspore
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "thread/work_stealing_deque.h"
+
+namespace mindspore {
+class TestWorkStealingDeque : public UT::Common {
+ public:
+  TestWorkStealingDeque() {}
+};
+
+/// Feature: WorkStealingDeque
+/// Description: Test the push, pop and steal of the deque in single thread
+/// Expectation: The owner pops in LIFO order, the thief steals in FIFO order and the push fails when full
+TEST_F(TestWorkStealingDeque, test_push_pop_steal) {
+  std::vector<int> values = {0, 1, 2, 3};
+  WorkStealingDeque<int> deque(3);
+  ASSERT_TRUE(deque.Empty());
+  ASSERT_EQ(deque.Pop(), nullptr);
+  ASSERT_EQ(deque.Steal(), nullptr);
+  for (auto &value : values) {
+    ASSERT_TRUE(deque.Push(&value));
+  }
+  int extra = 4;
+  ASSERT_FALSE(deque.Push(&extra));
+  ASSERT_EQ(deque.Pop(), &values[3]);
+  ASSERT_EQ(deque.Steal(), &values[0]);
+  ASSERT_EQ(deque.Pop(), &values[2]);
+  ASSERT_EQ(deque.Steal(), &values[1]);
+  ASSERT_TRUE(deque.Empty());
+  ASSERT_EQ(deque.Pop(), nullptr);
+}
+
+/// Feature: WorkStealingDeque
+/// Description: Test the owner pushes and pops while the other threads steal concurrently
+/// Expectation: Each value is taken exactly once
+TEST_F(TestWorkStealingDeque, test_concurrent_steal) {
+  constexpr size_t kValueNum = 100000;
+  constexpr size_t kThiefNum = 3;
+  std::vector<int> values(kValueNum, 0);
+  std::vector<std::atomic<int>> taken_counts(kValueNum);
+  WorkStealingDeque<int> deque(64);
+  std::atomic_bool done{false};
+  auto take = [&values, &taken_counts](int *value) { ++taken_counts[static_cast<size_t>(value - values.data())]; };
+
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < kThiefNum; ++i) {
+    thieves.emplace_back([&deque, &done, &take]() {
+      while (!done.load() || !deque.Empty()) {
+        auto value = deque.Steal();
+        if (value != nullptr) {
+          take(value);
+        }
+      }
+    });
+  }
+  for (size_t i = 0; i < kValueNum; ++i) {
+    while (!deque.Push(&values[i])) {
+      auto value = deque.Pop();
+      if (value != nullptr) {
+        take(value);
+      }
+    }
+    if (i % 3 == 0) {
+      auto value = deque.Pop();
+      if (value != nullptr) {
+        take(value);
+      }
+    }
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  for (size_t i = 0; i < kValueNum; ++i) {
+    ASSERT_EQ(taken_counts[i].load(), 1);
+  }
+}
+}  // namespace mindspore
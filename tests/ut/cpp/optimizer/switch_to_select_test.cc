@@ -0,0 +1,115 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "ir/anf.h"
+#include "ir/manager.h"
+#include "frontend/operator/ops.h"
+#include "frontend/optimizer/irpass/branch_culling.h"
+#include "include/common/utils/utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace opt {
+namespace {
+constexpr auto kSwitchToSelectEnv = "MS_DEV_SWITCH_TO_SELECT";
+
+abstract::AbstractTensorPtr MakeTensorAbstract(const TypePtr &type, const ShapeVector &shape) {
+  return std::make_shared<abstract::AbstractTensor>(type, std::make_shared<abstract::Shape>(shape));
+}
+
+// The branch graph which applies the unary primitive on the free variable x of the root graph.
+FuncGraphPtr MakeBranch(const PrimitivePtr &prim, const AnfNodePtr &x) {
+  auto branch = std::make_shared<FuncGraph>();
+  auto output = branch->NewCNode({NewValueNode(prim), x});
+  output->set_abstract(x->abstract()->Clone());
+  branch->set_output(output);
+  return branch;
+}
+
+// Build root(x, cond) = switch(cond, true_branch, false_branch)(), and return the root graph.
+FuncGraphPtr MakeSwitchGraph(const PrimitivePtr &true_prim, const PrimitivePtr &false_prim, const ShapeVector &shape,
+                             const ShapeVector &cond_shape) {
+  auto root = std::make_shared<FuncGraph>();
+  auto x = root->add_parameter();
+  x->set_abstract(MakeTensorAbstract(kFloat32, shape));
+  auto cond = root->add_parameter();
+  cond->set_abstract(MakeTensorAbstract(kBool, cond_shape));
+  auto switch_node = root->NewCNode({NewValueNode(prim::kPrimSwitch), cond, NewValueNode(MakeBranch(true_prim, x)),
+                                     NewValueNode(MakeBranch(false_prim, x))});
+  auto call = root->NewCNode({switch_node});
+  call->set_abstract(x->abstract()->Clone());
+  root->set_output(call);
+  (void)Manage(root, true);
+  return root;
+}
+}  // namespace
+
+class TestSwitchToSelect : public UT::Common {
+ public:
+  TestSwitchToSelect() {}
+  void SetUp() override { (void)common::SetEnv(kSwitchToSelectEnv, "1"); }
+  void TearDown() override { (void)unsetenv(kSwitchToSelectEnv); }
+};
+
+/// Feature: SwitchSmallBranchToSelect
+/// Description: Convert the switch of the small finite branches with a scalar condition
+/// Expectation: The call of switch is replaced by the select of both inlined branches and the broadcast condition
+TEST_F(TestSwitchToSelect, test_convert_small_branch) {
+  auto root = MakeSwitchGraph(prim::kPrimNeg, prim::kPrimAbs, {2, 3}, {});
+  ASSERT_TRUE(irpass::SwitchSmallBranchToSelect()(root, nullptr));
+  auto output = root->output();
+  ASSERT_TRUE(IsPrimitiveCNode(output, prim::kPrimSelect));
+  auto select = output->cast<CNodePtr>();
+  ASSERT_TRUE(IsPrimitiveCNode(select->input(kIndex1), prim::kPrimBroadcastTo));
+  ASSERT_TRUE(IsPrimitiveCNode(select->input(kIndex2), prim::kPrimNeg));
+  ASSERT_TRUE(IsPrimitiveCNode(select->input(kIndex3), prim::kPrimAbs));
+}
+
+/// Feature: SwitchSmallBranchToSelect
+/// Description: Run the pass on the branch with log, which produces inf or nan for the input the branch is guarded from
+/// Expectation: The switch is kept, as select would run the branch on every input
+TEST_F(TestSwitchToSelect, test_reject_non_finite_branch) {
+  auto root = MakeSwitchGraph(prim::kPrimLog, prim::kPrimNeg, {2, 3}, {});
+  auto output = root->output();
+  ASSERT_FALSE(irpass::SwitchSmallBranchToSelect()(root, nullptr));
+  ASSERT_EQ(root->output(), output);
+  ASSERT_FALSE(IsPrimitiveCNode(root->output(), prim::kPrimSelect));
+}
+
+/// Feature: SwitchSmallBranchToSelect
+/// Description: Run the pass on the condition which can't be broadcast to the output shape
+/// Expectation: The switch is kept
+TEST_F(TestSwitchToSelect, test_reject_condition_shape) {
+  auto root = MakeSwitchGraph(prim::kPrimNeg, prim::kPrimAbs, {2, 3}, {2});
+  auto output = root->output();
+  ASSERT_FALSE(irpass::SwitchSmallBranchToSelect()(root, nullptr));
+  ASSERT_EQ(root->output(), output);
+}
+
+/// Feature: SwitchSmallBranchToSelect
+/// Description: Run the pass without MS_DEV_SWITCH_TO_SELECT=1
+/// Expectation: The pass is disabled by default and the switch is kept
+TEST_F(TestSwitchToSelect, test_disabled_by_default) {
+  (void)unsetenv(kSwitchToSelectEnv);
+  auto root = MakeSwitchGraph(prim::kPrimNeg, prim::kPrimAbs, {2, 3}, {});
+  auto output = root->output();
+  ASSERT_FALSE(irpass::SwitchSmallBranchToSelect()(root, nullptr));
+  ASSERT_EQ(root->output(), output);
+}
+}  // namespace opt
+}  // namespace mindspore
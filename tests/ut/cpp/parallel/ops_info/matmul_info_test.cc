@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cstdlib>
 #include <string>
 #include <list>
 #include <vector>
@@ -415,6 +416,29 @@ TEST_F(TestMatmulInfo, GetForwardOp2) {
   ASSERT_EQ(forward_op.size(), 0);
 }
 
+/// Feature: test matmul info
+/// Description: split the forward all reduce into chunks by MS_DEV_MATMUL_COMM_CHUNK_NUM
+/// Expectation: the forward op is moved into the replace graph only if the slice rows can be split
+TEST_F(TestMatmulInfo, GetForwardOpCommChunk) {
+  mindspore::HashMap<std::string, ValuePtr> attr = {{"transpose_a", MakeValue(false)},
+                                                    {"transpose_b", MakeValue(false)}};
+  Shapes inputs_shape = {{64, 32}, {32, 16}};
+  Shapes outputs_shape = {{64, 16}};
+  auto matmul = std::make_shared<MatMulInfo>("matmul_info", inputs_shape, outputs_shape, attr);
+  (void)setenv("MS_DEV_MATMUL_COMM_CHUNK_NUM", "4", 1);
+
+  Strategies inputs = {{2, 4}, {4, 1}};
+  ASSERT_EQ(matmul->Init(NewStrategy(0, inputs), nullptr), SUCCESS);
+  ASSERT_EQ(matmul->forward_op().size(), 0);
+
+  // the slice rows 64 / 32 can not be split into 4 chunks
+  inputs = {{32, 4}, {4, 1}};
+  ASSERT_EQ(matmul->Init(NewStrategy(0, inputs), nullptr), SUCCESS);
+  ASSERT_EQ(matmul->forward_op().size(), 1);
+  ASSERT_EQ(matmul->forward_op().at(0).first, "AllReduce");
+  (void)unsetenv("MS_DEV_MATMUL_COMM_CHUNK_NUM");
+}
+
 /// Feature: test matmul info
 /// Description: infer virtual_div op
 /// Expectation: the virtual_div op is right
@@ -0,0 +1,156 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "common/common_test.h"
+#include "frontend/parallel/graph_util/pipeline_split_utils.h"
+
+namespace mindspore {
+namespace parallel {
+namespace {
+// The schedule as "F0.1 B1.0 ...", each step is the forward or backward followed by its chunk and micro batch.
+std::string ScheduleString(const std::vector<PipelineScheduleStep> &schedule) {
+  std::string result;
+  for (const auto &step : schedule) {
+    if (!result.empty()) {
+      result += " ";
+    }
+    result += (step.is_forward ? "F" : "B") + std::to_string(step.chunk) + "." + std::to_string(step.micro);
+  }
+  return result;
+}
+
+// Run the schedules of all the stages together, a step runs when the step it depends on ran in an earlier round. The
+// forward of the virtual stage v depends on the forward of v - 1, and the backward depends on the backward of v + 1 or
+// the forward of v on the last virtual stage. Return false if the schedules can't run to the end.
+bool RunSchedules(int64_t stage_num, int64_t micro_size, int64_t chunk_num) {
+  using Step = std::tuple<bool, int64_t, int64_t>;
+  std::vector<std::vector<PipelineScheduleStep>> schedules;
+  for (int64_t stage_id = 0; stage_id < stage_num; ++stage_id) {
+    schedules.push_back(PipelineSchedule(stage_num, stage_id, micro_size, chunk_num));
+  }
+  auto virtual_stage_num = stage_num * chunk_num;
+  std::set<Step> done;
+  std::vector<size_t> positions(LongToSize(stage_num), 0);
+  bool progress = true;
+  while (progress) {
+    progress = false;
+    std::vector<Step> finished;
+    for (int64_t stage_id = 0; stage_id < stage_num; ++stage_id) {
+      auto &position = positions[LongToSize(stage_id)];
+      const auto &schedule = schedules[LongToSize(stage_id)];
+      if (position == schedule.size()) {
+        continue;
+      }
+      const auto &step = schedule[position];
+      auto virtual_stage = step.chunk * stage_num + stage_id;
+      bool ready = true;
+      if (step.is_forward && virtual_stage > 0) {
+        ready = done.count(Step(true, virtual_stage - 1, step.micro)) != 0;
+      } else if (!step.is_forward) {
+        ready = virtual_stage == virtual_stage_num - 1 ? done.count(Step(true, virtual_stage, step.micro)) != 0
+                                                       : done.count(Step(false, virtual_stage + 1, step.micro)) != 0;
+      }
+      if (ready) {
+        finished.emplace_back(step.is_forward, virtual_stage, step.micro);
+        ++position;
+        progress = true;
+      }
+    }
+    done.insert(finished.begin(), finished.end());
+  }
+  return SizeToLong(done.size()) == virtual_stage_num * micro_size * 2;
+}
+}  // namespace
+
+class TestPipelineSchedule : public UT::Common {
+ public:
+  TestPipelineSchedule() = default;
+  virtual ~TestPipelineSchedule() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: PipelineSchedule
+/// Description: Schedule 8 micro batches on the first and last of 4 stages without virtual stages
+/// Expectation: The stages warm up with the forward of the micro batches before the last stage, then run 1F1B
+TEST_F(TestPipelineSchedule, test_one_forward_one_backward) {
+  ASSERT_EQ(ScheduleString(PipelineSchedule(4, 0, 8, 1)),
+            "F0.0 F0.1 F0.2 F0.3 B0.0 F0.4 B0.1 F0.5 B0.2 F0.6 B0.3 F0.7 B0.4 B0.5 B0.6 B0.7");
+  ASSERT_EQ(ScheduleString(PipelineSchedule(4, 3, 8, 1)),
+            "F0.0 B0.0 F0.1 B0.1 F0.2 B0.2 F0.3 B0.3 F0.4 B0.4 F0.5 B0.5 F0.6 B0.6 F0.7 B0.7");
+}
+
+/// Feature: PipelineSchedule
+/// Description: Schedule 4 micro batches on 2 stages, each of which has 2 virtual stages
+/// Expectation: The micro batches go through the chunks in groups of 2, and the backward goes in the reversed order
+TEST_F(TestPipelineSchedule, test_interleaved) {
+  ASSERT_EQ(ScheduleString(PipelineSchedule(2, 0, 4, 2)),
+            "F0.0 F0.1 F1.0 F1.1 F0.2 B1.0 F0.3 B1.1 F1.2 B0.0 F1.3 B0.1 B1.2 B1.3 B0.2 B0.3");
+  ASSERT_EQ(ScheduleString(PipelineSchedule(2, 1, 4, 2)),
+            "F0.0 F0.1 F1.0 B1.0 F1.1 B1.1 F0.2 B0.0 F0.3 B0.1 F1.2 B1.2 F1.3 B1.3 B0.2 B0.3");
+}
+
+/// Feature: PipelineSchedule
+/// Description: Schedule as many micro batches as the stages, each of which has 2 virtual stages
+/// Expectation: All the forward steps run before the backward steps
+TEST_F(TestPipelineSchedule, test_interleaved_one_group) {
+  ASSERT_EQ(ScheduleString(PipelineSchedule(2, 1, 2, 2)), "F0.0 F0.1 F1.0 F1.1 B1.0 B1.1 B0.0 B0.1");
+}
+
+/// Feature: PipelineSchedule
+/// Description: Schedule the micro batches on the stages with or without virtual stages
+/// Expectation: Each stage runs the forward and backward of each micro batch on each chunk once, and the schedules of
+/// all the stages run to the end
+TEST_F(TestPipelineSchedule, test_schedule_complete) {
+  const std::vector<std::tuple<int64_t, int64_t, int64_t>> configs = {{4, 4, 1}, {4, 7, 1}, {4, 8, 2},
+                                                                       {4, 12, 3}, {3, 3, 4}, {2, 8, 4}};
+  for (const auto &[stage_num, micro_size, chunk_num] : configs) {
+    for (int64_t stage_id = 0; stage_id < stage_num; ++stage_id) {
+      auto schedule = PipelineSchedule(stage_num, stage_id, micro_size, chunk_num);
+      ASSERT_EQ(SizeToLong(schedule.size()), micro_size * chunk_num * 2);
+      std::map<std::pair<int64_t, int64_t>, size_t> forward_index;
+      std::set<std::pair<int64_t, int64_t>> backward;
+      for (size_t i = 0; i < schedule.size(); ++i) {
+        auto key = std::make_pair(schedule[i].chunk, schedule[i].micro);
+        ASSERT_TRUE(key.first >= 0 && key.first < chunk_num && key.second >= 0 && key.second < micro_size);
+        if (schedule[i].is_forward) {
+          ASSERT_TRUE(forward_index.emplace(key, i).second);
+        } else {
+          ASSERT_EQ(forward_index.count(key), 1);
+          ASSERT_TRUE(backward.insert(key).second);
+        }
+      }
+    }
+    ASSERT_TRUE(RunSchedules(stage_num, micro_size, chunk_num))
+      << "stage num: " << stage_num << ", micro size: " << micro_size << ", chunk num: " << chunk_num;
+  }
+}
+
+/// Feature: PipelineSchedule
+/// Description: Schedule the micro batches which are not a multiple of the stages on the virtual stages
+/// Expectation: Throw exception
+TEST_F(TestPipelineSchedule, test_interleaved_invalid_micro_size) {
+  EXPECT_ANY_THROW(PipelineSchedule(4, 0, 6, 2));
+  EXPECT_ANY_THROW(PipelineSchedule(4, 0, 2, 1));
+  EXPECT_ANY_THROW(PipelineSchedule(4, 4, 8, 1));
+}
+}  // namespace parallel
+}  // namespace mindspore
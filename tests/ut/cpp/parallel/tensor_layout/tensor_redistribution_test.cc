@@ -206,5 +206,31 @@ TEST_F(TestTensorRedistribution, TestInferRedistribution3) {
   ASSERT_EQ(op_names, expected_op_names);
 }
 
+/// Feature: Cache of the redistribution cost
+/// Description: Compute the cost of the same layout pair by two cost model redistributions
+/// Expectation: The cached cost equals the inferred cost
+TEST_F(TestTensorRedistribution, TestComputeCostCache) {
+  TensorLayout from_layout;
+  ASSERT_EQ(Status::SUCCESS, from_layout.InitFromVector({2, 4, 2}, {2, 0}, {512, 1024}));
+  TensorLayout to_layout;
+  ASSERT_EQ(Status::SUCCESS, to_layout.InitFromVector({4, 2, 2}, {2, 1}, {512, 1024}));
+  RankList dev_list = g_device_manager->GetDeviceListByStageId(0);
+
+  TensorRedistribution first(false);
+  ASSERT_EQ(Status::SUCCESS, first.Init(from_layout, to_layout, dev_list));
+  ASSERT_EQ(Status::SUCCESS, first.ComputeCost());
+  TensorRedistribution second(false);
+  ASSERT_EQ(Status::SUCCESS, second.Init(from_layout, to_layout, dev_list));
+  ASSERT_EQ(Status::SUCCESS, second.ComputeCost());
+
+  ASSERT_GT(first.comm_cost(), 0.0);
+  ASSERT_EQ(first.reshape_flag(), second.reshape_flag());
+  ASSERT_DOUBLE_EQ(first.comm_cost(), second.comm_cost());
+  ASSERT_DOUBLE_EQ(first.forward_comm_cost(), second.forward_comm_cost());
+  ASSERT_DOUBLE_EQ(first.backward_comm_cost(), second.backward_comm_cost());
+  ASSERT_DOUBLE_EQ(first.computation_cost(), second.computation_cost());
+  ASSERT_DOUBLE_EQ(first.memory_cost(), second.memory_cost());
+}
+
 }  // namespace parallel
 }  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include "common/common_test.h"
+#include "ir/func_graph.h"
+#include "abstract/abstract_value.h"
+#include "include/common/utils/utils.h"
+#include "plugin/device/gpu/hal/hardware/cuda_graph_utils.h"
+
+namespace mindspore {
+namespace device {
+namespace gpu {
+class TestCudaGraphUtils : public UT::Common {
+ public:
+  TestCudaGraphUtils() {}
+
+  // Build the kernel of the primitive with one float tensor input and output of the shape.
+  CNodePtr NewKernel(const PrimitivePtr &prim, const ShapeVector &shape = {2, 3}) {
+    auto abstract = std::make_shared<abstract::AbstractTensor>(kFloat32, std::make_shared<abstract::Shape>(shape));
+    auto input = graph_->add_parameter();
+    input->set_abstract(abstract);
+    auto kernel = graph_->NewCNode({NewValueNode(prim), input});
+    kernel->set_abstract(abstract->Clone());
+    return kernel;
+  }
+
+ protected:
+  FuncGraphPtr graph_ = std::make_shared<FuncGraph>();
+};
+
+/// Feature: Cuda graph capture of GPU graph executor
+/// Description: Check the common static shape kernel on the default stream
+/// Expectation: The kernel can be captured
+TEST_F(TestCudaGraphUtils, test_capturable_kernel) {
+  ASSERT_TRUE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(kAddOpName))));
+  ASSERT_TRUE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(kReluOpName))));
+}
+
+/// Feature: Cuda graph capture of GPU graph executor
+/// Description: Check the random kernels, whose generator offset advances on host in each launch
+/// Expectation: The dropout and the kernels with the seed attr can't be captured
+TEST_F(TestCudaGraphUtils, test_random_kernel) {
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(kDropoutOpName))));
+  auto standard_normal = std::make_shared<Primitive>(kStandardNormalOpName);
+  (void)standard_normal->AddAttr("seed", MakeValue<int64_t>(0));
+  (void)standard_normal->AddAttr("seed2", MakeValue<int64_t>(0));
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(standard_normal)));
+  auto custom_random = std::make_shared<Primitive>("CustomRandom");
+  (void)custom_random->AddAttr("Seed0", MakeValue<int64_t>(1));
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(custom_random)));
+}
+
+/// Feature: Cuda graph capture of GPU graph executor
+/// Description: Check the kernels which copy data with host or keep the containers on host
+/// Expectation: The data queue, print, stack, tensor array and replay buffer kernels can't be captured
+TEST_F(TestCudaGraphUtils, test_host_state_kernel) {
+  for (const std::string &name : {kGetNextOpName, "Print", kStackPushOpName, "TensorArrayWrite",
+                                  kPriorityReplayBufferPush, "ReservoirReplayBufferSample", "BufferAppend"}) {
+    ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(name)))) << name;
+  }
+}
+
+/// Feature: Cuda graph capture of GPU graph executor
+/// Description: Check the kernel on the other stream, the communication kernel and the dynamic shape kernel
+/// Expectation: None of them can be captured
+TEST_F(TestCudaGraphUtils, test_stream_communication_dynamic_kernel) {
+  auto stream_add = std::make_shared<Primitive>(kAddOpName);
+  (void)stream_add->AddAttr(kAttrStream, MakeValue<int64_t>(1));
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(stream_add)));
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(kAllReduceOpName))));
+  ASSERT_FALSE(IsCudaGraphCapturable(NewKernel(std::make_shared<Primitive>(kAddOpName), {-1, 3})));
+}
+}  // namespace gpu
+}  // namespace device
+}  // namespace mindspore
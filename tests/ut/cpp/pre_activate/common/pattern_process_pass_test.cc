@@ -31,6 +31,7 @@
 #include "ir/value.h"
 #include "include/common/utils/utils.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
+#include "ir/manager.h"
 
 namespace mindspore {
 namespace opt {
@@ -39,6 +40,21 @@ class TestPass : public PatternProcessPass {
   const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const { return nullptr; };
 };
 
+class TestMulPass : public PatternProcessPass {
+ public:
+  TestMulPass() : PatternProcessPass("test_mul_pass") {}
+  const BaseRef DefinePattern() const override {
+    VarPtr x = std::make_shared<Var>();
+    VarPtr y = std::make_shared<Var>();
+    return VectorRef({prim::kPrimMul, x, y});
+  }
+  const AnfNodePtr Process(const FuncGraphPtr &, const AnfNodePtr &, const EquivPtr &) const override {
+    ++process_count_;
+    return nullptr;
+  }
+  mutable size_t process_count_ = 0;
+};
+
 class TestPatternProcessPass : public UT::Common {
  public:
   TestPatternProcessPass() : TU() { fg = std::make_shared<FuncGraph>(); };
@@ -80,5 +96,29 @@ TEST_F(TestPatternProcessPass, test_GetOrigNodes) {
   orig_nodes = TU.GetOrigNodes();
   ASSERT_EQ(orig_nodes.size(), std::size_t(2));
 }
+
+/// Feature: Backend pass manager skips pattern passes by the root primitive
+/// Description: Run a pass rooted at Mul on graphs without and with a Mul node
+/// Expectation: The pass is only processed on the graph which contains a Mul node
+TEST_F(TestPatternProcessPass, test_SkipPassByRootPrimitive) {
+  auto pass = std::make_shared<TestMulPass>();
+  ASSERT_EQ(pass->RootPrimitiveName(), prim::kPrimMul->name());
+  auto pm = std::make_shared<PassManager>("test_pm");
+  pm->AddPass(pass);
+
+  auto add_graph = std::make_shared<FuncGraph>();
+  auto x = add_graph->add_parameter();
+  add_graph->set_output(add_graph->NewCNode({NewValueNode(prim::kPrimAdd), x, x}));
+  (void)Manage(add_graph, true);
+  ASSERT_FALSE(pm->Run(add_graph));
+  ASSERT_EQ(pass->process_count_, std::size_t(0));
+
+  auto mul_graph = std::make_shared<FuncGraph>();
+  auto y = mul_graph->add_parameter();
+  mul_graph->set_output(mul_graph->NewCNode({NewValueNode(prim::kPrimMul), y, y}));
+  (void)Manage(mul_graph, true);
+  ASSERT_FALSE(pm->Run(mul_graph));
+  ASSERT_EQ(pass->process_count_, std::size_t(1));
+}
 }  // namespace opt
 }  // namespace mindspore
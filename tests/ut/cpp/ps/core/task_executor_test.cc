@@ -0,0 +1,79 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "common/common_test.h"
+#include "ps/core/communicator/task_executor.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace mindspore {
+namespace ps {
+namespace core {
+class TestTaskExecutor : public UT::Common {
+ public:
+  TestTaskExecutor() = default;
+  virtual ~TestTaskExecutor() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: TaskExecutor batch dispatch
+/// Description: Submit a burst of tasks larger than the max dispatch batch size from several threads
+/// Expectation: Every submitted task runs exactly once
+TEST_F(TestTaskExecutor, SubmitBurstLargerThanBatch) {
+  constexpr size_t kThreadNum = 2;
+  constexpr size_t kSubmitThreadNum = 4;
+  constexpr size_t kTaskNumPerThread = kMaxDispatchBatchSize * 4 + 1;
+  constexpr size_t kTaskNum = kSubmitThreadNum * kTaskNumPerThread;
+  constexpr size_t kWaitTimeoutInMs = 30000;
+  std::vector<std::atomic<size_t>> run_counts(kTaskNum);
+  for (auto &count : run_counts) {
+    count = 0;
+  }
+  std::atomic<size_t> finished_num{0};
+  auto run_task = [&run_counts, &finished_num](size_t index) {
+    ++run_counts[index];
+    ++finished_num;
+  };
+
+  TaskExecutor executor(kThreadNum);
+  std::vector<std::thread> submit_threads;
+  for (size_t i = 0; i < kSubmitThreadNum; ++i) {
+    submit_threads.emplace_back([&executor, &run_task, i]() {
+      for (size_t j = 0; j < kTaskNumPerThread; ++j) {
+        EXPECT_TRUE(executor.Submit(run_task, i * kTaskNumPerThread + j));
+      }
+    });
+  }
+  for (auto &thread : submit_threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < kWaitTimeoutInMs && finished_num.load() < kTaskNum; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  ASSERT_EQ(finished_num.load(), kTaskNum);
+  for (size_t i = 0; i < kTaskNum; ++i) {
+    ASSERT_EQ(run_counts[i].load(), 1);
+  }
+}
+}  // namespace core
+}  // namespace ps
+}  // namespace mindspore
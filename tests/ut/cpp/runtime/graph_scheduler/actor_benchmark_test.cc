@@ -0,0 +1,295 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/graph_scheduler/scheduler_helper.h"
+#include "runtime/graph_scheduler/actor/memory_aware_actor.h"
+#include "runtime/graph_scheduler/actor/memory_manager_actor.h"
+#include "runtime/hardware/device_context.h"
+#include "thread/actor_threadpool.h"
+
+namespace mindspore {
+namespace runtime {
+using DeviceContextKey = device::DeviceContextKey;
+using DeviceAddressPtr = device::DeviceAddressPtr;
+using DeviceType = device::DeviceType;
+
+namespace {
+constexpr size_t kChainActorNum = 1000;
+constexpr size_t kFanActorNum = 1000;
+constexpr size_t kLoopBodyActorNum = 100;
+constexpr size_t kLoopCount = 10;
+constexpr size_t kWarmUpStepNum = 2;
+constexpr size_t kStepNum = 20;
+const std::vector<size_t> kThreadNums = {1, 2, 4, 8};
+
+class BenchmarkDeviceResManager : public device::DeviceResManager {
+ public:
+  BenchmarkDeviceResManager() = default;
+  ~BenchmarkDeviceResManager() override = default;
+
+  void *AllocateMemory(size_t size) const override { return nullptr; }
+  void FreeMemory(void *const ptr) const override {}
+  DeviceAddressPtr CreateDeviceAddress(void *const device_ptr, size_t device_size, const string &format,
+                                       TypeId type_id, const ShapeVector &shape) const override {
+    return nullptr;
+  }
+};
+
+class BenchmarkDeviceContext : public device::DeviceInterface<BenchmarkDeviceResManager> {
+ public:
+  explicit BenchmarkDeviceContext(const DeviceContextKey &device_context_key) : DeviceInterface(device_context_key) {}
+  ~BenchmarkDeviceContext() override = default;
+
+  void Initialize() override {}
+  DeviceType GetDeviceType() const override { return DeviceType::kCPU; }
+  device::RunMode GetRunMode(const FuncGraphPtr &func_graph) const override { return device::RunMode::kKernelMode; }
+};
+
+// The actor of the no-op kernel, which runs the same message path as the kernel actor: receive the input controls,
+// optionally request the memory manager actor and wait for the callback, then erase the inputs and send the outputs.
+class NoOpActor : public MemoryAwareActor {
+ public:
+  NoOpActor(const std::string &name, const AID &memory_manager_aid, const DeviceContext *device_context,
+            bool use_memory_manager)
+      : MemoryAwareActor(name, KernelTransformType::kKernelActor, nullptr, memory_manager_aid),
+        use_memory_manager_(use_memory_manager) {
+    (void)device_contexts_.emplace_back(device_context);
+  }
+  ~NoOpActor() override = default;
+
+  // Launch the actor without the input, which is the entry of the step like the data prepare actor.
+  void Launch(OpContext<DeviceTensor> *const context) { Run(context); }
+
+  void SendMemoryAllocReq(OpContext<DeviceTensor> *const context) override {
+    ActorDispatcher::Send(memory_manager_aid_, &MemoryManagerActor::AllocateMemory, &memory_alloc_list_,
+                          device_contexts_[0], context, GetAID());
+  }
+  void OnMemoryAllocFinish(OpContext<DeviceTensor> *const context) override { PostRun(context); }
+
+ protected:
+  void Run(OpContext<DeviceTensor> *const context) override {
+    if (use_memory_manager_) {
+      SendMemoryAllocReq(context);
+    } else {
+      PostRun(context);
+    }
+  }
+
+ private:
+  bool use_memory_manager_;
+  // The no-op kernel has no output memory, so only the message round trip of the memory manager actor is measured.
+  std::vector<DeviceTensor *> memory_alloc_list_;
+};
+
+// The tail of the loop body, which launches the entry again until the loop count like the loop count actor.
+class LoopActor : public NoOpActor {
+ public:
+  LoopActor(const std::string &name, const AID &memory_manager_aid, const DeviceContext *device_context,
+            const AID &entry_aid)
+      : NoOpActor(name, memory_manager_aid, device_context, false), entry_aid_(entry_aid) {}
+  ~LoopActor() override = default;
+
+ protected:
+  void Run(OpContext<DeviceTensor> *const context) override {
+    EraseInput(context);
+    if (++loop_count_ < kLoopCount) {
+      ActorDispatcher::Send(entry_aid_, &NoOpActor::Launch, context);
+      return;
+    }
+    loop_count_ = 0;
+    SET_OPCONTEXT_SUCCESS_RET((*context));
+  }
+
+ private:
+  AID entry_aid_;
+  size_t loop_count_{0};
+};
+
+enum class Topology { kChain, kFan, kLoop };
+
+struct BenchmarkResult {
+  double step_us{0};
+  size_t actor_run_num{0};
+  size_t msg_num{0};
+};
+
+class ActorGraphBenchmark {
+ public:
+  ActorGraphBenchmark(Topology topology, size_t thread_num, bool use_memory_manager)
+      : topology_(topology), thread_num_(thread_num), use_memory_manager_(use_memory_manager) {
+    device_context_ = std::make_shared<BenchmarkDeviceContext>(DeviceContextKey{"CPU", 0});
+    memory_manager_actor_ = std::make_shared<MemoryManagerActor>();
+    prefix_ = std::to_string(static_cast<int>(topology)) + "_" + std::to_string(thread_num) + "_" +
+              std::to_string(use_memory_manager) + "_";
+    BuildActors();
+  }
+  ~ActorGraphBenchmark() {
+    auto actor_manager = ActorMgr::GetActorMgrRef();
+    for (auto &actor : actors_) {
+      actor_manager->Terminate(actor->GetAID());
+    }
+    if (spawn_memory_manager_) {
+      actor_manager->Terminate(memory_manager_actor_->GetAID());
+    }
+    delete thread_pool_;
+  }
+
+  // Run the steps and return the average step time after the warm up steps.
+  BenchmarkResult Run() {
+    BenchmarkResult result;
+    for (size_t step = 0; step < kWarmUpStepNum + kStepNum; ++step) {
+      if (step == kWarmUpStepNum) {
+        start_ = std::chrono::steady_clock::now();
+      }
+      OpContext<DeviceTensor> op_context;
+      std::vector<Promise<int>> promises(1);
+      op_context.sequential_num_ = static_cast<int>(step);
+      op_context.results_ = &promises;
+      ActorDispatcher::Send(actors_.front()->GetAID(), &NoOpActor::Launch, &op_context);
+      auto future = promises[0].GetFuture();
+      future.Wait();
+      EXPECT_TRUE(future.IsOK());
+    }
+    auto cost = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start_);
+    result.step_us = cost.count() / kStepNum;
+    result.actor_run_num = (topology_ == Topology::kLoop) ? actors_.size() * kLoopCount : actors_.size();
+    result.msg_num = (topology_ == Topology::kLoop) ? (actors_.size() - 1) * kLoopCount : control_arrow_num_;
+    if (use_memory_manager_) {
+      // Each no-op actor except the loop actor sends the request to the memory manager actor and receives the callback.
+      auto alloc_num = (topology_ == Topology::kLoop) ? result.actor_run_num - kLoopCount : result.actor_run_num;
+      result.msg_num += 2 * alloc_num;
+    }
+    return result;
+  }
+
+ private:
+  std::shared_ptr<NoOpActor> NewActor(const std::string &name) {
+    auto actor = std::make_shared<NoOpActor>(prefix_ + name, memory_manager_actor_->GetAID(), device_context_.get(),
+                                             use_memory_manager_);
+    actors_.push_back(actor);
+    return actor;
+  }
+
+  void AddControlArrow(AbstractActor *const from_actor, AbstractActor *const to_actor) {
+    SchedulerHelper::AddControlArrow(from_actor, to_actor);
+    ++control_arrow_num_;
+  }
+
+  void BuildActors() {
+    auto entry = NewActor("entry");
+    if (topology_ == Topology::kChain) {
+      auto from_actor = entry;
+      for (size_t i = 0; i < kChainActorNum; ++i) {
+        auto to_actor = NewActor("chain_" + std::to_string(i));
+        AddControlArrow(from_actor.get(), to_actor.get());
+        from_actor = to_actor;
+      }
+    } else if (topology_ == Topology::kFan) {
+      // The fan in of the exit actor stresses the mailbox of a single actor.
+      std::vector<std::shared_ptr<NoOpActor>> fan_actors;
+      for (size_t i = 0; i < kFanActorNum; ++i) {
+        fan_actors.push_back(NewActor("fan_" + std::to_string(i)));
+        AddControlArrow(entry.get(), fan_actors.back().get());
+      }
+      auto exit = NewActor("exit");
+      for (auto &fan_actor : fan_actors) {
+        AddControlArrow(fan_actor.get(), exit.get());
+      }
+    } else {
+      std::shared_ptr<NoOpActor> from_actor = entry;
+      for (size_t i = 0; i < kLoopBodyActorNum; ++i) {
+        auto to_actor = NewActor("body_" + std::to_string(i));
+        AddControlArrow(from_actor.get(), to_actor.get());
+        from_actor = to_actor;
+      }
+      auto loop_actor = std::make_shared<LoopActor>(prefix_ + "loop", memory_manager_actor_->GetAID(),
+                                                    device_context_.get(), entry->GetAID());
+      actors_.push_back(loop_actor);
+      AddControlArrow(from_actor.get(), loop_actor.get());
+    }
+
+    auto actor_manager = ActorMgr::GetActorMgrRef();
+    thread_pool_ = ActorThreadPool::CreateThreadPool(thread_num_);
+    MS_EXCEPTION_IF_NULL(thread_pool_);
+    for (auto &actor : actors_) {
+      actor->set_thread_pool(thread_pool_);
+      (void)actor_manager->Spawn(actor, true);
+    }
+    // Bind single thread to the memory manager actor, the same as the graph scheduler, and reuse the one spawned by the
+    // graph scheduler if any.
+    spawn_memory_manager_ = (actor_manager->GetActor(memory_manager_actor_->GetAID()) == nullptr);
+    if (spawn_memory_manager_) {
+      (void)actor_manager->Spawn(memory_manager_actor_, false);
+    }
+  }
+
+  Topology topology_;
+  size_t thread_num_;
+  bool use_memory_manager_;
+  std::string prefix_;
+  std::shared_ptr<BenchmarkDeviceContext> device_context_;
+  std::shared_ptr<MemoryManagerActor> memory_manager_actor_;
+  std::vector<std::shared_ptr<NoOpActor>> actors_;
+  size_t control_arrow_num_{0};
+  bool spawn_memory_manager_{false};
+  ActorThreadPool *thread_pool_{nullptr};
+  std::chrono::steady_clock::time_point start_;
+};
+
+std::string TopologyName(Topology topology) {
+  switch (topology) {
+    case Topology::kChain:
+      return "chain";
+    case Topology::kFan:
+      return "fan";
+    default:
+      return "loop";
+  }
+}
+}  // namespace
+
+class ActorBenchmarkTest : public UT::Common {
+ public:
+  ActorBenchmarkTest() {}
+  void SetUp() override { ActorDispatcher::set_is_multi_thread_execution(true); }
+};
+
+/// Feature: Actor runtime benchmark.
+/// Description: Run the steps of the chain, fan and loop graphs of no-op actors across the thread numbers, with and
+/// without the memory manager actor requests.
+/// Expectation: All the steps succeed, and the step time, the per actor latency and the message throughput are logged.
+TEST_F(ActorBenchmarkTest, ActorGraphBenchmark) {
+  for (auto topology : {Topology::kChain, Topology::kFan, Topology::kLoop}) {
+    for (auto thread_num : kThreadNums) {
+      for (auto use_memory_manager : {false, true}) {
+        ActorGraphBenchmark benchmark(topology, thread_num, use_memory_manager);
+        auto result = benchmark.Run();
+        ASSERT_GT(result.actor_run_num, 0);
+        MS_LOG(INFO) << "The " << TopologyName(topology) << " graph with " << thread_num << " threads"
+                     << (use_memory_manager ? " and the memory manager actor" : "") << ": " << result.step_us
+                     << " us per step, " << (result.step_us / result.actor_run_num) << " us per actor, "
+                     << (result.msg_num / result.step_us) << " million messages per second.";
+      }
+    }
+  }
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <string>
+#include "common/common_test.h"
+#include "runtime/graph_scheduler/actor/fusion/fusion_cost_model.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr char kCostFile[] = "./fusion_cost_model_test.json";
+constexpr char kTinyKernel[] = "Default/Add-op1";
+constexpr char kHeavyKernel[] = "Default/MatMul-op2";
+// The host time of one running in units of second.
+constexpr double kShortTime = 1e-6;
+constexpr double kLongTime = 1e-4;
+}  // namespace
+
+class FusionCostModelTest : public UT::Common {
+ public:
+  FusionCostModelTest() {}
+  void SetUp() override {
+    (void)std::remove(kCostFile);
+    FusionCostModel::GetInstance().Initialize(kCostFile);
+  }
+  void TearDown() override {
+    FusionCostModel::GetInstance().Initialize("");
+    (void)std::remove(kCostFile);
+  }
+};
+
+/// Feature: Cost model of actor fusion.
+/// Description: Record the kernels whose actor overhead is larger or smaller than the launch time.
+/// Expectation: Only the kernel with enough records and the overhead larger than the launch time is tiny.
+TEST_F(FusionCostModelTest, IsTinyKernel) {
+  auto &cost_model = FusionCostModel::GetInstance();
+  ASSERT_TRUE(cost_model.enable());
+  constexpr size_t kMinRecordCount = 3;
+  for (size_t i = 0; i < kMinRecordCount; ++i) {
+    ASSERT_FALSE(cost_model.IsTinyKernel(kTinyKernel));
+    cost_model.Record(kTinyKernel, kShortTime, kLongTime);
+    cost_model.Record(kHeavyKernel, kLongTime, kShortTime);
+  }
+  ASSERT_TRUE(cost_model.IsTinyKernel(kTinyKernel));
+  ASSERT_FALSE(cost_model.IsTinyKernel(kHeavyKernel));
+  ASSERT_FALSE(cost_model.IsTinyKernel("Default/Unknown-op3"));
+}
+
+/// Feature: Cost model of actor fusion.
+/// Description: Save the records to the cost file and load them by the later running, then disable the cost model.
+/// Expectation: The decision is the same after loading, and no kernel is tiny when the cost model is disabled.
+TEST_F(FusionCostModelTest, SaveAndLoad) {
+  auto &cost_model = FusionCostModel::GetInstance();
+  constexpr size_t kRecordCount = 3;
+  for (size_t i = 0; i < kRecordCount; ++i) {
+    cost_model.Record(kTinyKernel, kShortTime, kLongTime);
+    cost_model.Record(kHeavyKernel, kLongTime, kShortTime);
+  }
+  cost_model.Save();
+
+  cost_model.Initialize(kCostFile);
+  ASSERT_TRUE(cost_model.IsTinyKernel(kTinyKernel));
+  ASSERT_FALSE(cost_model.IsTinyKernel(kHeavyKernel));
+
+  cost_model.Initialize("");
+  ASSERT_FALSE(cost_model.enable());
+  ASSERT_FALSE(cost_model.IsTinyKernel(kTinyKernel));
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -14,12 +14,27 @@
  * limitations under the License.
  */
 
+#include <set>
+#include <string>
+#include <vector>
 #include "common/common_test.h"
 #include "abstract/abstract_function.h"
 #include "runtime/graph_scheduler/scheduler_helper.h"
 
 namespace mindspore {
 namespace runtime {
+namespace {
+class PriorityTestKernelMod : public kernel::KernelMod {
+ public:
+  PriorityTestKernelMod() = default;
+  ~PriorityTestKernelMod() override = default;
+  bool Launch(const std::vector<AddressPtr> &, const std::vector<AddressPtr> &, const std::vector<AddressPtr> &,
+              void *) override {
+    return true;
+  }
+};
+}  // namespace
+
 class SchedulerHelperTest : public UT::Common {
  public:
   SchedulerHelperTest() {}
@@ -59,5 +74,39 @@ TEST_F(SchedulerHelperTest, AddDependency) {
   SchedulerHelper::FuseDataArrowsToBatchDataArrow(fusion_actor.get());
   ASSERT_EQ(0, fusion_actor->batch_output_data_arrows().size());
 }
+
+/// Feature: Critical path priority of actors.
+/// Description: Build the actors a->b->c and d->c, the kernel of d outputs 4KB and the others have no kernel mod.
+/// Expectation: The priority is the cost sum of the longest path to the end, the cost of d is 1 + 4 output units.
+TEST_F(SchedulerHelperTest, SetCriticalPathPriority) {
+  auto memory_manager_actor = std::make_shared<MemoryManagerActor>();
+  auto kernel_graph = std::make_shared<KernelGraph>();
+  std::set<size_t> ref_input_indexes;
+  std::set<size_t> ref_output_indexes;
+  auto actor_set = std::make_shared<ActorSet>("priority_actor_set");
+  std::vector<std::string> actor_names = {"a", "b", "c", "d"};
+  for (const auto &actor_name : actor_names) {
+    std::vector<AnfNodePtr> inputs{NewValueNode(prim::kPrimAdd)};
+    auto kernel = kernel_graph->NewCNode(inputs);
+    MS_EXCEPTION_IF_NULL(kernel);
+    (void)actor_set->kernel_actors_.emplace_back(
+      std::make_shared<KernelActor>(actor_name, kernel, nullptr, memory_manager_actor->GetAID(), nullptr, nullptr,
+                                    GraphExecutionStrategy::kPipeline, ref_input_indexes, ref_output_indexes));
+  }
+  const auto &actors = actor_set->kernel_actors_;
+  auto kernel_mod = std::make_shared<PriorityTestKernelMod>();
+  constexpr size_t kOutputSize = 4096;
+  kernel_mod->SetOutputSizeList({kOutputSize});
+  AnfAlgo::SetKernelMod(kernel_mod, actors[3]->kernel().get());
+
+  SchedulerHelper::AddDataArrow(actors[0].get(), actors[1].get(), 0, 0);
+  SchedulerHelper::AddControlArrow(actors[1].get(), actors[2].get());
+  SchedulerHelper::AddDataArrow(actors[3].get(), actors[2].get(), 0, 0);
+  SchedulerHelper::SetCriticalPathPriority(actor_set.get());
+  ASSERT_EQ(3, actors[0]->priority());
+  ASSERT_EQ(2, actors[1]->priority());
+  ASSERT_EQ(1, actors[2]->priority());
+  ASSERT_EQ(6, actors[3]->priority());
+}
 }  // namespace runtime
 }  // namespace mindspore
@@ -0,0 +1,86 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "common/common_test.h"
+#include "ir/func_graph.h"
+#include "ir/manager.h"
+#include "utils/compile_profiler.h"
+
+namespace mindspore {
+class TestCompileProfiler : public UT::Common {
+ public:
+  TestCompileProfiler() {}
+  void TearDown() override { CompileProfiler::GetInstance().Init("", false); }
+};
+
+namespace {
+std::string ReadProfileFile(const std::string &file) {
+  std::ifstream ifs(file);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  return ss.str();
+}
+
+FuncGraphPtr MakeGraph() {
+  auto func_graph = std::make_shared<FuncGraph>();
+  auto param = func_graph->add_parameter();
+  func_graph->set_output(param);
+  (void)Manage(func_graph, true);
+  return func_graph;
+}
+}  // namespace
+
+/// Feature: CompileProfiler
+/// Description: Record the nested phases and export them as json
+/// Expectation: The records keep the nesting depth and the node number before and after each phase
+TEST_F(TestCompileProfiler, test_export_json) {
+  const std::string file = "./compile_profile_test.json";
+  auto &profiler = CompileProfiler::GetInstance();
+  profiler.Init(file, false);
+  ASSERT_TRUE(profiler.enable());
+  auto func_graph = MakeGraph();
+  auto node_num = func_graph->manager()->all_nodes().size();
+  {
+    CompileProfileScope action_scope("optimize", "action", func_graph);
+    CompileProfileScope pass_scope("opt_a.inline", "opt_pass", [&func_graph]() { return func_graph; });
+  }
+  profiler.Export();
+  auto content = ReadProfileFile(file);
+  ASSERT_NE(content.find("\"name\": \"optimize\", \"category\": \"action\", \"depth\": 0"), std::string::npos);
+  ASSERT_NE(content.find("\"name\": \"opt_a.inline\", \"category\": \"opt_pass\", \"depth\": 1"), std::string::npos);
+  ASSERT_NE(content.find("\"nodes_before\": " + std::to_string(node_num)), std::string::npos);
+  ASSERT_NE(content.find("\"peak_rss_kb\""), std::string::npos);
+}
+
+/// Feature: CompileProfiler
+/// Description: Export the records as a chrome trace
+/// Expectation: The records are the complete events of the trace
+TEST_F(TestCompileProfiler, test_export_trace) {
+  const std::string file = "./compile_profile_test_trace.json";
+  auto &profiler = CompileProfiler::GetInstance();
+  profiler.Init(file, true);
+  {
+    CompileProfileScope pass_scope("hwopt_d_0_cse", "backend_pass", MakeGraph());
+  }
+  profiler.Export();
+  auto content = ReadProfileFile(file);
+  ASSERT_NE(content.find("\"traceEvents\""), std::string::npos);
+  ASSERT_NE(content.find("\"name\": \"hwopt_d_0_cse\", \"cat\": \"backend_pass\", \"ph\": \"X\""), std::string::npos);
+}
+}  // namespace mindspore
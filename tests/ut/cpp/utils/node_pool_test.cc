@@ -0,0 +1,63 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "utils/node_pool.h"
+#include "ir/anf.h"
+#include "ir/func_graph.h"
+
+namespace mindspore {
+class TestNodePool : public UT::Common {
+ public:
+  TestNodePool() {}
+};
+
+/// Feature: NodePool
+/// Description: Create and release the nodes in the node pool, and release them in the other threads
+/// Expectation: The nodes work as the nodes created by std::make_shared, and the blocks are reused
+TEST_F(TestNodePool, test_create_and_release) {
+  constexpr int64_t kNodeNum = 10000;
+  auto func_graph = std::make_shared<FuncGraph>();
+  std::vector<ValueNodePtr> value_nodes;
+  std::vector<CNodePtr> cnodes;
+  for (int64_t i = 0; i < kNodeNum; ++i) {
+    auto value_node = NewValueNode(i);
+    (void)value_nodes.emplace_back(value_node);
+    (void)cnodes.emplace_back(func_graph->NewCNode({value_node}));
+  }
+  for (int64_t i = 0; i < kNodeNum; ++i) {
+    ASSERT_EQ(GetValue<int64_t>(value_nodes[i]->value()), i);
+    ASSERT_EQ(cnodes[i]->input(0), value_nodes[i]);
+    ASSERT_EQ(cnodes[i]->shared_from_base<CNode>(), cnodes[i]);
+  }
+  auto block = NodePool::Allocate(sizeof(int64_t));
+  NodePool::Free(block, sizeof(int64_t));
+  ASSERT_EQ(NodePool::Allocate(sizeof(int64_t)), block);
+  NodePool::Free(block, sizeof(int64_t));
+
+  // Release the nodes in the other thread, and the thread exits with the free blocks.
+  std::thread release_thread([&value_nodes, &cnodes]() {
+    cnodes.clear();
+    value_nodes.clear();
+  });
+  release_thread.join();
+  auto cnode = func_graph->NewCNode({NewValueNode(static_cast<int64_t>(0))});
+  ASSERT_EQ(cnode->size(), 1);
+}
+}  // namespace mindspore